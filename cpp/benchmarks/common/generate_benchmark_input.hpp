@@ -1,13 +1,19 @@
 #pragma once
 
 #include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/table/table.hpp>
+#include <cudf/utilities/bit.hpp>
 
 #include <tests/utilities/column_utilities.hpp>
 #include <tests/utilities/column_wrapper.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
 #include <random>
+#include <string>
 #include <vector>
 
 /**
@@ -19,7 +25,8 @@
  * The distribution of random data is meant to simulate real-world data. For example, numerical
  * values are generated using a normal distribution with a zero mean. Therefore, different column
  * types are filled using different distributions. The distributions are documented in the
- * functions where they are used.
+ * functions where they are used. A `column_profile` overrides the distribution, the cardinality,
+ * the null probability, the run lengths and the string lengths of the generated columns.
  *
  * Currently, the data generation is done on the CPU and the data is then copied to the device
  * memory.
@@ -30,13 +37,44 @@
  *
  * Produces the same random sequence on each run.
  */
-auto& deterministic_engine()
+inline auto& deterministic_engine()
 {
   static unsigned seed = 13377331;
   static std::mt19937 engine{seed};
   return engine;
 }
 
+/**
+ * @brief Distributions of the generated values
+ */
+enum class distribution_id : int8_t {
+  DEFAULT,    ///< Distribution documented for each type
+  UNIFORM,    ///< Uniform in [-scale, scale]
+  NORMAL,     ///< Normal with a zero mean and a standard deviation of scale
+  GEOMETRIC,  ///< Geometric with a mean of scale; only non-negative values
+  ZIPF,       ///< Zipf (exponent 1) frequencies of `cardinality` distinct values
+};
+
+/**
+ * @brief Describes the data of a generated column
+ *
+ * The default profile generates each value independently with the default distribution of the
+ * type, and about one null in every hundred rows.
+ */
+struct column_profile {
+  /// Distribution of the values; of the lengths of the strings for strings columns
+  distribution_id distribution = distribution_id::DEFAULT;
+  /// Number of distinct values drawn uniformly, or by frequency for ZIPF; 0 for no limit. ZIPF
+  /// uses 1000 distinct values when 0.
+  cudf::size_type cardinality = 0;
+  /// Probability of each row to be null; 0 for a column without a null mask
+  double null_probability = 0.01;
+  /// Mean length of the runs of repeated values, as a geometric distribution
+  cudf::size_type avg_run_length = 1;
+  /// Mean length of the strings, in characters
+  cudf::size_type avg_string_length = 16;
+};
+
 /**
  * @brief Type trait for cudf timestamp types.
  */
@@ -62,32 +100,52 @@ constexpr int64_t nanoseconds()
   return ratio::num / ratio::den;
 }
 
+/**
+ * @brief Draws a random number of the distribution `dist` with the given scale
+ *
+ * @param dist Distribution of the number, other than DEFAULT and ZIPF
+ * @param scale Half-width, standard deviation or mean of the distribution
+ */
+inline double random_number(distribution_id dist, double scale)
+{
+  switch (dist) {
+    case distribution_id::UNIFORM:
+      return std::uniform_real_distribution<>{-scale, scale}(deterministic_engine());
+    case distribution_id::GEOMETRIC:
+      return static_cast<double>(
+        std::geometric_distribution<int64_t>{1. / (1. + scale)}(deterministic_engine()));
+    default: return std::normal_distribution<>{0., scale}(deterministic_engine());
+  }
+}
+
 /**
  * @brief Creates an random timestamp
  *
  * Generates 'recent' timestamps. All timstamps are earlier that June 2020. The period between the
- * timestamps and June 2020 has a geometric distribution. Most timestamps are within a few years
- * before 2020.
+ * timestamps and June 2020 has a geometric distribution by default. Most timestamps are within a
+ * few years before 2020.
  *
+ * @param dist Distribution of the period before June 2020
  * @return The random timestamp
  * @tparam T Timestamp type
  */
 template <typename T, std::enable_if_t<is_timestamp<T>::value, int> = 0>
-T random_element()
+T random_element(distribution_id dist)
 {
   // Timestamp for June 2020
   static constexpr int64_t current_ns    = 1591053936l * nanoseconds<cudf::timestamp_s>();
-  static constexpr auto timestamp_spread = 1. / (2 * 365 * 24 * 60 * 60);  // one in two years
+  static constexpr auto timestamp_spread = 2. * 365 * 24 * 60 * 60;  // two years
 
-  // Generate a number of seconds that is 50% likely to be shorter than two years
-  static std::geometric_distribution<int64_t> seconds_gen{timestamp_spread};
+  // Generate a number of seconds that is about 50% likely to be shorter than two years
+  auto const seconds = std::abs(random_number(
+    dist == distribution_id::DEFAULT ? distribution_id::GEOMETRIC : dist, timestamp_spread));
   // Generate a random value for the nanoseconds within a second
   static std::uniform_int_distribution<int64_t> nanoseconds_gen{0,
                                                                 nanoseconds<cudf::timestamp_s>()};
 
   // Subtract the seconds from the 2020 timestamp to generate a reccent timestamp
   auto const timestamp_ns = current_ns -
-                            seconds_gen(deterministic_engine()) * nanoseconds<cudf::timestamp_s>() -
+                            static_cast<int64_t>(seconds) * nanoseconds<cudf::timestamp_s>() -
                             nanoseconds_gen(deterministic_engine());
   // Return value in the type's precision
   return T(timestamp_ns / nanoseconds<T>());
@@ -105,144 +163,256 @@ constexpr auto stddev()
 }
 
 /**
- * @brief Creates an random numeric value with a normal distribution
+ * @brief Creates an random numeric value with a normal distribution by default
  *
  * Zero is always used as the mean for teh distribution. Unsigned types are generated as the
- * absolute value of the normal distribution output.
+ * absolute value of the distribution output.
  * Different standard deviations are used depending on the type size, in order to generate larger
  * range of values for when the types supports it.
  *
+ * @param dist Distribution of the value
  * @return The random number
  * @tparam T Numeric type
  */
 template <typename T, std::enable_if_t<not is_timestamp<T>::value, int> = 0>
-T random_element()
+T random_element(distribution_id dist)
 {
   static constexpr T lower_bound = std::numeric_limits<T>::lowest();
   static constexpr T upper_bound = std::numeric_limits<T>::max();
 
   // Use the type dependent standard deviation
-  static std::normal_distribution<> gaussian{0., stddev<T>()};
-
-  auto elem = gaussian(deterministic_engine());
+  auto elem = random_number(dist, stddev<T>());
   // Use absolute value for unsigned types
-  if (lower_bound >= 0) elem = abs(elem);
+  if (lower_bound >= 0) elem = std::abs(elem);
   elem = std::max(std::min(elem, (double)upper_bound), (double)lower_bound);
 
   return T(elem);
 }
 
 /**
- * @brief Creates an boolean value with 50:50 probability
+ * @brief Creates an boolean value with 50:50 probability, whatever the distribution
  *
  * @return The random boolean value
  */
 template <>
-bool random_element<bool>()
+inline bool random_element<bool>(distribution_id)
 {
   static std::uniform_int_distribution<> uniform{0, 1};
   return uniform(deterministic_engine()) == 1;
 }
 
 /**
- * @brief Creates a column with random content of the given type
+ * @brief Creates a random string whose length has the given distribution
+ *
+ * The lengths have a normal distribution with a deviation of the square root of their mean by
+ * default, which approximates a Poisson distribution. The characters follow a pattern so there
+ * can be many unique strings.
+ *
+ * @param dist Distribution of the length
+ * @param avg_length Mean length of the strings
+ * @return The random string
+ */
+inline std::string random_string(distribution_id dist, cudf::size_type avg_length)
+{
+  double length = 0;
+  switch (dist) {
+    case distribution_id::UNIFORM: length = avg_length + random_number(dist, avg_length); break;
+    case distribution_id::GEOMETRIC: length = random_number(dist, avg_length); break;
+    default: length = avg_length + random_number(distribution_id::NORMAL, std::sqrt(avg_length));
+  }
+
+  static size_t i = 0;
+  std::string elem(static_cast<size_t>(std::max(std::round(length), 0.)), ' ');
+  std::generate(elem.begin(), elem.end(), []() { return 'a' + (i++ % 26); });
+  return elem;
+}
+
+/**
+ * @brief Generates the values of a column of the given profile
+ *
+ * Distinct values are first drawn when the cardinality is limited; each run of rows then uses a
+ * value drawn from them, with Zipf frequencies for ZIPF.
+ *
+ * @param num_rows Number of values to generate
+ * @param profile Profile of the column
+ * @param element Generates a random value of the profile's distribution
+ * @return The values of the rows
+ */
+template <typename T, typename ElementGenerator>
+std::vector<T> random_values(cudf::size_type num_rows,
+                             column_profile const& profile,
+                             ElementGenerator element)
+{
+  auto const is_zipf     = profile.distribution == distribution_id::ZIPF;
+  auto const cardinality = (is_zipf and profile.cardinality == 0) ? 1000 : profile.cardinality;
+
+  // The distinct values of a ZIPF column have the default distribution
+  std::vector<T> distinct_values;
+  std::generate_n(std::back_inserter(distinct_values), cardinality, [&]() {
+    return element(is_zipf ? distribution_id::DEFAULT : profile.distribution);
+  });
+  std::vector<double> weights(cardinality, 1.);
+  if (is_zipf) {
+    for (cudf::size_type k = 0; k < cardinality; ++k) { weights[k] = 1. / (k + 1); }
+  }
+  std::discrete_distribution<cudf::size_type> index_gen(weights.begin(), weights.end());
+  std::geometric_distribution<cudf::size_type> extra_run_length_gen{
+    1. / std::max(profile.avg_run_length, 1)};
+
+  std::vector<T> values;
+  values.reserve(num_rows);
+  while (static_cast<cudf::size_type>(values.size()) < num_rows) {
+    T const value = (cardinality > 0) ? distinct_values[index_gen(deterministic_engine())]
+                                      : element(profile.distribution);
+    auto const run_length =
+      std::min<cudf::size_type>(1 + extra_run_length_gen(deterministic_engine()),
+                                num_rows - values.size());
+    values.insert(values.end(), run_length, value);
+  }
+  return values;
+}
+
+/**
+ * @brief Generates the validity of the rows of a column of the given profile
+ *
+ * @return The validity of each row; empty if the profile has no nulls
+ */
+inline std::vector<bool> random_validity(cudf::size_type num_rows, column_profile const& profile)
+{
+  if (profile.null_probability <= 0) { return {}; }
+  std::bernoulli_distribution null_gen{profile.null_probability};
+  std::vector<bool> valids(num_rows);
+  std::generate(valids.begin(), valids.end(), [&]() { return !null_gen(deterministic_engine()); });
+  return valids;
+}
+
+/**
+ * @brief Creates a column with random content of the given type and profile
  *
  * The templated implementation is used for all fixed width types. String columns are generated
  * using the specialization implemented below.
  *
  * @param[in] col_bytes Size of the generated column, in bytes
- * @param[in] include_validity Whether to include the null mask in the columns
+ * @param[in] profile Profile of the generated data
  *
  * @return Column filled with random data
  */
 template <typename T>
-std::unique_ptr<cudf::column> create_random_column(cudf::size_type col_bytes, bool include_validity)
+std::unique_ptr<cudf::column> create_random_column(cudf::size_type col_bytes,
+                                                   column_profile const& profile)
 {
   const cudf::size_type num_rows = col_bytes / sizeof(T);
 
-  // Every 100th element is invalid
-  // TODO: should this also be random?
-  auto valids = cudf::test::make_counting_transform_iterator(
-    0, [](auto i) { return i % 100 == 0 ? false : true; });
-
-  cudf::test::fixed_width_column_wrapper<T> wrapped_col;
-  auto rand_elements =
-    cudf::test::make_counting_transform_iterator(0, [](auto row) { return random_element<T>(); });
-  if (include_validity) {
-    wrapped_col =
-      cudf::test::fixed_width_column_wrapper<T>(rand_elements, rand_elements + num_rows, valids);
-  } else {
-    wrapped_col =
-      cudf::test::fixed_width_column_wrapper<T>(rand_elements, rand_elements + num_rows);
-  }
-  auto col = wrapped_col.release();
+  auto const values = random_values<T>(
+    num_rows, profile, [](distribution_id dist) { return random_element<T>(dist); });
+  auto const valids = random_validity(num_rows, profile);
+
+  auto col = valids.empty()
+               ? cudf::test::fixed_width_column_wrapper<T>(values.begin(), values.end()).release()
+               : cudf::test::fixed_width_column_wrapper<T>(
+                   values.begin(), values.end(), valids.begin())
+                   .release();
   col->has_nulls();
   return col;
 }
 
 /**
- * @brief Creates a string column with random content
- *
- * Uses a Poisson distribution around the mean string length. The average length of elements is 16
- * and currently there is no way to modify this via parameters.
+ * @brief Creates a string column with random content and the given profile
  *
  * Due to random generation of the length of the columns elements, the resulting column will have a
  * slightly different size from @ref col_bytes.
  *
  * @param[in] col_bytes Size of the generated column, in bytes
- * @param[in] include_validity Whether to include the null mask in the columns
+ * @param[in] profile Profile of the generated data; its distribution is the one of the lengths
  *
  * @return Column filled with random data
  */
 template <>
-std::unique_ptr<cudf::column> create_random_column<std::string>(cudf::size_type col_bytes,
-                                                                bool include_validity)
+inline std::unique_ptr<cudf::column> create_random_column<std::string>(
+  cudf::size_type col_bytes, column_profile const& profile)
 {
-  // TODO: have some elements be null?
-
-  static constexpr int avg_string_len = 16;
-  const cudf::size_type num_rows      = col_bytes / avg_string_len;
+  const cudf::size_type num_rows = col_bytes / std::max(profile.avg_string_length, 1);
 
-  std::poisson_distribution<> dist(avg_string_len);
+  auto const values = random_values<std::string>(num_rows, profile, [&](distribution_id dist) {
+    return random_string(dist, profile.avg_string_length);
+  });
+  auto const valids = random_validity(num_rows, profile);
 
+  std::vector<char> chars;
   std::vector<int32_t> offsets{0};
   offsets.reserve(num_rows + 1);
-  for (int i = 1; i < num_rows; ++i) {
-    offsets.push_back(offsets.back() + dist(deterministic_engine()));
+  std::vector<cudf::bitmask_type> null_mask(valids.empty() ? 0 : cudf::num_bitmask_words(num_rows));
+  cudf::size_type null_count = 0;
+  for (cudf::size_type i = 0; i < num_rows; ++i) {
+    if (valids.empty() or valids[i]) {
+      chars.insert(chars.end(), values[i].begin(), values[i].end());
+      if (not valids.empty()) { cudf::set_bit_unsafe(null_mask.data(), i); }
+    } else {
+      ++null_count;
+    }
+    offsets.push_back(chars.size());
   }
-  auto const char_cnt = offsets.back() + 1;
-  std::vector<char> chars;
-  chars.reserve(char_cnt);
-  // Use a pattern so there can be more unique strings in the column
-  std::generate_n(std::back_inserter(chars), char_cnt, []() {
-    static size_t i = 0;
-    return 'a' + (i++ % 26);
-  });
 
-  return cudf::make_strings_column(chars, offsets);
+  return cudf::make_strings_column(chars, offsets, null_mask, null_count);
 }
 
 /**
- * @brief Creates a table with random content of the given type
+ * @brief Creates a column with random content of the given type
+ *
+ * @param[in] col_bytes Size of the generated column, in bytes
+ * @param[in] include_validity Whether to include the null mask in the columns
+ *
+ * @return Column filled with random data of the default profile, without nulls if
+ * `include_validity` is false
+ */
+template <typename T>
+std::unique_ptr<cudf::column> create_random_column(cudf::size_type col_bytes, bool include_validity)
+{
+  column_profile profile;
+  if (not include_validity) { profile.null_probability = 0; }
+  return create_random_column<T>(col_bytes, profile);
+}
+
+/**
+ * @brief Creates a table with random content of the given type and profile
  *
  * @param[in] num_columns Number of columns in the table
  * @param[in] col_bytes Size of each column, in bytes
- * @param[in] include_validity Whether to include the null mask in the columns
+ * @param[in] profile Profile of the data of each column
  *
  * @return Table filled with random data
  */
 template <typename T>
 std::unique_ptr<cudf::table> create_random_table(cudf::size_type num_columns,
                                                  cudf::size_type col_bytes,
-                                                 bool include_validity)
+                                                 column_profile const& profile)
 {
   return std::make_unique<cudf::table>([&]() {
     std::vector<std::unique_ptr<cudf::column>> columns;
     std::generate_n(std::back_inserter(columns), num_columns, [&]() {
-      return create_random_column<T>(col_bytes, include_validity);
+      return create_random_column<T>(col_bytes, profile);
     });
     return columns;
   }());
 }
 
+/**
+ * @brief Creates a table with random content of the given type
+ *
+ * @param[in] num_columns Number of columns in the table
+ * @param[in] col_bytes Size of each column, in bytes
+ * @param[in] include_validity Whether to include the null mask in the columns
+ *
+ * @return Table filled with random data
+ */
+template <typename T>
+std::unique_ptr<cudf::table> create_random_table(cudf::size_type num_columns,
+                                                 cudf::size_type col_bytes,
+                                                 bool include_validity)
+{
+  column_profile profile;
+  if (not include_validity) { profile.null_probability = 0; }
+  return create_random_table<T>(num_columns, col_bytes, profile);
+}
+
 // TODO: create random mixed table
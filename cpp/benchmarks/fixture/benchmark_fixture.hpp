@@ -15,10 +15,112 @@
  */
 
 #include <benchmark/benchmark.h>
+#include <cudf/utilities/error.hpp>
 #include "rmm/mr/device/cnmem_memory_resource.hpp"
+#include "rmm/mr/device/cuda_memory_resource.hpp"
 #include "rmm/mr/device/default_memory_resource.hpp"
+#include "rmm/mr/device/managed_memory_resource.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
 
 namespace cudf {
+/**
+ * @brief A device memory resource that tracks the peak memory usage of the iterations of a
+ * benchmark
+ *
+ * `cuda_event_timer` starts and ends an iteration; the peak is the largest number of bytes
+ * allocated during an iteration on top of the bytes allocated when it started, e.g., by the
+ * benchmark inputs.
+ */
+class memory_usage_tracker final : public rmm::mr::device_memory_resource {
+ public:
+  explicit memory_usage_tracker(rmm::mr::device_memory_resource* upstream) : upstream_{upstream}
+  {
+  }
+
+  bool supports_streams() const noexcept override { return upstream_->supports_streams(); }
+
+  bool supports_get_mem_info() const noexcept override
+  {
+    return upstream_->supports_get_mem_info();
+  }
+
+  /**
+   * @brief Starts tracking the usage of an iteration
+   */
+  void begin_iteration()
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    baseline_ = current_;
+    peak_     = current_;
+  }
+
+  /**
+   * @brief Ends the tracking of the usage of an iteration
+   */
+  void end_iteration()
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    max_iteration_peak_ = std::max(max_iteration_peak_, peak_ - baseline_);
+  }
+
+  /**
+   * @brief Returns the largest peak usage of the iterations so far, in bytes
+   */
+  std::size_t max_iteration_peak() const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return max_iteration_peak_;
+  }
+
+ private:
+  void* do_allocate(std::size_t bytes, cudaStream_t stream) override
+  {
+    auto const p = upstream_->allocate(bytes, stream);
+    std::lock_guard<std::mutex> lock(mutex_);
+    current_ += bytes;
+    peak_ = std::max(peak_, current_);
+    return p;
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, cudaStream_t stream) override
+  {
+    upstream_->deallocate(p, bytes, stream);
+    std::lock_guard<std::mutex> lock(mutex_);
+    current_ -= bytes;
+  }
+
+  std::pair<std::size_t, std::size_t> do_get_mem_info(cudaStream_t stream) const override
+  {
+    return upstream_->get_mem_info(stream);
+  }
+
+  rmm::mr::device_memory_resource* upstream_;
+  mutable std::mutex mutex_;
+  std::size_t current_{0};
+  std::size_t baseline_{0};
+  std::size_t peak_{0};
+  std::size_t max_iteration_peak_{0};
+};
+
+/**
+ * @brief Creates the memory resource selected by the `CUDF_BENCHMARK_RMM_MODE` environment
+ * variable: "pool" (the default), "cuda" or "managed"
+ */
+inline std::unique_ptr<rmm::mr::device_memory_resource> create_benchmark_memory_resource()
+{
+  auto const env_mode = std::getenv("CUDF_BENCHMARK_RMM_MODE");
+  std::string const mode{env_mode != nullptr ? env_mode : "pool"};
+  if (mode == "cuda") return std::make_unique<rmm::mr::cuda_memory_resource>();
+  if (mode == "pool") return std::make_unique<rmm::mr::cnmem_memory_resource>();
+  if (mode == "managed") return std::make_unique<rmm::mr::managed_memory_resource>();
+  CUDF_FAIL("Invalid CUDF_BENCHMARK_RMM_MODE, expected \"cuda\", \"pool\" or \"managed\"");
+}
+
 /**
  * @brief Google Benchmark fixture for libcudf benchmarks
  *
@@ -31,6 +133,12 @@ namespace cudf {
  * and finalize it, respectively. These methods are called automatically by
  * Google Benchmark
  *
+ * The `CUDF_BENCHMARK_RMM_MODE` environment variable selects another resource to
+ * measure allocator effects: "cuda" or "managed". When the
+ * `CUDF_BENCHMARK_PEAK_MEMORY` environment variable is set, the peak memory
+ * usage of the iterations timed by `cuda_event_timer` is reported in the
+ * `peak_memory_usage` counter, in bytes.
+ *
  * Example:
  *
  * template <class T>
@@ -54,22 +162,35 @@ class benchmark : public ::benchmark::Fixture {
  public:
   virtual void SetUp(const ::benchmark::State& state)
   {
-    auto mr = new rmm::mr::cnmem_memory_resource;
-    rmm::mr::set_default_resource(mr);  // set default resource to cnmem
+    mr = create_benchmark_memory_resource();
+    if (std::getenv("CUDF_BENCHMARK_PEAK_MEMORY") != nullptr) {
+      tracker = std::make_unique<memory_usage_tracker>(mr.get());
+      rmm::mr::set_default_resource(tracker.get());
+    } else {
+      rmm::mr::set_default_resource(mr.get());
+    }
   }
 
   virtual void TearDown(const ::benchmark::State& state)
   {
-    delete rmm::mr::get_default_resource();
     rmm::mr::set_default_resource(nullptr);  // reset default resource to the initial resource
+    tracker.reset();
+    mr.reset();
   }
 
   // eliminate partial override warnings (see benchmark/benchmark.h)
   virtual void SetUp(::benchmark::State& st) { SetUp(const_cast<const ::benchmark::State&>(st)); }
   virtual void TearDown(::benchmark::State& st)
   {
+    if (tracker) {
+      st.counters["peak_memory_usage"] = static_cast<double>(tracker->max_iteration_peak());
+    }
     TearDown(const_cast<const ::benchmark::State&>(st));
   }
+
+ private:
+  std::unique_ptr<rmm::mr::device_memory_resource> mr;
+  std::unique_ptr<memory_usage_tracker> tracker;
 };
 
 };  // namespace cudf
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/groupby.hpp>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+class GroupbyHashSort : public cudf::benchmark {
+};
+
+/**
+ * @brief Times the sum, min, max and count of a column grouped by an integer key
+ *
+ * The hash groupby is used for unsorted keys; the sort groupby is forced by grouping the keys
+ * first, as part of the timed work.
+ */
+void BM_group_aggregations(benchmark::State& state, bool use_sort)
+{
+  cudf::size_type const num_rows    = state.range(0);
+  cudf::size_type const cardinality = state.range(1);
+
+  column_profile key_profile;
+  key_profile.distribution     = distribution_id::UNIFORM;
+  key_profile.cardinality      = cardinality;
+  key_profile.null_probability = 0;
+  auto const keys   = create_random_column<int64_t>(num_rows * sizeof(int64_t), key_profile);
+  auto const values = create_random_column<double>(num_rows * sizeof(double), column_profile{});
+  cudf::table_view const keys_table{{keys->view()}};
+
+  std::vector<cudf::groupby::aggregation_request> requests(1);
+  requests[0].values = values->view();
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation());
+  requests[0].aggregations.push_back(cudf::make_min_aggregation());
+  requests[0].aggregations.push_back(cudf::make_max_aggregation());
+  requests[0].aggregations.push_back(cudf::make_count_aggregation());
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    if (use_sort) {
+      cudf::groupby::groupby gb_obj(cudf::groupby::grouping{keys_table});
+      gb_obj.aggregate(requests);
+    } else {
+      cudf::groupby::groupby gb_obj(keys_table);
+      gb_obj.aggregate(requests);
+    }
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(num_rows) * state.iterations());
+}
+
+static void generate_bench_args(benchmark::internal::Benchmark* b)
+{
+  for (int num_rows : {1 << 20, 1 << 24}) {
+    for (int cardinality : {10, 1000, 100000}) { b->Args({num_rows, cardinality}); }
+  }
+}
+
+BENCHMARK_DEFINE_F(GroupbyHashSort, Hash)(::benchmark::State& state)
+{
+  BM_group_aggregations(state, false);
+}
+
+BENCHMARK_DEFINE_F(GroupbyHashSort, Sort)(::benchmark::State& state)
+{
+  BM_group_aggregations(state, true);
+}
+
+BENCHMARK_REGISTER_F(GroupbyHashSort, Hash)
+  ->Apply(generate_bench_args)
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_REGISTER_F(GroupbyHashSort, Sort)
+  ->Apply(generate_bench_args)
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond);
@@ -17,6 +17,17 @@
 #pragma once
 
 #include <cudf/io/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <arrow/io/api.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 // used to make CUIO_BENCH_ALL_TYPES calls more readable
 constexpr int UNCOMPRESSED = (int)cudf::io::compression_type::NONE;
@@ -41,6 +52,67 @@ constexpr int USE_SNAPPY   = (int)cudf::io::compression_type::SNAPPY;
   benchmark_define(Timestamp_us##_##compression, cudf::timestamp_us, compression);  \
   benchmark_define(Timestamp_ns##_##compression, cudf::timestamp_ns, compression);
 
+// used to make the reader benchmark calls more readable
+constexpr int HOST_BUFFER_SOURCE = 0;
+constexpr int FILE_SOURCE        = 1;
+constexpr int ARROW_FILE_SOURCE  = 2;
+constexpr int ALL_COLUMNS        = 0;
+constexpr int HALF_COLUMNS       = 1;
+
+/**
+ * @brief Exposes the data written by a benchmark as a reader source of the given kind
+ *
+ * File sources are backed by a temporary file, removed on destruction.
+ */
+class cuio_source {
+ public:
+  cuio_source(std::vector<char>&& data, int kind) : _data(std::move(data)), _kind(kind)
+  {
+    if (_kind != HOST_BUFFER_SOURCE) {
+      auto const tmp_dir = std::getenv("TMPDIR");
+      _filepath = std::string{tmp_dir != nullptr ? tmp_dir : "/tmp"} + "/cudf_reader_benchmark";
+      std::ofstream{_filepath, std::ios::binary}.write(_data.data(), _data.size());
+    }
+    if (_kind == ARROW_FILE_SOURCE) {
+      CUDF_EXPECTS(arrow::io::ReadableFile::Open(_filepath).Value(&_arrow_file).ok(),
+                   "Cannot open the benchmark file");
+    }
+  }
+
+  ~cuio_source()
+  {
+    _arrow_file.reset();
+    if (not _filepath.empty()) { std::remove(_filepath.c_str()); }
+  }
+
+  cudf::io::source_info info() const
+  {
+    switch (_kind) {
+      case FILE_SOURCE: return cudf::io::source_info{_filepath};
+      case ARROW_FILE_SOURCE: return cudf::io::source_info{_arrow_file};
+      default: return cudf::io::source_info{_data.data(), _data.size()};
+    }
+  }
+
+  /**
+   * @brief Returns the size of the data in bytes
+   */
+  size_t size() const { return _data.size(); }
+
+ private:
+  std::vector<char> _data;
+  int _kind;
+  std::string _filepath;
+  std::shared_ptr<arrow::io::ReadableFile> _arrow_file;
+};
+
+// registers the source kinds and column selections of a reader benchmark
+#define CUIO_READER_ARGS(compression)                                    \
+  Args({data_size, 64, compression, HOST_BUFFER_SOURCE, ALL_COLUMNS})    \
+    ->Args({data_size, 64, compression, FILE_SOURCE, ALL_COLUMNS})       \
+    ->Args({data_size, 64, compression, ARROW_FILE_SOURCE, ALL_COLUMNS}) \
+    ->Args({data_size, 64, compression, HOST_BUFFER_SOURCE, HALF_COLUMNS})
+
 // sample benchmark define macro that can be passed to the macro above
 #define SAMPLE_BENCHMARK_DEFINE(name, datatype, compression)             \
   BENCHMARK_TEMPLATE_DEFINE_F(SampleFixture, name, datatype)             \
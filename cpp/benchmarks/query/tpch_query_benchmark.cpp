@@ -0,0 +1,411 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/binaryop.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/io/functions.hpp>
+#include <cudf/join.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/profiling.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+/**
+ * @file tpch_query_benchmark.cpp
+ * @brief Benchmarks of queries modeled after TPC-H, written with the public libcudf APIs
+ *
+ * Unlike the benchmarks of single operators, each iteration runs a whole query: filters, joins,
+ * groupbys and sorts chained as an application would, so the allocations of the intermediate
+ * tables and the synchronizations between the operators are measured as well.
+ *
+ * The first argument is the scale factor in hundredths, TPC-H scale factor 1 being 100: it
+ * generates 1.5M orders of 1 to 7 line items each, and 150K customers. The tables are
+ * generated on the host with a fixed seed, only the columns the queries read. When the second
+ * argument is `PARQUET_SOURCE`, the line items are read from a Parquet file in host memory at the
+ * start of each iteration, which adds the handoff from the reader to the operators.
+ *
+ * Besides the end-to-end time of an iteration, the time spent in each libcudf API is reported in
+ * the `<api>_ms` counters, per iteration, as collected by a `cudf::metrics_registry`. It is the
+ * time spent on the host, which includes the device work of the APIs that synchronize, and an
+ * API calling another one is counted in both. Setting `CUDF_BENCHMARK_PEAK_MEMORY` reports the
+ * peak memory usage of the iterations as well.
+ */
+
+namespace {
+constexpr int DEVICE_SOURCE  = 0;
+constexpr int PARQUET_SOURCE = 1;
+
+constexpr cudf::size_type orders_per_scale_factor    = 1500000;
+constexpr cudf::size_type customers_per_scale_factor = 150000;
+
+// Dates are days since the epoch
+constexpr int32_t first_order_date = 8035;   // 1992-01-01
+constexpr int32_t last_order_date  = 10440;  // 1998-08-02
+constexpr int32_t max_ship_delay   = 121;
+
+constexpr int8_t num_market_segments = 5;
+constexpr int8_t num_return_flags    = 3;
+
+enum lineitem_column {
+  L_ORDERKEY,
+  L_QUANTITY,
+  L_EXTENDEDPRICE,
+  L_DISCOUNT,
+  L_SHIPDATE,
+  L_RETURNFLAG
+};
+enum orders_column { O_ORDERKEY, O_CUSTKEY, O_ORDERDATE, O_SHIPPRIORITY };
+enum customer_column { C_CUSTKEY, C_MKTSEGMENT };
+
+struct tpch_tables {
+  std::unique_ptr<cudf::table> lineitem;
+  std::unique_ptr<cudf::table> orders;
+  std::unique_ptr<cudf::table> customer;
+};
+
+template <typename T>
+std::unique_ptr<cudf::column> make_column(std::vector<T> const& values)
+{
+  return cudf::test::fixed_width_column_wrapper<T>(values.begin(), values.end()).release();
+}
+
+/**
+ * @brief Generates the tables of a query benchmark at `scale` hundredths of TPC-H scale factor 1
+ */
+tpch_tables generate_tables(int64_t scale)
+{
+  auto const num_orders    = static_cast<cudf::size_type>(orders_per_scale_factor * scale / 100);
+  auto const num_customers = static_cast<cudf::size_type>(customers_per_scale_factor * scale / 100);
+  auto& engine             = deterministic_engine();
+
+  std::vector<int32_t> c_custkey(num_customers);
+  std::vector<int8_t> c_mktsegment(num_customers);
+  std::uniform_int_distribution<int32_t> segment_dist{0, num_market_segments - 1};
+  for (cudf::size_type i = 0; i < num_customers; ++i) {
+    c_custkey[i]    = i;
+    c_mktsegment[i] = static_cast<int8_t>(segment_dist(engine));
+  }
+
+  std::vector<int32_t> o_orderkey(num_orders);
+  std::vector<int32_t> o_custkey(num_orders);
+  std::vector<int32_t> o_orderdate(num_orders);
+  std::vector<int32_t> o_shippriority(num_orders, 0);
+  std::vector<int32_t> l_orderkey;
+  std::vector<double> l_quantity;
+  std::vector<double> l_extendedprice;
+  std::vector<double> l_discount;
+  std::vector<int32_t> l_shipdate;
+  std::vector<int8_t> l_returnflag;
+  std::uniform_int_distribution<int32_t> customer_dist{0, std::max(num_customers, 1) - 1};
+  std::uniform_int_distribution<int32_t> date_dist{first_order_date, last_order_date};
+  std::uniform_int_distribution<int32_t> lines_dist{1, 7};
+  std::uniform_int_distribution<int32_t> delay_dist{1, max_ship_delay};
+  std::uniform_int_distribution<int32_t> quantity_dist{1, 50};
+  std::uniform_int_distribution<int32_t> discount_dist{0, 10};
+  std::uniform_int_distribution<int32_t> flag_dist{0, num_return_flags - 1};
+  std::uniform_real_distribution<double> price_dist{900., 2000.};
+  for (cudf::size_type i = 0; i < num_orders; ++i) {
+    o_orderkey[i]  = i;
+    o_custkey[i]   = customer_dist(engine);
+    o_orderdate[i] = date_dist(engine);
+    for (auto line = lines_dist(engine); line > 0; --line) {
+      auto const quantity = quantity_dist(engine);
+      l_orderkey.push_back(i);
+      l_quantity.push_back(quantity);
+      l_extendedprice.push_back(quantity * price_dist(engine));
+      l_discount.push_back(discount_dist(engine) / 100.);
+      l_shipdate.push_back(o_orderdate[i] + delay_dist(engine));
+      l_returnflag.push_back(static_cast<int8_t>(flag_dist(engine)));
+    }
+  }
+
+  std::vector<std::unique_ptr<cudf::column>> lineitem;
+  lineitem.push_back(make_column(l_orderkey));
+  lineitem.push_back(make_column(l_quantity));
+  lineitem.push_back(make_column(l_extendedprice));
+  lineitem.push_back(make_column(l_discount));
+  lineitem.push_back(make_column(l_shipdate));
+  lineitem.push_back(make_column(l_returnflag));
+  std::vector<std::unique_ptr<cudf::column>> orders;
+  orders.push_back(make_column(o_orderkey));
+  orders.push_back(make_column(o_custkey));
+  orders.push_back(make_column(o_orderdate));
+  orders.push_back(make_column(o_shippriority));
+  std::vector<std::unique_ptr<cudf::column>> customer;
+  customer.push_back(make_column(c_custkey));
+  customer.push_back(make_column(c_mktsegment));
+  return tpch_tables{std::make_unique<cudf::table>(std::move(lineitem)),
+                     std::make_unique<cudf::table>(std::move(orders)),
+                     std::make_unique<cudf::table>(std::move(customer))};
+}
+
+template <typename T>
+std::unique_ptr<cudf::column> compare(cudf::column_view const& lhs,
+                                      cudf::binary_operator op,
+                                      T value)
+{
+  return cudf::binary_operation(
+    lhs, cudf::numeric_scalar<T>(value), op, cudf::data_type{cudf::type_id::BOOL8});
+}
+
+std::unique_ptr<cudf::column> logical_and(cudf::column_view const& lhs,
+                                          cudf::column_view const& rhs)
+{
+  return cudf::binary_operation(
+    lhs, rhs, cudf::binary_operator::LOGICAL_AND, cudf::data_type{cudf::type_id::BOOL8});
+}
+
+/**
+ * @brief Returns `price * (1 - discount)`
+ */
+std::unique_ptr<cudf::column> discounted_price(cudf::column_view const& price,
+                                               cudf::column_view const& discount)
+{
+  auto const float64   = cudf::data_type{cudf::type_id::FLOAT64};
+  auto const one_minus = cudf::binary_operation(
+    cudf::numeric_scalar<double>(1.), discount, cudf::binary_operator::SUB, float64);
+  return cudf::binary_operation(price, *one_minus, cudf::binary_operator::MUL, float64);
+}
+
+/**
+ * @brief Pricing summary report (TPC-H Q1): aggregates the line items shipped before a date by
+ * return flag
+ */
+std::unique_ptr<cudf::table> pricing_summary(cudf::table_view const& lineitem)
+{
+  constexpr int32_t ship_date_limit = 10471;  // 1998-12-01 - 90 days
+  auto const shipped =
+    compare(lineitem.column(L_SHIPDATE), cudf::binary_operator::LESS_EQUAL, ship_date_limit);
+  auto const items = cudf::apply_boolean_mask(
+    lineitem.select({L_RETURNFLAG, L_QUANTITY, L_EXTENDEDPRICE, L_DISCOUNT}), *shipped);
+  auto const revenue = discounted_price(items->get_column(2), items->get_column(3));
+
+  std::vector<cudf::groupby::aggregation_request> requests(4);
+  requests[0].values = items->get_column(1);
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation());
+  requests[0].aggregations.push_back(cudf::make_mean_aggregation());
+  requests[0].aggregations.push_back(cudf::make_count_aggregation());
+  requests[1].values = items->get_column(2);
+  requests[1].aggregations.push_back(cudf::make_sum_aggregation());
+  requests[2].values = *revenue;
+  requests[2].aggregations.push_back(cudf::make_sum_aggregation());
+  requests[3].values = items->get_column(3);
+  requests[3].aggregations.push_back(cudf::make_mean_aggregation());
+  cudf::groupby::groupby grouper(items->select({0}));
+  auto result = grouper.aggregate(requests);
+
+  auto columns = result.first->release();
+  for (auto& request_result : result.second) {
+    std::move(request_result.results.begin(),
+              request_result.results.end(),
+              std::back_inserter(columns));
+  }
+  cudf::table const summary(std::move(columns));
+  return cudf::sort_by_key(summary.view(), summary.view().select({0}));
+}
+
+/**
+ * @brief Shipping priority (TPC-H Q3): the 10 unshipped orders of a market segment with the
+ * highest revenue
+ */
+std::unique_ptr<cudf::table> shipping_priority(cudf::table_view const& lineitem,
+                                               cudf::table_view const& orders,
+                                               cudf::table_view const& customer)
+{
+  constexpr int8_t market_segment = 1;
+  constexpr int32_t date          = 9204;  // 1995-03-15
+  constexpr cudf::size_type limit = 10;
+
+  auto const in_segment =
+    compare(customer.column(C_MKTSEGMENT), cudf::binary_operator::EQUAL, market_segment);
+  auto const customers = cudf::apply_boolean_mask(customer.select({C_CUSTKEY}), *in_segment);
+  auto const ordered   = compare(orders.column(O_ORDERDATE), cudf::binary_operator::LESS, date);
+  // custkey, orderkey, orderdate, shippriority
+  auto const open_orders = cudf::apply_boolean_mask(
+    orders.select({O_CUSTKEY, O_ORDERKEY, O_ORDERDATE, O_SHIPPRIORITY}), *ordered);
+  auto const customer_orders =
+    cudf::inner_join(customers->view(), open_orders->view(), {0}, {0}, {{0, 0}});
+
+  auto const unshipped = compare(lineitem.column(L_SHIPDATE), cudf::binary_operator::GREATER, date);
+  // orderkey, extendedprice, discount
+  auto const items = cudf::apply_boolean_mask(
+    lineitem.select({L_ORDERKEY, L_EXTENDEDPRICE, L_DISCOUNT}), *unshipped);
+  // orderkey, extendedprice, discount, custkey, orderdate, shippriority
+  auto const order_items =
+    cudf::inner_join(items->view(), customer_orders->view(), {0}, {1}, {{0, 1}});
+  auto const revenue = discounted_price(order_items->get_column(1), order_items->get_column(2));
+
+  std::vector<cudf::groupby::aggregation_request> requests(1);
+  requests[0].values = *revenue;
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation());
+  cudf::groupby::groupby grouper(order_items->select({0, 4, 5}));
+  auto result = grouper.aggregate(requests);
+
+  // orderkey, orderdate, shippriority, revenue
+  auto columns = result.first->release();
+  columns.push_back(std::move(result.second[0].results[0]));
+  cudf::table const order_revenue(std::move(columns));
+  auto const sorted = cudf::sort_by_key(order_revenue.view(),
+                                        order_revenue.view().select({3, 1}),
+                                        {cudf::order::DESCENDING, cudf::order::ASCENDING});
+  auto const num_rows = std::min(limit, sorted->num_rows());
+  return std::make_unique<cudf::table>(cudf::slice(sorted->view(), {0, num_rows})[0]);
+}
+
+/**
+ * @brief Forecasting revenue change (TPC-H Q6): the revenue of the discounts of a year
+ */
+std::unique_ptr<cudf::scalar> forecast_revenue(cudf::table_view const& lineitem)
+{
+  constexpr int32_t year_begin = 8766;  // 1994-01-01
+  constexpr int32_t year_end   = 9131;  // 1995-01-01
+
+  auto const& shipdate      = lineitem.column(L_SHIPDATE);
+  auto const& discount      = lineitem.column(L_DISCOUNT);
+  auto const& quantity      = lineitem.column(L_QUANTITY);
+  auto const after          = compare(shipdate, cudf::binary_operator::GREATER_EQUAL, year_begin);
+  auto const before         = compare(shipdate, cudf::binary_operator::LESS, year_end);
+  auto const min_discount   = compare(discount, cudf::binary_operator::GREATER_EQUAL, 0.05);
+  auto const max_discount   = compare(discount, cudf::binary_operator::LESS_EQUAL, 0.07);
+  auto const small          = compare(quantity, cudf::binary_operator::LESS, 24.);
+  auto const in_year        = logical_and(*after, *before);
+  auto const discount_range = logical_and(*min_discount, *max_discount);
+  // The selection is applied by the reduction, without materializing the selected rows
+  auto const selected = logical_and(*logical_and(*in_year, *discount_range), *small);
+
+  auto const float64 = cudf::data_type{cudf::type_id::FLOAT64};
+  auto const revenue = cudf::binary_operation(
+    lineitem.column(L_EXTENDEDPRICE), discount, cudf::binary_operator::MUL, float64);
+  return cudf::reduce(*revenue, *selected, cudf::make_sum_aggregation(), float64);
+}
+
+/**
+ * @brief Holds the line items of a benchmark, in device memory or in a Parquet file in host
+ * memory read by each iteration
+ */
+class lineitem_source {
+ public:
+  lineitem_source(cudf::table_view const& lineitem, int kind) : _lineitem{lineitem}
+  {
+    if (kind == PARQUET_SOURCE) {
+      cudf::io::write_parquet_args write_args{cudf::io::sink_info(&_buffer), lineitem};
+      cudf::io::write_parquet(write_args);
+    }
+  }
+
+  /**
+   * @brief Returns the line items, reading them if they are in a file
+   */
+  std::unique_ptr<cudf::table> read() const
+  {
+    if (_buffer.empty()) { return nullptr; }
+    cudf::io::read_parquet_args read_args{cudf::io::source_info(_buffer.data(), _buffer.size())};
+    return cudf::io::read_parquet(read_args).tbl;
+  }
+
+  cudf::table_view view(std::unique_ptr<cudf::table> const& read) const
+  {
+    return read != nullptr ? read->view() : _lineitem;
+  }
+
+ private:
+  cudf::table_view _lineitem;
+  std::vector<char> _buffer;
+};
+
+/**
+ * @brief Runs `query(lineitem)` in each iteration and reports the time spent in each API
+ */
+template <typename Query>
+void run_query(benchmark::State& state, cudf::table_view const& lineitem, Query query)
+{
+  lineitem_source const source(lineitem, state.range(1));
+  cudf::metrics_registry registry;
+  cudf::set_profiling_callbacks(&registry);
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    auto const read = source.read();
+    query(source.view(read));
+  }
+  cudf::set_profiling_callbacks(nullptr);
+
+  for (auto const& op : registry.metrics()) {
+    auto const ms = std::chrono::duration<double, std::milli>(op.second.elapsed).count();
+    state.counters[op.first + "_ms"] = ms / state.iterations();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(lineitem.num_rows()) * state.iterations());
+}
+}  // namespace
+
+class TpchQuery : public cudf::benchmark {
+};
+
+BENCHMARK_DEFINE_F(TpchQuery, PricingSummary)(::benchmark::State& state)
+{
+  auto const tables = generate_tables(state.range(0));
+  run_query(state, tables.lineitem->view(), [](cudf::table_view const& lineitem) {
+    pricing_summary(lineitem);
+  });
+}
+
+BENCHMARK_DEFINE_F(TpchQuery, ShippingPriority)(::benchmark::State& state)
+{
+  auto const tables = generate_tables(state.range(0));
+  run_query(state, tables.lineitem->view(), [&tables](cudf::table_view const& lineitem) {
+    shipping_priority(lineitem, tables.orders->view(), tables.customer->view());
+  });
+}
+
+BENCHMARK_DEFINE_F(TpchQuery, ForecastRevenue)(::benchmark::State& state)
+{
+  auto const tables = generate_tables(state.range(0));
+  run_query(state, tables.lineitem->view(), [](cudf::table_view const& lineitem) {
+    forecast_revenue(lineitem);
+  });
+}
+
+#define TPCH_QUERY_BENCHMARK_REGISTER(name) \
+  BENCHMARK_REGISTER_F(TpchQuery, name)     \
+    ->Args({10, DEVICE_SOURCE})             \
+    ->Args({100, DEVICE_SOURCE})            \
+    ->Args({100, PARQUET_SOURCE})           \
+    ->Unit(benchmark::kMillisecond)         \
+    ->UseManualTime();
+
+TPCH_QUERY_BENCHMARK_REGISTER(PricingSummary)
+TPCH_QUERY_BENCHMARK_REGISTER(ShippingPriority)
+TPCH_QUERY_BENCHMARK_REGISTER(ForecastRevenue)
@@ -30,7 +30,9 @@ class Reduction : public cudf::benchmark {
 };
 
 template <typename type>
-void BM_reduction(benchmark::State& state, std::unique_ptr<cudf::aggregation> const& agg)
+void BM_reduction(benchmark::State& state,
+                  std::unique_ptr<cudf::aggregation> const& agg,
+                  bool nullable = false)
 {
   using wrapper = cudf::test::fixed_width_column_wrapper<type>;
   const cudf::size_type column_size{(cudf::size_type)state.range(0)};
@@ -38,7 +40,14 @@ void BM_reduction(benchmark::State& state, std::unique_ptr<cudf::aggregation> co
   cudf::test::UniformRandomGenerator<long> rand_gen(0, 100);
   auto data_it = cudf::test::make_counting_transform_iterator(
     0, [&rand_gen](cudf::size_type row) { return rand_gen.generate(); });
-  wrapper values(data_it, data_it + column_size);
+  // Percentage of null elements, the second argument of the nullable benchmarks
+  auto const null_percent = nullable ? state.range(1) : 0;
+  auto valid_it           = cudf::test::make_counting_transform_iterator(
+    0, [&rand_gen, null_percent](cudf::size_type row) {
+      return rand_gen.generate() >= null_percent;
+    });
+  wrapper values = nullable ? wrapper(data_it, data_it + column_size, valid_it)
+                            : wrapper(data_it, data_it + column_size);
 
   auto input_column = cudf::column_view(values);
   cudf::data_type output_dtype =
@@ -89,3 +98,26 @@ REDUCE_BENCHMARK_DEFINE(timestamp_ms, min);
 REDUCE_BENCHMARK_NUMERIC(mean);
 REDUCE_BENCHMARK_NUMERIC(variance);
 REDUCE_BENCHMARK_NUMERIC(std);
+
+// TYPE, OP, on columns of 10M elements with 1% to 99% nulls
+#define NULLABLE_RBM_BENCHMARK_DEFINE(name, type, aggregation)    \
+  BENCHMARK_DEFINE_F(Reduction, name)(::benchmark::State & state) \
+  {                                                               \
+    BM_reduction<type>(state, get_agg(aggregation), true);        \
+  }                                                               \
+  BENCHMARK_REGISTER_F(Reduction, name)                           \
+    ->UseManualTime()                                             \
+    ->Args({10000000, 1})                                         \
+    ->Args({10000000, 10})                                        \
+    ->Args({10000000, 50})                                        \
+    ->Args({10000000, 90})                                        \
+    ->Args({10000000, 99});
+
+#define NULLABLE_REDUCE_BENCHMARK_DEFINE(type, aggregation) \
+  NULLABLE_RBM_BENCHMARK_DEFINE(concat(type, _nullable_, aggregation), type, aggregation)
+
+NULLABLE_REDUCE_BENCHMARK_DEFINE(int32_t, sum);
+NULLABLE_REDUCE_BENCHMARK_DEFINE(int64_t, sum);
+NULLABLE_REDUCE_BENCHMARK_DEFINE(double, sum);
+NULLABLE_REDUCE_BENCHMARK_DEFINE(int32_t, min);
+NULLABLE_REDUCE_BENCHMARK_DEFINE(double, mean);
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/rolling.hpp>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+class Rolling : public cudf::benchmark {
+};
+
+template <typename T>
+void BM_rolling(benchmark::State& state, std::unique_ptr<cudf::aggregation> const& agg)
+{
+  cudf::size_type const num_rows    = state.range(0);
+  cudf::size_type const window_size = state.range(1);
+
+  auto const input = create_random_column<T>(num_rows * sizeof(T), column_profile{});
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf::rolling_window(input->view(), window_size, 0, 1, agg);
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(num_rows) * state.iterations());
+}
+
+#define ROLLING_BENCHMARK_DEFINE(name, type, aggregation)       \
+  BENCHMARK_DEFINE_F(Rolling, name)(::benchmark::State & state) \
+  {                                                             \
+    BM_rolling<type>(state, aggregation);                       \
+  }                                                             \
+  BENCHMARK_REGISTER_F(Rolling, name)                           \
+    ->Args({1 << 24, 2})                                        \
+    ->Args({1 << 24, 16})                                       \
+    ->Args({1 << 24, 256})                                      \
+    ->UseManualTime()                                           \
+    ->Unit(benchmark::kMillisecond);
+
+ROLLING_BENCHMARK_DEFINE(sum_int32, int32_t, cudf::make_sum_aggregation())
+ROLLING_BENCHMARK_DEFINE(sum_double, double, cudf::make_sum_aggregation())
+ROLLING_BENCHMARK_DEFINE(min_double, double, cudf::make_min_aggregation())
+ROLLING_BENCHMARK_DEFINE(count_int32, int32_t, cudf::make_count_aggregation())
+ROLLING_BENCHMARK_DEFINE(mean_double, double, cudf::make_mean_aggregation())
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/sorting.hpp>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+class Sort : public cudf::benchmark {
+};
+
+template <typename T>
+void BM_sorted_order(benchmark::State& state, bool stable)
+{
+  cudf::size_type const num_rows = state.range(0);
+  cudf::size_type const num_keys = state.range(1);
+  bool const nulls               = state.range(2) != 0;
+
+  auto const keys = create_random_table<T>(num_keys, num_rows * sizeof(T), nulls);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    if (stable) {
+      cudf::stable_sorted_order(keys->view());
+    } else {
+      cudf::sorted_order(keys->view());
+    }
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(num_rows) * state.iterations());
+}
+
+static void generate_bench_args(benchmark::internal::Benchmark* b)
+{
+  for (int num_keys : {1, 2, 4, 8}) {
+    for (int nulls : {0, 1}) { b->Args({1 << 24, num_keys, nulls}); }
+  }
+}
+
+#define SORT_BENCHMARK_DEFINE(name, type, stable)            \
+  BENCHMARK_DEFINE_F(Sort, name)(::benchmark::State & state) \
+  {                                                          \
+    BM_sorted_order<type>(state, stable);                    \
+  }                                                          \
+  BENCHMARK_REGISTER_F(Sort, name)                           \
+    ->Apply(generate_bench_args)                             \
+    ->UseManualTime()                                        \
+    ->Unit(benchmark::kMillisecond);
+
+SORT_BENCHMARK_DEFINE(sorted_order_int32, int32_t, false)
+SORT_BENCHMARK_DEFINE(sorted_order_double, double, false)
+SORT_BENCHMARK_DEFINE(stable_sorted_order_int32, int32_t, true)
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/stream_compaction.hpp>
+
+#include <string>
+#include <type_traits>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+class DropDuplicates : public cudf::benchmark {
+};
+
+template <typename T>
+void BM_drop_duplicates(benchmark::State& state)
+{
+  cudf::size_type const num_rows    = state.range(0);
+  cudf::size_type const cardinality = state.range(1);
+
+  column_profile profile;
+  profile.distribution = distribution_id::UNIFORM;
+  profile.cardinality  = cardinality;
+  // strings have the default average length of the profile
+  cudf::size_type const row_bytes =
+    std::is_same<T, std::string>::value ? profile.avg_string_length : sizeof(T);
+  auto const input = create_random_table<T>(1, num_rows * row_bytes, profile);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf::drop_duplicates(input->view(), {0}, cudf::duplicate_keep_option::KEEP_FIRST);
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(num_rows) * state.iterations());
+}
+
+#define DROP_DUPLICATES_BENCHMARK_DEFINE(name, type)                   \
+  BENCHMARK_DEFINE_F(DropDuplicates, name)(::benchmark::State & state) \
+  {                                                                    \
+    BM_drop_duplicates<type>(state);                                   \
+  }                                                                    \
+  BENCHMARK_REGISTER_F(DropDuplicates, name)                           \
+    ->Args({1 << 24, 100})                                             \
+    ->Args({1 << 24, 100000})                                          \
+    ->Args({1 << 24, 0})                                               \
+    ->UseManualTime()                                                  \
+    ->Unit(benchmark::kMillisecond);
+
+DROP_DUPLICATES_BENCHMARK_DEFINE(int32, int32_t)
+DROP_DUPLICATES_BENCHMARK_DEFINE(int64, int64_t)
+DROP_DUPLICATES_BENCHMARK_DEFINE(string, std::string)
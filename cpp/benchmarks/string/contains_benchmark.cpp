@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/strings/contains.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <array>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+class StringContains : public cudf::benchmark {
+};
+
+// patterns of increasing complexity, for the alphabetic strings of the generator
+std::array<char const*, 3> const patterns{"abc", "[a-e]+f", "(ab|xy)+[c-f]{2,3}z?g"};
+
+void BM_contains_re(benchmark::State& state)
+{
+  cudf::size_type const num_rows   = state.range(0);
+  cudf::size_type const str_length = state.range(1);
+  auto const pattern               = patterns[state.range(2)];
+
+  column_profile profile;
+  profile.avg_string_length = str_length;
+  auto const strings        = create_random_column<std::string>(num_rows * str_length, profile);
+  cudf::strings_column_view const input(strings->view());
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf::strings::contains_re(input, pattern);
+  }
+
+  state.SetBytesProcessed(input.chars_size() * state.iterations());
+}
+
+static void generate_bench_args(benchmark::internal::Benchmark* b)
+{
+  for (int str_length : {8, 32, 128}) {
+    for (int pattern = 0; pattern < static_cast<int>(patterns.size()); ++pattern) {
+      b->Args({1 << 20, str_length, pattern});
+    }
+  }
+}
+
+BENCHMARK_DEFINE_F(StringContains, ContainsRe)(::benchmark::State& state) { BM_contains_re(state); }
+
+BENCHMARK_REGISTER_F(StringContains, ContainsRe)
+  ->Apply(generate_bench_args)
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/strings/convert/convert_integers.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+class StringConvertIntegers : public cudf::benchmark {
+};
+
+template <typename T>
+void BM_convert_integers(benchmark::State& state, bool from_integers)
+{
+  cudf::size_type const num_rows = state.range(0);
+
+  auto const integers = create_random_column<T>(num_rows * sizeof(T), column_profile{});
+  auto const strings  = cudf::strings::from_integers(integers->view());
+  cudf::strings_column_view const input(strings->view());
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    if (from_integers) {
+      cudf::strings::from_integers(integers->view());
+    } else {
+      cudf::strings::to_integers(input, integers->type());
+    }
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(num_rows) * state.iterations());
+}
+
+#define CONVERT_INTEGERS_BENCHMARK_DEFINE(name, type, from_integers)          \
+  BENCHMARK_DEFINE_F(StringConvertIntegers, name)(::benchmark::State & state) \
+  {                                                                           \
+    BM_convert_integers<type>(state, from_integers);                          \
+  }                                                                           \
+  BENCHMARK_REGISTER_F(StringConvertIntegers, name)                           \
+    ->Arg(1 << 20)                                                            \
+    ->Arg(1 << 24)                                                            \
+    ->UseManualTime()                                                         \
+    ->Unit(benchmark::kMillisecond);
+
+CONVERT_INTEGERS_BENCHMARK_DEFINE(to_int32, int32_t, false)
+CONVERT_INTEGERS_BENCHMARK_DEFINE(to_int64, int64_t, false)
+CONVERT_INTEGERS_BENCHMARK_DEFINE(from_int32, int32_t, true)
+CONVERT_INTEGERS_BENCHMARK_DEFINE(from_int64, int64_t, true)
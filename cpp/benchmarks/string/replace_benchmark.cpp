@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/replace.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+class StringReplace : public cudf::benchmark {
+};
+
+void BM_replace(benchmark::State& state)
+{
+  cudf::size_type const num_rows   = state.range(0);
+  cudf::size_type const str_length = state.range(1);
+  // replacements of the same size, shorter and longer than the target
+  std::string const repl(state.range(2), 'X');
+
+  column_profile profile;
+  profile.avg_string_length = str_length;
+  auto const strings        = create_random_column<std::string>(num_rows * str_length, profile);
+  cudf::strings_column_view const input(strings->view());
+  cudf::string_scalar const target("abc");
+  cudf::string_scalar const replacement(repl);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf::strings::replace(input, target, replacement);
+  }
+
+  state.SetBytesProcessed(input.chars_size() * state.iterations());
+}
+
+static void generate_bench_args(benchmark::internal::Benchmark* b)
+{
+  for (int str_length : {8, 32, 128}) {
+    for (int repl_length : {1, 3, 8}) { b->Args({1 << 20, str_length, repl_length}); }
+  }
+}
+
+BENCHMARK_DEFINE_F(StringReplace, Replace)(::benchmark::State& state) { BM_replace(state); }
+
+BENCHMARK_REGISTER_F(StringReplace, Replace)
+  ->Apply(generate_bench_args)
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/split/split.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+class StringSplit : public cudf::benchmark {
+};
+
+void BM_split(benchmark::State& state)
+{
+  cudf::size_type const num_rows   = state.range(0);
+  cudf::size_type const str_length = state.range(1);
+
+  column_profile profile;
+  profile.avg_string_length = str_length;
+  auto const strings        = create_random_column<std::string>(num_rows * str_length, profile);
+  cudf::strings_column_view const input(strings->view());
+  // one in 26 characters of the generated strings
+  cudf::string_scalar const delimiter("a");
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf::strings::split(input, delimiter);
+  }
+
+  state.SetBytesProcessed(input.chars_size() * state.iterations());
+}
+
+BENCHMARK_DEFINE_F(StringSplit, Split)(::benchmark::State& state) { BM_split(state); }
+
+BENCHMARK_REGISTER_F(StringSplit, Split)
+  ->Args({1 << 20, 8})
+  ->Args({1 << 20, 32})
+  ->Args({1 << 20, 128})
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond);
@@ -16,6 +16,8 @@
 
 #include "synchronization.hpp"
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/nvtx_utils.hpp>
+#include <fixture/benchmark_fixture.hpp>
 
 #include <rmm/device_buffer.hpp>
 
@@ -39,6 +41,10 @@ cuda_event_timer::cuda_event_timer(benchmark::State& state,
     }
   }
 
+  cudf::nvtx::range_push("benchmark_iteration", cudf::nvtx::color::ORANGE);
+  tracker = dynamic_cast<cudf::memory_usage_tracker*>(rmm::mr::get_default_resource());
+  if (tracker != nullptr) { tracker->begin_iteration(); }
+
   CUDA_TRY(cudaEventCreate(&start));
   CUDA_TRY(cudaEventCreate(&stop));
   CUDA_TRY(cudaEventRecord(start, stream));
@@ -54,4 +60,7 @@ cuda_event_timer::~cuda_event_timer()
   p_state->SetIterationTime(milliseconds / (1000.0f));
   CUDA_TRY(cudaEventDestroy(start));
   CUDA_TRY(cudaEventDestroy(stop));
+
+  if (tracker != nullptr) { tracker->end_iteration(); }
+  cudf::nvtx::range_pop();
 }
@@ -65,12 +65,19 @@
 
 #include <driver_types.h>
 
+namespace cudf {
+class memory_usage_tracker;
+}
+
 class cuda_event_timer {
  public:
   /**
    * @brief This c'tor clears the L2$ by cudaMemset'ing a buffer of L2$ size
    * and starts the timer.
    *
+   * The iteration is annotated with a "benchmark_iteration" NVTX range and,
+   * when the fixture tracks the memory usage, starts a tracked iteration.
+   *
    * @param[in,out] state  This is the benchmark::State whose timer we are going
    * to update.
    * @param[in] flush_l2_cache_ whether or not to flush the L2 cache before
@@ -93,6 +100,7 @@ class cuda_event_timer {
   cudaEvent_t stop;
   cudaStream_t stream;
   benchmark::State* p_state;
+  cudf::memory_usage_tracker* tracker;
 };
 
 #endif
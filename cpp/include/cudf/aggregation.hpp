@@ -67,8 +67,15 @@ class aggregation {
     ARGMAX,          ///< Index of max element
     ARGMIN,          ///< Index of min element
     NUNIQUE,         ///< count number of unique elements
+    APPROX_NUNIQUE,  ///< approximate count of unique elements
     NTH_ELEMENT,     ///< get the nth element
     ROW_NUMBER,      ///< get row-number of element
+    LEAD,            ///< window function, accesses row at specified offset following current row
+    LAG,             ///< window function, accesses row at specified offset preceding current row
+    RANK,            ///< window function, rank of the row within its group, with gaps
+    DENSE_RANK,      ///< window function, rank of the row within its group, without gaps
+    COLLECT_LIST,    ///< collect the values of each group into a list
+    COLLECT_SET,     ///< collect the distinct values of each group into a list
     PTX,             ///< PTX UDF based reduction
     CUDA             ///< CUDA UDf based reduction
   };
@@ -173,6 +180,23 @@ std::unique_ptr<aggregation> make_argmin_aggregation();
 std::unique_ptr<aggregation> make_nunique_aggregation(
   null_policy null_handling = null_policy::EXCLUDE);
 
+/**
+ * @brief Factory to create an `approx_nunique` aggregation
+ *
+ * `approx_nunique` returns an estimate of the number of unique elements computed with a
+ * HyperLogLog sketch of `2^precision` registers in a single hash pass, without sorting. The
+ * relative standard error of the estimate is about `1.04 / sqrt(2^precision)`, i.e. 1.6% for the
+ * default precision.
+ *
+ * Only reductions support `approx_nunique`. The sketch itself is available through
+ * `make_distinct_count_sketch`, and sketches of separate columns merge.
+ *
+ * @param precision Number of bits of the hash value indexing the sketch registers, in `[4, 18]`.
+ * @param null_handling Indicates if null values will be counted.
+ */
+std::unique_ptr<aggregation> make_approx_nunique_aggregation(
+  int precision = 12, null_policy null_handling = null_policy::EXCLUDE);
+
 /**
  * @brief Factory to create a `nth_element` aggregation
  *
@@ -192,6 +216,66 @@ std::unique_ptr<aggregation> make_nth_element_aggregation(
 /// Factory to create a ROW_NUMBER aggregation
 std::unique_ptr<aggregation> make_row_number_aggregation();
 
+/**
+ * @brief Factory to create a LEAD aggregation
+ *
+ * In a rolling window, `lead` returns the element `offset` rows after the current row, or null
+ * when that row is not in the window of the current row.
+ *
+ * @param offset Number of rows after the current row
+ */
+std::unique_ptr<aggregation> make_lead_aggregation(size_type offset);
+
+/**
+ * @brief Factory to create a LAG aggregation
+ *
+ * In a rolling window, `lag` returns the element `offset` rows before the current row, or null
+ * when that row is not in the window of the current row.
+ *
+ * @param offset Number of rows before the current row
+ */
+std::unique_ptr<aggregation> make_lag_aggregation(size_type offset);
+
+/**
+ * @brief Factory to create a RANK aggregation
+ *
+ * In a rolling window, `rank` returns the `INT32` rank of each row within its group, whose rows
+ * are sorted by the input column: one plus the number of rows of the group before the first row
+ * equal to it. Equal rows have the same rank, and leave a gap in the ranks after them.
+ */
+std::unique_ptr<aggregation> make_rank_aggregation();
+
+/**
+ * @brief Factory to create a DENSE_RANK aggregation
+ *
+ * Same as `make_rank_aggregation`, except that the ranks have no gaps: the rank of a row is the
+ * number of distinct values of the group up to it.
+ */
+std::unique_ptr<aggregation> make_dense_rank_aggregation();
+
+/**
+ * @brief Factory to create a COLLECT_LIST aggregation
+ *
+ * `collect_list` returns a `LIST` column with one row per group, the list of the values of the
+ * group in their input order. The values must be fixed-width or strings.
+ *
+ * @param null_handling Indicates whether null values are included in the lists
+ */
+std::unique_ptr<aggregation> make_collect_list_aggregation(
+  null_policy null_handling = null_policy::INCLUDE);
+
+/**
+ * @brief Factory to create a COLLECT_SET aggregation
+ *
+ * `collect_set` returns a `LIST` column with one row per group, the list of the distinct values
+ * of the group in ascending order, nulls last. Null values are equal to each other, so a list
+ * holds at most one null. The values must be fixed-width or strings.
+ *
+ * @param null_handling Indicates whether a null value is included in the lists
+ */
+std::unique_ptr<aggregation> make_collect_set_aggregation(
+  null_policy null_handling = null_policy::INCLUDE);
+
 /**
  * @brief Factory to create an aggregation base on UDF for PTX or CUDA
  *
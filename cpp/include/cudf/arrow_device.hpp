@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/table/table_view.hpp>
+
+#include <cstdint>
+
+// Structures of the Arrow C data interface, as defined by its specification
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema {
+  const char* format;
+  const char* name;
+  const char* metadata;
+  int64_t flags;
+  int64_t n_children;
+  struct ArrowSchema** children;
+  struct ArrowSchema* dictionary;
+  void (*release)(struct ArrowSchema*);
+  void* private_data;
+};
+
+struct ArrowArray {
+  int64_t length;
+  int64_t null_count;
+  int64_t offset;
+  int64_t n_buffers;
+  int64_t n_children;
+  const void** buffers;
+  struct ArrowArray** children;
+  struct ArrowArray* dictionary;
+  void (*release)(struct ArrowArray*);
+  void* private_data;
+};
+
+#endif  // ARROW_C_DATA_INTERFACE
+
+// Structures of the Arrow C device data interface, as defined by its specification
+#ifndef ARROW_C_DEVICE_DATA_INTERFACE
+#define ARROW_C_DEVICE_DATA_INTERFACE
+
+typedef int32_t ArrowDeviceType;
+
+#define ARROW_DEVICE_CPU 1
+#define ARROW_DEVICE_CUDA 2
+#define ARROW_DEVICE_CUDA_HOST 3
+
+struct ArrowDeviceArray {
+  struct ArrowArray array;
+  int64_t device_id;
+  ArrowDeviceType device_type;
+  void* sync_event;
+  int64_t reserved[3];
+};
+
+#endif  // ARROW_C_DEVICE_DATA_INTERFACE
+
+namespace cudf {
+/**
+ * @addtogroup interop_arrow
+ * @{
+ */
+
+/**
+ * @brief Exports a table in the Arrow C device data interface format without copying its data
+ *
+ * The table is exported as a struct array with a child array per column. The children point
+ * directly at the device buffers of the columns: the data, the validity bitmaps, the offsets and
+ * characters of strings columns and the offsets of list columns. Only the host structures
+ * describing them are allocated. The `release` callbacks of `out_schema` and `out_array->array`
+ * must be called to free those structures.
+ *
+ * The exported arrays do not own the device memory: the data viewed by `input` must outlive
+ * them. `sync_event` is null, so the data must be ready (e.g., the stream that produced it is
+ * synchronized) before it is used from another stream.
+ *
+ * Supported types are the integer and floating point types, `TIMESTAMP_DAYS` as a date32, the
+ * other timestamps and the durations but `DURATION_DAYS`, `STRING` and `LIST`.
+ *
+ * @throw cudf::logic_error if a column type has no Arrow layout matching its cudf layout
+ *
+ * @param input The table to export
+ * @param[out] out_schema The schema of the exported struct array
+ * @param[out] out_array The exported struct array, on the current device
+ */
+void to_arrow_device(table_view const& input,
+                     ArrowSchema* out_schema,
+                     ArrowDeviceArray* out_array);
+
+/**
+ * @brief Views an Arrow struct array in the Arrow C device data interface format as a table
+ * without copying its data
+ *
+ * Each child of the struct array becomes a column of the table viewing the child's device
+ * buffers. The arrays are not released and must outlive the returned table_view. The data must
+ * be ready to be used on the default stream.
+ *
+ * The types supported are those exported by `to_arrow_device`.
+ *
+ * @throw cudf::logic_error if the array is not in CUDA device memory, is not a struct array
+ * without nulls, or has a child of an unsupported type
+ *
+ * @param schema The schema of the struct array
+ * @param input The struct array to view
+ * @return A table_view of the children of `input`
+ */
+table_view from_arrow_device(ArrowSchema const* schema, ArrowDeviceArray const* input);
+
+/** @} */  // end of group
+}  // namespace cudf
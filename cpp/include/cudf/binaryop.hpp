@@ -83,6 +83,10 @@ enum class binary_operator : int32_t {
  * Regardless of the operator, the validity of the output value is the logical
  * AND of the validity of the two operands
  *
+ * A DICTIONARY32 column is compared with a scalar of its keys type through its indices:
+ * the scalar is located once in the sorted keys. Only the comparison operators are
+ * supported for dictionary columns.
+ *
  * @param lhs         The left operand scalar
  * @param rhs         The right operand column
  * @param output_type The desired data type of the output column
@@ -108,6 +112,10 @@ std::unique_ptr<column> binary_operation(
  * Regardless of the operator, the validity of the output value is the logical
  * AND of the validity of the two operands
  *
+ * A DICTIONARY32 column is compared with a scalar of its keys type through its indices:
+ * the scalar is located once in the sorted keys. Only the comparison operators are
+ * supported for dictionary columns.
+ *
  * @param lhs         The left operand column
  * @param rhs         The right operand scalar
  * @param output_type The desired data type of the output column
@@ -131,6 +139,10 @@ std::unique_ptr<column> binary_operation(
  * Regardless of the operator, the validity of the output value is the logical
  * AND of the validity of the two operands
  *
+ * Two DICTIONARY32 columns are compared through their indices, after matching their keys
+ * if they do not share the same keys. Only the comparison operators are supported for
+ * dictionary columns.
+ *
  * @param lhs         The left operand column
  * @param rhs         The right operand column
  * @param output_type The desired data type of the output column
@@ -28,11 +28,28 @@
 
 namespace cudf {
 
+class scalar;
+
 /**
  * @ingroup column_classes Column
  * @{
  */
 
+/**
+ * @brief Statistics of the non-null values of a `column`, used to plan operations without
+ * reading the values
+ *
+ * Each statistic is unknown until recorded, e.g. by a reader from the statistics of the file, or
+ * computed by `column::compute_statistics()`. `min` and `max` are bounds: no value is smaller than
+ * `min` or greater than `max`. They are the smallest and greatest values when computed, and may be
+ * looser when recorded. A bound is an invalid scalar when the column has no non-null value.
+ */
+struct column_statistics {
+  std::shared_ptr<scalar const> min{};  ///< Lower bound of the values; null if unknown
+  std::shared_ptr<scalar const> max{};  ///< Upper bound of the values; null if unknown
+  size_type distinct_count{-1};         ///< Estimated number of distinct values; -1 if unknown
+};
+
 class column {
  public:
   column()        = default;
@@ -199,6 +216,35 @@ class column {
    */
   bool nullable() const noexcept { return (_null_mask.size() > 0); }
 
+  /**
+   * @brief Returns the statistics of the values known without reading them.
+   *
+   * The statistics are cleared whenever the values may change: by `mutable_view()`,
+   * `set_null_mask()`, the non-const `child()` and `release()`.
+   */
+  column_statistics const& statistics() const noexcept { return _statistics; }
+
+  /**
+   * @brief Records statistics of the values, e.g. read from the statistics of a file.
+   *
+   * The statistics are not checked against the values.
+   *
+   * @param statistics The statistics of the values
+   */
+  void set_statistics(column_statistics statistics) { _statistics = std::move(statistics); }
+
+  /**
+   * @brief Computes the statistics of the values that are unknown, and caches them.
+   *
+   * `min` and `max` are computed by `min` and `max` reductions, and `distinct_count` is estimated
+   * from a HyperLogLog sketch of the values, in a single hash pass. Statistics of columns of nested
+   * or dictionary types are left unknown.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @return The statistics of the values
+   */
+  column_statistics const& compute_statistics(cudaStream_t stream = 0) const;
+
   /**
    * @brief Indicates whether the column contains null elements.
    *
@@ -218,7 +264,11 @@ class column {
    * @param child_index Index of the desired child
    * @return column& Reference to the desired child
    */
-  column& child(size_type child_index) noexcept { return *_children[child_index]; };
+  column& child(size_type child_index) noexcept
+  {
+    _statistics = {};
+    return *_children[child_index];
+  };
 
   /**
    * @brief Returns a const reference to the specified child
@@ -314,6 +364,7 @@ class column {
   mutable size_type _null_count{UNKNOWN_NULL_COUNT};  ///< The number of null elements
   std::vector<std::unique_ptr<column>> _children{};   ///< Depending on element type, child
                                                       ///< columns may contain additional data
+  mutable column_statistics _statistics{};            ///< Statistics of the values known so far
 };
 
 /** @} */  // end of group
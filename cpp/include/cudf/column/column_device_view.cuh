@@ -367,6 +367,11 @@ class alignas(16) column_device_view : public detail::column_device_view_base {
    *
    * If `source_view.num_children() == 0`, then no device memory is allocated.
    *
+   * The children are staged in pinned memory and copied ordered on `stream`
+   * without synchronizing it, so the view is ready for kernels launched on
+   * `stream`. On the default stream, views of the same columns created recently
+   * by the same thread share the device copy of their children.
+   *
    * Returns a `std::unique_ptr<column_device_view>` with a custom deleter to
    * free the device memory allocated for the children.
    *
@@ -458,6 +463,9 @@ class alignas(16) mutable_column_device_view : public detail::column_device_view
    *
    * If `source_view.num_children() == 0`, then no device memory is allocated.
    *
+   * The copy of the children is ordered on `stream` and does not synchronize it,
+   * so the view is ready for kernels launched on `stream`.
+   *
    * Returns a `std::unique_ptr<mutable_column_device_view>` with a custom
    * deleter to free the device memory allocated for the children.
    *
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <memory>
+
+/**
+ * @file compressed_column.hpp
+ * @brief Compressed storage of integer columns resident in device memory
+ */
+
+namespace cudf {
+/**
+ * @brief Device-resident compressed copy of an integer or timestamp column.
+ *
+ * The values are compressed in blocks of `values_per_block` consecutive rows. Each block is
+ * encoded as the offsets of its values from the block's minimum (frame of reference) or, when
+ * narrower, as the offsets of the differences between consecutive values from their minimum
+ * (delta), bit-packed to the fewest bits holding the largest offset. A block of a repeated
+ * value packs to zero bits, and sorted or clustered values to a few bits each. The null mask is
+ * kept as is.
+ *
+ * The column is decompressed explicitly with `decompress_column`, or only at the rows of a
+ * gather map with `decompress_rows`.
+ */
+struct compressed_column {
+  static constexpr size_type values_per_block = 1024;
+
+  data_type type{type_id::EMPTY};  ///< Type of the decompressed column
+  size_type size       = 0;        ///< Number of rows
+  size_type null_count = 0;        ///< Number of null rows
+  rmm::device_buffer null_mask;    ///< Null mask of the rows; empty if not nullable
+  rmm::device_buffer blocks;       ///< Encoding of each block of values
+  rmm::device_buffer data;         ///< Bit-packed values of all the blocks
+
+  /**
+   * @brief Returns the device memory held, in bytes.
+   */
+  std::size_t compressed_size() const { return null_mask.size() + blocks.size() + data.size(); }
+};
+
+/**
+ * @brief Compresses an integer or timestamp column into device memory.
+ *
+ * @throw cudf::logic_error if the column is not of an integral, boolean or timestamp type
+ *
+ * @param input Column to compress.
+ * @param mr Device memory resource used to allocate the compressed column's device memory.
+ * @return The compressed column.
+ */
+std::unique_ptr<compressed_column> compress_column(
+  column_view const& input, rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Decompresses all the rows of a compressed column.
+ *
+ * @param input Compressed column.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return The decompressed column, equal to the column that was compressed.
+ */
+std::unique_ptr<column> decompress_column(
+  compressed_column const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Decompresses the rows of a compressed column at the indices of a gather map.
+ *
+ * Only the values gathered are decoded, and the delta blocks they are in, once each.
+ *
+ * @throw cudf::logic_error if `gather_map` is not of type INT32 or has nulls
+ * @throw cudf::logic_error if an index of `gather_map` is out of bounds
+ *
+ * @param input Compressed column.
+ * @param gather_map Indices of the rows to decompress, in [0, input.size).
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return Column of the rows of `input` at the indices of `gather_map`.
+ */
+std::unique_ptr<column> decompress_rows(
+  compressed_column const& input,
+  column_view const& gather_map,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+}  // namespace cudf
@@ -16,11 +16,14 @@
 
 #pragma once
 
+#include <cudf/aggregation.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
 
+#include <cstring>
 #include <memory>
 #include <vector>
 
@@ -57,13 +60,15 @@ namespace cudf {
  * @param[in] check_bounds Optionally perform bounds checking on the values
  * of `gather_map` and throw an error if any of its values are out of bounds.
  * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  * @return std::unique_ptr<table> Result of the gather
  */
 std::unique_ptr<table> gather(
   table_view const& source_table,
   column_view const& gather_map,
   bool check_bounds                   = false,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief Scatters the rows of the source table into a copy of the target table
@@ -149,6 +154,60 @@ std::unique_ptr<table> scatter(
   bool check_bounds                   = false,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Reduces the elements of the source column into a copy of the target
+ * column according to a scatter map.
+ *
+ * @ingroup copy_scatter
+ *
+ * Row `i` of the result is the reduction by `agg` of row `i` of `target` and of
+ * all the rows `j` of `source` such that `scatter_map[j] == i`. Unlike `scatter`,
+ * duplicate indices in the scatter map are well defined: the rows they map are
+ * all reduced into the same target row, in an unspecified order. Rows of
+ * `target` that no index maps equal the corresponding rows of `target`.
+ *
+ * This accumulates into a dense domain of buckets, e.g. a histogram, in a single
+ * pass of device atomics rather than with a hash based groupby.
+ *
+ * The supported aggregations are SUM, MIN and MAX on arithmetic types, and COUNT
+ * on fixed-width types. The type of `target` must be the type of the result of
+ * `agg` on the type of `source`, e.g. INT64 for the SUM of INT32 elements and
+ * INT32 for COUNT.
+ *
+ * Null elements of `source` are skipped by SUM, MIN and MAX when `null_handling`
+ * is `EXCLUDE`; when it is `INCLUDE`, a null element nullifies the target row it
+ * is mapped to. COUNT counts null elements according to its own null policy. A
+ * null row of `target` is reduced as if it held the identity of `agg`, and stays
+ * null unless a valid element is mapped to it. The target of COUNT must not have
+ * nulls.
+ *
+ * A negative value `i` in the `scatter_map` is interpreted as `i+n`, where `n`
+ * is the number of rows in `target`. Indices outside the range `[-n, n)` are
+ * ignored.
+ *
+ * @throws cudf::logic_error if `scatter_map` has nulls or is not of an integral type
+ * @throws cudf::logic_error if `scatter_map` and `source` have different sizes
+ * @throws cudf::logic_error if the aggregation is not supported for the type of `source`
+ * @throws cudf::logic_error if `target` is not of the result type of the aggregation
+ *
+ * @param source The column of the elements to reduce into `target`
+ * @param scatter_map A non-nullable column of integral indices that maps the
+ * rows of `source` to rows of `target`, one per row of `source`
+ * @param target The column of the initial values of the reductions
+ * @param agg The reduction to perform
+ * @param null_handling Whether null elements of `source` nullify the target rows
+ * they are mapped to
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Result of reducing the source elements into the target rows
+ */
+std::unique_ptr<column> scatter_reduce(
+  column_view const& source,
+  column_view const& scatter_map,
+  column_view const& target,
+  std::unique_ptr<aggregation> const& agg,
+  null_policy null_handling           = null_policy::EXCLUDE,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Indicates when to allocate a mask, based on an existing mask.
  */
@@ -486,6 +545,176 @@ std::vector<contiguous_split_result> contiguous_split(
   std::vector<size_type> const& splits,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Column data in a serialized format
+ *
+ * @ingroup copy_split
+ *
+ * The device data of all the columns of a table is in the contiguous `gpu_data` buffer, and
+ * `metadata` is a small host buffer describing the type, size, null count and children of each
+ * column along with the position of its buffers in `gpu_data`. The two buffers can be sent
+ * separately and turned back into a `table_view` with `unpack` without copying the device data.
+ */
+struct packed_columns {
+  std::unique_ptr<std::vector<uint8_t>> metadata;
+  std::unique_ptr<rmm::device_buffer> gpu_data;
+};
+
+/**
+ * @brief Deep-copies a `table_view` into a serialized contiguous memory format
+ *
+ * @ingroup copy_split
+ *
+ * The device memory of all the columns is copied into a single contiguous buffer as with
+ * `contiguous_split`, and their metadata is serialized into a host buffer.
+ *
+ * @param input View of the table to pack
+ * @param[in] mr Device memory resource used to allocate the returned device memory
+ * @return The packed device data and host metadata of `input`
+ */
+packed_columns pack(cudf::table_view const& input,
+                    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Serializes the metadata of a table whose device data is in a contiguous buffer
+ *
+ * @ingroup copy_split
+ *
+ * Used for the results of `contiguous_split`, whose tables already live in a single buffer,
+ * e.g. `pack_metadata(result.table, result.all_data->data(), result.all_data->size())`.
+ *
+ * @throws cudf::logic_error if the data or null mask of a column is not in the buffer
+ *
+ * @param table View of the table whose metadata is serialized
+ * @param contiguous_buffer Device buffer containing the data of all the columns of `table`
+ * @param buffer_size Size of `contiguous_buffer` in bytes
+ * @return The serialized host metadata of `table`
+ */
+std::vector<uint8_t> pack_metadata(table_view const& table,
+                                   void const* contiguous_buffer,
+                                   size_t buffer_size);
+
+/**
+ * @brief Deserializes the result of `pack` into a `table_view`
+ *
+ * @ingroup copy_split
+ *
+ * The returned view points into `input.gpu_data`, and must not outlive it.
+ *
+ * @throws cudf::logic_error if the metadata is not a serialized table
+ *
+ * @param input The packed device data and host metadata of a table
+ * @return View of the packed table
+ */
+table_view unpack(packed_columns const& input);
+
+/**
+ * @brief Deserializes a packed table from its host metadata and device data
+ *
+ * @ingroup copy_split
+ *
+ * No device memory is copied or allocated, the returned view points into `gpu_data`, which is
+ * typically a buffer received from another process, and must not outlive it.
+ *
+ * @throws cudf::logic_error if the metadata is not a serialized table
+ *
+ * @param metadata The host metadata returned by `pack` or `pack_metadata`
+ * @param gpu_data The device buffer the metadata was serialized for
+ * @return View of the packed table
+ */
+table_view unpack(uint8_t const* metadata, void const* gpu_data);
+
+/**
+ * @brief Column data in the serialized format of `packed_columns`, held in host memory
+ *
+ * @ingroup copy_split
+ *
+ * `metadata` is the metadata of `pack` and `host_data` holds the column buffers at the positions
+ * it records, so a table spilled from the device can be written out, sliced and concatenated
+ * without paging it back into device memory, and made resident again with a single copy.
+ */
+struct packed_host_columns {
+  std::unique_ptr<std::vector<uint8_t>> metadata;
+  std::unique_ptr<std::vector<uint8_t>> host_data;
+};
+
+/**
+ * @brief Packs a table as `pack` does and copies the packed data to host memory
+ *
+ * @ingroup copy_split
+ *
+ * @param input View of the table to pack
+ * @param[in] mr Device memory resource used to allocate the temporary packed device data
+ * @return The packed host data and metadata of `input`
+ */
+packed_host_columns pack_to_host(
+  cudf::table_view const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Copies packed host data to the device
+ *
+ * @ingroup copy_split
+ *
+ * @throws cudf::logic_error if `input` is not a packed table
+ *
+ * @param input The packed host data and metadata of a table
+ * @param[in] mr Device memory resource used to allocate the returned device memory
+ * @return The same table packed in device memory, to be read with `unpack`
+ */
+packed_columns copy_to_device(
+  packed_host_columns const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Deserializes packed host data into a `table_view` of host memory
+ *
+ * @ingroup copy_split
+ *
+ * The returned view points into `input.host_data` and must not outlive it. Its columns may be
+ * inspected on the host, e.g. with `data<T>()` and `null_mask()`, but must not be passed to
+ * functions that access their data on the device.
+ *
+ * @throws cudf::logic_error if the metadata is not a serialized table
+ *
+ * @param input The packed host data and metadata of a table
+ * @return Host view of the packed table
+ */
+table_view unpack(packed_host_columns const& input);
+
+/**
+ * @brief Copies the rows `[begin, end)` of a packed host table into a new packed host table
+ *
+ * @ingroup copy_split
+ *
+ * Runs on the host only. Supports fixed-width, string, list and dictionary columns.
+ *
+ * @throws cudf::logic_error if `begin > end`, `begin < 0` or `end` exceeds the number of rows
+ * @throws cudf::logic_error for unsupported column types
+ *
+ * @param input The packed host data and metadata of a table
+ * @param begin Index of the first row to copy
+ * @param end Index past the last row to copy
+ * @return The packed host data and metadata of the slice
+ */
+packed_host_columns host_slice(packed_host_columns const& input, size_type begin, size_type end);
+
+/**
+ * @brief Concatenates the rows of packed host tables into a new packed host table
+ *
+ * @ingroup copy_split
+ *
+ * Runs on the host only. Supports fixed-width, string and list columns.
+ *
+ * @throws cudf::logic_error if `inputs` is empty or the tables do not have the same column types
+ * @throws cudf::logic_error for unsupported column types
+ * @throws cudf::logic_error if the result has more than `size_type` rows
+ *
+ * @param inputs The packed host tables to concatenate
+ * @return The packed host data and metadata of the concatenated table
+ */
+packed_host_columns host_concatenate(std::vector<packed_host_columns> const& inputs);
+
 /**
  * @brief   Returns a new column, where each element is selected from either @p lhs or
  *          @p rhs based on the value of the corresponding element in @p boolean_mask
@@ -717,5 +946,70 @@ std::unique_ptr<scalar> get_element(
   size_type index,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Fixed-width values and their validity copied to host memory by `get_elements()`
+ */
+struct host_elements {
+  data_type type;              ///< The type of the values
+  std::vector<uint8_t> data;   ///< The values, `size_of(type)` bytes each
+  std::vector<bool> validity;  ///< Whether each value is valid
+
+  /**
+   * @brief Returns the number of values
+   */
+  size_type size() const { return static_cast<size_type>(validity.size()); }
+
+  /**
+   * @brief Returns whether value `i` is valid
+   */
+  bool is_valid(size_type i) const { return validity[i]; }
+
+  /**
+   * @brief Returns value `i`
+   *
+   * @throws cudf::logic_error if the size of `T` does not match the size of `type`
+   *
+   * @tparam T The type of the values
+   */
+  template <typename T>
+  T element(size_type i) const
+  {
+    CUDF_EXPECTS(sizeof(T) * validity.size() == data.size(), "Element type size mismatch");
+    T value;
+    std::memcpy(&value, data.data() + i * sizeof(T), sizeof(T));
+    return value;
+  }
+};
+
+/**
+ * @brief Copies the elements at the specified indices of a column to host memory
+ *
+ * Unlike calling `get_element()` for each index, the elements are gathered by a single kernel
+ * and copied to host with a single transfer through pinned memory, so the stream is
+ * synchronized once for all of them.
+ *
+ * @throws cudf::logic_error if `input` is not a fixed-width type
+ * @throws cudf::logic_error if an index is not within the range `[0, input.size())`
+ *
+ * @param input Column view to get the elements from
+ * @param indices Indices into `input` of the elements to get
+ * @return The values and validity of the elements, in the order of `indices`
+ */
+host_elements get_elements(column_view const& input, std::vector<size_type> const& indices);
+
+/**
+ * @brief Copies the values of scalars to host memory
+ *
+ * The values are read with a single transfer and a single stream synchronization, where
+ * reading them with `value()` and `is_valid()` synchronizes twice per scalar, e.g. to read the
+ * results of reductions of many columns.
+ *
+ * @throws cudf::logic_error if the scalars are not all of the same fixed-width type
+ *
+ * @param scalars The scalars to read
+ * @return The values and validity of the scalars, in the order of `scalars`
+ */
+host_elements get_elements(std::vector<std::reference_wrapper<scalar const>> const& scalars);
+
 /** @} */
 }  // namespace cudf
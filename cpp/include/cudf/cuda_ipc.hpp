@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/table/table_view.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+/**
+ * @addtogroup interop_ipc
+ * @{
+ */
+
+/**
+ * @brief A table whose device memory belongs to another process, opened by `import_ipc`
+ *
+ * The memory of the exporting process stays mapped as long as the object lives. It is shared
+ * through `std::shared_ptr`: the memory is unmapped when the last reference is released.
+ */
+class ipc_imported_table {
+ public:
+  ipc_imported_table(ipc_imported_table const&) = delete;
+  ipc_imported_table& operator=(ipc_imported_table const&) = delete;
+
+  /**
+   * @brief Unmaps the device memory of the exporting process
+   */
+  ~ipc_imported_table();
+
+  /**
+   * @brief Returns a view of the table, valid as long as this object lives
+   */
+  table_view view() const { return _view; }
+
+ private:
+  friend std::shared_ptr<ipc_imported_table> import_ipc(std::vector<uint8_t> const&);
+
+  ipc_imported_table() = default;
+
+  std::vector<void*> _mappings;  ///< Base pointers of the opened allocations
+  table_view _view;
+};
+
+/**
+ * @brief Exports the device memory of a table to other processes on the same machine without
+ * copying it
+ *
+ * Each device allocation holding a buffer of `input`, its columns' data and null masks and
+ * those of their children, is exported once as a `cudaIpcMemHandle_t`. The returned blob holds
+ * these handles and the layout of the columns, their types, sizes, offsets, null counts and the
+ * position of each buffer in its allocation. It can be sent to another process by any means and
+ * passed to `import_ipc` there.
+ *
+ * Nothing is copied or retained: the memory viewed by `input` must outlive every import of the
+ * blob, and must not be modified while imported. The data must be ready (e.g., the stream that
+ * produced it is synchronized) before it is imported.
+ *
+ * @throw cudf::logic_error if a buffer of `input` is not in memory allocated by `cudaMalloc`
+ * (e.g., managed or host memory), which cannot be exported
+ *
+ * @param input The table to export
+ * @return The handles and layout of the table
+ */
+std::vector<uint8_t> export_ipc(table_view const& input);
+
+/**
+ * @brief Opens a table exported by `export_ipc` in another process without copying it
+ *
+ * Each exported allocation is mapped into this process with `cudaIpcOpenMemHandle`, and the
+ * columns view the mapped memory. The allocations must not be opened twice in a process, so a
+ * blob is imported once and the result shared.
+ *
+ * @throw cudf::logic_error if `metadata` is not a blob returned by `export_ipc`
+ * @throw cudf::cuda_error if an allocation cannot be opened, e.g. in the exporting process
+ *
+ * @param metadata The blob returned by `export_ipc`
+ * @return The imported table
+ */
+std::shared_ptr<ipc_imported_table> import_ipc(std::vector<uint8_t> const& metadata);
+
+/** @} */  // end of group
+}  // namespace cudf
@@ -19,6 +19,8 @@
 #include <cudf/types.hpp>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 /**
  * @file datetime.hpp
@@ -27,7 +29,9 @@
 
 namespace cudf {
 namespace datetime {
-namespace detail {
+/**
+ * @brief Components of a timestamp, as extracted by `extract_components`
+ */
 enum class datetime_component {
   INVALID = 0,
   YEAR,
@@ -39,6 +43,20 @@ enum class datetime_component {
   SECOND,
 };
 
+/**
+ * @brief Units to which `floor_datetimes`, `ceil_datetimes` and `round_datetimes` round
+ */
+enum class rounding_frequency : int32_t {
+  DAY,
+  HOUR,
+  MINUTE,
+  SECOND,
+  MILLISECOND,
+  MICROSECOND,
+  NANOSECOND,
+};
+
+namespace detail {
 /**
  * @brief  Extracts the supplied datetime component from any date time type
  * and returns an int16_t cudf::column.
@@ -151,6 +169,31 @@ std::unique_ptr<cudf::column> extract_second(
   cudf::column_view const& column,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief  Extracts several components from any date time type and returns a table
+ * of an int16_t column per component.
+ *
+ * Each timestamp is converted to a civil date and time once for all the components,
+ * where extracting each component on its own converts it once per component.
+ *
+ * ```
+ * column = [2020-02-29T12:30:45]
+ * components = [YEAR, MONTH, HOUR]
+ * result = {[2020], [2], [12]}
+ * ```
+ *
+ * @param[in] cudf::column_view of the input datetime values
+ * @param[in] components The components to extract, in the order of the output columns
+ *
+ * @returns cudf::table of the extracted int16_t datetime components
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ * @throw cudf::logic_error if a component is INVALID
+ */
+std::unique_ptr<cudf::table> extract_components(
+  cudf::column_view const& column,
+  std::vector<datetime_component> const& components,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of group
 /**
  * @addtogroup datetime_compute
@@ -183,6 +226,90 @@ std::unique_ptr<cudf::column> day_of_year(
   cudf::column_view const& column,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief  Rounds each timestamp down to a multiple of the given unit since the epoch
+ * and returns a cudf::column of the same type.
+ *
+ * Timestamps are left unchanged by a unit shorter than their resolution.
+ *
+ * ```
+ * column = [2020-02-29T12:30:45]
+ * floor_datetimes(column, HOUR) = [2020-02-29T12:00:00]
+ * ```
+ *
+ * @param[in] cudf::column_view of the input datetime values
+ * @param[in] freq The unit to round to
+ *
+ * @returns cudf::column of the rounded timestamps
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ */
+std::unique_ptr<cudf::column> floor_datetimes(
+  cudf::column_view const& column,
+  rounding_frequency freq,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Rounds each timestamp up to a multiple of the given unit since the epoch
+ * and returns a cudf::column of the same type.
+ *
+ * Timestamps are left unchanged by a unit shorter than their resolution.
+ *
+ * @param[in] cudf::column_view of the input datetime values
+ * @param[in] freq The unit to round to
+ *
+ * @returns cudf::column of the rounded timestamps
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ */
+std::unique_ptr<cudf::column> ceil_datetimes(
+  cudf::column_view const& column,
+  rounding_frequency freq,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Rounds each timestamp to the nearest multiple of the given unit since the epoch,
+ * ties to the even multiple, and returns a cudf::column of the same type.
+ *
+ * Timestamps are left unchanged by a unit shorter than their resolution.
+ *
+ * @param[in] cudf::column_view of the input datetime values
+ * @param[in] freq The unit to round to
+ *
+ * @returns cudf::column of the rounded timestamps
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ */
+std::unique_ptr<cudf::column> round_datetimes(
+  cudf::column_view const& column,
+  rounding_frequency freq,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Converts timestamps from the local time of a timezone to that of another
+ * and returns a cudf::column of the same type.
+ *
+ * Timezones are named as in the tz database (for example, "America/New_York") and read from
+ * `/usr/share/zoneinfo`; "UTC" or an empty name is UTC. The transition table of each timezone is
+ * built and copied to the device once, then shared by all the conversions. A local time that
+ * is skipped or repeated by a transition is converted with the offset in effect before it.
+ *
+ * ```
+ * column = [2020-07-01T00:00:00]
+ * convert_timezone(column, "UTC", "America/New_York") = [2020-06-30T20:00:00]
+ * ```
+ *
+ * @param[in] cudf::column_view of the input datetime values
+ * @param[in] from_timezone Timezone of the local times of `column`
+ * @param[in] to_timezone Timezone of the local times returned
+ *
+ * @returns cudf::column of the converted timestamps
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ * @throw cudf::logic_error if a timezone cannot be found
+ */
+std::unique_ptr<cudf::column> convert_timezone(
+  cudf::column_view const& column,
+  std::string const& from_timezone,
+  std::string const& to_timezone,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of group
 }  // namespace datetime
 }  // namespace cudf
@@ -158,6 +158,27 @@ struct update_target_element<Source,
   }
 };
 
+template <typename Source, bool target_has_nulls, bool source_has_nulls>
+struct update_target_element<Source,
+                             aggregation::SUM_OF_SQUARES,
+                             target_has_nulls,
+                             source_has_nulls,
+                             std::enable_if_t<std::is_arithmetic<Source>::value>> {
+  __device__ void operator()(mutable_column_device_view target,
+                             size_type target_index,
+                             column_device_view source,
+                             size_type source_index) const noexcept
+  {
+    if (source_has_nulls and source.is_null(source_index)) { return; }
+
+    using Target       = target_type_t<Source, aggregation::SUM_OF_SQUARES>;
+    auto const element = static_cast<Target>(source.element<Source>(source_index));
+    atomicAdd(&target.element<Target>(target_index), element * element);
+
+    if (target_has_nulls and target.is_null(target_index)) { target.set_valid(target_index); }
+  }
+};
+
 template <typename Source, bool target_has_nulls, bool source_has_nulls>
 struct update_target_element<
   Source,
@@ -290,6 +311,7 @@ struct elementwise_aggregator {
  *
  * The initial value and validity of `R` depends on the aggregation:
  * SUM: 0 and NULL
+ * SUM_OF_SQUARES: 0 and NULL
  * MIN: Max value of type and NULL
  * MAX: Min value of type and NULL
  * COUNT_VALID: 0 and VALID
@@ -301,7 +323,7 @@ struct elementwise_aggregator {
  * initial values and validity specified above.
  *
  * Handling of null elements in both `source` and `target` depends on the aggregation:
- * SUM, MIN, MAX, ARGMIN, ARGMAX:
+ * SUM, SUM_OF_SQUARES, MIN, MAX, ARGMIN, ARGMAX:
  *  - `source`: Skipped
  *  - `target`: Updated from null to valid upon first successful aggregation
  * COUNT_VALID, COUNT_ALL:
@@ -345,6 +367,7 @@ __device__ inline void aggregate_row(mutable_table_device_view target,
  *
  * The initial values set as per aggregation are:
  * SUM: 0
+ * SUM_OF_SQUARES: 0
  * COUNT_VALID: 0 and VALID
  * COUNT_ALL:   0 and VALID
  * MIN: Max value of type `T`
@@ -360,9 +383,9 @@ struct identity_initializer {
   static constexpr bool is_supported()
   {
     return cudf::is_fixed_width<T>() and
-           (k == aggregation::SUM or k == aggregation::MIN or k == aggregation::MAX or
-            k == aggregation::COUNT_VALID or k == aggregation::COUNT_ALL or
-            k == aggregation::ARGMAX or k == aggregation::ARGMIN);
+           (k == aggregation::SUM or k == aggregation::SUM_OF_SQUARES or k == aggregation::MIN or
+            k == aggregation::MAX or k == aggregation::COUNT_VALID or
+            k == aggregation::COUNT_ALL or k == aggregation::ARGMAX or k == aggregation::ARGMIN);
   }
 
   template <typename T, aggregation::Kind k>
@@ -128,6 +128,31 @@ struct nunique_aggregation final : derived_aggregation<nunique_aggregation> {
   size_t hash_impl() const { return std::hash<int>{}(static_cast<int>(_null_handling)); }
 };
 
+/**
+ * @brief Derived class for specifying an approximate nunique aggregation
+ */
+struct approx_nunique_aggregation final : derived_aggregation<approx_nunique_aggregation> {
+  approx_nunique_aggregation(aggregation::Kind k, int precision, null_policy null_handling)
+    : derived_aggregation{k}, _precision{precision}, _null_handling{null_handling}
+  {
+  }
+  int _precision;              ///< log2 of the number of sketch registers
+  null_policy _null_handling;  ///< include or exclude nulls
+
+ protected:
+  friend class derived_aggregation<approx_nunique_aggregation>;
+
+  bool operator==(approx_nunique_aggregation const& other) const
+  {
+    return _precision == other._precision and _null_handling == other._null_handling;
+  }
+
+  size_t hash_impl() const
+  {
+    return std::hash<int>{}(_precision) ^ std::hash<int>{}(static_cast<int>(_null_handling));
+  }
+};
+
 /**
  * @brief Derived class for specifying a nth element aggregation
  */
@@ -153,6 +178,48 @@ struct nth_element_aggregation final : derived_aggregation<nth_element_aggregati
   }
 };
 
+/**
+ * @brief Derived class for specifying a collect_list or collect_set aggregation
+ */
+struct collect_aggregation final : derived_aggregation<collect_aggregation> {
+  collect_aggregation(aggregation::Kind k, null_policy null_handling)
+    : derived_aggregation{k}, _null_handling{null_handling}
+  {
+  }
+  null_policy _null_handling;  ///< include or exclude nulls
+
+ protected:
+  friend class derived_aggregation<collect_aggregation>;
+
+  bool operator==(collect_aggregation const& other) const
+  {
+    return _null_handling == other._null_handling;
+  }
+
+  size_t hash_impl() const { return std::hash<int>{}(static_cast<int>(_null_handling)); }
+};
+
+/**
+ * @brief Derived class for specifying a lead or lag aggregation
+ */
+struct lead_lag_aggregation final : derived_aggregation<lead_lag_aggregation> {
+  lead_lag_aggregation(aggregation::Kind k, size_type offset)
+    : derived_aggregation{k}, _row_offset{offset}
+  {
+  }
+  size_type _row_offset;  ///< Number of rows from the current row
+
+ protected:
+  friend class derived_aggregation<lead_lag_aggregation>;
+
+  bool operator==(lead_lag_aggregation const& other) const
+  {
+    return _row_offset == other._row_offset;
+  }
+
+  size_t hash_impl() const { return std::hash<size_type>{}(_row_offset); }
+};
+
 /**
  * @brief Derived class for specifying a custom aggregation
  * specified in udf
@@ -343,6 +410,12 @@ struct target_type_impl<Source, aggregation::NUNIQUE> {
   using type = cudf::size_type;
 };
 
+// Always use size_type accumulator for APPROX_NUNIQUE
+template <typename Source>
+struct target_type_impl<Source, aggregation::APPROX_NUNIQUE> {
+  using type = cudf::size_type;
+};
+
 // Always use Source for NTH_ELEMENT
 template <typename Source>
 struct target_type_impl<Source, aggregation::NTH_ELEMENT> {
@@ -355,6 +428,24 @@ struct target_type_impl<Source, aggregation::ROW_NUMBER> {
   using type = cudf::size_type;
 };
 
+// Collect fixed-width and string values into a list
+template <typename Source>
+struct target_type_impl<
+  Source,
+  aggregation::COLLECT_LIST,
+  std::enable_if_t<is_fixed_width<Source>() or std::is_same<Source, cudf::string_view>::value>> {
+  using type = cudf::list_view;
+};
+
+// Collect distinct fixed-width and string values into a list
+template <typename Source>
+struct target_type_impl<
+  Source,
+  aggregation::COLLECT_SET,
+  std::enable_if_t<is_fixed_width<Source>() or std::is_same<Source, cudf::string_view>::value>> {
+  using type = cudf::list_view;
+};
+
 /**
  * @brief Helper alias to get the accumulator type for performing aggregation
  * `k` on elements of type `Source`
@@ -436,10 +527,16 @@ CUDA_HOST_DEVICE_CALLABLE decltype(auto) aggregation_dispatcher(aggregation::Kin
       return f.template operator()<aggregation::ARGMIN>(std::forward<Ts>(args)...);
     case aggregation::NUNIQUE:
       return f.template operator()<aggregation::NUNIQUE>(std::forward<Ts>(args)...);
+    case aggregation::APPROX_NUNIQUE:
+      return f.template operator()<aggregation::APPROX_NUNIQUE>(std::forward<Ts>(args)...);
     case aggregation::NTH_ELEMENT:
       return f.template operator()<aggregation::NTH_ELEMENT>(std::forward<Ts>(args)...);
     case aggregation::ROW_NUMBER:
       return f.template operator()<aggregation::ROW_NUMBER>(std::forward<Ts>(args)...);
+    case aggregation::COLLECT_LIST:
+      return f.template operator()<aggregation::COLLECT_LIST>(std::forward<Ts>(args)...);
+    case aggregation::COLLECT_SET:
+      return f.template operator()<aggregation::COLLECT_SET>(std::forward<Ts>(args)...);
     default: {
 #ifndef __CUDA_ARCH__
       CUDF_FAIL("Unsupported aggregation.");
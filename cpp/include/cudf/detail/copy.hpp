@@ -84,6 +84,35 @@ std::vector<contiguous_split_result> contiguous_split(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @copydoc cudf::pack
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ **/
+packed_columns pack(cudf::table_view const& input,
+                    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                    cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::pack_to_host
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ **/
+packed_host_columns pack_to_host(
+  cudf::table_view const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::copy_to_device
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ **/
+packed_columns copy_to_device(
+  packed_host_columns const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 /**
  * @copydoc cudf::allocate_like(column_view const&, size_type, mask_allocation_policy,
  * rmm::mr::device_memory_resource*)
@@ -149,5 +178,93 @@ std::unique_ptr<column> copy_if_else(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @brief Returns a new column, where each row is selected from either @p lhs or @p rhs based on
+ * a bitmask
+ *
+ * `output[i] = bit_is_set(condition, condition_offset + i) ? lhs[i] : rhs[i]`
+ *
+ * Unlike a `BOOL8` column, the condition is read a word of 32 rows at a time, e.g. the null mask
+ * of a column or the result of `bools_to_mask`. A null @p condition selects every row of @p lhs,
+ * as a null mask does, and a condition selecting all or none of the rows copies @p lhs or @p rhs
+ * in bulk.
+ *
+ * @throws cudf::logic_error if @p lhs and @p rhs are not of the same type or size
+ *
+ * @param[in] lhs left-hand column_view
+ * @param[in] rhs right-hand column_view
+ * @param[in] condition Bitmask whose set bits select the rows of @p lhs
+ * @param[in] condition_offset Index of the bit of @p condition for the first row
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ * @returns new column with the selected elements
+ */
+std::unique_ptr<column> copy_if_else(
+  column_view const& lhs,
+  column_view const& rhs,
+  bitmask_type const* condition,
+  size_type condition_offset,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::detail::copy_if_else(column_view const&, column_view const&,
+ * bitmask_type const*, size_type, rmm::mr::device_memory_resource*, cudaStream_t)
+ */
+std::unique_ptr<column> copy_if_else(
+  scalar const& lhs,
+  column_view const& rhs,
+  bitmask_type const* condition,
+  size_type condition_offset,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::detail::copy_if_else(column_view const&, column_view const&,
+ * bitmask_type const*, size_type, rmm::mr::device_memory_resource*, cudaStream_t)
+ */
+std::unique_ptr<column> copy_if_else(
+  column_view const& lhs,
+  scalar const& rhs,
+  bitmask_type const* condition,
+  size_type condition_offset,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::get_elements(column_view const&, std::vector<size_type> const&)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+host_elements get_elements(column_view const& input,
+                           std::vector<size_type> const& indices,
+                           cudaStream_t stream = 0);
+
+/**
+ * @copydoc cudf::get_elements(std::vector<std::reference_wrapper<scalar const>> const&)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+host_elements get_elements(std::vector<std::reference_wrapper<scalar const>> const& scalars,
+                           cudaStream_t stream = 0);
+
+/**
+ * @brief Creates a column with the value of each scalar as a row
+ *
+ * The values are copied by a single kernel, without reading them on host.
+ *
+ * @throws cudf::logic_error if `scalars` is empty
+ * @throws cudf::logic_error if the scalars are not all of the same fixed-width type
+ *
+ * @param[in] scalars The scalars to copy
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ * @return Column of the type of the scalars with `scalars.size()` rows
+ */
+std::unique_ptr<column> make_column_from_scalars(
+  std::vector<std::reference_wrapper<scalar const>> const& scalars,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 }  // namespace detail
 }  // namespace cudf
@@ -245,7 +245,8 @@ struct scatter_gather_functor {
       input, output_size, cudf::mask_allocation_policy::RETAIN, mr, stream);
     auto output = output_column->mutable_view();
 
-    bool has_valid = input.nullable();
+    // The mask of an input without nulls is copied as all valid instead of being scattered
+    bool has_valid = input.has_nulls();
 
     auto scatter = (has_valid) ? scatter_kernel<T, Filter, block_size, true>
                                : scatter_kernel<T, Filter, block_size, false>;
@@ -254,10 +255,10 @@ struct scatter_gather_functor {
 
     rmm::device_scalar<cudf::size_type> null_count{0, stream};
     if (output.nullable()) {
-      // Have to initialize the output mask to all zeros because we may update
-      // it with atomicOr().
+      // A scattered mask has to be initialized to all zeros because we may
+      // update it with atomicOr(); otherwise it is all valid.
       CUDA_TRY(cudaMemsetAsync(static_cast<void*>(output.null_mask()),
-                               0,
+                               has_valid ? 0 : 0xff,
                                cudf::bitmask_allocation_size_bytes(output.size()),
                                stream));
     }
@@ -272,7 +273,11 @@ struct scatter_gather_functor {
                                                         per_thread,
                                                         filter);
 
-    if (has_valid) { output_column->set_null_count(null_count.value(stream)); }
+    if (has_valid) {
+      output_column->set_null_count(null_count.value(stream));
+    } else if (output_column->nullable()) {
+      output_column->set_null_count(0);
+    }
     return output_column;
   }
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2020, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -24,6 +24,7 @@
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/strings/detail/copy_if_else.cuh>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
@@ -32,8 +33,72 @@
 
 namespace cudf {
 namespace detail {
+/**
+ * @brief Filter selecting the rows whose bit is set in a bitmask
+ *
+ * A null `condition` selects every row, as a null mask does.
+ */
+struct bitmask_filter {
+  bitmask_type const *condition;
+  size_type condition_offset;  ///< Index of the bit of `condition` for the first row
+  size_type size;              ///< Number of rows
+
+  __device__ bool operator()(size_type i) const
+  {
+    return condition == nullptr or bit_is_set(condition, condition_offset + i);
+  }
+
+  /**
+   * @brief Returns the bits of the rows `[32 * w, 32 * w + 32)`, the first row at bit 0
+   *
+   * The bits of the rows past the end are undefined.
+   */
+  __device__ bitmask_type word(size_type w) const
+  {
+    if (condition == nullptr) { return ~bitmask_type{0}; }
+    size_type const begin_bit = condition_offset + w * warp_size;
+    size_type const shift     = intra_word_index(begin_bit);
+    bitmask_type const bits   = condition[word_index(begin_bit)];
+    if (shift == 0) { return bits; }
+    // the rows of the word straddle two words of the condition, unless they end in the first
+    size_type const count = min(size - w * warp_size, warp_size);
+    bitmask_type const next =
+      shift + count > warp_size ? condition[word_index(begin_bit) + 1] : bitmask_type{0};
+    return __funnelshift_r(bits, next, shift);
+  }
+};
+
 namespace {  // anonymous
 
+/**
+ * @brief Returns the bits of the current warp's rows selected by `filter`, the row of lane `l`
+ * at bit `l`
+ *
+ * Each lane evaluates the filter for its row.
+ */
+template <typename Filter>
+__device__ bitmask_type filter_word(Filter const &filter,
+                                    size_type word,
+                                    size_type index,
+                                    bool in_range)
+{
+  return __ballot_sync(0xFFFF'FFFF, in_range and filter(index));
+}
+
+/**
+ * @brief Returns the bits of the current warp's rows selected by a bitmask
+ *
+ * The first lane reads and aligns the word of the condition, for the whole warp.
+ */
+__device__ inline bitmask_type filter_word(bitmask_filter const &filter,
+                                           size_type word,
+                                           size_type index,
+                                           bool in_range)
+{
+  bitmask_type const bits = threadIdx.x % warp_size == 0 ? filter.word(word) : 0;
+  return __shfl_sync(0xFFFF'FFFF, bits, 0);
+}
+
 template <size_type block_size,
           typename T,
           typename LeftIter,
@@ -72,21 +137,26 @@ __launch_bounds__(block_size) __global__
   while (warp_cur <= warp_end) {
     bool in_range = (index >= begin && index < end);
 
-    bool valid = true;
-    if (has_validity) {
-      valid = in_range && (filter(index) ? thrust::get<1>(lhs[index]) : thrust::get<1>(rhs[index]));
-    }
-
-    // do the copy if-else
+    // do the copy if-else, reading only the selected element. The rows of a warp whose filter
+    // bits are all set or all clear take the same branch
+    bitmask_type const selected = filter_word(filter, warp_cur, index, in_range);
+    bool valid                  = false;
     if (in_range) {
-      out.element<T>(index) = filter(index) ? static_cast<T>(thrust::get<0>(lhs[index]))
-                                            : static_cast<T>(thrust::get<0>(rhs[index]));
+      if (selected & (bitmask_type{1} << lane_id)) {
+        auto const element    = lhs[index];
+        out.element<T>(index) = static_cast<T>(thrust::get<0>(element));
+        valid                 = thrust::get<1>(element);
+      } else {
+        auto const element    = rhs[index];
+        out.element<T>(index) = static_cast<T>(thrust::get<0>(element));
+        valid                 = thrust::get<1>(element);
+      }
     }
 
     // update validity
     if (has_validity) {
       // the final validity mask for this warp
-      int warp_mask = __ballot_sync(0xFFFF'FFFF, valid && in_range);
+      int warp_mask = __ballot_sync(0xFFFF'FFFF, valid);
       // only one guy in the warp needs to update the mask and count
       if (lane_id == 0) {
         out.set_mask_word(warp_cur, warp_mask);
@@ -30,15 +30,20 @@
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
+#include <rmm/device_buffer.hpp>
 #include <rmm/thrust_rmm_allocator.h>
 
 #include <algorithm>
 
+#include <thrust/copy.h>
+#include <thrust/count.h>
 #include <thrust/functional.h>
 #include <thrust/gather.h>
 #include <thrust/host_vector.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 #include <thrust/logical.h>
+#include <thrust/transform.h>
 
 #include <cub/cub.cuh>
 
@@ -350,22 +355,31 @@ void gather_bitmask(table_view const& source,
                            [target_rows](auto const& col) { return target_rows == col->size(); }),
                "Column size mismatch");
 
-  // Create null mask if source is nullable but target is not
+  // Create null mask if source is nullable but target is not. Gathering from a source without
+  // nulls cannot produce nulls unless out of bounds rows are nullified, so its mask is created
+  // all valid and is not gathered.
+  std::vector<bool> all_valid(target.size(), false);
   for (size_t i = 0; i < target.size(); ++i) {
     if ((source.column(i).nullable() or op == gather_bitmask_op::NULLIFY) and
         not target[i]->nullable()) {
-      auto const state =
-        op == gather_bitmask_op::PASSTHROUGH ? mask_state::ALL_VALID : mask_state::UNINITIALIZED;
+      all_valid[i] = op == gather_bitmask_op::DONT_CHECK and not source.column(i).has_nulls();
+      auto const state = (op == gather_bitmask_op::PASSTHROUGH or all_valid[i])
+                           ? mask_state::ALL_VALID
+                           : mask_state::UNINITIALIZED;
       auto mask = create_null_mask(target[i]->size(), state, stream, mr);
       target[i]->set_null_mask(std::move(mask), 0);
     }
   }
 
-  // Make device array of target bitmask pointers
+  // Make device array of the target bitmask pointers still to be gathered
   thrust::host_vector<bitmask_type*> target_masks(target.size());
-  std::transform(target.begin(), target.end(), target_masks.begin(), [](auto const& col) {
-    return col->mutable_view().null_mask();
-  });
+  for (size_t i = 0; i < target.size(); ++i) {
+    target_masks[i] = all_valid[i] ? nullptr : target[i]->mutable_view().null_mask();
+  }
+  if (std::all_of(
+        target_masks.begin(), target_masks.end(), [](auto mask) { return mask == nullptr; })) {
+    return;
+  }
   rmm::device_vector<bitmask_type*> d_target_masks(target_masks);
 
   auto const masks         = d_target_masks.data().get();
@@ -395,13 +409,251 @@ void gather_bitmask(table_view const& source,
   // Copy the valid counts into each column
   auto const valid_counts = thrust::host_vector<size_type>(d_valid_counts);
   for (size_t i = 0; i < target.size(); ++i) {
-    if (target[i]->nullable()) {
+    if (target_masks[i] != nullptr) {
       auto const null_count = target_rows - valid_counts[i];
       target[i]->set_null_count(null_count);
     }
   }
 }
 
+/**
+ * @brief Source and target data of a fixed-width column gathered by `gather_fixed_width_kernel`
+ */
+struct fixed_width_gather_column {
+  int8_t const* source;
+  int8_t* target;
+  size_type element_size;
+};
+
+/**
+ * @brief Copies an element of `size` bytes between locations aligned to `size`
+ */
+__device__ inline void copy_fixed_width_element(int8_t const* source,
+                                                int8_t* target,
+                                                size_type size)
+{
+  switch (size) {
+    case 1: *target = *source; break;
+    case 2: *reinterpret_cast<int16_t*>(target) = *reinterpret_cast<int16_t const*>(source); break;
+    case 4: *reinterpret_cast<int32_t*>(target) = *reinterpret_cast<int32_t const*>(source); break;
+    case 8: *reinterpret_cast<int64_t*>(target) = *reinterpret_cast<int64_t const*>(source); break;
+    default:
+      for (size_type i = 0; i < size; ++i) { target[i] = source[i]; }
+      break;
+  }
+}
+
+/**
+ * @brief Gathers the rows of several fixed-width columns, reading each gather map element once
+ *
+ * Each thread gathers a row of all the columns. The threads of a warp copy elements of the same
+ * column, so the element size switch does not diverge.
+ */
+template <typename MapIterator>
+__global__ void gather_fixed_width_kernel(MapIterator gather_map,
+                                          size_type num_rows,
+                                          size_type source_rows,
+                                          fixed_width_gather_column const* columns,
+                                          size_type num_columns,
+                                          bool nullify_out_of_bounds)
+{
+  using map_type = typename std::iterator_traits<MapIterator>::value_type;
+  bounds_checker<map_type> in_bounds{0, source_rows};
+
+  for (size_type row = threadIdx.x + blockIdx.x * blockDim.x; row < num_rows;
+       row += blockDim.x * gridDim.x) {
+    auto const index = gather_map[row];
+    // Out of bounds rows are nullified by the mask gather
+    if (nullify_out_of_bounds && !in_bounds(index)) { continue; }
+    for (size_type c = 0; c < num_columns; ++c) {
+      auto const column = columns[c];
+      copy_fixed_width_element(column.source + static_cast<int64_t>(index) * column.element_size,
+                               column.target + static_cast<int64_t>(row) * column.element_size,
+                               column.element_size);
+    }
+  }
+}
+
+/**
+ * @brief A run of consecutive indices of a gather map
+ */
+struct gather_run {
+  size_type target_row;  ///< Index of the first gather map element of the run
+  size_type source_row;  ///< Value of the first gather map element of the run
+  size_type size;        ///< Number of elements of the run
+};
+
+/**
+ * @brief Minimum number of rows of a gather for its runs to be searched
+ */
+constexpr size_type min_run_gather_rows = 64 * 1024;
+
+/**
+ * @brief Maximum number of bulk copies of the runs of a gather, across all columns
+ */
+constexpr size_type max_run_gather_copies = 64;
+
+/**
+ * @brief Returns the runs of consecutive indices of a gather map, when it consists of at most
+ * `max_runs` runs of in-bounds indices
+ *
+ * Such maps are e.g. produced by slicing or by compactions that keep long ranges of rows. Other
+ * maps are mostly rejected from a few hundred samples, with a small copy to the host, before
+ * the runs of the whole map are counted.
+ *
+ * @param gather_map_begin Beginning of iterator range of integral values representing the gather
+ * map
+ * @param map_size Number of elements of the gather map
+ * @param source_rows Number of rows of the gathered table
+ * @param max_runs Maximum number of runs
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The runs, or no run when the map does not consist of few enough in-bounds runs
+ */
+template <typename MapIterator>
+std::vector<gather_run> find_gather_runs(MapIterator gather_map_begin,
+                                         size_type map_size,
+                                         size_type source_rows,
+                                         size_type max_runs,
+                                         cudaStream_t stream)
+{
+  if (map_size < min_run_gather_rows or max_runs < 1) { return {}; }
+
+  // Evenly spaced samples of the map rule out most maps before the runs are counted: at most
+  // `max_runs - 1` of the intervals between samples hold the start of a run
+  auto const num_intervals = 4 * max_runs;
+  auto const sample_row    = [map_size, num_intervals] __host__ __device__(size_type s) {
+    return static_cast<size_type>(static_cast<int64_t>(s) * (map_size - 1) / num_intervals);
+  };
+  auto execpol = rmm::exec_policy(stream);
+  rmm::device_vector<int64_t> d_samples(num_intervals + 1);
+  thrust::transform(execpol->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_intervals + 1),
+                    d_samples.begin(),
+                    [gather_map_begin, sample_row] __device__(size_type s) {
+                      return static_cast<int64_t>(gather_map_begin[sample_row(s)]);
+                    });
+  thrust::host_vector<int64_t> const samples(d_samples);
+  size_type broken_intervals = 0;
+  for (size_type s = 0; s < num_intervals; ++s) {
+    auto const rows = sample_row(s + 1) - sample_row(s);
+    if (samples[s + 1] - samples[s] != rows) { ++broken_intervals; }
+  }
+  if (broken_intervals >= max_runs) { return {}; }
+
+  auto const is_run_start = [gather_map_begin] __device__(size_type i) {
+    return i == 0 or gather_map_begin[i] != gather_map_begin[i - 1] + 1;
+  };
+  auto const num_runs = thrust::count_if(execpol->on(stream),
+                                         thrust::make_counting_iterator<size_type>(0),
+                                         thrust::make_counting_iterator<size_type>(map_size),
+                                         is_run_start);
+  if (num_runs > max_runs) { return {}; }
+
+  rmm::device_vector<size_type> d_starts(num_runs);
+  thrust::copy_if(execpol->on(stream),
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(map_size),
+                  d_starts.begin(),
+                  is_run_start);
+  rmm::device_vector<int64_t> d_sources(num_runs);
+  thrust::transform(execpol->on(stream),
+                    d_starts.begin(),
+                    d_starts.end(),
+                    d_sources.begin(),
+                    [gather_map_begin] __device__(size_type i) {
+                      return static_cast<int64_t>(gather_map_begin[i]);
+                    });
+  thrust::host_vector<size_type> const starts(d_starts);
+  thrust::host_vector<int64_t> const sources(d_sources);
+
+  std::vector<gather_run> runs;
+  for (size_t r = 0; r < starts.size(); ++r) {
+    auto const size = (r + 1 < starts.size() ? starts[r + 1] : map_size) - starts[r];
+    // Out of bounds indices are left to the gather kernel
+    if (sources[r] < 0 or sources[r] + size > source_rows) { return {}; }
+    runs.push_back(gather_run{starts[r], static_cast<size_type>(sources[r]), size});
+  }
+  return runs;
+}
+
+/**
+ * @brief Gathers the data of the fixed-width columns of `source_table` in a single kernel
+ *
+ * When the gather map consists of a few runs of consecutive in-bounds indices, the runs are
+ * copied with `cudaMemcpyAsync` instead, at memcpy bandwidth and without reading the map.
+ *
+ * The target column of each fixed-width source column is allocated in `destination_columns`,
+ * without a null mask; the entries of the other columns are left untouched.
+ *
+ * @param source_table View into the table containing the columns to gather
+ * @param gather_map_begin Beginning of iterator range of integral values representing the gather
+ * map
+ * @param gather_map_end End of iterator range of integral values representing the gather map
+ * @param nullify_out_of_bounds Skip the rows whose indices are out of bounds
+ * @param destination_columns Target columns, one entry per source column
+ * @param mr Device memory resource used to allocate the target columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+template <typename MapIterator>
+void gather_fixed_width_columns(table_view const& source_table,
+                                MapIterator gather_map_begin,
+                                MapIterator gather_map_end,
+                                bool nullify_out_of_bounds,
+                                std::vector<std::unique_ptr<column>>& destination_columns,
+                                rmm::mr::device_memory_resource* mr,
+                                cudaStream_t stream)
+{
+  size_type const num_destination_rows = std::distance(gather_map_begin, gather_map_end);
+
+  thrust::host_vector<fixed_width_gather_column> columns;
+  for (size_type i = 0; i < source_table.num_columns(); ++i) {
+    auto const& source_column = source_table.column(i);
+    if (not is_fixed_width(source_column.type())) { continue; }
+    destination_columns[i] = allocate_like(
+      source_column, num_destination_rows, mask_allocation_policy::NEVER, mr, stream);
+    auto const element_size = static_cast<size_type>(size_of(source_column.type()));
+    columns.push_back(fixed_width_gather_column{
+      source_column.head<int8_t>() + static_cast<int64_t>(source_column.offset()) * element_size,
+      destination_columns[i]->mutable_view().head<int8_t>(),
+      element_size});
+  }
+  if (columns.empty() or num_destination_rows == 0) { return; }
+
+  // Maps made of a few runs of consecutive indices are gathered with bulk copies
+  auto const runs = find_gather_runs(gather_map_begin,
+                                     num_destination_rows,
+                                     source_table.num_rows(),
+                                     max_run_gather_copies / static_cast<size_type>(columns.size()),
+                                     stream);
+  if (not runs.empty()) {
+    for (auto const& column : columns) {
+      for (auto const& run : runs) {
+        CUDA_TRY(cudaMemcpyAsync(
+          column.target + static_cast<int64_t>(run.target_row) * column.element_size,
+          column.source + static_cast<int64_t>(run.source_row) * column.element_size,
+          static_cast<size_t>(run.size) * column.element_size,
+          cudaMemcpyDeviceToDevice,
+          stream));
+      }
+    }
+    return;
+  }
+
+  // Allocated and freed on `stream`, so no synchronization is needed before it is freed
+  rmm::device_buffer d_columns(
+    columns.data(), columns.size() * sizeof(fixed_width_gather_column), stream);
+  constexpr size_type block_size = 256;
+  cudf::detail::grid_1d grid{num_destination_rows, block_size};
+  gather_fixed_width_kernel<<<grid.num_blocks, block_size, 0, stream>>>(
+    gather_map_begin,
+    num_destination_rows,
+    source_table.num_rows(),
+    static_cast<fixed_width_gather_column const*>(d_columns.data()),
+    static_cast<size_type>(columns.size()),
+    nullify_out_of_bounds);
+}
+
 /**
  * @brief Gathers the specified rows of a set of columns according to a gather map.
  *
@@ -435,20 +687,27 @@ std::unique_ptr<table> gather(table_view const& source_table,
 {
   auto num_destination_rows = std::distance(gather_map_begin, gather_map_end);
 
-  std::vector<std::unique_ptr<column>> destination_columns;
-
-  // TODO: Could be beneficial to use streams internally here
-
-  for (auto const& source_column : source_table) {
-    // The data gather for n columns will be put on the first n streams
-    destination_columns.push_back(cudf::type_dispatcher(source_column.type(),
-                                                        column_gatherer{},
-                                                        source_column,
-                                                        gather_map_begin,
-                                                        gather_map_end,
-                                                        nullify_out_of_bounds,
-                                                        mr,
-                                                        stream));
+  std::vector<std::unique_ptr<column>> destination_columns(source_table.num_columns());
+
+  // The fixed-width columns are gathered together; the others have specialized gathers
+  gather_fixed_width_columns(source_table,
+                             gather_map_begin,
+                             gather_map_end,
+                             nullify_out_of_bounds,
+                             destination_columns,
+                             mr,
+                             stream);
+  for (size_type i = 0; i < source_table.num_columns(); ++i) {
+    if (destination_columns[i] != nullptr) { continue; }
+    auto const& source_column = source_table.column(i);
+    destination_columns[i]    = cudf::type_dispatcher(source_column.type(),
+                                                   column_gatherer{},
+                                                   source_column,
+                                                   gather_map_begin,
+                                                   gather_map_end,
+                                                   nullify_out_of_bounds,
+                                                   mr,
+                                                   stream);
   }
 
   auto const op =
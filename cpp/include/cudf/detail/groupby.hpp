@@ -36,11 +36,20 @@ namespace hash {
  */
 bool can_use_hash_groupby(table_view const& keys, std::vector<aggregation_request> const& requests);
 
-// Hash-based groupby
+/**
+ * @brief Hash-based groupby
+ *
+ * @param boolean_mask If not null, only the rows for which the mask is valid and `true` are
+ * aggregated
+ * @param estimated_num_groups Estimated number of distinct keys, sizing the hash map and choosing
+ * whether to pre-aggregate in shared memory; negative if unknown, sizing the map for all the rows
+ */
 std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
   table_view const& keys,
   std::vector<aggregation_request> const& requests,
   null_policy include_null_keys,
+  column_view const* boolean_mask,
+  size_type estimated_num_groups,
   cudaStream_t stream,
   rmm::mr::device_memory_resource* mr);
 }  // namespace hash
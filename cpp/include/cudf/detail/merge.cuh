@@ -19,6 +19,9 @@
 #include <cudf/table/row_operators.cuh>
 #include <cudf/utilities/type_dispatcher.hpp>
 
+#include <memory>
+#include <vector>
+
 namespace cudf {
 namespace detail {
 /**
@@ -141,5 +144,17 @@ struct row_lexicographic_tagged_comparator {
   order const* _column_order{};
 };
 
+/**
+ * @copydoc cudf::merge
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<cudf::table> merge(std::vector<table_view> const& tables_to_merge,
+                                   std::vector<cudf::size_type> const& key_cols,
+                                   std::vector<cudf::order> const& column_order,
+                                   std::vector<cudf::null_order> const& null_precedence,
+                                   rmm::mr::device_memory_resource* mr,
+                                   cudaStream_t stream = 0);
+
 }  // namespace detail
 }  // namespace cudf
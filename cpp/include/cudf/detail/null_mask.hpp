@@ -21,6 +21,16 @@
 
 namespace cudf {
 namespace detail {
+/**
+ * @copydoc cudf::count_set_bits
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+cudf::size_type count_set_bits(bitmask_type const* bitmask,
+                               size_type start,
+                               size_type stop,
+                               cudaStream_t stream = 0);
+
 /**
  * @copydoc cudf::segmented_count_set_bits
  *
@@ -18,6 +18,11 @@
 
 #include "nvtx3.hpp"
 
+#include <cudf/utilities/profiling.hpp>
+
+#include <chrono>
+#include <cstdint>
+
 namespace cudf {
 /**
  * @brief Tag type for libcudf's NVTX domain.
@@ -33,6 +38,52 @@ struct libcudf_domain {
  */
 using thread_range = ::nvtx3::domain_thread_range<libcudf_domain>;
 
+namespace detail {
+/**
+ * @brief Notifies the profiling callbacks set when it is created of the lifetime of a function.
+ *
+ * Only checks whether callbacks are set when there are none.
+ */
+class profiled_range {
+ public:
+  explicit profiled_range(char const* name) : _name{name}, _callbacks{get_profiling_callbacks()}
+  {
+    if (_callbacks != nullptr) {
+      _start = std::chrono::steady_clock::now();
+      _callbacks->on_begin(_name);
+    }
+  }
+
+  ~profiled_range()
+  {
+    if (_callbacks != nullptr) {
+      _callbacks->on_end(_name, std::chrono::steady_clock::now() - _start);
+    }
+  }
+
+  profiled_range(profiled_range const&) = delete;
+  profiled_range& operator=(profiled_range const&) = delete;
+
+ private:
+  char const* _name;
+  profiling_callbacks* _callbacks;
+  std::chrono::steady_clock::time_point _start;
+};
+
+/**
+ * @brief Notifies the profiling callbacks set, if any, of a measurement of an operation.
+ *
+ * @param name The name of the operation
+ * @param counter The name of the measurement
+ * @param value The measured value
+ */
+inline void report_counter(char const* name, char const* counter, int64_t value)
+{
+  auto const callbacks = get_profiling_callbacks();
+  if (callbacks != nullptr) { callbacks->on_counter(name, counter, value); }
+}
+
+}  // namespace detail
 }  // namespace cudf
 
 /**
@@ -40,7 +91,8 @@ using thread_range = ::nvtx3::domain_thread_range<libcudf_domain>;
  * from the lifetime of a function.
  *
  * Uses the name of the immediately enclosing function returned by `__func__` to
- * name the range.
+ * name the range. The `cudf::profiling_callbacks` set, if any, are notified of the
+ * range as well.
  *
  * Example:
  * ```
@@ -51,4 +103,6 @@ using thread_range = ::nvtx3::domain_thread_range<libcudf_domain>;
  * ```
  *
  */
-#define CUDF_FUNC_RANGE() NVTX3_FUNC_RANGE_IN(cudf::libcudf_domain)
+#define CUDF_FUNC_RANGE()                   \
+  NVTX3_FUNC_RANGE_IN(cudf::libcudf_domain) \
+  cudf::detail::profiled_range const cudf_profiled_range__{__func__}
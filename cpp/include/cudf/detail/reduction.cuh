@@ -16,12 +16,16 @@
 
 #pragma once
 
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_scalar.hpp>
 
 #include <rmm/thrust_rmm_allocator.h>
 #include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <cub/device/device_reduce.cuh>
 #include "reduction_operators.cuh"
@@ -29,6 +33,102 @@
 namespace cudf {
 namespace reduction {
 namespace detail {
+/**
+ * @brief Reduces the valid elements of a word of the null mask of a column
+ *
+ * Called with the index `w` of a bitmask word, it returns the reduction of the valid elements
+ * among the elements `[32w, 32w + 32)` of the column. The validity of the elements is read a
+ * word at a time rather than a bit per element: the elements of a word where all are null are
+ * not read at all, those of a word where all are valid are reduced without testing their
+ * validity, and only the set bits of the other words are visited. Reducing the words of a
+ * mostly null column thus reads only its valid elements.
+ *
+ * Each thread reads the elements of its word serially, so the loads of a warp are strided by
+ * 32 elements rather than coalesced: the words are only reduced when enough of the elements
+ * are null, see `reduce_valid_words`.
+ *
+ * @tparam ElementType The type of the elements of the column
+ * @tparam OutputType The type of the reduction
+ * @tparam Transformer Converts an element to `OutputType`
+ * @tparam BinaryOp The reduction operator
+ */
+template <typename ElementType, typename OutputType, typename Transformer, typename BinaryOp>
+struct valid_word_reducer {
+  column_device_view col;
+  Transformer transformer;
+  BinaryOp binary_op;
+  OutputType identity;
+
+  __device__ OutputType operator()(size_type word)
+  {
+    constexpr size_type word_size{cudf::detail::size_in_bits<bitmask_type>()};
+    size_type const first = word * word_size;
+    size_type const count = col.size() - first < word_size ? col.size() - first : word_size;
+
+    // The validity of the elements of this word, the column's offset aligning them to its bits
+    size_type const begin_bit = col.offset() + first;
+    size_type const shift     = intra_word_index(begin_bit);
+    bitmask_type valid        = col.null_mask()[word_index(begin_bit)];
+    if (shift != 0) {
+      bitmask_type const next = word_index(begin_bit + count - 1) > word_index(begin_bit)
+                                  ? col.null_mask()[word_index(begin_bit) + 1]
+                                  : 0;
+      valid = __funnelshift_r(valid, next, shift);
+    }
+    if (count < word_size) { valid &= set_least_significant_bits(count); }
+
+    OutputType result = identity;
+    if (__popc(valid) == count) {
+      for (size_type i = first; i < first + count; ++i) {
+        result = binary_op(result, transformer(col.element<ElementType>(i)));
+      }
+    } else {
+      while (valid != 0) {
+        size_type const i = first + __ffs(valid) - 1;
+        result            = binary_op(result, transformer(col.element<ElementType>(i)));
+        valid &= valid - 1;
+      }
+    }
+    return result;
+  }
+};
+
+/**
+ * @brief Returns whether the nulls of a column are dense enough to reduce it a bitmask word at
+ * a time, with `make_valid_word_iterator`
+ *
+ * Skipping the null elements only pays for the strided loads of the words when at least half the
+ * elements are null; other nullable columns are reduced an element at a time, with coalesced
+ * loads.
+ */
+inline bool reduce_valid_words(column_view const& col)
+{
+  return col.null_count() >= col.size() - col.null_count();
+}
+
+/**
+ * @brief Returns an iterator over the reductions of the valid elements of each bitmask word of
+ * a nullable column, to be reduced over `num_bitmask_words(col.size())` items
+ *
+ * @see valid_word_reducer
+ *
+ * @param col The nullable column
+ * @param transformer Converts an element to `OutputType`
+ * @param binary_op The reduction operator
+ * @param identity The identity of `binary_op`, the reduction of a word without valid elements
+ */
+template <typename ElementType, typename OutputType, typename Transformer, typename BinaryOp>
+auto make_valid_word_iterator(column_device_view const& col,
+                              Transformer transformer,
+                              BinaryOp binary_op,
+                              OutputType identity)
+{
+  return thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    valid_word_reducer<ElementType, OutputType, Transformer, BinaryOp>{
+      col, transformer, binary_op, identity});
+}
+
 /** --------------------------------------------------------------------------*
  * @brief Compute the specified simple reduction over the input range of elements.
  *
@@ -16,9 +16,12 @@
 
 #pragma once
 
+#include <cudf/aggregation.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/scalar/scalar.hpp>
 
+#include <vector>
+
 namespace cudf {
 namespace reduction {
 /**
@@ -210,5 +213,31 @@ std::unique_ptr<scalar> standard_deviation(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @brief Computes several reductions of the elements in input column in a single pass
+ *
+ * `sum`, `sum_of_squares`, `min`, `max`, `mean`, `var` and `std` are all derived from the same
+ * partial results (sum, sum of squares, minimum and maximum), which are computed by one
+ * reduction over the column. `mean`, `var` and `std` are only computed for a floating point
+ * `output_dtype`.
+ *
+ * The result of the aggregations that cannot be computed this way, or of all aggregations if the
+ * input column or `output_dtype` is not arithmetic, is `nullptr`.
+ * The input column must contain at least one valid element.
+ *
+ * @param col input column to reduce.
+ * @param aggs aggregations to compute.
+ * @param output_dtype data type of return type and typecast elements of input column.
+ * @param mr Device memory resource used to allocate the returned scalars' device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return One scalar of type `output_dtype` or `nullptr` per aggregation of `aggs`.
+ */
+std::vector<std::unique_ptr<scalar>> fused_reductions(
+  column_view const& col,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  data_type const output_dtype,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 }  // namespace reduction
 }  // namespace cudf
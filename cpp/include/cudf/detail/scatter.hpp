@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <cudf/aggregation.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
@@ -107,6 +108,20 @@ std::unique_ptr<table> scatter(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @copydoc cudf::scatter_reduce
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> scatter_reduce(
+  column_view const& source,
+  column_view const& scatter_map,
+  column_view const& target,
+  std::unique_ptr<aggregation> const& agg,
+  null_policy null_handling           = null_policy::EXCLUDE,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 /**
  * @copydoc cudf::boolean_mask_scatter(
                       table_view const& source, table_view const& target,
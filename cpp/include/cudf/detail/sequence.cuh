@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+/**
+ * @file sequence.cuh
+ * @brief Virtual columns of generated values
+ *
+ * Row indices and repeated keys are often generated only to be read once, e.g. as a gather map.
+ * The types below describe such columns without allocating them: operators read their values
+ * through `begin()` and `end()`, and `materialize` builds the column when one is needed.
+ */
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Copies the `size` values from `begin` into a new column
+ */
+template <typename IteratorType, typename T>
+std::unique_ptr<column> materialize_sequence(IteratorType begin,
+                                             size_type size,
+                                             rmm::mr::device_memory_resource* mr,
+                                             cudaStream_t stream)
+{
+  auto result =
+    make_fixed_width_column(data_type{type_to_id<T>()}, size, mask_state::UNALLOCATED, stream, mr);
+  thrust::copy(rmm::exec_policy(stream)->on(stream),
+               begin,
+               begin + size,
+               result->mutable_view().template begin<T>());
+  return result;
+}
+
+/**
+ * @brief The `size` values `init + i * step`, as `cudf::sequence` makes them
+ */
+template <typename T>
+struct affine_sequence {
+  struct generator {
+    T init;
+    T step;
+    __device__ T operator()(size_type i) const { return init + static_cast<T>(i) * step; }
+  };
+
+  T init;
+  T step;
+  size_type size;
+
+  auto begin() const
+  {
+    return thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                           generator{init, step});
+  }
+  auto end() const { return begin() + size; }
+
+  std::unique_ptr<column> materialize(
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0) const
+  {
+    return materialize_sequence<decltype(begin()), T>(begin(), size, mr, stream);
+  }
+};
+
+/**
+ * @brief `size` copies of `value`
+ */
+template <typename T>
+struct constant_sequence {
+  T value;
+  size_type size;
+
+  auto begin() const { return thrust::make_constant_iterator(value); }
+  auto end() const { return begin() + size; }
+
+  std::unique_ptr<column> materialize(
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0) const
+  {
+    return materialize_sequence<decltype(begin()), T>(begin(), size, mr, stream);
+  }
+};
+
+/**
+ * @brief The row indices `0, 1, ...` of a table, row `i` repeated
+ * `offsets[i] - offsets[i - 1]` times, as `cudf::repeat` gathers them
+ *
+ * Each value is found by a binary search of the inclusive prefix sums of the repeat counts.
+ */
+struct repeat_sequence {
+  struct generator {
+    size_type const* offsets;
+    size_type num_rows;
+    __device__ size_type operator()(size_type i) const
+    {
+      return static_cast<size_type>(
+        thrust::upper_bound(thrust::seq, offsets, offsets + num_rows, i) - offsets);
+    }
+  };
+
+  size_type const* offsets;  ///< Device pointer to the inclusive prefix sums of the counts
+  size_type num_rows;
+  size_type size;  ///< The sum of the counts
+
+  auto begin() const
+  {
+    return thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                           generator{offsets, num_rows});
+  }
+  auto end() const { return begin() + size; }
+
+  std::unique_ptr<column> materialize(
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0) const
+  {
+    return materialize_sequence<decltype(begin()), size_type>(begin(), size, mr, stream);
+  }
+};
+
+}  // namespace detail
+}  // namespace cudf
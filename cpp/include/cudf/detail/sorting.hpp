@@ -16,9 +16,11 @@
 
 #pragma once
 
+#include <cudf/sorting.hpp>
 #include <cudf/types.hpp>
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace cudf {
@@ -61,5 +63,89 @@ std::unique_ptr<table> sort_by_key(
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource(),
   cudaStream_t stream                            = 0);
 
+/**
+ * @copydoc cudf::segmented_sorted_order
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> segmented_sorted_order(
+  table_view const& keys,
+  column_view const& segment_offsets,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource(),
+  cudaStream_t stream                            = 0);
+
+/**
+ * @copydoc cudf::segmented_sort_by_key
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> segmented_sort_by_key(
+  table_view const& values,
+  table_view const& keys,
+  column_view const& segment_offsets,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource(),
+  cudaStream_t stream                            = 0);
+
+/**
+ * @copydoc cudf::top_k_order
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> top_k_order(
+  column_view const& input,
+  size_type k,
+  order column_order                  = order::DESCENDING,
+  null_order null_precedence          = null_order::BEFORE,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::segmented_top_k_order
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> segmented_top_k_order(
+  column_view const& input,
+  column_view const& segment_offsets,
+  size_type k,
+  order column_order                  = order::DESCENDING,
+  null_order null_precedence          = null_order::BEFORE,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::rank(column_view const&, rank_method, order, null_policy, null_order, bool,
+ * sorted, rmm::mr::device_memory_resource*)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> rank(column_view const& input,
+                             rank_method method,
+                             order column_order,
+                             null_policy null_handling,
+                             null_order null_precedence,
+                             bool percentage,
+                             sorted is_sorted                    = sorted::NO,
+                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                             cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::segmented_rank
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> segmented_rank(
+  column_view const& input,
+  column_view const& segment_offsets,
+  rank_method method,
+  null_policy null_handling,
+  bool percentage,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 }  // namespace detail
 }  // namespace cudf
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cudf/column/column_view.hpp>
+#include <cudf/selection.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/types.hpp>
 
@@ -60,8 +61,11 @@ std::unique_ptr<table> apply_boolean_mask(
   cudaStream_t stream                 = 0);
 
 /**
- * @copydoc cudf::drop_duplicates
+ * @copydoc cudf::drop_duplicates(table_view const&, std::vector<size_type> const&,
+ * duplicate_keep_option, null_equality, rmm::mr::device_memory_resource*)
  *
+ * @param[in] keys_are_sorted Whether the rows of `input` are already sorted by the `keys` columns
+ * in ascending order with nulls before, so that they are not sorted again
  * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  */
 std::unique_ptr<table> drop_duplicates(
@@ -69,6 +73,7 @@ std::unique_ptr<table> drop_duplicates(
   std::vector<size_type> const& keys,
   duplicate_keep_option keep,
   null_equality nulls_equal           = null_equality::EQUAL,
+  sorted keys_are_sorted              = sorted::NO,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
@@ -91,5 +96,131 @@ cudf::size_type distinct_count(table_view const& input,
                                null_equality nulls_equal = null_equality::EQUAL,
                                cudaStream_t stream       = 0);
 
+/**
+ * @copydoc cudf::make_distinct_count_sketch
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> make_distinct_count_sketch(
+  column_view const& input,
+  int precision                       = 12,
+  null_policy null_handling           = null_policy::EXCLUDE,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::merge_distinct_count_sketches
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> merge_distinct_count_sketches(
+  std::vector<column_view> const& sketches,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::estimate_distinct_count
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+cudf::size_type estimate_distinct_count(column_view const& sketch, cudaStream_t stream = 0);
+
+/**
+ * @copydoc cudf::approx_distinct_count
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+cudf::size_type approx_distinct_count(column_view const& input,
+                                      int precision             = 12,
+                                      null_policy null_handling = null_policy::EXCLUDE,
+                                      cudaStream_t stream       = 0);
+
+/**
+ * @brief Estimates the number of distinct rows of a table from a HyperLogLog sketch of the hashes
+ * of its rows
+ *
+ * @param[in] input The table whose distinct rows are counted
+ * @param[in] precision Number of bits of the hash value indexing the sketch registers
+ * @param[in] null_handling With `null_policy::EXCLUDE`, the rows with a null element are not
+ * counted; otherwise nulls compare equal
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return The estimated number of distinct rows
+ */
+cudf::size_type approx_distinct_count(table_view const& input,
+                                      int precision             = 12,
+                                      null_policy null_handling = null_policy::EXCLUDE,
+                                      cudaStream_t stream       = 0);
+
+/**
+ * @copydoc cudf::make_selection(column_view const&, rmm::mr::device_memory_resource*)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<selection> make_selection(
+  column_view const& boolean_mask,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::make_selection(selection const&, column_view const&,
+ *                               rmm::mr::device_memory_resource*)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<selection> make_selection(
+  selection const& rows,
+  column_view const& boolean_mask,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::apply_selection
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> apply_selection(
+  table_view const& input,
+  selection const& rows,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Computes a null mask of `input` in which the rows not selected by `rows` are null.
+ *
+ * Operations that skip nulls, like reductions, can use the mask to operate on the selected rows
+ * of `input` without copying them. Bit `input.offset() + i` of the mask is the validity of row
+ * `i`, so the mask can replace the null mask of `input` in a `column_view` with the same offset.
+ *
+ * @throws cudf::logic_error if the sizes of `input` and `rows` mismatch.
+ *
+ * @param[in] input The column to mask
+ * @param[in] rows The selection of the rows to keep valid
+ * @param[in] mr Device memory resource used to allocate the returned bitmask
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ * @return The null mask and its null count
+ */
+std::pair<rmm::device_buffer, size_type> selection_null_mask(
+  column_view const& input,
+  selection const& rows,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Computes a null mask of `input` in which the rows for which `boolean_mask` is null or
+ * `false` are null.
+ *
+ * @see selection_null_mask(column_view const&, selection const&,
+ *                          rmm::mr::device_memory_resource*, cudaStream_t)
+ *
+ * @throws cudf::logic_error if `boolean_mask` is not `type_id::BOOL8` type.
+ * @throws cudf::logic_error if the sizes of `input` and `boolean_mask` mismatch.
+ */
+std::pair<rmm::device_buffer, size_type> selection_null_mask(
+  column_view const& input,
+  column_view const& boolean_mask,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 }  // namespace detail
 }  // namespace cudf
@@ -18,6 +18,8 @@
 
 #include <cudf/transform.hpp>
 
+#include <vector>
+
 namespace cudf {
 namespace detail {
 /**
@@ -33,6 +35,20 @@ std::unique_ptr<column> transform(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @copydoc cudf::transform(table_view const&, std::string const&, data_type, bool,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ **/
+std::unique_ptr<column> transform(
+  table_view const& inputs,
+  std::string const& udf,
+  data_type output_type,
+  bool is_ptx,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 /**
  * @copydoc cudf::nans_to_nulls
  *
@@ -52,5 +68,32 @@ std::pair<std::unique_ptr<rmm::device_buffer>, cudf::size_type> bools_to_mask(
   column_view const& input,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::compute_column
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ **/
+std::unique_ptr<column> compute_column(
+  table_view const& table,
+  expression const& expr,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Returns the indices of the columns of `table` that an expression tree refers to
+ *
+ * Only the types of the columns are used, so `table` may have no rows.
+ *
+ * @throws cudf::logic_error if the expression cannot be evaluated on `table`
+ *
+ * @param table The table the expression is to be evaluated on
+ * @param expr The root of the expression tree
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The indices of the columns, each once
+ **/
+std::vector<size_type> expression_columns(table_view const& table,
+                                          expression const& expr,
+                                          cudaStream_t stream = 0);
 }  // namespace detail
 }  // namespace cudf
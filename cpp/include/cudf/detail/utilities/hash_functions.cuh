@@ -17,6 +17,8 @@
 #pragma once
 
 #include <cudf/strings/string_view.cuh>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/wrappers/timestamps.hpp>
 
 using hash_value_type = uint32_t;
 
@@ -211,6 +213,454 @@ MurmurHash3_32<double>::operator()(double const& key) const
   return this->compute_floating_point(key);
 }
 
+/**
+ * @brief MurmurHash3_32 as computed by Spark's Murmur3Hash expression, so that rows hash and
+ * partition the same as in Spark.
+ *
+ * Spark hashes booleans and integers narrower than 4 bytes as 4-byte integers, hashes -0.0 as
+ * 0 and all NaNs as the canonical NaN, and mixes each byte of a string after its last 4-byte
+ * block as a signed 4-byte integer instead of as one final block.
+ */
+template <typename Key>
+struct SparkMurmurHash3_32 {
+  using argument_type = Key;
+  using result_type   = hash_value_type;
+
+  CUDA_HOST_DEVICE_CALLABLE SparkMurmurHash3_32() : m_seed(0) {}
+  CUDA_HOST_DEVICE_CALLABLE SparkMurmurHash3_32(uint32_t seed) : m_seed(seed) {}
+
+  CUDA_HOST_DEVICE_CALLABLE uint32_t rotl32(uint32_t x, int8_t r) const
+  {
+    return (x << r) | (x >> (32 - r));
+  }
+
+  CUDA_HOST_DEVICE_CALLABLE uint32_t fmix32(uint32_t h) const
+  {
+    h ^= h >> 16;
+    h *= 0x85ebca6b;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35;
+    h ^= h >> 16;
+    return h;
+  }
+
+  CUDA_HOST_DEVICE_CALLABLE uint32_t mix_k1(uint32_t k1) const
+  {
+    k1 *= 0xcc9e2d51;
+    k1 = rotl32(k1, 15);
+    return k1 * 0x1b873593;
+  }
+
+  CUDA_HOST_DEVICE_CALLABLE uint32_t mix_h1(uint32_t h1, uint32_t k1) const
+  {
+    h1 ^= k1;
+    h1 = rotl32(h1, 13);
+    return h1 * 5 + 0xe6546b64;
+  }
+
+  result_type CUDA_HOST_DEVICE_CALLABLE operator()(Key const& key) const { return compute(key); }
+
+  template <typename TKey>
+  result_type CUDA_HOST_DEVICE_CALLABLE compute(TKey const& key) const
+  {
+    return compute_bytes(reinterpret_cast<const uint8_t*>(&key), sizeof(TKey));
+  }
+
+  /**
+   * @brief Computes the hash value of `length` bytes starting at `data`.
+   */
+  result_type CUDA_HOST_DEVICE_CALLABLE compute_bytes(const uint8_t* data, int length) const
+  {
+    int const nblocks = length / 4;
+    uint32_t h1       = m_seed;
+    //----------
+    // body
+    for (int i = 0; i < nblocks; i++) {
+      auto const block = data + i * 4;
+      uint32_t const k1 =
+        block[0] | (block[1] << 8) | (block[2] << 16) | (static_cast<uint32_t>(block[3]) << 24);
+      h1 = mix_h1(h1, mix_k1(k1));
+    }
+    //----------
+    // tail: each byte is mixed as a sign-extended 4-byte block
+    for (int i = nblocks * 4; i < length; i++) {
+      auto const k1 = static_cast<uint32_t>(static_cast<int32_t>(static_cast<int8_t>(data[i])));
+      h1            = mix_h1(h1, mix_k1(k1));
+    }
+    //----------
+    // finalization
+    h1 ^= length;
+    return fmix32(h1);
+  }
+
+ private:
+  uint32_t m_seed;
+};
+
+template <>
+hash_value_type CUDA_HOST_DEVICE_CALLABLE
+SparkMurmurHash3_32<bool>::operator()(bool const& key) const
+{
+  return this->compute(static_cast<int32_t>(key));
+}
+
+template <>
+hash_value_type CUDA_HOST_DEVICE_CALLABLE
+SparkMurmurHash3_32<int8_t>::operator()(int8_t const& key) const
+{
+  return this->compute(static_cast<int32_t>(key));
+}
+
+template <>
+hash_value_type CUDA_HOST_DEVICE_CALLABLE
+SparkMurmurHash3_32<int16_t>::operator()(int16_t const& key) const
+{
+  return this->compute(static_cast<int32_t>(key));
+}
+
+template <>
+hash_value_type CUDA_HOST_DEVICE_CALLABLE
+SparkMurmurHash3_32<uint8_t>::operator()(uint8_t const& key) const
+{
+  return this->compute(static_cast<int32_t>(key));
+}
+
+template <>
+hash_value_type CUDA_HOST_DEVICE_CALLABLE
+SparkMurmurHash3_32<uint16_t>::operator()(uint16_t const& key) const
+{
+  return this->compute(static_cast<int32_t>(key));
+}
+
+// floats and doubles hash their bits as Java's floatToIntBits and doubleToLongBits
+template <>
+hash_value_type CUDA_HOST_DEVICE_CALLABLE
+SparkMurmurHash3_32<float>::operator()(float const& key) const
+{
+  if (key == 0.0f) { return this->compute(int32_t{0}); }
+  if (isnan(key)) { return this->compute(int32_t{0x7fc00000}); }
+  return this->compute(key);
+}
+
+template <>
+hash_value_type CUDA_HOST_DEVICE_CALLABLE
+SparkMurmurHash3_32<double>::operator()(double const& key) const
+{
+  if (key == 0.0) { return this->compute(int64_t{0}); }
+  if (isnan(key)) { return this->compute(int64_t{0x7ff8000000000000L}); }
+  return this->compute(key);
+}
+
+/**
+ * @brief Specialization of SparkMurmurHash3_32 operator for strings.
+ */
+template <>
+hash_value_type CUDA_HOST_DEVICE_CALLABLE
+SparkMurmurHash3_32<cudf::string_view>::operator()(cudf::string_view const& key) const
+{
+#ifndef __CUDA_ARCH__
+  CUDF_FAIL("Hashing a string in host code is not supported.");
+#else
+  return this->compute_bytes(reinterpret_cast<const uint8_t*>(key.data()), key.size_bytes());
+#endif
+}
+
+/**
+ * @brief The hash function of Hive, as computed by Spark's HiveHash expression, so that rows
+ * hash and bucket the same as in Hive.
+ *
+ * Integers of up to 4 bytes hash to their value and 8-byte values to the exclusive-or of
+ * their two halves. Floats and doubles hash their bits with -0.0 as 0, strings combine their
+ * signed bytes as `31 * hash + byte`, dates hash to their days and timestamps hash their
+ * seconds and nanoseconds as Hive's TimestampWritable.
+ */
+template <typename Key>
+struct HiveHash {
+  using argument_type = Key;
+  using result_type   = hash_value_type;
+
+  result_type CUDA_HOST_DEVICE_CALLABLE operator()(Key const& key) const { return compute(key); }
+
+  // 8-byte values hash to the exclusive-or of their halves
+  result_type CUDA_HOST_DEVICE_CALLABLE hash_long(int64_t value) const
+  {
+    auto const bits = static_cast<uint64_t>(value);
+    return static_cast<result_type>(bits ^ (bits >> 32));
+  }
+
+  template <typename T, typename std::enable_if_t<std::is_integral<T>::value>* = nullptr>
+  result_type CUDA_HOST_DEVICE_CALLABLE compute(T const& key) const
+  {
+    return sizeof(T) <= 4 ? static_cast<result_type>(static_cast<int32_t>(key))
+                          : hash_long(static_cast<int64_t>(key));
+  }
+
+  template <typename T, typename std::enable_if_t<cudf::is_timestamp<T>()>* = nullptr>
+  result_type CUDA_HOST_DEVICE_CALLABLE compute(T const& key) const
+  {
+    if (std::is_same<T, cudf::timestamp_D>::value) {
+      return static_cast<result_type>(key.time_since_epoch().count());
+    }
+    auto const micros = simt::std::chrono::duration_cast<simt::std::chrono::microseconds>(
+                          key.time_since_epoch())
+                          .count();
+    // seconds in the upper bits and the nanoseconds of the second in the lower 30 bits
+    int64_t const seconds = micros / 1000000;
+    int64_t const nanos   = (micros % 1000000) * 1000;
+    return hash_long((seconds << 30) | nanos);
+  }
+
+  // other fixed-width types hash the integer of their bytes
+  template <typename T,
+            typename std::enable_if_t<not std::is_integral<T>::value and
+                                      not cudf::is_timestamp<T>()>* = nullptr>
+  result_type CUDA_HOST_DEVICE_CALLABLE compute(T const& key) const
+  {
+    if (sizeof(T) <= 4) {
+      int32_t bits = 0;
+      memcpy(&bits, &key, sizeof(T) < sizeof(bits) ? sizeof(T) : sizeof(bits));
+      return static_cast<result_type>(bits);
+    }
+    int64_t bits = 0;
+    memcpy(&bits, &key, sizeof(T) < sizeof(bits) ? sizeof(T) : sizeof(bits));
+    return hash_long(bits);
+  }
+};
+
+// floats and doubles hash their bits as Java's floatToIntBits and doubleToLongBits
+template <>
+hash_value_type CUDA_HOST_DEVICE_CALLABLE HiveHash<float>::operator()(float const& key) const
+{
+  if (key == 0.0f) { return 0; }
+  if (isnan(key)) { return 0x7fc00000; }
+  int32_t bits;
+  memcpy(&bits, &key, sizeof(bits));
+  return static_cast<result_type>(bits);
+}
+
+template <>
+hash_value_type CUDA_HOST_DEVICE_CALLABLE HiveHash<double>::operator()(double const& key) const
+{
+  if (key == 0.0) { return 0; }
+  if (isnan(key)) { return this->hash_long(0x7ff8000000000000L); }
+  int64_t bits;
+  memcpy(&bits, &key, sizeof(bits));
+  return this->hash_long(bits);
+}
+
+/**
+ * @brief Specialization of HiveHash operator for strings.
+ */
+template <>
+hash_value_type CUDA_HOST_DEVICE_CALLABLE
+HiveHash<cudf::string_view>::operator()(cudf::string_view const& key) const
+{
+#ifndef __CUDA_ARCH__
+  CUDF_FAIL("Hashing a string in host code is not supported.");
+#else
+  result_type hash = 0;
+  auto const data  = key.data();
+  for (size_type i = 0; i < key.size_bytes(); ++i) {
+    hash = hash * 31 + static_cast<result_type>(static_cast<int32_t>(data[i]));
+  }
+  return hash;
+#endif
+}
+
+// xxHash64 implementation from
+// https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+//-----------------------------------------------------------------------------
+// xxHash is written by Yann Collet and is distributed under the BSD 2-Clause
+// license. It hashes 32 bytes per step in 4 independent 64-bit lanes and
+// produces 64-bit hash values, which collide far less often than 32-bit ones.
+template <typename Key>
+struct XXHash_64 {
+  using argument_type = Key;
+  using result_type   = uint64_t;
+
+  static constexpr uint64_t prime1 = 0x9E3779B185EBCA87UL;
+  static constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4FUL;
+  static constexpr uint64_t prime3 = 0x165667B19E3779F9UL;
+  static constexpr uint64_t prime4 = 0x85EBCA77C2B2AE63UL;
+  static constexpr uint64_t prime5 = 0x27D4EB2F165667C5UL;
+
+  CUDA_HOST_DEVICE_CALLABLE XXHash_64() : m_seed(0) {}
+
+  CUDA_HOST_DEVICE_CALLABLE uint64_t rotl64(uint64_t x, int8_t r) const
+  {
+    return (x << r) | (x >> (64 - r));
+  }
+
+  /**
+   * @brief Loads 8 bytes in little-endian order, with a single load when they are aligned.
+   */
+  CUDA_HOST_DEVICE_CALLABLE uint64_t load64(const uint8_t* p) const
+  {
+    if (reinterpret_cast<uintptr_t>(p) % sizeof(uint64_t) == 0) {
+      return *reinterpret_cast<const uint64_t*>(p);
+    }
+    uint64_t value = 0;
+    for (int i = 0; i < 8; ++i) { value |= static_cast<uint64_t>(p[i]) << (8 * i); }
+    return value;
+  }
+
+  /**
+   * @brief Loads 4 bytes in little-endian order, with a single load when they are aligned.
+   */
+  CUDA_HOST_DEVICE_CALLABLE uint32_t load32(const uint8_t* p) const
+  {
+    if (reinterpret_cast<uintptr_t>(p) % sizeof(uint32_t) == 0) {
+      return *reinterpret_cast<const uint32_t*>(p);
+    }
+    return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24);
+  }
+
+  CUDA_HOST_DEVICE_CALLABLE uint64_t round(uint64_t acc, uint64_t input) const
+  {
+    acc += input * prime2;
+    return rotl64(acc, 31) * prime1;
+  }
+
+  CUDA_HOST_DEVICE_CALLABLE uint64_t merge_round(uint64_t acc, uint64_t value) const
+  {
+    acc ^= round(0, value);
+    return acc * prime1 + prime4;
+  }
+
+  /**
+   * @brief  Combines two hash values into a new single hash value. Called
+   * repeatedly to create a hash value from several variables.
+   * The 64-bit variant of the Boost hash_combine function.
+   *
+   * @param lhs The first hash value to combine
+   * @param rhs The second hash value to combine
+   *
+   * @returns A hash value that intelligently combines the lhs and rhs hash values
+   */
+  CUDA_HOST_DEVICE_CALLABLE result_type hash_combine(result_type lhs, result_type rhs) const
+  {
+    result_type combined{lhs};
+
+    combined ^= rhs + 0x9e3779b97f4a7c15UL + (combined << 6) + (combined >> 2);
+
+    return combined;
+  }
+
+  result_type CUDA_HOST_DEVICE_CALLABLE operator()(Key const& key) const { return compute(key); }
+
+  // compute wrapper for floating point types
+  template <typename T, typename std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+  result_type CUDA_HOST_DEVICE_CALLABLE compute_floating_point(T const& key) const
+  {
+    if (key == T{0.0}) {
+      return compute(T{0.0});  // -0.0 and 0.0 hash the same
+    } else if (isnan(key)) {
+      T nan = std::numeric_limits<T>::quiet_NaN();
+      return compute(nan);
+    } else {
+      return compute(key);
+    }
+  }
+
+  template <typename TKey>
+  result_type CUDA_HOST_DEVICE_CALLABLE compute(TKey const& key) const
+  {
+    return compute_bytes(reinterpret_cast<const uint8_t*>(&key), sizeof(TKey));
+  }
+
+  /**
+   * @brief Computes the hash value of `length` bytes starting at `data`.
+   */
+  result_type CUDA_HOST_DEVICE_CALLABLE compute_bytes(const uint8_t* data, size_t length) const
+  {
+    const uint8_t* const end = data + length;
+    uint64_t h64;
+    //----------
+    // body: 32-byte stripes in 4 lanes
+    if (length >= 32) {
+      const uint8_t* const limit = end - 32;
+      uint64_t v1                = m_seed + prime1 + prime2;
+      uint64_t v2                = m_seed + prime2;
+      uint64_t v3                = m_seed;
+      uint64_t v4                = m_seed - prime1;
+      do {
+        v1 = round(v1, load64(data));
+        v2 = round(v2, load64(data + 8));
+        v3 = round(v3, load64(data + 16));
+        v4 = round(v4, load64(data + 24));
+        data += 32;
+      } while (data <= limit);
+
+      h64 = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+      h64 = merge_round(h64, v1);
+      h64 = merge_round(h64, v2);
+      h64 = merge_round(h64, v3);
+      h64 = merge_round(h64, v4);
+    } else {
+      h64 = m_seed + prime5;
+    }
+    h64 += static_cast<uint64_t>(length);
+    //----------
+    // tail
+    for (; data + 8 <= end; data += 8) {
+      h64 ^= round(0, load64(data));
+      h64 = rotl64(h64, 27) * prime1 + prime4;
+    }
+    if (data + 4 <= end) {
+      h64 ^= static_cast<uint64_t>(load32(data)) * prime1;
+      h64 = rotl64(h64, 23) * prime2 + prime3;
+      data += 4;
+    }
+    for (; data < end; ++data) {
+      h64 ^= static_cast<uint64_t>(*data) * prime5;
+      h64 = rotl64(h64, 11) * prime1;
+    }
+    //----------
+    // finalization
+    h64 ^= h64 >> 33;
+    h64 *= prime2;
+    h64 ^= h64 >> 29;
+    h64 *= prime3;
+    h64 ^= h64 >> 32;
+    return h64;
+  }
+
+ private:
+  uint64_t m_seed;
+};
+
+template <>
+uint64_t CUDA_HOST_DEVICE_CALLABLE XXHash_64<bool>::operator()(bool const& key) const
+{
+  return this->compute(static_cast<uint8_t>(key));
+}
+
+/**
+ * @brief Specialization of XXHash_64 operator for strings.
+ */
+template <>
+uint64_t CUDA_HOST_DEVICE_CALLABLE
+XXHash_64<cudf::string_view>::operator()(cudf::string_view const& key) const
+{
+#ifndef __CUDA_ARCH__
+  CUDF_FAIL("Hashing a string in host code is not supported.");
+#else
+  return this->compute_bytes(reinterpret_cast<const uint8_t*>(key.data()), key.size_bytes());
+#endif
+}
+
+template <>
+uint64_t CUDA_HOST_DEVICE_CALLABLE XXHash_64<float>::operator()(float const& key) const
+{
+  return this->compute_floating_point(key);
+}
+
+template <>
+uint64_t CUDA_HOST_DEVICE_CALLABLE XXHash_64<double>::operator()(double const& key) const
+{
+  return this->compute_floating_point(key);
+}
+
 /* --------------------------------------------------------------------------*/
 /**
  * @brief  This hash function simply returns the value that is asked to be hash
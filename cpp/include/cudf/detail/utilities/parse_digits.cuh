@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+/**
+ * @file parse_digits.cuh
+ * @brief Device functions parsing runs of decimal digits 8 characters at a time.
+ *
+ * The 8 characters are loaded into a 64-bit word, first character in the lowest byte,
+ * and are checked and converted with a few integer operations on the whole word
+ * instead of a branch and a multiply per character.
+ */
+
+#include <cstdint>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Maximum number of digits parsed by `parse_digits_chunk`.
+ */
+constexpr int digits_chunk_size = 8;
+
+/**
+ * @brief Returns 10 to the power of `exponent`, for `0 <= exponent <= digits_chunk_size`.
+ */
+__device__ inline uint64_t digits_chunk_scale(int exponent)
+{
+  uint64_t scale = 1;
+  while (exponent-- > 0) { scale *= 10; }
+  return scale;
+}
+
+/**
+ * @brief Parses the decimal digits at the beginning of `[begin, end)`, up to
+ * `digits_chunk_size` of them.
+ *
+ * Only the characters before `end` are read.
+ *
+ * @param begin First character to parse.
+ * @param end End of the characters.
+ * @param[out] value Value of the parsed digits.
+ * @return Number of digits parsed, 0 if `begin` is not a digit.
+ */
+__device__ inline int parse_digits_chunk(const char* begin, const char* end, uint64_t& value)
+{
+  auto const count = end - begin < digits_chunk_size ? static_cast<int>(end - begin)
+                                                     : digits_chunk_size;
+  // characters past the end are loaded as 0, which is not a digit
+  uint64_t chunk = 0;
+  for (int idx = 0; idx < count; ++idx) {
+    chunk |= static_cast<uint64_t>(static_cast<uint8_t>(begin[idx])) << (8 * idx);
+  }
+
+  // a byte is a digit when both it and the byte plus 6 are in [0x30,0x3F]; a carry out of a
+  // non-digit byte can only affect the bytes after it
+  uint64_t const not_digits =
+    ((chunk & 0xF0F0F0F0F0F0F0F0) ^ 0x3030303030303030) |
+    (((chunk + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) ^ 0x3030303030303030);
+  int const digits = not_digits == 0 ? digits_chunk_size : (__ffsll(not_digits) - 1) / 8;
+  if (digits == 0) { return 0; }
+
+  // shift the digits to the top so the bytes after them become leading zeros
+  chunk = (chunk - 0x3030303030303030) << (8 * (digits_chunk_size - digits));
+  // combine adjacent digits into 2-digit, then 4-digit, then the 8-digit value
+  chunk = (chunk * 10) + (chunk >> 8);
+  chunk = (((chunk & 0x000000FF000000FF) * (100 + (1000000ULL << 32))) +
+           (((chunk >> 16) & 0x000000FF000000FF) * (1 + (10000ULL << 32)))) >>
+          32;
+  value = chunk;
+  return digits;
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <cuda_runtime.h>
+
+#include <cstddef>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Migrates `size` bytes at `ptr` to the current device if they are managed memory
+ *
+ * Kernels touching managed memory that is not resident on the device fault its pages in one at a
+ * time, far slower than a bulk migration. When the memory resource allocates managed memory, e.g.
+ * to oversubscribe the device, prefetching the buffers an operation is about to read or write
+ * migrates them ahead of its kernels. Device and host memory are left alone, as is managed memory
+ * on devices without concurrent managed access, so the call costs only a pointer query otherwise.
+ *
+ * @param ptr The start of the range, nothing is done if null
+ * @param size The size of the range in bytes
+ * @param stream CUDA stream the migration is ordered on
+ */
+void prefetch(void const* ptr, std::size_t size, cudaStream_t stream = 0);
+
+/**
+ * @brief Migrates the data and null mask of a column and its children to the current device if
+ * they are managed memory
+ *
+ * Only the rows in the view are prefetched for fixed-width data and null masks; children are
+ * prefetched whole.
+ *
+ * @param input The column to prefetch
+ * @param stream CUDA stream the migration is ordered on
+ */
+void prefetch(column_view const& input, cudaStream_t stream = 0);
+
+/**
+ * @copydoc prefetch(column_view const&, cudaStream_t)
+ *
+ * @param input The table whose columns are prefetched
+ */
+void prefetch(table_view const& input, cudaStream_t stream = 0);
+
+}  // namespace detail
+}  // namespace cudf
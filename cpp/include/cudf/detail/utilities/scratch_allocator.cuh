@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/utilities/scratch_arena.hpp>
+
+#include <thrust/device_malloc_allocator.h>
+#include <thrust/device_vector.h>
+#include <thrust/system/cuda/execution_policy.h>
+
+#include <memory>
+#include <utility>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Thrust allocator drawing from the scratch resource of the thread that constructed it
+ *
+ * The counterpart of `rmm::rmm_allocator`, which always uses the default resource, for the
+ * temporaries of an operation. See `cudf::scratch_resource_scope`.
+ */
+template <typename T>
+class scratch_allocator : public thrust::device_malloc_allocator<T> {
+ public:
+  using pointer   = typename thrust::device_malloc_allocator<T>::pointer;
+  using size_type = typename thrust::device_malloc_allocator<T>::size_type;
+
+  template <typename U>
+  struct rebind {
+    using other = scratch_allocator<U>;
+  };
+
+  scratch_allocator(cudaStream_t stream = 0) : _stream{stream}, _mr{scratch_resource()} {}
+
+  template <typename U>
+  scratch_allocator(scratch_allocator<U> const& other)
+    : _stream{other.stream()}, _mr{other.resource()}
+  {
+  }
+
+  pointer allocate(size_type n)
+  {
+    return thrust::device_pointer_cast(static_cast<T*>(_mr->allocate(n * sizeof(T), _stream)));
+  }
+
+  void deallocate(pointer p, size_type n)
+  {
+    _mr->deallocate(thrust::raw_pointer_cast(p), n * sizeof(T), _stream);
+  }
+
+  cudaStream_t stream() const noexcept { return _stream; }
+
+  rmm::mr::device_memory_resource* resource() const noexcept { return _mr; }
+
+ private:
+  cudaStream_t _stream;
+  rmm::mr::device_memory_resource* _mr;
+};
+
+template <typename T, typename U>
+bool operator==(scratch_allocator<T> const& lhs, scratch_allocator<U> const& rhs)
+{
+  return lhs.resource()->is_equal(*rhs.resource());
+}
+
+template <typename T, typename U>
+bool operator!=(scratch_allocator<T> const& lhs, scratch_allocator<U> const& rhs)
+{
+  return not(lhs == rhs);
+}
+
+/**
+ * @brief Device vector for the temporaries of an operation, allocated from the scratch resource
+ */
+template <typename T>
+using scratch_vector = thrust::device_vector<T, scratch_allocator<T>>;
+
+using scratch_par_t = decltype(thrust::cuda::par(std::declval<scratch_allocator<char>&>()));
+
+/**
+ * @brief Returns a Thrust execution policy allocating temporary storage from the scratch resource
+ *
+ * Used like `rmm::exec_policy`: `thrust::sort(scratch_policy(stream)->on(stream), ...)`.
+ *
+ * @param stream The stream the temporary storage is allocated on
+ */
+inline auto scratch_policy(cudaStream_t stream = 0)
+{
+  auto* alloc  = new scratch_allocator<char>(stream);
+  auto deleter = [alloc](scratch_par_t* pointer) {
+    delete alloc;
+    delete pointer;
+  };
+  return std::unique_ptr<scratch_par_t, decltype(deleter)>{new scratch_par_t(*alloc), deleter};
+}
+
+}  // namespace detail
+}  // namespace cudf
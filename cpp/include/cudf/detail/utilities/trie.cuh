@@ -23,6 +23,8 @@
 #ifndef TRIE_CUH
 #define TRIE_CUH
 
+#include <algorithm>
+#include <cstdint>
 #include <deque>
 #include <string>
 #include <vector>
@@ -148,4 +150,42 @@ __host__ __device__ inline bool serializedTrieContains(const SerialTrieNode *tri
   return trie[curr_node].is_leaf;
 }
 
+/**
+ * @brief Create a mask of the lengths of the keys of a trie
+ *
+ * Bit `i` is set if a key is `i` characters long; bit 63 stands for all the lengths from 63 up.
+ * Bit 0 is always set, since `serializedTrieContains` looks up an empty string at the first node.
+ *
+ * @param[in] keys Array of strings inserted into the trie
+ *
+ * @return The mask of the key lengths
+ */
+inline uint64_t createTrieLengthMask(const std::vector<std::string> &keys)
+{
+  uint64_t mask = 1;
+  for (const auto &key : keys) { mask |= uint64_t{1} << std::min<size_t>(key.size(), 63); }
+  return mask;
+}
+
+/*
+ * @brief Searches for a string in a serialized trie, if any key has the string's length
+ *
+ * Most strings are rejected by the length check, without reading the trie.
+ *
+ * @param[in] trie Pointer to the array of nodes that make up the trie
+ * @param[in] key_lengths Mask of the key lengths, from `createTrieLengthMask`
+ * @param[in] key Pointer to the start of the string to find
+ * @param[in] key_len Length of the string to find
+ *
+ * @return Boolean value, true if string is found, false otherwise
+ */
+__host__ __device__ inline bool serializedTrieContains(const SerialTrieNode *trie,
+                                                       uint64_t key_lengths,
+                                                       const char *key,
+                                                       size_t key_len)
+{
+  if (((key_lengths >> (key_len < 63 ? key_len : 63)) & 1) == 0) { return false; }
+  return serializedTrieContains(trie, key, key_len);
+}
+
 #endif  // TRIE_CUH
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/device_buffer.hpp>
+
+#include <cuda_runtime.h>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Device memory holding the descriptors of a column or table device view
+ *
+ * Owned by the view through an opaque pointer, so the view stays trivially copyable. The buffer
+ * may be shared with other views of the same columns.
+ */
+struct view_descriptors {
+  std::shared_ptr<rmm::device_buffer> buffer;
+};
+
+/**
+ * @brief Copies the descriptors of a device view to device memory, ordered on `stream`
+ *
+ * `fill(h_ptr, d_ptr)` writes the `size` bytes of descriptors to the zeroed host memory at
+ * `h_ptr`, computing their device pointers from `d_ptr`, the address they are copied to. The
+ * descriptors are staged in pinned memory from `io::detail::pinned_memory_pool`, so the copy
+ * neither blocks the host nor is staged through a pageable bounce buffer, and the staging block is
+ * reused once the copy has completed.
+ *
+ * If `shareable` and `stream` is a default stream, descriptors equal to those of a recent call on
+ * the same device are not copied again: the device memory of that call is returned. They are
+ * compared as filled with a null `d_ptr`, so only views whose descriptors never change once copied
+ * may be shared, i.e. views of immutable columns. Other streams are never shared, since the cache
+ * could outlive them and would release the memory on a destroyed stream.
+ *
+ * `fill` is called once or twice; its last call always receives the returned buffer's address.
+ *
+ * @param size Size in bytes of the descriptors, must not be 0
+ * @param fill Writes the descriptors
+ * @param shareable Whether the descriptors may be shared with other views
+ * @param stream CUDA stream used for the device memory and the copy
+ * @return Device memory holding the descriptors
+ */
+std::shared_ptr<rmm::device_buffer> copy_view_descriptors(
+  std::size_t size,
+  std::function<void(void* h_ptr, void* d_ptr)> const& fill,
+  bool shareable,
+  cudaStream_t stream);
+
+}  // namespace detail
+}  // namespace cudf
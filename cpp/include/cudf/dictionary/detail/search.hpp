@@ -33,6 +33,27 @@ std::unique_ptr<numeric_scalar<int32_t>> get_index(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @brief Get the index at which a given key would be inserted into the dictionary's keys.
+ *
+ * This is the position of the first key that is not less than `key`, so the indices of the
+ * rows whose values are less than `key` are the ones less than the returned index. It is
+ * the index of `key` itself when `key` is one of the keys. The returned scalar is always valid.
+ *
+ * @throw cudf::logic_error if `key.type() != dictionary.keys().type()`
+ *
+ * @param dictionary The dictionary to search for the key.
+ * @param key The value to search for in the dictionary keyset.
+ * @param mr Device memory resource used to allocate the returned scalar's device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return Insert index of the key within the dictionary's keys
+ */
+std::unique_ptr<numeric_scalar<int32_t>> get_insert_index(
+  dictionary_column_view const& dictionary,
+  scalar const& key,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 }  // namespace detail
 }  // namespace dictionary
 }  // namespace cudf
@@ -18,6 +18,8 @@
 #include <cudf/column/column.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 
+#include <vector>
+
 namespace cudf {
 namespace dictionary {
 namespace detail {
@@ -83,6 +85,36 @@ std::unique_ptr<column> set_keys(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @brief Re-encodes dictionary columns with the union of their keys.
+ *
+ * Dictionary rows are hashed and compared by their indices, which identify the same values
+ * across columns only when the columns have the same keys. Each column is re-encoded with
+ * `add_keys`, which remaps its indices without searching its rows.
+ *
+ * Columns already sharing the same keys column are not copied.
+ *
+ * ```
+ * Example:
+ * d1 = {[a, b, d], [2, 0, 1]}
+ * d2 = {[b, c], [1, 0]}
+ * r = match_dictionaries([d1, d2])
+ * r.second is now [{[a, b, c, d], [3, 0, 1]}, {[a, b, c, d], [2, 1]}]
+ * ```
+ *
+ * @throw cudf::logic_error if the keys types of the columns are not the same
+ *
+ * @param input Dictionary columns to match.
+ * @param mr Device memory resource used to allocate the returned columns' device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The re-encoded columns, empty if none were copied, and views of the matched columns
+ *         in the order of `input`.
+ */
+std::pair<std::vector<std::unique_ptr<column>>, std::vector<column_view>> match_dictionaries(
+  std::vector<dictionary_column_view> const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 }  // namespace detail
 }  // namespace dictionary
 }  // namespace cudf
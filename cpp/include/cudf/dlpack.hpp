@@ -68,5 +68,50 @@ std::unique_ptr<table> from_dlpack(
 DLManagedTensor* to_dlpack(table_view const& input,
                            rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief View a DLPack DLTensor in device memory as a cudf table without copying
+ *
+ * The `device_type` of the DLTensor must be `kDLGPU` and `device_id` must
+ * match the current device. The tensor must be 1D or 2D column-major: if
+ * `strides` is not null, `strides[0]` must be 1 and `strides[1]` is the
+ * number of elements between the start of each column. The `dtype` must have
+ * 1 lane and the bitsize must match a supported `cudf::data_type`.
+ *
+ * @note The managed tensor is not deleted by this function and must outlive
+ * the returned view.
+ *
+ * @throw cudf::logic_error if the any of the DLTensor fields are unsupported
+ *
+ * @param managed_tensor a 1D or 2D column-major (Fortran order) tensor
+ *
+ * @return Table view of the tensor data
+ */
+table_view from_dlpack_view(DLManagedTensor const* managed_tensor);
+
+/**
+ * @brief Convert a cudf table into a DLPack DLTensor, viewing the table data
+ * when possible
+ *
+ * If the columns are evenly spaced in memory, as are the columns allocated
+ * together by `contiguous_split`, the tensor points at the table data and no
+ * memory is allocated for it. Otherwise the data is copied as by `to_dlpack`.
+ * The requirements on the input are those of `to_dlpack`.
+ *
+ * @note The `deleter` method of the returned `DLManagedTensor` must be used to
+ * free the memory allocated for the tensor. The input table data must outlive
+ * the tensor.
+ *
+ * @throw cudf::logic_error if the data types are not equal or not numeric,
+ * or if any of columns have non-zero null count
+ *
+ * @param input Table to convert to DLPack
+ * @param mr Device memory resource used to allocate the returned DLPack tensor's device memory
+ * if the data is copied.
+ *
+ * @return 1D or 2D DLPack tensor viewing or copying the table data, or nullptr
+ */
+DLManagedTensor* to_dlpack_view(
+  table_view const& input, rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/binaryop.hpp>
+#include <cudf/types.hpp>
+#include <cudf/unary.hpp>
+
+namespace cudf {
+namespace detail {
+class expression_linearizer;
+}  // namespace detail
+
+/**
+ * @addtogroup transformation_transform
+ * @{
+ */
+
+/**
+ * @brief A node of an expression tree evaluated by `compute_column()`.
+ *
+ * Expressions hold references to their operands, which must outlive them.
+ **/
+class expression {
+ public:
+  virtual ~expression() = default;
+
+  /**
+   * @brief Adds the operations computing this expression to `linearizer`.
+   *
+   * @return The index of the value of this expression in `linearizer`
+   **/
+  virtual size_type accept(detail::expression_linearizer& linearizer) const = 0;
+};
+
+/**
+ * @brief An expression whose value is the element of a column of the evaluated table.
+ **/
+class column_reference : public expression {
+ public:
+  /**
+   * @brief Construct a reference to a column of the evaluated table.
+   *
+   * @param column_index Index of the column in the table passed to `compute_column()`
+   **/
+  explicit column_reference(size_type column_index) : _column_index{column_index} {}
+
+  size_type column_index() const { return _column_index; }
+
+  size_type accept(detail::expression_linearizer& linearizer) const override;
+
+ private:
+  size_type _column_index;
+};
+
+/**
+ * @brief An expression whose value is a numeric scalar.
+ **/
+class literal : public expression {
+ public:
+  /**
+   * @brief Construct a literal of a numeric or boolean scalar.
+   *
+   * @param value The scalar, which must outlive the expression
+   **/
+  explicit literal(scalar const& value) : _value{value} {}
+
+  scalar const& value() const { return _value; }
+
+  size_type accept(detail::expression_linearizer& linearizer) const override;
+
+ private:
+  scalar const& _value;
+};
+
+/**
+ * @brief An expression applying a `unary_op` to another expression.
+ **/
+class unary_expression : public expression {
+ public:
+  unary_expression(unary_op op, expression const& input) : _op{op}, _input{input} {}
+
+  unary_op op() const { return _op; }
+  expression const& input() const { return _input; }
+
+  size_type accept(detail::expression_linearizer& linearizer) const override;
+
+ private:
+  unary_op _op;
+  expression const& _input;
+};
+
+/**
+ * @brief An expression applying a `binary_operator` to two other expressions.
+ **/
+class binary_expression : public expression {
+ public:
+  binary_expression(binary_operator op, expression const& lhs, expression const& rhs)
+    : _op{op}, _lhs{lhs}, _rhs{rhs}
+  {
+  }
+
+  binary_operator op() const { return _op; }
+  expression const& lhs() const { return _lhs; }
+  expression const& rhs() const { return _rhs; }
+
+  size_type accept(detail::expression_linearizer& linearizer) const override;
+
+ private:
+  binary_operator _op;
+  expression const& _lhs;
+  expression const& _rhs;
+};
+
+/**
+ * @brief An expression converting the value of another expression to a numeric type.
+ **/
+class cast_expression : public expression {
+ public:
+  cast_expression(data_type type, expression const& input) : _type{type}, _input{input} {}
+
+  data_type type() const { return _type; }
+  expression const& input() const { return _input; }
+
+  size_type accept(detail::expression_linearizer& linearizer) const override;
+
+ private:
+  data_type _type;
+  expression const& _input;
+};
+
+/** @} */  // end of group
+}  // namespace cudf
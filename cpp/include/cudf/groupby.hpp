@@ -17,13 +17,17 @@
 #pragma once
 
 #include <cudf/aggregation.hpp>
+#include <cudf/replace.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 
+#include <memory>
 #include <utility>
 #include <vector>
 
 namespace cudf {
+class hash_join;
+
 //! `groupby` APIs
 namespace groupby {
 namespace detail {
@@ -66,6 +70,93 @@ struct aggregation_result {
   std::vector<std::unique_ptr<column>> results{};
 };
 
+/**
+ * @brief The grouping of the rows of a table of keys, shared by grouped operations on the same keys
+ *
+ * The sorted order of the keys, the group offsets and the group labels are computed on first use
+ * and memoized, so that several grouped operations, e.g., a `groupby` aggregation, `get_groups`
+ * and `grouped_rolling_window`, pay for a single sort of the keys. Copies of a `grouping` share
+ * the memoized data.
+ *
+ * @note This object does *not* maintain the lifetime of `keys`. It is the user's responsibility to
+ * ensure the `grouping` object, and the objects it is passed to, do not outlive the data viewed by
+ * the `keys` `table_view`.
+ */
+class grouping {
+ public:
+  grouping() = delete;
+
+  /**
+   * @brief Construct the grouping of the rows of `keys`
+   *
+   * @param keys Table whose rows act as the groupby keys
+   * @param null_handling Indicates whether rows in `keys` that contain NULL values should be
+   * included
+   * @param keys_are_sorted Indicates whether rows in `keys` are already sorted
+   */
+  explicit grouping(table_view const& keys,
+                    null_policy null_handling = null_policy::EXCLUDE,
+                    sorted keys_are_sorted    = sorted::NO);
+
+  /**
+   * @brief Returns the number of groups
+   */
+  size_type num_groups() const;
+
+  /**
+   * @brief Returns the number of rows of the keys that belong to a group
+   *
+   * Rows with a NULL key do not belong to any group if NULL keys are excluded.
+   */
+  size_type num_grouped_rows() const;
+
+  /**
+   * @brief Returns the row indices of the keys, sorted by group
+   *
+   * The `num_grouped_rows()` indices list the rows of each group in turn, in the order of the
+   * groups; the rows of a group are in their original order. Rows that do not belong to any group
+   * are not listed.
+   */
+  column_view key_sort_order() const;
+
+  /**
+   * @brief Returns the `num_groups() + 1` offsets of the groups into `key_sort_order()`
+   */
+  column_view group_offsets() const;
+
+  /**
+   * @brief Returns the group of each row of `key_sort_order()`
+   */
+  column_view group_labels() const;
+
+  /**
+   * @brief Returns the keys the grouping was constructed with
+   */
+  table_view keys() const { return _keys; }
+
+  /**
+   * @brief Returns whether rows with NULL keys are included in the groups
+   */
+  null_policy null_handling() const { return _include_null_keys; }
+
+  /**
+   * @brief Returns whether the keys were declared sorted at construction
+   */
+  sorted keys_are_sorted() const { return _keys_are_sorted; }
+
+  /**
+   * @brief Returns the sort helper holding the memoized grouping
+   */
+  std::shared_ptr<detail::sort::sort_groupby_helper> const& helper() const { return _helper; }
+
+ private:
+  table_view _keys;                                      ///< Keys that determine grouping
+  null_policy _include_null_keys{null_policy::EXCLUDE};  ///< Include rows in keys
+                                                         ///< with NULLs
+  sorted _keys_are_sorted{sorted::NO};                   ///< Whether or not the keys are sorted
+  std::shared_ptr<detail::sort::sort_groupby_helper> _helper;  ///< Memoized grouping
+};
+
 /**
  * @brief Groups values by keys and computes aggregations on those groups.
  */
@@ -107,6 +198,31 @@ class groupby {
                    std::vector<order> const& column_order         = {},
                    std::vector<null_order> const& null_precedence = {});
 
+  /**
+   * @brief Construct a groupby object with the columns of `keys`, which are known to be sorted
+   * when `keys.sort_order()` leads with all of them, e.g. the keys returned by `sort` or `merge`.
+   *
+   * The keys known to be sorted are grouped as if `keys_are_sorted == YES`, with the column
+   * orders and null precedences of `keys.sort_order()`, so they are not sorted again.
+   *
+   * @note This object does *not* maintain the lifetime of `keys`.
+   *
+   * @param keys Table whose rows act as the groupby keys
+   * @param null_handling Indicates whether rows in `keys` that contain
+   * NULL values should be included
+   */
+  explicit groupby(table const& keys, null_policy null_handling = null_policy::EXCLUDE);
+
+  /**
+   * @brief Construct a groupby object sharing the memoized sort of the keys of `grouping`
+   *
+   * The aggregations use the sort-based implementation, which reuses the sorted order and group
+   * offsets that `grouping` computed for previous operations, and memoizes them for later ones.
+   *
+   * @param groups The grouping of the keys
+   */
+  explicit groupby(grouping const& groups);
+
   /**
    * @brief Performs grouped aggregations on the specified values.
    *
@@ -156,13 +272,42 @@ class groupby {
    * @param requests The set of columns to aggregate and the aggregations to
    * perform
    * @param mr Device memory resource used to allocate the returned table and columns' device memory
+   * @param stream CUDA stream used for device memory operations and kernel launches.
    * @return Pair containing the table with each group's unique key and
    * a vector of aggregation_results for each request in the same order as
    * specified in `requests`.
    */
   std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> aggregate(
     std::vector<aggregation_request> const& requests,
-    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0);
+
+  /**
+   * @brief Performs grouped aggregations on the rows selected by a boolean mask.
+   *
+   * The result is the same as the aggregation of the rows for which `boolean_mask` is non-null
+   * and `true`, e.g., after `apply_boolean_mask` on the keys and the values, but the hash-based
+   * implementation skips the other rows while aggregating instead of copying the selected rows.
+   * Groups with no selected row are not in the result.
+   *
+   * @throws cudf::logic_error If `boolean_mask` is not `type_id::BOOL8` type.
+   * @throws cudf::logic_error If `boolean_mask.size() != keys.num_rows()`.
+   * @throws cudf::logic_error If `requests[i].values.size() != keys.num_rows()`.
+   *
+   * @param requests The set of columns to aggregate and the aggregations to
+   * perform
+   * @param boolean_mask A nullable column of type type_id::BOOL8 selecting the rows to aggregate
+   * @param mr Device memory resource used to allocate the returned table and columns' device memory
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @return Pair containing the table with each group's unique key and
+   * a vector of aggregation_results for each request in the same order as
+   * specified in `requests`.
+   */
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> aggregate(
+    std::vector<aggregation_request> const& requests,
+    column_view const& boolean_mask,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0);
 
   /**
    * @brief The grouped data corresponding to a groupby operation on a set of values.
@@ -193,6 +338,40 @@ class groupby {
   groups get_groups(cudf::table_view values             = {},
                     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+  /**
+   * @brief Replaces the nulls of each group of the columns of `values` with the nearest non-null
+   * value of the group preceding or following them
+   *
+   * Within each group, the rows keep their order in `values`. If `replace_policies[i]` is
+   * `PRECEDING`, the nulls of column `i` are replaced with the last non-null value of their group
+   * before them: the last valid observation is carried forward. If it is `FOLLOWING`, they are
+   * replaced with the first non-null value of their group after them. Nulls with no such value
+   * stay null.
+   *
+   * @code{.pseudo}
+   * keys             = {1, 2, 1, 2, 1}
+   * values           = {{3, NULL, NULL, 5, NULL}}
+   * replace_policies = {PRECEDING}
+   *
+   * result.first  = {{1, 1, 1, 2, 2}}
+   * result.second = {{3, 3, 3, NULL, 5}}
+   * @endcode
+   *
+   * @throws cudf::logic_error if `values` and the keys have different numbers of rows
+   * @throws cudf::logic_error if `replace_policies` does not have one policy per column of
+   * `values`
+   *
+   * @param values Table of the columns whose nulls are replaced
+   * @param replace_policies The replace policy of each column of `values`
+   * @param mr Device memory resource used to allocate the returned tables' device memory
+   * @return Pair of the grouped keys and the grouped values with their nulls replaced, in the
+   * order of `get_groups`
+   */
+  std::pair<std::unique_ptr<table>, std::unique_ptr<table>> replace_nulls(
+    table_view const& values,
+    std::vector<replace_policy> const& replace_policies,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
  private:
   table_view _keys;                                      ///< Keys that determine grouping
   null_policy _include_null_keys{null_policy::EXCLUDE};  ///< Include rows in keys
@@ -203,7 +382,7 @@ class groupby {
   std::vector<null_order> _null_precedence{};            ///< If keys are sorted,
                                                          ///< indicates null order
                                                          ///< of each column
-  std::unique_ptr<detail::sort::sort_groupby_helper>
+  std::shared_ptr<detail::sort::sort_groupby_helper>
     _helper;  ///< Helper object
               ///< used by sort based implementation
 
@@ -221,6 +400,7 @@ class groupby {
    */
   std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> dispatch_aggregation(
     std::vector<aggregation_request> const& requests,
+    column_view const* boolean_mask,
     cudaStream_t stream,
     rmm::mr::device_memory_resource* mr);
 
@@ -229,6 +409,236 @@ class groupby {
     std::vector<aggregation_request> const& requests,
     cudaStream_t stream,
     rmm::mr::device_memory_resource* mr);
+
+  // Sort-based groupby of the rows selected by a boolean mask
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> filtered_sort_aggregate(
+    std::vector<aggregation_request> const& requests,
+    column_view const& boolean_mask,
+    cudaStream_t stream,
+    rmm::mr::device_memory_resource* mr);
+};
+
+/**
+ * @brief Accumulates grouped aggregations over a sequence of batches of rows
+ *
+ * Each batch passed to `update` is reduced to one row per group of partial results, e.g., a SUM
+ * and a COUNT for a MEAN. The groups of the batch are looked up in a hash table of the groups seen
+ * so far, kept between updates: the partial results of the groups found are combined in place,
+ * and the new groups are appended, which rebuilds the hash table. An update therefore costs
+ * time proportional to the size of the batch, plus the number of groups seen so far only when it
+ * brings new groups. `finalize` computes the requested aggregations from the partial results.
+ *
+ * VARIANCE and STD keep the count, the mean and the sum of squared deviations from the mean of
+ * each group, combined with the parallel formula of Chan et al., which does not lose precision
+ * to cancellation when the mean is large relative to the deviations.
+ *
+ * The partial results of accumulators built with the same aggregations, e.g., on different
+ * devices or over different streams of batches, can be combined with `merge`.
+ *
+ * Only aggregations whose partial results can be merged are supported: SUM, SUM_OF_SQUARES, MIN,
+ * MAX, COUNT_VALID, COUNT_ALL, and, on numeric values, MEAN, VARIANCE and STD.
+ *
+ * Example:
+ * ```
+ * aggregations: {{SUM, MEAN}}
+ *
+ * update(keys: {1 2 1}, values: {{3 1 4}})
+ * update(keys: {2 3}, values: {{5 9}})
+ *
+ * finalize():
+ * keys:   {1 2 3}
+ * values:
+ *   SUM:  {7 6 9}
+ *   MEAN: {3.5 3 9}
+ * ```
+ */
+class groupby_accumulator {
+ public:
+  groupby_accumulator() = delete;
+  ~groupby_accumulator();
+  groupby_accumulator(groupby_accumulator const&) = delete;
+  groupby_accumulator(groupby_accumulator&&);
+  groupby_accumulator& operator=(groupby_accumulator const&) = delete;
+  groupby_accumulator& operator=(groupby_accumulator&&);
+
+  /**
+   * @brief Construct an accumulator computing the specified aggregations
+   *
+   * @throws cudf::logic_error If an aggregation is not supported
+   *
+   * @param aggregations The aggregations to compute on each column of values, in the order of the
+   * columns of the `values` passed to `update`
+   * @param null_handling Indicates whether rows in `keys` that contain NULL values should be
+   * included
+   */
+  explicit groupby_accumulator(
+    std::vector<std::vector<std::unique_ptr<aggregation>>> const& aggregations,
+    null_policy null_handling = null_policy::EXCLUDE);
+
+  /**
+   * @brief Aggregates a batch of rows into the partial results
+   *
+   * @throws cudf::logic_error If `keys` and `values` have a different number of rows
+   * @throws cudf::logic_error If the number of columns of `values` does not match the number of
+   * columns of aggregations
+   * @throws cudf::logic_error If the column types differ from those of the previous batches
+   *
+   * @param keys Table whose rows act as the groupby keys of the batch
+   * @param values Table of the values to aggregate
+   */
+  void update(table_view const& keys, table_view const& values);
+
+  /**
+   * @brief Merges the partial results of `other` into the partial results of this accumulator
+   *
+   * @throws cudf::logic_error If `other` was not constructed with the same aggregations
+   * @throws cudf::logic_error If the column types of `other` differ from those of this accumulator
+   *
+   * @param other The accumulator to merge
+   */
+  void merge(groupby_accumulator const& other);
+
+  /**
+   * @brief Computes the aggregations of all the rows accumulated so far
+   *
+   * The accumulator is not modified and can be updated further.
+   *
+   * @throws cudf::logic_error If `update` was never called
+   *
+   * @param mr Device memory resource used to allocate the returned table and columns' device memory
+   * @return Pair containing the table with each group's unique key and a vector of
+   * aggregation_results for each column of values, in the order of the aggregations given to the
+   * constructor
+   */
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> finalize(
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) const;
+
+ private:
+  std::vector<std::vector<std::unique_ptr<aggregation>>> _aggregations;  ///< Requested
+                                                                         ///< aggregations
+  std::vector<std::vector<aggregation::Kind>> _partial_kinds;  ///< Partial results kept for
+                                                               ///< each column of values
+  null_policy _include_null_keys{null_policy::EXCLUDE};        ///< Include rows in keys
+                                                               ///< with NULLs
+  std::unique_ptr<table> _keys;                                ///< Keys of the groups seen so far
+  std::unique_ptr<hash_join> _key_index;                       ///< Hash table of `_keys`
+  std::vector<std::vector<std::unique_ptr<column>>> _partials;  ///< Partial results of each group
+
+  /**
+   * @brief Merges batch partial results into the partial results of the accumulator
+   *
+   * Each group must appear once in `keys`.
+   */
+  void merge_partials(table_view const& keys,
+                      std::vector<std::vector<column_view>> const& partials);
+
+  /**
+   * @brief Appends groups that are not in the accumulator yet, with their partial results, and
+   * rebuilds the hash table of the keys
+   */
+  void append_groups(table_view const& keys,
+                     std::vector<std::vector<column_view>> const& partials);
+};
+
+/**
+ * @brief Aggregates a stream of chunks of rows sorted by their keys, one chunk at a time
+ *
+ * The chunks are the consecutive parts of a table sorted by its keys, e.g. the batches of a
+ * sorted file or of an append-only log. Each chunk is aggregated as keys known to be sorted: the
+ * groups are the runs of equal keys, found by comparing adjacent rows, and are reduced in place
+ * without sorting or hashing the keys.
+ *
+ * `update` returns the aggregations of the groups a chunk completes. The rows of the last group
+ * of a chunk, which the next chunk may continue, are carried over and aggregated with the rows of
+ * the next chunk that continue it. Only the rows of one group are kept between chunks, and any
+ * aggregation supported by `groupby` is computed exactly, since no group is split. `finish`
+ * returns the aggregations of the last group.
+ *
+ * Example:
+ * ```
+ * aggregations: {{SUM}}
+ *
+ * update(keys: {1 1 2}, values: {{3 1 4}})  ->  keys: {1}, SUM: {4}
+ * update(keys: {2 2 3}, values: {{5 9 2}})  ->  keys: {2}, SUM: {18}
+ * finish()                                  ->  keys: {3}, SUM: {2}
+ * ```
+ */
+class sorted_groupby_stream {
+ public:
+  sorted_groupby_stream() = delete;
+  ~sorted_groupby_stream();
+  sorted_groupby_stream(sorted_groupby_stream const&) = delete;
+  sorted_groupby_stream(sorted_groupby_stream&&);
+  sorted_groupby_stream& operator=(sorted_groupby_stream const&) = delete;
+  sorted_groupby_stream& operator=(sorted_groupby_stream&&);
+
+  /**
+   * @brief Construct a stream computing the specified aggregations
+   *
+   * @param aggregations The aggregations to compute on each column of values, in the order of the
+   * columns of the `values` passed to `update`
+   * @param null_handling Indicates whether rows in `keys` that contain NULL values should be
+   * included
+   * @param column_order Indicates whether each column of the keys is ascending/descending. If
+   * empty, assumes all columns are ascending.
+   * @param null_precedence Indicates the ordering of null values in each column of the keys. If
+   * empty, assumes all columns use `null_order::BEFORE`.
+   */
+  explicit sorted_groupby_stream(
+    std::vector<std::vector<std::unique_ptr<aggregation>>> const& aggregations,
+    null_policy null_handling                      = null_policy::EXCLUDE,
+    std::vector<order> const& column_order         = {},
+    std::vector<null_order> const& null_precedence = {});
+
+  /**
+   * @brief Aggregates the groups completed by the next chunk of rows
+   *
+   * @throws cudf::logic_error If `keys` and `values` have a different number of rows
+   * @throws cudf::logic_error If the number of columns of `values` does not match the number of
+   * columns of aggregations
+   * @throws cudf::logic_error If the column types differ from those of the previous chunks
+   *
+   * @param keys Table whose rows act as the groupby keys of the chunk, sorted as the keys of the
+   * previous chunks and following them
+   * @param values Table of the values to aggregate
+   * @param mr Device memory resource used to allocate the returned table and columns' device memory
+   * @return Pair containing the table with the key of each completed group and a vector of
+   * aggregation_results for each column of values, in the order of the aggregations given to the
+   * constructor
+   */
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> update(
+    table_view const& keys,
+    table_view const& values,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Aggregates the group carried over from the last chunk
+   *
+   * The stream is then empty and can aggregate a new sequence of chunks.
+   *
+   * @throws cudf::logic_error If `update` was never called
+   *
+   * @param mr Device memory resource used to allocate the returned table and columns' device memory
+   * @return Pair containing the table with the key of the last group, if any, and a vector of
+   * aggregation_results for each column of values
+   */
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> finish(
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+ private:
+  std::vector<std::vector<std::unique_ptr<aggregation>>> _aggregations;  ///< Requested
+                                                                         ///< aggregations
+  null_policy _include_null_keys{null_policy::EXCLUDE};  ///< Include rows in keys with NULLs
+  std::vector<order> _column_order;                      ///< Order of each column of the keys
+  std::vector<null_order> _null_precedence;              ///< Order of the nulls of the keys
+  std::unique_ptr<table> _carry;  ///< Keys then values of the rows of the last group seen,
+                                  ///< null before the first update
+
+  /**
+   * @brief Aggregates rows whose keys are sorted
+   */
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> aggregate(
+    table_view const& keys, table_view const& values, rmm::mr::device_memory_resource* mr) const;
 };
 /** @} */
 }  // namespace groupby
@@ -27,7 +27,18 @@ namespace cudf {
 /**
  * @brief Computes the hash value of each row in the input set of columns.
  *
+ * The hash values are INT32 for `hash_id::HASH_MURMUR3` and UINT64 for
+ * `hash_id::HASH_XXHASH64`.
+ *
+ * `hash_id::HASH_SPARK_MURMUR3` and `hash_id::HASH_HIVE` compute the INT32 hash values of
+ * Spark's `hash` function and of Hive's bucketing. Null elements are skipped by the former and
+ * hash to 0 with the latter. They do not take initial hash values.
+ *
+ * @throw cudf::logic_error if `initial_hash` is not empty for `hash_id::HASH_SPARK_MURMUR3` or
+ * `hash_id::HASH_HIVE`
+ *
  * @param input The table of columns to hash
+ * @param hash_function The hash function to use
  * @param initial_hash Optional vector of initial hash values for each column.
  * If this vector is empty then each element will be hashed as-is.
  * @param mr Device memory resource used to allocate the returned column's device memory.
@@ -35,6 +46,7 @@ namespace cudf {
  * @returns A column where each row is the hash of a column from the input
  */
 std::unique_ptr<column> hash(table_view const& input,
+                             hash_id hash_function                     = hash_id::HASH_MURMUR3,
                              std::vector<uint32_t> const& initial_hash = {},
                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
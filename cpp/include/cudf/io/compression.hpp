@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file compression.hpp
+ * @brief cuDF-IO device buffer compression API
+ */
+
+#pragma once
+
+#include "types.hpp"
+
+#include <rmm/device_buffer.hpp>
+
+#include <memory>
+
+namespace cudf {
+namespace io {
+/**
+ * @addtogroup io_compression
+ * @{
+ */
+
+/**
+ * @brief Compresses a device buffer, such as the `all_data` buffer of a
+ * `contiguous_split_result` that is about to be spilled or sent over the network
+ *
+ * The input is split into fixed-size chunks that are compressed independently on the GPU. The
+ * output holds a small header with the chunk sizes, followed by the compressed chunks; chunks
+ * that do not compress are stored as is. The result can only be read back with
+ * `decompress_buffer()` using the same compression type.
+ *
+ * @throw cudf::logic_error if the compression type is not one of `SNAPPY`, `ZSTD` or `LZ4`
+ *
+ * @param type Compression type
+ * @param input Device buffer to compress
+ * @param mr Device memory resource used to allocate the returned buffer
+ *
+ * @return Compressed device buffer
+ */
+std::unique_ptr<rmm::device_buffer> compress_buffer(
+  compression_type type,
+  rmm::device_buffer const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Decompresses a device buffer produced by `compress_buffer()`
+ *
+ * @throw cudf::logic_error if the compression type is not one of `SNAPPY`, `ZSTD` or `LZ4`
+ * @throw cudf::logic_error if the input is not a valid compressed buffer
+ *
+ * @param type Compression type used to compress the buffer
+ * @param input Compressed device buffer
+ * @param mr Device memory resource used to allocate the returned buffer
+ *
+ * @return Decompressed device buffer
+ */
+std::unique_ptr<rmm::device_buffer> decompress_buffer(
+  compression_type type,
+  rmm::device_buffer const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/** @} */  // end of group
+}  // namespace io
+}  // namespace cudf
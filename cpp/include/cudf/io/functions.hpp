@@ -30,6 +30,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 //! cuDF interfaces
@@ -111,7 +112,8 @@ table_with_metadata read_avro(
 struct read_json_args {
   source_info source;
 
-  ///< Data types of the column; empty to infer dtypes
+  ///< Data types of the column; empty to infer dtypes. A "category" column is read as a
+  ///< DICTIONARY32 column of strings
   std::vector<std::string> dtype;
   /// Specify the compression format of the source or infer from file extension
   compression_type compression = compression_type::AUTO;
@@ -146,6 +148,9 @@ struct read_json_args {
  *  auto result = cudf::read_json(args);
  * @endcode
  *
+ * When the source holds several files or buffers, their records are read into a single table, in
+ * the order of the sources. Byte ranges are not supported with multiple sources.
+ *
  * @param args Settings for controlling reading behavior
  * @param mr Device memory resource used to allocate device memory of the table in the returned
  * table_with_metadata
@@ -227,8 +232,13 @@ struct read_csv_args {
 
   // Conversion settings
 
-  /// Per-column types; disables type inference on those columns
+  /// Per-column types; disables type inference on those columns. A "category" column is read as
+  /// a DICTIONARY32 column of strings
   std::vector<std::string> dtype;
+  /// Number of rows, evenly spread across the data, sampled to infer the column types; 0 is all
+  /// rows. Sampling speeds up the reading of wide files, but columns whose sampled values all
+  /// look like numbers are read as numbers, with non-numeric values read as invalid
+  size_type dtype_sample_rows = 0;
   /// Additional values to recognize as boolean true values
   std::vector<std::string> true_values;
   /// Additional values to recognize as boolean false values
@@ -263,6 +273,10 @@ struct read_csv_args {
  *  auto result = cudf::read_csv(args);
  * @endcode
  *
+ * When the source holds several files or buffers, their rows are read into a single table, in the
+ * order of the sources. Each source starts with its own header rows, if any. Byte ranges and row
+ * selection are not supported with multiple sources.
+ *
  * @param args Settings for controlling reading behavior
  * @param mr Device memory resource used to allocate device memory of the table in the returned
  * table_with_metadata
@@ -272,6 +286,83 @@ struct read_csv_args {
 table_with_metadata read_csv(read_csv_args const& args,
                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+namespace detail {
+namespace csv {
+/**
+ * @brief Forward declaration of the CSV reader class
+ */
+class reader;
+}  // namespace csv
+}  // namespace detail
+
+/**
+ * @brief Reads a CSV dataset as a sequence of tables, each made of the rows starting within a
+ * fixed number of bytes
+ *
+ * @ingroup io_readers
+ *
+ * Only the data of the current chunk, along with enough data to complete its last row, is loaded
+ * to the device, so that datasets larger than device memory can be read with constant memory
+ * usage. Each chunk starts exactly at the row that follows the last row of the previous chunk,
+ * so quoted fields spanning several lines are handled like in a whole-file read. The next chunk
+ * is loaded from the source while the current one is converted.
+ *
+ * The header is only parsed in the first chunk, and the column types inferred from the first
+ * chunk are used for all the chunks; set `dtype` if the first chunk is not representative of the
+ * whole dataset.
+ *
+ * The following code snippet demonstrates how to read a large file in bounded pieces:
+ * @code
+ *  ...
+ *  cudf::io::read_csv_args args{cudf::io::source_info("dataset.csv")};
+ *  cudf::io::chunked_csv_reader reader(args, 256 << 20);
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *    ...
+ *  }
+ * @endcode
+ */
+class chunked_csv_reader {
+ public:
+  /**
+   * @brief Constructor for the chunked reader
+   *
+   * @throw cudf::logic_error if a byte range or rows to skip or read are set in `args`
+   *
+   * @param args Settings for controlling reading behavior; byte range and row selection are not
+   * supported
+   * @param chunk_size Number of bytes of data in which the rows of each chunk start, or `0` to
+   * read everything in a single chunk
+   * @param mr Device memory resource used to allocate device memory of the returned tables
+   */
+  chunked_csv_reader(read_csv_args const& args,
+                     size_t chunk_size,
+                     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~chunked_csv_reader();
+
+  /**
+   * @brief Returns whether there are chunks left to read
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Reads the next chunk of rows
+   *
+   * @throw cudf::logic_error if there are no chunks left to read
+   *
+   * @return The next table along with metadata
+   */
+  table_with_metadata read_chunk();
+
+ private:
+  std::unique_ptr<detail::csv::reader> _reader;
+  size_t _chunk_size;
+};
+
 /**
  * @brief Settings to use for `write_csv()`
  *
@@ -341,6 +432,65 @@ struct write_csv_args : detail::csv::writer_options {
 void write_csv(write_csv_args const& args,
                rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Settings to use for `write_json()`
+ *
+ * @ingroup io_writers
+ */
+struct write_json_args {
+  /// Specify the sink to use for writer output
+  sink_info sink;
+  /// Set of columns to output
+  table_view table;
+  /// Optional associated metadata, whose column names are the keys of the objects
+  const table_metadata* metadata = nullptr;
+  /// Writes one object per line (JSON Lines) if true, an array of the objects otherwise
+  bool lines = true;
+  /// Writes the null fields of a row as `null` if true, leaves them out of its object otherwise
+  bool include_nulls = true;
+  /// Maximum number of rows formatted and written at once
+  size_type rows_per_chunk = 1000000;
+
+  write_json_args() = default;
+
+  explicit write_json_args(sink_info const& snk,
+                           table_view const& table_,
+                           const table_metadata* metadata_ = nullptr,
+                           bool lines_                     = true)
+    : sink(snk), table(table_), metadata(metadata_), lines(lines_)
+  {
+  }
+};
+
+/**
+ * @brief Writes a set of columns to JSON format
+ *
+ * @ingroup io_writers
+ *
+ * Each row is written as an object whose keys are the column names, or the column indices
+ * without metadata. Strings are escaped, timestamps written as ISO 8601 strings, durations as
+ * their count of ticks, and non-finite floating-point values as `null`. List columns become
+ * arrays, nested as deeply as the lists are.
+ *
+ * The rows are formatted on the device and written to the sink by chunks of
+ * `rows_per_chunk` rows.
+ *
+ * The following code snippet demonstrates how to write columns to a file:
+ * @code
+ *  #include <cudf/io/functions.hpp>
+ *  ...
+ *  std::string filepath = "dataset.json";
+ *  cudf::io::write_json_args args{cudf::io::sink_info(filepath), table->view(), &metadata};
+ *  ...
+ *  cudf::io::write_json(args);
+ * @endcode
+ *
+ * @param args Settings for controlling writing behavior
+ * @param mr Device memory resource to use for device memory allocation
+ */
+void write_json(write_json_args const& args,
+                rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Settings to use for `read_orc()`
  *
@@ -349,7 +499,8 @@ void write_csv(write_csv_args const& args,
 struct read_orc_args {
   source_info source;
 
-  /// Names of column to read; empty is all
+  /// Names of column to read; empty is all. Nested fields are named by their dotted path
+  /// (`a.b.c`), and the path of a struct reads all the leaves below it
   std::vector<std::string> columns;
 
   /// Stripe to read; -1 is all
@@ -377,6 +528,14 @@ struct read_orc_args {
   /// -1 is auto (column scale), >=0: number of fractional digits
   int forced_decimals_scale = -1;
 
+  /// Whether to return string columns as DICTIONARY32 columns, keeping the stripes' dictionary
+  /// encoding instead of expanding it
+  bool strings_to_dictionary = false;
+
+  /// Skip stripes and row groups whose statistics cannot satisfy the filter (ignored if empty);
+  /// `skip_rows` and `num_rows` then apply to the rows of the remaining stripes
+  predicate_filter filters;
+
   read_orc_args() = default;
 
   explicit read_orc_args(source_info const& src) : source(src) {}
@@ -405,13 +564,120 @@ struct read_orc_args {
 table_with_metadata read_orc(read_orc_args const& args,
                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Reads an ORC dataset into a set of columns partitioned for distribution
+ *
+ * @ingroup io_readers
+ *
+ * The rows are partitioned as `hash_partition` or `round_robin_partition` would partition the
+ * table returned by `read_orc()`. The partitioned order of the rows is computed once from the
+ * hashed columns, then each column read is copied in that order and released right away, so the
+ * peak memory use is that of the table plus one column, rather than of two tables.
+ *
+ * The following code snippet demonstrates how to read a dataset hash partitioned on its first
+ * column:
+ * @code
+ *  ...
+ *  cudf::io::read_partitioning partitioning;
+ *  partitioning.num_partitions  = num_gpus;
+ *  partitioning.columns_to_hash = {0};
+ *  auto result = cudf::io::read_orc_partitioned(args, partitioning);
+ *  // Partition i is the rows [result.partition_offsets[i], result.partition_offsets[i + 1])
+ * @endcode
+ *
+ * @throw cudf::logic_error if `partitioning.num_partitions` is not positive
+ * @throw std::out_of_range if an index of `partitioning.columns_to_hash` is invalid
+ *
+ * @param args Settings for controlling reading behavior
+ * @param partitioning Partitioning of the rows read
+ * @param mr Device memory resource used to allocate device memory of the table in the returned
+ * partitioned_table_with_metadata
+ *
+ * @return The partitioned columns and the offsets of the partitions
+ */
+partitioned_table_with_metadata read_orc_partitioned(
+  read_orc_args const& args,
+  read_partitioning const& partitioning,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief One reader's share of a dataset, as assigned by `plan_orc_read()` or
+ * `plan_parquet_read()`
+ *
+ * @ingroup io_readers
+ */
+struct read_partition {
+  /// Indices of the stripes or row groups to read, per source
+  std::vector<std::vector<size_type>> blocks;
+  /// Number of rows in the assigned blocks
+  size_t num_rows = 0;
+  /// Number of bytes read from the sources
+  size_t compressed_size = 0;
+  /// Estimated size of the decoded columns in bytes
+  size_t uncompressed_size = 0;
+};
+
+/**
+ * @brief Assigns the stripes of an ORC dataset to a number of readers
+ *
+ * @ingroup io_readers
+ *
+ * Each partition is a contiguous range of stripes, in source and file order, and partitions are
+ * balanced by the sum of the compressed and estimated decoded sizes of their stripes. Reading
+ * each partition with `read_orc(args, partition)` and concatenating the results in partition
+ * order returns all the rows of the dataset. Partitions are empty if there are fewer stripes
+ * than readers.
+ *
+ * Only the file metadata is read. The plan only depends on the dataset and `args`, so each reader
+ * can compute it independently and read its own partition.
+ *
+ * The following code snippet demonstrates how each of `num_gpus` processes reads its share:
+ * @code
+ *  ...
+ *  cudf::io::read_orc_args args{cudf::io::source_info(filepaths)};
+ *  auto partitions = cudf::io::plan_orc_read(args, num_gpus);
+ *  auto result     = cudf::io::read_orc(args, partitions[rank]);
+ * @endcode
+ *
+ * @throw cudf::logic_error if `args` selects stripes or rows
+ * @throw cudf::logic_error if `num_partitions` is not positive
+ *
+ * @param args Settings for controlling reading behavior; only columns and filters are supported
+ * @param num_partitions Number of readers
+ *
+ * @return One partition per reader
+ */
+std::vector<read_partition> plan_orc_read(read_orc_args const& args, size_type num_partitions);
+
+/**
+ * @brief Reads one partition of an ORC dataset into a set of columns
+ *
+ * @ingroup io_readers
+ *
+ * Unlike `read_orc()`, the dataset may consist of multiple sources; the sources of the
+ * partition are read one at a time and concatenated.
+ *
+ * @throw cudf::logic_error if the partition does not list stripes for each source
+ *
+ * @param args Settings for controlling reading behavior; stripe and row selections are ignored
+ * @param partition Stripes to read, as returned by `plan_orc_read()`
+ * @param mr Device memory resource used to allocate device memory of the table in the returned
+ * table_with_metadata
+ *
+ * @return The set of columns
+ */
+table_with_metadata read_orc(read_orc_args const& args,
+                             read_partition const& partition,
+                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Settings to use for `read_parquet()`
  */
 struct read_parquet_args {
   source_info source;
 
-  /// Names of column to read; empty is all
+  /// Names of column to read; empty is all. Nested fields are named by their dotted path
+  /// (`a.b.c`), and the path of a group reads all the leaves below it
   std::vector<std::string> columns;
 
   /// List of individual row groups to read (ignored if empty)
@@ -423,11 +689,22 @@ struct read_parquet_args {
 
   /// Whether to store string data as categorical type
   bool strings_to_categorical = false;
+  /// Whether to return string columns as DICTIONARY32 columns, keeping the file's dictionary
+  /// encoding instead of expanding it
+  bool strings_to_dictionary = false;
   /// Whether to use PANDAS metadata to load columns
   bool use_pandas_metadata = true;
   /// Cast timestamp columns to a specific type
   data_type timestamp_type{type_id::EMPTY};
 
+  /// Skip row groups whose statistics cannot satisfy the filter (ignored if empty);
+  /// `skip_rows` and `num_rows` then apply to the rows of the remaining row groups
+  predicate_filter filters;
+  /// Whether to also drop the rows of the remaining row groups that do not satisfy `filters`;
+  /// the filter columns are decoded first, and the other columns only for the row groups with
+  /// rows left
+  bool filter_rows = false;
+
   explicit read_parquet_args() = default;
 
   explicit read_parquet_args(source_info const& src) : source(src) {}
@@ -457,6 +734,180 @@ table_with_metadata read_parquet(
   read_parquet_args const& args,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Reads a Parquet dataset into a set of columns partitioned for distribution
+ *
+ * @ingroup io_readers
+ *
+ * The rows are partitioned as by `read_orc_partitioned()`.
+ *
+ * @throw cudf::logic_error if `partitioning.num_partitions` is not positive
+ * @throw std::out_of_range if an index of `partitioning.columns_to_hash` is invalid
+ *
+ * @param args Settings for controlling reading behavior
+ * @param partitioning Partitioning of the rows read
+ * @param mr Device memory resource used to allocate device memory of the table in the returned
+ * partitioned_table_with_metadata
+ *
+ * @return The partitioned columns and the offsets of the partitions, along with metadata
+ */
+partitioned_table_with_metadata read_parquet_partitioned(
+  read_parquet_args const& args,
+  read_partitioning const& partitioning,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Reads a Parquet dataset into caller-owned columns
+ *
+ * @ingroup io_readers
+ *
+ * The pages are decoded directly into `outputs`, e.g. views of a pre-allocated staging area,
+ * instead of into newly allocated columns. Only fixed-width columns are supported; each output
+ * must have the type the selected column would be read as, and enough rows. A column is read into
+ * the first rows of its output, and its validity into the output's null mask, which may only be
+ * omitted if the column has no nulls.
+ *
+ * The following code snippet demonstrates how to read a dataset into existing columns:
+ * @code
+ *  ...
+ *  cudf::io::read_parquet_args args{cudf::io::source_info(filepath)};
+ *  args.columns = {"x", "y"};
+ *  auto result = cudf::io::read_parquet_into(args, {x_view, y_view});
+ *  // x_view and y_view hold result.num_rows rows
+ * @endcode
+ *
+ * @throw cudf::logic_error if an output does not match its column or has too few rows
+ * @throw cudf::logic_error if a column with nulls is read into an output without null mask
+ * @throw cudf::logic_error if `args` selects row groups
+ *
+ * @param args Settings for controlling reading behavior
+ * @param outputs Columns to read the selected columns into, without offset
+ * @param mr Device memory resource used for temporary device memory allocations
+ *
+ * @return The number of rows and null counts read, along with metadata
+ */
+read_into_result read_parquet_into(
+  read_parquet_args const& args,
+  std::vector<mutable_column_view> const& outputs,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Assigns the row groups of a Parquet dataset to a number of readers
+ *
+ * @ingroup io_readers
+ *
+ * Each partition is a contiguous range of row groups, in source and file order, and partitions
+ * are balanced by the sum of the compressed and uncompressed sizes of their column chunks.
+ * Reading each partition with `read_parquet(args, partition)` and concatenating the results in
+ * partition order returns the rows of `read_parquet(args)`. Partitions are empty if there are
+ * fewer row groups than readers.
+ *
+ * Only the file footers are read. The plan only depends on the dataset and `args`, so each reader
+ * can compute it independently and read its own partition.
+ *
+ * @throw cudf::logic_error if `args` selects row groups or rows
+ * @throw cudf::logic_error if `num_partitions` is not positive
+ *
+ * @param args Settings for controlling reading behavior; only columns and filters are supported
+ * @param num_partitions Number of readers
+ *
+ * @return One partition per reader
+ */
+std::vector<read_partition> plan_parquet_read(read_parquet_args const& args,
+                                              size_type num_partitions);
+
+/**
+ * @brief Reads one partition of a Parquet dataset into a set of columns
+ *
+ * @ingroup io_readers
+ *
+ * @throw cudf::logic_error if the partition does not list row groups for each source
+ *
+ * @param args Settings for controlling reading behavior; row group and row selections are
+ * ignored
+ * @param partition Row groups to read, as returned by `plan_parquet_read()`
+ * @param mr Device memory resource used to allocate device memory of the table in the returned
+ * table_with_metadata
+ *
+ * @return The set of columns along with metadata
+ */
+table_with_metadata read_parquet(
+  read_parquet_args const& args,
+  read_partition const& partition,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+namespace detail {
+namespace parquet {
+/**
+ * @brief Forward declaration of the Parquet reader class
+ */
+class reader;
+}  // namespace parquet
+}  // namespace detail
+
+/**
+ * @brief Reads a Parquet dataset as a sequence of tables, each bounded by a memory budget
+ *
+ * @ingroup io_readers
+ *
+ * The rows selected by the read arguments are split into consecutive ranges whose decompressed
+ * column data is estimated, from the column chunk sizes recorded in the file footer, to fit
+ * within `chunk_read_limit` bytes. Row groups larger than the limit are split into row ranges;
+ * in that case the compressed data of the whole row group is still read for each range. An
+ * empty selection produces no chunks.
+ *
+ * The following code snippet demonstrates how to read a large file in bounded pieces:
+ * @code
+ *  ...
+ *  cudf::io::read_parquet_args args{cudf::io::source_info("dataset.parquet")};
+ *  cudf::io::chunked_parquet_reader reader(args, 1 << 30);
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *    ...
+ *  }
+ * @endcode
+ */
+class chunked_parquet_reader {
+ public:
+  /**
+   * @brief Constructor for the chunked reader
+   *
+   * @throw cudf::logic_error if `args.row_groups` is not empty
+   *
+   * @param args Settings for controlling reading behavior; `row_groups` is not supported
+   * @param chunk_read_limit Limit on the decompressed size of each chunk in bytes, or `0` to
+   * read everything in a single chunk
+   * @param mr Device memory resource used to allocate device memory of the returned tables
+   */
+  chunked_parquet_reader(read_parquet_args const& args,
+                         size_t chunk_read_limit,
+                         rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~chunked_parquet_reader();
+
+  /**
+   * @brief Returns whether there are chunks left to read
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Reads the next chunk of rows
+   *
+   * @throw cudf::logic_error if there are no chunks left to read
+   *
+   * @return The next table along with metadata
+   */
+  table_with_metadata read_chunk();
+
+ private:
+  std::unique_ptr<detail::parquet::reader> _reader;
+  std::vector<std::pair<size_type, size_type>> _row_ranges;
+  size_t _next_range = 0;
+};
+
 /**
  * @brief Settings to use for `write_orc()`
  *
@@ -473,6 +924,12 @@ struct write_orc_args {
   table_view table;
   /// Optional associated metadata
   const table_metadata* metadata;
+  /// Maximum uncompressed size of a stripe. The rows are split in the fewest stripes within the
+  /// size and row limits, of balanced sizes.
+  size_t stripe_size_bytes = 64 * 1024 * 1024;
+  /// Maximum number of rows in a stripe, rounded down to a multiple of the 10000 rows of a row
+  /// index entry
+  size_type stripe_size_rows = 1000000;
 
   write_orc_args() = default;
 
@@ -524,6 +981,12 @@ struct write_orc_chunked_args {
   bool enable_statistics;
   /// Optional associated metadata
   const table_metadata_with_nullability* metadata;
+  /// Maximum uncompressed size of a stripe. The rows of each chunk are split in the fewest stripes
+  /// within the size and row limits, of balanced sizes.
+  size_t stripe_size_bytes = 64 * 1024 * 1024;
+  /// Maximum number of rows in a stripe, rounded down to a multiple of the 10000 rows of a row
+  /// index entry
+  size_type stripe_size_rows = 1000000;
 
   explicit write_orc_chunked_args(sink_info const& sink_,
                                   const table_metadata_with_nullability* metadata_ = nullptr,
@@ -613,6 +1076,10 @@ struct write_parquet_args {
   compression_type compression = compression_type::AUTO;
   /// Specify the level of statistics in the output file
   statistics_freq stats_level = statistics_freq::STATISTICS_ROWGROUP;
+  /// Maximum length in bytes of the string min/max statistics of column chunks and pages, 0 for
+  /// no limit. As in parquet-mr, a min is truncated to a prefix and a truncated max ends with an
+  /// incremented character, so that both remain bounds of the values.
+  size_type stats_truncate_length = 64;
   /// Set of columns to output
   table_view table;
   /// Optional associated metadata
@@ -621,6 +1088,26 @@ struct write_parquet_args {
   bool return_filemetadata = false;
   /// Column chunks file path to be set in the raw output metadata
   std::string metadata_out_file_path;
+  /// Names of the columns to write a split-block Bloom filter for in each row group, so that
+  /// readers can skip row groups that cannot contain the values of `EQUAL` filter predicates
+  std::vector<std::string> bloom_filter_columns;
+  /// Dictionary encoding policy of the columns not listed in `column_dictionary_policy`
+  dictionary_policy dictionary = dictionary_policy::ADAPTIVE;
+  /// Dictionary encoding policy of individual columns, by name
+  std::map<std::string, dictionary_policy> column_dictionary_policy;
+  /// Names of the integer and timestamp columns whose pages without a dictionary are encoded as
+  /// DELTA_BINARY_PACKED instead of PLAIN, which stores sorted or slowly changing values in a few
+  /// bits each
+  std::vector<std::string> delta_encoding_columns;
+  /// Maximum uncompressed size of a row group. The rows are split in the fewest row groups within
+  /// the size and row limits, of balanced sizes.
+  size_t row_group_size_bytes = 128 * 1024 * 1024;
+  /// Maximum number of rows in a row group
+  size_type row_group_size_rows = 1000000;
+  /// Maximum uncompressed size of a page, unless a single row is larger
+  size_t max_page_size_bytes = 512 * 1024;
+  /// Maximum number of rows in a page (values for list columns)
+  size_type max_page_size_rows = 20000;
 
   write_parquet_args() = default;
 
@@ -662,6 +1149,88 @@ std::unique_ptr<std::vector<uint8_t>> write_parquet(
   write_parquet_args const& args,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Settings to use for `write_parquet_partitioned()`
+ *
+ * @ingroup io_writers
+ */
+struct write_parquet_partitioned_args {
+  /// Specify the sinks to use for writer output, one per partition
+  std::vector<sink_info> sinks;
+  /// Set of columns to output
+  table_view table;
+  /// Offsets of the partitions, as returned by `cudf::partition`: partition `i` holds the rows
+  /// [`partition_offsets[i]`, `partition_offsets[i + 1]`) and is written to `sinks[i]`
+  std::vector<size_type> partition_offsets;
+  /// Optional associated metadata, common to all the partitions
+  const table_metadata* metadata = nullptr;
+  /// Specify the compression format to use
+  compression_type compression = compression_type::AUTO;
+  /// Specify the level of statistics in the output files
+  statistics_freq stats_level = statistics_freq::STATISTICS_ROWGROUP;
+  /// Maximum length in bytes of the string min/max statistics, 0 for no limit
+  size_type stats_truncate_length = 64;
+  /// Names of the columns to write a split-block Bloom filter for in each row group
+  std::vector<std::string> bloom_filter_columns;
+  /// Dictionary encoding policy of the columns not listed in `column_dictionary_policy`
+  dictionary_policy dictionary = dictionary_policy::ADAPTIVE;
+  /// Dictionary encoding policy of individual columns, by name
+  std::map<std::string, dictionary_policy> column_dictionary_policy;
+  /// Names of the integer and timestamp columns to encode as DELTA_BINARY_PACKED without a
+  /// dictionary
+  std::vector<std::string> delta_encoding_columns;
+  /// Maximum uncompressed size of a row group
+  size_t row_group_size_bytes = 128 * 1024 * 1024;
+  /// Maximum number of rows in a row group
+  size_type row_group_size_rows = 1000000;
+  /// Maximum uncompressed size of a page, unless a single row is larger
+  size_t max_page_size_bytes = 512 * 1024;
+  /// Maximum number of rows in a page (values for list columns)
+  size_type max_page_size_rows = 20000;
+
+  write_parquet_partitioned_args() = default;
+
+  explicit write_parquet_partitioned_args(std::vector<sink_info> const& sinks_,
+                                          table_view const& table_,
+                                          std::vector<size_type> const& partition_offsets_,
+                                          const table_metadata* metadata_ = nullptr)
+    : sinks(sinks_), table(table_), partition_offsets(partition_offsets_), metadata(metadata_)
+  {
+  }
+};
+
+/**
+ * @brief Writes the partitions of a set of columns to parquet format, each to its own file
+ *
+ * @ingroup io_writers
+ *
+ * Writing many small partitions, e.g. the output of `cudf::partition`, one `write_parquet()` call
+ * at a time is dominated by the launch overhead of the encoding steps. The partitions are instead
+ * encoded together, so that each step is a single launch over all of them; the result is the
+ * files `write_parquet()` would write for each partition, up to the row group boundaries.
+ *
+ * The following code snippet demonstrates how to write partitions to files:
+ * @code
+ *  ...
+ *  auto partitioned = cudf::partition(table->view(), partition_map, num_partitions);
+ *  std::vector<cudf::io::sink_info> sinks;
+ *  for (...) { sinks.emplace_back(filepath); }
+ *  cudf::io::write_parquet_partitioned_args args{
+ *    sinks, partitioned.first->view(), partitioned.second};
+ *  cudf::io::write_parquet_partitioned(args);
+ * @endcode
+ *
+ * @throw cudf::logic_error if the number of partitions and of sinks differ
+ * @throw cudf::logic_error if the partition offsets are not increasing from 0 to the number of
+ * rows
+ *
+ * @param args Settings for controlling writing behavior
+ * @param mr Device memory resource to use for device memory allocation
+ */
+void write_parquet_partitioned(
+  write_parquet_partitioned_args const& args,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Merges multiple raw metadata blobs that were previously created by write_parquet
  * into a single metadata blob
@@ -686,8 +1255,29 @@ struct write_parquet_chunked_args {
   compression_type compression = compression_type::AUTO;
   /// Specify the level of statistics in the output file
   statistics_freq stats_level = statistics_freq::STATISTICS_ROWGROUP;
+  /// Maximum length in bytes of the string min/max statistics, 0 for no limit
+  size_type stats_truncate_length = 64;
   /// Optional associated metadata.
   const table_metadata_with_nullability* metadata;
+  /// Names of the columns to write a split-block Bloom filter for in each row group
+  std::vector<std::string> bloom_filter_columns;
+  /// Dictionary encoding policy of the columns not listed in `column_dictionary_policy`.
+  /// With `ADAPTIVE`, columns found to have too many distinct values for a dictionary in every
+  /// row group of a table are plain-encoded in the following tables without further analysis
+  dictionary_policy dictionary = dictionary_policy::ADAPTIVE;
+  /// Dictionary encoding policy of individual columns, by name
+  std::map<std::string, dictionary_policy> column_dictionary_policy;
+  /// Names of the integer and timestamp columns to encode as DELTA_BINARY_PACKED without a
+  /// dictionary
+  std::vector<std::string> delta_encoding_columns;
+  /// Maximum uncompressed size of a row group
+  size_t row_group_size_bytes = 128 * 1024 * 1024;
+  /// Maximum number of rows in a row group
+  size_type row_group_size_rows = 1000000;
+  /// Maximum uncompressed size of a page, unless a single row is larger
+  size_t max_page_size_bytes = 512 * 1024;
+  /// Maximum number of rows in a page (values for list columns)
+  size_type max_page_size_rows = 20000;
 
   write_parquet_chunked_args() = default;
 
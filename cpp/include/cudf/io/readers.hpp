@@ -23,6 +23,7 @@
 
 #include "types.hpp"
 
+#include <cudf/column/column_view.hpp>
 #include <cudf/io/datasource.hpp>
 #include <cudf/types.hpp>
 
@@ -273,6 +274,8 @@ struct reader_options {
 
   /// Per-column types; disables type inference on those columns
   std::vector<std::string> dtype;
+  /// Number of rows, evenly spread across the data, sampled to infer the column types; 0 is all
+  size_type dtype_sample_rows = 0;
   /// User-extensible list of values to recognize as boolean true values
   std::vector<std::string> true_values{"True", "TRUE", "true"};
   /// User-extensible list of values to recognize as boolean false values
@@ -361,6 +364,25 @@ class reader {
    */
   table_with_metadata read_byte_range(size_t offset, size_t size, cudaStream_t stream = 0);
 
+  /**
+   * @brief Reads the rows that start within the next bytes of the dataset.
+   *
+   * Successive calls read the dataset as a sequence of tables, each chunk starting at the row
+   * that follows the last row of the previous one. The header and the column types are only
+   * parsed or inferred from the first chunk.
+   *
+   * @param chunk_size Number of bytes in which the rows start; set to 0 for all remaining
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with table metadata
+   */
+  table_with_metadata read_chunk(size_t chunk_size, cudaStream_t stream = 0);
+
+  /**
+   * @brief Returns whether there are chunks left to read with `read_chunk()`.
+   */
+  bool has_next_chunk() const;
+
   /**
    * @brief Reads a range of rows.
    *
@@ -390,6 +412,8 @@ struct reader_options {
   data_type timestamp_type{type_id::EMPTY};
   bool decimals_as_float    = true;
   int forced_decimals_scale = -1;
+  predicate_filter filters;
+  bool strings_to_dictionary = false;
 
   reader_options()                       = default;
   reader_options(reader_options const &) = default;
@@ -401,19 +425,25 @@ struct reader_options {
    * @param use_index_lookup Whether to use row index for faster scanning
    * @param np_compat Whether to use numpy-compatible dtypes
    * @param timestamp_type Cast timestamp columns to a specific type
+   * @param filters Predicates used to skip stripes and row groups based on their statistics
+   * @param strings_to_dictionary Whether to return strings as dictionary columns
    */
   reader_options(std::vector<std::string> columns,
                  bool use_index_lookup,
                  bool np_compat,
                  data_type timestamp_type,
-                 bool decimals_as_float_    = true,
-                 int forced_decimals_scale_ = -1)
+                 bool decimals_as_float_     = true,
+                 int forced_decimals_scale_  = -1,
+                 predicate_filter filters_   = {},
+                 bool strings_to_dictionary_ = false)
     : columns(std::move(columns)),
       use_index(use_index_lookup),
       use_np_dtypes(np_compat),
       timestamp_type(timestamp_type),
       decimals_as_float(decimals_as_float_),
-      forced_decimals_scale(forced_decimals_scale_)
+      forced_decimals_scale(forced_decimals_scale_),
+      filters(std::move(filters_)),
+      strings_to_dictionary(strings_to_dictionary_)
   {
   }
 };
@@ -501,6 +531,16 @@ class reader {
    * @return The set of columns along with table metadata
    */
   table_with_metadata read_rows(size_type skip_rows, size_type num_rows, cudaStream_t stream = 0);
+
+  /**
+   * @brief Returns the size information of the stripes to read.
+   *
+   * Only stripes that pass the reader's filters are listed. Sizes are taken or estimated from the
+   * stripe information and statistics in the file metadata; no stripe data is read.
+   *
+   * @return Size information of each stripe, in file order
+   */
+  std::vector<block_info> get_stripe_info();
 };
 
 }  // namespace orc
@@ -514,6 +554,9 @@ struct reader_options {
   bool strings_to_categorical = false;
   bool use_pandas_metadata    = false;
   data_type timestamp_type{type_id::EMPTY};
+  predicate_filter filters;
+  bool strings_to_dictionary = false;
+  bool filter_rows           = false;
 
   reader_options()                       = default;
   reader_options(reader_options const &) = default;
@@ -525,15 +568,24 @@ struct reader_options {
    * @param strings_to_categorical Whether to return strings as category
    * @param use_pandas_metadata Whether to always load PANDAS index columns
    * @param timestamp_type Cast timestamp columns to a specific type
+   * @param filters Predicates used to skip row groups based on their statistics
+   * @param strings_to_dictionary Whether to return strings as dictionary columns
+   * @param filter_rows Whether to also drop the rows that do not satisfy the filters
    */
   reader_options(std::vector<std::string> columns,
                  bool strings_to_categorical,
                  bool use_pandas_metadata,
-                 data_type timestamp_type)
+                 data_type timestamp_type,
+                 predicate_filter filters   = {},
+                 bool strings_to_dictionary = false,
+                 bool filter_rows           = false)
     : columns(std::move(columns)),
       strings_to_categorical(strings_to_categorical),
       use_pandas_metadata(use_pandas_metadata),
-      timestamp_type(timestamp_type)
+      timestamp_type(timestamp_type),
+      filters(std::move(filters)),
+      strings_to_dictionary(strings_to_dictionary),
+      filter_rows(filter_rows)
   {
   }
 };
@@ -606,6 +658,50 @@ class reader {
    * @return The set of columns along with table metadata
    */
   table_with_metadata read_rows(size_type skip_rows, size_type num_rows, cudaStream_t stream = 0);
+
+  /**
+   * @brief Reads a range of rows into caller-owned columns.
+   *
+   * The selected columns are decoded directly into `outputs`, without allocating them.
+   *
+   * @param outputs Fixed-width columns of the types of the selected columns, without offset,
+   * whose first rows receive the rows read
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to read; use `0` for all remaining data
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The number of rows and null counts decoded, along with table metadata
+   */
+  read_into_result read_rows_into(std::vector<mutable_column_view> const &outputs,
+                                  size_type skip_rows,
+                                  size_type num_rows,
+                                  cudaStream_t stream = 0);
+
+  /**
+   * @brief Splits a range of rows into consecutive ranges that fit a decompressed size limit.
+   *
+   * Sizes are estimated from the uncompressed column chunk sizes in the file metadata, and only
+   * row groups that pass the reader's filters are considered.
+   *
+   * @param chunk_read_limit Limit on the decompressed size of each range in bytes; `0` for none
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to split; use `0` for all remaining data
+   *
+   * @return List of (skip_rows, num_rows) pairs to pass to `read_rows()`
+   */
+  std::vector<std::pair<size_type, size_type>> split_rows(size_t chunk_read_limit,
+                                                          size_type skip_rows = 0,
+                                                          size_type num_rows  = 0);
+
+  /**
+   * @brief Returns the size information of the row groups to read.
+   *
+   * Only row groups that pass the reader's filters are listed. Sizes are taken from the column
+   * chunk metadata in the file footers.
+   *
+   * @return Size information of each row group, in source and file order
+   */
+  std::vector<block_info> get_row_group_info();
 };
 
 }  // namespace parquet
@@ -57,7 +57,9 @@ enum class compression_type {
   BZIP2,   ///< BZIP2 format, using Burrows-Wheeler transform
   BROTLI,  ///< BROTLI format, using LZ77 + Huffman + 2nd order context modeling
   ZIP,     ///< ZIP format, using DEFLATE algorithm
-  XZ       ///< XZ format, using LZMA(2) algorithm
+  XZ,      ///< XZ format, using LZMA(2) algorithm
+  ZSTD,    ///< ZSTD format, using LZ77 + FSE/Huffman entropy coding
+  LZ4      ///< LZ4 format, using byte-oriented LZ77
 };
 
 /**
@@ -90,6 +92,98 @@ enum statistics_freq {
   STATISTICS_PAGE     = 2,  //!< Per-page column statistics
 };
 
+/**
+ * @brief Dictionary encoding policy of a column for the parquet writer
+ */
+enum class dictionary_policy {
+  ADAPTIVE,  ///< Use a dictionary in the column chunks where it is expected to reduce the size
+  ALWAYS,    ///< Use a dictionary in every column chunk, if the column type supports it
+  NEVER      ///< Always use plain encoding
+};
+
+/**
+ * @brief Comparison operators for reader predicate pushdown
+ */
+enum class predicate_op {
+  EQUAL,          ///< column == literal
+  NOT_EQUAL,      ///< column != literal
+  LESS,           ///< column < literal
+  LESS_EQUAL,     ///< column <= literal
+  GREATER,        ///< column > literal
+  GREATER_EQUAL,  ///< column >= literal
+};
+
+/**
+ * @brief A single `column <op> literal` comparison used to skip row groups/stripes
+ *
+ * Readers only evaluate predicates against the min/max statistics stored in the file, and skip a
+ * block of rows when its statistics prove that no row in it can satisfy the predicate. Blocks
+ * without usable statistics are always read, so the caller must still apply the exact filter to
+ * the returned table.
+ *
+ * `EQUAL` predicates are also probed against the Bloom filters of Parquet column chunks when the
+ * file has them. A set of probe keys, such as the IDs of a point-lookup join, is expressed as a
+ * disjunction of `EQUAL` predicates on the key column.
+ *
+ * Integer literals compare against the column's physical (on-disk) representation; for example
+ * timestamps are compared in the file's time unit. ORC statistics store timestamps in
+ * milliseconds since the UNIX epoch and dates in days since the epoch.
+ */
+struct column_predicate {
+  /**
+   * @brief Type of the literal value
+   */
+  enum class literal_kind { INTEGER, FLOAT, STRING };
+
+  std::string column_name;                    ///< Name of the column to compare
+  predicate_op op     = predicate_op::EQUAL;    ///< Comparison operator
+  literal_kind kind   = literal_kind::INTEGER;  ///< Which of the literal members is valid
+  int64_t int_value   = 0;                      ///< Literal for `literal_kind::INTEGER`
+  double float_value  = 0;                      ///< Literal for `literal_kind::FLOAT`
+  std::string string_value;                     ///< Literal for `literal_kind::STRING`
+
+  column_predicate() = default;
+
+  column_predicate(std::string const& name, predicate_op op, int32_t value)
+    : column_name(name), op(op), kind(literal_kind::INTEGER), int_value(value)
+  {
+  }
+  column_predicate(std::string const& name, predicate_op op, int64_t value)
+    : column_name(name), op(op), kind(literal_kind::INTEGER), int_value(value)
+  {
+  }
+  column_predicate(std::string const& name, predicate_op op, double value)
+    : column_name(name), op(op), kind(literal_kind::FLOAT), float_value(value)
+  {
+  }
+  column_predicate(std::string const& name, predicate_op op, std::string const& value)
+    : column_name(name), op(op), kind(literal_kind::STRING), string_value(value)
+  {
+  }
+};
+
+/**
+ * @brief Reader filter in disjunctive normal form
+ *
+ * The outer list is OR-ed together, and each inner list is a conjunction of predicates; this
+ * mirrors the `filters` argument of `pyarrow.parquet.read_table`. An empty filter selects
+ * everything.
+ */
+using predicate_filter = std::vector<std::vector<column_predicate>>;
+
+/**
+ * @brief Size information of a stripe (ORC) or row group (Parquet), used to plan reads
+ *
+ * Sizes only account for the columns selected by the reader.
+ */
+struct block_info {
+  size_type source_index   = 0;  ///< Index of the source containing the block
+  size_type index          = 0;  ///< Index of the stripe or row group within its source
+  size_type num_rows       = 0;  ///< Number of rows to read from the block
+  size_t compressed_size   = 0;  ///< Number of bytes read from the source
+  size_t uncompressed_size = 0;  ///< Estimated size of the decoded columns in bytes
+};
+
 /**
  * @brief Table metadata for io readers/writers (primarily column names)
  * For nested types (structs, maps, unions), the ordering of names in the column_names vector
@@ -137,6 +231,37 @@ struct table_with_metadata {
   table_metadata metadata;
 };
 
+/**
+ * @brief Partitioning of the rows read, used by io readers that partition their output
+ *
+ * The rows are hash partitioned on `columns_to_hash` as by `hash_partition`, or, if it is empty,
+ * dealt to the partitions from `start_partition` as by `round_robin_partition`.
+ */
+struct read_partitioning {
+  int num_partitions{1};                         //!< Number of partitions
+  std::vector<size_type> columns_to_hash;        //!< Indices of the read columns to hash
+  hash_id hash_function{hash_id::HASH_MURMUR3};  //!< Hash function of the rows
+  size_type start_partition{0};                  //!< Partition of the first row, if round-robin
+};
+
+/**
+ * @brief Partitioned table with table metadata, used by io readers that partition their output
+ */
+struct partitioned_table_with_metadata {
+  std::unique_ptr<table> tbl;                //!< Rows of each partition, one after the other
+  std::vector<size_type> partition_offsets;  //!< Offset of the first row of each partition
+  table_metadata metadata;                   //!< Column names and user data
+};
+
+/**
+ * @brief Outcome of a read into caller-owned columns, used by io readers that decode in place
+ */
+struct read_into_result {
+  size_type num_rows{0};               //!< Rows decoded at the head of each output column
+  std::vector<size_type> null_counts;  //!< Null count of the decoded rows of each column
+  table_metadata metadata;             //!< Column names and user data
+};
+
 /**
  * @brief Non-owning view of a host memory buffer
  *
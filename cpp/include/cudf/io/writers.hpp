@@ -46,6 +46,10 @@ struct writer_options {
   compression_type compression = compression_type::AUTO;
   /// Enables writing column statistics in the ORC file
   bool enable_statistics = true;
+  /// Maximum uncompressed size of a stripe
+  size_t stripe_size_bytes = 64 * 1024 * 1024;
+  /// Maximum number of rows in a stripe
+  size_type stripe_size_rows = 1000000;
 
   writer_options()                      = default;
   writer_options(writer_options const&) = default;
@@ -132,6 +136,24 @@ struct writer_options {
   compression_type compression = compression_type::AUTO;
   /// Select the statistics level to generate in the parquet file
   statistics_freq stats_granularity = statistics_freq::STATISTICS_ROWGROUP;
+  /// Maximum length in bytes of string min/max statistics, 0 for no limit
+  size_type stats_truncate_length = 64;
+  /// Names of the columns to write a Bloom filter for in each row group
+  std::vector<std::string> bloom_filter_columns;
+  /// Default dictionary encoding policy of the columns
+  dictionary_policy dictionary = dictionary_policy::ADAPTIVE;
+  /// Dictionary encoding policy of individual columns, by name
+  std::map<std::string, dictionary_policy> column_dictionary_policy;
+  /// Names of the columns whose non-dictionary pages are DELTA_BINARY_PACKED
+  std::vector<std::string> delta_encoding_columns;
+  /// Maximum uncompressed size of a row group
+  size_t row_group_size_bytes = 128 * 1024 * 1024;
+  /// Maximum number of rows in a row group
+  size_type row_group_size_rows = 1000000;
+  /// Maximum uncompressed size of a page
+  size_t max_page_size_bytes = 512 * 1024;
+  /// Maximum number of rows in a page
+  size_type max_page_size_rows = 20000;
 
   writer_options()                      = default;
   writer_options(writer_options const&) = default;
@@ -167,6 +189,17 @@ class writer {
                   writer_options const& options,
                   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+  /**
+   * @brief Constructor for output of partitions, each to its own file.
+   *
+   * @param sinks The data sinks to write the partitions to, one per partition
+   * @param options Settings for controlling writing behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit writer(std::vector<std::unique_ptr<cudf::io::data_sink>> sinks,
+                  writer_options const& options,
+                  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
   /**
    * @brief Destructor explicitly-declared to avoid inlined in header
    */
@@ -187,6 +220,20 @@ class writer {
                                                   const std::string metadata_out_file_path = "",
                                                   cudaStream_t stream                      = 0);
 
+  /**
+   * @brief Writes the partitions of the dataset, each to its own sink.
+   *
+   * @param table Set of columns to output
+   * @param partition_offsets Offsets of the partitions, as returned by `cudf::partition`: partition
+   * `i` holds the rows [`partition_offsets[i]`, `partition_offsets[i + 1]`)
+   * @param metadata Table metadata and column names
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void write_partitioned(table_view const& table,
+                         std::vector<size_type> const& partition_offsets,
+                         const table_metadata* metadata = nullptr,
+                         cudaStream_t stream            = 0);
+
   /**
    * @brief Begins the chunked/streamed write process.
    *
@@ -351,6 +398,74 @@ class writer {
 
 }  // namespace csv
 
+namespace json {
+
+/**
+ * @brief Options for the JSON writer.
+ */
+struct writer_options {
+  /// Writes one object per line (JSON Lines) if true, an array of the objects otherwise
+  bool lines = true;
+  /// Writes the null fields of a row as `null` if true, leaves them out of its object otherwise
+  bool include_nulls = true;
+  /// Maximum number of rows formatted and written at once
+  size_type rows_per_chunk = 1000000;
+
+  writer_options()                      = default;
+  writer_options(writer_options const&) = default;
+
+  /**
+   * @brief Constructor to populate writer options.
+   *
+   * @param lines Whether to write JSON Lines rather than an array of records
+   * @param include_nulls Whether to write null fields
+   * @param rows_per_chunk Maximum number of rows formatted and written at once
+   */
+  writer_options(bool lines, bool include_nulls, size_type rows_per_chunk = 1000000)
+    : lines(lines), include_nulls(include_nulls), rows_per_chunk(rows_per_chunk)
+  {
+  }
+};
+
+/**
+ * @brief Class to write JSON dataset data into columns.
+ */
+class writer {
+ private:
+  class impl;
+  std::unique_ptr<impl> _impl;
+
+ public:
+  /**
+   * @brief Constructor for output to a file.
+   *
+   * @param sinkp The data sink to write the data to
+   * @param options Settings for controlling writing behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit writer(std::unique_ptr<cudf::io::data_sink> sinkp,
+                  writer_options const& options,
+                  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~writer();
+
+  /**
+   * @brief Writes the entire dataset.
+   *
+   * @param table Set of columns to output
+   * @param metadata Table metadata and column names
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void write_all(table_view const& table,
+                 const table_metadata* metadata = nullptr,
+                 cudaStream_t stream            = 0);
+};
+
+}  // namespace json
+
 }  // namespace detail
 }  // namespace io
 }  // namespace cudf
@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <cudf/binaryop.hpp>
+#include <cudf/types.hpp>
+
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -79,6 +82,7 @@ namespace cudf {
  * @param[in] compare_nulls controls whether null join-key values
  * should match or not.
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  *
  * @return Result of joining `left` and `right` tables on the columns
  * specified by `left_on` and `right_on`. The resulting table will be joined columns of
@@ -91,7 +95,8 @@ std::unique_ptr<cudf::table> inner_join(
   std::vector<cudf::size_type> const& right_on,
   std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
   null_equality compare_nulls         = null_equality::EQUAL,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief Performs a left join (also known as left outer join) on the
@@ -228,6 +233,413 @@ std::unique_ptr<cudf::table> full_join(
   std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
   null_equality compare_nulls         = null_equality::EQUAL,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to an
+ * inner join between the specified tables.
+ *
+ * The first returned vector contains the row indices from the left
+ * table that have a match in the right table (in unspecified order).
+ * The corresponding values in the second returned vector are
+ * the matched row indices from the right table.
+ *
+ * Unlike the `inner_join` overload returning a table, no column is gathered, so the caller can
+ * materialize only the columns it needs, e.g. with `cudf::gather`.
+ *
+ * @code{.pseudo}
+ * Left: {{0, 1, 2}}
+ * Right: {{1, 2, 3}}
+ * Result: {{1, 2}, {0, 1}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if number of columns in either `left_keys` or `right_keys` is 0,
+ * or if the column types of `left_keys` and `right_keys` mismatch
+ *
+ * @param[in] left_keys The left table
+ * @param[in] right_keys The right table
+ * @param[in] compare_nulls controls whether null join-key values
+ * should match or not.
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return A pair of `INT32` columns that can be used to construct
+ * the result of performing an inner join between two tables with
+ * `left_keys` and `right_keys` as the join keys.
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> inner_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to a
+ * left join between the specified tables.
+ *
+ * The first returned vector contains all the row indices from the left
+ * table (in unspecified order). The corresponding value in the
+ * second returned vector is either (1) the row index of the matched row
+ * from the right table, if there is a match or (2) `-1`, if there is no match.
+ *
+ * `cudf::gather` interprets a negative index as counting from the end of the table. To gather
+ * nulls for the unmatched rows instead, gather through a `UINT32` view of the index column:
+ * `-1` is then out of bounds, and `cudf::gather` nullifies it when `check_bounds` is false.
+ *
+ * @code{.pseudo}
+ * Left: {{0, 1, 2}}
+ * Right: {{1, 2, 3}}
+ * Result: {{0, 1, 2}, {-1, 0, 1}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if number of columns in either `left_keys` or `right_keys` is 0,
+ * or if the column types of `left_keys` and `right_keys` mismatch
+ *
+ * @param[in] left_keys The left table
+ * @param[in] right_keys The right table
+ * @param[in] compare_nulls controls whether null join-key values
+ * should match or not.
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ *
+ * @return A pair of `INT32` columns that can be used to construct
+ * the result of performing a left join between two tables with
+ * `left_keys` and `right_keys` as the join keys.
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> left_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to a
+ * full join between the specified tables.
+ *
+ * Taken pairwise, the values from the returned vectors are one of:
+ * (1) row indices corresponding to matching rows from the left and
+ * right tables, (2) a row index and `-1`, corresponding to an unmatched
+ * row from the left table, or (3) `-1` and a row index, corresponding to
+ * an unmatched row from the right table. See `left_join` for gathering nulls for the `-1`
+ * indices.
+ *
+ * @code{.pseudo}
+ * Left: {{0, 1, 2}}
+ * Right: {{1, 2, 3}}
+ * Result: {{0, 1, 2, -1}, {-1, 0, 1, 2}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if number of columns in either `left_keys` or `right_keys` is 0,
+ * or if the column types of `left_keys` and `right_keys` mismatch
+ *
+ * @param[in] left_keys The left table
+ * @param[in] right_keys The right table
+ * @param[in] compare_nulls controls whether null join-key values
+ * should match or not.
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ *
+ * @return A pair of `INT32` columns that can be used to construct
+ * the result of performing a full join between two tables with
+ * `left_keys` and `right_keys` as the join keys.
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> full_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to an inner join between the specified
+ * tables, computed by a partitioned hash join.
+ *
+ * Both tables are hash partitioned on their keys into `num_partitions` partitions, and each
+ * partition of `left_keys` is joined with the matching partition of `right_keys` only. The hash
+ * table of each partition is small enough to stay in the L2 cache, which speeds up the probes of
+ * joins with a large build table, at the cost of copying both tables once.
+ *
+ * The result is the same as the one of `inner_join`, in a different order.
+ *
+ * @throw cudf::logic_error if number of columns in either `left_keys` or `right_keys` is 0,
+ * or if the column types of `left_keys` and `right_keys` mismatch
+ *
+ * @param[in] left_keys The left table
+ * @param[in] right_keys The right table
+ * @param[in] num_partitions The number of partitions. If 0, it is chosen so that the hash table
+ * of each partition of `right_keys` fits in the L2 cache.
+ * @param[in] compare_nulls controls whether null join-key values
+ * should match or not.
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ *
+ * @return A pair of `INT32` columns that can be used to construct
+ * the result of performing an inner join between two tables with
+ * `left_keys` and `right_keys` as the join keys.
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> partitioned_inner_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  cudf::size_type num_partitions      = 0,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to a left join between the specified
+ * tables, computed by a partitioned hash join.
+ *
+ * See `partitioned_inner_join` for the partitioning and `left_join` for the result.
+ *
+ * @throw cudf::logic_error if number of columns in either `left_keys` or `right_keys` is 0,
+ * or if the column types of `left_keys` and `right_keys` mismatch
+ *
+ * @param[in] left_keys The left table
+ * @param[in] right_keys The right table
+ * @param[in] num_partitions The number of partitions. If 0, it is chosen so that the hash table
+ * of each partition of `right_keys` fits in the L2 cache.
+ * @param[in] compare_nulls controls whether null join-key values
+ * should match or not.
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ *
+ * @return A pair of `INT32` columns that can be used to construct
+ * the result of performing a left join between two tables with
+ * `left_keys` and `right_keys` as the join keys.
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> partitioned_left_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  cudf::size_type num_partitions      = 0,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to a full join between the specified
+ * tables, computed by a partitioned hash join.
+ *
+ * See `partitioned_inner_join` for the partitioning and `full_join` for the result.
+ *
+ * @throw cudf::logic_error if number of columns in either `left_keys` or `right_keys` is 0,
+ * or if the column types of `left_keys` and `right_keys` mismatch
+ *
+ * @param[in] left_keys The left table
+ * @param[in] right_keys The right table
+ * @param[in] num_partitions The number of partitions. If 0, it is chosen so that the hash table
+ * of each partition of `right_keys` fits in the L2 cache.
+ * @param[in] compare_nulls controls whether null join-key values
+ * should match or not.
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ *
+ * @return A pair of `INT32` columns that can be used to construct
+ * the result of performing a full join between two tables with
+ * `left_keys` and `right_keys` as the join keys.
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> partitioned_full_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  cudf::size_type num_partitions      = 0,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to an inner join between the specified
+ * tables, which are both sorted on all of their columns.
+ *
+ * The rows matching each row of `left_keys` form a contiguous range of `right_keys`, which is
+ * found by binary search, so no hash table is built. The result is the same as the one of
+ * `inner_join`, ordered by left row index, then by right row index.
+ *
+ * @code{.pseudo}
+ * Left: {{0, 1, 1, 2}}
+ * Right: {{1, 1, 2, 3}}
+ * Result: {{1, 1, 2, 2, 3}, {0, 1, 0, 1, 2}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if number of columns in either `left_keys` or `right_keys` is 0,
+ * or if the column types of `left_keys` and `right_keys` mismatch
+ *
+ * @param[in] left_keys The left table, sorted according to `column_order` and `null_precedence`
+ * @param[in] right_keys The right table, sorted according to `column_order` and
+ * `null_precedence`
+ * @param[in] column_order The sort order of each column. Empty means all ascending.
+ * @param[in] null_precedence The position of the nulls of each column. Empty means nulls before
+ * all other values.
+ * @param[in] compare_nulls controls whether null join-key values
+ * should match or not.
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ *
+ * @return A pair of `INT32` columns that can be used to construct
+ * the result of performing an inner join between two tables with
+ * `left_keys` and `right_keys` as the join keys.
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> sorted_inner_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  null_equality compare_nulls                    = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to a left join between the specified
+ * tables, which are both sorted on all of their columns.
+ *
+ * See `sorted_inner_join` for the algorithm and `left_join` for the result, which is ordered by
+ * left row index.
+ *
+ * @throw cudf::logic_error if number of columns in either `left_keys` or `right_keys` is 0,
+ * or if the column types of `left_keys` and `right_keys` mismatch
+ *
+ * @param[in] left_keys The left table, sorted according to `column_order` and `null_precedence`
+ * @param[in] right_keys The right table, sorted according to `column_order` and
+ * `null_precedence`
+ * @param[in] column_order The sort order of each column. Empty means all ascending.
+ * @param[in] null_precedence The position of the nulls of each column. Empty means nulls before
+ * all other values.
+ * @param[in] compare_nulls controls whether null join-key values
+ * should match or not.
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ *
+ * @return A pair of `INT32` columns that can be used to construct
+ * the result of performing a left join between two tables with
+ * `left_keys` and `right_keys` as the join keys.
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> sorted_left_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  null_equality compare_nulls                    = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to a full join between the specified
+ * tables, which are both sorted on all of their columns.
+ *
+ * See `sorted_inner_join` for the algorithm and `full_join` for the result. The unmatched rows
+ * of `right_keys` come last.
+ *
+ * @throw cudf::logic_error if number of columns in either `left_keys` or `right_keys` is 0,
+ * or if the column types of `left_keys` and `right_keys` mismatch
+ *
+ * @param[in] left_keys The left table, sorted according to `column_order` and `null_precedence`
+ * @param[in] right_keys The right table, sorted according to `column_order` and
+ * `null_precedence`
+ * @param[in] column_order The sort order of each column. Empty means all ascending.
+ * @param[in] null_precedence The position of the nulls of each column. Empty means nulls before
+ * all other values.
+ * @param[in] compare_nulls controls whether null join-key values
+ * should match or not.
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ *
+ * @return A pair of `INT32` columns that can be used to construct
+ * the result of performing a full join between two tables with
+ * `left_keys` and `right_keys` as the join keys.
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> sorted_full_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  null_equality compare_nulls                    = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns a pair of row index vectors of the rows of two columns that satisfy the
+ * inequality `left_values[i] op right_values[j]`.
+ *
+ * The left column is sorted once, so the rows matching each right row form a prefix or a suffix
+ * of it, which is found by binary search. This takes `O((N + M) log N)` time plus the size of the
+ * output, instead of the `O(N * M)` of a nested loop or a cross join. The result is ordered by
+ * right row index. Null values match nothing.
+ *
+ * @code{.pseudo}
+ * Left: {0, 1, 2}
+ * Right: {1, 2}
+ * op: LESS
+ * Result: {{0, 0, 1}, {0, 1, 1}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if the types of `left_values` and `right_values` mismatch, or if `op`
+ * is not one of `LESS`, `LESS_EQUAL`, `GREATER` or `GREATER_EQUAL`
+ *
+ * @param[in] left_values The column of the left table to compare
+ * @param[in] right_values The column of the right table to compare
+ * @param[in] op The comparison operator
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ *
+ * @return A pair of `INT32` gather maps of the left and right tables
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> inequality_join(
+  cudf::column_view const& left_values,
+  cudf::column_view const& right_values,
+  binary_operator op,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns a pair of row index vectors of the rows of two tables such that
+ * `right_lower[j] <= left_values[i] <= right_upper[j]`.
+ *
+ * This implements `left.x BETWEEN right.lower AND right.upper` without exploding the ranges: the
+ * left column is sorted once, and the rows within each range are found by two binary searches.
+ * The result is ordered by right row index. Null values and ranges with a null bound match
+ * nothing.
+ *
+ * @code{.pseudo}
+ * Left: {5, 1, 3}
+ * Right lower: {0, 2, 6}
+ * Right upper: {3, 5, 9}
+ * Result: {{1, 2, 2, 0}, {0, 0, 1, 1}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if the types of the columns mismatch, or if `right_lower` and
+ * `right_upper` have different sizes
+ *
+ * @param[in] left_values The column of the left table to compare
+ * @param[in] right_lower The inclusive lower bounds of the ranges of the right table
+ * @param[in] right_upper The inclusive upper bounds of the ranges of the right table
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ *
+ * @return A pair of `INT32` gather maps of the left and right tables
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> range_join(
+  cudf::column_view const& left_values,
+  cudf::column_view const& right_lower,
+  cudf::column_view const& right_upper,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns, for each row of the left table, the row of the right table with equal `by` keys
+ * and the greatest `on` value not greater than the left row's one.
+ *
+ * This is the as-of join of time series, e.g. the last quote preceding each trade of the same
+ * ticker. The right table is sorted once by its `by` and `on` columns, and each left row is
+ * matched by a single binary search. Left rows without a preceding right row, or with a null
+ * `on` value, are matched with `-1`. Ties in `on` are matched with any one of the tied rows.
+ *
+ * @code{.pseudo}
+ * Left by: {{"a", "a", "b"}}
+ * Left on: {2, 5, 5}
+ * Right by: {{"a", "a", "b"}}
+ * Right on: {1, 4, 6}
+ * Result: {0, 1, -1}
+ * @endcode
+ *
+ * @throw cudf::logic_error if the number or the types of the `by` columns mismatch, if the types
+ * of the `on` columns mismatch, or if the `by` and `on` columns of a table have different sizes
+ *
+ * @param[in] left_by The columns of the left table that must match exactly. May have no columns.
+ * @param[in] left_on The ordered column of the left table
+ * @param[in] right_by The columns of the right table that must match exactly
+ * @param[in] right_on The ordered column of the right table
+ * @param[in] compare_nulls controls whether null `by` values should match or not.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @return An `INT32` gather map of the right table with one row per row of the left table
+ */
+std::unique_ptr<cudf::column> asof_join(
+  cudf::table_view const& left_by,
+  cudf::column_view const& left_on,
+  cudf::table_view const& right_by,
+  cudf::column_view const& right_on,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Performs a left semi join on the specified columns of two
  * tables (`left`, `right`)
@@ -340,6 +752,93 @@ std::unique_ptr<cudf::table> left_anti_join(
   null_equality compare_nulls         = null_equality::EQUAL,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Returns the indices of the rows of `left_keys` that are equal to a row of `right_keys`
+ *
+ * This is a left semi join returning a gather map instead of the gathered rows, e.g. for an
+ * `EXISTS` subquery. Only the existence of a match is computed: the hash table built on
+ * `right_keys` holds the indices of its rows without payload, and the lookup of a row of
+ * `left_keys` stops at its first match.
+ *
+ * @code{.pseudo}
+ *          left_keys: {0, 1, 2, 1}
+ *          right_keys: {1, 2, 3, 2}
+ * Result: {1, 2, 3}
+ * @endcode
+ *
+ * @throw cudf::logic_error if `left_keys` has no columns
+ * @throw cudf::logic_error if `left_keys` and `right_keys` have different numbers of columns
+ *
+ * @param left_keys     The key columns of the left table
+ * @param right_keys    The key columns of the right table
+ * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param mr            Device memory resource used to allocate the returned column's device memory
+ *
+ * @return `INT32` column of the indices of the matched rows of `left_keys`, in increasing order
+ */
+std::unique_ptr<cudf::column> left_semi_join_gather_map(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns the indices of the rows of `left_keys` that are not equal to any row of
+ * `right_keys`
+ *
+ * This is a left anti join returning a gather map instead of the gathered rows, e.g. for a
+ * `NOT EXISTS` subquery, computed as `left_semi_join_gather_map` is.
+ *
+ * @code{.pseudo}
+ *          left_keys: {0, 1, 2, 1}
+ *          right_keys: {1, 2, 3, 2}
+ * Result: {0}
+ * @endcode
+ *
+ * @throw cudf::logic_error if `left_keys` has no columns
+ * @throw cudf::logic_error if `left_keys` and `right_keys` have different numbers of columns
+ *
+ * @param left_keys     The key columns of the left table
+ * @param right_keys    The key columns of the right table
+ * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param mr            Device memory resource used to allocate the returned column's device memory
+ *
+ * @return `INT32` column of the indices of the unmatched rows of `left_keys`, in increasing order
+ */
+std::unique_ptr<cudf::column> left_anti_join_gather_map(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns whether each row of `left_keys` is equal to a row of `right_keys`
+ *
+ * The mask can be passed to `apply_boolean_mask` to compute a left semi join, or negated to
+ * compute a left anti join. It is computed as `left_semi_join_gather_map` is.
+ *
+ * @code{.pseudo}
+ *          left_keys: {0, 1, 2, 1}
+ *          right_keys: {1, 2, 3, 2}
+ * Result: {false, true, true, true}
+ * @endcode
+ *
+ * @throw cudf::logic_error if `left_keys` has no columns
+ * @throw cudf::logic_error if `left_keys` and `right_keys` have different numbers of columns
+ *
+ * @param left_keys     The key columns of the left table
+ * @param right_keys    The key columns of the right table
+ * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param mr            Device memory resource used to allocate the returned column's device memory
+ *
+ * @return `BOOL8` column without nulls, with one element per row of `left_keys`
+ */
+std::unique_ptr<cudf::column> left_semi_join_mask(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Performs a cross join on two tables (`left`, `right`)
  *
@@ -355,6 +854,8 @@ std::unique_ptr<cudf::table> left_anti_join(
  * @endcode
 
  * @throw cudf::logic_error if the number of columns in either `left` or `right` table is 0
+ * @throw cudf::logic_error if `left.num_rows() * right.num_rows()` is more rows than a column
+ * can hold; use `chunked_cross_join` to return such a result in pieces
  *
  * @param left  The left table
  * @param right The right table
@@ -367,5 +868,179 @@ std::unique_ptr<cudf::table> cross_join(
   cudf::table_view const& right,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Hash join that builds the hash table on the join columns of a build table once, and
+ * probes it with any number of probe tables.
+ *
+ * This amortizes the cost of building the hash table when the same table is joined repeatedly,
+ * e.g. a small dimension table joined with every batch of a large fact table.
+ *
+ * Each join returns a pair of `INT32` gather maps: the first one holds the indices of the rows of
+ * the probe table and the second one the indices of the matching rows of the build table. A
+ * probe row without a match in a left or full join, and a build row without a match in a full
+ * join, is paired with the index `-1`.
+ *
+ * Dictionary columns are joined on their indices, so the dictionary columns of the probe tables
+ * must have the same keys column as those of the build table, e.g. by `dictionary::set_keys`.
+ *
+ * @note The build table must outlive the `hash_join` object.
+ */
+class hash_join {
+ public:
+  hash_join() = delete;
+  ~hash_join();
+  hash_join(hash_join const&) = delete;
+  hash_join(hash_join&&)      = delete;
+  hash_join& operator=(hash_join const&) = delete;
+  hash_join& operator=(hash_join&&) = delete;
+
+  /**
+   * @brief Construct a hash join object for subsequent probe calls.
+   *
+   * @throw cudf::logic_error if `build_on` is empty or out of range
+   *
+   * @param build The build table, from which the hash table is built.
+   * @param build_on The column indices from `build` to join on.
+   */
+  hash_join(cudf::table_view const& build, std::vector<size_type> const& build_on);
+
+  /**
+   * @brief Performs an inner join by probing in the internal hash table.
+   *
+   * @throw cudf::logic_error if the number or types of the `probe_on` columns do not match the
+   * `build_on` columns
+   *
+   * @param probe The probe table, from which the tuples are probed.
+   * @param probe_on The column indices from `probe` to join on.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param mr Device memory resource used to allocate the returned gather maps' device memory
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Gather maps of the probe and build tables
+   */
+  std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> inner_join(
+    cudf::table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    null_equality compare_nulls         = null_equality::EQUAL,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0) const;
+
+  /**
+   * @brief Performs a left join by probing in the internal hash table.
+   *
+   * Every row of `probe` appears at least once in the result.
+   *
+   * @throw cudf::logic_error if the number or types of the `probe_on` columns do not match the
+   * `build_on` columns
+   *
+   * @param probe The probe table, from which the tuples are probed.
+   * @param probe_on The column indices from `probe` to join on.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param mr Device memory resource used to allocate the returned gather maps' device memory
+   *
+   * @return Gather maps of the probe and build tables
+   */
+  std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> left_join(
+    cudf::table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    null_equality compare_nulls         = null_equality::EQUAL,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) const;
+
+  /**
+   * @brief Performs a full join by probing in the internal hash table.
+   *
+   * Every row of `probe` and of the build table appears at least once in the result; the
+   * unmatched build rows come last.
+   *
+   * @throw cudf::logic_error if the number or types of the `probe_on` columns do not match the
+   * `build_on` columns
+   *
+   * @param probe The probe table, from which the tuples are probed.
+   * @param probe_on The column indices from `probe` to join on.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param mr Device memory resource used to allocate the returned gather maps' device memory
+   *
+   * @return Gather maps of the probe and build tables
+   */
+  std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> full_join(
+    cudf::table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    null_equality compare_nulls         = null_equality::EQUAL,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) const;
+
+ private:
+  struct hash_join_impl;
+  const std::unique_ptr<const hash_join_impl> impl;
+};
+
+/**
+ * @brief Cross join of two tables returned one piece of bounded size at a time
+ *
+ * Concatenating the pieces returned by `next` gives `cross_join(left, right)`, in the same order,
+ * while the device memory used is that of a single piece of at most `max_chunk_rows` rows. The
+ * joined table may have more rows than a column can hold.
+ *
+ * If a predicate is given, only the joined rows for which it evaluates to true are returned, as
+ * `apply_boolean_mask` would keep them given the result of `compute_column` on the joined table.
+ * The predicate refers to the columns of `left` followed by the columns of `right`, as they are
+ * in the joined table. For each window of `max_chunk_rows` joined rows, only the columns the
+ * predicate refers to are gathered to evaluate it, and the other columns are gathered only for
+ * the rows it keeps. Pieces may then have fewer rows than `max_chunk_rows`, and the last one may
+ * be empty.
+ *
+ * @code{.pseudo}
+ * chunked_cross_join joiner(left, right, 1 << 20, &predicate);
+ * while (joiner.has_next()) { write(*joiner.next()); }
+ * @endcode
+ *
+ * @note The tables and the predicate must outlive the `chunked_cross_join` object.
+ */
+class chunked_cross_join {
+ public:
+  /**
+   * @brief Constructs a join returning no rows yet
+   *
+   * @throw cudf::logic_error if the number of columns in either `left` or `right` table is 0
+   * @throw cudf::logic_error if `max_chunk_rows` is not positive
+   * @throw cudf::logic_error if `predicate` cannot be evaluated on the joined table
+   *
+   * @param left The left table
+   * @param right The right table
+   * @param max_chunk_rows The maximum number of rows of a piece
+   * @param predicate The boolean expression selecting the joined rows to return, or `nullptr` to
+   * return all of them
+   */
+  chunked_cross_join(table_view const& left,
+                     table_view const& right,
+                     size_type max_chunk_rows,
+                     expression const* predicate = nullptr);
+
+  ~chunked_cross_join();
+
+  chunked_cross_join(chunked_cross_join const&) = delete;
+  chunked_cross_join& operator=(chunked_cross_join const&) = delete;
+
+  /**
+   * @brief Returns whether `next` has rows left to return
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Returns the next piece of the joined table
+   *
+   * @throw cudf::logic_error if `has_next()` is false
+   * @throw cudf::logic_error if the predicate is not of type `BOOL8`
+   *
+   * @param mr Device memory resource used to allocate the returned table's device memory
+   * @return The joined rows following those already returned
+   */
+  std::unique_ptr<table> next(
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+ private:
+  class impl;
+  std::unique_ptr<impl> _impl;
+};
+
 /** @} */  // end of group
 }  // namespace cudf
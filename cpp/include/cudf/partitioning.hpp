@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/copying.hpp>
 #include <cudf/types.hpp>
 #include <memory>
 #include <vector>
@@ -65,6 +66,66 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
   size_type num_partitions,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Partitions rows of `input` into the ranges between sorted splitter rows.
+ *
+ * `splitters` holds `n` rows sorted by `column_order` and `null_precedence`, which divide the
+ * rows into `n + 1` partitions: a row is in partition `i` when `i` splitters are ordered
+ * before it, i.e. `i` is the `lower_bound` of the row in `splitters`. A row equal to splitter
+ * `i` is therefore in partition `i`.
+ *
+ * The partitions are computed with a single batched `lower_bound` and the rows are moved to
+ * their partitions as by `partition`. Sorting each partition then sorts the whole table, which
+ * makes this the partitioning step of a distributed sort.
+ *
+ * Example:
+ * @code{.pseudo}
+ * input:     {5, 1, 9, 3, 7, 3}
+ * splitters: {3, 7}
+ * output:    {1, 3, 3, 5, 7, 9}, offsets {0, 3, 5, 6}
+ * @endcode
+ *
+ * @throw cudf::logic_error if `input` and `splitters` have different numbers of columns
+ *
+ * @param input The table to partition
+ * @param splitters Sorted rows that bound the partitions
+ * @param column_order The order of each column of `splitters`
+ * @param null_precedence The order of the nulls of each column of `splitters`
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @return Pair containing the reordered table and vector of `splitters.num_rows() + 2`
+ * offsets to each partition, as returned by `partition`.
+ */
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  table_view const& splitters,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Picks the splitters dividing a sample of a table into `num_partitions` ranges with
+ * the same number of sampled rows.
+ *
+ * The sample is sorted and the splitters are its rows at `i * sample.num_rows() /
+ * num_partitions` for `i` in `[1, num_partitions)`. Used with `range_partition` on the table,
+ * a representative sample gives partitions of similar sizes.
+ *
+ * @throw cudf::logic_error if `num_partitions <= 0`
+ *
+ * @param sample Rows sampled from the table to partition
+ * @param num_partitions The number of partitions
+ * @param column_order The order of each column of the partitioned table
+ * @param null_precedence The order of the nulls of each column of the partitioned table
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @return The `num_partitions - 1` sorted splitters, or no splitter if `sample` is empty
+ */
+std::unique_ptr<table> range_partition_splitters(
+  table_view const& sample,
+  size_type num_partitions,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Partitions rows from the input table into multiple output tables.
  *
@@ -73,11 +134,16 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
  * the same bin are grouped consecutively in the output table. Returns a vector
  * of row offsets to the start of each partition in the output table.
  *
+ * With `hash_id::HASH_SPARK_MURMUR3` a row is in the partition Spark's hash partitioning
+ * assigns it to, the non-negative remainder of its hash value, and with `hash_id::HASH_HIVE`
+ * in the bucket Hive assigns it to.
+ *
  * @throw std::out_of_range if index is `columns_to_hash` is invalid
  *
  * @param input The table to partition
  * @param columns_to_hash Indices of input columns to hash
  * @param num_partitions The number of partitions to use
+ * @param hash_function The hash function used to hash the rows
  * @param mr Device memory resource used to allocate the returned table's device memory.
  *
  * @returns An output table and a vector of row offsets to each partition
@@ -86,6 +152,36 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   table_view const& input,
   std::vector<size_type> const& columns_to_hash,
   int num_partitions,
+  hash_id hash_function               = hash_id::HASH_MURMUR3,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Partitions rows from the input table into one contiguous buffer per partition.
+ *
+ * The rows of `input` are assigned to `num_partitions` partitions as by `hash_partition`, and
+ * are copied directly into a separately owned contiguous buffer for each partition, laid out
+ * as by `contiguous_split`. This avoids the second copy of `contiguous_split` on the result of
+ * `hash_partition` when the partitions are sent to other processes, e.g. with `pack_metadata`.
+ *
+ * Returns `num_partitions` results, empty partitions included, or no result if
+ * `num_partitions <= 0` or `columns_to_hash` is empty.
+ *
+ * @throw cudf::logic_error if a column of `input` is neither fixed-width nor strings
+ * @throw std::out_of_range if index is `columns_to_hash` is invalid
+ *
+ * @param input The table to partition
+ * @param columns_to_hash Indices of input columns to hash
+ * @param num_partitions The number of partitions to use
+ * @param hash_function The hash function used to hash the rows
+ * @param mr Device memory resource used to allocate the returned buffers' device memory.
+ *
+ * @returns The view of each partition and the buffer holding its data
+ */
+std::vector<contiguous_split_result> hash_partition_packed(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  hash_id hash_function               = hash_id::HASH_MURMUR3,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
 /**
@@ -231,5 +327,89 @@ std::pair<std::unique_ptr<cudf::table>, std::vector<cudf::size_type>> round_robi
   cudf::size_type start_partition     = 0,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Transport exchanging the packed partitions of `shuffle` between the ranks of a
+ * group of processes, e.g. over NCCL or UCX.
+ *
+ * The ranks are numbered `[0, size())`. Each message is the host metadata and the device data
+ * of a packed table, as returned by `pack`.
+ */
+class shuffle_communicator {
+ public:
+  virtual ~shuffle_communicator() = default;
+
+  /**
+   * @brief Returns the rank of this process.
+   */
+  virtual int rank() const = 0;
+
+  /**
+   * @brief Returns the number of ranks.
+   */
+  virtual int size() const = 0;
+
+  /**
+   * @brief Starts sending a packed table to rank `destination` and returns without waiting for
+   * the send to complete.
+   *
+   * The device data is ready once the work queued on `stream` has completed, and remains valid
+   * until `synchronize` returns.
+   *
+   * @param destination Rank receiving the table
+   * @param metadata Host metadata of the table
+   * @param gpu_data Device data of the table
+   * @param stream CUDA stream on which the device data is written
+   */
+  virtual void send(int destination,
+                    std::vector<uint8_t> const& metadata,
+                    rmm::device_buffer const& gpu_data,
+                    cudaStream_t stream) = 0;
+
+  /**
+   * @brief Receives the packed table sent by rank `source`.
+   *
+   * @param source Rank sending the table
+   * @param mr Device memory resource used to allocate the received device data
+   * @param stream CUDA stream on which the received device data is used
+   * @return The received host metadata and device data
+   */
+  virtual packed_columns recv(int source,
+                              rmm::mr::device_memory_resource* mr,
+                              cudaStream_t stream) = 0;
+
+  /**
+   * @brief Waits until all the sends started by `send` have completed.
+   */
+  virtual void synchronize() = 0;
+};
+
+/**
+ * @brief Exchanges the rows of a table distributed over the ranks of `communicator` so that
+ * each rank gets the rows of its hash partition.
+ *
+ * Every rank calls `shuffle` with its own rows. Their rows are partitioned into
+ * `communicator.size()` partitions by the hash of `columns_to_hash` as by
+ * `hash_partition_packed`, which writes each partition into its own contiguous buffer. The
+ * partitions are sent to their ranks straight from these buffers, all sends starting before
+ * the first receive, and the received tables are used in place before being concatenated
+ * in rank order into the returned table.
+ *
+ * @throw cudf::logic_error if `columns_to_hash` is empty
+ * @throw cudf::logic_error if a column of `input` is neither fixed-width nor strings
+ *
+ * @param input The rows of this rank
+ * @param columns_to_hash Indices of input columns to hash
+ * @param communicator Transport to the other ranks
+ * @param hash_function The hash function used to hash the rows
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @return The rows of all the ranks in the partition of this rank
+ */
+std::unique_ptr<table> shuffle(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  shuffle_communicator& communicator,
+  hash_id hash_function               = hash_id::HASH_MURMUR3,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -17,7 +17,10 @@
 #pragma once
 
 #include <cudf/aggregation.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/selection.hpp>
+#include <cudf/table/table_view.hpp>
 
 namespace cudf {
 /**
@@ -62,6 +65,154 @@ std::unique_ptr<scalar> reduce(
   data_type output_dtype,
   rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief  Computes several reductions of the values in all rows of a column.
+ *
+ * The result is the same as calling `reduce()` for each aggregation, but the reductions that
+ * can be derived from the same partial results are computed together in a single pass over the
+ * column: `sum`, `sum_of_squares`, `min` and `max` of arithmetic columns, and `mean`, `var` and
+ * `std` for a floating point `output_dtype`.
+ *
+ * `count` aggregations are also supported and return the number of valid elements
+ * (`null_policy::EXCLUDE`) or of all elements (`null_policy::INCLUDE`) as a `size_type` scalar,
+ * regardless of `output_dtype`.
+ *
+ * @throws cudf::logic_error for the same reasons as `reduce()` with a single aggregation.
+ *
+ * @param[in] col Input column view
+ * @param[in] aggs The aggregation operators applied by the reductions
+ * @param[in] output_dtype  The computation and output precision.
+ * @param[in] mr Device memory resource used to allocate the returned scalars' device memory
+ * @returns  One cudf::scalar result value per aggregation of @p aggs, in the same order
+ */
+std::vector<std::unique_ptr<scalar>> reduce(
+  const column_view &col,
+  std::vector<std::unique_ptr<aggregation>> const &aggs,
+  data_type output_dtype,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Computes the reduction of the values in all rows of each column of a table.
+ *
+ * Row `i` of the output is the result of `reduce()` of column `i`. The results are copied into
+ * the output on the device, so reading the reductions of many columns, e.g. to collect per-column
+ * statistics, costs a single copy to host instead of a read of each scalar result. A column with
+ * no valid rows results in a null row.
+ *
+ * @throws cudf::logic_error for the same reasons as `reduce()` of a column.
+ * @throws cudf::logic_error if @p output_dtype is not a fixed-width type.
+ *
+ * @param[in] input Input table view
+ * @param[in] agg unique_ptr of the aggregation operator applied by the reductions
+ * @param[in] output_dtype  The computation and output precision.
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ * @returns  Column of type @p output_dtype with the reduction of each column of @p input
+ */
+std::unique_ptr<column> reduce(
+  table_view const &input,
+  std::unique_ptr<aggregation> const &agg,
+  data_type output_dtype,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Computes the reduction of the values in the selected rows of a column.
+ *
+ * The result is the same as the reduction of the column compacted with
+ * `apply_selection()`, but the selected values are not copied: the rows that are not selected
+ * are skipped like null values.
+ *
+ * @throws cudf::logic_error if the sizes of `col` and `rows` mismatch.
+ * @throws cudf::logic_error for the same reasons as `reduce()` without selection.
+ *
+ * @param[in] col Input column view
+ * @param[in] rows The selection of the rows of @p col to reduce
+ * @param[in] agg unique_ptr of the aggregation operator applied by the reduction
+ * @param[in] output_dtype  The computation and output precision.
+ * @param[in] mr Device memory resource used to allocate the returned scalar's device memory
+ * @returns  cudf::scalar the result value
+ */
+std::unique_ptr<scalar> reduce(
+  const column_view &col,
+  selection const &rows,
+  std::unique_ptr<aggregation> const &agg,
+  data_type output_dtype,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Computes the reduction of the values in the rows of a column selected by a boolean mask.
+ *
+ * The result is the same as the reduction of the column filtered with `apply_boolean_mask()`,
+ * but the filtered values are not copied: the rows for which `boolean_mask` is null or `false`
+ * are skipped like null values.
+ *
+ * @throws cudf::logic_error if `boolean_mask` is not `type_id::BOOL8` type.
+ * @throws cudf::logic_error if the sizes of `col` and `boolean_mask` mismatch.
+ * @throws cudf::logic_error for the same reasons as `reduce()` without mask.
+ *
+ * @param[in] col Input column view
+ * @param[in] boolean_mask A nullable column_view of type type_id::BOOL8 selecting the rows of
+ * @p col to reduce
+ * @param[in] agg unique_ptr of the aggregation operator applied by the reduction
+ * @param[in] output_dtype  The computation and output precision.
+ * @param[in] mr Device memory resource used to allocate the returned scalar's device memory
+ * @returns  cudf::scalar the result value
+ */
+std::unique_ptr<scalar> reduce(
+  const column_view &col,
+  const column_view &boolean_mask,
+  std::unique_ptr<aggregation> const &agg,
+  data_type output_dtype,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Computes the reduction of the values in each segment of a column.
+ *
+ * Segment `i` spans the rows `[offsets[i], offsets[i + 1])` of `values`, and the output contains
+ * `offsets.size() - 1` rows. All segments are reduced by a single segmented reduction, without
+ * materializing a group-label column.
+ * Only `sum`, `product`, `min`, `max`, `any` and `all` are supported. `any` and `all` require a
+ * `type_id::BOOL8` `output_dtype`.
+ * The null values are skipped for the operation. The output row of a segment is null if the
+ * segment is empty or all its values are null.
+ *
+ * @throws cudf::logic_error if `offsets` is not `type_id::INT32` type or has nulls.
+ * @throws cudf::logic_error if the aggregation is not supported.
+ * @throws cudf::logic_error if `values` is not a fixed-width type.
+ * @throws cudf::logic_error if `values` data type is not convertible to `output_dtype`.
+ *
+ * @param[in] values Input column view
+ * @param[in] offsets Non-decreasing offsets of the segments, with one more element than the
+ * number of segments. The behavior is undefined if an offset is outside `[0, values.size()]`.
+ * @param[in] agg unique_ptr of the aggregation operator applied by the reduction
+ * @param[in] output_dtype  The computation and output precision.
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ * @returns  Column of type @p output_dtype with the reduction of each segment
+ */
+std::unique_ptr<column> segmented_reduce(
+  const column_view &values,
+  const column_view &offsets,
+  std::unique_ptr<aggregation> const &agg,
+  data_type output_dtype,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Computes the reduction of the elements of each list row of a lists column.
+ *
+ * Same as `segmented_reduce()` with the child column and the offsets of the lists column. The
+ * output row of a null list is null.
+ *
+ * @param[in] input Input lists column view
+ * @param[in] agg unique_ptr of the aggregation operator applied by the reduction
+ * @param[in] output_dtype  The computation and output precision.
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ * @returns  Column of type @p output_dtype with the reduction of each list row
+ */
+std::unique_ptr<column> segmented_reduce(
+  lists_column_view const &input,
+  std::unique_ptr<aggregation> const &agg,
+  data_type output_dtype,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
 /**
  * @brief  Computes the scan of a column.
  *
@@ -86,5 +237,40 @@ std::unique_ptr<column> scan(const column_view &input,
                              null_policy null_handling           = null_policy::EXCLUDE,
                              rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief  Computes the scan of each segment of a column.
+ *
+ * Segment `i` spans the rows `[offsets[i], offsets[i + 1])` of `values`, and the scan restarts
+ * at the first row of every segment, e.g. for the cumulative aggregations of sorted groups.
+ * All segments are scanned by a single scan over the column.
+ *
+ * The null values are skipped for the operation if @p null_handling is `null_policy::EXCLUDE`,
+ * and the output element at `i` is null if the input element at `i` is null. If
+ * @p null_handling is `null_policy::INCLUDE`, the output element at `i` is null if any element
+ * of its segment accumulated into it is null.
+ *
+ * @throws cudf::logic_error if `values` is not an arithmetic type.
+ * @throws cudf::logic_error if `offsets` is not `type_id::INT32` type or has nulls.
+ * @throws cudf::logic_error if the aggregation is not `sum`, `product`, `min` or `max`.
+ *
+ * @param[in] values The input column view for the scan
+ * @param[in] offsets Non-decreasing offsets of the segments, starting at 0 and ending at
+ * `values.size()`
+ * @param[in] agg unique_ptr to aggregation operator applied by the scan
+ * @param[in] inclusive The flag for applying an inclusive scan if
+ *            scan_type::INCLUSIVE, an exclusive scan if scan_type::EXCLUSIVE.
+ * @param[in] null_handling Exclude null values when computing the result if
+ * null_policy::EXCLUDE. Include nulls if null_policy::INCLUDE.
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ * @returns unique pointer to new output column
+ */
+std::unique_ptr<column> segmented_scan(
+  const column_view &values,
+  const column_view &offsets,
+  std::unique_ptr<aggregation> const &agg,
+  scan_type inclusive,
+  null_policy null_handling           = null_policy::EXCLUDE,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
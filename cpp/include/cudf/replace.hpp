@@ -17,7 +17,10 @@
 #pragma once
 
 #include <cudf/types.hpp>
+
+#include <functional>
 #include <memory>
+#include <vector>
 
 namespace cudf {
 /**
@@ -25,6 +28,14 @@ namespace cudf {
  * @{
  */
 
+/**
+ * @brief Policy to specify the position of replacement values relative to null rows
+ */
+enum class replace_policy : bool {
+  PRECEDING,  ///< the replacement value is the first non-null value preceding the null row
+  FOLLOWING   ///< the replacement value is the first non-null value following the null row
+};
+
 /**
  * @brief Replaces all null values in a column with corresponding values of another column
  *
@@ -60,6 +71,52 @@ std::unique_ptr<column> replace_nulls(
   scalar const& replacement,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Replaces the null values of each column of a table with a scalar.
+ *
+ * The null values of column `i` of `input` are replaced with `replacements[i]`, which must have
+ * the type of the column.
+ *
+ * @throws cudf::logic_error if the number of replacements is not the number of columns of `input`
+ * @throws cudf::logic_error if a replacement does not have the type of its column
+ *
+ * @param[in] input A table whose null values will be replaced
+ * @param[in] replacements The scalar replacing the null values of each column of `input`
+ * @param[in] mr Device memory resource used to allocate device memory of the returned table.
+ *
+ * @returns Copy of `input` with null values replaced by `replacements`.
+ */
+std::unique_ptr<table> replace_nulls(
+  table_view const& input,
+  std::vector<std::reference_wrapper<scalar const>> const& replacements,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Replaces each null value in a column with the nearest non-null value preceding or
+ * following it
+ *
+ * If `replace_policy` is `PRECEDING`, a null `input[i]` is replaced with the value of the last
+ * non-null row before `i`: the last valid observation is carried forward. If it is `FOLLOWING`,
+ * it is replaced with the value of the first non-null row after `i`. Nulls with no such row
+ * stay null.
+ *
+ * @code{.pseudo}
+ * input     = {1, NULL, NULL, 4, NULL}
+ * PRECEDING = {1, 1, 1, 4, 4}
+ * FOLLOWING = {1, 4, 4, 4, NULL}
+ * @endcode
+ *
+ * @param[in] input A column whose null values will be replaced
+ * @param[in] replace_policy Specify the position of the replacement values relative to the nulls
+ * @param[in] mr Device memory resource used to allocate device memory of the returned column.
+ *
+ * @returns Copy of `input` with null values replaced based on `replace_policy`.
+ */
+std::unique_ptr<column> replace_nulls(
+  column_view const& input,
+  replace_policy const& replace_policy,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Replaces all NaN values in a column with corresponding values from another column
  *
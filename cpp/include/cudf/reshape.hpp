@@ -17,8 +17,11 @@
 #pragma once
 
 #include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <memory>
+#include <vector>
 #include "cudf/types.hpp"
 
 namespace cudf {
@@ -68,5 +71,51 @@ std::unique_ptr<table> tile(table_view const& input,
                             size_type count,
                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Converts each row of a table of fixed-width columns into the Spark UnsafeRow format.
+ *
+ * Each row is converted into a list of bytes laid out as the fixed-length part of an UnsafeRow:
+ * a null bitset of `8 * ceil(num_columns / 64)` bytes, where bit `i` is set if column `i` is null,
+ * followed by an 8-byte little-endian slot for each column. Values smaller than 8 bytes are stored
+ * at the beginning of their slot. Unused bytes, including the slots of null values, are zero.
+ *
+ * ```
+ * input  = [[1, null], [true, false]]  (INT32, BOOL8)
+ * return = [[0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0],
+ *           [1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0]]
+ * ```
+ *
+ * @throws cudf::logic_error if a column is not fixed-width.
+ * @throws cudf::logic_error if the rows do not fit in a column.
+ *
+ * @param input Table to convert.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ *
+ * @return LIST column of INT8 with the bytes of each row.
+ */
+std::unique_ptr<column> convert_to_rows(
+  table_view const& input, rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Converts rows in the Spark UnsafeRow format, as returned by `convert_to_rows`, into a
+ * table of fixed-width columns.
+ *
+ * Every row must have the size of an UnsafeRow with a column of each of `schema`'s types. The
+ * returned columns always have a null mask.
+ *
+ * @throws cudf::logic_error if a type of `schema` is not fixed-width.
+ * @throws cudf::logic_error if the rows do not have the size of a row of `schema`.
+ *
+ * @param input LIST column of INT8 with the bytes of each row.
+ * @param schema The types of the columns of the rows.
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ *
+ * @return Table of the rows' values.
+ */
+std::unique_ptr<table> convert_from_rows(
+  lists_column_view const& input,
+  std::vector<data_type> const& schema,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
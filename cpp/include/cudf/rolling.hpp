@@ -16,9 +16,11 @@
 
 #pragma once
 
+#include <cudf/groupby.hpp>
 #include <cudf/types.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace cudf {
 /**
@@ -43,6 +45,9 @@ namespace cudf {
  * column of the same type as the input. Therefore it is suggested to convert integer column types
  * (especially low-precision integers) to `FLOAT32` or `FLOAT64` before doing a rolling `MEAN`.
  *
+ * The window functions `LEAD`, `LAG`, `NTH_ELEMENT`, `RANK` and `DENSE_RANK` are computed as in
+ * `grouped_rolling_window()`, all the rows forming a single group.
+ *
  * @param[in] input_col The input column
  * @param[in] preceding_window The static rolling window size in the backward direction.
  * @param[in] following_window The static rolling window size in the forward direction.
@@ -60,6 +65,30 @@ std::unique_ptr<column> rolling_window(
   std::unique_ptr<aggregation> const& agg,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief  Applies several fixed-size rolling window functions to the values in a column.
+ *
+ * Returns the same columns as calling `rolling_window` once for each of `aggs`. When all the
+ * aggregations are among SUM, MIN, MAX, COUNT and MEAN over a numeric column, the windows are
+ * read once and every aggregation is computed in the same pass.
+ *
+ * @param[in] input_col The input column
+ * @param[in] preceding_window The static rolling window size in the backward direction.
+ * @param[in] following_window The static rolling window size in the forward direction.
+ * @param[in] min_periods Minimum number of observations in window required to have a value,
+ *                        otherwise element `i` is null.
+ * @param[in] aggs The rolling window aggregation types (SUM, MAX, MIN, etc.)
+ *
+ * @returns   A nullable output column for each of `aggs`, in the same order
+ **/
+std::vector<std::unique_ptr<column>> rolling_window(
+  column_view const& input,
+  size_type preceding_window,
+  size_type following_window,
+  size_type min_periods,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief  Applies a grouping-aware, fixed-size rolling window function to the values in a column.
  *
@@ -120,6 +149,15 @@ std::unique_ptr<column> rolling_window(
  * column of the same type as the input. Therefore it is suggested to convert integer column types
  * (especially low-precision integers) to `FLOAT32` or `FLOAT64` before doing a rolling `MEAN`.
  *
+ * The SQL window functions are computed in the same pass over the windows, for any input type:
+ * - `LEAD(offset)` and `LAG(offset)` return the element `offset` rows after or before each row,
+ *   null when that row is outside the window. The window must thus extend at least `offset` rows
+ *   in their direction. They are null regardless of `min_periods`.
+ * - `FIRST_VALUE` and `LAST_VALUE` are `NTH_ELEMENT` aggregations of `0` and `-1`: the first and
+ *   last element of each window, or of the valid elements of the window if nulls are excluded.
+ * - `RANK` and `DENSE_RANK` rank the rows of each group, which must be sorted by `input`, and
+ *   ignore the window bounds and `min_periods`. Their result is an `INT32` column without nulls.
+ *
  * @param[in] group_keys The (pre-sorted) grouping columns
  * @param[in] input The input column (to be aggregated)
  * @param[in] preceding_window The static rolling window size in the backward direction.
@@ -139,6 +177,69 @@ std::unique_ptr<column> grouped_rolling_window(
   std::unique_ptr<aggregation> const& aggr,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief  Applies a grouping-aware, fixed-size rolling window function to the values in a column,
+ * grouped by a precomputed `grouping`
+ *
+ * Like `grouped_rolling_window()` above, but the rows need not be sorted by their keys: the
+ * windows span the rows of each group in the order of `groups.key_sort_order()`. The sort of the
+ * keys is memoized in `groups` and shared with the other operations using it. The results are
+ * returned in the original order of the rows. Rows that do not belong to any group, i.e., with
+ * NULL keys excluded from `groups`, are null.
+ *
+ * @throws cudf::logic_error if `input.size() != groups.keys().num_rows()`
+ *
+ * @param[in] groups The grouping of the rows of `input`
+ * @param[in] input The input column (to be aggregated)
+ * @param[in] preceding_window The static rolling window size in the backward direction.
+ * @param[in] following_window The static rolling window size in the forward direction.
+ * @param[in] min_periods Minimum number of observations in window required to have a value,
+ *                        otherwise element `i` is null.
+ * @param[in] aggr The rolling window aggregation type (SUM, MAX, MIN, etc.)
+ *
+ * @returns   A nullable output column containing the rolling window results
+ **/
+std::unique_ptr<column> grouped_rolling_window(
+  groupby::grouping const& groups,
+  column_view const& input,
+  size_type preceding_window,
+  size_type following_window,
+  size_type min_periods,
+  std::unique_ptr<aggregation> const& aggr,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Applies a grouping-aware, fixed-size `LEAD` or `LAG` window function to the values in
+ * a column, with default values for the rows whose lead or lag is outside their window
+ *
+ * Same as `grouped_rolling_window()` with a `LEAD` or `LAG` aggregation, except that row `i` of
+ * the result is `default_outputs[i]` instead of null when the row `offset` rows after or before
+ * it is outside its window.
+ *
+ * @throws cudf::logic_error if `aggr` is not a `LEAD` or `LAG` aggregation
+ * @throws cudf::logic_error if `default_outputs` and `input` differ in type or size
+ *
+ * @param[in] group_keys The (pre-sorted) grouping columns
+ * @param[in] input The input column (to be aggregated)
+ * @param[in] default_outputs The values of the rows without a lead or lag in their window
+ * @param[in] preceding_window The static rolling window size in the backward direction.
+ * @param[in] following_window The static rolling window size in the forward direction.
+ * @param[in] min_periods Minimum number of observations in window required to have a value,
+ *                        otherwise element `i` is null.
+ * @param[in] aggr The `LEAD` or `LAG` aggregation
+ *
+ * @returns   An output column containing the rolling window results
+ **/
+std::unique_ptr<column> grouped_rolling_window(
+  table_view const& group_keys,
+  column_view const& input,
+  column_view const& default_outputs,
+  size_type preceding_window,
+  size_type following_window,
+  size_type min_periods,
+  std::unique_ptr<aggregation> const& aggr,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief  Applies a grouping-aware, timestamp-based rolling window function to the values in a
  *column.
@@ -210,6 +311,15 @@ std::unique_ptr<column> grouped_rolling_window(
  * column of the same type as the input. Therefore it is suggested to convert integer column types
  * (especially low-precision integers) to `FLOAT32` or `FLOAT64` before doing a rolling `MEAN`.
  *
+ * The SQL window functions are computed in the same pass over the windows, for any input type:
+ * - `LEAD(offset)` and `LAG(offset)` return the element `offset` rows after or before each row,
+ *   null when that row is outside the window. The window must thus extend at least `offset` rows
+ *   in their direction. They are null regardless of `min_periods`.
+ * - `FIRST_VALUE` and `LAST_VALUE` are `NTH_ELEMENT` aggregations of `0` and `-1`: the first and
+ *   last element of each window, or of the valid elements of the window if nulls are excluded.
+ * - `RANK` and `DENSE_RANK` rank the rows of each group, which must be sorted by `input`, and
+ *   ignore the window bounds and `min_periods`. Their result is an `INT32` column without nulls.
+ *
  * @param[in] group_keys The (pre-sorted) grouping columns
  * @param[in] timestamp_column The (pre-sorted) timestamps for each row
  * @param[in] timestamp_order  The order (ASCENDING/DESCENDING) in which the timestamps are sorted
@@ -233,6 +343,42 @@ std::unique_ptr<column> grouped_time_range_rolling_window(
   std::unique_ptr<aggregation> const& aggr,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief  Applies a time-range rolling window function to the values in a column.
+ *
+ * This is `grouped_time_range_rolling_window` with all the rows in a single group: the window of
+ * each row spans the rows whose timestamps are at most `preceding_window_in_days` before and
+ * `following_window_in_days` after the timestamp of the row.
+ *
+ * @code{.pseudo}
+ * Date :(202001-)  [ 01,  02,  03,  07,  07 ]
+ * Input:           [ 10,  20,  10,  50,  60 ]
+ *
+ * SUM with 1 day preceding, 1 day following and min_periods 1:
+ * Results:         [ 30,  40,  30,  110, 110 ]
+ * @endcode
+ *
+ * @param[in] timestamp_column The (pre-sorted) timestamps for each row
+ * @param[in] timestamp_order  The order (ASCENDING/DESCENDING) in which the timestamps are sorted
+ * @param[in] input The input column (to be aggregated)
+ * @param[in] preceding_window_in_days The rolling window time-interval in the backward direction.
+ * @param[in] following_window_in_days The rolling window time-interval in the forward direction.
+ * @param[in] min_periods Minimum number of observations in window required to have a value,
+ *                        otherwise element `i` is null.
+ * @param[in] aggr The rolling window aggregation type (SUM, MAX, MIN, etc.)
+ *
+ * @returns   A nullable output column containing the rolling window results
+ */
+std::unique_ptr<column> time_range_rolling_window(
+  column_view const& timestamp_column,
+  cudf::order const& timestamp_order,
+  column_view const& input,
+  size_type preceding_window_in_days,
+  size_type following_window_in_days,
+  size_type min_periods,
+  std::unique_ptr<aggregation> const& aggr,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief  Applies a variable-size rolling window function to the values in a column.
  *
@@ -275,5 +421,49 @@ std::unique_ptr<column> rolling_window(
   std::unique_ptr<aggregation> const& agg,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief  Applies several variable-size rolling window functions to the values in a column.
+ *
+ * Returns the same columns as calling `rolling_window` once for each of `aggs`. When all the
+ * aggregations are among SUM, MIN, MAX, COUNT and MEAN over a numeric column, the windows are
+ * read once and every aggregation is computed in the same pass.
+ *
+ * @throws cudf::logic_error if window column type is not INT32
+ *
+ * @param[in] input_col The input column
+ * @param[in] preceding_window A non-nullable column of INT32 window sizes in the forward direction.
+ * @param[in] following_window A non-nullable column of INT32 window sizes in the backward
+ *                             direction.
+ * @param[in] min_periods Minimum number of observations in window required to have a value,
+ *                        otherwise element `i` is null.
+ * @param[in] aggs The rolling window aggregation types (sum, max, min, etc.)
+ *
+ * @returns   A nullable output column for each of `aggs`, in the same order
+ */
+std::vector<std::unique_ptr<column>> rolling_window(
+  column_view const& input,
+  column_view const& preceding_window,
+  column_view const& following_window,
+  size_type min_periods,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Compiles the rolling window kernels of a user-defined aggregation ahead of use.
+ *
+ * User-defined rolling window aggregations are JIT compiled the first time they are applied to a
+ * type. This compiles the kernels of the fixed-size, variable-size and grouped rolling windows of
+ * `agg` over each of `input_types`, so that later calls to the rolling window functions do not
+ * wait for the compilation. The compiled kernels are also written to the kernel cache directory,
+ * which can then be shared with other processes through `LIBCUDF_KERNEL_CACHE_READONLY_PATH`.
+ *
+ * @throws cudf::logic_error if `agg` is not a CUDA or PTX user-defined aggregation
+ *
+ * @param[in] input_types The types of the input columns the aggregation will be applied to
+ * @param[in] agg The user-defined rolling window aggregation
+ */
+void precompile_rolling_window_udf(std::vector<data_type> const& input_types,
+                                   std::unique_ptr<aggregation> const& agg);
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <memory>
+
+namespace cudf {
+/**
+ * @addtogroup reorder_compact
+ * @{
+ */
+
+/**
+ * @brief A set of selected rows of a table, stored as a bitmask with one bit per row.
+ *
+ * A selection is the result of a filter that has not been applied yet. Successive filters refine
+ * the selection instead of compacting the table at every stage, and the selected rows are only
+ * copied once with `apply_selection()`, or never when they are only reduced.
+ */
+class selection {
+ public:
+  selection()                 = delete;
+  ~selection()                = default;
+  selection(selection const&) = delete;
+  selection(selection&&)      = default;
+  selection& operator=(selection const&) = delete;
+  selection& operator=(selection&&) = default;
+
+  /**
+   * @brief Construct a selection from a bitmask in which set bits mark the selected rows.
+   *
+   * @param mask Bitmask with at least `size` bits
+   * @param size Number of rows of the table the selection applies to
+   * @param selected_count Number of set bits in the first `size` bits of `mask`
+   */
+  selection(rmm::device_buffer&& mask, size_type size, size_type selected_count)
+    : _mask{std::move(mask)}, _size{size}, _selected_count{selected_count}
+  {
+  }
+
+  /**
+   * @brief Returns the number of rows of the table the selection applies to
+   */
+  size_type size() const noexcept { return _size; }
+
+  /**
+   * @brief Returns the number of selected rows
+   */
+  size_type selected_count() const noexcept { return _selected_count; }
+
+  /**
+   * @brief Returns the device bitmask in which bit `i` is set if row `i` is selected
+   */
+  bitmask_type const* mask() const noexcept
+  {
+    return static_cast<bitmask_type const*>(_mask.data());
+  }
+
+ private:
+  rmm::device_buffer _mask{};
+  size_type _size{};
+  size_type _selected_count{};
+};
+
+/**
+ * @brief Creates the selection of the rows for which `boolean_mask` is non-null and `true`.
+ *
+ * @throws cudf::logic_error if `boolean_mask` is not `type_id::BOOL8` type.
+ *
+ * @param[in] boolean_mask A nullable column_view of type type_id::BOOL8
+ * @param[in] mr Device memory resource used to allocate the returned selection's device memory
+ * @return The selection of the rows passing the filter defined by @p boolean_mask
+ */
+std::unique_ptr<selection> make_selection(
+  column_view const& boolean_mask,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Refines a selection with another filter.
+ *
+ * A row is selected in the result if it is selected in `rows` and `boolean_mask` is non-null and
+ * `true` for it. `boolean_mask` has one element per row of the table, so it may be computed over
+ * the full columns without compacting them first.
+ *
+ * @throws cudf::logic_error if `boolean_mask` is not `type_id::BOOL8` type.
+ * @throws cudf::logic_error if the sizes of `rows` and `boolean_mask` mismatch.
+ *
+ * @param[in] rows The selection to refine
+ * @param[in] boolean_mask A nullable column_view of type type_id::BOOL8
+ * @param[in] mr Device memory resource used to allocate the returned selection's device memory
+ * @return The selection of the rows of @p rows passing the filter defined by @p boolean_mask
+ */
+std::unique_ptr<selection> make_selection(
+  selection const& rows,
+  column_view const& boolean_mask,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Copies the selected rows of a table.
+ *
+ * This operation is stable: the input order is preserved.
+ *
+ * @throws cudf::logic_error if the sizes of `input` and `rows` mismatch.
+ *
+ * @param[in] input The input table_view to filter
+ * @param[in] rows The selection of the rows to copy
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ * @return Table containing a copy of the rows of @p input selected by @p rows
+ */
+std::unique_ptr<table> apply_selection(
+  table_view const& input,
+  selection const& rows,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/** @} */  // end of group
+}  // namespace cudf
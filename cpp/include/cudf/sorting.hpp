@@ -19,6 +19,7 @@
 #include <cudf/types.hpp>
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace cudf {
@@ -52,6 +53,7 @@ enum class rank_method {
  * for each column.  Size must be equal to `input.num_columns()` or empty.
  * If empty, all columns will be sorted in `null_order::BEFORE`.
  * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  * @return A non-nullable column of `size_type` elements containing the permuted row indices of
  * `input` if it were sorted
  */
@@ -59,7 +61,8 @@ std::unique_ptr<column> sorted_order(
   table_view input,
   std::vector<order> const& column_order         = {},
   std::vector<null_order> const& null_precedence = {},
-  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource(),
+  cudaStream_t stream                            = 0);
 
 /**
  * @brief Computes the row indices that would produce `input` in a stable
@@ -73,7 +76,8 @@ std::unique_ptr<column> stable_sorted_order(
   table_view input,
   std::vector<order> const& column_order         = {},
   std::vector<null_order> const& null_precedence = {},
-  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource(),
+  cudaStream_t stream                            = 0);
 
 /**
  * @brief Checks whether the rows of a `table` are sorted in a lexicographical
@@ -95,6 +99,21 @@ bool is_sorted(cudf::table_view const& table,
                std::vector<order> const& column_order,
                std::vector<null_order> const& null_precedence);
 
+/**
+ * @brief Checks whether the rows of a `table` are sorted in a lexicographical order, without
+ *        reading the rows when the table is known to be sorted.
+ *
+ * Returns true without scanning the rows when `table.is_sorted_by()` all its columns in
+ * `column_order` and `null_precedence`, e.g. for the result of `sort`, and checks the rows as
+ * `is_sorted` of `table.view()` does otherwise.
+ *
+ * @copydetails cudf::is_sorted(cudf::table_view const&, std::vector<order> const&,
+ * std::vector<null_order> const&)
+ */
+bool is_sorted(cudf::table const& table,
+               std::vector<order> const& column_order,
+               std::vector<null_order> const& null_precedence);
+
 /**
  * @brief Performs a lexicographic sort of the rows of a table
  *
@@ -180,5 +199,262 @@ std::unique_ptr<column> rank(column_view const& input,
                              bool percentage,
                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Computes the ranks of an input column, as `rank` does, skipping the sort when the
+ * column is already sorted.
+ *
+ * When `is_sorted` is `sorted::YES`, `input` must already be sorted in `column_order` with its
+ * nulls placed by `null_precedence`, e.g. the output of `sort_by_key`; the ranks are then computed
+ * in a single scan of the runs of equal elements, without sorting.
+ *
+ * @copydetails cudf::rank
+ *
+ * @param is_sorted Whether `input` is already sorted
+ */
+std::unique_ptr<column> rank(column_view const& input,
+                             rank_method method,
+                             order column_order,
+                             null_policy null_handling,
+                             null_order null_precedence,
+                             bool percentage,
+                             sorted is_sorted,
+                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Computes the ranks of the elements of each segment of an input column independently,
+ * e.g., the ranks of the values within each group of a groupby.
+ *
+ * The segments are the ranges of elements `[segment_offsets[i], segment_offsets[i + 1])`, and
+ * each segment of `input` must already be sorted, e.g. by `segmented_sort_by_key`. The ranks
+ * restart from 1 in each segment, and percentages are relative to the size of the segment, so
+ * that no sort is needed.
+ *
+ * @code{.pseudo}
+ * input           = { 1, 4, 4, 9, 2, 2, 3 }
+ * segment_offsets = { 0, 4, 7 }
+ * MIN    result   = { 1, 2, 2, 4, 1, 1, 3 }
+ * DENSE  result   = { 1, 2, 2, 3, 1, 1, 2 }
+ * @endcode
+ *
+ * @throws cudf::logic_error if `segment_offsets` is not a non-nullable `size_type` column
+ *
+ * @param input The column to rank, sorted within each segment
+ * @param segment_offsets The offsets of the segments; the first offset must be 0 and the last
+ * `input.size()`
+ * @param method The ranking method used for tie breaking (same values).
+ * @param null_handling  flag to include nulls during ranking. If nulls are not
+ * included, corresponding rank will be null.
+ * @param percentage flag to convert ranks to percentage of their segment in range (0,1}
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return A column of the rank of each element of `input` within its segment, of the same type
+ * as the result of `rank`
+ */
+std::unique_ptr<column> segmented_rank(
+  column_view const& input,
+  column_view const& segment_offsets,
+  rank_method method,
+  null_policy null_handling,
+  bool percentage,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Computes the row indices that would sort each segment of the rows of `keys`
+ * independently, in a stable lexicographical order.
+ *
+ * The segments are the ranges of rows `[segment_offsets[i], segment_offsets[i + 1])`, e.g., the
+ * group offsets of sorted groupby keys. The indices of the rows of each segment are returned in
+ * the same range of the result, so the segments stay in place.
+ *
+ * @code{.pseudo}
+ * keys            = { 3, 1, 2, 9, 8, 7, 7 }
+ * segment_offsets = { 0, 3, 7 }
+ * result          = { 1, 2, 0, 5, 6, 4, 3 }
+ * @endcode
+ *
+ * @throws cudf::logic_error if `segment_offsets` is not a non-nullable `size_type` column
+ *
+ * @param keys The table to sort
+ * @param segment_offsets The offsets of the segments; the first offset must be 0 and the last
+ * `keys.num_rows()`
+ * @param column_order The desired sort order for each column. Size must be
+ * equal to `keys.num_columns()` or empty. If empty, all columns will be sorted
+ * in ascending order.
+ * @param null_precedence The desired order of null compared to other elements
+ * for each column.  Size must be equal to `keys.num_columns()` or empty.
+ * If empty, all columns will be sorted in `null_order::BEFORE`.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return A non-nullable column of `size_type` elements containing the permuted row indices of
+ * `keys` if each segment were sorted
+ */
+std::unique_ptr<column> segmented_sorted_order(
+  table_view const& keys,
+  column_view const& segment_offsets,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
+
+/**
+ * @brief Performs a key-value sort of each segment of the rows independently.
+ *
+ * Creates a new table that reorders the rows of each segment of `values` according to the
+ * lexicographic ordering of the rows of the same segment of `keys`.
+ *
+ * @throws cudf::logic_error if `values.num_rows() != keys.num_rows()`.
+ *
+ * @copydetails cudf::segmented_sorted_order
+ *
+ * @param values The table to reorder
+ */
+std::unique_ptr<table> segmented_sort_by_key(
+  table_view const& values,
+  table_view const& keys,
+  column_view const& segment_offsets,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
+
+/**
+ * @brief Computes the row indices of the first `k` elements of `input` in sorted order.
+ *
+ * Equivalent to the first `k` indices of `stable_sorted_order`, e.g. the indices of the `k`
+ * largest elements for `order::DESCENDING`, but fixed-width elements are found by a radix
+ * selection of the `k`-th element in a few linear passes, and only the `k` selected elements are
+ * sorted.
+ *
+ * @code{.pseudo}
+ * input  = { 3, 9, 1, 7, 9, 4 }
+ * k      = 3
+ * result = { 1, 4, 3 }  // for order::DESCENDING
+ * @endcode
+ *
+ * @param input The column to select from
+ * @param k The number of elements to select; all elements are returned if `k > input.size()`
+ * @param column_order The desired sort order
+ * @param null_precedence The desired order of null compared to other elements
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return A non-nullable column of `min(k, input.size())` `size_type` row indices of `input`
+ */
+std::unique_ptr<column> top_k_order(
+  column_view const& input,
+  size_type k,
+  order column_order                  = order::DESCENDING,
+  null_order null_precedence          = null_order::BEFORE,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Computes the row indices of the first `k` elements in sorted order of each segment of
+ * `input`, e.g., the top `k` values of each group of a groupby.
+ *
+ * The `k`-th elements of the segments of a fixed-width column without nulls are found together by
+ * a radix selection, and only the selected elements are sorted. Other columns are sorted whole.
+ *
+ * @code{.pseudo}
+ * input           = { 3, 1, 2, 9, 8, 7, 7 }
+ * segment_offsets = { 0, 3, 7 }
+ * k               = 2
+ * result          = { { 0, 2, 3, 4 }, { 0, 2, 4 } }  // for order::DESCENDING
+ * @endcode
+ *
+ * @throws cudf::logic_error if `segment_offsets` is not a non-nullable `size_type` column
+ *
+ * @param input The column to select from
+ * @param segment_offsets The offsets of the segments; the first offset must be 0 and the last
+ * `input.size()`
+ * @param k The number of elements to select from each segment
+ * @param column_order The desired sort order
+ * @param null_precedence The desired order of null compared to other elements
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return Pair of a column of the selected row indices of `input`, the indices selected from each
+ * segment being contiguous and sorted, and a column of the offsets of the selected indices of each
+ * segment
+ */
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> segmented_top_k_order(
+  column_view const& input,
+  column_view const& segment_offsets,
+  size_type k,
+  order column_order                  = order::DESCENDING,
+  null_order null_precedence          = null_order::BEFORE,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Sorts a table too large for device memory, given as a sequence of batches
+ *
+ * Each batch passed to `push` is sorted on the device and spilled to pinned host memory as a run
+ * of chunks of at most `chunk_rows` rows. `next` then merges the runs on the device, loading one
+ * chunk of each run at a time, and returns the sorted table one piece at a time. Concatenating the
+ * pieces returned by `next` gives the rows of all the batches sorted by the key columns, with the
+ * order of rows with equal keys unspecified.
+ *
+ * The device memory used is about one sorted batch while pushing, and one chunk of each run plus
+ * the returned piece while merging, so `chunk_rows` should be chosen such that a chunk of every
+ * run fits in device memory at once.
+ *
+ * @code{.pseudo}
+ * external_sorter sorter({0}, {order::ASCENDING});
+ * for (auto const& batch : batches) { sorter.push(batch); }
+ * while (sorter.has_next()) { write(*sorter.next()); }
+ * @endcode
+ */
+class external_sorter {
+ public:
+  static constexpr size_type default_chunk_rows = 1 << 22;
+
+  /**
+   * @brief Constructs an empty sorter
+   *
+   * @throws cudf::logic_error if `key_cols` is empty, or `column_order` or a non-empty
+   * `null_precedence` does not have one element per key column
+   * @throws cudf::logic_error if `chunk_rows` is not positive
+   *
+   * @param key_cols Indices of the columns of the batches to sort by
+   * @param column_order The desired sort order of each key column
+   * @param null_precedence The desired order of null compared to other elements of each key
+   * column; nulls are before other elements if empty
+   * @param chunk_rows The number of rows of the chunks spilled to host memory
+   */
+  external_sorter(std::vector<size_type> const& key_cols,
+                  std::vector<order> const& column_order,
+                  std::vector<null_order> const& null_precedence = {},
+                  size_type chunk_rows                           = default_chunk_rows);
+
+  ~external_sorter();
+
+  external_sorter(external_sorter const&) = delete;
+  external_sorter& operator=(external_sorter const&) = delete;
+
+  /**
+   * @brief Sorts a batch and spills it to host memory
+   *
+   * @throws cudf::logic_error if `next` has been called
+   * @throws cudf::logic_error if the columns of `batch` do not have the types of the columns of
+   * the previous batches
+   *
+   * @param batch The rows to add
+   */
+  void push(table_view const& batch);
+
+  /**
+   * @brief Returns whether `next` has rows left to return
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Returns the next piece of the sorted table
+   *
+   * No batch can be pushed once `next` has been called.
+   *
+   * @throws cudf::logic_error if `has_next()` is false
+   *
+   * @param mr Device memory resource used to allocate the returned table's device memory
+   * @return The smallest rows not yet returned, sorted
+   */
+  std::unique_ptr<table> next(
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+ private:
+  class impl;
+  std::unique_ptr<impl> _impl;
+};
+
 /** @} */  // end of group
 }  // namespace cudf
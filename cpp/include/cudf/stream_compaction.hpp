@@ -239,6 +239,26 @@ std::unique_ptr<table> drop_duplicates(
   null_equality nulls_equal           = null_equality::EQUAL,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Create a new table without duplicate rows, skipping the sort of `input` when it is
+ * known to be sorted.
+ *
+ * Same as `drop_duplicates` of `input.view()`. When `input.is_sorted_by(keys)`, e.g. `input` is
+ * the result of `sort` or of a previous `drop_duplicates` on the same keys, duplicate rows are
+ * already consecutive and are dropped in a single pass, without sorting.
+ *
+ * The result records that it is sorted by `keys` in ascending order.
+ *
+ * @copydetails cudf::drop_duplicates(table_view const&, std::vector<size_type> const&,
+ * duplicate_keep_option, null_equality, rmm::mr::device_memory_resource*)
+ */
+std::unique_ptr<table> drop_duplicates(
+  table const& input,
+  std::vector<size_type> const& keys,
+  duplicate_keep_option keep,
+  null_equality nulls_equal           = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Count the unique elements in the column_view
  *
@@ -272,5 +292,73 @@ cudf::size_type distinct_count(column_view const& input,
 cudf::size_type distinct_count(table_view const& input,
                                null_equality nulls_equal = null_equality::EQUAL);
 
+/**
+ * @brief Builds a HyperLogLog sketch of the distinct elements of a column
+ *
+ * The sketch is an INT32 column of `2^precision` registers, computed in a single hash pass over
+ * `input`. Sketches of different columns (e.g. batches of a table, or partitions on different
+ * GPUs) with the same precision are merged with `merge_distinct_count_sketches()`, and the
+ * number of distinct elements is estimated with `estimate_distinct_count()`.
+ *
+ * `NaN` values are counted as a single valid value.
+ *
+ * @throws cudf::logic_error if `precision` is not in `[4, 18]`.
+ *
+ * @param[in] input The column_view whose unique elements will be counted.
+ * @param[in] precision Number of bits of the hash value indexing the registers.
+ * @param[in] null_handling flag to include or ignore `null` while counting
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @return The sketch of the unique elements of @p input
+ */
+std::unique_ptr<column> make_distinct_count_sketch(
+  column_view const& input,
+  int precision                       = 12,
+  null_policy null_handling           = null_policy::EXCLUDE,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Merges HyperLogLog sketches of distinct elements into one sketch
+ *
+ * The result is the sketch of the union of the columns the sketches were built from.
+ *
+ * @throws cudf::logic_error if `sketches` is empty or the sketches have different sizes.
+ *
+ * @param[in] sketches Sketches built by `make_distinct_count_sketch()` with the same precision
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @return The merged sketch
+ */
+std::unique_ptr<column> merge_distinct_count_sketches(
+  std::vector<column_view> const& sketches,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Estimates the number of distinct elements from a HyperLogLog sketch
+ *
+ * The relative standard error of the estimate is about `1.04 / sqrt(sketch.size())`.
+ *
+ * @param[in] sketch A sketch built by `make_distinct_count_sketch()` or
+ * `merge_distinct_count_sketches()`
+ *
+ * @return The estimated number of unique elements
+ */
+cudf::size_type estimate_distinct_count(column_view const& sketch);
+
+/**
+ * @brief Estimates the number of unique elements in the column_view without sorting it
+ *
+ * Same as `estimate_distinct_count(make_distinct_count_sketch(input, precision, null_handling))`.
+ *
+ * @param[in] input The column_view whose unique elements will be counted.
+ * @param[in] precision Number of bits of the hash value indexing the sketch registers.
+ * @param[in] null_handling flag to include or ignore `null` while counting
+ *
+ * @return The estimated number of unique elements
+ */
+cudf::size_type approx_distinct_count(column_view const& input,
+                                      int precision             = 12,
+                                      null_policy null_handling = null_policy::EXCLUDE);
+
 /** @} */
 }  // namespace cudf
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cudf/column/column.hpp>
+#include <cudf/strings/regex_program.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
 namespace cudf {
@@ -50,6 +51,19 @@ std::unique_ptr<column> contains_re(
   std::string const& pattern,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Same as `contains_re` with a compiled regex program, which is not compiled again.
+ *
+ * @param strings Strings instance for this operation.
+ * @param program Compiled regex program.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New column of boolean results for each string.
+ */
+std::unique_ptr<column> contains_re(
+  strings_column_view const& strings,
+  regex_program const& program,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Returns a boolean column identifying rows which
  * matching the given regex pattern but only at the beginning the string.
@@ -75,6 +89,19 @@ std::unique_ptr<column> matches_re(
   std::string const& pattern,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Same as `matches_re` with a compiled regex program, which is not compiled again.
+ *
+ * @param strings Strings instance for this operation.
+ * @param program Compiled regex program.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New column of boolean results for each string.
+ */
+std::unique_ptr<column> matches_re(
+  strings_column_view const& strings,
+  regex_program const& program,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Returns the number of times the given regex pattern
  * matches in each string.
@@ -100,6 +127,19 @@ std::unique_ptr<column> count_re(
   std::string const& pattern,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Same as `count_re` with a compiled regex program, which is not compiled again.
+ *
+ * @param strings Strings instance for this operation.
+ * @param program Compiled regex program.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New INT32 column with counts for each string.
+ */
+std::unique_ptr<column> count_re(
+  strings_column_view const& strings,
+  regex_program const& program,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
+
+namespace cudf {
+namespace strings {
+/**
+ * @addtogroup strings_convert
+ * @{
+ */
+
+/**
+ * @brief Converts IPv6 addresses into 128-bit integers, as two 64-bit halves.
+ *
+ * The IPv6 format is 8 groups of 1-4 hex digits between colons
+ * (e.g. 2001:db8:0:0:0:ff00:42:8329). A single `::` replaces one or more groups of zeros
+ * (e.g. 2001:db8::ff00:42:8329), and the last 2 groups can be written in the IPv4 format
+ * (e.g. ::ffff:192.168.0.1).
+ * ```
+ *   g0:g1:g2:g3:g4:g5:g6:g7 -> high = (g0 << 48) | (g1 << 32) | (g2 << 16) | g3
+ *                              low  = (g4 << 48) | (g5 << 32) | (g6 << 16) | g7
+ * ```
+ * No checking is done on the format. If a string is not in IPv6 format, the resulting
+ * integers are undefined.
+ * Any null entries will result in corresponding null entries in the output columns.
+ *
+ * @param strings Strings instance for this operation.
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @return New table of two UINT64 columns: the high and the low 64 bits of each address.
+ */
+std::unique_ptr<table> ipv6_to_integers(
+  strings_column_view const& strings,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/** @} */  // end of doxygen group
+}  // namespace strings
+}  // namespace cudf
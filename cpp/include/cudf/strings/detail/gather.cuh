@@ -18,11 +18,14 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/copy.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/valid_if.cuh>
 #include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
+#include <thrust/binary_search.h>
+
 namespace cudf {
 
 template <typename Iterator>
@@ -33,12 +36,69 @@ constexpr inline bool is_signed_iterator()
 
 namespace strings {
 namespace detail {
+// Average output string size in bytes from which the chars are copied in parallel over the
+// characters rather than over the strings
+constexpr size_type char_parallel_gather_threshold = 32;
+// Number of consecutive output chars copied by each thread of `gather_chars_kernel`
+constexpr size_type gather_chars_per_thread = 8;
+
+/**
+ * @brief Copies the chars of the gathered strings, parallel over the output chars
+ *
+ * Each thread copies `gather_chars_per_thread` consecutive output chars and finds the output
+ * string of the first one with a binary search of the output offsets. Long strings are thereby
+ * copied by many threads, where copying one string per thread leaves the other threads idle.
+ *
+ * The output strings that are null or out of bounds are empty and so never searched for.
+ *
+ * @param d_strings Strings column to gather from
+ * @param map Iterator of the indices of the gathered strings
+ * @param d_offsets Offsets of the output strings
+ * @param output_count Number of output strings
+ * @param d_chars Output chars
+ * @param chars_count Number of output chars
+ */
+template <typename MapIterator>
+__global__ void gather_chars_kernel(column_device_view const d_strings,
+                                    MapIterator map,
+                                    int32_t const* d_offsets,
+                                    size_type output_count,
+                                    char* d_chars,
+                                    size_type chars_count)
+{
+  auto const stride = static_cast<int64_t>(blockDim.x) * gridDim.x * gather_chars_per_thread;
+  for (auto begin_pos =
+         static_cast<int64_t>(threadIdx.x + blockIdx.x * blockDim.x) * gather_chars_per_thread;
+       begin_pos < chars_count;
+       begin_pos += stride) {
+    auto const end_pos =
+      begin_pos + gather_chars_per_thread < chars_count ? begin_pos + gather_chars_per_thread
+                                                        : int64_t{chars_count};
+    auto const next_offset =
+      thrust::upper_bound(thrust::seq, d_offsets, d_offsets + output_count + 1, begin_pos);
+    size_type row = thrust::distance(d_offsets, next_offset) - 1;
+    auto d_str    = d_strings.element<string_view>(map[row]).data();
+    for (auto pos = begin_pos; pos < end_pos; ++pos) {
+      // A thread copies the end of a string and the start of the following non-empty ones
+      if (pos >= d_offsets[row + 1]) {
+        while (pos >= d_offsets[row + 1]) { ++row; }
+        d_str = d_strings.element<string_view>(map[row]).data();
+      }
+      d_chars[pos] = d_str[pos - d_offsets[row]];
+    }
+  }
+}
+
 /**
  * @brief Returns a new strings column using the specified indices to select
  * elements from the `strings` column.
  *
  * Caller must update the validity mask in the output column.
  *
+ * The chars are copied one string per thread when the strings are short on average, and
+ * otherwise parallel over the chars with `gather_chars_kernel`, which keeps all the threads busy
+ * with skewed string sizes.
+ *
  * ```
  * s1 = ["a", "b", "c", "d", "e", "f"]
  * map = [0, 2]
@@ -90,20 +150,30 @@ std::unique_ptr<cudf::column> gather(
   auto chars_view   = chars_column->mutable_view();
   auto d_chars      = chars_view.template data<char>();
   // fill in chars
-  auto gather_chars =
-    [d_strings, begin, strings_count, d_offsets, d_chars] __device__(size_type idx) {
-      auto index = begin[idx];
-      if (NullifyOutOfBounds) {
-        if (is_signed_iterator<MapIterator>() ? ((index < 0) || (index >= strings_count))
-                                              : (index >= strings_count))
-          return;
-      }
-      if (d_strings.is_null(index)) return;
-      string_view d_str = d_strings.element<string_view>(index);
-      memcpy(d_chars + d_offsets[idx], d_str.data(), d_str.size_bytes());
-    };
-  thrust::for_each_n(
-    execpol->on(stream), thrust::make_counting_iterator<size_type>(0), output_count, gather_chars);
+  if (static_cast<int64_t>(bytes) >=
+      static_cast<int64_t>(output_count) * static_cast<int64_t>(char_parallel_gather_threshold)) {
+    constexpr size_type block_size{256};
+    cudf::detail::grid_1d config(bytes, block_size, gather_chars_per_thread);
+    gather_chars_kernel<<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
+      d_strings, begin, d_offsets, output_count, d_chars, bytes);
+  } else {
+    auto gather_chars =
+      [d_strings, begin, strings_count, d_offsets, d_chars] __device__(size_type idx) {
+        auto index = begin[idx];
+        if (NullifyOutOfBounds) {
+          if (is_signed_iterator<MapIterator>() ? ((index < 0) || (index >= strings_count))
+                                                : (index >= strings_count))
+            return;
+        }
+        if (d_strings.is_null(index)) return;
+        string_view d_str = d_strings.element<string_view>(index);
+        memcpy(d_chars + d_offsets[idx], d_str.data(), d_str.size_bytes());
+      };
+    thrust::for_each_n(execpol->on(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       output_count,
+                       gather_chars);
+  }
 
   return make_strings_column(output_count,
                              std::move(offsets_column),
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/strings/strip.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+#include <thrust/pair.h>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+/**
+ * @brief A string referencing the chars of a strings column: its first char and its size in
+ * bytes. A null pointer marks a null string.
+ *
+ * A vector of these is a strings column whose chars are not copied; it is materialized with
+ * `make_strings_column`, which copies only the referenced chars. The vector can be gathered or
+ * filtered before, so that only the strings kept are copied. The strings column referenced must
+ * outlive the vector.
+ */
+using string_index_pair = thrust::pair<const char*, size_type>;
+
+/**
+ * @brief Returns the strings of `strings` stripped as `cudf::strings::strip` does, without
+ * copying their chars.
+ *
+ * @throw cudf::logic_error if `to_strip` is invalid.
+ *
+ * @param strings Strings column to strip.
+ * @param stype Indicates characters are to be stripped from the beginning, end, or both.
+ * @param to_strip UTF-8 encoded characters to strip; whitespace when empty.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The stripped strings, referencing the chars of `strings`.
+ */
+rmm::device_vector<string_index_pair> strip_index_pairs(
+  strings_column_view const& strings,
+  strip_type stype              = strip_type::BOTH,
+  string_scalar const& to_strip = string_scalar(""),
+  cudaStream_t stream           = 0);
+
+/**
+ * @brief Returns the substrings of `strings` in the character positions [start, stop), as
+ * `cudf::strings::slice_strings` with a step of 1 does, without copying their chars.
+ *
+ * Negative positions count from the end of each string. An invalid `start` is the beginning of
+ * the strings and an invalid `stop` their end.
+ *
+ * @param strings Strings column to slice.
+ * @param start First character position of the substrings.
+ * @param stop Character position past the end of the substrings.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The substrings, referencing the chars of `strings`.
+ */
+rmm::device_vector<string_index_pair> slice_strings_index_pairs(
+  strings_column_view const& strings,
+  numeric_scalar<size_type> const& start = numeric_scalar<size_type>(0, false),
+  numeric_scalar<size_type> const& stop  = numeric_scalar<size_type>(0, false),
+  cudaStream_t stream                    = 0);
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
@@ -22,14 +22,36 @@
 #include <rmm/thrust_rmm_allocator.h>
 #include <thrust/scan.h>
 
+#include <cstdint>
+#include <limits>
+
 namespace cudf {
 namespace strings {
 namespace detail {
+/**
+ * @brief Adds two offsets, saturating at the maximum `size_type` value instead
+ * of overflowing.
+ *
+ * This is associative for non-negative sizes, so it can be used in a scan.
+ */
+struct saturating_offsets_sum {
+  __device__ size_type operator()(size_type lhs, size_type rhs) const
+  {
+    auto const sum = static_cast<int64_t>(lhs) + static_cast<int64_t>(rhs);
+    return sum < std::numeric_limits<size_type>::max() ? static_cast<size_type>(sum)
+                                                       : std::numeric_limits<size_type>::max();
+  }
+};
+
 /**
  * @brief Create an offsets column to be a child of a strings column.
  * This will set the offsets values by executing scan on the provided
  * Iterator.
  *
+ * Offsets past the `size_type` range saturate at its maximum value, which
+ * `create_chars_child_column` rejects, so a strings column too large for
+ * 32-bit offsets fails instead of wrapping around.
+ *
  * @tparam Iterator Used as input to scan to set the offset values.
  * @param begin The beginning of the input sequence
  * @param end The end of the input sequence
@@ -55,7 +77,8 @@ std::unique_ptr<column> make_offsets_child_column(
   // Rather than manually computing the final offset using values in device memory,
   // we use inclusive-scan on a shifted output (d_offsets+1) and then set the first
   // offset values to zero manually.
-  thrust::inclusive_scan(rmm::exec_policy(stream)->on(stream), begin, end, d_offsets + 1);
+  thrust::inclusive_scan(
+    rmm::exec_policy(stream)->on(stream), begin, end, d_offsets + 1, saturating_offsets_sum{});
   CUDA_TRY(cudaMemsetAsync(d_offsets, 0, sizeof(int32_t), stream));
   return offsets_column;
 }
@@ -20,6 +20,8 @@
 #include <cudf/column/column.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
+#include <thrust/pair.h>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -27,6 +29,8 @@ namespace detail {
  * @brief Create a chars column to be a child of a strings column.
  * This will return the properly sized column to be filled in by the caller.
  *
+ * @throw cudf::logic_error if `bytes` is negative or not less than the maximum `size_type`.
+ *
  * @param strings_count Number of strings in the column.
  * @param null_count Number of null string entries in the column.
  * @param bytes Number of bytes for the chars column.
@@ -91,6 +95,31 @@ std::unique_ptr<cudf::column> child_chars_from_string_vector(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @brief Creates a strings column from pointer/size pairs and a null mask of the rows.
+ *
+ * Unlike `cudf::make_strings_column` of pairs, the null rows are given by `null_mask` rather
+ * than by null pointers, which saves a pass over the pairs and a null mask allocation for readers
+ * that decode the validity of the rows separately. The pairs of the null rows must have a size
+ * of 0.
+ *
+ * @throw cudf::logic_error if the total size of the strings is not less than the maximum
+ * `size_type`.
+ *
+ * @param strings Pointer/size pair of each row.
+ * @param null_mask Null mask of the rows; empty if no row is null.
+ * @param null_count Number of null rows, or `UNKNOWN_NULL_COUNT`.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return Strings column of the pairs
+ */
+std::unique_ptr<column> make_strings_column(
+  const rmm::device_vector<thrust::pair<const char*, size_type>>& strings,
+  rmm::device_buffer&& null_mask,
+  size_type null_count,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <cudf/strings/regex_program.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
 
@@ -54,6 +55,19 @@ std::unique_ptr<table> extract(
   std::string const& pattern,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Same as `extract` with a compiled regex program, which is not compiled again.
+ *
+ * @param strings Strings instance for this operation.
+ * @param program Compiled regex program.
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @return Columns of strings extracted from the input column.
+ */
+std::unique_ptr<table> extract(
+  strings_column_view const& strings,
+  regex_program const& program,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
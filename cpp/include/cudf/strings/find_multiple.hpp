@@ -53,6 +53,116 @@ std::unique_ptr<column> find_multiple(
   strings_column_view const& targets,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Searches strings for any of a set of literal patterns at once.
+ *
+ * The patterns are compiled once into an Aho-Corasick automaton kept in device memory, which
+ * can then search any number of strings columns. Each string is scanned a single time whatever
+ * the number of patterns, unlike `find_multiple` which searches every pattern separately.
+ *
+ * The patterns are matched byte for byte, so they must be valid UTF-8 to match whole characters.
+ */
+class multi_pattern_matcher {
+ public:
+  multi_pattern_matcher() = delete;
+  ~multi_pattern_matcher();
+  multi_pattern_matcher(multi_pattern_matcher const&) = delete;
+  multi_pattern_matcher(multi_pattern_matcher&&)      = delete;
+  multi_pattern_matcher& operator=(multi_pattern_matcher const&) = delete;
+  multi_pattern_matcher& operator=(multi_pattern_matcher&&) = delete;
+
+  /**
+   * @brief Builds the automaton of the patterns.
+   *
+   * @throw cudf::logic_error if `patterns` is empty or contains nulls
+   *
+   * @param patterns Literal strings to search for. Pattern ids are the row indices.
+   */
+  multi_pattern_matcher(strings_column_view const& patterns);
+
+  /**
+   * @brief Returns a boolean column identifying the strings that contain any of the patterns.
+   *
+   * Null strings produce null entries.
+   *
+   * @code{.pseudo}
+   * Example:
+   * p = ["ab","cd"]
+   * s = ["xabx","cxd",null]
+   * r = multi_pattern_matcher(p).contains_any(s)
+   * r is now [true,false,null]
+   * @endcode
+   *
+   * @param strings Strings instance for this operation.
+   * @param mr Device memory resource used to allocate the returned column's device memory.
+   * @return New BOOL8 column.
+   */
+  std::unique_ptr<column> contains_any(
+    strings_column_view const& strings,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) const;
+
+  /**
+   * @brief Returns the id of the first pattern found in each string, or -1 if none is found.
+   *
+   * The first pattern found is the one whose occurrence ends first in the string. If several
+   * patterns end at the same position, the lowest id is returned. Null strings produce null
+   * entries.
+   *
+   * @code{.pseudo}
+   * Example:
+   * p = ["bcd","abc","c"]
+   * s = ["abcd","xbcdx","z"]
+   * r = multi_pattern_matcher(p).find_any(s)
+   * r is now [1,2,-1]
+   * @endcode
+   *
+   * @param strings Strings instance for this operation.
+   * @param mr Device memory resource used to allocate the returned column's device memory.
+   * @return New INT32 column of pattern ids.
+   */
+  std::unique_ptr<column> find_any(
+    strings_column_view const& strings,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) const;
+
+ private:
+  struct matcher_impl;
+  const std::unique_ptr<const matcher_impl> impl;
+};
+
+/**
+ * @brief Returns a boolean column identifying the strings that contain any of the patterns.
+ *
+ * This builds a `multi_pattern_matcher` for a single search.
+ *
+ * @throw cudf::logic_error if `patterns` is empty or contains nulls
+ *
+ * @param strings Strings instance for this operation.
+ * @param patterns Literal strings to search for.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New BOOL8 column.
+ */
+std::unique_ptr<column> contains_any(
+  strings_column_view const& strings,
+  strings_column_view const& patterns,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns the index of the first pattern found in each string, or -1 if none is found.
+ *
+ * This builds a `multi_pattern_matcher` for a single search.
+ *
+ * @throw cudf::logic_error if `patterns` is empty or contains nulls
+ *
+ * @param strings Strings instance for this operation.
+ * @param patterns Literal strings to search for.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New INT32 column of pattern indices.
+ */
+std::unique_ptr<column> find_any(
+  strings_column_view const& strings,
+  strings_column_view const& patterns,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
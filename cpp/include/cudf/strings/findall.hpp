@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <cudf/strings/regex_program.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
 
@@ -56,6 +57,19 @@ std::unique_ptr<table> findall_re(
   std::string const& pattern,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Same as `findall_re` with a compiled regex program, which is not compiled again.
+ *
+ * @param strings Strings instance for this operation.
+ * @param program Compiled regex program.
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @return New table of strings columns.
+ */
+std::unique_ptr<table> findall_re(
+  strings_column_view const& strings,
+  regex_program const& program,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
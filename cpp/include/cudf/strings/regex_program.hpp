@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <memory>
+#include <string>
+
+namespace cudf {
+namespace strings {
+/**
+ * @addtogroup strings_contains
+ * @{
+ */
+
+/**
+ * @brief Regex pattern compiled once and evaluated by any number of regex APIs calls.
+ *
+ * The regex APIs taking a pattern string look up their compiled program in a process-wide cache
+ * of the most recently used patterns, so repeated calls with the same pattern are not compiled
+ * again. Holding a `regex_program` keeps its compiled program alive whatever the cache evicts.
+ *
+ * The number of programs kept in the cache is read from the `LIBCUDF_REGEX_CACHE_SIZE`
+ * environment variable, and is 128 if it is not set. A size of 0 disables the cache.
+ *
+ * See the @ref md_regex "Regex Features" page for details on patterns supported.
+ */
+class regex_program {
+ public:
+  struct regex_program_impl;
+
+  regex_program() = delete;
+  ~regex_program();
+  regex_program(regex_program const&) = delete;
+  regex_program(regex_program&&)      = delete;
+  regex_program& operator=(regex_program const&) = delete;
+  regex_program& operator=(regex_program&&) = delete;
+
+  /**
+   * @brief Compiles a regex pattern, or returns its cached compiled program.
+   *
+   * @throw cudf::logic_error if the pattern is invalid
+   *
+   * @param pattern Regex pattern to compile.
+   * @return The compiled program.
+   */
+  static std::unique_ptr<regex_program> create(std::string const& pattern);
+
+  /**
+   * @brief Returns the pattern of this program.
+   */
+  std::string const& pattern() const;
+
+  /**
+   * @brief Returns the number of capturing groups of the pattern.
+   */
+  size_type groups_count() const;
+
+  /**
+   * @brief Returns the compiled program, for use by the regex APIs.
+   */
+  regex_program_impl const* get_impl() const;
+
+ private:
+  std::string _pattern;
+  std::shared_ptr<regex_program_impl const> _impl;
+
+  regex_program(std::string const& pattern, std::shared_ptr<regex_program_impl const> impl);
+};
+
+/** @} */  // end of doxygen group
+}  // namespace strings
+}  // namespace cudf
@@ -112,7 +112,8 @@ std::unique_ptr<column> replace_slice(
  *
  * For each string in strings, the list of targets is searched within that string.
  * If a target string is found, it is replaced by the corresponding entry in the repls column.
- * All occurrences found in each string are replaced.
+ * All occurrences found in each string are replaced. Where several targets are found at
+ * the same position, the first one in targets is replaced. Empty targets are ignored.
  *
  * This does not use regex to match targets in the string.
  *
@@ -17,6 +17,7 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/regex_program.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
 namespace cudf {
@@ -49,6 +50,24 @@ std::unique_ptr<column> replace_re(
   size_type maxrepl                   = -1,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Same as `replace_re` with a compiled regex program, which is not compiled again.
+ *
+ * @param strings Strings instance for this operation.
+ * @param program Compiled regex program.
+ * @param repl The string used to replace the matched sequence in each string.
+ *        Default is an empty string.
+ * @param maxrepl The maximum number of times to replace the matched pattern within each string.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New strings column.
+ */
+std::unique_ptr<column> replace_re(
+  strings_column_view const& strings,
+  regex_program const& program,
+  string_scalar const& repl           = string_scalar(""),
+  size_type maxrepl                   = -1,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief For each string, replaces any character sequence matching the given patterns
  * with the corresponding string in the repls column.
@@ -89,5 +108,21 @@ std::unique_ptr<column> replace_with_backrefs(
   std::string const& repl,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Same as `replace_with_backrefs` with a compiled regex program, which is not compiled
+ * again.
+ *
+ * @param strings Strings instance for this operation.
+ * @param program Compiled regex program.
+ * @param repl The replacement template for creating the output string.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New strings column.
+ */
+std::unique_ptr<column> replace_with_backrefs(
+  strings_column_view const& strings,
+  regex_program const& program,
+  std::string const& repl,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 }  // namespace strings
 }  // namespace cudf
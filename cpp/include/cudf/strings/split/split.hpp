@@ -163,6 +163,98 @@ contiguous_split_record_result contiguous_rsplit_record(
   size_type maxsplit                  = -1,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Splits each string of the column into a list of its tokens.
+ *
+ * Strings are split as `split` splits them, but the tokens of each string are returned as a
+ * row of a `LIST<STRING>` column, so rows with fewer tokens take no space for the tokens of
+ * the longest row.
+ *
+ * Splitting a null string element results in a null list. A string with no tokens, e.g. an
+ * empty string split on whitespace, results in an empty list.
+ *
+ * @code{.pseudo}
+ * s = ["a_b_c", "d_e", null, "f"]
+ * r = split_record(s, "_")
+ * r is now [["a", "b", "c"], ["d", "e"], null, ["f"]]
+ * r = split_record(s, "_", 1)
+ * r is now [["a", "b_c"], ["d", "e"], null, ["f"]]
+ * @endcode
+ *
+ * @throws cudf:logic_error if `delimiter` is invalid.
+ *
+ * @param strings A column of string elements to be split.
+ * @param delimiter UTF-8 encoded string indicating the split points in each string.
+ *        Default of empty string indicates split on whitespace.
+ * @param maxsplit Maximum number of splits to perform.
+ *        Default of -1 indicates all possible splits on each string.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New `LIST<STRING>` column of the tokens of each string.
+ */
+std::unique_ptr<column> split_record(
+  strings_column_view const& strings,
+  string_scalar const& delimiter      = string_scalar(""),
+  size_type maxsplit                  = -1,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Splits each string of the column into a list of its tokens, starting from the end
+ * of each string.
+ *
+ * The tokens of each string are in string order; `maxsplit` only limits the splits made from
+ * the end, as `rsplit` does.
+ *
+ * @code{.pseudo}
+ * s = ["a_b_c", "d_e", null, "f"]
+ * r = rsplit_record(s, "_", 1)
+ * r is now [["a_b", "c"], ["d", "e"], null, ["f"]]
+ * @endcode
+ *
+ * @throws cudf:logic_error if `delimiter` is invalid.
+ *
+ * @param strings A column of string elements to be split.
+ * @param delimiter UTF-8 encoded string indicating the split points in each string.
+ *        Default of empty string indicates split on whitespace.
+ * @param maxsplit Maximum number of splits to perform.
+ *        Default of -1 indicates all possible splits on each string.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New `LIST<STRING>` column of the tokens of each string.
+ */
+std::unique_ptr<column> rsplit_record(
+  strings_column_view const& strings,
+  string_scalar const& delimiter      = string_scalar(""),
+  size_type maxsplit                  = -1,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns the token at `index` of each string split as `split` splits it.
+ *
+ * This is the column `index` of the table `split` returns, without building the other
+ * columns: each string is only split up to that token.
+ *
+ * The output row is null where the string is null or has no more than `index` tokens.
+ *
+ * @code{.pseudo}
+ * s = ["key=value", "other=", "none", null]
+ * r = split_part(s, 1, "=")
+ * r is now ["value", "", null, null]
+ * @endcode
+ *
+ * @throws cudf:logic_error if `delimiter` is invalid or `index` is negative.
+ *
+ * @param strings A column of string elements to be split.
+ * @param index Position of the token to return, from 0.
+ * @param delimiter UTF-8 encoded string indicating the split points in each string.
+ *        Default of empty string indicates split on whitespace.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New strings column of the tokens.
+ */
+std::unique_ptr<column> split_part(
+  strings_column_view const& strings,
+  size_type index,
+  string_scalar const& delimiter      = string_scalar(""),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
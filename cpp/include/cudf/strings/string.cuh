@@ -39,12 +39,13 @@ namespace string {
 __device__ bool is_integer(string_view const& d_str)
 {
   if (d_str.empty()) return false;
-  auto begin = d_str.begin();
-  auto end   = d_str.end();
+  // the bytes of multi-byte UTF-8 characters are never digits, so no decoding is needed
+  auto begin = d_str.data();
+  auto end   = begin + d_str.size_bytes();
   if (*begin == '+' || *begin == '-') ++begin;
-  return (thrust::distance(begin, end) > 0) &&
+  return (begin < end) &&
          thrust::all_of(
-           thrust::seq, begin, end, [] __device__(auto chr) { return chr >= '0' && chr <= '9'; });
+           thrust::seq, begin, end, [] __device__(char chr) { return chr >= '0' && chr <= '9'; });
 }
 
 /**
@@ -35,6 +35,10 @@ namespace cudf {
 /**
  * @brief Given a column-view of strings type, an instance of this class
  * provides a wrapper on this compound column for strings operations.
+ *
+ * The offsets of a strings column are `size_type` values, so a column holds
+ * less than 2GB of characters. Operations whose output would hold more throw
+ * a `cudf::logic_error` rather than producing wrapped-around offsets.
  */
 class strings_column_view : private column_view {
  public:
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/aggregation.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+
+/**
+ * @addtogroup table_classes
+ * @{
+ */
+
+/**
+ * @brief A partition of a `distributed_table`: a table owned by a device, with the memory
+ * resource its device memory was allocated from.
+ */
+struct device_partition {
+  int device;                           ///< Device holding the table
+  std::unique_ptr<table> data;          ///< Rows of the partition
+  rmm::mr::device_memory_resource* mr;  ///< Memory resource of `device`
+};
+
+/**
+ * @brief A logical table whose rows are split in partitions held by different devices.
+ *
+ * The rows of the table are the rows of the partitions, in order. All the partitions have the
+ * same column types.
+ *
+ * The constructor enables the peer access between each pair of devices of the partitions that
+ * supports it, e.g. devices connected by NVLink. The operations below read the partitions of the
+ * peer devices directly from their kernels when peer access is supported, and copy the
+ * partitions with `cudaMemcpyPeerAsync`, which the driver stages through the host, otherwise.
+ *
+ * The partitions are synchronized with the default stream of their device before they are read
+ * from another device.
+ */
+class distributed_table {
+ public:
+  distributed_table()                         = default;
+  distributed_table(distributed_table&&)      = default;
+  distributed_table(distributed_table const&) = delete;
+  distributed_table& operator=(distributed_table const&) = delete;
+  distributed_table& operator=(distributed_table&&) = default;
+
+  /**
+   * @brief Constructs the table from its partitions.
+   *
+   * @throws cudf::logic_error if the partitions have different column types, or if a partition
+   * has no table or no memory resource.
+   *
+   * @param partitions Partitions of the table, in row order
+   */
+  explicit distributed_table(std::vector<device_partition>&& partitions);
+
+  /**
+   * @brief Returns the number of partitions
+   */
+  size_type num_partitions() const noexcept { return _partitions.size(); }
+
+  /**
+   * @brief Returns the number of rows of all the partitions
+   */
+  size_type num_rows() const noexcept;
+
+  /**
+   * @brief Returns the partition `i`
+   */
+  device_partition const& partition(size_type i) const { return _partitions.at(i); }
+
+ private:
+  std::vector<device_partition> _partitions{};
+};
+
+/**
+ * @brief Enables the peer access between each pair of `devices` that supports it.
+ *
+ * Peer access that is already enabled is left enabled.
+ *
+ * @param devices Devices to connect
+ */
+void enable_peer_access(std::vector<int> const& devices);
+
+/**
+ * @brief Concatenates the partitions of `input` on `device`.
+ *
+ * @throws cudf::logic_error if `input` has no partition.
+ *
+ * @param input Table to concatenate
+ * @param device Device of the result
+ * @param mr Memory resource of `device` used to allocate the result
+ * @return The rows of `input`, in order
+ */
+std::unique_ptr<table> concatenate(
+  distributed_table const& input,
+  int device,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Gathers rows of `input` on `device`, as `cudf::gather` does with the concatenation of
+ * the partitions.
+ *
+ * Only the columns `column_indices` of the partitions are read.
+ *
+ * @throws cudf::logic_error if `input` has no partition.
+ *
+ * @param input Table to gather from
+ * @param column_indices Columns of `input` to gather
+ * @param gather_map Indices of the rows of `input` to gather, on `device`
+ * @param device Device of the result
+ * @param mr Memory resource of `device` used to allocate the result
+ * @return The gathered rows
+ */
+std::unique_ptr<table> gather(
+  distributed_table const& input,
+  std::vector<size_type> const& column_indices,
+  column_view const& gather_map,
+  int device,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Reduces a column of `input`, as `cudf::reduce` does with the concatenation of its
+ * partitions.
+ *
+ * Each partition is reduced on its device, and the partial results are reduced on `device`.
+ *
+ * @throws cudf::logic_error if `agg` is not a sum, product, min, max, any or all.
+ * @throws cudf::logic_error for the same reasons as `cudf::reduce`.
+ *
+ * @param input Table to reduce
+ * @param column_index Column of `input` to reduce
+ * @param agg Aggregation applied by the reduction
+ * @param output_dtype Type of the result
+ * @param device Device of the result
+ * @param mr Memory resource of `device` used to allocate the result
+ * @return The reduction of the column; invalid if the column has no valid element
+ */
+std::unique_ptr<scalar> reduce(
+  distributed_table const& input,
+  size_type column_index,
+  std::unique_ptr<aggregation> const& agg,
+  data_type output_dtype,
+  int device,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Copies a table of `source_device` to each device of the partitions of `layout`, e.g.
+ * the small side of a join with each partition.
+ *
+ * @param input Table to copy
+ * @param source_device Device of `input`
+ * @param layout Table whose partitions determine the devices and memory resources of the copies
+ * @return A copy of `input` for each partition of `layout`
+ */
+distributed_table broadcast(table_view const& input,
+                            int source_device,
+                            distributed_table const& layout);
+
+/**
+ * @brief Joins each partition of `probe` with a small `build` table replicated to its device.
+ *
+ * The build table is packed once into a contiguous buffer, as `cudf::pack` does, which is copied
+ * to each device of the partitions in a single peer copy. A `hash_join` is built per device and
+ * probed with the partitions of the device, so the probe side is never moved.
+ *
+ * Each partition of the result holds the matching rows of the probe partition of its index: the
+ * columns of the probe partition followed by the columns of `build`. The order of the rows within
+ * a partition is unspecified.
+ *
+ * @throws cudf::logic_error for the same reasons as `hash_join::inner_join`.
+ *
+ * @param probe Large table, whose partitions are joined in place
+ * @param probe_on Columns of `probe` to join on
+ * @param build Small table to replicate
+ * @param build_device Device of `build`
+ * @param build_on Columns of `build` to join on
+ * @param compare_nulls Controls whether null join-key values should match or not
+ * @return The joined rows, partitioned as `probe`
+ */
+distributed_table broadcast_inner_join(distributed_table const& probe,
+                                       std::vector<size_type> const& probe_on,
+                                       table_view const& build,
+                                       int build_device,
+                                       std::vector<size_type> const& build_on,
+                                       null_equality compare_nulls = null_equality::EQUAL);
+
+/**
+ * @brief Left joins each partition of `probe` with a small `build` table replicated to its
+ * device.
+ *
+ * Same as `broadcast_inner_join`, except that each row of `probe` appears at least once in the
+ * result, with null build columns when it has no match. There is no broadcast full join, since
+ * each partition only sees the build rows that match its own rows.
+ *
+ * @throws cudf::logic_error for the same reasons as `hash_join::left_join`.
+ *
+ * @param probe Large table, whose partitions are joined in place
+ * @param probe_on Columns of `probe` to join on
+ * @param build Small table to replicate
+ * @param build_device Device of `build`
+ * @param build_on Columns of `build` to join on
+ * @param compare_nulls Controls whether null join-key values should match or not
+ * @return The joined rows, partitioned as `probe`
+ */
+distributed_table broadcast_left_join(distributed_table const& probe,
+                                      std::vector<size_type> const& probe_on,
+                                      table_view const& build,
+                                      int build_device,
+                                      std::vector<size_type> const& build_on,
+                                      null_equality compare_nulls = null_equality::EQUAL);
+
+/** @} */  // end of group
+}  // namespace cudf
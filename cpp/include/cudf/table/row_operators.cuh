@@ -28,6 +28,9 @@
 #include <thrust/swap.h>
 #include <thrust/transform_reduce.h>
 
+#include <algorithm>
+#include <type_traits>
+
 namespace cudf {
 
 /**
@@ -383,6 +386,306 @@ class row_lexicographic_comparator {
   order const* _column_order{};
 };  // class row_lexicographic_comparator
 
+/**
+ * @brief Returns whether the rows of tables whose columns all have type `T` are compared by the
+ * typed row comparators
+ *
+ * Each type with typed comparators adds instantiations of every algorithm using the comparators,
+ * so they are limited to the types of the keys most often sorted and joined on.
+ */
+template <typename T>
+constexpr bool has_typed_row_comparators()
+{
+  return std::is_same<T, int32_t>::value or std::is_same<T, int64_t>::value or
+         std::is_same<T, double>::value or std::is_same<T, string_view>::value;
+}
+
+/**
+ * @brief Computes whether two rows are equal, all the columns of both tables having type
+ * `Element`
+ *
+ * Equivalent to `row_equality_comparator<has_nulls>`, but the elements are compared directly
+ * instead of through a `type_dispatcher` switch on the type of each column of every row.
+ *
+ * @tparam Element The type of all the columns
+ * @tparam has_nulls Indicates the potential for null values in either table.
+ **/
+template <typename Element, bool has_nulls = true>
+class typed_row_equality_comparator {
+ public:
+  typed_row_equality_comparator(table_device_view lhs,
+                                table_device_view rhs,
+                                bool nulls_are_equal = true)
+    : lhs{lhs}, rhs{rhs}, nulls_are_equal{nulls_are_equal}
+  {
+    CUDF_EXPECTS(lhs.num_columns() == rhs.num_columns(), "Mismatched number of columns.");
+  }
+
+  __device__ bool operator()(size_type lhs_row_index, size_type rhs_row_index) const noexcept
+  {
+    for (size_type i = 0; i < lhs.num_columns(); ++i) {
+      auto const equal_elements =
+        element_equality_comparator<has_nulls>{lhs.column(i), rhs.column(i), nulls_are_equal};
+      if (not equal_elements.template operator()<Element>(lhs_row_index, rhs_row_index)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+ private:
+  table_device_view lhs;
+  table_device_view rhs;
+  bool nulls_are_equal;
+};
+
+/**
+ * @brief Computes whether one row is lexicographically *less* than another row, all the columns
+ * of both tables having type `Element`
+ *
+ * Equivalent to `row_lexicographic_comparator<has_nulls>`, but the elements are compared directly
+ * instead of through a `type_dispatcher` switch on the type of each column of every row.
+ *
+ * @tparam Element The type of all the columns
+ * @tparam has_nulls Indicates the potential for null values in either row.
+ **/
+template <typename Element, bool has_nulls = true>
+class typed_row_lexicographic_comparator {
+ public:
+  /**
+   * @copydoc row_lexicographic_comparator::row_lexicographic_comparator
+   */
+  typed_row_lexicographic_comparator(table_device_view lhs,
+                                     table_device_view rhs,
+                                     order const* column_order         = nullptr,
+                                     null_order const* null_precedence = nullptr)
+    : _lhs{lhs}, _rhs{rhs}, _column_order{column_order}, _null_precedence{null_precedence}
+  {
+    CUDF_EXPECTS(_lhs.num_columns() == _rhs.num_columns(), "Mismatched number of columns.");
+  }
+
+  /**
+   * @copydoc row_lexicographic_comparator::operator()
+   */
+  __device__ bool operator()(size_type lhs_index, size_type rhs_index) const noexcept
+  {
+    for (size_type i = 0; i < _lhs.num_columns(); ++i) {
+      null_order const null_precedence =
+        _null_precedence == nullptr ? null_order::BEFORE : _null_precedence[i];
+      auto const comparator =
+        element_relational_comparator<has_nulls>{_lhs.column(i), _rhs.column(i), null_precedence};
+      auto const state = comparator.template operator()<Element>(lhs_index, rhs_index);
+
+      if (state == weak_ordering::EQUIVALENT) { continue; }
+
+      bool const ascending = (_column_order == nullptr) or (_column_order[i] == order::ASCENDING);
+      return state == (ascending ? weak_ordering::LESS : weak_ordering::GREATER);
+    }
+    return false;
+  }
+
+ private:
+  table_device_view _lhs;
+  table_device_view _rhs;
+  order const* _column_order{};
+  null_order const* _null_precedence{};
+};
+
+namespace detail {
+/**
+ * @brief Returns the type of all the columns of two tables, or an `EMPTY` type if they do not all
+ * have the same type
+ */
+inline data_type common_column_type(table_view const& lhs, table_view const& rhs)
+{
+  auto const type = lhs.num_columns() > 0 ? lhs.column(0).type() : data_type{type_id::EMPTY};
+  auto const same_type = [type](column_view const& col) { return col.type() == type; };
+  if (std::all_of(lhs.begin(), lhs.end(), same_type) and
+      std::all_of(rhs.begin(), rhs.end(), same_type)) {
+    return type;
+  }
+  return data_type{type_id::EMPTY};
+}
+
+template <bool has_nulls>
+struct row_equality_dispatch_fn {
+  template <typename T, typename Function>
+  auto operator()(table_device_view lhs,
+                  table_device_view rhs,
+                  bool nulls_are_equal,
+                  Function& f) const
+  {
+    return call<T>(lhs, rhs, nulls_are_equal, f, std::integral_constant<bool, typed<T>()>{});
+  }
+
+ private:
+  template <typename T>
+  static constexpr bool typed()
+  {
+    return has_typed_row_comparators<T>() and is_equality_comparable<T, T>();
+  }
+
+  template <typename T, typename Function>
+  auto call(table_device_view lhs,
+            table_device_view rhs,
+            bool nulls_are_equal,
+            Function& f,
+            std::true_type) const
+  {
+    return f(typed_row_equality_comparator<T, has_nulls>{lhs, rhs, nulls_are_equal});
+  }
+
+  template <typename T, typename Function>
+  auto call(table_device_view lhs,
+            table_device_view rhs,
+            bool nulls_are_equal,
+            Function& f,
+            std::false_type) const
+  {
+    return f(row_equality_comparator<has_nulls>{lhs, rhs, nulls_are_equal});
+  }
+};
+
+template <bool has_nulls>
+struct row_lexicographic_dispatch_fn {
+  template <typename T, typename Function>
+  auto operator()(table_device_view lhs,
+                  table_device_view rhs,
+                  order const* column_order,
+                  null_order const* null_precedence,
+                  Function& f) const
+  {
+    return call<T>(lhs,
+                   rhs,
+                   column_order,
+                   null_precedence,
+                   f,
+                   std::integral_constant<bool, typed<T>()>{});
+  }
+
+ private:
+  template <typename T>
+  static constexpr bool typed()
+  {
+    return has_typed_row_comparators<T>() and is_relationally_comparable<T, T>();
+  }
+
+  template <typename T, typename Function>
+  auto call(table_device_view lhs,
+            table_device_view rhs,
+            order const* column_order,
+            null_order const* null_precedence,
+            Function& f,
+            std::true_type) const
+  {
+    return f(typed_row_lexicographic_comparator<T, has_nulls>{
+      lhs, rhs, column_order, null_precedence});
+  }
+
+  template <typename T, typename Function>
+  auto call(table_device_view lhs,
+            table_device_view rhs,
+            order const* column_order,
+            null_order const* null_precedence,
+            Function& f,
+            std::false_type) const
+  {
+    return f(row_lexicographic_comparator<has_nulls>{lhs, rhs, column_order, null_precedence});
+  }
+};
+}  // namespace detail
+
+/**
+ * @brief Calls `f` with the row equality comparator of two tables specialized for their columns,
+ * returning its result
+ *
+ * The comparator is chosen once for all the rows compared: if neither table has nulls, it does
+ * not check for them, and if all the columns have the same type and that type
+ * `has_typed_row_comparators`, it is a `typed_row_equality_comparator`. `f` is called with a
+ * `row_equality_comparator` otherwise.
+ *
+ * @param lhs The first table
+ * @param rhs The second table
+ * @param d_lhs The device view of `lhs`
+ * @param d_rhs The device view of `rhs`
+ * @param nulls_are_equal Indicates if two null elements are treated as equivalent
+ * @param f The function to call with the comparator; it must return the same type whatever the
+ * comparator
+ */
+template <typename Function>
+auto dispatch_row_equality_comparator(table_view const& lhs,
+                                      table_view const& rhs,
+                                      table_device_view d_lhs,
+                                      table_device_view d_rhs,
+                                      bool nulls_are_equal,
+                                      Function&& f)
+{
+  auto const type = detail::common_column_type(lhs, rhs);
+  if (has_nulls(lhs) or has_nulls(rhs)) {
+    if (type.id() == type_id::EMPTY) {
+      return f(row_equality_comparator<true>{d_lhs, d_rhs, nulls_are_equal});
+    }
+    return type_dispatcher(
+      type, detail::row_equality_dispatch_fn<true>{}, d_lhs, d_rhs, nulls_are_equal, f);
+  }
+  if (type.id() == type_id::EMPTY) {
+    return f(row_equality_comparator<false>{d_lhs, d_rhs, nulls_are_equal});
+  }
+  return type_dispatcher(
+    type, detail::row_equality_dispatch_fn<false>{}, d_lhs, d_rhs, nulls_are_equal, f);
+}
+
+/**
+ * @brief Calls `f` with the lexicographic row comparator of two tables specialized for their
+ * columns, returning its result
+ *
+ * The comparator is chosen as by `dispatch_row_equality_comparator`, among
+ * `typed_row_lexicographic_comparator` and `row_lexicographic_comparator`.
+ *
+ * @param lhs The first table
+ * @param rhs The second table
+ * @param d_lhs The device view of `lhs`
+ * @param d_rhs The device view of `rhs`
+ * @param column_order Optional, device array of the order of each column, all ascending if null
+ * @param null_precedence Optional, device array of the order of the nulls of each column, all
+ * `null_order::BEFORE` if null
+ * @param f The function to call with the comparator; it must return the same type whatever the
+ * comparator
+ */
+template <typename Function>
+auto dispatch_row_lexicographic_comparator(table_view const& lhs,
+                                           table_view const& rhs,
+                                           table_device_view d_lhs,
+                                           table_device_view d_rhs,
+                                           order const* column_order,
+                                           null_order const* null_precedence,
+                                           Function&& f)
+{
+  auto const type = detail::common_column_type(lhs, rhs);
+  if (has_nulls(lhs) or has_nulls(rhs)) {
+    if (type.id() == type_id::EMPTY) {
+      return f(row_lexicographic_comparator<true>{d_lhs, d_rhs, column_order, null_precedence});
+    }
+    return type_dispatcher(type,
+                           detail::row_lexicographic_dispatch_fn<true>{},
+                           d_lhs,
+                           d_rhs,
+                           column_order,
+                           null_precedence,
+                           f);
+  }
+  if (type.id() == type_id::EMPTY) {
+    return f(row_lexicographic_comparator<false>{d_lhs, d_rhs, column_order, null_precedence});
+  }
+  return type_dispatcher(type,
+                         detail::row_lexicographic_dispatch_fn<false>{},
+                         d_lhs,
+                         d_rhs,
+                         column_order,
+                         null_precedence,
+                         f);
+}
+
 /**
  * @brief Computes the hash value of an element in the given column.
  *
@@ -392,10 +695,12 @@ class row_lexicographic_comparator {
 template <template <typename> class hash_function, bool has_nulls = true>
 class element_hasher {
  public:
+  using result_type = typename hash_function<hash_value_type>::result_type;
+
   template <typename T>
-  __device__ inline hash_value_type operator()(column_device_view col, size_type row_index)
+  __device__ inline result_type operator()(column_device_view col, size_type row_index)
   {
-    if (has_nulls && col.is_null(row_index)) { return std::numeric_limits<hash_value_type>::max(); }
+    if (has_nulls && col.is_null(row_index)) { return std::numeric_limits<result_type>::max(); }
 
     return hash_function<T>{}(col.element<T>(row_index));
   }
@@ -413,9 +718,11 @@ class row_hasher {
   row_hasher() = delete;
   row_hasher(table_device_view t) : _table{t} {}
 
+  using result_type = typename element_hasher<hash_function, has_nulls>::result_type;
+
   __device__ auto operator()(size_type row_index) const
   {
-    auto hash_combiner = [](hash_value_type lhs, hash_value_type rhs) {
+    auto hash_combiner = [](result_type lhs, result_type rhs) {
       return hash_function<hash_value_type>{}.hash_combine(lhs, rhs);
     };
 
@@ -432,7 +739,7 @@ class row_hasher {
                                     thrust::make_counting_iterator(0),
                                     thrust::make_counting_iterator(_table.num_columns()),
                                     hasher,
-                                    hash_value_type{0},
+                                    result_type{0},
                                     hash_combiner);
   }
 
@@ -456,9 +763,11 @@ class row_hasher_initial_values {
   {
   }
 
+  using result_type = typename element_hasher<hash_function, has_nulls>::result_type;
+
   __device__ auto operator()(size_type row_index) const
   {
-    auto hash_combiner = [](hash_value_type lhs, hash_value_type rhs) {
+    auto hash_combiner = [](result_type lhs, result_type rhs) {
       return hash_function<hash_value_type>{}.hash_combine(lhs, rhs);
     };
 
@@ -477,7 +786,7 @@ class row_hasher_initial_values {
                                     thrust::make_counting_iterator(0),
                                     thrust::make_counting_iterator(_table.num_columns()),
                                     hasher,
-                                    hash_value_type{0},
+                                    result_type{0},
                                     hash_combiner);
   }
 
@@ -486,4 +795,95 @@ class row_hasher_initial_values {
   hash_value_type* _initial_hash;
 };
 
+/**
+ * @brief Computes the `SparkMurmurHash3_32` hash value of an element in the given column,
+ * seeded with the hash value of the previous column.
+ *
+ * @tparam has_nulls Indicates the potential for null values in the column.
+ **/
+template <bool has_nulls = true>
+class spark_murmur_element_hasher {
+ public:
+  __device__ spark_murmur_element_hasher(hash_value_type seed) : _seed{seed} {}
+
+  template <typename T>
+  __device__ inline hash_value_type operator()(column_device_view col, size_type row_index) const
+  {
+    // a null element leaves the hash value unchanged
+    if (has_nulls && col.is_null(row_index)) { return _seed; }
+
+    return SparkMurmurHash3_32<T>{_seed}(col.element<T>(row_index));
+  }
+
+ private:
+  hash_value_type _seed;
+};
+
+/**
+ * @brief Computes the hash value of a row in the given table as Spark's `hash` function and
+ * hash partitioning do.
+ *
+ * The hash value of each column is the seed of the hash of the next column, starting from
+ * Spark's seed of 42.
+ *
+ * @tparam has_nulls Indicates the potential for null values in the table.
+ **/
+template <bool has_nulls = true>
+class spark_murmur_row_hasher {
+ public:
+  spark_murmur_row_hasher() = delete;
+  spark_murmur_row_hasher(table_device_view t) : _table{t} {}
+
+  using result_type = int32_t;
+
+  static constexpr hash_value_type seed = 42;
+
+  __device__ result_type operator()(size_type row_index) const
+  {
+    hash_value_type hash = seed;
+    for (size_type column_index = 0; column_index < _table.num_columns(); ++column_index) {
+      hash = cudf::type_dispatcher(_table.column(column_index).type(),
+                                   spark_murmur_element_hasher<has_nulls>{hash},
+                                   _table.column(column_index),
+                                   row_index);
+    }
+    return static_cast<result_type>(hash);
+  }
+
+ private:
+  table_device_view _table;
+};
+
+/**
+ * @brief Computes the hash value of a row in the given table as Hive does, combining the
+ * `HiveHash` hash values of the columns as `31 * hash + column_hash`.
+ *
+ * Null elements have a hash value of 0.
+ *
+ * @tparam has_nulls Indicates the potential for null values in the table.
+ **/
+template <bool has_nulls = true>
+class hive_row_hasher {
+ public:
+  hive_row_hasher() = delete;
+  hive_row_hasher(table_device_view t) : _table{t} {}
+
+  using result_type = int32_t;
+
+  __device__ result_type operator()(size_type row_index) const
+  {
+    hash_value_type hash = 0;
+    for (size_type column_index = 0; column_index < _table.num_columns(); ++column_index) {
+      auto const col = _table.column(column_index);
+      hash *= 31;
+      if (has_nulls && col.is_null(row_index)) { continue; }
+      hash += cudf::type_dispatcher(col.type(), element_hasher<HiveHash, false>{}, col, row_index);
+    }
+    return static_cast<result_type>(hash);
+  }
+
+ private:
+  table_device_view _table;
+};
+
 }  // namespace cudf
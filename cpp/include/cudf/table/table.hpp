@@ -28,6 +28,18 @@ namespace cudf {
  * @{
  */
 
+/**
+ * @brief The columns a table is known to be sorted by, with their order and null precedence.
+ *
+ * The rows are sorted lexicographically by `key_columns`, in that order of precedence. An empty
+ * `key_columns` means that the order of the rows is unknown.
+ */
+struct table_sort_order {
+  std::vector<size_type> key_columns{};       ///< Indices of the columns sorted by
+  std::vector<order> column_order{};          ///< Order of each key column
+  std::vector<null_order> null_precedence{};  ///< Order of the nulls of each key column
+};
+
 class table {
  public:
   table()        = default;
@@ -124,7 +136,11 @@ class table {
    * @param i Index of the desired column
    * @return A reference to the desired column
    **/
-  column& get_column(cudf::size_type column_index) { return *(_columns.at(column_index)); }
+  column& get_column(cudf::size_type column_index)
+  {
+    _sort_order = {};
+    return *(_columns.at(column_index));
+  }
 
   /**
    * @brief Returns a const reference to the specified column
@@ -137,9 +153,53 @@ class table {
    **/
   column const& get_column(cudf::size_type i) const { return *(_columns.at(i)); }
 
+  /**
+   * @brief Returns the columns the rows are known to be sorted by.
+   *
+   * Sorting and merging record the order of the table they return, so that operations on the
+   * table can skip sorting it, or checking that it is sorted. The order is forgotten when the
+   * table may be modified, by `mutable_view()`, the non-const `get_column()` or `release()`.
+   *
+   * @return The sort order of the rows; with no key column if it is unknown
+   **/
+  table_sort_order const& sort_order() const noexcept { return _sort_order; }
+
+  /**
+   * @brief Records the columns the rows are sorted by.
+   *
+   * The rows are not checked to be sorted.
+   *
+   * @throws cudf::logic_error if a key column is not a column of the table, or `column_order` or
+   * a non-empty `null_precedence` does not have one element per key column
+   *
+   * @param key_columns Indices of the columns the rows are sorted by, in order of precedence
+   * @param column_order Order of each key column
+   * @param null_precedence Order of the nulls of each key column; `null_order::BEFORE` if empty
+   **/
+  void set_sort_order(std::vector<size_type> const& key_columns,
+                      std::vector<order> const& column_order,
+                      std::vector<null_order> const& null_precedence = {});
+
+  /**
+   * @brief Returns whether the rows are known to be sorted by `key_columns`.
+   *
+   * The rows sorted by some key columns are also sorted by the leading key columns, so this is
+   * true when `key_columns` are the first columns of `sort_order()`, with the same orders. No
+   * data is read.
+   *
+   * @param key_columns Indices of the columns, in order of precedence
+   * @param column_order Order of each column; ascending if empty
+   * @param null_precedence Order of the nulls of each column; `null_order::BEFORE` if empty
+   * @return true if the rows are known to be sorted as specified
+   **/
+  bool is_sorted_by(std::vector<size_type> const& key_columns,
+                    std::vector<order> const& column_order         = {},
+                    std::vector<null_order> const& null_precedence = {}) const;
+
  private:
   std::vector<std::unique_ptr<column>> _columns{};
   size_type _num_rows{};
+  table_sort_order _sort_order{};
 };
 /** @} */  // end of group
 
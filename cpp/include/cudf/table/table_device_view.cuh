@@ -24,6 +24,8 @@
 
 namespace cudf {
 namespace detail {
+struct view_descriptors;
+
 template <typename ColumnDeviceView, typename HostTableView>
 class table_device_view_base {
  public:
@@ -56,6 +58,9 @@ class table_device_view_base {
 
   __host__ __device__ size_type num_rows() const noexcept { return _num_rows; }
 
+  /**
+   * @brief Destroys the view and releases its device memory
+   */
   void destroy();
 
  private:
@@ -67,18 +72,26 @@ class table_device_view_base {
  protected:
   table_device_view_base(HostTableView source_view, cudaStream_t stream);
 
-  rmm::device_buffer* _descendant_storage{};
+  view_descriptors* _descendant_storage{};  ///< Owns the device memory of `_columns`
 };
 }  // namespace detail
 
 class table_device_view : public detail::table_device_view_base<column_device_view, table_view> {
  public:
+  /**
+   * @brief Factory to construct a `table_device_view` of `source_view` usable in device code.
+   *
+   * The column views are staged in pinned memory and copied to device memory ordered on
+   * `stream` without synchronizing it, so the result is ready for kernels launched on `stream`.
+   * On the default stream, views of the same columns created recently by the same thread share
+   * the device copy of their column views.
+   *
+   * @param source_view The table to make usable in device code
+   * @param stream CUDA stream used for the device memory of the column views
+   */
   static auto create(table_view source_view, cudaStream_t stream = 0)
   {
-    auto deleter = [](table_device_view* t) {
-      t->destroy();
-      delete t->_descendant_storage;
-    };
+    auto deleter = [](table_device_view* t) { t->destroy(); };
     return std::unique_ptr<table_device_view, decltype(deleter)>{
       new table_device_view(source_view, stream), deleter};
   }
@@ -93,6 +106,16 @@ class table_device_view : public detail::table_device_view_base<column_device_vi
 class mutable_table_device_view
   : public detail::table_device_view_base<mutable_column_device_view, mutable_table_view> {
  public:
+  /**
+   * @brief Factory to construct a `mutable_table_device_view` of `source_view` usable in device
+   * code.
+   *
+   * The column views are staged in pinned memory and copied to device memory ordered on
+   * `stream` without synchronizing it, so the result is ready for kernels launched on `stream`.
+   *
+   * @param source_view The table to make usable in device code
+   * @param stream CUDA stream used for the device memory of the column views
+   */
   static auto create(mutable_table_view source_view, cudaStream_t stream = 0)
   {
     auto deleter = [](mutable_table_device_view* t) { t->destroy(); };
@@ -51,6 +51,36 @@ std::unique_ptr<column> transform(
   bool is_ptx,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Creates a new column by applying a function against every row of the input columns.
+ *
+ * Computes:
+ * `out[i] = F(in_0[i], in_1[i], ...)`
+ *
+ * The function takes a pointer to the output value followed by the values of the columns of
+ * `inputs`, in order. `out[i]` is null if any `in_j[i]` is null, and the function is not applied
+ * to such rows.
+ *
+ * The compiled function is cached in memory and in the kernel cache directory, so a UDF is only
+ * compiled once for each output type and number of inputs, even across processes.
+ *
+ * @throws cudf::logic_error if `inputs` has no columns
+ * @throws cudf::logic_error if a column of `inputs` or `output_type` is not fixed-width
+ *
+ * @param inputs        The columns to transform
+ * @param udf           The PTX/CUDA string of the function to apply
+ * @param output_type   The output type that is compatible with the output type in the UDF
+ * @param is_ptx        true: the UDF is treated as PTX code; false: the UDF is treated as CUDA code
+ * @param mr            Device memory resource used to allocate the returned column's device memory
+ * @return              The column resulting from applying the function to every row of `inputs`
+ **/
+std::unique_ptr<column> transform(
+  table_view const& inputs,
+  std::string const& udf,
+  data_type output_type,
+  bool is_ptx,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Creates a null_mask from `input` by converting `NaN` to null and
  * preserving existing null values and also returns new null_count.
@@ -83,5 +113,43 @@ std::pair<std::unique_ptr<rmm::device_buffer>, size_type> nans_to_nulls(
 std::pair<std::unique_ptr<rmm::device_buffer>, cudf::size_type> bools_to_mask(
   column_view const& input, rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Computes a column by evaluating an expression tree on each row of a table.
+ *
+ * The whole expression is evaluated in a single pass over the table, without materializing the
+ * values of its subexpressions: `(a * b + c) > d` reads the four columns once and writes one
+ * column, where the equivalent `binary_operation()` calls run three kernels and allocate two
+ * temporary columns. The result of a boolean expression can be passed to `apply_boolean_mask()`
+ * to filter a table.
+ *
+ * Operators compute their values like `binary_operation()` and `unary_operation()`, in 64-bit
+ * types:
+ * - arithmetic operators return `INT64` if both operands are integral or boolean, and `FLOAT64`
+ *   otherwise, except `TRUE_DIV`, `FLOOR_DIV`, `POW`, `LOG_BASE` and `ATAN2` which always return
+ *   `FLOAT64`
+ * - comparison and logical operators, and `NOT`, return `BOOL8`
+ * - bitwise and shift operators, and `BIT_INVERT`, require integral operands and return `INT64`
+ * - `ABS`, `CEIL`, `FLOOR` and `RINT` return `INT64` or `FLOAT64` like their operand, and the
+ *   other unary operators return `FLOAT64`
+ * - a `cast_expression` converts its operand to its numeric type
+ *
+ * The output column has the type of the root of the expression tree. Element `i` of the output is
+ * null if any column referenced by the expression is null at row `i`, or if any literal is null.
+ *
+ * @throws cudf::logic_error if a referenced column is out of bounds of `table`
+ * @throws cudf::logic_error if a referenced column, a literal or a cast is not of a numeric type
+ * @throws cudf::logic_error if an operator is not supported by expressions
+ * @throws cudf::logic_error if the expression has more than 64 operators
+ *
+ * @param table  The table whose columns are referenced by `expr`
+ * @param expr   The root of the expression tree
+ * @param mr     Device memory resource used to allocate the returned column's device memory
+ * @return The values of `expr` for each row of `table`
+ **/
+std::unique_ptr<column> compute_column(
+  table_view const& table,
+  expression const& expr,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -83,6 +83,8 @@ class table;
 class table_view;
 class mutable_table_view;
 
+class expression;
+
 /**
  * @addtogroup utility_types
  * @{
@@ -178,6 +180,16 @@ enum class interpolation : int32_t {
   NEAREST    ///< i or j, whichever is nearest
 };
 
+/**
+ * @brief Identifies the hash function used to hash the rows of a table
+ **/
+enum class hash_id : int32_t {
+  HASH_MURMUR3,        ///< MurmurHash3_32, producing 32-bit hash values
+  HASH_XXHASH64,       ///< xxHash64, producing 64-bit hash values
+  HASH_SPARK_MURMUR3,  ///< MurmurHash3_32 with seed 42 as computed by Spark, producing INT32
+  HASH_HIVE            ///< The hash function of Hive, producing INT32
+};
+
 /**
  * @brief Identifies a column's logical element type
  **/
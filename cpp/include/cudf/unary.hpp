@@ -18,6 +18,7 @@
 
 #include <cudf/types.hpp>
 #include <memory>
+#include <vector>
 
 namespace cudf {
 /**
@@ -92,6 +93,38 @@ std::unique_ptr<cudf::column> is_valid(
   cudf::column_view const& input,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Creates a table of `type_id::BOOL8` columns where `true` indicates that the element of
+ * the corresponding column of `input` is null
+ *
+ * All the columns are computed by a single kernel launch, which makes this faster than calling
+ * `is_null` for each column of a table with many columns.
+ *
+ * @param input The columns to test
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @returns A table of non-nullable `type_id::BOOL8` columns with `true` representing `null`
+ * values
+ */
+std::unique_ptr<table> is_null(
+  table_view const& input, rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Creates a table of `type_id::BOOL8` columns where `true` indicates that the element of
+ * the corresponding column of `input` is valid
+ *
+ * All the columns are computed by a single kernel launch, which makes this faster than calling
+ * `is_valid` for each column of a table with many columns.
+ *
+ * @param input The columns to test
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @returns A table of non-nullable `type_id::BOOL8` columns with `false` representing `null`
+ * values
+ */
+std::unique_ptr<table> is_valid(
+  table_view const& input, rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief  Casts data from dtype specified in input to dtype specified in output.
  * Supports only fixed-width types.
@@ -107,6 +140,38 @@ std::unique_ptr<column> cast(column_view const& input,
                              data_type out_type,
                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Casts each column of a table to the corresponding type of `out_types`
+ *
+ * Equivalent to calling `cast` for each column, in a single call.
+ *
+ * @param input Input table
+ * @param out_types Desired datatype of each output column
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @returns Table of the cast columns
+ * @throw cudf::logic_error if `out_types` does not have a type per column of `input`
+ * @throw cudf::logic_error if a type of `out_types` is not a fixed-width type
+ */
+std::unique_ptr<table> cast(table_view const& input,
+                            std::vector<data_type> const& out_types,
+                            rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns a view of `input` whose elements are reinterpreted as `out_type`
+ *
+ * No data is copied. For types of the same layout, e.g. `INT64` and `TIMESTAMP_SECONDS`, the
+ * result holds the values `cast` would return.
+ *
+ * @param input Input column
+ * @param out_type Type of the elements of the returned view
+ *
+ * @returns View of the data and null mask of `input`
+ * @throw cudf::logic_error if `input` or `out_type` is not a fixed-width type
+ * @throw cudf::logic_error if the types of `input` and `out_type` do not have the same size
+ */
+column_view bit_cast(column_view const& input, data_type out_type);
+
 /**
  * @brief Creates a column of `type_id::BOOL8` elements indicating the presence of `NaN` values
  * in a column of floating point values.
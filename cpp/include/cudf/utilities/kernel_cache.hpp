@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+namespace cudf {
+/**
+ * @brief Counters of the cache of JIT compiled programs and kernels
+ **/
+struct kernel_cache_statistics {
+  std::size_t memory_hits{0};                ///< Lookups found in memory
+  std::size_t file_hits{0};                  ///< Lookups read from a cache file
+  std::size_t misses{0};                     ///< Lookups that had to be compiled
+  std::size_t evictions{0};                  ///< Entries evicted from memory
+  std::size_t file_evictions{0};             ///< Cache files removed from the cache directory
+  std::chrono::nanoseconds compile_time{0};  ///< Total time spent compiling on misses
+};
+
+/**
+ * @brief  Returns the counters of the process-wide cache of JIT compiled kernels.
+ *
+ * @returns The counters accumulated since the start of the process, or since the last call to
+ * `reset_kernel_cache_statistics()`
+ **/
+kernel_cache_statistics get_kernel_cache_statistics();
+
+/**
+ * @brief  Resets the counters of the process-wide cache of JIT compiled kernels to zero.
+ **/
+void reset_kernel_cache_statistics();
+
+/**
+ * @brief  Sets the size limits of the process-wide cache of JIT compiled kernels.
+ *
+ * When a limit is exceeded the least recently used entries are evicted. The memory limit applies
+ * separately to the programs and to the kernels of each CUDA context, and is measured by the
+ * serialized size of the entries. The disk limit applies to the total size of the files in the
+ * kernel cache directory, which may be shared by several processes.
+ *
+ * The initial limits are read from the environment variables `LIBCUDF_KERNEL_CACHE_LIMIT_MEMORY`
+ * and `LIBCUDF_KERNEL_CACHE_LIMIT_DISK`, in bytes, and are unlimited if these are not set.
+ *
+ * @param[in] memory_limit The maximum size in bytes of the entries held in memory, or 0 for no
+ *                         limit
+ * @param[in] disk_limit The maximum size in bytes of the kernel cache directory, or 0 for no limit
+ **/
+void set_kernel_cache_limits(std::size_t memory_limit, std::size_t disk_limit);
+
+}  // namespace cudf
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace cudf {
+/**
+ * @addtogroup utility_profiling
+ * @{
+ */
+
+/**
+ * @brief Interface of the callbacks notified of the calls of libcudf's public APIs
+ *
+ * The callbacks are invoked for every API annotated with an NVTX range in the `libcudf`
+ * domain, so they observe the same operations as Nsight Systems without requiring it. An API
+ * calling another public API produces nested notifications.
+ *
+ * The callbacks may be invoked concurrently from several threads and must not throw.
+ */
+class profiling_callbacks {
+ public:
+  virtual ~profiling_callbacks() = default;
+
+  /**
+   * @brief Called when an API is entered
+   *
+   * @param name The name of the API
+   */
+  virtual void on_begin(char const* name) {}
+
+  /**
+   * @brief Called when an API returns or throws
+   *
+   * The kernels launched by the API may still be running: `elapsed` is the time spent on the
+   * host, which includes the device work only when the API synchronizes.
+   *
+   * @param name The name of the API
+   * @param elapsed The time spent in the API
+   */
+  virtual void on_end(char const* name, std::chrono::nanoseconds elapsed) {}
+
+  /**
+   * @brief Called when an operation reports a measurement
+   *
+   * For example, `read_parquet` and `read_orc` report the `bytes_read` from their sources, the
+   * `bytes_decompressed` and the `rows_skipped` in row groups or stripes that are not read.
+   *
+   * @param name The name of the operation
+   * @param counter The name of the measurement
+   * @param value The measured value
+   */
+  virtual void on_counter(char const* name, char const* counter, int64_t value) {}
+};
+
+/**
+ * @brief Profiling callbacks aggregating the calls and measurements of each operation
+ *
+ * Set it with `set_profiling_callbacks` to collect the metrics of the operations of all threads,
+ * e.g., for choosing between operations from measurements.
+ */
+class metrics_registry final : public profiling_callbacks {
+ public:
+  /**
+   * @brief Aggregated metrics of an operation
+   */
+  struct operation_metrics {
+    int64_t calls{0};                           ///< Number of calls that returned or threw
+    std::chrono::nanoseconds elapsed{0};        ///< Total time spent in the calls on the host
+    std::map<std::string, int64_t> counters{};  ///< Sum of the values of each measurement
+  };
+
+  void on_end(char const* name, std::chrono::nanoseconds elapsed) override;
+
+  void on_counter(char const* name, char const* counter, int64_t value) override;
+
+  /**
+   * @brief Returns a copy of the metrics of each operation called since the last reset
+   */
+  std::map<std::string, operation_metrics> metrics() const;
+
+  /**
+   * @brief Discards the metrics collected so far
+   */
+  void reset();
+
+ private:
+  mutable std::mutex _mutex;
+  std::map<std::string, operation_metrics> _metrics;
+};
+
+/**
+ * @brief Sets the callbacks notified of the calls of libcudf's public APIs
+ *
+ * No callbacks are set by default, in which case an API only checks that none are set.
+ *
+ * @param callbacks The callbacks to notify, or `nullptr` to stop notifying. They must outlive
+ * the calls in progress when they are replaced.
+ * @return The callbacks previously set, or `nullptr`
+ */
+profiling_callbacks* set_profiling_callbacks(profiling_callbacks* callbacks);
+
+/**
+ * @brief Returns the callbacks notified of the calls of libcudf's public APIs, or `nullptr`
+ */
+profiling_callbacks* get_profiling_callbacks();
+
+/** @} */  // end of group
+}  // namespace cudf
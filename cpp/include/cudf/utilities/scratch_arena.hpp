@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/mr/device/default_memory_resource.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <cuda_runtime.h>
+
+#include <cstddef>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+/**
+ * @brief A device memory resource that carves allocations out of large blocks and frees them all
+ * at once.
+ *
+ * Allocations bump a pointer through blocks of at least `block_size` bytes obtained from the
+ * upstream resource; deallocations are no-ops. `reset()` makes the blocks available again and the
+ * destructor returns them upstream. Used as the scratch resource of a sequence of operations (see
+ * `scratch_resource_scope`), their temporaries cost no allocator calls once the blocks are large
+ * enough, and do not fragment the upstream resource of long-running services.
+ *
+ * All work using the memory must be ordered on the stream the arena is created with: the blocks
+ * are reused by `reset()` and freed by the destructor on that stream.
+ */
+class scratch_arena final : public rmm::mr::device_memory_resource {
+ public:
+  static constexpr std::size_t default_block_size = 4 * 1024 * 1024;
+
+  /**
+   * @brief Constructs an arena allocating blocks from `upstream`.
+   *
+   * @throws cudf::logic_error if `upstream` is null or `block_size` is 0
+   *
+   * @param stream The stream all work using the memory is ordered on
+   * @param upstream The resource the blocks are allocated from
+   * @param block_size The minimum size of a block in bytes
+   */
+  explicit scratch_arena(
+    cudaStream_t stream                       = 0,
+    rmm::mr::device_memory_resource* upstream = rmm::mr::get_default_resource(),
+    std::size_t block_size                    = default_block_size);
+
+  ~scratch_arena() override;
+
+  scratch_arena(scratch_arena const&) = delete;
+  scratch_arena& operator=(scratch_arena const&) = delete;
+
+  /**
+   * @brief Makes all the memory of the arena available again, invalidating its allocations.
+   */
+  void reset();
+
+  /**
+   * @brief Returns the number of bytes of the blocks obtained from upstream.
+   */
+  std::size_t capacity() const;
+
+  /**
+   * @brief Returns the resource the blocks are allocated from.
+   */
+  rmm::mr::device_memory_resource* get_upstream() const noexcept { return _upstream; }
+
+  bool supports_streams() const noexcept override { return false; }
+
+  bool supports_get_mem_info() const noexcept override { return false; }
+
+ private:
+  void* do_allocate(std::size_t bytes, cudaStream_t stream) override;
+
+  void do_deallocate(void* p, std::size_t bytes, cudaStream_t stream) override {}
+
+  std::pair<std::size_t, std::size_t> do_get_mem_info(cudaStream_t stream) const override
+  {
+    return {0, 0};
+  }
+
+  struct block {
+    void* ptr;
+    std::size_t size;
+    std::size_t used;
+  };
+
+  cudaStream_t _stream;
+  rmm::mr::device_memory_resource* _upstream;
+  std::size_t _block_size;
+  mutable std::mutex _mutex;
+  std::vector<block> _blocks;
+  std::size_t _current{};  ///< Index of the first block with free space
+};
+
+/**
+ * @brief Sets the resource libcudf allocates temporaries from in the calling thread, for the
+ * lifetime of the object.
+ *
+ * Temporaries are the device memory an operation frees before returning: scratch vectors and the
+ * temporary storage of Thrust algorithms. They come from the default resource outside of a scope,
+ * while the memory returned to the caller always comes from the `mr` argument. Scopes nest; the
+ * previous resource is restored on destruction.
+ *
+ * @code{.cpp}
+ * cudf::scratch_arena arena;  // public APIs run on the default stream
+ * for (auto const& batch : batches) {
+ *   cudf::scratch_resource_scope scope{&arena};
+ *   auto sorted = cudf::sort(batch, {}, {}, mr);
+ *   ...
+ *   arena.reset();  // the stream orders the next batch after this one
+ * }
+ * @endcode
+ */
+class scratch_resource_scope {
+ public:
+  /**
+   * @brief Sets `mr` as the scratch resource of the calling thread.
+   *
+   * @throws cudf::logic_error if `mr` is null
+   *
+   * @param mr The resource to allocate temporaries from
+   */
+  explicit scratch_resource_scope(rmm::mr::device_memory_resource* mr);
+
+  ~scratch_resource_scope();
+
+  scratch_resource_scope(scratch_resource_scope const&) = delete;
+  scratch_resource_scope& operator=(scratch_resource_scope const&) = delete;
+
+ private:
+  rmm::mr::device_memory_resource* _previous;
+};
+
+namespace detail {
+/**
+ * @brief Returns the resource temporaries are allocated from in the calling thread
+ *
+ * The resource of the innermost `scratch_resource_scope`, or the default resource.
+ */
+rmm::mr::device_memory_resource* scratch_resource();
+
+}  // namespace detail
+}  // namespace cudf
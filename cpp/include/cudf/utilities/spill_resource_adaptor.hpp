@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <functional>
+#include <new>
+#include <utility>
+
+namespace cudf {
+/**
+ * @brief Callback invoked by `spill_resource_adaptor` when an allocation fails.
+ *
+ * It is passed the number of bytes requested and should try to free device memory, for example
+ * by moving cached buffers to host memory. It returns `true` if the allocation should be retried
+ * and `false` to let the allocation fail.
+ */
+using spill_handler = std::function<bool(std::size_t)>;
+
+/**
+ * @brief A device memory resource that delegates to another resource and, when an allocation
+ * fails, invokes a spill handler and retries instead of failing the operation.
+ *
+ * Installing it as the default resource (and passing it as `mr`) lets the allocations of a
+ * libcudf operation under memory pressure wait for the application to evict memory rather than
+ * throwing `std::bad_alloc` and discarding the work done so far.
+ *
+ * The handler is called without any lock held, so it may free memory allocated from this
+ * resource. It is called again after each failed retry until it returns `false`.
+ *
+ * @tparam Upstream Type of the wrapped resource
+ */
+template <typename Upstream>
+class spill_resource_adaptor final : public rmm::mr::device_memory_resource {
+ public:
+  /**
+   * @brief Constructs an adaptor allocating from `upstream` and calling `handler` when an
+   * allocation fails.
+   *
+   * @throws cudf::logic_error if `upstream` is null or `handler` is empty
+   *
+   * @param upstream The resource used for all allocations
+   * @param handler The callback invoked on allocation failure
+   */
+  spill_resource_adaptor(Upstream* upstream, spill_handler handler)
+    : upstream_{upstream}, handler_{std::move(handler)}
+  {
+    CUDF_EXPECTS(upstream_ != nullptr, "Unexpected null upstream resource pointer.");
+    CUDF_EXPECTS(static_cast<bool>(handler_), "Unexpected empty spill handler.");
+  }
+
+  /**
+   * @brief Returns the wrapped resource.
+   */
+  Upstream* get_upstream() const noexcept { return upstream_; }
+
+  bool supports_streams() const noexcept override { return upstream_->supports_streams(); }
+
+  bool supports_get_mem_info() const noexcept override
+  {
+    return upstream_->supports_get_mem_info();
+  }
+
+ private:
+  void* do_allocate(std::size_t bytes, cudaStream_t stream) override
+  {
+    while (true) {
+      try {
+        return upstream_->allocate(bytes, stream);
+      } catch (std::bad_alloc const&) {
+        if (not handler_(bytes)) { throw; }
+      }
+    }
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, cudaStream_t stream) override
+  {
+    upstream_->deallocate(p, bytes, stream);
+  }
+
+  std::pair<std::size_t, std::size_t> do_get_mem_info(cudaStream_t stream) const override
+  {
+    return upstream_->get_mem_info(stream);
+  }
+
+  Upstream* upstream_;
+  spill_handler handler_;
+};
+
+}  // namespace cudf
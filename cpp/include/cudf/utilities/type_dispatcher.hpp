@@ -18,6 +18,7 @@
 
 #include <cudf/detail/utilities/release_assert.cuh>
 #include <cudf/types.hpp>
+#include <cudf/utilities/dispatch_config.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/wrappers/dictionary.hpp>
 #include <cudf/wrappers/durations.hpp>
@@ -307,6 +308,14 @@ using scalar_device_type_t = typename type_to_scalar_type_impl<T>::ScalarDeviceT
  * lambda must be the same, else there will be a compiler error as you would be
  * trying to return different types from the same function.
  *
+ * Groups of types can be left out of every dispatch to reduce the number of
+ * instantiations, and so the library size and module load time, with the
+ * libcudf CMake options `CUDF_DISPATCH_EXCLUDE_DURATIONS` and
+ * `CUDF_DISPATCH_EXCLUDE_UNSIGNED`. They are recorded in the generated
+ * `dispatch_config.hpp`, so that the library and the code using it agree on the
+ * dispatched types. No functor is instantiated for the excluded types and
+ * dispatching one of them fails as an unsupported `type_id`.
+ *
  * @tparam id_to_type_impl Maps a `cudf::type_id` its dispatched C++ type
  * @tparam Functor The callable object's type
  * @tparam Ts Variadic parameter pack type
@@ -343,6 +352,7 @@ CUDA_HOST_DEVICE_CALLABLE constexpr decltype(auto) type_dispatcher(cudf::data_ty
     case type_id::INT64:
       return f.template operator()<typename IdTypeMap<type_id::INT64>::type>(
         std::forward<Ts>(args)...);
+#ifndef CUDF_DISPATCH_EXCLUDE_UNSIGNED
     case type_id::UINT8:
       return f.template operator()<typename IdTypeMap<type_id::UINT8>::type>(
         std::forward<Ts>(args)...);
@@ -355,6 +365,7 @@ CUDA_HOST_DEVICE_CALLABLE constexpr decltype(auto) type_dispatcher(cudf::data_ty
     case type_id::UINT64:
       return f.template operator()<typename IdTypeMap<type_id::UINT64>::type>(
         std::forward<Ts>(args)...);
+#endif
     case type_id::FLOAT32:
       return f.template operator()<typename IdTypeMap<type_id::FLOAT32>::type>(
         std::forward<Ts>(args)...);
@@ -379,6 +390,7 @@ CUDA_HOST_DEVICE_CALLABLE constexpr decltype(auto) type_dispatcher(cudf::data_ty
     case type_id::TIMESTAMP_NANOSECONDS:
       return f.template operator()<typename IdTypeMap<type_id::TIMESTAMP_NANOSECONDS>::type>(
         std::forward<Ts>(args)...);
+#ifndef CUDF_DISPATCH_EXCLUDE_DURATIONS
     case type_id::DURATION_DAYS:
       return f.template operator()<typename IdTypeMap<type_id::DURATION_DAYS>::type>(
         std::forward<Ts>(args)...);
@@ -394,6 +406,7 @@ CUDA_HOST_DEVICE_CALLABLE constexpr decltype(auto) type_dispatcher(cudf::data_ty
     case type_id::DURATION_NANOSECONDS:
       return f.template operator()<typename IdTypeMap<type_id::DURATION_NANOSECONDS>::type>(
         std::forward<Ts>(args)...);
+#endif
     case type_id::DICTIONARY32:
       return f.template operator()<typename IdTypeMap<type_id::DICTIONARY32>::type>(
         std::forward<Ts>(args)...);
@@ -86,6 +86,8 @@
  *   @defgroup column_interop Interop
  *   @{
  *     @defgroup interop_dlpack DLPack
+ *     @defgroup interop_arrow Arrow
+ *     @defgroup interop_ipc CUDA IPC
  *   @}
  * @}
  * @defgroup datetime_apis DateTime
@@ -117,6 +119,7 @@
  *   @defgroup io_datasources Datasources
  *   @defgroup io_readers Readers
  *   @defgroup io_writers Writers
+ *   @defgroup io_compression Compression
  * @}
  * @defgroup nvtext_apis NVText
  * @{
@@ -131,5 +134,6 @@
  *   @defgroup utility_dispatcher Type Dispatcher
  *   @defgroup utility_bitmask Bitmask
  *   @defgroup utility_error Exception
+ *   @defgroup utility_profiling Profiling
  * @}
  */
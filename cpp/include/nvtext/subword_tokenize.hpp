@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <string>
+
+namespace nvtext {
+/**
+ * @addtogroup nvtext_tokenize
+ * @{
+ */
+
+/**
+ * @brief Vocabulary of a WordPiece tokenizer, kept in a hash table in device memory.
+ *
+ * Each row of the vocabulary column is a token and its row index is the token's id.
+ * As in BERT vocabularies, the tokens starting with "##" are the pieces continuing a word,
+ * and the other tokens are the pieces starting a word. The tokens should be unique.
+ *
+ * The vocabulary is loaded once and can then tokenize any number of strings columns.
+ */
+class wordpiece_vocabulary {
+ public:
+  struct vocabulary_impl;
+
+  wordpiece_vocabulary() = delete;
+  ~wordpiece_vocabulary();
+  wordpiece_vocabulary(wordpiece_vocabulary const&) = delete;
+  wordpiece_vocabulary(wordpiece_vocabulary&&)      = delete;
+  wordpiece_vocabulary& operator=(wordpiece_vocabulary const&) = delete;
+  wordpiece_vocabulary& operator=(wordpiece_vocabulary&&) = delete;
+
+  /**
+   * @brief Copies the vocabulary to device memory and builds its hash table.
+   *
+   * @throw cudf::logic_error if `vocabulary` is empty or contains nulls
+   * @throw cudf::logic_error if `unknown_token` is not in `vocabulary`
+   *
+   * @param vocabulary Tokens of the vocabulary. Token ids are the row indices.
+   * @param unknown_token Token replacing the words that cannot be split into vocabulary tokens.
+   */
+  wordpiece_vocabulary(cudf::strings_column_view const& vocabulary,
+                       std::string const& unknown_token = "[UNK]");
+
+  /**
+   * @brief Returns the hash table of the vocabulary, for use by `subword_tokenize`.
+   */
+  vocabulary_impl const* get_impl() const;
+
+ private:
+  const std::unique_ptr<const vocabulary_impl> impl;
+};
+
+/**
+ * @brief Token ids, attention mask and token offsets of each string, `max_sequence_length`
+ * values per string.
+ *
+ * Row `i` of the strings is represented by the values `[i * max_sequence_length,
+ * (i + 1) * max_sequence_length)` of each column.
+ */
+struct subword_tokens {
+  std::unique_ptr<cudf::column> token_ids;       ///< INT32 token ids, 0 after the last token
+  std::unique_ptr<cudf::column> attention_mask;  ///< INT8 1 for each token, 0 after the last
+  std::unique_ptr<cudf::column> token_offsets;   ///< INT32 byte position of each token
+};
+
+/**
+ * @brief Splits each string into the subword tokens of a WordPiece vocabulary.
+ *
+ * The strings are first split into words on whitespace (code-point <= ' '), as
+ * `normalize_spaces` does, and each ASCII punctuation character is a word by itself.
+ * Each word is then split into the longest vocabulary tokens from its beginning. A word that
+ * cannot be split into vocabulary tokens, or that is longer than 100 characters, becomes
+ * the unknown token.
+ *
+ * The tokens of each string after the first `max_sequence_length` are dropped.
+ * Null strings produce no tokens.
+ *
+ * @code{.pseudo}
+ * Example:
+ * v = ["[PAD]","[UNK]","the","un","##aff","##able",","]
+ * s = ["the unaffable, the ", "thé"]
+ * r = subword_tokenize(s,wordpiece_vocabulary(v),6)
+ * r.token_ids is now      [2,3,4,5,6,2, 1,0,0,0,0,0]
+ * r.attention_mask is now [1,1,1,1,1,1, 1,0,0,0,0,0]
+ * r.token_offsets is now  [0,4,6,9,13,15, 0,0,0,0,0,0]
+ * @endcode
+ *
+ * @throw cudf::logic_error if `max_sequence_length` is not positive
+ * @throw cudf::logic_error if the output would have more than the maximum column size
+ *
+ * @param strings Strings column to tokenize.
+ * @param vocabulary Vocabulary of the tokens.
+ * @param max_sequence_length Number of tokens kept for each string.
+ * @param do_lower_case Convert the strings to lower case before tokenizing them.
+ *        The token offsets are then byte positions in the lower case strings.
+ * @param mr Device memory resource used to allocate the returned columns' device memory.
+ * @return The token ids, attention mask and token offsets of the strings.
+ */
+subword_tokens subword_tokenize(
+  cudf::strings_column_view const& strings,
+  wordpiece_vocabulary const& vocabulary,
+  cudf::size_type max_sequence_length,
+  bool do_lower_case                  = true,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/** @} */  // end of group
+}  // namespace nvtext
@@ -19,18 +19,30 @@
 #include <algorithm>
 #include <chrono>
 #include <cudf/io/datasource.hpp>
+#include <future>
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace cudf {
 namespace io {
 namespace external {
 namespace kafka {
 
+/**
+ * @brief Messages consumed from each partition of a topic
+ **/
+using partition_messages = std::vector<std::vector<std::unique_ptr<RdKafka::Message>>>;
+
 /**
  * @brief libcudf datasource for Apache Kafka
  *
+ * The messages of a batch are consumed from each partition by a separate thread and copied once
+ * into a page-locked host buffer, which is served by `host_read` without copies and by
+ * `device_read` with a direct DMA transfer. The offset of each message in the data is kept, so
+ * that messages can be delimited without scanning the data for delimiters.
+ *
  * @ingroup io_datasources
  **/
 class kafka_consumer : public cudf::io::datasource {
@@ -58,6 +70,29 @@ class kafka_consumer : public cudf::io::datasource {
                  int batch_timeout,
                  std::string delimiter);
 
+  /**
+   * @brief Instantiate a Kafka consumer object reading several partitions of a topic in parallel
+   *
+   * The messages of each partition follow those of the previous partitions in the data.
+   *
+   * @param configs key/value pairs of librdkafka configurations that will be
+   *                passed to the librdkafka clients
+   * @param topic_name name of the Kafka topic to consume from
+   * @param partitions indexes of the partitions to consume from
+   * @param start_offset seek position in each partition
+   * @param end_offset position in each partition to read to
+   * @param batch_timeout maximum (millisecond) read time allowed. If end_offset is not reached
+   * before batch_timeout, a smaller subset will be returned
+   * @param delimiter optional delimiter to insert into the output between kafka messages, Ex: "\n"
+   **/
+  kafka_consumer(std::map<std::string, std::string> configs,
+                 std::string topic_name,
+                 std::vector<int> partitions,
+                 int64_t start_offset,
+                 int64_t end_offset,
+                 int batch_timeout,
+                 std::string delimiter);
+
   /**
    * @brief Returns a buffer with a subset of data from Kafka Topic
    *
@@ -86,32 +121,143 @@ class kafka_consumer : public cudf::io::datasource {
    */
   size_t host_read(size_t offset, size_t size, uint8_t *dst) override;
 
+  bool supports_device_read() const override { return true; }
+
+  /**
+   * @brief Returns a device buffer with a subset of data from Kafka Topic
+   *
+   * @param[in] offset Bytes from the start
+   * @param[in] size Bytes to read
+   *
+   * @return The data buffer in the device memory
+   */
+  std::unique_ptr<cudf::io::datasource::buffer> device_read(size_t offset, size_t size) override;
+
+  /**
+   * @brief Reads a selected range into a preallocated device buffer
+   *
+   * @param[in] offset Bytes from the start
+   * @param[in] size Bytes to read
+   * @param[in] dst Address of the existing device memory
+   *
+   * @return The number of bytes read (can be smaller than size)
+   */
+  size_t device_read(size_t offset, size_t size, uint8_t *dst) override;
+
+  /**
+   * @brief Returns the offset of each message in the data, followed by the size of the data
+   *
+   * Message `i` and its delimiter span `[message_offsets()[i], message_offsets()[i + 1])`.
+   */
+  std::vector<size_t> const &message_offsets() const { return offsets; }
+
   virtual ~kafka_consumer(){};
 
  private:
+  friend class kafka_batch_consumer;
+
+  struct pinned_deleter {
+    void operator()(uint8_t *ptr) const;
+  };
+
+  /**
+   * @brief Instantiates a datasource serving messages consumed beforehand
+   **/
+  kafka_consumer(partition_messages const &messages, std::string delimiter);
+
   std::unique_ptr<RdKafka::Conf> kafka_conf;  // RDKafka configuration object
-  std::unique_ptr<RdKafka::KafkaConsumer> consumer;
 
   std::string topic_name;
-  int partition;
+  std::vector<int> partitions;
   int64_t start_offset;
   int64_t end_offset;
   int batch_timeout;
   std::string delimiter;
 
-  std::string buffer;
+  std::unique_ptr<uint8_t, pinned_deleter> buffer;  // page-locked message data
+  size_t buffer_size = 0;
+  std::vector<size_t> offsets;
 
  private:
-  RdKafka::ErrorCode update_consumer_topic_partition_assignment(std::string const &topic,
-                                                                int partition,
-                                                                int64_t offset);
+  void consume_to_buffer();
 
   /**
-   * Convenience method for getting "now()" in Kafka's standard format
+   * @brief Copies the payloads of the messages into the pinned buffer, a thread per partition
    **/
-  int64_t now();
+  void fill_buffer(partition_messages const &messages);
+};
 
-  void consume_to_buffer();
+/**
+ * @brief Long-lived Kafka consumer yielding a datasource per micro-batch of messages
+ *
+ * The librdkafka consumers of the partitions are created and assigned once, rather than for each
+ * offset range as with `kafka_consumer`. The next batch is consumed in the background while the
+ * current one is parsed.
+ *
+ * @ingroup io_datasources
+ **/
+class kafka_batch_consumer {
+ public:
+  /**
+   * @brief Instantiate a consumer of successive batches of a topic, and starts consuming the
+   * first batch
+   *
+   * @param configs key/value pairs of librdkafka configurations that will be
+   *                passed to the librdkafka clients
+   * @param topic_name name of the Kafka topic to consume from
+   * @param partitions indexes of the partitions to consume from
+   * @param start_offset seek position in each partition
+   * @param batch_size maximum number of messages of each partition in a batch
+   * @param batch_timeout maximum (millisecond) read time allowed for a batch. If `batch_size`
+   * messages are not read before batch_timeout, a smaller batch will be returned
+   * @param delimiter optional delimiter to insert into the output between kafka messages, Ex: "\n"
+   **/
+  kafka_batch_consumer(std::map<std::string, std::string> configs,
+                       std::string topic_name,
+                       std::vector<int> partitions,
+                       int64_t start_offset,
+                       int64_t batch_size,
+                       int batch_timeout,
+                       std::string delimiter);
+
+  ~kafka_batch_consumer();
+
+  /**
+   * @brief Returns a datasource of the messages of the next batch, and starts consuming the
+   * following batch
+   *
+   * @return The datasource of the batch, empty if no message arrived within the batch timeout
+   */
+  std::unique_ptr<kafka_consumer> next_batch();
+
+  /**
+   * @brief Commits the offsets following the batches returned by `next_batch`, waiting for the
+   * commit to complete
+   */
+  void commit();
+
+  /**
+   * @brief Returns the offset following the batches returned by `next_batch`, in each partition
+   */
+  std::vector<int64_t> const &next_offsets() const { return offsets; }
+
+ private:
+  std::unique_ptr<RdKafka::Conf> kafka_conf;  // RDKafka configuration object
+
+  std::string topic_name;
+  std::vector<int> partitions;
+  int64_t batch_size;
+  int batch_timeout;
+  std::string delimiter;
+
+  std::vector<std::unique_ptr<RdKafka::KafkaConsumer>> consumers;  // one per partition
+  std::vector<int64_t> offsets;
+  std::future<partition_messages> prefetched_batch;
+
+  /**
+   * @brief Consumes a batch from each partition, a thread per partition
+   **/
+  partition_messages consume_batch();
 };
 
 }  // namespace kafka
@@ -15,30 +15,43 @@
  */
 
 #include "cudf_kafka/kafka_consumer.hpp"
+#include <cuda_runtime.h>
 #include <librdkafka/rdkafkacpp.h>
+#include <rmm/device_buffer.hpp>
 #include <chrono>
+#include <cstring>
+#include <exception>
+#include <future>
 #include <memory>
+#include <thread>
 
 namespace cudf {
 namespace io {
 namespace external {
 namespace kafka {
+namespace {
+/**
+ * @brief Buffer owning the device memory it was read into
+ **/
+class device_buffer_wrapper : public cudf::io::datasource::buffer {
+ public:
+  explicit device_buffer_wrapper(rmm::device_buffer &&buffer) : _buffer(std::move(buffer)) {}
 
-kafka_consumer::kafka_consumer(std::map<std::string, std::string> configs,
-                               std::string topic_name,
-                               int partition,
-                               int64_t start_offset,
-                               int64_t end_offset,
-                               int batch_timeout,
-                               std::string delimiter)
-  : topic_name(topic_name),
-    partition(partition),
-    start_offset(start_offset),
-    end_offset(end_offset),
-    batch_timeout(batch_timeout),
-    delimiter(delimiter)
+  size_t size() const override { return _buffer.size(); }
+
+  const uint8_t *data() const override { return static_cast<const uint8_t *>(_buffer.data()); }
+
+ private:
+  rmm::device_buffer _buffer;
+};
+
+/**
+ * @brief Creates a librdkafka configuration from key/value pairs
+ **/
+std::unique_ptr<RdKafka::Conf> make_conf(std::map<std::string, std::string> const &configs)
 {
-  kafka_conf = std::unique_ptr<RdKafka::Conf>(RdKafka::Conf::create(RdKafka::Conf::CONF_GLOBAL));
+  auto kafka_conf =
+    std::unique_ptr<RdKafka::Conf>(RdKafka::Conf::create(RdKafka::Conf::CONF_GLOBAL));
 
   for (auto const &key_value : configs) {
     std::string error_string;
@@ -49,63 +62,257 @@ kafka_consumer::kafka_consumer(std::map<std::string, std::string> configs,
 
   // Kafka 0.9 > requires group.id in the configuration
   std::string conf_val;
-  CUDF_EXPECTS(RdKafka::Conf::ConfResult::CONF_OK == kafka_conf->get("group_id", conf_val),
+  CUDF_EXPECTS(RdKafka::Conf::ConfResult::CONF_OK == kafka_conf->get("group.id", conf_val) &&
+                 !conf_val.empty(),
                "Kafka group.id must be configured");
+  return kafka_conf;
+}
 
+/**
+ * @brief Creates a consumer of a partition, assigned at `offset`
+ **/
+std::unique_ptr<RdKafka::KafkaConsumer> make_consumer(RdKafka::Conf *kafka_conf,
+                                                      std::string const &topic_name,
+                                                      int partition,
+                                                      int64_t offset)
+{
   std::string errstr;
-  consumer = std::unique_ptr<RdKafka::KafkaConsumer>(
-    RdKafka::KafkaConsumer::create(kafka_conf.get(), errstr));
+  std::unique_ptr<RdKafka::KafkaConsumer> consumer{
+    RdKafka::KafkaConsumer::create(kafka_conf, errstr)};
+  CUDF_EXPECTS(consumer != nullptr, "Cannot create Kafka consumer");
+
+  std::unique_ptr<RdKafka::TopicPartition> topic_partition{
+    RdKafka::TopicPartition::create(topic_name, partition, offset)};
+  CUDF_EXPECTS(consumer->assign({topic_partition.get()}) == RdKafka::ErrorCode::ERR_NO_ERROR,
+               "Cannot assign Kafka partition");
+  return consumer;
+}
+
+/**
+ * @brief Consumes up to `count` messages from each consumer before `end`, a thread per consumer
+ **/
+partition_messages consume_partitions(std::vector<RdKafka::KafkaConsumer *> const &consumers,
+                                      int64_t count,
+                                      std::chrono::steady_clock::time_point end)
+{
+  partition_messages messages(consumers.size());
+  std::vector<std::exception_ptr> errors(consumers.size());
+  std::vector<std::thread> threads;
+  for (size_t p = 0; p < consumers.size(); ++p) {
+    threads.emplace_back([&, p] {
+      try {
+        while (static_cast<int64_t>(messages[p].size()) < count &&
+               end > std::chrono::steady_clock::now()) {
+          auto const timeout = std::chrono::duration_cast<std::chrono::milliseconds>(
+            end - std::chrono::steady_clock::now());
+          std::unique_ptr<RdKafka::Message> msg{consumers[p]->consume(timeout.count())};
+
+          if (msg->err() == RdKafka::ErrorCode::ERR_NO_ERROR) {
+            messages[p].push_back(std::move(msg));
+          }
+        }
+      } catch (...) {
+        errors[p] = std::current_exception();
+      }
+    });
+  }
+  for (auto &thread : threads) { thread.join(); }
+  for (auto const &error : errors) {
+    if (error) { std::rethrow_exception(error); }
+  }
+  return messages;
+}
+
+}  // namespace
+
+kafka_consumer::kafka_consumer(std::map<std::string, std::string> configs,
+                               std::string topic_name,
+                               int partition,
+                               int64_t start_offset,
+                               int64_t end_offset,
+                               int batch_timeout,
+                               std::string delimiter)
+  : kafka_consumer(std::move(configs),
+                   std::move(topic_name),
+                   std::vector<int>{partition},
+                   start_offset,
+                   end_offset,
+                   batch_timeout,
+                   std::move(delimiter))
+{
+}
+
+kafka_consumer::kafka_consumer(std::map<std::string, std::string> configs,
+                               std::string topic_name,
+                               std::vector<int> partitions,
+                               int64_t start_offset,
+                               int64_t end_offset,
+                               int batch_timeout,
+                               std::string delimiter)
+  : topic_name(topic_name),
+    partitions(partitions),
+    start_offset(start_offset),
+    end_offset(end_offset),
+    batch_timeout(batch_timeout),
+    delimiter(delimiter)
+{
+  CUDF_EXPECTS(!partitions.empty(), "No Kafka partition to consume from");
+  kafka_conf = make_conf(configs);
 
   // Pre fill the local buffer with messages so the datasource->size() invocation
   // will return a valid size.
   consume_to_buffer();
 }
 
+kafka_consumer::kafka_consumer(partition_messages const &messages, std::string delimiter)
+  : start_offset(0), end_offset(0), batch_timeout(0), delimiter(delimiter)
+{
+  fill_buffer(messages);
+}
+
+void kafka_consumer::pinned_deleter::operator()(uint8_t *ptr) const { cudaFreeHost(ptr); }
+
 std::unique_ptr<cudf::io::datasource::buffer> kafka_consumer::host_read(size_t offset, size_t size)
 {
-  if (offset > buffer.size()) { return 0; }
-  size = std::min(size, buffer.size() - offset);
-  return std::make_unique<non_owning_buffer>((uint8_t *)buffer.data() + offset, size);
+  if (offset > buffer_size) { return 0; }
+  size = std::min(size, buffer_size - offset);
+  return std::make_unique<non_owning_buffer>(buffer.get() + offset, size);
 }
 
 size_t kafka_consumer::host_read(size_t offset, size_t size, uint8_t *dst)
 {
-  if (offset > buffer.size()) { return 0; }
-  auto const read_size = std::min(size, buffer.size() - offset);
-  memcpy(dst, buffer.data() + offset, size);
+  if (offset > buffer_size) { return 0; }
+  auto const read_size = std::min(size, buffer_size - offset);
+  memcpy(dst, buffer.get() + offset, read_size);
   return read_size;
 }
 
-size_t kafka_consumer::size() const { return buffer.size(); }
+std::unique_ptr<cudf::io::datasource::buffer> kafka_consumer::device_read(size_t offset,
+                                                                          size_t size)
+{
+  if (offset > buffer_size) { return 0; }
+  rmm::device_buffer out_data(std::min(size, buffer_size - offset));
+  device_read(offset, out_data.size(), static_cast<uint8_t *>(out_data.data()));
+  return std::make_unique<device_buffer_wrapper>(std::move(out_data));
+}
 
-/**
- * Change the TOPPAR assignment for this consumer instance
- **/
-RdKafka::ErrorCode kafka_consumer::update_consumer_topic_partition_assignment(
-  std::string const &topic, int partition, int64_t offset)
+size_t kafka_consumer::device_read(size_t offset, size_t size, uint8_t *dst)
 {
-  std::vector<RdKafka::TopicPartition *> topic_partitions;
-  topic_partitions.push_back(RdKafka::TopicPartition::create(topic, partition, offset));
-  return consumer.get()->assign(topic_partitions);
+  if (offset > buffer_size) { return 0; }
+  auto const read_size = std::min(size, buffer_size - offset);
+  // The buffer is page-locked, so the copy is a direct DMA transfer
+  CUDA_TRY(cudaMemcpy(dst, buffer.get() + offset, read_size, cudaMemcpyHostToDevice));
+  return read_size;
 }
 
+size_t kafka_consumer::size() const { return buffer_size; }
+
 void kafka_consumer::consume_to_buffer()
 {
-  update_consumer_topic_partition_assignment(topic_name, partition, start_offset);
+  auto const end = std::chrono::steady_clock::now() + std::chrono::milliseconds(batch_timeout);
 
-  int64_t messages_read = 0;
-  auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(batch_timeout);
+  std::vector<std::unique_ptr<RdKafka::KafkaConsumer>> consumers;
+  std::vector<RdKafka::KafkaConsumer *> consumer_ptrs;
+  for (auto partition : partitions) {
+    consumers.push_back(make_consumer(kafka_conf.get(), topic_name, partition, start_offset));
+    consumer_ptrs.push_back(consumers.back().get());
+  }
+  // The payloads stay in the messages until they are copied once into the pinned buffer
+  auto const messages = consume_partitions(consumer_ptrs, end_offset - start_offset, end);
+  for (auto &consumer : consumers) { consumer->close(); }
 
-  while (messages_read < end_offset - start_offset && end > std::chrono::steady_clock::now()) {
-    std::unique_ptr<RdKafka::Message> msg{
-      consumer->consume((end - std::chrono::steady_clock::now()).count())};
+  fill_buffer(messages);
+}
 
-    if (msg->err() == RdKafka::ErrorCode::ERR_NO_ERROR) {
-      buffer.append(static_cast<char *>(msg->payload()));
-      buffer.append(delimiter);
-      messages_read++;
+void kafka_consumer::fill_buffer(partition_messages const &messages)
+{
+  offsets.clear();
+  buffer_size = 0;
+  for (auto const &partition : messages) {
+    for (auto const &msg : partition) {
+      offsets.push_back(buffer_size);
+      buffer_size += msg->len() + delimiter.size();
     }
   }
+  offsets.push_back(buffer_size);
+  if (buffer_size == 0) { return; }
+
+  uint8_t *pinned = nullptr;
+  CUDA_TRY(cudaMallocHost(&pinned, buffer_size));
+  buffer.reset(pinned);
+
+  // Each thread copies the messages of a partition
+  std::vector<std::thread> threads;
+  for (size_t p = 0, first_message = 0; p < messages.size(); ++p) {
+    threads.emplace_back([&, p, first_message] {
+      for (size_t m = 0; m < messages[p].size(); ++m) {
+        auto const &msg = messages[p][m];
+        auto dst        = buffer.get() + offsets[first_message + m];
+        memcpy(dst, msg->payload(), msg->len());
+        memcpy(dst + msg->len(), delimiter.data(), delimiter.size());
+      }
+    });
+    first_message += messages[p].size();
+  }
+  for (auto &thread : threads) { thread.join(); }
+}
+
+kafka_batch_consumer::kafka_batch_consumer(std::map<std::string, std::string> configs,
+                                           std::string topic_name,
+                                           std::vector<int> partitions,
+                                           int64_t start_offset,
+                                           int64_t batch_size,
+                                           int batch_timeout,
+                                           std::string delimiter)
+  : topic_name(topic_name),
+    partitions(partitions),
+    batch_size(batch_size),
+    batch_timeout(batch_timeout),
+    delimiter(delimiter),
+    offsets(partitions.size(), start_offset)
+{
+  CUDF_EXPECTS(!partitions.empty(), "No Kafka partition to consume from");
+  CUDF_EXPECTS(batch_size > 0, "Kafka batch size must be positive");
+  kafka_conf = make_conf(configs);
+  for (auto partition : partitions) {
+    consumers.push_back(make_consumer(kafka_conf.get(), topic_name, partition, start_offset));
+  }
+  prefetched_batch = std::async(std::launch::async, [this] { return consume_batch(); });
+}
+
+kafka_batch_consumer::~kafka_batch_consumer()
+{
+  if (prefetched_batch.valid()) { prefetched_batch.wait(); }
+  for (auto &consumer : consumers) { consumer->close(); }
+}
+
+std::unique_ptr<kafka_consumer> kafka_batch_consumer::next_batch()
+{
+  auto const messages = prefetched_batch.get();
+  for (size_t p = 0; p < messages.size(); ++p) {
+    if (!messages[p].empty()) { offsets[p] = messages[p].back()->offset() + 1; }
+  }
+  prefetched_batch = std::async(std::launch::async, [this] { return consume_batch(); });
+  return std::unique_ptr<kafka_consumer>(new kafka_consumer(messages, delimiter));
+}
+
+void kafka_batch_consumer::commit()
+{
+  for (size_t p = 0; p < consumers.size(); ++p) {
+    std::unique_ptr<RdKafka::TopicPartition> topic_partition{
+      RdKafka::TopicPartition::create(topic_name, partitions[p], offsets[p])};
+    std::vector<RdKafka::TopicPartition *> topic_partitions{topic_partition.get()};
+    CUDF_EXPECTS(consumers[p]->commitSync(topic_partitions) == RdKafka::ErrorCode::ERR_NO_ERROR,
+                 "Cannot commit Kafka offsets");
+  }
+}
+
+partition_messages kafka_batch_consumer::consume_batch()
+{
+  auto const end = std::chrono::steady_clock::now() + std::chrono::milliseconds(batch_timeout);
+  std::vector<RdKafka::KafkaConsumer *> consumer_ptrs;
+  for (auto &consumer : consumers) { consumer_ptrs.push_back(consumer.get()); }
+  return consume_partitions(consumer_ptrs, batch_size, end);
 }
 
 }  // namespace kafka
@@ -54,3 +54,47 @@ TEST_F(KafkaDatasourceTest, InvalidConfigValues)
   EXPECT_THROW(kafka::kafka_consumer kc(kafka_configs, "csv-topic", 0, 0, 3, 5000, "\n"),
                cudf::logic_error);
 }
+
+TEST_F(KafkaDatasourceTest, MultiplePartitions)
+{
+  std::map<std::string, std::string> kafka_configs;
+  kafka_configs.insert({"bootstrap.servers", "localhost:9092"});
+
+  // group.id is required as well with several partitions
+  EXPECT_THROW(kafka::kafka_consumer kc(kafka_configs, "csv-topic", {0, 1}, 0, 3, 5000, "\n"),
+               cudf::logic_error);
+  EXPECT_THROW(
+    kafka::kafka_consumer kc(kafka_configs, "csv-topic", std::vector<int>{}, 0, 3, 5000, "\n"),
+    cudf::logic_error);
+}
+
+TEST_F(KafkaDatasourceTest, BatchConsumer)
+{
+  std::map<std::string, std::string> kafka_configs;
+  kafka_configs.insert({"bootstrap.servers", "localhost:9092"});
+
+  EXPECT_THROW(
+    kafka::kafka_batch_consumer kbc(kafka_configs, "csv-topic", {0, 1}, 0, 3, 5000, "\n"),
+    cudf::logic_error);
+
+  // batches hold at least a message
+  kafka_configs.insert({"group.id", "batch-group"});
+  EXPECT_THROW(kafka::kafka_batch_consumer kbc(kafka_configs, "csv-topic", {0}, 0, 0, 5000, "\n"),
+               cudf::logic_error);
+
+  // Without a broker every batch times out with no message
+  kafka::kafka_batch_consumer kbc(kafka_configs, "csv-topic", {0, 1}, 0, 3, 100, "\n");
+  EXPECT_EQ(kbc.next_batch()->size(), 0u);
+  EXPECT_EQ(kbc.next_batch()->size(), 0u);
+}
+
+TEST_F(KafkaDatasourceTest, ConstructsWithGroupID)
+{
+  std::map<std::string, std::string> kafka_configs;
+  kafka_configs.insert({"bootstrap.servers", "localhost:9092"});
+  kafka_configs.insert({"group.id", "csv-group"});
+
+  // Without a broker the consumption times out with no message
+  kafka::kafka_consumer kc(kafka_configs, "csv-topic", {0, 1}, 0, 3, 100, "\n");
+  EXPECT_EQ(kc.size(), 0u);
+}
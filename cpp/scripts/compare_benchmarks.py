@@ -0,0 +1,169 @@
+# Copyright (c) 2020, NVIDIA CORPORATION.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+"""Compares two sets of Google Benchmark JSON results.
+
+Each set is a JSON file or a directory of JSON files, e.g. the
+`gbenchmarks/results` directory written by the `run_benchmarks_cudf` target.
+Benchmarks are matched by name across the sets. A benchmark is a regression
+when its time grew by more than the threshold and the difference between the
+repetitions of both sets is statistically significant (two-sided
+Mann-Whitney U test). The script exits with 1 when there are regressions.
+"""
+
+from __future__ import print_function
+
+import argparse
+import glob
+import json
+import math
+import os
+import sys
+
+TIME_UNITS = {"ns": 1e-9, "us": 1e-6, "ms": 1e-3, "s": 1.0}
+
+
+def parse_args():
+    argparser = argparse.ArgumentParser(
+        "Compares two sets of Google Benchmark JSON results"
+    )
+    argparser.add_argument(
+        "baseline", type=str, help="JSON file or directory of the baseline"
+    )
+    argparser.add_argument(
+        "contender", type=str, help="JSON file or directory to compare"
+    )
+    argparser.add_argument(
+        "-threshold",
+        type=float,
+        default=0.05,
+        help="Relative change of the mean time below which a difference is"
+        " ignored",
+    )
+    argparser.add_argument(
+        "-alpha",
+        type=float,
+        default=0.05,
+        help="Significance level of the Mann-Whitney U test",
+    )
+    argparser.add_argument(
+        "-filter",
+        type=str,
+        default="",
+        help="Only compare the benchmarks whose name contains this string",
+    )
+    return argparser.parse_args()
+
+
+def result_files(path):
+    if os.path.isdir(path):
+        return sorted(glob.glob(os.path.join(path, "*.json")))
+    return [path]
+
+
+def load_times(path):
+    """Returns the times in seconds of the repetitions of each benchmark."""
+    times = {}
+    for filename in result_files(path):
+        with open(filename) as f:
+            results = json.load(f)
+        for bench in results.get("benchmarks", []):
+            # skip the mean, median and stddev of the repetitions
+            if bench.get("run_type") == "aggregate" or "aggregate_name" in bench:
+                continue
+            if "error_occurred" in bench:
+                continue
+            name = bench.get("run_name", bench["name"])
+            unit = TIME_UNITS[bench.get("time_unit", "ns")]
+            times.setdefault(name, []).append(bench["real_time"] * unit)
+    return times
+
+
+def mann_whitney_p_value(a, b):
+    """Two-sided p-value of the Mann-Whitney U test, normal approximation
+    with a tie correction."""
+    n1, n2 = len(a), len(b)
+    if n1 < 2 or n2 < 2:
+        return 1.0
+    values = sorted([(v, 0) for v in a] + [(v, 1) for v in b])
+    ranks = [0.0] * len(values)
+    ties = 0.0
+    i = 0
+    while i < len(values):
+        j = i
+        while j + 1 < len(values) and values[j + 1][0] == values[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2.0 + 1
+        t = j - i + 1
+        ties += t ** 3 - t
+        i = j + 1
+    rank_sum = sum(r for r, (_, s) in zip(ranks, values) if s == 0)
+    u = rank_sum - n1 * (n1 + 1) / 2.0
+    n = n1 + n2
+    variance = n1 * n2 / 12.0 * ((n + 1) - ties / (n * (n - 1)))
+    if variance <= 0:
+        return 1.0
+    z = (abs(u - n1 * n2 / 2.0) - 0.5) / math.sqrt(variance)
+    return min(1.0, math.erfc(max(z, 0.0) / math.sqrt(2)))
+
+
+def mean(values):
+    return sum(values) / len(values)
+
+
+def main():
+    args = parse_args()
+    baseline = load_times(args.baseline)
+    contender = load_times(args.contender)
+    names = sorted(
+        name for name in baseline if name in contender and args.filter in name
+    )
+    if not names:
+        print("No benchmark found in both result sets")
+        return 1
+
+    regressions = 0
+    print(
+        "%-70s %12s %12s %9s %8s"
+        % ("Benchmark", "Baseline", "Contender", "Change", "p-value")
+    )
+    for name in names:
+        old, new = mean(baseline[name]), mean(contender[name])
+        change = (new - old) / old if old > 0 else 0.0
+        p_value = mann_whitney_p_value(baseline[name], contender[name])
+        verdict = ""
+        if abs(change) > args.threshold and p_value < args.alpha:
+            verdict = "REGRESSION" if change > 0 else "improvement"
+            regressions += change > 0
+        line = "%-70s %10.3fms %10.3fms %+8.1f%% %8.4f  %s" % (
+            name,
+            old * 1e3,
+            new * 1e3,
+            change * 100,
+            p_value,
+            verdict,
+        )
+        print(line.rstrip())
+    for name in sorted(set(baseline) - set(contender)):
+        if args.filter in name:
+            print("%-70s missing from the contender" % name)
+
+    print("%d regression(s) in %d benchmark(s)" % (regressions, len(names)))
+    return 1 if regressions > 0 else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
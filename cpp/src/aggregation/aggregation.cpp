@@ -105,6 +105,13 @@ std::unique_ptr<aggregation> make_nunique_aggregation(null_policy null_handling)
 {
   return std::make_unique<detail::nunique_aggregation>(aggregation::NUNIQUE, null_handling);
 }
+/// Factory to create a APPROX_NUNIQUE aggregation
+std::unique_ptr<aggregation> make_approx_nunique_aggregation(int precision,
+                                                             null_policy null_handling)
+{
+  return std::make_unique<detail::approx_nunique_aggregation>(
+    aggregation::APPROX_NUNIQUE, precision, null_handling);
+}
 /// Factory to create a NTH_ELEMENT aggregation
 std::unique_ptr<aggregation> make_nth_element_aggregation(size_type n, null_policy null_handling)
 {
@@ -116,6 +123,36 @@ std::unique_ptr<aggregation> make_row_number_aggregation()
 {
   return std::make_unique<aggregation>(aggregation::ROW_NUMBER);
 }
+/// Factory to create a LEAD aggregation
+std::unique_ptr<aggregation> make_lead_aggregation(size_type offset)
+{
+  return std::make_unique<detail::lead_lag_aggregation>(aggregation::LEAD, offset);
+}
+/// Factory to create a LAG aggregation
+std::unique_ptr<aggregation> make_lag_aggregation(size_type offset)
+{
+  return std::make_unique<detail::lead_lag_aggregation>(aggregation::LAG, offset);
+}
+/// Factory to create a RANK aggregation
+std::unique_ptr<aggregation> make_rank_aggregation()
+{
+  return std::make_unique<aggregation>(aggregation::RANK);
+}
+/// Factory to create a DENSE_RANK aggregation
+std::unique_ptr<aggregation> make_dense_rank_aggregation()
+{
+  return std::make_unique<aggregation>(aggregation::DENSE_RANK);
+}
+/// Factory to create a COLLECT_LIST aggregation
+std::unique_ptr<aggregation> make_collect_list_aggregation(null_policy null_handling)
+{
+  return std::make_unique<detail::collect_aggregation>(aggregation::COLLECT_LIST, null_handling);
+}
+/// Factory to create a COLLECT_SET aggregation
+std::unique_ptr<aggregation> make_collect_set_aggregation(null_policy null_handling)
+{
+  return std::make_unique<detail::collect_aggregation>(aggregation::COLLECT_SET, null_handling);
+}
 /// Factory to create a UDF aggregation
 std::unique_ptr<aggregation> make_udf_aggregation(udf_type type,
                                                   std::string const& user_defined_aggregator,
@@ -20,6 +20,9 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/binaryop.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/dictionary/detail/search.hpp>
+#include <cudf/dictionary/detail/update_keys.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/table/table_view.hpp>
@@ -63,6 +66,109 @@ rmm::device_buffer scalar_col_valid_mask_and(column_view const& col,
     return rmm::device_buffer{0, stream, mr};
   }
 }
+
+/**
+ * @brief Returns whether the operator is one of the six comparison operators
+ */
+bool is_comparison(binary_operator op)
+{
+  return op == binary_operator::EQUAL || op == binary_operator::NOT_EQUAL ||
+         op == binary_operator::LESS || op == binary_operator::GREATER ||
+         op == binary_operator::LESS_EQUAL || op == binary_operator::GREATER_EQUAL;
+}
+
+/**
+ * @brief Returns the comparison `op` with its operands swapped, such that `s op x` is `x op' s`
+ */
+binary_operator swap_operands(binary_operator op)
+{
+  switch (op) {
+    case binary_operator::LESS: return binary_operator::GREATER;
+    case binary_operator::GREATER: return binary_operator::LESS;
+    case binary_operator::LESS_EQUAL: return binary_operator::GREATER_EQUAL;
+    case binary_operator::GREATER_EQUAL: return binary_operator::LESS_EQUAL;
+    default: return op;
+  }
+}
+
+/**
+ * @brief Compares the rows of a dictionary column with a scalar of its keys type
+ *
+ * The keys are sorted, so the scalar is located once in the keys and each row is compared
+ * through its index instead of its key: e.g. `x < s` when the index of `x` is less than the
+ * insert index of `s` in the keys. The indices are compared with the precompiled INT32 kernels.
+ */
+std::unique_ptr<column> dictionary_scalar_compare(column_view const& lhs,
+                                                  scalar const& rhs,
+                                                  binary_operator op,
+                                                  data_type output_type,
+                                                  rmm::mr::device_memory_resource* mr,
+                                                  cudaStream_t stream)
+{
+  CUDF_EXPECTS(is_comparison(op), "Only comparison operators are supported for dictionaries");
+  dictionary_column_view const dictionary(lhs);
+  if (dictionary.size() == 0) { return make_empty_column(output_type); }
+
+  // the keys before the insert index are less than the scalar
+  auto const lower = dictionary::detail::get_insert_index(
+    dictionary, rhs, rmm::mr::get_default_resource(), stream);
+  auto const found =
+    dictionary::detail::get_index(dictionary, rhs, rmm::mr::get_default_resource(), stream);
+
+  auto const lower_index = lower->value(stream);
+  auto const upper_index = found->is_valid(stream) ? lower_index + 1 : lower_index;
+  auto const equal_index = found->is_valid(stream) ? lower_index : -1;  // -1 matches no row
+
+  int32_t index       = lower_index;
+  binary_operator iop = op;
+  switch (op) {
+    case binary_operator::EQUAL:
+    case binary_operator::NOT_EQUAL: index = equal_index; break;
+    case binary_operator::LESS_EQUAL:
+      index = upper_index;
+      iop   = binary_operator::LESS;
+      break;
+    case binary_operator::GREATER:
+      index = upper_index;
+      iop   = binary_operator::GREATER_EQUAL;
+      break;
+    default: break;
+  }
+  numeric_scalar<int32_t> const index_scalar(index, rhs.is_valid(stream), stream);
+  return cudf::detail::binary_operation(
+    dictionary.get_indices_annotated(), index_scalar, iop, output_type, mr, stream);
+}
+
+/**
+ * @brief Compares the rows of two dictionary columns through their indices
+ *
+ * The columns are first re-encoded with the union of their keys unless they already share
+ * the same keys, so that the order of the indices is the order of the values.
+ */
+std::unique_ptr<column> dictionary_compare(column_view const& lhs,
+                                           column_view const& rhs,
+                                           binary_operator op,
+                                           data_type output_type,
+                                           rmm::mr::device_memory_resource* mr,
+                                           cudaStream_t stream)
+{
+  CUDF_EXPECTS(is_comparison(op), "Only comparison operators are supported for dictionaries");
+  CUDF_EXPECTS(rhs.type().id() == type_id::DICTIONARY32,
+               "A dictionary column can only be compared with another dictionary column");
+  if (lhs.size() == 0) { return make_empty_column(output_type); }
+
+  auto const matched = dictionary::detail::match_dictionaries(
+    {dictionary_column_view(lhs), dictionary_column_view(rhs)},
+    rmm::mr::get_default_resource(),
+    stream);
+  return cudf::detail::binary_operation(
+    dictionary_column_view(matched.second[0]).get_indices_annotated(),
+    dictionary_column_view(matched.second[1]).get_indices_annotated(),
+    op,
+    output_type,
+    mr,
+    stream);
+}
 }  // namespace detail
 
 namespace jit {
@@ -247,6 +353,10 @@ std::unique_ptr<column> binary_operation(scalar const& lhs,
                                          rmm::mr::device_memory_resource* mr,
                                          cudaStream_t stream)
 {
+  if (rhs.type().id() == type_id::DICTIONARY32) {
+    return binops::detail::dictionary_scalar_compare(
+      rhs, lhs, binops::detail::swap_operands(op), output_type, mr, stream);
+  }
   if ((lhs.type().id() == type_id::STRING) && (rhs.type().id() == type_id::STRING)) {
     return binops::compiled::binary_operation(lhs, rhs, op, output_type, mr, stream);
   }
@@ -269,7 +379,11 @@ std::unique_ptr<column> binary_operation(scalar const& lhs,
   if (rhs.size() == 0) { return out; }
 
   auto out_view = out->mutable_view();
-  binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
+  if (binops::compiled::is_supported_operation(output_type, lhs.type(), rhs.type(), op)) {
+    binops::compiled::binary_operation(out_view, lhs, rhs, op, stream);
+  } else {
+    binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
+  }
   return out;
 }
 
@@ -280,6 +394,9 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          rmm::mr::device_memory_resource* mr,
                                          cudaStream_t stream)
 {
+  if (lhs.type().id() == type_id::DICTIONARY32) {
+    return binops::detail::dictionary_scalar_compare(lhs, rhs, op, output_type, mr, stream);
+  }
   if ((lhs.type().id() == type_id::STRING) && (rhs.type().id() == type_id::STRING)) {
     return binops::compiled::binary_operation(lhs, rhs, op, output_type, mr, stream);
   }
@@ -302,7 +419,11 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   if (lhs.size() == 0) { return out; }
 
   auto out_view = out->mutable_view();
-  binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
+  if (binops::compiled::is_supported_operation(output_type, lhs.type(), rhs.type(), op)) {
+    binops::compiled::binary_operation(out_view, lhs, rhs, op, stream);
+  } else {
+    binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
+  }
   return out;
 }
 
@@ -315,6 +436,9 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
 {
   CUDF_EXPECTS((lhs.size() == rhs.size()), "Column sizes don't match");
 
+  if (lhs.type().id() == type_id::DICTIONARY32) {
+    return binops::detail::dictionary_compare(lhs, rhs, op, output_type, mr, stream);
+  }
   if ((lhs.type().id() == type_id::STRING) && (rhs.type().id() == type_id::STRING)) {
     return binops::compiled::binary_operation(lhs, rhs, op, output_type, mr, stream);
   }
@@ -338,7 +462,11 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   if (lhs.size() == 0 || rhs.size() == 0) { return out; }
 
   auto out_view = out->mutable_view();
-  binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
+  if (binops::compiled::is_supported_operation(output_type, lhs.type(), rhs.type(), op)) {
+    binops::compiled::binary_operation(out_view, lhs, rhs, op, stream);
+  } else {
+    binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
+  }
   return out;
 }
 
@@ -121,6 +121,77 @@ std::unique_ptr<column> binary_operation(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @brief Indicates whether a binary operation between fixed-width operands has a precompiled
+ * kernel, so that it does not need to be JIT compiled.
+ *
+ * Precompiled kernels cover operands of the same numeric type (other than BOOL8) with the
+ * arithmetic operators `ADD`, `SUB`, `MUL`, `DIV`, `TRUE_DIV`, `FLOOR_DIV`, `MOD` and `PYMOD`
+ * producing that same type, and the comparison operators producing BOOL8.
+ *
+ * @param out         The data type of the output column
+ * @param lhs         The data type of the left operand
+ * @param rhs         The data type of the right operand
+ * @param op          The binary operator
+ * @return true if `binary_operation` into a mutable_column_view supports the operation
+ */
+bool is_supported_operation(data_type out, data_type lhs, data_type rhs, binary_operator op);
+
+/**
+ * @brief Computes op(lhs, rhs[i]) into the preallocated `out` column with a precompiled kernel.
+ *
+ * The null mask of `out` is left unchanged. The operation must satisfy
+ * `is_supported_operation()`.
+ *
+ * @param out         Output column, with the same size as @p rhs
+ * @param lhs         The left operand scalar
+ * @param rhs         The right operand column
+ * @param op          The binary operator
+ * @param stream      CUDA stream used for kernel launches
+ */
+void binary_operation(mutable_column_view& out,
+                      scalar const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      cudaStream_t stream = 0);
+
+/**
+ * @brief Computes op(lhs[i], rhs) into the preallocated `out` column with a precompiled kernel.
+ *
+ * The null mask of `out` is left unchanged. The operation must satisfy
+ * `is_supported_operation()`.
+ *
+ * @param out         Output column, with the same size as @p lhs
+ * @param lhs         The left operand column
+ * @param rhs         The right operand scalar
+ * @param op          The binary operator
+ * @param stream      CUDA stream used for kernel launches
+ */
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      scalar const& rhs,
+                      binary_operator op,
+                      cudaStream_t stream = 0);
+
+/**
+ * @brief Computes op(lhs[i], rhs[i]) into the preallocated `out` column with a precompiled
+ * kernel.
+ *
+ * The null mask of `out` is left unchanged. The operation must satisfy
+ * `is_supported_operation()`.
+ *
+ * @param out         Output column, with the same size as @p lhs and @p rhs
+ * @param lhs         The left operand column
+ * @param rhs         The right operand column
+ * @param op          The binary operator
+ * @param stream      CUDA stream used for kernel launches
+ */
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      cudaStream_t stream = 0);
+
 }  // namespace compiled
 }  // namespace binops
 }  // namespace cudf
@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <cmath>
+
+#include "binary_ops.hpp"
+
+namespace cudf {
+namespace binops {
+namespace compiled {
+
+namespace {
+
+/**
+ * @brief Operand types with precompiled arithmetic and comparison kernels.
+ */
+template <typename T>
+constexpr bool is_supported_operand()
+{
+  return is_numeric<T>() && !std::is_same<T, bool>::value;
+}
+
+struct is_supported_operand_impl {
+  template <typename T>
+  bool operator()()
+  {
+    return is_supported_operand<T>();
+  }
+};
+
+bool is_comparison(binary_operator op)
+{
+  switch (op) {
+    case binary_operator::EQUAL:
+    case binary_operator::NOT_EQUAL:
+    case binary_operator::LESS:
+    case binary_operator::GREATER:
+    case binary_operator::LESS_EQUAL:
+    case binary_operator::GREATER_EQUAL: return true;
+    default: return false;
+  }
+}
+
+bool is_arithmetic(binary_operator op)
+{
+  switch (op) {
+    case binary_operator::ADD:
+    case binary_operator::SUB:
+    case binary_operator::MUL:
+    case binary_operator::DIV:
+    case binary_operator::TRUE_DIV:
+    case binary_operator::FLOOR_DIV:
+    case binary_operator::MOD:
+    case binary_operator::PYMOD: return true;
+    default: return false;
+  }
+}
+
+// The operators below reproduce the JIT operators of `binaryop/jit/code/operation.cpp` for
+// operands and output of the same type, so that both paths give identical results.
+
+template <typename T, std::enable_if_t<std::is_integral<T>::value>* = nullptr>
+CUDA_DEVICE_CALLABLE T modulo(T x, T y)
+{
+  return static_cast<T>(x % y);
+}
+
+template <typename T, std::enable_if_t<std::is_same<T, float>::value>* = nullptr>
+CUDA_DEVICE_CALLABLE T modulo(T x, T y)
+{
+  return fmodf(x, y);
+}
+
+template <typename T, std::enable_if_t<std::is_same<T, double>::value>* = nullptr>
+CUDA_DEVICE_CALLABLE T modulo(T x, T y)
+{
+  return fmod(x, y);
+}
+
+template <typename T, std::enable_if_t<std::is_integral<T>::value>* = nullptr>
+CUDA_DEVICE_CALLABLE T python_modulo(T x, T y)
+{
+  return static_cast<T>(((x % y) + y) % y);
+}
+
+template <typename T, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+CUDA_DEVICE_CALLABLE T python_modulo(T x, T y)
+{
+  double x1 = static_cast<double>(x);
+  double y1 = static_cast<double>(y);
+  return static_cast<T>(fmod(fmod(x1, y1) + y1, y1));
+}
+
+template <typename T>
+struct apply_arithmetic {
+  binary_operator op;
+  CUDA_DEVICE_CALLABLE T operator()(T x, T y) const
+  {
+    switch (op) {
+      case binary_operator::ADD: return static_cast<T>(x + y);
+      case binary_operator::SUB: return static_cast<T>(x - y);
+      case binary_operator::MUL: return static_cast<T>(x * y);
+      case binary_operator::DIV: return static_cast<T>(x / y);
+      case binary_operator::TRUE_DIV:
+        return static_cast<T>(static_cast<double>(x) / static_cast<double>(y));
+      case binary_operator::FLOOR_DIV:
+        return static_cast<T>(floor(static_cast<double>(x) / static_cast<double>(y)));
+      case binary_operator::MOD: return modulo(x, y);
+      case binary_operator::PYMOD: return python_modulo(x, y);
+      default: return T{};
+    }
+  }
+};
+
+template <typename T>
+struct apply_comparison {
+  binary_operator op;
+  CUDA_DEVICE_CALLABLE bool operator()(T x, T y) const
+  {
+    switch (op) {
+      case binary_operator::EQUAL: return x == y;
+      case binary_operator::NOT_EQUAL: return x != y;
+      case binary_operator::LESS: return x < y;
+      case binary_operator::GREATER: return x > y;
+      case binary_operator::LESS_EQUAL: return x <= y;
+      case binary_operator::GREATER_EQUAL: return x >= y;
+      default: return false;
+    }
+  }
+};
+
+/**
+ * @brief Operand reading the elements of a column.
+ *
+ * Null elements are read as they are; the null mask of the output is computed by the caller.
+ */
+template <typename T>
+struct column_operand {
+  T const* data;
+  CUDA_DEVICE_CALLABLE T operator[](size_type i) const { return data[i]; }
+};
+
+/**
+ * @brief Operand reading the device value of a scalar for every row.
+ */
+template <typename T>
+struct scalar_operand {
+  T const* value;
+  CUDA_DEVICE_CALLABLE T operator[](size_type) const { return *value; }
+};
+
+template <typename T>
+column_operand<T> make_operand(column_view const& input)
+{
+  return column_operand<T>{input.data<T>()};
+}
+
+template <typename T>
+scalar_operand<T> make_operand(scalar const& input)
+{
+  return scalar_operand<T>{static_cast<scalar_type_t<T> const&>(input).data()};
+}
+
+template <typename LhsOperand, typename RhsOperand, typename Operator>
+struct binop_element_fn {
+  LhsOperand lhs;
+  RhsOperand rhs;
+  Operator op;
+  CUDA_DEVICE_CALLABLE auto operator()(size_type i) const { return op(lhs[i], rhs[i]); }
+};
+
+template <typename Out, typename LhsOperand, typename RhsOperand, typename Operator>
+void transform_operands(
+  mutable_column_view& out, LhsOperand lhs, RhsOperand rhs, Operator op, cudaStream_t stream)
+{
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(out.size()),
+                    out.begin<Out>(),
+                    binop_element_fn<LhsOperand, RhsOperand, Operator>{lhs, rhs, op});
+}
+
+struct dispatch_numeric_binop {
+  template <typename T,
+            typename Lhs,
+            typename Rhs,
+            std::enable_if_t<is_supported_operand<T>()>* = nullptr>
+  void operator()(mutable_column_view& out,
+                  Lhs const& lhs,
+                  Rhs const& rhs,
+                  binary_operator op,
+                  cudaStream_t stream)
+  {
+    if (is_comparison(op)) {
+      transform_operands<bool>(
+        out, make_operand<T>(lhs), make_operand<T>(rhs), apply_comparison<T>{op}, stream);
+    } else {
+      transform_operands<T>(
+        out, make_operand<T>(lhs), make_operand<T>(rhs), apply_arithmetic<T>{op}, stream);
+    }
+  }
+
+  template <typename T,
+            typename Lhs,
+            typename Rhs,
+            std::enable_if_t<!is_supported_operand<T>()>* = nullptr>
+  void operator()(mutable_column_view&, Lhs const&, Rhs const&, binary_operator, cudaStream_t)
+  {
+    CUDF_FAIL("Invalid/Unsupported operand datatype for a compiled binary operation");
+  }
+};
+
+template <typename Lhs, typename Rhs>
+void numeric_binary_operation(mutable_column_view& out,
+                              Lhs const& lhs,
+                              Rhs const& rhs,
+                              binary_operator op,
+                              cudaStream_t stream)
+{
+  CUDF_EXPECTS(is_supported_operation(out.type(), lhs.type(), rhs.type(), op),
+               "Invalid/Unsupported operation for a compiled binary operation");
+  if (out.size() == 0) { return; }
+  type_dispatcher(lhs.type(), dispatch_numeric_binop{}, out, lhs, rhs, op, stream);
+  CHECK_CUDA(stream);
+}
+
+}  // namespace
+
+bool is_supported_operation(data_type out, data_type lhs, data_type rhs, binary_operator op)
+{
+  if (!(lhs == rhs) || !type_dispatcher(lhs, is_supported_operand_impl{})) { return false; }
+  if (is_comparison(op)) { return out.id() == type_id::BOOL8; }
+  return is_arithmetic(op) && out == lhs;
+}
+
+void binary_operation(mutable_column_view& out,
+                      scalar const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      cudaStream_t stream)
+{
+  numeric_binary_operation(out, lhs, rhs, op, stream);
+}
+
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      scalar const& rhs,
+                      binary_operator op,
+                      cudaStream_t stream)
+{
+  numeric_binary_operation(out, lhs, rhs, op, stream);
+}
+
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      cudaStream_t stream)
+{
+  numeric_binary_operation(out, lhs, rhs, op, stream);
+}
+
+}  // namespace compiled
+}  // namespace binops
+}  // namespace cudf
@@ -29,6 +29,7 @@
 #include <thrust/copy.h>
 #include <thrust/device_ptr.h>
 #include <thrust/extrema.h>
+#include <thrust/functional.h>
 #include <cub/cub.cuh>
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_scalar.hpp>
@@ -201,7 +202,7 @@ __global__ void count_set_bits_kernel(bitmask_type const *bitmask,
  * @brief Convenience function to get offset word from a bitmask
  *
  * @see copy_offset_bitmask
- * @see offset_bitmask_and
+ * @see offset_bitmask_binop
  */
 __device__ bitmask_type get_mask_offset_word(bitmask_type const *__restrict__ source,
                                              size_type destination_word_index,
@@ -311,46 +312,59 @@ __global__ void copy_offset_bitmask(bitmask_type *__restrict__ destination,
 }
 
 /**
- * @brief Computes the bitwise AND of an array of bitmasks
+ * @brief Computes a bitwise operation across an array of bitmasks
  *
+ * Each thread combines whole words of the source masks, each word shifted into
+ * place from the source's offset with a funnel shift.
+ *
+ * @param op The binary operator applied to the words of the masks
  * @param destination The bitmask to write result into
  * @param source Array of source mask pointers. All masks must be of same size
  * @param begin_bit Array of offsets into corresponding @p source masks.
  *                  Must be same size as source array
- * @param num_sources Number of masks in @p source array
+ * @param num_sources Number of masks in @p source array. Must be at least 1
  * @param source_size Number of bits in each mask in @p source
  * @param number_of_mask_words The number of words of type bitmask_type to copy
  */
-__global__ void offset_bitmask_and(bitmask_type *__restrict__ destination,
-                                   bitmask_type const *const *__restrict__ source,
-                                   size_type const *__restrict__ begin_bit,
-                                   size_type num_sources,
-                                   size_type source_size,
-                                   size_type number_of_mask_words)
+template <typename Binop>
+__global__ void offset_bitmask_binop(Binop op,
+                                     bitmask_type *__restrict__ destination,
+                                     bitmask_type const *const *__restrict__ source,
+                                     size_type const *__restrict__ begin_bit,
+                                     size_type num_sources,
+                                     size_type source_size,
+                                     size_type number_of_mask_words)
 {
   for (size_type destination_word_index = threadIdx.x + blockIdx.x * blockDim.x;
        destination_word_index < number_of_mask_words;
        destination_word_index += blockDim.x * gridDim.x) {
-    bitmask_type destination_word = ~bitmask_type{0};  // All bits 1
-    for (size_type i = 0; i < num_sources; i++) {
-      destination_word &= get_mask_offset_word(
-        source[i], destination_word_index, begin_bit[i], begin_bit[i] + source_size);
+    bitmask_type destination_word = get_mask_offset_word(
+      source[0], destination_word_index, begin_bit[0], begin_bit[0] + source_size);
+    for (size_type i = 1; i < num_sources; i++) {
+      destination_word = op(destination_word,
+                            get_mask_offset_word(source[i],
+                                                 destination_word_index,
+                                                 begin_bit[i],
+                                                 begin_bit[i] + source_size));
     }
 
     destination[destination_word_index] = destination_word;
   }
 }
 
-// Bitwise AND of the masks
-rmm::device_buffer bitmask_and(std::vector<bitmask_type const *> const &masks,
-                               std::vector<size_type> const &begin_bits,
-                               size_type mask_size,
-                               cudaStream_t stream,
-                               rmm::mr::device_memory_resource *mr)
+// Bitwise operation `op` across the masks
+template <typename Binop>
+rmm::device_buffer bitmask_binop(Binop op,
+                                 std::vector<bitmask_type const *> const &masks,
+                                 std::vector<size_type> const &begin_bits,
+                                 size_type mask_size,
+                                 cudaStream_t stream,
+                                 rmm::mr::device_memory_resource *mr)
 {
   CUDF_EXPECTS(std::all_of(begin_bits.begin(), begin_bits.end(), [](auto b) { return b >= 0; }),
                "Invalid range.");
   CUDF_EXPECTS(mask_size > 0, "Invalid bit range.");
+  CUDF_EXPECTS(not masks.empty(), "At least one mask is required");
   CUDF_EXPECTS(std::all_of(masks.begin(), masks.end(), [](auto p) { return p != nullptr; }),
                "Mask pointer cannot be null");
 
@@ -365,7 +379,8 @@ rmm::device_buffer bitmask_and(std::vector<bitmask_type const *> const &masks,
   rmm::device_vector<size_type> d_begin_bits(begin_bits);
 
   cudf::detail::grid_1d config(number_of_mask_words, 256);
-  offset_bitmask_and<<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
+  offset_bitmask_binop<<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
+    op,
     static_cast<bitmask_type *>(dest_mask.data()),
     d_masks.data().get(),
     d_begin_bits.data().get(),
@@ -378,6 +393,26 @@ rmm::device_buffer bitmask_and(std::vector<bitmask_type const *> const &masks,
   return dest_mask;
 }
 
+// Bitwise AND of the masks
+rmm::device_buffer bitmask_and(std::vector<bitmask_type const *> const &masks,
+                               std::vector<size_type> const &begin_bits,
+                               size_type mask_size,
+                               cudaStream_t stream,
+                               rmm::mr::device_memory_resource *mr)
+{
+  return bitmask_binop(thrust::bit_and<bitmask_type>{}, masks, begin_bits, mask_size, stream, mr);
+}
+
+// Bitwise OR of the masks
+rmm::device_buffer bitmask_or(std::vector<bitmask_type const *> const &masks,
+                              std::vector<size_type> const &begin_bits,
+                              size_type mask_size,
+                              cudaStream_t stream,
+                              rmm::mr::device_memory_resource *mr)
+{
+  return bitmask_binop(thrust::bit_or<bitmask_type>{}, masks, begin_bits, mask_size, stream, mr);
+}
+
 // convert [first_bit_index,last_bit_index) to
 // [first_word_index,last_word_index)
 struct to_word_index : public thrust::unary_function<size_type, size_type> {
@@ -410,7 +445,7 @@ namespace detail {
 cudf::size_type count_set_bits(bitmask_type const *bitmask,
                                size_type start,
                                size_type stop,
-                               cudaStream_t stream = 0)
+                               cudaStream_t stream)
 {
   if (nullptr == bitmask) { return 0; }
 
@@ -667,4 +702,28 @@ rmm::device_buffer bitmask_and(table_view const &view,
   return null_mask;
 }
 
+// Returns the bitwise OR of the null masks of all columns in the table view
+rmm::device_buffer bitmask_or(table_view const &view,
+                              rmm::mr::device_memory_resource *mr,
+                              cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  rmm::device_buffer null_mask{0, stream, mr};
+  if (view.num_rows() == 0 or view.num_columns() == 0) { return null_mask; }
+
+  // a column without a null mask is all valid, and so is the OR
+  if (std::any_of(view.begin(), view.end(), [](auto const &col) { return not col.nullable(); })) {
+    return null_mask;
+  }
+
+  std::vector<bitmask_type const *> masks;
+  std::vector<size_type> offsets;
+  for (auto &&col : view) {
+    masks.push_back(col.null_mask());
+    offsets.push_back(col.offset());
+  }
+
+  return bitmask_or(masks, offsets, view.num_rows(), stream, mr);
+}
+
 }  // namespace cudf
@@ -19,7 +19,10 @@
 #include <cudf/copying.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reduction_functions.hpp>
+#include <cudf/detail/stream_compaction.hpp>
 #include <cudf/null_mask.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/copying.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/traits.hpp>
@@ -38,7 +41,8 @@ column::column(column const &other)
     _size{other._size},
     _data{other._data},
     _null_mask{other._null_mask},
-    _null_count{other._null_count}
+    _null_count{other._null_count},
+    _statistics{other._statistics}
 {
   _children.reserve(other.num_children());
   for (auto const &c : other._children) { _children.emplace_back(std::make_unique<column>(*c)); }
@@ -50,7 +54,8 @@ column::column(column const &other, cudaStream_t stream, rmm::mr::device_memory_
     _size{other._size},
     _data{other._data, stream, mr},
     _null_mask{other._null_mask, stream, mr},
-    _null_count{other._null_count}
+    _null_count{other._null_count},
+    _statistics{other._statistics}
 {
   _children.reserve(other.num_children());
   for (auto const &c : other._children) {
@@ -65,7 +70,8 @@ column::column(column &&other) noexcept
     _data{std::move(other._data)},
     _null_mask{std::move(other._null_mask)},
     _null_count{other._null_count},
-    _children{std::move(other._children)}
+    _children{std::move(other._children)},
+    _statistics{std::move(other._statistics)}
 {
   other._size       = 0;
   other._null_count = 0;
@@ -78,6 +84,7 @@ column::contents column::release() noexcept
   _size       = 0;
   _null_count = 0;
   _type       = data_type{type_id::EMPTY};
+  _statistics = {};
   return column::contents{std::make_unique<rmm::device_buffer>(std::move(_data)),
                           std::make_unique<rmm::device_buffer>(std::move(_null_mask)),
                           std::move(_children)};
@@ -120,6 +127,7 @@ mutable_column_view column::mutable_view()
   // existing `null_count` is no longer valid. Reset it to `UNKNOWN_NULL_COUNT` forcing it to be
   // recomputed on the next invocation of `null_count()`.
   set_null_count(cudf::UNKNOWN_NULL_COUNT);
+  _statistics = {};
 
   return mutable_column_view{type(),
                              size(),
@@ -150,6 +158,7 @@ void column::set_null_mask(rmm::device_buffer &&new_null_mask, size_type new_nul
   }
   _null_mask  = std::move(new_null_mask);  // move
   _null_count = new_null_count;
+  _statistics = {};
 }
 
 void column::set_null_mask(rmm::device_buffer const &new_null_mask, size_type new_null_count)
@@ -161,6 +170,7 @@ void column::set_null_mask(rmm::device_buffer const &new_null_mask, size_type ne
   }
   _null_mask  = new_null_mask;  // copy
   _null_count = new_null_count;
+  _statistics = {};
 }
 
 void column::set_null_count(size_type new_null_count)
@@ -169,6 +179,28 @@ void column::set_null_count(size_type new_null_count)
   _null_count = new_null_count;
 }
 
+// Compute the unknown statistics of the values and cache them
+column_statistics const &column::compute_statistics(cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  // Nested and dictionary columns have no min/max reductions
+  bool const supported = type().id() == type_id::STRING ||
+                         (is_fixed_width(type()) && type().id() != type_id::DICTIONARY32);
+  if (not supported) { return _statistics; }
+  auto const input = view();
+  if (not _statistics.min) {
+    _statistics.min = reduction::min(input, type(), rmm::mr::get_default_resource(), stream);
+  }
+  if (not _statistics.max) {
+    _statistics.max = reduction::max(input, type(), rmm::mr::get_default_resource(), stream);
+  }
+  if (_statistics.distinct_count < 0) {
+    _statistics.distinct_count =
+      detail::approx_distinct_count(input, 12, null_policy::EXCLUDE, stream);  // default precision
+  }
+  return _statistics;
+}
+
 namespace {
 struct create_column_from_view {
   cudf::column_view view;
@@ -15,9 +15,11 @@
  */
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_view.hpp>
+#include <cudf/detail/utilities/view_descriptors.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 #include <numeric>
+#include <type_traits>
 
 #include <rmm/thrust_rmm_allocator.h>
 
@@ -105,35 +107,25 @@ create_device_view_from_view(ColumnView const& source, cudaStream_t stream)
   auto const descendant_storage_bytes =
     std::accumulate(get_extent, get_extent + num_children, std::size_t{0});
 
-  // A buffer of CPU memory is allocated to hold the ColumnDeviceView
-  // objects. Once filled, the CPU memory is copied to device memory
-  // and then set into the d_children member pointer.
-  std::vector<char> staging_buffer(descendant_storage_bytes);
-
-  // Each ColumnDeviceView instance may have child objects that
-  // require setting some internal device pointers before being copied
-  // from CPU to device.
-  rmm::device_buffer* const descendant_storage =
-    new rmm::device_buffer(descendant_storage_bytes, stream);
-
-  auto deleter = [descendant_storage](ColumnDeviceView* v) {
-    v->destroy();
-    delete descendant_storage;
-  };
-
-  std::unique_ptr<ColumnDeviceView, decltype(deleter)> result{
-    new ColumnDeviceView(source, staging_buffer.data(), descendant_storage->data()), deleter};
-
-  // copy the CPU memory with all the children into device memory
-  CUDA_TRY(cudaMemcpyAsync(descendant_storage->data(),
-                           staging_buffer.data(),
-                           descendant_storage->size(),
-                           cudaMemcpyDefault,
-                           stream));
-
-  CUDA_TRY(cudaStreamSynchronize(stream));
+  auto destroy = [](ColumnDeviceView* v) { v->destroy(); };
+  if (descendant_storage_bytes == 0) {
+    return std::unique_ptr<ColumnDeviceView, std::function<void(ColumnDeviceView*)>>{
+      new ColumnDeviceView(source, nullptr, nullptr), destroy};
+  }
 
-  return result;
+  std::unique_ptr<ColumnDeviceView, decltype(destroy)> result{nullptr, destroy};
+  // Each ColumnDeviceView instance may have child objects that require setting some internal
+  // device pointers, so the children are laid out in host memory for the device address they
+  // are copied to. Views of immutable columns may share the copy with equal views.
+  auto descendant_storage = detail::copy_view_descriptors(
+    descendant_storage_bytes,
+    [&](void* h_ptr, void* d_ptr) { result.reset(new ColumnDeviceView(source, h_ptr, d_ptr)); },
+    std::is_same<ColumnView, column_view>::value,
+    stream);
+
+  // The deleter keeps the children alive for as long as the view
+  return std::unique_ptr<ColumnDeviceView, std::function<void(ColumnDeviceView*)>>{
+    result.release(), [descendant_storage](ColumnDeviceView* v) { v->destroy(); }};
 }
 
 }  // namespace
@@ -0,0 +1,488 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/compressed_column.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/null_mask.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/logical.h>
+#include <thrust/scan.h>
+
+#include <cub/cub.cuh>
+
+namespace cudf {
+namespace detail {
+namespace {
+constexpr size_type values_per_block = compressed_column::values_per_block;
+constexpr int block_size             = 256;
+constexpr int values_per_thread      = values_per_block / block_size;
+constexpr uint64_t sign_bit          = uint64_t{1} << 63;
+
+/**
+ * @brief Encoding of a block of values of a compressed column.
+ *
+ * Values are mapped to unsigned integers of the same order. A frame of reference block packs
+ * `value - reference`. A delta block packs `delta - reference`, where each delta is the
+ * difference from the previous value mapped to an unsigned integer of the same order, and the
+ * first value is `first`. All the arithmetic wraps around.
+ */
+struct block_encoding {
+  uint64_t reference;       // Minimum value or delta
+  uint64_t first;           // First value, for delta blocks
+  std::size_t word_offset;  // Position of the packed values in 32-bit words
+  int32_t bit_width;        // Bits per packed value
+  bool is_delta;            // Whether deltas are packed
+};
+
+template <typename T>
+constexpr bool is_compressible()
+{
+  return std::is_integral<T>::value || is_timestamp<T>();
+}
+
+// Rep of a timestamp; integral values are their own rep
+template <typename T, std::enable_if_t<is_timestamp<T>()>* = nullptr>
+__device__ typename T::rep to_rep(T value)
+{
+  return value.time_since_epoch().count();
+}
+
+template <typename T, std::enable_if_t<!is_timestamp<T>()>* = nullptr>
+__device__ T to_rep(T value)
+{
+  return value;
+}
+
+template <typename T>
+using rep_type = decltype(to_rep(std::declval<T>()));
+
+/**
+ * @brief Maps a value to an unsigned integer of the same order
+ */
+template <typename T>
+__device__ uint64_t to_ordered(T value)
+{
+  auto const rep = to_rep(value);
+  return std::is_signed<rep_type<T>>::value
+           ? static_cast<uint64_t>(static_cast<int64_t>(rep)) ^ sign_bit
+           : static_cast<uint64_t>(rep);
+}
+
+template <typename T>
+__device__ T from_ordered(uint64_t ordered)
+{
+  using Rep = rep_type<T>;
+  return T(std::is_signed<Rep>::value ? static_cast<Rep>(static_cast<int64_t>(ordered ^ sign_bit))
+                                      : static_cast<Rep>(ordered));
+}
+
+__device__ int32_t bit_width(uint64_t range) { return range == 0 ? 0 : 64 - __clzll(range); }
+
+/**
+ * @brief Returns the `width` bits packed at bit `position` of `words`
+ */
+__device__ uint64_t unpack(uint32_t const* words, std::size_t position, int32_t width)
+{
+  if (width == 0) { return 0; }
+  auto const word  = position / 32;
+  auto const shift = static_cast<int32_t>(position % 32);
+  uint64_t bits    = words[word] >> shift;
+  for (int32_t read = 32 - shift, i = 1; read < width; read += 32, ++i) {
+    bits |= static_cast<uint64_t>(words[word + i]) << read;
+  }
+  return width == 64 ? bits : bits & ((uint64_t{1} << width) - 1);
+}
+
+/**
+ * @brief Packs the `width` low bits of `bits` at bit `position` of `words`
+ */
+__device__ void pack(uint32_t* words, std::size_t position, int32_t width, uint64_t bits)
+{
+  if (width == 0) { return; }
+  auto const word  = position / 32;
+  auto const shift = static_cast<int32_t>(position % 32);
+  atomicOr(&words[word], static_cast<uint32_t>(bits << shift));
+  for (int32_t written = 32 - shift, i = 1; written < width; written += 32, ++i) {
+    atomicOr(&words[word + i], static_cast<uint32_t>(bits >> written));
+  }
+}
+
+/**
+ * @brief Chooses the encoding of each block of values, and the number of 32-bit words it packs
+ * to
+ */
+template <typename T>
+__global__ void encode_blocks_kernel(T const* values,
+                                     size_type size,
+                                     block_encoding* blocks,
+                                     std::size_t* block_words)
+{
+  using block_reduce = cub::BlockReduce<uint64_t, block_size>;
+  __shared__ typename block_reduce::TempStorage temp_storage;
+
+  auto const begin = static_cast<size_type>(blockIdx.x) * values_per_block;
+  auto const count = min(size - begin, values_per_block);
+
+  uint64_t min_value = ~uint64_t{0}, max_value = 0;
+  uint64_t min_delta = ~uint64_t{0}, max_delta = 0;
+  for (int i = threadIdx.x; i < count; i += block_size) {
+    auto const value = to_ordered(values[begin + i]);
+    min_value        = min(min_value, value);
+    max_value        = max(max_value, value);
+    if (i > 0) {
+      auto const delta = (value - to_ordered(values[begin + i - 1])) ^ sign_bit;
+      min_delta        = min(min_delta, delta);
+      max_delta        = max(max_delta, delta);
+    }
+  }
+  min_value = block_reduce(temp_storage).Reduce(min_value, cub::Min());
+  __syncthreads();
+  max_value = block_reduce(temp_storage).Reduce(max_value, cub::Max());
+  __syncthreads();
+  min_delta = block_reduce(temp_storage).Reduce(min_delta, cub::Min());
+  __syncthreads();
+  max_delta = block_reduce(temp_storage).Reduce(max_delta, cub::Max());
+
+  if (threadIdx.x == 0) {
+    auto const value_width = bit_width(max_value - min_value);
+    auto const delta_width = (count > 1) ? bit_width(max_delta - min_delta) : 64;
+    auto const is_delta     = delta_width < value_width;
+    auto const width        = is_delta ? delta_width : value_width;
+    blocks[blockIdx.x]      = block_encoding{
+      is_delta ? min_delta : min_value, to_ordered(values[begin]), 0, width, is_delta};
+    block_words[blockIdx.x] = (static_cast<std::size_t>(count) * width + 31) / 32;
+  }
+}
+
+template <typename T>
+__global__ void pack_values_kernel(T const* values,
+                                   size_type size,
+                                   block_encoding const* blocks,
+                                   uint32_t* data)
+{
+  auto const idx = static_cast<size_type>(blockIdx.x * blockDim.x + threadIdx.x);
+  if (idx >= size) { return; }
+  auto const& block = blocks[idx / values_per_block];
+  auto const index  = idx % values_per_block;
+  auto const value  = to_ordered(values[idx]);
+  if (block.is_delta && index == 0) { return; }
+  auto const bits = block.is_delta ? ((value - to_ordered(values[idx - 1])) ^ sign_bit)
+                                   : value;
+  pack(data + block.word_offset,
+       static_cast<std::size_t>(index) * block.bit_width,
+       block.bit_width,
+       bits - block.reference);
+}
+
+/**
+ * @brief Decodes blocks of values, one per thread block
+ *
+ * Decodes all the blocks into `values` at their rows, or, with `block_ids`, the blocks listed
+ * into consecutive runs of `values_per_block` values of `values`.
+ */
+template <typename T>
+__global__ void unpack_blocks_kernel(block_encoding const* blocks,
+                                     uint32_t const* data,
+                                     size_type size,
+                                     size_type const* block_ids,
+                                     T* values)
+{
+  using block_scan = cub::BlockScan<uint64_t, block_size>;
+  __shared__ typename block_scan::TempStorage temp_storage;
+
+  auto const block_id = block_ids == nullptr ? static_cast<size_type>(blockIdx.x)
+                                             : block_ids[blockIdx.x];
+  auto const& block   = blocks[block_id];
+  auto const begin    = block_id * values_per_block;
+  auto const count    = min(size - begin, values_per_block);
+  auto const words    = data + block.word_offset;
+  auto const output =
+    values + (block_ids == nullptr ? begin : static_cast<size_type>(blockIdx.x) * values_per_block);
+
+  // Blocked arrangement, for the scan of the deltas
+  uint64_t items[values_per_thread];
+  for (int i = 0; i < values_per_thread; ++i) {
+    auto const index = static_cast<int>(threadIdx.x) * values_per_thread + i;
+    if (index >= count) {
+      items[i] = 0;
+      continue;
+    }
+    auto const bits =
+      unpack(words, static_cast<std::size_t>(index) * block.bit_width, block.bit_width);
+    if (!block.is_delta) {
+      items[i] = block.reference + bits;
+    } else {
+      items[i] = (index == 0) ? block.first : (block.reference + bits) ^ sign_bit;
+    }
+  }
+  if (block.is_delta) { block_scan(temp_storage).InclusiveSum(items, items); }
+  for (int i = 0; i < values_per_thread; ++i) {
+    auto const index = static_cast<int>(threadIdx.x) * values_per_thread + i;
+    if (index < count) { output[index] = from_ordered<T>(items[i]); }
+  }
+}
+
+/**
+ * @brief Gathers the values at `rows`
+ *
+ * Values of frame of reference blocks are unpacked in place. Those of delta blocks are read from
+ * `decoded`, which holds the delta block `b` at `block_slots[b] * values_per_block`.
+ */
+template <typename T>
+__global__ void unpack_rows_kernel(block_encoding const* blocks,
+                                   uint32_t const* data,
+                                   size_type const* block_slots,
+                                   T const* decoded,
+                                   size_type const* rows,
+                                   size_type num_rows,
+                                   T* values)
+{
+  auto const idx = static_cast<size_type>(blockIdx.x * blockDim.x + threadIdx.x);
+  if (idx >= num_rows) { return; }
+  auto const row      = rows[idx];
+  auto const block_id = row / values_per_block;
+  auto const& block   = blocks[block_id];
+  auto const index    = row % values_per_block;
+  if (block.is_delta) {
+    values[idx] = decoded[block_slots[block_id] * values_per_block + index];
+    return;
+  }
+  values[idx] = from_ordered<T>(
+    block.reference + unpack(data + block.word_offset,
+                             static_cast<std::size_t>(index) * block.bit_width,
+                             block.bit_width));
+}
+
+struct compress_fn {
+  template <typename T, std::enable_if_t<is_compressible<T>()>* = nullptr>
+  void operator()(column_view const& input,
+                  compressed_column& output,
+                  rmm::mr::device_memory_resource* mr,
+                  cudaStream_t stream)
+  {
+    if (input.is_empty()) { return; }
+    auto const num_blocks = (input.size() + values_per_block - 1) / values_per_block;
+    output.blocks         = rmm::device_buffer(num_blocks * sizeof(block_encoding), stream, mr);
+    auto const d_blocks   = static_cast<block_encoding*>(output.blocks.data());
+    rmm::device_vector<std::size_t> block_words(num_blocks + 1, 0);
+    encode_blocks_kernel<T><<<num_blocks, block_size, 0, stream>>>(
+      input.data<T>(), input.size(), d_blocks, block_words.data().get());
+    CHECK_CUDA(stream);
+
+    // The word counts of the blocks become their offsets, and the last one the total
+    thrust::exclusive_scan(rmm::exec_policy(stream)->on(stream),
+                           block_words.begin(),
+                           block_words.end(),
+                           block_words.begin());
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       num_blocks,
+                       [d_blocks, d_offsets = block_words.data().get()] __device__(size_type b) {
+                         d_blocks[b].word_offset = d_offsets[b];
+                       });
+    std::size_t const num_words = block_words.back();
+
+    output.data = rmm::device_buffer(num_words * sizeof(uint32_t), stream, mr);
+    CUDA_TRY(cudaMemsetAsync(output.data.data(), 0, output.data.size(), stream));
+    cudf::detail::grid_1d grid{input.size(), block_size};
+    pack_values_kernel<T><<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
+      input.data<T>(), input.size(), d_blocks, static_cast<uint32_t*>(output.data.data()));
+    CHECK_CUDA(stream);
+  }
+
+  template <typename T, std::enable_if_t<!is_compressible<T>()>* = nullptr>
+  void operator()(column_view const&,
+                  compressed_column&,
+                  rmm::mr::device_memory_resource*,
+                  cudaStream_t)
+  {
+    CUDF_FAIL("Only integral and timestamp columns can be compressed");
+  }
+};
+
+struct decompress_fn {
+  template <typename T, std::enable_if_t<is_compressible<T>()>* = nullptr>
+  void operator()(compressed_column const& input,
+                  size_type const* rows,
+                  size_type num_rows,
+                  mutable_column_view output,
+                  cudaStream_t stream)
+  {
+    if (input.size == 0 || (rows != nullptr && num_rows == 0)) { return; }
+    auto const d_blocks = static_cast<block_encoding const*>(input.blocks.data());
+    auto const d_data   = static_cast<uint32_t const*>(input.data.data());
+    auto const num_blocks = (input.size + values_per_block - 1) / values_per_block;
+    if (rows == nullptr) {
+      unpack_blocks_kernel<T><<<num_blocks, block_size, 0, stream>>>(
+        d_blocks, d_data, input.size, nullptr, output.data<T>());
+      CHECK_CUDA(stream);
+      return;
+    }
+
+    // Each delta block gathered from is decoded once, instead of summing its deltas up to each
+    // row gathered
+    rmm::device_vector<size_type> block_slots(num_blocks, 0);
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                       rows,
+                       num_rows,
+                       [d_blocks, d_slots = block_slots.data().get()] __device__(size_type row) {
+                         auto const block_id = row / values_per_block;
+                         if (d_blocks[block_id].is_delta) { d_slots[block_id] = 1; }
+                       });
+    rmm::device_vector<size_type> block_ids(num_blocks);
+    auto const num_decoded = static_cast<size_type>(
+      thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_blocks),
+                      block_slots.begin(),
+                      block_ids.begin(),
+                      thrust::identity<size_type>{}) -
+      block_ids.begin());
+    thrust::exclusive_scan(rmm::exec_policy(stream)->on(stream),
+                           block_slots.begin(),
+                           block_slots.end(),
+                           block_slots.begin());
+
+    rmm::device_buffer decoded(
+      static_cast<std::size_t>(num_decoded) * values_per_block * sizeof(T), stream);
+    if (num_decoded > 0) {
+      unpack_blocks_kernel<T><<<num_decoded, block_size, 0, stream>>>(
+        d_blocks, d_data, input.size, block_ids.data().get(), static_cast<T*>(decoded.data()));
+      CHECK_CUDA(stream);
+    }
+    cudf::detail::grid_1d grid{num_rows, block_size};
+    unpack_rows_kernel<T><<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
+      d_blocks,
+      d_data,
+      block_slots.data().get(),
+      static_cast<T const*>(decoded.data()),
+      rows,
+      num_rows,
+      output.data<T>());
+    CHECK_CUDA(stream);
+  }
+
+  template <typename T, std::enable_if_t<!is_compressible<T>()>* = nullptr>
+  void operator()(
+    compressed_column const&, size_type const*, size_type, mutable_column_view, cudaStream_t)
+  {
+    CUDF_FAIL("Only integral and timestamp columns can be compressed");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<compressed_column> compress_column(column_view const& input,
+                                                   rmm::mr::device_memory_resource* mr,
+                                                   cudaStream_t stream)
+{
+  auto output        = std::make_unique<compressed_column>();
+  output->type       = input.type();
+  output->size       = input.size();
+  output->null_count = input.null_count();
+  output->null_mask  = copy_bitmask(input, stream, mr);
+  type_dispatcher(input.type(), compress_fn{}, input, *output, mr, stream);
+  return output;
+}
+
+std::unique_ptr<column> decompress_column(compressed_column const& input,
+                                          rmm::mr::device_memory_resource* mr,
+                                          cudaStream_t stream)
+{
+  rmm::device_buffer null_mask{input.null_mask.data(), input.null_mask.size(), stream, mr};
+  auto output = make_fixed_width_column(
+    input.type, input.size, std::move(null_mask), input.null_count, stream, mr);
+  type_dispatcher(input.type, decompress_fn{}, input, nullptr, 0, output->mutable_view(), stream);
+  return output;
+}
+
+std::unique_ptr<column> decompress_rows(compressed_column const& input,
+                                        column_view const& gather_map,
+                                        rmm::mr::device_memory_resource* mr,
+                                        cudaStream_t stream)
+{
+  CUDF_EXPECTS(gather_map.type().id() == type_id::INT32, "Gather map must be of type INT32");
+  CUDF_EXPECTS(!gather_map.has_nulls(), "Gather map must not have nulls");
+  auto const d_rows = gather_map.data<size_type>();
+  CUDF_EXPECTS(thrust::all_of(rmm::exec_policy(stream)->on(stream),
+                              d_rows,
+                              d_rows + gather_map.size(),
+                              [size = input.size] __device__(size_type row) {
+                                return row >= 0 && row < size;
+                              }),
+               "Index out of bounds.");
+
+  auto output = make_fixed_width_column(
+    input.type, gather_map.size(), mask_state::UNALLOCATED, stream, mr);
+  type_dispatcher(input.type,
+                  decompress_fn{},
+                  input,
+                  gather_map.data<size_type>(),
+                  gather_map.size(),
+                  output->mutable_view(),
+                  stream);
+  if (input.null_count > 0) {
+    // The validity of the gathered rows, from the null mask kept as is
+    auto const d_mask = static_cast<bitmask_type const*>(input.null_mask.data());
+    auto valid        = valid_if(
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(gather_map.size()),
+      [d_mask, d_rows] __device__(size_type idx) { return bit_is_set(d_mask, d_rows[idx]); },
+      stream,
+      mr);
+    output->set_null_mask(std::move(valid.first), valid.second);
+  }
+  return output;
+}
+
+}  // namespace detail
+
+std::unique_ptr<compressed_column> compress_column(column_view const& input,
+                                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compress_column(input, mr, 0);
+}
+
+std::unique_ptr<column> decompress_column(compressed_column const& input,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::decompress_column(input, mr, 0);
+}
+
+std::unique_ptr<column> decompress_rows(compressed_column const& input,
+                                        column_view const& gather_map,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::decompress_rows(input, gather_map, mr, 0);
+}
+
+}  // namespace cudf
@@ -140,17 +140,103 @@ void concatenate_masks(rmm::device_vector<column_device_view> const& d_views,
     output_size);
 }
 
+/**
+ * @brief The part of an input column read by the batched concatenate kernels
+ *
+ * The inputs of all the columns are uploaded at once as plain pointers, where creating a
+ * `column_device_view` of each input takes an allocation and a copy of its own.
+ */
+struct batched_input {
+  void const* head;               ///< The data of the column, not adjusted for its offset
+  bitmask_type const* null_mask;  ///< Null if the column has no null mask
+  size_type offset;
+};
+
+/**
+ * @brief An output column of the batched concatenate kernel
+ */
+struct batched_output {
+  void* data;
+  bitmask_type* null_mask;  ///< Null if the output has no nulls
+  size_type element_size;
+};
+
+/**
+ * @brief Uploads the inputs of `views` and the prefix sum of their sizes to device memory
+ *
+ * @return The device inputs, the device prefix sum and the sum of the sizes
+ */
+auto upload_batched_inputs(std::vector<column_view> const& views, cudaStream_t stream)
+{
+  auto inputs  = thrust::host_vector<batched_input>();
+  auto offsets = thrust::host_vector<size_t>();
+  inputs.reserve(views.size());
+  offsets.reserve(views.size() + 1);
+  offsets.push_back(0);
+  for (auto const& view : views) {
+    inputs.push_back(batched_input{view.head(), view.null_mask(), view.offset()});
+    offsets.push_back(offsets.back() + view.size());
+  }
+  auto const output_size = offsets.back();
+  return std::make_tuple(rmm::device_vector<batched_input>{inputs},
+                         rmm::device_vector<size_t>{offsets},
+                         output_size);
+}
+
+__device__ inline bool batched_input_is_valid(batched_input const& input, size_type index)
+{
+  return input.null_mask == nullptr or bit_is_set(input.null_mask, input.offset + index);
+}
+
+/**
+ * @brief Concatenates the null mask bits of the `number_of_inputs` inputs to the destination
+ * bitmask
+ */
+__global__ void concatenate_batched_masks_kernel(batched_input const* inputs,
+                                                 size_t const* output_offsets,
+                                                 size_type number_of_inputs,
+                                                 bitmask_type* dest_mask,
+                                                 size_type number_of_mask_bits)
+{
+  size_type mask_index = threadIdx.x + blockIdx.x * blockDim.x;
+
+  auto active_mask = __ballot_sync(0xFFFF'FFFF, mask_index < number_of_mask_bits);
+
+  while (mask_index < number_of_mask_bits) {
+    size_type const source_index =
+      thrust::upper_bound(
+        thrust::seq, output_offsets, output_offsets + number_of_inputs, mask_index) -
+      output_offsets - 1;
+    bool const bit_is_set =
+      batched_input_is_valid(inputs[source_index], mask_index - output_offsets[source_index]);
+    bitmask_type const new_word = __ballot_sync(active_mask, bit_is_set);
+
+    if (threadIdx.x % detail::warp_size == 0) { dest_mask[word_index(mask_index)] = new_word; }
+
+    mask_index += blockDim.x * gridDim.x;
+    active_mask = __ballot_sync(active_mask, mask_index < number_of_mask_bits);
+  }
+}
+
 void concatenate_masks(std::vector<column_view> const& views,
                        bitmask_type* dest_mask,
                        cudaStream_t stream)
 {
-  // Preprocess and upload inputs to device memory
-  auto const device_views = create_device_views(views, stream);
-  auto const& d_views     = std::get<1>(device_views);
-  auto const& d_offsets   = std::get<2>(device_views);
-  auto const output_size  = std::get<3>(device_views);
+  // Upload the null masks of all the inputs at once
+  auto const uploaded    = upload_batched_inputs(views, stream);
+  auto const& d_inputs   = std::get<0>(uploaded);
+  auto const& d_offsets  = std::get<1>(uploaded);
+  auto const output_size = static_cast<size_type>(std::get<2>(uploaded));
+  if (output_size == 0) { return; }
 
-  concatenate_masks(d_views, d_offsets, dest_mask, output_size, stream);
+  constexpr size_type block_size{256};
+  cudf::detail::grid_1d config(output_size, block_size);
+  concatenate_batched_masks_kernel<<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
+    d_inputs.data().get(),
+    d_offsets.data().get(),
+    static_cast<size_type>(d_inputs.size()),
+    dest_mask,
+    output_size);
 }
 
 template <typename T, size_type block_size, bool Nullable>
@@ -281,6 +367,186 @@ std::unique_ptr<column> for_each_concatenate(std::vector<column_view> const& vie
   return col;
 }
 
+/**
+ * @brief Copies the element `source_index` of `source` to the element `target_index` of
+ * `target`, elements being `element_size` bytes
+ */
+__device__ inline void copy_element(void const* source,
+                                    size_type source_index,
+                                    void* target,
+                                    size_type target_index,
+                                    size_type element_size)
+{
+  switch (element_size) {
+    case 1:
+      static_cast<int8_t*>(target)[target_index] = static_cast<int8_t const*>(source)[source_index];
+      break;
+    case 2:
+      static_cast<int16_t*>(target)[target_index] =
+        static_cast<int16_t const*>(source)[source_index];
+      break;
+    case 4:
+      static_cast<int32_t*>(target)[target_index] =
+        static_cast<int32_t const*>(source)[source_index];
+      break;
+    default:
+      static_cast<int64_t*>(target)[target_index] =
+        static_cast<int64_t const*>(source)[source_index];
+      break;
+  }
+}
+
+/**
+ * @brief Concatenates the inputs of several fixed-width columns, with their null masks
+ *
+ * Output `c` is the concatenation of the inputs `c * num_inputs` to `(c + 1) * num_inputs - 1`,
+ * all the outputs having the same size. The `y` dimension of the grid strides over the outputs.
+ *
+ * @param inputs The inputs of all the outputs
+ * @param input_offsets Prefix sum of the sizes of the inputs of an output
+ * @param num_inputs The number of inputs of an output
+ * @param outputs The outputs
+ * @param num_outputs The number of outputs
+ * @param output_size The size of each output
+ * @param out_valid_counts The number of valid elements of each output, for the outputs with a
+ * null mask
+ */
+template <size_type block_size>
+__global__ void batched_concatenate_kernel(batched_input const* inputs,
+                                           size_t const* input_offsets,
+                                           size_type num_inputs,
+                                           batched_output const* outputs,
+                                           size_type num_outputs,
+                                           size_type output_size,
+                                           size_type* out_valid_counts)
+{
+  for (size_type c = blockIdx.y; c < num_outputs; c += gridDim.y) {
+    auto const output         = outputs[c];
+    auto const* output_inputs = inputs + static_cast<size_t>(c) * num_inputs;
+    bool const nullable       = output.null_mask != nullptr;
+
+    size_type output_index     = threadIdx.x + blockIdx.x * blockDim.x;
+    size_type warp_valid_count = 0;
+
+    unsigned active_mask;
+    if (nullable) { active_mask = __ballot_sync(0xFFFF'FFFF, output_index < output_size); }
+    while (output_index < output_size) {
+      auto const offset_it =
+        -1 + thrust::upper_bound(
+               thrust::seq, input_offsets, input_offsets + num_inputs, output_index);
+      auto const& input       = output_inputs[offset_it - input_offsets];
+      auto const offset_index = static_cast<size_type>(output_index - *offset_it);
+      copy_element(
+        input.head, input.offset + offset_index, output.data, output_index, output.element_size);
+
+      if (nullable) {
+        bool const bit_is_set       = batched_input_is_valid(input, offset_index);
+        bitmask_type const new_word = __ballot_sync(active_mask, bit_is_set);
+
+        if (threadIdx.x % detail::warp_size == 0) {
+          output.null_mask[word_index(output_index)] = new_word;
+        }
+
+        warp_valid_count += __popc(new_word);
+      }
+
+      output_index += blockDim.x * gridDim.x;
+      if (nullable) { active_mask = __ballot_sync(active_mask, output_index < output_size); }
+    }
+
+    if (nullable) {
+      using detail::single_lane_block_sum_reduce;
+      auto block_valid_count = single_lane_block_sum_reduce<block_size, 0>(warp_valid_count);
+      if (threadIdx.x == 0) { atomicAdd(out_valid_counts + c, block_valid_count); }
+      // The reduction's shared memory is reused by the next output
+      __syncthreads();
+    }
+  }
+}
+
+/**
+ * @brief Concatenates the fixed-width columns `column_indices` of `tables` with one kernel
+ * launch
+ *
+ * Concatenating each column on its own creates and uploads a device view of each of its inputs
+ * and launches a kernel, which dominates the time taken to concatenate many small tables. Here
+ * the inputs of all the columns are uploaded at once and copied by a single kernel.
+ *
+ * @return The concatenated columns, in the order of `column_indices`
+ */
+std::vector<std::unique_ptr<column>> batched_concatenate(
+  std::vector<table_view> const& tables,
+  std::vector<size_type> const& column_indices,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  using mask_policy = cudf::mask_allocation_policy;
+
+  auto const num_inputs = tables.size();
+  auto offsets          = thrust::host_vector<size_t>();
+  offsets.reserve(num_inputs + 1);
+  offsets.push_back(0);
+  for (auto const& table : tables) { offsets.push_back(offsets.back() + table.num_rows()); }
+  auto const output_size = offsets.back();
+
+  CUDF_EXPECTS(output_size < std::numeric_limits<size_type>::max(),
+               "Total number of concatenated rows exceeds size_type range");
+
+  auto inputs  = thrust::host_vector<batched_input>();
+  auto outputs = thrust::host_vector<batched_output>();
+  inputs.reserve(column_indices.size() * num_inputs);
+  outputs.reserve(column_indices.size());
+  std::vector<bool> output_has_nulls;
+  std::vector<std::unique_ptr<column>> concat_columns;
+  for (auto const index : column_indices) {
+    bool const has_nulls = std::any_of(tables.cbegin(), tables.cend(), [index](auto const& t) {
+      return t.column(index).has_nulls();
+    });
+    auto const policy = has_nulls ? mask_policy::ALWAYS : mask_policy::NEVER;
+    auto const& first = tables.front().column(index);
+    auto out_col      = detail::allocate_like(first, output_size, policy, mr, stream);
+    out_col->set_null_count(0);  // prevent null count from being materialized
+    auto out_view = out_col->mutable_view();
+    outputs.push_back(batched_output{out_view.head(),
+                                     has_nulls ? out_view.null_mask() : nullptr,
+                                     static_cast<size_type>(size_of(first.type()))});
+    for (auto const& table : tables) {
+      auto const& view = table.column(index);
+      inputs.push_back(batched_input{view.head(), view.null_mask(), view.offset()});
+    }
+    output_has_nulls.push_back(has_nulls);
+    concat_columns.push_back(std::move(out_col));
+  }
+  if (output_size == 0) { return concat_columns; }
+
+  auto const d_inputs  = rmm::device_vector<batched_input>{inputs};
+  auto const d_offsets = rmm::device_vector<size_t>{offsets};
+  auto const d_outputs = rmm::device_vector<batched_output>{outputs};
+  auto d_valid_counts  = rmm::device_vector<size_type>(outputs.size(), 0);
+
+  constexpr size_type block_size{256};
+  constexpr size_type max_grid_y{65535};
+  cudf::detail::grid_1d config(output_size, block_size);
+  dim3 const grid(config.num_blocks, std::min(static_cast<size_type>(outputs.size()), max_grid_y));
+  batched_concatenate_kernel<block_size>
+    <<<grid, config.num_threads_per_block, 0, stream>>>(d_inputs.data().get(),
+                                                        d_offsets.data().get(),
+                                                        static_cast<size_type>(num_inputs),
+                                                        d_outputs.data().get(),
+                                                        static_cast<size_type>(outputs.size()),
+                                                        static_cast<size_type>(output_size),
+                                                        d_valid_counts.data().get());
+
+  if (std::find(output_has_nulls.cbegin(), output_has_nulls.cend(), true) !=
+      output_has_nulls.cend()) {
+    thrust::host_vector<size_type> const valid_counts(d_valid_counts);
+    for (size_t i = 0; i < concat_columns.size(); ++i) {
+      if (output_has_nulls[i]) { concat_columns[i]->set_null_count(output_size - valid_counts[i]); }
+    }
+  }
+  return concat_columns;
+}
+
 struct concatenate_dispatch {
   std::vector<column_view> const& views;
   rmm::mr::device_memory_resource* mr;
@@ -357,8 +623,25 @@ std::unique_ptr<table> concatenate(std::vector<table_view> const& tables_to_conc
                            }),
                "Mismatch in table columns to concatenate.");
 
+  // Concatenate the fixed-width columns together when there are enough inputs for the setup of
+  // each column to matter
+  std::vector<size_type> fixed_width_columns;
+  for (size_type i = 0; i < first_table.num_columns(); ++i) {
+    if (is_fixed_width(first_table.column(i).type())) { fixed_width_columns.push_back(i); }
+  }
+  bool const use_batched_kernel =
+    not fixed_width_columns.empty() and use_fused_kernel_heuristic(false, tables_to_concat.size());
+  auto batched_columns =
+    use_batched_kernel ? batched_concatenate(tables_to_concat, fixed_width_columns, mr, stream)
+                       : std::vector<std::unique_ptr<column>>{};
+
   std::vector<std::unique_ptr<column>> concat_columns;
+  auto batched_column = batched_columns.begin();
   for (size_type i = 0; i < first_table.num_columns(); ++i) {
+    if (use_batched_kernel and is_fixed_width(first_table.column(i).type())) {
+      concat_columns.emplace_back(std::move(*batched_column++));
+      continue;
+    }
     std::vector<column_view> cols;
     std::transform(tables_to_concat.cbegin(),
                    tables_to_concat.cend(),
@@ -14,465 +14,453 @@
  * limitations under the License.
  */
 
-#include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/for_each.h>
+#include <thrust/host_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <cub/cub.cuh>
 
 #include <numeric>
 
 namespace cudf {
 namespace detail {
 namespace {
-/**
- * @brief Copies contents of `in` to `out`.  Copies validity if present
- * but does not compute null count.
- *
- * @param in column_view to copy from
- * @param out mutable_column_view to copy to.
- */
-template <size_type block_size, typename T, bool has_validity>
-__launch_bounds__(block_size) __global__
-  void copy_in_place_kernel(column_device_view const in, mutable_column_device_view out)
-{
-  const size_type tid            = threadIdx.x + blockIdx.x * block_size;
-  const int warp_id              = tid / cudf::detail::warp_size;
-  const size_type warps_per_grid = gridDim.x * block_size / cudf::detail::warp_size;
-
-  // begin/end indices for the column data
-  size_type begin = 0;
-  size_type end   = in.size();
-  // warp indices.  since 1 warp == 32 threads == sizeof(bit_mask_t) * 8,
-  // each warp will process one (32 bit) of the validity mask via
-  // __ballot_sync()
-  size_type warp_begin = cudf::word_index(begin);
-  size_type warp_end   = cudf::word_index(end - 1);
-
-  // lane id within the current warp
-  const int lane_id = threadIdx.x % cudf::detail::warp_size;
-
-  // current warp.
-  size_type warp_cur = warp_begin + warp_id;
-  size_type index    = tid;
-  while (warp_cur <= warp_end) {
-    bool in_range = (index >= begin && index < end);
-
-    bool valid = true;
-    if (has_validity) { valid = in_range && in.is_valid(index); }
-    if (in_range) { out.element<T>(index) = in.element<T>(index); }
-
-    // update validity
-    if (has_validity) {
-      // the final validity mask for this warp
-      int warp_mask = __ballot_sync(0xFFFF'FFFF, valid && in_range);
-      // only one guy in the warp needs to update the mask and count
-      if (lane_id == 0) { out.set_mask_word(warp_cur, warp_mask); }
-    }
+// align all column size allocations to this boundary so that all output column buffers
+// start at that alignment.
+static constexpr size_t split_align = 64;
 
-    // next grid
-    warp_cur += warps_per_grid;
-    index += block_size * gridDim.x;
-  }
-}
+// the most bytes copied by a single block. larger buffers are copied by several blocks.
+static constexpr size_t copy_chunk_bytes = 1 << 18;
 
 /**
- * @brief Copies contents of one string column to another.  Copies validity if present
- * but does not compute null count.
- *
- * The purpose of this kernel is to reduce the number of
- * kernel calls for copying a string column from 2 to 1, since number of kernel calls is the
- * dominant factor in large scale contiguous_split() calls.  To do this, the kernel is
- * invoked with using max(num_chars, num_offsets) threads and then doing separate
- * bounds checking on offset, chars and validity indices.
- *
- * Outgoing offset values are shifted down to account for the new base address
- * each column gets as a result of the contiguous_split() process.
- *
- * @param in num_strings number of strings (rows) in the column
- * @param in offsets_in pointer to incoming offsets to be copied
- * @param out offsets_out pointer to output offsets
- * @param in validity_in_offset offset into validity buffer to add to element indices
- * @param in validity_in pointer to incoming validity vector to be copied
- * @param out validity_out pointer to output validity vector
- * @param in offset_shift value to shift copied offsets down by
- * @param in num_chars number of chars to copy
- * @param in chars_in input chars to be copied
- * @param out chars_out output chars to be copied.
+ * @brief How the rows of a column in a partition follow from the rows of its parent.
  */
-template <size_type block_size, bool has_validity>
-__launch_bounds__(block_size) __global__
-  void copy_in_place_strings_kernel(size_type num_strings,
-                                    size_type const* __restrict__ offsets_in,
-                                    size_type* __restrict__ offsets_out,
-                                    size_type validity_in_offset,
-                                    bitmask_type const* __restrict__ validity_in,
-                                    bitmask_type* __restrict__ validity_out,
-                                    size_type offset_shift,
-                                    size_type num_chars,
-                                    char const* __restrict__ chars_in,
-                                    char* __restrict__ chars_out)
-{
-  const size_type tid            = threadIdx.x + blockIdx.x * block_size;
-  const int warp_id              = tid / cudf::detail::warp_size;
-  const size_type warps_per_grid = gridDim.x * block_size / cudf::detail::warp_size;
-
-  // how many warps we'll be processing. with strings, the chars and offsets
-  // lengths may be different.  so we'll just march the worst case.
-  size_type warp_begin = cudf::word_index(0);
-  size_type warp_end   = cudf::word_index(std::max(num_chars, num_strings + 1) - 1);
-
-  // end indices for chars
-  size_type chars_end = num_chars;
-  // end indices for offsets
-  size_type offsets_end = num_strings + 1;
-  // end indices for validity and the last warp that actually should
-  // be updated
-  size_type validity_end      = num_strings;
-  size_type validity_warp_end = cudf::word_index(num_strings - 1);
-
-  // lane id within the current warp
-  const int lane_id = threadIdx.x % cudf::detail::warp_size;
-
-  size_type warp_cur = warp_begin + warp_id;
-  size_type index    = tid;
-  while (warp_cur <= warp_end) {
-    if (index < chars_end) { chars_out[index] = chars_in[index]; }
-
-    if (index < offsets_end) {
-      // each output column starts at a new base pointer. so we have to
-      // shift every offset down by the point (in chars) at which it was split.
-      offsets_out[index] = offsets_in[index] - offset_shift;
-    }
-
-    // if we're still in range of validity at all
-    if (has_validity && warp_cur <= validity_warp_end) {
-      bool valid = (index < validity_end) && bit_is_set(validity_in, validity_in_offset + index);
-
-      // the final validity mask for this warp
-      int warp_mask = __ballot_sync(0xFFFF'FFFF, valid);
-      // only one guy in the warp needs to update the mask and count
-      if (lane_id == 0) { validity_out[warp_cur] = warp_mask; }
-    }
-
-    // next grid
-    warp_cur += warps_per_grid;
-    index += block_size * gridDim.x;
-  }
-}
-
-// align all column size allocations to this boundary so that all output column buffers
-// start at that alignment.
-static constexpr size_t split_align = 64;
+enum class row_source : int8_t {
+  PARENT,          ///< the rows of the parent (the partition itself for a top-level column)
+  PARENT_OFFSETS,  ///< one more row than the parent (offsets of strings and lists)
+  OFFSETS_RANGE,   ///< the rows spanned by the offsets of the parent (chars and list elements)
+  ALL              ///< every row of the column (dictionary keys)
+};
 
 /**
- * @brief Information about the split for a given column. Bundled together
- *        into a struct because tuples were getting pretty unreadable.
+ * @brief Information about a column of the input table or one of its descendants, used to
+ * compute its rows in each partition.
  */
-struct column_split_info {
-  size_t data_buf_size;      // size of the data (including padding)
-  size_t validity_buf_size;  // validity vector size (including padding)
+struct src_column_info {
+  row_source source;
+  size_type offset;                 // offset of the column view
+  size_type size;                   // size of the column view
+  size_type const* parent_offsets;  // (OFFSETS_RANGE only) offsets indexed by the parent's rows
+};
 
-  size_t offsets_buf_size;  // (strings only) size of offset column (including padding)
-  size_type num_chars;      // (strings only) number of chars in the column
-  size_type chars_offset;   // (strings only) offset from head of chars data
+/**
+ * @brief Range of rows `[begin, end)` of the buffers of a column.
+ */
+struct row_range {
+  size_type begin;
+  size_type end;
 };
 
 /**
- * @brief Functor called by the `type_dispatcher` to incrementally compute total
- * memory buffer size needed to allocate a contiguous copy of all columns within
- * a source table.
+ * @brief Every column of a table and all of their descendants, with parents ahead of their
+ * children.
  */
-struct column_buffer_size_functor {
-  template <typename T>
-  size_t operator()(column_view const& c, column_split_info& split_info)
-  {
-    split_info.data_buf_size = cudf::util::round_up_safe(c.size() * sizeof(T), split_align);
-    split_info.validity_buf_size =
-      (c.has_nulls() ? cudf::bitmask_allocation_size_bytes(c.size(), split_align) : 0);
-    return split_info.data_buf_size + split_info.validity_buf_size;
-  }
+struct flattened_columns {
+  std::vector<column_view> columns;
+  std::vector<src_column_info> info;
+  // the columns from the top-level column down to each column, concatenated
+  std::vector<size_type> paths;
+  std::vector<size_type> path_offsets{0};
 };
-template <>
-size_t column_buffer_size_functor::operator()<string_view>(column_view const& c,
-                                                           column_split_info& split_info)
+
+void flatten_column(column_view const& col,
+                    row_source source,
+                    size_type const* parent_offsets,
+                    std::vector<size_type> path,
+                    flattened_columns& flat)
 {
-  // this has already been precomputed in an earlier step. return the sum.
-  return split_info.data_buf_size + split_info.validity_buf_size + split_info.offsets_buf_size;
+  path.push_back(flat.columns.size());
+  flat.columns.push_back(col);
+  flat.info.push_back(src_column_info{source, col.offset(), col.size(), parent_offsets});
+  flat.paths.insert(flat.paths.end(), path.begin(), path.end());
+  flat.path_offsets.push_back(flat.paths.size());
+
+  if (col.num_children() == 0) { return; }
+  switch (col.type().id()) {
+    case type_id::STRING:
+    case type_id::LIST: {
+      // children are the offsets and the chars or list elements
+      auto const offsets = col.child(0);
+      flatten_column(offsets, row_source::PARENT_OFFSETS, nullptr, path, flat);
+      flatten_column(col.child(1),
+                     row_source::OFFSETS_RANGE,
+                     offsets.head<size_type>() + offsets.offset(),
+                     path,
+                     flat);
+    } break;
+    case type_id::DICTIONARY32: {
+      // the parent's offset and rows apply to the indices, the keys are shared by all rows
+      flatten_column(col.child(0), row_source::PARENT, nullptr, path, flat);
+      flatten_column(col.child(1), row_source::ALL, nullptr, path, flat);
+    } break;
+    default: CUDF_FAIL("Unsupported column type for contiguous_split");
+  }
 }
 
 /**
- * @brief Functor called by the `type_dispatcher` to copy a column into a contiguous
- * buffer of output memory.
+ * @brief Computes the rows of every column in every partition.
  *
- * Used for copying each column in a source table into one contiguous buffer of memory.
+ * Each thread follows the path from the top-level column down to its column, so the rows of
+ * all nested columns in all partitions are found in a single pass.
  */
-struct column_copy_functor {
-  template <typename T>
-  void operator()(column_view const& in,
-                  column_split_info const& split_info,
-                  char*& dst,
-                  std::vector<column_view>& out_cols)
+struct compute_row_ranges {
+  size_type const* partition_bounds;
+  src_column_info const* columns;
+  size_type const* paths;
+  size_type const* path_offsets;
+  size_type num_columns;
+  row_range* ranges;
+
+  __device__ void operator()(size_type index) const
   {
-    // outgoing pointers
-    char* data             = dst;
-    bitmask_type* validity = split_info.validity_buf_size == 0
-                               ? nullptr
-                               : reinterpret_cast<bitmask_type*>(dst + split_info.data_buf_size);
-
-    // increment working buffer
-    dst += (split_info.data_buf_size + split_info.validity_buf_size);
-
-    // no work to do
-    if (in.size() == 0) {
-      out_cols.push_back(column_view{in.type(), 0, nullptr});
-      return;
+    auto const partition = index / num_columns;
+    auto const column    = index % num_columns;
+    row_range rows{partition_bounds[partition], partition_bounds[partition + 1]};
+    for (auto p = path_offsets[column]; p < path_offsets[column + 1]; ++p) {
+      auto const& info = columns[paths[p]];
+      bool const empty = rows.begin == rows.end;
+      switch (info.source) {
+        case row_source::PARENT: break;
+        case row_source::PARENT_OFFSETS:
+          // a column with no rows may have no offsets at all
+          rows = (empty && info.size == 0) ? row_range{0, 0} : row_range{rows.begin, rows.end + 1};
+          break;
+        case row_source::OFFSETS_RANGE:
+          rows = empty ? row_range{0, 0}
+                       : row_range{info.parent_offsets[rows.begin], info.parent_offsets[rows.end]};
+          break;
+        case row_source::ALL: rows = row_range{0, info.size}; break;
+      }
+      rows = row_range{rows.begin + info.offset, rows.end + info.offset};
     }
+    ranges[index] = rows;
+  }
+};
 
-    // custom copy kernel (which could probably just be an in-place copy() function in cudf).
-    cudf::size_type num_els  = cudf::util::round_up_safe(in.size(), cudf::detail::warp_size);
-    constexpr int block_size = 256;
-    cudf::detail::grid_1d grid{num_els, block_size, 1};
+/**
+ * @brief A chunk of a buffer copied by one block of `copy_partitions_kernel`.
+ *
+ * `[begin, end)` are the elements of the buffer copied by the chunk, or its output words for
+ * a validity buffer.
+ */
+struct copy_task {
+  void const* src;           // first element of the rows of the partition, or head of the mask
+  void* dst;                 // output buffer
+  size_type num_rows;        // rows of the partition in the buffer
+  size_type src_bit_offset;  // (validity only) first bit of the rows of the partition
+  size_type begin;
+  size_type end;
+  int32_t element_size;         // size of the elements in bytes, or 0 for a validity buffer
+  bool is_offsets;              // offsets are shifted down to start at zero
+  size_type valid_count_index;  // (validity only) index of the valid count of the output column
+};
 
-    // output copied column
-    mutable_column_view mcv{in.type(), in.size(), data, validity, in.null_count()};
-    if (in.has_nulls()) {
-      copy_in_place_kernel<block_size, T, true><<<grid.num_blocks, block_size, 0, 0>>>(
-        *column_device_view::create(in), *mutable_column_device_view::create(mcv));
-    } else {
-      copy_in_place_kernel<block_size, T, false><<<grid.num_blocks, block_size, 0, 0>>>(
-        *column_device_view::create(in), *mutable_column_device_view::create(mcv));
-    }
+template <typename T>
+__device__ void copy_elements(copy_task const& task)
+{
+  auto const src = static_cast<T const*>(task.src);
+  auto const dst = static_cast<T*>(task.dst);
+  for (auto i = task.begin + static_cast<size_type>(threadIdx.x); i < task.end; i += blockDim.x) {
+    dst[i] = src[i];
+  }
+}
 
-    out_cols.push_back(mcv);
+__device__ void copy_offsets(copy_task const& task)
+{
+  auto const src   = static_cast<size_type const*>(task.src);
+  auto const dst   = static_cast<size_type*>(task.dst);
+  auto const shift = src[0];
+  for (auto i = task.begin + static_cast<size_type>(threadIdx.x); i < task.end; i += blockDim.x) {
+    dst[i] = src[i] - shift;
   }
-};
-template <>
-void column_copy_functor::operator()<string_view>(column_view const& in,
-                                                  column_split_info const& split_info,
-                                                  char*& dst,
-                                                  std::vector<column_view>& out_cols)
+}
+
+template <size_type block_size>
+__device__ void copy_validity(copy_task const& task, size_type* valid_counts)
 {
-  // outgoing pointers
-  char* chars_buf            = dst;
-  bitmask_type* validity_buf = split_info.validity_buf_size == 0
-                                 ? nullptr
-                                 : reinterpret_cast<bitmask_type*>(dst + split_info.data_buf_size);
-  size_type* offsets_buf =
-    reinterpret_cast<size_type*>(dst + split_info.data_buf_size + split_info.validity_buf_size);
-
-  // increment working buffer
-  dst += (split_info.data_buf_size + split_info.validity_buf_size + split_info.offsets_buf_size);
-
-  // offsets column.
-  strings_column_view strings_c(in);
-  column_view in_offsets = strings_c.offsets();
-  // note, incoming columns are sliced, so their size is fundamentally different from their child
-  // offset columns, which are unsliced.
-  size_type num_offsets = in.size() + 1;
-  cudf::size_type num_threads =
-    cudf::util::round_up_safe(std::max(split_info.num_chars, num_offsets), cudf::detail::warp_size);
-  column_view in_chars = strings_c.chars();
-
-  // a column with no strings will still have a single offset.
-  CUDF_EXPECTS(num_offsets > 0, "Invalid offsets child column");
-
-  // 1 combined kernel call that copies chars, offsets and validity in one pass. see notes on why
-  // this exists in the kernel brief.
-  constexpr int block_size = 256;
-  cudf::detail::grid_1d grid{num_threads, block_size, 1};
-  if (in.has_nulls()) {
-    copy_in_place_strings_kernel<block_size, true><<<grid.num_blocks, block_size, 0, 0>>>(
-      in.size(),                                        // num_rows
-      in_offsets.head<size_type>() + in.offset(),       // offsets_in
-      offsets_buf,                                      // offsets_out
-      in.offset(),                                      // validity_in_offset
-      in.null_mask(),                                   // validity_in
-      validity_buf,                                     // validity_out
-      split_info.chars_offset,                          // offset_shift
-      split_info.num_chars,                             // num_chars
-      in_chars.head<char>() + split_info.chars_offset,  // chars_in
-      chars_buf);
-  } else {
-    copy_in_place_strings_kernel<block_size, false><<<grid.num_blocks, block_size, 0, 0>>>(
-      in.size(),                                        // num_rows
-      in_offsets.head<size_type>() + in.offset(),       // offsets_in
-      offsets_buf,                                      // offsets_out
-      0,                                                // validity_in_offset
-      nullptr,                                          // validity_in
-      nullptr,                                          // validity_out
-      split_info.chars_offset,                          // offset_shift
-      split_info.num_chars,                             // num_chars
-      in_chars.head<char>() + split_info.chars_offset,  // chars_in
-      chars_buf);
+  constexpr size_type word_bits = detail::size_in_bits<bitmask_type>();
+  auto const src                = static_cast<bitmask_type const*>(task.src);
+  auto const dst                = static_cast<bitmask_type*>(task.dst);
+
+  size_type valid_count = 0;
+  for (auto w = task.begin + static_cast<size_type>(threadIdx.x); w < task.end; w += block_size) {
+    auto const rows      = min(task.num_rows - w * word_bits, word_bits);
+    auto const first_bit = task.src_bit_offset + w * word_bits;
+    auto const shift     = intra_word_index(first_bit);
+    bitmask_type word    = src[word_index(first_bit)];
+    if (shift + rows > word_bits) {
+      word = __funnelshift_r(word, src[word_index(first_bit) + 1], shift);
+    } else {
+      word >>= shift;
+    }
+    if (rows < word_bits) { word &= set_least_significant_bits(rows); }
+    dst[w] = word;
+    valid_count += __popc(word);
   }
 
-  // output child columns
-  column_view out_offsets{in_offsets.type(), num_offsets, offsets_buf};
-  column_view out_chars{in_chars.type(), static_cast<size_type>(split_info.num_chars), chars_buf};
+  using BlockReduce = cub::BlockReduce<size_type, block_size>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  size_type const block_count{BlockReduce(temp_storage).Sum(valid_count)};
+  if (threadIdx.x == 0) { atomicAdd(valid_counts + task.valid_count_index, block_count); }
+}
 
-  // result
-  out_cols.push_back(column_view(
-    in.type(), in.size(), nullptr, validity_buf, in.null_count(), 0, {out_offsets, out_chars}));
+/**
+ * @brief Copies the buffers of all columns of all partitions, one chunk per block.
+ */
+template <size_type block_size>
+__launch_bounds__(block_size) __global__
+  void copy_partitions_kernel(copy_task const* __restrict__ tasks, size_type* valid_counts)
+{
+  auto const& task = tasks[blockIdx.x];
+  switch (task.element_size) {
+    case 0: copy_validity<block_size>(task, valid_counts); break;
+    case 1: copy_elements<int8_t>(task); break;
+    case 2: copy_elements<int16_t>(task); break;
+    case 4:
+      if (task.is_offsets) {
+        copy_offsets(task);
+      } else {
+        copy_elements<int32_t>(task);
+      }
+      break;
+    case 8: copy_elements<int64_t>(task); break;
+    default: {
+      // any other element size is copied bytewise
+      copy_task bytes = task;
+      bytes.begin     = task.begin * task.element_size;
+      bytes.end       = task.end * task.element_size;
+      copy_elements<int8_t>(bytes);
+    }
+  }
 }
 
 /**
- * @brief Information about a string column in a table view.
- *
- * Used internally by preprocess_string_column_info as part of a device-accessible
- * vector for computing final string information in a single kernel call.
+ * @brief Position of the buffers of a column within the output buffer of a partition.
  */
-struct column_preprocess_info {
-  size_type index;
-  size_type offset;
-  size_type size;
-  bool has_nulls;
-  cudf::column_device_view offsets;
+struct dst_column_info {
+  size_t validity_pos;
+  size_t data_pos;
+  size_type valid_count_index;  // index of the valid count of a nullable column
 };
 
 /**
- * @brief Preprocess information about all strings columns in a table view.
- *
- * In order to minimize how often we touch the gpu, we need to preprocess various pieces of
- * information about the string columns in a table as a batch process.  This function builds a list
- * of the offset columns for all input string columns and computes this information with a single
- * thrust call.  In addition, the vector returned is allocated for -all- columns in the table so
- * further processing of non-string columns can happen afterwards.
- *
- * The key things this function avoids
- * - avoiding reaching into gpu memory on the cpu to retrieve offsets to compute string sizes.
- * - creating column_device_views on the base string_column_view itself as that causes gpu memory
- * allocation.
+ * @brief Appends the copy of rows `[0, num_elements)` of a buffer, in chunks of at most
+ * `copy_chunk_bytes`.
  */
-thrust::host_vector<column_split_info> preprocess_string_column_info(
-  cudf::table_view const& t,
-  rmm::device_vector<column_split_info>& device_split_info,
-  cudaStream_t stream)
+void add_copy_tasks(copy_task task, size_type num_elements, std::vector<copy_task>& tasks)
 {
-  // build a list of all the offset columns and their indices for all input string columns and put
-  // them on the gpu
-  thrust::host_vector<column_preprocess_info> offset_columns;
-  offset_columns.reserve(t.num_columns());  // worst case
-
-  // collect only string columns
-  size_type column_index = 0;
-  std::for_each(t.begin(), t.end(), [&offset_columns, &column_index](cudf::column_view const& c) {
-    if (c.type().id() == type_id::STRING) {
-      cudf::column_device_view cdv((strings_column_view(c)).offsets(), 0, 0);
-      offset_columns.push_back(
-        column_preprocess_info{column_index, c.offset(), c.size(), c.has_nulls(), cdv});
-    }
-    column_index++;
-  });
-  rmm::device_vector<column_preprocess_info> device_offset_columns = offset_columns;
-
-  // compute column split information
-  rmm::device_vector<thrust::pair<size_type, size_type>> device_offsets(t.num_columns());
-  auto* offsets_p = device_offsets.data().get();
-  thrust::for_each(rmm::exec_policy(stream)->on(stream),
-                   device_offset_columns.begin(),
-                   device_offset_columns.end(),
-                   [offsets_p] __device__(column_preprocess_info const& cpi) {
-                     offsets_p[cpi.index] =
-                       thrust::make_pair(cpi.offsets.head<int32_t>()[cpi.offset],
-                                         cpi.offsets.head<int32_t>()[cpi.offset + cpi.size]);
-                   });
-  thrust::host_vector<thrust::pair<size_type, size_type>> host_offsets(device_offsets);
-  thrust::host_vector<column_split_info> split_info(t.num_columns());
-  std::for_each(offset_columns.begin(),
-                offset_columns.end(),
-                [&split_info, &host_offsets](column_preprocess_info const& cpi) {
-                  int32_t offset_start = host_offsets[cpi.index].first;
-                  int32_t offset_end   = host_offsets[cpi.index].second;
-                  auto num_chars       = offset_end - offset_start;
-                  split_info[cpi.index].data_buf_size =
-                    cudf::util::round_up_safe(static_cast<size_t>(num_chars), split_align);
-                  split_info[cpi.index].validity_buf_size =
-                    cpi.has_nulls ? cudf::bitmask_allocation_size_bytes(cpi.size, split_align) : 0;
-                  split_info[cpi.index].offsets_buf_size =
-                    cudf::util::round_up_safe((cpi.size + 1) * sizeof(size_type), split_align);
-                  split_info[cpi.index].num_chars    = num_chars;
-                  split_info[cpi.index].chars_offset = offset_start;
-                });
-  return split_info;
+  size_t const element_size =
+    task.element_size == 0 ? sizeof(bitmask_type) : static_cast<size_t>(task.element_size);
+  size_type const chunk_size =
+    static_cast<size_type>(std::max(copy_chunk_bytes / element_size, size_t{1}));
+  for (size_type begin = 0; begin < num_elements; begin += chunk_size) {
+    task.begin = begin;
+    task.end   = std::min(begin + chunk_size, num_elements);
+    tasks.push_back(task);
+  }
 }
 
 /**
- * @brief Creates a contiguous_split_result object which contains a deep-copy of the input
- * table_view into a single contiguous block of memory.
- *
- * The table_view contained within the contiguous_split_result will pass an expect_tables_equal()
- * call with the input table.  The memory referenced by the table_view and its internal column_views
- * is entirely contained in single block of memory.
+ * @brief Returns the rows of the input table that start each partition, followed by the number
+ * of rows.
  */
-contiguous_split_result alloc_and_copy(cudf::table_view const& t,
-                                       rmm::device_vector<column_split_info>& device_split_info,
-                                       rmm::mr::device_memory_resource* mr,
-                                       cudaStream_t stream)
+std::vector<size_type> partition_bounds(table_view const& input,
+                                        std::vector<size_type> const& splits)
 {
-  // preprocess column split information for string columns.
-  thrust::host_vector<column_split_info> split_info =
-    preprocess_string_column_info(t, device_split_info, stream);
-
-  // compute the rest of the column sizes (non-string columns, and total buffer size)
-  size_t total_size      = 0;
-  size_type column_index = 0;
-  std::for_each(
-    t.begin(), t.end(), [&total_size, &column_index, &split_info](cudf::column_view const& c) {
-      total_size +=
-        cudf::type_dispatcher(c.type(), column_buffer_size_functor{}, c, split_info[column_index]);
-      column_index++;
-    });
-
-  // allocate
-  auto device_buf = std::make_unique<rmm::device_buffer>(total_size, stream, mr);
-  char* buf       = static_cast<char*>(device_buf->data());
-
-  // copy (this would be cleaner with a std::transform, but there's an nvcc compiler issue in the
-  // way)
-  std::vector<column_view> out_cols;
-  out_cols.reserve(t.num_columns());
-
-  column_index = 0;
-  std::for_each(
-    t.begin(), t.end(), [&out_cols, &buf, &column_index, &split_info](cudf::column_view const& c) {
-      cudf::type_dispatcher(
-        c.type(), column_copy_functor{}, c, split_info[column_index], buf, out_cols);
-      column_index++;
-    });
-
-  return contiguous_split_result{cudf::table_view{out_cols}, std::move(device_buf)};
+  auto const num_rows = input.num_rows();
+  if (splits.empty() || num_rows == 0) { return {0, num_rows}; }
+  CUDF_EXPECTS(splits.back() <= num_rows, "splits can't exceed size of input columns");
+
+  std::vector<size_type> bounds{0};
+  bounds.insert(bounds.end(), splits.begin(), splits.end());
+  bounds.push_back(num_rows);
+  for (size_t i = 1; i < bounds.size(); ++i) {
+    CUDF_EXPECTS(bounds[i - 1] >= 0, "Starting index cannot be negative.");
+    CUDF_EXPECTS(bounds[i] >= bounds[i - 1],
+                 "End index cannot be smaller than the starting index.");
+  }
+  return bounds;
 }
 
-};  // anonymous namespace
+/**
+ * @brief Builds the view of column `index` of `flat` and of its children in the output buffer
+ * of a partition, advancing `index` past them.
+ */
+column_view make_output_view(flattened_columns const& flat,
+                             row_range const* ranges,
+                             dst_column_info const* dst_info,
+                             char* buf,
+                             thrust::host_vector<size_type> const& valid_counts,
+                             size_type& index)
+{
+  auto const col       = flat.columns[index];
+  auto const rows      = ranges[index];
+  auto const dst       = dst_info[index];
+  auto const num_rows  = rows.end - rows.begin;
+  bool const has_data  = is_fixed_width(col.type()) && num_rows > 0;
+  bool const has_nulls = col.nullable() && num_rows > 0;
+  ++index;
+
+  std::vector<column_view> children;
+  for (size_type i = 0; i < col.num_children(); ++i) {
+    children.push_back(make_output_view(flat, ranges, dst_info, buf, valid_counts, index));
+  }
+  return column_view{
+    col.type(),
+    num_rows,
+    has_data ? buf + dst.data_pos : nullptr,
+    has_nulls ? reinterpret_cast<bitmask_type const*>(buf + dst.validity_pos) : nullptr,
+    has_nulls ? num_rows - valid_counts[dst.valid_count_index] : 0,
+    0,
+    children};
+}
+}  // anonymous namespace
 
 std::vector<contiguous_split_result> contiguous_split(cudf::table_view const& input,
                                                       std::vector<size_type> const& splits,
                                                       rmm::mr::device_memory_resource* mr,
                                                       cudaStream_t stream)
 {
-  auto subtables = cudf::split(input, splits);
+  if (input.num_columns() == 0) { return {}; }
+  auto const bounds              = partition_bounds(input, splits);
+  size_type const num_partitions = bounds.size() - 1;
+
+  // optimization : the number of kernel launches does not depend on the number of columns or
+  //                partitions. the rows of every (partition, column) pair are computed in one
+  //                pass, and every buffer of every partition is copied by a single kernel.
+  flattened_columns flat;
+  std::for_each(input.begin(), input.end(), [&flat](column_view const& col) {
+    flatten_column(col, row_source::PARENT, nullptr, {}, flat);
+  });
+  size_type const num_columns = flat.columns.size();
+
+  auto exec = rmm::exec_policy(stream);
+  rmm::device_vector<size_type> d_bounds(bounds);
+  rmm::device_vector<src_column_info> d_info(flat.info);
+  rmm::device_vector<size_type> d_paths(flat.paths);
+  rmm::device_vector<size_type> d_path_offsets(flat.path_offsets);
+  rmm::device_vector<row_range> d_ranges(num_partitions * num_columns);
+  thrust::for_each_n(exec->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     d_ranges.size(),
+                     compute_row_ranges{d_bounds.data().get(),
+                                        d_info.data().get(),
+                                        d_paths.data().get(),
+                                        d_path_offsets.data().get(),
+                                        num_columns,
+                                        d_ranges.data().get()});
+  thrust::host_vector<row_range> ranges(d_ranges);
+
+  // lay out the buffers of each partition and collect the copies into them
+  size_type num_nullable = 0;
+  std::vector<dst_column_info> dst_info(ranges.size());
+  std::vector<std::unique_ptr<rmm::device_buffer>> buffers;
+  std::vector<copy_task> tasks;
+  for (size_type p = 0; p < num_partitions; ++p) {
+    size_t total_size = 0;
+    for (size_type c = 0; c < num_columns; ++c) {
+      auto const& col     = flat.columns[c];
+      auto const num_rows = ranges[p * num_columns + c].end - ranges[p * num_columns + c].begin;
+      auto& dst           = dst_info[p * num_columns + c];
+      if (col.nullable()) {
+        dst.validity_pos      = total_size;
+        dst.valid_count_index = num_nullable++;
+        total_size += bitmask_allocation_size_bytes(num_rows, split_align);
+      }
+      if (is_fixed_width(col.type())) {
+        dst.data_pos = total_size;
+        total_size += util::round_up_safe(num_rows * size_of(col.type()), split_align);
+      }
+    }
+    buffers.push_back(std::make_unique<rmm::device_buffer>(total_size, stream, mr));
+
+    char* buf = static_cast<char*>(buffers.back()->data());
+    for (size_type c = 0; c < num_columns; ++c) {
+      auto const& col     = flat.columns[c];
+      auto const rows     = ranges[p * num_columns + c];
+      auto const num_rows = rows.end - rows.begin;
+      auto const& dst     = dst_info[p * num_columns + c];
+      if (num_rows == 0) { continue; }
+      if (col.nullable()) {
+        add_copy_tasks(copy_task{col.null_mask(),
+                                 buf + dst.validity_pos,
+                                 num_rows,
+                                 rows.begin,
+                                 0,
+                                 0,
+                                 0,
+                                 false,
+                                 dst.valid_count_index},
+                       num_bitmask_words(num_rows),
+                       tasks);
+      }
+      if (is_fixed_width(col.type())) {
+        auto const element_size = static_cast<int32_t>(size_of(col.type()));
+        bool const is_offsets   = flat.info[c].source == row_source::PARENT_OFFSETS;
+        add_copy_tasks(copy_task{col.head<char>() + static_cast<size_t>(rows.begin) * element_size,
+                                 buf + dst.data_pos,
+                                 num_rows,
+                                 0,
+                                 0,
+                                 0,
+                                 element_size,
+                                 is_offsets,
+                                 0},
+                       num_rows,
+                       tasks);
+      }
+    }
+  }
 
-  // optimization : for large numbers of splits this allocation can dominate total time
-  //                spent if done inside alloc_and_copy().  so we'll allocate it once
-  //                and reuse it.
-  //
-  //                benchmark:        1 GB data, 10 columns, 256 splits.
-  //                no optimization:  106 ms (8 GB/s)
-  //                optimization:     20 ms (48 GB/s)
-  rmm::device_vector<column_split_info> device_split_info(input.num_columns());
+  rmm::device_vector<size_type> d_valid_counts(num_nullable, 0);
+  if (not tasks.empty()) {
+    rmm::device_vector<copy_task> d_tasks(tasks);
+    constexpr size_type block_size = 256;
+    copy_partitions_kernel<block_size>
+      <<<d_tasks.size(), block_size, 0, stream>>>(d_tasks.data().get(),
+                                                  d_valid_counts.data().get());
+    CHECK_CUDA(stream);
+  }
+  thrust::host_vector<size_type> valid_counts(d_valid_counts);
 
   std::vector<contiguous_split_result> result;
-  std::transform(subtables.begin(),
-                 subtables.end(),
-                 std::back_inserter(result),
-                 [mr, stream, &device_split_info](table_view const& t) {
-                   return alloc_and_copy(t, device_split_info, mr, stream);
-                 });
-
+  for (size_type p = 0; p < num_partitions; ++p) {
+    char* buf = static_cast<char*>(buffers[p]->data());
+    std::vector<column_view> out_cols;
+    for (size_type c = 0; c < num_columns;) {
+      out_cols.push_back(make_output_view(flat,
+                                          ranges.data() + p * num_columns,
+                                          dst_info.data() + p * num_columns,
+                                          buf,
+                                          valid_counts,
+                                          c));
+    }
+    result.push_back(contiguous_split_result{cudf::table_view{out_cols}, std::move(buffers[p])});
+  }
   return result;
 }
 
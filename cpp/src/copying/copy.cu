@@ -14,12 +14,15 @@
  * limitations under the License.
  */
 
+#include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/copy_if_else.cuh>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/strings/string_view.cuh>
+#include <cudf/utilities/bit.hpp>
 
 namespace cudf {
 namespace detail {
@@ -135,6 +138,29 @@ struct copy_if_else_functor {
   }
 };
 
+// dispatch copy_if_else on the type of the inputs, for a filter of type `bool(size_type)`
+template <typename Left, typename Right, typename Filter>
+std::unique_ptr<column> dispatch_copy_if_else(Left const& lhs,
+                                              Right const& rhs,
+                                              bool left_nullable,
+                                              bool right_nullable,
+                                              size_type size,
+                                              Filter filter,
+                                              rmm::mr::device_memory_resource* mr,
+                                              cudaStream_t stream)
+{
+  return cudf::type_dispatcher(lhs.type(),
+                               copy_if_else_functor{},
+                               lhs,
+                               rhs,
+                               size,
+                               left_nullable,
+                               right_nullable,
+                               filter,
+                               mr,
+                               stream);
+}
+
 // wrap up boolean_mask into a filter lambda
 template <typename Left, typename Right>
 std::unique_ptr<column> copy_if_else(Left const& lhs,
@@ -158,33 +184,82 @@ std::unique_ptr<column> copy_if_else(Left const& lhs,
     auto filter = [bool_mask_device] __device__(cudf::size_type i) {
       return bool_mask_device.is_valid_nocheck(i) and bool_mask_device.element<bool>(i);
     };
-    return cudf::type_dispatcher(lhs.type(),
-                                 copy_if_else_functor{},
-                                 lhs,
-                                 rhs,
-                                 boolean_mask.size(),
-                                 left_nullable,
-                                 right_nullable,
-                                 filter,
-                                 mr,
-                                 stream);
+    return dispatch_copy_if_else(
+      lhs, rhs, left_nullable, right_nullable, boolean_mask.size(), filter, mr, stream);
   } else {
     auto filter = [bool_mask_device] __device__(cudf::size_type i) {
       return bool_mask_device.element<bool>(i);
     };
-    return cudf::type_dispatcher(lhs.type(),
-                                 copy_if_else_functor{},
-                                 lhs,
-                                 rhs,
-                                 boolean_mask.size(),
-                                 left_nullable,
-                                 right_nullable,
-                                 filter,
-                                 mr,
-                                 stream);
+    return dispatch_copy_if_else(
+      lhs, rhs, left_nullable, right_nullable, boolean_mask.size(), filter, mr, stream);
   }
 }
 
+// wrap up a bitmask condition into a bitmask_filter. Each warp of the copy_if_else kernel
+// handles 32 rows, whose bits one of its threads reads and aligns from the condition
+template <typename Left, typename Right>
+std::unique_ptr<column> copy_if_else(Left const& lhs,
+                                     Right const& rhs,
+                                     bool left_nullable,
+                                     bool right_nullable,
+                                     size_type size,
+                                     bitmask_type const* condition,
+                                     size_type condition_offset,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+{
+  CUDF_EXPECTS(lhs.type() == rhs.type(), "Both inputs must be of the same type");
+
+  if (size == 0) { return cudf::make_empty_column(lhs.type()); }
+
+  return dispatch_copy_if_else(lhs,
+                               rhs,
+                               left_nullable,
+                               right_nullable,
+                               size,
+                               bitmask_filter{condition, condition_offset, size},
+                               mr,
+                               stream);
+}
+
+std::unique_ptr<column> copy_all(column_view const& input,
+                                 size_type,
+                                 rmm::mr::device_memory_resource* mr,
+                                 cudaStream_t stream)
+{
+  return std::make_unique<column>(input, stream, mr);
+}
+
+std::unique_ptr<column> copy_all(scalar const& input,
+                                 size_type size,
+                                 rmm::mr::device_memory_resource* mr,
+                                 cudaStream_t stream)
+{
+  return make_column_from_scalar(input, size, mr, stream);
+}
+
+// a bitmask condition selecting all or none of the rows is a bulk copy of one of the inputs.
+// Returns nullptr for any other condition
+template <typename Left, typename Right>
+std::unique_ptr<column> copy_if_uniform(Left const& lhs,
+                                        Right const& rhs,
+                                        size_type size,
+                                        bitmask_type const* condition,
+                                        size_type condition_offset,
+                                        rmm::mr::device_memory_resource* mr,
+                                        cudaStream_t stream)
+{
+  CUDF_EXPECTS(lhs.type() == rhs.type(), "Both inputs must be of the same type");
+  if (size == 0) { return nullptr; }
+  auto const selected =
+    condition == nullptr
+      ? size
+      : count_set_bits(condition, condition_offset, condition_offset + size, stream);
+  if (selected == size) { return copy_all(lhs, size, mr, stream); }
+  if (selected == 0) { return copy_all(rhs, size, mr, stream); }
+  return nullptr;
+}
+
 };  // namespace
 
 std::unique_ptr<column> copy_if_else(column_view const& lhs,
@@ -248,6 +323,70 @@ std::unique_ptr<column> copy_if_else(scalar const& lhs,
   return copy_if_else(lhs, rhs, !lhs.is_valid(), !rhs.is_valid(), boolean_mask, mr, stream);
 }
 
+std::unique_ptr<column> copy_if_else(column_view const& lhs,
+                                     column_view const& rhs,
+                                     bitmask_type const* condition,
+                                     size_type condition_offset,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+{
+  CUDF_EXPECTS(lhs.size() == rhs.size(), "Both columns must be of the size");
+  if (auto copy = copy_if_uniform(lhs, rhs, lhs.size(), condition, condition_offset, mr, stream)) {
+    return copy;
+  }
+  return copy_if_else(*column_device_view::create(lhs),
+                      *column_device_view::create(rhs),
+                      lhs.has_nulls(),
+                      rhs.has_nulls(),
+                      lhs.size(),
+                      condition,
+                      condition_offset,
+                      mr,
+                      stream);
+}
+
+std::unique_ptr<column> copy_if_else(scalar const& lhs,
+                                     column_view const& rhs,
+                                     bitmask_type const* condition,
+                                     size_type condition_offset,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+{
+  if (auto copy = copy_if_uniform(lhs, rhs, rhs.size(), condition, condition_offset, mr, stream)) {
+    return copy;
+  }
+  return copy_if_else(lhs,
+                      *column_device_view::create(rhs),
+                      !lhs.is_valid(),
+                      rhs.has_nulls(),
+                      rhs.size(),
+                      condition,
+                      condition_offset,
+                      mr,
+                      stream);
+}
+
+std::unique_ptr<column> copy_if_else(column_view const& lhs,
+                                     scalar const& rhs,
+                                     bitmask_type const* condition,
+                                     size_type condition_offset,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+{
+  if (auto copy = copy_if_uniform(lhs, rhs, lhs.size(), condition, condition_offset, mr, stream)) {
+    return copy;
+  }
+  return copy_if_else(*column_device_view::create(lhs),
+                      rhs,
+                      lhs.has_nulls(),
+                      !rhs.is_valid(),
+                      lhs.size(),
+                      condition,
+                      condition_offset,
+                      mr,
+                      stream);
+}
+
 };  // namespace detail
 
 std::unique_ptr<column> copy_if_else(column_view const& lhs,
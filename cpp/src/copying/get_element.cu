@@ -15,13 +15,25 @@
  */
 
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/valid_if.cuh>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/scalar/scalar_factories.hpp>
 
 #include <cudf/detail/utilities/cuda.cuh>
 
+#include <io/utilities/hostdevice_vector.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+#include <numeric>
+
 namespace cudf {
 namespace detail {
 
@@ -116,8 +128,144 @@ struct get_element_functor {
   }
 };
 
+struct scalar_data_functor {
+  template <typename T, std::enable_if_t<is_fixed_width<T>()> *p = nullptr>
+  void const *operator()(scalar const &s)
+  {
+    return static_cast<detail::fixed_width_scalar<T> const &>(s).data();
+  }
+
+  template <typename T, std::enable_if_t<not is_fixed_width<T>()> *p = nullptr>
+  void const *operator()(scalar const &)
+  {
+    CUDF_FAIL("Only fixed-width scalars are supported");
+  }
+};
+
+size_t round_up_8(size_t bytes) { return (bytes + 7) / 8 * 8; }
+
 }  // namespace
 
+host_elements get_elements(column_view const &input,
+                           std::vector<size_type> const &indices,
+                           cudaStream_t stream)
+{
+  CUDF_EXPECTS(is_fixed_width(input.type()), "get_elements supports only fixed-width types");
+  CUDF_EXPECTS(std::all_of(indices.begin(),
+                           indices.end(),
+                           [size = input.size()](auto i) { return i >= 0 and i < size; }),
+               "Index out of bounds");
+
+  auto const num_elements = indices.size();
+  auto const element_size = static_cast<size_type>(size_of(input.type()));
+  host_elements result{input.type(),
+                       std::vector<uint8_t>(num_elements * element_size),
+                       std::vector<bool>(num_elements)};
+  if (num_elements == 0) { return result; }
+
+  // One staging buffer holds the indices, followed by the values and their validity, so the
+  // indices are copied to the device and the elements back by a single transfer each
+  auto const indices_size = round_up_8(num_elements * sizeof(size_type));
+  auto const values_size  = round_up_8(num_elements * element_size);
+  hostdevice_vector<uint8_t> staging(indices_size + values_size + num_elements, stream);
+  std::memcpy(staging.host_ptr(), indices.data(), num_elements * sizeof(size_type));
+  CUDA_TRY(cudaMemcpyAsync(staging.device_ptr(),
+                           staging.host_ptr(),
+                           indices_size,
+                           cudaMemcpyHostToDevice,
+                           stream));
+
+  auto d_input = column_device_view::create(input, stream);
+  thrust::for_each_n(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    num_elements,
+    [d_input    = *d_input,
+     d_indices  = reinterpret_cast<size_type const *>(staging.device_ptr()),
+     d_values   = staging.device_ptr(indices_size),
+     d_validity = staging.device_ptr(indices_size + values_size),
+     element_size] __device__(size_type i) {
+      auto const index  = d_indices[i];
+      auto const source = d_input.head<uint8_t>() + (d_input.offset() + index) * element_size;
+      for (size_type b = 0; b < element_size; ++b) { d_values[i * element_size + b] = source[b]; }
+      d_validity[i] = d_input.is_valid(index);
+    });
+
+  CUDA_TRY(cudaMemcpyAsync(staging.host_ptr(indices_size),
+                           staging.device_ptr(indices_size),
+                           values_size + num_elements,
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  std::copy(staging.host_ptr(indices_size),
+            staging.host_ptr(indices_size) + num_elements * element_size,
+            result.data.begin());
+  std::transform(staging.host_ptr(indices_size + values_size),
+                 staging.host_ptr(indices_size + values_size) + num_elements,
+                 result.validity.begin(),
+                 [](uint8_t valid) { return valid != 0; });
+  return result;
+}
+
+std::unique_ptr<column> make_column_from_scalars(
+  std::vector<std::reference_wrapper<scalar const>> const &scalars,
+  rmm::mr::device_memory_resource *mr,
+  cudaStream_t stream)
+{
+  CUDF_EXPECTS(not scalars.empty(), "No scalars to make a column from");
+  auto const type = scalars.front().get().type();
+  CUDF_EXPECTS(is_fixed_width(type), "Only fixed-width scalars are supported");
+  CUDF_EXPECTS(std::all_of(scalars.begin(),
+                           scalars.end(),
+                           [type](auto const &s) { return s.get().type() == type; }),
+               "The scalars must be of the same type");
+
+  // The addresses of the values, followed by those of the validities
+  auto const num_rows = static_cast<size_type>(scalars.size());
+  hostdevice_vector<void const *> pointers(2 * scalars.size(), stream);
+  for (size_type i = 0; i < num_rows; ++i) {
+    auto const &s          = scalars[i].get();
+    pointers[i]            = type_dispatcher(type, scalar_data_functor{}, s);
+    pointers[num_rows + i] = s.validity_data();
+  }
+  CUDA_TRY(cudaMemcpyAsync(pointers.device_ptr(),
+                           pointers.host_ptr(),
+                           pointers.memory_size(),
+                           cudaMemcpyHostToDevice,
+                           stream));
+
+  auto result = make_fixed_width_column(type, num_rows, mask_state::UNALLOCATED, stream, mr);
+  rmm::device_vector<bool> validity(num_rows);
+  thrust::for_each_n(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    num_rows,
+    [d_pointers   = pointers.device_ptr(),
+     d_values     = result->mutable_view().head<uint8_t>(),
+     d_validity   = validity.data().get(),
+     element_size = static_cast<size_type>(size_of(type)),
+     num_rows] __device__(size_type i) {
+      auto const source = static_cast<uint8_t const *>(d_pointers[i]);
+      for (size_type b = 0; b < element_size; ++b) { d_values[i * element_size + b] = source[b]; }
+      d_validity[i] = *static_cast<bool const *>(d_pointers[num_rows + i]);
+    });
+
+  auto null_mask = valid_if(validity.begin(), validity.end(), thrust::identity<bool>{}, stream, mr);
+  if (null_mask.second > 0) { result->set_null_mask(std::move(null_mask.first), null_mask.second); }
+  return result;
+}
+
+host_elements get_elements(std::vector<std::reference_wrapper<scalar const>> const &scalars,
+                           cudaStream_t stream)
+{
+  if (scalars.empty()) { return host_elements{data_type{type_id::EMPTY}, {}, {}}; }
+  auto const values = make_column_from_scalars(scalars, rmm::mr::get_default_resource(), stream);
+  std::vector<size_type> indices(scalars.size());
+  std::iota(indices.begin(), indices.end(), 0);
+  return get_elements(values->view(), indices, stream);
+}
+
 std::unique_ptr<scalar> get_element(column_view const &input,
                                     size_type index,
                                     cudaStream_t stream,
@@ -136,4 +284,16 @@ std::unique_ptr<scalar> get_element(column_view const &input,
   return detail::get_element(input, index, 0, mr);
 }
 
+host_elements get_elements(column_view const &input, std::vector<size_type> const &indices)
+{
+  CUDF_FUNC_RANGE();
+  return detail::get_elements(input, indices);
+}
+
+host_elements get_elements(std::vector<std::reference_wrapper<scalar const>> const &scalars)
+{
+  CUDF_FUNC_RANGE();
+  return detail::get_elements(scalars);
+}
+
 }  // namespace cudf
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace cudf {
+namespace detail {
+namespace {
+// identifies the metadata of a packed table
+constexpr uint32_t packed_magic   = 0x43554446;  // "CUDF"
+constexpr uint32_t packed_version = 1;
+
+/**
+ * @brief Header of the metadata of a packed table.
+ */
+struct serialized_header {
+  uint32_t magic;
+  uint32_t version;
+  size_type num_columns;
+};
+
+/**
+ * @brief Metadata of a packed column. The columns are serialized with parents ahead of their
+ * children.
+ *
+ * The positions of the data and the null mask are relative to the start of the device buffer,
+ * or -1 if the column has none.
+ */
+struct serialized_column {
+  type_id id;
+  size_type size;
+  size_type null_count;
+  size_type offset;
+  int64_t data_position;
+  int64_t null_mask_position;
+  size_type num_children;
+};
+
+template <typename T>
+void append(std::vector<uint8_t>& metadata, T const& value)
+{
+  auto const bytes = reinterpret_cast<uint8_t const*>(&value);
+  metadata.insert(metadata.end(), bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+T read(uint8_t const*& metadata)
+{
+  T value;
+  std::memcpy(&value, metadata, sizeof(T));
+  metadata += sizeof(T);
+  return value;
+}
+
+void serialize_column(column_view const& col,
+                      uint8_t const* base,
+                      size_t buffer_size,
+                      std::vector<uint8_t>& metadata)
+{
+  auto position = [base, buffer_size](void const* ptr) -> int64_t {
+    if (ptr == nullptr) { return -1; }
+    auto const pos = static_cast<uint8_t const*>(ptr) - base;
+    CUDF_EXPECTS(pos >= 0 && static_cast<size_t>(pos) <= buffer_size,
+                 "Column data is not in the contiguous buffer");
+    return pos;
+  };
+  append(metadata,
+         serialized_column{col.type().id(),
+                           col.size(),
+                           col.null_count(),
+                           col.offset(),
+                           position(col.head()),
+                           position(col.null_mask()),
+                           col.num_children()});
+  for (size_type i = 0; i < col.num_children(); ++i) {
+    serialize_column(col.child(i), base, buffer_size, metadata);
+  }
+}
+
+column_view deserialize_column(uint8_t const*& metadata, uint8_t const* base)
+{
+  auto const col = read<serialized_column>(metadata);
+  std::vector<column_view> children;
+  for (size_type i = 0; i < col.num_children; ++i) {
+    children.push_back(deserialize_column(metadata, base));
+  }
+  return column_view{
+    data_type{col.id},
+    col.size,
+    col.data_position < 0 ? nullptr : base + col.data_position,
+    col.null_mask_position < 0
+      ? nullptr
+      : reinterpret_cast<bitmask_type const*>(base + col.null_mask_position),
+    col.null_count,
+    col.offset,
+    children};
+}
+}  // namespace
+
+packed_columns pack(cudf::table_view const& input,
+                    rmm::mr::device_memory_resource* mr,
+                    cudaStream_t stream)
+{
+  if (input.num_columns() == 0) {
+    return packed_columns{
+      std::make_unique<std::vector<uint8_t>>(pack_metadata(input, nullptr, 0)),
+      std::make_unique<rmm::device_buffer>(0, stream, mr)};
+  }
+  auto contiguous = std::move(contiguous_split(input, {}, mr, stream).front());
+  auto metadata   = pack_metadata(
+    contiguous.table, contiguous.all_data->data(), contiguous.all_data->size());
+  return packed_columns{std::make_unique<std::vector<uint8_t>>(std::move(metadata)),
+                        std::move(contiguous.all_data)};
+}
+}  // namespace detail
+
+packed_columns pack(cudf::table_view const& input, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::pack(input, mr);
+}
+
+std::vector<uint8_t> pack_metadata(table_view const& table,
+                                   void const* contiguous_buffer,
+                                   size_t buffer_size)
+{
+  CUDF_FUNC_RANGE();
+  std::vector<uint8_t> metadata;
+  detail::append(metadata,
+                 detail::serialized_header{
+                   detail::packed_magic, detail::packed_version, table.num_columns()});
+  std::for_each(table.begin(), table.end(), [&](column_view const& col) {
+    detail::serialize_column(
+      col, static_cast<uint8_t const*>(contiguous_buffer), buffer_size, metadata);
+  });
+  return metadata;
+}
+
+table_view unpack(packed_columns const& input)
+{
+  CUDF_EXPECTS(input.metadata != nullptr && input.gpu_data != nullptr, "Invalid packed columns");
+  CUDF_EXPECTS(input.metadata->size() >= sizeof(detail::serialized_header),
+               "Invalid packed metadata");
+  return unpack(input.metadata->data(), input.gpu_data->data());
+}
+
+table_view unpack(uint8_t const* metadata, void const* gpu_data)
+{
+  CUDF_FUNC_RANGE();
+  auto const header = detail::read<detail::serialized_header>(metadata);
+  CUDF_EXPECTS(header.magic == detail::packed_magic, "Invalid packed metadata");
+  CUDF_EXPECTS(header.version == detail::packed_version, "Unsupported packed metadata version");
+
+  std::vector<column_view> columns;
+  for (size_type i = 0; i < header.num_columns; ++i) {
+    columns.push_back(
+      detail::deserialize_column(metadata, static_cast<uint8_t const*>(gpu_data)));
+  }
+  return table_view{columns};
+}
+
+}  // namespace cudf
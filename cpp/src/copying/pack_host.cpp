@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <numeric>
+
+namespace cudf {
+namespace detail {
+namespace {
+// same alignment as the buffers of `contiguous_split`, so that the copy on the device is aligned
+constexpr size_t host_split_align = 64;
+
+/**
+ * @brief The buffers of a column being built on the host, always with a zero offset. The column
+ * has a null mask if `null_mask` is not empty.
+ */
+struct host_column {
+  data_type type;
+  size_type size{0};
+  size_type null_count{0};
+  std::vector<uint8_t> data;
+  std::vector<bitmask_type> null_mask;
+  std::vector<host_column> children;
+};
+
+/**
+ * @brief Copies `count` bits of `source` from `source_begin` to `target` at `target_begin`, a null
+ * `source` being all valid.
+ *
+ * @return The number of unset bits copied
+ */
+size_type copy_bits(bitmask_type const* source,
+                    size_type source_begin,
+                    bitmask_type* target,
+                    size_type target_begin,
+                    size_type count)
+{
+  size_type unset = 0;
+  for (size_type i = 0; i < count; ++i) {
+    if (source == nullptr || bit_is_set(source, source_begin + i)) {
+      set_bit_unsafe(target, target_begin + i);
+    } else {
+      clear_bit_unsafe(target, target_begin + i);
+      ++unset;
+    }
+  }
+  return unset;
+}
+
+host_column make_offsets(size_type const* offsets, size_type size)
+{
+  host_column out;
+  out.type = data_type{type_id::INT32};
+  out.size = size + 1;
+  out.data.resize(out.size * sizeof(size_type));
+  auto const rebased = reinterpret_cast<size_type*>(out.data.data());
+  std::transform(
+    offsets, offsets + out.size, rebased, [base = offsets[0]](size_type o) { return o - base; });
+  return out;
+}
+
+/**
+ * @brief Copies the rows `[begin, end)` of a host column view
+ */
+host_column slice_column(column_view const& col, size_type begin, size_type end)
+{
+  host_column out;
+  out.type         = col.type();
+  out.size         = end - begin;
+  auto const first = col.offset() + begin;
+  if (col.nullable()) {
+    out.null_mask.resize(num_bitmask_words(out.size));
+    out.null_count = copy_bits(col.null_mask(), first, out.null_mask.data(), 0, out.size);
+  }
+
+  switch (col.type().id()) {
+    case type_id::EMPTY: out.null_count = out.size; break;
+    case type_id::STRING:
+    case type_id::LIST: {
+      // empty string and list columns have no children
+      if (out.size == 0 || col.num_children() == 0) { break; }
+      auto const offsets = col.child(0).data<size_type>() + first;
+      out.children.push_back(make_offsets(offsets, out.size));
+      out.children.push_back(slice_column(col.child(1), offsets[0], offsets[out.size]));
+      break;
+    }
+    case type_id::DICTIONARY32: {
+      if (col.num_children() == 0) { break; }
+      out.children.push_back(slice_column(col.child(0), first, first + out.size));
+      out.children.push_back(slice_column(col.child(1), 0, col.child(1).size()));
+      break;
+    }
+    default: {
+      CUDF_EXPECTS(is_fixed_width(col.type()), "Unsupported column type for a host slice");
+      auto const width = size_of(col.type());
+      auto const data  = static_cast<uint8_t const*>(col.head()) + first * width;
+      out.data.assign(data, data + out.size * width);
+    }
+  }
+  return out;
+}
+
+/**
+ * @brief Concatenates columns built by `slice_column`
+ */
+host_column concatenate_columns(std::vector<host_column const*> const& pieces)
+{
+  auto const type = pieces.front()->type;
+  CUDF_EXPECTS(std::all_of(pieces.begin(),
+                           pieces.end(),
+                           [type](host_column const* piece) { return piece->type == type; }),
+               "Type mismatch in columns to concatenate");
+  auto const total_size = std::accumulate(
+    pieces.begin(), pieces.end(), size_t{0}, [](size_t sum, host_column const* piece) {
+      return sum + piece->size;
+    });
+  CUDF_EXPECTS(total_size <= static_cast<size_t>(std::numeric_limits<size_type>::max()),
+               "Total number of concatenated rows exceeds size_type range");
+
+  host_column out;
+  out.type = type;
+  out.size = static_cast<size_type>(total_size);
+  if (std::any_of(pieces.begin(), pieces.end(), [](host_column const* piece) {
+        return not piece->null_mask.empty();
+      })) {
+    out.null_mask.resize(num_bitmask_words(out.size));
+    size_type position = 0;
+    for (auto piece : pieces) {
+      auto const mask = piece->null_mask.empty() ? nullptr : piece->null_mask.data();
+      out.null_count += copy_bits(mask, 0, out.null_mask.data(), position, piece->size);
+      position += piece->size;
+    }
+  }
+
+  switch (type.id()) {
+    case type_id::EMPTY: out.null_count = out.size; break;
+    case type_id::STRING:
+    case type_id::LIST: {
+      std::vector<host_column const*> children;
+      std::vector<size_type> offsets{0};
+      for (auto piece : pieces) {
+        if (piece->size == 0) { continue; }
+        auto const piece_offsets =
+          reinterpret_cast<size_type const*>(piece->children[0].data.data());
+        auto const shift = offsets.back();
+        std::transform(piece_offsets + 1,
+                       piece_offsets + piece->size + 1,
+                       std::back_inserter(offsets),
+                       [shift](size_type o) { return o + shift; });
+        children.push_back(&piece->children[1]);
+      }
+      if (children.empty()) { break; }
+      out.children.push_back(make_offsets(offsets.data(), out.size));
+      out.children.push_back(concatenate_columns(children));
+      break;
+    }
+    case type_id::DICTIONARY32: CUDF_FAIL("Dictionary columns cannot be concatenated on the host");
+    default:
+      for (auto piece : pieces) {
+        out.data.insert(out.data.end(), piece->data.begin(), piece->data.end());
+      }
+  }
+  return out;
+}
+
+size_t buffers_size(host_column const& col)
+{
+  auto size = util::round_up_safe(col.data.size(), host_split_align);
+  if (not col.null_mask.empty()) {
+    size += bitmask_allocation_size_bytes(col.size, host_split_align);
+  }
+  return std::accumulate(
+    col.children.begin(), col.children.end(), size, [](size_t sum, host_column const& child) {
+      return sum + buffers_size(child);
+    });
+}
+
+/**
+ * @brief Copies the buffers of a column into `base` from `position`, and returns a view of them
+ */
+column_view write_column(host_column const& col, uint8_t* base, size_t& position)
+{
+  void const* data = nullptr;
+  if (not col.data.empty()) {
+    std::memcpy(base + position, col.data.data(), col.data.size());
+    data = base + position;
+    position += util::round_up_safe(col.data.size(), host_split_align);
+  }
+  bitmask_type const* null_mask = nullptr;
+  if (not col.null_mask.empty()) {
+    std::memcpy(base + position, col.null_mask.data(), col.null_mask.size() * sizeof(bitmask_type));
+    null_mask = reinterpret_cast<bitmask_type const*>(base + position);
+    position += bitmask_allocation_size_bytes(col.size, host_split_align);
+  }
+  std::vector<column_view> children;
+  for (auto const& child : col.children) {
+    children.push_back(write_column(child, base, position));
+  }
+  return column_view{col.type, col.size, data, null_mask, col.null_count, 0, children};
+}
+
+packed_host_columns make_packed_host_columns(std::vector<host_column> const& columns)
+{
+  auto const size = std::accumulate(
+    columns.begin(), columns.end(), size_t{0}, [](size_t sum, host_column const& col) {
+      return sum + buffers_size(col);
+    });
+  auto host_data = std::make_unique<std::vector<uint8_t>>(size);
+
+  size_t position = 0;
+  std::vector<column_view> views;
+  for (auto const& col : columns) {
+    views.push_back(write_column(col, host_data->data(), position));
+  }
+  auto metadata = pack_metadata(table_view{views}, host_data->data(), host_data->size());
+  return packed_host_columns{std::make_unique<std::vector<uint8_t>>(std::move(metadata)),
+                             std::move(host_data)};
+}
+}  // namespace
+
+packed_host_columns pack_to_host(cudf::table_view const& input,
+                                 rmm::mr::device_memory_resource* mr,
+                                 cudaStream_t stream)
+{
+  auto packed    = pack(input, mr, stream);
+  auto host_data = std::make_unique<std::vector<uint8_t>>(packed.gpu_data->size());
+  CUDA_TRY(cudaMemcpyAsync(host_data->data(),
+                           packed.gpu_data->data(),
+                           host_data->size(),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  // the metadata records positions relative to the start of the buffer, so it is unchanged
+  return packed_host_columns{std::move(packed.metadata), std::move(host_data)};
+}
+
+packed_columns copy_to_device(packed_host_columns const& input,
+                              rmm::mr::device_memory_resource* mr,
+                              cudaStream_t stream)
+{
+  CUDF_EXPECTS(input.metadata != nullptr && input.host_data != nullptr,
+               "Invalid packed host columns");
+  auto gpu_data = std::make_unique<rmm::device_buffer>(
+    input.host_data->data(), input.host_data->size(), stream, mr);
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  return packed_columns{std::make_unique<std::vector<uint8_t>>(*input.metadata),
+                        std::move(gpu_data)};
+}
+}  // namespace detail
+
+packed_host_columns pack_to_host(cudf::table_view const& input,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::pack_to_host(input, mr);
+}
+
+packed_columns copy_to_device(packed_host_columns const& input,
+                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::copy_to_device(input, mr);
+}
+
+table_view unpack(packed_host_columns const& input)
+{
+  CUDF_EXPECTS(input.metadata != nullptr && input.host_data != nullptr,
+               "Invalid packed host columns");
+  return unpack(input.metadata->data(), input.host_data->data());
+}
+
+packed_host_columns host_slice(packed_host_columns const& input, size_type begin, size_type end)
+{
+  CUDF_FUNC_RANGE();
+  auto const table = unpack(input);
+  CUDF_EXPECTS(begin >= 0, "Invalid beginning of range.");
+  CUDF_EXPECTS(begin <= end, "Invalid end of range.");
+  CUDF_EXPECTS(end <= table.num_rows(), "Slice range out of bounds.");
+
+  std::vector<detail::host_column> columns;
+  for (auto const& col : table) {
+    columns.push_back(detail::slice_column(col, begin, end));
+  }
+  return detail::make_packed_host_columns(columns);
+}
+
+packed_host_columns host_concatenate(std::vector<packed_host_columns> const& inputs)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(not inputs.empty(), "Need at least one table to concatenate");
+
+  // compact the columns of each table first, so that they all have a zero offset
+  std::vector<std::vector<detail::host_column>> tables;
+  for (auto const& input : inputs) {
+    auto const table = unpack(input);
+    CUDF_EXPECTS(tables.empty() || static_cast<size_t>(table.num_columns()) ==
+                                     tables.front().size(),
+                 "Mismatch in table columns to concatenate.");
+    std::vector<detail::host_column> columns;
+    for (auto const& col : table) {
+      columns.push_back(detail::slice_column(col, 0, col.size()));
+    }
+    tables.push_back(std::move(columns));
+  }
+
+  std::vector<detail::host_column> columns;
+  for (size_t i = 0; i < tables.front().size(); ++i) {
+    std::vector<detail::host_column const*> pieces;
+    for (auto const& table : tables) {
+      pieces.push_back(&table[i]);
+    }
+    columns.push_back(detail::concatenate_columns(pieces));
+  }
+  return detail::make_packed_host_columns(columns);
+}
+
+}  // namespace cudf
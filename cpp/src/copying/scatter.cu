@@ -22,6 +22,7 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/scatter.cuh>
 #include <cudf/detail/scatter.hpp>
+#include <cudf/detail/sequence.cuh>
 #include <cudf/detail/stream_compaction.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/lists/list_view.cuh>
@@ -32,7 +33,6 @@
 #include <cudf/utilities/traits.hpp>
 
 #include <thrust/iterator/counting_iterator.h>
-#include <thrust/sequence.h>
 #include <numeric>
 
 namespace cudf {
@@ -327,14 +327,8 @@ std::unique_ptr<column> boolean_mask_scatter(column_view const& input,
                                              rmm::mr::device_memory_resource* mr,
                                              cudaStream_t stream)
 {
-  auto indices = cudf::make_numeric_column(
-    data_type{type_id::INT32}, target.size(), mask_state::UNALLOCATED, stream);
-  auto mutable_indices = indices->mutable_view();
-
-  thrust::sequence(rmm::exec_policy(stream)->on(stream),
-                   mutable_indices.begin<size_type>(),
-                   mutable_indices.end<size_type>(),
-                   0);
+  auto indices = affine_sequence<size_type>{0, 1, target.size()}.materialize(
+    rmm::mr::get_default_resource(), stream);
 
   // The scatter map is actually a table with only one column, which is scatter map.
   auto scatter_map = detail::apply_boolean_mask(
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/aggregation/aggregation.cuh>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/scatter.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+/**
+ * @brief Converts a scatter map to indices of target rows, where out of bounds indices are -1
+ */
+struct scatter_map_normalizer {
+  template <typename MapType, std::enable_if_t<is_index_type<MapType>()>* = nullptr>
+  rmm::device_vector<size_type> operator()(column_view const& scatter_map,
+                                           size_type target_rows,
+                                           cudaStream_t stream)
+  {
+    rmm::device_vector<size_type> indices(scatter_map.size());
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      scatter_map.begin<MapType>(),
+                      scatter_map.end<MapType>(),
+                      indices.begin(),
+                      [target_rows] __device__(MapType map_index) {
+                        auto const index = static_cast<int64_t>(map_index);
+                        if (index < -target_rows or index >= target_rows) { return size_type{-1}; }
+                        return static_cast<size_type>(index < 0 ? index + target_rows : index);
+                      });
+    return indices;
+  }
+
+  template <typename MapType, std::enable_if_t<not is_index_type<MapType>()>* = nullptr>
+  rmm::device_vector<size_type> operator()(column_view const&, size_type, cudaStream_t)
+  {
+    CUDF_FAIL("Scatter map must be an integral type.");
+  }
+};
+
+/**
+ * @brief Resets the null rows of `result` to the identity of the aggregation `k`
+ */
+template <typename Target, aggregation::Kind k>
+void reset_null_rows(mutable_column_device_view result, cudaStream_t stream)
+{
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     result.size(),
+                     [result] __device__(size_type i) mutable {
+                       if (result.is_null(i)) {
+                         result.element<Target>(i) =
+                           corresponding_operator_t<k>::template identity<Target>();
+                       }
+                     });
+}
+
+/**
+ * @brief Reduces each element of `source` into the row of `result` it is mapped to
+ */
+template <typename Source, aggregation::Kind k, bool target_has_nulls, bool source_has_nulls>
+void reduce_into_targets(column_device_view source,
+                         size_type const* indices,
+                         mutable_column_device_view result,
+                         cudaStream_t stream)
+{
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     source.size(),
+                     [source, indices, result] __device__(size_type i) {
+                       if (indices[i] < 0) { return; }
+                       update_target_element<Source, k, target_has_nulls, source_has_nulls>{}(
+                         result, indices[i], source, i);
+                     });
+}
+
+/**
+ * @brief Nullifies the rows of `result` that null elements of `source` are mapped to
+ */
+void nullify_targets(column_device_view source,
+                     size_type const* indices,
+                     bitmask_type* result_mask,
+                     cudaStream_t stream)
+{
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     source.size(),
+                     [source, indices, result_mask] __device__(size_type i) {
+                       if (indices[i] >= 0 and source.is_null(i)) {
+                         clear_bit(result_mask, indices[i]);
+                       }
+                     });
+}
+
+template <typename Source, aggregation::Kind k>
+constexpr bool is_scatter_reduce_supported()
+{
+  return is_valid_aggregation<Source, k>() and
+         (((k == aggregation::SUM or k == aggregation::MIN or k == aggregation::MAX) and
+           std::is_arithmetic<Source>::value and not std::is_same<Source, bool>::value) or
+          ((k == aggregation::COUNT_VALID or k == aggregation::COUNT_ALL) and
+           is_fixed_width<Source>()));
+}
+
+struct scatter_reduce_functor {
+  template <typename Source,
+            aggregation::Kind k,
+            std::enable_if_t<is_scatter_reduce_supported<Source, k>()>* = nullptr>
+  void operator()(column_view const& source,
+                  size_type const* indices,
+                  mutable_column_view result,
+                  bool nullify,
+                  cudaStream_t stream)
+  {
+    using Target        = target_type_t<Source, k>;
+    auto const d_source = column_device_view::create(source, stream);
+    auto const d_result = mutable_column_device_view::create(result, stream);
+
+    // The null rows of the target start from the identity, and become valid with the first
+    // valid element reduced into them
+    if (result.nullable()) { reset_null_rows<Target, k>(*d_result, stream); }
+
+    if (result.nullable() and source.has_nulls()) {
+      reduce_into_targets<Source, k, true, true>(*d_source, indices, *d_result, stream);
+    } else if (result.nullable()) {
+      reduce_into_targets<Source, k, true, false>(*d_source, indices, *d_result, stream);
+    } else if (source.has_nulls()) {
+      reduce_into_targets<Source, k, false, true>(*d_source, indices, *d_result, stream);
+    } else {
+      reduce_into_targets<Source, k, false, false>(*d_source, indices, *d_result, stream);
+    }
+
+    // Only after all the reductions, which may set the target rows valid
+    if (nullify) { nullify_targets(*d_source, indices, result.null_mask(), stream); }
+  }
+
+  template <typename Source,
+            aggregation::Kind k,
+            std::enable_if_t<not is_scatter_reduce_supported<Source, k>()>* = nullptr>
+  void operator()(column_view const&, size_type const*, mutable_column_view, bool, cudaStream_t)
+  {
+    CUDF_FAIL("Unsupported aggregation for scatter_reduce");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> scatter_reduce(column_view const& source,
+                                       column_view const& scatter_map,
+                                       column_view const& target,
+                                       std::unique_ptr<aggregation> const& agg,
+                                       null_policy null_handling,
+                                       rmm::mr::device_memory_resource* mr,
+                                       cudaStream_t stream)
+{
+  CUDF_EXPECTS(not scatter_map.has_nulls(), "scatter_map contains nulls");
+  CUDF_EXPECTS(scatter_map.size() == source.size(), "scatter_map and source size mismatch");
+  auto const k = agg->kind;
+  CUDF_EXPECTS(target.type() == target_type(source.type(), k),
+               "target type must be the result type of the aggregation");
+  auto const is_count = k == aggregation::COUNT_VALID or k == aggregation::COUNT_ALL;
+  CUDF_EXPECTS(not is_count or not target.has_nulls(), "The target of COUNT must not have nulls");
+
+  auto const nullify =
+    not is_count and null_handling == null_policy::INCLUDE and source.has_nulls();
+  auto result = std::make_unique<column>(target, stream, mr);
+  if (nullify and not result->nullable()) {
+    result->set_null_mask(create_null_mask(target.size(), mask_state::ALL_VALID, stream, mr), 0);
+  }
+  if (source.is_empty() or target.is_empty()) { return result; }
+
+  auto const indices = type_dispatcher(
+    scatter_map.type(), scatter_map_normalizer{}, scatter_map, target.size(), stream);
+  dispatch_type_and_aggregation(source.type(),
+                                k,
+                                scatter_reduce_functor{},
+                                source,
+                                indices.data().get(),
+                                result->mutable_view(),
+                                nullify,
+                                stream);
+  return result;
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> scatter_reduce(column_view const& source,
+                                       column_view const& scatter_map,
+                                       column_view const& target,
+                                       std::unique_ptr<aggregation> const& agg,
+                                       null_policy null_handling,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::scatter_reduce(source, scatter_map, target, agg, null_handling, mr);
+}
+
+}  // namespace cudf
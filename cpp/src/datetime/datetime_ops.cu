@@ -20,10 +20,15 @@
 #include <cudf/datetime.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/null_mask.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/traits.hpp>
 
 #include <rmm/thrust_rmm_allocator.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
 
 namespace cudf {
 namespace datetime {
@@ -180,13 +185,225 @@ std::unique_ptr<column> apply_datetime_op(column_view const& column,
   return output;
 }
 
+// Extract several components of each timestamp, converting it to a civil date and time once
+template <typename Timestamp>
+struct extract_components_fn {
+  Timestamp const* input;
+  datetime_component const* components;
+  int16_t* const* outputs;
+  size_type num_components;
+  bool needs_date;  // whether a component is computed from the year, month and day
+
+  CUDA_DEVICE_CALLABLE void operator()(size_type idx) const
+  {
+    using namespace simt::std::chrono;
+
+    auto const ts               = input[idx];
+    auto const days_since_epoch = floor<days>(ts);
+
+    auto time_since_midnight = ts - days_since_epoch;
+
+    if (time_since_midnight.count() < 0) { time_since_midnight += days(1); }
+
+    auto const hrs_  = duration_cast<hours>(time_since_midnight);
+    auto const mins_ = duration_cast<minutes>(time_since_midnight - hrs_);
+    auto const secs_ = duration_cast<seconds>(time_since_midnight - hrs_ - mins_);
+    auto const date  = needs_date ? year_month_day(days_since_epoch) : year_month_day{};
+
+    for (size_type i = 0; i < num_components; ++i) {
+      int16_t value = 0;
+      switch (components[i]) {
+        case datetime_component::YEAR: value = static_cast<int>(date.year()); break;
+        case datetime_component::MONTH: value = static_cast<unsigned>(date.month()); break;
+        case datetime_component::DAY: value = static_cast<unsigned>(date.day()); break;
+        case datetime_component::WEEKDAY:
+          value = year_month_weekday(days_since_epoch).weekday().iso_encoding();
+          break;
+        case datetime_component::HOUR: value = hrs_.count(); break;
+        case datetime_component::MINUTE: value = mins_.count(); break;
+        case datetime_component::SECOND: value = secs_.count(); break;
+        default: break;
+      }
+      outputs[i][idx] = value;
+    }
+  }
+};
+
+struct launch_extract_components {
+  template <typename Timestamp>
+  typename std::enable_if_t<!cudf::is_timestamp_t<Timestamp>::value, void> operator()(
+    column_view const&, datetime_component const*, int16_t* const*, size_type, bool, cudaStream_t)
+    const
+  {
+    CUDF_FAIL("Cannot extract datetime component from non-timestamp column.");
+  }
+
+  template <typename Timestamp>
+  typename std::enable_if_t<cudf::is_timestamp_t<Timestamp>::value, void> operator()(
+    column_view const& input,
+    datetime_component const* components,
+    int16_t* const* outputs,
+    size_type num_components,
+    bool needs_date,
+    cudaStream_t stream) const
+  {
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       input.size(),
+                       extract_components_fn<Timestamp>{
+                         input.data<Timestamp>(), components, outputs, num_components, needs_date});
+  }
+};
+
+std::unique_ptr<table> extract_components(column_view const& column,
+                                          std::vector<datetime_component> const& components,
+                                          cudaStream_t stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_timestamp(column.type()), "Column type should be timestamp");
+  CUDF_EXPECTS(std::none_of(components.begin(),
+                            components.end(),
+                            [](auto c) { return c == datetime_component::INVALID; }),
+               "Invalid datetime component");
+
+  auto const output_type = data_type{type_id::INT16};
+  std::vector<std::unique_ptr<column>> outputs;
+  std::vector<int16_t*> output_data;
+  for (size_t i = 0; i < components.size(); ++i) {
+    outputs.push_back(column.is_empty()
+                        ? make_empty_column(output_type)
+                        : make_fixed_width_column(output_type,
+                                                  column.size(),
+                                                  copy_bitmask(column, stream, mr),
+                                                  column.null_count(),
+                                                  stream,
+                                                  mr));
+    output_data.push_back(outputs.back()->mutable_view().data<int16_t>());
+  }
+  if (column.is_empty() || components.empty()) {
+    return std::make_unique<table>(std::move(outputs));
+  }
+
+  auto const needs_date = std::any_of(components.begin(), components.end(), [](auto c) {
+    return c == datetime_component::YEAR || c == datetime_component::MONTH ||
+           c == datetime_component::DAY;
+  });
+  rmm::device_vector<datetime_component> d_components(components);
+  rmm::device_vector<int16_t*> d_outputs(output_data);
+  type_dispatcher(column.type(),
+                  launch_extract_components{},
+                  column,
+                  d_components.data().get(),
+                  d_outputs.data().get(),
+                  static_cast<size_type>(components.size()),
+                  needs_date,
+                  stream);
+  return std::make_unique<table>(std::move(outputs));
+}
+
+enum class rounding_kind { FLOOR, CEIL, ROUND };
+
+// Number of ticks of the duration of `Timestamp` in a unit, or 1 for the units shorter than a tick
+template <typename Timestamp>
+int64_t ticks_per_unit(rounding_frequency freq)
+{
+  using namespace simt::std::chrono;
+  using Duration = typename Timestamp::duration;
+
+  auto const ticks = [freq]() -> int64_t {
+    switch (freq) {
+      case rounding_frequency::DAY: return duration_cast<Duration>(days(1)).count();
+      case rounding_frequency::HOUR: return duration_cast<Duration>(hours(1)).count();
+      case rounding_frequency::MINUTE: return duration_cast<Duration>(minutes(1)).count();
+      case rounding_frequency::SECOND: return duration_cast<Duration>(seconds(1)).count();
+      case rounding_frequency::MILLISECOND:
+        return duration_cast<Duration>(milliseconds(1)).count();
+      case rounding_frequency::MICROSECOND:
+        return duration_cast<Duration>(microseconds(1)).count();
+      case rounding_frequency::NANOSECOND:
+        return duration_cast<Duration>(nanoseconds(1)).count();
+      default: CUDF_FAIL("Unsupported rounding frequency");
+    }
+  }();
+  return std::max(ticks, int64_t{1});
+}
+
+// Round a timestamp to a multiple of `ticks` of its duration
+template <typename Timestamp>
+struct round_timestamp_fn {
+  int64_t ticks;
+  rounding_kind kind;
+
+  CUDA_DEVICE_CALLABLE Timestamp operator()(Timestamp const ts) const
+  {
+    int64_t const count = ts.time_since_epoch().count();
+    // floor division, for the timestamps before the epoch
+    auto const quotient  = count / ticks - ((count % ticks) < 0 ? 1 : 0);
+    auto const floored   = quotient * ticks;
+    auto const remainder = count - floored;
+    auto result          = floored;
+    if (kind == rounding_kind::CEIL) {
+      if (remainder > 0) { result += ticks; }
+    } else if (kind == rounding_kind::ROUND) {
+      if (2 * remainder > ticks || (2 * remainder == ticks && (quotient % 2) != 0)) {
+        result += ticks;
+      }
+    }
+    return Timestamp(static_cast<typename Timestamp::rep>(result));
+  }
+};
+
+struct launch_round_timestamps {
+  template <typename Timestamp>
+  typename std::enable_if_t<!cudf::is_timestamp_t<Timestamp>::value, void> operator()(
+    column_view const&, mutable_column_view, rounding_frequency, rounding_kind, cudaStream_t) const
+  {
+    CUDF_FAIL("Cannot round non-timestamp column.");
+  }
+
+  template <typename Timestamp>
+  typename std::enable_if_t<cudf::is_timestamp_t<Timestamp>::value, void> operator()(
+    column_view const& input,
+    mutable_column_view output,
+    rounding_frequency freq,
+    rounding_kind kind,
+    cudaStream_t stream) const
+  {
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      input.begin<Timestamp>(),
+                      input.end<Timestamp>(),
+                      output.begin<Timestamp>(),
+                      round_timestamp_fn<Timestamp>{ticks_per_unit<Timestamp>(freq), kind});
+  }
+};
+
+std::unique_ptr<column> round_timestamps(column_view const& column,
+                                         rounding_frequency freq,
+                                         rounding_kind kind,
+                                         cudaStream_t stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_timestamp(column.type()), "Column type should be timestamp");
+  if (column.is_empty()) return make_empty_column(column.type());
+
+  auto output = make_fixed_width_column(column.type(),
+                                        column.size(),
+                                        copy_bitmask(column, stream, mr),
+                                        column.null_count(),
+                                        stream,
+                                        mr);
+  type_dispatcher(
+    column.type(), launch_round_timestamps{}, column, output->mutable_view(), freq, kind, stream);
+  return output;
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> extract_year(column_view const& column, rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::YEAR>,
+    detail::extract_component_operator<datetime_component::YEAR>,
     cudf::type_id::INT16>(column, 0, mr);
 }
 
@@ -196,7 +413,7 @@ std::unique_ptr<column> extract_month(column_view const& column,
   CUDF_FUNC_RANGE();
 
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::MONTH>,
+    detail::extract_component_operator<datetime_component::MONTH>,
     cudf::type_id::INT16>(column, 0, mr);
 }
 
@@ -204,7 +421,7 @@ std::unique_ptr<column> extract_day(column_view const& column, rmm::mr::device_m
 {
   CUDF_FUNC_RANGE();
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::DAY>,
+    detail::extract_component_operator<datetime_component::DAY>,
     cudf::type_id::INT16>(column, 0, mr);
 }
 
@@ -213,7 +430,7 @@ std::unique_ptr<column> extract_weekday(column_view const& column,
 {
   CUDF_FUNC_RANGE();
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::WEEKDAY>,
+    detail::extract_component_operator<datetime_component::WEEKDAY>,
     cudf::type_id::INT16>(column, 0, mr);
 }
 
@@ -221,7 +438,7 @@ std::unique_ptr<column> extract_hour(column_view const& column, rmm::mr::device_
 {
   CUDF_FUNC_RANGE();
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::HOUR>,
+    detail::extract_component_operator<datetime_component::HOUR>,
     cudf::type_id::INT16>(column, 0, mr);
 }
 
@@ -230,7 +447,7 @@ std::unique_ptr<column> extract_minute(column_view const& column,
 {
   CUDF_FUNC_RANGE();
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::MINUTE>,
+    detail::extract_component_operator<datetime_component::MINUTE>,
     cudf::type_id::INT16>(column, 0, mr);
 }
 
@@ -239,7 +456,7 @@ std::unique_ptr<column> extract_second(column_view const& column,
 {
   CUDF_FUNC_RANGE();
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::SECOND>,
+    detail::extract_component_operator<datetime_component::SECOND>,
     cudf::type_id::INT16>(column, 0, mr);
 }
 
@@ -258,5 +475,37 @@ std::unique_ptr<column> day_of_year(column_view const& column, rmm::mr::device_m
     column, 0, mr);
 }
 
+std::unique_ptr<table> extract_components(column_view const& column,
+                                          std::vector<datetime_component> const& components,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::extract_components(column, components, 0, mr);
+}
+
+std::unique_ptr<column> floor_datetimes(column_view const& column,
+                                        rounding_frequency freq,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::round_timestamps(column, freq, detail::rounding_kind::FLOOR, 0, mr);
+}
+
+std::unique_ptr<column> ceil_datetimes(column_view const& column,
+                                       rounding_frequency freq,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::round_timestamps(column, freq, detail::rounding_kind::CEIL, 0, mr);
+}
+
+std::unique_ptr<column> round_datetimes(column_view const& column,
+                                        rounding_frequency freq,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::round_timestamps(column, freq, detail::rounding_kind::ROUND, 0, mr);
+}
+
 }  // namespace datetime
 }  // namespace cudf
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <io/orc/timezone.h>
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/datetime.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+#include <thrust/transform.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace cudf {
+namespace datetime {
+namespace detail {
+namespace {
+/**
+ * @brief Transition table of a timezone, as built by `io::BuildTimezoneTransitionTable`
+ */
+struct timezone_table {
+  rmm::device_vector<int64_t> data;  // Offset at the ORC epoch, then (UTC time, offset) pairs
+  uint32_t num_entries = 0;          // Number of transitions before the 400-year cycle
+  uint32_t dst_cycle   = 0;          // Number of transitions in the 400-year cycle
+};
+
+/**
+ * @brief Device view of a `timezone_table`
+ */
+struct timezone_table_view {
+  int64_t const* data;
+  uint32_t num_entries;
+  uint32_t dst_cycle;
+
+  /**
+   * @brief Returns the offset from UTC in seconds in effect at a UTC time in seconds
+   */
+  CUDA_DEVICE_CALLABLE int64_t utc_offset(int64_t ts) const
+  {
+    if (num_entries == 0) { return 0; }
+    uint32_t first = 0;
+    uint32_t last  = num_entries - 1;
+    if (ts <= data[1]) {
+      return data[2];
+    } else if (ts > data[(num_entries - 1) * 2 + 1]) {
+      if (dst_cycle == 0) { return data[(num_entries - 1) * 2 + 2]; }
+      // The Gregorian calendar repeats every 400 years
+      constexpr int64_t k400Years = (365 * 400 + (100 - 3)) * 24 * 60 * 60ll;
+      ts %= k400Years;
+      if (ts < 0) { ts += k400Years; }
+      first = num_entries;
+      last  = num_entries + dst_cycle - 1;
+      if (ts < data[num_entries * 2 + 1]) { return data[last * 2 + 2]; }
+    }
+    // Last transition at or before ts
+    while (first < last) {
+      uint32_t const mid = first + ((last - first + 1) >> 1);
+      if (data[mid * 2 + 1] <= ts) {
+        first = mid;
+      } else {
+        last = mid - 1;
+      }
+    }
+    return data[first * 2 + 2];
+  }
+
+  /**
+   * @brief Returns the offset from UTC in seconds in effect at a local time in seconds
+   */
+  CUDA_DEVICE_CALLABLE int64_t local_offset(int64_t ts) const
+  {
+    return utc_offset(ts - utc_offset(ts));
+  }
+};
+
+/**
+ * @brief Returns the transition table of a timezone, built and copied to the device on first use
+ */
+std::shared_ptr<timezone_table const> get_timezone_table(std::string const& name)
+{
+  static std::mutex cache_mutex;
+  // Never destroyed, since the device memory cannot be freed after the CUDA runtime shuts down
+  static auto* cache = new std::map<std::string, std::shared_ptr<timezone_table const>>();
+
+  std::lock_guard<std::mutex> lock(cache_mutex);
+  auto const cached = cache->find(name);
+  if (cached != cache->end()) { return cached->second; }
+
+  std::vector<int64_t> h_table;
+  CUDF_EXPECTS(io::BuildTimezoneTransitionTable(h_table, name), "Unknown timezone: " + name);
+  auto table = std::make_shared<timezone_table>();
+  if (!h_table.empty()) {
+    table->num_entries = static_cast<uint32_t>(h_table.size() >> 1);
+    if (table->num_entries > 800) {  // 2 entries/year for 400 years
+      table->num_entries -= 800;
+      table->dst_cycle = 800;
+    }
+    table->data = h_table;
+  }
+  return cache->emplace(name, std::move(table)).first->second;
+}
+
+timezone_table_view make_view(timezone_table const& table)
+{
+  return {table.data.data().get(), table.num_entries, table.dst_cycle};
+}
+
+CUDA_DEVICE_CALLABLE int64_t floor_div(int64_t x, int64_t y)
+{
+  return x / y - ((x % y) < 0 ? 1 : 0);
+}
+
+// Shift a timestamp from the local time of a timezone to that of another
+template <typename Timestamp>
+struct convert_timezone_fn {
+  timezone_table_view from;
+  timezone_table_view to;
+
+  CUDA_DEVICE_CALLABLE Timestamp operator()(Timestamp const ts) const
+  {
+    using period = typename Timestamp::period;
+
+    int64_t const count = ts.time_since_epoch().count();
+    // Whole seconds, for the lookup in the tables
+    int64_t const seconds =
+      (period::num == 1) ? floor_div(count, period::den) : count * period::num;
+    int64_t const from_offset = from.local_offset(seconds);
+    int64_t const shift       = to.utc_offset(seconds - from_offset) - from_offset;
+    int64_t const result =
+      (period::num == 1) ? count + shift * period::den : floor_div(seconds + shift, period::num);
+    return Timestamp(static_cast<typename Timestamp::rep>(result));
+  }
+};
+
+struct launch_convert_timezone {
+  template <typename Timestamp>
+  typename std::enable_if_t<!cudf::is_timestamp_t<Timestamp>::value, void> operator()(
+    column_view const& ,
+    mutable_column_view,
+    timezone_table_view,
+    timezone_table_view,
+    cudaStream_t) const
+  {
+    CUDF_FAIL("Cannot convert the timezone of a non-timestamp column.");
+  }
+
+  template <typename Timestamp>
+  typename std::enable_if_t<cudf::is_timestamp_t<Timestamp>::value, void> operator()(
+    column_view const& input,
+    mutable_column_view output,
+    timezone_table_view from,
+    timezone_table_view to,
+    cudaStream_t stream) const
+  {
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      input.begin<Timestamp>(),
+                      input.end<Timestamp>(),
+                      output.begin<Timestamp>(),
+                      convert_timezone_fn<Timestamp>{from, to});
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> convert_timezone(column_view const& column,
+                                         std::string const& from_timezone,
+                                         std::string const& to_timezone,
+                                         cudaStream_t stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_timestamp(column.type()), "Column type should be timestamp");
+  auto const from = get_timezone_table(from_timezone);
+  auto const to   = get_timezone_table(to_timezone);
+  if (column.is_empty()) return make_empty_column(column.type());
+
+  auto output = make_fixed_width_column(column.type(),
+                                        column.size(),
+                                        copy_bitmask(column, stream, mr),
+                                        column.null_count(),
+                                        stream,
+                                        mr);
+  type_dispatcher(column.type(),
+                  launch_convert_timezone{},
+                  column,
+                  output->mutable_view(),
+                  make_view(*from),
+                  make_view(*to),
+                  stream);
+  return output;
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> convert_timezone(column_view const& column,
+                                         std::string const& from_timezone,
+                                         std::string const& to_timezone,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::convert_timezone(column, from_timezone, to_timezone, 0, mr);
+}
+
+}  // namespace datetime
+}  // namespace cudf
@@ -19,6 +19,7 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/search.hpp>
 #include <cudf/detail/stream_compaction.hpp>
+#include <cudf/dictionary/detail/update_keys.hpp>
 #include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/dictionary/update_keys.hpp>
 #include <cudf/stream_compaction.hpp>
@@ -27,6 +28,8 @@
 
 #include <rmm/thrust_rmm_allocator.h>
 
+#include <algorithm>
+
 namespace cudf {
 namespace dictionary {
 namespace detail {
@@ -42,11 +45,10 @@ namespace detail {
  * ```
  *
  */
-std::unique_ptr<column> add_keys(
-  dictionary_column_view const& dictionary_column,
-  column_view const& new_keys,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
-  cudaStream_t stream                 = 0)
+std::unique_ptr<column> add_keys(dictionary_column_view const& dictionary_column,
+                                 column_view const& new_keys,
+                                 rmm::mr::device_memory_resource* mr,
+                                 cudaStream_t stream)
 {
   CUDF_EXPECTS(!new_keys.has_nulls(), "Keys must not have nulls");
   auto old_keys = dictionary_column.keys();  // [a,b,c,d,f]
@@ -61,6 +63,7 @@ std::unique_ptr<column> add_keys(
                                                   std::vector<size_type>{0},  // only one key column
                                                   duplicate_keep_option::KEEP_FIRST,
                                                   null_equality::EQUAL,
+                                                  sorted::NO,
                                                   mr,
                                                   stream)
                       ->release();
@@ -105,6 +108,55 @@ std::unique_ptr<column> add_keys(
                                 dictionary_column.null_count());  // not changed
 }
 
+namespace {
+/**
+ * @brief Returns whether two views are of the same device memory.
+ */
+bool is_same_view(column_view const& lhs, column_view const& rhs)
+{
+  if (!(lhs.type() == rhs.type()) || lhs.size() != rhs.size() || lhs.offset() != rhs.offset() ||
+      lhs.head() != rhs.head() || lhs.num_children() != rhs.num_children()) {
+    return false;
+  }
+  for (size_type i = 0; i < lhs.num_children(); ++i) {
+    if (!is_same_view(lhs.child(i), rhs.child(i))) return false;
+  }
+  return true;
+}
+}  // namespace
+
+std::pair<std::vector<std::unique_ptr<column>>, std::vector<column_view>> match_dictionaries(
+  std::vector<dictionary_column_view> const& input,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  std::vector<column_view> keys;
+  std::vector<column_view> views;
+  for (auto const& dictionary : input) {
+    if (dictionary.size() > 0) keys.push_back(dictionary.keys());
+    views.push_back(dictionary.parent());
+  }
+  std::vector<std::unique_ptr<column>> matched;
+  if (keys.empty() || std::all_of(keys.begin(), keys.end(), [&keys](auto const& k) {
+        return is_same_view(k, keys.front());
+      })) {
+    return std::make_pair(std::move(matched), std::move(views));
+  }
+  CUDF_EXPECTS(std::all_of(keys.begin(),
+                           keys.end(),
+                           [&keys](auto const& k) { return k.type() == keys.front().type(); }),
+               "keys types must match");
+
+  // every column gets the keys of all the others; add_keys removes the duplicates
+  auto const all_keys = cudf::detail::concatenate(keys, rmm::mr::get_default_resource(), stream);
+  for (size_t i = 0; i < input.size(); ++i) {
+    if (input[i].size() == 0) continue;
+    matched.push_back(add_keys(input[i], all_keys->view(), mr, stream));
+    views[i] = matched.back()->view();
+  }
+  return std::make_pair(std::move(matched), std::move(views));
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> add_keys(dictionary_column_view const& dictionary_column,
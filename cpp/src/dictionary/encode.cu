@@ -15,20 +15,136 @@
  */
 
 #include <cudf/column/column.hpp>
-#include <cudf/copying.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/gather.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
-#include <cudf/detail/search.hpp>
-#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
 #include <cudf/dictionary/detail/encode.hpp>
 #include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/dictionary/encode.hpp>
-#include <cudf/stream_compaction.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/table/row_operators.cuh>
 #include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
+#include <hash/concurrent_unordered_map.cuh>
+#include <hash/helper_functions.cuh>
+
+#include <thrust/scatter.h>
+
+#include <limits>
 
 namespace cudf {
 namespace dictionary {
 namespace detail {
+namespace {
+/**
+ * @brief Computes the keys and indices of a dictionary from the distinct non-null values of
+ * `input`.
+ *
+ * Each row is inserted into a hash table of the rows, which returns the row first inserted
+ * with the same value. Only those distinct rows are then sorted to order the keys, so a column
+ * with few distinct values is encoded without sorting all of its rows.
+ *
+ * The indices of the null rows are set to the number of keys.
+ */
+template <bool has_nulls>
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> hash_encode(
+  column_view const& input, rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+{
+  size_type constexpr unused_key{std::numeric_limits<size_type>::max()};
+  size_type constexpr unused_value{std::numeric_limits<size_type>::max()};
+
+  using hasher_type   = row_hasher<default_hash, has_nulls>;
+  using equality_type = row_equality_comparator<has_nulls>;
+  using map_type      = concurrent_unordered_map<size_type, size_type, hasher_type, equality_type>;
+
+  auto const num_rows = input.size();
+  auto const d_input  = table_device_view::create(table_view{{input}}, stream);
+  auto const map_ptr  = map_type::create(compute_hash_table_size(num_rows),
+                                         unused_key,
+                                         unused_value,
+                                         hasher_type{*d_input},
+                                         equality_type{*d_input, *d_input},
+                                         typename map_type::allocator_type(mr),
+                                         stream);
+  auto map     = *map_ptr;
+  auto execpol = rmm::exec_policy(stream);
+
+  // the first row inserted with each value represents all the rows with that value
+  rmm::device_vector<size_type> representatives(num_rows);
+  thrust::transform(execpol->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    representatives.begin(),
+                    [map, d_column = d_input->column(0)] __device__(size_type idx) mutable {
+                      if (has_nulls && d_column.is_null(idx)) return size_type{-1};
+                      return map.insert(thrust::make_pair(idx, idx)).first->first;
+                    });
+
+  // the representative rows are the distinct values
+  auto const d_representatives = representatives.data().get();
+  rmm::device_vector<size_type> distinct_rows(num_rows);
+  auto const keys_count = static_cast<size_type>(
+    thrust::copy_if(execpol->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    distinct_rows.begin(),
+                    [d_representatives] __device__(size_type idx) {
+                      return d_representatives[idx] == idx;
+                    }) -
+    distinct_rows.begin());
+  distinct_rows.resize(keys_count);
+
+  // sort only the distinct values to order the keys
+  auto const distinct_keys = cudf::detail::gather(table_view{{input}},
+                                                  distinct_rows.begin(),
+                                                  distinct_rows.end(),
+                                                  false,
+                                                  rmm::mr::get_default_resource(),
+                                                  stream);
+  auto const keys_order    = cudf::detail::sorted_order(
+    distinct_keys->view(), {}, {}, rmm::mr::get_default_resource(), stream);
+
+  // gather the keys from the distinct rows in their sorted order
+  auto const d_keys_order    = keys_order->view().data<size_type>();
+  auto const d_distinct_rows = distinct_rows.data().get();
+  rmm::device_vector<size_type> sorted_rows(keys_count);
+  thrust::transform(execpol->on(stream),
+                    d_keys_order,
+                    d_keys_order + keys_count,
+                    sorted_rows.begin(),
+                    [d_distinct_rows] __device__(size_type idx) { return d_distinct_rows[idx]; });
+  auto sorted_keys = cudf::detail::gather(
+    table_view{{input}}, sorted_rows.begin(), sorted_rows.end(), false, mr, stream);
+  auto keys_column = std::move(sorted_keys->release().front());
+  if (keys_column->nullable()) {
+    keys_column->set_null_mask(rmm::device_buffer{0, stream, mr}, 0);  // keys have no nulls
+  }
+
+  // each row's index is the position of its representative in the sorted keys
+  rmm::device_vector<size_type> row_indices(num_rows);
+  thrust::scatter(execpol->on(stream),
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(keys_count),
+                  sorted_rows.begin(),
+                  row_indices.begin());
+  auto indices_column = make_numeric_column(
+    data_type{type_id::INT32}, num_rows, mask_state::UNALLOCATED, stream, mr);
+  auto const d_row_indices = row_indices.data().get();
+  thrust::transform(execpol->on(stream),
+                    representatives.begin(),
+                    representatives.end(),
+                    indices_column->mutable_view().data<int32_t>(),
+                    [d_row_indices, keys_count] __device__(size_type row) {
+                      return row < 0 ? keys_count : d_row_indices[row];
+                    });
+
+  return std::make_pair(std::move(keys_column), std::move(indices_column));
+}
+}  // namespace
+
 /**
  * @brief Create a new dictionary column from a column_view.
  *
@@ -42,42 +158,19 @@ std::unique_ptr<column> encode(column_view const& input_column,
   CUDF_EXPECTS(input_column.type().id() != type_id::DICTIONARY32,
                "cannot encode a dictionary from a dictionary");
 
-  // side effects of this function were are now dependent on:
-  // - resulting column elements are sorted ascending
-  // - nulls are sorted to the beginning
-  auto table_keys = cudf::detail::drop_duplicates(table_view{{input_column}},
-                                                  std::vector<size_type>{0},
-                                                  duplicate_keep_option::KEEP_FIRST,
-                                                  null_equality::EQUAL,
-                                                  mr,
-                                                  stream)
-                      ->release();  // true == nulls are equal
-  std::unique_ptr<column> keys_column(std::move(table_keys.front()));
-
-  if (input_column.has_nulls()) {
-    // the single null entry should be at the beginning -- side effect from drop_duplicates
-    // copy the column without the null entry
-    keys_column = std::make_unique<column>(
-      slice(keys_column->view(), std::vector<size_type>{1, keys_column->size()}).front(),
-      stream,
-      mr);
-    keys_column->set_null_mask(rmm::device_buffer{0, stream, mr}, 0);  // remove the null-mask
+  if (input_column.is_empty()) {
+    return make_dictionary_column(make_empty_column(input_column.type()),
+                                  make_empty_column(indices_type),
+                                  rmm::device_buffer{0, stream, mr},
+                                  0);
   }
 
-  // this returns a column with no null entries
-  // - it appears to ignore the null entries in the input and tries to place the value regardless
-  auto indices_column = cudf::detail::lower_bound(table_view{{keys_column->view()}},
-                                                  table_view{{input_column}},
-                                                  std::vector<order>{order::ASCENDING},
-                                                  std::vector<null_order>{null_order::AFTER},
-                                                  mr,
-                                                  stream);
-  // we should probably copy/cast to type_id::INT32 type if different
-  CUDF_EXPECTS(indices_column->type() == indices_type, "expecting type_id::INT32 indices type");
+  auto encoded = input_column.has_nulls() ? hash_encode<true>(input_column, mr, stream)
+                                          : hash_encode<false>(input_column, mr, stream);
 
   // create column with keys_column and indices_column
-  return make_dictionary_column(std::move(keys_column),
-                                std::move(indices_column),
+  return make_dictionary_column(std::move(encoded.first),
+                                std::move(encoded.second),
                                 copy_bitmask(input_column, stream, mr),
                                 input_column.null_count());
 }
@@ -88,6 +88,60 @@ std::unique_ptr<numeric_scalar<int32_t>> get_index(dictionary_column_view const&
   return type_dispatcher(dictionary.keys().type(), find_index_fn(), dictionary, key, mr, stream);
 }
 
+/**
+ * @brief Find the position within a dictionary's keys column at which a given key would be
+ * inserted to keep the keys sorted.
+ *
+ * The result is an integer scalar identifying the index value. It is always valid.
+ */
+struct find_insert_index_fn {
+  template <typename Element,
+            std::enable_if_t<not std::is_same<Element, dictionary32>::value and
+                             not std::is_same<Element, list_view>::value>* = nullptr>
+  std::unique_ptr<numeric_scalar<int32_t>> operator()(dictionary_column_view const& input,
+                                                      scalar const& key,
+                                                      rmm::mr::device_memory_resource* mr,
+                                                      cudaStream_t stream) const
+  {
+    if (input.size() == 0) return std::make_unique<numeric_scalar<int32_t>>(0, true, stream, mr);
+    CUDF_EXPECTS(input.keys().type() == key.type(),
+                 "search key type must match dictionary keys type");
+    auto keys_view = column_device_view::create(input.keys(), stream);
+    auto find_key  = static_cast<scalar_type_t<Element> const&>(key).value(stream);
+    auto iter      = thrust::lower_bound(
+      thrust::device, keys_view->begin<Element>(), keys_view->end<Element>(), find_key);
+    return std::make_unique<numeric_scalar<int32_t>>(
+      thrust::distance(keys_view->begin<Element>(), iter), true, stream, mr);
+  }
+  template <typename Element,
+            std::enable_if_t<std::is_same<Element, dictionary32>::value>* = nullptr>
+  std::unique_ptr<numeric_scalar<int32_t>> operator()(dictionary_column_view const& input,
+                                                      scalar const& key,
+                                                      rmm::mr::device_memory_resource* mr,
+                                                      cudaStream_t stream) const
+  {
+    CUDF_FAIL("dictionary column cannot be the keys column of another dictionary");
+  }
+
+  template <typename Element, std::enable_if_t<std::is_same<Element, list_view>::value>* = nullptr>
+  std::unique_ptr<numeric_scalar<int32_t>> operator()(dictionary_column_view const& input,
+                                                      scalar const& key,
+                                                      rmm::mr::device_memory_resource* mr,
+                                                      cudaStream_t stream) const
+  {
+    CUDF_FAIL("list_view column cannot be the keys column of a dictionary");
+  }
+};
+
+std::unique_ptr<numeric_scalar<int32_t>> get_insert_index(dictionary_column_view const& dictionary,
+                                                          scalar const& key,
+                                                          rmm::mr::device_memory_resource* mr,
+                                                          cudaStream_t stream)
+{
+  return type_dispatcher(
+    dictionary.keys().type(), find_insert_index_fn(), dictionary, key, mr, stream);
+}
+
 }  // namespace detail
 
 // external API
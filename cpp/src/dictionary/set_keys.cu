@@ -107,6 +107,7 @@ std::unique_ptr<column> set_keys(
                                                   std::vector<size_type>{0},
                                                   duplicate_keep_option::KEEP_FIRST,
                                                   null_equality::EQUAL,
+                                                  sorted::NO,
                                                   mr,
                                                   stream)
                       ->release();
@@ -15,6 +15,7 @@
  */
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/dlpack.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
@@ -251,17 +252,121 @@ DLManagedTensor* to_dlpack(table_view const& input,
   return managed_tensor.release();
 }
 
+table_view from_dlpack_view(DLManagedTensor const* managed_tensor)
+{
+  CUDF_EXPECTS(nullptr != managed_tensor, "managed_tensor is null");
+  auto const& tensor = managed_tensor->dl_tensor;
+
+  CUDF_EXPECTS(kDLGPU == tensor.ctx.device_type, "DLTensor must be GPU type to be viewed");
+  int device_id = 0;
+  CUDA_TRY(cudaGetDevice(&device_id));
+  CUDF_EXPECTS(tensor.ctx.device_id == device_id, "DLTensor device ID must be current device");
+
+  CUDF_EXPECTS(tensor.ndim > 0 && tensor.ndim <= 2, "DLTensor must be 1D or 2D");
+  CUDF_EXPECTS(tensor.shape[0] >= 0 && tensor.shape[0] < std::numeric_limits<size_type>::max(),
+               "DLTensor first dim is not supported by cudf");
+  CUDF_EXPECTS(tensor.ndim == 1 || (tensor.shape[1] >= 0 &&
+                                    tensor.shape[1] < std::numeric_limits<size_type>::max()),
+               "DLTensor second dim is not supported by cudf");
+  CUDF_EXPECTS(nullptr == tensor.strides || 1 == tensor.strides[0],
+               "DLTensor must be column-major to be viewed");
+
+  data_type const dtype    = DLDataType_to_data_type(tensor.dtype);
+  size_type const num_rows = static_cast<size_type>(tensor.shape[0]);
+  size_type const num_columns =
+    (tensor.ndim == 2) ? static_cast<size_type>(tensor.shape[1]) : size_type{1};
+  size_t const col_stride = (tensor.ndim == 2 && nullptr != tensor.strides)
+                              ? size_of(dtype) * tensor.strides[1]
+                              : size_of(dtype) * num_rows;
+
+  auto tensor_data = reinterpret_cast<uintptr_t>(tensor.data) + tensor.byte_offset;
+  std::vector<column_view> columns;
+  for (size_type i = 0; i < num_columns; ++i) {
+    columns.emplace_back(dtype, num_rows, reinterpret_cast<void const*>(tensor_data));
+    tensor_data += col_stride;
+  }
+  return table_view{columns};
+}
+
+DLManagedTensor* to_dlpack_view(table_view const& input,
+                                rmm::mr::device_memory_resource* mr,
+                                cudaStream_t stream)
+{
+  auto const num_rows = input.num_rows();
+  auto const num_cols = input.num_columns();
+  if (num_rows == 0) { return nullptr; }
+
+  data_type const type    = input.column(0).type();
+  DLDataType const dltype = data_type_to_DLDataType(type);
+  CUDF_EXPECTS(
+    std::all_of(input.begin(), input.end(), [type](auto const& col) { return col.type() == type; }),
+    "All columns required to have same data type");
+  CUDF_EXPECTS(
+    std::none_of(input.begin(), input.end(), [](auto const& col) { return col.has_nulls(); }),
+    "Input required to have null count zero");
+
+  // The columns can be viewed as a column-major tensor if they are evenly spaced in memory, as
+  // are the columns of a fresh allocation or of a `contiguous_split` result
+  auto const first      = reinterpret_cast<intptr_t>(get_column_data(input.column(0)));
+  auto const col_stride = (num_cols > 1)
+                            ? reinterpret_cast<intptr_t>(get_column_data(input.column(1))) - first
+                            : static_cast<intptr_t>(num_rows * size_of(type));
+  bool viewable = col_stride >= static_cast<intptr_t>(num_rows * size_of(type)) &&
+                  col_stride % static_cast<intptr_t>(size_of(type)) == 0;
+  for (size_type i = 2; viewable && i < num_cols; ++i) {
+    viewable = reinterpret_cast<intptr_t>(get_column_data(input.column(i))) ==
+               first + i * col_stride;
+  }
+  if (not viewable) { return to_dlpack(input, mr, stream); }
+
+  auto managed_tensor = std::make_unique<DLManagedTensor>();
+  auto context        = std::make_unique<dltensor_context>();
+
+  DLTensor& tensor = managed_tensor->dl_tensor;
+  tensor.dtype     = dltype;
+  tensor.ndim      = (num_cols > 1) ? 2 : 1;
+  tensor.shape     = context->shape;
+  tensor.shape[0]  = num_rows;
+  if (tensor.ndim > 1) {
+    tensor.shape[1]   = num_cols;
+    tensor.strides    = context->strides;
+    tensor.strides[0] = 1;
+    tensor.strides[1] = col_stride / static_cast<intptr_t>(size_of(type));
+  }
+  CUDA_TRY(cudaGetDevice(&tensor.ctx.device_id));
+  tensor.ctx.device_type = kDLGPU;
+  tensor.data            = reinterpret_cast<void*>(first);
+
+  managed_tensor->deleter     = dltensor_context::deleter;
+  managed_tensor->manager_ctx = context.release();
+  return managed_tensor.release();
+}
+
 }  // namespace detail
 
 std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
                                    rmm::mr::device_memory_resource* mr)
 {
+  CUDF_FUNC_RANGE();
   return detail::from_dlpack(managed_tensor, mr);
 }
 
 DLManagedTensor* to_dlpack(table_view const& input, rmm::mr::device_memory_resource* mr)
 {
+  CUDF_FUNC_RANGE();
   return detail::to_dlpack(input, mr);
 }
 
+table_view from_dlpack_view(DLManagedTensor const* managed_tensor)
+{
+  CUDF_FUNC_RANGE();
+  return detail::from_dlpack_view(managed_tensor);
+}
+
+DLManagedTensor* to_dlpack_view(table_view const& input, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::to_dlpack_view(input, mr);
+}
+
 }  // namespace cudf
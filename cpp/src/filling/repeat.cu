@@ -22,6 +22,7 @@
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/repeat.hpp>
+#include <cudf/detail/sequence.cuh>
 #include <cudf/filling.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/table/table.hpp>
@@ -123,15 +124,20 @@ std::unique_ptr<table> repeat(table_view const& input_table,
   auto offsets = cudf::type_dispatcher(count.type(), compute_offsets{&count}, check_count, stream);
 
   size_type output_size{offsets.back()};
-  rmm::device_vector<size_type> indices(output_size);
-  thrust::upper_bound(rmm::exec_policy(stream)->on(stream),
-                      offsets.begin(),
-                      offsets.end(),
-                      thrust::make_counting_iterator(0),
-                      thrust::make_counting_iterator(output_size),
-                      indices.begin());
-
-  return gather(input_table, indices.begin(), indices.end(), false, mr, stream);
+  repeat_sequence const indices{offsets.data().get(), input_table.num_rows(), output_size};
+
+  // a single column reads the gather map once, so each output row is searched in the offsets as
+  // it is gathered; wider tables read the map once per column, so it is searched only once
+  if (input_table.num_columns() == 1) {
+    return gather(input_table, indices.begin(), indices.end(), false, mr, stream);
+  }
+  auto const gather_map = indices.materialize(rmm::mr::get_default_resource(), stream);
+  return gather(input_table,
+                gather_map->view().begin<size_type>(),
+                gather_map->view().end<size_type>(),
+                false,
+                mr,
+                stream);
 }
 
 std::unique_ptr<table> repeat(table_view const& input_table,
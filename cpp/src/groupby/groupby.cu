@@ -23,19 +23,51 @@
 #include <cudf/detail/groupby.hpp>
 #include <cudf/detail/groupby/sort_helper.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/stream_compaction.hpp>
 #include <cudf/groupby.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <groupby/sort/group_reductions.hpp>
+
 #include <thrust/copy.h>
 
+#include <algorithm>
 #include <memory>
+#include <numeric>
 #include <utility>
 
 namespace cudf {
 namespace groupby {
+grouping::grouping(table_view const& keys, null_policy null_handling, sorted keys_are_sorted)
+  : _keys{keys},
+    _include_null_keys{null_handling},
+    _keys_are_sorted{keys_are_sorted},
+    _helper{std::make_shared<detail::sort::sort_groupby_helper>(
+      keys, null_handling, keys_are_sorted)}
+{
+}
+
+size_type grouping::num_groups() const { return _helper->num_groups(); }
+
+size_type grouping::num_grouped_rows() const { return _helper->num_keys(); }
+
+column_view grouping::key_sort_order() const { return _helper->key_sort_order(); }
+
+column_view grouping::group_offsets() const
+{
+  auto const& offsets = _helper->group_offsets();
+  return column_view(data_type(type_to_id<size_type>()), offsets.size(), offsets.data().get());
+}
+
+column_view grouping::group_labels() const
+{
+  auto const& labels = _helper->group_labels();
+  return column_view(data_type(type_to_id<size_type>()), labels.size(), labels.data().get());
+}
+
 // Constructor
 groupby::groupby(table_view const& keys,
                  null_policy include_null_keys,
@@ -50,9 +82,78 @@ groupby::groupby(table_view const& keys,
 {
 }
 
+groupby::groupby(table const& keys, null_policy include_null_keys)
+  : groupby(keys.view(), include_null_keys)
+{
+  // Sorted by all the key columns in their order, the keys are grouped as sorted keys
+  auto const& sort_order  = keys.sort_order();
+  auto const num_columns  = static_cast<size_t>(keys.num_columns());
+  auto const leading_keys = std::vector<size_type>(
+    sort_order.key_columns.begin(),
+    sort_order.key_columns.begin() + std::min(num_columns, sort_order.key_columns.size()));
+  std::vector<size_type> all_columns(num_columns);
+  std::iota(all_columns.begin(), all_columns.end(), 0);
+  if (num_columns == 0 or leading_keys != all_columns) { return; }
+
+  _keys_are_sorted = sorted::YES;
+  _column_order.assign(sort_order.column_order.begin(),
+                       sort_order.column_order.begin() + num_columns);
+  _null_precedence.assign(sort_order.null_precedence.begin(),
+                          sort_order.null_precedence.begin() + num_columns);
+}
+
+groupby::groupby(grouping const& groups)
+  : _keys{groups.keys()},
+    _include_null_keys{groups.null_handling()},
+    _keys_are_sorted{groups.keys_are_sorted()},
+    _helper{groups.helper()}
+{
+}
+
+namespace {
+/**
+ * @brief Number of rows from which the number of groups is estimated before a hash groupby
+ *
+ * The hash map of smaller inputs is small enough to be sized for all their rows.
+ */
+constexpr size_type MIN_ROWS_TO_ESTIMATE_GROUPS = 1 << 16;
+
+/**
+ * @brief Fraction of the rows above which the estimated number of groups leaves the keys to the
+ * sort groupby: nearly every row then has a group of its own in the hash map
+ */
+constexpr double HIGH_CARDINALITY_FRACTION = 0.9;
+
+/**
+ * @brief Estimates the number of groups of `keys` from a HyperLogLog sketch of the hashes of the
+ * rows, or returns -1 for inputs too small to need an estimate
+ */
+size_type estimate_num_groups(table_view const& keys,
+                              null_policy include_null_keys,
+                              cudaStream_t stream)
+{
+  if (keys.num_rows() < MIN_ROWS_TO_ESTIMATE_GROUPS) { return -1; }
+  return detail::approx_distinct_count(keys, 12, include_null_keys, stream);
+}
+
+/**
+ * @brief Indicates whether the sort groupby computes the aggregations of `requests`, which it
+ * does for all the hash aggregations but SUM_OF_SQUARES
+ */
+bool sort_groupby_supports(std::vector<aggregation_request> const& requests)
+{
+  return std::none_of(requests.begin(), requests.end(), [](aggregation_request const& r) {
+    return std::any_of(r.aggregations.begin(), r.aggregations.end(), [](auto const& a) {
+      return a->kind == aggregation::SUM_OF_SQUARES;
+    });
+  });
+}
+}  // namespace
+
 // Select hash vs. sort groupby implementation
 std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::dispatch_aggregation(
   std::vector<aggregation_request> const& requests,
+  column_view const* boolean_mask,
   cudaStream_t stream,
   rmm::mr::device_memory_resource* mr)
 {
@@ -64,7 +165,18 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::disp
   // satisfied with a hash implementation
   if (_keys_are_sorted == sorted::NO and not _helper and
       detail::hash::can_use_hash_groupby(_keys, requests)) {
-    return detail::hash::groupby(_keys, requests, _include_null_keys, stream, mr);
+    // The estimated number of groups sizes the hash map, and chooses between pre-aggregating in
+    // shared memory for few groups and the sort groupby for nearly as many groups as rows
+    auto const num_groups = estimate_num_groups(_keys, _include_null_keys, stream);
+    if (num_groups < HIGH_CARDINALITY_FRACTION * _keys.num_rows() or
+        not sort_groupby_supports(requests)) {
+      // The hash groupby skips the rows that are not selected while aggregating
+      return detail::hash::groupby(
+        _keys, requests, _include_null_keys, boolean_mask, num_groups, stream, mr);
+    }
+  }
+  if (boolean_mask != nullptr) {
+    return filtered_sort_aggregate(requests, *boolean_mask, stream, mr);
   } else {
     return sort_aggregate(requests, stream, mr);
   }
@@ -112,13 +224,64 @@ void verify_valid_requests(std::vector<aggregation_request> const& requests)
                                                 });
                            }),
                "Invalid type/aggregation combination.");
+  // the sketch of APPROX_NUNIQUE describes a whole column; groups would each need one
+  CUDF_EXPECTS(std::none_of(requests.begin(),
+                            requests.end(),
+                            [](auto const& request) {
+                              return std::any_of(
+                                request.aggregations.begin(),
+                                request.aggregations.end(),
+                                [](auto const& agg) {
+                                  return agg->kind == aggregation::APPROX_NUNIQUE;
+                                });
+                            }),
+               "APPROX_NUNIQUE is only supported by reductions.");
 }
 
 }  // namespace
 
+// The sort-based groupby sorts the selected rows, which are copied first
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>>
+groupby::filtered_sort_aggregate(std::vector<aggregation_request> const& requests,
+                                 column_view const& boolean_mask,
+                                 cudaStream_t stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  std::vector<column_view> columns(_keys.begin(), _keys.end());
+  std::transform(requests.begin(),
+                 requests.end(),
+                 std::back_inserter(columns),
+                 [](auto const& request) { return request.values; });
+  auto const selected = cudf::detail::apply_boolean_mask(
+    table_view{columns}, boolean_mask, rmm::mr::get_default_resource(), stream);
+  auto const selected_view = selected->view();
+
+  std::vector<size_type> key_indices(_keys.num_columns());
+  std::iota(key_indices.begin(), key_indices.end(), 0);
+  groupby selected_groupby(selected_view.select(key_indices),
+                           _include_null_keys,
+                           _keys_are_sorted,
+                           _column_order,
+                           _null_precedence);
+
+  std::vector<aggregation_request> selected_requests(requests.size());
+  for (size_t i = 0; i < requests.size(); ++i) {
+    selected_requests[i].values = selected_view.column(_keys.num_columns() + i);
+    for (auto const& agg : requests[i].aggregations) {
+      selected_requests[i].aggregations.push_back(agg->clone());
+    }
+  }
+  if (selected_view.num_rows() == 0) {
+    return std::make_pair(empty_like(_keys), empty_results(selected_requests));
+  }
+  return selected_groupby.sort_aggregate(selected_requests, stream, mr);
+}
+
 // Compute aggregation requests
 std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::aggregate(
-  std::vector<aggregation_request> const& requests, rmm::mr::device_memory_resource* mr)
+  std::vector<aggregation_request> const& requests,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
   CUDF_EXPECTS(
@@ -131,7 +294,31 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::aggr
 
   if (_keys.num_rows() == 0) { return std::make_pair(empty_like(_keys), empty_results(requests)); }
 
-  return dispatch_aggregation(requests, 0, mr);
+  return dispatch_aggregation(requests, nullptr, stream, mr);
+}
+
+// Compute aggregation requests on the rows selected by a boolean mask
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::aggregate(
+  std::vector<aggregation_request> const& requests,
+  column_view const& boolean_mask,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(boolean_mask.type().id() == type_id::BOOL8, "Mask must be Boolean type");
+  CUDF_EXPECTS(boolean_mask.size() == _keys.num_rows(),
+               "Size mismatch between boolean mask and groupby keys.");
+  CUDF_EXPECTS(
+    std::all_of(requests.begin(),
+                requests.end(),
+                [this](auto const& request) { return request.values.size() == _keys.num_rows(); }),
+    "Size mismatch between request values and groupby keys.");
+
+  verify_valid_requests(requests);
+
+  if (_keys.num_rows() == 0) { return std::make_pair(empty_like(_keys), empty_results(requests)); }
+
+  return dispatch_aggregation(requests, &boolean_mask, stream, mr);
 }
 
 groupby::groups groupby::get_groups(table_view values, rmm::mr::device_memory_resource* mr)
@@ -157,11 +344,33 @@ groupby::groups groupby::get_groups(table_view values, rmm::mr::device_memory_re
   }
 }
 
+std::pair<std::unique_ptr<table>, std::unique_ptr<table>> groupby::replace_nulls(
+  table_view const& values,
+  std::vector<replace_policy> const& replace_policies,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(_keys.num_rows() == values.num_rows(),
+               "Size mismatch between group labels and value.");
+  CUDF_EXPECTS(static_cast<size_t>(values.num_columns()) == replace_policies.size(),
+               "Size mismatch between values and replace policies.");
+
+  auto const& group_labels = helper().group_labels(0);
+  std::vector<std::unique_ptr<column>> results;
+  results.reserve(values.num_columns());
+  for (size_type i = 0; i < values.num_columns(); ++i) {
+    results.push_back(detail::group_replace_nulls(
+      values.column(i), helper().key_sort_order(0), group_labels, replace_policies[i], mr, 0));
+  }
+
+  return std::make_pair(helper().sorted_keys(mr, 0), std::make_unique<table>(std::move(results)));
+}
+
 // Get the sort helper object
 detail::sort::sort_groupby_helper& groupby::helper()
 {
   if (_helper) return *_helper;
-  _helper = std::make_unique<detail::sort::sort_groupby_helper>(
+  _helper = std::make_shared<detail::sort::sort_groupby_helper>(
     _keys, _include_null_keys, _keys_are_sorted);
   return *_helper;
 };
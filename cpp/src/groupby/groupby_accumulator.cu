@@ -0,0 +1,565 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/binaryop.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/binaryop.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/unary.hpp>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/groupby.hpp>
+#include <cudf/join.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/replace.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/partition.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace groupby {
+namespace {
+/**
+ * @brief Returns the kinds of the partial results from which `kind` is computed
+ *
+ * The partial results of VARIANCE and STD are the count, the mean (MEAN) and the sum of squared
+ * deviations from the mean (VARIANCE) of each group.
+ */
+std::vector<aggregation::Kind> partial_kinds(aggregation::Kind kind)
+{
+  switch (kind) {
+    case aggregation::SUM:
+    case aggregation::SUM_OF_SQUARES:
+    case aggregation::MIN:
+    case aggregation::MAX:
+    case aggregation::COUNT_VALID:
+    case aggregation::COUNT_ALL: return {kind};
+    case aggregation::MEAN: return {aggregation::SUM, aggregation::COUNT_VALID};
+    case aggregation::VARIANCE:
+    case aggregation::STD:
+      return {aggregation::COUNT_VALID, aggregation::MEAN, aggregation::VARIANCE};
+    default: CUDF_FAIL("Unsupported aggregation in groupby_accumulator");
+  }
+}
+
+/**
+ * @brief Returns the aggregation computing the partial result `kind` of a batch
+ */
+std::unique_ptr<aggregation> make_partial_aggregation(aggregation::Kind kind)
+{
+  switch (kind) {
+    case aggregation::SUM: return make_sum_aggregation();
+    case aggregation::SUM_OF_SQUARES: return make_sum_of_squares_aggregation();
+    case aggregation::MIN: return make_min_aggregation();
+    case aggregation::MAX: return make_max_aggregation();
+    case aggregation::COUNT_VALID: return make_count_aggregation(null_policy::EXCLUDE);
+    case aggregation::COUNT_ALL: return make_count_aggregation(null_policy::INCLUDE);
+    case aggregation::MEAN: return make_mean_aggregation();
+    // The population variance, scaled by the count into the sum of squared deviations
+    case aggregation::VARIANCE: return make_variance_aggregation(0);
+    default: CUDF_FAIL("Unexpected partial aggregation");
+  }
+}
+
+bool is_count(aggregation::Kind kind)
+{
+  return kind == aggregation::COUNT_VALID or kind == aggregation::COUNT_ALL;
+}
+
+/**
+ * @brief Indicates whether the partial results of kind `kind` are null for the groups without
+ * valid values
+ */
+bool is_nullable_partial(aggregation::Kind kind)
+{
+  return kind == aggregation::SUM or kind == aggregation::SUM_OF_SQUARES or
+         kind == aggregation::MIN or kind == aggregation::MAX;
+}
+
+/**
+ * @brief Moves the pairs of rows of the groups found in the accumulator before the others
+ *
+ * @param batch_rows Rows of the batch groups
+ * @param group_rows Rows of the same groups in the accumulator, -1 for the groups not found
+ * @return The number of groups found
+ */
+size_type partition_matches(size_type* batch_rows,
+                            size_type* group_rows,
+                            size_type num_rows,
+                            cudaStream_t stream)
+{
+  auto const rows = thrust::make_zip_iterator(thrust::make_tuple(batch_rows, group_rows));
+  auto const end  = thrust::partition(rmm::exec_policy(stream)->on(stream),
+                                     rows,
+                                     rows + num_rows,
+                                     [] __device__(thrust::tuple<size_type, size_type> const& r) {
+                                       return thrust::get<1>(r) >= 0;
+                                     });
+  return static_cast<size_type>(thrust::distance(rows, end));
+}
+
+/**
+ * @brief Combines in place the fixed-width partial results of the groups found in the accumulator
+ * with those of the batch
+ *
+ * Each group appears once in `group_rows`, so no two threads update the same value.
+ */
+struct combine_in_place_fn {
+  template <typename T, std::enable_if_t<is_fixed_width<T>()>* = nullptr>
+  void operator()(mutable_column_view target,
+                  column_view const& source,
+                  size_type const* group_rows,
+                  size_type const* batch_rows,
+                  size_type num_rows,
+                  aggregation::Kind kind,
+                  cudaStream_t stream)
+  {
+    auto const d_target = mutable_column_device_view::create(target, stream);
+    auto const d_source = column_device_view::create(source, stream);
+    thrust::for_each_n(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      num_rows,
+      [target = *d_target, source = *d_source, group_rows, batch_rows, kind] __device__(
+        size_type i) {
+        auto const g = group_rows[i];
+        auto const b = batch_rows[i];
+        if (source.is_null(b)) { return; }
+        auto const value = source.element<T>(b);
+        if (target.is_null(g)) {
+          target.element<T>(g) = value;
+          target.set_valid(g);
+          return;
+        }
+        auto& current = target.element<T>(g);
+        switch (kind) {
+          case aggregation::MIN: current = DeviceMin{}(current, value); break;
+          case aggregation::MAX: current = DeviceMax{}(current, value); break;
+          default: current = DeviceSum{}(current, value);
+        }
+      });
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not is_fixed_width<T>()> operator()(Args&&...)
+  {
+    CUDF_FAIL("Only fixed-width partial results are combined in place");
+  }
+};
+
+/**
+ * @brief Combines the partial results `target` of the groups found in the accumulator with those
+ * of the batch, `source`
+ */
+void combine_partial(std::unique_ptr<column>& target,
+                     column_view const& source,
+                     aggregation::Kind kind,
+                     column_view const& group_rows,
+                     column_view const& batch_rows,
+                     cudaStream_t stream)
+{
+  if (is_fixed_width(target->type())) {
+    type_dispatcher(target->type(),
+                    combine_in_place_fn{},
+                    target->mutable_view(),
+                    source,
+                    group_rows.data<size_type>(),
+                    batch_rows.data<size_type>(),
+                    group_rows.size(),
+                    kind,
+                    stream);
+    return;
+  }
+
+  // The MIN and MAX of strings cannot be updated in place: the current and new values of the
+  // groups found are reduced by a groupby on their row in the accumulator, and scattered back
+  auto const current  = gather(table_view({target->view()}), group_rows);
+  auto const incoming = gather(table_view({source}), batch_rows);
+  auto const values   = concatenate({current->get_column(0), incoming->get_column(0)});
+  auto const rows     = concatenate({group_rows, group_rows});
+  std::vector<aggregation_request> requests(1);
+  requests[0].values = values->view();
+  requests[0].aggregations.push_back(make_partial_aggregation(kind));
+  groupby gb(table_view({rows->view()}));
+  auto const result = gb.aggregate(requests);
+  target = std::move(scatter(table_view({result.second[0].results[0]->view()}),
+                             result.first->get_column(0),
+                             table_view({target->view()}))
+                       ->release()
+                       .front());
+}
+
+/**
+ * @brief Combines in place the count, mean and sum of squared deviations of the groups found in
+ * the accumulator with those of the batch, by the parallel formula of Chan et al.
+ *
+ * Must be called before the counts of the accumulator are combined.
+ */
+void combine_moments(column& counts,
+                     column& means,
+                     column& m2s,
+                     column_view const& batch_counts,
+                     column_view const& batch_means,
+                     column_view const& batch_m2s,
+                     column_view const& group_rows,
+                     column_view const& batch_rows,
+                     cudaStream_t stream)
+{
+  thrust::for_each_n(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    group_rows.size(),
+    [counts   = counts.view().data<int64_t>(),
+     means    = means.mutable_view().data<double>(),
+     m2s      = m2s.mutable_view().data<double>(),
+     b_counts = batch_counts.data<int64_t>(),
+     b_means  = batch_means.data<double>(),
+     b_m2s    = batch_m2s.data<double>(),
+     g_rows   = group_rows.data<size_type>(),
+     b_rows   = batch_rows.data<size_type>()] __device__(size_type i) {
+      auto const g  = g_rows[i];
+      auto const b  = b_rows[i];
+      auto const na = static_cast<double>(counts[g]);
+      auto const nb = static_cast<double>(b_counts[b]);
+      if (nb == 0) { return; }
+      if (na == 0) {
+        means[g] = b_means[b];
+        m2s[g]   = b_m2s[b];
+        return;
+      }
+      auto const n     = na + nb;
+      auto const delta = b_means[b] - means[g];
+      means[g] += delta * nb / n;
+      m2s[g] += b_m2s[b] + delta * delta * na * nb / n;
+    });
+}
+
+/**
+ * @brief Computes the variance of each group from its count and sum of squared deviations
+ */
+std::unique_ptr<column> compute_variance(column_view const& counts,
+                                         column_view const& m2s,
+                                         size_type ddof,
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream)
+{
+  auto const float64 = data_type(type_id::FLOAT64);
+  auto result = make_numeric_column(float64, counts.size(), mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    counts.begin<int64_t>(),
+                    counts.end<int64_t>(),
+                    m2s.begin<double>(),
+                    result->mutable_view().begin<double>(),
+                    [ddof] __device__(int64_t count, double m2) {
+                      return count - ddof > 0 ? m2 / (count - ddof) : 0.0;
+                    });
+
+  // Groups without more than `ddof` valid values have a null variance
+  auto null_mask = cudf::detail::valid_if(
+    counts.begin<int64_t>(),
+    counts.end<int64_t>(),
+    [ddof] __device__(int64_t count) { return count - ddof > 0; },
+    stream,
+    mr);
+  result->set_null_mask(std::move(null_mask.first), null_mask.second);
+  return result;
+}
+
+std::vector<std::vector<column_view>> to_views(
+  std::vector<std::vector<std::unique_ptr<column>>> const& columns)
+{
+  std::vector<std::vector<column_view>> views;
+  for (auto const& column_partials : columns) {
+    std::vector<column_view> column_views;
+    for (auto const& partial : column_partials) { column_views.push_back(partial->view()); }
+    views.push_back(std::move(column_views));
+  }
+  return views;
+}
+
+}  // namespace
+
+groupby_accumulator::groupby_accumulator(
+  std::vector<std::vector<std::unique_ptr<aggregation>>> const& aggregations,
+  null_policy null_handling)
+  : _include_null_keys{null_handling}
+{
+  for (auto const& column_aggs : aggregations) {
+    std::vector<std::unique_ptr<aggregation>> aggs;
+    std::vector<aggregation::Kind> kinds;
+    for (auto const& agg : column_aggs) {
+      aggs.push_back(agg->clone());
+      for (auto kind : partial_kinds(agg->kind)) {
+        if (std::find(kinds.begin(), kinds.end(), kind) == kinds.end()) { kinds.push_back(kind); }
+      }
+    }
+    _aggregations.push_back(std::move(aggs));
+    _partial_kinds.push_back(std::move(kinds));
+  }
+}
+
+groupby_accumulator::~groupby_accumulator()                     = default;
+groupby_accumulator::groupby_accumulator(groupby_accumulator&&) = default;
+groupby_accumulator& groupby_accumulator::operator=(groupby_accumulator&&) = default;
+
+void groupby_accumulator::update(table_view const& keys, table_view const& values)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(keys.num_rows() == values.num_rows(),
+               "Size mismatch between groupby keys and values.");
+  CUDF_EXPECTS(static_cast<size_t>(values.num_columns()) == _aggregations.size(),
+               "Number of value columns does not match the number of aggregation requests.");
+
+  std::vector<aggregation_request> requests(values.num_columns());
+  for (size_type i = 0; i < values.num_columns(); ++i) {
+    auto const type = values.column(i).type();
+    for (auto const& agg : _aggregations[i]) {
+      CUDF_EXPECTS(cudf::detail::is_valid_aggregation(type, agg->kind),
+                   "Invalid type/aggregation combination.");
+      CUDF_EXPECTS(is_numeric(type) or not(agg->kind == aggregation::MEAN or
+                                            agg->kind == aggregation::VARIANCE or
+                                            agg->kind == aggregation::STD),
+                   "MEAN, VARIANCE and STD are only supported on numeric values.");
+    }
+    requests[i].values = values.column(i);
+    for (auto kind : _partial_kinds[i]) {
+      requests[i].aggregations.push_back(make_partial_aggregation(kind));
+    }
+  }
+
+  groupby gb(keys, _include_null_keys);
+  auto result = gb.aggregate(requests);
+
+  // Counts are kept as INT64 so that they add up without overflow. Means and sums of squared
+  // deviations are 0 for the groups without valid values, whose count is 0.
+  auto const float64 = data_type(type_id::FLOAT64);
+  numeric_scalar<double> const zero(0);
+  std::vector<std::vector<std::unique_ptr<column>>> partials(values.num_columns());
+  for (size_type i = 0; i < values.num_columns(); ++i) {
+    auto& results        = result.second[i].results;
+    auto const& kinds    = _partial_kinds[i];
+    auto const count_idx = std::find(kinds.begin(), kinds.end(), aggregation::COUNT_VALID);
+    for (size_t j = 0; j < kinds.size(); ++j) {
+      if (is_count(kinds[j])) {
+        partials[i].push_back(cudf::detail::cast(results[j]->view(), data_type(type_id::INT64)));
+      } else if (kinds[j] == aggregation::MEAN) {
+        partials[i].push_back(replace_nulls(results[j]->view(), zero));
+      } else if (kinds[j] == aggregation::VARIANCE) {
+        auto const variance = replace_nulls(results[j]->view(), zero);
+        partials[i].push_back(binary_operation(variance->view(),
+                                               results[count_idx - kinds.begin()]->view(),
+                                               binary_operator::MUL,
+                                               float64));
+      } else {
+        partials[i].push_back(std::move(results[j]));
+      }
+    }
+  }
+
+  merge_partials(result.first->view(), to_views(partials));
+}
+
+void groupby_accumulator::merge(groupby_accumulator const& other)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(_partial_kinds == other._partial_kinds,
+               "Cannot merge accumulators of different aggregations.");
+  if (not other._keys) { return; }
+  merge_partials(other._keys->view(), to_views(other._partials));
+}
+
+void groupby_accumulator::merge_partials(table_view const& keys,
+                                         std::vector<std::vector<column_view>> const& partials)
+{
+  cudaStream_t stream = 0;
+  if (not _keys) {
+    append_groups(keys, partials);
+    return;
+  }
+  if (keys.num_rows() == 0) { return; }
+  for (size_t i = 0; i < partials.size(); ++i) {
+    for (size_t j = 0; j < partials[i].size(); ++j) {
+      CUDF_EXPECTS(partials[i][j].type() == _partials[i][j]->type(),
+                   "Column types differ from those of the previous batches.");
+    }
+  }
+
+  // Each group appears once in `keys` and in `_keys`, so each batch group has at most one match
+  std::vector<size_type> key_columns(keys.num_columns());
+  std::iota(key_columns.begin(), key_columns.end(), 0);
+  auto matches = _key_index->left_join(keys, key_columns, null_equality::EQUAL);
+  auto const batch_rows  = matches.first->mutable_view().data<size_type>();
+  auto const group_rows  = matches.second->mutable_view().data<size_type>();
+  auto const num_rows    = matches.first->size();
+  auto const num_matched = partition_matches(batch_rows, group_rows, num_rows, stream);
+
+  auto const int32 = data_type(type_to_id<size_type>());
+  column_view const matched_batch_rows(int32, num_matched, batch_rows);
+  column_view const matched_group_rows(int32, num_matched, group_rows);
+  for (size_t i = 0; i < partials.size() and num_matched > 0; ++i) {
+    auto const& kinds = _partial_kinds[i];
+    auto const index  = [&kinds](aggregation::Kind kind) {
+      return std::find(kinds.begin(), kinds.end(), kind) - kinds.begin();
+    };
+    if (std::find(kinds.begin(), kinds.end(), aggregation::VARIANCE) != kinds.end()) {
+      auto const c = index(aggregation::COUNT_VALID);
+      auto const m = index(aggregation::MEAN);
+      auto const v = index(aggregation::VARIANCE);
+      combine_moments(*_partials[i][c],
+                      *_partials[i][m],
+                      *_partials[i][v],
+                      partials[i][c],
+                      partials[i][m],
+                      partials[i][v],
+                      matched_group_rows,
+                      matched_batch_rows,
+                      stream);
+    }
+    for (size_t j = 0; j < kinds.size(); ++j) {
+      if (kinds[j] == aggregation::MEAN or kinds[j] == aggregation::VARIANCE) { continue; }
+      combine_partial(
+        _partials[i][j], partials[i][j], kinds[j], matched_group_rows, matched_batch_rows, stream);
+    }
+  }
+  if (num_matched == num_rows) { return; }
+
+  column_view const new_rows(int32, num_rows - num_matched, batch_rows + num_matched);
+  auto const new_keys = gather(keys, new_rows);
+  std::vector<std::vector<std::unique_ptr<column>>> new_partials(partials.size());
+  for (size_t i = 0; i < partials.size(); ++i) {
+    new_partials[i] = gather(table_view(partials[i]), new_rows)->release();
+  }
+  append_groups(new_keys->view(), to_views(new_partials));
+}
+
+void groupby_accumulator::append_groups(table_view const& keys,
+                                        std::vector<std::vector<column_view>> const& partials)
+{
+  cudaStream_t stream = 0;
+  // The hash table views the keys it is built on
+  _key_index.reset();
+  if (not _keys) {
+    _keys = std::make_unique<table>(keys);
+    _partials.clear();
+    for (auto const& column_partials : partials) {
+      std::vector<std::unique_ptr<column>> columns;
+      for (auto const& partial : column_partials) {
+        columns.push_back(std::make_unique<column>(partial));
+      }
+      _partials.push_back(std::move(columns));
+    }
+  } else {
+    _keys = concatenate({_keys->view(), keys});
+    for (size_t i = 0; i < partials.size(); ++i) {
+      for (size_t j = 0; j < partials[i].size(); ++j) {
+        _partials[i][j] = concatenate({_partials[i][j]->view(), partials[i][j]});
+      }
+    }
+  }
+
+  // Partial results that may become valid are updated in place, so they need a null mask
+  for (size_t i = 0; i < _partials.size(); ++i) {
+    for (size_t j = 0; j < _partials[i].size(); ++j) {
+      auto& partial = *_partials[i][j];
+      if (is_nullable_partial(_partial_kinds[i][j]) and not partial.nullable()) {
+        partial.set_null_mask(create_null_mask(partial.size(), mask_state::ALL_VALID, stream), 0);
+      }
+    }
+  }
+
+  std::vector<size_type> key_columns(_keys->num_columns());
+  std::iota(key_columns.begin(), key_columns.end(), 0);
+  _key_index = std::make_unique<hash_join>(_keys->view(), key_columns);
+}
+
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby_accumulator::finalize(
+  rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(_keys != nullptr, "groupby_accumulator::finalize called before any update.");
+  cudaStream_t stream = 0;
+
+  std::vector<aggregation_result> results(_aggregations.size());
+  for (size_t i = 0; i < _aggregations.size(); ++i) {
+    auto partial = [&](aggregation::Kind kind) {
+      auto const it = std::find(_partial_kinds[i].begin(), _partial_kinds[i].end(), kind);
+      return _partials[i][it - _partial_kinds[i].begin()]->view();
+    };
+    for (auto const& agg : _aggregations[i]) {
+      switch (agg->kind) {
+        case aggregation::COUNT_VALID:
+        case aggregation::COUNT_ALL:
+          results[i].results.push_back(cudf::detail::cast(
+            partial(agg->kind), data_type(type_to_id<size_type>()), mr, stream));
+          break;
+        case aggregation::MEAN:
+          results[i].results.push_back(
+            cudf::detail::binary_operation(partial(aggregation::SUM),
+                                           partial(aggregation::COUNT_VALID),
+                                           binary_operator::DIV,
+                                           data_type(type_id::FLOAT64),
+                                           mr,
+                                           stream));
+          break;
+        case aggregation::VARIANCE:
+        case aggregation::STD: {
+          auto const ddof = static_cast<cudf::detail::std_var_aggregation const&>(*agg)._ddof;
+          auto variance   = compute_variance(partial(aggregation::COUNT_VALID),
+                                           partial(aggregation::VARIANCE),
+                                           ddof,
+                                           mr,
+                                           stream);
+          results[i].results.push_back(
+            agg->kind == aggregation::VARIANCE
+              ? std::move(variance)
+              : cudf::detail::unary_operation(variance->view(), unary_op::SQRT, mr, stream));
+          break;
+        }
+        default:
+          results[i].results.push_back(std::make_unique<column>(partial(agg->kind), stream, mr));
+      }
+    }
+  }
+
+  return std::make_pair(std::make_unique<table>(_keys->view(), stream, mr), std::move(results));
+}
+
+}  // namespace groupby
+}  // namespace cudf
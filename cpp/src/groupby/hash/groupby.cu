@@ -24,12 +24,17 @@
 #include <cudf/detail/aggregation/aggregation.cuh>
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/detail/aggregation/result_cache.hpp>
+#include <cudf/detail/binaryop.hpp>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/groupby.hpp>
 #include <cudf/detail/replace.hpp>
+#include <cudf/detail/unary.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/detail/utilities/prefetch.hpp>
+#include <cudf/detail/utilities/scratch_allocator.cuh>
+#include <cudf/detail/valid_if.cuh>
 #include <cudf/groupby.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/table/row_operators.cuh>
@@ -40,8 +45,12 @@
 #include <cudf/utilities/traits.hpp>
 #include <hash/concurrent_unordered_map.cuh>
 
+#include <thrust/tabulate.h>
+
+#include <algorithm>
 #include <memory>
 #include <utility>
+#include <vector>
 
 namespace cudf {
 namespace groupby {
@@ -55,10 +64,11 @@ namespace {
  * @brief List of aggregation operations that can be computed with a hash-based
  * implementation.
  */
-constexpr std::array<aggregation::Kind, 7> hash_aggregations{
-    aggregation::SUM, aggregation::MIN, aggregation::MAX,
-    aggregation::COUNT_VALID, aggregation::COUNT_ALL,
-    aggregation::ARGMIN, aggregation::ARGMAX};
+constexpr std::array<aggregation::Kind, 12> hash_aggregations{
+    aggregation::SUM, aggregation::SUM_OF_SQUARES, aggregation::MIN,
+    aggregation::MAX, aggregation::COUNT_VALID, aggregation::COUNT_ALL,
+    aggregation::ARGMIN, aggregation::ARGMAX, aggregation::MEAN,
+    aggregation::VARIANCE, aggregation::STD, aggregation::NUNIQUE};
 
 template <class T, size_t N>
 constexpr bool array_contains(std::array<T, N> const& haystack, T needle) {
@@ -82,9 +92,44 @@ bool constexpr is_hash_aggregation(aggregation::Kind t)
   // this is a temporary fix due to compiler bug and we can resort back to
   // constexpr once cuda 10.2 becomes RAPIDS's minimum compiler version
   // return array_contains(hash_aggregations, t);
-  return (t == aggregation::SUM) or (t == aggregation::MIN) or (t == aggregation::MAX) or
-         (t == aggregation::COUNT_VALID) or (t == aggregation::COUNT_ALL) or
-         (t == aggregation::ARGMIN) or (t == aggregation::ARGMAX);
+  return (t == aggregation::SUM) or (t == aggregation::SUM_OF_SQUARES) or
+         (t == aggregation::MIN) or (t == aggregation::MAX) or (t == aggregation::COUNT_VALID) or
+         (t == aggregation::COUNT_ALL) or (t == aggregation::ARGMIN) or
+         (t == aggregation::ARGMAX) or (t == aggregation::MEAN) or
+         (t == aggregation::VARIANCE) or (t == aggregation::STD) or (t == aggregation::NUNIQUE);
+}
+
+/**
+ * @brief Indicates whether the specified aggregation operation can be computed on the specified
+ * type of values with a hash-based implementation.
+ */
+bool is_hash_aggregation(aggregation::Kind t, data_type type)
+{
+  switch (t) {
+    case aggregation::SUM_OF_SQUARES:
+    case aggregation::MEAN:
+    case aggregation::VARIANCE:
+    case aggregation::STD: return is_numeric(type);
+    case aggregation::NUNIQUE: return is_fixed_width(type) or type.id() == type_id::STRING;
+    default: return is_hash_aggregation(t);
+  }
+}
+
+/**
+ * @brief Returns the single pass aggregations that a hash aggregation is computed from
+ *
+ * MEAN, VARIANCE and STD are finalized from the SUM and the COUNT_VALID of their group, while
+ * NUNIQUE is computed by a separate pass.
+ */
+std::vector<aggregation::Kind> single_pass_aggs(aggregation::Kind t)
+{
+  switch (t) {
+    case aggregation::MEAN:
+    case aggregation::VARIANCE:
+    case aggregation::STD: return {aggregation::SUM, aggregation::COUNT_VALID};
+    case aggregation::NUNIQUE: return {};
+    default: return {t};
+  }
 }
 
 // flatten aggs to filter in single pass aggs
@@ -99,7 +144,14 @@ flatten_single_pass_aggs(std::vector<aggregation_request> const& requests)
     auto const& request = requests[i];
     auto const& agg_v   = request.aggregations;
 
-    auto insert_agg = [&agg_kinds, &columns, &col_ids, &request, i](aggregation::Kind k) {
+    // Compound aggregations of a request share their single pass aggregations
+    std::vector<aggregation::Kind> request_kinds;
+    auto insert_agg = [&agg_kinds, &columns, &col_ids, &request_kinds, &request, i](
+                        aggregation::Kind k) {
+      if (std::find(request_kinds.begin(), request_kinds.end(), k) != request_kinds.end()) {
+        return;
+      }
+      request_kinds.push_back(k);
       agg_kinds.push_back(k);
       columns.push_back(request.values);
       col_ids.push_back(i);
@@ -107,17 +159,19 @@ flatten_single_pass_aggs(std::vector<aggregation_request> const& requests)
 
     for (auto&& agg : agg_v) {
       if (is_hash_aggregation(agg->kind)) {
-        if (is_fixed_width(request.values.type()) or agg->kind == aggregation::COUNT_VALID or
-            agg->kind == aggregation::COUNT_ALL) {
-          insert_agg(agg->kind);
-        } else if (request.values.type().id() == type_id::STRING) {
-          // For string type, only ARGMIN, ARGMAX, MIN, and MAX are supported
-          if (agg->kind == aggregation::ARGMIN or agg->kind == aggregation::ARGMAX) {
-            insert_agg(agg->kind);
-          } else if (agg->kind == aggregation::MIN) {
-            insert_agg(aggregation::ARGMIN);
-          } else if (agg->kind == aggregation::MAX) {
-            insert_agg(aggregation::ARGMAX);
+        for (auto kind : single_pass_aggs(agg->kind)) {
+          if (is_fixed_width(request.values.type()) or kind == aggregation::COUNT_VALID or
+              kind == aggregation::COUNT_ALL) {
+            insert_agg(kind);
+          } else if (request.values.type().id() == type_id::STRING) {
+            // For string type, only ARGMIN, ARGMAX, MIN, and MAX are supported
+            if (kind == aggregation::ARGMIN or kind == aggregation::ARGMAX) {
+              insert_agg(kind);
+            } else if (kind == aggregation::MIN) {
+              insert_agg(aggregation::ARGMIN);
+            } else if (kind == aggregation::MAX) {
+              insert_agg(aggregation::ARGMAX);
+            }
           }
         }
       }
@@ -135,7 +189,7 @@ flatten_single_pass_aggs(std::vector<aggregation_request> const& requests)
 void sparse_to_dense_results(std::vector<aggregation_request> const& requests,
                              cudf::detail::result_cache const& sparse_results,
                              cudf::detail::result_cache* dense_results,
-                             rmm::device_vector<size_type> const& gather_map,
+                             cudf::detail::scratch_vector<size_type> const& gather_map,
                              size_type map_size,
                              cudaStream_t stream,
                              rmm::mr::device_memory_resource* mr)
@@ -196,13 +250,86 @@ void sparse_to_dense_results(std::vector<aggregation_request> const& requests,
   }
 }
 
+/**
+ * @brief Hashes the rows of the keys, or looks up their hashes if they are cached
+ */
+template <bool keys_have_nulls>
+struct key_row_hasher {
+  row_hasher<default_hash, keys_have_nulls> hasher;
+  hash_value_type const* row_hashes;  ///< The hash of each row, or null to hash the rows
+
+  __device__ hash_value_type operator()(size_type row) const
+  {
+    return row_hashes != nullptr ? row_hashes[row] : hasher(row);
+  }
+};
+
+/**
+ * @brief Compares rows of the keys, comparing their cached hashes first if there are
+ *
+ * Rows of different groups landing in the same slot of the hash map mostly have different
+ * hashes, so their keys, e.g. long strings, are only compared when the hashes are equal.
+ */
+template <bool keys_have_nulls>
+struct key_row_equality {
+  row_equality_comparator<keys_have_nulls> equal;
+  hash_value_type const* row_hashes;  ///< The hash of each row, or null to compare the keys only
+
+  __device__ bool operator()(size_type lhs, size_type rhs) const
+  {
+    return (row_hashes == nullptr or row_hashes[lhs] == row_hashes[rhs]) and equal(lhs, rhs);
+  }
+};
+
+/**
+ * @brief Computes the hash of each row of the keys once, if it is worth caching
+ *
+ * Every insert into and lookup in the hash map hashes a row, and every collision compares two.
+ * Fixed-width keys are hashed again for less than a lookup costs, but strings, lists and
+ * dictionaries are hashed byte by byte, so their hashes are computed once and kept.
+ *
+ * @return The hash of each row, or an empty vector if the keys are all fixed-width
+ */
+template <bool keys_have_nulls>
+cudf::detail::scratch_vector<hash_value_type> compute_row_hashes(table_view const& keys,
+                                                                 table_device_view const& d_keys,
+                                                                 cudaStream_t stream)
+{
+  if (std::all_of(keys.begin(), keys.end(), [](column_view const& col) {
+        return is_fixed_width(col.type());
+      })) {
+    return {};
+  }
+  cudf::detail::scratch_vector<hash_value_type> row_hashes(keys.num_rows());
+  thrust::tabulate(cudf::detail::scratch_policy(stream)->on(stream),
+                   row_hashes.begin(),
+                   row_hashes.end(),
+                   row_hasher<default_hash, keys_have_nulls>{d_keys});
+  return row_hashes;
+}
+
+/**
+ * @brief Number of keys added to twice the estimated number of groups when sizing the hash map,
+ * covering the error of the estimates of few groups
+ */
+constexpr size_type MAP_SIZE_MARGIN = 1024;
+
 /**
  * @brief Construct hash map that uses row comparator and row hasher on
  * `d_keys` table and stores indices
+ *
+ * The map's storage is allocated from `mr` on `stream`.
+ *
+ * @param row_hashes The cached hash of each row of `d_keys`, or null to hash the rows
+ * @param num_keys The number of distinct keys the map is sized for, at least the number of
+ * distinct rows of `d_keys`
  */
 template <bool keys_have_nulls>
 auto create_hash_map(table_device_view const& d_keys,
                      null_policy include_null_keys,
+                     hash_value_type const* row_hashes,
+                     size_type num_keys,
+                     rmm::mr::device_memory_resource* mr,
                      cudaStream_t stream = 0)
 {
   size_type constexpr unused_key{std::numeric_limits<size_type>::max()};
@@ -210,30 +337,109 @@ auto create_hash_map(table_device_view const& d_keys,
 
   using map_type = concurrent_unordered_map<size_type,
                                             size_type,
-                                            row_hasher<default_hash, keys_have_nulls>,
-                                            row_equality_comparator<keys_have_nulls>>;
+                                            key_row_hasher<keys_have_nulls>,
+                                            key_row_equality<keys_have_nulls>>;
 
   using allocator_type = typename map_type::allocator_type;
 
   bool const null_keys_are_equal{include_null_keys == null_policy::INCLUDE};
 
-  row_hasher<default_hash, keys_have_nulls> hasher{d_keys};
-  row_equality_comparator<keys_have_nulls> rows_equal{d_keys, d_keys, null_keys_are_equal};
+  key_row_hasher<keys_have_nulls> hasher{row_hasher<default_hash, keys_have_nulls>{d_keys},
+                                         row_hashes};
+  key_row_equality<keys_have_nulls> rows_equal{
+    row_equality_comparator<keys_have_nulls>{d_keys, d_keys, null_keys_are_equal}, row_hashes};
 
-  return map_type::create(compute_hash_table_size(d_keys.num_rows()),
+  return map_type::create(compute_hash_table_size(num_keys),
                           unused_key,
                           unused_value,
                           hasher,
                           rows_equal,
-                          allocator_type(),
+                          allocator_type(mr),
                           stream);
 }
 
+/**
+ * @brief Returns the size in bytes of the dynamic shared memory of
+ * `hash::compute_shared_memory_aggs` for `num_columns` aggregations
+ */
+size_t shared_memory_aggs_size(size_type num_columns)
+{
+  auto const num_accumulators = static_cast<size_t>(num_columns) * hash::SHARED_MEMORY_AGG_SLOTS;
+  return num_accumulators * sizeof(int64_t) + (num_accumulators + 7) / 8 * 8 +
+         hash::SHARED_MEMORY_AGG_SLOTS * sizeof(size_type);
+}
+
+/**
+ * @brief Indicates whether the single pass aggregations `aggs` of `values` can be pre-aggregated
+ * in shared memory by `hash::compute_shared_memory_aggs`
+ */
+bool can_use_shared_memory_aggs(table_view const& values,
+                                std::vector<aggregation::Kind> const& aggs)
+{
+  // Leave room for the static shared memory of the kernel within the default 48KB
+  constexpr size_t max_shared_memory_size = 40 * 1024;
+  if (values.num_rows() == 0 or
+      shared_memory_aggs_size(values.num_columns()) > max_shared_memory_size) {
+    return false;
+  }
+  return std::equal(
+    values.begin(), values.end(), aggs.begin(), [](column_view const& col, aggregation::Kind k) {
+      return is_numeric(col.type()) and col.type().id() != type_id::BOOL8 and
+             (k == aggregation::SUM or k == aggregation::SUM_OF_SQUARES or
+              k == aggregation::MIN or k == aggregation::MAX or k == aggregation::COUNT_VALID or
+              k == aggregation::COUNT_ALL);
+    });
+}
+
+// Returns true if row i of the keys is aggregated: its keys are valid, unless nulls are included,
+// and the boolean mask is valid and true
+struct selected_key_row {
+  bitmask_type const* keys_bitmask;
+  column_device_view boolean_mask;
+
+  __device__ inline bool operator()(size_type i) const
+  {
+    return (keys_bitmask == nullptr or bit_is_set(keys_bitmask, i)) and
+           boolean_mask.is_valid(i) and boolean_mask.data<bool>()[i];
+  }
+};
+
+/**
+ * @brief Computes the bitmask of the rows of `keys` to aggregate
+ *
+ * @return A bitmask in which bit `i` is set if row `i` is aggregated, or an empty buffer if all
+ * rows are aggregated
+ */
+rmm::device_buffer compute_row_bitmask(table_view const& keys,
+                                       bool skip_key_rows_with_nulls,
+                                       column_view const* boolean_mask,
+                                       cudaStream_t stream)
+{
+  rmm::device_buffer keys_bitmask;
+  if (skip_key_rows_with_nulls) {
+    keys_bitmask = bitmask_and(keys, cudf::detail::scratch_resource(), stream);
+  }
+  if (boolean_mask == nullptr) { return keys_bitmask; }
+
+  auto d_boolean_mask = column_device_view::create(*boolean_mask, stream);
+  return cudf::detail::valid_if(
+           thrust::make_counting_iterator<size_type>(0),
+           thrust::make_counting_iterator(keys.num_rows()),
+           selected_key_row{static_cast<bitmask_type const*>(keys_bitmask.data()),
+                            *d_boolean_mask},
+           stream,
+           cudf::detail::scratch_resource())
+    .first;
+}
+
 /**
  * @brief Computes all aggregations from `requests` that require a single pass
  * over the data and stores the results in `sparse_results`
  *
  * @see groupby_null_templated()
+ *
+ * @param few_groups Whether the keys may have few enough distinct values to pre-aggregate the rows
+ * of each block in shared memory
  */
 template <bool keys_have_nulls, typename Map>
 void compute_single_pass_aggs(table_view const& keys,
@@ -241,6 +447,9 @@ void compute_single_pass_aggs(table_view const& keys,
                               cudf::detail::result_cache* sparse_results,
                               Map& map,
                               null_policy include_null_keys,
+                              hash_value_type const* row_hashes,
+                              bitmask_type const* row_bitmask,
+                              bool few_groups,
                               cudaStream_t stream)
 {
   // flatten the aggs to a table that can be operated on by aggregate_row
@@ -262,8 +471,11 @@ void compute_single_pass_aggs(table_view const& keys,
                        : col.has_nulls();
                    auto mask_flag = (nullable) ? mask_state::ALL_NULL : mask_state::UNALLOCATED;
 
-                   return make_fixed_width_column(
-                     cudf::detail::target_type(col.type(), agg), col.size(), mask_flag, stream);
+                   return make_fixed_width_column(cudf::detail::target_type(col.type(), agg),
+                                                  col.size(),
+                                                  mask_flag,
+                                                  stream,
+                                                  cudf::detail::scratch_resource());
                  });
 
   table sparse_table(std::move(sparse_columns));
@@ -273,25 +485,57 @@ void compute_single_pass_aggs(table_view const& keys,
   // prepare to launch kernel to do the actual aggregation
   auto d_sparse_table = mutable_table_device_view::create(sparse_table);
   auto d_values       = table_device_view::create(flattened_values);
-  rmm::device_vector<aggregation::Kind> d_aggs(aggs);
-
-  bool skip_key_rows_with_nulls = keys_have_nulls and include_null_keys == null_policy::EXCLUDE;
-
-  if (skip_key_rows_with_nulls) {
-    auto row_bitmask{bitmask_and(keys, rmm::mr::get_default_resource(), stream)};
+  cudf::detail::scratch_vector<aggregation::Kind> d_aggs(aggs);
+
+  if (few_groups and can_use_shared_memory_aggs(flattened_values, aggs)) {
+    // Pre-aggregate the rows of each block in shared memory to avoid contending on the few
+    // output rows of low-cardinality keys
+    auto d_keys = table_device_view::create(keys, stream);
+    key_row_hasher<keys_have_nulls> key_hasher{row_hasher<default_hash, keys_have_nulls>{*d_keys},
+                                               row_hashes};
+    key_row_equality<keys_have_nulls> key_equal{
+      row_equality_comparator<keys_have_nulls>{
+        *d_keys, *d_keys, include_null_keys == null_policy::INCLUDE},
+      row_hashes};
+    auto const shared_memory_size = shared_memory_aggs_size(flattened_values.num_columns());
+    auto const num_blocks =
+      util::div_rounding_up_safe(keys.num_rows(), hash::SHARED_MEMORY_AGG_ROWS_PER_BLOCK);
+    if (row_bitmask != nullptr) {
+      hash::compute_shared_memory_aggs<true>
+        <<<num_blocks, hash::SHARED_MEMORY_AGG_BLOCK_SIZE, shared_memory_size, stream>>>(
+          map,
+          key_hasher,
+          key_equal,
+          keys.num_rows(),
+          hash::SHARED_MEMORY_AGG_ROWS_PER_BLOCK,
+          *d_values,
+          *d_sparse_table,
+          d_aggs.data().get(),
+          row_bitmask);
+    } else {
+      hash::compute_shared_memory_aggs<false>
+        <<<num_blocks, hash::SHARED_MEMORY_AGG_BLOCK_SIZE, shared_memory_size, stream>>>(
+          map,
+          key_hasher,
+          key_equal,
+          keys.num_rows(),
+          hash::SHARED_MEMORY_AGG_ROWS_PER_BLOCK,
+          *d_values,
+          *d_sparse_table,
+          d_aggs.data().get(),
+          nullptr);
+    }
+    CHECK_CUDA(stream);
+  } else if (row_bitmask != nullptr) {
     thrust::for_each_n(
-      rmm::exec_policy(stream)->on(stream),
+      cudf::detail::scratch_policy(stream)->on(stream),
       thrust::make_counting_iterator(0),
       keys.num_rows(),
-      hash::compute_single_pass_aggs<true, Map>{map,
-                                                keys.num_rows(),
-                                                *d_values,
-                                                *d_sparse_table,
-                                                d_aggs.data().get(),
-                                                static_cast<bitmask_type*>(row_bitmask.data())});
+      hash::compute_single_pass_aggs<true, Map>{
+        map, keys.num_rows(), *d_values, *d_sparse_table, d_aggs.data().get(), row_bitmask});
   } else {
     thrust::for_each_n(
-      rmm::exec_policy(stream)->on(stream),
+      cudf::detail::scratch_policy(stream)->on(stream),
       thrust::make_counting_iterator(0),
       keys.num_rows(),
       hash::compute_single_pass_aggs<false, Map>{
@@ -307,16 +551,194 @@ void compute_single_pass_aggs(table_view const& keys,
   }
 }
 
+/**
+ * @brief Dispatched functor computing the sparse VARIANCE of a column of values
+ */
+template <typename Map>
+struct variance_functor {
+  template <typename T>
+  std::enable_if_t<std::is_arithmetic<T>::value, std::unique_ptr<column>> operator()(
+    column_view const& values,
+    column_view const& means,
+    column_view const& group_sizes,
+    size_type ddof,
+    Map& map,
+    bitmask_type const* row_bitmask,
+    cudaStream_t stream)
+  {
+    auto result = make_numeric_column(data_type(type_id::FLOAT64),
+                                      values.size(),
+                                      mask_state::UNALLOCATED,
+                                      stream,
+                                      cudf::detail::scratch_resource());
+    auto result_view = result->mutable_view();
+    thrust::fill(cudf::detail::scratch_policy(stream)->on(stream),
+                 result_view.begin<double>(),
+                 result_view.end<double>(),
+                 0.0);
+
+    auto d_values      = column_device_view::create(values, stream);
+    auto d_means       = column_device_view::create(means, stream);
+    auto d_group_sizes = column_device_view::create(group_sizes, stream);
+    thrust::for_each_n(cudf::detail::scratch_policy(stream)->on(stream),
+                       thrust::make_counting_iterator(0),
+                       values.size(),
+                       hash::compute_variance<T, Map>{
+                         map,
+                         *d_values,
+                         *d_means,
+                         *d_group_sizes,
+                         ddof,
+                         result_view.data<double>(),
+                         row_bitmask});
+
+    // Groups without more than `ddof` valid values have a null variance
+    auto null_mask = cudf::detail::valid_if(
+      group_sizes.begin<size_type>(),
+      group_sizes.end<size_type>(),
+      [ddof] __device__(size_type group_size) { return group_size - ddof > 0; },
+      stream,
+      cudf::detail::scratch_resource());
+    result->set_null_mask(std::move(null_mask.first), null_mask.second);
+    return result;
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<!std::is_arithmetic<T>::value, std::unique_ptr<column>> operator()(Args&&...)
+  {
+    CUDF_FAIL("Only numeric types are supported in std/variance");
+  }
+};
+
+/**
+ * @brief Computes the sparse NUNIQUE of a column of values
+ */
+template <typename Map>
+std::unique_ptr<column> compute_nunique(table_view const& keys,
+                                        column_view const& values,
+                                        null_policy null_handling,
+                                        Map& map,
+                                        bitmask_type const* row_bitmask,
+                                        cudaStream_t stream)
+{
+  auto result = make_numeric_column(data_type(type_to_id<size_type>()),
+                                    values.size(),
+                                    mask_state::UNALLOCATED,
+                                    stream,
+                                    cudf::detail::scratch_resource());
+  auto result_view = result->mutable_view();
+  thrust::fill(cudf::detail::scratch_policy(stream)->on(stream),
+               result_view.begin<size_type>(),
+               result_view.end<size_type>(),
+               0);
+
+  // A second map holds the distinct (keys, value) rows; null values are equal to each other, and
+  // rows with null keys are either skipped or grouped together
+  std::vector<column_view> keys_and_values(keys.begin(), keys.end());
+  keys_and_values.push_back(values);
+  auto d_keys_and_values = table_device_view::create(table_view{keys_and_values}, stream);
+  auto distinct_map      = create_hash_map<true>(
+    *d_keys_and_values, null_policy::INCLUDE, nullptr, cudf::detail::scratch_resource(), stream);
+
+  auto d_values    = column_device_view::create(values, stream);
+  using DistinctMap = std::remove_reference_t<decltype(*distinct_map)>;
+  thrust::for_each_n(cudf::detail::scratch_policy(stream)->on(stream),
+                     thrust::make_counting_iterator(0),
+                     values.size(),
+                     hash::compute_nunique<Map, DistinctMap>{
+                       map,
+                       *distinct_map,
+                       *d_values,
+                       null_handling == null_policy::EXCLUDE,
+                       result_view.data<size_type>(),
+                       row_bitmask});
+  return result;
+}
+
+/**
+ * @brief Computes all aggregations from `requests` that are finalized from single pass
+ * aggregations or need a pass of their own, and stores the results in `sparse_results`
+ *
+ * MEAN is the SUM over the COUNT_VALID of a group, and VARIANCE and STD are computed in a second
+ * pass over the values given the MEAN, as in the sort-based groupby.
+ *
+ * @see groupby_null_templated()
+ */
+template <bool keys_have_nulls, typename Map>
+void compute_multi_pass_aggs(table_view const& keys,
+                             std::vector<aggregation_request> const& requests,
+                             cudf::detail::result_cache* sparse_results,
+                             Map& map,
+                             bitmask_type const* d_row_bitmask,
+                             cudaStream_t stream)
+{
+  for (size_t i = 0; i < requests.size(); i++) {
+    auto const& values = requests[i].values;
+
+    auto compute_mean = [&]() {
+      aggregation const mean_agg{aggregation::MEAN};
+      if (sparse_results->has_result(i, mean_agg)) { return; }
+      auto result = cudf::detail::binary_operation(
+        sparse_results->get_result(i, aggregation{aggregation::SUM}),
+        sparse_results->get_result(i, aggregation{aggregation::COUNT_VALID}),
+        binary_operator::DIV,
+        cudf::detail::target_type(values.type(), aggregation::MEAN),
+        cudf::detail::scratch_resource(),
+        stream);
+      sparse_results->add_result(i, mean_agg, std::move(result));
+    };
+
+    auto compute_var = [&](size_type ddof) {
+      auto var_agg = make_variance_aggregation(ddof);
+      if (sparse_results->has_result(i, *var_agg)) { return; }
+      compute_mean();
+      auto result =
+        type_dispatcher(values.type(),
+                        variance_functor<Map>{},
+                        values,
+                        sparse_results->get_result(i, aggregation{aggregation::MEAN}),
+                        sparse_results->get_result(i, aggregation{aggregation::COUNT_VALID}),
+                        ddof,
+                        map,
+                        d_row_bitmask,
+                        stream);
+      sparse_results->add_result(i, *var_agg, std::move(result));
+    };
+
+    for (auto&& agg : requests[i].aggregations) {
+      if (sparse_results->has_result(i, *agg)) { continue; }
+      if (agg->kind == aggregation::MEAN) {
+        compute_mean();
+      } else if (agg->kind == aggregation::VARIANCE) {
+        compute_var(static_cast<cudf::detail::std_var_aggregation const&>(*agg)._ddof);
+      } else if (agg->kind == aggregation::STD) {
+        auto const ddof = static_cast<cudf::detail::std_var_aggregation const&>(*agg)._ddof;
+        compute_var(ddof);
+        auto result = cudf::detail::unary_operation(
+          sparse_results->get_result(i, *make_variance_aggregation(ddof)),
+          unary_op::SQRT,
+          cudf::detail::scratch_resource(),
+          stream);
+        sparse_results->add_result(i, *agg, std::move(result));
+      } else if (agg->kind == aggregation::NUNIQUE) {
+        auto const null_handling =
+          static_cast<cudf::detail::nunique_aggregation const&>(*agg)._null_handling;
+        sparse_results->add_result(
+          i, *agg, compute_nunique(keys, values, null_handling, map, d_row_bitmask, stream));
+      }
+    }
+  }
+}
+
 /**
  * @brief Computes and returns a device vector containing all populated keys in
  * `map`.
  */
 template <typename Map>
-std::pair<rmm::device_vector<size_type>, size_type> extract_populated_keys(Map map,
-                                                                           size_type num_keys,
-                                                                           cudaStream_t stream = 0)
+std::pair<cudf::detail::scratch_vector<size_type>, size_type> extract_populated_keys(
+  Map map, size_type num_keys, cudaStream_t stream = 0)
 {
-  rmm::device_vector<size_type> populated_keys(num_keys);
+  cudf::detail::scratch_vector<size_type> populated_keys(num_keys);
 
   auto get_key = [] __device__(auto const& element) {
     size_type key, value;
@@ -325,7 +747,7 @@ std::pair<rmm::device_vector<size_type>, size_type> extract_populated_keys(Map m
   };
 
   auto end_it = thrust::copy_if(
-    rmm::exec_policy(stream)->on(stream),
+    cudf::detail::scratch_policy(stream)->on(stream),
     thrust::make_transform_iterator(map.data(), get_key),
     thrust::make_transform_iterator(map.data() + map.capacity(), get_key),
     populated_keys.begin(),
@@ -368,26 +790,54 @@ std::unique_ptr<table> groupby_null_templated(table_view const& keys,
                                               std::vector<aggregation_request> const& requests,
                                               cudf::detail::result_cache* cache,
                                               null_policy include_null_keys,
+                                              column_view const* boolean_mask,
+                                              size_type estimated_num_groups,
                                               cudaStream_t stream,
                                               rmm::mr::device_memory_resource* mr)
 {
-  auto d_keys = table_device_view::create(keys);
-  auto map    = create_hash_map<keys_have_nulls>(*d_keys, include_null_keys, stream);
+  // A map too small for the distinct keys would never complete an insertion, so an estimate
+  // sizes it with a wide margin
+  auto const map_keys =
+    (estimated_num_groups < 0)
+      ? keys.num_rows()
+      : static_cast<size_type>(std::min<int64_t>(
+          keys.num_rows(), 2 * static_cast<int64_t>(estimated_num_groups) + MAP_SIZE_MARGIN));
+  auto d_keys             = table_device_view::create(keys);
+  auto const row_hashes   = compute_row_hashes<keys_have_nulls>(keys, *d_keys, stream);
+  auto const d_row_hashes = row_hashes.empty() ? nullptr : row_hashes.data().get();
+  auto map                = create_hash_map<keys_have_nulls>(
+    *d_keys, include_null_keys, d_row_hashes, map_keys, cudf::detail::scratch_resource(), stream);
 
   // Cache of sparse results where the location of aggregate value in each
   // column is indexed by the hash map
   cudf::detail::result_cache sparse_results(requests.size());
 
+  // Rows with null keys, when they are excluded, and rows not selected by the boolean mask are
+  // skipped by every aggregation
+  auto const row_bitmask = compute_row_bitmask(
+    keys, keys_have_nulls and include_null_keys == null_policy::EXCLUDE, boolean_mask, stream);
+  auto const d_row_bitmask = static_cast<bitmask_type const*>(row_bitmask.data());
+
   // Compute all single pass aggs first
-  compute_single_pass_aggs<keys_have_nulls>(
-    keys, requests, &sparse_results, *map, include_null_keys, stream);
+  bool const few_groups =
+    estimated_num_groups < 0 or estimated_num_groups <= hash::SHARED_MEMORY_AGG_SLOTS;
+  compute_single_pass_aggs<keys_have_nulls>(keys,
+                                            requests,
+                                            &sparse_results,
+                                            *map,
+                                            include_null_keys,
+                                            d_row_hashes,
+                                            d_row_bitmask,
+                                            few_groups,
+                                            stream);
 
   // Now continue with remaining multi-pass aggs
-  // <placeholder>
+  compute_multi_pass_aggs<keys_have_nulls>(
+    keys, requests, &sparse_results, *map, d_row_bitmask, stream);
 
   // Extract the populated indices from the hash map and create a gather map.
   // Gathering using this map from sparse results will give dense results.
-  rmm::device_vector<size_type> gather_map;
+  cudf::detail::scratch_vector<size_type> gather_map;
   size_type map_size;
   std::tie(gather_map, map_size) = extract_populated_keys(*map, keys.num_rows(), stream);
 
@@ -413,8 +863,8 @@ std::unique_ptr<table> groupby_null_templated(table_view const& keys,
 bool can_use_hash_groupby(table_view const& keys, std::vector<aggregation_request> const& requests)
 {
   return std::all_of(requests.begin(), requests.end(), [](aggregation_request const& r) {
-    return std::all_of(r.aggregations.begin(), r.aggregations.end(), [](auto const& a) {
-      return is_hash_aggregation(a->kind);
+    return std::all_of(r.aggregations.begin(), r.aggregations.end(), [&r](auto const& a) {
+      return is_hash_aggregation(a->kind, r.values.type());
     });
   });
 }
@@ -424,18 +874,24 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
   table_view const& keys,
   std::vector<aggregation_request> const& requests,
   null_policy include_null_keys,
+  column_view const* boolean_mask,
+  size_type estimated_num_groups,
   cudaStream_t stream,
   rmm::mr::device_memory_resource* mr)
 {
   cudf::detail::result_cache cache(requests.size());
 
+  // The hash map is built from the keys and every aggregation reads them again through it
+  cudf::detail::prefetch(keys, stream);
+  for (auto const& request : requests) { cudf::detail::prefetch(request.values, stream); }
+
   std::unique_ptr<table> unique_keys;
   if (has_nulls(keys)) {
-    unique_keys =
-      groupby_null_templated<true>(keys, requests, &cache, include_null_keys, stream, mr);
+    unique_keys = groupby_null_templated<true>(
+      keys, requests, &cache, include_null_keys, boolean_mask, estimated_num_groups, stream, mr);
   } else {
-    unique_keys =
-      groupby_null_templated<false>(keys, requests, &cache, include_null_keys, stream, mr);
+    unique_keys = groupby_null_templated<false>(
+      keys, requests, &cache, include_null_keys, boolean_mask, estimated_num_groups, stream, mr);
   }
 
   return std::make_pair(std::move(unique_keys), extract_results(requests, cache));
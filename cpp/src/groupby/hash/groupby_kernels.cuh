@@ -18,7 +18,9 @@
 
 #include <cudf/detail/aggregation/aggregation.cuh>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/utilities/release_assert.cuh>
 #include <cudf/groupby.hpp>
+#include <cudf/table/table_device_view.cuh>
 #include <cudf/utilities/bit.hpp>
 
 namespace cudf {
@@ -111,7 +113,327 @@ struct compute_single_pass_aggs {
   }
 };
 
-// TODO (dm): variance kernel
+/**
+ * @brief Number of slots of the per-block hash table of `compute_shared_memory_aggs`
+ */
+constexpr size_type SHARED_MEMORY_AGG_SLOTS = 128;
+
+/**
+ * @brief Maximum number of slots probed in the per-block hash table before a row is aggregated
+ * directly into the global hash map
+ */
+constexpr size_type SHARED_MEMORY_AGG_MAX_PROBES = 8;
+
+/**
+ * @brief Number of rows aggregated by a block between two flushes of its table
+ */
+constexpr size_type SHARED_MEMORY_AGG_ROWS_PER_BLOCK = 4096;
+
+constexpr int SHARED_MEMORY_AGG_BLOCK_SIZE = 256;
+
+/**
+ * @brief Indicates whether the aggregation `k` of values of type `Source` can be accumulated in
+ * shared memory by `compute_shared_memory_aggs`
+ */
+template <typename Source, aggregation::Kind k>
+constexpr bool is_shared_memory_aggregation()
+{
+  return std::is_arithmetic<Source>::value and not std::is_same<Source, bool>::value and
+         (k == aggregation::SUM or k == aggregation::SUM_OF_SQUARES or k == aggregation::MIN or
+          k == aggregation::MAX or k == aggregation::COUNT_VALID or k == aggregation::COUNT_ALL);
+}
+
+/**
+ * @brief Dispatched functor setting a shared memory accumulator to the identity of its
+ * aggregation
+ */
+struct initialize_shared_accumulator {
+  template <typename Source, aggregation::Kind k>
+  __device__ std::enable_if_t<is_shared_memory_aggregation<Source, k>()> operator()(
+    void* accumulator) const noexcept
+  {
+    using Target = cudf::detail::target_type_t<Source, k>;
+    *static_cast<Target*>(accumulator) =
+      cudf::detail::corresponding_operator_t<k>::template identity<Target>();
+  }
+
+  template <typename Source, aggregation::Kind k>
+  __device__ std::enable_if_t<not is_shared_memory_aggregation<Source, k>()> operator()(
+    void*) const noexcept
+  {
+    release_assert(false and "Unsupported shared memory aggregation.");
+  }
+};
+
+/**
+ * @brief Dispatched functor aggregating an element of `source` into a shared memory accumulator,
+ * with the same semantics as `update_target_element`
+ */
+struct update_shared_accumulator {
+  template <typename Source, aggregation::Kind k>
+  __device__ std::enable_if_t<is_shared_memory_aggregation<Source, k>()> operator()(
+    void* accumulator,
+    bool* accumulator_valid,
+    column_device_view source,
+    size_type source_index) const noexcept
+  {
+    using Target = cudf::detail::target_type_t<Source, k>;
+    auto target  = static_cast<Target*>(accumulator);
+    if (k == aggregation::COUNT_ALL) {
+      atomicAdd(target, Target{1});
+      return;
+    }
+    if (source.is_null(source_index)) { return; }
+
+    auto const element = static_cast<Target>(source.element<Source>(source_index));
+    switch (k) {
+      case aggregation::SUM: atomicAdd(target, element); break;
+      case aggregation::SUM_OF_SQUARES:
+        atomicAdd(target, static_cast<Target>(element * element));
+        break;
+      case aggregation::MIN: atomicMin(target, element); break;
+      case aggregation::MAX: atomicMax(target, element); break;
+      case aggregation::COUNT_VALID: atomicAdd(target, Target{1}); break;
+      default: break;
+    }
+    *accumulator_valid = true;
+  }
+
+  template <typename Source, aggregation::Kind k>
+  __device__ std::enable_if_t<not is_shared_memory_aggregation<Source, k>()> operator()(
+    void*, bool*, column_device_view, size_type) const noexcept
+  {
+    release_assert(false and "Unsupported shared memory aggregation.");
+  }
+};
+
+/**
+ * @brief Dispatched functor merging a shared memory accumulator into an element of `target`
+ *
+ * Partial sums and counts are added, and partial minimums and maximums are compared. An
+ * accumulator to which no valid element was aggregated leaves the target unchanged.
+ */
+struct merge_shared_accumulator {
+  template <typename Source, aggregation::Kind k>
+  __device__ std::enable_if_t<is_shared_memory_aggregation<Source, k>()> operator()(
+    mutable_column_device_view target,
+    size_type target_index,
+    void const* accumulator,
+    bool accumulator_valid) const noexcept
+  {
+    using Target = cudf::detail::target_type_t<Source, k>;
+    auto const partial = *static_cast<Target const*>(accumulator);
+    if (k == aggregation::COUNT_VALID or k == aggregation::COUNT_ALL) {
+      if (partial != 0) { atomicAdd(&target.element<Target>(target_index), partial); }
+      return;
+    }
+    if (not accumulator_valid) { return; }
+
+    switch (k) {
+      case aggregation::SUM:
+      case aggregation::SUM_OF_SQUARES:
+        atomicAdd(&target.element<Target>(target_index), partial);
+        break;
+      case aggregation::MIN: atomicMin(&target.element<Target>(target_index), partial); break;
+      case aggregation::MAX: atomicMax(&target.element<Target>(target_index), partial); break;
+      default: break;
+    }
+    if (target.nullable() and target.is_null(target_index)) { target.set_valid(target_index); }
+  }
+
+  template <typename Source, aggregation::Kind k>
+  __device__ std::enable_if_t<not is_shared_memory_aggregation<Source, k>()> operator()(
+    mutable_column_device_view, size_type, void const*, bool) const noexcept
+  {
+    release_assert(false and "Unsupported shared memory aggregation.");
+  }
+};
+
+/**
+ * @brief Computes the same single-pass aggregations as `compute_single_pass_aggs`, but first
+ * aggregates the rows of a block in a hash table in shared memory
+ *
+ * With few distinct keys, aggregating every row into the global hash map makes all threads
+ * contend on the atomics of a handful of output rows. Instead, each block aggregates a chunk of
+ * `rows_per_block` rows into a small shared memory table of `SHARED_MEMORY_AGG_SLOTS` keys, then
+ * inserts each of its keys into the global map and merges the partial results into
+ * `output_values` once. A row whose key does not find a slot within
+ * `SHARED_MEMORY_AGG_MAX_PROBES` probes, e.g. once the table is full of other keys, is aggregated
+ * directly into the global map.
+ *
+ * Only the aggregations for which `is_shared_memory_aggregation` is true are supported. The
+ * dynamic shared memory must hold `input_values.num_columns()` 8-byte accumulators and validity
+ * flags per slot, followed by the slot keys.
+ *
+ * @tparam skip_rows_with_nulls Indicates if rows in the keys containing null values should be
+ * skipped, in which case bit `i` of `row_bitmask` is set if row `i` has no null
+ * @tparam Map The type of the hash map
+ * @tparam KeyHasher The type of the row hasher of the keys
+ * @tparam KeyEqual The type of the row comparator of the keys
+ */
+template <bool skip_rows_with_nulls, typename Map, typename KeyHasher, typename KeyEqual>
+__global__ void compute_shared_memory_aggs(Map map,
+                                           KeyHasher key_hasher,
+                                           KeyEqual key_equal,
+                                           size_type num_rows,
+                                           size_type rows_per_block,
+                                           table_device_view input_values,
+                                           mutable_table_device_view output_values,
+                                           aggregation::Kind const* __restrict__ aggs,
+                                           bitmask_type const* __restrict__ row_bitmask)
+{
+  size_type constexpr empty_slot{-1};
+  extern __shared__ int64_t shared_memory[];
+
+  // Shared memory layout: accumulators, then validity flags, then slot keys
+  auto const num_columns      = input_values.num_columns();
+  auto const num_accumulators = num_columns * SHARED_MEMORY_AGG_SLOTS;
+  int64_t* accumulators       = shared_memory;
+  bool* accumulators_valid    = reinterpret_cast<bool*>(accumulators + num_accumulators);
+  size_type* slot_keys =
+    reinterpret_cast<size_type*>(accumulators_valid + (num_accumulators + 7) / 8 * 8);
+  auto accumulator_index = [](size_type col, size_type slot) {
+    return col * SHARED_MEMORY_AGG_SLOTS + slot;
+  };
+
+  for (size_type chunk_begin = blockIdx.x * rows_per_block; chunk_begin < num_rows;
+       chunk_begin += gridDim.x * rows_per_block) {
+    auto const chunk_end = min(chunk_begin + rows_per_block, num_rows);
+
+    for (size_type slot = threadIdx.x; slot < SHARED_MEMORY_AGG_SLOTS; slot += blockDim.x) {
+      slot_keys[slot] = empty_slot;
+      for (size_type col = 0; col < num_columns; ++col) {
+        auto const index          = accumulator_index(col, slot);
+        accumulators_valid[index] = false;
+        cudf::detail::dispatch_type_and_aggregation(input_values.column(col).type(),
+                                                    aggs[col],
+                                                    initialize_shared_accumulator{},
+                                                    static_cast<void*>(accumulators + index));
+      }
+    }
+    __syncthreads();
+
+    for (size_type i = chunk_begin + threadIdx.x; i < chunk_end; i += blockDim.x) {
+      if (skip_rows_with_nulls and not cudf::bit_is_set(row_bitmask, i)) { continue; }
+
+      // Find or claim the slot of the key of row `i`
+      size_type slot  = key_hasher(i) % SHARED_MEMORY_AGG_SLOTS;
+      bool found_slot = false;
+      for (size_type probe = 0; probe < SHARED_MEMORY_AGG_MAX_PROBES; ++probe) {
+        auto slot_key = slot_keys[slot];
+        if (slot_key == empty_slot) { slot_key = atomicCAS(&slot_keys[slot], empty_slot, i); }
+        if (slot_key == empty_slot or key_equal(slot_key, i)) {
+          found_slot = true;
+          break;
+        }
+        slot = (slot + 1) % SHARED_MEMORY_AGG_SLOTS;
+      }
+
+      if (found_slot) {
+        for (size_type col = 0; col < num_columns; ++col) {
+          auto const index = accumulator_index(col, slot);
+          cudf::detail::dispatch_type_and_aggregation(input_values.column(col).type(),
+                                                      aggs[col],
+                                                      update_shared_accumulator{},
+                                                      static_cast<void*>(accumulators + index),
+                                                      accumulators_valid + index,
+                                                      input_values.column(col),
+                                                      i);
+        }
+      } else {
+        auto result = map.insert(thrust::make_pair(i, i));
+        cudf::detail::aggregate_row<true, true>(
+          output_values, result.first->second, input_values, i, aggs);
+      }
+    }
+    __syncthreads();
+
+    // Merge the partial results of the block into the global hash map
+    for (size_type slot = threadIdx.x; slot < SHARED_MEMORY_AGG_SLOTS; slot += blockDim.x) {
+      auto const slot_key = slot_keys[slot];
+      if (slot_key == empty_slot) { continue; }
+      auto const target = map.insert(thrust::make_pair(slot_key, slot_key)).first->second;
+      for (size_type col = 0; col < num_columns; ++col) {
+        auto const index = accumulator_index(col, slot);
+        cudf::detail::dispatch_type_and_aggregation(input_values.column(col).type(),
+                                                    aggs[col],
+                                                    merge_shared_accumulator{},
+                                                    output_values.column(col),
+                                                    target,
+                                                    static_cast<void const*>(accumulators + index),
+                                                    accumulators_valid[index]);
+      }
+    }
+    __syncthreads();
+  }
+}
+
+/**
+ * @brief Computes the variance of the values of each group, given the mean and the number of
+ * valid values of the group, and adds it to the sparse `output` column
+ *
+ * The rows of `output`, `means` and `group_sizes` are indexed by the hash map, as in
+ * `compute_single_pass_aggs`. `output` must be initialized with zeros.
+ *
+ * Rows of the keys containing null values are skipped if `row_bitmask` is not null.
+ *
+ * @tparam Source The type of the values
+ * @tparam Map The type of the hash map
+ */
+template <typename Source, typename Map>
+struct compute_variance {
+  Map map;
+  column_device_view values;
+  column_device_view means;
+  column_device_view group_sizes;
+  size_type ddof;
+  double* __restrict__ output;
+  bitmask_type const* __restrict__ row_bitmask;
+
+  __device__ void operator()(size_type i)
+  {
+    if (row_bitmask != nullptr and not cudf::bit_is_set(row_bitmask, i)) { return; }
+    if (values.is_null(i)) { return; }
+
+    auto const target     = map.find(i)->second;
+    auto const group_size = group_sizes.element<size_type>(target);
+    if (group_size - ddof <= 0) { return; }
+
+    auto const x    = static_cast<double>(values.element<Source>(i));
+    auto const mean = means.element<double>(target);
+    atomicAdd(&output[target], (x - mean) * (x - mean) / (group_size - ddof));
+  }
+};
+
+/**
+ * @brief Counts the distinct values of each group into the sparse `output` column
+ *
+ * `distinct_map` is keyed by the rows of a table holding the keys and the values, so a row is
+ * inserted into it only if it is the first occurrence of its value in its group. Rows of the keys
+ * containing null values are skipped if `row_bitmask` is not null.
+ *
+ * @tparam Map The type of the hash map of the keys
+ * @tparam DistinctMap The type of the hash map of the keys and the values
+ */
+template <typename Map, typename DistinctMap>
+struct compute_nunique {
+  Map map;
+  DistinctMap distinct_map;
+  column_device_view values;
+  bool skip_null_values;
+  size_type* __restrict__ output;
+  bitmask_type const* __restrict__ row_bitmask;
+
+  __device__ void operator()(size_type i)
+  {
+    if (row_bitmask != nullptr and not cudf::bit_is_set(row_bitmask, i)) { return; }
+    if (skip_null_values and values.is_null(i)) { return; }
+
+    if (distinct_map.insert(thrust::make_pair(i, i)).second) {
+      atomicAdd(&output[map.find(i)->second], size_type{1});
+    }
+  }
+};
 
 }  // namespace hash
 }  // namespace detail
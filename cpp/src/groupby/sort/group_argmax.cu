@@ -26,14 +26,28 @@ std::unique_ptr<column> group_argmax(column_view const& values,
                                      size_type num_groups,
                                      rmm::device_vector<size_type> const& group_labels,
                                      column_view const& key_sort_order,
+                                     column_view const& gather_map,
                                      rmm::mr::device_memory_resource* mr,
                                      cudaStream_t stream)
 {
+  // Values read through the gather map are found at their index in the unsorted values
+  if (not gather_map.is_empty()) {
+    return type_dispatcher(values.type(),
+                           reduce_functor<aggregation::ARGMAX>{},
+                           values,
+                           num_groups,
+                           group_labels,
+                           gather_map,
+                           mr,
+                           stream);
+  }
+
   auto indices = type_dispatcher(values.type(),
                                  reduce_functor<aggregation::ARGMAX>{},
                                  values,
                                  num_groups,
                                  group_labels,
+                                 gather_map,
                                  rmm::mr::get_default_resource(),
                                  stream);
 
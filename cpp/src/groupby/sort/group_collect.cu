@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/types.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/tabulate.h>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+namespace {
+/**
+ * @brief Flags the values to collect: the valid ones, or all if nulls are included, and of
+ * those only the first of each run of equal values of a group if `distinct`
+ */
+void flag_collected_values(column_view const& values,
+                           rmm::device_vector<size_type> const& group_labels,
+                           rmm::device_vector<size_type> const& group_offsets,
+                           bool distinct,
+                           null_policy null_handling,
+                           mutable_column_view keep,
+                           cudaStream_t stream)
+{
+  auto d_values = table_device_view::create(table_view{{values}}, stream);
+  thrust::tabulate(rmm::exec_policy(stream)->on(stream),
+                   keep.begin<bool>(),
+                   keep.end<bool>(),
+                   [values        = d_values->column(0),
+                    equal         = row_equality_comparator<true>{*d_values, *d_values},
+                    group_labels  = group_labels.data().get(),
+                    group_offsets = group_offsets.data().get(),
+                    distinct,
+                    include_nulls = null_handling == null_policy::INCLUDE] __device__(size_type i) {
+                     if (not include_nulls and values.is_null(i)) { return false; }
+                     return not distinct or group_offsets[group_labels[i]] == i or
+                            not equal(i, i - 1);
+                   });
+}
+}  // namespace
+
+std::unique_ptr<column> group_collect(column_view const& values,
+                                      rmm::device_vector<size_type> const& group_labels,
+                                      rmm::device_vector<size_type> const& group_offsets,
+                                      size_type num_groups,
+                                      bool distinct,
+                                      null_policy null_handling,
+                                      rmm::mr::device_memory_resource* mr,
+                                      cudaStream_t stream)
+{
+  CUDF_EXPECTS(static_cast<size_t>(values.size()) == group_labels.size(),
+               "Size of values column should be same as that of group labels");
+  CUDF_EXPECTS(group_offsets.size() == static_cast<size_t>(num_groups) + 1,
+               "Size of group offsets should be one more than the number of groups");
+
+  auto offsets = make_numeric_column(
+    data_type(type_to_id<size_type>()), num_groups + 1, mask_state::UNALLOCATED, stream, mr);
+  auto d_offsets = offsets->mutable_view().begin<size_type>();
+
+  // Every value is collected: the groups are the lists
+  if (not distinct and (null_handling == null_policy::INCLUDE or not values.has_nulls())) {
+    thrust::copy(rmm::exec_policy(stream)->on(stream),
+                 group_offsets.begin(),
+                 group_offsets.end(),
+                 d_offsets);
+    return make_lists_column(num_groups,
+                             std::move(offsets),
+                             std::make_unique<column>(values, stream, mr),
+                             0,
+                             rmm::device_buffer{0, stream, mr},
+                             stream,
+                             mr);
+  }
+
+  auto keep = make_numeric_column(
+    data_type(type_id::BOOL8), values.size(), mask_state::UNALLOCATED, stream);
+  flag_collected_values(
+    values, group_labels, group_offsets, distinct, null_handling, keep->mutable_view(), stream);
+
+  // The position of each value among the collected ones, a group's being the offset of its list
+  rmm::device_vector<size_type> positions(values.size() + 1, 0);
+  auto const d_keep = thrust::make_transform_iterator(
+    keep->view().begin<bool>(), [] __device__(bool k) { return static_cast<size_type>(k); });
+  thrust::inclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         d_keep,
+                         d_keep + values.size(),
+                         positions.begin() + 1);
+  thrust::gather(rmm::exec_policy(stream)->on(stream),
+                 group_offsets.begin(),
+                 group_offsets.end(),
+                 positions.begin(),
+                 d_offsets);
+
+  auto collected =
+    cudf::detail::apply_boolean_mask(table_view{{values}}, keep->view(), mr, stream)->release();
+  return make_lists_column(num_groups,
+                           std::move(offsets),
+                           std::move(collected.front()),
+                           0,
+                           rmm::device_buffer{0, stream, mr},
+                           stream,
+                           mr);
+}
+
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
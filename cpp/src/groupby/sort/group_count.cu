@@ -21,6 +21,7 @@
 
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/permutation_iterator.h>
 
 namespace cudf {
 namespace groupby {
@@ -28,6 +29,7 @@ namespace detail {
 std::unique_ptr<column> group_count_valid(column_view const& values,
                                           rmm::device_vector<size_type> const& group_labels,
                                           size_type num_groups,
+                                          column_view const& gather_map,
                                           rmm::mr::device_memory_resource* mr,
                                           cudaStream_t stream)
 {
@@ -49,12 +51,23 @@ std::unique_ptr<column> group_count_valid(column_view const& values,
       thrust::make_transform_iterator(cudf::detail::make_validity_iterator(*values_view),
                                       [] __device__(auto b) { return static_cast<size_type>(b); });
 
-    thrust::reduce_by_key(rmm::exec_policy(stream)->on(stream),
-                          group_labels.begin(),
-                          group_labels.end(),
-                          bitmask_iterator,
-                          thrust::make_discard_iterator(),
-                          result->mutable_view().begin<size_type>());
+    if (gather_map.is_empty()) {
+      thrust::reduce_by_key(rmm::exec_policy(stream)->on(stream),
+                            group_labels.begin(),
+                            group_labels.end(),
+                            bitmask_iterator,
+                            thrust::make_discard_iterator(),
+                            result->mutable_view().begin<size_type>());
+    } else {
+      // Only the validity of the ungrouped values is read through the gather map
+      thrust::reduce_by_key(
+        rmm::exec_policy(stream)->on(stream),
+        group_labels.begin(),
+        group_labels.end(),
+        thrust::make_permutation_iterator(bitmask_iterator, gather_map.begin<size_type>()),
+        thrust::make_discard_iterator(),
+        result->mutable_view().begin<size_type>());
+    }
   } else {
     thrust::reduce_by_key(rmm::exec_policy(stream)->on(stream),
                           group_labels.begin(),
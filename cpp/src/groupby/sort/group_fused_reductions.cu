@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "group_reductions.hpp"
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/aggregation/aggregation.cuh>
+#include <cudf/detail/gather.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+namespace {
+/**
+ * @brief Maps the indices of the sorted values found by ARGMIN or ARGMAX to indices of the
+ * unsorted values, as `group_argmin` does.
+ */
+std::unique_ptr<column> unsort_indices(column const& indices,
+                                       column_view const& key_sort_order,
+                                       rmm::mr::device_memory_resource* mr,
+                                       cudaStream_t stream)
+{
+  // The null groups hold ARGMIN_SENTINEL, which is out of bounds and gathers a null
+  column_view null_removed_indices(
+    data_type(type_to_id<size_type>()),
+    indices.size(),
+    static_cast<void const*>(indices.view().template data<size_type>()));
+  auto result_table =
+    cudf::detail::gather(table_view({key_sort_order}),
+                         null_removed_indices,
+                         indices.nullable() ? cudf::detail::out_of_bounds_policy::IGNORE
+                                            : cudf::detail::out_of_bounds_policy::NULLIFY,
+                         cudf::detail::negative_index_policy::NOT_ALLOWED,
+                         mr,
+                         stream);
+  return std::move(result_table->release()[0]);
+}
+
+}  // namespace
+
+bool is_fusable_reduction(data_type type, aggregation::Kind kind)
+{
+  switch (kind) {
+    case aggregation::SUM: return cudf::is_numeric(type);
+    case aggregation::MIN:
+    case aggregation::MAX:
+    case aggregation::ARGMIN:
+    case aggregation::ARGMAX:
+    case aggregation::COUNT_VALID: return cudf::is_fixed_width(type);
+    default: return false;
+  }
+}
+
+std::vector<std::unique_ptr<column>> group_fused_reductions(
+  column_view const& values,
+  std::vector<aggregation::Kind> const& kinds,
+  size_type num_groups,
+  rmm::device_vector<size_type> const& group_labels,
+  column_view const& key_sort_order,
+  column_view const& gather_map,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_EXPECTS(
+    std::all_of(kinds.begin(),
+                kinds.end(),
+                [&values](auto kind) { return is_fusable_reduction(values.type(), kind); }),
+    "Unsupported type-agg combination");
+
+  // The results of ARGMIN and ARGMAX are temporary indices of the sorted values, unless the values
+  // are read through the gather map, in which case they are indices of the unsorted values
+  auto const unsort = [&gather_map](auto kind) {
+    return gather_map.is_empty() and (kind == aggregation::ARGMIN or kind == aggregation::ARGMAX);
+  };
+  std::vector<std::unique_ptr<column>> reductions;
+  for (auto kind : kinds) {
+    auto const nullable = kind != aggregation::COUNT_VALID and values.has_nulls();
+    reductions.push_back(
+      make_fixed_width_column(cudf::detail::target_type(values.type(), kind),
+                              num_groups,
+                              nullable ? mask_state::ALL_NULL : mask_state::UNALLOCATED,
+                              stream,
+                              unsort(kind) ? rmm::mr::get_default_resource() : mr));
+  }
+  table reductions_table(std::move(reductions));
+
+  if (values.size() > 0) {
+    auto reductions_view = reductions_table.mutable_view();
+    cudf::detail::initialize_with_identity(reductions_view, kinds, stream);
+
+    // Each row of values updates the group of every reduction, so the values are read once
+    auto const d_reductions = mutable_table_device_view::create(reductions_view, stream);
+    auto const d_values =
+      table_device_view::create(table_view(std::vector<column_view>(kinds.size(), values)), stream);
+    rmm::device_vector<aggregation::Kind> const d_kinds(kinds);
+    auto const source_map = gather_map.is_empty() ? nullptr : gather_map.data<size_type>();
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                       thrust::make_counting_iterator(0),
+                       values.size(),
+                       [d_reductions = *d_reductions,
+                        d_values     = *d_values,
+                        d_kinds      = d_kinds.data().get(),
+                        dest_indices = group_labels.data().get(),
+                        source_map] __device__(size_type i) {
+                         cudf::detail::aggregate_row<true, true>(d_reductions,
+                                                                 dest_indices[i],
+                                                                 d_values,
+                                                                 source_map ? source_map[i] : i,
+                                                                 d_kinds);
+                       });
+  }
+
+  reductions = reductions_table.release();
+  for (size_t i = 0; i < kinds.size(); ++i) {
+    if (unsort(kinds[i])) {
+      reductions[i] = unsort_indices(*reductions[i], key_sort_order, mr, stream);
+    }
+  }
+  return reductions;
+}
+
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
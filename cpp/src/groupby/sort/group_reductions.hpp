@@ -18,10 +18,12 @@
 
 #include <cudf/aggregation.hpp>
 #include <cudf/column/column.hpp>
+#include <cudf/replace.hpp>
 
 #include <rmm/thrust_rmm_allocator.h>
 
 #include <memory>
+#include <vector>
 
 namespace cudf {
 namespace groupby {
@@ -32,12 +34,15 @@ namespace detail {
  * @param values Grouped values to get sum of
  * @param num_groups Number of groups
  * @param group_labels ID of group that the corresponding value belongs to
+ * @param gather_map Indices of the grouped values in @p values, through which ungrouped values
+ *   are read without being gathered; empty if @p values are grouped already
  * @param mr Device memory resource used to allocate the returned column's device memory
  * @param stream CUDA stream used for device memory operations and kernel launches.
  */
 std::unique_ptr<column> group_sum(column_view const& values,
                                   size_type num_groups,
                                   rmm::device_vector<size_type> const& group_labels,
+                                  column_view const& gather_map,
                                   rmm::mr::device_memory_resource* mr,
                                   cudaStream_t stream = 0);
 
@@ -47,12 +52,15 @@ std::unique_ptr<column> group_sum(column_view const& values,
  * @param values Grouped values to get minimum from
  * @param num_groups Number of groups
  * @param group_labels ID of group that the corresponding value belongs to
+ * @param gather_map Indices of the grouped values in @p values, through which ungrouped values
+ *   are read without being gathered; empty if @p values are grouped already
  * @param mr Device memory resource used to allocate the returned column's device memory
  * @param stream CUDA stream used for device memory operations and kernel launches.
  */
 std::unique_ptr<column> group_min(column_view const& values,
                                   size_type num_groups,
                                   rmm::device_vector<size_type> const& group_labels,
+                                  column_view const& gather_map,
                                   rmm::mr::device_memory_resource* mr,
                                   cudaStream_t stream = 0);
 
@@ -62,22 +70,28 @@ std::unique_ptr<column> group_min(column_view const& values,
  * @param values Grouped values to get maximum from
  * @param num_groups Number of groups
  * @param group_labels ID of group that the corresponding value belongs to
+ * @param gather_map Indices of the grouped values in @p values, through which ungrouped values
+ *   are read without being gathered; empty if @p values are grouped already
  * @param mr Device memory resource used to allocate the returned column's device memory
  * @param stream CUDA stream used for device memory operations and kernel launches.
  */
 std::unique_ptr<column> group_max(column_view const& values,
                                   size_type num_groups,
                                   rmm::device_vector<size_type> const& group_labels,
+                                  column_view const& gather_map,
                                   rmm::mr::device_memory_resource* mr,
                                   cudaStream_t stream = 0);
 
 /**
  * @brief Internal API to calculate group-wise indices of maximum values.
  *
- * @param values Ungrouped values to get maximum value's index from
+ * @param values Grouped values, or ungrouped values read through @p gather_map, to get maximum
+ *   value's index from
  * @param num_groups Number of groups
  * @param group_labels ID of group that the corresponding value belongs to
  * @param key_sort_order Indices indicating sort order of groupby keys
+ * @param gather_map Indices of the grouped values in @p values, through which ungrouped values
+ *   are read without being gathered; empty if @p values are grouped already
  * @param mr Device memory resource used to allocate the returned column's device memory
  * @param stream CUDA stream used for device memory operations and kernel launches.
  */
@@ -85,16 +99,20 @@ std::unique_ptr<column> group_argmax(column_view const& values,
                                      size_type num_groups,
                                      rmm::device_vector<size_type> const& group_labels,
                                      column_view const& key_sort_order,
+                                     column_view const& gather_map,
                                      rmm::mr::device_memory_resource* mr,
                                      cudaStream_t stream = 0);
 
 /**
  * @brief Internal API to calculate group-wise indices of minimum values.
  *
- * @param values Ungrouped values to get minimum value's index from
+ * @param values Grouped values, or ungrouped values read through @p gather_map, to get minimum
+ *   value's index from
  * @param num_groups Number of groups
  * @param group_labels ID of group that the corresponding value belongs to
  * @param key_sort_order Indices indicating sort order of groupby keys
+ * @param gather_map Indices of the grouped values in @p values, through which ungrouped values
+ *   are read without being gathered; empty if @p values are grouped already
  * @param mr Device memory resource used to allocate the returned column's device memory
  * @param stream CUDA stream used for device memory operations and kernel launches.
  */
@@ -102,9 +120,51 @@ std::unique_ptr<column> group_argmin(column_view const& values,
                                      size_type num_groups,
                                      rmm::device_vector<size_type> const& group_labels,
                                      column_view const& key_sort_order,
+                                     column_view const& gather_map,
                                      rmm::mr::device_memory_resource* mr,
                                      cudaStream_t stream = 0);
 
+/**
+ * @brief Internal API to check whether a reduction of values of type @p type can be computed by
+ * `group_fused_reductions`
+ *
+ * @param type Type of the values to reduce
+ * @param kind Kind of the reduction
+ */
+bool is_fusable_reduction(data_type type, aggregation::Kind kind);
+
+/**
+ * @brief Internal API to calculate several groupwise reductions of the same values in a single
+ * pass over the values
+ *
+ * Each row of @p values updates its group in the result of every reduction, so that the values
+ * are read once however many reductions are requested. The results are the same as those of
+ * `group_sum`, `group_min`, `group_max`, `group_argmin`, `group_argmax` and `group_count_valid`.
+ *
+ * @throws cudf::logic_error if a reduction is not `is_fusable_reduction` for the values
+ *
+ * @param values Grouped values, or ungrouped values read through @p gather_map, to reduce
+ * @param kinds Kinds of the reductions: SUM, MIN, MAX, ARGMIN, ARGMAX or COUNT_VALID
+ * @param num_groups Number of groups
+ * @param group_labels ID of group that the corresponding value belongs to
+ * @param key_sort_order Indices indicating sort order of groupby keys, to map the indices found
+ * by ARGMIN and ARGMAX to the unsorted values
+ * @param gather_map Indices of the grouped values in @p values, through which ungrouped values
+ *   are read without being gathered; empty if @p values are grouped already
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The result of each reduction of @p kinds, in order
+ */
+std::vector<std::unique_ptr<column>> group_fused_reductions(
+  column_view const& values,
+  std::vector<aggregation::Kind> const& kinds,
+  size_type num_groups,
+  rmm::device_vector<size_type> const& group_labels,
+  column_view const& key_sort_order,
+  column_view const& gather_map,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream = 0);
+
 /**
  * @brief Internal API to calculate number of non-null values in each group of
  *  @p values
@@ -112,12 +172,15 @@ std::unique_ptr<column> group_argmin(column_view const& values,
  * @param values Grouped values to get valid count of
  * @param group_labels ID of group that the corresponding value belongs to
  * @param num_groups Number of groups ( unique values in @p group_labels )
+ * @param gather_map Indices of the grouped values in @p values, through which ungrouped values
+ *   are read without being gathered; empty if @p values are grouped already
  * @param mr Device memory resource used to allocate the returned column's device memory
  * @param stream CUDA stream used for device memory operations and kernel launches.
  */
 std::unique_ptr<column> group_count_valid(column_view const& values,
                                           rmm::device_vector<size_type> const& group_labels,
                                           size_type num_groups,
+                                          column_view const& gather_map,
                                           rmm::mr::device_memory_resource* mr,
                                           cudaStream_t stream = 0);
 
@@ -141,6 +204,8 @@ std::unique_ptr<column> group_count_all(rmm::device_vector<size_type> const& gro
  * @param group_means Pre-calculated groupwise MEAN
  * @param group_sizes Number of valid elements per group
  * @param group_labels ID of group corresponding value in @p values belongs to
+ * @param gather_map Indices of the grouped values in @p values, through which ungrouped values
+ *   are read without being gathered; empty if @p values are grouped already
  * @param ddof Delta degrees of freedom. The divisor used in calculation of
  *             `var` is `N - ddof`, where `N` is the group size.
  * @param mr Device memory resource used to allocate the returned column's device memory
@@ -150,6 +215,7 @@ std::unique_ptr<column> group_var(column_view const& values,
                                   column_view const& group_means,
                                   column_view const& group_sizes,
                                   rmm::device_vector<size_type> const& group_labels,
+                                  column_view const& gather_map,
                                   size_type ddof,
                                   rmm::mr::device_memory_resource* mr,
                                   cudaStream_t stream = 0);
@@ -219,6 +285,52 @@ std::unique_ptr<column> group_nth_element(column_view const& values,
                                           null_policy null_handling,
                                           rmm::mr::device_memory_resource* mr,
                                           cudaStream_t stream = 0);
+
+/**
+ * @brief Internal API to collect the values of each group of @p values into a list
+ *
+ * The lists view the groups of @p values through @p group_offsets, copied into the offsets of
+ * the result. Only the values dropped, nulls if excluded and repeats if @p distinct, require the
+ * values to be compacted and the offsets recomputed.
+ *
+ * @param values Grouped values to collect, sorted within each group if @p distinct
+ * @param group_labels ID of group that the corresponding value belongs to
+ * @param group_offsets Offsets of groups' starting points within @p values
+ * @param num_groups Number of groups
+ * @param distinct Whether each value is collected once per group, nulls being equal
+ * @param null_handling Exclude nulls from the lists if null_policy::EXCLUDE,
+ *  Include nulls if null_policy::INCLUDE.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return A `LIST` column of `num_groups` lists of the type of @p values
+ */
+std::unique_ptr<column> group_collect(column_view const& values,
+                                      rmm::device_vector<size_type> const& group_labels,
+                                      rmm::device_vector<size_type> const& group_offsets,
+                                      size_type num_groups,
+                                      bool distinct,
+                                      null_policy null_handling,
+                                      rmm::mr::device_memory_resource* mr,
+                                      cudaStream_t stream = 0);
+
+/**
+ * @brief Internal API to replace the nulls of each group of @p values with the nearest valid
+ * value of the group preceding or following them
+ *
+ * @param values Ungrouped values whose nulls are to be replaced
+ * @param gather_map Indices of the grouped values in @p values
+ * @param group_labels ID of group that the corresponding grouped value belongs to
+ * @param replace_policy Whether nulls are replaced by the preceding or the following value
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The grouped values, with their nulls replaced
+ */
+std::unique_ptr<column> group_replace_nulls(column_view const& values,
+                                            column_view const& gather_map,
+                                            rmm::device_vector<size_type> const& group_labels,
+                                            replace_policy replace_policy,
+                                            rmm::mr::device_memory_resource* mr,
+                                            cudaStream_t stream = 0);
 }  // namespace detail
 }  // namespace groupby
 }  // namespace cudf
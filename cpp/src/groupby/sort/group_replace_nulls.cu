@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "group_reductions.hpp"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/gather.cuh>
+#include <cudf/replace.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/reverse_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+std::unique_ptr<column> group_replace_nulls(column_view const& values,
+                                            column_view const& gather_map,
+                                            rmm::device_vector<size_type> const& group_labels,
+                                            replace_policy replace_policy,
+                                            rmm::mr::device_memory_resource* mr,
+                                            cudaStream_t stream)
+{
+  CUDF_EXPECTS(static_cast<size_t>(gather_map.size()) == group_labels.size(),
+               "Size of gather map should be same as that of group labels");
+
+  auto const num_rows = gather_map.size();
+  auto const order    = gather_map.data<size_type>();
+  if (!values.has_nulls()) {
+    auto output =
+      cudf::detail::gather(table_view{{values}}, order, order + num_rows, false, mr, stream);
+    return std::move(output->release()[0]);
+  }
+
+  // Grouped row `j` is gathered from the nearest grouped row of its group before or after it
+  // whose value is valid, found by a scan of the grouped indices of the valid rows. The scan
+  // restarts at each group, so rows with no such row in their group get an out of bounds index
+  // and stay null
+  auto device_values = column_device_view::create(values, stream);
+  rmm::device_vector<size_type> source_rows(num_rows);
+  auto exec = rmm::exec_policy(stream);
+  if (replace_policy == cudf::replace_policy::PRECEDING) {
+    auto valid_indices = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0),
+      [d_values = *device_values, order] __device__(size_type j) {
+        return d_values.is_valid_nocheck(order[j]) ? j : -1;
+      });
+    thrust::inclusive_scan_by_key(exec->on(stream),
+                                  group_labels.begin(),
+                                  group_labels.end(),
+                                  valid_indices,
+                                  source_rows.begin(),
+                                  thrust::equal_to<size_type>{},
+                                  thrust::maximum<size_type>{});
+  } else {
+    auto valid_indices = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0),
+      [d_values = *device_values, order, num_rows] __device__(size_type j) {
+        return d_values.is_valid_nocheck(order[j]) ? j : num_rows;
+      });
+    thrust::inclusive_scan_by_key(exec->on(stream),
+                                  group_labels.rbegin(),
+                                  group_labels.rend(),
+                                  thrust::make_reverse_iterator(valid_indices + num_rows),
+                                  source_rows.rbegin(),
+                                  thrust::equal_to<size_type>{},
+                                  thrust::minimum<size_type>{});
+  }
+
+  // Map the grouped indices back to rows of `values`, leaving out of bounds indices as they are
+  auto map = thrust::make_transform_iterator(source_rows.begin(),
+                                             [order, num_rows] __device__(size_type j) {
+                                               return (j >= 0 && j < num_rows) ? order[j] : -1;
+                                             });
+  auto output = cudf::detail::gather(table_view{{values}}, map, map + num_rows, true, mr, stream);
+  return std::move(output->release()[0]);
+}
+
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
@@ -52,6 +52,7 @@ struct reduce_functor {
     column_view const& values,
     size_type num_groups,
     rmm::device_vector<cudf::size_type> const& group_labels,
+    column_view const& gather_map,
     rmm::mr::device_memory_resource* mr,
     cudaStream_t stream)
   {
@@ -73,14 +74,17 @@ struct reduce_functor {
     auto resultview = mutable_column_device_view::create(result->mutable_view());
     auto valuesview = column_device_view::create(values);
 
+    // The grouped values are read through the gather map when they are not materialized
+    auto const source_map = gather_map.is_empty() ? nullptr : gather_map.data<size_type>();
     thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
                        thrust::make_counting_iterator(0),
                        values.size(),
                        [d_values     = *valuesview,
                         d_result     = *resultview,
-                        dest_indices = group_labels.data().get()] __device__(auto i) {
+                        dest_indices = group_labels.data().get(),
+                        source_map] __device__(auto i) {
                          cudf::detail::update_target_element<T, K, true, true>{}(
-                           d_result, dest_indices[i], d_values, i);
+                           d_result, dest_indices[i], d_values, source_map ? source_map[i] : i);
                        });
 
     return result;
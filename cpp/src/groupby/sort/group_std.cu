@@ -37,13 +37,15 @@ struct var_transform {
   column_device_view d_means;
   column_device_view d_group_sizes;
   size_type const* d_group_labels;
+  size_type const* d_gather_map;
   size_type ddof;
 
   __device__ ResultType operator()(size_type i)
   {
-    if (d_values.is_null(i)) return 0.0;
+    auto const source_index = d_gather_map ? d_gather_map[i] : i;
+    if (d_values.is_null(source_index)) return 0.0;
 
-    ResultType x         = d_values.element<T>(i);
+    ResultType x         = d_values.element<T>(source_index);
     size_type group_idx  = d_group_labels[i];
     size_type group_size = d_group_sizes.element<size_type>(group_idx);
 
@@ -62,6 +64,7 @@ struct var_functor {
     column_view const& group_means,
     column_view const& group_sizes,
     rmm::device_vector<size_type> const& group_labels,
+    column_view const& gather_map,
     size_type ddof,
     rmm::mr::device_memory_resource* mr,
     cudaStream_t stream)
@@ -85,9 +88,12 @@ struct var_functor {
     auto d_means       = *means_view;
     auto d_group_sizes = *group_size_view;
 
-    auto values_it = thrust::make_transform_iterator(
+    // Ungrouped values are read in group order through the gather map
+    auto const d_gather_map = gather_map.is_empty() ? nullptr : gather_map.data<size_type>();
+    auto values_it          = thrust::make_transform_iterator(
       thrust::make_counting_iterator(0),
-      var_transform<ResultType, T>{d_values, d_means, d_group_sizes, d_group_labels, ddof});
+      var_transform<ResultType, T>{
+        d_values, d_means, d_group_sizes, d_group_labels, d_gather_map, ddof});
 
     thrust::reduce_by_key(rmm::exec_policy(stream)->on(stream),
                           group_labels.begin(),
@@ -131,12 +137,21 @@ std::unique_ptr<column> group_var(column_view const& values,
                                   column_view const& group_means,
                                   column_view const& group_sizes,
                                   rmm::device_vector<size_type> const& group_labels,
+                                  column_view const& gather_map,
                                   size_type ddof,
                                   rmm::mr::device_memory_resource* mr,
                                   cudaStream_t stream)
 {
-  return type_dispatcher(
-    values.type(), var_functor{}, values, group_means, group_sizes, group_labels, ddof, mr, stream);
+  return type_dispatcher(values.type(),
+                         var_functor{},
+                         values,
+                         group_means,
+                         group_sizes,
+                         group_labels,
+                         gather_map,
+                         ddof,
+                         mr,
+                         stream);
 }
 
 }  // namespace detail
@@ -22,6 +22,7 @@ namespace detail {
 std::unique_ptr<column> group_sum(column_view const& values,
                                   size_type num_groups,
                                   rmm::device_vector<size_type> const& group_labels,
+                                  column_view const& gather_map,
                                   rmm::mr::device_memory_resource* mr,
                                   cudaStream_t stream)
 {
@@ -30,6 +31,7 @@ std::unique_ptr<column> group_sum(column_view const& values,
                          values,
                          num_groups,
                          group_labels,
+                         gather_map,
                          mr,
                          stream);
 }
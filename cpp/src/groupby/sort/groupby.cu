@@ -32,7 +32,9 @@
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <quantiles/quantile_select.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <unordered_map>
 #include <utility>
@@ -65,6 +67,76 @@ struct store_result_functor {
   {
   }
 
+  /**
+   * @brief Gathers the grouped values up front if an aggregation of `aggs` needs them materialized
+   *
+   * The reductions then read the gathered values rather than reading @p values through the key
+   * sort order, since the gather is paid for anyway.
+   */
+  void materialize_grouped_values_if_needed(std::vector<std::unique_ptr<aggregation>> const& aggs)
+  {
+    if (std::any_of(aggs.begin(), aggs.end(), [](auto const& agg) {
+          return agg->kind == aggregation::NTH_ELEMENT;
+        })) {
+      get_grouped_values();
+    }
+  }
+
+  /**
+   * @brief Computes together the single pass reductions that `aggs` need
+   *
+   * The sums, minimums, maximums, their indices and the valid counts of the values, including
+   * those MEAN, VARIANCE and STD are derived from, are computed by a single pass over the grouped
+   * values and stored in the cache, from which the aggregations then read them.
+   */
+  void compute_fused_reductions(std::vector<std::unique_ptr<aggregation>> const& aggs)
+  {
+    std::vector<std::unique_ptr<aggregation>> reductions;
+    auto const add_reduction = [&](std::unique_ptr<aggregation>&& reduction) {
+      auto const is_new = std::none_of(reductions.begin(), reductions.end(), [&](auto const& r) {
+        return r->is_equal(*reduction);
+      });
+      if (is_new and not cache.has_result(col_idx, *reduction) and
+          detail::is_fusable_reduction(values.type(), reduction->kind)) {
+        reductions.push_back(std::move(reduction));
+      }
+    };
+    for (auto const& agg : aggs) {
+      switch (agg->kind) {
+        case aggregation::SUM: add_reduction(make_sum_aggregation()); break;
+        case aggregation::MIN: add_reduction(make_min_aggregation()); break;
+        case aggregation::MAX: add_reduction(make_max_aggregation()); break;
+        case aggregation::ARGMIN: add_reduction(make_argmin_aggregation()); break;
+        case aggregation::ARGMAX: add_reduction(make_argmax_aggregation()); break;
+        case aggregation::COUNT_VALID:
+        case aggregation::MEAN:
+        case aggregation::VARIANCE:
+        case aggregation::STD:
+          if (agg->kind != aggregation::COUNT_VALID) { add_reduction(make_sum_aggregation()); }
+          // The counts of values without nulls are the group sizes, which need no pass
+          if (values.nullable()) { add_reduction(make_count_aggregation()); }
+          break;
+        default: break;
+      }
+    }
+    if (reductions.size() < 2) { return; }
+
+    std::vector<aggregation::Kind> kinds;
+    for (auto const& reduction : reductions) { kinds.push_back(reduction->kind); }
+    auto const reduced = get_reduction_values();
+    auto results       = detail::group_fused_reductions(reduced.first,
+                                                        kinds,
+                                                        helper.num_groups(),
+                                                        helper.group_labels(),
+                                                        helper.key_sort_order(),
+                                                        reduced.second,
+                                                        mr,
+                                                        stream);
+    for (size_t i = 0; i < reductions.size(); ++i) {
+      cache.add_result(col_idx, *reductions[i], std::move(results[i]));
+    }
+  }
+
  private:
   /**
    * @brief Get the grouped values
@@ -87,6 +159,20 @@ struct store_result_functor {
     return grouped_values->view();
   };
 
+  /**
+   * @brief Get the values to reduce, with the gather map through which they are read in group
+   * order
+   *
+   * The reductions read @p values through the key sort order, which saves gathering a copy of
+   * them, unless the grouped values are materialized already. The gather map is empty when the
+   * returned values are grouped.
+   */
+  std::pair<column_view, column_view> get_reduction_values()
+  {
+    if (grouped_values) { return {grouped_values->view(), column_view{}}; }
+    return {values, helper.key_sort_order()};
+  }
+
   /**
    * @brief Get the grouped and sorted values
    *
@@ -117,13 +203,21 @@ void store_result_functor::operator()<aggregation::COUNT_VALID>(aggregation cons
 {
   if (cache.has_result(col_idx, agg)) return;
 
-  cache.add_result(
-    col_idx,
-    agg,
-    get_grouped_values().nullable()
-      ? detail::group_count_valid(
-          get_grouped_values(), helper.group_labels(), helper.num_groups(), mr, stream)
-      : detail::group_count_all(helper.group_offsets(), helper.num_groups(), mr, stream));
+  if (not values.nullable()) {
+    auto count = detail::group_count_all(helper.group_offsets(), helper.num_groups(), mr, stream);
+    cache.add_result(col_idx, agg, std::move(count));
+    return;
+  }
+
+  auto const reduced = get_reduction_values();
+  cache.add_result(col_idx,
+                   agg,
+                   detail::group_count_valid(reduced.first,
+                                             helper.group_labels(),
+                                             helper.num_groups(),
+                                             reduced.second,
+                                             mr,
+                                             stream));
 }
 
 template <>
@@ -140,10 +234,15 @@ void store_result_functor::operator()<aggregation::SUM>(aggregation const& agg)
 {
   if (cache.has_result(col_idx, agg)) return;
 
+  auto const reduced = get_reduction_values();
   cache.add_result(col_idx,
                    agg,
-                   detail::group_sum(
-                     get_grouped_values(), helper.num_groups(), helper.group_labels(), mr, stream));
+                   detail::group_sum(reduced.first,
+                                     helper.num_groups(),
+                                     helper.group_labels(),
+                                     reduced.second,
+                                     mr,
+                                     stream));
 };
 
 template <>
@@ -151,12 +250,14 @@ void store_result_functor::operator()<aggregation::ARGMAX>(aggregation const& ag
 {
   if (cache.has_result(col_idx, agg)) return;
 
+  auto const reduced = get_reduction_values();
   cache.add_result(col_idx,
                    agg,
-                   detail::group_argmax(get_grouped_values(),
+                   detail::group_argmax(reduced.first,
                                         helper.num_groups(),
                                         helper.group_labels(),
                                         helper.key_sort_order(),
+                                        reduced.second,
                                         mr,
                                         stream));
 };
@@ -166,12 +267,14 @@ void store_result_functor::operator()<aggregation::ARGMIN>(aggregation const& ag
 {
   if (cache.has_result(col_idx, agg)) return;
 
+  auto const reduced = get_reduction_values();
   cache.add_result(col_idx,
                    agg,
-                   detail::group_argmin(get_grouped_values(),
+                   detail::group_argmin(reduced.first,
                                         helper.num_groups(),
                                         helper.group_labels(),
                                         helper.key_sort_order(),
+                                        reduced.second,
                                         mr,
                                         stream));
 };
@@ -183,8 +286,13 @@ void store_result_functor::operator()<aggregation::MIN>(aggregation const& agg)
 
   auto result = [&]() {
     if (cudf::is_fixed_width(values.type())) {
-      return detail::group_min(
-        get_grouped_values(), helper.num_groups(), helper.group_labels(), mr, stream);
+      auto const reduced = get_reduction_values();
+      return detail::group_min(reduced.first,
+                               helper.num_groups(),
+                               helper.group_labels(),
+                               reduced.second,
+                               mr,
+                               stream);
     } else {
       auto argmin_agg = make_argmin_aggregation();
       operator()<aggregation::ARGMIN>(*argmin_agg);
@@ -220,8 +328,13 @@ void store_result_functor::operator()<aggregation::MAX>(aggregation const& agg)
 
   auto result = [&]() {
     if (cudf::is_fixed_width(values.type())) {
-      return detail::group_max(
-        get_grouped_values(), helper.num_groups(), helper.group_labels(), mr, stream);
+      auto const reduced = get_reduction_values();
+      return detail::group_max(reduced.first,
+                               helper.num_groups(),
+                               helper.group_labels(),
+                               reduced.second,
+                               mr,
+                               stream);
     } else {
       auto argmax_agg = make_argmax_aggregation();
       operator()<aggregation::ARGMAX>(*argmax_agg);
@@ -287,13 +400,15 @@ void store_result_functor::operator()<aggregation::VARIANCE>(aggregation const&
   column_view mean_result = cache.get_result(col_idx, *mean_agg);
   column_view group_sizes = cache.get_result(col_idx, *count_agg);
 
-  auto result = detail::group_var(get_grouped_values(),
-                                  mean_result,
-                                  group_sizes,
-                                  helper.group_labels(),
-                                  var_agg._ddof,
-                                  mr,
-                                  stream);
+  auto const reduced = get_reduction_values();
+  auto result        = detail::group_var(reduced.first,
+                                         mean_result,
+                                         group_sizes,
+                                         helper.group_labels(),
+                                         reduced.second,
+                                         var_agg._ddof,
+                                         mr,
+                                         stream);
   cache.add_result(col_idx, agg, std::move(result));
 };
 
@@ -316,10 +431,29 @@ void store_result_functor::operator()<aggregation::QUANTILE>(aggregation const&
 {
   if (cache.has_result(col_idx, agg)) return;
 
+  auto quantile_agg = static_cast<cudf::detail::quantile_aggregation const&>(agg);
+
+  // The quantiles of few groups are selected from the unsorted values, which saves sorting the
+  // values within the groups
+  if (cudf::detail::is_quantile_select_supported(values.type(),
+                                                 helper.num_groups(),
+                                                 quantile_agg._quantiles.size(),
+                                                 quantile_agg._interpolation)) {
+    cache.add_result(col_idx,
+                     agg,
+                     cudf::detail::select_quantiles(values,
+                                                    helper.unsorted_keys_labels(stream),
+                                                    helper.num_groups(),
+                                                    quantile_agg._quantiles,
+                                                    quantile_agg._interpolation,
+                                                    mr,
+                                                    stream));
+    return;
+  }
+
   auto count_agg = make_count_aggregation();
   operator()<aggregation::COUNT_VALID>(*count_agg);
   column_view group_sizes = cache.get_result(col_idx, *count_agg);
-  auto quantile_agg       = static_cast<cudf::detail::quantile_aggregation const&>(agg);
 
   auto result = detail::group_quantiles(get_sorted_values(),
                                         group_sizes,
@@ -337,6 +471,20 @@ void store_result_functor::operator()<aggregation::MEDIAN>(aggregation const& ag
 {
   if (cache.has_result(col_idx, agg)) return;
 
+  if (cudf::detail::is_quantile_select_supported(
+        values.type(), helper.num_groups(), 1, interpolation::LINEAR)) {
+    cache.add_result(col_idx,
+                     agg,
+                     cudf::detail::select_quantiles(values,
+                                                    helper.unsorted_keys_labels(stream),
+                                                    helper.num_groups(),
+                                                    {0.5},
+                                                    interpolation::LINEAR,
+                                                    mr,
+                                                    stream));
+    return;
+  }
+
   auto count_agg = make_count_aggregation();
   operator()<aggregation::COUNT_VALID>(*count_agg);
   column_view group_sizes = cache.get_result(col_idx, *count_agg);
@@ -397,6 +545,49 @@ void store_result_functor::operator()<aggregation::NTH_ELEMENT>(aggregation cons
                                              mr,
                                              stream));
 }
+
+template <>
+void store_result_functor::operator()<aggregation::COLLECT_LIST>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  auto collect_agg = static_cast<cudf::detail::collect_aggregation const&>(agg);
+
+  // Not `get_grouped_values()`, which may return the values sorted within their groups rather
+  // than in their input order
+  if (not grouped_values) { grouped_values = helper.grouped_values(values); }
+
+  cache.add_result(col_idx,
+                   agg,
+                   detail::group_collect(grouped_values->view(),
+                                         helper.group_labels(),
+                                         helper.group_offsets(),
+                                         helper.num_groups(),
+                                         false,
+                                         collect_agg._null_handling,
+                                         mr,
+                                         stream));
+}
+
+// The values are sorted within their groups, so the repeats to drop follow each other
+template <>
+void store_result_functor::operator()<aggregation::COLLECT_SET>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  auto collect_agg = static_cast<cudf::detail::collect_aggregation const&>(agg);
+
+  cache.add_result(col_idx,
+                   agg,
+                   detail::group_collect(get_sorted_values(),
+                                         helper.group_labels(),
+                                         helper.group_offsets(),
+                                         helper.num_groups(),
+                                         true,
+                                         collect_agg._null_handling,
+                                         mr,
+                                         stream));
+}
 }  // namespace detail
 
 // Sort-based groupby
@@ -413,8 +604,9 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::sort
   for (size_t i = 0; i < requests.size(); i++) {
     auto store_functor =
       detail::store_result_functor(i, requests[i].values, helper(), cache, stream, mr);
+    store_functor.materialize_grouped_values_if_needed(requests[i].aggregations);
+    store_functor.compute_fused_reductions(requests[i].aggregations);
     for (size_t j = 0; j < requests[i].aggregations.size(); j++) {
-      // TODO (dm): single pass compute all supported reductions
       cudf::detail::aggregation_dispatcher(
         requests[i].aggregations[j]->kind, store_functor, *requests[i].aggregations[j]);
     }
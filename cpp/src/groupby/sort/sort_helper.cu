@@ -21,7 +21,9 @@
 #include <cudf/detail/groupby/sort_helper.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/scatter.hpp>
+#include <cudf/detail/sequence.cuh>
 #include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/scratch_allocator.cuh>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
 
@@ -30,7 +32,6 @@
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/scan.h>
-#include <thrust/sequence.h>
 #include <thrust/unique.h>
 
 #include <algorithm>
@@ -112,26 +113,20 @@ column_view sort_groupby_helper::key_sort_order(cudaStream_t stream)
   //            we still want all rows with nulls in the end. Sort is costly, so
   //            do a copy_if(counting, sorted_order, {bitmask.is_valid(i)})
   if (_keys_pre_sorted == sorted::YES) {
-    _key_sorted_order = make_numeric_column(
-      data_type(type_to_id<size_type>()), _keys.num_rows(), mask_state::UNALLOCATED, stream);
-
-    auto d_key_sorted_order = _key_sorted_order->mutable_view().data<size_type>();
-
-    thrust::sequence(rmm::exec_policy(stream)->on(stream),
-                     d_key_sorted_order,
-                     d_key_sorted_order + _key_sorted_order->size(),
-                     0);
-
+    cudf::detail::affine_sequence<size_type> const row_indices{0, 1, _keys.num_rows()};
+    _key_sorted_order = row_indices.materialize(rmm::mr::get_default_resource(), stream);
     return sliced_key_sorted_order();
   }
 
+  // A stable sort keeps the rows of each group in their original order, which grouped
+  // operations sharing this helper, e.g. rolling windows, rely on
   if (_include_null_keys == null_policy::INCLUDE || !cudf::has_nulls(_keys)) {  // SQL style
-    _key_sorted_order =
-      cudf::detail::sorted_order(_keys,
-                                 {},
-                                 std::vector<null_order>(_keys.num_columns(), null_order::AFTER),
-                                 rmm::mr::get_default_resource(),
-                                 stream);
+    _key_sorted_order = cudf::detail::stable_sorted_order(
+      _keys,
+      {},
+      std::vector<null_order>(_keys.num_columns(), null_order::AFTER),
+      rmm::mr::get_default_resource(),
+      stream);
   } else {  // Pandas style
     // Temporarily prepend the keys table with a column that indicates the
     // presence of a null value within a row. This allows moving all rows that
@@ -139,7 +134,7 @@ column_view sort_groupby_helper::key_sort_order(cudaStream_t stream)
 
     auto augmented_keys = table_view({table_view({keys_bitmask_column()}), _keys});
 
-    _key_sorted_order = cudf::detail::sorted_order(
+    _key_sorted_order = cudf::detail::stable_sorted_order(
       augmented_keys,
       {},
       std::vector<null_order>(_keys.num_columns() + 1, null_order::AFTER),
@@ -161,7 +156,7 @@ sort_groupby_helper::index_vector const& sort_groupby_helper::group_offsets(cuda
   auto device_input_table = table_device_view::create(_keys, stream);
   auto sorted_order       = key_sort_order().data<size_type>();
   decltype(_group_offsets->begin()) result_end;
-  auto exec = rmm::exec_policy(stream);
+  auto exec = cudf::detail::scratch_policy(stream);
 
   if (has_nulls(_keys)) {
     result_end = thrust::unique_copy(
@@ -197,7 +192,7 @@ sort_groupby_helper::index_vector const& sort_groupby_helper::group_labels(cudaS
 
   if (num_keys(stream) == 0) return group_labels;
 
-  auto exec = rmm::exec_policy(stream);
+  auto exec = cudf::detail::scratch_policy(stream);
   thrust::scatter(exec->on(stream),
                   thrust::make_constant_iterator(1, decltype(num_groups())(1)),
                   thrust::make_constant_iterator(1, num_groups()),
@@ -249,7 +244,7 @@ column_view sort_groupby_helper::keys_bitmask_column(cudaStream_t stream)
 
   auto keys_bitmask_view = _keys_bitmask_column->mutable_view();
   using T                = id_to_type<type_id::INT8>;
-  thrust::fill(rmm::exec_policy(stream)->on(stream),
+  thrust::fill(cudf::detail::scratch_policy(stream)->on(stream),
                keys_bitmask_view.begin<T>(),
                keys_bitmask_view.end<T>(),
                0);
@@ -283,6 +278,9 @@ sort_groupby_helper::column_ptr sort_groupby_helper::sorted_values(
 sort_groupby_helper::column_ptr sort_groupby_helper::grouped_values(
   column_view const& values, rmm::mr::device_memory_resource* mr, cudaStream_t stream)
 {
+  // Sorted keys are grouped in place, every row being grouped, so the values need no gather
+  if (_keys_pre_sorted == sorted::YES) { return std::make_unique<column>(values, stream, mr); }
+
   auto gather_map = key_sort_order();
 
   auto grouped_values_table = cudf::detail::gather(table_view({values}),
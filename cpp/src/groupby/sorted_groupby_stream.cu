@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/find.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace groupby {
+namespace {
+using aggregate_result = std::pair<std::unique_ptr<table>, std::vector<aggregation_result>>;
+
+/**
+ * @brief Returns the index of the first row of `rows` not equal to the row `row` of `other`, or
+ * `rows.num_rows()` if all are
+ */
+size_type find_first_not_equal(table_view const& rows,
+                               table_view const& other,
+                               size_type row,
+                               cudaStream_t stream)
+{
+  auto d_rows  = table_device_view::create(rows, stream);
+  auto d_other = table_device_view::create(other, stream);
+  auto const it =
+    thrust::find_if(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(rows.num_rows()),
+                    [equal = row_equality_comparator<true>{*d_rows, *d_other}, row] __device__(
+                      size_type i) { return not equal(i, row); });
+  return *it;
+}
+
+/**
+ * @brief Returns the index of the first row of the run of rows equal to the last row of `rows`
+ */
+size_type find_last_run(table_view const& rows, cudaStream_t stream)
+{
+  auto const num_rows = rows.num_rows();
+  auto d_rows         = table_device_view::create(rows, stream);
+  // The rows are compared from the last one backwards, so that only the last run is read
+  auto const it = thrust::find_if(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(1),
+    thrust::make_counting_iterator<size_type>(num_rows),
+    [equal = row_equality_comparator<true>{*d_rows, *d_rows}, last = num_rows - 1] __device__(
+      size_type i) { return not equal(last - i, last); });
+  return num_rows - *it;
+}
+
+/**
+ * @brief Appends the results of `more` groups to `results`
+ */
+aggregate_result concatenate_results(aggregate_result&& results,
+                                     aggregate_result&& more,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  if (more.first->num_rows() == 0) { return std::move(results); }
+  if (results.first->num_rows() == 0) { return std::move(more); }
+  auto keys = concatenate({results.first->view(), more.first->view()}, mr);
+  for (size_t i = 0; i < results.second.size(); ++i) {
+    auto& columns = results.second[i].results;
+    for (size_t j = 0; j < columns.size(); ++j) {
+      columns[j] = concatenate({columns[j]->view(), more.second[i].results[j]->view()}, mr);
+    }
+  }
+  return std::make_pair(std::move(keys), std::move(results.second));
+}
+
+}  // namespace
+
+sorted_groupby_stream::sorted_groupby_stream(
+  std::vector<std::vector<std::unique_ptr<aggregation>>> const& aggregations,
+  null_policy null_handling,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence)
+  : _include_null_keys{null_handling},
+    _column_order{column_order},
+    _null_precedence{null_precedence}
+{
+  for (auto const& column_aggs : aggregations) {
+    std::vector<std::unique_ptr<aggregation>> aggs;
+    for (auto const& agg : column_aggs) { aggs.push_back(agg->clone()); }
+    _aggregations.push_back(std::move(aggs));
+  }
+}
+
+sorted_groupby_stream::~sorted_groupby_stream()                       = default;
+sorted_groupby_stream::sorted_groupby_stream(sorted_groupby_stream&&) = default;
+sorted_groupby_stream& sorted_groupby_stream::operator=(sorted_groupby_stream&&) = default;
+
+aggregate_result sorted_groupby_stream::aggregate(table_view const& keys,
+                                                  table_view const& values,
+                                                  rmm::mr::device_memory_resource* mr) const
+{
+  std::vector<aggregation_request> requests(values.num_columns());
+  for (size_type i = 0; i < values.num_columns(); ++i) {
+    requests[i].values = values.column(i);
+    for (auto const& agg : _aggregations[i]) { requests[i].aggregations.push_back(agg->clone()); }
+  }
+  groupby gb(keys, _include_null_keys, sorted::YES, _column_order, _null_precedence);
+  return gb.aggregate(requests, mr);
+}
+
+aggregate_result sorted_groupby_stream::update(table_view const& keys,
+                                               table_view const& values,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(keys.num_rows() == values.num_rows(),
+               "Size mismatch between groupby keys and values.");
+  CUDF_EXPECTS(static_cast<size_t>(values.num_columns()) == _aggregations.size(),
+               "Number of value columns does not match the number of aggregation requests.");
+  auto const chunk = table_view{{keys, values}};
+  CUDF_EXPECTS(not _carry or have_same_types(_carry->view(), chunk),
+               "Column types do not match those of the previous chunks.");
+  cudaStream_t stream = 0;
+
+  auto const num_rows = keys.num_rows();
+  std::vector<size_type> key_indices(keys.num_columns());
+  std::iota(key_indices.begin(), key_indices.end(), 0);
+  auto const split_rows = [&](table_view const& rows) {
+    std::vector<size_type> value_indices(values.num_columns());
+    std::iota(value_indices.begin(), value_indices.end(), keys.num_columns());
+    return std::make_pair(rows.select(key_indices), rows.select(value_indices));
+  };
+  auto const aggregate_rows = [&](table_view const& rows) {
+    auto const split = split_rows(rows);
+    return aggregate(split.first, split.second, mr);
+  };
+
+  if (not _carry) { _carry = std::make_unique<table>(slice(chunk, {0, 0})[0]); }
+  auto const carried = _carry->view();
+
+  // The rows of the chunk continuing the carried group, which they all may continue
+  auto const head_end =
+    carried.num_rows() > 0 and num_rows > 0
+      ? find_first_not_equal(keys, carried.select(key_indices), 0, stream)
+      : 0;
+  if (num_rows == 0 or head_end == num_rows) {
+    if (num_rows > 0) { _carry = concatenate({carried, chunk}); }
+    return aggregate_rows(slice(chunk, {0, 0})[0]);
+  }
+
+  // The last group of the chunk, which the next chunk may continue
+  auto const tail_begin = std::max(find_last_run(keys, stream), head_end);
+
+  auto result = aggregate_rows(slice(chunk, {0, 0})[0]);
+  if (carried.num_rows() > 0) {
+    auto const group = concatenate({carried, slice(chunk, {0, head_end})[0]});
+    result           = concatenate_results(std::move(result), aggregate_rows(group->view()), mr);
+  }
+  if (tail_begin > head_end) {
+    result = concatenate_results(
+      std::move(result), aggregate_rows(slice(chunk, {head_end, tail_begin})[0]), mr);
+  }
+  _carry = std::make_unique<table>(slice(chunk, {tail_begin, num_rows})[0]);
+  return result;
+}
+
+aggregate_result sorted_groupby_stream::finish(rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(_carry != nullptr, "sorted_groupby_stream::finish called before any update.");
+
+  auto const carried    = _carry->view();
+  auto const num_values = static_cast<size_type>(_aggregations.size());
+  auto const num_keys   = carried.num_columns() - num_values;
+  std::vector<size_type> key_indices(num_keys);
+  std::vector<size_type> value_indices(num_values);
+  std::iota(key_indices.begin(), key_indices.end(), 0);
+  std::iota(value_indices.begin(), value_indices.end(), num_keys);
+  auto result = aggregate(carried.select(key_indices), carried.select(value_indices), mr);
+  _carry.reset();
+  return result;
+}
+
+}  // namespace groupby
+}  // namespace cudf
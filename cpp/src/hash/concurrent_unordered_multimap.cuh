@@ -52,7 +52,7 @@ template <typename Key,
           Element unused_element,
           typename Hasher       = default_hash<Key>,
           typename Equality     = equal_to<Key>,
-          typename Allocator    = managed_allocator<thrust::pair<Key, Element>>,
+          typename Allocator    = default_allocator<thrust::pair<Key, Element>>,
           bool count_collisions = false>
 class concurrent_unordered_multimap {
  public:
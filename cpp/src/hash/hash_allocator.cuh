@@ -23,10 +23,17 @@
 #include <rmm/mr/device/device_memory_resource.hpp>
 #include <rmm/mr/device/managed_memory_resource.hpp>
 
+/**
+ * @brief Allocator for hash table storage in CUDA managed memory
+ *
+ * Managed storage page-faults on first touch and is not served by the current device resource;
+ * use it only where the table must be read from host code. Tables use `default_allocator` unless
+ * this allocator is given explicitly.
+ */
 template <class T>
 struct managed_allocator {
   typedef T value_type;
-  rmm::mr::device_memory_resource* mr = new rmm::mr::managed_memory_resource;
+  rmm::mr::device_memory_resource* mr = managed_resource();
 
   managed_allocator() = default;
 
@@ -44,19 +51,22 @@ struct managed_allocator {
   {
     mr->deallocate(p, n * sizeof(T), stream);
   }
-};
 
-template <class T, class U>
-bool operator==(const managed_allocator<T>&, const managed_allocator<U>&)
-{
-  return true;
-}
-template <class T, class U>
-bool operator!=(const managed_allocator<T>&, const managed_allocator<U>&)
-{
-  return false;
-}
+ private:
+  // Shared by all the allocators rather than created by each of them
+  static rmm::mr::device_memory_resource* managed_resource()
+  {
+    static rmm::mr::managed_memory_resource resource{};
+    return &resource;
+  }
+};
 
+/**
+ * @brief Stream-ordered allocator for hash table storage backed by a device memory resource
+ *
+ * Hash tables built by an operation are allocated from the resource passed to it, so they are
+ * served by the same pool as the rest of its memory and are counted by it.
+ */
 template <class T>
 struct default_allocator {
   typedef T value_type;
@@ -64,8 +74,10 @@ struct default_allocator {
 
   default_allocator() = default;
 
+  explicit default_allocator(rmm::mr::device_memory_resource* mr) noexcept : mr{mr} {}
+
   template <class U>
-  constexpr default_allocator(const default_allocator<U>&) noexcept
+  constexpr default_allocator(const default_allocator<U>& other) noexcept : mr{other.mr}
   {
   }
 
@@ -81,14 +93,14 @@ struct default_allocator {
 };
 
 template <class T, class U>
-bool operator==(const default_allocator<T>&, const default_allocator<U>&)
+bool operator==(const default_allocator<T>& lhs, const default_allocator<U>& rhs)
 {
-  return true;
+  return lhs.mr->is_equal(*rhs.mr);
 }
 template <class T, class U>
-bool operator!=(const default_allocator<T>&, const default_allocator<U>&)
+bool operator!=(const default_allocator<T>& lhs, const default_allocator<U>& rhs)
 {
-  return false;
+  return !(lhs == rhs);
 }
 
 #endif
@@ -633,14 +633,20 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   }
 }
 
-std::unique_ptr<column> hash(table_view const& input,
-                             std::vector<uint32_t> const& initial_hash,
-                             rmm::mr::device_memory_resource* mr,
-                             cudaStream_t stream)
+namespace {
+/**
+ * @brief Computes the hash value of each row with `hash_function` into a column of
+ * `output_type`, whose size matches the hash function's result type.
+ */
+template <template <typename> class hash_function, typename output_t>
+std::unique_ptr<column> hash_rows(table_view const& input,
+                                  std::vector<uint32_t> const& initial_hash,
+                                  data_type output_type,
+                                  rmm::mr::device_memory_resource* mr,
+                                  cudaStream_t stream)
 {
-  // TODO this should be UINT32
-  auto output = make_numeric_column(
-    data_type(type_id::INT32), input.num_rows(), mask_state::UNALLOCATED, stream, mr);
+  auto output =
+    make_numeric_column(output_type, input.num_rows(), mask_state::UNALLOCATED, stream, mr);
 
   // Return early if there's nothing to hash
   if (input.num_columns() == 0 || input.num_rows() == 0) { return output; }
@@ -657,42 +663,102 @@ std::unique_ptr<column> hash(table_view const& input,
 
     if (nullable) {
       thrust::tabulate(rmm::exec_policy(stream)->on(stream),
-                       output_view.begin<int32_t>(),
-                       output_view.end<int32_t>(),
-                       row_hasher_initial_values<MurmurHash3_32, true>(
+                       output_view.begin<output_t>(),
+                       output_view.end<output_t>(),
+                       row_hasher_initial_values<hash_function, true>(
                          *device_input, device_initial_hash.data().get()));
     } else {
       thrust::tabulate(rmm::exec_policy(stream)->on(stream),
-                       output_view.begin<int32_t>(),
-                       output_view.end<int32_t>(),
-                       row_hasher_initial_values<MurmurHash3_32, false>(
+                       output_view.begin<output_t>(),
+                       output_view.end<output_t>(),
+                       row_hasher_initial_values<hash_function, false>(
                          *device_input, device_initial_hash.data().get()));
     }
   } else {
     if (nullable) {
       thrust::tabulate(rmm::exec_policy(stream)->on(stream),
-                       output_view.begin<int32_t>(),
-                       output_view.end<int32_t>(),
-                       row_hasher<MurmurHash3_32, true>(*device_input));
+                       output_view.begin<output_t>(),
+                       output_view.end<output_t>(),
+                       row_hasher<hash_function, true>(*device_input));
     } else {
       thrust::tabulate(rmm::exec_policy(stream)->on(stream),
-                       output_view.begin<int32_t>(),
-                       output_view.end<int32_t>(),
-                       row_hasher<MurmurHash3_32, false>(*device_input));
+                       output_view.begin<output_t>(),
+                       output_view.end<output_t>(),
+                       row_hasher<hash_function, false>(*device_input));
     }
   }
 
   return output;
 }
 
+/**
+ * @brief Computes the INT32 hash value of each row of `input` with a row hasher that combines
+ * the hash values of the columns its own way, such as `spark_murmur_row_hasher`.
+ */
+template <template <bool> class row_hasher_t>
+std::unique_ptr<column> hash_rows_compatible(table_view const& input,
+                                             std::vector<uint32_t> const& initial_hash,
+                                             rmm::mr::device_memory_resource* mr,
+                                             cudaStream_t stream)
+{
+  CUDF_EXPECTS(initial_hash.empty(), "Initial hash values are not supported by this hash function");
+
+  auto output = make_numeric_column(
+    data_type(type_id::INT32), input.num_rows(), mask_state::UNALLOCATED, stream, mr);
+
+  // Return early if there's nothing to hash
+  if (input.num_columns() == 0 || input.num_rows() == 0) { return output; }
+
+  auto const device_input = table_device_view::create(input, stream);
+  auto output_view        = output->mutable_view();
+
+  if (has_nulls(input)) {
+    thrust::tabulate(rmm::exec_policy(stream)->on(stream),
+                     output_view.begin<int32_t>(),
+                     output_view.end<int32_t>(),
+                     row_hasher_t<true>(*device_input));
+  } else {
+    thrust::tabulate(rmm::exec_policy(stream)->on(stream),
+                     output_view.begin<int32_t>(),
+                     output_view.end<int32_t>(),
+                     row_hasher_t<false>(*device_input));
+  }
+
+  return output;
+}
+}  // namespace
+
+std::unique_ptr<column> hash(table_view const& input,
+                             hash_id hash_function,
+                             std::vector<uint32_t> const& initial_hash,
+                             rmm::mr::device_memory_resource* mr,
+                             cudaStream_t stream)
+{
+  switch (hash_function) {
+    // TODO this should be UINT32
+    case hash_id::HASH_MURMUR3:
+      return hash_rows<MurmurHash3_32, int32_t>(
+        input, initial_hash, data_type(type_id::INT32), mr, stream);
+    case hash_id::HASH_XXHASH64:
+      return hash_rows<XXHash_64, uint64_t>(
+        input, initial_hash, data_type(type_id::UINT64), mr, stream);
+    case hash_id::HASH_SPARK_MURMUR3:
+      return hash_rows_compatible<spark_murmur_row_hasher>(input, initial_hash, mr, stream);
+    case hash_id::HASH_HIVE:
+      return hash_rows_compatible<hive_row_hasher>(input, initial_hash, mr, stream);
+    default: CUDF_FAIL("Unsupported hash function");
+  }
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> hash(table_view const& input,
+                             hash_id hash_function,
                              std::vector<uint32_t> const& initial_hash,
                              rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::hash(input, initial_hash, mr);
+  return detail::hash(input, hash_function, initial_hash, mr);
 }
 
 }  // namespace cudf
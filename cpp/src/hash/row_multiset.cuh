@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/detail/utilities/device_atomics.cuh>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/bit.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Device view of a `row_multiset`
+ */
+class row_multiset_device_view {
+ public:
+  row_multiset_device_view(size_type num_buckets,
+                           size_type const *bucket_begin,
+                           size_type const *rows)
+    : num_buckets{num_buckets}, bucket_begin{bucket_begin}, rows{rows}
+  {
+  }
+
+  /**
+   * @brief Returns whether the set holds a row equal to a probe row
+   *
+   * Only the rows of the bucket of `hash` are compared, and the search stops at the first equal
+   * one.
+   *
+   * @param hash The hash of the probe row, computed as the rows of the set were hashed
+   * @param probe_row The index of the probe row
+   * @param equal Returns whether the probe row `i` is equal to the row `j` of the set when called
+   * as `equal(i, j)`
+   */
+  template <typename Equality>
+  __device__ bool contains(hash_value_type hash, size_type probe_row, Equality const &equal) const
+  {
+    auto const bucket = hash % num_buckets;
+    for (size_type i = bucket_begin[bucket]; i < bucket_begin[bucket + 1]; ++i) {
+      if (equal(probe_row, rows[i])) { return true; }
+    }
+    return false;
+  }
+
+ private:
+  size_type num_buckets;
+  size_type const *bucket_begin;
+  size_type const *rows;
+};
+
+/**
+ * @brief Fixed size set of the rows of a table, holding only their indices
+ *
+ * The indices are grouped by the bucket of their hash, as `unordered_multiset` groups elements:
+ * the rows of each bucket are counted, the counts scanned into the offsets of the buckets, and
+ * the indices scattered to their bucket. With one bucket per row, the set takes two integers per
+ * row, and a bucket holds about one row, so a lookup makes about one row comparison.
+ *
+ * Equal rows are all kept, lookups stopping at the first one found.
+ */
+class row_multiset {
+ public:
+  /**
+   * @brief Builds the set of the rows of a table
+   *
+   * @param rows The table
+   * @param hasher Returns the hash of row `i` of `rows` when called as `hasher(i)`
+   * @param row_valid Rows whose bit is unset are not added, all rows are if null
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  template <typename Hasher>
+  static row_multiset create(table_device_view const &rows,
+                             Hasher const &hasher,
+                             bitmask_type const *row_valid,
+                             cudaStream_t stream)
+  {
+    auto const num_rows    = rows.num_rows();
+    auto const num_buckets = std::max(num_rows, size_type{1});
+    rmm::device_vector<size_type> bucket_sizes(num_buckets + 1, size_type{0});
+    rmm::device_vector<size_type> bucket_begin(num_buckets + 1);
+    rmm::device_vector<size_type> indices(num_rows);
+
+    auto const d_bucket_sizes = bucket_sizes.data().get();
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       num_rows,
+                       [d_bucket_sizes, hasher, row_valid, num_buckets] __device__(size_type idx) {
+                         if (row_valid == nullptr or bit_is_set(row_valid, idx)) {
+                           atomicAdd(d_bucket_sizes + hasher(idx) % num_buckets, size_type{1});
+                         }
+                       });
+    thrust::exclusive_scan(rmm::exec_policy(stream)->on(stream),
+                           bucket_sizes.begin(),
+                           bucket_sizes.end(),
+                           bucket_begin.begin());
+
+    // Reuse the sizes as the next free position of each bucket
+    thrust::copy(rmm::exec_policy(stream)->on(stream),
+                 bucket_begin.begin(),
+                 bucket_begin.end(),
+                 bucket_sizes.begin());
+    auto const d_indices = indices.data().get();
+    thrust::for_each_n(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      num_rows,
+      [d_bucket_sizes, d_indices, hasher, row_valid, num_buckets] __device__(size_type idx) {
+        if (row_valid == nullptr or bit_is_set(row_valid, idx)) {
+          auto const position = atomicAdd(d_bucket_sizes + hasher(idx) % num_buckets, size_type{1});
+          d_indices[position] = idx;
+        }
+      });
+
+    return row_multiset(num_buckets, std::move(bucket_begin), std::move(indices));
+  }
+
+  row_multiset_device_view to_device() const
+  {
+    return row_multiset_device_view(
+      num_buckets, bucket_begin.data().get(), indices.data().get());
+  }
+
+ private:
+  row_multiset(size_type num_buckets,
+               rmm::device_vector<size_type> &&bucket_begin,
+               rmm::device_vector<size_type> &&indices)
+    : num_buckets{num_buckets}, bucket_begin{std::move(bucket_begin)}, indices{std::move(indices)}
+  {
+  }
+
+  size_type num_buckets;
+  rmm::device_vector<size_type> bucket_begin;
+  rmm::device_vector<size_type> indices;
+};
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/detail/utilities/device_atomics.cuh>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/utilities/error.hpp>
+#include <hash/helper_functions.cuh>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/fill.h>
+
+#include <cooperative_groups.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Number of consecutive slots probed at once by a tile of threads
+ */
+constexpr uint32_t DEFAULT_PROBE_TILE_SIZE = 4;
+
+/**
+ * @brief Returns the smallest prime number that is not less than `n`
+ */
+inline size_t next_prime(size_t n)
+{
+  if (n <= 2) { return 2; }
+  if (n % 2 == 0) { ++n; }
+  auto const is_prime = [](size_t m) {
+    for (size_t d = 3; d * d <= m; d += 2) {
+      if (m % d == 0) { return false; }
+    }
+    return true;
+  };
+  while (!is_prime(n)) { n += 2; }
+  return n;
+}
+
+/**
+ * @brief Non-owning view of a `static_multimap`, passed by value to kernels
+ *
+ * All the functions are called cooperatively by the threads of a tile of `TileSize` threads, with
+ * the same arguments. Each probe step loads a window of `TileSize` consecutive slots, one slot per
+ * thread, so a key is found or placed in a single coalesced load in most cases. The windows a key
+ * visits are chosen by double hashing, which avoids the long runs of occupied slots that linear
+ * probing builds up at high load factors.
+ *
+ * Slots hold keys and values in separate arrays; only the key is updated atomically, so the key
+ * must be 4 or 8 bytes wide, while the value can be of any width.
+ */
+template <typename Key,
+          typename Value,
+          uint32_t TileSize = DEFAULT_PROBE_TILE_SIZE,
+          typename Hasher   = default_hash<Key>,
+          typename Equality = equal_to<Key>>
+class static_multimap_device_view {
+  static_assert(sizeof(Key) == 4 || sizeof(Key) == 8, "Key must be 4 or 8 bytes wide");
+
+ public:
+  using key_type    = Key;
+  using mapped_type = Value;
+  using tile_type   = cooperative_groups::thread_block_tile<TileSize>;
+
+  static constexpr uint32_t tile_size = TileSize;
+
+  static_multimap_device_view(size_t num_windows, Key empty_key, Key* keys, Value* values)
+    : num_windows{num_windows}, empty_key{empty_key}, keys{keys}, values{values}
+  {
+  }
+
+  /**
+   * @brief Inserts a key/value pair; existing pairs with an equal key are kept
+   *
+   * @return `false` if the map is full
+   */
+  __device__ bool insert(tile_type const& tile, Key key, Value value)
+  {
+    auto const hash_value = hasher(key);
+    auto window           = initial_window(hash_value);
+    auto const step       = window_step(hash_value);
+    for (size_t i = 0; i < num_windows; ++i) {
+      auto const slot = window * TileSize + tile.thread_rank();
+      auto empty_mask = tile.ballot(equals(keys[slot], empty_key));
+      // Claim the first empty slot of the window; retry with the next one if another tile won it
+      while (empty_mask != 0) {
+        auto const lane = __ffs(empty_mask) - 1;
+        bool inserted   = false;
+        if (tile.thread_rank() == lane) {
+          inserted = equals(atomicCAS(&keys[slot], empty_key, key), empty_key);
+          if (inserted) { values[slot] = value; }
+        }
+        if (tile.shfl(inserted, lane)) { return true; }
+        empty_mask &= ~(1u << lane);
+      }
+      window = (window + step) % num_windows;
+    }
+    return false;
+  }
+
+  /**
+   * @brief Visits the values of `key` for which `pred(value)` is true
+   *
+   * The thread holding the `k`-th matching value calls `callback(value, k)`. Inserts must have
+   * completed before the call, e.g. in a previous kernel.
+   *
+   * @return The number of matching values, in every thread of the tile
+   */
+  template <typename Pred, typename Callback>
+  __device__ size_type for_each_match(tile_type const& tile,
+                                      Key key,
+                                      Pred pred,
+                                      Callback callback) const
+  {
+    auto const hash_value  = hasher(key);
+    auto window            = initial_window(hash_value);
+    auto const step        = window_step(hash_value);
+    auto const lower_lanes = (1u << tile.thread_rank()) - 1;
+    size_type num_matches{0};
+    for (size_t i = 0; i < num_windows; ++i) {
+      auto const slot     = window * TileSize + tile.thread_rank();
+      auto const slot_key = keys[slot];
+      bool const is_match = equals(slot_key, key) && pred(values[slot]);
+      auto const matches  = tile.ballot(is_match);
+      if (is_match) { callback(values[slot], num_matches + __popc(matches & lower_lanes)); }
+      num_matches += __popc(matches);
+      // A key is always placed in the first window that had an empty slot, so the search ends at
+      // the first window that still has one
+      if (tile.any(equals(slot_key, empty_key))) { break; }
+      window = (window + step) % num_windows;
+    }
+    return num_matches;
+  }
+
+  /**
+   * @brief Counts the values of `key` for which `pred(value)` is true
+   *
+   * @return The number of matching values, in every thread of the tile
+   */
+  template <typename Pred>
+  __device__ size_type count(tile_type const& tile, Key key, Pred pred) const
+  {
+    return for_each_match(tile, key, pred, [](Value, size_type) {});
+  }
+
+ private:
+  __device__ size_t initial_window(hash_value_type hash_value) const
+  {
+    return hash_value % num_windows;
+  }
+
+  // The number of windows is prime, so any step in [1, num_windows) visits every window
+  __device__ size_t window_step(hash_value_type hash_value) const
+  {
+    if (num_windows < 2) { return 1; }
+    hash_value_type const mixed = (hash_value ^ (hash_value >> 15)) * 0x9e3779b1u;
+    return 1 + (mixed >> 7) % (num_windows - 1);
+  }
+
+  size_t num_windows;
+  Key empty_key;
+  Key* keys;
+  Value* values;
+  Hasher hasher{};
+  Equality equals{};
+};
+
+/**
+ * @brief Fixed capacity hash multimap using open addressing and tile-cooperative probing
+ *
+ * The map owns its storage; kernels access it through `to_device()`. See
+ * `static_multimap_device_view` for the probing scheme.
+ *
+ * @note Inserting a key equal to `empty_key` results in undefined behavior.
+ */
+template <typename Key,
+          typename Value,
+          uint32_t TileSize = DEFAULT_PROBE_TILE_SIZE,
+          typename Hasher   = default_hash<Key>,
+          typename Equality = equal_to<Key>>
+class static_multimap {
+ public:
+  using device_view = static_multimap_device_view<Key, Value, TileSize, Hasher, Equality>;
+
+  /**
+   * @brief Allocates an empty map for `num_keys` pairs
+   *
+   * @param num_keys The number of pairs to be inserted
+   * @param load_factor The maximum fraction of occupied slots once all pairs are inserted, in
+   * `(0, 1]`
+   * @param empty_key The sentinel key marking an empty slot
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @param mr Device memory resource used to allocate the map's slots
+   */
+  static_multimap(size_type num_keys,
+                  double load_factor,
+                  Key empty_key                       = std::numeric_limits<Key>::max(),
+                  cudaStream_t stream                 = 0,
+                  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource())
+    : num_windows{num_windows_for(num_keys, load_factor)},
+      empty_key{empty_key},
+      keys{num_windows * TileSize * sizeof(Key), stream, mr},
+      values{num_windows * TileSize * sizeof(Value), stream, mr}
+  {
+    auto const d_keys = static_cast<Key*>(keys.data());
+    thrust::fill(rmm::exec_policy(stream)->on(stream), d_keys, d_keys + capacity(), empty_key);
+  }
+
+  /**
+   * @brief Returns the number of slots of the map
+   */
+  size_t capacity() const { return num_windows * TileSize; }
+
+  device_view to_device()
+  {
+    return device_view(
+      num_windows, empty_key, static_cast<Key*>(keys.data()), static_cast<Value*>(values.data()));
+  }
+
+ private:
+  static size_t num_windows_for(size_type num_keys, double load_factor)
+  {
+    CUDF_EXPECTS(load_factor > 0 && load_factor <= 1, "Invalid hash table load factor");
+    auto const num_slots = static_cast<size_t>(std::ceil(std::max(num_keys, 1) / load_factor));
+    return next_prime((num_slots + TileSize - 1) / TileSize);
+  }
+
+  size_t num_windows;
+  Key empty_key;
+  rmm::device_buffer keys;    ///< `capacity()` keys
+  rmm::device_buffer values;  ///< `capacity()` values
+};
+
+}  // namespace detail
+}  // namespace cudf
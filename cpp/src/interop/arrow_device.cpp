@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/arrow_device.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <cuda_runtime.h>
+
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace {
+/**
+ * @brief Host structures owned by an exported `ArrowSchema`
+ */
+struct exported_schema {
+  std::string format;
+  std::vector<ArrowSchema> children;
+  std::vector<ArrowSchema*> children_ptrs;
+
+  static void release(ArrowSchema* schema)
+  {
+    auto const exported = static_cast<exported_schema*>(schema->private_data);
+    for (auto child : exported->children_ptrs) {
+      if (child->release != nullptr) { child->release(child); }
+    }
+    delete exported;
+    schema->release = nullptr;
+  }
+};
+
+/**
+ * @brief Host structures owned by an exported `ArrowArray`
+ */
+struct exported_array {
+  std::vector<void const*> buffers;
+  std::vector<ArrowArray> children;
+  std::vector<ArrowArray*> children_ptrs;
+
+  static void release(ArrowArray* array)
+  {
+    auto const exported = static_cast<exported_array*>(array->private_data);
+    for (auto child : exported->children_ptrs) {
+      if (child->release != nullptr) { child->release(child); }
+    }
+    delete exported;
+    array->release = nullptr;
+  }
+};
+
+/**
+ * @brief Returns the Arrow format string of the columns of type `type`.
+ */
+std::string arrow_format(data_type type)
+{
+  switch (type.id()) {
+    case type_id::INT8: return "c";
+    case type_id::INT16: return "s";
+    case type_id::INT32: return "i";
+    case type_id::INT64: return "l";
+    case type_id::UINT8: return "C";
+    case type_id::UINT16: return "S";
+    case type_id::UINT32: return "I";
+    case type_id::UINT64: return "L";
+    case type_id::FLOAT32: return "f";
+    case type_id::FLOAT64: return "g";
+    case type_id::TIMESTAMP_DAYS: return "tdD";
+    case type_id::TIMESTAMP_SECONDS: return "tss:";
+    case type_id::TIMESTAMP_MILLISECONDS: return "tsm:";
+    case type_id::TIMESTAMP_MICROSECONDS: return "tsu:";
+    case type_id::TIMESTAMP_NANOSECONDS: return "tsn:";
+    case type_id::DURATION_SECONDS: return "tDs";
+    case type_id::DURATION_MILLISECONDS: return "tDm";
+    case type_id::DURATION_MICROSECONDS: return "tDu";
+    case type_id::DURATION_NANOSECONDS: return "tDn";
+    case type_id::STRING: return "u";
+    case type_id::LIST: return "+l";
+    default: CUDF_FAIL("Unsupported type for the Arrow device interface");
+  }
+}
+
+/**
+ * @brief Returns the cudf type of the Arrow format string `format`.
+ */
+data_type cudf_type(std::string const& format)
+{
+  // timestamps are UTC whatever their time zone
+  auto const timestamp_unit = format.size() >= 4 and format.compare(0, 2, "ts") == 0 and
+                                  format[3] == ':'
+                                ? format[2]
+                                : '\0';
+  switch (timestamp_unit) {
+    case 's': return data_type{type_id::TIMESTAMP_SECONDS};
+    case 'm': return data_type{type_id::TIMESTAMP_MILLISECONDS};
+    case 'u': return data_type{type_id::TIMESTAMP_MICROSECONDS};
+    case 'n': return data_type{type_id::TIMESTAMP_NANOSECONDS};
+    default: break;
+  }
+  for (auto id : {type_id::INT8,
+                  type_id::INT16,
+                  type_id::INT32,
+                  type_id::INT64,
+                  type_id::UINT8,
+                  type_id::UINT16,
+                  type_id::UINT32,
+                  type_id::UINT64,
+                  type_id::FLOAT32,
+                  type_id::FLOAT64,
+                  type_id::TIMESTAMP_DAYS,
+                  type_id::DURATION_SECONDS,
+                  type_id::DURATION_MILLISECONDS,
+                  type_id::DURATION_MICROSECONDS,
+                  type_id::DURATION_NANOSECONDS,
+                  type_id::STRING,
+                  type_id::LIST}) {
+    if (format == arrow_format(data_type{id})) { return data_type{id}; }
+  }
+  CUDF_FAIL("Unsupported Arrow format");
+}
+
+void export_schema(column_view const& input, ArrowSchema* out)
+{
+  auto format = arrow_format(input.type());
+  CUDF_EXPECTS(input.type().id() != type_id::LIST or input.num_children() == 2,
+               "Unexpected list column without a child column");
+  auto exported = new exported_schema{std::move(format)};
+  if (input.type().id() == type_id::LIST) {
+    exported->children.resize(1);
+    exported->children_ptrs.push_back(exported->children.data());
+  }
+
+  *out = ArrowSchema{exported->format.c_str(),
+                     "",
+                     nullptr,
+                     input.nullable() ? ARROW_FLAG_NULLABLE : 0,
+                     static_cast<int64_t>(exported->children_ptrs.size()),
+                     exported->children_ptrs.data(),
+                     nullptr,
+                     exported_schema::release,
+                     exported};
+  if (input.type().id() == type_id::LIST) {
+    export_schema(input.child(1), exported->children_ptrs.front());
+  }
+}
+
+void export_array(column_view const& input, ArrowArray* out)
+{
+  auto exported = new exported_array{};
+  exported->buffers.push_back(input.null_mask());
+  switch (input.type().id()) {
+    case type_id::STRING:
+      // an empty strings column may have no children
+      exported->buffers.push_back(input.num_children() > 0 ? input.child(0).data<int32_t>()
+                                                           : nullptr);
+      exported->buffers.push_back(input.num_children() > 0 ? input.child(1).data<char>()
+                                                           : nullptr);
+      break;
+    case type_id::LIST:
+      exported->buffers.push_back(input.child(0).data<int32_t>());
+      exported->children.resize(1);
+      exported->children_ptrs.push_back(exported->children.data());
+      break;
+    default: exported->buffers.push_back(input.head()); break;
+  }
+
+  *out = ArrowArray{input.size(),
+                    input.nullable() ? input.null_count() : 0,
+                    input.offset(),
+                    static_cast<int64_t>(exported->buffers.size()),
+                    static_cast<int64_t>(exported->children_ptrs.size()),
+                    exported->buffers.data(),
+                    exported->children_ptrs.data(),
+                    nullptr,
+                    exported_array::release,
+                    exported};
+  if (input.type().id() == type_id::LIST) {
+    export_array(input.child(1), exported->children_ptrs.front());
+  }
+}
+
+column_view import_column(ArrowSchema const* schema, ArrowArray const* input)
+{
+  CUDF_EXPECTS(input->offset + input->length <= std::numeric_limits<size_type>::max(),
+               "Arrow array is too large for a cudf column");
+  auto const type   = cudf_type(schema->format);
+  auto const size   = static_cast<size_type>(input->length);
+  auto const offset = static_cast<size_type>(input->offset);
+  auto const null_mask =
+    input->n_buffers > 0 ? static_cast<bitmask_type const*>(input->buffers[0]) : nullptr;
+  auto null_count = static_cast<size_type>(input->null_count);
+  if (null_mask == nullptr) {
+    null_count = 0;
+  } else if (input->null_count < 0) {
+    null_count = UNKNOWN_NULL_COUNT;
+  }
+
+  switch (type.id()) {
+    case type_id::STRING: {
+      CUDF_EXPECTS(input->n_buffers == 3, "Unexpected number of buffers for a string array");
+      if (input->buffers[1] == nullptr) {
+        CUDF_EXPECTS(size == 0, "Unexpected string array without offsets");
+        return column_view{type, 0, nullptr};
+      }
+      auto const d_offsets = static_cast<int32_t const*>(input->buffers[1]);
+      // the size of the characters is only found in the offsets
+      int32_t chars_size = 0;
+      CUDA_TRY(cudaMemcpy(
+        &chars_size, d_offsets + offset + size, sizeof(int32_t), cudaMemcpyDeviceToHost));
+      return column_view{type,
+                         size,
+                         nullptr,
+                         null_mask,
+                         null_count,
+                         offset,
+                         {column_view{data_type{type_id::INT32}, offset + size + 1, d_offsets},
+                          column_view{data_type{type_id::INT8}, chars_size, input->buffers[2]}}};
+    }
+    case type_id::LIST: {
+      CUDF_EXPECTS(input->n_buffers == 2 and input->n_children == 1,
+                   "Unexpected number of buffers or children for a list array");
+      return column_view{
+        type,
+        size,
+        nullptr,
+        null_mask,
+        null_count,
+        offset,
+        {column_view{data_type{type_id::INT32}, offset + size + 1, input->buffers[1]},
+         import_column(schema->children[0], input->children[0])}};
+    }
+    default:
+      CUDF_EXPECTS(input->n_buffers == 2, "Unexpected number of buffers for a fixed-width array");
+      return column_view{type, size, input->buffers[1], null_mask, null_count, offset};
+  }
+}
+
+}  // namespace
+
+void to_arrow_device(table_view const& input, ArrowSchema* out_schema, ArrowDeviceArray* out_array)
+{
+  CUDF_FUNC_RANGE();
+  auto schema = new exported_schema{"+s"};
+  auto array  = new exported_array{{nullptr}};
+  schema->children.resize(input.num_columns());
+  array->children.resize(input.num_columns());
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    schema->children_ptrs.push_back(&schema->children[i]);
+    array->children_ptrs.push_back(&array->children[i]);
+  }
+
+  *out_schema = ArrowSchema{schema->format.c_str(),
+                            "",
+                            nullptr,
+                            0,
+                            input.num_columns(),
+                            schema->children_ptrs.data(),
+                            nullptr,
+                            exported_schema::release,
+                            schema};
+  *out_array  = ArrowDeviceArray{};
+  out_array->array = ArrowArray{input.num_rows(),
+                                0,
+                                0,
+                                1,
+                                input.num_columns(),
+                                array->buffers.data(),
+                                array->children_ptrs.data(),
+                                nullptr,
+                                exported_array::release,
+                                array};
+  // the release callbacks free the children exported so far if a column is not supported
+  try {
+    for (size_type i = 0; i < input.num_columns(); ++i) {
+      export_schema(input.column(i), schema->children_ptrs[i]);
+      export_array(input.column(i), array->children_ptrs[i]);
+    }
+  } catch (...) {
+    out_schema->release(out_schema);
+    out_array->array.release(&out_array->array);
+    throw;
+  }
+
+  int device_id = 0;
+  CUDA_TRY(cudaGetDevice(&device_id));
+  out_array->device_id   = device_id;
+  out_array->device_type = ARROW_DEVICE_CUDA;
+  out_array->sync_event  = nullptr;
+}
+
+table_view from_arrow_device(ArrowSchema const* schema, ArrowDeviceArray const* input)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(input->device_type == ARROW_DEVICE_CUDA, "Arrow array is not in device memory");
+  int device_id = 0;
+  CUDA_TRY(cudaGetDevice(&device_id));
+  CUDF_EXPECTS(input->device_id == device_id, "Arrow array is not on the current device");
+  CUDF_EXPECTS(std::string{schema->format} == "+s", "Arrow array is not a struct array");
+  auto const& array = input->array;
+  CUDF_EXPECTS(array.null_count == 0 or array.n_buffers == 0 or array.buffers[0] == nullptr,
+               "Arrow struct array has nulls");
+  CUDF_EXPECTS(array.offset == 0, "Arrow struct array has an offset");
+
+  std::vector<column_view> columns;
+  for (int64_t i = 0; i < array.n_children; ++i) {
+    columns.push_back(import_column(schema->children[i], array.children[i]));
+    CUDF_EXPECTS(columns.back().size() == array.length, "Arrow struct array size mismatch");
+  }
+  return table_view{columns};
+}
+
+}  // namespace cudf
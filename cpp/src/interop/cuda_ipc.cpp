@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/cuda_ipc.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <cuda.h>
+#include <cuda_runtime.h>
+
+#include <cstring>
+#include <map>
+#include <type_traits>
+
+namespace cudf {
+namespace {
+constexpr uint32_t ipc_magic   = 0x43495043;  // "CPIC"
+constexpr uint32_t ipc_version = 1;
+
+struct ipc_header {
+  uint32_t magic;
+  uint32_t version;
+  int32_t num_allocations;
+  int32_t num_columns;      ///< The number of columns of the table
+  int32_t num_descendants;  ///< The number of columns including their descendants
+};
+
+/**
+ * @brief Position of a buffer in the exported allocations, `allocation` being -1 for a null
+ * buffer
+ */
+struct ipc_buffer {
+  int32_t allocation;
+  int64_t offset;
+};
+
+/**
+ * @brief A column of the blob. The columns are stored in pre-order, each followed by its
+ * children.
+ */
+struct ipc_column {
+  int32_t type;
+  size_type size;
+  size_type offset;
+  size_type null_count;
+  int32_t num_children;
+  ipc_buffer data;
+  ipc_buffer null_mask;
+};
+
+template <typename T>
+void write(std::vector<uint8_t>& out, T const& value)
+{
+  static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values are written");
+  auto const position = out.size();
+  out.resize(position + sizeof(T));
+  std::memcpy(out.data() + position, &value, sizeof(T));
+}
+
+template <typename T>
+T read(std::vector<uint8_t> const& in, size_t& position)
+{
+  CUDF_EXPECTS(position + sizeof(T) <= in.size(), "Truncated IPC metadata");
+  T value;
+  std::memcpy(&value, in.data() + position, sizeof(T));
+  position += sizeof(T);
+  return value;
+}
+
+/**
+ * @brief Collects the allocations holding the buffers of the exported columns, each exported
+ * once however many buffers it holds
+ */
+class allocation_exporter {
+ public:
+  ipc_buffer add(void const* buffer)
+  {
+    if (buffer == nullptr) { return ipc_buffer{-1, 0}; }
+    CUdeviceptr base = 0;
+    size_t size      = 0;
+    auto const ptr   = reinterpret_cast<CUdeviceptr>(buffer);
+    CUDF_EXPECTS(cuMemGetAddressRange(&base, &size, ptr) == CUDA_SUCCESS,
+                 "Table buffer is not in device memory");
+    auto it = allocations.find(base);
+    if (it == allocations.end()) {
+      cudaIpcMemHandle_t handle;
+      CUDA_TRY(cudaIpcGetMemHandle(&handle, reinterpret_cast<void*>(base)));
+      it = allocations.emplace(base, static_cast<int32_t>(handles.size())).first;
+      handles.push_back(handle);
+    }
+    return ipc_buffer{it->second, static_cast<int64_t>(ptr - base)};
+  }
+
+  std::vector<cudaIpcMemHandle_t> const& exported_handles() const { return handles; }
+
+ private:
+  std::map<CUdeviceptr, int32_t> allocations;
+  std::vector<cudaIpcMemHandle_t> handles;
+};
+
+void export_column(column_view const& input,
+                   allocation_exporter& allocations,
+                   std::vector<ipc_column>& out)
+{
+  out.push_back(ipc_column{static_cast<int32_t>(input.type().id()),
+                           input.size(),
+                           input.offset(),
+                           input.null_count(),
+                           input.num_children(),
+                           allocations.add(input.head()),
+                           allocations.add(input.null_mask())});
+  for (size_type i = 0; i < input.num_children(); ++i) {
+    export_column(input.child(i), allocations, out);
+  }
+}
+
+column_view import_column(std::vector<ipc_column> const& columns,
+                          size_t& index,
+                          std::vector<void*> const& mappings)
+{
+  CUDF_EXPECTS(index < columns.size(), "Truncated IPC metadata");
+  auto const& column = columns[index++];
+  CUDF_EXPECTS(column.type >= 0 and column.type < static_cast<int32_t>(type_id::NUM_TYPE_IDS) and
+                 column.num_children >= 0,
+               "Invalid IPC metadata");
+  auto const address = [&mappings](ipc_buffer const& buffer) -> void* {
+    if (buffer.allocation < 0) { return nullptr; }
+    CUDF_EXPECTS(static_cast<size_t>(buffer.allocation) < mappings.size(),
+                 "Invalid IPC metadata");
+    return static_cast<uint8_t*>(mappings[buffer.allocation]) + buffer.offset;
+  };
+  std::vector<column_view> children;
+  for (int32_t i = 0; i < column.num_children; ++i) {
+    children.push_back(import_column(columns, index, mappings));
+  }
+  return column_view{data_type{static_cast<type_id>(column.type)},
+                     column.size,
+                     address(column.data),
+                     static_cast<bitmask_type const*>(address(column.null_mask)),
+                     column.null_count,
+                     column.offset,
+                     children};
+}
+
+}  // namespace
+
+ipc_imported_table::~ipc_imported_table()
+{
+  // the mappings are only read once opened, errors closing them cannot be acted on
+  for (auto mapping : _mappings) { cudaIpcCloseMemHandle(mapping); }
+}
+
+std::vector<uint8_t> export_ipc(table_view const& input)
+{
+  CUDF_FUNC_RANGE();
+  allocation_exporter allocations;
+  std::vector<ipc_column> columns;
+  for (auto const& column : input) { export_column(column, allocations, columns); }
+
+  auto const& handles = allocations.exported_handles();
+  std::vector<uint8_t> metadata;
+  write(metadata,
+        ipc_header{ipc_magic,
+                   ipc_version,
+                   static_cast<int32_t>(handles.size()),
+                   input.num_columns(),
+                   static_cast<int32_t>(columns.size())});
+  for (auto const& handle : handles) { write(metadata, handle); }
+  for (auto const& column : columns) { write(metadata, column); }
+  return metadata;
+}
+
+std::shared_ptr<ipc_imported_table> import_ipc(std::vector<uint8_t> const& metadata)
+{
+  CUDF_FUNC_RANGE();
+  size_t position   = 0;
+  auto const header = read<ipc_header>(metadata, position);
+  CUDF_EXPECTS(header.magic == ipc_magic, "Invalid IPC metadata");
+  CUDF_EXPECTS(header.version == ipc_version, "Unsupported IPC metadata version");
+  CUDF_EXPECTS(header.num_allocations >= 0 and header.num_columns >= 0 and
+                 header.num_descendants >= header.num_columns,
+               "Invalid IPC metadata");
+
+  std::vector<cudaIpcMemHandle_t> handles;
+  for (int32_t i = 0; i < header.num_allocations; ++i) {
+    handles.push_back(read<cudaIpcMemHandle_t>(metadata, position));
+  }
+  std::vector<ipc_column> columns;
+  for (int32_t i = 0; i < header.num_descendants; ++i) {
+    columns.push_back(read<ipc_column>(metadata, position));
+  }
+
+  // the destructor closes the allocations opened so far if one cannot be opened
+  std::shared_ptr<ipc_imported_table> result{new ipc_imported_table{}};
+  for (auto const& handle : handles) {
+    void* mapping = nullptr;
+    CUDA_TRY(cudaIpcOpenMemHandle(&mapping, handle, cudaIpcMemLazyEnablePeerAccess));
+    result->_mappings.push_back(mapping);
+  }
+
+  std::vector<column_view> table_columns;
+  size_t index = 0;
+  for (int32_t i = 0; i < header.num_columns; ++i) {
+    table_columns.push_back(import_column(columns, index, result->_mappings));
+  }
+  CUDF_EXPECTS(index == columns.size(), "Invalid IPC metadata");
+  result->_view = table_view{table_columns};
+  return result;
+}
+
+}  // namespace cudf
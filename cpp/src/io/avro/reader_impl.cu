@@ -135,22 +135,23 @@ class metadata : public file_metadata {
 };
 
 rmm::device_buffer reader::impl::decompress_data(const rmm::device_buffer &comp_block_data,
+                                                 const uint8_t *comp_block_host,
                                                  cudaStream_t stream)
 {
-  size_t uncompressed_data_size = 0;
-  hostdevice_vector<gpu_inflate_input_s> inflate_in(_metadata->block_list.size());
-  hostdevice_vector<gpu_inflate_status_s> inflate_out(_metadata->block_list.size());
+  const auto num_blocks    = _metadata->block_list.size();
+  const auto base_offset   = _metadata->block_list[0].offset;
+  size_t uncompressed_size = 0;
+  hostdevice_vector<gpu_inflate_input_s> inflate_in(num_blocks);
+  hostdevice_vector<gpu_inflate_status_s> inflate_out(num_blocks);
 
   if (_metadata->codec == "deflate") {
     // Guess an initial maximum uncompressed block size
     uint32_t initial_blk_len = (_metadata->max_block_size * 2 + 0xfff) & ~0xfff;
-    uncompressed_data_size   = initial_blk_len * _metadata->block_list.size();
-    for (size_t i = 0; i < inflate_in.size(); ++i) { inflate_in[i].dstSize = initial_blk_len; }
+    for (size_t i = 0; i < num_blocks; ++i) { inflate_in[i].dstSize = initial_blk_len; }
   } else if (_metadata->codec == "snappy") {
-    // Extract the uncompressed length from the snappy stream
-    for (size_t i = 0; i < _metadata->block_list.size(); i++) {
-      const auto buffer  = _source->host_read(_metadata->block_list[i].offset, 4);
-      const uint8_t *blk = buffer->data();
+    // Extract the uncompressed length from the snappy stream, already in host memory
+    for (size_t i = 0; i < num_blocks; i++) {
+      const uint8_t *blk = comp_block_host + _metadata->block_list[i].offset - base_offset;
       uint32_t blk_len   = blk[0];
       if (blk_len > 0x7f) {
         blk_len = (blk_len & 0x7f) | (blk[1] << 7);
@@ -160,16 +161,14 @@ rmm::device_buffer reader::impl::decompress_data(const rmm::device_buffer &comp_
         }
       }
       inflate_in[i].dstSize = blk_len;
-      uncompressed_data_size += blk_len;
     }
   } else {
     CUDF_FAIL("Unsupported compression codec\n");
   }
+  for (size_t i = 0; i < num_blocks; ++i) { uncompressed_size += inflate_in[i].dstSize; }
 
-  rmm::device_buffer decomp_block_data(uncompressed_data_size, stream);
-
-  const auto base_offset = _metadata->block_list[0].offset;
-  for (size_t i = 0, dst_pos = 0; i < _metadata->block_list.size(); i++) {
+  rmm::device_buffer decomp_block_data(uncompressed_size, stream);
+  for (size_t i = 0, dst_pos = 0; i < num_blocks; i++) {
     const auto src_pos = _metadata->block_list[i].offset - base_offset;
 
     inflate_in[i].srcDevice = static_cast<const uint8_t *>(comp_block_data.data()) + src_pos;
@@ -182,55 +181,58 @@ rmm::device_buffer reader::impl::decompress_data(const rmm::device_buffer &comp_
     dst_pos += _metadata->block_list[i].size;
   }
 
-  for (int loop_cnt = 0; loop_cnt < 2; loop_cnt++) {
+  // All blocks are decompressed in a single launch
+  auto const decompress = [&](size_t count) {
     CUDA_TRY(cudaMemcpyAsync(inflate_in.device_ptr(),
                              inflate_in.host_ptr(),
-                             inflate_in.memory_size(),
+                             count * sizeof(gpu_inflate_input_s),
                              cudaMemcpyHostToDevice,
                              stream));
     CUDA_TRY(cudaMemsetAsync(inflate_out.device_ptr(), 0, inflate_out.memory_size(), stream));
     if (_metadata->codec == "deflate") {
-      CUDA_TRY(gpuinflate(
-        inflate_in.device_ptr(), inflate_out.device_ptr(), inflate_in.size(), 0, stream));
-    } else if (_metadata->codec == "snappy") {
-      CUDA_TRY(
-        gpu_unsnap(inflate_in.device_ptr(), inflate_out.device_ptr(), inflate_in.size(), stream));
+      CUDA_TRY(gpuinflate(inflate_in.device_ptr(), inflate_out.device_ptr(), count, 0, stream));
     } else {
-      CUDF_FAIL("Unsupported compression codec\n");
+      CUDA_TRY(gpu_unsnap(inflate_in.device_ptr(), inflate_out.device_ptr(), count, stream));
     }
     CUDA_TRY(cudaMemcpyAsync(inflate_out.host_ptr(),
                              inflate_out.device_ptr(),
-                             inflate_out.memory_size(),
+                             count * sizeof(gpu_inflate_status_s),
                              cudaMemcpyDeviceToHost,
                              stream));
     CUDA_TRY(cudaStreamSynchronize(stream));
+  };
+  decompress(num_blocks);
 
-    // Check if larger output is required, as it's not known ahead of time
-    if (_metadata->codec == "deflate" && !loop_cnt) {
-      size_t actual_uncompressed_size = 0;
-      for (size_t i = 0; i < _metadata->block_list.size(); i++) {
-        // If error status is 1 (buffer too small), the `bytes_written` field
-        // is actually contains the uncompressed data size
-        if (inflate_out[i].status == 1 && inflate_out[i].bytes_written > inflate_in[i].dstSize) {
-          inflate_in[i].dstSize = inflate_out[i].bytes_written;
-        }
-        actual_uncompressed_size += inflate_in[i].dstSize;
+  if (_metadata->codec == "deflate") {
+    // The uncompressed size is not known ahead of time. If error status is 1 (buffer too small),
+    // the `bytes_written` field contains the uncompressed size; only those blocks are
+    // decompressed again, into space appended after the other blocks
+    std::vector<size_t> retried_blocks;
+    size_t retried_size = 0;
+    for (size_t i = 0; i < num_blocks; i++) {
+      if (inflate_out[i].status == 1 && inflate_out[i].bytes_written > inflate_in[i].dstSize) {
+        retried_blocks.push_back(i);
+        retried_size += inflate_out[i].bytes_written;
+      } else if (inflate_out[i].status == 0) {
+        _metadata->block_list[i].size = static_cast<uint32_t>(inflate_out[i].bytes_written);
       }
-      if (actual_uncompressed_size > uncompressed_data_size) {
-        decomp_block_data.resize(actual_uncompressed_size);
-        for (size_t i = 0, dst_pos = 0; i < _metadata->block_list.size(); i++) {
-          auto dst_base           = static_cast<uint8_t *>(decomp_block_data.data());
-          inflate_in[i].dstDevice = dst_base + dst_pos;
-
-          _metadata->block_list[i].offset = dst_pos;
-          _metadata->block_list[i].size   = static_cast<uint32_t>(inflate_in[i].dstSize);
-          dst_pos += _metadata->block_list[i].size;
-        }
-      } else {
-        break;
+    }
+    if (!retried_blocks.empty()) {
+      auto dst_pos = decomp_block_data.size();
+      decomp_block_data.resize(dst_pos + retried_size);
+      auto const dst_base = static_cast<uint8_t *>(decomp_block_data.data());
+      for (size_t r = 0; r < retried_blocks.size(); r++) {
+        auto const i            = retried_blocks[r];
+        auto const blk_len      = inflate_out[i].bytes_written;
+        inflate_in[r]           = inflate_in[i];
+        inflate_in[r].dstSize   = blk_len;
+        inflate_in[r].dstDevice = dst_base + dst_pos;
+
+        _metadata->block_list[i].offset = dst_pos;
+        _metadata->block_list[i].size   = static_cast<uint32_t>(blk_len);
+        dst_pos += blk_len;
       }
-    } else {
-      break;
+      decompress(retried_blocks.size());
     }
   }
 
@@ -383,7 +385,7 @@ table_with_metadata reader::impl::read(int skip_rows, int num_rows, cudaStream_t
       rmm::device_buffer block_data(buffer->data(), buffer->size(), stream);
 
       if (_metadata->codec != "" && _metadata->codec != "null") {
-        auto decomp_block_data = decompress_data(block_data, stream);
+        auto decomp_block_data = decompress_data(block_data, buffer->data(), stream);
         block_data             = std::move(decomp_block_data);
       } else {
         auto dst_ofs = _metadata->block_list[0].offset;
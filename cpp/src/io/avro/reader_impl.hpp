@@ -77,11 +77,13 @@ class reader::impl {
    * @brief Decompresses the block data.
    *
    * @param comp_block_data Compressed block data
+   * @param comp_block_host Compressed block data, in host memory
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
    * @return Device buffer to decompressed block data
    */
   rmm::device_buffer decompress_data(const rmm::device_buffer &comp_block_data,
+                                     const uint8_t *comp_block_host,
                                      cudaStream_t stream);
 
   /**
@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file compression.cu
+ * @brief Chunked compression of device buffers
+ *
+ * Compressed buffers start with a `buffer_header_s`, followed by the compressed size of each
+ * chunk and by the chunks themselves, each starting on an 8-byte boundary.
+ */
+
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/io/compression.hpp>
+#include <cudf/utilities/error.hpp>
+#include <io/utilities/hostdevice_vector.hpp>
+#include "gpuinflate.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace {
+constexpr uint32_t chunk_size         = 64 * 1024;
+constexpr uint32_t chunk_uncompressed = 0x80000000u;  // Size flag of chunks stored as is
+
+/**
+ * @brief Header of a compressed buffer
+ **/
+struct buffer_header_s {
+  uint32_t chunk_size;         ///< Uncompressed size of all chunks but the last one
+  uint32_t num_chunks;         ///< Number of chunks
+  uint64_t uncompressed_size;  ///< Size of the uncompressed buffer
+};
+
+constexpr size_t align8(size_t v) { return (v + 7) & ~7; }
+
+/**
+ * @brief Returns the offset of the first chunk of a compressed buffer
+ **/
+constexpr size_t chunks_offset(uint32_t num_chunks)
+{
+  return align8(sizeof(buffer_header_s) + num_chunks * sizeof(uint32_t));
+}
+
+/**
+ * @brief Returns the worst-case compressed size of a chunk, for all supported codecs
+ **/
+constexpr size_t max_compressed_chunk_size(size_t size) { return size + (size >> 7) + 64; }
+
+void compress_chunks(compression_type type,
+                     gpu_inflate_input_s *inputs,
+                     gpu_inflate_status_s *outputs,
+                     int count,
+                     cudaStream_t stream)
+{
+  switch (type) {
+    case compression_type::SNAPPY: CUDA_TRY(gpu_snap(inputs, outputs, count, stream)); break;
+    case compression_type::ZSTD: CUDA_TRY(gpu_zstd(inputs, outputs, count, stream)); break;
+    case compression_type::LZ4: CUDA_TRY(gpu_lz4(inputs, outputs, count, 0, stream)); break;
+    default: CUDF_FAIL("Unsupported compression type");
+  }
+}
+
+void decompress_chunks(compression_type type,
+                       gpu_inflate_input_s *inputs,
+                       gpu_inflate_status_s *outputs,
+                       int count,
+                       cudaStream_t stream)
+{
+  switch (type) {
+    case compression_type::SNAPPY: CUDA_TRY(gpu_unsnap(inputs, outputs, count, stream)); break;
+    case compression_type::ZSTD: CUDA_TRY(gpu_unzstd(inputs, outputs, count, stream)); break;
+    case compression_type::LZ4: CUDA_TRY(gpu_unlz4(inputs, outputs, count, 0, stream)); break;
+    default: CUDF_FAIL("Unsupported compression type");
+  }
+}
+
+}  // namespace
+
+/**
+ * @copydoc cudf::io::compress_buffer
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ **/
+std::unique_ptr<rmm::device_buffer> compress_buffer(compression_type type,
+                                                    rmm::device_buffer const &input,
+                                                    rmm::mr::device_memory_resource *mr,
+                                                    cudaStream_t stream)
+{
+  CUDF_EXPECTS(type == compression_type::SNAPPY || type == compression_type::ZSTD ||
+                 type == compression_type::LZ4,
+               "Unsupported compression type");
+  auto const src             = static_cast<uint8_t const *>(input.data());
+  uint32_t const num_chunks  = (input.size() + chunk_size - 1) / chunk_size;
+  size_t const max_comp_size = max_compressed_chunk_size(chunk_size);
+
+  rmm::device_buffer scratch(num_chunks * max_comp_size, stream);
+  hostdevice_vector<gpu_inflate_input_s> comp_in(num_chunks, stream);
+  hostdevice_vector<gpu_inflate_status_s> comp_out(num_chunks, stream);
+  for (uint32_t i = 0; i < num_chunks; i++) {
+    size_t const src_pos = i * static_cast<size_t>(chunk_size);
+    comp_in[i].srcDevice = src + src_pos;
+    comp_in[i].srcSize   = std::min<size_t>(input.size() - src_pos, chunk_size);
+    comp_in[i].dstDevice = static_cast<uint8_t *>(scratch.data()) + i * max_comp_size;
+    comp_in[i].dstSize   = max_comp_size;
+  }
+  if (num_chunks > 0) {
+    CUDA_TRY(cudaMemcpyAsync(comp_in.device_ptr(),
+                             comp_in.host_ptr(),
+                             comp_in.memory_size(),
+                             cudaMemcpyHostToDevice,
+                             stream));
+    compress_chunks(type, comp_in.device_ptr(), comp_out.device_ptr(), num_chunks, stream);
+    CUDA_TRY(cudaMemcpyAsync(comp_out.host_ptr(),
+                             comp_out.device_ptr(),
+                             comp_out.memory_size(),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+  }
+
+  // Chunks that failed to compress or that did not get smaller are stored as is
+  std::vector<uint8_t> header(chunks_offset(num_chunks));
+  auto const hdr   = reinterpret_cast<buffer_header_s *>(header.data());
+  auto const sizes = reinterpret_cast<uint32_t *>(header.data() + sizeof(buffer_header_s));
+  hdr->chunk_size        = chunk_size;
+  hdr->num_chunks        = num_chunks;
+  hdr->uncompressed_size = input.size();
+  size_t output_size     = header.size();
+  for (uint32_t i = 0; i < num_chunks; i++) {
+    if (comp_out[i].status != 0 || comp_out[i].bytes_written >= comp_in[i].srcSize) {
+      sizes[i] = comp_in[i].srcSize | chunk_uncompressed;
+    } else {
+      sizes[i]             = comp_out[i].bytes_written;
+      comp_in[i].srcDevice = comp_in[i].dstDevice;
+    }
+    comp_in[i].srcSize = sizes[i] & ~chunk_uncompressed;
+    output_size += align8(comp_in[i].srcSize);
+  }
+
+  // Compact the chunks into the output buffer
+  auto output = std::make_unique<rmm::device_buffer>(output_size, stream, mr);
+  auto dst    = static_cast<uint8_t *>(output->data());
+  CUDA_TRY(cudaMemcpyAsync(dst, header.data(), header.size(), cudaMemcpyHostToDevice, stream));
+  size_t dst_pos = header.size();
+  for (uint32_t i = 0; i < num_chunks; i++) {
+    comp_in[i].dstDevice = dst + dst_pos;
+    comp_in[i].dstSize   = comp_in[i].srcSize;
+    dst_pos += align8(comp_in[i].srcSize);
+  }
+  if (num_chunks > 0) {
+    CUDA_TRY(cudaMemcpyAsync(comp_in.device_ptr(),
+                             comp_in.host_ptr(),
+                             comp_in.memory_size(),
+                             cudaMemcpyHostToDevice,
+                             stream));
+    CUDA_TRY(gpu_copy_uncompressed_blocks(comp_in.device_ptr(), num_chunks, stream));
+  }
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  return output;
+}
+
+/**
+ * @copydoc cudf::io::decompress_buffer
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ **/
+std::unique_ptr<rmm::device_buffer> decompress_buffer(compression_type type,
+                                                      rmm::device_buffer const &input,
+                                                      rmm::mr::device_memory_resource *mr,
+                                                      cudaStream_t stream)
+{
+  CUDF_EXPECTS(type == compression_type::SNAPPY || type == compression_type::ZSTD ||
+                 type == compression_type::LZ4,
+               "Unsupported compression type");
+  auto const src = static_cast<uint8_t const *>(input.data());
+  buffer_header_s hdr;
+  CUDF_EXPECTS(input.size() >= sizeof(hdr), "Invalid compressed buffer");
+  CUDA_TRY(cudaMemcpyAsync(&hdr, src, sizeof(hdr), cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  uint32_t const num_chunks = hdr.num_chunks;
+  CUDF_EXPECTS(hdr.chunk_size != 0 &&
+                 num_chunks == (hdr.uncompressed_size + hdr.chunk_size - 1) / hdr.chunk_size &&
+                 input.size() >= chunks_offset(num_chunks),
+               "Invalid compressed buffer");
+  std::vector<uint32_t> sizes(num_chunks);
+  if (num_chunks > 0) {
+    CUDA_TRY(cudaMemcpyAsync(sizes.data(),
+                             src + sizeof(hdr),
+                             num_chunks * sizeof(uint32_t),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+  }
+
+  // Compressed chunks come first, followed by the chunks stored as is
+  auto output = std::make_unique<rmm::device_buffer>(hdr.uncompressed_size, stream, mr);
+  auto dst    = static_cast<uint8_t *>(output->data());
+  uint32_t const num_compressed = std::count_if(
+    sizes.begin(), sizes.end(), [](uint32_t size) { return !(size & chunk_uncompressed); });
+  hostdevice_vector<gpu_inflate_input_s> decomp_in(num_chunks, stream);
+  hostdevice_vector<gpu_inflate_status_s> decomp_out(num_compressed, stream);
+  size_t src_pos         = chunks_offset(num_chunks);
+  uint32_t compressed_id = 0;
+  uint32_t copy_id       = num_compressed;
+  for (uint32_t i = 0; i < num_chunks; i++) {
+    size_t const dst_pos  = i * static_cast<size_t>(hdr.chunk_size);
+    size_t const dst_size = std::min<size_t>(hdr.uncompressed_size - dst_pos, hdr.chunk_size);
+    size_t const src_size = sizes[i] & ~chunk_uncompressed;
+    CUDF_EXPECTS(src_pos + src_size <= input.size(), "Invalid compressed buffer");
+    auto &chunk     = decomp_in[(sizes[i] & chunk_uncompressed) ? copy_id++ : compressed_id++];
+    chunk.srcDevice = src + src_pos;
+    chunk.srcSize   = src_size;
+    chunk.dstDevice = dst + dst_pos;
+    chunk.dstSize   = dst_size;
+    CUDF_EXPECTS(!(sizes[i] & chunk_uncompressed) || src_size == dst_size,
+                 "Invalid compressed buffer");
+    src_pos += align8(src_size);
+  }
+  if (num_chunks > 0) {
+    CUDA_TRY(cudaMemcpyAsync(decomp_in.device_ptr(),
+                             decomp_in.host_ptr(),
+                             decomp_in.memory_size(),
+                             cudaMemcpyHostToDevice,
+                             stream));
+  }
+  if (num_compressed > 0) {
+    decompress_chunks(
+      type, decomp_in.device_ptr(), decomp_out.device_ptr(), num_compressed, stream);
+    CUDA_TRY(cudaMemcpyAsync(decomp_out.host_ptr(),
+                             decomp_out.device_ptr(),
+                             decomp_out.memory_size(),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+  }
+  if (num_chunks > num_compressed) {
+    CUDA_TRY(gpu_copy_uncompressed_blocks(
+      decomp_in.device_ptr(num_compressed), num_chunks - num_compressed, stream));
+  }
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  for (uint32_t i = 0; i < num_compressed; i++) {
+    CUDF_EXPECTS(decomp_out[i].status == 0 && decomp_out[i].bytes_written == decomp_in[i].dstSize,
+                 "Error decompressing buffer");
+  }
+
+  return output;
+}
+
+}  // namespace detail
+
+std::unique_ptr<rmm::device_buffer> compress_buffer(compression_type type,
+                                                    rmm::device_buffer const &input,
+                                                    rmm::mr::device_memory_resource *mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compress_buffer(type, input, mr, 0);
+}
+
+std::unique_ptr<rmm::device_buffer> decompress_buffer(compression_type type,
+                                                      rmm::device_buffer const &input,
+                                                      rmm::mr::device_memory_resource *mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::decompress_buffer(type, input, mr, 0);
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -369,6 +369,7 @@ int32_t bz2_decompress_block(unbz_state_s *s)
       if (zvec >= BZ_MAX_ALPHA_SIZE) return BZ_DATA_ERROR;
       nextSym = gSel->perm[zvec];
       if (nextSym > BZ_RUNB) break;
+      if (N >= 2 * 1024 * 1024) return BZ_DATA_ERROR;  // Prevents run length overflows
       es += N << nextSym;
       N <<= 1;
     }
@@ -525,8 +526,12 @@ static void bzUnRLE(unbz_state_s *s)
   s->out = out;
 }
 
-int32_t cpu_bz2_uncompress(
-  const uint8_t *source, size_t sourceLen, uint8_t *dest, size_t *destLen, uint64_t *block_start)
+int32_t cpu_bz2_uncompress(const uint8_t *source,
+                           size_t sourceLen,
+                           uint8_t *dest,
+                           size_t *destLen,
+                           uint64_t *block_start,
+                           bool single_block)
 {
   unbz_state_s s;
   uint32_t v;
@@ -586,13 +591,13 @@ int32_t cpu_bz2_uncompress(
         ret = (s.out < s.outend) ? BZ_UNEXPECTED_EOF : BZ_OUTBUFF_FULL;
       }
     }
-  } while (ret == BZ_OK);
+  } while (ret == BZ_OK && !single_block);
 
-  if (ret == BZ_STREAM_END) {
+  if (ret == BZ_STREAM_END || (ret == BZ_OK && single_block)) {
     // normal termination
     last_valid_block_in  = ((s.cur - s.base) << 3) + (s.bitpos);
     last_valid_block_out = s.out - s.outbase;
-    ret                  = BZ_OK;
+    if (!single_block) { ret = BZ_OK; }
   }
 
   *destLen = last_valid_block_out;
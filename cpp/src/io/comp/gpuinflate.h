@@ -114,6 +114,44 @@ cudaError_t gpu_debrotli(gpu_inflate_input_s *inputs,
                          int count           = 1,
                          cudaStream_t stream = (cudaStream_t)0);
 
+/**
+ * @brief Interface for decompressing ZSTD-compressed data
+ *
+ * Multiple, independent chunks of compressed data can be decompressed by using
+ * separate gpu_inflate_input_s/gpu_inflate_status_s pairs for each chunk.
+ * Frames using a dictionary are not supported.
+ *
+ * @param[in] inputs List of input argument structures
+ * @param[out] outputs List of output status structures
+ * @param[in] count Number of input/output structures, default 1
+ * @param[in] stream CUDA stream to use, default 0
+ **/
+cudaError_t gpu_unzstd(gpu_inflate_input_s *inputs,
+                       gpu_inflate_status_s *outputs,
+                       int count           = 1,
+                       cudaStream_t stream = (cudaStream_t)0);
+
+/**
+ * @brief Interface for decompressing LZ4-compressed data
+ *
+ * Multiple, independent chunks of compressed data can be decompressed by using
+ * separate gpu_inflate_input_s/gpu_inflate_status_s pairs for each chunk.
+ * With Hadoop framing, each chunk is a sequence of frames made of the big-endian uncompressed
+ * and compressed sizes followed by an LZ4 block; chunks that are not validly framed are decoded
+ * as a single raw LZ4 block.
+ *
+ * @param[in] inputs List of input argument structures
+ * @param[out] outputs List of output status structures
+ * @param[in] count Number of input/output structures, default 1
+ * @param[in] hadoop_framing Whether chunks may use Hadoop framing, default 0
+ * @param[in] stream CUDA stream to use, default 0
+ **/
+cudaError_t gpu_unlz4(gpu_inflate_input_s *inputs,
+                      gpu_inflate_status_s *outputs,
+                      int count           = 1,
+                      int hadoop_framing  = 0,
+                      cudaStream_t stream = (cudaStream_t)0);
+
 /**
  * @brief Interface for compressing data with Snappy
  *
@@ -130,6 +168,42 @@ cudaError_t gpu_snap(gpu_inflate_input_s *inputs,
                      int count           = 1,
                      cudaStream_t stream = (cudaStream_t)0);
 
+/**
+ * @brief Interface for compressing data with ZSTD
+ *
+ * Multiple, independent chunks of compressed data can be compressed by using
+ * separate gpu_inflate_input_s/gpu_inflate_status_s pairs for each chunk. Each chunk is
+ * compressed to a single ZSTD frame.
+ *
+ * @param[in] inputs List of input argument structures
+ * @param[out] outputs List of output status structures
+ * @param[in] count Number of input/output structures, default 1
+ * @param[in] stream CUDA stream to use, default 0
+ **/
+cudaError_t gpu_zstd(gpu_inflate_input_s *inputs,
+                     gpu_inflate_status_s *outputs,
+                     int count           = 1,
+                     cudaStream_t stream = (cudaStream_t)0);
+
+/**
+ * @brief Interface for compressing data with LZ4
+ *
+ * Multiple, independent chunks of compressed data can be compressed by using
+ * separate gpu_inflate_input_s/gpu_inflate_status_s pairs for each chunk. Each chunk is
+ * compressed to a single LZ4 block, preceded by a Hadoop frame header if requested.
+ *
+ * @param[in] inputs List of input argument structures
+ * @param[out] outputs List of output status structures
+ * @param[in] count Number of input/output structures, default 1
+ * @param[in] hadoop_framing Whether to use Hadoop framing, default 0
+ * @param[in] stream CUDA stream to use, default 0
+ **/
+cudaError_t gpu_lz4(gpu_inflate_input_s *inputs,
+                    gpu_inflate_status_s *outputs,
+                    int count           = 1,
+                    int hadoop_framing  = 0,
+                    cudaStream_t stream = (cudaStream_t)0);
+
 }  // namespace io
 }  // namespace cudf
 
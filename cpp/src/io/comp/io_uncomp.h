@@ -45,6 +45,30 @@ void getUncompressedHostData(const char* h_data,
                              const std::string& compression,
                              std::vector<char>& h_uncomp_data);
 
+/**
+ * @brief Decompresses ZSTD frames on the host
+ *
+ * @param[out] dst Destination buffer
+ * @param[in] dst_len Size of the destination buffer
+ * @param[in] src Compressed data
+ * @param[in] src_len Size of the compressed data
+ *
+ * @return Number of decompressed bytes, zero if the data is invalid or does not fit
+ */
+size_t cpu_unzstd(uint8_t* dst, size_t dst_len, const uint8_t* src, size_t src_len);
+
+/**
+ * @brief Decompresses a raw LZ4 block on the host
+ *
+ * @param[out] dst Destination buffer
+ * @param[in] dst_len Size of the destination buffer
+ * @param[in] src Compressed data
+ * @param[in] src_len Size of the compressed data
+ *
+ * @return Number of decompressed bytes, zero if the data is invalid or does not fit
+ */
+size_t cpu_unlz4(uint8_t* dst, size_t dst_len, const uint8_t* src, size_t src_len);
+
 class HostDecompressor {
  public:
   virtual size_t Decompress(uint8_t* dstBytes,
@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file lz4.cu
+ * @brief LZ4 block compression
+ *
+ * Each stream is compressed by a single warp into a single LZ4 block, optionally preceded by the
+ * Hadoop frame header used by Parquet. Matches are found with 4-byte hashes like the snappy
+ * compressor.
+ */
+
+#include <io/utilities/block_utils.cuh>
+#include "gpuinflate.h"
+
+namespace cudf {
+namespace io {
+#define LZ4_HASH_BITS 12
+#define LZ4_MAX_DISTANCE 0xffff  // Syntax limit of the 2-byte offset
+#define LZ4_LAST_LITERALS 5      // The last bytes of a block are always literals
+#define LZ4_MATCH_LIMIT 12       // The last match starts at least this many bytes before the end
+
+/**
+ * @brief LZ4 compressor state
+ **/
+struct lz4_state_s {
+  const uint8_t *src;                     ///< Ptr to uncompressed data
+  uint32_t src_len;                       ///< Uncompressed data length
+  uint8_t *dst_base;                      ///< Base ptr to output compressed data
+  uint8_t *dst;                           ///< Current ptr to compressed data
+  uint8_t *end;                           ///< End of compressed data buffer
+  uint16_t hash_map[1 << LZ4_HASH_BITS];  ///< Low 16-bit offset from hash
+};
+
+/**
+ * @brief 12-bit hash from four consecutive bytes
+ **/
+static inline __device__ uint32_t lz4_hash(uint32_t v)
+{
+  return (v * ((1 << 20) + (0x2a00) + (0x6a) + 1)) >> (32 - LZ4_HASH_BITS);
+}
+
+/**
+ * @brief Fetches four consecutive bytes
+ **/
+static inline __device__ uint32_t lz4_fetch4(const uint8_t *src)
+{
+  uint32_t src_align    = 3 & reinterpret_cast<uintptr_t>(src);
+  const uint32_t *src32 = reinterpret_cast<const uint32_t *>(src - src_align);
+  uint32_t v            = src32[0];
+  return (src_align) ? __funnelshift_r(v, src32[1], src_align * 8) : v;
+}
+
+/**
+ * @brief Returns mask of any thread in the warp that has a hash value
+ * equal to that of the calling thread
+ **/
+static inline __device__ uint32_t lz4_hash_match_any(uint32_t v)
+{
+#if (__CUDA_ARCH__ >= 700)
+  return __match_any_sync(~0, v);
+#else
+  uint32_t err_map = 0;
+  for (uint32_t i = 0; i < LZ4_HASH_BITS; i++, v >>= 1) {
+    uint32_t b       = v & 1;
+    uint32_t match_b = BALLOT(b);
+    err_map |= match_b ^ -(int32_t)b;
+  }
+  return ~err_map;
+#endif
+}
+
+/**
+ * @brief Finds the first 4-byte match starting before a given position
+ *
+ * @param[in] s Compressor state
+ * @param[in] pos0 Position in uncompressed buffer
+ * @param[in] end End of the last possible match start, plus 4
+ * @param[out] distance Match distance, zero if there is no match
+ * @param[in] t Thread in warp
+ *
+ * @return Number of bytes before the match (literal length)
+ **/
+static __device__ uint32_t lz4_find_match(
+  lz4_state_s *s, uint32_t pos0, uint32_t end, uint32_t *distance, uint32_t t)
+{
+  const uint8_t *src = s->src;
+  uint32_t pos       = pos0;
+  uint32_t match_mask, literal_cnt;
+  *distance = 0;
+  while (pos + 4 <= end) {
+    bool valid4               = (pos + t + 4 <= end);
+    uint32_t data32           = (valid4) ? lz4_fetch4(src + pos + t) : 0;
+    uint32_t hash             = (valid4) ? lz4_hash(data32) : 0;
+    uint32_t local_match      = lz4_hash_match_any(hash);
+    uint32_t local_match_lane = 31 - __clz(local_match & ((1u << t) - 1));
+    uint32_t local_match_data = SHFL(data32, min(local_match_lane, t));
+    uint32_t offset, match;
+    if (valid4) {
+      if (local_match_lane < t && local_match_data == data32) {
+        match  = 1;
+        offset = pos + local_match_lane;
+      } else {
+        offset = (pos & ~0xffff) | s->hash_map[hash];
+        if (offset >= pos) { offset = (offset >= 0x10000) ? offset - 0x10000 : pos; }
+        match = (offset < pos && offset + LZ4_MAX_DISTANCE >= pos + t &&
+                 lz4_fetch4(src + offset) == data32);
+      }
+    } else {
+      match       = 0;
+      local_match = 0;
+      offset      = pos + t;
+    }
+    match_mask  = BALLOT(match);
+    literal_cnt = (match_mask != 0) ? __ffs(match_mask) - 1 : 32;
+    // Update hash up to the first 4 bytes of the match
+    if (literal_cnt < 31) { local_match &= (2u << literal_cnt) - 1; }
+    if (t <= literal_cnt && t == 31 - __clz(local_match)) { s->hash_map[hash] = pos + t; }
+    SYNCWARP();
+    if (match_mask != 0) {
+      *distance = SHFL(pos + t - offset, literal_cnt);
+      return pos + literal_cnt - pos0;
+    }
+    pos += 32;
+  }
+  return end - pos0;
+}
+
+/**
+ * @brief Returns the length of a match, extended up to a given position
+ **/
+static __device__ uint32_t lz4_match_length(
+  const uint8_t *src, uint32_t pos, uint32_t distance, uint32_t end, uint32_t t)
+{
+  uint32_t len = 4;
+  for (;;) {
+    uint32_t const p        = pos + len + t;
+    uint32_t const mismatch = BALLOT(p >= end || src[p] != src[p - distance]);
+    if (mismatch != 0) { return len + __ffs(mismatch) - 1; }
+    len += 32;
+  }
+}
+
+/**
+ * @brief Outputs the trailing bytes of an extended length (assumed to be called by a single
+ * thread)
+ **/
+static inline __device__ uint8_t *lz4_store_length(uint8_t *dst, uint8_t *end, uint32_t len)
+{
+  for (; len >= 255; len -= 255) {
+    if (dst < end) dst[0] = 255;
+    dst++;
+  }
+  if (dst < end) dst[0] = len;
+  return dst + 1;
+}
+
+/**
+ * @brief Outputs an LZ4 sequence: literals optionally followed by a match
+ *
+ * @param dst Destination compressed byte stream
+ * @param end End of compressed data buffer
+ * @param literals Pointer to literal bytes
+ * @param literal_length Number of literal bytes
+ * @param match_length Number of match bytes, zero for the last sequence of the block
+ * @param distance Match distance
+ * @param t Thread in warp
+ *
+ * @return Updated pointer to compressed byte stream
+ **/
+static __device__ uint8_t *lz4_store_sequence(uint8_t *dst,
+                                              uint8_t *end,
+                                              const uint8_t *literals,
+                                              uint32_t literal_length,
+                                              uint32_t match_length,
+                                              uint32_t distance,
+                                              uint32_t t)
+{
+  uint32_t const ml_code = (match_length > 0) ? match_length - 4 : 0;
+  uint32_t hdr_len       = 1;
+  if (literal_length >= 15) { hdr_len += (literal_length - 15) / 255 + 1; }
+  if (!t) {
+    if (dst < end) dst[0] = (min(literal_length, 15u) << 4) | min(ml_code, 15u);
+    if (literal_length >= 15) { lz4_store_length(dst + 1, end, literal_length - 15); }
+  }
+  dst += hdr_len;
+  for (uint32_t i = t; i < literal_length; i += 32) {
+    if (dst + i < end) dst[i] = literals[i];
+  }
+  dst += literal_length;
+  if (match_length > 0) {
+    if (!t && dst + 2 <= end) {
+      dst[0] = distance;
+      dst[1] = distance >> 8;
+    }
+    dst += 2;
+    if (ml_code >= 15) {
+      uint32_t const ext_len = (ml_code - 15) / 255 + 1;
+      if (!t) { lz4_store_length(dst, end, ml_code - 15); }
+      dst += ext_len;
+    }
+  }
+  return dst;
+}
+
+/**
+ * @brief Writes a big-endian 32-bit value (assumed to be called by a single thread)
+ **/
+static inline __device__ void lz4_store_be32(uint8_t *dst, uint32_t v)
+{
+  dst[0] = v >> 24;
+  dst[1] = v >> 16;
+  dst[2] = v >> 8;
+  dst[3] = v;
+}
+
+/**
+ * @brief LZ4 compression kernel
+ * See https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md
+ *
+ * blockDim {32,1,1}
+ *
+ * @param[in] inputs Source/Destination buffer information per block
+ * @param[out] outputs Compression status per block
+ * @param[in] count Number of blocks to compress
+ * @param[in] hadoop_framing Whether to precede each block with a Hadoop frame header
+ **/
+extern "C" __global__ void __launch_bounds__(32) lz4_kernel(gpu_inflate_input_s *inputs,
+                                                            gpu_inflate_status_s *outputs,
+                                                            int count,
+                                                            int hadoop_framing)
+{
+  __shared__ __align__(16) lz4_state_s state_g;
+
+  lz4_state_s *const s = &state_g;
+  uint32_t t           = threadIdx.x;
+
+  if (!t) {
+    const uint8_t *src = reinterpret_cast<const uint8_t *>(inputs[blockIdx.x].srcDevice);
+    uint32_t src_len   = static_cast<uint32_t>(inputs[blockIdx.x].srcSize);
+    uint8_t *dst       = reinterpret_cast<uint8_t *>(inputs[blockIdx.x].dstDevice);
+    uint32_t dst_len   = static_cast<uint32_t>(inputs[blockIdx.x].dstSize);
+    s->src             = src;
+    s->src_len         = src_len;
+    s->dst_base        = dst;
+    s->end             = dst + dst_len;
+    // Hadoop frame header: [uncompressed size][compressed size], written once the block is done
+    s->dst = (hadoop_framing) ? dst + 8 : dst;
+  }
+  for (uint32_t i = t; i < sizeof(s->hash_map) / sizeof(uint32_t); i += 32) {
+    *reinterpret_cast<volatile uint32_t *>(&s->hash_map[i * 2]) = 0;
+  }
+  __syncthreads();
+  const uint8_t *src     = s->src;
+  uint32_t const src_len = s->src_len;
+  uint8_t *dst           = s->dst;
+  uint8_t *const end     = s->end;
+  uint32_t const match_start_end =
+    (src_len > LZ4_MATCH_LIMIT) ? src_len - LZ4_MATCH_LIMIT + 4 : 0;
+  uint32_t const match_end = (src_len > LZ4_LAST_LITERALS) ? src_len - LZ4_LAST_LITERALS : 0;
+  uint32_t pos             = 0;
+  while (pos + 4 <= match_start_end) {
+    uint32_t distance;
+    uint32_t const literal_length = lz4_find_match(s, pos, match_start_end, &distance, t);
+    if (distance == 0) break;
+    uint32_t const match_length =
+      lz4_match_length(src, pos + literal_length, distance, match_end, t);
+    dst = lz4_store_sequence(dst, end, src + pos, literal_length, match_length, distance, t);
+    pos += literal_length + match_length;
+  }
+  dst = lz4_store_sequence(dst, end, src + pos, src_len - pos, 0, 0, t);
+  SYNCWARP();
+  if (!t) {
+    if (hadoop_framing && s->dst_base + 8 <= end) {
+      lz4_store_be32(s->dst_base, src_len);
+      lz4_store_be32(s->dst_base + 4, static_cast<uint32_t>(dst - s->dst_base - 8));
+    }
+    outputs[blockIdx.x].bytes_written = dst - s->dst_base;
+    outputs[blockIdx.x].status        = (dst > end) ? 1 : 0;
+    outputs[blockIdx.x].reserved      = 0;
+  }
+}
+
+cudaError_t __host__ gpu_lz4(gpu_inflate_input_s *inputs,
+                             gpu_inflate_status_s *outputs,
+                             int count,
+                             int hadoop_framing,
+                             cudaStream_t stream)
+{
+  dim3 dim_block(32, 1);  // 1 warp per stream, 1 stream per block
+  dim3 dim_grid(count, 1);
+  if (count > 0) {
+    lz4_kernel<<<dim_grid, dim_block, 0, stream>>>(inputs, outputs, count, hadoop_framing);
+  }
+  return cudaSuccess;
+}
+
+}  // namespace io
+}  // namespace cudf
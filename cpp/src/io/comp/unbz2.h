@@ -83,6 +83,9 @@ namespace io {
 // If BZ_OUTBUFF_FULL is returned and block_start is non-NULL, dstlen will be updated to point to
 // the end of the last valid block, and block_start will contain the offset in bits of the beginning
 // of the block, so it can be passed in to resume decoding later on.
+// If single_block is true, only the block at block_start is decoded: block_start is then updated to
+// the beginning of the next block if BZ_OK is returned, or to the end of the end-of-stream
+// signature if BZ_STREAM_END is returned.
 #define BZ_OK 0
 #define BZ_RUN_OK 1
 #define BZ_FLUSH_OK 2
@@ -101,7 +104,8 @@ int32_t cpu_bz2_uncompress(const uint8_t *input,
                            size_t inlen,
                            uint8_t *dst,
                            size_t *dstlen,
-                           uint64_t *block_start = nullptr);
+                           uint64_t *block_start = nullptr,
+                           bool single_block     = false);
 
 }  // namespace io
 }  // namespace cudf
@@ -22,6 +22,10 @@
 
 #include <cudf/utilities/error.hpp>
 
+#include <algorithm>
+#include <future>
+#include <thread>
+
 namespace cudf {
 namespace io {
 #define GZ_FLG_FTEXT 0x01     // ASCII text hint
@@ -240,13 +244,18 @@ int cpu_inflate(uint8_t *uncomp_data, size_t *destLen, const uint8_t *comp_data,
  * @Brief Uncompresses a raw DEFLATE stream to a char vector.
  * The vector will be grown to match the uncompressed size
  * Optimized for the case where the initial size is the uncompressed
- * size truncated to 32-bit, and grows the buffer in 1GB increments.
+ * size truncated to 32-bit, and grows the buffer by doubling its size, in
+ * at most 1GB increments.
  *
  * @param dst[out] Destination vector
  * @param comp_data[in] Raw compressed data
  * @param comp_len[in] Compressed data size
+ * @param comp_used[out] If non-null, number of compressed bytes of the DEFLATE stream
  */
-int cpu_inflate_vector(std::vector<char> &dst, const uint8_t *comp_data, size_t comp_len)
+int cpu_inflate_vector(std::vector<char> &dst,
+                       const uint8_t *comp_data,
+                       size_t comp_len,
+                       size_t *comp_used = nullptr)
 {
   int zerr;
   z_stream strm;
@@ -265,7 +274,7 @@ int cpu_inflate_vector(std::vector<char> &dst, const uint8_t *comp_data, size_t
   }
   do {
     if (strm.avail_out == 0) {
-      dst.resize(strm.total_out + (1 << 30));
+      dst.resize(strm.total_out + std::min<size_t>(std::max<size_t>(dst.size(), 4096), 1 << 30));
       strm.avail_out = dst.size() - strm.total_out;
       strm.next_out  = reinterpret_cast<uint8_t *>(dst.data()) + strm.total_out;
     }
@@ -273,10 +282,202 @@ int cpu_inflate_vector(std::vector<char> &dst, const uint8_t *comp_data, size_t
   } while ((zerr == Z_BUF_ERROR || zerr == Z_OK) && strm.avail_out == 0 &&
            strm.total_out == dst.size());
   dst.resize(strm.total_out);
+  if (comp_used) { *comp_used = strm.total_in; }
   inflateEnd(&strm);
   return (zerr == Z_STREAM_END) ? Z_OK : zerr;
 }
 
+/**
+ * @Brief Decoded independent block of a compressed file
+ */
+struct host_block_s {
+  bool valid;              // Whether the candidate position is the start of a block
+  uint64_t next;           // Position of the following block, or end_of_blocks
+  std::vector<char> data;  // Uncompressed data
+};
+
+constexpr uint64_t end_of_blocks = ~0ull;
+
+/**
+ * @Brief Decodes the independent blocks of a compressed file on concurrent host threads
+ *
+ * The positions of the blocks are not known in advance: candidate positions that look like the
+ * start of a block are all decoded, and only the ones that chain up from the first block are
+ * kept. Candidates are decoded in waves of one per host core, so that the memory used for the
+ * blocks that are not yet concatenated stays bounded.
+ *
+ * @param candidates[in] Candidate block positions, in increasing order
+ * @param first[in] Position of the first block
+ * @param decode[in] Functor decoding the candidate block of a given index into a host_block_s
+ * @param dst[out] Uncompressed data
+ *
+ * @returns true if the blocks chain up to the end of the file, false otherwise
+ */
+template <typename Decode>
+bool uncompress_host_blocks(std::vector<uint64_t> const &candidates,
+                            uint64_t first,
+                            Decode decode,
+                            std::vector<char> &dst)
+{
+  size_t const num_threads = std::max(1u, std::thread::hardware_concurrency());
+  uint64_t expected        = first;
+
+  dst.clear();
+  for (size_t begin = 0; begin < candidates.size() && expected != end_of_blocks;
+       begin += num_threads) {
+    auto const end = std::min(begin + num_threads, candidates.size());
+    std::vector<std::pair<uint64_t, std::future<host_block_s>>> blocks;
+    for (size_t i = begin; i < end; i++) {
+      // Candidates within the blocks that are already decoded are skipped
+      if (candidates[i] >= expected) {
+        blocks.emplace_back(candidates[i], std::async(std::launch::async, decode, i));
+      }
+    }
+    for (auto &block : blocks) {
+      auto decoded = block.second.get();
+      if (block.first < expected) { continue; }
+      if (block.first > expected || !decoded.valid) { return false; }
+      dst.insert(dst.end(), decoded.data.begin(), decoded.data.end());
+      expected = decoded.next;
+    }
+  }
+  return expected == end_of_blocks;
+}
+
+/**
+ * @Brief Returns whether a gzip member header may start at the given position
+ */
+inline bool is_gz_member_start(const uint8_t *raw, size_t len)
+{
+  return len >= sizeof(gz_file_header_s) + 8 && raw[0] == 0x1f && raw[1] == 0x8b && raw[2] == 8 &&
+         (raw[3] & 0xe0) == 0;
+}
+
+/**
+ * @Brief Uncompresses the members of a multi-member gzip file (such as concatenated gzip files or
+ * BGZF) on concurrent host threads
+ *
+ * @param raw[in] Compressed file
+ * @param len[in] Compressed file size
+ * @param dst[out] Uncompressed data
+ *
+ * @returns true if successful, false if the file should be uncompressed as a single member
+ */
+bool uncompress_gz_members(const uint8_t *raw, size_t len, std::vector<char> &dst)
+{
+  std::vector<uint64_t> candidates;
+  for (auto p = raw; (p = static_cast<const uint8_t *>(memchr(p, 0x1f, raw + len - p))); p++) {
+    if (is_gz_member_start(p, raw + len - p)) { candidates.push_back(p - raw); }
+  }
+  if (candidates.size() < 2) { return false; }
+
+  auto decode = [&](size_t i) {
+    host_block_s member{false, end_of_blocks, {}};
+    uint64_t const pos = candidates[i];
+    gz_archive_s gz;
+    if (!ParseGZArchive(&gz, raw + pos, len - pos)) { return member; }
+    // The following candidate gives a hint of the compressed size of the member
+    size_t const comp_avail = raw + len - gz.comp_data;
+    size_t const comp_hint  = (i + 1 < candidates.size()) ? candidates[i + 1] - pos : comp_avail;
+    size_t comp_used        = 0;
+    member.data.resize(comp_hint * 4 + 4096);
+    if (cpu_inflate_vector(member.data, gz.comp_data, comp_avail, &comp_used) != Z_OK ||
+        comp_used + 8 > comp_avail) {
+      return member;
+    }
+    auto le32 = [](const uint8_t *p) { return p[0] | (p[1] << 8) | (p[2] << 16) | (p[3] << 24); };
+    const uint8_t *trailer = gz.comp_data + comp_used;
+    uint32_t const crc     = le32(trailer);
+    uint32_t const isize   = le32(trailer + 4);
+    auto const data        = reinterpret_cast<const Bytef *>(member.data.data());
+    uLong data_crc         = crc32(0, nullptr, 0);
+    for (size_t pos = 0; pos < member.data.size(); pos += (1 << 30)) {
+      data_crc = crc32(data_crc, data + pos, std::min<size_t>(member.data.size() - pos, 1 << 30));
+    }
+    member.valid = (isize == static_cast<uint32_t>(member.data.size()) && crc == data_crc);
+    // Anything other than another member after the trailer is ignored, like gunzip does
+    size_t const next = trailer + 8 - raw;
+    if (is_gz_member_start(raw + next, len - next)) { member.next = next; }
+    return member;
+  };
+  return uncompress_host_blocks(candidates, 0, decode, dst);
+}
+
+/**
+ * @Brief Uncompresses the blocks of a bzip2 file on concurrent host threads, including files made
+ * of several concatenated streams (as produced by pbzip2)
+ *
+ * Blocks are not byte-aligned, and their start is found by looking for their 48-bit signature.
+ *
+ * @param raw[in] Compressed file
+ * @param len[in] Compressed file size
+ * @param dst[out] Uncompressed data
+ *
+ * @returns true if successful, false if the file should be uncompressed sequentially
+ */
+bool uncompress_bz2_blocks(const uint8_t *raw, size_t len, std::vector<char> &dst)
+{
+  constexpr uint64_t block_signature = 0x314159265359ull;
+  constexpr uint64_t max_block_size  = 64 << 20;  // Limit of the uncompressed size of a block
+  auto is_stream_start               = [&](size_t pos) {
+    return pos + 8 <= len && raw[pos] == 'B' && raw[pos + 1] == 'Z' && raw[pos + 2] == 'h' &&
+           raw[pos + 3] >= '1' && raw[pos + 3] <= '9';
+  };
+
+  // Candidate positions are in bits, along with the start of the stream containing them
+  std::vector<uint64_t> candidates;
+  std::vector<size_t> streams;
+  size_t stream = 0;
+  uint64_t bits = 0;
+  for (size_t i = 0; i < len; i++) {
+    bits = (bits << 8) | raw[i];
+    if (i >= 3 && is_stream_start(i - 3)) { stream = i - 3; }
+    if (i < 6) { continue; }
+    for (uint32_t shift = 8; shift > 0; shift--) {
+      if (((bits >> (shift - 1)) & 0xffffffffffffull) == block_signature) {
+        uint64_t const pos = (i + 1) * 8 - (shift - 1) - 48;
+        if (pos >= stream * 8 + 32) {
+          candidates.push_back(pos);
+          streams.push_back(stream);
+        }
+      }
+    }
+  }
+  if (candidates.size() < 2 || candidates[0] != 32) { return false; }
+
+  auto decode = [&](size_t i) {
+    host_block_s block{false, end_of_blocks, {}};
+    size_t const stream_pos = streams[i];
+    block.data.resize((raw[stream_pos + 3] - '0') * 100000);
+    for (;;) {
+      size_t dst_len       = block.data.size();
+      uint64_t block_start = candidates[i] - stream_pos * 8;
+      int32_t const ret    = cpu_bz2_uncompress(raw + stream_pos,
+                                             len - stream_pos,
+                                             reinterpret_cast<uint8_t *>(block.data.data()),
+                                             &dst_len,
+                                             &block_start,
+                                             true);
+      if (ret == BZ_OUTBUFF_FULL && block.data.size() < max_block_size) {
+        block.data.resize(std::min(block.data.size() * 4, max_block_size));
+        continue;
+      }
+      block.data.resize(dst_len);
+      if (ret == BZ_OK) {
+        block.valid = true;
+        block.next  = stream_pos * 8 + block_start;
+      } else if (ret == BZ_STREAM_END) {
+        // The end-of-stream signature is followed by the stream CRC, and by the next stream
+        size_t const next_stream = stream_pos + (block_start + 32 + 7) / 8;
+        block.valid              = true;
+        if (is_stream_start(next_stream)) { block.next = next_stream * 8 + 32; }
+      }
+      return block;
+    }
+  };
+  return uncompress_host_blocks(candidates, 32, decode, dst);
+}
+
 /* --------------------------------------------------------------------------*/
 /**
  * @Brief Uncompresses a gzip/zip/bzip2/xz file stored in system memory.
@@ -376,6 +577,14 @@ void io_uncompress_single_h2d(const void *src,
                                        // ~4:1 compression for initial size
   }
 
+  // Files made of independent members or blocks are uncompressed in parallel
+  if (strm_type == IO_UNCOMP_STREAM_TYPE_GZIP && uncompress_gz_members(raw, src_size, dst)) {
+    return;
+  }
+  if (strm_type == IO_UNCOMP_STREAM_TYPE_BZIP2 && uncompress_bz2_blocks(raw, src_size, dst)) {
+    return;
+  }
+
   if (strm_type == IO_UNCOMP_STREAM_TYPE_GZIP || strm_type == IO_UNCOMP_STREAM_TYPE_ZIP) {
     // INFLATE
     dst.resize(uncomp_len);
@@ -569,6 +778,44 @@ class HostDecompressor_SNAPPY : public HostDecompressor {
   }
 };
 
+/* --------------------------------------------------------------------------*/
+/**
+ * @Brief ZSTD host decompressor class
+ */
+/* ----------------------------------------------------------------------------*/
+
+class HostDecompressor_ZSTD : public HostDecompressor {
+ public:
+  HostDecompressor_ZSTD() {}
+  size_t Decompress(uint8_t *dstBytes,
+                    size_t dstLen,
+                    const uint8_t *srcBytes,
+                    size_t srcLen) override
+  {
+    if (!dstBytes || srcLen < 1) { return 0; }
+    return cpu_unzstd(dstBytes, dstLen, srcBytes, srcLen);
+  }
+};
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Brief LZ4 host decompressor class
+ */
+/* ----------------------------------------------------------------------------*/
+
+class HostDecompressor_LZ4 : public HostDecompressor {
+ public:
+  HostDecompressor_LZ4() {}
+  size_t Decompress(uint8_t *dstBytes,
+                    size_t dstLen,
+                    const uint8_t *srcBytes,
+                    size_t srcLen) override
+  {
+    if (!dstBytes || srcLen < 1) { return 0; }
+    return cpu_unlz4(dstBytes, dstLen, srcBytes, srcLen);
+  }
+};
+
 /* --------------------------------------------------------------------------*/
 /**
  * @Brief CPU decompression class
@@ -586,6 +833,8 @@ HostDecompressor *HostDecompressor::Create(int stream_type)
     case IO_UNCOMP_STREAM_TYPE_GZIP: decompressor = new HostDecompressor_ZLIB(true); break;
     case IO_UNCOMP_STREAM_TYPE_INFLATE: decompressor = new HostDecompressor_ZLIB(false); break;
     case IO_UNCOMP_STREAM_TYPE_SNAPPY: decompressor = new HostDecompressor_SNAPPY(); break;
+    case IO_UNCOMP_STREAM_TYPE_ZSTD: decompressor = new HostDecompressor_ZSTD(); break;
+    case IO_UNCOMP_STREAM_TYPE_LZ4: decompressor = new HostDecompressor_LZ4(); break;
     default: decompressor = nullptr; break;
   }
   return decompressor;
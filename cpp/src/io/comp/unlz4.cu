@@ -0,0 +1,334 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file unlz4.cu
+ * @brief LZ4 block decompression
+ *
+ * Each stream is decoded by a single warp: the first lane parses the sequences into batches of
+ * literal and match copies, which are then executed by the whole warp. The same parser is used
+ * for host decompression of ORC metadata.
+ */
+
+#include <io/utilities/block_utils.cuh>
+#include "gpuinflate.h"
+#include "io_uncomp.h"
+
+#include <memory>
+
+namespace cudf {
+namespace io {
+#define UNLZ4_BATCH_SIZE 32        // Sequences decoded per batch
+#define UNLZ4_STREAMS_PER_BLOCK 4  // One warp per stream
+#define LZ4_MIN_MATCH 4
+
+/**
+ * @brief Literal and match copy of a decoded sequence
+ **/
+struct unlz4_copy_s {
+  const uint8_t *literals;  // Source of the literals
+  uint32_t literal_length;  // Number of literal bytes
+  uint32_t match_length;    // Number of match bytes
+  uint32_t offset;          // Distance of the match source
+};
+
+/**
+ * @brief LZ4 decompressor state
+ **/
+struct unlz4_state_s {
+  const uint8_t *src;        // Start of the compressed data
+  const uint8_t *cur;        // Current position in the compressed data
+  const uint8_t *end;        // End of the compressed data
+  const uint8_t *block_end;  // End of the current LZ4 block
+  uint8_t *dst_base;         // Start of the decompressed data
+  uint8_t *dst;              // Output position after the current batch
+  uint8_t *dst_end;          // End of the output buffer
+  uint8_t *frame_dst_end;    // Expected end of the output of the current Hadoop frame
+  int32_t error;             // Non-zero if the data is invalid
+  int32_t done;              // Whether the whole input is decoded
+  int32_t hadoop;            // Whether the input uses Hadoop framing
+
+  uint8_t *batch_dst;                    // Output position of the first copy of the batch
+  uint32_t batch_len;                    // Number of copies in the batch
+  unlz4_copy_s batch[UNLZ4_BATCH_SIZE];  // Sequences of the batch
+};
+
+/**
+ * @brief Reads a big-endian 32-bit value
+ **/
+inline __host__ __device__ uint32_t unlz4_be32(const uint8_t *p)
+{
+  return (p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+/**
+ * @brief Starts decoding the input, either as a sequence of Hadoop frames or as a raw LZ4 block
+ **/
+__host__ __device__ void unlz4_start(unlz4_state_s *s, int32_t hadoop)
+{
+  s->cur       = s->src;
+  s->dst       = s->dst_base;
+  s->error     = 0;
+  s->done      = 0;
+  s->hadoop    = hadoop;
+  s->batch_len = 0;
+  if (hadoop) {
+    // Each frame is [uncompressed size][compressed size][LZ4 block], with big-endian sizes
+    s->block_end     = s->cur;
+    s->frame_dst_end = s->dst;
+  } else {
+    s->block_end     = s->end;
+    s->frame_dst_end = s->dst_end;
+  }
+}
+
+/**
+ * @brief Reads an extended length, made of bytes that are added until one is not 255
+ *
+ * @return false if the length runs past the end of the block
+ **/
+inline __host__ __device__ bool unlz4_extended_length(unlz4_state_s *s, uint32_t *len)
+{
+  uint32_t b;
+  do {
+    if (s->cur >= s->block_end) return false;
+    b = *s->cur++;
+    *len += b;
+  } while (b == 255);
+  return true;
+}
+
+/**
+ * @brief Decodes a batch of sequences
+ *
+ * With Hadoop framing, invalid frames restart the decoding as a raw LZ4 block, as writers
+ * differ in how they frame LZ4 data.
+ **/
+__host__ __device__ void unlz4_step(unlz4_state_s *s)
+{
+  uint8_t *out = s->dst;
+  uint32_t n   = 0;
+
+  s->batch_dst = out;
+  while (n < UNLZ4_BATCH_SIZE && !s->error && !s->done) {
+    if (s->cur == s->block_end) {
+      if (!s->hadoop) {
+        s->done = 1;
+        break;
+      }
+      // Each Hadoop frame must decompress to its recorded size
+      if (out != s->frame_dst_end) {
+        s->error = 1;
+        break;
+      }
+      if (s->cur == s->end) {
+        s->done = 1;
+        break;
+      }
+      if (s->end - s->cur < 8) {
+        s->error = 1;
+        break;
+      }
+      uint32_t const frame_len = unlz4_be32(s->cur);
+      uint32_t const block_len = unlz4_be32(s->cur + 4);
+      s->cur += 8;
+      if (block_len > static_cast<size_t>(s->end - s->cur) ||
+          frame_len > static_cast<size_t>(s->dst_end - out) || block_len == 0) {
+        s->error = 1;
+        break;
+      }
+      s->block_end     = s->cur + block_len;
+      s->frame_dst_end = out + frame_len;
+      continue;
+    }
+    uint32_t const token    = *s->cur++;
+    uint32_t literal_length = token >> 4;
+    if (literal_length == 15 && !unlz4_extended_length(s, &literal_length)) {
+      s->error = 1;
+      break;
+    }
+    if (literal_length > static_cast<size_t>(s->block_end - s->cur) ||
+        literal_length > static_cast<size_t>(s->frame_dst_end - out)) {
+      s->error = 1;
+      break;
+    }
+    const uint8_t *literals = s->cur;
+    uint32_t match_length   = 0;
+    uint32_t offset         = 0;
+    s->cur += literal_length;
+    if (s->cur != s->block_end) {
+      // Every sequence but the last one of a block ends with a match
+      if (s->block_end - s->cur < 2) {
+        s->error = 1;
+        break;
+      }
+      offset = s->cur[0] | (s->cur[1] << 8);
+      s->cur += 2;
+      match_length = token & 0xf;
+      if (match_length == 15 && !unlz4_extended_length(s, &match_length)) {
+        s->error = 1;
+        break;
+      }
+      match_length += LZ4_MIN_MATCH;
+      if (offset == 0 || offset > (out - s->dst_base) + literal_length ||
+          static_cast<size_t>(literal_length) + match_length >
+            static_cast<size_t>(s->frame_dst_end - out)) {
+        s->error = 1;
+        break;
+      }
+    }
+    s->batch[n].literals       = literals;
+    s->batch[n].literal_length = literal_length;
+    s->batch[n].match_length   = match_length;
+    s->batch[n].offset         = offset;
+    out += literal_length + match_length;
+    n++;
+  }
+  if (s->error && s->hadoop) {
+    unlz4_start(s, 0);
+    return;
+  }
+  s->dst       = out;
+  s->batch_len = n;
+}
+
+/**
+ * @brief Initializes the decompressor state
+ **/
+__host__ __device__ void unlz4_init(unlz4_state_s *s,
+                                    const void *src,
+                                    size_t src_len,
+                                    void *dst,
+                                    size_t dst_len,
+                                    int32_t hadoop)
+{
+  s->src      = static_cast<const uint8_t *>(src);
+  s->end      = s->src + src_len;
+  s->dst_base = static_cast<uint8_t *>(dst);
+  s->dst_end  = s->dst_base + dst_len;
+  unlz4_start(s, hadoop && src_len != 0);
+}
+
+/**
+ * @brief Executes the literal and match copies of a batch with the warp
+ **/
+inline __device__ void unlz4_execute_batch(unlz4_state_s *s, uint32_t t)
+{
+  uint8_t *out       = s->batch_dst;
+  uint32_t const num = s->batch_len;
+  for (uint32_t i = 0; i < num; i++) {
+    const uint8_t *literals       = s->batch[i].literals;
+    uint32_t const literal_length = s->batch[i].literal_length;
+    uint32_t const match_length   = s->batch[i].match_length;
+    uint32_t const offset         = s->batch[i].offset;
+    for (uint32_t j = t; j < literal_length; j += 32) { out[j] = literals[j]; }
+    out += literal_length;
+    SYNCWARP();
+    if (match_length > 0) {
+      // Repeated patterns shorter than the match are read from before the match
+      const uint8_t *match = out - offset;
+      if (offset >= match_length) {
+        for (uint32_t j = t; j < match_length; j += 32) { out[j] = match[j]; }
+      } else {
+        for (uint32_t j = t; j < match_length; j += 32) { out[j] = match[j % offset]; }
+      }
+      out += match_length;
+      SYNCWARP();
+    }
+  }
+}
+
+/**
+ * @brief LZ4 decompression kernel
+ * See https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md
+ *
+ * blockDim {128,1,1}
+ *
+ * @param[in] inputs Source and destination information per block
+ * @param[out] outputs Decompression status per block
+ * @param[in] count Number of blocks to decompress
+ * @param[in] hadoop_framing Whether the blocks may use Hadoop framing
+ **/
+extern "C" __global__ void __launch_bounds__(UNLZ4_STREAMS_PER_BLOCK * 32) unlz4_kernel(
+  gpu_inflate_input_s *inputs, gpu_inflate_status_s *outputs, int count, int hadoop_framing)
+{
+  __shared__ __align__(16) unlz4_state_s state_g[UNLZ4_STREAMS_PER_BLOCK];
+
+  uint32_t const t       = threadIdx.x & 0x1f;
+  int const strm_id      = blockIdx.x * UNLZ4_STREAMS_PER_BLOCK + (threadIdx.x >> 5);
+  unlz4_state_s *const s = &state_g[threadIdx.x >> 5];
+
+  if (strm_id >= count) return;
+  if (t == 0) {
+    unlz4_init(s,
+               inputs[strm_id].srcDevice,
+               inputs[strm_id].srcSize,
+               inputs[strm_id].dstDevice,
+               inputs[strm_id].dstSize,
+               hadoop_framing);
+  }
+  SYNCWARP();
+  for (;;) {
+    if (t == 0) { unlz4_step(s); }
+    SYNCWARP();
+    unlz4_execute_batch(s, t);
+    if (s->error || (s->done && s->batch_len == 0)) break;
+    SYNCWARP();
+  }
+  if (t == 0) {
+    outputs[strm_id].bytes_written = (s->error) ? 0 : s->dst - s->dst_base;
+    outputs[strm_id].status        = s->error;
+    outputs[strm_id].reserved      = 0;
+  }
+}
+
+cudaError_t __host__ gpu_unlz4(gpu_inflate_input_s *inputs,
+                               gpu_inflate_status_s *outputs,
+                               int count,
+                               int hadoop_framing,
+                               cudaStream_t stream)
+{
+  dim3 dim_block(UNLZ4_STREAMS_PER_BLOCK * 32, 1);  // 1 warp per stream
+  dim3 dim_grid((count + UNLZ4_STREAMS_PER_BLOCK - 1) / UNLZ4_STREAMS_PER_BLOCK, 1);
+  if (count > 0) {
+    unlz4_kernel<<<dim_grid, dim_block, 0, stream>>>(inputs, outputs, count, hadoop_framing);
+  }
+  return cudaSuccess;
+}
+
+size_t __host__ cpu_unlz4(uint8_t *dst, size_t dst_len, const uint8_t *src, size_t src_len)
+{
+  auto s = std::make_unique<unlz4_state_s>();
+  unlz4_init(s.get(), src, src_len, dst, dst_len, 0);
+  for (;;) {
+    unlz4_step(s.get());
+    // Byte-wise copies, as matches may overlap their destination
+    uint8_t *out = s->batch_dst;
+    for (uint32_t i = 0; i < s->batch_len; i++) {
+      for (uint32_t j = 0; j < s->batch[i].literal_length; j++) {
+        *out++ = s->batch[i].literals[j];
+      }
+      for (uint32_t j = 0; j < s->batch[i].match_length; j++, out++) {
+        *out = *(out - s->batch[i].offset);
+      }
+    }
+    if (s->error || (s->done && s->batch_len == 0)) break;
+  }
+  return (s->error) ? 0 : s->dst - s->dst_base;
+}
+
+}  // namespace io
+}  // namespace cudf
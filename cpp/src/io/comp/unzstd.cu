@@ -0,0 +1,1098 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file unzstd.cu
+ * @brief ZSTD decompression
+ *
+ * Each stream is decoded by a single warp: the first lane parses the frames and decodes the
+ * entropy-coded sequences into small batches of literal and match copies, which are then executed
+ * by the whole warp. Huffman-coded literals are written to the end of the output buffer, and
+ * the four literal streams of a block are decoded by separate lanes.
+ *
+ * The same parser is used for host decompression of ORC metadata.
+ */
+
+#include <io/utilities/block_utils.cuh>
+#include "gpuinflate.h"
+#include "io_uncomp.h"
+#include "zstd_common.cuh"
+
+#include <memory>
+
+namespace cudf {
+namespace io {
+#define UNZSTD_BATCH_SIZE 32        // Sequences decoded per batch
+#define UNZSTD_STREAMS_PER_BLOCK 4  // One warp per stream
+
+/**
+ * @brief Parsing phase of a ZSTD stream
+ **/
+enum unzstd_phase_e {
+  UNZSTD_FRAME_HEADER = 0,  // Start of a frame, or end of input
+  UNZSTD_BLOCK_HEADER,      // Start of a block
+  UNZSTD_SEQUENCES_HEADER,  // Literals are decoded, sequence tables follow
+  UNZSTD_SEQUENCES,         // Decoding sequences
+  UNZSTD_FRAME_END,         // Optional frame checksum
+  UNZSTD_DONE,
+};
+
+/**
+ * @brief FSE decoding table entry
+ **/
+struct unzstd_fse_entry_s {
+  uint8_t symbol;    // Decoded symbol
+  uint8_t num_bits;  // Number of bits to read for the next state
+  uint16_t base;     // Next state before adding the bits read
+};
+
+/**
+ * @brief Literal and match copy of a decoded sequence
+ **/
+struct unzstd_copy_s {
+  const uint8_t *literals;  // Source of the literals, nullptr to repeat a single byte
+  uint32_t literal_length;  // Number of literal bytes
+  uint32_t match_length;    // Number of match bytes
+  uint32_t offset;          // Distance of the match source
+};
+
+/**
+ * @brief ZSTD decompressor state
+ **/
+struct unzstd_state_s {
+  const uint8_t *cur;        // Current position in the compressed data
+  const uint8_t *end;        // End of the compressed data
+  const uint8_t *block_end;  // End of the current compressed block
+  uint8_t *dst_base;         // Start of the decompressed data
+  uint8_t *dst;              // Output position after the current batch
+  uint8_t *dst_end;          // End of the output buffer
+  int32_t phase;             // Parsing phase (unzstd_phase_e)
+  int32_t error;             // Non-zero if the data is invalid
+  uint32_t last_block;       // Whether the current block is the last block of the frame
+  uint32_t has_checksum;     // Whether the current frame ends with a checksum
+
+  const uint8_t *literals;  // Next literal byte, nullptr if the literals repeat a single byte
+  uint32_t literals_left;   // Number of literals not consumed by sequences
+  uint32_t literal_byte;    // Repeated literal byte
+
+  uint32_t huf_bits;                           // Longest code of the Huffman table, 0 if none
+  uint32_t huf_pending;                        // Whether the literal streams need decoding
+  uint32_t num_huf_streams;                    // Number of Huffman-coded literal streams
+  const uint8_t *huf_src[4];                   // Huffman-coded literal streams
+  uint32_t huf_src_len[4];                     // Size of each literal stream
+  uint8_t *huf_dst[4];                         // Output of each literal stream
+  uint32_t huf_dst_len[4];                     // Number of literals in each stream
+  int32_t huf_error[4];                        // Non-zero if a literal stream is invalid
+  uint16_t huf_table[1 << zstd_huf_max_bits];  // (num_bits << 8) | symbol
+
+  const uint8_t *seq_src;  // Sequence bitstream
+  int64_t seq_bit_pos;     // Number of bits left in the sequence bitstream
+  uint32_t seqs_left;      // Number of sequences left in the block
+  uint32_t ll_state, of_state, ml_state;
+  int32_t ll_log, of_log, ml_log;  // Table logs, -1 if there is no previous table
+  uint32_t rep[3];                 // Repeat offsets
+
+  uint8_t *batch_dst;                          // Output position of the first copy of the batch
+  uint32_t batch_len;                          // Number of copies in the batch
+  unzstd_copy_s batch[UNZSTD_BATCH_SIZE + 1];  // Sequences, and the last literals of a block
+
+  unzstd_fse_entry_s ll_table[1 << zstd_ll_max_log];
+  unzstd_fse_entry_s of_table[1 << zstd_of_max_log];
+  unzstd_fse_entry_s ml_table[1 << zstd_ml_max_log];
+  unzstd_fse_entry_s huf_weight_table[1 << zstd_huf_max_log];
+};
+
+/**
+ * @brief Reads up to 32 bits at a bit position of a byte stream, bits before the start of the
+ * stream read as zero
+ *
+ * @param src Start of the stream
+ * @param pos Bit position of the least significant bit to read
+ * @param num_bits Number of bits to read
+ **/
+inline __host__ __device__ uint32_t unzstd_bits(const uint8_t *src, int64_t pos, uint32_t num_bits)
+{
+  uint32_t shift = 0;
+  if (pos < 0) {
+    if (pos + num_bits <= 0) return 0;
+    shift = static_cast<uint32_t>(-pos);
+    num_bits -= shift;
+    pos = 0;
+  }
+  if (num_bits == 0) return 0;
+  const uint8_t *p     = src + (pos >> 3);
+  uint32_t const bit   = pos & 7;
+  uint32_t const bytes = (bit + num_bits + 7) >> 3;
+  uint64_t v           = 0;
+  for (uint32_t i = 0; i < bytes; i++) { v |= static_cast<uint64_t>(p[i]) << (i * 8); }
+  return static_cast<uint32_t>(((v >> bit) & ((1ull << num_bits) - 1)) << shift);
+}
+
+/**
+ * @brief Returns the number of bits of a backward bitstream, excluding its end marker
+ **/
+inline __host__ __device__ int64_t unzstd_bitstream_size(const uint8_t *src, uint32_t len)
+{
+  if (len == 0 || src[len - 1] == 0) return -1;
+  return static_cast<int64_t>(len - 1) * 8 + zstd_highbit(src[len - 1]);
+}
+
+/**
+ * @brief Decodes the normalized counts of an FSE table description
+ *
+ * @param[in] src Table description
+ * @param[in] len Maximum size of the description
+ * @param[out] norm Normalized counts
+ * @param[in] max_symbol Largest valid symbol
+ * @param[in] max_log Largest valid accuracy log
+ * @param[out] log Accuracy log
+ * @param[out] num_symbols Number of symbols with a normalized count
+ *
+ * @return Size of the description in bytes, zero if invalid
+ **/
+__host__ __device__ uint32_t unzstd_fse_header(const uint8_t *src,
+                                               uint32_t len,
+                                               int16_t *norm,
+                                               uint32_t max_symbol,
+                                               uint32_t max_log,
+                                               uint32_t *log,
+                                               uint32_t *num_symbols)
+{
+  int64_t const total_bits = static_cast<int64_t>(len) * 8;
+  if (len == 0) return 0;
+  uint32_t const accuracy_log = (src[0] & 0xf) + 5;
+  if (accuracy_log > max_log) return 0;
+  // Reads past the end of the description are zero, and detected below
+  auto peek = [&](int64_t pos, uint32_t num_bits) {
+    uint32_t v = 0;
+    for (uint32_t i = 0; i < num_bits; i++) {
+      int64_t const p = pos + i;
+      if (p < total_bits) { v |= ((src[p >> 3] >> (p & 7)) & 1) << i; }
+    }
+    return v;
+  };
+  int64_t bit_pos   = 4;
+  int32_t remaining = (1 << accuracy_log) + 1;
+  uint32_t symbol   = 0;
+  while (remaining > 1 && symbol <= max_symbol) {
+    uint32_t const num_bits   = zstd_highbit(remaining) + 1;
+    uint32_t val              = peek(bit_pos, num_bits);
+    uint32_t const lower_mask = (1u << (num_bits - 1)) - 1;
+    uint32_t const threshold  = (1u << num_bits) - 1 - remaining;
+    if ((val & lower_mask) < threshold) {
+      val &= lower_mask;
+      bit_pos += num_bits - 1;
+    } else {
+      if (val > lower_mask) { val -= threshold; }
+      bit_pos += num_bits;
+    }
+    int32_t const count = static_cast<int32_t>(val) - 1;
+    remaining -= (count < 0) ? -count : count;
+    norm[symbol++] = count;
+    if (count == 0) {
+      // Runs of zero counts are coded as 2-bit repeat flags
+      uint32_t repeat;
+      do {
+        repeat = peek(bit_pos, 2);
+        bit_pos += 2;
+        for (uint32_t i = 0; i < repeat && symbol <= max_symbol; i++) { norm[symbol++] = 0; }
+      } while (repeat == 3 && bit_pos <= total_bits);
+    }
+    if (bit_pos > total_bits) return 0;
+  }
+  if (remaining != 1 || bit_pos > total_bits) return 0;
+  *log         = accuracy_log;
+  *num_symbols = symbol;
+  return static_cast<uint32_t>((bit_pos + 7) >> 3);
+}
+
+/**
+ * @brief Builds an FSE decoding table from normalized counts
+ *
+ * @return false if the counts are invalid
+ **/
+__host__ __device__ bool unzstd_build_fse_table(unzstd_fse_entry_s *table,
+                                                const int16_t *norm,
+                                                uint32_t num_symbols,
+                                                uint32_t log)
+{
+  uint32_t const size = 1u << log;
+  uint32_t const mask = size - 1;
+  uint32_t const step = (size >> 1) + (size >> 3) + 3;
+  uint32_t high       = size;
+  uint16_t next_state[zstd_fse_max_symbols];
+
+  if (num_symbols > zstd_fse_max_symbols) return false;
+  // Symbols with "less than 1" probability take the last positions
+  for (uint32_t s = 0; s < num_symbols; s++) {
+    if (norm[s] == -1) {
+      if (high == 0) return false;
+      table[--high].symbol = s;
+      next_state[s]        = 1;
+    }
+  }
+  uint32_t pos = 0;
+  for (uint32_t s = 0; s < num_symbols; s++) {
+    if (norm[s] <= 0) continue;
+    next_state[s] = norm[s];
+    for (int32_t i = 0; i < norm[s]; i++) {
+      table[pos].symbol = s;
+      do {
+        pos = (pos + step) & mask;
+      } while (pos >= high);
+    }
+  }
+  if (pos != 0) return false;
+  for (uint32_t i = 0; i < size; i++) {
+    uint32_t const state    = next_state[table[i].symbol]++;
+    uint32_t const num_bits = log - zstd_highbit(state);
+    table[i].num_bits       = num_bits;
+    table[i].base           = (state << num_bits) - size;
+  }
+  return true;
+}
+
+/**
+ * @brief Builds the Huffman decoding table from the symbol weights
+ *
+ * @param[out] table Decoding table, indexed by the next `max_bits` bits of the stream
+ * @param[in] weights Weights of all symbols but the last
+ * @param[in] num_weights Number of weights
+ *
+ * @return Longest code length, zero if the weights are invalid
+ **/
+__host__ __device__ uint32_t unzstd_build_huffman_table(uint16_t *table,
+                                                        const uint8_t *weights,
+                                                        uint32_t num_weights)
+{
+  uint32_t weight_sum = 0;
+  for (uint32_t i = 0; i < num_weights; i++) {
+    if (weights[i] > zstd_huf_max_bits) return 0;
+    if (weights[i] > 0) { weight_sum += 1u << (weights[i] - 1); }
+  }
+  if (weight_sum == 0) return 0;
+  // The weight of the last symbol completes the sum to the next power of two
+  uint32_t const max_bits = zstd_highbit(weight_sum) + 1;
+  uint32_t const leftover = (1u << max_bits) - weight_sum;
+  if (max_bits > zstd_huf_max_bits || (leftover & (leftover - 1)) != 0) return 0;
+  uint32_t const last_weight = zstd_highbit(leftover) + 1;
+
+  // Longest codes come first in the table, then symbols in increasing order
+  uint32_t rank_count[zstd_huf_max_bits + 1] = {0};
+  for (uint32_t i = 0; i <= num_weights; i++) {
+    uint32_t const w = (i < num_weights) ? weights[i] : last_weight;
+    if (w > 0) { rank_count[max_bits + 1 - w]++; }
+  }
+  uint32_t rank_start[zstd_huf_max_bits + 1];
+  rank_start[max_bits] = 0;
+  for (uint32_t bits = max_bits; bits > 1; bits--) {
+    rank_start[bits - 1] = rank_start[bits] + (rank_count[bits] << (max_bits - bits));
+  }
+  for (uint32_t i = 0; i <= num_weights; i++) {
+    uint32_t const w = (i < num_weights) ? weights[i] : last_weight;
+    if (w == 0) continue;
+    uint32_t const bits  = max_bits + 1 - w;
+    uint32_t const code  = rank_start[bits];
+    uint32_t const count = 1u << (w - 1);
+    for (uint32_t j = 0; j < count; j++) { table[code + j] = (bits << 8) | i; }
+    rank_start[bits] += count;
+  }
+  return max_bits;
+}
+
+/**
+ * @brief Decodes a Huffman-coded literal stream
+ *
+ * @return Non-zero if the stream is invalid
+ **/
+__host__ __device__ int32_t unzstd_huffman_stream(const uint16_t *table,
+                                                  uint32_t max_bits,
+                                                  const uint8_t *src,
+                                                  uint32_t len,
+                                                  uint8_t *dst,
+                                                  uint32_t count)
+{
+  int64_t pos = unzstd_bitstream_size(src, len);
+  if (pos < 0) return 1;
+  uint32_t const mask = (1u << max_bits) - 1;
+  pos -= max_bits;
+  uint32_t state = unzstd_bits(src, pos, max_bits);
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t const entry    = table[state];
+    uint32_t const num_bits = entry >> 8;
+    dst[i]                  = static_cast<uint8_t>(entry);
+    pos -= num_bits;
+    state = ((state << num_bits) | unzstd_bits(src, pos, num_bits)) & mask;
+  }
+  // The stream must be exactly consumed
+  return (pos == -static_cast<int64_t>(max_bits)) ? 0 : 1;
+}
+
+/**
+ * @brief Decodes the Huffman weights of the literals (tree description)
+ *
+ * @return Size of the tree description in bytes, zero if invalid
+ **/
+__host__ __device__ uint32_t unzstd_huffman_tree(unzstd_state_s *s,
+                                                 const uint8_t *src,
+                                                 uint32_t len)
+{
+  uint8_t weights[256];
+  uint32_t num_weights = 0;
+  if (len < 1) return 0;
+  uint32_t const header = src[0];
+  if (header < 128) {
+    // FSE-compressed weights, decoded with two interleaved states
+    int16_t norm[zstd_fse_max_symbols];
+    uint32_t log, num_symbols;
+    if (header + 1 > len) return 0;
+    uint32_t const table_len = unzstd_fse_header(
+      src + 1, header, norm, zstd_huf_max_bits, zstd_huf_max_log, &log, &num_symbols);
+    if (table_len == 0 || !unzstd_build_fse_table(s->huf_weight_table, norm, num_symbols, log)) {
+      return 0;
+    }
+    const uint8_t *stream = src + 1 + table_len;
+    int64_t pos           = unzstd_bitstream_size(stream, header - table_len);
+    if (table_len >= header || pos < 0) return 0;
+    const unzstd_fse_entry_s *table = s->huf_weight_table;
+    pos -= log;
+    uint32_t state1 = unzstd_bits(stream, pos, log);
+    pos -= log;
+    uint32_t state2 = unzstd_bits(stream, pos, log);
+    for (;;) {
+      if (num_weights + 2 > 255) return 0;
+      weights[num_weights++] = table[state1].symbol;
+      pos -= table[state1].num_bits;
+      state1 = table[state1].base + unzstd_bits(stream, pos, table[state1].num_bits);
+      if (pos < 0) {
+        weights[num_weights++] = table[state2].symbol;
+        break;
+      }
+      weights[num_weights++] = table[state2].symbol;
+      pos -= table[state2].num_bits;
+      state2 = table[state2].base + unzstd_bits(stream, pos, table[state2].num_bits);
+      if (pos < 0) {
+        weights[num_weights++] = table[state1].symbol;
+        break;
+      }
+    }
+    len = header + 1;
+  } else {
+    // 4-bit weights
+    num_weights = header - 127;
+    if (1 + (num_weights + 1) / 2 > len) return 0;
+    for (uint32_t i = 0; i < num_weights; i++) {
+      uint8_t const b = src[1 + i / 2];
+      weights[i]      = (i & 1) ? (b & 0xf) : (b >> 4);
+    }
+    len = 1 + (num_weights + 1) / 2;
+  }
+  s->huf_bits = unzstd_build_huffman_table(s->huf_table, weights, num_weights);
+  return (s->huf_bits != 0) ? len : 0;
+}
+
+/**
+ * @brief Decodes the literals section of a compressed block
+ *
+ * Raw literals are used in place. Huffman-coded literals are decoded to the end of the output
+ * buffer, which the output only reaches once the literals have been consumed.
+ **/
+__host__ __device__ void unzstd_literals(unzstd_state_s *s)
+{
+  const uint8_t *cur = s->cur;
+  uint32_t avail     = static_cast<uint32_t>(s->block_end - cur);
+  if (avail < 1) {
+    s->error = 1;
+    return;
+  }
+  uint32_t const type        = cur[0] & 3;
+  uint32_t const size_format = (cur[0] >> 2) & 3;
+  s->num_huf_streams         = 0;
+  if (type < 2) {
+    // Raw or RLE literals
+    uint32_t header_len, size;
+    if (!(size_format & 1)) {
+      header_len = 1;
+      size       = cur[0] >> 3;
+    } else {
+      header_len = (size_format == 1) ? 2 : 3;
+      if (avail < header_len) {
+        s->error = 1;
+        return;
+      }
+      size = (cur[0] >> 4) | (cur[1] << 4);
+      if (size_format == 3) { size |= cur[2] << 12; }
+    }
+    cur += header_len;
+    avail -= header_len;
+    if (type == 0) {
+      if (avail < size) {
+        s->error = 1;
+        return;
+      }
+      s->literals = cur;
+      cur += size;
+    } else {
+      if (avail < 1) {
+        s->error = 1;
+        return;
+      }
+      s->literals     = nullptr;
+      s->literal_byte = cur[0];
+      cur += 1;
+    }
+    s->literals_left = size;
+    s->cur           = cur;
+    return;
+  }
+
+  // Huffman-coded literals, with a new table or the previous one (treeless)
+  uint32_t const num_streams = (size_format == 0) ? 1 : 4;
+  uint32_t const header_len  = (size_format < 2) ? 3 : size_format + 2;
+  if (avail < header_len) {
+    s->error = 1;
+    return;
+  }
+  uint32_t lhc = cur[0] | (cur[1] << 8) | (cur[2] << 16);
+  uint32_t size, comp_size;
+  if (header_len == 3) {
+    size      = (lhc >> 4) & 0x3ff;
+    comp_size = (lhc >> 14) & 0x3ff;
+  } else if (header_len == 4) {
+    lhc |= cur[3] << 24;
+    size      = (lhc >> 4) & 0x3fff;
+    comp_size = lhc >> 18;
+  } else {
+    lhc |= cur[3] << 24;
+    size      = (lhc >> 4) & 0x3ffff;
+    comp_size = (lhc >> 22) | (cur[4] << 10);
+  }
+  cur += header_len;
+  avail -= header_len;
+  if (comp_size > avail || size > zstd_max_block_size ||
+      size > static_cast<size_t>(s->dst_end - s->dst)) {
+    s->error = 1;
+    return;
+  }
+  const uint8_t *const literals_end = cur + comp_size;
+  if (type == 2) {
+    uint32_t const tree_len = unzstd_huffman_tree(s, cur, comp_size);
+    if (tree_len == 0) {
+      s->error = 1;
+      return;
+    }
+    cur += tree_len;
+  } else if (s->huf_bits == 0) {
+    s->error = 1;
+    return;
+  }
+  uint8_t *const dst = s->dst_end - size;
+  if (num_streams == 1) {
+    s->huf_src[0]     = cur;
+    s->huf_src_len[0] = static_cast<uint32_t>(literals_end - cur);
+    s->huf_dst[0]     = dst;
+    s->huf_dst_len[0] = size;
+  } else {
+    // 4 streams, with a jump table of the sizes of the first three
+    uint32_t const segment = (size + 3) / 4;
+    if (literals_end - cur < 6 || size < 3 * segment) {
+      s->error = 1;
+      return;
+    }
+    uint32_t const len0 = cur[0] | (cur[1] << 8);
+    uint32_t const len1 = cur[2] | (cur[3] << 8);
+    uint32_t const len2 = cur[4] | (cur[5] << 8);
+    cur += 6;
+    if (len0 + len1 + len2 > literals_end - cur) {
+      s->error = 1;
+      return;
+    }
+    s->huf_src_len[0] = len0;
+    s->huf_src_len[1] = len1;
+    s->huf_src_len[2] = len2;
+    s->huf_src_len[3] = static_cast<uint32_t>(literals_end - cur) - len0 - len1 - len2;
+    for (uint32_t i = 0; i < 4; i++) {
+      s->huf_src[i]     = cur;
+      s->huf_dst[i]     = dst + i * segment;
+      s->huf_dst_len[i] = (i < 3) ? segment : size - 3 * segment;
+      cur += s->huf_src_len[i];
+    }
+  }
+  s->num_huf_streams = num_streams;
+  s->huf_pending     = 1;
+  s->literals        = dst;
+  s->literals_left   = size;
+  s->cur             = literals_end;
+}
+
+/**
+ * @brief Sets up the decoding table of a sequence symbol type
+ *
+ * @return Size of the table description in bytes, -1 if invalid
+ **/
+__host__ __device__ int32_t unzstd_sequence_table(unzstd_state_s *s,
+                                                  zstd_symbol_type type,
+                                                  uint32_t mode,
+                                                  const uint8_t *src,
+                                                  uint32_t len)
+{
+  unzstd_fse_entry_s *table;
+  int32_t *table_log;
+  uint32_t max_symbol, max_log;
+  switch (type) {
+    case ZSTD_LITERAL_LENGTH:
+      table      = s->ll_table;
+      table_log  = &s->ll_log;
+      max_symbol = zstd_ll_max_code;
+      max_log    = zstd_ll_max_log;
+      break;
+    case ZSTD_OFFSET:
+      table      = s->of_table;
+      table_log  = &s->of_log;
+      max_symbol = zstd_of_max_code;
+      max_log    = zstd_of_max_log;
+      break;
+    default:
+      table      = s->ml_table;
+      table_log  = &s->ml_log;
+      max_symbol = zstd_ml_max_code;
+      max_log    = zstd_ml_max_log;
+      break;
+  }
+  int16_t norm[zstd_fse_max_symbols];
+  uint32_t log, num_symbols;
+  switch (mode) {
+    case 0:
+      // Predefined distribution
+      num_symbols = zstd_default_distribution(type, norm, &log);
+      unzstd_build_fse_table(table, norm, num_symbols, log);
+      *table_log = log;
+      return 0;
+    case 1:
+      // Single symbol
+      if (len < 1 || src[0] > max_symbol) return -1;
+      table[0].symbol   = src[0];
+      table[0].num_bits = 0;
+      table[0].base     = 0;
+      *table_log        = 0;
+      return 1;
+    case 2: {
+      uint32_t const table_len =
+        unzstd_fse_header(src, len, norm, max_symbol, max_log, &log, &num_symbols);
+      if (table_len == 0 || !unzstd_build_fse_table(table, norm, num_symbols, log)) return -1;
+      *table_log = log;
+      return table_len;
+    }
+    default:
+      // Table of the previous block
+      return (*table_log >= 0) ? 0 : -1;
+  }
+}
+
+/**
+ * @brief Decodes the sequences section header and initializes the sequence bitstream
+ **/
+__host__ __device__ void unzstd_sequences_header(unzstd_state_s *s)
+{
+  const uint8_t *cur = s->cur;
+  const uint8_t *end = s->block_end;
+  uint32_t num_seqs;
+  if (end - cur < 1) {
+    s->error = 1;
+    return;
+  }
+  if (cur[0] < 128) {
+    num_seqs = cur[0];
+    cur += 1;
+  } else if (cur[0] < 255) {
+    if (end - cur < 2) {
+      s->error = 1;
+      return;
+    }
+    num_seqs = ((cur[0] - 128) << 8) + cur[1];
+    cur += 2;
+  } else {
+    if (end - cur < 3) {
+      s->error = 1;
+      return;
+    }
+    num_seqs = cur[1] + (cur[2] << 8) + 0x7f00;
+    cur += 3;
+  }
+  s->seqs_left = num_seqs;
+  if (num_seqs != 0) {
+    if (end - cur < 1 || (cur[0] & 3) != 0) {
+      s->error = 1;
+      return;
+    }
+    uint32_t const modes = *cur++;
+    // Tables are described in literals length, offset, match length order
+    for (int type = ZSTD_LITERAL_LENGTH; type <= ZSTD_MATCH_LENGTH; type++) {
+      uint32_t const mode = (modes >> (6 - 2 * type)) & 3;
+      int32_t const len   = unzstd_sequence_table(
+        s, static_cast<zstd_symbol_type>(type), mode, cur, static_cast<uint32_t>(end - cur));
+      if (len < 0) {
+        s->error = 1;
+        return;
+      }
+      cur += len;
+    }
+    int64_t pos = unzstd_bitstream_size(cur, static_cast<uint32_t>(end - cur));
+    if (pos < 0) {
+      s->error = 1;
+      return;
+    }
+    pos -= s->ll_log;
+    s->ll_state = unzstd_bits(cur, pos, s->ll_log);
+    pos -= s->of_log;
+    s->of_state = unzstd_bits(cur, pos, s->of_log);
+    pos -= s->ml_log;
+    s->ml_state    = unzstd_bits(cur, pos, s->ml_log);
+    s->seq_src     = cur;
+    s->seq_bit_pos = pos;
+  } else if (cur != end) {
+    s->error = 1;
+    return;
+  }
+  s->cur = end;
+}
+
+/**
+ * @brief Decodes a batch of sequences, followed by the last literals of the block once all
+ * sequences are decoded
+ **/
+__host__ __device__ void unzstd_sequences(unzstd_state_s *s)
+{
+  const uint8_t *src = s->seq_src;
+  int64_t pos        = s->seq_bit_pos;
+  uint8_t *out       = s->dst;
+  uint32_t n         = 0;
+
+  s->batch_dst = out;
+  while (n < UNZSTD_BATCH_SIZE && s->seqs_left > 0) {
+    unzstd_fse_entry_s const ll = s->ll_table[s->ll_state];
+    unzstd_fse_entry_s const of = s->of_table[s->of_state];
+    unzstd_fse_entry_s const ml = s->ml_table[s->ml_state];
+    if (ll.symbol > zstd_ll_max_code || ml.symbol > zstd_ml_max_code) {
+      s->error = 1;
+      return;
+    }
+    // Extra bits are read in offset, match length, literals length order
+    pos -= of.symbol;
+    uint32_t const offset_value = (1u << of.symbol) + unzstd_bits(src, pos, of.symbol);
+    uint32_t const ml_bits      = zstd_ml_bits(ml.symbol);
+    pos -= ml_bits;
+    uint32_t const match_length = zstd_ml_baseline(ml.symbol) + unzstd_bits(src, pos, ml_bits);
+    uint32_t const ll_bits      = zstd_ll_bits(ll.symbol);
+    pos -= ll_bits;
+    uint32_t const literal_length = zstd_ll_baseline(ll.symbol) + unzstd_bits(src, pos, ll_bits);
+
+    // Offset values 1 to 3 select a repeat offset, shifted by one if there are no literals
+    uint32_t offset;
+    if (offset_value > 3) {
+      offset    = offset_value - 3;
+      s->rep[2] = s->rep[1];
+      s->rep[1] = s->rep[0];
+      s->rep[0] = offset;
+    } else {
+      uint32_t const idx = offset_value - 1 + (literal_length == 0);
+      if (idx == 0) {
+        offset = s->rep[0];
+      } else {
+        offset = (idx < 3) ? s->rep[idx] : s->rep[0] - 1;
+        if (idx > 1) { s->rep[2] = s->rep[1]; }
+        s->rep[1] = s->rep[0];
+        s->rep[0] = offset;
+      }
+    }
+
+    // States are updated in literals length, match length, offset order
+    if (--s->seqs_left > 0) {
+      pos -= ll.num_bits;
+      s->ll_state = ll.base + unzstd_bits(src, pos, ll.num_bits);
+      pos -= ml.num_bits;
+      s->ml_state = ml.base + unzstd_bits(src, pos, ml.num_bits);
+      pos -= of.num_bits;
+      s->of_state = of.base + unzstd_bits(src, pos, of.num_bits);
+    }
+
+    // The remaining literals must still fit in the output after the copy
+    size_t const avail = s->dst_end - out;
+    if (literal_length > s->literals_left ||
+        static_cast<size_t>(literal_length) + match_length + (s->literals_left - literal_length) >
+          avail ||
+        offset == 0 || offset > (out - s->dst_base) + literal_length) {
+      s->error = 1;
+      return;
+    }
+    s->batch[n].literals       = s->literals;
+    s->batch[n].literal_length = literal_length;
+    s->batch[n].match_length   = match_length;
+    s->batch[n].offset         = offset;
+    if (s->literals) { s->literals += literal_length; }
+    s->literals_left -= literal_length;
+    out += literal_length + match_length;
+    n++;
+  }
+  if (s->seqs_left == 0) {
+    // The bitstream must be exactly consumed
+    if ((s->seq_src && pos != 0) || s->literals_left > static_cast<size_t>(s->dst_end - out)) {
+      s->error = 1;
+      return;
+    }
+    s->batch[n].literals       = s->literals;
+    s->batch[n].literal_length = s->literals_left;
+    s->batch[n].match_length   = 0;
+    s->batch[n].offset         = 0;
+    out += s->literals_left;
+    s->literals_left = 0;
+    s->seq_src       = nullptr;
+    n++;
+    s->phase = (s->last_block) ? UNZSTD_FRAME_END : UNZSTD_BLOCK_HEADER;
+  }
+  s->seq_bit_pos = pos;
+  s->dst         = out;
+  s->batch_len   = n;
+}
+
+/**
+ * @brief Decodes a frame header, or skips a skippable frame
+ **/
+__host__ __device__ void unzstd_frame_header(unzstd_state_s *s)
+{
+  const uint8_t *cur = s->cur;
+  size_t const avail = s->end - cur;
+  if (avail == 0) {
+    s->phase = UNZSTD_DONE;
+    return;
+  }
+  if (avail < 5) {
+    s->error = 1;
+    return;
+  }
+  uint32_t const magic = cur[0] | (cur[1] << 8) | (cur[2] << 16) | (cur[3] << 24);
+  if ((magic & ~0xfu) == zstd_skippable_magic) {
+    if (avail < 8) {
+      s->error = 1;
+      return;
+    }
+    uint32_t const len = cur[4] | (cur[5] << 8) | (cur[6] << 16) | (cur[7] << 24);
+    if (len > avail - 8) {
+      s->error = 1;
+      return;
+    }
+    s->cur = cur + 8 + len;
+    return;
+  }
+  uint32_t const descriptor     = cur[4];
+  uint32_t const fcs_flag       = descriptor >> 6;
+  uint32_t const single_segment = (descriptor >> 5) & 1;
+  uint32_t const dict_flag      = descriptor & 3;
+  uint32_t const dict_len       = (dict_flag == 3) ? 4 : dict_flag;
+  uint32_t const fcs_len        = (fcs_flag == 0) ? single_segment : (1u << fcs_flag);
+  uint32_t const header_len     = 5 + !single_segment + dict_len + fcs_len;
+  if (magic != zstd_magic || (descriptor & 0x08) != 0 || avail < header_len) {
+    s->error = 1;
+    return;
+  }
+  // Dictionaries are not supported
+  const uint8_t *dict_id = cur + 5 + !single_segment;
+  for (uint32_t i = 0; i < dict_len; i++) {
+    if (dict_id[i] != 0) {
+      s->error = 1;
+      return;
+    }
+  }
+  s->has_checksum = (descriptor >> 2) & 1;
+  s->cur          = cur + header_len;
+  s->huf_bits     = 0;
+  s->ll_log       = -1;
+  s->of_log       = -1;
+  s->ml_log       = -1;
+  s->rep[0]       = 1;
+  s->rep[1]       = 4;
+  s->rep[2]       = 8;
+  s->phase        = UNZSTD_BLOCK_HEADER;
+}
+
+/**
+ * @brief Decodes a block header; raw and RLE blocks are output as a single copy
+ **/
+__host__ __device__ void unzstd_block_header(unzstd_state_s *s)
+{
+  const uint8_t *cur = s->cur;
+  if (s->end - cur < 3) {
+    s->error = 1;
+    return;
+  }
+  uint32_t const header = cur[0] | (cur[1] << 8) | (cur[2] << 16);
+  uint32_t const type   = (header >> 1) & 3;
+  uint32_t const size   = header >> 3;
+  size_t const avail    = s->end - cur - 3;
+  cur += 3;
+  s->last_block = header & 1;
+  if (size > zstd_max_block_size) {
+    s->error = 1;
+    return;
+  }
+  if (type == 0 || type == 1) {
+    // Raw or RLE block
+    uint32_t const src_len = (type == 0) ? size : 1;
+    if (src_len > avail || size > static_cast<size_t>(s->dst_end - s->dst)) {
+      s->error = 1;
+      return;
+    }
+    if (type == 1) { s->literal_byte = cur[0]; }
+    s->batch[0].literals       = (type == 0) ? cur : nullptr;
+    s->batch[0].literal_length = size;
+    s->batch[0].match_length   = 0;
+    s->batch[0].offset         = 0;
+    s->batch_dst               = s->dst;
+    s->batch_len               = 1;
+    s->dst += size;
+    s->cur   = cur + src_len;
+    s->phase = (s->last_block) ? UNZSTD_FRAME_END : UNZSTD_BLOCK_HEADER;
+  } else if (type == 2) {
+    if (size > avail) {
+      s->error = 1;
+      return;
+    }
+    s->cur       = cur;
+    s->block_end = cur + size;
+    unzstd_literals(s);
+    s->phase = UNZSTD_SEQUENCES_HEADER;
+  } else {
+    s->error = 1;
+  }
+}
+
+/**
+ * @brief Advances the decompressor until there is a batch of copies, or literal streams to
+ * decode, or the end of the data
+ **/
+__host__ __device__ void unzstd_step(unzstd_state_s *s)
+{
+  s->batch_len = 0;
+  if (s->huf_pending) {
+    s->huf_pending = 0;
+    for (uint32_t i = 0; i < s->num_huf_streams; i++) { s->error |= s->huf_error[i]; }
+  }
+  while (!s->error && s->phase != UNZSTD_DONE && s->batch_len == 0 && !s->huf_pending) {
+    switch (s->phase) {
+      case UNZSTD_FRAME_HEADER: unzstd_frame_header(s); break;
+      case UNZSTD_BLOCK_HEADER: unzstd_block_header(s); break;
+      case UNZSTD_SEQUENCES_HEADER:
+        unzstd_sequences_header(s);
+        s->phase = UNZSTD_SEQUENCES;
+        break;
+      case UNZSTD_SEQUENCES: unzstd_sequences(s); break;
+      case UNZSTD_FRAME_END:
+        if (s->has_checksum) {
+          if (s->end - s->cur < 4) {
+            s->error = 1;
+            break;
+          }
+          s->cur += 4;
+        }
+        s->phase = UNZSTD_FRAME_HEADER;
+        break;
+      default: s->error = 1; break;
+    }
+  }
+}
+
+/**
+ * @brief Initializes the decompressor state
+ **/
+__host__ __device__ void unzstd_init(
+  unzstd_state_s *s, const void *src, size_t src_len, void *dst, size_t dst_len)
+{
+  s->cur             = static_cast<const uint8_t *>(src);
+  s->end             = s->cur + src_len;
+  s->block_end       = s->cur;
+  s->dst_base        = static_cast<uint8_t *>(dst);
+  s->dst             = s->dst_base;
+  s->dst_end         = s->dst_base + dst_len;
+  s->phase           = UNZSTD_FRAME_HEADER;
+  s->error           = 0;
+  s->last_block      = 0;
+  s->has_checksum    = 0;
+  s->literals        = nullptr;
+  s->literals_left   = 0;
+  s->huf_bits        = 0;
+  s->huf_pending     = 0;
+  s->num_huf_streams = 0;
+  s->seq_src         = nullptr;
+  s->seqs_left       = 0;
+  s->batch_len       = 0;
+}
+
+/**
+ * @brief Copies bytes with the warp; overlapping copies are done in chunks no larger than the
+ * distance between source and destination
+ **/
+inline __device__ void unzstd_warp_copy(uint8_t *dst,
+                                        const uint8_t *src,
+                                        uint32_t len,
+                                        uint32_t t)
+{
+  uintptr_t const d    = reinterpret_cast<uintptr_t>(dst);
+  uintptr_t const s    = reinterpret_cast<uintptr_t>(src);
+  uintptr_t const dist = (d > s) ? d - s : s - d;
+  if (dist >= len) {
+    for (uint32_t i = t; i < len; i += 32) { dst[i] = src[i]; }
+  } else {
+    uint32_t const step = min(static_cast<uint32_t>(dist), 32u);
+    for (uint32_t i = 0; i < len; i += step) {
+      if (t < step && i + t < len) { dst[i + t] = src[i + t]; }
+      SYNCWARP();
+    }
+  }
+}
+
+/**
+ * @brief Executes the literal and match copies of a batch with the warp
+ **/
+inline __device__ void unzstd_execute_batch(unzstd_state_s *s, uint32_t t)
+{
+  uint8_t *out       = s->batch_dst;
+  uint32_t const num = s->batch_len;
+  for (uint32_t i = 0; i < num; i++) {
+    const uint8_t *literals       = s->batch[i].literals;
+    uint32_t const literal_length = s->batch[i].literal_length;
+    uint32_t const match_length   = s->batch[i].match_length;
+    uint32_t const offset         = s->batch[i].offset;
+    if (literals) {
+      unzstd_warp_copy(out, literals, literal_length, t);
+    } else {
+      uint8_t const b = s->literal_byte;
+      for (uint32_t j = t; j < literal_length; j += 32) { out[j] = b; }
+    }
+    out += literal_length;
+    SYNCWARP();
+    if (match_length > 0) {
+      // Repeated patterns shorter than the match are read from before the match
+      const uint8_t *match = out - offset;
+      if (offset >= match_length) {
+        for (uint32_t j = t; j < match_length; j += 32) { out[j] = match[j]; }
+      } else {
+        for (uint32_t j = t; j < match_length; j += 32) { out[j] = match[j % offset]; }
+      }
+      out += match_length;
+      SYNCWARP();
+    }
+  }
+}
+
+/**
+ * @brief ZSTD decompression kernel
+ * See https://tools.ietf.org/html/rfc8878
+ *
+ * blockDim {128,1,1}
+ *
+ * @param[in] inputs Source and destination information per block
+ * @param[out] outputs Decompression status per block
+ * @param[in] count Number of blocks to decompress
+ **/
+extern "C" __global__ void __launch_bounds__(UNZSTD_STREAMS_PER_BLOCK * 32)
+  unzstd_kernel(gpu_inflate_input_s *inputs, gpu_inflate_status_s *outputs, int count)
+{
+  __shared__ __align__(16) unzstd_state_s state_g[UNZSTD_STREAMS_PER_BLOCK];
+
+  uint32_t const t        = threadIdx.x & 0x1f;
+  int const strm_id       = blockIdx.x * UNZSTD_STREAMS_PER_BLOCK + (threadIdx.x >> 5);
+  unzstd_state_s *const s = &state_g[threadIdx.x >> 5];
+
+  if (strm_id >= count) return;
+  if (t == 0) {
+    unzstd_init(s,
+                inputs[strm_id].srcDevice,
+                inputs[strm_id].srcSize,
+                inputs[strm_id].dstDevice,
+                inputs[strm_id].dstSize);
+  }
+  SYNCWARP();
+  for (;;) {
+    if (t == 0) { unzstd_step(s); }
+    SYNCWARP();
+    if (s->error || s->phase == UNZSTD_DONE) break;
+    if (s->huf_pending) {
+      if (t < s->num_huf_streams) {
+        s->huf_error[t] = unzstd_huffman_stream(s->huf_table,
+                                                s->huf_bits,
+                                                s->huf_src[t],
+                                                s->huf_src_len[t],
+                                                s->huf_dst[t],
+                                                s->huf_dst_len[t]);
+      }
+    } else {
+      unzstd_execute_batch(s, t);
+    }
+    SYNCWARP();
+  }
+  if (t == 0) {
+    outputs[strm_id].bytes_written = (s->error) ? 0 : s->dst - s->dst_base;
+    outputs[strm_id].status        = s->error;
+    outputs[strm_id].reserved      = 0;
+  }
+}
+
+cudaError_t __host__ gpu_unzstd(gpu_inflate_input_s *inputs,
+                                gpu_inflate_status_s *outputs,
+                                int count,
+                                cudaStream_t stream)
+{
+  dim3 dim_block(UNZSTD_STREAMS_PER_BLOCK * 32, 1);  // 1 warp per stream
+  dim3 dim_grid((count + UNZSTD_STREAMS_PER_BLOCK - 1) / UNZSTD_STREAMS_PER_BLOCK, 1);
+  if (count > 0) { unzstd_kernel<<<dim_grid, dim_block, 0, stream>>>(inputs, outputs, count); }
+  return cudaSuccess;
+}
+
+size_t __host__ cpu_unzstd(uint8_t *dst, size_t dst_len, const uint8_t *src, size_t src_len)
+{
+  auto s = std::make_unique<unzstd_state_s>();
+  unzstd_init(s.get(), src, src_len, dst, dst_len);
+  for (;;) {
+    unzstd_step(s.get());
+    if (s->error || s->phase == UNZSTD_DONE) break;
+    if (s->huf_pending) {
+      for (uint32_t i = 0; i < s->num_huf_streams; i++) {
+        s->huf_error[i] = unzstd_huffman_stream(s->huf_table,
+                                                s->huf_bits,
+                                                s->huf_src[i],
+                                                s->huf_src_len[i],
+                                                s->huf_dst[i],
+                                                s->huf_dst_len[i]);
+      }
+    } else {
+      // Byte-wise copies, as literals and matches may overlap their destination
+      uint8_t *out = s->batch_dst;
+      for (uint32_t i = 0; i < s->batch_len; i++) {
+        const uint8_t *literals = s->batch[i].literals;
+        for (uint32_t j = 0; j < s->batch[i].literal_length; j++) {
+          *out++ = (literals) ? literals[j] : static_cast<uint8_t>(s->literal_byte);
+        }
+        for (uint32_t j = 0; j < s->batch[i].match_length; j++, out++) {
+          *out = *(out - s->batch[i].offset);
+        }
+      }
+    }
+  }
+  return (s->error) ? 0 : s->dst - s->dst_base;
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,525 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file zstd.cu
+ * @brief ZSTD compression
+ *
+ * Each stream is compressed by a single warp into a single-segment frame. Matches are found with
+ * 4-byte hashes like the snappy compressor; literals are stored uncompressed and sequences are
+ * coded with the predefined FSE distributions, so the output stays simple to produce on the GPU
+ * while remaining readable by any ZSTD decoder.
+ */
+
+#include <io/utilities/block_utils.cuh>
+#include "gpuinflate.h"
+#include "zstd_common.cuh"
+
+namespace cudf {
+namespace io {
+#define ZSTD_HASH_BITS 12
+#define ZSTD_BLOCK_SIZE (32 * 1024)  // Uncompressed size of a block
+#define ZSTD_MAX_SEQUENCES 1024      // Sequences per block, a block ends early once reached
+
+/**
+ * @brief FSE encoding transform of a symbol
+ **/
+struct zstd_fse_symbol_s {
+  uint32_t delta_num_bits;
+  int32_t delta_find_state;
+};
+
+/**
+ * @brief FSE encoding table of a predefined distribution
+ **/
+struct zstd_fse_ctable_s {
+  uint16_t state_table[1 << zstd_default_ll_log];
+  zstd_fse_symbol_s symbols[zstd_ml_max_code + 1];
+  uint32_t log;
+};
+
+/**
+ * @brief Sequence of a compressed block
+ **/
+struct zstd_sequence_s {
+  uint16_t literal_length;
+  uint16_t match_length;
+  uint32_t offset;
+};
+
+/**
+ * @brief ZSTD compressor state
+ **/
+struct zstd_state_s {
+  const uint8_t *src;  ///< Ptr to uncompressed data
+  uint32_t src_len;    ///< Uncompressed data length
+  uint8_t *dst_base;   ///< Base ptr to output compressed data
+  uint8_t *dst;        ///< Current ptr to compressed data
+  uint8_t *end;        ///< End of compressed data buffer
+  zstd_fse_ctable_s ll_table;
+  zstd_fse_ctable_s of_table;
+  zstd_fse_ctable_s ml_table;
+  zstd_sequence_s seqs[ZSTD_MAX_SEQUENCES];
+  uint16_t hash_map[1 << ZSTD_HASH_BITS];  ///< Low 16-bit offset from hash
+};
+
+/**
+ * @brief Little-endian bit writer of an FSE bitstream
+ **/
+struct zstd_bit_writer_s {
+  uint8_t *dst;
+  uint8_t *end;
+  uint64_t bits;
+  uint32_t num_bits;
+};
+
+/**
+ * @brief Appends up to 32 bits to a bitstream
+ **/
+inline __host__ __device__ void zstd_put_bits(zstd_bit_writer_s *w, uint32_t v, uint32_t num_bits)
+{
+  w->bits |= static_cast<uint64_t>(v & ((1ull << num_bits) - 1)) << w->num_bits;
+  w->num_bits += num_bits;
+  while (w->num_bits >= 8) {
+    if (w->dst < w->end) { w->dst[0] = static_cast<uint8_t>(w->bits); }
+    w->dst++;
+    w->bits >>= 8;
+    w->num_bits -= 8;
+  }
+}
+
+/**
+ * @brief Builds the FSE encoding table of a predefined distribution
+ **/
+__host__ __device__ void zstd_build_fse_ctable(zstd_fse_ctable_s *ct, zstd_symbol_type type)
+{
+  int16_t norm[zstd_fse_max_symbols];
+  uint32_t log;
+  uint32_t const num_symbols = zstd_default_distribution(type, norm, &log);
+  uint32_t const size        = 1u << log;
+  uint32_t const mask        = size - 1;
+  uint32_t const step        = (size >> 1) + (size >> 3) + 3;
+  uint32_t high              = size - 1;
+  uint32_t cumul[zstd_fse_max_symbols + 1];
+  uint8_t table_symbol[1 << zstd_default_ll_log];
+
+  // Symbols with "less than 1" probability take the last positions, in the same order as decoding
+  cumul[0] = 0;
+  for (uint32_t s = 0; s < num_symbols; s++) {
+    if (norm[s] == -1) {
+      cumul[s + 1]         = cumul[s] + 1;
+      table_symbol[high--] = s;
+    } else {
+      cumul[s + 1] = cumul[s] + norm[s];
+    }
+  }
+  uint32_t pos = 0;
+  for (uint32_t s = 0; s < num_symbols; s++) {
+    for (int32_t i = 0; i < norm[s]; i++) {
+      table_symbol[pos] = s;
+      do {
+        pos = (pos + step) & mask;
+      } while (pos > high);
+    }
+  }
+  for (uint32_t u = 0; u < size; u++) { ct->state_table[cumul[table_symbol[u]]++] = size + u; }
+  int32_t total = 0;
+  for (uint32_t s = 0; s < num_symbols; s++) {
+    int32_t const n = norm[s];
+    if (n == -1 || n == 1) {
+      ct->symbols[s].delta_num_bits   = (log << 16) - size;
+      ct->symbols[s].delta_find_state = total - 1;
+      total++;
+    } else {
+      uint32_t const max_bits_out     = log - zstd_highbit(n - 1);
+      ct->symbols[s].delta_num_bits   = (max_bits_out << 16) - (n << max_bits_out);
+      ct->symbols[s].delta_find_state = total - n;
+      total += n;
+    }
+  }
+  ct->log = log;
+}
+
+/**
+ * @brief Returns the initial FSE state that encodes a symbol
+ **/
+inline __host__ __device__ uint32_t zstd_fse_init_state(const zstd_fse_ctable_s *ct,
+                                                        uint32_t symbol)
+{
+  zstd_fse_symbol_s const tt = ct->symbols[symbol];
+  uint32_t const num_bits    = (tt.delta_num_bits + (1 << 15)) >> 16;
+  uint32_t const value       = (num_bits << 16) - tt.delta_num_bits;
+  return ct->state_table[static_cast<int32_t>(value >> num_bits) + tt.delta_find_state];
+}
+
+/**
+ * @brief Encodes a symbol, outputting the low bits of the current state
+ **/
+inline __host__ __device__ uint32_t zstd_fse_encode(zstd_bit_writer_s *w,
+                                                    const zstd_fse_ctable_s *ct,
+                                                    uint32_t state,
+                                                    uint32_t symbol)
+{
+  zstd_fse_symbol_s const tt = ct->symbols[symbol];
+  uint32_t const num_bits    = (state + tt.delta_num_bits) >> 16;
+  zstd_put_bits(w, state, num_bits);
+  return ct->state_table[static_cast<int32_t>(state >> num_bits) + tt.delta_find_state];
+}
+
+/**
+ * @brief Encodes the sequences bitstream of a block (single thread)
+ *
+ * Sequences are encoded in reverse order, so that the decoder reads them from the first one.
+ *
+ * @return Updated pointer to compressed byte stream
+ **/
+__host__ __device__ uint8_t *zstd_encode_sequences(const zstd_state_s *s,
+                                                   uint32_t num_seqs,
+                                                   uint8_t *dst,
+                                                   uint8_t *end)
+{
+  zstd_bit_writer_s w{dst, end, 0, 0};
+  uint32_t ll_state = 0, of_state = 0, ml_state = 0;
+  for (uint32_t i = num_seqs; i > 0; i--) {
+    zstd_sequence_s const seq = s->seqs[i - 1];
+    uint32_t const ll_code    = zstd_ll_code(seq.literal_length);
+    uint32_t const ml_code    = zstd_ml_code(seq.match_length);
+    uint32_t const of_value   = seq.offset + 3;  // Values 1 to 3 are repeat offsets
+    uint32_t const of_code    = zstd_highbit(of_value);
+    if (i == num_seqs) {
+      ml_state = zstd_fse_init_state(&s->ml_table, ml_code);
+      of_state = zstd_fse_init_state(&s->of_table, of_code);
+      ll_state = zstd_fse_init_state(&s->ll_table, ll_code);
+    } else {
+      of_state = zstd_fse_encode(&w, &s->of_table, of_state, of_code);
+      ml_state = zstd_fse_encode(&w, &s->ml_table, ml_state, ml_code);
+      ll_state = zstd_fse_encode(&w, &s->ll_table, ll_state, ll_code);
+    }
+    // Extra bits are the low bits of the values, as the baselines are aligned to them
+    zstd_put_bits(&w, seq.literal_length, zstd_ll_bits(ll_code));
+    zstd_put_bits(&w, seq.match_length - zstd_min_match_length, zstd_ml_bits(ml_code));
+    zstd_put_bits(&w, of_value, of_code);
+  }
+  zstd_put_bits(&w, ml_state, s->ml_table.log);
+  zstd_put_bits(&w, of_state, s->of_table.log);
+  zstd_put_bits(&w, ll_state, s->ll_table.log);
+  // End marker, followed by zero padding to a byte boundary
+  zstd_put_bits(&w, 1, 1);
+  zstd_put_bits(&w, 0, (8 - w.num_bits) & 7);
+  return w.dst;
+}
+
+/**
+ * @brief 12-bit hash from four consecutive bytes
+ **/
+static inline __device__ uint32_t zstd_hash(uint32_t v)
+{
+  return (v * ((1 << 20) + (0x2a00) + (0x6a) + 1)) >> (32 - ZSTD_HASH_BITS);
+}
+
+/**
+ * @brief Fetches four consecutive bytes
+ **/
+static inline __device__ uint32_t zstd_fetch4(const uint8_t *src)
+{
+  uint32_t src_align    = 3 & reinterpret_cast<uintptr_t>(src);
+  const uint32_t *src32 = reinterpret_cast<const uint32_t *>(src - src_align);
+  uint32_t v            = src32[0];
+  return (src_align) ? __funnelshift_r(v, src32[1], src_align * 8) : v;
+}
+
+/**
+ * @brief Returns mask of any thread in the warp that has a hash value
+ * equal to that of the calling thread
+ **/
+static inline __device__ uint32_t zstd_hash_match_any(uint32_t v)
+{
+#if (__CUDA_ARCH__ >= 700)
+  return __match_any_sync(~0, v);
+#else
+  uint32_t err_map = 0;
+  for (uint32_t i = 0; i < ZSTD_HASH_BITS; i++, v >>= 1) {
+    uint32_t b       = v & 1;
+    uint32_t match_b = BALLOT(b);
+    err_map |= match_b ^ -(int32_t)b;
+  }
+  return ~err_map;
+#endif
+}
+
+/**
+ * @brief Finds the first 4-byte match of the remaining bytes of a block
+ *
+ * @param[in] s Compressor state
+ * @param[in] pos0 Position in uncompressed buffer
+ * @param[in] end End of the block in uncompressed buffer
+ * @param[out] distance Match distance, zero if there is no match before the end of the block
+ * @param[in] t Thread in warp
+ *
+ * @return Number of bytes before the match (literal length)
+ **/
+static __device__ uint32_t zstd_find_match(
+  zstd_state_s *s, uint32_t pos0, uint32_t end, uint32_t *distance, uint32_t t)
+{
+  const uint8_t *src = s->src;
+  uint32_t pos       = pos0;
+  uint32_t match_mask, literal_cnt;
+  *distance = 0;
+  while (pos + 4 <= end) {
+    bool valid4               = (pos + t + 4 <= end);
+    uint32_t data32           = (valid4) ? zstd_fetch4(src + pos + t) : 0;
+    uint32_t hash             = (valid4) ? zstd_hash(data32) : 0;
+    uint32_t local_match      = zstd_hash_match_any(hash);
+    uint32_t local_match_lane = 31 - __clz(local_match & ((1u << t) - 1));
+    uint32_t local_match_data = SHFL(data32, min(local_match_lane, t));
+    uint32_t offset, match;
+    if (valid4) {
+      if (local_match_lane < t && local_match_data == data32) {
+        match  = 1;
+        offset = pos + local_match_lane;
+      } else {
+        offset = (pos & ~0xffff) | s->hash_map[hash];
+        if (offset >= pos) { offset = (offset >= 0x10000) ? offset - 0x10000 : pos; }
+        match = (offset < pos && zstd_fetch4(src + offset) == data32);
+      }
+    } else {
+      match       = 0;
+      local_match = 0;
+      offset      = pos + t;
+    }
+    match_mask  = BALLOT(match);
+    literal_cnt = (match_mask != 0) ? __ffs(match_mask) - 1 : 32;
+    // Update hash up to the first 4 bytes of the match
+    if (literal_cnt < 31) { local_match &= (2u << literal_cnt) - 1; }
+    if (t <= literal_cnt && t == 31 - __clz(local_match)) { s->hash_map[hash] = pos + t; }
+    SYNCWARP();
+    if (match_mask != 0) {
+      *distance = SHFL(pos + t - offset, literal_cnt);
+      return pos + literal_cnt - pos0;
+    }
+    pos += 32;
+  }
+  return end - pos0;
+}
+
+/**
+ * @brief Returns the length of a match, extended up to the end of the block
+ **/
+static __device__ uint32_t zstd_match_length(
+  const uint8_t *src, uint32_t pos, uint32_t distance, uint32_t end, uint32_t t)
+{
+  uint32_t len = 4;
+  for (;;) {
+    uint32_t const p        = pos + len + t;
+    uint32_t const mismatch = BALLOT(p >= end || src[p] != src[p - distance]);
+    if (mismatch != 0) { return len + __ffs(mismatch) - 1; }
+    len += 32;
+  }
+}
+
+/**
+ * @brief Copies bytes with the warp, up to the end of the output buffer
+ **/
+static inline __device__ void zstd_store_bytes(
+  uint8_t *dst, uint8_t *end, const uint8_t *src, uint32_t len, uint32_t t)
+{
+  for (uint32_t i = t; i < len; i += 32) {
+    if (dst + i < end) dst[i] = src[i];
+  }
+}
+
+/**
+ * @brief Outputs a block, compressed with the sequences found for it or stored raw if that is
+ * not smaller
+ *
+ * @param s Compressor state
+ * @param block_start Block position in uncompressed buffer
+ * @param block_end End of the block
+ * @param num_seqs Number of sequences
+ * @param num_literals Number of literal bytes
+ * @param t Thread in warp
+ **/
+static __device__ void zstd_store_block(zstd_state_s *s,
+                                        uint32_t block_start,
+                                        uint32_t block_end,
+                                        uint32_t num_seqs,
+                                        uint32_t num_literals,
+                                        uint32_t t)
+{
+  const uint8_t *src       = s->src;
+  uint8_t *const block_hdr = s->dst;
+  uint8_t *end             = s->end;
+  uint32_t const block_len = block_end - block_start;
+  uint8_t *dst             = block_hdr + 3;
+  bool compressed          = false;
+  if (num_seqs > 0) {
+    // Raw literals section
+    uint32_t const lit_hdr_len = (num_literals < 32) ? 1 : (num_literals < 4096) ? 2 : 3;
+    if (!t && dst + lit_hdr_len <= end) {
+      if (lit_hdr_len == 1) {
+        dst[0] = num_literals << 3;
+      } else {
+        dst[0] = (num_literals << 4) | ((lit_hdr_len == 2) ? 1 << 2 : 3 << 2);
+        dst[1] = num_literals >> 4;
+        if (lit_hdr_len == 3) { dst[2] = num_literals >> 12; }
+      }
+    }
+    dst += lit_hdr_len;
+    uint32_t pos = block_start;
+    for (uint32_t i = 0; i < num_seqs; i++) {
+      uint32_t const literal_length = s->seqs[i].literal_length;
+      zstd_store_bytes(dst, end, src + pos, literal_length, t);
+      dst += literal_length;
+      pos += literal_length + s->seqs[i].match_length;
+    }
+    zstd_store_bytes(dst, end, src + pos, block_end - pos, t);
+    dst += block_end - pos;
+    // Sequences section, with predefined distributions for all symbol types
+    uint32_t const seq_hdr_len = (num_seqs < 128) ? 2 : 3;
+    if (!t && dst + seq_hdr_len <= end) {
+      if (num_seqs < 128) {
+        dst[0] = num_seqs;
+      } else {
+        dst[0] = (num_seqs >> 8) + 128;
+        dst[1] = num_seqs;
+      }
+      dst[seq_hdr_len - 1] = 0;
+    }
+    dst += seq_hdr_len;
+    SYNCWARP();
+    if (!t) { s->dst = zstd_encode_sequences(s, num_seqs, dst, end); }
+    SYNCWARP();
+    dst        = s->dst;
+    compressed = (dst - block_hdr - 3 < block_len);
+  }
+  if (!compressed) {
+    dst = block_hdr + 3;
+    zstd_store_bytes(dst, end, src + block_start, block_len, t);
+    dst += block_len;
+  }
+  if (!t && block_hdr + 3 <= end) {
+    uint32_t const last   = (block_end == s->src_len);
+    uint32_t const header = last | ((compressed) ? 2 << 1 : 0) |
+                            (static_cast<uint32_t>(dst - block_hdr - 3) << 3);
+    block_hdr[0] = header;
+    block_hdr[1] = header >> 8;
+    block_hdr[2] = header >> 16;
+  }
+  SYNCWARP();
+  if (!t) { s->dst = dst; }
+  SYNCWARP();
+}
+
+/**
+ * @brief ZSTD compression kernel
+ * See https://tools.ietf.org/html/rfc8878
+ *
+ * blockDim {32,1,1}
+ *
+ * @param[in] inputs Source/Destination buffer information per block
+ * @param[out] outputs Compression status per block
+ * @param[in] count Number of blocks to compress
+ **/
+extern "C" __global__ void __launch_bounds__(32)
+  zstd_kernel(gpu_inflate_input_s *inputs, gpu_inflate_status_s *outputs, int count)
+{
+  __shared__ __align__(16) zstd_state_s state_g;
+
+  zstd_state_s *const s = &state_g;
+  uint32_t t            = threadIdx.x;
+
+  if (!t) {
+    const uint8_t *src = reinterpret_cast<const uint8_t *>(inputs[blockIdx.x].srcDevice);
+    uint32_t src_len   = static_cast<uint32_t>(inputs[blockIdx.x].srcSize);
+    uint8_t *dst       = reinterpret_cast<uint8_t *>(inputs[blockIdx.x].dstDevice);
+    uint32_t dst_len   = static_cast<uint32_t>(inputs[blockIdx.x].dstSize);
+    uint8_t *end       = dst + dst_len;
+    s->src             = src;
+    s->src_len         = src_len;
+    s->dst_base        = dst;
+    s->end             = end;
+    // Single-segment frame header, with the content size and no checksum
+    uint32_t const fcs_flag = (src_len < 256) ? 0 : (src_len < 0x10000 + 256) ? 1 : 2;
+    uint32_t const fcs      = (fcs_flag == 1) ? src_len - 256 : src_len;
+    uint32_t const hdr_len  = 5 + ((fcs_flag == 0) ? 1 : 1u << fcs_flag);
+    if (dst + hdr_len <= end) {
+      for (uint32_t i = 0; i < 4; i++) { dst[i] = zstd_magic >> (i * 8); }
+      dst[4] = (fcs_flag << 6) | (1 << 5);
+      for (uint32_t i = 5; i < hdr_len; i++) { dst[i] = fcs >> ((i - 5) * 8); }
+    }
+    s->dst = dst + hdr_len;
+    zstd_build_fse_ctable(&s->ll_table, ZSTD_LITERAL_LENGTH);
+    zstd_build_fse_ctable(&s->of_table, ZSTD_OFFSET);
+    zstd_build_fse_ctable(&s->ml_table, ZSTD_MATCH_LENGTH);
+  }
+  for (uint32_t i = t; i < sizeof(s->hash_map) / sizeof(uint32_t); i += 32) {
+    *reinterpret_cast<volatile uint32_t *>(&s->hash_map[i * 2]) = 0;
+  }
+  __syncthreads();
+  uint32_t const src_len = s->src_len;
+  uint32_t block_start   = 0;
+  do {
+    uint32_t block_end    = min(block_start + ZSTD_BLOCK_SIZE, src_len);
+    uint32_t pos          = block_start;
+    uint32_t num_seqs     = 0;
+    uint32_t num_literals = 0;
+    while (pos < block_end) {
+      uint32_t distance;
+      uint32_t const literal_length = zstd_find_match(s, pos, block_end, &distance, t);
+      if (distance == 0) {
+        num_literals += block_end - pos;
+        break;
+      }
+      uint32_t const match_length =
+        zstd_match_length(s->src, pos + literal_length, distance, block_end, t);
+      if (!t) {
+        s->seqs[num_seqs].literal_length = literal_length;
+        s->seqs[num_seqs].match_length   = match_length;
+        s->seqs[num_seqs].offset         = distance;
+      }
+      num_seqs++;
+      num_literals += literal_length;
+      pos += literal_length + match_length;
+      if (num_seqs == ZSTD_MAX_SEQUENCES) {
+        // End the block after the last match
+        block_end = pos;
+        break;
+      }
+    }
+    SYNCWARP();
+    zstd_store_block(s, block_start, block_end, num_seqs, num_literals, t);
+    block_start = block_end;
+  } while (block_start < src_len);
+  if (!t) {
+    outputs[blockIdx.x].bytes_written = s->dst - s->dst_base;
+    outputs[blockIdx.x].status        = (s->dst > s->end) ? 1 : 0;
+    outputs[blockIdx.x].reserved      = 0;
+  }
+}
+
+cudaError_t __host__ gpu_zstd(gpu_inflate_input_s *inputs,
+                              gpu_inflate_status_s *outputs,
+                              int count,
+                              cudaStream_t stream)
+{
+  dim3 dim_block(32, 1);  // 1 warp per stream, 1 stream per block
+  dim3 dim_grid(count, 1);
+  if (count > 0) { zstd_kernel<<<dim_grid, dim_block, 0, stream>>>(inputs, outputs, count); }
+  return cudaSuccess;
+}
+
+}  // namespace io
+}  // namespace cudf
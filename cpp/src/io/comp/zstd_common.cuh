@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file zstd_common.cuh
+ * @brief Definitions shared by the ZSTD compressor and decompressor
+ *
+ * See https://tools.ietf.org/html/rfc8878 for the format description.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+namespace cudf {
+namespace io {
+constexpr uint32_t zstd_magic            = 0xfd2fb528;
+constexpr uint32_t zstd_skippable_magic  = 0x184d2a50;  // Low 4 bits are user-defined
+constexpr uint32_t zstd_max_block_size   = 128 * 1024;
+constexpr uint32_t zstd_ll_max_code      = 35;  // Largest literals length code
+constexpr uint32_t zstd_ml_max_code      = 52;  // Largest match length code
+constexpr uint32_t zstd_of_max_code      = 31;  // Largest offset code
+constexpr uint32_t zstd_ll_max_log       = 9;   // Largest literals length table log
+constexpr uint32_t zstd_ml_max_log       = 9;   // Largest match length table log
+constexpr uint32_t zstd_of_max_log       = 8;   // Largest offset table log
+constexpr uint32_t zstd_huf_max_bits     = 11;  // Longest Huffman code for literals
+constexpr uint32_t zstd_huf_max_log      = 6;   // Largest table log for Huffman weights
+constexpr uint32_t zstd_fse_max_symbols  = 64;  // Upper bound of FSE alphabet sizes
+constexpr uint32_t zstd_default_ll_log   = 6;   // Predefined literals length table log
+constexpr uint32_t zstd_default_ml_log   = 6;   // Predefined match length table log
+constexpr uint32_t zstd_default_of_log   = 5;   // Predefined offset table log
+constexpr uint32_t zstd_min_match_length = 3;
+
+/**
+ * @brief Sequence symbol types, in the order of their compression modes
+ */
+enum zstd_symbol_type { ZSTD_LITERAL_LENGTH = 0, ZSTD_OFFSET = 1, ZSTD_MATCH_LENGTH = 2 };
+
+/**
+ * @brief Returns the index of the most significant set bit (`v` must be non-zero)
+ */
+inline __host__ __device__ uint32_t zstd_highbit(uint32_t v)
+{
+#ifdef __CUDA_ARCH__
+  return 31 - __clz(v);
+#else
+  return 31 - __builtin_clz(v);
+#endif
+}
+
+/**
+ * @brief Returns the number of extra bits of a literals length code
+ */
+inline __host__ __device__ uint32_t zstd_ll_bits(uint32_t code)
+{
+  if (code < 16) return 0;
+  if (code < 20) return 1;
+  if (code < 24) return (code - 20) / 2 + 2;
+  if (code == 24) return 4;
+  return code - 19;
+}
+
+/**
+ * @brief Returns the smallest literals length of a literals length code
+ */
+inline __host__ __device__ uint32_t zstd_ll_baseline(uint32_t code)
+{
+  if (code < 16) return code;
+  if (code < 20) return 16 + (code - 16) * 2;
+  if (code < 22) return 24 + (code - 20) * 4;
+  if (code < 24) return 32 + (code - 22) * 8;
+  if (code == 24) return 48;
+  return 1u << (code - 19);
+}
+
+/**
+ * @brief Returns the literals length code of a literals length
+ */
+inline __host__ __device__ uint32_t zstd_ll_code(uint32_t length)
+{
+  if (length < 16) return length;
+  if (length < 24) return 16 + (length - 16) / 2;
+  if (length < 32) return 20 + (length - 24) / 4;
+  if (length < 48) return 22 + (length - 32) / 8;
+  if (length < 64) return 24;
+  return zstd_highbit(length) + 19;
+}
+
+/**
+ * @brief Returns the number of extra bits of a match length code
+ */
+inline __host__ __device__ uint32_t zstd_ml_bits(uint32_t code)
+{
+  if (code < 32) return 0;
+  if (code < 36) return 1;
+  if (code < 42) return (code - 36) / 2 + 2;
+  if (code == 42) return 5;
+  return code - 36;
+}
+
+/**
+ * @brief Returns the smallest match length of a match length code
+ */
+inline __host__ __device__ uint32_t zstd_ml_baseline(uint32_t code)
+{
+  if (code < 32) return code + 3;
+  if (code < 36) return 35 + (code - 32) * 2;
+  if (code < 38) return 43 + (code - 36) * 4;
+  if (code < 40) return 51 + (code - 38) * 8;
+  if (code < 42) return 67 + (code - 40) * 16;
+  if (code == 42) return 99;
+  return (1u << (code - 36)) + 3;
+}
+
+/**
+ * @brief Returns the match length code of a match length
+ */
+inline __host__ __device__ uint32_t zstd_ml_code(uint32_t length)
+{
+  uint32_t const v = length - zstd_min_match_length;
+  if (v < 32) return v;
+  if (v < 40) return 32 + (v - 32) / 2;
+  if (v < 48) return 36 + (v - 40) / 4;
+  if (v < 64) return 38 + (v - 48) / 8;
+  if (v < 96) return 40 + (v - 64) / 16;
+  if (v < 128) return 42;
+  return zstd_highbit(v) + 36;
+}
+
+/**
+ * @brief Copies the predefined normalized distribution of a sequence symbol type
+ *
+ * @param[in] type Symbol type
+ * @param[out] norm Normalized counts, with -1 for "less than 1" probabilities
+ * @param[out] log Accuracy log of the distribution
+ *
+ * @return Number of symbols of the distribution
+ */
+inline __host__ __device__ uint32_t zstd_default_distribution(zstd_symbol_type type,
+                                                              int16_t *norm,
+                                                              uint32_t *log)
+{
+  const int16_t ll_norm[36] = {4, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 2, 2,
+                               2, 2, 2, 2, 2, 2, 2, 3, 2, 1, 1, 1, 1, 1, -1, -1, -1, -1};
+  const int16_t ml_norm[53] = {1, 4, 3, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                               1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                               1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1, -1, -1};
+  const int16_t of_norm[29] = {1, 1, 1, 1, 1, 1, 2, 2, 2, 1, 1, 1, 1, 1, 1,
+                               1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1};
+  const int16_t *src;
+  uint32_t num_symbols;
+  switch (type) {
+    case ZSTD_LITERAL_LENGTH:
+      src         = ll_norm;
+      num_symbols = 36;
+      *log        = zstd_default_ll_log;
+      break;
+    case ZSTD_MATCH_LENGTH:
+      src         = ml_norm;
+      num_symbols = 53;
+      *log        = zstd_default_ml_log;
+      break;
+    default:
+      src         = of_norm;
+      num_symbols = 29;
+      *log        = zstd_default_of_log;
+      break;
+  }
+  for (uint32_t i = 0; i < num_symbols; i++) { norm[i] = src[i]; }
+  return num_symbols;
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -32,6 +32,7 @@ enum : uint8_t {
   as_default     = 4,   ///< no special decoding
   as_hexadecimal = 8,   ///< decode with base-16
   as_datetime    = 16,  ///< decode as date and/or time
+  as_dictionary  = 32,  ///< decode as strings, then dictionary encode
 };
 using flags = uint8_t;
 
@@ -30,6 +30,11 @@
 
 #include <io/utilities/block_utils.cuh>
 #include <io/utilities/parsing_utils.cuh>
+
+#include <thrust/binary_search.h>
+#include <thrust/host_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+
 #include <type_traits>
 
 using namespace ::cudf::io;
@@ -42,6 +47,87 @@ namespace gpu {
 /// Block dimension for dtype detection and conversion kernels
 constexpr uint32_t csvparse_block_dim = 128;
 
+/// Largest trie the dtype detection and conversion kernels copy into shared memory
+constexpr int max_shared_trie_nodes = 256;
+
+/**
+ * @brief Shared memory for the N/A, true and false value tries of a block
+ */
+struct shared_tries {
+  // Raw storage, as shared memory variables cannot have constructors
+  uint32_t na[max_shared_trie_nodes];
+  uint32_t true_values[max_shared_trie_nodes];
+  uint32_t false_values[max_shared_trie_nodes];
+};
+static_assert(sizeof(SerialTrieNode) == sizeof(uint32_t), "Unexpected trie node size");
+
+/**
+ * @brief Copies a trie into shared memory, if it fits
+ *
+ * @param trie The trie in global memory
+ * @param num_nodes The number of nodes of the trie
+ * @param storage The shared memory to copy the trie to
+ *
+ * @return The copy in shared memory, or `trie` if it does not fit
+ */
+__device__ SerialTrieNode *copy_trie_to_shared(SerialTrieNode *trie, int num_nodes, void *storage)
+{
+  if (trie == nullptr || num_nodes <= 0 || num_nodes > max_shared_trie_nodes) { return trie; }
+  auto shared = static_cast<SerialTrieNode *>(storage);
+  for (int i = threadIdx.x; i < num_nodes; i += blockDim.x) { shared[i] = trie[i]; }
+  return shared;
+}
+
+/**
+ * @brief Returns the parsing options with their tries copied into the block's shared memory
+ *
+ * Every field is looked up in the N/A trie, and many in the true and false value tries, so
+ * reading them from shared memory saves a chain of dependent global loads per field. Must be
+ * called by all the threads of the block.
+ */
+__device__ ParseOptions load_tries(ParseOptions const &options, shared_tries &storage)
+{
+  ParseOptions opts = options;
+  opts.naValuesTrie =
+    copy_trie_to_shared(options.naValuesTrie, options.naValuesTrieSize, storage.na);
+  opts.trueValuesTrie =
+    copy_trie_to_shared(options.trueValuesTrie, options.trueValuesTrieSize, storage.true_values);
+  opts.falseValuesTrie =
+    copy_trie_to_shared(options.falseValuesTrie, options.falseValuesTrieSize, storage.false_values);
+  __syncthreads();
+  return opts;
+}
+
+/**
+ * @brief Returns whether a field is one of the N/A values
+ */
+__host__ __device__ __forceinline__ bool is_na_value(ParseOptions const &opts,
+                                                     const char *field,
+                                                     size_t field_len)
+{
+  return serializedTrieContains(opts.naValuesTrie, opts.naValuesLengths, field, field_len);
+}
+
+/**
+ * @brief Returns whether a field is one of the true values
+ */
+__host__ __device__ __forceinline__ bool is_true_value(ParseOptions const &opts,
+                                                       const char *field,
+                                                       size_t field_len)
+{
+  return serializedTrieContains(opts.trueValuesTrie, opts.trueValuesLengths, field, field_len);
+}
+
+/**
+ * @brief Returns whether a field is one of the false values
+ */
+__host__ __device__ __forceinline__ bool is_false_value(ParseOptions const &opts,
+                                                        const char *field,
+                                                        size_t field_len)
+{
+  return serializedTrieContains(opts.falseValuesTrie, opts.falseValuesLengths, field, field_len);
+}
+
 /*
  * @brief Checks whether the given character is a whitespace character.
  *
@@ -174,7 +260,8 @@ __device__ __inline__ bool is_floatingpoint(
  *
  * @param raw_csv The entire CSV data to read
  * @param opts A set of parsing options
- * @param num_records The number of lines/rows of CSV data
+ * @param num_records The number of lines/rows of CSV data to sample
+ * @param row_stride Distance between two sampled rows
  * @param num_columns The number of columns of CSV data
  * @param column_flags Per-column parsing behavior flags
  * @param recStart The start the CSV data of interest
@@ -182,13 +269,17 @@ __device__ __inline__ bool is_floatingpoint(
  */
 __global__ void __launch_bounds__(csvparse_block_dim)
   data_type_detection(const char *raw_csv,
-                      const ParseOptions opts,
+                      const ParseOptions options,
                       size_t num_records,
+                      size_t row_stride,
                       int num_columns,
                       column_parse::flags *flags,
                       const uint64_t *recStart,
                       column_parse::stats *d_columnData)
 {
+  __shared__ shared_tries tries;
+  auto const opts = load_tries(options, tries);
+
   // ThreadIds range per block, so also need the blockId
   // This is entry into the fields; threadId is an element within `num_records`
   long rec_id = threadIdx.x + (blockDim.x * blockIdx.x);
@@ -196,6 +287,7 @@ __global__ void __launch_bounds__(csvparse_block_dim)
   // we can have more threads than data, make sure we are not past the end of
   // the data
   if (rec_id >= num_records) { return; }
+  rec_id *= row_stride;
 
   long start = recStart[rec_id];
   long stop  = recStart[rec_id + 1];
@@ -216,10 +308,10 @@ __global__ void __launch_bounds__(csvparse_block_dim)
       long tempPos   = pos - 1;
       long field_len = pos - start;
 
-      if (field_len <= 0 || serializedTrieContains(opts.naValuesTrie, raw_csv + start, field_len)) {
+      if (field_len <= 0 || is_na_value(opts, raw_csv + start, field_len)) {
         atomicAdd(&d_columnData[actual_col].countNULL, 1);
-      } else if (serializedTrieContains(opts.trueValuesTrie, raw_csv + start, field_len) ||
-                 serializedTrieContains(opts.falseValuesTrie, raw_csv + start, field_len)) {
+      } else if (is_true_value(opts, raw_csv + start, field_len) ||
+                 is_false_value(opts, raw_csv + start, field_len)) {
         atomicAdd(&d_columnData[actual_col].countBool, 1);
       } else {
         long countNumber   = 0;
@@ -429,9 +521,9 @@ struct decode_op {
     // Check for user-specified true/false values first, where the output is
     // replaced with 1/0 respectively
     const size_t field_len = end - start + 1;
-    if (serializedTrieContains(opts.trueValuesTrie, data + start, field_len)) {
+    if (is_true_value(opts, data + start, field_len)) {
       value = 1;
-    } else if (serializedTrieContains(opts.falseValuesTrie, data + start, field_len)) {
+    } else if (is_false_value(opts, data + start, field_len)) {
       value = 0;
     } else {
       if (flags & column_parse::as_hexadecimal) {
@@ -460,9 +552,9 @@ struct decode_op {
     // Check for user-specified true/false values first, where the output is
     // replaced with 1/0 respectively
     const size_t field_len = end - start + 1;
-    if (serializedTrieContains(opts.trueValuesTrie, data + start, field_len)) {
+    if (is_true_value(opts, data + start, field_len)) {
       value = 1;
-    } else if (serializedTrieContains(opts.falseValuesTrie, data + start, field_len)) {
+    } else if (is_false_value(opts, data + start, field_len)) {
       value = 0;
     } else {
       value = decode_value<T>(data, start, end, opts);
@@ -528,7 +620,7 @@ struct decode_op {
  **/
 __global__ void __launch_bounds__(csvparse_block_dim)
   convert_csv_to_cudf(const char *raw_csv,
-                      const ParseOptions opts,
+                      const ParseOptions options,
                       size_t num_records,
                       size_t num_columns,
                       const column_parse::flags *flags,
@@ -537,6 +629,9 @@ __global__ void __launch_bounds__(csvparse_block_dim)
                       void **data,
                       cudf::bitmask_type **valid)
 {
+  __shared__ shared_tries tries;
+  auto const opts = load_tries(options, tries);
+
   // thread IDs range per block, so also need the block id
   long rec_id =
     threadIdx.x + (blockDim.x * blockIdx.x);  // this is entry into the field array - tid is
@@ -560,7 +655,7 @@ __global__ void __launch_bounds__(csvparse_block_dim)
 
     if (flags[col] & column_parse::enabled) {
       // check if the entire field is a NaN string - consistent with pandas
-      const bool is_na = serializedTrieContains(opts.naValuesTrie, raw_csv + start, pos - start);
+      const bool is_na = is_na_value(opts, raw_csv + start, pos - start);
 
       // Modify start & end to ignore whitespace and quotechars
       long tempPos = pos - 1;
@@ -969,20 +1064,67 @@ void __host__ remove_blank_rows(rmm::device_vector<uint64_t> &row_offsets,
   const auto newline  = opts.skipblanklines ? opts.terminator : opts.comment;
   const auto comment  = opts.comment != '\0' ? opts.comment : newline;
   const auto carriage = (opts.skipblanklines && opts.terminator == '\n') ? '\r' : comment;
+  if (row_offsets.size() < 2) { return; }
+  // The last offset marks the end of the previous row, so is kept even if it is a blank row
+  auto const last_row = row_offsets.end() - 1;
   auto new_end        = thrust::remove_if(
     rmm::exec_policy(stream)->on(stream),
     row_offsets.begin(),
-    row_offsets.end(),
+    last_row,
     [d_data, d_size, newline, comment, carriage] __device__(const uint64_t pos) {
       return ((pos != d_size) &&
               (d_data[pos] == newline || d_data[pos] == comment || d_data[pos] == carriage));
     });
+  new_end =
+    thrust::copy(rmm::exec_policy(stream)->on(stream), last_row, row_offsets.end(), new_end);
+  row_offsets.resize(new_end - row_offsets.begin());
+}
+
+void __host__ remove_source_header_rows(rmm::device_vector<uint64_t> &row_offsets,
+                                        std::vector<uint64_t> const &source_starts,
+                                        size_t header_rows,
+                                        cudaStream_t stream)
+{
+  if (row_offsets.size() < 2 || source_starts.empty() || header_rows == 0) { return; }
+  // Find the first row of each source; the last offset marks the end of the last row
+  size_t const num_rows = row_offsets.size() - 1;
+  rmm::device_vector<uint64_t> d_source_starts(source_starts);
+  rmm::device_vector<uint64_t> d_first_rows(source_starts.size());
+  thrust::lower_bound(rmm::exec_policy(stream)->on(stream),
+                      row_offsets.begin(),
+                      row_offsets.begin() + num_rows,
+                      d_source_starts.begin(),
+                      d_source_starts.end(),
+                      d_first_rows.begin());
+  thrust::host_vector<uint64_t> first_rows = d_first_rows;
+
+  // A source may have fewer rows than the header, so stop at the first row of the next source
+  std::vector<uint64_t> h_header_rows;
+  for (size_t i = 0; i < first_rows.size(); ++i) {
+    auto const rows_end = (i + 1 < first_rows.size()) ? first_rows[i + 1] : num_rows;
+    auto const hdr_end  = std::min<uint64_t>(first_rows[i] + header_rows, rows_end);
+    for (auto row = first_rows[i]; row < hdr_end; ++row) { h_header_rows.push_back(row); }
+  }
+  if (h_header_rows.empty()) { return; }
+
+  rmm::device_vector<uint64_t> d_header_rows(h_header_rows);
+  auto const d_rows   = d_header_rows.data().get();
+  auto const num_hdrs = d_header_rows.size();
+  auto new_end        = thrust::remove_if(
+    rmm::exec_policy(stream)->on(stream),
+    row_offsets.begin(),
+    row_offsets.end(),
+    thrust::make_counting_iterator<uint64_t>(0),
+    [d_rows, num_hdrs] __device__(uint64_t row) {
+      return thrust::binary_search(thrust::seq, d_rows, d_rows + num_hdrs, row);
+    });
   row_offsets.resize(new_end - row_offsets.begin());
 }
 
 cudaError_t __host__ DetectColumnTypes(const char *data,
                                        const uint64_t *row_starts,
                                        size_t num_rows,
+                                       size_t row_stride,
                                        size_t num_columns,
                                        const ParseOptions &options,
                                        column_parse::flags *flags,
@@ -994,7 +1136,7 @@ cudaError_t __host__ DetectColumnTypes(const char *data,
   const int grid_size  = (num_rows + block_size - 1) / block_size;
 
   data_type_detection<<<grid_size, block_size, 0, stream>>>(
-    data, options, num_rows, num_columns, flags, row_starts, stats);
+    data, options, num_rows, row_stride, num_columns, flags, row_starts, stats);
 
   return cudaSuccess;
 }
@@ -20,6 +20,8 @@
 #include <cudf/types.hpp>
 #include <io/utilities/parsing_utils.cuh>
 
+#include <vector>
+
 namespace cudf {
 namespace io {
 namespace csv {
@@ -178,6 +180,8 @@ size_t count_blank_rows(rmm::device_vector<uint64_t> const &row_offsets,
 /**
  * Remove blank rows in the given row offset array
  *
+ * The last row offset, which marks the end of the last row, is always kept.
+ *
  * @param row_offsets Row offsets in the character data buffer
  * @param d_data Character data buffer
  * @param options Options that control parsing of individual fields
@@ -189,12 +193,28 @@ void remove_blank_rows(rmm::device_vector<uint64_t> &row_offsets,
                        const cudf::io::ParseOptions &options,
                        cudaStream_t stream = 0);
 
+/**
+ * Remove the header rows of each source from the given row offset array, when the data of
+ * several sources is read as one
+ *
+ * @param row_offsets Row offsets in the character data buffer
+ * @param source_starts Offsets of the sources that follow the first source in the data buffer
+ * @param header_rows Number of header rows at the start of each source
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ **/
+void remove_source_header_rows(rmm::device_vector<uint64_t> &row_offsets,
+                               std::vector<uint64_t> const &source_starts,
+                               size_t header_rows,
+                               cudaStream_t stream = 0);
+
 /**
  * @brief Launches kernel for detecting possible dtype of each column of data
  *
  * @param[in] data The row-column data
  * @param[in] row_starts List of row data start positions (offsets)
- * @param[in] num_rows Number of rows
+ * @param[in] num_rows Number of rows to sample
+ * @param[in] row_stride Distance between two sampled rows; every row is sampled if 1
  * @param[in] num_columns Number of columns
  * @param[in] options Options that control individual field data conversion
  * @param[in,out] flags Flags that control individual column parsing
@@ -206,6 +226,7 @@ void remove_blank_rows(rmm::device_vector<uint64_t> &row_offsets,
 cudaError_t DetectColumnTypes(const char *data,
                               const uint64_t *row_starts,
                               size_t num_rows,
+                              size_t row_stride,
                               size_t num_columns,
                               const cudf::io::ParseOptions &options,
                               column_parse::flags *flags,
@@ -299,6 +299,62 @@ __inline__ __device__ void extractTime(
   }
 }
 
+/**
+ * @brief Extract the date and time fields of the fixed-width ISO 8601 layouts
+ * YYYY-MM-DD, YYYY-MM-DDTHH:MM:SS and YYYY-MM-DDTHH:MM:SS.sss
+ *
+ * The date and time may also be separated by a space. Each field is read at its
+ * fixed position instead of searching for the separators, and the values are the
+ * same as `extractDate` and `extractTime` return for these layouts.
+ *
+ * @param[in] data Pointer to the data block
+ * @param[in] start Starting index within the data block
+ * @param[in] end Ending index within the data block
+ * @param[out] year
+ * @param[out] month
+ * @param[out] day
+ * @param[out] hour The hour value (0 if not present)
+ * @param[out] minute The minute value (0 if not present)
+ * @param[out] second The second value (0 if not present)
+ * @param[out] millisecond The millisecond (0 if not present)
+ *
+ * @return true if the characters have one of the layouts, false otherwise
+ */
+__inline__ __device__ bool extractISODateTime(const char *data,
+                                              long start,
+                                              long end,
+                                              int *year,
+                                              int *month,
+                                              int *day,
+                                              int *hour,
+                                              int *minute,
+                                              int *second,
+                                              int *millisecond)
+{
+  constexpr char layout[] = "dddd-dd-ddTdd:dd:dd.ddd";
+  const long length       = end - start + 1;
+  if (length != 10 && length != 19 && length != 23) return false;
+  for (long i = 0; i < length; ++i) {
+    const char c = data[start + i];
+    if (layout[i] == 'd') {
+      if (c < '0' || c > '9') return false;
+    } else if (layout[i] == 'T') {
+      if (c != 'T' && c != ' ') return false;
+    } else if (c != layout[i]) {
+      return false;
+    }
+  }
+
+  *year        = convertStrToInteger<int>(data, start, start + 3);
+  *month       = convertStrToInteger<int>(data, start + 5, start + 6);
+  *day         = convertStrToInteger<int>(data, start + 8, start + 9);
+  *hour        = length > 10 ? convertStrToInteger<int>(data, start + 11, start + 12) : 0;
+  *minute      = length > 10 ? convertStrToInteger<int>(data, start + 14, start + 15) : 0;
+  *second      = length > 10 ? convertStrToInteger<int>(data, start + 17, start + 18) : 0;
+  *millisecond = length > 19 ? convertStrToInteger<int>(data, start + 20, start + 22) : 0;
+  return true;
+}
+
 /**
  * @brief Parse a Date string into a date32, days since epoch
  *
@@ -318,9 +374,15 @@ __inline__ __device__ int32_t parseDateFormat(const char *data,
                                               bool dayfirst)
 {
   int day, month, year;
+  int hour, minute, second, millisecond;
   int32_t e = -1;
 
-  bool status = extractDate(data, start_idx, end_idx, dayfirst, &year, &month, &day);
+  // a YYYY-MM-DD date needs no separator search
+  bool status =
+    (end_idx - start_idx + 1 == 10 &&
+     extractISODateTime(
+       data, start_idx, end_idx, &year, &month, &day, &hour, &minute, &second, &millisecond)) ||
+    extractDate(data, start_idx, end_idx, dayfirst, &year, &month, &day);
 
   if (status) e = daysSinceEpoch(year, month, day);
 
@@ -350,6 +412,12 @@ __inline__ __device__ int64_t parseDateTimeFormat(const char *data,
   int hour, minute, second, millisecond = 0;
   int64_t answer = -1;
 
+  // Most timestamps are in a fixed ISO 8601 layout that needs no separator search
+  if (extractISODateTime(
+        data, start, end, &year, &month, &day, &hour, &minute, &second, &millisecond)) {
+    return secondsSinceEpoch(year, month, day, hour, minute, second) * 1000 + millisecond;
+  }
+
   // Find end of the date portion
   // TODO: Refactor all the date/time parsing to remove multiple passes over
   // each character because of find() then convert(); that can also avoid the
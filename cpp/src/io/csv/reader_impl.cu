@@ -27,6 +27,7 @@
 #include <tuple>
 #include <unordered_map>
 
+#include <cudf/dictionary/detail/encode.hpp>
 #include <cudf/strings/replace.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
@@ -88,6 +89,9 @@ std::tuple<data_type, column_parse::flags> get_dtype_info(const std::string &dty
   if (dtype == "hex32") {
     return std::make_tuple(data_type{cudf::type_id::INT32}, column_parse::as_hexadecimal);
   }
+  if (is_dictionary_dtype(dtype)) {
+    return std::make_tuple(data_type{cudf::type_id::STRING}, column_parse::as_dictionary);
+  }
 
   return std::make_tuple(convert_string_to_dtype(dtype), column_parse::as_default);
 }
@@ -195,26 +199,46 @@ table_with_metadata reader::impl::read(size_t range_offset,
 
   // Support delayed opening of the file if using memory mapping datasource
   // This allows only mapping of a subset of the file if using byte range
-  if (source_ == nullptr) {
-    assert(!filepath_.empty());
-    source_ = datasource::create(filepath_, range_offset, map_range_size);
+  if (sources_.empty()) {
+    assert(!filepaths_.empty());
+    if (filepaths_.size() == 1) {
+      sources_.emplace_back(datasource::create(filepaths_[0], range_offset, map_range_size));
+    } else {
+      sources_ = datasource::create(filepaths_);
+    }
   }
+  if (sources_.size() > 1) {
+    CUDF_EXPECTS(range_offset == 0 && range_size == 0,
+                 "Byte range is not supported with multiple sources");
+    CUDF_EXPECTS(skip_rows <= 0 && skip_end_rows <= 0 && num_rows == -1,
+                 "Row selection is not supported with multiple sources");
+  }
+  auto const is_empty = std::all_of(
+    sources_.cbegin(), sources_.cend(), [](auto const &source) { return source->is_empty(); });
 
   // Return an empty dataframe if no data and no column metadata to process
-  if (source_->is_empty() && (args_.names.empty() || args_.dtype.empty())) {
+  if (is_empty && (args_.names.empty() || args_.dtype.empty())) {
     return {std::make_unique<table>(std::move(out_columns)), std::move(metadata)};
   }
 
   // Transfer source data to GPU
-  if (!source_->is_empty()) {
+  if (!is_empty) {
     const char *h_uncomp_data = nullptr;
     size_t h_uncomp_size      = 0;
 
-    auto data_size = (map_range_size != 0) ? map_range_size : source_->size();
-    auto buffer    = source_->host_read(range_offset, data_size);
-
+    std::unique_ptr<datasource::buffer> buffer;
     std::vector<char> h_uncomp_data_owner;
-    if (compression_type_ == "none") {
+    std::vector<uint64_t> source_starts;
+    if (sources_.size() == 1) {
+      auto data_size = (map_range_size != 0) ? map_range_size : sources_[0]->size();
+      buffer         = sources_[0]->host_read(range_offset, data_size);
+    }
+    if (sources_.size() > 1) {
+      // The rows of all the sources are located and parsed in one pass over the joint data
+      source_starts = concatenate_sources(h_uncomp_data_owner);
+      h_uncomp_data = h_uncomp_data_owner.data();
+      h_uncomp_size = h_uncomp_data_owner.size();
+    } else if (compression_type_ == "none") {
       // Do not use the owner vector here to avoid extra copy
       h_uncomp_data = reinterpret_cast<const char *>(buffer->data());
       h_uncomp_size = buffer->size();
@@ -245,8 +269,13 @@ table_with_metadata reader::impl::read(size_t range_offset,
                        (range_size) ? range_size : h_uncomp_size,
                        (skip_rows > 0) ? skip_rows : 0,
                        num_rows,
+                       (args_.header >= 0) ? args_.header + 1 : 0,
                        load_whole_file,
                        stream);
+    if (args_.header >= 0) {
+      cudf::io::csv::gpu::remove_source_header_rows(
+        row_offsets, source_starts, args_.header + 1, stream);
+    }
 
     // Exclude the rows that are to be skipped from the end
     if (skip_end_rows > 0 && static_cast<size_t>(skip_end_rows) < row_offsets.size()) {
@@ -260,6 +289,121 @@ table_with_metadata reader::impl::read(size_t range_offset,
     num_records = 0;
   }
 
+  select_columns();
+
+  // Return empty table rather than exception if nothing to load
+  if (num_active_cols == 0) {
+    return {std::make_unique<table>(std::move(out_columns)), std::move(metadata)};
+  }
+
+  return convert_rows(gather_column_types(stream), stream);
+}
+
+table_with_metadata reader::impl::read_chunk(size_t chunk_size, cudaStream_t stream)
+{
+  CUDF_EXPECTS(has_next_chunk(), "No more chunks to read");
+
+  if (!chunked_read_started_) {
+    if (sources_.empty()) {
+      assert(!filepaths_.empty());
+      sources_ = datasource::create(filepaths_);
+    }
+    CUDF_EXPECTS(sources_.size() == 1, "Chunked reads of multiple sources are not supported");
+    auto const &source = sources_[0];
+    if (compression_type_ != "none" && !source->is_empty()) {
+      // Compressed data is decompressed once in host memory, then read in chunks
+      auto buffer = source->host_read(0, source->size());
+      getUncompressedHostData(reinterpret_cast<const char *>(buffer->data()),
+                              buffer->size(),
+                              compression_type_,
+                              chunk_uncomp_data_);
+      chunk_data_size_ = chunk_uncomp_data_.size();
+    } else {
+      chunk_data_size_ = source->size();
+    }
+    chunk_tail_size_ = calculateMaxRowSize(std::max(args_.names.size(), args_.dtype.size()));
+  }
+
+  // Gather the rows starting within the chunk. The data past the end of the chunk is loaded
+  // until the last row ends, and the following row is where the next chunk starts.
+  size_t const range_size  = (chunk_size != 0) ? chunk_size : chunk_data_size_ - chunk_pos_;
+  size_t const header_rows = (!chunked_read_started_ && args_.header >= 0) ? args_.header + 1 : 0;
+  row_offsets.resize(0);
+  num_records = 0;
+  while (chunk_pos_ < chunk_data_size_) {
+    size_t const load_size =
+      std::min(range_size + chunk_tail_size_, chunk_data_size_ - chunk_pos_);
+    std::unique_ptr<datasource::buffer> buffer;
+    const char *h_data = nullptr;
+    if (compression_type_ == "none") {
+      if (next_buffer_.valid()) {
+        buffer = next_buffer_.get();
+        if (next_buffer_range_ != std::make_pair(chunk_pos_, load_size)) { buffer.reset(); }
+      }
+      if (buffer == nullptr) { buffer = sources_[0]->host_read(chunk_pos_, load_size); }
+      h_data = reinterpret_cast<const char *>(buffer->data());
+    } else {
+      h_data = chunk_uncomp_data_.data() + chunk_pos_;
+    }
+    gather_row_offsets(h_data,
+                       load_size,
+                       0,
+                       std::min(range_size, load_size),
+                       0,
+                       -1,
+                       header_rows,
+                       false,
+                       stream);
+
+    uint64_t next_row = load_size;
+    if (row_offsets.size() != 0) {
+      CUDA_TRY(cudaMemcpyAsync(&next_row,
+                               row_offsets.data().get() + row_offsets.size() - 1,
+                               sizeof(uint64_t),
+                               cudaMemcpyDeviceToHost,
+                               stream));
+      CUDA_TRY(cudaStreamSynchronize(stream));
+    }
+    if (next_row < load_size || chunk_pos_ + load_size == chunk_data_size_) {
+      chunk_pos_ += next_row;
+      num_records = row_offsets.size();
+      num_records -= (num_records > 0);
+      break;
+    }
+    // The last row does not end within the loaded data
+    chunk_tail_size_ *= 2;
+  }
+
+  // Start loading the next chunk while the rows of this one are converted
+  if (compression_type_ == "none" && chunk_pos_ < chunk_data_size_) {
+    next_buffer_range_ = {chunk_pos_,
+                          std::min(range_size + chunk_tail_size_, chunk_data_size_ - chunk_pos_)};
+    next_buffer_ = std::async(std::launch::async, [this, range = next_buffer_range_]() {
+      return sources_[0]->host_read(range.first, range.second);
+    });
+  }
+
+  // The column names and types of the first chunk are used for all the chunks
+  if (!chunked_read_started_) {
+    chunked_read_started_ = true;
+    if (chunk_data_size_ == 0 && (args_.names.empty() || args_.dtype.empty())) {
+      num_active_cols = 0;
+    } else {
+      select_columns();
+      if (num_active_cols != 0) { chunk_column_types_ = gather_column_types(stream); }
+    }
+  }
+
+  // Return empty table rather than exception if nothing to load
+  if (num_active_cols == 0) {
+    return {std::make_unique<table>(std::vector<std::unique_ptr<column>>{}), table_metadata{}};
+  }
+
+  return convert_rows(chunk_column_types_, stream);
+}
+
+void reader::impl::select_columns()
+{
   // Check if the user gave us a list of column names
   if (not args_.names.empty()) {
     h_column_flags.resize(args_.names.size(), column_parse::enabled);
@@ -332,29 +476,27 @@ table_with_metadata reader::impl::read(size_t range_offset,
       }
     }
   }
+}
 
-  // Return empty table rather than exception if nothing to load
-  if (num_active_cols == 0) {
-    return {std::make_unique<table>(std::move(out_columns)), std::move(metadata)};
-  }
-
-  std::vector<data_type> column_types = gather_column_types(stream);
+table_with_metadata reader::impl::convert_rows(std::vector<data_type> const &column_types,
+                                               cudaStream_t stream)
+{
+  std::vector<std::unique_ptr<column>> out_columns;
+  table_metadata metadata;
 
   // Alloc output; columns' data memory is still expected for empty dataframe
   std::vector<column_buffer> out_buffers;
+  std::vector<bool> as_dictionary;
   out_buffers.reserve(column_types.size());
   for (int col = 0, active_col = 0; col < num_actual_cols; ++col) {
     if (h_column_flags[col] & column_parse::enabled) {
-      // Replace EMPTY dtype with STRING
-      if (column_types[active_col].id() == type_id::EMPTY) {
-        column_types[active_col] = data_type{type_id::STRING};
-      }
       const bool is_final_allocation = column_types[active_col].id() != type_id::STRING;
       out_buffers.emplace_back(column_types[active_col],
                                num_records,
                                true,
                                stream,
                                is_final_allocation ? mr_ : rmm::mr::get_default_resource());
+      as_dictionary.push_back(h_column_flags[col] & column_parse::as_dictionary);
       metadata.column_names.emplace_back(col_names[col]);
       active_col++;
     }
@@ -365,6 +507,9 @@ table_with_metadata reader::impl::read(size_t range_offset,
     decode_data(column_types, out_buffers, stream);
 
     for (size_t i = 0; i < column_types.size(); ++i) {
+      // dictionary columns are encoded from a temporary strings column
+      auto const col_mr = as_dictionary[i] ? rmm::mr::get_default_resource() : mr_;
+      std::unique_ptr<column> out_column;
       if (column_types[i].id() == type_id::STRING && opts.quotechar != '\0' &&
           opts.doublequote == true) {
         // PANDAS' default behavior of enabling doublequote for two consecutive
@@ -374,17 +519,25 @@ table_with_metadata reader::impl::read(size_t range_offset,
         const std::string quotechar(1, opts.quotechar);
         const std::string dblquotechar(2, opts.quotechar);
         std::unique_ptr<column> col = make_strings_column(out_buffers[i]._strings, stream);
-        out_columns.emplace_back(
-          cudf::strings::replace(col->view(), dblquotechar, quotechar, -1, mr_));
+        out_column = cudf::strings::replace(col->view(), dblquotechar, quotechar, -1, col_mr);
       } else {
-        out_columns.emplace_back(
-          make_column(column_types[i], num_records, out_buffers[i], stream, mr_));
+        out_column = make_column(column_types[i], num_records, out_buffers[i], stream, col_mr);
       }
+      if (as_dictionary[i]) {
+        out_column = cudf::dictionary::detail::encode(
+          out_column->view(), data_type{type_id::INT32}, mr_, stream);
+      }
+      out_columns.emplace_back(std::move(out_column));
     }
   } else {
     // Create empty columns
     for (size_t i = 0; i < column_types.size(); ++i) {
-      out_columns.emplace_back(make_empty_column(column_types[i]));
+      auto out_column = make_empty_column(column_types[i]);
+      if (as_dictionary[i]) {
+        out_column = cudf::dictionary::detail::encode(
+          out_column->view(), data_type{type_id::INT32}, mr_, stream);
+      }
+      out_columns.emplace_back(std::move(out_column));
     }
   }
   return {std::make_unique<table>(std::move(out_columns)), std::move(metadata)};
@@ -399,12 +552,45 @@ size_t reader::impl::find_first_row_start(const char *h_data, size_t h_size)
   return std::min(pos + 1, h_size);
 }
 
+std::vector<uint64_t> reader::impl::concatenate_sources(std::vector<char> &h_data)
+{
+  std::vector<uint64_t> source_starts;
+  std::vector<char> h_uncomp_data;
+  h_data.resize(0);
+  for (size_t i = 0; i < sources_.size(); ++i) {
+    if (sources_[i]->is_empty()) { continue; }
+    auto const buffer = sources_[i]->host_read(0, sources_[i]->size());
+    auto const compression_type =
+      (i < filepaths_.size())
+        ? infer_compression_type(args_.compression,
+                                 filepaths_[i],
+                                 {{"gz", "gzip"}, {"zip", "zip"}, {"bz2", "bz2"}, {"xz", "xz"}})
+        : compression_type_;
+    const char *data = reinterpret_cast<const char *>(buffer->data());
+    size_t size      = buffer->size();
+    if (compression_type != "none") {
+      getUncompressedHostData(data, size, compression_type, h_uncomp_data);
+      data = h_uncomp_data.data();
+      size = h_uncomp_data.size();
+    }
+    if (size == 0) { continue; }
+
+    if (!h_data.empty()) {
+      if (h_data.back() != opts.terminator) { h_data.push_back(opts.terminator); }
+      source_starts.push_back(h_data.size());
+    }
+    h_data.insert(h_data.end(), data, data + size);
+  }
+  return source_starts;
+}
+
 void reader::impl::gather_row_offsets(const char *h_data,
                                       size_t h_size,
                                       size_t range_begin,
                                       size_t range_end,
                                       size_t skip_rows,
                                       int64_t num_rows,
+                                      size_t header_rows,
                                       bool load_whole_file,
                                       cudaStream_t stream)
 {
@@ -413,10 +599,9 @@ void reader::impl::gather_row_offsets(const char *h_data,
   size_t max_blocks =
     std::max<size_t>((buffer_size / cudf::io::csv::gpu::rowofs_block_bytes) + 1, 2);
   hostdevice_vector<uint64_t> row_ctx(max_blocks);
-  size_t buffer_pos  = std::min(range_begin - std::min(range_begin, sizeof(char)), h_size);
-  size_t pos         = std::min(range_begin, h_size);
-  size_t header_rows = (args_.header >= 0) ? args_.header + 1 : 0;
-  uint64_t ctx       = 0;
+  size_t buffer_pos = std::min(range_begin - std::min(range_begin, sizeof(char)), h_size);
+  size_t pos        = std::min(range_begin, h_size);
+  uint64_t ctx      = 0;
 
   // For compatibility with the previous parser, a row is considered in-range if the
   // previous row terminator is within the given range
@@ -558,11 +743,18 @@ std::vector<data_type> reader::impl::gather_column_types(cudaStream_t stream)
     } else {
       d_column_flags = h_column_flags;
 
+      // Optionally sample rows evenly spread across the data rather than scanning every row
+      size_t const sample_rows =
+        (args_.dtype_sample_rows > 0) ? std::min<size_t>(args_.dtype_sample_rows, num_records)
+                                      : num_records;
+      size_t const row_stride  = num_records / sample_rows;
+
       hostdevice_vector<column_parse::stats> column_stats(num_active_cols);
       CUDA_TRY(cudaMemsetAsync(column_stats.device_ptr(), 0, column_stats.memory_size(), stream));
       CUDA_TRY(cudf::io::csv::gpu::DetectColumnTypes(data_.data().get(),
                                                      row_offsets.data().get(),
-                                                     num_records,
+                                                     sample_rows,
+                                                     row_stride,
                                                      num_actual_cols,
                                                      opts,
                                                      d_column_flags.data().get(),
@@ -579,7 +771,7 @@ std::vector<data_type> reader::impl::gather_column_types(cudaStream_t stream)
         unsigned long long countInt = column_stats[col].countInt8 + column_stats[col].countInt16 +
                                       column_stats[col].countInt32 + column_stats[col].countInt64;
 
-        if (column_stats[col].countNULL == num_records) {
+        if (column_stats[col].countNULL == sample_rows) {
           // Entire column is NULL; allocate the smallest amount of memory
           dtypes.emplace_back(cudf::type_id::INT8);
         } else if (column_stats[col].countString > 0L) {
@@ -663,6 +855,11 @@ std::vector<data_type> reader::impl::gather_column_types(cudaStream_t stream)
     }
   }
 
+  // Replace EMPTY dtype with STRING
+  for (auto &type : dtypes) {
+    if (type.id() == type_id::EMPTY) { type = data_type{type_id::STRING}; }
+  }
+
   return dtypes;
 }
 
@@ -698,11 +895,11 @@ void reader::impl::decode_data(const std::vector<data_type> &column_types,
   for (int i = 0; i < num_active_cols; ++i) { out_buffers[i].null_count() = UNKNOWN_NULL_COUNT; }
 }
 
-reader::impl::impl(std::unique_ptr<datasource> source,
-                   std::string filepath,
+reader::impl::impl(std::vector<std::unique_ptr<datasource>> &&sources,
+                   std::vector<std::string> const &filepaths,
                    reader_options const &options,
                    rmm::mr::device_memory_resource *mr)
-  : source_(std::move(source)), mr_(mr), filepath_(filepath), args_(options)
+  : sources_(std::move(sources)), mr_(mr), filepaths_(filepaths), args_(options)
 {
   num_actual_cols = args_.names.size();
   num_active_cols = args_.names.size();
@@ -733,27 +930,35 @@ reader::impl::impl(std::unique_ptr<datasource> source,
   CUDF_EXPECTS(opts.thousands != opts.delimiter,
                "Thousands separator cannot be the same as the delimiter");
 
-  compression_type_ = infer_compression_type(
-    args_.compression, filepath, {{"gz", "gzip"}, {"zip", "zip"}, {"bz2", "bz2"}, {"xz", "xz"}});
+  compression_type_ =
+    infer_compression_type(args_.compression,
+                           filepaths_.empty() ? std::string{} : filepaths_[0],
+                           {{"gz", "gzip"}, {"zip", "zip"}, {"bz2", "bz2"}, {"xz", "xz"}});
 
   // Handle user-defined false values, whereby field data is substituted with a
   // boolean true or numeric `1` value
   if (args_.true_values.size() != 0) {
-    d_trueTrie          = createSerializedTrie(args_.true_values);
-    opts.trueValuesTrie = d_trueTrie.data().get();
+    d_trueTrie              = createSerializedTrie(args_.true_values);
+    opts.trueValuesTrie     = d_trueTrie.data().get();
+    opts.trueValuesTrieSize = d_trueTrie.size();
+    opts.trueValuesLengths  = createTrieLengthMask(args_.true_values);
   }
 
   // Handle user-defined false values, whereby field data is substituted with a
   // boolean false or numeric `0` value
   if (args_.false_values.size() != 0) {
-    d_falseTrie          = createSerializedTrie(args_.false_values);
-    opts.falseValuesTrie = d_falseTrie.data().get();
+    d_falseTrie              = createSerializedTrie(args_.false_values);
+    opts.falseValuesTrie     = d_falseTrie.data().get();
+    opts.falseValuesTrieSize = d_falseTrie.size();
+    opts.falseValuesLengths  = createTrieLengthMask(args_.false_values);
   }
 
   // Handle user-defined N/A values, whereby field data is treated as null
   if (args_.na_values.size() != 0) {
-    d_naTrie          = createSerializedTrie(args_.na_values);
-    opts.naValuesTrie = d_naTrie.data().get();
+    d_naTrie              = createSerializedTrie(args_.na_values);
+    opts.naValuesTrie     = d_naTrie.data().get();
+    opts.naValuesTrieSize = d_naTrie.size();
+    opts.naValuesLengths  = createTrieLengthMask(args_.na_values);
   }
 }
 
@@ -762,10 +967,11 @@ reader::reader(std::vector<std::string> const &filepaths,
                reader_options const &options,
                rmm::mr::device_memory_resource *mr)
 {
-  CUDF_EXPECTS(filepaths.size() == 1, "Only a single source is currently supported.");
+  CUDF_EXPECTS(!filepaths.empty(), "No sources to read from.");
   // Delay actual instantiation of data source until read to allow for
   // partial memory mapping of file using byte ranges
-  _impl = std::make_unique<impl>(nullptr, filepaths[0], options, mr);
+  _impl = std::make_unique<impl>(
+    std::vector<std::unique_ptr<cudf::io::datasource>>{}, filepaths, options, mr);
 }
 
 // Forward to implementation
@@ -773,8 +979,8 @@ reader::reader(std::vector<std::unique_ptr<cudf::io::datasource>> &&sources,
                reader_options const &options,
                rmm::mr::device_memory_resource *mr)
 {
-  CUDF_EXPECTS(sources.size() == 1, "Only a single source is currently supported.");
-  _impl = std::make_unique<impl>(std::move(sources[0]), "", options, mr);
+  CUDF_EXPECTS(!sources.empty(), "No sources to read from.");
+  _impl = std::make_unique<impl>(std::move(sources), std::vector<std::string>{}, options, mr);
 }
 
 // Destructor within this translation unit
@@ -792,6 +998,15 @@ table_with_metadata reader::read_byte_range(size_t offset, size_t size, cudaStre
   return _impl->read(offset, size, 0, 0, -1, stream);
 }
 
+// Forward to implementation
+table_with_metadata reader::read_chunk(size_t chunk_size, cudaStream_t stream)
+{
+  return _impl->read_chunk(chunk_size, stream);
+}
+
+// Forward to implementation
+bool reader::has_next_chunk() const { return _impl->has_next_chunk(); }
+
 // Forward to implementation
 table_with_metadata reader::read_rows(size_type num_skip_header,
                                       size_type num_skip_footer,
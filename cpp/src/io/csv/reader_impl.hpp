@@ -31,6 +31,7 @@
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/readers.hpp>
 
+#include <future>
 #include <memory>
 #include <string>
 #include <utility>
@@ -68,15 +69,18 @@ using namespace cudf::io;
 class reader::impl {
  public:
   /**
-   * @brief Constructor from a dataset source with reader options.
+   * @brief Constructor from dataset sources with reader options.
    *
-   * @param source Dataset source
-   * @param filepath Filepath if reading dataset from a file
+   * The rows of all the sources are read into a single set of columns, in the order of the
+   * sources. When reading from files, the sources are only opened on the first read.
+   *
+   * @param sources Dataset sources; empty if opening the files on read
+   * @param filepaths Filepaths if reading dataset from files
    * @param options Settings for controlling reading behavior
    * @param mr Device memory resource to use for device memory allocation
    */
-  explicit impl(std::unique_ptr<datasource> source,
-                std::string filepath,
+  explicit impl(std::vector<std::unique_ptr<datasource>> &&sources,
+                std::vector<std::string> const &filepaths,
                 reader_options const &options,
                 rmm::mr::device_memory_resource *mr);
 
@@ -100,6 +104,24 @@ class reader::impl {
                            int num_rows,
                            cudaStream_t stream);
 
+  /**
+   * @brief Reads the rows that start within the next bytes of data and returns a set of columns.
+   *
+   * Each chunk starts at the row that follows the last row of the previous chunk. The column
+   * names and types are only determined for the first chunk.
+   *
+   * @param chunk_size Number of bytes in which the rows start; use `0` for all remaining data
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_chunk(size_t chunk_size, cudaStream_t stream);
+
+  /**
+   * @brief Returns whether there are chunks left to read with `read_chunk()`.
+   */
+  bool has_next_chunk() const { return !chunked_read_started_ || chunk_pos_ < chunk_data_size_; }
+
  private:
   /**
    * @brief Finds row positions within the specified input data.
@@ -114,6 +136,7 @@ class reader::impl {
    * @param range_end Only include rows starting before this position
    * @param skip_rows Number of rows to skip from the start
    * @param num_rows Number of rows to read; -1: all remaining data
+   * @param header_rows Number of header rows at the start of the data
    * @param load_whole_file Hint that the entire data will be needed on gpu
    * @param stream CUDA stream used for device memory operations and kernel launches.
    */
@@ -123,6 +146,7 @@ class reader::impl {
                           size_t range_end,
                           size_t skip_rows,
                           int64_t num_rows,
+                          size_t header_rows,
                           bool load_whole_file,
                           cudaStream_t stream);
 
@@ -136,6 +160,18 @@ class reader::impl {
    */
   size_t find_first_row_start(const char *h_data, size_t h_size);
 
+  /**
+   * @brief Reads and decompresses the data of all the sources into a single buffer
+   *
+   * Each source starts on a new row; a line terminator is added after any source that does not
+   * end with one.
+   *
+   * @param h_data Output buffer holding the uncompressed data of all the sources
+   *
+   * @return Offsets of the sources that follow the first non-empty source
+   */
+  std::vector<uint64_t> concatenate_sources(std::vector<char> &h_data);
+
   /**
    * @brief Returns a detected or parsed list of column dtypes.
    *
@@ -145,6 +181,22 @@ class reader::impl {
    */
   std::vector<data_type> gather_column_types(cudaStream_t stream);
 
+  /**
+   * @brief Sets the column names and selects the columns to read.
+   */
+  void select_columns();
+
+  /**
+   * @brief Converts the gathered rows to a set of columns.
+   *
+   * @param column_types Column types
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata convert_rows(std::vector<data_type> const &column_types,
+                                   cudaStream_t stream);
+
   /**
    * @brief Converts the row-column data and outputs to columns.
    *
@@ -158,8 +210,8 @@ class reader::impl {
 
  private:
   rmm::mr::device_memory_resource *mr_ = nullptr;
-  std::unique_ptr<datasource> source_;
-  std::string filepath_;
+  std::vector<std::unique_ptr<datasource>> sources_;
+  std::vector<std::string> filepaths_;
   std::string compression_type_;
   const reader_options args_;
 
@@ -180,6 +232,16 @@ class reader::impl {
   // Intermediate data
   std::vector<std::string> col_names;
   std::vector<char> header;
+
+  // Chunked reading state
+  bool chunked_read_started_ = false;
+  size_t chunk_pos_          = 0;  // Position of the next row to read
+  size_t chunk_data_size_    = 0;  // Size of the uncompressed data
+  size_t chunk_tail_size_    = 0;  // Bytes loaded past the end of the chunk for its last row
+  std::vector<char> chunk_uncomp_data_;
+  std::vector<data_type> chunk_column_types_;
+  std::pair<size_t, size_t> next_buffer_range_;
+  std::future<std::unique_ptr<datasource::buffer>> next_buffer_;  // Prefetched next chunk
 };
 
 }  // namespace csv
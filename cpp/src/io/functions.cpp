@@ -14,16 +14,24 @@
  * limitations under the License.
  */
 
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/filling.hpp>
 #include <cudf/io/functions.hpp>
 #include <cudf/io/readers.hpp>
 #include <cudf/io/writers.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 
 #include "orc/chunked_state.hpp"
 #include "parquet/chunked_state.hpp"
 
+#include <algorithm>
+#include <numeric>
+
 namespace cudf {
 namespace io {
 namespace {
@@ -50,26 +58,176 @@ std::unique_ptr<reader> make_reader(source_info const& src_info,
   return std::make_unique<reader>(std::move(datasources), options, mr);
 }
 
-template <typename writer, typename writer_options>
-std::unique_ptr<writer> make_writer(sink_info const& sink,
-                                    writer_options const& options,
-                                    rmm::mr::device_memory_resource* mr)
+/**
+ * @brief Returns the number of sources of a `source_info`
+ */
+size_t get_num_sources(source_info const& src_info)
+{
+  switch (src_info.type) {
+    case io_type::FILEPATH: return src_info.filepaths.size();
+    case io_type::HOST_BUFFER: return src_info.buffers.size();
+    case io_type::ARROW_RANDOM_ACCESS_FILE: return src_info.files.size();
+    case io_type::USER_IMPLEMENTED: return src_info.user_sources.size();
+    default: CUDF_FAIL("Unsupported source type");
+  }
+}
+
+/**
+ * @brief Returns a `source_info` with a subset of the sources of another, in the given order
+ */
+source_info select_sources(source_info const& src_info, std::vector<size_t> const& indices)
+{
+  source_info selected;
+  selected.type = src_info.type;
+  for (auto const index : indices) {
+    switch (src_info.type) {
+      case io_type::FILEPATH: selected.filepaths.push_back(src_info.filepaths[index]); break;
+      case io_type::HOST_BUFFER: selected.buffers.push_back(src_info.buffers[index]); break;
+      case io_type::ARROW_RANDOM_ACCESS_FILE:
+        selected.files.push_back(src_info.files[index]);
+        break;
+      case io_type::USER_IMPLEMENTED:
+        selected.user_sources.push_back(src_info.user_sources[index]);
+        break;
+      default: CUDF_FAIL("Unsupported source type");
+    }
+  }
+  return selected;
+}
+
+/**
+ * @brief Splits a list of stripes or row groups into contiguous partitions of balanced sizes
+ *
+ * Each block is weighted by the sum of its compressed and uncompressed sizes, and assigned to the
+ * partition whose equal share of the total weight contains the midpoint of the block.
+ *
+ * @param blocks Size information of the blocks, in source and file order
+ * @param num_sources Number of sources of the dataset
+ * @param num_partitions Number of partitions
+ *
+ * @return List of partitions
+ */
+std::vector<read_partition> partition_blocks(std::vector<block_info> const& blocks,
+                                             size_t num_sources,
+                                             size_type num_partitions)
 {
-  if (sink.type == io_type::FILEPATH) {
-    return std::make_unique<writer>(cudf::io::data_sink::create(sink.filepath), options, mr);
+  std::vector<read_partition> partitions(num_partitions);
+  for (auto& partition : partitions) { partition.blocks.resize(num_sources); }
+
+  auto const weight = [](block_info const& block) {
+    return block.compressed_size + block.uncompressed_size;
+  };
+  size_t total_weight = 0;
+  for (auto const& block : blocks) { total_weight += weight(block); }
+
+  size_t start_weight = 0;
+  for (size_t i = 0; i < blocks.size(); ++i) {
+    auto const& block = blocks[i];
+    // Fall back to balancing the number of blocks if no sizes are known
+    auto const part =
+      (total_weight > 0)
+        ? static_cast<size_t>((start_weight + weight(block) / 2.0) * num_partitions / total_weight)
+        : i * num_partitions / blocks.size();
+    auto& partition = partitions[std::min<size_t>(part, num_partitions - 1)];
+    partition.blocks[block.source_index].push_back(block.index);
+    partition.num_rows += block.num_rows;
+    partition.compressed_size += block.compressed_size;
+    partition.uncompressed_size += block.uncompressed_size;
+    start_weight += weight(block);
   }
-  if (sink.type == io_type::HOST_BUFFER) {
-    return std::make_unique<writer>(cudf::io::data_sink::create(sink.buffer), options, mr);
+
+  return partitions;
+}
+
+/**
+ * @brief Concatenates the tables read from several sources
+ *
+ * @param results Tables with the same columns; the metadata of the first one is returned
+ * @param mr Device memory resource used to allocate device memory of the returned table
+ */
+table_with_metadata concatenate_results(std::vector<table_with_metadata>&& results,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  if (results.size() == 1) { return std::move(results[0]); }
+
+  std::vector<table_view> views;
+  for (auto const& result : results) { views.push_back(result.tbl->view()); }
+  return {cudf::concatenate(views, mr), std::move(results[0].metadata)};
+}
+
+/**
+ * @brief Partitions a table read, releasing each column read once it is copied in partition order
+ *
+ * The partitioned order of the rows is that of their indices partitioned along with the hashed
+ * columns, so only these are partitioned as a whole. The other columns are then gathered in that
+ * order one at a time.
+ *
+ * @param read The table read and its metadata
+ * @param partitioning Partitioning of the rows
+ * @param mr Device memory resource used to allocate device memory of the returned table
+ */
+partitioned_table_with_metadata partition_read(table_with_metadata&& read,
+                                               read_partitioning const& partitioning,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(partitioning.num_partitions > 0, "Invalid number of partitions");
+  auto const input    = read.tbl->view();
+  auto const num_rows = input.num_rows();
+
+  auto indices = cudf::sequence(num_rows, numeric_scalar<size_type>(0));
+  std::pair<std::unique_ptr<table>, std::vector<size_type>> order;
+  if (not partitioning.columns_to_hash.empty()) {
+    std::vector<column_view> columns;
+    for (auto const index : partitioning.columns_to_hash) {
+      columns.push_back(input.column(index));
+    }
+    columns.push_back(indices->view());
+    std::vector<size_type> columns_to_hash(partitioning.columns_to_hash.size());
+    std::iota(columns_to_hash.begin(), columns_to_hash.end(), 0);
+    order = cudf::hash_partition(table_view{columns},
+                                 columns_to_hash,
+                                 partitioning.num_partitions,
+                                 partitioning.hash_function);
+  } else if (partitioning.num_partitions > 1) {
+    order = cudf::round_robin_partition(
+      table_view{{indices->view()}}, partitioning.num_partitions, partitioning.start_partition);
+  } else {
+    // A single partition holds the rows in their order
+    std::vector<std::unique_ptr<column>> order_columns;
+    order_columns.push_back(std::move(indices));
+    order = {std::make_unique<table>(std::move(order_columns)), {0}};
   }
-  if (sink.type == io_type::VOID) {
-    return std::make_unique<writer>(cudf::io::data_sink::create(), options, mr);
+  auto const gather_map = order.first->view().column(order.first->num_columns() - 1);
+
+  auto columns = read.tbl->release();
+  for (auto& column : columns) {
+    auto partitioned = cudf::gather(table_view{{column->view()}}, gather_map, false, mr)->release();
+    column           = std::move(partitioned.front());
   }
+  return {std::make_unique<table>(std::move(columns)),
+          std::move(order.second),
+          std::move(read.metadata)};
+}
+
+std::unique_ptr<data_sink> make_sink(sink_info const& sink)
+{
+  if (sink.type == io_type::FILEPATH) { return cudf::io::data_sink::create(sink.filepath); }
+  if (sink.type == io_type::HOST_BUFFER) { return cudf::io::data_sink::create(sink.buffer); }
+  if (sink.type == io_type::VOID) { return cudf::io::data_sink::create(); }
   if (sink.type == io_type::USER_IMPLEMENTED) {
-    return std::make_unique<writer>(cudf::io::data_sink::create(sink.user_sink), options, mr);
+    return cudf::io::data_sink::create(sink.user_sink);
   }
   CUDF_FAIL("Unsupported sink type");
 }
 
+template <typename writer, typename writer_options>
+std::unique_ptr<writer> make_writer(sink_info const& sink,
+                                    writer_options const& options,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  return std::make_unique<writer>(make_sink(sink), options, mr);
+}
+
 }  // namespace
 
 // Freeform API wraps the detail reader class API
@@ -104,13 +262,10 @@ table_with_metadata read_json(read_json_args const& args, rmm::mr::device_memory
   }
 }
 
-// Freeform API wraps the detail reader class API
-table_with_metadata read_csv(read_csv_args const& args, rmm::mr::device_memory_resource* mr)
+namespace {
+cudf::io::detail::csv::reader_options make_csv_reader_options(read_csv_args const& args)
 {
-  namespace csv = cudf::io::detail::csv;
-
-  CUDF_FUNC_RANGE();
-  csv::reader_options options{};
+  cudf::io::detail::csv::reader_options options{};
   options.compression        = args.compression;
   options.lineterminator     = args.lineterminator;
   options.delimiter          = args.delimiter;
@@ -126,6 +281,7 @@ table_with_metadata read_csv(read_csv_args const& args, rmm::mr::device_memory_r
   options.infer_date_indexes = args.infer_date_indexes;
   options.names              = args.names;
   options.dtype              = args.dtype;
+  options.dtype_sample_rows  = args.dtype_sample_rows;
   options.use_cols_indexes   = args.use_cols_indexes;
   options.use_cols_names     = args.use_cols_names;
   options.true_values.insert(
@@ -145,7 +301,17 @@ table_with_metadata read_csv(read_csv_args const& args, rmm::mr::device_memory_r
   options.quoting          = args.quoting;
   options.doublequote      = args.doublequote;
   options.timestamp_type   = args.timestamp_type;
-  auto reader              = make_reader<csv::reader>(args.source, options, mr);
+  return options;
+}
+}  // namespace
+
+// Freeform API wraps the detail reader class API
+table_with_metadata read_csv(read_csv_args const& args, rmm::mr::device_memory_resource* mr)
+{
+  namespace csv = cudf::io::detail::csv;
+
+  CUDF_FUNC_RANGE();
+  auto reader = make_reader<csv::reader>(args.source, make_csv_reader_options(args), mr);
 
   if (args.byte_range_offset != 0 || args.byte_range_size != 0) {
     return reader->read_byte_range(args.byte_range_offset, args.byte_range_size);
@@ -156,6 +322,29 @@ table_with_metadata read_csv(read_csv_args const& args, rmm::mr::device_memory_r
   }
 }
 
+chunked_csv_reader::chunked_csv_reader(read_csv_args const& args,
+                                       size_t chunk_size,
+                                       rmm::mr::device_memory_resource* mr)
+  : _chunk_size(chunk_size)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(args.byte_range_offset == 0 && args.byte_range_size == 0,
+               "Byte range is not supported by chunked reads");
+  CUDF_EXPECTS(args.skiprows <= 0 && args.skipfooter <= 0 && args.nrows < 0,
+               "Row selection is not supported by chunked reads");
+  _reader = make_reader<detail::csv::reader>(args.source, make_csv_reader_options(args), mr);
+}
+
+chunked_csv_reader::~chunked_csv_reader() = default;
+
+bool chunked_csv_reader::has_next() const { return _reader->has_next_chunk(); }
+
+table_with_metadata chunked_csv_reader::read_chunk()
+{
+  CUDF_FUNC_RANGE();
+  return _reader->read_chunk(_chunk_size);
+}
+
 // Freeform API wraps the detail writer class API
 void write_csv(write_csv_args const& args, rmm::mr::device_memory_resource* mr)
 {
@@ -166,19 +355,39 @@ void write_csv(write_csv_args const& args, rmm::mr::device_memory_resource* mr)
   writer->write_all(args.table(), args.metadata());
 }
 
+// Freeform API wraps the detail writer class API
+void write_json(write_json_args const& args, rmm::mr::device_memory_resource* mr)
+{
+  namespace json = cudf::io::detail::json;
+
+  CUDF_FUNC_RANGE();
+  json::writer_options options{args.lines, args.include_nulls, args.rows_per_chunk};
+  auto writer = make_writer<json::writer>(args.sink, options, mr);
+
+  writer->write_all(args.table, args.metadata);
+}
+
 namespace detail_orc = cudf::io::detail::orc;
 
+namespace {
+detail_orc::reader_options make_orc_reader_options(read_orc_args const& args)
+{
+  return detail_orc::reader_options{args.columns,
+                                    args.use_index,
+                                    args.use_np_dtypes,
+                                    args.timestamp_type,
+                                    args.decimals_as_float,
+                                    args.forced_decimals_scale,
+                                    args.filters,
+                                    args.strings_to_dictionary};
+}
+}  // namespace
+
 // Freeform API wraps the detail reader class API
 table_with_metadata read_orc(read_orc_args const& args, rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  detail_orc::reader_options options{args.columns,
-                                     args.use_index,
-                                     args.use_np_dtypes,
-                                     args.timestamp_type,
-                                     args.decimals_as_float,
-                                     args.forced_decimals_scale};
-  auto reader = make_reader<detail_orc::reader>(args.source, options, mr);
+  auto reader = make_reader<detail_orc::reader>(args.source, make_orc_reader_options(args), mr);
 
   if (args.stripe_list.size() > 0) {
     return reader->read_stripes(args.stripe_list);
@@ -191,11 +400,81 @@ table_with_metadata read_orc(read_orc_args const& args, rmm::mr::device_memory_r
   }
 }
 
+/**
+ * @copydoc cudf::io::read_orc_partitioned
+ *
+ **/
+partitioned_table_with_metadata read_orc_partitioned(read_orc_args const& args,
+                                                     read_partitioning const& partitioning,
+                                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  // Only the partitioned table is allocated with `mr`, the table read being released as it goes
+  return partition_read(read_orc(args), partitioning, mr);
+}
+
+/**
+ * @copydoc cudf::io::plan_orc_read
+ *
+ **/
+std::vector<read_partition> plan_orc_read(read_orc_args const& args, size_type num_partitions)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(num_partitions > 0, "Invalid number of partitions");
+  CUDF_EXPECTS(args.stripe_list.empty() && args.stripe == -1 && args.skip_rows == -1 &&
+                 args.num_rows == -1,
+               "Stripe and row selection is not supported by read planning");
+
+  // The ORC reader handles a single source, so each source is opened separately
+  auto const options     = make_orc_reader_options(args);
+  auto const num_sources = get_num_sources(args.source);
+  std::vector<block_info> blocks;
+  for (size_t i = 0; i < num_sources; ++i) {
+    auto reader = make_reader<detail_orc::reader>(
+      select_sources(args.source, {i}), options, rmm::mr::get_default_resource());
+    for (auto block : reader->get_stripe_info()) {
+      block.source_index = static_cast<size_type>(i);
+      blocks.push_back(block);
+    }
+  }
+
+  return partition_blocks(blocks, num_sources, num_partitions);
+}
+
+/**
+ * @copydoc cudf::io::read_orc(read_orc_args const&, read_partition const&,
+ *rmm::mr::device_memory_resource*)
+ *
+ **/
+table_with_metadata read_orc(read_orc_args const& args,
+                             read_partition const& partition,
+                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  auto const num_sources = get_num_sources(args.source);
+  CUDF_EXPECTS(num_sources > 0 && partition.blocks.size() == num_sources,
+               "Must specify stripes for each source");
+
+  // Only the sources with assigned stripes are opened; the last one provides the schema of an
+  // empty partition
+  auto const options = make_orc_reader_options(args);
+  std::vector<table_with_metadata> results;
+  for (size_t i = 0; i < num_sources; ++i) {
+    if (partition.blocks[i].empty() && not(results.empty() && i + 1 == num_sources)) { continue; }
+    auto reader = make_reader<detail_orc::reader>(select_sources(args.source, {i}), options, mr);
+    results.push_back(reader->read_stripes(partition.blocks[i]));
+  }
+
+  return concatenate_results(std::move(results), mr);
+}
+
 // Freeform API wraps the detail writer class API
 void write_orc(write_orc_args const& args, rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
   detail_orc::writer_options options{args.compression, args.enable_statistics};
+  options.stripe_size_bytes = args.stripe_size_bytes;
+  options.stripe_size_rows  = args.stripe_size_rows;
   auto writer = make_writer<detail_orc::writer>(args.sink, options, mr);
 
   writer->write_all(args.table, args.metadata);
@@ -210,6 +489,8 @@ std::shared_ptr<detail_orc::orc_chunked_state> write_orc_chunked_begin(
 {
   CUDF_FUNC_RANGE();
   detail_orc::writer_options options{args.compression, args.enable_statistics};
+  options.stripe_size_bytes = args.stripe_size_bytes;
+  options.stripe_size_rows  = args.stripe_size_rows;
 
   auto state = std::make_shared<detail_orc::orc_chunked_state>();
   state->wp  = make_writer<detail_orc::writer>(args.sink, options, mr);
@@ -250,13 +531,25 @@ void write_orc_chunked_end(std::shared_ptr<detail_orc::orc_chunked_state>& state
 using namespace cudf::io::detail::parquet;
 namespace detail_parquet = cudf::io::detail::parquet;
 
+namespace {
+detail_parquet::reader_options make_parquet_reader_options(read_parquet_args const& args)
+{
+  return detail_parquet::reader_options{args.columns,
+                                        args.strings_to_categorical,
+                                        args.use_pandas_metadata,
+                                        args.timestamp_type,
+                                        args.filters,
+                                        args.strings_to_dictionary,
+                                        args.filter_rows};
+}
+}  // namespace
+
 // Freeform API wraps the detail reader class API
 table_with_metadata read_parquet(read_parquet_args const& args, rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  detail_parquet::reader_options options{
-    args.columns, args.strings_to_categorical, args.use_pandas_metadata, args.timestamp_type};
-  auto reader = make_reader<detail_parquet::reader>(args.source, options, mr);
+  auto reader =
+    make_reader<detail_parquet::reader>(args.source, make_parquet_reader_options(args), mr);
 
   if (args.row_groups.size() > 0) {
     return reader->read_row_groups(args.row_groups);
@@ -267,18 +560,154 @@ table_with_metadata read_parquet(read_parquet_args const& args, rmm::mr::device_
   }
 }
 
+/**
+ * @copydoc cudf::io::read_parquet_partitioned
+ *
+ **/
+partitioned_table_with_metadata read_parquet_partitioned(read_parquet_args const& args,
+                                                         read_partitioning const& partitioning,
+                                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  // Only the partitioned table is allocated with `mr`, the table read being released as it goes
+  return partition_read(read_parquet(args), partitioning, mr);
+}
+
+/**
+ * @copydoc cudf::io::read_parquet_into
+ *
+ **/
+read_into_result read_parquet_into(read_parquet_args const& args,
+                                   std::vector<mutable_column_view> const& outputs,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(args.row_groups.empty(), "Row group selection is not supported by read_parquet_into");
+  auto reader =
+    make_reader<detail_parquet::reader>(args.source, make_parquet_reader_options(args), mr);
+
+  return reader->read_rows_into(outputs, std::max(args.skip_rows, 0), std::max(args.num_rows, 0));
+}
+
+/**
+ * @copydoc cudf::io::plan_parquet_read
+ *
+ **/
+std::vector<read_partition> plan_parquet_read(read_parquet_args const& args,
+                                              size_type num_partitions)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(num_partitions > 0, "Invalid number of partitions");
+  CUDF_EXPECTS(args.row_groups.empty() && args.skip_rows == -1 && args.num_rows == -1,
+               "Row group and row selection is not supported by read planning");
+
+  auto reader = make_reader<detail_parquet::reader>(
+    args.source, make_parquet_reader_options(args), rmm::mr::get_default_resource());
+
+  return partition_blocks(
+    reader->get_row_group_info(), get_num_sources(args.source), num_partitions);
+}
+
+/**
+ * @copydoc cudf::io::read_parquet(read_parquet_args const&, read_partition const&,
+ *rmm::mr::device_memory_resource*)
+ *
+ **/
+table_with_metadata read_parquet(read_parquet_args const& args,
+                                 read_partition const& partition,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  auto const num_sources = get_num_sources(args.source);
+  CUDF_EXPECTS(num_sources > 0 && partition.blocks.size() == num_sources,
+               "Must specify row groups for each source");
+
+  // Only the sources with assigned row groups are opened; the first one provides the schema of
+  // an empty partition
+  std::vector<size_t> sources;
+  std::vector<std::vector<size_type>> row_groups;
+  for (size_t i = 0; i < num_sources; ++i) {
+    if (not partition.blocks[i].empty()) {
+      sources.push_back(i);
+      row_groups.push_back(partition.blocks[i]);
+    }
+  }
+  if (sources.empty()) {
+    sources.push_back(0);
+    row_groups.emplace_back();
+  }
+
+  auto reader = make_reader<detail_parquet::reader>(
+    select_sources(args.source, sources), make_parquet_reader_options(args), mr);
+  return reader->read_row_groups(row_groups);
+}
+
+chunked_parquet_reader::chunked_parquet_reader(read_parquet_args const& args,
+                                               size_t chunk_read_limit,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(args.row_groups.empty(), "Row group selection is not supported by chunked reads");
+  _reader = make_reader<detail_parquet::reader>(args.source, make_parquet_reader_options(args), mr);
+  _row_ranges = _reader->split_rows(
+    chunk_read_limit, std::max(args.skip_rows, 0), (args.num_rows > 0) ? args.num_rows : 0);
+}
+
+chunked_parquet_reader::~chunked_parquet_reader() = default;
+
+bool chunked_parquet_reader::has_next() const { return _next_range < _row_ranges.size(); }
+
+table_with_metadata chunked_parquet_reader::read_chunk()
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(has_next(), "No more chunks to read");
+  auto const& range = _row_ranges[_next_range++];
+  return _reader->read_rows(range.first, range.second);
+}
+
 // Freeform API wraps the detail writer class API
 std::unique_ptr<std::vector<uint8_t>> write_parquet(write_parquet_args const& args,
                                                     rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
   detail_parquet::writer_options options{args.compression, args.stats_level};
+  options.stats_truncate_length    = args.stats_truncate_length;
+  options.bloom_filter_columns     = args.bloom_filter_columns;
+  options.dictionary               = args.dictionary;
+  options.column_dictionary_policy = args.column_dictionary_policy;
+  options.delta_encoding_columns   = args.delta_encoding_columns;
+  options.row_group_size_bytes     = args.row_group_size_bytes;
+  options.row_group_size_rows      = args.row_group_size_rows;
+  options.max_page_size_bytes      = args.max_page_size_bytes;
+  options.max_page_size_rows       = args.max_page_size_rows;
   auto writer = make_writer<detail_parquet::writer>(args.sink, options, mr);
 
   return writer->write_all(
     args.table, args.metadata, args.return_filemetadata, args.metadata_out_file_path);
 }
 
+// Freeform API wraps the detail writer class API
+void write_parquet_partitioned(write_parquet_partitioned_args const& args,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  detail_parquet::writer_options options{args.compression, args.stats_level};
+  options.stats_truncate_length    = args.stats_truncate_length;
+  options.bloom_filter_columns     = args.bloom_filter_columns;
+  options.dictionary               = args.dictionary;
+  options.column_dictionary_policy = args.column_dictionary_policy;
+  options.delta_encoding_columns   = args.delta_encoding_columns;
+  options.row_group_size_bytes     = args.row_group_size_bytes;
+  options.row_group_size_rows      = args.row_group_size_rows;
+  options.max_page_size_bytes      = args.max_page_size_bytes;
+  options.max_page_size_rows       = args.max_page_size_rows;
+  std::vector<std::unique_ptr<data_sink>> sinks;
+  for (auto const& sink : args.sinks) { sinks.push_back(make_sink(sink)); }
+  detail_parquet::writer writer(std::move(sinks), options, mr);
+
+  writer.write_partitioned(args.table, args.partition_offsets, args.metadata);
+}
+
 /**
  * @copydoc cudf::io::merge_rowgroup_metadata
  *
@@ -299,6 +728,15 @@ std::shared_ptr<pq_chunked_state> write_parquet_chunked_begin(
 {
   CUDF_FUNC_RANGE();
   detail_parquet::writer_options options{args.compression, args.stats_level};
+  options.stats_truncate_length    = args.stats_truncate_length;
+  options.bloom_filter_columns     = args.bloom_filter_columns;
+  options.dictionary               = args.dictionary;
+  options.column_dictionary_policy = args.column_dictionary_policy;
+  options.delta_encoding_columns   = args.delta_encoding_columns;
+  options.row_group_size_bytes     = args.row_group_size_bytes;
+  options.row_group_size_rows      = args.row_group_size_rows;
+  options.max_page_size_bytes      = args.max_page_size_bytes;
+  options.max_page_size_rows       = args.max_page_size_rows;
 
   auto state = std::make_shared<pq_chunked_state>();
   state->wp  = make_writer<detail_parquet::writer>(args.sink, options, mr);
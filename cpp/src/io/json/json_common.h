@@ -30,6 +30,7 @@ struct ColumnInfo {
   cudf::size_type int_count;
   cudf::size_type bool_count;
   cudf::size_type null_count;
+  cudf::size_type list_count;
 };
 
 }  // namespace json
@@ -93,6 +93,42 @@ __device__ long seek_field_name_end(const char *data,
   return stop;
 }
 
+/**
+ * @brief CUDA kernel that finds the end of the field that starts at the given position.
+ *
+ * Delimiters within quotes or within nested arrays and objects do not end the field.
+ *
+ * @param[in] data Pointer to the device buffer containing the data to process
+ * @param[in] opts Parsing options (e.g. delimiter and quotation character)
+ * @param[in] start Offset of the first character of the field
+ * @param[in] stop Offset of the first character after the range
+ *
+ * @return long Position of the delimiter that follows the field, or `stop`
+ **/
+__device__ long seek_json_field_end(const char *data,
+                                    const ParseOptions opts,
+                                    long start,
+                                    long stop)
+{
+  bool quotation = false;
+  int depth      = 0;
+  for (auto pos = start; pos < stop; ++pos) {
+    // Ignore escaped quotes
+    if (data[pos] == opts.quotechar && (pos == 0 || data[pos - 1] != '\\')) {
+      quotation = !quotation;
+    } else if (!quotation) {
+      if (data[pos] == '[' || data[pos] == '{') {
+        ++depth;
+      } else if (data[pos] == ']' || data[pos] == '}') {
+        depth -= (depth > 0);
+      } else if (depth == 0 && (data[pos] == opts.delimiter || data[pos] == opts.terminator)) {
+        return pos;
+      }
+    }
+  }
+  return stop;
+}
+
 /**
  * @brief Decodes a numeric value base on templated cudf type T with specified
  * base.
@@ -371,6 +407,44 @@ __inline__ __device__ void trim_field_start_end(const char *data,
   if ((*start <= *end) && data[*end] == quotechar) { (*end)--; }
 }
 
+/**
+ * @brief Returns whether the trimmed field is a JSON array.
+ *
+ * @param[in] data The character stream
+ * @param[in] start The index of the first character of the field
+ * @param[in] end The index of the last character of the field
+ **/
+__inline__ __device__ bool is_list_field(const char *data, long start, long end)
+{
+  return start < end && data[start] == '[' && data[end] == ']';
+}
+
+/**
+ * @brief Invokes a functor with the index, the first and the last character of each element
+ * of a JSON array, ignoring the whitespace around the elements.
+ *
+ * @param[in] data The character stream
+ * @param[in] opts A set of parsing options
+ * @param[in] start The index of the opening square bracket
+ * @param[in] end The index of the closing square bracket
+ * @param[in] f The functor to invoke for each element
+ **/
+template <typename Functor>
+__inline__ __device__ void for_each_list_element(
+  const char *data, ParseOptions const &opts, long start, long end, Functor f)
+{
+  cudf::size_type index = 0;
+  for (long pos = start + 1; pos < end;) {
+    const long elem_end = seek_json_field_end(data, opts, pos, end);
+    long elem_start     = pos;
+    long elem_last      = elem_end - 1;
+    trim_field_start_end(data, &elem_start, &elem_last);
+    // A blank element is only skipped at the end, so that `[ ]` is an empty list
+    if (elem_start <= elem_last || elem_end < end) { f(index++, elem_start, elem_last); }
+    pos = elem_end + 1;
+  }
+}
+
 /**
  * @brief Returns true is the input character is a valid digit.
  * Supports both decimal and hexadecimal digits (uppercase and lowercase).
@@ -460,15 +534,22 @@ __global__ void convert_json_to_columns_kernel(const char *data,
   for (int col = 0; col < num_columns && start < stop; col++) {
     if (is_object) { start = seek_field_name_end(data, opts, start, stop); }
     // field_end is at the next delimiter/newline
-    const long field_end = cudf::io::gpu::seek_field_end(data, opts, start, stop);
+    const long field_end = seek_json_field_end(data, opts, start, stop);
     long field_data_last = field_end - 1;
     // Modify start & end to ignore whitespace and quotechars
     trim_field_start_end(data, &start, &field_data_last, opts.quotechar);
     // Empty fields are not legal values
     if (start <= field_data_last &&
         !serializedTrieContains(opts.naValuesTrie, data + start, field_end - start)) {
+      // List elements are converted separately, once the list offsets are known
+      if (dtypes[col].id() == type_id::LIST) {
+        if (is_list_field(data, start, field_data_last)) {
+          set_bit(valid_fields[col], rec_id);
+          atomicAdd(&num_valid_fields[col], 1);
+        }
+      }
       // Type dispatcher does not handle strings
-      if (dtypes[col].id() == type_id::STRING) {
+      else if (dtypes[col].id() == type_id::STRING) {
         auto str_list           = static_cast<string_pair *>(output_columns[col]);
         str_list[rec_id].first  = data + start;
         str_list[rec_id].second = field_data_last - start + 1;
@@ -499,6 +580,105 @@ __global__ void convert_json_to_columns_kernel(const char *data,
   }
 }
 
+/**
+ * @brief Counts the value in the type counters of its column, based on the characters of the
+ * value.
+ *
+ * @param[in] data Input data buffer
+ * @param[in] opts A set of parsing options
+ * @param[in] field_start The index of the first character of the value
+ * @param[in] field_data_last The index of the last character of the value
+ * @param[out] column_info The counters of each data type
+ *
+ * @returns void
+ **/
+__device__ void classify_value(const char *data,
+                               const ParseOptions &opts,
+                               long field_start,
+                               long field_data_last,
+                               ColumnInfo *column_info)
+{
+  const int field_len = field_data_last - field_start + 1;
+
+  // Checking if the field is empty
+  if (field_start > field_data_last ||
+      serializedTrieContains(opts.naValuesTrie, data + field_start, field_len)) {
+    atomicAdd(&column_info->null_count, 1);
+    return;
+  }
+  // Don't need counts to detect strings, any field in quotes is deduced to be a string
+  if (data[field_start] == opts.quotechar && data[field_data_last] == opts.quotechar) {
+    atomicAdd(&column_info->string_count, 1);
+    return;
+  }
+
+  int digit_count    = 0;
+  int decimal_count  = 0;
+  int slash_count    = 0;
+  int dash_count     = 0;
+  int colon_count    = 0;
+  int exponent_count = 0;
+  int other_count    = 0;
+
+  const bool maybe_hex =
+    ((field_len > 2 && data[field_start] == '0' && data[field_start + 1] == 'x') ||
+     (field_len > 3 && data[field_start] == '-' && data[field_start + 1] == '0' &&
+      data[field_start + 2] == 'x'));
+  for (long pos = field_start; pos <= field_data_last; pos++) {
+    if (is_digit(data[pos], maybe_hex)) {
+      digit_count++;
+      continue;
+    }
+    // Looking for unique characters that will help identify column types
+    switch (data[pos]) {
+      case '.': decimal_count++; break;
+      case '-': dash_count++; break;
+      case '/': slash_count++; break;
+      case ':': colon_count++; break;
+      case 'e':
+      case 'E':
+        if (!maybe_hex && pos > field_start && pos < field_data_last) exponent_count++;
+        break;
+      default: other_count++; break;
+    }
+  }
+
+  // Integers have to have the length of the string
+  int int_req_number_cnt = field_len;
+  // Off by one if they start with a minus sign
+  if (data[field_start] == '-' && field_len > 1) { --int_req_number_cnt; }
+  // Off by one if they are a hexadecimal number
+  if (maybe_hex) { --int_req_number_cnt; }
+  if (serializedTrieContains(opts.trueValuesTrie, data + field_start, field_len) ||
+      serializedTrieContains(opts.falseValuesTrie, data + field_start, field_len)) {
+    atomicAdd(&column_info->bool_count, 1);
+  } else if (digit_count == int_req_number_cnt) {
+    atomicAdd(&column_info->int_count, 1);
+  } else if (is_like_float(field_len, digit_count, decimal_count, dash_count, exponent_count)) {
+    atomicAdd(&column_info->float_count, 1);
+  }
+  // A date-time field cannot have more than 3 non-special characters
+  // A number field cannot have more than one decimal point
+  else if (other_count > 3 || decimal_count > 1) {
+    atomicAdd(&column_info->string_count, 1);
+  } else {
+    // A date field can have either one or two '-' or '\'; A legal combination will only have one
+    // of them To simplify the process of auto column detection, we are not covering all the
+    // date-time formation permutations
+    if ((dash_count > 0 && dash_count <= 2 && slash_count == 0) ||
+        (dash_count == 0 && slash_count > 0 && slash_count <= 2)) {
+      if (colon_count <= 2) {
+        atomicAdd(&column_info->datetime_count, 1);
+      } else {
+        atomicAdd(&column_info->string_count, 1);
+      }
+    } else {
+      // Default field type is string
+      atomicAdd(&column_info->string_count, 1);
+    }
+  }
+}
+
 /**
  * @brief CUDA kernel that processes a buffer of data and determines information about the
  * column types within.
@@ -513,6 +693,7 @@ __global__ void convert_json_to_columns_kernel(const char *data,
  * @param[in] rec_starts The start the input data of interest
  * @param[in] num_records The number of lines/rows of input data
  * @param[out] column_infos The count for each column data type
+ * @param[out] element_infos The count for each data type of the list elements in each column
  *
  * @returns void
  **/
@@ -522,7 +703,8 @@ __global__ void detect_json_data_types(const char *data,
                                        int num_columns,
                                        const uint64_t *rec_starts,
                                        cudf::size_type num_records,
-                                       ColumnInfo *column_infos)
+                                       ColumnInfo *column_infos,
+                                       ColumnInfo *element_infos)
 {
   long rec_id = threadIdx.x + (blockDim.x * blockIdx.x);
   if (rec_id >= num_records) return;
@@ -537,90 +719,158 @@ __global__ void detect_json_data_types(const char *data,
   for (int col = 0; col < num_columns; col++) {
     if (is_object) { start = seek_field_name_end(data, opts, start, stop); }
     auto field_start     = start;
-    const long field_end = cudf::io::gpu::seek_field_end(data, opts, field_start, stop);
+    const long field_end = seek_json_field_end(data, opts, field_start, stop);
     long field_data_last = field_end - 1;
     trim_field_start_end(data, &field_start, &field_data_last);
-    const int field_len = field_data_last - field_start + 1;
     // Advance the start offset
     start = field_end + 1;
 
-    // Checking if the field is empty
-    if (field_start > field_data_last ||
-        serializedTrieContains(opts.naValuesTrie, data + field_start, field_len)) {
-      atomicAdd(&column_infos[col].null_count, 1);
-      continue;
-    }
-    // Don't need counts to detect strings, any field in quotes is deduced to be a string
-    if (data[field_start] == opts.quotechar && data[field_data_last] == opts.quotechar) {
-      atomicAdd(&column_infos[col].string_count, 1);
-      continue;
+    if (is_list_field(data, field_start, field_data_last)) {
+      atomicAdd(&column_infos[col].list_count, 1);
+      for_each_list_element(
+        data, opts, field_start, field_data_last, [&](cudf::size_type, long first, long last) {
+          // Nested arrays and objects are kept as strings
+          if (data[first] == '[' || data[first] == '{') {
+            atomicAdd(&element_infos[col].string_count, 1);
+          } else {
+            classify_value(data, opts, first, last, &element_infos[col]);
+          }
+        });
+    } else {
+      classify_value(data, opts, field_start, field_data_last, &column_infos[col]);
     }
+  }
+}
 
-    int digit_count    = 0;
-    int decimal_count  = 0;
-    int slash_count    = 0;
-    int dash_count     = 0;
-    int colon_count    = 0;
-    int exponent_count = 0;
-    int other_count    = 0;
-
-    const bool maybe_hex =
-      ((field_len > 2 && data[field_start] == '0' && data[field_start + 1] == 'x') ||
-       (field_len > 3 && data[field_start] == '-' && data[field_start + 1] == '0' &&
-        data[field_start + 2] == 'x'));
-    for (long pos = field_start; pos <= field_data_last; pos++) {
-      if (is_digit(data[pos], maybe_hex)) {
-        digit_count++;
-        continue;
-      }
-      // Looking for unique characters that will help identify column types
-      switch (data[pos]) {
-        case '.': decimal_count++; break;
-        case '-': dash_count++; break;
-        case '/': slash_count++; break;
-        case ':': colon_count++; break;
-        case 'e':
-        case 'E':
-          if (!maybe_hex && pos > field_start && pos < field_data_last) exponent_count++;
-          break;
-        default: other_count++; break;
-      }
-    }
+/**
+ * @brief CUDA kernel that counts the elements of every list, for each list column.
+ *
+ * The element count of each record is written at the record's position in the output; a
+ * subsequent exclusive scan yields the list offsets.
+ *
+ * @param[in] data The entire data to read
+ * @param[in] data_size Size of the data buffer, in bytes
+ * @param[in] rec_starts The start of each data record
+ * @param[in] num_records The number of lines/rows
+ * @param[in] dtypes The data type of each column
+ * @param[in] opts A set of parsing options
+ * @param[in] num_columns The number of columns
+ * @param[out] list_sizes The element counts of each list column; null for other columns
+ *
+ * @return void
+ **/
+__global__ void count_list_elements_kernel(const char *data,
+                                           size_t data_size,
+                                           const uint64_t *rec_starts,
+                                           cudf::size_type num_records,
+                                           const data_type *dtypes,
+                                           ParseOptions opts,
+                                           int num_columns,
+                                           cudf::size_type *const *list_sizes)
+{
+  const long rec_id = threadIdx.x + (blockDim.x * blockIdx.x);
+  if (rec_id >= num_records) return;
+
+  long start = rec_starts[rec_id];
+  // has the same semantics as end() in STL containers (one past last element)
+  long stop = ((rec_id < num_records - 1) ? rec_starts[rec_id + 1] : data_size);
 
-    // Integers have to have the length of the string
-    int int_req_number_cnt = field_len;
-    // Off by one if they start with a minus sign
-    if (data[field_start] == '-' && field_len > 1) { --int_req_number_cnt; }
-    // Off by one if they are a hexadecimal number
-    if (maybe_hex) { --int_req_number_cnt; }
-    if (serializedTrieContains(opts.trueValuesTrie, data + field_start, field_len) ||
-        serializedTrieContains(opts.falseValuesTrie, data + field_start, field_len)) {
-      atomicAdd(&column_infos[col].bool_count, 1);
-    } else if (digit_count == int_req_number_cnt) {
-      atomicAdd(&column_infos[col].int_count, 1);
-    } else if (is_like_float(field_len, digit_count, decimal_count, dash_count, exponent_count)) {
-      atomicAdd(&column_infos[col].float_count, 1);
+  limit_range_to_brackets(data, start, stop);
+  const bool is_object = (data[start - 1] == '{');
+
+  for (int col = 0; col < num_columns && start < stop; col++) {
+    if (is_object) { start = seek_field_name_end(data, opts, start, stop); }
+    const long field_end = seek_json_field_end(data, opts, start, stop);
+    long field_data_last = field_end - 1;
+    trim_field_start_end(data, &start, &field_data_last);
+    if (dtypes[col].id() == type_id::LIST && is_list_field(data, start, field_data_last)) {
+      cudf::size_type count = 0;
+      for_each_list_element(
+        data, opts, start, field_data_last, [&](cudf::size_type, long, long) { ++count; });
+      list_sizes[col][rec_id] = count;
     }
-    // A date-time field cannot have more than 3 non-special characters
-    // A number field cannot have more than one decimal point
-    else if (other_count > 3 || decimal_count > 1) {
-      atomicAdd(&column_infos[col].string_count, 1);
-    } else {
-      // A date field can have either one or two '-' or '\'; A legal combination will only have one
-      // of them To simplify the process of auto column detection, we are not covering all the
-      // date-time formation permutations
-      if ((dash_count > 0 && dash_count <= 2 && slash_count == 0) ||
-          (dash_count == 0 && slash_count > 0 && slash_count <= 2)) {
-        if (colon_count <= 2) {
-          atomicAdd(&column_infos[col].datetime_count, 1);
-        } else {
-          atomicAdd(&column_infos[col].string_count, 1);
-        }
-      } else {
-        // Default field type is string
-        atomicAdd(&column_infos[col].string_count, 1);
-      }
+    start = field_end + 1;
+  }
+}
+
+/**
+ * @brief CUDA kernel that parses and converts the list elements into the child columns of the
+ * list columns.
+ *
+ * @param[in] data The entire data to read
+ * @param[in] data_size Size of the data buffer, in bytes
+ * @param[in] rec_starts The start of each data record
+ * @param[in] num_records The number of lines/rows
+ * @param[in] dtypes The data type of each column
+ * @param[in] element_dtypes The data type of the list elements of each column
+ * @param[in] opts A set of parsing options
+ * @param[in] num_columns The number of columns
+ * @param[in] list_offsets The list offsets of each list column; null for other columns
+ * @param[out] element_columns The output list element data
+ * @param[out] element_valid The bitmaps indicating whether list elements are valid
+ * @param[out] num_valid_elements The numbers of valid list elements in columns
+ *
+ * @return void
+ **/
+__global__ void convert_list_elements_kernel(const char *data,
+                                             size_t data_size,
+                                             const uint64_t *rec_starts,
+                                             cudf::size_type num_records,
+                                             const data_type *dtypes,
+                                             const data_type *element_dtypes,
+                                             ParseOptions opts,
+                                             int num_columns,
+                                             cudf::size_type const *const *list_offsets,
+                                             void *const *element_columns,
+                                             bitmask_type *const *element_valid,
+                                             cudf::size_type *num_valid_elements)
+{
+  const long rec_id = threadIdx.x + (blockDim.x * blockIdx.x);
+  if (rec_id >= num_records) return;
+
+  long start = rec_starts[rec_id];
+  // has the same semantics as end() in STL containers (one past last element)
+  long stop = ((rec_id < num_records - 1) ? rec_starts[rec_id + 1] : data_size);
+
+  limit_range_to_brackets(data, start, stop);
+  const bool is_object = (data[start - 1] == '{');
+
+  for (int col = 0; col < num_columns && start < stop; col++) {
+    if (is_object) { start = seek_field_name_end(data, opts, start, stop); }
+    const long field_end = seek_json_field_end(data, opts, start, stop);
+    long field_data_last = field_end - 1;
+    trim_field_start_end(data, &start, &field_data_last);
+    if (dtypes[col].id() == type_id::LIST && is_list_field(data, start, field_data_last)) {
+      const auto offset = list_offsets[col][rec_id];
+      const auto dtype  = element_dtypes[col];
+      for_each_list_element(
+        data, opts, start, field_data_last, [&](cudf::size_type index, long first, long last) {
+          const auto row = offset + index;
+          // Modify start & end to ignore quotechars
+          trim_field_start_end(data, &first, &last, opts.quotechar);
+          const bool is_valid =
+            first <= last &&
+            !serializedTrieContains(opts.naValuesTrie, data + first, last - first + 1);
+          if (dtype.id() == type_id::STRING) {
+            auto str_list        = static_cast<string_pair *>(element_columns[col]);
+            str_list[row].first  = is_valid ? data + first : nullptr;
+            str_list[row].second = is_valid ? last - first + 1 : 0;
+          }
+          if (is_valid && (dtype.id() == type_id::STRING ||
+                           cudf::type_dispatcher(dtype,
+                                                 ConvertFunctor{},
+                                                 data,
+                                                 element_columns[col],
+                                                 row,
+                                                 first,
+                                                 last,
+                                                 opts))) {
+            set_bit(element_valid[col], row);
+            atomicAdd(&num_valid_elements[col], 1);
+          }
+        });
     }
+    start = field_end + 1;
   }
 }
 
@@ -668,6 +918,7 @@ void convert_json_to_columns(rmm::device_buffer const &input_data,
  *
  **/
 void detect_data_types(ColumnInfo *column_infos,
+                       ColumnInfo *element_infos,
                        const char *data,
                        size_t data_size,
                        const ParseOptions &options,
@@ -684,7 +935,81 @@ void detect_data_types(ColumnInfo *column_infos,
   const int grid_size = (num_records + block_size - 1) / block_size;
 
   detect_json_data_types<<<grid_size, block_size, 0, stream>>>(
-    data, data_size, options, num_columns, rec_starts, num_records, column_infos);
+    data, data_size, options, num_columns, rec_starts, num_records, column_infos, element_infos);
+
+  CUDA_TRY(cudaGetLastError());
+}
+
+/**
+ * @copydoc cudf::io::json::gpu::count_list_elements
+ *
+ **/
+void count_list_elements(rmm::device_buffer const &input_data,
+                         data_type const *dtypes,
+                         cudf::size_type *const *list_sizes,
+                         cudf::size_type num_records,
+                         cudf::size_type num_columns,
+                         const uint64_t *rec_starts,
+                         ParseOptions const &opts,
+                         cudaStream_t stream)
+{
+  int block_size;
+  int min_grid_size;
+  CUDA_TRY(
+    cudaOccupancyMaxPotentialBlockSize(&min_grid_size, &block_size, count_list_elements_kernel));
+
+  const int grid_size = (num_records + block_size - 1) / block_size;
+
+  count_list_elements_kernel<<<grid_size, block_size, 0, stream>>>(
+    static_cast<const char *>(input_data.data()),
+    input_data.size(),
+    rec_starts,
+    num_records,
+    dtypes,
+    opts,
+    num_columns,
+    list_sizes);
+
+  CUDA_TRY(cudaGetLastError());
+}
+
+/**
+ * @copydoc cudf::io::json::gpu::convert_list_elements
+ *
+ **/
+void convert_list_elements(rmm::device_buffer const &input_data,
+                           data_type const *dtypes,
+                           data_type const *element_dtypes,
+                           cudf::size_type const *const *list_offsets,
+                           void *const *element_columns,
+                           cudf::size_type num_records,
+                           cudf::size_type num_columns,
+                           const uint64_t *rec_starts,
+                           bitmask_type *const *element_valid,
+                           cudf::size_type *num_valid_elements,
+                           ParseOptions const &opts,
+                           cudaStream_t stream)
+{
+  int block_size;
+  int min_grid_size;
+  CUDA_TRY(
+    cudaOccupancyMaxPotentialBlockSize(&min_grid_size, &block_size, convert_list_elements_kernel));
+
+  const int grid_size = (num_records + block_size - 1) / block_size;
+
+  convert_list_elements_kernel<<<grid_size, block_size, 0, stream>>>(
+    static_cast<const char *>(input_data.data()),
+    input_data.size(),
+    rec_starts,
+    num_records,
+    dtypes,
+    element_dtypes,
+    opts,
+    num_columns,
+    list_offsets,
+    element_columns,
+    element_valid,
+    num_valid_elements);
 
   CUDA_TRY(cudaGetLastError());
 }
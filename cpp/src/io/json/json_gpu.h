@@ -54,6 +54,7 @@ void convert_json_to_columns(rmm::device_buffer const &input_data,
  * @brief Process a buffer of data and determine information about the column types within.
  *
  * @param[out] column_infos The count for each column data type
+ * @param[out] element_infos The count for each data type of the list elements in each column
  * @param[in] data Input data buffer
  * @param[in] data_size Size of the data buffer, in bytes
  * @param[in] opts A set of parsing options
@@ -65,6 +66,7 @@ void convert_json_to_columns(rmm::device_buffer const &input_data,
  * @returns void
  **/
 void detect_data_types(ColumnInfo *column_infos,
+                       ColumnInfo *element_infos,
                        const char *data,
                        size_t data_size,
                        const ParseOptions &options,
@@ -73,6 +75,63 @@ void detect_data_types(ColumnInfo *column_infos,
                        cudf::size_type num_records,
                        cudaStream_t stream = 0);
 
+/**
+ * @brief Count the elements of each list in the list columns.
+ *
+ * The count of each record is written at the position of the record, so that an exclusive scan
+ * of the counts yields the offsets of the lists.
+ *
+ * @param[in] input_data The entire data to read
+ * @param[in] dtypes The data type of each column
+ * @param[out] list_sizes The element counts of each list column; null for other columns
+ * @param[in] num_records The number of lines/rows
+ * @param[in] num_columns The number of columns
+ * @param[in] rec_starts The start of each data record
+ * @param[in] opts A set of parsing options
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @returns void
+ **/
+void count_list_elements(rmm::device_buffer const &input_data,
+                         data_type const *dtypes,
+                         cudf::size_type *const *list_sizes,
+                         cudf::size_type num_records,
+                         cudf::size_type num_columns,
+                         const uint64_t *rec_starts,
+                         ParseOptions const &opts,
+                         cudaStream_t stream = 0);
+
+/**
+ * @brief Convert the elements of each list in the list columns into their child columns.
+ *
+ * @param[in] input_data The entire data to read
+ * @param[in] dtypes The data type of each column
+ * @param[in] element_dtypes The data type of the list elements of each column
+ * @param[in] list_offsets The list offsets of each list column; null for other columns
+ * @param[out] element_columns The output list element data
+ * @param[in] num_records The number of lines/rows
+ * @param[in] num_columns The number of columns
+ * @param[in] rec_starts The start of each data record
+ * @param[out] element_valid The bitmaps indicating whether list elements are valid
+ * @param[out] num_valid_elements The numbers of valid list elements in columns
+ * @param[in] opts A set of parsing options
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @returns void
+ **/
+void convert_list_elements(rmm::device_buffer const &input_data,
+                           data_type const *dtypes,
+                           data_type const *element_dtypes,
+                           cudf::size_type const *const *list_offsets,
+                           void *const *element_columns,
+                           cudf::size_type num_records,
+                           cudf::size_type num_columns,
+                           const uint64_t *rec_starts,
+                           bitmask_type *const *element_valid,
+                           cudf::size_type *num_valid_elements,
+                           ParseOptions const &opts,
+                           cudaStream_t stream = 0);
+
 }  // namespace gpu
 }  // namespace json
 }  // namespace io
@@ -24,6 +24,7 @@
 #include <rmm/thrust_rmm_allocator.h>
 
 #include <cudf/detail/utilities/trie.cuh>
+#include <cudf/dictionary/detail/encode.hpp>
 #include <cudf/io/readers.hpp>
 #include <cudf/utilities/error.hpp>
 
@@ -33,6 +34,11 @@
 
 #include <cudf/table/table.hpp>
 
+#include <thrust/scan.h>
+
+#include <algorithm>
+#include <future>
+
 namespace cudf {
 namespace io {
 namespace detail {
@@ -54,6 +60,7 @@ std::vector<std::string> get_names_from_json_object(const std::vector<char> &jso
   enum class ParseState { preColName, colName, postColName };
   std::vector<std::string> names;
   bool quotation = false;
+  int depth      = 0;  // Nesting level of the arrays and objects within the values
   auto state     = ParseState::preColName;
   int name_start = 0;
   for (size_t pos = 0; pos < json_obj.size(); ++pos) {
@@ -71,12 +78,15 @@ std::vector<std::string> get_names_from_json_object(const std::vector<char> &jso
         continue;
       }
     } else if (state == ParseState::postColName) {
-      // TODO handle complex data types that might include unquoted commas
-      if (!quotation && json_obj[pos] == opts.delimiter) {
+      if (!quotation && depth == 0 && json_obj[pos] == opts.delimiter) {
         state = ParseState::preColName;
         continue;
-      } else if (json_obj[pos] == opts.quotechar) {
+      } else if (json_obj[pos] == opts.quotechar && json_obj[pos - 1] != '\\') {
         quotation = !quotation;
+      } else if (!quotation && (json_obj[pos] == '[' || json_obj[pos] == '{')) {
+        ++depth;
+      } else if (!quotation && (json_obj[pos] == ']' || json_obj[pos] == '}')) {
+        depth -= (depth > 0);
       }
     }
   }
@@ -113,7 +123,7 @@ constexpr size_t calculate_max_row_size(int num_columns = 0) noexcept
 /**
  * @brief Ingest input JSON file/buffer, without decompression
  *
- * Sets the source_, byte_range_offset_, and byte_range_size_ data members
+ * Sets the sources_, buffers_, byte_range_offset_, and byte_range_size_ data members
  *
  * @param[in] range_offset Number of bytes offset from the start
  * @param[in] range_size Bytes to read; use `0` for all remaining data
@@ -127,19 +137,51 @@ void reader::impl::ingest_raw_input(size_t range_offset, size_t range_size)
 
   // Support delayed opening of the file if using memory mapping datasource
   // This allows only mapping of a subset of the file if using byte range
-  if (source_ == nullptr) {
-    assert(!filepath_.empty());
-    source_ = datasource::create(filepath_, range_offset, map_range_size);
+  if (sources_.empty()) {
+    assert(!filepaths_.empty());
+    if (filepaths_.size() == 1) {
+      sources_.emplace_back(datasource::create(filepaths_[0], range_offset, map_range_size));
+    } else {
+      sources_ = datasource::create(filepaths_);
+    }
   }
-
-  if (!source_->is_empty()) {
-    auto data_size = (map_range_size != 0) ? map_range_size : source_->size();
-    buffer_        = source_->host_read(range_offset, data_size);
+  if (sources_.size() > 1) {
+    CUDF_EXPECTS(range_offset == 0 && range_size == 0,
+                 "Byte range is not supported with multiple sources");
   }
 
   byte_range_offset_ = range_offset;
   byte_range_size_   = range_size;
   load_whole_file_   = byte_range_offset_ == 0 && byte_range_size_ == 0;
+
+  // Uncompressed data of a single source is later read straight into device memory
+  read_to_device_ = load_whole_file_ && sources_.size() == 1 && !allow_newlines_in_strings_ &&
+                    get_compression_type(0) == "none";
+
+  buffers_.clear();
+  for (auto const &source : sources_) {
+    if (!source->is_empty() && !read_to_device_) {
+      auto data_size = (map_range_size != 0) ? map_range_size : source->size();
+      buffers_.emplace_back(source->host_read(range_offset, data_size));
+    } else {
+      buffers_.emplace_back(nullptr);
+    }
+  }
+}
+
+/**
+ * @brief Returns the compression type of a source
+ *
+ * @param[in] source_index Index of the source
+ *
+ * @return Compression type name; "none" if not compressed
+ **/
+std::string reader::impl::get_compression_type(size_t source_index) const
+{
+  return infer_compression_type(
+    args_.compression,
+    (source_index < filepaths_.size()) ? filepaths_[source_index] : std::string{},
+    {{"gz", "gzip"}, {"zip", "zip"}, {"bz2", "bz2"}, {"xz", "xz"}});
 }
 
 /**
@@ -148,23 +190,75 @@ void reader::impl::ingest_raw_input(size_t range_offset, size_t range_size)
  * Sets the uncomp_data_ and uncomp_size_ data members
  * Loads the data into device memory if byte range parameters are not used
  *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ *
  * @return void
  **/
-void reader::impl::decompress_input()
+void reader::impl::decompress_input(cudaStream_t stream)
 {
-  const auto compression_type = infer_compression_type(
-    args_.compression, filepath_, {{"gz", "gzip"}, {"zip", "zip"}, {"bz2", "bz2"}, {"xz", "xz"}});
-  if (compression_type == "none") {
+  if (read_to_device_) {
+    // Copy the data to the device piece by piece, reading the next piece from the source while
+    // the previous one is copied, instead of holding the whole data in host memory
+    constexpr size_t max_piece_bytes = 64 * 1024 * 1024;  // 64MB
+    auto const &source               = sources_[0];
+    uncomp_data_                     = nullptr;
+    uncomp_size_                     = source->size();
+    data_                            = rmm::device_buffer(uncomp_size_, stream);
+    auto const read_piece            = [&](size_t offset) {
+      auto const size = std::min(max_piece_bytes, uncomp_size_ - offset);
+      return std::async(std::launch::async,
+                        [&source, offset, size]() { return source->host_read(offset, size); });
+    };
+    auto next_piece = read_piece(0);
+    for (size_t offset = 0; offset < uncomp_size_; offset += max_piece_bytes) {
+      auto const piece = next_piece.get();
+      if (offset + max_piece_bytes < uncomp_size_) {
+        next_piece = read_piece(offset + max_piece_bytes);
+      }
+      CUDA_TRY(cudaMemcpyAsync(static_cast<char *>(data_.data()) + offset,
+                               piece->data(),
+                               piece->size(),
+                               cudaMemcpyHostToDevice,
+                               stream));
+      // The piece is released once its copy completes
+      CUDA_TRY(cudaStreamSynchronize(stream));
+    }
+    return;
+  }
+
+  auto const compression_type = [&](size_t i) { return get_compression_type(i); };
+  if (buffers_.size() == 1 && compression_type(0) == "none") {
     // Do not use the owner vector here to avoid extra copy
-    uncomp_data_ = reinterpret_cast<const char *>(buffer_->data());
-    uncomp_size_ = buffer_->size();
-  } else {
-    getUncompressedHostData(reinterpret_cast<const char *>(buffer_->data()),
-                            buffer_->size(),
-                            compression_type,
+    uncomp_data_ = reinterpret_cast<const char *>(buffers_[0]->data());
+    uncomp_size_ = buffers_[0]->size();
+  } else if (buffers_.size() == 1) {
+    getUncompressedHostData(reinterpret_cast<const char *>(buffers_[0]->data()),
+                            buffers_[0]->size(),
+                            compression_type(0),
                             uncomp_data_owner_);
     uncomp_data_ = uncomp_data_owner_.data();
     uncomp_size_ = uncomp_data_owner_.size();
+  } else {
+    // Join the records of all the sources, so that they are all parsed at once
+    std::vector<char> h_uncomp_data;
+    uncomp_data_owner_.resize(0);
+    for (size_t i = 0; i < buffers_.size(); ++i) {
+      if (buffers_[i] == nullptr) { continue; }
+      const char *data = reinterpret_cast<const char *>(buffers_[i]->data());
+      size_t size      = buffers_[i]->size();
+      if (compression_type(i) != "none") {
+        getUncompressedHostData(data, size, compression_type(i), h_uncomp_data);
+        data = h_uncomp_data.data();
+        size = h_uncomp_data.size();
+      }
+      if (size == 0) { continue; }
+      if (!uncomp_data_owner_.empty() && uncomp_data_owner_.back() != '\n') {
+        uncomp_data_owner_.push_back('\n');
+      }
+      uncomp_data_owner_.insert(uncomp_data_owner_.end(), data, data + size);
+    }
+    uncomp_data_ = uncomp_data_owner_.data();
+    uncomp_size_ = uncomp_data_owner_.size();
   }
   if (load_whole_file_) data_ = rmm::device_buffer(uncomp_data_, uncomp_size_);
 }
@@ -236,7 +330,18 @@ void reader::impl::set_record_starts(cudaStream_t stream)
   }
 
   // Exclude the ending newline as it does not precede a record start
-  if (uncomp_data_[uncomp_size_ - 1] == '\n') { filtered_count--; }
+  char last_char = '\0';
+  if (uncomp_data_ != nullptr) {
+    last_char = uncomp_data_[uncomp_size_ - 1];
+  } else {
+    CUDA_TRY(cudaMemcpyAsync(&last_char,
+                             static_cast<const char *>(data_.data()) + uncomp_size_ - 1,
+                             sizeof(char),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+  }
+  if (last_char == '\n') { filtered_count--; }
 
   rec_starts_.resize(filtered_count);
 }
@@ -252,6 +357,9 @@ void reader::impl::set_record_starts(cudaStream_t stream)
  **/
 void reader::impl::upload_data_to_device()
 {
+  // The entire data has already been loaded while decompressing
+  if (load_whole_file_) { return; }
+
   size_t start_offset = 0;
   size_t end_offset   = uncomp_size_;
 
@@ -329,14 +437,20 @@ void reader::impl::set_column_names(cudaStream_t stream)
   } else {
     int cols_found = 0;
     bool quotation = false;
+    int depth      = 0;  // Nesting level, including the top level array
     for (size_t pos = 0; pos < first_row.size(); ++pos) {
       // Flip the quotation flag if current character is a quotechar
       if (first_row[pos] == opts_.quotechar) {
         quotation = !quotation;
       }
       // Check if end of a column/row
-      else if (pos == first_row.size() - 1 || (!quotation && first_row[pos] == opts_.delimiter)) {
+      else if (pos == first_row.size() - 1 ||
+               (!quotation && depth <= 1 && first_row[pos] == opts_.delimiter)) {
         metadata.column_names.emplace_back(std::to_string(cols_found++));
+      } else if (!quotation && (first_row[pos] == '[' || first_row[pos] == '{')) {
+        ++depth;
+      } else if (!quotation && (first_row[pos] == ']' || first_row[pos] == '}')) {
+        depth -= (depth > 0);
       }
     }
   }
@@ -362,27 +476,26 @@ void reader::impl::set_data_types(cudaStream_t stream)
         return std::find(s.begin(), s.end(), ':') != s.end();
       });
     if (is_dict) {
-      std::map<std::string, data_type> col_type_map;
+      std::map<std::string, std::string> col_type_map;
 
       for (const auto &ts : args_.dtype) {
         const size_t colon_idx = ts.find(":");
         const std::string col_name(ts.begin(), ts.begin() + colon_idx);
         const std::string type_str(ts.begin() + colon_idx + 1, ts.end());
 
-        col_type_map[col_name] = convert_string_to_dtype(type_str);
+        col_type_map[col_name] = type_str;
       }
 
       // Using the map here allows O(n log n) complexity
       for (size_t col = 0; col < args_.dtype.size(); ++col) {
-        dtypes_.push_back(col_type_map[metadata.column_names[col]]);
-        // dtypes_extra_info_.push_back(col_type_info_map[column_names_[col]]);
+        const auto &type_str = col_type_map[metadata.column_names[col]];
+        dtypes_.push_back(convert_string_to_dtype(type_str));
+        as_dictionary_.push_back(is_dictionary_dtype(type_str));
       }
     } else {
-      auto dtype_ = std::back_inserter(dtypes_);
-      // auto dtype_info_ = std::back_inserter(dtypes_extra_info_);
       for (size_t col = 0; col < args_.dtype.size(); ++col) {
-        // std::tie(dtype_, dtype_info_) = convertStringToDtype(args_.dtype[col]);
-        dtype_ = convert_string_to_dtype(args_.dtype[col]);
+        dtypes_.push_back(convert_string_to_dtype(args_.dtype[col]));
+        as_dictionary_.push_back(is_dictionary_dtype(args_.dtype[col]));
       }
     }
   } else {
@@ -391,7 +504,10 @@ void reader::impl::set_data_types(cudaStream_t stream)
 
     rmm::device_vector<cudf::io::json::ColumnInfo> d_column_infos(num_columns,
                                                                   cudf::io::json::ColumnInfo{});
+    rmm::device_vector<cudf::io::json::ColumnInfo> d_element_infos(num_columns,
+                                                                   cudf::io::json::ColumnInfo{});
     cudf::io::json::gpu::detect_data_types(d_column_infos.data().get(),
+                                           d_element_infos.data().get(),
                                            static_cast<const char *>(data_.data()),
                                            data_.size(),
                                            opts_,
@@ -399,27 +515,49 @@ void reader::impl::set_data_types(cudaStream_t stream)
                                            rec_starts_.data().get(),
                                            rec_starts_.size(),
                                            stream);
-    thrust::host_vector<cudf::io::json::ColumnInfo> h_column_infos = d_column_infos;
+    thrust::host_vector<cudf::io::json::ColumnInfo> h_column_infos  = d_column_infos;
+    thrust::host_vector<cudf::io::json::ColumnInfo> h_element_infos = d_element_infos;
 
-    for (const auto &cinfo : h_column_infos) {
-      if (cinfo.null_count == static_cast<int>(rec_starts_.size())) {
+    auto const select_data_type = [](cudf::io::json::ColumnInfo const &cinfo, int num_values) {
+      if (cinfo.null_count == num_values) {
         // Entire column is NULL; allocate the smallest amount of memory
-        dtypes_.push_back(data_type(type_id::INT8));
-      } else if (cinfo.string_count > 0) {
-        dtypes_.push_back(data_type(type_id::STRING));
+        return data_type(type_id::INT8);
+      } else if (cinfo.string_count > 0 || cinfo.list_count > 0) {
+        return data_type(type_id::STRING);
       } else if (cinfo.datetime_count > 0) {
-        dtypes_.push_back(data_type(type_id::TIMESTAMP_MILLISECONDS));
+        return data_type(type_id::TIMESTAMP_MILLISECONDS);
       } else if (cinfo.float_count > 0 || (cinfo.int_count > 0 && cinfo.null_count > 0)) {
-        dtypes_.push_back(data_type(type_id::FLOAT64));
+        return data_type(type_id::FLOAT64);
       } else if (cinfo.int_count > 0) {
-        dtypes_.push_back(data_type(type_id::INT64));
+        return data_type(type_id::INT64);
       } else if (cinfo.bool_count > 0) {
-        dtypes_.push_back(data_type(type_id::BOOL8));
+        return data_type(type_id::BOOL8);
       } else {
         CUDF_FAIL("Data type detection failed.\n");
       }
+    };
+
+    for (size_t col = 0; col < num_columns; ++col) {
+      const auto &cinfo = h_column_infos[col];
+      if (cinfo.list_count > 0 &&
+          cinfo.list_count + cinfo.null_count == static_cast<int>(rec_starts_.size())) {
+        // Every value is an array or null; arrays that contain arrays or objects are read as
+        // lists of strings
+        const auto &einfo       = h_element_infos[col];
+        const auto num_elements = einfo.float_count + einfo.datetime_count + einfo.string_count +
+                                  einfo.int_count + einfo.bool_count + einfo.null_count;
+        dtypes_.push_back(data_type(type_id::LIST));
+        element_dtypes_.push_back((num_elements != 0) ? select_data_type(einfo, num_elements)
+                                                      : data_type(type_id::INT8));
+      } else {
+        // Columns that mix arrays with other values are read as strings
+        dtypes_.push_back(select_data_type(cinfo, rec_starts_.size()));
+        element_dtypes_.push_back(data_type(type_id::EMPTY));
+      }
     }
   }
+  element_dtypes_.resize(dtypes_.size(), data_type(type_id::EMPTY));
+  as_dictionary_.resize(dtypes_.size(), false);
 }
 
 /**
@@ -437,7 +575,12 @@ table_with_metadata reader::impl::convert_data_to_table(cudaStream_t stream)
   // alloc output buffers.
   std::vector<column_buffer> out_buffers;
   for (size_t col = 0; col < num_columns; ++col) {
-    out_buffers.emplace_back(dtypes_[col], num_records, true, stream, mr_);
+    if (dtypes_[col].id() == type_id::LIST) {
+      // The buffer data holds the list offsets
+      out_buffers.emplace_back(data_type(type_id::INT32), num_records + 1, true, stream, mr_);
+    } else {
+      out_buffers.emplace_back(dtypes_[col], num_records, true, stream, mr_);
+    }
   }
 
   thrust::host_vector<data_type> h_dtypes(num_columns);
@@ -468,13 +611,31 @@ table_with_metadata reader::impl::convert_data_to_table(cudaStream_t stream)
   CUDA_TRY(cudaStreamSynchronize(stream));
   CUDA_TRY(cudaGetLastError());
 
+  auto list_elements = convert_list_elements(out_buffers, stream);
+
   // postprocess columns
   thrust::host_vector<cudf::size_type> h_valid_counts = d_valid_counts;
   std::vector<std::unique_ptr<column>> out_columns;
   for (size_t i = 0; i < num_columns; ++i) {
     out_buffers[i].null_count() = num_records - h_valid_counts[i];
 
-    out_columns.emplace_back(make_column(dtypes_[i], num_records, out_buffers[i]));
+    if (dtypes_[i].id() == type_id::LIST) {
+      auto offsets = std::make_unique<column>(
+        data_type(type_id::INT32), num_records + 1, std::move(out_buffers[i]._data));
+      out_columns.emplace_back(make_lists_column(num_records,
+                                                 std::move(offsets),
+                                                 std::move(list_elements[i]),
+                                                 out_buffers[i].null_count(),
+                                                 std::move(out_buffers[i]._null_mask),
+                                                 stream,
+                                                 mr_));
+    } else {
+      out_columns.emplace_back(make_column(dtypes_[i], num_records, out_buffers[i]));
+    }
+    if (as_dictionary_[i]) {
+      out_columns.back() = cudf::dictionary::detail::encode(
+        out_columns.back()->view(), data_type{type_id::INT32}, mr_, stream);
+    }
   }
 
   CUDF_EXPECTS(!out_columns.empty(), "Error converting json input into gdf columns.\n");
@@ -482,11 +643,104 @@ table_with_metadata reader::impl::convert_data_to_table(cudaStream_t stream)
   return table_with_metadata{std::make_unique<table>(std::move(out_columns)), metadata};
 }
 
-reader::impl::impl(std::unique_ptr<datasource> source,
-                   std::string filepath,
+/**
+ * @brief Parse the elements of the list columns into their child columns
+ *
+ * @param[in,out] out_buffers Output buffers of the columns
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return The child column of each list column; null for other columns
+ **/
+std::vector<std::unique_ptr<column>> reader::impl::convert_list_elements(
+  std::vector<column_buffer> &out_buffers, cudaStream_t stream)
+{
+  const auto num_columns = dtypes_.size();
+  const auto num_records = rec_starts_.size();
+
+  std::vector<std::unique_ptr<column>> list_elements(num_columns);
+  const auto is_list = [](data_type const &dtype) { return dtype.id() == type_id::LIST; };
+  if (std::none_of(dtypes_.cbegin(), dtypes_.cend(), is_list)) { return list_elements; }
+
+  thrust::host_vector<data_type> h_dtypes(dtypes_.begin(), dtypes_.end());
+  thrust::host_vector<data_type> h_element_dtypes(element_dtypes_.begin(), element_dtypes_.end());
+  thrust::host_vector<cudf::size_type *> h_offsets(num_columns, nullptr);
+  for (size_t i = 0; i < num_columns; ++i) {
+    if (is_list(dtypes_[i])) {
+      h_offsets[i] = static_cast<cudf::size_type *>(out_buffers[i].data());
+    }
+  }
+  rmm::device_vector<data_type> d_dtypes          = h_dtypes;
+  rmm::device_vector<data_type> d_element_dtypes  = h_element_dtypes;
+  rmm::device_vector<cudf::size_type *> d_offsets = h_offsets;
+
+  // Count the elements of each list, then scan the counts into the list offsets
+  cudf::io::json::gpu::count_list_elements(data_,
+                                           d_dtypes.data().get(),
+                                           d_offsets.data().get(),
+                                           num_records,
+                                           num_columns,
+                                           rec_starts_.data().get(),
+                                           opts_,
+                                           stream);
+
+  std::vector<cudf::size_type> num_elements(num_columns, 0);
+  std::vector<column_buffer> element_buffers;
+  element_buffers.reserve(num_columns);
+  thrust::host_vector<void *> h_element_data(num_columns, nullptr);
+  thrust::host_vector<bitmask_type *> h_element_valid(num_columns, nullptr);
+  for (size_t i = 0; i < num_columns; ++i) {
+    if (is_list(dtypes_[i])) {
+      thrust::exclusive_scan(rmm::exec_policy(stream)->on(stream),
+                             h_offsets[i],
+                             h_offsets[i] + num_records + 1,
+                             h_offsets[i]);
+      CUDA_TRY(cudaMemcpyAsync(&num_elements[i],
+                               h_offsets[i] + num_records,
+                               sizeof(cudf::size_type),
+                               cudaMemcpyDeviceToHost,
+                               stream));
+      CUDA_TRY(cudaStreamSynchronize(stream));
+      element_buffers.emplace_back(element_dtypes_[i], num_elements[i], true, stream, mr_);
+      h_element_data[i]  = element_buffers.back().data();
+      h_element_valid[i] = element_buffers.back().null_mask();
+    } else {
+      element_buffers.emplace_back(data_type(type_id::INT8), 0, false, stream, mr_);
+    }
+  }
+  rmm::device_vector<void *> d_element_data                = h_element_data;
+  rmm::device_vector<cudf::bitmask_type *> d_element_valid = h_element_valid;
+  rmm::device_vector<cudf::size_type> d_valid_counts(num_columns, 0);
+
+  cudf::io::json::gpu::convert_list_elements(data_,
+                                             d_dtypes.data().get(),
+                                             d_element_dtypes.data().get(),
+                                             d_offsets.data().get(),
+                                             d_element_data.data().get(),
+                                             num_records,
+                                             num_columns,
+                                             rec_starts_.data().get(),
+                                             d_element_valid.data().get(),
+                                             d_valid_counts.data().get(),
+                                             opts_,
+                                             stream);
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  thrust::host_vector<cudf::size_type> h_valid_counts = d_valid_counts;
+  for (size_t i = 0; i < num_columns; ++i) {
+    if (is_list(dtypes_[i])) {
+      element_buffers[i].null_count() = num_elements[i] - h_valid_counts[i];
+      list_elements[i] =
+        make_column(element_dtypes_[i], num_elements[i], element_buffers[i], stream, mr_);
+    }
+  }
+  return list_elements;
+}
+
+reader::impl::impl(std::vector<std::unique_ptr<datasource>> &&sources,
+                   std::vector<std::string> const &filepaths,
                    reader_options const &options,
                    rmm::mr::device_memory_resource *mr)
-  : source_(std::move(source)), filepath_(filepath), args_(options), mr_(mr)
+  : sources_(std::move(sources)), filepaths_(filepaths), args_(options), mr_(mr)
 {
   CUDF_EXPECTS(args_.lines, "Only JSON Lines format is currently supported.\n");
 
@@ -514,10 +768,14 @@ reader::impl::impl(std::unique_ptr<datasource> source,
 table_with_metadata reader::impl::read(size_t range_offset, size_t range_size, cudaStream_t stream)
 {
   ingest_raw_input(range_offset, range_size);
-  CUDF_EXPECTS(buffer_ != nullptr, "Ingest failed: input data is null.\n");
-
-  decompress_input();
-  CUDF_EXPECTS(uncomp_data_ != nullptr, "Ingest failed: uncompressed input data is null.\n");
+  CUDF_EXPECTS(std::any_of(sources_.cbegin(),
+                           sources_.cend(),
+                           [](auto const &source) { return !source->is_empty(); }),
+               "Ingest failed: input data is null.\n");
+
+  decompress_input(stream);
+  CUDF_EXPECTS(uncomp_data_ != nullptr || read_to_device_,
+               "Ingest failed: uncompressed input data is null.\n");
   CUDF_EXPECTS(uncomp_size_ != 0, "Ingest failed: uncompressed input data has zero size.\n");
 
   set_record_starts(stream);
@@ -540,10 +798,11 @@ reader::reader(std::vector<std::string> const &filepaths,
                reader_options const &options,
                rmm::mr::device_memory_resource *mr)
 {
-  CUDF_EXPECTS(filepaths.size() == 1, "Only a single source is currently supported.");
+  CUDF_EXPECTS(!filepaths.empty(), "No sources to read from.");
   // Delay actual instantiation of data source until read to allow for
   // partial memory mapping of file using byte ranges
-  _impl = std::make_unique<impl>(nullptr, filepaths[0], options, mr);
+  _impl = std::make_unique<impl>(
+    std::vector<std::unique_ptr<cudf::io::datasource>>{}, filepaths, options, mr);
 }
 
 // Forward to implementation
@@ -551,8 +810,8 @@ reader::reader(std::vector<std::unique_ptr<cudf::io::datasource>> &&sources,
                reader_options const &options,
                rmm::mr::device_memory_resource *mr)
 {
-  CUDF_EXPECTS(sources.size() == 1, "Only a single source is currently supported.");
-  _impl = std::make_unique<impl>(std::move(sources[0]), "", options, mr);
+  CUDF_EXPECTS(!sources.empty(), "No sources to read from.");
+  _impl = std::make_unique<impl>(std::move(sources), std::vector<std::string>{}, options, mr);
 }
 
 // Destructor within this translation unit
@@ -50,9 +50,9 @@ class reader::impl {
 
   rmm::mr::device_memory_resource *mr_ = nullptr;
 
-  std::unique_ptr<datasource> source_;
-  std::string filepath_;
-  std::unique_ptr<datasource::buffer> buffer_;
+  std::vector<std::unique_ptr<datasource>> sources_;
+  std::vector<std::string> filepaths_;
+  std::vector<std::unique_ptr<datasource::buffer>> buffers_;  // One per source; null if empty
 
   const char *uncomp_data_ = nullptr;
   size_t uncomp_size_      = 0;
@@ -65,9 +65,12 @@ class reader::impl {
   size_t byte_range_offset_ = 0;
   size_t byte_range_size_   = 0;
   bool load_whole_file_     = true;
+  bool read_to_device_      = false;  // Whether the data is read straight into device memory
 
   table_metadata metadata;
   std::vector<data_type> dtypes_;
+  std::vector<data_type> element_dtypes_;  // Types of the list elements; EMPTY if not a list
+  std::vector<bool> as_dictionary_;        // Whether each column is returned dictionary encoded
 
   // parsing options
   const bool allow_newlines_in_strings_ = false;
@@ -79,7 +82,7 @@ class reader::impl {
   /**
    * @brief Ingest input JSON file/buffer, without decompression
    *
-   * Sets the source_, byte_range_offset_, and byte_range_size_ data members
+   * Sets the sources_, buffers_, byte_range_offset_, and byte_range_size_ data members
    *
    * @param[in] range_offset Number of bytes offset from the start
    * @param[in] range_size Bytes to read; use `0` for all remaining data
@@ -88,14 +91,27 @@ class reader::impl {
    **/
   void ingest_raw_input(size_t range_offset, size_t range_size);
 
+  /**
+   * @brief Returns the compression type of a source
+   *
+   * @param[in] source_index Index of the source
+   *
+   * @return Compression type name; "none" if not compressed
+   **/
+  std::string get_compression_type(size_t source_index) const;
+
   /**
    * @brief Decompress the input data, if needed
    *
    * Sets the uncomp_data_ and uncomp_size_ data members
+   * The data of multiple sources is joined, with each source starting on a new line
+   * Uncompressed data is read from the source straight into device memory when possible
+   *
+   * @param[in] stream CUDA stream used for device memory operations and kernel launches.
    *
    * @return void
    **/
-  void decompress_input();
+  void decompress_input(cudaStream_t stream);
 
   /**
    * @brief Finds all record starts in the file and stores them in rec_starts_
@@ -150,12 +166,28 @@ class reader::impl {
    **/
   table_with_metadata convert_data_to_table(cudaStream_t stream);
 
+  /**
+   * @brief Parse the elements of the list columns into their child columns
+   *
+   * The offsets of each list column are computed in the data of its output buffer.
+   *
+   * @param[in,out] out_buffers Output buffers of the columns
+   * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The child column of each list column; null for other columns
+   **/
+  std::vector<std::unique_ptr<column>> convert_list_elements(
+    std::vector<column_buffer> &out_buffers, cudaStream_t stream);
+
  public:
   /**
-   * @brief Constructor from a dataset source with reader options.
+   * @brief Constructor from dataset sources with reader options.
+   *
+   * The records of all the sources are read into a single table, in the order of the sources.
+   * When reading from files, the sources are only opened on the first read.
    **/
-  explicit impl(std::unique_ptr<datasource> source,
-                std::string filepath,
+  explicit impl(std::vector<std::unique_ptr<datasource>> &&sources,
+                std::vector<std::string> const &filepaths,
                 reader_options const &args,
                 rmm::mr::device_memory_resource *mr);
 
@@ -0,0 +1,502 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file writer_impl.cu
+ * @brief cuDF-IO JSON writer class implementation
+ */
+
+#include "writer_impl.hpp"
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/copying.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/strings/convert/convert_booleans.hpp>
+#include <cudf/strings/convert/convert_datetime.hpp>
+#include <cudf/strings/convert/convert_floats.hpp>
+#include <cudf/strings/convert/convert_integers.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/for_each.h>
+#include <thrust/host_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace json {
+namespace {
+/// Deepest nesting of lists the rows are formatted with
+constexpr int max_nesting_depth = 8;
+
+/**
+ * @brief How the text of a leaf value is written
+ */
+enum class leaf_kind : uint8_t {
+  LITERAL,   ///< Written as is: integers, booleans and durations
+  FLOATING,  ///< Written as is unless not finite, as `null`
+  STRING,    ///< Quoted and escaped: strings and timestamps
+};
+
+/**
+ * @brief Converts the leaf values of a column to strings
+ *
+ * Returns a null column for strings, which are written as they are.
+ */
+struct leaf_converter {
+  rmm::mr::device_memory_resource* mr;
+
+  template <typename T>
+  std::enable_if_t<std::is_same<T, bool>::value, std::pair<std::unique_ptr<column>, leaf_kind>>
+  operator()(column_view const& column) const
+  {
+    return {strings::from_booleans(column, string_scalar("true"), string_scalar("false"), mr),
+            leaf_kind::LITERAL};
+  }
+
+  template <typename T>
+  std::enable_if_t<std::is_integral<T>::value and not std::is_same<T, bool>::value,
+                   std::pair<std::unique_ptr<column>, leaf_kind>>
+  operator()(column_view const& column) const
+  {
+    return {strings::from_integers(column, mr), leaf_kind::LITERAL};
+  }
+
+  template <typename T>
+  std::enable_if_t<std::is_floating_point<T>::value, std::pair<std::unique_ptr<column>, leaf_kind>>
+  operator()(column_view const& column) const
+  {
+    return {strings::from_floats(column, mr), leaf_kind::FLOATING};
+  }
+
+  template <typename T>
+  std::enable_if_t<is_timestamp<T>(), std::pair<std::unique_ptr<column>, leaf_kind>> operator()(
+    column_view const& column) const
+  {
+    // ISO 8601, with as many digits of the fraction of a second as the unit has
+    std::string format = "%Y-%m-%dT%H:%M:%SZ";
+    switch (column.type().id()) {
+      case type_id::TIMESTAMP_MILLISECONDS: format = "%Y-%m-%dT%H:%M:%S.%3fZ"; break;
+      case type_id::TIMESTAMP_MICROSECONDS: format = "%Y-%m-%dT%H:%M:%S.%6fZ"; break;
+      case type_id::TIMESTAMP_NANOSECONDS: format = "%Y-%m-%dT%H:%M:%S.%9fZ"; break;
+      default: break;
+    }
+    return {strings::from_timestamps(column, format, mr), leaf_kind::STRING};
+  }
+
+  template <typename T>
+  std::enable_if_t<is_duration<T>(), std::pair<std::unique_ptr<column>, leaf_kind>> operator()(
+    column_view const& column) const
+  {
+    // Durations are written as their count of ticks
+    column_view const ticks{data_type{type_to_id<typename T::rep>()},
+                            column.size(),
+                            column.head(),
+                            column.null_mask(),
+                            column.null_count(),
+                            column.offset()};
+    return {strings::from_integers(ticks, mr), leaf_kind::LITERAL};
+  }
+
+  template <typename T>
+  std::enable_if_t<std::is_same<T, string_view>::value,
+                   std::pair<std::unique_ptr<column>, leaf_kind>>
+  operator()(column_view const&) const
+  {
+    return {nullptr, leaf_kind::STRING};
+  }
+
+  template <typename T>
+  std::enable_if_t<not std::is_arithmetic<T>::value and not is_timestamp<T>() and
+                     not is_duration<T>() and not std::is_same<T, string_view>::value,
+                   std::pair<std::unique_ptr<column>, leaf_kind>>
+  operator()(column_view const&) const
+  {
+    CUDF_FAIL("Unsupported column type for JSON output");
+  }
+};
+
+/**
+ * @brief Converts the leaf values of a column to strings, keeping its lists
+ *
+ * @param column The column to convert
+ * @param converted Owns the converted columns
+ * @param depth The number of lists `column` is nested in
+ * @param mr Device memory resource used to allocate the converted columns
+ * @return A view of the column whose leaves are strings, and how to write them
+ */
+std::pair<column_view, leaf_kind> convert_leaves(column_view const& column,
+                                                 std::vector<std::unique_ptr<column>>& converted,
+                                                 int depth,
+                                                 rmm::mr::device_memory_resource* mr)
+{
+  if (column.type().id() == type_id::LIST) {
+    CUDF_EXPECTS(depth < max_nesting_depth, "Lists are nested too deeply to be written to JSON");
+    auto const leaves = convert_leaves(
+      column.child(lists_column_view::child_column_index), converted, depth + 1, mr);
+    return {column_view{column.type(),
+                        column.size(),
+                        nullptr,
+                        column.null_mask(),
+                        column.null_count(),
+                        column.offset(),
+                        {column.child(lists_column_view::offsets_column_index), leaves.first}},
+            leaves.second};
+  }
+  if (column.type().id() == type_id::DICTIONARY32) {
+    converted.push_back(dictionary::decode(dictionary_column_view(column), mr));
+    return convert_leaves(converted.back()->view(), converted, depth, mr);
+  }
+  auto result = type_dispatcher(column.type(), leaf_converter{mr}, column);
+  if (result.first == nullptr) { return {column, result.second}; }
+  converted.push_back(std::move(result.first));
+  return {converted.back()->view(), result.second};
+}
+
+/**
+ * @brief Returns a JSON string holding `text`, escaped
+ */
+std::string quote(std::string const& text)
+{
+  std::string result = "\"";
+  for (unsigned char c : text) {
+    switch (c) {
+      case '"': result += "\\\""; break;
+      case '\\': result += "\\\\"; break;
+      case '\b': result += "\\b"; break;
+      case '\f': result += "\\f"; break;
+      case '\n': result += "\\n"; break;
+      case '\r': result += "\\r"; break;
+      case '\t': result += "\\t"; break;
+      default:
+        if (c < 0x20) {
+          char escaped[8];
+          snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+          result += escaped;
+        } else {
+          result += c;
+        }
+    }
+  }
+  return result + "\"";
+}
+
+/**
+ * @brief Writes the text of a row, or only counts its bytes without an output buffer
+ */
+class json_output {
+ public:
+  __device__ explicit json_output(char* out) : out_{out} {}
+
+  __device__ void put(char c)
+  {
+    if (out_ != nullptr) { out_[size_] = c; }
+    ++size_;
+  }
+
+  __device__ void put(char const* str, size_type length)
+  {
+    if (out_ != nullptr) { memcpy(out_ + size_, str, length); }
+    size_ += length;
+  }
+
+  /**
+   * @brief Writes a string quoted, escaping quotes, backslashes and control characters
+   */
+  __device__ void put_quoted(string_view const& str)
+  {
+    put('"');
+    auto const data = str.data();
+    for (size_type i = 0; i < str.size_bytes(); ++i) {
+      auto const c = static_cast<unsigned char>(data[i]);
+      switch (c) {
+        case '"': put("\\\"", 2); break;
+        case '\\': put("\\\\", 2); break;
+        case '\b': put("\\b", 2); break;
+        case '\f': put("\\f", 2); break;
+        case '\n': put("\\n", 2); break;
+        case '\r': put("\\r", 2); break;
+        case '\t': put("\\t", 2); break;
+        default:
+          if (c < 0x20) {
+            put("\\u00", 4);
+            put("0123456789abcdef"[c >> 4]);
+            put("0123456789abcdef"[c & 15]);
+          } else {
+            put(static_cast<char>(c));
+          }
+      }
+    }
+    put('"');
+  }
+
+  __device__ size_type size() const { return size_; }
+
+ private:
+  char* out_;
+  size_type size_ = 0;
+};
+
+__device__ void put_leaf(column_device_view const& column,
+                         size_type row,
+                         leaf_kind kind,
+                         json_output& out)
+{
+  auto const str = column.element<string_view>(row);
+  if (kind == leaf_kind::STRING) {
+    out.put_quoted(str);
+    return;
+  }
+  // from_floats spells the values that are not finite NaN, Inf and -Inf, JSON has no literal for
+  // them
+  auto const data = str.data();
+  if (kind == leaf_kind::FLOATING and str.size_bytes() > 0 and
+      (data[0] == 'N' or data[0] == 'I' or (data[0] == '-' and data[1] == 'I'))) {
+    out.put("null", 4);
+    return;
+  }
+  out.put(data, str.size_bytes());
+}
+
+/**
+ * @brief An open list of a value: the position of the next element, and the end of the list
+ */
+struct list_frame {
+  size_type position;
+  size_type end;
+};
+
+/**
+ * @brief Writes a value of a column, lists as nested arrays
+ *
+ * The lists are walked with an explicit stack rather than recursively. Without structs, the
+ * values at a depth are always the children of the lists of the depth above, so the stack only
+ * holds positions.
+ */
+__device__ void put_value(column_device_view const& root,
+                          size_type row,
+                          leaf_kind kind,
+                          json_output& out)
+{
+  list_frame stack[max_nesting_depth];
+  int depth   = 0;
+  auto column = root;
+  while (true) {
+    if (column.is_null(row)) {
+      out.put("null", 4);
+    } else if (column.type().id() == type_id::LIST) {
+      auto const offsets = column.child(lists_column_view::offsets_column_index);
+      auto const begin   = offsets.element<size_type>(row + column.offset());
+      auto const end     = offsets.element<size_type>(row + column.offset() + 1);
+      out.put('[');
+      if (begin < end) {
+        stack[depth++] = list_frame{begin, end};
+        column         = column.child(lists_column_view::child_column_index);
+        row            = begin;
+        continue;
+      }
+      out.put(']');
+    } else {
+      put_leaf(column, row, kind, out);
+    }
+
+    // Move to the next element of the innermost list not written completely
+    while (depth > 0 and ++stack[depth - 1].position == stack[depth - 1].end) {
+      out.put(']');
+      --depth;
+    }
+    if (depth == 0) { return; }
+    out.put(',');
+    column = root;
+    for (int i = 0; i < depth; ++i) {
+      column = column.child(lists_column_view::child_column_index);
+    }
+    row = stack[depth - 1].position;
+  }
+}
+
+/**
+ * @brief Formats the rows of a table as objects
+ *
+ * Without an output buffer, the size of each row is written to `sizes` instead.
+ */
+struct format_rows_fn {
+  table_device_view table;
+  char const* keys;
+  size_type const* key_offsets;
+  leaf_kind const* kinds;
+  bool lines;
+  bool include_nulls;
+  size_type first_row;
+  size_t* sizes;
+  size_t const* offsets;
+  char* chars;
+
+  __device__ void operator()(size_type row) const
+  {
+    json_output out{chars == nullptr ? nullptr : chars + offsets[row]};
+    if (not lines and first_row + row > 0) { out.put(','); }
+    out.put('{');
+    bool first = true;
+    for (size_type c = 0; c < table.num_columns(); ++c) {
+      auto const column = table.column(c);
+      if (not include_nulls and column.is_null(row)) { continue; }
+      if (not first) { out.put(','); }
+      first = false;
+      out.put(keys + key_offsets[c], key_offsets[c + 1] - key_offsets[c]);
+      put_value(column, row, kinds[c], out);
+    }
+    out.put('}');
+    if (lines) { out.put('\n'); }
+    if (chars == nullptr) { sizes[row] = out.size(); }
+  }
+};
+
+}  // namespace
+
+// Forward to implementation
+writer::writer(std::unique_ptr<data_sink> sink,
+               writer_options const& options,
+               rmm::mr::device_memory_resource* mr)
+  : _impl(std::make_unique<impl>(std::move(sink), options, mr))
+{
+}
+
+// Destructor within this translation unit
+writer::~writer() = default;
+
+writer::impl::impl(std::unique_ptr<data_sink> sink,
+                   writer_options const& options,
+                   rmm::mr::device_memory_resource* mr)
+  : out_sink_(std::move(sink)), _mr(mr), options_(options)
+{
+}
+
+void writer::impl::write(table_view const& table,
+                         const table_metadata* metadata,
+                         cudaStream_t stream)
+{
+  CUDF_EXPECTS(options_.rows_per_chunk > 0, "write_json: rows_per_chunk must be positive");
+  CUDF_EXPECTS(metadata == nullptr or
+                 metadata->column_names.size() == static_cast<size_t>(table.num_columns()),
+               "Mismatch between number of column names and table columns.");
+
+  // The keys are the column names, or their indices without metadata
+  std::string keys;
+  std::vector<size_type> key_offsets{0};
+  for (size_type c = 0; c < table.num_columns(); ++c) {
+    keys += quote(metadata != nullptr ? metadata->column_names[c] : std::to_string(c)) + ':';
+    key_offsets.push_back(keys.size());
+  }
+
+  // The values are converted to text once for the whole table, only their JSON text is built
+  // and written by chunks. Converting each chunk would convert the whole children of its lists.
+  std::vector<std::unique_ptr<column>> converted;
+  std::vector<column_view> columns;
+  std::vector<leaf_kind> kinds;
+  for (auto const& column : table) {
+    auto const leaves = convert_leaves(column, converted, 0, _mr);
+    columns.push_back(leaves.first);
+    kinds.push_back(leaves.second);
+  }
+
+  d_keys_        = rmm::device_buffer(keys.data(), keys.size(), stream);
+  d_key_offsets_ = rmm::device_buffer(
+    key_offsets.data(), key_offsets.size() * sizeof(size_type), stream);
+  d_leaf_kinds_  = rmm::device_buffer(kinds.data(), kinds.size() * sizeof(leaf_kind), stream);
+
+  if (not options_.lines) { out_sink_->host_write("[", 1); }
+  table_view const strings_table{columns};
+  size_type first = 0;
+  while (first < table.num_rows()) {
+    auto const last = first + std::min(options_.rows_per_chunk, table.num_rows() - first);
+    write_chunk(cudf::slice(strings_table, {first, last}).front(), first, stream);
+    first = last;
+  }
+  if (not options_.lines) { out_sink_->host_write("]", 1); }
+  out_sink_->flush();
+}
+
+void writer::impl::write_chunk(table_view const& table, size_type first_row, cudaStream_t stream)
+{
+  auto const num_rows = table.num_rows();
+  auto const d_table  = table_device_view::create(table, stream);
+
+  // The size of each row, scanned into its offset in the output
+  rmm::device_vector<size_t> offsets(num_rows + 1, 0);
+  format_rows_fn format{*d_table,
+                        static_cast<char const*>(d_keys_.data()),
+                        static_cast<size_type const*>(d_key_offsets_.data()),
+                        static_cast<leaf_kind const*>(d_leaf_kinds_.data()),
+                        options_.lines,
+                        options_.include_nulls,
+                        first_row,
+                        offsets.data().get(),
+                        nullptr,
+                        nullptr};
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     num_rows,
+                     format);
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream)->on(stream), offsets.begin(), offsets.end(), offsets.begin());
+  size_t const total_size = offsets.back();
+
+  rmm::device_buffer chars(total_size, stream, _mr);
+  format.offsets = offsets.data().get();
+  format.chars   = static_cast<char*>(chars.data());
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     num_rows,
+                     format);
+
+  if (out_sink_->supports_device_write()) {
+    out_sink_->device_write(chars.data(), total_size, stream);
+  } else {
+    thrust::host_vector<char> h_chars(total_size);
+    CUDA_TRY(cudaMemcpyAsync(
+      h_chars.data(), chars.data(), total_size, cudaMemcpyDeviceToHost, stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    out_sink_->host_write(h_chars.data(), total_size);
+  }
+}
+
+void writer::write_all(table_view const& table, const table_metadata* metadata, cudaStream_t stream)
+{
+  _impl->write(table, metadata, stream);
+}
+
+}  // namespace json
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
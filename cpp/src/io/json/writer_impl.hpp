@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file writer_impl.hpp
+ * @brief cuDF-IO JSON writer class implementation header
+ */
+
+#pragma once
+
+#include <cudf/io/data_sink.hpp>
+#include <cudf/io/writers.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <memory>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace json {
+
+/**
+ * @brief Implementation for JSON writer
+ */
+class writer::impl {
+ public:
+  /**
+   * @brief Constructor with writer options.
+   *
+   * @param sink Output sink
+   * @param options Settings for controlling behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit impl(std::unique_ptr<data_sink> sink,
+                writer_options const& options,
+                rmm::mr::device_memory_resource* mr);
+
+  /**
+   * @brief Write an entire dataset to JSON format.
+   *
+   * @param table The set of columns
+   * @param metadata The metadata associated with the table
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void write(table_view const& table, const table_metadata* metadata, cudaStream_t stream);
+
+ private:
+  /**
+   * @brief Formats rows of the converted table and writes them to the sink
+   *
+   * @param table The rows to write, with their leaves converted to strings
+   * @param first_row The index of the first row in the whole table
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void write_chunk(table_view const& table, size_type first_row, cudaStream_t stream);
+
+ private:
+  std::unique_ptr<data_sink> out_sink_;
+  rmm::mr::device_memory_resource* _mr = nullptr;
+  writer_options const options_;
+
+  // The keys of the objects, each written `"key":`, their offsets, and how the leaf values of
+  // each column are written, set for the table being written
+  rmm::device_buffer d_keys_;
+  rmm::device_buffer d_key_offsets_;
+  rmm::device_buffer d_leaf_kinds_;
+};
+
+}  // namespace json
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
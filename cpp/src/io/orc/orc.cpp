@@ -111,6 +111,75 @@ void ProtobufReader::skip_struct_field(int t)
     break;                                       \
   }
 
+#define ORC_FLD_PACKED_UINT64(id, m)                     \
+  case (id)*8 + PB_TYPE_FIXEDLEN: {                      \
+    uint32_t len           = get_u32();                  \
+    const uint8_t *fld_end = std::min(m_cur + len, end); \
+    while (m_cur < fld_end) s->m.push_back(get_u64());   \
+    break;                                               \
+  }
+
+#define ORC_FLD_STRUCT_BLOB(id, m)               \
+  case (id)*8 + PB_TYPE_FIXEDLEN: {              \
+    uint32_t n = get_u32();                      \
+    if (n > (size_t)(end - m_cur)) return false; \
+    s->m.assign(m_cur, m_cur + n);               \
+    m_cur += n;                                  \
+    break;                                       \
+  }
+
+// Optional fields, also recording their presence in `has_<m>`
+#define ORC_FLD_OPT_UINT64(id, m) \
+  case (id)*8 + PB_TYPE_VARINT:   \
+    s->m       = get_u64();       \
+    s->has_##m = true;            \
+    break;
+
+#define ORC_FLD_OPT_INT64(id, m) \
+  case (id)*8 + PB_TYPE_VARINT:  \
+    s->m       = get_i64();      \
+    s->has_##m = true;           \
+    break;
+
+#define ORC_FLD_OPT_INT32(id, m) \
+  case (id)*8 + PB_TYPE_VARINT:  \
+    s->m       = get_i32();      \
+    s->has_##m = true;           \
+    break;
+
+#define ORC_FLD_OPT_BOOL(id, m)  \
+  case (id)*8 + PB_TYPE_VARINT:  \
+    s->m       = get_u32() != 0; \
+    s->has_##m = true;           \
+    break;
+
+#define ORC_FLD_OPT_DOUBLE(id, m)                \
+  case (id)*8 + PB_TYPE_FIXED64:                 \
+    if (8 > (size_t)(end - m_cur)) return false; \
+    memcpy(&s->m, m_cur, 8);                     \
+    m_cur += 8;                                  \
+    s->has_##m = true;                           \
+    break;
+
+#define ORC_FLD_OPT_STRING(id, m)                \
+  case (id)*8 + PB_TYPE_FIXEDLEN: {              \
+    uint32_t n = get_u32();                      \
+    if (n > (size_t)(end - m_cur)) return false; \
+    s->m.assign((const char *)m_cur, n);         \
+    m_cur += n;                                  \
+    s->has_##m = true;                           \
+    break;                                       \
+  }
+
+#define ORC_FLD_OPT_STRUCT(id, m)                \
+  case (id)*8 + PB_TYPE_FIXEDLEN: {              \
+    uint32_t n = get_u32();                      \
+    if (n > (size_t)(end - m_cur)) return false; \
+    if (!read(&s->m, n)) return false;           \
+    s->has_##m = true;                           \
+    break;                                       \
+  }
+
 #define ORC_END_STRUCT_(postproccond)                                    \
   default: /*printf("unknown fld %d of type %d\n", fld >> 3, fld & 7);*/ \
            skip_struct_field(fld & 7);                                   \
@@ -189,6 +258,59 @@ ORC_BEGIN_STRUCT(Metadata)
 ORC_FLD_REPEATED_STRUCT(1, stripeStats)
 ORC_END_STRUCT()
 
+ORC_BEGIN_STRUCT(IntegerStatistics)
+ORC_FLD_OPT_INT64(1, minimum)
+ORC_FLD_OPT_INT64(2, maximum)
+ORC_END_STRUCT()
+
+ORC_BEGIN_STRUCT(DoubleStatistics)
+ORC_FLD_OPT_DOUBLE(1, minimum)
+ORC_FLD_OPT_DOUBLE(2, maximum)
+ORC_END_STRUCT()
+
+ORC_BEGIN_STRUCT(StringStatistics)
+ORC_FLD_OPT_STRING(1, minimum)
+ORC_FLD_OPT_STRING(2, maximum)
+ORC_FLD_OPT_INT64(3, sum)
+ORC_FLD_OPT_STRING(4, lowerBound)
+ORC_FLD_OPT_STRING(5, upperBound)
+ORC_END_STRUCT()
+
+ORC_BEGIN_STRUCT(BucketStatistics)
+ORC_FLD_PACKED_UINT64(1, count)
+ORC_END_STRUCT()
+
+ORC_BEGIN_STRUCT(DateStatistics)
+ORC_FLD_OPT_INT32(1, minimum)
+ORC_FLD_OPT_INT32(2, maximum)
+ORC_END_STRUCT()
+
+ORC_BEGIN_STRUCT(TimestampStatistics)
+ORC_FLD_OPT_INT64(1, minimum)
+ORC_FLD_OPT_INT64(2, maximum)
+ORC_FLD_OPT_INT64(3, minimumUtc)
+ORC_FLD_OPT_INT64(4, maximumUtc)
+ORC_END_STRUCT()
+
+ORC_BEGIN_STRUCT(DecodedColumnStatistics)
+ORC_FLD_OPT_UINT64(1, numberOfValues)
+ORC_FLD_OPT_STRUCT(2, intStatistics)
+ORC_FLD_OPT_STRUCT(3, doubleStatistics)
+ORC_FLD_OPT_STRUCT(4, stringStatistics)
+ORC_FLD_OPT_STRUCT(5, bucketStatistics)
+ORC_FLD_OPT_STRUCT(7, dateStatistics)
+ORC_FLD_OPT_STRUCT(9, timestampStatistics)
+ORC_FLD_OPT_BOOL(10, hasNull)
+ORC_END_STRUCT()
+
+ORC_BEGIN_STRUCT(RowIndexEntry)
+ORC_FLD_STRUCT_BLOB(2, statistics)
+ORC_END_STRUCT()
+
+ORC_BEGIN_STRUCT(RowIndex)
+ORC_FLD_REPEATED_STRUCT(1, entry)
+ORC_END_STRUCT()
+
 // return the column name
 std::string FileFooter::GetColumnName(uint32_t column_id)
 {
@@ -453,7 +575,10 @@ OrcDecompressor::OrcDecompressor(CompressionKind kind, uint32_t blockSize)
         m_log2MaxRatio = 5;  // < 32:1
         break;
       case LZO: stream_type = IO_UNCOMP_STREAM_TYPE_LZO; break;
-      case LZ4: stream_type = IO_UNCOMP_STREAM_TYPE_LZ4; break;
+      case LZ4:
+        stream_type    = IO_UNCOMP_STREAM_TYPE_LZ4;
+        m_log2MaxRatio = 8;  // < 256:1
+        break;
       case ZSTD: stream_type = IO_UNCOMP_STREAM_TYPE_ZSTD; break;
       default: stream_type = IO_UNCOMP_STREAM_TYPE_INFER;  // Will be treated as invalid
     }
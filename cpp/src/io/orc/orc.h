@@ -105,6 +105,83 @@ struct Metadata {
   std::vector<StripeStatistics> stripeStats;
 };
 
+struct IntegerStatistics {
+  int64_t minimum  = 0;
+  int64_t maximum  = 0;
+  bool has_minimum = false;
+  bool has_maximum = false;
+};
+
+struct DoubleStatistics {
+  double minimum   = 0;
+  double maximum   = 0;
+  bool has_minimum = false;
+  bool has_maximum = false;
+};
+
+struct StringStatistics {
+  std::string minimum;
+  std::string maximum;
+  std::string lowerBound;  // truncated prefix of the minimum, if the minimum is not stored
+  std::string upperBound;  // truncated upper bound of the maximum, if the maximum is not stored
+  int64_t sum         = 0;  // total length of the strings
+  bool has_minimum    = false;
+  bool has_maximum    = false;
+  bool has_sum        = false;
+  bool has_lowerBound = false;
+  bool has_upperBound = false;
+};
+
+struct BucketStatistics {
+  std::vector<uint64_t> count;  // number of true values (boolean columns)
+};
+
+struct DateStatistics {
+  int32_t minimum  = 0;  // days since epoch
+  int32_t maximum  = 0;
+  bool has_minimum = false;
+  bool has_maximum = false;
+};
+
+struct TimestampStatistics {
+  int64_t minimum     = 0;  // milliseconds since epoch, in the writer's local time
+  int64_t maximum     = 0;
+  int64_t minimumUtc  = 0;  // milliseconds since UNIX epoch
+  int64_t maximumUtc  = 0;
+  bool has_minimum    = false;
+  bool has_maximum    = false;
+  bool has_minimumUtc = false;
+  bool has_maximumUtc = false;
+};
+
+// Decoded contents of a column statistics blob; at most one of the typed statistics is present
+struct DecodedColumnStatistics {
+  uint64_t numberOfValues = 0;  // the number of non-null values
+  IntegerStatistics intStatistics;
+  DoubleStatistics doubleStatistics;
+  StringStatistics stringStatistics;
+  BucketStatistics bucketStatistics;
+  DateStatistics dateStatistics;
+  TimestampStatistics timestampStatistics;
+  bool hasNull                 = false;
+  bool has_numberOfValues      = false;
+  bool has_intStatistics       = false;
+  bool has_doubleStatistics    = false;
+  bool has_stringStatistics    = false;
+  bool has_bucketStatistics    = false;
+  bool has_dateStatistics      = false;
+  bool has_timestampStatistics = false;
+  bool has_hasNull             = false;
+};
+
+struct RowIndexEntry {
+  ColumnStatistics statistics;  // Column statistics blob of the row group
+};
+
+struct RowIndex {
+  std::vector<RowIndexEntry> entry;
+};
+
 // Minimal protobuf reader for orc metadata
 
 /**
@@ -170,6 +247,15 @@ class ProtobufReader {
   DECL_ORC_STRUCT(ColumnEncoding);
   DECL_ORC_STRUCT(StripeStatistics);
   DECL_ORC_STRUCT(Metadata);
+  DECL_ORC_STRUCT(IntegerStatistics);
+  DECL_ORC_STRUCT(DoubleStatistics);
+  DECL_ORC_STRUCT(StringStatistics);
+  DECL_ORC_STRUCT(BucketStatistics);
+  DECL_ORC_STRUCT(DateStatistics);
+  DECL_ORC_STRUCT(TimestampStatistics);
+  DECL_ORC_STRUCT(DecodedColumnStatistics);
+  DECL_ORC_STRUCT(RowIndexEntry);
+  DECL_ORC_STRUCT(RowIndex);
 #undef DECL_ORC_STRUCT
  protected:
   bool InitSchema(FileFooter *);
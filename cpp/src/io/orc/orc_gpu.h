@@ -95,6 +95,7 @@ struct ColumnDesc {
   uint32_t num_rows;                       // starting row of the stripe
   uint32_t dictionary_start;               // start position in global dictionary
   uint32_t dict_len;                       // length of local dictionary
+  uint32_t dict_index_base;                // position of the local dictionary in the column's keys
   uint32_t null_count;                     // number of null values in this stripe's column
   uint32_t skip_count;                     // number of non-null values to skip
   uint32_t rowgroup_id;                    // row group position
@@ -342,9 +343,10 @@ cudaError_t CompactOrcDataStreams(StripeStream *strm_desc,
  * @param[in] chunks EncChunk device array [rowgroup][column]
  * @param[out] comp_in Per-block compression input parameters
  * @param[out] comp_out Per-block compression status
- * @param[in] num_stripe_streams Total number of streams
+ * @param[in] num_stripe_streams Number of streams to compress, starting at `strm_desc`
+ * @param[in] first_block Index of the first compressed block of the streams
+ * @param[in] num_compressed_blocks Number of compressed blocks of the streams
  * @param[in] compression Type of compression
- * @param[in] num_compressed_blocks Total number of compressed blocks
  * @param[in] stream CUDA stream to use, default 0
  *
  * @return cudaSuccess if successful, a CUDA error code otherwise
@@ -355,6 +357,7 @@ cudaError_t CompressOrcDataStreams(uint8_t *compressed_data,
                                    gpu_inflate_input_s *comp_in,
                                    gpu_inflate_status_s *comp_out,
                                    uint32_t num_stripe_streams,
+                                   uint32_t first_block,
                                    uint32_t num_compressed_blocks,
                                    CompressionKind compression,
                                    uint32_t comp_blk_size,
@@ -23,7 +23,13 @@
 #include "timezone.h"
 
 #include <io/comp/gpuinflate.h>
+#include <io/statistics/predicate_filter.hpp>
+#include <io/utilities/staging_buffer.hpp>
 
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/dictionary/detail/encode.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
@@ -31,8 +37,15 @@
 #include <rmm/thrust_rmm_allocator.h>
 #include <rmm/device_buffer.hpp>
 
+#include <thrust/equal.h>
+#include <thrust/transform.h>
+
 #include <algorithm>
 #include <array>
+#include <cmath>
+#include <functional>
+#include <map>
+#include <numeric>
 
 namespace cudf {
 namespace io {
@@ -118,6 +131,136 @@ constexpr std::pair<gpu::StreamIndexType, uint32_t> get_index_type_and_pos(
   }
 }
 
+/**
+ * @brief Decodes a column statistics blob into the min/max summary used to evaluate filters
+ *
+ * @param blobs Column statistics blobs of a file, stripe or row group, indexed by column
+ * @param col ORC column index
+ * @param types ORC schema
+ * @param num_rows Number of rows described by the statistics
+ *
+ * @return Decoded statistics, without min/max if the blob is missing or cannot be parsed
+ **/
+minmax_statistics decode_statistics(const std::vector<orc::ColumnStatistics> &blobs,
+                                    int col,
+                                    const std::vector<orc::SchemaType> &types,
+                                    size_t num_rows)
+{
+  using literal_kind = minmax_statistics::literal_kind;
+
+  minmax_statistics stats;
+  stats.num_rows = num_rows;
+  switch (types[col].kind) {
+    case orc::STRING:
+    case orc::BINARY:
+    case orc::VARCHAR:
+    case orc::CHAR: stats.kind = literal_kind::STRING; break;
+    case orc::FLOAT:
+    case orc::DOUBLE: stats.kind = literal_kind::FLOAT; break;
+    default: stats.kind = literal_kind::INTEGER; break;
+  }
+  if (static_cast<size_t>(col) >= blobs.size() || blobs[col].empty()) { return stats; }
+
+  orc::DecodedColumnStatistics cs;
+  orc::ProtobufReader pb(blobs[col].data(), blobs[col].size());
+  if (!pb.read(&cs, blobs[col].size())) { return stats; }
+
+  if (cs.has_numberOfValues) {
+    stats.null_count = std::max<int64_t>(num_rows - cs.numberOfValues, 0);
+  } else if (cs.has_hasNull && !cs.hasNull) {
+    stats.null_count = 0;
+  }
+
+  auto set_int_minmax = [&](int64_t min, int64_t max) {
+    stats.int_min    = min;
+    stats.int_max    = max;
+    stats.has_minmax = true;
+  };
+  switch (types[col].kind) {
+    case orc::BOOLEAN:
+      // The bucket count is the number of true values
+      if (cs.has_bucketStatistics && !cs.bucketStatistics.count.empty() && cs.numberOfValues > 0) {
+        const auto true_count = cs.bucketStatistics.count[0];
+        set_int_minmax(true_count >= cs.numberOfValues ? 1 : 0, true_count > 0 ? 1 : 0);
+      }
+      break;
+    case orc::DATE:
+      if (cs.has_dateStatistics && cs.dateStatistics.has_minimum &&
+          cs.dateStatistics.has_maximum) {
+        set_int_minmax(cs.dateStatistics.minimum, cs.dateStatistics.maximum);
+      } else if (cs.has_intStatistics && cs.intStatistics.has_minimum &&
+                 cs.intStatistics.has_maximum) {
+        // cuDF writes dates with integer statistics
+        set_int_minmax(cs.intStatistics.minimum, cs.intStatistics.maximum);
+      }
+      break;
+    case orc::BYTE:
+    case orc::SHORT:
+    case orc::INT:
+    case orc::LONG:
+      if (cs.has_intStatistics && cs.intStatistics.has_minimum && cs.intStatistics.has_maximum) {
+        set_int_minmax(cs.intStatistics.minimum, cs.intStatistics.maximum);
+      }
+      break;
+    case orc::TIMESTAMP:
+      // Only the UTC values are usable without the writer's timezone; they are truncated to
+      // milliseconds, so widen the range to cover the sub-millisecond part
+      if (cs.has_timestampStatistics && cs.timestampStatistics.has_minimumUtc &&
+          cs.timestampStatistics.has_maximumUtc) {
+        set_int_minmax(cs.timestampStatistics.minimumUtc - 1,
+                       cs.timestampStatistics.maximumUtc + 1);
+      }
+      break;
+    case orc::FLOAT:
+    case orc::DOUBLE:
+      if (cs.has_doubleStatistics && cs.doubleStatistics.has_minimum &&
+          cs.doubleStatistics.has_maximum && !std::isnan(cs.doubleStatistics.minimum) &&
+          !std::isnan(cs.doubleStatistics.maximum)) {
+        stats.float_min  = cs.doubleStatistics.minimum;
+        stats.float_max  = cs.doubleStatistics.maximum;
+        stats.has_minmax = true;
+      }
+      break;
+    case orc::STRING:
+    case orc::VARCHAR:
+    case orc::CHAR:
+      // The bounds replace the min/max when those are too long to be stored
+      if (cs.has_stringStatistics) {
+        const auto &ss = cs.stringStatistics;
+        if ((ss.has_minimum || ss.has_lowerBound) && (ss.has_maximum || ss.has_upperBound)) {
+          stats.string_min = ss.has_minimum ? ss.minimum : ss.lowerBound;
+          stats.string_max = ss.has_maximum ? ss.maximum : ss.upperBound;
+          stats.has_minmax = true;
+        }
+      }
+      break;
+    default: break;
+  }
+
+  return stats;
+}
+
+/**
+ * @brief Returns the total length of the strings of a column from its statistics blob
+ *
+ * @param blobs Column statistics blobs of a file or stripe, indexed by column
+ * @param col ORC column index
+ *
+ * @return Total length in bytes, or `-1` if the statistics do not record it
+ **/
+int64_t get_string_length(const std::vector<orc::ColumnStatistics> &blobs, int col)
+{
+  if (static_cast<size_t>(col) >= blobs.size() || blobs[col].empty()) { return -1; }
+
+  orc::DecodedColumnStatistics cs;
+  orc::ProtobufReader pb(blobs[col].data(), blobs[col].size());
+  if (!pb.read(&cs, blobs[col].size()) || !cs.has_stringStatistics ||
+      !cs.stringStatistics.has_sum) {
+    return -1;
+  }
+  return cs.stringStatistics.sum;
+}
+
 }  // namespace
 
 /**
@@ -153,28 +296,70 @@ class metadata {
     pb.init(ff_data, ff_length);
     CUDF_EXPECTS(pb.read(&ff, ff_length), "Cannot read filefooter");
     CUDF_EXPECTS(get_num_columns() > 0, "No columns found");
+
+    // The metadata section, holding the stripe-level statistics, precedes the filefooter
+    metadata_offset = len - ps_length - 1 - ps.footerLength - ps.metadataLength;
   }
 
   /**
    * @brief Filters and reads the info of only a selection of stripes
    *
+   * If a filter is given, the stripe-based selection only lists the candidate stripes, and the
+   * row-based selection applies to the rows of the stripes that pass the filter.
+   *
    * @param[in] stripe Index of the stripe to select
    * @param[in] max_stripe_count Number of stripes to select for stripe-based selection
    * @param[in] stripe_indices Indices of individual stripes [max_stripe_count]
-   * @param[in] row_start Starting row of the selection
+   * @param[in] filter Filter with resolved ORC column indexes; empty to select all stripes
+   * @param[in] use_index Whether to evaluate the filter against the row index statistics
+   * @param[in,out] row_start Starting row of the selection
    * @param[in,out] row_count Total number of rows selected
+   * @param[out] stripe_rows Number of leading rows to read from each selected stripe
    *
    * @return List of stripe info and total number of selected rows
    **/
   auto select_stripes(size_type stripe,
                       size_type max_stripe_count,
                       const size_type *stripe_indices,
+                      const resolved_predicate_filter &filter,
+                      bool use_index,
                       size_type &row_start,
-                      size_type &row_count)
+                      size_type &row_count,
+                      std::vector<size_type> &stripe_rows)
   {
     std::vector<OrcStripeInfo> selection;
 
-    if (stripe_indices) {
+    stripe_rows.clear();
+    if (not filter.empty()) {
+      std::vector<size_type> candidates;
+      if (stripe_indices) {
+        candidates.assign(stripe_indices, stripe_indices + max_stripe_count);
+      } else if (stripe != -1) {
+        CUDF_EXPECTS(stripe < get_num_stripes(), "Non-existent stripe");
+        const auto stripe_end = std::min(stripe + std::max(max_stripe_count, 1), get_num_stripes());
+        for (auto i = stripe; i < stripe_end; ++i) { candidates.emplace_back(i); }
+      } else {
+        for (auto i = 0; i < get_num_stripes(); ++i) { candidates.emplace_back(i); }
+      }
+
+      row_start = std::max(row_start, 0);
+      size_t count            = 0;
+      size_t stripe_skip_rows = 0;
+      for (const auto &filtered : filter_stripes(candidates, filter, use_index)) {
+        if (row_count >= 0 && count >= static_cast<size_t>(row_start) + row_count) { break; }
+        if (count + filtered.second > static_cast<size_t>(row_start)) {
+          if (selection.empty()) { stripe_skip_rows = row_start - count; }
+          selection.emplace_back(&ff.stripes[filtered.first], nullptr);
+          stripe_rows.emplace_back(filtered.second);
+        }
+        count += filtered.second;
+      }
+      const size_t selected_rows =
+        std::accumulate(stripe_rows.begin(), stripe_rows.end(), size_t{0}) - stripe_skip_rows;
+      row_start = static_cast<size_type>(stripe_skip_rows);
+      row_count = (row_count < 0) ? static_cast<size_type>(selected_rows)
+                                  : std::min(row_count, static_cast<size_type>(selected_rows));
+    } else if (stripe_indices) {
       size_t stripe_rows = 0;
       for (auto i = 0; i < max_stripe_count; i++) {
         auto stripe_idx = stripe_indices[i];
@@ -217,33 +402,164 @@ class metadata {
       row_start = stripe_skip_rows;
     }
 
+    // Without a filter, all rows of each stripe are read
+    if (stripe_rows.empty()) {
+      for (const auto &selected : selection) {
+        stripe_rows.emplace_back(selected.first->numberOfRows);
+      }
+    }
+
     // Read each stripe's stripefooter metadata
-    if (not selection.empty()) {
-      orc::ProtobufReader pb;
-
-      stripefooters.resize(selection.size());
-      for (size_t i = 0; i < selection.size(); ++i) {
-        const auto stripe         = selection[i].first;
-        const auto sf_comp_offset = stripe->offset + stripe->indexLength + stripe->dataLength;
-        const auto sf_comp_length = stripe->footerLength;
-        CUDF_EXPECTS(sf_comp_offset + sf_comp_length < source->size(),
-                     "Invalid stripe information");
-
-        const auto buffer = source->host_read(sf_comp_offset, sf_comp_length);
-        size_t sf_length  = 0;
-        auto sf_data      = decompressor->Decompress(buffer->data(), sf_comp_length, &sf_length);
-        pb.init(sf_data, sf_length);
-        CUDF_EXPECTS(pb.read(&stripefooters[i], sf_length), "Cannot read stripefooter");
-        selection[i].second = &stripefooters[i];
+    stripefooters.resize(selection.size());
+    for (size_t i = 0; i < selection.size(); ++i) {
+      read_stripe_footer(*selection[i].first, stripefooters[i]);
+      selection[i].second = &stripefooters[i];
+    }
+
+    return selection;
+  }
+
+  /**
+   * @brief Reads and parses the footer of a stripe
+   *
+   * @param[in] stripe Stripe information
+   * @param[out] footer Parsed stripe footer
+   **/
+  void read_stripe_footer(const StripeInformation &stripe, StripeFooter &footer)
+  {
+    const auto sf_comp_offset = stripe.offset + stripe.indexLength + stripe.dataLength;
+    const auto sf_comp_length = stripe.footerLength;
+    CUDF_EXPECTS(sf_comp_offset + sf_comp_length < source->size(), "Invalid stripe information");
+
+    const auto buffer = source->host_read(sf_comp_offset, sf_comp_length);
+    size_t sf_length  = 0;
+    auto sf_data      = decompressor->Decompress(buffer->data(), sf_comp_length, &sf_length);
+    orc::ProtobufReader pb(sf_data, sf_length);
+    CUDF_EXPECTS(pb.read(&footer, sf_length), "Cannot read stripefooter");
+  }
+
+  /**
+   * @brief Returns the stripe-level statistics, reading the metadata section on first use
+   *
+   * @return Statistics of each stripe; empty if the file has none
+   **/
+  const std::vector<StripeStatistics> &get_stripe_statistics()
+  {
+    if (not md_loaded) {
+      md_loaded = true;
+      if (ps.metadataLength != 0) {
+        const auto buffer = source->host_read(metadata_offset, ps.metadataLength);
+        size_t md_length  = 0;
+        auto md_data = decompressor->Decompress(buffer->data(), ps.metadataLength, &md_length);
+        orc::ProtobufReader pb(md_data, md_length);
+        if (!pb.read(&md, md_length)) { md.stripeStats.clear(); }
       }
     }
+    return md.stripeStats;
+  }
+
+  /**
+   * @brief Selects the stripes whose statistics may satisfy a filter
+   *
+   * The filter is evaluated against the file-level, then the stripe-level statistics and, if
+   * `use_index` is set, the statistics of each row group in the row index. Rows following the
+   * last row group of a stripe that may satisfy the filter are not selected.
+   *
+   * @param candidates Indices of the stripes to consider
+   * @param filter Filter with resolved ORC column indexes
+   * @param use_index Whether to evaluate the filter against the row index statistics
+   *
+   * @return Index of each selected stripe, with the number of leading rows to read from it
+   **/
+  std::vector<std::pair<size_type, size_type>> filter_stripes(
+    const std::vector<size_type> &candidates, const resolved_predicate_filter &filter, bool use_index)
+  {
+    std::vector<std::pair<size_type, size_type>> selection;
+
+    auto file_stats = [&](int col) {
+      return decode_statistics(ff.statistics, col, ff.types, ff.numberOfRows);
+    };
+    if (not may_satisfy(filter, file_stats)) { return selection; }
+
+    const auto &stripe_stats = get_stripe_statistics();
+    for (const auto stripe_idx : candidates) {
+      CUDF_EXPECTS(stripe_idx >= 0 && stripe_idx < get_num_stripes(), "Invalid stripe index");
+      const auto &stripe = ff.stripes[stripe_idx];
+      if (static_cast<size_t>(stripe_idx) < stripe_stats.size()) {
+        auto stats = [&](int col) {
+          return decode_statistics(
+            stripe_stats[stripe_idx].colStats, col, ff.types, stripe.numberOfRows);
+        };
+        if (not may_satisfy(filter, stats)) { continue; }
+      }
+      const auto num_rows = (use_index && get_row_index_stride() > 0)
+                              ? filter_row_groups(stripe, filter)
+                              : static_cast<size_type>(stripe.numberOfRows);
+      if (num_rows > 0) { selection.emplace_back(stripe_idx, num_rows); }
+    }
 
     return selection;
   }
 
+  /**
+   * @brief Evaluates a filter against the row index statistics of a stripe
+   *
+   * @param stripe Stripe information
+   * @param filter Filter with resolved ORC column indexes
+   *
+   * @return Number of leading rows of the stripe, up to the end of the last row group that may
+   * satisfy the filter
+   **/
+  size_type filter_row_groups(const StripeInformation &stripe,
+                              const resolved_predicate_filter &filter)
+  {
+    StripeFooter footer;
+    read_stripe_footer(stripe, footer);
+
+    // Read the row index of each column referenced by the filter
+    std::map<int, RowIndex> row_indexes;
+    for (const auto &conjunction : filter) {
+      for (const auto &pred : conjunction) { row_indexes[pred.first]; }
+    }
+    auto offset = stripe.offset;
+    for (const auto &strm : footer.streams) {
+      const auto it = row_indexes.find(strm.column);
+      if (strm.kind == orc::ROW_INDEX && it != row_indexes.end() && strm.length > 0) {
+        const auto buffer = source->host_read(offset, strm.length);
+        size_t ri_length  = 0;
+        auto ri_data      = decompressor->Decompress(buffer->data(), strm.length, &ri_length);
+        orc::ProtobufReader pb(ri_data, ri_length);
+        if (!pb.read(&it->second, ri_length)) { it->second.entry.clear(); }
+      }
+      offset += strm.length;
+    }
+
+    const size_t stride        = get_row_index_stride();
+    const size_t num_rowgroups = (stripe.numberOfRows + stride - 1) / stride;
+    std::vector<orc::ColumnStatistics> rowgroup_blobs(ff.types.size());
+    size_type num_rows = 0;
+    for (size_t g = 0; g < num_rowgroups; ++g) {
+      const auto rowgroup_rows = std::min<size_t>(stride, stripe.numberOfRows - g * stride);
+      for (auto &index : row_indexes) {
+        rowgroup_blobs[index.first] = (g < index.second.entry.size())
+                                        ? index.second.entry[g].statistics
+                                        : orc::ColumnStatistics{};
+      }
+      auto stats = [&](int col) {
+        return decode_statistics(rowgroup_blobs, col, ff.types, rowgroup_rows);
+      };
+      if (may_satisfy(filter, stats)) { num_rows = g * stride + rowgroup_rows; }
+    }
+
+    return num_rows;
+  }
+
   /**
    * @brief Filters and reduces down to a selection of columns
    *
+   * A name may be the dotted path of a nested field (`a.b.c`); naming a struct selects all the
+   * leaf columns below it, so that only the streams of those leaves are read.
+   *
    * @param[in] use_names List of column names to select
    * @param[out] has_timestamp_column Whether there is a orc::TIMESTAMP column
    *
@@ -254,13 +570,21 @@ class metadata {
     std::vector<int> selection;
 
     if (not use_names.empty()) {
+      // Adds a column, or the leaf columns below it in schema order
+      std::function<void(int)> add_leaves = [&](int index) {
+        auto const &type = ff.types[index];
+        if (type.subtypes.empty()) {
+          selection.emplace_back(index);
+          if (type.kind == orc::TIMESTAMP) { has_timestamp_column = true; }
+        }
+        for (auto const child : type.subtypes) { add_leaves(child); }
+      };
       int index = 0;
       for (const auto &use_name : use_names) {
         for (int i = 0; i < get_num_columns(); ++i, ++index) {
           if (index >= get_num_columns()) { index = 0; }
           if (ff.GetColumnName(index) == use_name) {
-            selection.emplace_back(index);
-            if (ff.types[index].kind == orc::TIMESTAMP) { has_timestamp_column = true; }
+            add_leaves(index);
             index++;
             break;
           }
@@ -293,6 +617,9 @@ class metadata {
 
  private:
   datasource *const source;
+  size_t metadata_offset = 0;
+  Metadata md;
+  bool md_loaded = false;
 };
 
 namespace {
@@ -388,6 +715,32 @@ size_t gather_stream_info(const size_t stripe_index,
   return dst_offset;
 }
 
+/**
+ * @brief Returns whether two stripes of a column have byte-identical string dictionaries
+ *
+ * @param a Column chunk descriptor of the first stripe
+ * @param b Column chunk descriptor of the second stripe
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+bool is_same_dictionary(const gpu::ColumnDesc &a, const gpu::ColumnDesc &b, cudaStream_t stream)
+{
+  // The LENGTH stream holds the lengths of the entries, and DICTIONARY_DATA their characters
+  const std::array<int, 2> dict_streams{gpu::CI_DATA2, gpu::CI_DICTIONARY};
+  if (a.dict_len != b.dict_len || a.encoding_kind != b.encoding_kind) { return false; }
+  for (auto strm : dict_streams) {
+    if (a.strm_len[strm] != b.strm_len[strm]) { return false; }
+  }
+  for (auto strm : dict_streams) {
+    if (!thrust::equal(rmm::exec_policy(stream)->on(stream),
+                       a.streams[strm],
+                       a.streams[strm] + a.strm_len[strm],
+                       b.streams[strm])) {
+      return false;
+    }
+  }
+  return true;
+}
+
 }  // namespace
 
 rmm::device_buffer reader::impl::decompress_stripe_data(
@@ -478,6 +831,14 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
         CUDA_TRY(gpu_unsnap(
           inflate_in.data().get(), inflate_out.data().get(), num_compressed_blocks, stream));
         break;
+      case orc::ZSTD:
+        CUDA_TRY(gpu_unzstd(
+          inflate_in.data().get(), inflate_out.data().get(), num_compressed_blocks, stream));
+        break;
+      case orc::LZ4:
+        CUDA_TRY(gpu_unlz4(
+          inflate_in.data().get(), inflate_out.data().get(), num_compressed_blocks, 0, stream));
+        break;
       default: CUDF_EXPECTS(false, "Unexpected decompression dispatch"); break;
     }
   }
@@ -540,6 +901,7 @@ void reader::impl::decode_stream_data(hostdevice_vector<gpu::ColumnDesc> &chunks
                                       const rmm::device_vector<gpu::RowGroup> &row_groups,
                                       size_t row_index_stride,
                                       std::vector<column_buffer> &out_buffers,
+                                      rmm::device_vector<gpu::DictionaryEntry> &global_dict,
                                       cudaStream_t stream)
 {
   const auto num_columns = out_buffers.size();
@@ -555,7 +917,7 @@ void reader::impl::decode_stream_data(hostdevice_vector<gpu::ColumnDesc> &chunks
   }
 
   // Allocate global dictionary for deserializing
-  rmm::device_vector<gpu::DictionaryEntry> global_dict(num_dicts);
+  global_dict.resize(num_dicts);
 
   // Allocate timezone transition table timestamp conversion
   rmm::device_vector<int64_t> tz_table = timezone_table;
@@ -592,6 +954,72 @@ void reader::impl::decode_stream_data(hostdevice_vector<gpu::ColumnDesc> &chunks
   }
 }
 
+std::unique_ptr<column> reader::impl::make_dictionary_column(
+  hostdevice_vector<gpu::ColumnDesc> &chunks,
+  const rmm::device_vector<gpu::DictionaryEntry> &global_dict,
+  size_t col_idx,
+  size_type num_rows,
+  bool is_indices,
+  column_buffer &buffer,
+  cudaStream_t stream)
+{
+  if (!is_indices) {
+    // Some stripes are not dictionary encoded, so encode the decoded strings instead
+    auto const strings = make_column(data_type{type_id::STRING}, num_rows, buffer, stream);
+    return cudf::dictionary::detail::encode(
+      strings->view(), data_type{type_id::INT32}, _mr, stream);
+  }
+
+  // Concatenate the distinct dictionaries of the column's stripes; `dict_index_base` is the
+  // position of each stripe's first entry, and stripes that reuse an earlier dictionary point to it
+  const auto num_columns = _selected_columns.size();
+  const auto num_stripes = chunks.size() / num_columns;
+  size_t num_keys        = 0;
+  for (size_t i = 0; i < num_stripes; ++i) {
+    const auto &chunk = chunks[i * num_columns + col_idx];
+    if (chunk.dict_len != 0 && chunk.dict_index_base == num_keys) { num_keys += chunk.dict_len; }
+  }
+  rmm::device_vector<column_buffer::str_pair> stripe_keys(num_keys);
+  for (size_t i = 0, key_count = 0; i < num_stripes; ++i) {
+    const auto &chunk = chunks[i * num_columns + col_idx];
+    if (chunk.dict_len != 0 && chunk.dict_index_base == key_count) {
+      auto const dict_data = reinterpret_cast<const char *>(chunk.streams[gpu::CI_DICTIONARY]);
+      thrust::transform(rmm::exec_policy(stream)->on(stream),
+                        global_dict.begin() + chunk.dictionary_start,
+                        global_dict.begin() + chunk.dictionary_start + chunk.dict_len,
+                        stripe_keys.begin() + chunk.dict_index_base,
+                        [dict_data] __device__(gpu::DictionaryEntry const &entry) {
+                          return column_buffer::str_pair{dict_data + entry.pos,
+                                                         static_cast<size_type>(entry.len)};
+                        });
+      key_count += chunk.dict_len;
+    }
+  }
+
+  // Stripe dictionaries may overlap, so map every entry onto a single set of sorted, unique keys
+  auto key_map = cudf::dictionary::detail::encode(
+    make_strings_column(stripe_keys, stream)->view(), data_type{type_id::INT32}, _mr, stream);
+  auto key_map_contents = key_map->release();
+  auto &key_indices     = key_map_contents.children[0];
+  auto &keys            = key_map_contents.children[1];
+
+  // Null rows have an index of zero, which is always valid as the keys are not empty
+  column_view const stripe_indices(data_type{type_id::INT32}, num_rows, buffer._data.data());
+  auto indices = cudf::detail::gather(table_view{{key_indices->view()}},
+                                      stripe_indices,
+                                      cudf::detail::out_of_bounds_policy::IGNORE,
+                                      cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                      _mr,
+                                      stream)
+                   ->release();
+  indices[0]->set_null_mask(rmm::device_buffer{}, 0);
+
+  return cudf::make_dictionary_column(std::move(keys),
+                                      std::move(indices[0]),
+                                      std::move(buffer._null_mask),
+                                      buffer._null_count);
+}
+
 reader::impl::impl(std::unique_ptr<datasource> source,
                    reader_options const &options,
                    rmm::mr::device_memory_resource *mr)
@@ -615,6 +1043,65 @@ reader::impl::impl(std::unique_ptr<datasource> source,
   // Control decimals conversion (float64 or int64 with optional scale)
   _decimals_as_float     = options.decimals_as_float;
   _decimals_as_int_scale = options.forced_decimals_scale;
+
+  // Strings may be returned as either string or dictionary columns
+  _strings_to_dictionary = options.strings_to_dictionary;
+
+  // Resolve the filter columns against all columns of the file, not only the selected ones
+  if (not options.filters.empty()) {
+    std::vector<std::string> column_names(_metadata->get_num_columns());
+    for (int i = 0; i < _metadata->get_num_columns(); ++i) {
+      column_names[i] = _metadata->ff.GetColumnName(i);
+    }
+    _filter = resolve_predicate_filter(options.filters, column_names);
+  }
+}
+
+std::vector<block_info> reader::impl::get_stripe_info()
+{
+  std::vector<std::pair<size_type, size_type>> stripes;
+  if (_filter.empty()) {
+    for (int i = 0; i < _metadata->get_num_stripes(); ++i) {
+      stripes.emplace_back(i, static_cast<size_type>(_metadata->ff.stripes[i].numberOfRows));
+    }
+  } else {
+    std::vector<size_type> candidates(_metadata->get_num_stripes());
+    std::iota(candidates.begin(), candidates.end(), 0);
+    stripes = _metadata->filter_stripes(candidates, _filter, _use_index);
+  }
+
+  const auto &stripe_stats = _metadata->get_stripe_statistics();
+  std::vector<block_info> info;
+  for (const auto &selected : stripes) {
+    const auto &stripe = _metadata->ff.stripes[selected.first];
+    block_info block;
+    block.index           = selected.first;
+    block.num_rows        = selected.second;
+    block.compressed_size = stripe.indexLength + stripe.dataLength + stripe.footerLength;
+
+    // ORC does not record uncompressed sizes; estimate the decoded size from the column types,
+    // and the string lengths from the stripe statistics
+    for (const auto &col : _selected_columns) {
+      const auto col_type = to_type_id(
+        _metadata->ff.types[col], _use_np_dtypes, _timestamp_type.id(), _decimals_as_float);
+      CUDF_EXPECTS(col_type != type_id::EMPTY, "Unknown type");
+      if (col_type == type_id::STRING) {
+        const auto length = (static_cast<size_t>(selected.first) < stripe_stats.size())
+                              ? get_string_length(stripe_stats[selected.first].colStats, col)
+                              : -1;
+        block.uncompressed_size +=
+          (length >= 0)
+            ? length * selected.second / std::max<uint64_t>(stripe.numberOfRows, 1)
+            : stripe.dataLength / _metadata->get_num_columns();
+        block.uncompressed_size += sizeof(size_type) * selected.second;
+      } else {
+        block.uncompressed_size += size_of(data_type{col_type}) * selected.second;
+      }
+    }
+    info.emplace_back(block);
+  }
+
+  return info;
 }
 
 table_with_metadata reader::impl::read(size_type skip_rows,
@@ -627,9 +1114,22 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   std::vector<std::unique_ptr<column>> out_columns;
   table_metadata out_metadata;
 
-  // Select only stripes required (aka row groups)
-  const auto selected_stripes =
-    _metadata->select_stripes(stripe, max_stripe_count, stripe_indices, skip_rows, num_rows);
+  // Select only stripes required (aka row groups), and the rows to read from each
+  std::vector<size_type> stripe_rows;
+  const auto selected_stripes = _metadata->select_stripes(stripe,
+                                                          max_stripe_count,
+                                                          stripe_indices,
+                                                          _filter,
+                                                          _use_index,
+                                                          skip_rows,
+                                                          num_rows,
+                                                          stripe_rows);
+
+  // Measurements reported to the profiling callbacks
+  int64_t rows_selected = 0;
+  for (auto const &selected : selected_stripes) { rows_selected += selected.first->numberOfRows; }
+  size_t bytes_read         = 0;
+  size_t bytes_decompressed = 0;
 
   // Association between each ORC column and its cudf::column
   std::vector<int32_t> orc_col_map(_metadata->get_num_columns(), -1);
@@ -640,7 +1140,9 @@ table_with_metadata reader::impl::read(size_type skip_rows,
     auto col_type = to_type_id(
       _metadata->ff.types[col], _use_np_dtypes, _timestamp_type.id(), _decimals_as_float);
     CUDF_EXPECTS(col_type != type_id::EMPTY, "Unknown type");
-    column_types.emplace_back(col_type);
+    column_types.emplace_back((_strings_to_dictionary && col_type == type_id::STRING)
+                                ? type_id::DICTIONARY32
+                                : col_type);
 
     // Map each ORC column to its column
     orc_col_map[col] = column_types.size() - 1;
@@ -653,6 +1155,11 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                    std::back_inserter(out_columns),
                    [](auto const &dtype) { return make_empty_column(dtype); });
   } else {
+    // Dictionary columns are decoded as strings unless their stripes can output indices
+    auto const decode_type_id = [](data_type type) {
+      return (type.id() == type_id::DICTIONARY32) ? type_id::STRING : type.id();
+    };
+
     const auto num_columns = _selected_columns.size();
     const auto num_chunks  = selected_stripes.size() * num_columns;
     hostdevice_vector<gpu::ColumnDesc> chunks(num_chunks, stream);
@@ -674,6 +1181,9 @@ table_with_metadata reader::impl::read(size_type skip_rows,
     // Tracker for eventually deallocating compressed and uncompressed data
     std::vector<rmm::device_buffer> stripe_data;
 
+    // Reads of later streams overlap the device transfers of earlier ones
+    detail::staged_device_copier copier(stream);
+
     size_t stripe_start_row = 0;
     size_t num_dict_entries = 0;
     size_t num_rowgroups    = 0;
@@ -693,6 +1203,7 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                                                       chunks,
                                                       stream_info);
       CUDF_EXPECTS(total_data_size > 0, "Expected streams data within stripe");
+      bytes_read += total_data_size;
 
       stripe_data.emplace_back(total_data_size, stream);
       auto dst_base = static_cast<uint8_t *>(stripe_data.back().data());
@@ -709,16 +1220,14 @@ table_with_metadata reader::impl::read(size_type skip_rows,
           len += stream_info[stream_count].length;
           stream_count++;
         }
-        const auto buffer = _source->host_read(offset, len);
-        CUDA_TRY(cudaMemcpyAsync(d_dst, buffer->data(), len, cudaMemcpyHostToDevice, stream));
-        CUDA_TRY(cudaStreamSynchronize(stream));
+        copier.copy(*_source, offset, len, d_dst);
       }
 
       // Update chunks to reference streams pointers
       for (size_t j = 0; j < num_columns; j++) {
         auto &chunk         = chunks[i * num_columns + j];
         chunk.start_row     = stripe_start_row;
-        chunk.num_rows      = stripe_info->numberOfRows;
+        chunk.num_rows      = stripe_rows[i];
         chunk.encoding_kind = stripe_footer->columns[_selected_columns[j]].kind;
         chunk.type_kind     = _metadata->ff.types[_selected_columns[j]].kind;
         if (_decimals_as_float) {
@@ -730,7 +1239,7 @@ table_with_metadata reader::impl::read(size_type skip_rows,
           chunk.decimal_scale = _decimals_as_int_scale;
         }
         chunk.rowgroup_id = num_rowgroups;
-        chunk.dtype_len   = (column_types[j].id() == type_id::STRING)
+        chunk.dtype_len   = (decode_type_id(column_types[j]) == type_id::STRING)
                             ? sizeof(std::pair<const char *, size_t>)
                             : cudf::size_of(column_types[j]);
         if (chunk.type_kind == orc::TIMESTAMP) {
@@ -742,9 +1251,9 @@ table_with_metadata reader::impl::read(size_type skip_rows,
           }
         }
       }
-      stripe_start_row += stripe_info->numberOfRows;
+      stripe_start_row += stripe_rows[i];
       if (use_index) {
-        num_rowgroups += (stripe_info->numberOfRows + _metadata->get_row_index_stride() - 1) /
+        num_rowgroups += (stripe_rows[i] + _metadata->get_row_index_stride() - 1) /
                          _metadata->get_row_index_stride();
       }
     }
@@ -762,6 +1271,7 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                                                   row_groups,
                                                   _metadata->get_row_index_stride(),
                                                   stream);
+        bytes_decompressed = decomp_data.size();
         stripe_data.clear();
         stripe_data.push_back(std::move(decomp_data));
       } else {
@@ -790,6 +1300,40 @@ table_with_metadata reader::impl::read(size_type skip_rows,
           "Cannot setup timezone LUT");
       }
 
+      // Dictionary columns whose stripes are all dictionary encoded are decoded as indices into
+      // the concatenated dictionaries of their stripes. A stripe whose dictionary is identical to
+      // the previous distinct one of the column reuses its entries, so that the keys are only
+      // unified when the stripes' dictionaries differ
+      std::vector<bool> decode_indices(num_columns);
+      for (size_t j = 0; j < num_columns; ++j) {
+        decode_indices[j]    = (column_types[j].id() == type_id::DICTIONARY32);
+        size_t num_dict_keys = 0;
+        for (size_t i = 0; decode_indices[j] && i < selected_stripes.size(); ++i) {
+          const auto &chunk = chunks[i * num_columns + j];
+          decode_indices[j] =
+            (chunk.encoding_kind == orc::DICTIONARY || chunk.encoding_kind == orc::DICTIONARY_V2);
+          num_dict_keys += chunk.dict_len;
+        }
+        // Columns with only empty dictionaries have no keys to index
+        decode_indices[j] = decode_indices[j] && num_dict_keys != 0;
+        if (!decode_indices[j]) { continue; }
+
+        uint32_t dict_index_base             = 0;
+        const gpu::ColumnDesc *distinct_dict = nullptr;
+        for (size_t i = 0; i < selected_stripes.size(); ++i) {
+          auto &chunk     = chunks[i * num_columns + j];
+          chunk.dtype_len = sizeof(uint32_t);
+          if (chunk.dict_len == 0) { continue; }
+          if (distinct_dict != nullptr && is_same_dictionary(*distinct_dict, chunk, stream)) {
+            chunk.dict_index_base = distinct_dict->dict_index_base;
+          } else {
+            chunk.dict_index_base = dict_index_base;
+            dict_index_base += chunk.dict_len;
+            distinct_dict = &chunk;
+          }
+        }
+      }
+
       std::vector<column_buffer> out_buffers;
       for (size_t i = 0; i < column_types.size(); ++i) {
         bool is_nullable = false;
@@ -799,9 +1343,18 @@ table_with_metadata reader::impl::read(size_type skip_rows,
             break;
           }
         }
-        out_buffers.emplace_back(column_types[i], num_rows, is_nullable, stream, _mr);
+        auto const buffer_id = decode_indices[i] ? type_id::INT32 : decode_type_id(column_types[i]);
+        out_buffers.emplace_back(data_type{buffer_id}, num_rows, is_nullable, stream, _mr);
+        out_buffers.back()._strings_validity_in_mask = true;
+        if (decode_indices[i]) {
+          // Null rows are not written by the decoder, and keep index zero
+          CUDA_TRY(cudaMemsetAsync(
+            out_buffers.back().data(), 0, out_buffers.back().data_size(), stream));
+        }
       }
 
+      rmm::device_vector<gpu::DictionaryEntry> global_dict;
+
       decode_stream_data(chunks,
                          num_dict_entries,
                          skip_rows,
@@ -810,11 +1363,22 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                          row_groups,
                          _metadata->get_row_index_stride(),
                          out_buffers,
+                         global_dict,
                          stream);
 
       for (size_t i = 0; i < column_types.size(); ++i) {
-        out_columns.emplace_back(
-          make_column(column_types[i], num_rows, out_buffers[i], stream, _mr));
+        if (column_types[i].id() == type_id::DICTIONARY32) {
+          out_columns.emplace_back(make_dictionary_column(
+            chunks, global_dict, i, num_rows, decode_indices[i], out_buffers[i], stream));
+        } else {
+          out_columns.emplace_back(
+            make_column(column_types[i], num_rows, out_buffers[i], stream, _mr));
+          // The statistics of the file bound the values of any of its rows
+          auto const &ff = _metadata->ff;
+          out_columns.back()->set_statistics(to_column_statistics(
+            decode_statistics(ff.statistics, _selected_columns[i], ff.types, ff.numberOfRows),
+            column_types[i]));
+        }
       }
     }
   }
@@ -829,6 +1393,11 @@ table_with_metadata reader::impl::read(size_type skip_rows,
     out_metadata.user_data.insert({kv.name, kv.value});
   }
 
+  cudf::detail::report_counter("read_orc", "bytes_read", bytes_read);
+  cudf::detail::report_counter("read_orc", "bytes_decompressed", bytes_decompressed);
+  cudf::detail::report_counter(
+    "read_orc", "rows_skipped", _metadata->get_total_rows() - rows_selected);
+
   return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
 }
 
@@ -871,8 +1440,14 @@ table_with_metadata reader::read_stripe(size_type stripe,
 table_with_metadata reader::read_stripes(const std::vector<size_type> &stripe_list,
                                          cudaStream_t stream)
 {
-  return _impl->read(
-    0, -1, -1, static_cast<size_type>(stripe_list.size()), stripe_list.data(), stream);
+  // An empty list selects no stripes rather than all of them
+  const size_type no_stripes = 0;
+  return _impl->read(0,
+                     -1,
+                     -1,
+                     static_cast<size_type>(stripe_list.size()),
+                     stripe_list.empty() ? &no_stripes : stripe_list.data(),
+                     stream);
 }
 
 // Forward to implementation
@@ -881,6 +1456,9 @@ table_with_metadata reader::read_rows(size_type skip_rows, size_type num_rows, c
   return _impl->read(skip_rows, (num_rows != 0) ? num_rows : -1, -1, -1, nullptr, stream);
 }
 
+// Forward to implementation
+std::vector<block_info> reader::get_stripe_info() { return _impl->get_stripe_info(); }
+
 }  // namespace orc
 }  // namespace detail
 }  // namespace io
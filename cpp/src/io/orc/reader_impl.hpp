@@ -27,6 +27,8 @@
 #include <io/utilities/column_buffer.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
 
+#include <io/statistics/predicate_filter.hpp>
+
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/readers.hpp>
 
@@ -83,6 +85,13 @@ class reader::impl {
                            const size_type *stripe_indices,
                            cudaStream_t stream);
 
+  /**
+   * @brief Returns the size information of the stripes that pass the filters
+   *
+   * @return Size information of each stripe
+   */
+  std::vector<block_info> get_stripe_info();
+
  private:
   /**
    * @brief Decompresses the stripe data, at stream granularity
@@ -118,6 +127,7 @@ class reader::impl {
    * @param row_groups List of row index descriptors
    * @param row_index_stride Distance between each row index
    * @param out_buffers Output columns' device buffers
+   * @param global_dict Output string dictionary entries of all chunks
    * @param stream CUDA stream used for device memory operations and kernel launches.
    */
   void decode_stream_data(hostdevice_vector<gpu::ColumnDesc> &chunks,
@@ -128,20 +138,49 @@ class reader::impl {
                           const rmm::device_vector<gpu::RowGroup> &row_groups,
                           size_t row_index_stride,
                           std::vector<column_buffer> &out_buffers,
+                          rmm::device_vector<gpu::DictionaryEntry> &global_dict,
                           cudaStream_t stream);
 
+  /**
+   * @brief Creates a dictionary column from a decoded string column buffer.
+   *
+   * If the stripes were decoded as dictionary indices, the distinct dictionaries of the column's
+   * stripes are merged into a single set of keys and the indices are remapped onto them.
+   * Otherwise the decoded strings are dictionary encoded.
+   *
+   * @param chunks List of column chunk descriptors
+   * @param global_dict String dictionary entries of all chunks
+   * @param col_idx Index of the output column
+   * @param num_rows Number of rows in the output column
+   * @param is_indices Whether the buffer holds dictionary indices instead of strings
+   * @param buffer Output column's device buffers
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The dictionary column
+   */
+  std::unique_ptr<column> make_dictionary_column(
+    hostdevice_vector<gpu::ColumnDesc> &chunks,
+    const rmm::device_vector<gpu::DictionaryEntry> &global_dict,
+    size_t col_idx,
+    size_type num_rows,
+    bool is_indices,
+    column_buffer &buffer,
+    cudaStream_t stream);
+
  private:
   rmm::mr::device_memory_resource *_mr = nullptr;
   std::unique_ptr<datasource> _source;
   std::unique_ptr<metadata> _metadata;
 
   std::vector<int> _selected_columns;
-  bool _use_index            = true;
-  bool _use_np_dtypes        = true;
-  bool _has_timestamp_column = false;
-  bool _decimals_as_float    = true;
-  int _decimals_as_int_scale = -1;
+  bool _use_index             = true;
+  bool _use_np_dtypes         = true;
+  bool _has_timestamp_column  = false;
+  bool _decimals_as_float     = true;
+  int _decimals_as_int_scale  = -1;
+  bool _strings_to_dictionary = false;
   data_type _timestamp_type{type_id::EMPTY};
+  resolved_predicate_filter _filter;
 };
 
 }  // namespace orc
@@ -1758,6 +1758,13 @@ extern "C" __global__ void __launch_bounds__(NTHREADS)
             case BINARY:
             case VARCHAR:
             case CHAR: {
+              if (s->chunk.dtype_len == sizeof(uint32_t)) {
+                // Output the index in the column's keys instead of the string
+                uint32_t dict_idx = s->vals.u32[t + vals_skipped];
+                reinterpret_cast<uint32_t *>(data_out)[row] =
+                  (dict_idx < s->chunk.dict_len) ? s->chunk.dict_index_base + dict_idx : 0;
+                break;
+              }
               nvstrdesc_s *strdesc = &reinterpret_cast<nvstrdesc_s *>(data_out)[row];
               const uint8_t *ptr;
               uint32_t count;
@@ -44,6 +44,8 @@ struct intrle_enc_state_s {
   uint32_t hdr_bytes;
   uint32_t pl_bytes;
   volatile uint32_t delta_map[(512 / 32) + 1];
+  volatile uint32_t delta_signs[512 / 32];  // 1: increasing, 2: decreasing delta in each warp
+  volatile uint64_t delta_max[512 / 32];    // largest absolute delta in each warp
   volatile union {
     uint32_t u32[(512 / 32) * 2];
     uint64_t u64[(512 / 32) * 2];
@@ -281,6 +283,16 @@ static inline __device__ uint32_t StoreVarint(uint8_t *dst, uint64_t v)
   return bytecnt;
 }
 
+/**
+ * @brief Returns the number of bytes of the varint encoding of a value
+ **/
+static inline __device__ uint32_t VarintLength(uint64_t v)
+{
+  uint32_t bytecnt = 1;
+  for (v >>= 7u; v != 0; v >>= 7u) { bytecnt++; }
+  return bytecnt;
+}
+
 static inline __device__ void intrle_minmax(int64_t &vmin, int64_t &vmax)
 {
   vmin = INT64_MIN;
@@ -412,9 +424,27 @@ static __device__ uint32_t IntegerRLE(
       vmax = max(vmax, (T)SHFL_XOR(vmax, 4));
       vmax = max(vmax, (T)SHFL_XOR(vmax, 8));
       vmax = max(vmax, (T)SHFL_XOR(vmax, 16));
+      // Statistics of the deltas between consecutive values after the first one, which the delta
+      // mode stores bit-packed, thread t holding the delta of values t + 1 and t + 2
+      uint64_t delta_abs  = 0;
+      uint32_t delta_sign = 0;
+      if (t + 2 < literal_run) {
+        delta_abs  = (v2 > v1) ? (uint64_t)v2 - (uint64_t)v1 : (uint64_t)v1 - (uint64_t)v2;
+        delta_sign = (v2 > v1) ? 1 : (v2 < v1) ? 2 : 0;
+      }
+      if (t == 0 && literal_run > 1) { delta_sign |= (v1 > v0) ? 1 : (v1 < v0) ? 2 : 0; }
+      delta_abs                 = max(delta_abs, (uint64_t)SHFL_XOR(delta_abs, 1));
+      delta_abs                 = max(delta_abs, (uint64_t)SHFL_XOR(delta_abs, 2));
+      delta_abs                 = max(delta_abs, (uint64_t)SHFL_XOR(delta_abs, 4));
+      delta_abs                 = max(delta_abs, (uint64_t)SHFL_XOR(delta_abs, 8));
+      delta_abs                 = max(delta_abs, (uint64_t)SHFL_XOR(delta_abs, 16));
+      uint32_t const increasing = BALLOT(delta_sign & 1);
+      uint32_t const decreasing = BALLOT(delta_sign & 2);
       if (!(t & 0x1f)) {
         s->u.intrle.scratch.u64[(t >> 5) * 2 + 0] = vmin;
         s->u.intrle.scratch.u64[(t >> 5) * 2 + 1] = vmax;
+        s->u.intrle.delta_signs[t >> 5]          = (increasing ? 1 : 0) | (decreasing ? 2 : 0);
+        s->u.intrle.delta_max[t >> 5]            = delta_abs;
       }
       __syncthreads();
       if (t < 32) {
@@ -470,6 +500,38 @@ static __device__ uint32_t IntegerRLE(
             else
               w <<= 3;  // bytes -> bits
             s->u.intrle.literal_w = w;
+
+            // Monotonic runs, such as sorted keys or timestamps, are often smaller in delta mode:
+            // the first value and delta are stored as varints, and the following deltas, all of
+            // the sign of the first one, bit-packed. Width 1 is not available to delta mode, whose
+            // width code 0 denotes a fixed delta.
+            uint32_t signs     = 0;
+            uint64_t delta_max = 0;
+            for (uint32_t i = 0; i < 512 / 32; i++) {
+              signs |= s->u.intrle.delta_signs[i];
+              delta_max = max(delta_max, (uint64_t)s->u.intrle.delta_max[i]);
+            }
+            uint64_t first_delta = (v1 > v0) ? (uint64_t)v1 - (uint64_t)v0
+                                             : (uint64_t)v0 - (uint64_t)v1;
+            bool monotonic       = !(signs & 2) || (!(signs & 1) && v1 < v0);
+            if (literal_run >= 3 && monotonic && (delta_max >> 56) == 0 &&
+                (first_delta >> 62) == 0) {
+              uint32_t delta_w = 0;
+              while ((delta_max >> delta_w) != 0) { delta_w++; }
+              delta_w = (delta_w <= 2) ? 2 : (delta_w <= 4) ? 4 : ((delta_w + 7) >> 3) << 3;
+
+              uint64_t base = (is_signed) ? (sizeof(T) > 4) ? zigzag64(v0) : zigzag32(v0) : v0;
+              int64_t delta = (v1 > v0) ? (int64_t)first_delta : -(int64_t)first_delta;
+
+              uint32_t delta_size   = 2 + VarintLength(base) + VarintLength(zigzag64(delta)) +
+                                    (((literal_run - 2) * delta_w + 7) >> 3);
+              uint32_t literal_size = ((s->u.intrle.literal_mode == 2) ? 6 : 2) +
+                                      ((literal_run * w + 7) >> 3);
+              if (delta_size < literal_size) {
+                s->u.intrle.literal_mode = 4;
+                s->u.intrle.literal_w    = delta_w;
+              }
+            }
           }
         }
       }
@@ -533,6 +595,34 @@ static __device__ uint32_t IntegerRLE(
         else if (t < literal_run)
           StoreBytesBigEndian(dst + t * (literal_w >> 3), v0, (literal_w >> 3));
         dst += s->u.intrle.pl_bytes;
+      } else if (literal_mode == 4) {
+        // Delta mode with bit-packed deltas
+        if (!t) {
+          uint64_t delta_base = (is_signed) ? (sizeof(T) > 4) ? zigzag64(v0) : zigzag32(v0) : v0;
+          int64_t delta       = (v1 > v0) ? (int64_t)((uint64_t)v1 - (uint64_t)v0)
+                                    : -(int64_t)((uint64_t)v0 - (uint64_t)v1);
+          uint32_t bytecnt    = 2;
+
+          dst[0] = 0xC0 +
+                   ((literal_w < 8) ? literal_w - 1 : kByteLengthToRLEv2_W[literal_w >> 3]) * 2 +
+                   ((literal_run - 1) >> 8);
+          dst[1] = (literal_run - 1) & 0xff;
+          bytecnt += StoreVarint(dst + bytecnt, delta_base);
+          bytecnt += StoreVarint(dst + bytecnt, zigzag64(delta));
+          s->u.intrle.hdr_bytes = bytecnt;
+        }
+        __syncthreads();
+        dst += s->u.intrle.hdr_bytes;
+        uint64_t delta_abs = 0;
+        if (t + 2 < literal_run) {
+          delta_abs = (v2 > v1) ? (uint64_t)v2 - (uint64_t)v1 : (uint64_t)v1 - (uint64_t)v2;
+        }
+        if (literal_w < 8)
+          StoreBitsBigEndian(dst, (uint32_t)delta_abs, literal_w, literal_run - 2, t);
+        else if (t + 2 < literal_run)
+          StoreBytesBigEndian(dst + t * (literal_w >> 3), delta_abs, (literal_w >> 3));
+        dst += ((literal_run - 2) * literal_w + 7) >> 3;
+        literal_w = 0;
       } else {
         // Delta mode
         dst += literal_w;
@@ -1281,6 +1371,7 @@ cudaError_t CompressOrcDataStreams(uint8_t *compressed_data,
                                    gpu_inflate_input_s *comp_in,
                                    gpu_inflate_status_s *comp_out,
                                    uint32_t num_stripe_streams,
+                                   uint32_t first_block,
                                    uint32_t num_compressed_blocks,
                                    CompressionKind compression,
                                    uint32_t comp_blk_size,
@@ -1290,7 +1381,15 @@ cudaError_t CompressOrcDataStreams(uint8_t *compressed_data,
   dim3 dim_grid(num_stripe_streams, 1);
   gpuInitCompressionBlocks<<<dim_grid, dim_block_init, 0, stream>>>(
     strm_desc, chunks, comp_in, comp_out, compressed_data, comp_blk_size);
-  if (compression == SNAPPY) { gpu_snap(comp_in, comp_out, num_compressed_blocks, stream); }
+  // Stream descriptors index the blocks from the start of the block arrays
+  auto const blk_in  = comp_in + first_block;
+  auto const blk_out = comp_out + first_block;
+  switch (compression) {
+    case SNAPPY: gpu_snap(blk_in, blk_out, num_compressed_blocks, stream); break;
+    case ZSTD: gpu_zstd(blk_in, blk_out, num_compressed_blocks, stream); break;
+    case LZ4: gpu_lz4(blk_in, blk_out, num_compressed_blocks, 0, stream); break;
+    default: break;
+  }
   dim3 dim_block_compact(1024, 1);
   gpuCompactCompressedBlocks<<<dim_grid, dim_block_compact, 0, stream>>>(
     strm_desc, comp_in, comp_out, compressed_data, comp_blk_size);
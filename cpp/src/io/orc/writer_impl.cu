@@ -26,6 +26,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <numeric>
 #include <utility>
 
 #include <rmm/thrust_rmm_allocator.h>
@@ -40,10 +41,19 @@ using namespace cudf::io;
 
 namespace {
 /**
- * @brief Helper for pinned host memory
+ * @brief CUDA events that are destroyed when going out of scope
  **/
-template <typename T>
-using pinned_buffer = std::unique_ptr<T, decltype(&cudaFreeHost)>;
+struct event_list {
+  std::vector<cudaEvent_t> events;
+
+  explicit event_list(size_t count) : events(count, nullptr) {}
+  ~event_list()
+  {
+    for (auto &event : events) {
+      if (event != nullptr) { cudaEventDestroy(event); }
+    }
+  }
+};
 
 /**
  * @brief Function that translates GDF compression to ORC compression
@@ -53,6 +63,8 @@ orc::CompressionKind to_orc_compression(compression_type compression)
   switch (compression) {
     case compression_type::AUTO:
     case compression_type::SNAPPY: return orc::CompressionKind::SNAPPY;
+    case compression_type::ZSTD: return orc::CompressionKind::ZSTD;
+    case compression_type::LZ4: return orc::CompressionKind::LZ4;
     case compression_type::NONE: return orc::CompressionKind::NONE;
     default: CUDF_EXPECTS(false, "Unsupported compression type"); return orc::CompressionKind::NONE;
   }
@@ -838,7 +850,8 @@ void writer::impl::write_index_stream(int32_t stripe_id,
                                       hostdevice_vector<gpu_inflate_status_s> const &comp_out,
                                       StripeInformation &stripe,
                                       std::vector<Stream> &streams,
-                                      ProtobufWriter *pbw)
+                                      ProtobufWriter *pbw,
+                                      detail::async_sink_writer &out)
 {
   // 0: position, 1: block position, 2: compressed position, 3: compressed size
   std::array<int32_t, 4> present;
@@ -909,27 +922,23 @@ void writer::impl::write_index_stream(int32_t stripe_id,
     buffer_[1]             = static_cast<uint8_t>(uncomp_ix_len >> 8);
     buffer_[2]             = static_cast<uint8_t>(uncomp_ix_len >> 16);
   }
-  out_sink_->host_write(buffer_.data(), buffer_.size());
+  out.host_write(buffer_.data(), buffer_.size());
   stripe.indexLength += buffer_.size();
 }
 
 void writer::impl::write_data_stream(gpu::StripeStream const &strm_desc,
                                      gpu::EncChunk const &chunk,
                                      uint8_t const *compressed_data,
-                                     uint8_t *stream_out,
                                      StripeInformation &stripe,
                                      std::vector<Stream> &streams,
-                                     cudaStream_t stream)
+                                     detail::async_sink_writer &out)
 {
   const auto length                                  = strm_desc.stream_size;
   streams[chunk.strm_id[strm_desc.strm_type]].length = length;
   if (length != 0) {
     const auto *stream_in = (compression_kind_ == NONE) ? chunk.streams[strm_desc.strm_type]
                                                         : (compressed_data + strm_desc.bfr_offset);
-    CUDA_TRY(cudaMemcpyAsync(stream_out, stream_in, length, cudaMemcpyDeviceToHost, stream));
-    CUDA_TRY(cudaStreamSynchronize(stream));
-
-    out_sink_->host_write(stream_out, length);
+    out.device_write(stream_in, length);
   }
   stripe.dataLength += length;
 }
@@ -957,7 +966,9 @@ void writer::impl::add_uncompressed_block_headers(std::vector<uint8_t> &v)
 writer::impl::impl(std::unique_ptr<data_sink> sink,
                    writer_options const &options,
                    rmm::mr::device_memory_resource *mr)
-  : compression_kind_(to_orc_compression(options.compression)),
+  : max_stripe_size_(options.stripe_size_bytes),
+    max_stripe_rows_(options.stripe_size_rows),
+    compression_kind_(to_orc_compression(options.compression)),
     enable_statistics_(options.enable_statistics),
     out_sink_(std::move(sink)),
     _mr(mr)
@@ -1029,27 +1040,41 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
                       state.stream);
   }
 
-  // Decide stripe boundaries early on, based on uncompressed size
-  std::vector<uint32_t> stripe_list;
-  for (size_t g = 0, stripe_start = 0, stripe_size = 0; g < num_rowgroups; g++) {
-    size_t rowgroup_size = 0;
+  // Decide stripe boundaries early on, based on uncompressed size. The rowgroups are split in the
+  // fewest stripes within the size and row limits, stripe `k` ending at the rowgroup closest to
+  // `k + 1` equal shares of the total size, so that the stripes are of similar sizes rather than a
+  // few full ones and a small last one.
+  std::vector<size_t> rowgroup_sizes(num_rowgroups, 0);
+  for (size_t g = 0; g < num_rowgroups; g++) {
     for (int i = 0; i < num_columns; i++) {
       if (orc_columns[i].is_string()) {
         const auto dt = orc_columns[i].host_dict_chunk(g);
-        rowgroup_size += 1 * row_index_stride_;
-        rowgroup_size += dt->string_char_count;
+        rowgroup_sizes[g] += 1 * row_index_stride_;
+        rowgroup_sizes[g] += dt->string_char_count;
       } else {
-        rowgroup_size += orc_columns[i].type_width() * row_index_stride_;
+        rowgroup_sizes[g] += orc_columns[i].type_width() * row_index_stride_;
       }
     }
+  }
+  const auto total_size  = std::accumulate(rowgroup_sizes.begin(), rowgroup_sizes.end(), size_t{0});
+  const auto max_size    = std::max<size_t>(max_stripe_size_, 1);
+  const auto max_groups  = std::max<size_t>(max_stripe_rows_ / row_index_stride_, 1);
+  const auto num_stripes = std::max({cudf::util::div_rounding_up_safe(total_size, max_size),
+                                     cudf::util::div_rounding_up_safe(num_rowgroups, max_groups),
+                                     size_t{1}});
+  const auto target_size = cudf::util::div_rounding_up_safe(total_size, num_stripes);
 
-    // Apply rows per stripe limit to limit string dictionaries
-    const size_t max_stripe_rows = !str_col_ids.empty() ? 1000000 : 5000000;
-    if ((g > stripe_start) && (stripe_size + rowgroup_size > max_stripe_size_ ||
-                               (g + 1 - stripe_start) * row_index_stride_ > max_stripe_rows)) {
+  std::vector<uint32_t> stripe_list;
+  for (size_t g = 0, stripe_start = 0, stripe_size = 0, written_size = 0; g < num_rowgroups; g++) {
+    const auto rowgroup_size = rowgroup_sizes[g];
+    const auto stripe_end    = (stripe_list.size() + 1) * target_size;
+    if ((g > stripe_start) && (stripe_size + rowgroup_size > max_size ||
+                               written_size + stripe_size + rowgroup_size / 2 > stripe_end ||
+                               g - stripe_start >= max_groups)) {
       stripe_list.push_back(g - stripe_start);
       stripe_start = g;
-      stripe_size  = 0;
+      written_size += stripe_size;
+      stripe_size = 0;
     }
     stripe_size += rowgroup_size;
     if (g + 1 == num_rowgroups) { stripe_list.push_back(num_rowgroups - stripe_start); }
@@ -1115,78 +1140,88 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
                                           state.stream);
   }
 
-  // Allocate intermediate output stream buffer
+  // Assign each data stream its range of compressed blocks
   size_t compressed_bfr_size   = 0;
   size_t num_compressed_blocks = 0;
-  auto stream_output           = [&]() {
-    size_t max_stream_size = 0;
-
-    for (size_t stripe_id = 0; stripe_id < stripe_list.size(); stripe_id++) {
-      for (size_t i = 0; i < num_data_streams; i++) {
-        gpu::StripeStream *ss = &strm_desc[stripe_id * num_data_streams + i];
-        size_t stream_size    = ss->stream_size;
-        if (compression_kind_ != NONE) {
-          ss->first_block = num_compressed_blocks;
-          ss->bfr_offset  = compressed_bfr_size;
-
-          auto num_blocks = std::max<uint32_t>(
-            (stream_size + compression_blocksize_ - 1) / compression_blocksize_, 1);
-          stream_size += num_blocks * 3;
-          num_compressed_blocks += num_blocks;
-          compressed_bfr_size += stream_size;
-        }
-        max_stream_size = std::max(max_stream_size, stream_size);
-      }
+  if (compression_kind_ != NONE) {
+    for (size_t i = 0; i < num_stripe_streams; i++) {
+      gpu::StripeStream *ss = &strm_desc[i];
+      auto num_blocks       = std::max<uint32_t>(
+        (ss->stream_size + compression_blocksize_ - 1) / compression_blocksize_, 1);
+      ss->first_block = num_compressed_blocks;
+      ss->bfr_offset  = compressed_bfr_size;
+      num_compressed_blocks += num_blocks;
+      compressed_bfr_size += ss->stream_size + num_blocks * 3;
     }
+  }
 
-    return pinned_buffer<uint8_t>{[](size_t size) {
-                                    uint8_t *ptr = nullptr;
-                                    CUDA_TRY(cudaMallocHost(&ptr, size));
-                                    return ptr;
-                                  }(max_stream_size),
-                                  cudaFreeHost};
-  }();
-
-  // Compress the data streams
+  // Compress the data streams in groups of stripes, so that the completed groups can be written
+  // while the later ones are still being compressed
+  const size_t num_stripe_groups =
+    std::min(stripes.size(), static_cast<size_t>(MAX_STRIPE_GROUPS));
+  const size_t stripes_per_group = cudf::util::div_rounding_up_safe(
+    std::max<size_t>(stripes.size(), 1), std::max<size_t>(num_stripe_groups, 1));
   rmm::device_buffer compressed_data(compressed_bfr_size, state.stream);
   hostdevice_vector<gpu_inflate_status_s> comp_out(num_compressed_blocks);
   hostdevice_vector<gpu_inflate_input_s> comp_in(num_compressed_blocks);
+  event_list group_compressed(num_stripe_groups);
   if (compression_kind_ != NONE) {
     CUDA_TRY(cudaMemcpyAsync(strm_desc.device_ptr(),
                              strm_desc.host_ptr(),
                              strm_desc.memory_size(),
                              cudaMemcpyHostToDevice,
                              state.stream));
-    CUDA_TRY(gpu::CompressOrcDataStreams(static_cast<uint8_t *>(compressed_data.data()),
-                                         strm_desc.device_ptr(),
-                                         chunks.device_ptr(),
-                                         comp_in.device_ptr(),
-                                         comp_out.device_ptr(),
-                                         num_stripe_streams,
-                                         num_compressed_blocks,
-                                         compression_kind_,
-                                         compression_blocksize_,
-                                         state.stream));
-    CUDA_TRY(cudaMemcpyAsync(strm_desc.host_ptr(),
-                             strm_desc.device_ptr(),
-                             strm_desc.memory_size(),
-                             cudaMemcpyDeviceToHost,
-                             state.stream));
-    CUDA_TRY(cudaMemcpyAsync(comp_out.host_ptr(),
-                             comp_out.device_ptr(),
-                             comp_out.memory_size(),
-                             cudaMemcpyDeviceToHost,
-                             state.stream));
-    CUDA_TRY(cudaStreamSynchronize(state.stream));
+    for (size_t g = 0; g < num_stripe_groups; g++) {
+      const auto first_stream = g * stripes_per_group * num_data_streams;
+      const auto last_stream =
+        std::min((g + 1) * stripes_per_group, stripes.size()) * num_data_streams;
+      if (first_stream >= last_stream) { continue; }
+      const auto first_block = strm_desc[first_stream].first_block;
+      const auto last_block  = (last_stream < num_stripe_streams)
+                                ? strm_desc[last_stream].first_block
+                                : static_cast<uint32_t>(num_compressed_blocks);
+      CUDA_TRY(gpu::CompressOrcDataStreams(static_cast<uint8_t *>(compressed_data.data()),
+                                           strm_desc.device_ptr() + first_stream,
+                                           chunks.device_ptr(),
+                                           comp_in.device_ptr(),
+                                           comp_out.device_ptr(),
+                                           last_stream - first_stream,
+                                           first_block,
+                                           last_block - first_block,
+                                           compression_kind_,
+                                           compression_blocksize_,
+                                           state.stream));
+      CUDA_TRY(cudaMemcpyAsync(strm_desc.host_ptr() + first_stream,
+                               strm_desc.device_ptr() + first_stream,
+                               (last_stream - first_stream) * sizeof(gpu::StripeStream),
+                               cudaMemcpyDeviceToHost,
+                               state.stream));
+      CUDA_TRY(cudaMemcpyAsync(comp_out.host_ptr() + first_block,
+                               comp_out.device_ptr() + first_block,
+                               (last_block - first_block) * sizeof(gpu_inflate_status_s),
+                               cudaMemcpyDeviceToHost,
+                               state.stream));
+      CUDA_TRY(cudaEventCreateWithFlags(&group_compressed.events[g], cudaEventDisableTiming));
+      CUDA_TRY(cudaEventRecord(group_compressed.events[g], state.stream));
+    }
   }
 
   ProtobufWriter pbw_(&buffer_);
 
-  // Write stripes
+  // Write stripes; sink writes run in the background and overlap the remaining compression.
+  // Uncompressed streams are complete, as gathering the stripes synchronizes the stream
+  detail::async_sink_writer out(*out_sink_);
   size_t group = 0;
   for (size_t stripe_id = 0; stripe_id < stripes.size(); stripe_id++) {
+    // The stream sizes and block sizes of the stripe are known once its group is compressed
+    if (compression_kind_ != NONE && stripe_id % stripes_per_group == 0) {
+      auto const event = group_compressed.events[stripe_id / stripes_per_group];
+      CUDA_TRY(cudaEventSynchronize(event));
+      out.wait_event(event);
+    }
+
     auto groups_in_stripe     = div_by_rowgroups(stripes[stripe_id].numberOfRows);
-    stripes[stripe_id].offset = out_sink_->bytes_written();
+    stripes[stripe_id].offset = out.bytes_written();
 
     // Column (skippable) index streams appear at the start of the stripe
     stripes[stripe_id].indexLength = 0;
@@ -1203,7 +1238,8 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
                          comp_out,
                          stripes[stripe_id],
                          streams,
-                         &pbw_);
+                         &pbw_,
+                         out);
     }
 
     // Column data consisting one or more separate streams
@@ -1215,10 +1251,9 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
       write_data_stream(ss,
                         ck,
                         static_cast<uint8_t *>(compressed_data.data()),
-                        stream_output.get(),
                         stripes[stripe_id],
                         streams,
-                        state.stream);
+                        out);
     }
 
     // Write stripefooter consisting of stream information
@@ -1243,10 +1278,12 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
       buffer_[1]             = static_cast<uint8_t>(uncomp_sf_len >> 8);
       buffer_[2]             = static_cast<uint8_t>(uncomp_sf_len >> 16);
     }
-    out_sink_->host_write(buffer_.data(), buffer_.size());
+    out.host_write(buffer_.data(), buffer_.size());
 
     group += groups_in_stripe;
   }
+  // The device data written above must remain valid until the writes complete
+  out.flush();
 
   if (column_stats.size() != 0) {
     // File-level statistics
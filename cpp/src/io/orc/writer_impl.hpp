@@ -24,6 +24,7 @@
 #include "orc.h"
 #include "orc_gpu.h"
 
+#include <io/utilities/async_sink_writer.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
 
 #include <cudf/detail/utilities/integer_utils.hpp>
@@ -58,6 +59,12 @@ class writer::impl {
   // ORC datasets are divided into fixed-size, independent stripes
   static constexpr uint32_t DEFAULT_STRIPE_SIZE = 64 * 1024 * 1024;
 
+  // Stripes are limited in rows to bound the size of their string dictionaries
+  static constexpr uint32_t DEFAULT_STRIPE_ROWS = 1000000;
+
+  // Stripes are compressed in up to this many groups, each written once it is compressed
+  static constexpr uint32_t MAX_STRIPE_GROUPS = 8;
+
   // ORC rows are divided into groups and assigned indexes for faster seeking
   static constexpr uint32_t DEFAULT_ROW_INDEX_STRIDE = 10000;
 
@@ -260,6 +267,7 @@ class writer::impl {
    * @param comp_out Output status for compressed streams
    * @param streams List of all streams
    * @param pbw Protobuf writer
+   * @param out Writer to the output sink
    **/
   void write_index_stream(int32_t stripe_id,
                           int32_t stream_id,
@@ -273,7 +281,8 @@ class writer::impl {
                           hostdevice_vector<gpu_inflate_status_s> const& comp_out,
                           StripeInformation& stripe,
                           std::vector<Stream>& streams,
-                          ProtobufWriter* pbw);
+                          ProtobufWriter* pbw,
+                          detail::async_sink_writer& out);
 
   /**
    * @brief Write the specified column's data streams
@@ -281,18 +290,16 @@ class writer::impl {
    * @param strm_desc Stream's descriptor
    * @param chunk First column chunk of the stream
    * @param compressed_data Compressed stream data
-   * @param stream_out Temporary host output buffer
    * @param stripe Stream's parent stripe
    * @param streams List of all streams
-   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @param out Writer to the output sink; the data must remain valid until it is flushed
    **/
   void write_data_stream(gpu::StripeStream const& strm_desc,
                          gpu::EncChunk const& chunk,
                          uint8_t const* compressed_data,
-                         uint8_t* stream_out,
                          StripeInformation& stripe,
                          std::vector<Stream>& streams,
-                         cudaStream_t stream);
+                         detail::async_sink_writer& out);
 
   /**
    * @brief Insert 3-byte uncompressed block headers in a byte vector
@@ -329,6 +336,7 @@ class writer::impl {
   rmm::mr::device_memory_resource* _mr = nullptr;
 
   size_t max_stripe_size_           = DEFAULT_STRIPE_SIZE;
+  size_t max_stripe_rows_           = DEFAULT_STRIPE_ROWS;
   size_t row_index_stride_          = DEFAULT_ROW_INDEX_STRIDE;
   size_t compression_blocksize_     = DEFAULT_COMPRESSION_BLOCKSIZE;
   CompressionKind compression_kind_ = CompressionKind::NONE;
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file bloom_filter.hpp
+ * @brief Parquet split-block Bloom filter (SBBF) primitives shared by the writer and the reader
+ *
+ * A filter is an array of 32-byte blocks of eight 32-bit words. Values are hashed with xxHash64
+ * (seed 0) over their plain encoding, without the length prefix for byte arrays. The upper 32
+ * bits of the hash select a block and the lower 32 bits set one bit in each word of the block.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <stdint.h>
+
+namespace cudf {
+namespace io {
+namespace parquet {
+constexpr uint32_t kBloomFilterBlockWords = 8;
+constexpr uint32_t kBloomFilterBlockBytes = kBloomFilterBlockWords * sizeof(uint32_t);
+constexpr uint32_t kBloomFilterMinBytes   = kBloomFilterBlockBytes;
+constexpr uint32_t kBloomFilterMaxBytes   = 128 * 1024 * 1024;
+
+namespace xxhash64_detail {
+constexpr uint64_t prime1 = 11400714785074694791ull;
+constexpr uint64_t prime2 = 14029467366897019727ull;
+constexpr uint64_t prime3 = 1609587929392839161ull;
+constexpr uint64_t prime4 = 9650029242287828579ull;
+constexpr uint64_t prime5 = 2870177450012600261ull;
+
+CUDA_HOST_DEVICE_CALLABLE uint64_t rotl(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+CUDA_HOST_DEVICE_CALLABLE uint32_t load32(const uint8_t *p)
+{
+  return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+CUDA_HOST_DEVICE_CALLABLE uint64_t load64(const uint8_t *p)
+{
+  return load32(p) | (static_cast<uint64_t>(load32(p + 4)) << 32);
+}
+
+CUDA_HOST_DEVICE_CALLABLE uint64_t hash_round(uint64_t acc, uint64_t input)
+{
+  return rotl(acc + input * prime2, 31) * prime1;
+}
+
+CUDA_HOST_DEVICE_CALLABLE uint64_t merge_round(uint64_t acc, uint64_t val)
+{
+  return (acc ^ hash_round(0, val)) * prime1 + prime4;
+}
+}  // namespace xxhash64_detail
+
+/**
+ * @brief Computes the 64-bit xxHash (seed 0) of a byte sequence
+ */
+CUDA_HOST_DEVICE_CALLABLE uint64_t xxhash64(const uint8_t *data, uint32_t len)
+{
+  using namespace xxhash64_detail;
+  const uint8_t *p   = data;
+  const uint8_t *end = data + len;
+  uint64_t h;
+
+  if (len >= 32) {
+    uint64_t v1 = prime1 + prime2;
+    uint64_t v2 = prime2;
+    uint64_t v3 = 0;
+    uint64_t v4 = 0 - prime1;
+    do {
+      v1 = hash_round(v1, load64(p));
+      v2 = hash_round(v2, load64(p + 8));
+      v3 = hash_round(v3, load64(p + 16));
+      v4 = hash_round(v4, load64(p + 24));
+      p += 32;
+    } while (p + 32 <= end);
+    h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+    h = merge_round(h, v1);
+    h = merge_round(h, v2);
+    h = merge_round(h, v3);
+    h = merge_round(h, v4);
+  } else {
+    h = prime5;
+  }
+  h += len;
+  for (; p + 8 <= end; p += 8) { h = rotl(h ^ hash_round(0, load64(p)), 27) * prime1 + prime4; }
+  if (p + 4 <= end) {
+    h = rotl(h ^ (load32(p) * prime1), 23) * prime2 + prime3;
+    p += 4;
+  }
+  for (; p < end; p++) { h = rotl(h ^ (*p * prime5), 11) * prime1; }
+  h ^= h >> 33;
+  h *= prime2;
+  h ^= h >> 29;
+  h *= prime3;
+  h ^= h >> 32;
+  return h;
+}
+
+/**
+ * @brief Returns the salt used to set the bit of word `i` within a filter block
+ */
+CUDA_HOST_DEVICE_CALLABLE uint32_t bloom_filter_salt(uint32_t i)
+{
+  switch (i) {
+    case 0: return 0x47b6137bu;
+    case 1: return 0x44974d91u;
+    case 2: return 0x8824ad5bu;
+    case 3: return 0xa2b7289du;
+    case 4: return 0x705495c7u;
+    case 5: return 0x2df1424bu;
+    case 6: return 0x9efc4947u;
+    default: return 0x5c6bfb31u;
+  }
+}
+
+/**
+ * @brief Returns the index of the block that a hash maps to
+ */
+CUDA_HOST_DEVICE_CALLABLE uint32_t bloom_filter_block(uint64_t hash, uint32_t num_blocks)
+{
+  return static_cast<uint32_t>(((hash >> 32) * num_blocks) >> 32);
+}
+
+/**
+ * @brief Returns the bit that a hash sets in word `i` of its block
+ */
+CUDA_HOST_DEVICE_CALLABLE uint32_t bloom_filter_mask(uint64_t hash, uint32_t i)
+{
+  return 1u << ((static_cast<uint32_t>(hash) * bloom_filter_salt(i)) >> 27);
+}
+
+/**
+ * @brief Returns whether a value with the given hash may have been inserted into the filter
+ *
+ * @param bitset Filter words, `num_blocks * kBloomFilterBlockWords` in total
+ * @param num_blocks Number of 32-byte blocks in the filter
+ * @param hash xxHash64 of the plain-encoded value
+ */
+CUDA_HOST_DEVICE_CALLABLE bool bloom_filter_may_contain(const uint32_t *bitset,
+                                                        uint32_t num_blocks,
+                                                        uint64_t hash)
+{
+  const uint32_t *block = bitset + bloom_filter_block(hash, num_blocks) * kBloomFilterBlockWords;
+  for (uint32_t i = 0; i < kBloomFilterBlockWords; i++) {
+    uint32_t const mask = bloom_filter_mask(hash, i);
+    if ((block[i] & mask) != mask) { return false; }
+  }
+  return true;
+}
+
+}  // namespace parquet
+}  // namespace io
+}  // namespace cudf
@@ -41,8 +41,21 @@ struct pq_chunked_state {
   cudaStream_t stream;
   /// Overall file metadata.  Filled in during the process and written during write_chunked_end()
   cudf::io::parquet::FileMetaData md;
-  /// current write position for rowgroups/chunks
-  std::size_t current_chunk_offset;
+  /// current write position for rowgroups/chunks, per sink
+  std::vector<std::size_t> current_chunk_offsets;
+  /// first row of each partition written to its own sink; empty when writing a single file
+  std::vector<size_type> partition_offsets;
+  /// partition of each rowgroup, whose rowgroups are contiguous
+  std::vector<std::size_t> rowgroup_partitions;
+  /// page locations of each column chunk, per rowgroup. Written during write_chunked_end()
+  std::vector<std::vector<cudf::io::parquet::OffsetIndex>> offset_indexes;
+  /// per-page statistics of each column chunk, per rowgroup. Written during write_chunked_end()
+  std::vector<std::vector<cudf::io::parquet::ColumnIndex>> column_indexes;
+  /// Bloom filter bitset of each column chunk, per rowgroup. Written during write_chunked_end()
+  std::vector<std::vector<std::vector<uint8_t>>> bloom_filters;
+  /// columns with adaptive dictionary encoding that had too many distinct values for a dictionary
+  /// in all row groups of a previous table, and are no longer analyzed
+  std::vector<bool> high_cardinality_columns;
   /// optional user metadata
   table_metadata_with_nullability user_metadata_with_nullability;
   /// special parameter only used by detail::write() to indicate that we are guaranteeing
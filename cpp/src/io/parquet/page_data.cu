@@ -59,6 +59,19 @@ struct page_state_s {
   int32_t dict_pos;     // write position of dictionary indices
   int32_t out_pos;      // read position of final output
   int32_t ts_scale;     // timestamp scale: <0: divide by -ts_scale, >0: multiply by ts_scale
+  // DELTA_BINARY_PACKED values, or string lengths of DELTA_LENGTH_BYTE_ARRAY
+  const uint8_t *delta_cur;  // start of the current miniblock
+  const uint8_t *delta_bw;   // bit widths of the miniblocks of the current block
+  int64_t delta_min;         // min delta of the current block
+  int64_t delta_last;        // last decoded value
+  int32_t delta_num_values;  // number of encoded values
+  int32_t delta_mb_count;    // number of miniblocks in a block
+  int32_t delta_mb_size;     // number of values in a miniblock
+  int32_t delta_mb_idx;      // current miniblock in its block
+  int32_t delta_mb_pos;      // position of the next value in the current miniblock
+  int32_t delta_mb_bytes;    // size of the current miniblock
+  int32_t delta_bits;        // bit width of the current miniblock
+  uint32_t delta_str_pos;    // byte position of the next DELTA_LENGTH_BYTE_ARRAY string
   uint32_t nz_idx[NZ_BFRSZ];    // circular buffer of non-null row positions
   uint32_t dict_idx[NZ_BFRSZ];  // Dictionary index, boolean, or string offset values
   uint32_t str_len[NZ_BFRSZ];   // String length for plain encoding of strings
@@ -146,6 +159,131 @@ inline __device__ uint32_t get_vlq32(const uint8_t *&cur, const uint8_t *end)
   return v;
 }
 
+/**
+ * @brief Read a 64-bit varint integer
+ *
+ * @param[in,out] cur The current data position, updated after the read
+ * @param[in] end The end data position
+ *
+ * @return The 64-bit value read
+ **/
+inline __device__ uint64_t get_vlq64(const uint8_t *&cur, const uint8_t *end)
+{
+  uint64_t v = 0;
+  for (uint32_t l = 0; l < 64 && cur < end; l += 7) {
+    uint32_t c = *cur++;
+    v |= static_cast<uint64_t>(c & 0x7f) << l;
+    if (c < 0x80) { break; }
+  }
+  return v;
+}
+
+/**
+ * @brief Read a zigzag-encoded 64-bit varint integer
+ *
+ * @param[in,out] cur The current data position, updated after the read
+ * @param[in] end The end data position
+ *
+ * @return The 64-bit signed value read
+ **/
+inline __device__ int64_t get_zigzag64(const uint8_t *&cur, const uint8_t *end)
+{
+  uint64_t u = get_vlq64(cur, end);
+  return static_cast<int64_t>((u >> 1u) ^ -static_cast<int64_t>(u & 1));
+}
+
+/**
+ * @brief Parse the header of DELTA_BINARY_PACKED data
+ *
+ * The header holds the number of values in a block and of miniblocks in a block, the total number
+ * of values and the first value. Blocks are read by gpuDecodeDeltaBinaryPacked as it reaches them.
+ *
+ * @param[in,out] s Page state input/output
+ * @param[in] cur Start of the encoded data
+ * @param[in] end End of the page data
+ *
+ * @return The position of the first block
+ **/
+__device__ const uint8_t *InitDeltaBinaryPacked(page_state_s *s,
+                                                const uint8_t *cur,
+                                                const uint8_t *end)
+{
+  uint32_t block_size = get_vlq32(cur, end);
+  uint32_t mb_count   = get_vlq32(cur, end);
+  s->delta_num_values = get_vlq32(cur, end);
+  s->delta_last       = get_zigzag64(cur, end);
+  s->delta_mb_count   = mb_count;
+  s->delta_mb_size    = (mb_count != 0) ? block_size / mb_count : 0;
+  if (s->delta_mb_size == 0 || (s->delta_mb_size & 0x1f) != 0) { s->error = 1; }
+  // Position past the end of a (non-existent) last miniblock, so that the first block is read
+  s->delta_cur      = cur;
+  s->delta_mb_idx   = mb_count - 1;
+  s->delta_mb_pos   = s->delta_mb_size;
+  s->delta_mb_bytes = 0;
+  s->delta_bits     = 0;
+  s->delta_str_pos  = 0;
+  return cur;
+}
+
+/**
+ * @brief Returns the end of DELTA_BINARY_PACKED data whose header was parsed
+ *
+ * Only the miniblocks that hold values are present in the last block.
+ *
+ * @param[in] cur Position of the first block
+ * @param[in] end End of the page data
+ * @param[in] num_values Number of encoded values, including the first value of the header
+ * @param[in] mb_count Number of miniblocks in a block
+ * @param[in] mb_size Number of values in a miniblock
+ *
+ * @return The position following the last miniblock
+ **/
+__device__ const uint8_t *SkipDeltaBinaryPacked(
+  const uint8_t *cur, const uint8_t *end, int32_t num_values, int32_t mb_count, int32_t mb_size)
+{
+  int32_t remaining = num_values - 1;
+  while (remaining > 0 && cur < end) {
+    get_vlq64(cur, end);  // min delta
+    const uint8_t *bw = cur;
+    cur += mb_count;
+    for (int i = 0; i < mb_count && remaining > 0 && cur <= end; i++) {
+      cur += (mb_size >> 3) * bw[i];
+      remaining -= mb_size;
+    }
+  }
+  return cur;
+}
+
+/**
+ * @brief Reads a bit-packed value of 0 to 64 bits
+ *
+ * @param[in] base Start of the bit-packed data
+ * @param[in] end End of the page data
+ * @param[in] ofs Bit position of the value
+ * @param[in] bits Bit width of the value
+ *
+ * @return The value read, with the bits past the end of the page data as zeros
+ **/
+inline __device__ uint64_t get_packed_bits(const uint8_t *base,
+                                           const uint8_t *end,
+                                           uint32_t ofs,
+                                           uint32_t bits)
+{
+  const uint8_t *p = base + (ofs >> 3);
+  uint64_t v       = 0;
+  ofs &= 7;
+  if (bits > 0 && p < end) {
+    uint32_t c = 8 - ofs;
+    v          = (*p++) >> ofs;
+    while (c < bits && p < end) {
+      v |= static_cast<uint64_t>(*p++) << c;
+      c += 8;
+    }
+    if (bits < 64) { v &= (1ull << bits) - 1; }
+  }
+  return v;
+}
+
 /**
  * @brief Parse the beginning of the level section (definition or repetition),
  * initializes the initial RLE run & value, and returns the section length
@@ -498,6 +636,92 @@ __device__ int gpuDecodeRleBooleans(volatile page_state_s *s, int target_pos, in
   return pos;
 }
 
+/**
+ * @brief Decodes DELTA_BINARY_PACKED values, 32 values of a miniblock at a time
+ *
+ * The values are stored as the low and high words in the dict_idx and str_len buffers, except
+ * for the string lengths of DELTA_LENGTH_BYTE_ARRAY pages, whose positions and lengths are stored
+ * as gpuInitStringDescriptors does for plain strings.
+ *
+ * @param[in,out] s Page state input/output
+ * @param[in] target_pos Target index position in dict_idx buffer (may exceed this value by up to
+ *31)
+ * @param[in] t Warp1 thread ID (0..31)
+ *
+ * @return The new output position
+ **/
+__device__ int gpuDecodeDeltaBinaryPacked(volatile page_state_s *s, int target_pos, int t)
+{
+  const uint8_t *end = s->data_end;
+  int num_values     = s->delta_num_values;
+  int is_strings     = (s->page.encoding == DELTA_LENGTH_BYTE_ARRAY);
+  int pos            = s->dict_pos;
+
+  while (pos < target_pos) {
+    // The first value is stored in the header, and each miniblock holds a multiple of 32 deltas
+    int batch_len = (pos == 0) ? 1 : 32;
+    int has_data  = (pos > 0 && pos < num_values);
+    if (!t && has_data && s->delta_mb_pos >= s->delta_mb_size) {
+      // Move to the next miniblock, reading the header of the next block if needed
+      const uint8_t *cur = s->delta_cur + s->delta_mb_bytes;
+      int mb_idx         = s->delta_mb_idx + 1;
+      if (mb_idx >= s->delta_mb_count) {
+        s->delta_min = get_zigzag64(cur, end);
+        s->delta_bw  = cur;
+        cur += s->delta_mb_count;
+        mb_idx = 0;
+      }
+      int bits = (s->delta_bw + mb_idx < end) ? s->delta_bw[mb_idx] : 0;
+      if (bits > 64) {
+        s->error = 1;
+        bits     = 0;
+      }
+      s->delta_cur      = cur;
+      s->delta_mb_idx   = mb_idx;
+      s->delta_mb_pos   = 0;
+      s->delta_mb_bytes = (s->delta_mb_size >> 3) * bits;
+      s->delta_bits     = bits;
+      __threadfence_block();
+    }
+    SYNCWARP();
+    uint64_t delta = 0;
+    if (has_data) {
+      int bits     = s->delta_bits;
+      uint32_t ofs = (s->delta_mb_pos + t) * bits;
+      delta        = s->delta_min + get_packed_bits(s->delta_cur, end, ofs, bits);
+    } else if (pos == 0 && t == 0) {
+      delta = s->delta_last;
+    }
+    // Running sum of the deltas
+    int64_t val      = WarpReducePos32(delta, t) + ((pos == 0) ? 0 : s->delta_last);
+    uint32_t str_end = 0;
+    if (is_strings) {
+      uint32_t len     = (t < batch_len && pos + t < num_values) ? static_cast<uint32_t>(val) : 0;
+      uint32_t str_pos = s->delta_str_pos;
+      str_end          = WarpReducePos32(len, t) + str_pos;
+      str_pos          = str_end - len;
+      if (t < batch_len) {
+        s->dict_idx[(pos + t) & (NZ_BFRSZ - 1)] = str_pos;
+        s->str_len[(pos + t) & (NZ_BFRSZ - 1)]  = (str_end <= (uint32_t)s->dict_size) ? len : 0;
+      }
+      str_end = SHFL(str_end, batch_len - 1);
+    } else if (t < batch_len) {
+      s->dict_idx[(pos + t) & (NZ_BFRSZ - 1)] = static_cast<uint32_t>(val);
+      s->str_len[(pos + t) & (NZ_BFRSZ - 1)]  = static_cast<uint32_t>(val >> 32);
+    }
+    val = SHFL(val, batch_len - 1);
+    SYNCWARP();
+    if (!t && (pos == 0 || has_data)) {
+      s->delta_last = val;
+      if (is_strings) { s->delta_str_pos = str_end; }
+      if (has_data) { s->delta_mb_pos += 32; }
+      __threadfence_block();
+    }
+    pos += batch_len;
+  }
+  return pos;
+}
+
 /**
  * @brief Parses the length and position of strings
  *
@@ -540,13 +764,19 @@ __device__ void gpuInitStringDescriptors(volatile page_state_s *s, int target_po
  *
  * @param[in,out] s Page state input/output
  * @param[in] src_pos Source position
- * @param[in] dstv Pointer to row output data (string descriptor or 32-bit hash)
+ * @param[in] dstv Pointer to row output data (string descriptor, 32-bit hash or dictionary index)
  **/
 inline __device__ void gpuOutputString(volatile page_state_s *s, int src_pos, void *dstv)
 {
   const char *ptr = NULL;
   size_t len      = 0;
 
+  if (s->dtype_len == 4 && s->col.dict_index_base >= 0) {
+    // Output dictionary index, relative to the column's combined dictionaries
+    uint32_t dict_idx = (s->dict_bits > 0) ? s->dict_idx[src_pos & (NZ_BFRSZ - 1)] : 0;
+    *reinterpret_cast<int32_t *>(dstv) = s->col.dict_index_base + dict_idx;
+    return;
+  }
   if (s->dict_base) {
     // String dictionary
     uint32_t dict_pos =
@@ -845,6 +1075,41 @@ inline __device__ void gpuOutputDecimal(volatile page_state_s *s,
   *dst  = (scale < 0) ? (d * kPow10[min(-scale, 39)]) : (d / kPow10[min(scale, 39)]);
 }
 
+/**
+ * @brief Output an INT32 or INT64 value decoded by gpuDecodeDeltaBinaryPacked
+ *
+ * @param[in,out] s Page state input/output
+ * @param[in] src_pos Source position
+ * @param[in] dst Pointer to row output data
+ **/
+inline __device__ void gpuOutputDeltaValue(volatile page_state_s *s, int src_pos, uint8_t *dst)
+{
+  uint64_t v  = s->str_len[src_pos & (NZ_BFRSZ - 1)];
+  int64_t val = static_cast<int64_t>((v << 32) | s->dict_idx[src_pos & (NZ_BFRSZ - 1)]);
+  if ((s->col.data_type & 7) == INT32) { val = static_cast<int32_t>(val); }
+  if (s->col.converted_type == DECIMAL) {
+    int32_t scale = s->col.decimal_scale;
+    double d      = __ll2double_rn(val);
+    *reinterpret_cast<double *>(dst) =
+      (scale < 0) ? (d * kPow10[min(-scale, 39)]) : (d / kPow10[min(scale, 39)]);
+    return;
+  }
+  int32_t ts_scale = s->ts_scale;
+  if (ts_scale < 0) {
+    // round towards negative infinity
+    int sign = (val < 0);
+    val      = ((val + sign) / -ts_scale) + sign;
+  } else if (ts_scale > 0) {
+    val *= ts_scale;
+  }
+  switch (s->dtype_len) {
+    case 1: *reinterpret_cast<int8_t *>(dst) = static_cast<int8_t>(val); break;
+    case 2: *reinterpret_cast<int16_t *>(dst) = static_cast<int16_t>(val); break;
+    case 4: *reinterpret_cast<int32_t *>(dst) = static_cast<int32_t>(val); break;
+    default: *reinterpret_cast<int64_t *>(dst) = val; break;
+  }
+}
+
 /**
  * @brief Output a small fixed-length value
  *
@@ -1012,7 +1277,7 @@ extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
         if (dtype_len_out == 1) s->dtype_len = 1;  // INT8 output
         if (dtype_len_out == 2) s->dtype_len = 2;  // INT16 output
       } else if ((s->col.data_type & 7) == BYTE_ARRAY && dtype_len_out == 4) {
-        s->dtype_len = 4;  // HASH32 output
+        s->dtype_len = 4;  // HASH32 or dictionary index output
       } else if ((s->col.data_type & 7) == INT96) {
         s->dtype_len = 8;  // Convert to 64-bit timestamp
       }
@@ -1035,12 +1300,12 @@ extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
       if (page_start_row + s->num_rows > min_row + num_rows) {
         s->num_rows = (int32_t)max((int64_t)(min_row + num_rows - page_start_row), INT64_C(0));
       }
+      // Find the compressed size of repetition levels, which precede the definition levels
+      cur +=
+        InitLevelSection(s, cur, end, s->page.repetition_level_encoding, s->col.rep_level_bits, 1);
       // Find the compressed size of definition levels
       cur +=
         InitLevelSection(s, cur, end, s->page.definition_level_encoding, s->col.def_level_bits, 0);
-      // Find the compressed size of repetition levels
-      cur +=
-        InitLevelSection(s, cur, end, s->page.repetition_level_encoding, s->col.rep_level_bits, 1);
       s->dict_bits = 0;
       s->dict_base = 0;
       s->dict_size = 0;
@@ -1068,6 +1333,18 @@ extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
           if ((s->col.data_type & 7) == BOOLEAN) { s->dict_run = s->dict_size * 2 + 1; }
           break;
         case RLE: s->dict_run = 0; break;
+        case DELTA_BINARY_PACKED:
+          if ((s->col.data_type & 7) != INT32 && (s->col.data_type & 7) != INT64) { s->error = 1; }
+          cur = InitDeltaBinaryPacked(s, cur, end);
+          break;
+        case DELTA_LENGTH_BYTE_ARRAY:
+          // String lengths encoded as DELTA_BINARY_PACKED, followed by the concatenated strings
+          if ((s->col.data_type & 7) != BYTE_ARRAY) { s->error = 1; }
+          cur          = InitDeltaBinaryPacked(s, cur, end);
+          cur          = SkipDeltaBinaryPacked(
+            cur, end, s->delta_num_values, s->delta_mb_count, s->delta_mb_size);
+          s->dict_size = static_cast<int32_t>(end - cur);
+          break;
         default:
           s->error = 1;  // Unsupported encoding
           break;
@@ -1088,6 +1365,9 @@ extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
   __syncthreads();
   if (s->dict_base) {
     out_thread0 = (s->dict_bits > 0) ? 64 : 32;
+  } else if (s->page.encoding == DELTA_BINARY_PACKED ||
+             s->page.encoding == DELTA_LENGTH_BYTE_ARRAY) {
+    out_thread0 = 64;
   } else {
     out_thread0 =
       ((s->col.data_type & 7) == BOOLEAN || (s->col.data_type & 7) == BYTE_ARRAY) ? 64 : 32;
@@ -1112,6 +1392,9 @@ extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
       // WARP1: Decode dictionary indices, booleans or string positions
       if (s->dict_base) {
         target_pos = gpuDecodeDictionaryIndices(s, target_pos, t & 0x1f);
+      } else if (s->page.encoding == DELTA_BINARY_PACKED ||
+                 s->page.encoding == DELTA_LENGTH_BYTE_ARRAY) {
+        target_pos = gpuDecodeDeltaBinaryPacked(s, target_pos, t & 0x1f);
       } else if ((s->col.data_type & 7) == BOOLEAN) {
         target_pos = gpuDecodeRleBooleans(s, target_pos, t & 0x1f);
       } else if ((s->col.data_type & 7) == BYTE_ARRAY) {
@@ -1130,6 +1413,8 @@ extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
           gpuOutputString(s, out_pos, dst);
         else if (dtype == BOOLEAN)
           gpuOutputBoolean(s, out_pos, dst);
+        else if (s->page.encoding == DELTA_BINARY_PACKED)
+          gpuOutputDeltaValue(s, out_pos, dst);
         else if (s->col.converted_type == DECIMAL)
           gpuOutputDecimal(s, out_pos, reinterpret_cast<double *>(dst), dtype);
         else if (dtype == INT96)
@@ -1157,6 +1442,330 @@ extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
   }
 }
 
+/**
+ * @brief Decodes a RLE/bit-packed hybrid stream of levels
+ *
+ * @param[in] cur Start of the encoded levels
+ * @param[in] end End of the encoded levels
+ * @param[in] level_bits Number of bits per level (1..8)
+ * @param[in] num_values Number of levels to decode
+ * @param[out] out Decoded levels
+ * @param[in] t Thread ID within the warp (0..31)
+ **/
+inline __device__ void gpuDecodeLevelStream(
+  const uint8_t *cur, const uint8_t *end, int level_bits, int32_t num_values, uint8_t *out, int t)
+{
+  int32_t pos = 0;
+  while (pos < num_values && cur < end) {
+    // Every thread parses the run header, which keeps the warp in sync without shuffles
+    uint32_t run = get_vlq32(cur, end);
+    if (run & 1) {
+      // Literal run of groups of 8 bit-packed values
+      int32_t batch_len = min(static_cast<int32_t>((run >> 1) * 8), num_values - pos);
+      for (int32_t i = t; i < batch_len; i += 32) {
+        int bitpos         = i * level_bits;
+        const uint8_t *src = cur + (bitpos >> 3);
+        uint32_t v         = (src < end) ? src[0] : 0;
+        if (src + 1 < end) { v |= src[1] << 8; }
+        out[pos + i] = (v >> (bitpos & 7)) & ((1 << level_bits) - 1);
+      }
+      cur += (run >> 1) * level_bits;
+      pos += batch_len;
+    } else {
+      // Repeated value
+      int32_t batch_len = min(static_cast<int32_t>(run >> 1), num_values - pos);
+      uint8_t v         = (cur < end) ? cur[0] : 0;
+      cur++;
+      for (int32_t i = t; i < batch_len; i += 32) { out[pos + i] = v; }
+      pos += batch_len;
+    }
+  }
+}
+
+/**
+ * @brief Kernel for reading the repetition and definition levels of data pages
+ *
+ * Only RLE-encoded levels are decoded; the deprecated BIT_PACKED level encoding is left as zeros.
+ *
+ * @param[in] pages List of pages
+ * @param[in] num_pages Number of pages
+ * @param[in] chunks List of column chunks
+ * @param[in] num_chunks Number of column chunks
+ * @param[in] min_row Row corresponding to the start of the level outputs
+ **/
+// blockDim {128,1,1}
+extern "C" __global__ void __launch_bounds__(128) gpuDecodePageLevels(PageInfo *pages,
+                                                                      int32_t num_pages,
+                                                                      ColumnChunkDesc const *chunks,
+                                                                      int32_t num_chunks,
+                                                                      size_t min_row)
+{
+  int t        = threadIdx.x & 0x1f;
+  int page_idx = (blockIdx.x << 2) + (threadIdx.x >> 5);
+  if (page_idx >= num_pages) { return; }
+
+  PageInfo const &page = pages[page_idx];
+  if ((page.flags & PAGEINFO_FLAGS_DICTIONARY) || (uint32_t)page.chunk_idx >= (uint32_t)num_chunks) {
+    return;
+  }
+  ColumnChunkDesc const &col = chunks[page.chunk_idx];
+  if (!col.rep_levels || page.num_values <= 0) { return; }
+
+  size_t const out_pos = col.start_row + page.chunk_row - min_row;
+  const uint8_t *cur   = page.page_data;
+  const uint8_t *end   = cur + page.uncompressed_page_size;
+  for (int lvl = 0; lvl < 2; lvl++) {
+    // Repetition levels come first
+    int level_bits = (lvl == 0) ? col.rep_level_bits : col.def_level_bits;
+    int encoding   = (lvl == 0) ? page.repetition_level_encoding : page.definition_level_encoding;
+    uint8_t *out   = ((lvl == 0) ? col.rep_levels : col.def_levels) + out_pos;
+    if (level_bits == 0) {
+      for (int32_t i = t; i < page.num_values; i += 32) { out[i] = 0; }
+      continue;
+    }
+    if (encoding != RLE || cur + 4 > end) { return; }
+    uint32_t len = cur[0] + (cur[1] << 8) + (cur[2] << 16) + (cur[3] << 24);
+    cur += 4;
+    const uint8_t *lvl_end = (len < end - cur) ? cur + len : end;
+    gpuDecodeLevelStream(cur, lvl_end, level_bits, page.num_values, out, t);
+    cur += len;
+  }
+}
+
+/**
+ * @brief State of a DELTA_BINARY_PACKED stream read one value at a time
+ **/
+struct delta_reader_s {
+  const uint8_t *cur;  // start of the current miniblock
+  const uint8_t *end;  // end of the page data
+  const uint8_t *bw;   // bit widths of the miniblocks of the current block
+  uint64_t min_delta;  // min delta of the current block
+  uint64_t last;       // last decoded value
+  int32_t num_values;  // number of encoded values
+  int32_t pos;         // number of values read
+  int32_t mb_count;    // number of miniblocks in a block
+  int32_t mb_size;     // number of values in a miniblock
+  int32_t mb_idx;      // current miniblock in its block
+  int32_t mb_pos;      // position of the next value in the current miniblock
+  int32_t bits;        // bit width of the current miniblock
+};
+
+/**
+ * @brief Parse the header of DELTA_BINARY_PACKED data into a delta reader
+ *
+ * @param[out] r Delta reader
+ * @param[in] cur Start of the encoded data
+ * @param[in] end End of the page data
+ *
+ * @return False if the header is invalid
+ **/
+inline __device__ bool InitDeltaReader(delta_reader_s *r, const uint8_t *cur, const uint8_t *end)
+{
+  uint32_t block_size = get_vlq32(cur, end);
+  uint32_t mb_count   = get_vlq32(cur, end);
+  r->num_values       = get_vlq32(cur, end);
+  r->last             = get_zigzag64(cur, end);
+  r->cur              = cur;
+  r->end              = end;
+  r->bw               = cur;
+  r->min_delta        = 0;
+  r->pos              = 0;
+  r->mb_count         = mb_count;
+  r->mb_size          = (mb_count != 0) ? block_size / mb_count : 0;
+  // Position past the end of a (non-existent) last miniblock, so that the first block is read
+  r->mb_idx = r->mb_count - 1;
+  r->mb_pos = r->mb_size;
+  r->bits   = 0;
+  return r->num_values >= 0 && r->mb_size != 0 && (r->mb_size & 0x1f) == 0 && cur <= end;
+}
+
+/**
+ * @brief Returns the next value of a delta reader
+ **/
+inline __device__ int64_t DeltaReaderNext(delta_reader_s *r)
+{
+  if (r->pos++ == 0) { return static_cast<int64_t>(r->last); }
+  if (r->mb_pos >= r->mb_size) {
+    r->cur += (r->mb_size >> 3) * r->bits;
+    if (++r->mb_idx >= r->mb_count) {
+      r->min_delta = get_zigzag64(r->cur, r->end);
+      r->bw        = r->cur;
+      r->cur += r->mb_count;
+      r->mb_idx = 0;
+    }
+    r->bits   = (r->bw + r->mb_idx < r->end) ? min(static_cast<int32_t>(r->bw[r->mb_idx]), 64) : 0;
+    r->mb_pos = 0;
+  }
+  r->last += r->min_delta + get_packed_bits(r->cur, r->end, r->mb_pos * r->bits, r->bits);
+  r->mb_pos++;
+  return static_cast<int64_t>(r->last);
+}
+
+/**
+ * @brief Returns the size of a definition or repetition level section, as parsed by
+ * InitLevelSection
+ **/
+inline __device__ uint32_t LevelSectionSize(
+  const uint8_t *cur, const uint8_t *end, int encoding, int level_bits, int32_t num_values)
+{
+  if (level_bits == 0) { return 0; }
+  if (encoding == BIT_PACKED) { return (num_values * level_bits + 7) >> 3; }
+  if (encoding != RLE || cur + 4 > end) { return 0; }
+  return 4 + (cur[0] + (cur[1] << 8) + (cur[2] << 16) + (cur[3] << 24));
+}
+
+/**
+ * @brief Locates the levels, prefix lengths, suffix lengths and suffixes of a DELTA_BYTE_ARRAY
+ * page
+ *
+ * @param[in] page Data page
+ * @param[in] col Column chunk of the page
+ * @param[out] prefixes Reader of the prefix lengths
+ * @param[out] suffixes Reader of the suffix lengths
+ * @param[out] suffix_data Start of the concatenated suffixes
+ *
+ * @return The size of the levels preceding the values, or -1 if the page is invalid
+ **/
+__device__ int32_t InitDeltaByteArray(PageInfo const &page,
+                                      ColumnChunkDesc const &col,
+                                      delta_reader_s *prefixes,
+                                      delta_reader_s *suffixes,
+                                      const uint8_t *&suffix_data)
+{
+  const uint8_t *cur = page.page_data;
+  const uint8_t *end = cur + page.uncompressed_page_size;
+  cur += LevelSectionSize(
+    cur, end, page.repetition_level_encoding, col.rep_level_bits, page.num_values);
+  cur += LevelSectionSize(
+    cur, end, page.definition_level_encoding, col.def_level_bits, page.num_values);
+  if ((col.data_type & 7) != BYTE_ARRAY || cur > end || !InitDeltaReader(prefixes, cur, end) ||
+      prefixes->num_values > page.num_values) {
+    return -1;
+  }
+  int32_t const levels_size = static_cast<int32_t>(cur - page.page_data);
+  cur = SkipDeltaBinaryPacked(
+    prefixes->cur, end, prefixes->num_values, prefixes->mb_count, prefixes->mb_size);
+  if (cur > end || !InitDeltaReader(suffixes, cur, end)) { return -1; }
+  suffix_data = SkipDeltaBinaryPacked(
+    suffixes->cur, end, suffixes->num_values, suffixes->mb_count, suffixes->mb_size);
+  if (suffix_data > end || suffixes->num_values != prefixes->num_values) { return -1; }
+  return levels_size;
+}
+
+/**
+ * @brief Kernel for computing the size of DELTA_BYTE_ARRAY pages rebuilt as PLAIN pages
+ *
+ * A rebuilt page holds the levels of the page, followed by each string as its 4-byte length and
+ * its characters. Pages of other encodings, and invalid pages, have a size of zero.
+ *
+ * @param[in] pages List of pages
+ * @param[in] num_pages Number of pages
+ * @param[in] chunks List of column chunks
+ * @param[in] num_chunks Number of column chunks
+ * @param[out] sizes Size of each rebuilt page
+ **/
+// blockDim {128,1,1}
+extern "C" __global__ void __launch_bounds__(128)
+  gpuSizeDeltaByteArrayPages(PageInfo const *pages,
+                             int32_t num_pages,
+                             ColumnChunkDesc const *chunks,
+                             int32_t num_chunks,
+                             size_t *sizes)
+{
+  int page_idx = blockIdx.x * 128 + threadIdx.x;
+  if (page_idx >= num_pages) { return; }
+
+  PageInfo const &page = pages[page_idx];
+  sizes[page_idx]      = 0;
+  if (page.encoding != DELTA_BYTE_ARRAY || (page.flags & PAGEINFO_FLAGS_DICTIONARY) ||
+      (uint32_t)page.chunk_idx >= (uint32_t)num_chunks) {
+    return;
+  }
+  delta_reader_s prefixes, suffixes;
+  const uint8_t *suffix_data;
+  int32_t const levels_size =
+    InitDeltaByteArray(page, chunks[page.chunk_idx], &prefixes, &suffixes, suffix_data);
+  if (levels_size < 0) { return; }
+
+  // Each string is the prefix of the previous string, followed by its suffix
+  int64_t const max_suffix_bytes = page.page_data + page.uncompressed_page_size - suffix_data;
+  int64_t size                   = levels_size + 4 * static_cast<int64_t>(prefixes.num_values);
+  int64_t suffix_bytes           = 0;
+  int64_t prev_len               = 0;
+  for (int32_t i = 0; i < prefixes.num_values; i++) {
+    int64_t const prefix_len = DeltaReaderNext(&prefixes);
+    int64_t const suffix_len = DeltaReaderNext(&suffixes);
+    if (prefix_len < 0 || prefix_len > prev_len || suffix_len < 0) { return; }
+    suffix_bytes += suffix_len;
+    if (suffix_bytes > max_suffix_bytes) { return; }
+    prev_len = prefix_len + suffix_len;
+    size += prev_len;
+    if (size > INT32_MAX) { return; }
+  }
+  sizes[page_idx] = size;
+}
+
+/**
+ * @brief Kernel for rebuilding DELTA_BYTE_ARRAY pages as PLAIN pages
+ *
+ * The rebuilt pages replace the data and encoding of the pages, so that they are decoded as
+ * PLAIN string pages.
+ *
+ * @param[in,out] pages List of pages
+ * @param[in] num_pages Number of pages
+ * @param[in] chunks List of column chunks
+ * @param[in] num_chunks Number of column chunks
+ * @param[out] out_base Rebuilt pages
+ * @param[in] sizes Size of each rebuilt page, zero for the pages to leave as they are
+ * @param[in] offsets Position of each rebuilt page in `out_base`
+ **/
+// blockDim {128,1,1}
+extern "C" __global__ void __launch_bounds__(128)
+  gpuExpandDeltaByteArrayPages(PageInfo *pages,
+                               int32_t num_pages,
+                               ColumnChunkDesc const *chunks,
+                               int32_t num_chunks,
+                               uint8_t *out_base,
+                               size_t const *sizes,
+                               size_t const *offsets)
+{
+  int t        = threadIdx.x & 0x1f;
+  int page_idx = (blockIdx.x << 2) + (threadIdx.x >> 5);
+  if (page_idx >= num_pages || sizes[page_idx] == 0) { return; }
+
+  // Every thread parses the lengths, which keeps the warp in sync without shuffles; the page was
+  // validated by gpuSizeDeltaByteArrayPages
+  PageInfo &page = pages[page_idx];
+  delta_reader_s prefixes, suffixes;
+  const uint8_t *suffix_data;
+  int32_t const levels_size =
+    InitDeltaByteArray(page, chunks[page.chunk_idx], &prefixes, &suffixes, suffix_data);
+  uint8_t *const out = out_base + offsets[page_idx];
+  for (int32_t i = t; i < levels_size; i += 32) { out[i] = page.page_data[i]; }
+  uint8_t *dst       = out + levels_size;
+  const uint8_t *str = dst;
+  for (int32_t i = 0; i < prefixes.num_values; i++) {
+    uint32_t const prefix_len = static_cast<uint32_t>(DeltaReaderNext(&prefixes));
+    uint32_t const suffix_len = static_cast<uint32_t>(DeltaReaderNext(&suffixes));
+    uint32_t const len        = prefix_len + suffix_len;
+    if (t < 4) { dst[t] = static_cast<uint8_t>(len >> (t * 8)); }
+    dst += 4;
+    for (uint32_t k = t; k < prefix_len; k += 32) { dst[k] = str[k]; }
+    for (uint32_t k = t; k < suffix_len; k += 32) { dst[prefix_len + k] = suffix_data[k]; }
+    // The next string reads its prefix from the characters written by the whole warp
+    SYNCWARP();
+    str = dst;
+    dst += len;
+    suffix_data += suffix_len;
+  }
+  SYNCWARP();
+  if (!t) {
+    page.page_data              = out;
+    page.uncompressed_page_size = static_cast<int32_t>(sizes[page_idx]);
+    page.encoding               = PLAIN;
+  }
+}
+
 cudaError_t __host__ DecodePageData(PageInfo *pages,
                                     int32_t num_pages,
                                     ColumnChunkDesc *chunks,
@@ -1172,6 +1781,56 @@ cudaError_t __host__ DecodePageData(PageInfo *pages,
   return cudaSuccess;
 }
 
+cudaError_t __host__ DecodePageLevels(PageInfo *pages,
+                                      int32_t num_pages,
+                                      ColumnChunkDesc const *chunks,
+                                      int32_t num_chunks,
+                                      size_t min_row,
+                                      cudaStream_t stream)
+{
+  dim3 dim_block(128, 1);
+  dim3 dim_grid((num_pages + 3) >> 2, 1);  // 1 warp per page
+  if (num_pages > 0) {
+    gpuDecodePageLevels<<<dim_grid, dim_block, 0, stream>>>(
+      pages, num_pages, chunks, num_chunks, min_row);
+  }
+  return cudaSuccess;
+}
+
+cudaError_t __host__ SizeDeltaByteArrayPages(PageInfo const *pages,
+                                             int32_t num_pages,
+                                             ColumnChunkDesc const *chunks,
+                                             int32_t num_chunks,
+                                             size_t *sizes,
+                                             cudaStream_t stream)
+{
+  dim3 dim_block(128, 1);
+  dim3 dim_grid((num_pages + 127) >> 7, 1);  // 1 thread per page
+  if (num_pages > 0) {
+    gpuSizeDeltaByteArrayPages<<<dim_grid, dim_block, 0, stream>>>(
+      pages, num_pages, chunks, num_chunks, sizes);
+  }
+  return cudaSuccess;
+}
+
+cudaError_t __host__ ExpandDeltaByteArrayPages(PageInfo *pages,
+                                               int32_t num_pages,
+                                               ColumnChunkDesc const *chunks,
+                                               int32_t num_chunks,
+                                               uint8_t *out_base,
+                                               size_t const *sizes,
+                                               size_t const *offsets,
+                                               cudaStream_t stream)
+{
+  dim3 dim_block(128, 1);
+  dim3 dim_grid((num_pages + 3) >> 2, 1);  // 1 warp per page
+  if (num_pages > 0) {
+    gpuExpandDeltaByteArrayPages<<<dim_grid, dim_block, 0, stream>>>(
+      pages, num_pages, chunks, num_chunks, out_base, sizes, offsets);
+  }
+  return cudaSuccess;
+}
+
 }  // namespace gpu
 }  // namespace parquet
 }  // namespace io
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include <io/utilities/block_utils.cuh>
+#include "bloom_filter.hpp"
 #include "parquet_gpu.h"
 
 namespace cudf {
@@ -28,6 +29,7 @@ namespace gpu {
 struct frag_init_state_s {
   EncColumnDesc col;
   PageFragment frag;
+  uint32_t start_value;
   uint32_t total_dupes;
   volatile uint32_t scratch_red[32];
   uint32_t dict[MAX_PAGE_FRAGMENT_SIZE];
@@ -41,6 +43,11 @@ struct frag_init_state_s {
 #define RLE_BFRSZ (1 << LOG2_RLE_BFRSZ)
 #define RLE_MAX_LIT_RUN 0xfff8  // Maximum literal run for 2-byte run code
 
+// DELTA_BINARY_PACKED blocks of 128 values, in 4 miniblocks of 32 values
+#define DELTA_BLOCK_SIZE 128
+#define DELTA_MINIBLOCKS 4
+#define DELTA_BFRSZ 256
+
 struct page_enc_state_s {
   uint8_t *cur;          //!< current output ptr
   uint8_t *rle_out;      //!< current RLE write ptr
@@ -58,6 +65,12 @@ struct page_enc_state_s {
   gpu_inflate_input_s comp_in;
   gpu_inflate_status_s comp_out;
   uint16_t vals[RLE_BFRSZ];
+  uint32_t delta_pos;        //!< position of the next value to delta encode
+  uint32_t delta_first_row;  //!< first non-null row of the page, whose value is in the header
+  int64_t delta_min[DELTA_MINIBLOCKS];
+  uint32_t delta_bits[DELTA_MINIBLOCKS];
+  int64_t delta_vals[DELTA_BFRSZ];          //!< circular buffer of values to delta encode
+  uint64_t delta_packed[DELTA_BLOCK_SIZE];  //!< deltas of a block, relative to the min delta
 };
 
 /**
@@ -97,7 +110,8 @@ __global__ void __launch_bounds__(512) gpuInitPageFragments(PageFragment *frag,
                                                             int32_t num_fragments,
                                                             int32_t num_columns,
                                                             uint32_t fragment_size,
-                                                            uint32_t max_num_rows)
+                                                            uint32_t max_num_rows,
+                                                            const uint32_t *fragment_starts)
 {
   __shared__ __align__(16) frag_init_state_s state_g;
 
@@ -113,10 +127,20 @@ __global__ void __launch_bounds__(512) gpuInitPageFragments(PageFragment *frag,
     if (i + t < sizeof(s->map) / sizeof(uint32_t)) s->map.u32[i + t] = 0;
   }
   __syncthreads();
-  start_row = blockIdx.y * fragment_size;
+  start_row = (fragment_starts) ? fragment_starts[blockIdx.y] : blockIdx.y * fragment_size;
   if (!t) {
-    s->col.num_rows            = min(s->col.num_rows, max_num_rows);
-    s->frag.num_rows           = min(fragment_size, max_num_rows - min(start_row, max_num_rows));
+    uint32_t end_row =
+      min((fragment_starts) ? fragment_starts[blockIdx.y + 1] : start_row + fragment_size,
+          max_num_rows);
+    if (s->col.row_offsets) {
+      // List columns: the fragment holds the values of its rows
+      s->start_value   = s->col.row_offsets[min(start_row, max_num_rows)];
+      s->frag.num_rows = s->col.row_offsets[end_row] - s->start_value;
+    } else {
+      s->col.num_rows  = min(s->col.num_rows, max_num_rows);
+      s->start_value   = start_row;
+      s->frag.num_rows = end_row - min(start_row, end_row);
+    }
     s->frag.non_nulls          = 0;
     s->frag.num_dict_vals      = 0;
     s->frag.fragment_data_size = 0;
@@ -131,7 +155,8 @@ __global__ void __launch_bounds__(512) gpuInitPageFragments(PageFragment *frag,
     dtype_len_in = (dtype == BYTE_ARRAY) ? sizeof(nvstrdesc_s) : dtype_len;
   }
   __syncthreads();
-  nrows = s->frag.num_rows;
+  start_row = s->start_value;
+  nrows     = s->frag.num_rows;
   for (uint32_t i = 0; i < nrows; i += 512) {
     const uint32_t *valid = s->col.valid_map_base;
     uint32_t row          = start_row + i + t;
@@ -352,7 +377,8 @@ __global__ void __launch_bounds__(128) gpuInitFragmentStats(statistics_group *gr
                                                             const EncColumnDesc *col_desc,
                                                             int32_t num_fragments,
                                                             int32_t num_columns,
-                                                            uint32_t fragment_size)
+                                                            uint32_t fragment_size,
+                                                            const uint32_t *fragment_starts)
 {
   __shared__ __align__(8) statistics_group group_g[4];
 
@@ -361,8 +387,11 @@ __global__ void __launch_bounds__(128) gpuInitFragmentStats(statistics_group *gr
   uint32_t column_id        = blockIdx.x;
   statistics_group *const g = &group_g[threadIdx.x >> 5];
   if (!t && frag_id < num_fragments) {
-    g->col       = &col_desc[column_id];
-    g->start_row = frag_id * fragment_size;
+    const uint32_t *row_offsets = col_desc[column_id].row_offsets;
+    g->col                      = &col_desc[column_id];
+    uint32_t const first_row =
+      (fragment_starts) ? fragment_starts[frag_id] : frag_id * fragment_size;
+    g->start_row = (row_offsets) ? row_offsets[first_row] : first_row;
     g->num_rows  = fragments[column_id * num_fragments + frag_id].num_rows;
   }
   __syncthreads();
@@ -379,7 +408,9 @@ __global__ void __launch_bounds__(128) gpuInitPages(EncColumnChunk *chunks,
                                                     statistics_merge_group *page_grstats,
                                                     statistics_merge_group *chunk_grstats,
                                                     int32_t num_rowgroups,
-                                                    int32_t num_columns)
+                                                    int32_t num_columns,
+                                                    uint32_t max_page_size_bytes,
+                                                    uint32_t max_page_size_rows)
 {
   __shared__ __align__(8) EncColumnDesc col_g;
   __shared__ __align__(8) EncColumnChunk ck_g;
@@ -468,12 +499,15 @@ __global__ void __launch_bounds__(128) gpuInitPages(EncColumnChunk *chunks,
       } else {
         fragment_data_size = frag_g.fragment_data_size;
       }
+      // Pages holding half or a third of the chunk get smaller, to balance the pages of the chunk
       max_page_size = (rows_in_page * 2 >= ck_g.num_rows)
-                        ? 256 * 1024
-                        : (rows_in_page * 3 >= ck_g.num_rows) ? 384 * 1024 : 512 * 1024;
+                        ? max_page_size_bytes / 2
+                        : (rows_in_page * 3 >= ck_g.num_rows) ? max_page_size_bytes / 4 * 3
+                                                              : max_page_size_bytes;
       if (num_rows >= ck_g.num_rows ||
           (rows_in_page > 0 &&
            (page_size + fragment_data_size > max_page_size ||
+            rows_in_page + frag_g.num_rows > max_page_size_rows ||
             (ck_g.has_dictionary && fragments_in_chunk == ck_g.num_dict_fragments)))) {
         uint32_t dict_bits_plus1;
 
@@ -496,13 +530,23 @@ __global__ void __launch_bounds__(128) gpuInitPages(EncColumnChunk *chunks,
           dict_bits_plus1 = dict_bits + 1;
         } else {
           dict_bits_plus1 = 0;
+          if (col_g.delta_encoding) {
+            // DELTA_BINARY_PACKED: header, min delta and bit widths of each block, and the
+            // padding of the last miniblock of 32 values
+            page_size += 25 + 14 * ((rows_in_page + 127) >> 7) + 31 * 8;
+          }
         }
         if (!t) {
           uint32_t def_level_bits = col_g.level_bits & 0xf;
+          uint32_t rep_level_bits = col_g.level_bits >> 4;
           uint32_t def_level_size =
             (def_level_bits)
               ? 4 + 5 + ((def_level_bits * rows_in_page + 7) >> 3) + (rows_in_page >> 8)
               : 0;
+          uint32_t rep_level_size =
+            (rep_level_bits)
+              ? 4 + 5 + ((rep_level_bits * rows_in_page + 7) >> 3) + (rows_in_page >> 8)
+              : 0;
           page_g.num_fragments   = fragments_in_chunk - page_start;
           page_g.chunk_id        = blockIdx.y * num_columns + blockIdx.x;
           page_g.page_type       = DATA_PAGE;
@@ -518,7 +562,7 @@ __global__ void __launch_bounds__(128) gpuInitPages(EncColumnChunk *chunks,
             }
             page_g.max_hdr_size += stats_hdr_len;
           }
-          page_g.max_data_size    = page_size + def_level_size;
+          page_g.max_data_size    = page_size + def_level_size + rep_level_size;
           page_g.page_data        = ck_g.uncompressed_bfr + page_offset;
           page_g.compressed_data  = ck_g.compressed_bfr + comp_page_offset;
           page_g.start_row        = cur_row;
@@ -598,6 +642,27 @@ inline __device__ uint8_t *VlqEncode(uint8_t *p, uint32_t v)
   return p;
 }
 
+/**
+ * @brief Variable-length encode a 64-bit integer
+ **/
+inline __device__ uint8_t *VlqEncode(uint8_t *p, uint64_t v)
+{
+  while (v > 0x7f) {
+    *p++ = (v | 0x80);
+    v >>= 7;
+  }
+  *p++ = v;
+  return p;
+}
+
+/**
+ * @brief Zigzag encode a signed integer
+ **/
+inline __device__ uint64_t ZigZagEncode(int64_t v)
+{
+  return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63);
+}
+
 /**
  * @brief Pack literal values in output bitstream (1,2,4,8,12 or 16 bits per value)
  **/
@@ -814,6 +879,113 @@ static __device__ void PlainBoolEncode(page_enc_state_s *s,
   }
 }
 
+/**
+ * @brief Returns the value of an INT32 or INT64 row, converted as by the plain encoder
+ *
+ * @param[in] s Page encode state
+ * @param[in] row Row of the value
+ * @param[in] dtype_len_in Size of the values in the column
+ */
+inline __device__ int64_t GetIntegerValue(const page_enc_state_s *s,
+                                          uint32_t row,
+                                          uint32_t dtype_len_in)
+{
+  const uint8_t *src8 =
+    reinterpret_cast<const uint8_t *>(s->col.column_data_base) + row * (size_t)dtype_len_in;
+  if (s->col.physical_type == INT32) {
+    if (dtype_len_in == 4) { return *reinterpret_cast<const int32_t *>(src8); }
+    if (dtype_len_in == 2) { return *reinterpret_cast<const int16_t *>(src8); }
+    return *reinterpret_cast<const int8_t *>(src8);
+  }
+  int64_t v        = *reinterpret_cast<const int64_t *>(src8);
+  int32_t ts_scale = s->col.ts_scale;
+  if (ts_scale < 0) {
+    v /= -ts_scale;
+  } else if (ts_scale > 0) {
+    v *= ts_scale;
+  }
+  return v;
+}
+
+/**
+ * @brief DELTA_BINARY_PACKED encoder, for blocks of 128 values in 4 miniblocks of 32 values
+ *
+ * Each thread computes the delta of one value from the previous one. INT32 deltas wrap around as
+ * 32-bit integers, so that they are packed with at most 32 bits.
+ *
+ * @param[in,out] s Page encode state
+ * @param[in] numvals Total count of input values
+ * @param[in] flush nonzero if last batch in block
+ * @param[in] t thread id (0..127)
+ */
+static __device__ void DeltaEncode(page_enc_state_s *s,
+                                   uint32_t numvals,
+                                   uint32_t flush,
+                                   uint32_t t)
+{
+  uint32_t delta_pos = s->delta_pos;
+  bool is_int32      = (s->col.physical_type == INT32);
+
+  while (numvals >= delta_pos + DELTA_BLOCK_SIZE || (flush && delta_pos < numvals)) {
+    uint32_t n    = min(numvals - delta_pos, DELTA_BLOCK_SIZE);
+    uint32_t pos  = delta_pos + t;
+    int64_t delta = INT64_MAX;
+    if (t < n) {
+      uint64_t v    = s->delta_vals[pos & (DELTA_BFRSZ - 1)];
+      uint64_t prev = s->delta_vals[(pos - 1) & (DELTA_BFRSZ - 1)];
+      delta = (is_int32) ? static_cast<int32_t>(v - prev) : static_cast<int64_t>(v - prev);
+    }
+    int64_t min_delta = delta;
+    for (uint32_t i = 1; i < 32; i <<= 1) { min_delta = min(min_delta, SHFL_XOR(min_delta, i)); }
+    if (!(t & 0x1f)) { s->delta_min[t >> 5] = min_delta; }
+    __syncthreads();
+    min_delta = min(min(s->delta_min[0], s->delta_min[1]), min(s->delta_min[2], s->delta_min[3]));
+    // The padding of the last miniblock is zero
+    uint64_t packed =
+      (t < n) ? static_cast<uint64_t>(delta) - static_cast<uint64_t>(min_delta) : 0;
+    uint64_t packed_or = packed;
+    for (uint32_t i = 1; i < 32; i <<= 1) { packed_or |= SHFL_XOR(packed_or, i); }
+    s->delta_packed[t] = packed;
+    if (!(t & 0x1f)) { s->delta_bits[t >> 5] = (packed_or) ? 64 - __clzll(packed_or) : 0; }
+    __syncthreads();
+    if (!t) {
+      // Block header: min delta and the bit width of each miniblock
+      uint8_t *dst = VlqEncode(s->rle_out, ZigZagEncode(min_delta));
+      for (uint32_t i = 0; i < DELTA_MINIBLOCKS; i++) { *dst++ = s->delta_bits[i]; }
+      s->rle_out = dst;
+    }
+    __syncthreads();
+    // Miniblocks of 32 values are 4 * bit width bytes long; those without values are empty
+    uint8_t *dst       = s->rle_out;
+    uint32_t num_bytes = 4 * (s->delta_bits[0] + s->delta_bits[1] + s->delta_bits[2] +
+                              s->delta_bits[3]);
+    for (uint32_t b = t; b < num_bytes; b += DELTA_BLOCK_SIZE) {
+      uint32_t mb = 0, ofs = b;
+      while (ofs >= 4 * s->delta_bits[mb]) {
+        ofs -= 4 * s->delta_bits[mb];
+        mb++;
+      }
+      uint32_t bits = s->delta_bits[mb];
+      uint32_t bit  = ofs * 8;
+      uint32_t v    = 0;
+      for (uint32_t got = 0; got < 8;) {
+        uint32_t idx = bit / bits, shift = bit % bits;
+        uint32_t len = min(bits - shift, 8 - got);
+        v |= static_cast<uint32_t>((s->delta_packed[mb * 32 + idx] >> shift) & ((1u << len) - 1))
+             << got;
+        got += len;
+        bit += len;
+      }
+      dst[b] = v;
+    }
+    delta_pos += n;
+    __syncthreads();
+    if (!t) { s->rle_out = dst + num_bytes; }
+    __syncthreads();
+  }
+  if (!t) { s->delta_pos = delta_pos; }
+}
+
 // blockDim(128, 1, 1)
 __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
                                                          const EncColumnChunk *chunks,
@@ -827,6 +999,7 @@ __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
   uint32_t t                = threadIdx.x;
   uint32_t dtype, dtype_len_in, dtype_len_out;
   int32_t dict_bits;
+  bool is_delta;
 
   if (t < sizeof(EncPage) / sizeof(uint32_t)) {
     reinterpret_cast<uint32_t *>(&s->page)[t] =
@@ -845,11 +1018,15 @@ __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
   __syncthreads();
   if (!t) { s->cur = s->page.page_data + s->page.max_hdr_size; }
   __syncthreads();
-  // Encode NULLs
+  // Encode repetition levels, then definition levels (NULLs). Flat columns only have definition
+  // levels, which are given by the validity of each row.
   if (s->page.page_type != DICTIONARY_PAGE && s->col.level_bits != 0) {
     const uint32_t *valid = s->col.valid_map_base;
-    uint32_t def_lvl_bits = s->col.level_bits & 0xf;
-    if (def_lvl_bits != 0) {
+    for (uint32_t lvl = 0; lvl < 2; lvl++) {
+      const uint8_t *lvl_values = (lvl == 0) ? s->col.rep_values : s->col.def_values;
+      uint32_t lvl_bits         = (lvl == 0) ? s->col.level_bits >> 4 : s->col.level_bits & 0xf;
+      if (lvl_bits == 0) { continue; }
+      __syncthreads();
       if (!t) {
         s->rle_run     = 0;
         s->rle_pos     = 0;
@@ -861,13 +1038,15 @@ __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
         uint32_t rle_numvals = s->rle_numvals;
         uint32_t nrows       = min(s->page.num_rows - rle_numvals, 128);
         uint32_t row         = s->page.start_row + rle_numvals + t;
-        uint32_t def_lvl     = (rle_numvals + t < s->page.num_rows && row < s->col.num_rows)
-                             ? (valid) ? (valid[row >> 5] >> (row & 0x1f)) & 1 : 1
-                             : 0;
-        s->vals[(rle_numvals + t) & (RLE_BFRSZ - 1)] = def_lvl;
+        uint32_t level       = 0;
+        if (rle_numvals + t < s->page.num_rows && row < s->col.num_rows) {
+          level = (lvl_values) ? lvl_values[row]
+                               : (valid) ? (valid[row >> 5] >> (row & 0x1f)) & 1 : 1;
+        }
+        s->vals[(rle_numvals + t) & (RLE_BFRSZ - 1)] = level;
         __syncthreads();
         rle_numvals += nrows;
-        RleEncode(s, rle_numvals, def_lvl_bits, (rle_numvals == s->page.num_rows), t);
+        RleEncode(s, rle_numvals, lvl_bits, (rle_numvals == s->page.num_rows), t);
         __syncthreads();
       }
       if (t < 32) {
@@ -892,18 +1071,42 @@ __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
     dtype_len_in = (dtype == BYTE_ARRAY) ? sizeof(nvstrdesc_s) : dtype_len_out;
   }
   dict_bits = (dtype == BOOLEAN) ? 1 : (s->page.dict_bits_plus1 - 1);
+  is_delta  = (s->page.page_type != DICTIONARY_PAGE && dict_bits < 0 && s->col.delta_encoding);
   if (t == 0) {
-    uint8_t *dst   = s->cur;
-    s->rle_run     = 0;
-    s->rle_pos     = 0;
-    s->rle_numvals = 0;
-    s->rle_out     = dst;
+    uint8_t *dst       = s->cur;
+    s->rle_run         = 0;
+    s->rle_pos         = 0;
+    s->rle_numvals     = 0;
+    s->rle_out         = dst;
+    s->delta_pos       = 1;
+    s->delta_first_row = ~0u;
     if (dict_bits >= 0 && dtype != BOOLEAN) {
       dst[0]     = dict_bits;
       s->rle_out = dst + 1;
     }
   }
   __syncthreads();
+  if (is_delta) {
+    // The header holds the number of non-null values and the first of them
+    const uint32_t *valid = s->col.valid_map_base;
+    uint32_t num_valid    = 0;
+    for (uint32_t cur_row = 0; cur_row < s->page.num_rows; cur_row += 128) {
+      uint32_t row      = s->page.start_row + cur_row + t;
+      uint32_t is_valid = (row < s->col.num_rows && cur_row + t < s->page.num_rows)
+                            ? (valid) ? (valid[row >> 5] >> (row & 0x1f)) & 1 : 1
+                            : 0;
+      if (is_valid) { atomicMin(&s->delta_first_row, row); }
+      num_valid += __syncthreads_count(is_valid);
+    }
+    if (t == 0) {
+      int64_t first = (num_valid != 0) ? GetIntegerValue(s, s->delta_first_row, dtype_len_in) : 0;
+      uint8_t *dst  = VlqEncode(s->rle_out, static_cast<uint32_t>(DELTA_BLOCK_SIZE));
+      dst           = VlqEncode(dst, static_cast<uint32_t>(DELTA_MINIBLOCKS));
+      dst           = VlqEncode(dst, num_valid);
+      s->rle_out    = VlqEncode(dst, ZigZagEncode(first));
+    }
+    __syncthreads();
+  }
   for (uint32_t cur_row = 0; cur_row < s->page.num_rows;) {
     uint32_t nrows = min(s->page.num_rows - cur_row, 128);
     uint32_t row   = s->page.start_row + cur_row + t;
@@ -953,6 +1156,29 @@ __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
       }
       if (t == 0) { s->cur = s->rle_out; }
       __syncthreads();
+    } else if (is_delta) {
+      // DELTA_BINARY_PACKED encoding
+      uint32_t delta_numvals;
+
+      pos = __popc(warp_valids & ((1 << (t & 0x1f)) - 1));
+      if (!(t & 0x1f)) { s->scratch_red[t >> 5] = __popc(warp_valids); }
+      __syncthreads();
+      if (t < 32) { s->scratch_red[t] = WarpReducePos4((t < 4) ? s->scratch_red[t] : 0, t); }
+      __syncthreads();
+      pos           = pos + ((t >= 32) ? s->scratch_red[(t - 32) >> 5] : 0);
+      delta_numvals = s->rle_numvals;
+      if (is_valid) {
+        s->delta_vals[(delta_numvals + pos) & (DELTA_BFRSZ - 1)] =
+          GetIntegerValue(s, row, dtype_len_in);
+      }
+      delta_numvals += s->scratch_red[3];
+      __syncthreads();
+      DeltaEncode(s, delta_numvals, (cur_row == s->page.num_rows), t);
+      if (t == 0) {
+        s->rle_numvals = delta_numvals;
+        s->cur         = s->rle_out;
+      }
+      __syncthreads();
     } else {
       // Non-dictionary encoding
       uint8_t *dst = s->cur;
@@ -1192,7 +1418,8 @@ inline __device__ uint8_t *cpw_put_fldh(uint8_t *p, int f, int cur, int t)
 __device__ uint8_t *EncodeStatistics(uint8_t *start,
                                      const statistics_chunk *s,
                                      const EncColumnDesc *col,
-                                     float *fp_scratch)
+                                     float *fp_scratch,
+                                     uint32_t truncate_length)
 {
   uint8_t *end, dtype, dtype_len;
   dtype = col->stats_dtype;
@@ -1218,10 +1445,14 @@ __device__ uint8_t *EncodeStatistics(uint8_t *start,
     uint32_t lmin, lmax;
 
     if (dtype == dtype_string) {
-      lmin = s->min_value.str_val.length;
       vmin = s->min_value.str_val.ptr;
-      lmax = s->max_value.str_val.length;
       vmax = s->max_value.str_val.ptr;
+      lmin = TruncatedMinLength(static_cast<const uint8_t *>(vmin),
+                                s->min_value.str_val.length,
+                                truncate_length);
+      lmax = TruncatedMaxLength(static_cast<const uint8_t *>(vmax),
+                                s->max_value.str_val.length,
+                                truncate_length);
     } else {
       lmin = lmax = dtype_len;
       if (dtype == dtype_float32) {  // Convert from double to float32
@@ -1235,6 +1466,8 @@ __device__ uint8_t *EncodeStatistics(uint8_t *start,
       }
     }
     CPW_FLD_BINARY(5, vmax, lmax);
+    // A truncated max is incremented to remain an upper bound
+    if (dtype == dtype_string && lmax < s->max_value.str_val.length) { p[-1]++; }
     CPW_FLD_BINARY(6, vmin, lmin);
   }
   CPW_END_STRUCT_NOTERMINATION(end);
@@ -1247,6 +1480,7 @@ __global__ void __launch_bounds__(128) gpuEncodePageHeaders(EncPage *pages,
                                                             const gpu_inflate_status_s *comp_out,
                                                             const statistics_chunk *page_stats,
                                                             const statistics_chunk *chunk_stats,
+                                                            uint32_t stats_truncate_length,
                                                             uint32_t start_page)
 {
   __shared__ __align__(8) EncColumnDesc col_g;
@@ -1276,7 +1510,8 @@ __global__ void __launch_bounds__(128) gpuEncodePageHeaders(EncPage *pages,
 
     if (chunk_stats && start_page + blockIdx.x == ck_g.first_page) {
       hdr_start = (ck_g.is_compressed) ? ck_g.compressed_bfr : ck_g.uncompressed_bfr;
-      hdr_end   = EncodeStatistics(hdr_start, &chunk_stats[page_g.chunk_id], &col_g, fp_scratch);
+      hdr_end   = EncodeStatistics(
+        hdr_start, &chunk_stats[page_g.chunk_id], &col_g, fp_scratch, stats_truncate_length);
       chunks[page_g.chunk_id].ck_stat_size = static_cast<uint32_t>(hdr_end - hdr_start);
     }
     uncompressed_page_size = page_g.max_data_size;
@@ -1302,6 +1537,9 @@ __global__ void __launch_bounds__(128) gpuEncodePageHeaders(EncPage *pages,
     int encoding =
       (page_type == DICTIONARY_PAGE || page_g.dict_bits_plus1 != 0) ? PLAIN_DICTIONARY : PLAIN;
 #endif
+    if (encoding == PLAIN && page_type == DATA_PAGE && col_g.delta_encoding) {
+      encoding = DELTA_BINARY_PACKED;
+    }
     CPW_FLD_INT32(1, page_type)
     CPW_FLD_INT32(2, uncompressed_page_size)
     CPW_FLD_INT32(3, compressed_page_size)
@@ -1315,7 +1553,8 @@ __global__ void __launch_bounds__(128) gpuEncodePageHeaders(EncPage *pages,
       // Optionally encode page-level statistics
       if (page_stats) {
         CPW_FLD_STRUCT_BEGIN(5)
-        p = EncodeStatistics(p, &page_stats[start_page + blockIdx.x], &col_g, fp_scratch);
+        p = EncodeStatistics(
+          p, &page_stats[start_page + blockIdx.x], &col_g, fp_scratch, stats_truncate_length);
         CPW_FLD_STRUCT_END(5)
       }
       CPW_FLD_STRUCT_END(5)
@@ -1389,6 +1628,84 @@ __global__ void __launch_bounds__(1024) gpuGatherPages(EncColumnChunk *chunks, c
   }
 }
 
+/**
+ * @brief Returns the xxHash64 of the plain encoding of a row, converted as in gpuEncodePages
+ */
+inline __device__ uint64_t hash_plain_value(const EncColumnDesc *col,
+                                            uint32_t dtype_len_in,
+                                            uint32_t row)
+{
+  const uint8_t *src8 =
+    reinterpret_cast<const uint8_t *>(col->column_data_base) + row * (size_t)dtype_len_in;
+  uint8_t buf[8];
+  switch (col->physical_type) {
+    case INT32:
+    case FLOAT: {
+      // Unsigned values are hashed as the INT32 that other writers store, i.e. zero-extended
+      bool const is_unsigned = (col->converted_type == UINT_8 || col->converted_type == UINT_16);
+      int32_t v;
+      if (dtype_len_in == 4)
+        v = *reinterpret_cast<const int32_t *>(src8);
+      else if (dtype_len_in == 2)
+        v = is_unsigned ? *reinterpret_cast<const uint16_t *>(src8)
+                        : *reinterpret_cast<const int16_t *>(src8);
+      else
+        v = is_unsigned ? *src8 : *reinterpret_cast<const int8_t *>(src8);
+      for (int i = 0; i < 4; i++) { buf[i] = v >> (i * 8); }
+      return xxhash64(buf, 4);
+    }
+    case INT64: {
+      int64_t v        = *reinterpret_cast<const int64_t *>(src8);
+      int32_t ts_scale = col->ts_scale;
+      if (ts_scale != 0) {
+        if (ts_scale < 0) {
+          v /= -ts_scale;
+        } else {
+          v *= ts_scale;
+        }
+      }
+      for (int i = 0; i < 8; i++) { buf[i] = v >> (i * 8); }
+      return xxhash64(buf, 8);
+    }
+    case DOUBLE: return xxhash64(src8, 8);
+    case BYTE_ARRAY: {
+      const nvstrdesc_s *str = reinterpret_cast<const nvstrdesc_s *>(src8);
+      return xxhash64(reinterpret_cast<const uint8_t *>(str->ptr), (uint32_t)str->count);
+    }
+    default: return 0;
+  }
+}
+
+// blockDim {256,1,1}
+__global__ void __launch_bounds__(256) gpuBuildBloomFilters(EncColumnChunk *chunks)
+{
+  const EncColumnChunk *ck  = &chunks[blockIdx.x];
+  uint32_t *bitset          = ck->bloom_filter;
+  const EncColumnDesc *col  = ck->col_desc;
+  uint32_t const num_blocks = ck->bloom_filter_blocks;
+  uint8_t const dtype       = col->physical_type;
+  uint32_t dtype_len_in;
+
+  if (dtype == INT32) {
+    dtype_len_in = GetDtypeLogicalLen(col->converted_type);
+  } else if (dtype == BYTE_ARRAY) {
+    dtype_len_in = sizeof(nvstrdesc_s);
+  } else {
+    dtype_len_in = (dtype == INT64 || dtype == DOUBLE) ? 8 : 4;
+  }
+  if (bitset == nullptr || num_blocks == 0) { return; }
+  for (uint32_t i = threadIdx.x; i < ck->num_rows; i += blockDim.x) {
+    uint32_t const row    = ck->start_row + i;
+    const uint32_t *valid = col->valid_map_base;
+    if (row >= col->num_rows || (valid && !((valid[row >> 5] >> (row & 0x1f)) & 1))) { continue; }
+    uint64_t const hash = hash_plain_value(col, dtype_len_in, row);
+    uint32_t *block     = bitset + bloom_filter_block(hash, num_blocks) * kBloomFilterBlockWords;
+    for (uint32_t w = 0; w < kBloomFilterBlockWords; w++) {
+      atomicOr(&block[w], bloom_filter_mask(hash, w));
+    }
+  }
+}
+
 /**
  * @brief Launches kernel for initializing encoder page fragments
  *
@@ -1396,6 +1713,9 @@ __global__ void __launch_bounds__(1024) gpuGatherPages(EncColumnChunk *chunks, c
  * @param[in] col_desc Column description array [column_id]
  * @param[in] num_fragments Number of fragments per column
  * @param[in] num_columns Number of columns
+ * @param[in] fragment_size Number of rows per fragment
+ * @param[in] num_rows Number of rows per column
+ * @param[in] fragment_starts First row of each fragment followed by the number of rows, or null
  * @param[in] stream CUDA stream to use, default 0
  *
  * @return cudaSuccess if successful, a CUDA error code otherwise
@@ -1406,11 +1726,12 @@ cudaError_t InitPageFragments(PageFragment *frag,
                               int32_t num_columns,
                               uint32_t fragment_size,
                               uint32_t num_rows,
+                              const uint32_t *fragment_starts,
                               cudaStream_t stream)
 {
   dim3 dim_grid(num_columns, num_fragments);  // 1 threadblock per fragment
   gpuInitPageFragments<<<dim_grid, 512, 0, stream>>>(
-    frag, col_desc, num_fragments, num_columns, fragment_size, num_rows);
+    frag, col_desc, num_fragments, num_columns, fragment_size, num_rows, fragment_starts);
   return cudaSuccess;
 }
 
@@ -1423,6 +1744,7 @@ cudaError_t InitPageFragments(PageFragment *frag,
  * @param[in] num_fragments Number of fragments
  * @param[in] num_columns Number of columns
  * @param[in] fragment_size Max size of each fragment in rows
+ * @param[in] fragment_starts First row of each fragment, or null
  * @param[in] stream CUDA stream to use, default 0
  *
  * @return cudaSuccess if successful, a CUDA error code otherwise
@@ -1433,11 +1755,12 @@ cudaError_t InitFragmentStatistics(statistics_group *groups,
                                    int32_t num_fragments,
                                    int32_t num_columns,
                                    uint32_t fragment_size,
+                                   const uint32_t *fragment_starts,
                                    cudaStream_t stream)
 {
   dim3 dim_grid(num_columns, (num_fragments + 3) >> 2);  // 1 warp per fragment
   gpuInitFragmentStats<<<dim_grid, 128, 0, stream>>>(
-    groups, fragments, col_desc, num_fragments, num_columns, fragment_size);
+    groups, fragments, col_desc, num_fragments, num_columns, fragment_size, fragment_starts);
   return cudaSuccess;
 }
 
@@ -1449,6 +1772,8 @@ cudaError_t InitFragmentStatistics(statistics_group *groups,
  * @param[in] col_desc Column description array [column_id]
  * @param[in] num_rowgroups Number of fragments per column
  * @param[in] num_columns Number of columns
+ * @param[in] max_page_size_bytes Maximum uncompressed size of a page, unless one fragment is larger
+ * @param[in] max_page_size_rows Maximum number of rows (or list values) in a page
  * @param[in] page_grstats Setup for page-level stats
  * @param[in] chunk_grstats Setup for chunk-level stats
  * @param[in] stream CUDA stream to use, default 0
@@ -1460,13 +1785,22 @@ cudaError_t InitEncoderPages(EncColumnChunk *chunks,
                              const EncColumnDesc *col_desc,
                              int32_t num_rowgroups,
                              int32_t num_columns,
+                             uint32_t max_page_size_bytes,
+                             uint32_t max_page_size_rows,
                              statistics_merge_group *page_grstats,
                              statistics_merge_group *chunk_grstats,
                              cudaStream_t stream)
 {
   dim3 dim_grid(num_columns, num_rowgroups);  // 1 threadblock per rowgroup
-  gpuInitPages<<<dim_grid, 128, 0, stream>>>(
-    chunks, pages, col_desc, page_grstats, chunk_grstats, num_rowgroups, num_columns);
+  gpuInitPages<<<dim_grid, 128, 0, stream>>>(chunks,
+                                             pages,
+                                             col_desc,
+                                             page_grstats,
+                                             chunk_grstats,
+                                             num_rowgroups,
+                                             num_columns,
+                                             max_page_size_bytes,
+                                             max_page_size_rows);
   return cudaSuccess;
 }
 
@@ -1528,6 +1862,7 @@ cudaError_t DecideCompression(EncColumnChunk *chunks,
  * @param[in] comp_out Compressor status or nullptr if no compression
  * @param[in] page_stats Optional page-level statistics to be included in page header
  * @param[in] chunk_stats Optional chunk-level statistics to be encoded
+ * @param[in] stats_truncate_length Maximum length of string min/max statistics, 0 for no limit
  * @param[in] stream CUDA stream to use, default 0
  *
  * @return cudaSuccess if successful, a CUDA error code otherwise
@@ -1539,10 +1874,11 @@ cudaError_t EncodePageHeaders(EncPage *pages,
                               const gpu_inflate_status_s *comp_out,
                               const statistics_chunk *page_stats,
                               const statistics_chunk *chunk_stats,
+                              uint32_t stats_truncate_length,
                               cudaStream_t stream)
 {
   gpuEncodePageHeaders<<<num_pages, 128, 0, stream>>>(
-    pages, chunks, comp_out, page_stats, chunk_stats, start_page);
+    pages, chunks, comp_out, page_stats, chunk_stats, stats_truncate_length, start_page);
   return cudaSuccess;
 }
 
@@ -1565,6 +1901,21 @@ cudaError_t GatherPages(EncColumnChunk *chunks,
   return cudaSuccess;
 }
 
+/**
+ * @brief Launches kernel to build the split-block Bloom filters of the column chunks
+ *
+ * @param[in] chunks Column chunks
+ * @param[in] num_chunks Number of column chunks
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ **/
+cudaError_t BuildBloomFilters(EncColumnChunk *chunks, uint32_t num_chunks, cudaStream_t stream)
+{
+  gpuBuildBloomFilters<<<num_chunks, 256, 0, stream>>>(chunks);
+  return cudaSuccess;
+}
+
 }  // namespace gpu
 }  // namespace parquet
 }  // namespace io
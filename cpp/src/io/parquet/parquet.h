@@ -76,6 +76,21 @@ struct SchemaElement {
   }
 };
 
+/**
+ * @brief Thrift-derived struct describing column chunk statistics
+ *
+ * `min`/`max` are the deprecated fields that are only meaningful for signed types, while
+ * `min_value`/`max_value` follow the sort order of the column's logical type.
+ **/
+struct Statistics {
+  std::vector<uint8_t> max;        // deprecated max value in signed comparison order
+  std::vector<uint8_t> min;        // deprecated min value in signed comparison order
+  int64_t null_count     = -1;     // count of null values in the column
+  int64_t distinct_count = -1;     // count of distinct values occurring
+  std::vector<uint8_t> max_value;  // max value for the column, determined by its ColumnOrder
+  std::vector<uint8_t> min_value;  // min value for the column, determined by its ColumnOrder
+};
+
 /**
  * @brief Thrift-derived struct describing a column of data
  **/
@@ -94,6 +109,8 @@ struct ColumnMetaData {
   int64_t dictionary_page_offset =
     0;  // Byte offset from the beginning of file to first (only) dictionary page
   std::vector<uint8_t> statistics_blob;  // Encoded chunk-level statistics as binary blob
+  int64_t bloom_filter_offset = 0;  // Byte offset from beginning of file to the Bloom filter header
+  int32_t bloom_filter_length = 0;  // Size of the Bloom filter header and bitset, in bytes
 };
 
 /**
@@ -189,6 +206,49 @@ struct PageHeader {
   DictionaryPageHeader dictionary_page_header;
 };
 
+/**
+ * @brief Thrift-derived struct describing the location of a data page within the file
+ **/
+struct PageLocation {
+  int64_t offset               = 0;  // Byte offset of the page header from the start of the file
+  int32_t compressed_page_size = 0;  // Size of the page, including the header, in bytes
+  int64_t first_row_index      = 0;  // Index of the page's first row relative to its row group
+};
+
+/**
+ * @brief Thrift-derived struct describing the page locations of a column chunk
+ *
+ * Dictionary pages are not listed; they always precede the first data page.
+ **/
+struct OffsetIndex {
+  std::vector<PageLocation> page_locations;
+};
+
+/**
+ * @brief Thrift-derived struct describing the per-page statistics of a column chunk
+ *
+ * All lists have one entry per data page. The min/max values of pages that only contain nulls are
+ * empty and must be ignored.
+ **/
+struct ColumnIndex {
+  std::vector<bool> null_pages;                  // whether each page only contains nulls
+  std::vector<std::vector<uint8_t>> min_values;  // plain-encoded min value of each page
+  std::vector<std::vector<uint8_t>> max_values;  // plain-encoded max value of each page
+  BoundaryOrder boundary_order = UNORDERED;      // ordering of the min/max values across pages
+  std::vector<int64_t> null_counts;              // optional null count of each page
+};
+
+/**
+ * @brief Thrift-derived struct describing the Bloom filter of a column chunk
+ *
+ * The bitset of `num_bytes` bytes immediately follows the header. Only the split-block algorithm
+ * with xxHash and no compression is defined, so the remaining fields are made of empty unions
+ * that are written as such and skipped when reading.
+ **/
+struct BloomFilterHeader {
+  int32_t num_bytes = 0;  // Size of the bitset in bytes
+};
+
 /**
  * @brief Count the number of leading zeros in an unsigned integer
  **/
@@ -294,6 +354,11 @@ class CompactProtocolReader {
   DECL_PARQUET_STRUCT(DataPageHeader);
   DECL_PARQUET_STRUCT(DictionaryPageHeader);
   DECL_PARQUET_STRUCT(KeyValue);
+  DECL_PARQUET_STRUCT(Statistics);
+  DECL_PARQUET_STRUCT(PageLocation);
+  DECL_PARQUET_STRUCT(OffsetIndex);
+  DECL_PARQUET_STRUCT(ColumnIndex);
+  DECL_PARQUET_STRUCT(BloomFilterHeader);
 #undef DECL_PARQUET_STRUCT
 
  public:
@@ -365,6 +430,10 @@ class CompactProtocolWriter {
   DECL_CPW_STRUCT(KeyValue);
   DECL_CPW_STRUCT(ColumnChunk);
   DECL_CPW_STRUCT(ColumnMetaData);
+  DECL_CPW_STRUCT(PageLocation);
+  DECL_CPW_STRUCT(OffsetIndex);
+  DECL_CPW_STRUCT(ColumnIndex);
+  DECL_CPW_STRUCT(BloomFilterHeader);
 #undef DECL_CPW_STRUCT
 
  protected:
@@ -101,7 +101,10 @@ struct ColumnChunkDesc {
       codec(codec_),
       converted_type(converted_type_),
       decimal_scale(decimal_scale_),
-      ts_clock_rate(ts_clock_rate_)
+      ts_clock_rate(ts_clock_rate_),
+      dict_index_base(-1),
+      rep_levels(nullptr),
+      def_levels(nullptr)
   {
   }
 
@@ -128,22 +131,29 @@ struct ColumnChunkDesc {
   int8_t converted_type;        // converted type enum
   int8_t decimal_scale;         // decimal scale pow(10, -decimal_scale)
   int32_t ts_clock_rate;  // output timestamp clock frequency (0=default, 1000=ms, 1000000000=ns)
+  int32_t dict_index_base;  // offset added to dictionary indices output in place of string
+                            // hashes (-1 outputs hashes)
+  uint8_t *rep_levels;      // output repetition level of each value (nullptr if not needed)
+  uint8_t *def_levels;      // output definition level of each value (nullptr if not needed)
 };
 
 /**
  * @brief Struct describing an encoder column
  **/
 struct EncColumnDesc : stats_column_desc {
-  uint32_t *dict_index;    //!< Dictionary index [row]
-  uint32_t *dict_data;     //!< Dictionary data (unique row indices)
-  uint8_t physical_type;   //!< physical data type
-  uint8_t converted_type;  //!< logical data type
+  uint32_t *dict_index;         //!< Dictionary index [row]
+  uint32_t *dict_data;          //!< Dictionary data (unique row indices)
+  const uint32_t *row_offsets;  //!< First value of each row, for list columns (nullptr if flat)
+  const uint8_t *rep_values;    //!< Repetition level of each value (nullptr if flat)
+  const uint8_t *def_values;    //!< Definition level of each value (nullptr if flat)
+  uint8_t physical_type;        //!< physical data type
+  uint8_t converted_type;       //!< logical data type
   uint8_t level_bits;  //!< bits to encode max definition (lower nibble) & repetition (upper nibble)
                        //!< levels
-  uint8_t pad;
+  uint8_t delta_encoding;  //!< Nonzero to encode non-dictionary pages as DELTA_BINARY_PACKED
 };
 
-#define MAX_PAGE_FRAGMENT_SIZE 5000  //!< Max number of rows in a page fragment
+#define MAX_PAGE_FRAGMENT_SIZE 5000  //!< Max number of rows (or list values) in a page fragment
 
 /**
  * @brief Struct describing an encoder page fragment
@@ -151,10 +161,9 @@ struct EncColumnDesc : stats_column_desc {
 struct PageFragment {
   uint32_t fragment_data_size;  //!< Size of fragment data in bytes
   uint32_t dict_data_size;      //!< Size of dictionary for this fragment
-  uint16_t num_rows;            //!< Number of rows in fragment
-  uint16_t non_nulls;           //!< Number of non-null values
-  uint16_t num_dict_vals;       //!< Number of unique dictionary entries
-  uint16_t pad;
+  uint32_t num_rows;            //!< Number of rows in fragment (values for list columns)
+  uint32_t non_nulls;           //!< Number of non-null values
+  uint32_t num_dict_vals;       //!< Number of unique dictionary entries
 };
 
 /**
@@ -192,13 +201,56 @@ inline uint32_t __device__ GetDtypeLogicalLen(uint8_t parquet_dtype)
   }
 }
 
+/**
+ * @brief Returns the length of a string min statistic truncated to at most `max_length` bytes
+ *
+ * The prefix does not split a UTF-8 character and is a lower bound of the string.
+ *
+ * @param str Characters of the string, at least `max_length + 1` of which are readable if the
+ * string is longer than `max_length`
+ * @param length Length of the string in bytes
+ * @param max_length Maximum length of the statistic, or 0 to keep the whole string
+ **/
+inline uint32_t __device__ __host__ TruncatedMinLength(uint8_t const *str,
+                                                       uint32_t length,
+                                                       uint32_t max_length)
+{
+  if (max_length == 0 || length <= max_length) { return length; }
+  while (max_length > 0 && (str[max_length] & 0xc0) == 0x80) { max_length--; }
+  return max_length;
+}
+
+/**
+ * @brief Returns the length of a string max statistic truncated to at most `max_length` bytes
+ *
+ * The prefix ends with an ASCII character other than DEL, which the writer increments so that
+ * the truncated statistic remains a valid UTF-8 upper bound of the string. The string is kept
+ * whole if there is no such prefix.
+ *
+ * @param str Characters of the string
+ * @param length Length of the string in bytes
+ * @param max_length Maximum length of the statistic, or 0 to keep the whole string
+ **/
+inline uint32_t __device__ __host__ TruncatedMaxLength(uint8_t const *str,
+                                                       uint32_t length,
+                                                       uint32_t max_length)
+{
+  if (max_length == 0 || length <= max_length) { return length; }
+  for (uint32_t len = max_length; len > 0; len--) {
+    if (str[len - 1] < 0x7f) { return len; }
+  }
+  return length;
+}
+
 /**
  * @brief Return worst-case compressed size of compressed data given the uncompressed size
+ *
+ * The per-page overhead covers the ZSTD frame and block headers of small pages.
  **/
 inline size_t __device__ __host__ GetMaxCompressedBfrSize(size_t uncomp_size,
                                                           uint32_t num_pages = 1)
 {
-  return uncomp_size + (uncomp_size >> 7) + num_pages * 8;
+  return uncomp_size + (uncomp_size >> 7) + num_pages * 16;
 }
 
 /**
@@ -210,10 +262,11 @@ struct EncColumnChunk {
   uint8_t *uncompressed_bfr;      //!< Uncompressed page data
   uint8_t *compressed_bfr;        //!< Compressed page data
   const statistics_chunk *stats;  //!< Fragment statistics
+  uint32_t *bloom_filter;         //!< Bloom filter bitset (nullptr if none)
   uint32_t bfr_size;              //!< Uncompressed buffer size
   uint32_t compressed_size;       //!< Compressed buffer size
-  uint32_t start_row;             //!< First row of chunk
-  uint32_t num_rows;              //!< Number of rows in chunk
+  uint32_t start_row;             //!< First row of chunk (first value for list columns)
+  uint32_t num_rows;              //!< Number of rows in chunk (values for list columns)
   uint32_t first_fragment;        //!< First fragment of chunk
   uint32_t first_page;            //!< First page of chunk
   uint32_t num_pages;             //!< Number of pages in chunk
@@ -224,6 +277,7 @@ struct EncColumnChunk {
   uint32_t dictionary_size;       //!< Size of dictionary
   uint32_t total_dict_entries;    //!< Total number of entries in dictionary
   uint32_t ck_stat_size;          //!< Size of chunk-level statistics (included in 1st page header)
+  uint32_t bloom_filter_blocks;   //!< Number of 32-byte blocks in the Bloom filter
 };
 
 /**
@@ -277,6 +331,75 @@ cudaError_t DecodePageData(PageInfo *pages,
                            size_t min_row      = 0,
                            cudaStream_t stream = (cudaStream_t)0);
 
+/**
+ * @brief Launches kernel for reading the repetition and definition levels of the pages
+ *
+ * The levels of each value are written to the `rep_levels` and `def_levels` outputs of the
+ * page's column chunk, at the same position as the value in the column data; chunks without
+ * level outputs are skipped.
+ *
+ * @param[in] pages List of pages
+ * @param[in] num_pages Number of pages
+ * @param[in] chunks List of column chunks
+ * @param[in] num_chunks Number of column chunks
+ * @param[in] min_row Row corresponding to the start of the level outputs
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ **/
+cudaError_t DecodePageLevels(PageInfo *pages,
+                             int32_t num_pages,
+                             ColumnChunkDesc const *chunks,
+                             int32_t num_chunks,
+                             size_t min_row      = 0,
+                             cudaStream_t stream = (cudaStream_t)0);
+
+/**
+ * @brief Launches kernel for computing the size of DELTA_BYTE_ARRAY pages rebuilt as PLAIN pages
+ *
+ * @param[in] pages List of pages
+ * @param[in] num_pages Number of pages
+ * @param[in] chunks List of column chunks
+ * @param[in] num_chunks Number of column chunks
+ * @param[out] sizes Size of each rebuilt page, zero for pages of other encodings or invalid pages
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ **/
+cudaError_t SizeDeltaByteArrayPages(PageInfo const *pages,
+                                    int32_t num_pages,
+                                    ColumnChunkDesc const *chunks,
+                                    int32_t num_chunks,
+                                    size_t *sizes,
+                                    cudaStream_t stream = (cudaStream_t)0);
+
+/**
+ * @brief Launches kernel for rebuilding DELTA_BYTE_ARRAY pages as PLAIN pages
+ *
+ * The prefix-compressed strings of DELTA_BYTE_ARRAY pages are not stored anywhere in the page, so
+ * they are written out with their levels in the PLAIN layout, and the pages are updated to point
+ * to the rebuilt data.
+ *
+ * @param[in,out] pages List of pages
+ * @param[in] num_pages Number of pages
+ * @param[in] chunks List of column chunks
+ * @param[in] num_chunks Number of column chunks
+ * @param[out] out_base Rebuilt pages
+ * @param[in] sizes Size of each rebuilt page, as computed by SizeDeltaByteArrayPages
+ * @param[in] offsets Position of each rebuilt page in `out_base`
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ **/
+cudaError_t ExpandDeltaByteArrayPages(PageInfo *pages,
+                                      int32_t num_pages,
+                                      ColumnChunkDesc const *chunks,
+                                      int32_t num_chunks,
+                                      uint8_t *out_base,
+                                      size_t const *sizes,
+                                      size_t const *offsets,
+                                      cudaStream_t stream = (cudaStream_t)0);
+
 /**
  * @brief Launches kernel for initializing encoder page fragments
  *
@@ -286,6 +409,8 @@ cudaError_t DecodePageData(PageInfo *pages,
  * @param[in] num_columns Number of columns
  * @param[in] fragment_size Number of rows per fragment
  * @param[in] num_rows Number of rows per column
+ * @param[in] fragment_starts First row of each fragment followed by the number of rows
+ * [num_fragments + 1], or null for fragments of `fragment_size` rows
  * @param[in] stream CUDA stream to use, default 0
  *
  * @return cudaSuccess if successful, a CUDA error code otherwise
@@ -296,7 +421,8 @@ cudaError_t InitPageFragments(PageFragment *frag,
                               int32_t num_columns,
                               uint32_t fragment_size,
                               uint32_t num_rows,
-                              cudaStream_t stream = (cudaStream_t)0);
+                              const uint32_t *fragment_starts = nullptr,
+                              cudaStream_t stream             = (cudaStream_t)0);
 
 /**
  * @brief Launches kernel for initializing fragment statistics groups
@@ -307,6 +433,8 @@ cudaError_t InitPageFragments(PageFragment *frag,
  * @param[in] num_fragments Number of fragments
  * @param[in] num_columns Number of columns
  * @param[in] fragment_size Max size of each fragment in rows
+ * @param[in] fragment_starts First row of each fragment [num_fragments], or null for fragments
+ * of `fragment_size` rows
  * @param[in] stream CUDA stream to use, default 0
  *
  * @return cudaSuccess if successful, a CUDA error code otherwise
@@ -317,7 +445,8 @@ cudaError_t InitFragmentStatistics(statistics_group *groups,
                                    int32_t num_fragments,
                                    int32_t num_columns,
                                    uint32_t fragment_size,
-                                   cudaStream_t stream = (cudaStream_t)0);
+                                   const uint32_t *fragment_starts = nullptr,
+                                   cudaStream_t stream             = (cudaStream_t)0);
 
 /**
  * @brief Launches kernel for initializing encoder data pages
@@ -327,6 +456,8 @@ cudaError_t InitFragmentStatistics(statistics_group *groups,
  * @param[in] col_desc Column description array [column_id]
  * @param[in] num_rowgroups Number of fragments per column
  * @param[in] num_columns Number of columns
+ * @param[in] max_page_size_bytes Maximum uncompressed size of a page, unless one fragment is larger
+ * @param[in] max_page_size_rows Maximum number of rows (or list values) in a page
  * @param[in] page_grstats Setup for page-level stats
  * @param[in] chunk_grstats Setup for chunk-level stats
  * @param[in] stream CUDA stream to use, default 0
@@ -338,6 +469,8 @@ cudaError_t InitEncoderPages(EncColumnChunk *chunks,
                              const EncColumnDesc *col_desc,
                              int32_t num_rowgroups,
                              int32_t num_columns,
+                             uint32_t max_page_size_bytes,
+                             uint32_t max_page_size_rows,
                              statistics_merge_group *page_grstats  = nullptr,
                              statistics_merge_group *chunk_grstats = nullptr,
                              cudaStream_t stream                   = (cudaStream_t)0);
@@ -392,6 +525,7 @@ cudaError_t DecideCompression(EncColumnChunk *chunks,
  * @param[in] comp_out Compressor status or nullptr if no compression
  * @param[in] page_stats Optional page-level statistics to be included in page header
  * @param[in] chunk_stats Optional chunk-level statistics to be encoded
+ * @param[in] stats_truncate_length Maximum length of string min/max statistics, 0 for no limit
  * @param[in] stream CUDA stream to use, default 0
  *
  * @return cudaSuccess if successful, a CUDA error code otherwise
@@ -403,6 +537,7 @@ cudaError_t EncodePageHeaders(EncPage *pages,
                               const gpu_inflate_status_s *comp_out = nullptr,
                               const statistics_chunk *page_stats   = nullptr,
                               const statistics_chunk *chunk_stats  = nullptr,
+                              uint32_t stats_truncate_length       = 0,
                               cudaStream_t stream                  = (cudaStream_t)0);
 
 /**
@@ -421,6 +556,22 @@ cudaError_t GatherPages(EncColumnChunk *chunks,
                         uint32_t num_chunks,
                         cudaStream_t stream = (cudaStream_t)0);
 
+/**
+ * @brief Launches kernel to build the split-block Bloom filters of the column chunks
+ *
+ * Each chunk with a zero-initialized `bloom_filter` bitset gets the hashes of its non-null values
+ * inserted, using the same value conversions as the page encoder.
+ *
+ * @param[in] chunks Column chunks
+ * @param[in] num_chunks Number of column chunks
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ **/
+cudaError_t BuildBloomFilters(EncColumnChunk *chunks,
+                              uint32_t num_chunks,
+                              cudaStream_t stream = (cudaStream_t)0);
+
 /**
  * @brief Launches kernel for building chunk dictionaries
  *
@@ -19,10 +19,20 @@
  * @brief cuDF-IO Parquet reader class implementation
  */
 
+#include "bloom_filter.hpp"
 #include "reader_impl.hpp"
 
 #include <io/comp/gpuinflate.h>
-
+#include <io/statistics/predicate_filter.hpp>
+#include <io/statistics/predicate_rows.hpp>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/dictionary/detail/encode.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
@@ -30,8 +40,16 @@
 #include <rmm/thrust_rmm_allocator.h>
 #include <rmm/device_buffer.hpp>
 
+#include <thrust/copy.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
 #include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstring>
+#include <future>
 #include <numeric>
 #include <regex>
 
@@ -147,6 +165,406 @@ std::tuple<int32_t, int32_t, int8_t> conversion_info(type_id column_type_id,
   return std::make_tuple(type_width, clock_rate, converted_type);
 }
 
+/**
+ * @brief Decodes the min/max statistics of a column chunk for predicate evaluation
+ *
+ * Only statistics that follow the natural ordering of the physical value are decoded; decimal
+ * and INT96 columns, as well as unsigned values outside the signed 64-bit range, report no
+ * min/max so that predicates never skip them.
+ */
+minmax_statistics decode_statistics(ColumnChunk const &chunk,
+                                    SchemaElement const &schema,
+                                    int64_t num_rows)
+{
+  using literal_kind = minmax_statistics::literal_kind;
+
+  minmax_statistics stats;
+  stats.num_rows = num_rows;
+  switch (schema.type) {
+    case parquet::BYTE_ARRAY:
+    case parquet::FIXED_LEN_BYTE_ARRAY: stats.kind = literal_kind::STRING; break;
+    case parquet::FLOAT:
+    case parquet::DOUBLE: stats.kind = literal_kind::FLOAT; break;
+    default: stats.kind = literal_kind::INTEGER; break;
+  }
+
+  auto const &blob = chunk.meta_data.statistics_blob;
+  if (blob.empty()) { return stats; }
+  Statistics file_stats;
+  CompactProtocolReader cp(blob.data(), blob.size());
+  if (not cp.read(&file_stats)) { return stats; }
+  stats.null_count = file_stats.null_count;
+
+  auto const converted   = schema.converted_type;
+  bool const is_unsigned = converted == parquet::UINT_8 || converted == parquet::UINT_16 ||
+                           converted == parquet::UINT_32 || converted == parquet::UINT_64;
+  if (converted == parquet::DECIMAL || schema.type == parquet::INT96) { return stats; }
+
+  // The deprecated fields are only ordered correctly for signed numeric values
+  auto const *min_blob = &file_stats.min_value;
+  auto const *max_blob = &file_stats.max_value;
+  if (max_blob->empty()) {
+    if (stats.kind == literal_kind::STRING || is_unsigned) { return stats; }
+    min_blob = &file_stats.min;
+    max_blob = &file_stats.max;
+  }
+
+  auto load = [](std::vector<uint8_t> const &v, auto &value) {
+    if (v.size() != sizeof(value)) { return false; }
+    memcpy(&value, v.data(), sizeof(value));
+    return true;
+  };
+  switch (schema.type) {
+    case parquet::BOOLEAN:
+      if (min_blob->size() != 1 || max_blob->size() != 1) { return stats; }
+      stats.int_min    = (*min_blob)[0];
+      stats.int_max    = (*max_blob)[0];
+      stats.has_minmax = true;
+      break;
+    case parquet::INT32: {
+      int32_t vmin, vmax;
+      if (!load(*min_blob, vmin) || !load(*max_blob, vmax)) { return stats; }
+      stats.int_min    = is_unsigned ? static_cast<int64_t>(static_cast<uint32_t>(vmin)) : vmin;
+      stats.int_max    = is_unsigned ? static_cast<int64_t>(static_cast<uint32_t>(vmax)) : vmax;
+      stats.has_minmax = true;
+    } break;
+    case parquet::INT64: {
+      int64_t vmin, vmax;
+      if (!load(*min_blob, vmin) || !load(*max_blob, vmax)) { return stats; }
+      // Unsigned values above INT64_MAX wrap around in the signed representation
+      if (is_unsigned && (vmin < 0 || vmax < 0)) { return stats; }
+      stats.int_min    = vmin;
+      stats.int_max    = vmax;
+      stats.has_minmax = true;
+    } break;
+    case parquet::FLOAT: {
+      float vmin, vmax;
+      if (!load(*min_blob, vmin) || !load(*max_blob, vmax)) { return stats; }
+      if (std::isnan(vmin) || std::isnan(vmax)) { return stats; }
+      stats.float_min  = vmin;
+      stats.float_max  = vmax;
+      stats.has_minmax = true;
+    } break;
+    case parquet::DOUBLE: {
+      double vmin, vmax;
+      if (!load(*min_blob, vmin) || !load(*max_blob, vmax)) { return stats; }
+      if (std::isnan(vmin) || std::isnan(vmax)) { return stats; }
+      stats.float_min  = vmin;
+      stats.float_max  = vmax;
+      stats.has_minmax = true;
+    } break;
+    case parquet::BYTE_ARRAY:
+    case parquet::FIXED_LEN_BYTE_ARRAY:
+      stats.string_min.assign(min_blob->cbegin(), min_blob->cend());
+      stats.string_max.assign(max_blob->cbegin(), max_blob->cend());
+      stats.has_minmax = true;
+      break;
+    default: break;
+  }
+  return stats;
+}
+
+/**
+ * @brief Reads the split-block Bloom filter of a column chunk
+ *
+ * @return The filter words, or an empty filter if the chunk has none or it cannot be parsed
+ */
+std::vector<uint32_t> read_bloom_filter(datasource &source, ColumnChunk const &chunk)
+{
+  // Large enough for any header of a filter up to kBloomFilterMaxBytes
+  constexpr size_t max_header_size = 64;
+
+  std::vector<uint32_t> bitset;
+  auto const offset = static_cast<size_t>(chunk.meta_data.bloom_filter_offset);
+  if (offset == 0 || offset >= source.size()) { return bitset; }
+  auto const length = (chunk.meta_data.bloom_filter_length > 0)
+                        ? static_cast<size_t>(chunk.meta_data.bloom_filter_length)
+                        : std::min(max_header_size, source.size() - offset);
+  auto buffer = source.host_read(offset, length);
+  BloomFilterHeader header;
+  CompactProtocolReader cp(buffer->data(), buffer->size());
+  if (!cp.read(&header)) { return bitset; }
+  auto const header_size = static_cast<size_t>(cp.bytecount());
+  auto const num_bytes   = static_cast<size_t>(header.num_bytes);
+  if (num_bytes < kBloomFilterMinBytes || num_bytes > kBloomFilterMaxBytes ||
+      num_bytes % kBloomFilterBlockBytes != 0 || offset + header_size + num_bytes > source.size()) {
+    return bitset;
+  }
+  // The bitset follows the header; re-read it when the length of the filter was not known
+  auto const *data = buffer->data() + header_size;
+  if (header_size + num_bytes > buffer->size()) {
+    buffer = source.host_read(offset + header_size, num_bytes);
+    data   = buffer->data();
+  }
+  bitset.resize(num_bytes / sizeof(uint32_t));
+  memcpy(bitset.data(), data, num_bytes);
+  return bitset;
+}
+
+/**
+ * @brief Returns whether a column chunk's Bloom filter may contain the literal of an `EQUAL`
+ * predicate
+ *
+ * The literal is hashed in the physical representation of the column. Literals that have no exact
+ * physical representation, or that compare equal to more than one (signed zeros), are reported as
+ * possibly present.
+ */
+bool bloom_filter_may_contain(std::vector<uint32_t> const &bitset,
+                              SchemaElement const &schema,
+                              column_predicate const &predicate)
+{
+  using literal_kind = column_predicate::literal_kind;
+
+  if (bitset.empty() || schema.converted_type == parquet::DECIMAL) { return true; }
+  auto const num_blocks = static_cast<uint32_t>(bitset.size() / kBloomFilterBlockWords);
+  auto const probe      = [&](auto value) {
+    uint8_t buf[sizeof(value)];
+    memcpy(buf, &value, sizeof(value));
+    return bloom_filter_may_contain(bitset.data(), num_blocks, xxhash64(buf, sizeof(value)));
+  };
+
+  // Integral value of the literal, if it has one
+  int64_t int_value = predicate.int_value;
+  if (predicate.kind == literal_kind::FLOAT) {
+    auto const value = predicate.float_value;
+    if (!(value >= -0x1p63 && value < 0x1p63) || std::trunc(value) != value) { return true; }
+    int_value = static_cast<int64_t>(value);
+  }
+  bool const is_unsigned = schema.converted_type == parquet::UINT_8 ||
+                           schema.converted_type == parquet::UINT_16 ||
+                           schema.converted_type == parquet::UINT_32;
+  switch (schema.type) {
+    case parquet::INT32:
+      if (is_unsigned) {
+        if (int_value < 0 || int_value > std::numeric_limits<uint32_t>::max()) { return true; }
+        return probe(static_cast<uint32_t>(int_value));
+      }
+      if (int_value < std::numeric_limits<int32_t>::min() ||
+          int_value > std::numeric_limits<int32_t>::max()) {
+        return true;
+      }
+      return probe(static_cast<int32_t>(int_value));
+    case parquet::INT64: return probe(int_value);
+    case parquet::FLOAT: {
+      auto const value = (predicate.kind == literal_kind::FLOAT)
+                           ? predicate.float_value
+                           : static_cast<double>(predicate.int_value);
+      auto const f = static_cast<float>(value);
+      if (value == 0 || static_cast<double>(f) != value) { return true; }
+      return probe(f);
+    }
+    case parquet::DOUBLE: {
+      auto const value = (predicate.kind == literal_kind::FLOAT)
+                           ? predicate.float_value
+                           : static_cast<double>(predicate.int_value);
+      if (value == 0 || std::isnan(value)) { return true; }
+      return probe(value);
+    }
+    case parquet::BYTE_ARRAY:
+    case parquet::FIXED_LEN_BYTE_ARRAY:
+      return bloom_filter_may_contain(
+        bitset.data(),
+        num_blocks,
+        xxhash64(reinterpret_cast<const uint8_t *>(predicate.string_value.data()),
+                 static_cast<uint32_t>(predicate.string_value.size())));
+    default: return true;
+  }
+}
+
+/**
+ * @brief Data pages of a column chunk that overlap a range of rows
+ */
+struct page_selection {
+  size_t skip_offset = 0;  // Offset of the skipped pages relative to the start of the chunk
+  size_t skip_size   = 0;  // Total size of the skipped pages
+  size_t read_size   = 0;  // Number of bytes to read, excluding the skipped pages
+  size_t first_row   = 0;  // First row of the selected pages, relative to the row group
+  size_t num_rows    = 0;  // Number of rows in the selected pages
+};
+
+/**
+ * @brief Reads the OffsetIndex of a column chunk
+ *
+ * @return The page index, or an index without pages if the chunk has none
+ */
+OffsetIndex read_offset_index(datasource &source, ColumnChunk const &chunk)
+{
+  OffsetIndex index;
+  if (chunk.offset_index_length > 0) {
+    auto const buffer = source.host_read(chunk.offset_index_offset, chunk.offset_index_length);
+    CompactProtocolReader cp(buffer->data(), buffer->size());
+    if (!cp.read(&index)) { index.page_locations.clear(); }
+  }
+  return index;
+}
+
+/**
+ * @brief Selects the data pages of a column chunk that overlap rows `[min_row, max_row)` of its
+ * row group
+ *
+ * The pages that precede the first data page (the dictionary) are always read. The pages before
+ * the ones selected are skipped, and the pages after them are not read.
+ *
+ * @param index Page index of the column chunk
+ * @param chunk_offset File offset of the column chunk
+ * @param chunk_size Size of the column chunk in bytes
+ * @param num_rows Number of rows in the row group
+ * @param min_row First row to read
+ * @param max_row Row after the last row to read
+ * @param selection Selected pages
+ *
+ * @return Whether the index is valid for the chunk
+ */
+bool select_pages(OffsetIndex const &index,
+                  size_t chunk_offset,
+                  size_t chunk_size,
+                  size_t num_rows,
+                  size_t min_row,
+                  size_t max_row,
+                  page_selection &selection)
+{
+  auto const &locations = index.page_locations;
+  if (locations.empty() || locations[0].first_row_index != 0 ||
+      static_cast<size_t>(locations[0].offset) < chunk_offset) {
+    return false;
+  }
+
+  // Last page that starts at or before `min_row`, and one past the last page that starts before
+  // `max_row`
+  size_t first_page = 0;
+  size_t end_page   = 0;
+  for (size_t p = 0; p < locations.size(); ++p) {
+    auto const page_row = static_cast<size_t>(locations[p].first_row_index);
+    if (page_row <= min_row) { first_page = p; }
+    if (page_row < max_row) { end_page = p + 1; }
+  }
+  if (end_page <= first_page) { return false; }
+
+  auto const &last_page  = locations[end_page - 1];
+  auto const pages_begin = static_cast<size_t>(locations[0].offset);
+  auto const read_begin  = static_cast<size_t>(locations[first_page].offset);
+  auto const read_end    = static_cast<size_t>(last_page.offset) + last_page.compressed_page_size;
+  if (read_begin < pages_begin || read_end <= read_begin || read_end > chunk_offset + chunk_size) {
+    return false;
+  }
+  auto const end_row =
+    (end_page < locations.size()) ? locations[end_page].first_row_index : num_rows;
+
+  selection.skip_offset = pages_begin - chunk_offset;
+  selection.skip_size   = read_begin - pages_begin;
+  selection.read_size   = selection.skip_offset + (read_end - read_begin);
+  selection.first_row   = locations[first_page].first_row_index;
+  selection.num_rows    = end_row - selection.first_row;
+  return true;
+}
+
+/**
+ * @brief Returns whether all data pages of a column chunk use its dictionary
+ *
+ * @param chunk Column chunk descriptor
+ * @param pages Page information of the column chunk, dictionary page first
+ */
+bool is_dictionary_encoded(gpu::ColumnChunkDesc const &chunk, gpu::PageInfo const *pages)
+{
+  if ((chunk.data_type & 7) != BYTE_ARRAY || chunk.num_dict_pages == 0) { return false; }
+  for (int p = chunk.num_dict_pages; p < chunk.max_num_pages; ++p) {
+    if (pages[p].encoding != Encoding::PLAIN_DICTIONARY &&
+        pages[p].encoding != Encoding::RLE_DICTIONARY) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Definition levels that delimit the rows of a list column
+ */
+struct list_levels {
+  bool is_list    = false;
+  int list_def    = 0;  // Minimum definition level of a non-null list
+  int element_def = 0;  // Minimum definition level of a list element (null or not)
+};
+
+/**
+ * @brief Assembles a list column from its decoded leaf values and their levels
+ *
+ * Each leaf value has a level; null and empty lists take up a single value without an element.
+ *
+ * @param leaf Decoded leaf values
+ * @param rep_levels Repetition level of each leaf value
+ * @param def_levels Definition level of each leaf value
+ * @param levels Definition levels that delimit the rows of the column
+ * @param num_rows Number of rows in the column
+ * @param mr Device memory resource to use for device memory allocation
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return The list column
+ */
+std::unique_ptr<column> make_list_column(std::unique_ptr<column> &&leaf,
+                                         rmm::device_vector<uint8_t> const &rep_levels,
+                                         rmm::device_vector<uint8_t> const &def_levels,
+                                         list_levels const &levels,
+                                         size_type num_rows,
+                                         rmm::mr::device_memory_resource *mr,
+                                         cudaStream_t stream)
+{
+  auto exec                  = rmm::exec_policy(stream)->on(stream);
+  size_type const num_values = leaf->size();
+  auto const element_def     = levels.element_def;
+  auto const list_def        = levels.list_def;
+
+  // Position of each value among the list elements
+  rmm::device_vector<size_type> element_pos(num_values + 1, 0);
+  thrust::transform(exec,
+                    def_levels.begin(),
+                    def_levels.end(),
+                    element_pos.begin() + 1,
+                    [element_def] __device__(uint8_t def) { return (def >= element_def) ? 1 : 0; });
+  rmm::device_vector<bool> is_element(num_values);
+  thrust::transform(exec,
+                    element_pos.begin() + 1,
+                    element_pos.end(),
+                    is_element.begin(),
+                    [] __device__(size_type count) { return count != 0; });
+  thrust::inclusive_scan(exec, element_pos.begin() + 1, element_pos.end(), element_pos.begin() + 1);
+
+  column_view const element_mask(data_type{type_id::BOOL8}, num_values, is_element.data().get());
+  auto child = std::move(
+    cudf::detail::apply_boolean_mask(table_view{{leaf->view()}}, element_mask, mr, stream)
+      ->release()[0]);
+
+  // Rows start at the values with a repetition level of zero
+  auto offsets = make_numeric_column(
+    data_type{type_id::INT32}, num_rows + 1, mask_state::UNALLOCATED, stream, mr);
+  auto const d_offsets  = offsets->mutable_view().data<size_type>();
+  auto const is_row     = [] __device__(uint8_t rep) { return rep == 0; };
+  auto const offset_end = thrust::copy_if(
+    exec, element_pos.begin(), element_pos.end() - 1, rep_levels.begin(), d_offsets, is_row);
+  CUDF_EXPECTS(offset_end - d_offsets == num_rows, "Mismatched number of rows in list column");
+  CUDA_TRY(cudaMemcpyAsync(d_offsets + num_rows,
+                           element_pos.data().get() + num_values,
+                           sizeof(size_type),
+                           cudaMemcpyDeviceToDevice,
+                           stream));
+
+  rmm::device_buffer null_mask{};
+  size_type null_count = 0;
+  if (list_def > 0) {
+    rmm::device_vector<uint8_t> row_def(num_rows);
+    thrust::copy_if(
+      exec, def_levels.begin(), def_levels.end(), rep_levels.begin(), row_def.begin(), is_row);
+    std::tie(null_mask, null_count) = cudf::detail::valid_if(
+      row_def.begin(),
+      row_def.end(),
+      [list_def] __device__(uint8_t def) { return def >= list_def; },
+      stream,
+      mr);
+  }
+
+  return make_lists_column(
+    num_rows, std::move(offsets), std::move(child), null_count, std::move(null_mask), stream, mr);
+}
+
 }  // namespace
 
 std::string name_from_path(const std::vector<std::string> &path_in_schema)
@@ -156,6 +574,16 @@ std::string name_from_path(const std::vector<std::string> &path_in_schema)
   return s;
 }
 
+/**
+ * @brief Returns the name of the column of a chunk; the values of a list are named after the list
+ */
+std::string column_name(ColumnChunk const &chunk, SchemaElement const &schema)
+{
+  auto const &path = chunk.meta_data.path_in_schema;
+  if (schema.max_repetition_level > 0 && !path.empty()) { return path[0]; }
+  return name_from_path(path);
+}
+
 /**
  * @brief Class for parsing dataset metadata
  */
@@ -192,14 +620,29 @@ class aggregate_metadata {
 
   /**
    * @brief Create a metadata object from each element in the source vector
+   *
+   * Footers are parsed on concurrent host threads, since reading many small files is bound by
+   * the latency of each footer read rather than by bandwidth.
    */
   auto metadatas_from_sources(std::vector<std::unique_ptr<datasource>> const &sources)
   {
+    constexpr size_t max_footer_threads = 16;
+
     std::vector<metadata> metadatas;
-    std::transform(
-      sources.cbegin(), sources.cend(), std::back_inserter(metadatas), [](auto const &source) {
-        return metadata(source.get());
-      });
+    metadatas.reserve(sources.size());
+    if (sources.size() == 1) {
+      metadatas.emplace_back(sources[0].get());
+      return metadatas;
+    }
+    for (size_t begin = 0; begin < sources.size(); begin += max_footer_threads) {
+      auto const end = std::min(begin + max_footer_threads, sources.size());
+      std::vector<std::future<metadata>> footers;
+      for (size_t i = begin; i < end; ++i) {
+        footers.emplace_back(std::async(std::launch::async,
+                                        [source = sources[i].get()] { return metadata(source); }));
+      }
+      for (auto &footer : footers) { metadatas.emplace_back(footer.get()); }
+    }
     return metadatas;
   }
 
@@ -243,7 +686,7 @@ class aggregate_metadata {
       if (pfm.row_groups.size() != 0) {
         std::vector<std::string> column_names;
         for (const auto &chunk : pfm.row_groups[0].columns) {
-          column_names.emplace_back(name_from_path(chunk.meta_data.path_in_schema));
+          column_names.emplace_back(column_name(chunk, pfm.schema[chunk.schema_idx]));
         }
         return column_names;
       }
@@ -286,12 +729,42 @@ class aggregate_metadata {
 
   auto get_num_rows() const { return num_rows; }
 
+  auto const &get_column_names() const { return column_names; }
+
   auto get_num_row_groups() const { return num_row_groups; }
 
   auto const &get_schema(int idx) const { return per_file_metadata[0].schema[idx]; }
 
   auto const &get_key_value_metadata() const { return agg_keyval_map; }
 
+  /**
+   * @brief Returns the definition levels that delimit the lists of a column
+   *
+   * Lists of non-nested values are supported, in both the standard three-level and the legacy
+   * two-level list encodings.
+   *
+   * @param schema_idx Index of the schema element of the column values
+   */
+  list_levels get_list_levels(int schema_idx) const
+  {
+    auto const &schema = per_file_metadata[0].schema;
+    auto const &leaf   = schema[schema_idx];
+    list_levels levels;
+    if (leaf.max_repetition_level == 0) { return levels; }
+
+    auto const repeated_idx = (leaf.repetition_type == REPEATED) ? schema_idx : leaf.parent_idx;
+    auto const &repeated    = schema[repeated_idx];
+    auto const &list        = schema[repeated.parent_idx];
+    CUDF_EXPECTS(leaf.max_repetition_level == 1 && repeated.repetition_type == REPEATED &&
+                   repeated.parent_idx != 0 && list.parent_idx == 0 &&
+                   list.converted_type == parquet::LIST,
+                 "Unsupported nested column");
+    levels.is_list     = true;
+    levels.list_def    = list.max_definition_level;
+    levels.element_def = repeated.max_definition_level;
+    return levels;
+  }
+
   /**
    * @brief Extracts the pandas "index_columns" section
    *
@@ -363,6 +836,9 @@ class aggregate_metadata {
   /**
    * @brief Filters and reduces down to a selection of row groups
    *
+   * When a list of row groups is specified, the row range applies to the rows of the listed row
+   * groups in list order rather than to the rows of the dataset.
+   *
    * @param row_groups Lists of row group to reads, one per source
    * @param row_start Starting row of the selection
    * @param row_count Total number of rows selected
@@ -373,43 +849,116 @@ class aggregate_metadata {
                          size_type &row_start,
                          size_type &row_count) const
   {
+    // Candidate row groups, either listed or all of them
+    std::vector<row_group_info> candidates;
+    int64_t total_rows = 0;
     if (!row_groups.empty()) {
-      std::vector<row_group_info> selection;
       CUDF_EXPECTS(row_groups.size() == per_file_metadata.size(),
                    "Must specify row groups for each source");
 
-      row_count = 0;
       for (size_t src_idx = 0; src_idx < row_groups.size(); ++src_idx) {
         for (auto const &rowgroup_idx : row_groups[src_idx]) {
           CUDF_EXPECTS(
             rowgroup_idx >= 0 &&
               rowgroup_idx < static_cast<size_type>(per_file_metadata[src_idx].row_groups.size()),
             "Invalid rowgroup index");
-          selection.emplace_back(rowgroup_idx, row_count, src_idx);
-          row_count += get_row_group(rowgroup_idx, src_idx).num_rows;
+          candidates.emplace_back(rowgroup_idx, total_rows, src_idx);
+          total_rows += get_row_group(rowgroup_idx, src_idx).num_rows;
+        }
+      }
+    } else {
+      for (size_t src_idx = 0; src_idx < per_file_metadata.size(); ++src_idx) {
+        for (size_t rg_idx = 0; rg_idx < per_file_metadata[src_idx].row_groups.size(); ++rg_idx) {
+          candidates.emplace_back(rg_idx, total_rows, src_idx);
+          total_rows += get_row_group(rg_idx, src_idx).num_rows;
         }
       }
-      return selection;
     }
 
     row_start = std::max(row_start, 0);
     if (row_count < 0) {
       row_count = static_cast<size_type>(
-        std::min<int64_t>(get_num_rows(), std::numeric_limits<size_type>::max()));
+        std::min<int64_t>(total_rows, std::numeric_limits<size_type>::max()));
     }
     CUDF_EXPECTS(row_count >= 0, "Invalid row count");
-    CUDF_EXPECTS(row_start <= get_num_rows(), "Invalid row start");
+    CUDF_EXPECTS(row_start <= total_rows, "Invalid row start");
+    if (!row_groups.empty()) {
+      row_count = static_cast<size_type>(std::min<int64_t>(row_count, total_rows - row_start));
+    }
 
     std::vector<row_group_info> selection;
-    size_type count = 0;
+    for (auto const &rg : candidates) {
+      auto const count = rg.start_row + get_row_group(rg.index, rg.source_index).num_rows;
+      if (count > static_cast<size_t>(row_start) || count == 0) { selection.push_back(rg); }
+      if (count >= static_cast<size_t>(row_start) + row_count) { break; }
+    }
+    return selection;
+  }
+
+  /**
+   * @brief Decodes the min/max statistics of a column chunk of a row group
+   *
+   * @param row_group The row group
+   * @param col_idx Index of the column chunk in the row group
+   */
+  minmax_statistics chunk_statistics(row_group_info const &row_group, int col_idx) const
+  {
+    auto const &rg    = get_row_group(row_group.index, row_group.source_index);
+    auto const &chunk = rg.columns[col_idx];
+    return decode_statistics(chunk, get_schema(chunk.schema_idx), rg.num_rows);
+  }
+
+  /**
+   * @brief Removes the row groups whose statistics cannot satisfy a filter
+   *
+   * `EQUAL` predicates that the statistics cannot rule out are probed against the Bloom filter of
+   * the column chunk, which is only read from the source when needed.
+   *
+   * @param sources Data sources of the row groups
+   * @param row_groups Lists of row groups to filter, one per source; empty for all row groups
+   * @param filter Filter with columns resolved against `column_names`
+   *
+   * @return Lists of row groups that may contain matching rows, one per source
+   */
+  std::vector<std::vector<size_type>> filter_row_groups(
+    std::vector<std::unique_ptr<datasource>> const &sources,
+    std::vector<std::vector<size_type>> const &row_groups,
+    resolved_predicate_filter const &filter) const
+  {
+    std::vector<std::vector<size_type>> selection(per_file_metadata.size());
     for (size_t src_idx = 0; src_idx < per_file_metadata.size(); ++src_idx) {
-      for (size_t rg_idx = 0; rg_idx < per_file_metadata[src_idx].row_groups.size(); ++rg_idx) {
-        auto const chunk_start_row = count;
-        count += get_row_group(rg_idx, src_idx).num_rows;
-        if (count > row_start || count == 0) {
-          selection.emplace_back(rg_idx, chunk_start_row, src_idx);
+      auto test_row_group = [&](size_type rg_idx) {
+        auto const &row_group = get_row_group(rg_idx, src_idx);
+        auto const get_stats  = [&](int col_idx) {
+          auto const &chunk = row_group.columns[col_idx];
+          return decode_statistics(chunk, get_schema(chunk.schema_idx), row_group.num_rows);
+        };
+        // Filters are read once per chunk, as a set of probe keys tests the same column many times
+        std::map<int, std::vector<uint32_t>> bloom_filters;
+        auto const may_contain = [&](int col_idx, column_predicate const &predicate) {
+          auto const &chunk = row_group.columns[col_idx];
+          if (chunk.meta_data.bloom_filter_offset == 0) { return true; }
+          auto it = bloom_filters.find(col_idx);
+          if (it == bloom_filters.end()) {
+            it = bloom_filters.emplace(col_idx, read_bloom_filter(*sources[src_idx], chunk)).first;
+          }
+          return bloom_filter_may_contain(it->second, get_schema(chunk.schema_idx), predicate);
+        };
+        if (may_satisfy(filter, get_stats, may_contain)) { selection[src_idx].push_back(rg_idx); }
+      };
+      if (!row_groups.empty()) {
+        CUDF_EXPECTS(row_groups.size() == per_file_metadata.size(),
+                     "Must specify row groups for each source");
+        for (auto const &rg_idx : row_groups[src_idx]) {
+          CUDF_EXPECTS(
+            rg_idx >= 0 &&
+              rg_idx < static_cast<size_type>(per_file_metadata[src_idx].row_groups.size()),
+            "Invalid rowgroup index");
+          test_row_group(rg_idx);
         }
-        if (count >= row_start + row_count) { break; }
+      } else {
+        auto const num_row_groups = per_file_metadata[src_idx].row_groups.size();
+        for (size_t rg_idx = 0; rg_idx < num_row_groups; ++rg_idx) { test_row_group(rg_idx); }
       }
     }
     return selection;
@@ -418,6 +967,9 @@ class aggregate_metadata {
   /**
    * @brief Filters and reduces down to a selection of columns
    *
+   * Columns nested in groups are named by their dotted path (`a.b.c`); the path of a group
+   * selects all the leaf columns below it, so that only the chunks of those leaves are read.
+   *
    * @param use_names List of column names to select
    * @param include_index Whether to always include the PANDAS index column(s)
    *
@@ -433,10 +985,16 @@ class aggregate_metadata {
       // Load subset of columns; include PANDAS index unless excluded
       if (include_index) { add_pandas_index_names(use_names); }
       for (const auto &use_name : use_names) {
+        auto const it = std::find(column_names.cbegin(), column_names.cend(), use_name);
+        if (it != column_names.cend()) {
+          selection.emplace_back(it - column_names.cbegin(), *it);
+          continue;
+        }
+        // The dotted path of a group selects all the leaf columns below it
+        auto const prefix = use_name + ".";
         for (size_t i = 0; i < column_names.size(); ++i) {
-          if (column_names[i] == use_name) {
+          if (column_names[i].compare(0, prefix.size(), prefix) == 0) {
             selection.emplace_back(i, column_names[i]);
-            break;
           }
         }
       }
@@ -452,7 +1010,9 @@ void reader::impl::read_column_chunks(
   size_t begin_chunk,
   size_t end_chunk,
   const std::vector<size_t> &column_chunk_offsets,
+  std::vector<std::pair<size_t, size_t>> const &column_chunk_skips,
   std::vector<size_type> const &chunk_source_map,
+  detail::staged_device_copier &copier,
   cudaStream_t stream)
 {
   // Transfer chunk data, coalescing adjacent chunks
@@ -461,11 +1021,29 @@ void reader::impl::read_column_chunks(
     size_t io_size           = chunks[chunk].compressed_size;
     size_t next_chunk        = chunk + 1;
     const bool is_compressed = (chunks[chunk].codec != parquet::Compression::UNCOMPRESSED);
+
+    // Chunks with skipped pages are read in two pieces, around the skipped pages
+    const auto &skip = column_chunk_skips[chunk];
+    if (skip.second != 0) {
+      auto &source     = *_sources[chunk_source_map[chunk]];
+      page_data[chunk] = rmm::device_buffer(io_size, stream);
+      auto d_compdata  = reinterpret_cast<uint8_t *>(page_data[chunk].data());
+      copier.copy(source, io_offset, skip.first, d_compdata);
+      copier.copy(source,
+                  io_offset + skip.first + skip.second,
+                  io_size - skip.first,
+                  d_compdata + skip.first);
+      chunks[chunk].compressed_data = d_compdata;
+      chunk                         = next_chunk;
+      continue;
+    }
+
     while (next_chunk < end_chunk) {
       const size_t next_offset = column_chunk_offsets[next_chunk];
       const bool is_next_compressed =
         (chunks[next_chunk].codec != parquet::Compression::UNCOMPRESSED);
-      if (next_offset != io_offset + io_size || is_next_compressed != is_compressed) {
+      if (next_offset != io_offset + io_size || is_next_compressed != is_compressed ||
+          column_chunk_skips[next_chunk].second != 0) {
         // Can't merge if not contiguous or mixing compressed and uncompressed
         // Not coalescing uncompressed with compressed chunks is so that compressed buffers can be
         // freed earlier (immediately after decompression stage) to limit peak memory requirements
@@ -475,8 +1053,8 @@ void reader::impl::read_column_chunks(
       next_chunk++;
     }
     if (io_size != 0) {
-      auto buffer         = _sources[chunk_source_map[chunk]]->host_read(io_offset, io_size);
-      page_data[chunk]    = rmm::device_buffer(buffer->data(), buffer->size(), stream);
+      page_data[chunk] = rmm::device_buffer(io_size, stream);
+      copier.copy(*_sources[chunk_source_map[chunk]], io_offset, io_size, page_data[chunk].data());
       uint8_t *d_compdata = reinterpret_cast<uint8_t *>(page_data[chunk].data());
       do {
         chunks[chunk].compressed_data = d_compdata;
@@ -546,9 +1124,11 @@ rmm::device_buffer reader::impl::decompress_page_data(
   // Count the exact number of compressed pages
   size_t num_comp_pages    = 0;
   size_t total_decomp_size = 0;
-  std::array<std::pair<parquet::Compression, size_t>, 3> codecs{std::make_pair(parquet::GZIP, 0),
+  std::array<std::pair<parquet::Compression, size_t>, 5> codecs{std::make_pair(parquet::GZIP, 0),
                                                                 std::make_pair(parquet::SNAPPY, 0),
-                                                                std::make_pair(parquet::BROTLI, 0)};
+                                                                std::make_pair(parquet::BROTLI, 0),
+                                                                std::make_pair(parquet::ZSTD, 0),
+                                                                std::make_pair(parquet::LZ4, 0)};
 
   for (auto &codec : codecs) {
     for_each_codec_page(codec.first, [&](size_t page) {
@@ -620,6 +1200,20 @@ rmm::device_buffer reader::impl::decompress_page_data(
                                 argc - start_pos,
                                 stream));
           break;
+        case parquet::ZSTD:
+          CUDA_TRY(gpu_unzstd(inflate_in.device_ptr(start_pos),
+                              inflate_out.device_ptr(start_pos),
+                              argc - start_pos,
+                              stream));
+          break;
+        case parquet::LZ4:
+          // Hadoop-framed as written by parquet-mr, with a fallback to raw blocks for older writers
+          CUDA_TRY(gpu_unlz4(inflate_in.device_ptr(start_pos),
+                             inflate_out.device_ptr(start_pos),
+                             argc - start_pos,
+                             1,
+                             stream));
+          break;
         default: CUDF_EXPECTS(false, "Unexpected decompression dispatch"); break;
       }
       CUDA_TRY(cudaMemcpyAsync(inflate_out.host_ptr(start_pos),
@@ -639,12 +1233,54 @@ rmm::device_buffer reader::impl::decompress_page_data(
   return decomp_pages;
 }
 
+rmm::device_buffer reader::impl::expand_delta_byte_array_pages(
+  hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
+  hostdevice_vector<gpu::PageInfo> &pages,
+  cudaStream_t stream)
+{
+  auto const has_delta_pages =
+    std::any_of(pages.host_ptr(), pages.host_ptr() + pages.size(), [](auto const &page) {
+      return page.encoding == Encoding::DELTA_BYTE_ARRAY;
+    });
+  if (!has_delta_pages) { return rmm::device_buffer{}; }
+
+  rmm::device_vector<size_t> sizes(pages.size());
+  rmm::device_vector<size_t> offsets(pages.size());
+  CUDA_TRY(gpu::SizeDeltaByteArrayPages(pages.device_ptr(),
+                                        pages.size(),
+                                        chunks.device_ptr(),
+                                        chunks.size(),
+                                        sizes.data().get(),
+                                        stream));
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream)->on(stream), sizes.begin(), sizes.end(), offsets.begin());
+  auto const total_size =
+    thrust::reduce(rmm::exec_policy(stream)->on(stream), sizes.begin(), sizes.end(), size_t{0});
+
+  // Pages that fail to rebuild keep their encoding, which the decoder reports as an error
+  rmm::device_buffer expanded_pages(total_size, stream);
+  CUDA_TRY(gpu::ExpandDeltaByteArrayPages(pages.device_ptr(),
+                                          pages.size(),
+                                          chunks.device_ptr(),
+                                          chunks.size(),
+                                          static_cast<uint8_t *>(expanded_pages.data()),
+                                          sizes.data().get(),
+                                          offsets.data().get(),
+                                          stream));
+  CUDA_TRY(cudaMemcpyAsync(
+    pages.host_ptr(), pages.device_ptr(), pages.memory_size(), cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  return expanded_pages;
+}
+
 void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
                                     hostdevice_vector<gpu::PageInfo> &pages,
                                     size_t min_row,
                                     size_t total_rows,
                                     const std::vector<int> &chunk_col_map,
                                     std::vector<column_buffer> &out_buffers,
+                                    rmm::device_vector<gpu::nvstrdesc_s> &str_dict_index,
                                     cudaStream_t stream)
 {
   auto is_dict_chunk = [](const gpu::ColumnChunkDesc &chunk) {
@@ -661,7 +1297,6 @@ void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chu
 
   // Build index for string dictionaries since they can't be indexed
   // directly due to variable-sized elements
-  rmm::device_vector<gpu::nvstrdesc_s> str_dict_index;
   if (total_str_dict_indexes > 0) { str_dict_index.resize(total_str_dict_indexes); }
 
   // Update chunks with pointers to column data
@@ -687,6 +1322,14 @@ void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chu
                                total_rows,
                                min_row,
                                stream));
+  auto const has_levels =
+    std::any_of(chunks.host_ptr(), chunks.host_ptr() + chunks.size(), [](auto const &chunk) {
+      return chunk.rep_levels != nullptr;
+    });
+  if (has_levels) {
+    CUDA_TRY(gpu::DecodePageLevels(
+      pages.device_ptr(), pages.size(), chunks.device_ptr(), chunks.size(), min_row, stream));
+  }
   CUDA_TRY(cudaMemcpyAsync(
     pages.host_ptr(), pages.device_ptr(), pages.memory_size(), cudaMemcpyDeviceToHost, stream));
   CUDA_TRY(cudaStreamSynchronize(stream));
@@ -701,6 +1344,73 @@ void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chu
   }
 }
 
+std::unique_ptr<column> reader::impl::make_dictionary_column(
+  hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
+  hostdevice_vector<gpu::PageInfo> &pages,
+  const std::vector<int> &chunk_col_map,
+  size_t col_idx,
+  size_type num_rows,
+  bool is_indices,
+  column_buffer &buffer,
+  cudaStream_t stream)
+{
+  if (!is_indices) {
+    // Some chunks are not fully dictionary encoded, so encode the decoded strings instead
+    auto const strings = make_column(data_type{type_id::STRING}, num_rows, buffer, stream);
+    return cudf::dictionary::detail::encode(
+      strings->view(), data_type{type_id::INT32}, _mr, stream);
+  }
+
+  // Concatenate the dictionaries of the column's chunks; `dict_index_base` is the position of
+  // each chunk's first entry
+  // NOTE: Assumes first page in the chunk is always the dictionary page
+  size_t num_keys = 0;
+  for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
+    if (static_cast<size_t>(chunk_col_map[c]) == col_idx) {
+      num_keys += pages[page_count].num_values;
+    }
+    page_count += chunks[c].max_num_pages;
+  }
+  rmm::device_vector<column_buffer::str_pair> chunk_keys(num_keys);
+  for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
+    if (static_cast<size_t>(chunk_col_map[c]) == col_idx) {
+      auto const dict = chunks[c].str_dict_index;
+      thrust::transform(rmm::exec_policy(stream)->on(stream),
+                        dict,
+                        dict + pages[page_count].num_values,
+                        chunk_keys.begin() + chunks[c].dict_index_base,
+                        [] __device__(gpu::nvstrdesc_s const &entry) {
+                          return column_buffer::str_pair{entry.ptr,
+                                                         static_cast<size_type>(entry.count)};
+                        });
+    }
+    page_count += chunks[c].max_num_pages;
+  }
+
+  // Chunk dictionaries may overlap, so map every entry onto a single set of sorted, unique keys
+  auto key_map = cudf::dictionary::detail::encode(
+    make_strings_column(chunk_keys, stream)->view(), data_type{type_id::INT32}, _mr, stream);
+  auto key_map_contents = key_map->release();
+  auto &key_indices     = key_map_contents.children[0];
+  auto &keys            = key_map_contents.children[1];
+
+  // Null rows have an index of zero, which is always valid as the keys are not empty
+  column_view const chunk_indices(data_type{type_id::INT32}, num_rows, buffer._data.data());
+  auto indices = cudf::detail::gather(table_view{{key_indices->view()}},
+                                      chunk_indices,
+                                      cudf::detail::out_of_bounds_policy::IGNORE,
+                                      cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                      _mr,
+                                      stream)
+                   ->release();
+  indices[0]->set_null_mask(rmm::device_buffer{}, 0);
+
+  return cudf::make_dictionary_column(std::move(keys),
+                                      std::move(indices[0]),
+                                      std::move(buffer._null_mask),
+                                      buffer._null_count);
+}
+
 reader::impl::impl(std::vector<std::unique_ptr<datasource>> &&sources,
                    reader_options const &options,
                    rmm::mr::device_memory_resource *mr)
@@ -717,39 +1427,193 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>> &&sources,
 
   // Strings may be returned as either string or categorical columns
   _strings_to_categorical = options.strings_to_categorical;
+  _strings_to_dictionary  = options.strings_to_dictionary;
+  CUDF_EXPECTS(!(_strings_to_categorical && _strings_to_dictionary),
+               "Strings cannot be returned as both categorical and dictionary columns");
+
+  // Resolve filter columns once; the schemas of all sources are known to match
+  _filter = resolve_predicate_filter(options.filters, _metadata->get_column_names());
+  _filter_rows = options.filter_rows;
 }
 
-table_with_metadata reader::impl::read(size_type skip_rows,
-                                       size_type num_rows,
-                                       std::vector<std::vector<size_type>> const &row_group_list,
-                                       cudaStream_t stream)
+std::vector<std::pair<size_type, size_type>> reader::impl::split_rows(size_t chunk_read_limit,
+                                                                     size_type skip_rows,
+                                                                     size_type num_rows)
 {
-  // Select only row groups required
+  std::vector<std::vector<size_type>> filtered_row_groups;
+  if (!_filter.empty()) {
+    filtered_row_groups = _metadata->filter_row_groups(_sources, {}, _filter);
+  }
+  const auto selected_row_groups =
+    _metadata->select_row_groups(filtered_row_groups, skip_rows, num_rows);
+
+  std::vector<std::pair<size_type, size_type>> ranges;
+  size_type range_start = skip_rows;
+  size_type range_rows  = 0;
+  size_t range_size     = 0;
+  auto flush            = [&]() {
+    if (range_rows > 0) { ranges.emplace_back(range_start, range_rows); }
+    range_start += range_rows;
+    range_rows = 0;
+    range_size = 0;
+  };
+
+  auto const end_row = static_cast<int64_t>(skip_rows) + num_rows;
+  for (const auto &rg : selected_row_groups) {
+    const auto &row_group = _metadata->get_row_group(rg.index, rg.source_index);
+    // Only the part of the row group that overlaps the requested rows is read
+    auto const first_row = std::max<int64_t>(rg.start_row, skip_rows);
+    auto const last_row  = std::min<int64_t>(rg.start_row + row_group.num_rows, end_row);
+    if (last_row <= first_row) { continue; }
+    auto const rows = static_cast<size_type>(last_row - first_row);
+
+    auto const rg_size =
+      decoded_size(row_group) * rows / std::max<int64_t>(row_group.num_rows, 1);
+
+    if (chunk_read_limit == 0 || range_size + rg_size <= chunk_read_limit) {
+      range_rows += rows;
+      range_size += rg_size;
+    } else if (rg_size <= chunk_read_limit) {
+      flush();
+      range_rows = rows;
+      range_size = rg_size;
+    } else {
+      // Row group alone exceeds the limit; split it into evenly-sized row ranges
+      flush();
+      auto const num_splits = (rg_size + chunk_read_limit - 1) / chunk_read_limit;
+      auto const rows_per_split = std::max<size_type>(
+        1, static_cast<size_type>((rows + num_splits - 1) / num_splits));
+      for (size_type row = 0; row < rows; row += rows_per_split) {
+        range_rows = std::min(rows_per_split, rows - row);
+        flush();
+      }
+    }
+  }
+  flush();
+
+  return ranges;
+}
+
+std::vector<block_info> reader::impl::get_row_group_info()
+{
+  std::vector<std::vector<size_type>> filtered_row_groups;
+  if (!_filter.empty()) {
+    filtered_row_groups = _metadata->filter_row_groups(_sources, {}, _filter);
+  }
+  size_type skip_rows = 0;
+  size_type num_rows  = -1;
   const auto selected_row_groups =
-    _metadata->select_row_groups(row_group_list, skip_rows, num_rows);
+    _metadata->select_row_groups(filtered_row_groups, skip_rows, num_rows);
+
+  std::vector<block_info> info;
+  for (const auto &rg : selected_row_groups) {
+    const auto &row_group = _metadata->get_row_group(rg.index, rg.source_index);
+    block_info block;
+    block.source_index = rg.source_index;
+    block.index        = rg.index;
+    block.num_rows     = static_cast<size_type>(row_group.num_rows);
+    for (const auto &col : _selected_columns) {
+      block.compressed_size += row_group.columns[col.first].meta_data.total_compressed_size;
+    }
+    block.uncompressed_size = decoded_size(row_group);
+    info.emplace_back(block);
+  }
+
+  return info;
+}
+
+size_t reader::impl::decoded_size(RowGroup const &row_group) const
+{
+  size_t size = 0;
+  for (const auto &col : _selected_columns) {
+    auto const &chunk = row_group.columns[col.first];
+    size += chunk.meta_data.total_uncompressed_size;
+    auto const physical = _metadata->get_schema(chunk.schema_idx).type;
+    if (physical == parquet::BYTE_ARRAY || physical == parquet::FIXED_LEN_BYTE_ARRAY) {
+      size += sizeof(size_type) * row_group.num_rows;
+    }
+  }
+  return size;
+}
+
+table_with_metadata reader::impl::read_columns(
+  std::vector<std::pair<int, std::string>> const &columns,
+  size_type skip_rows,
+  size_type num_rows,
+  std::vector<std::vector<size_type>> const &row_group_list,
+  cudaStream_t stream,
+  std::vector<mutable_column_view> const *outputs,
+  read_into_result *into)
+{
+  // Skip row groups that cannot contain any rows that satisfy the filter; any row range then
+  // applies to the rows of the remaining row groups
+  std::vector<std::vector<size_type>> filtered_row_groups;
+  if (!_filter.empty()) {
+    filtered_row_groups = _metadata->filter_row_groups(_sources, row_group_list, _filter);
+  }
+
+  // Select only row groups required
+  const auto selected_row_groups = _metadata->select_row_groups(
+    _filter.empty() ? row_group_list : filtered_row_groups, skip_rows, num_rows);
+
+  // Measurements reported to the profiling callbacks
+  int64_t rows_selected = 0;
+  for (auto const &rg : selected_row_groups) {
+    rows_selected += _metadata->get_row_group(rg.index, rg.source_index).num_rows;
+  }
+  size_t bytes_read         = 0;
+  size_t bytes_decompressed = 0;
 
-  // Get a list of column data types
+  // Get a list of column data types; the types of list columns are the types of their elements
   std::vector<data_type> column_types;
+  std::vector<list_levels> column_lists;
   if (_metadata->get_num_row_groups() != 0) {
-    for (const auto &col : _selected_columns) {
-      auto const &col_schema =
-        _metadata->get_schema(_metadata->get_row_group(0, 0).columns[col.first].schema_idx);
-      auto const col_type = to_type_id(col_schema.type,
+    for (const auto &col : columns) {
+      auto const schema_idx  = _metadata->get_row_group(0, 0).columns[col.first].schema_idx;
+      auto const &col_schema = _metadata->get_schema(schema_idx);
+      auto const col_type    = to_type_id(col_schema.type,
                                        col_schema.converted_type,
                                        _strings_to_categorical,
                                        _timestamp_type.id(),
                                        col_schema.decimal_scale);
       CUDF_EXPECTS(col_type != type_id::EMPTY, "Unknown type");
-      column_types.emplace_back(col_type);
+      column_lists.emplace_back(_metadata->get_list_levels(schema_idx));
+      column_types.emplace_back(
+        (_strings_to_dictionary && col_type == type_id::STRING && !column_lists.back().is_list)
+          ? type_id::DICTIONARY32
+          : col_type);
+    }
+  }
+  auto const has_lists = std::any_of(
+    column_lists.cbegin(), column_lists.cend(), [](auto const &levels) { return levels.is_list; });
+
+  // Only fixed-width columns can be decoded into caller-owned memory, which must hold their rows
+  if (outputs != nullptr) {
+    CUDF_EXPECTS(outputs->size() == columns.size(),
+                 "Mismatch between the number of output and selected columns");
+    for (size_t i = 0; i < column_types.size(); ++i) {
+      auto const &output = (*outputs)[i];
+      CUDF_EXPECTS(output.type() == column_types[i], "Output column type mismatch");
+      CUDF_EXPECTS(is_fixed_width(output.type()) && !column_lists[i].is_list,
+                   "Only fixed-width columns can be read into caller-owned memory");
+      CUDF_EXPECTS(output.offset() == 0, "Output columns must not have an offset");
+      CUDF_EXPECTS(output.size() >= num_rows, "Output column too small for the rows read");
     }
+    into->num_rows = (selected_row_groups.empty() || column_types.empty()) ? 0 : num_rows;
+    into->null_counts.assign(outputs->size(), 0);
   }
 
   std::vector<std::unique_ptr<column>> out_columns;
   out_columns.reserve(column_types.size());
 
   if (selected_row_groups.size() != 0 && column_types.size() != 0) {
+    // Dictionary columns are decoded as strings unless their chunks can output indices
+    auto const decode_type_id = [](data_type type) {
+      return (type.id() == type_id::DICTIONARY32) ? type_id::STRING : type.id();
+    };
+
     // Descriptors for all the chunks that make up the selected columns
-    const auto num_columns = _selected_columns.size();
+    const auto num_columns = columns.size();
     const auto num_chunks  = selected_row_groups.size() * num_columns;
     hostdevice_vector<gpu::ColumnChunkDesc> chunks(0, num_chunks, stream);
 
@@ -763,6 +1627,14 @@ table_with_metadata reader::impl::read(size_type skip_rows,
 
     // Keep track of column chunk file offsets
     std::vector<size_t> column_chunk_offsets(num_chunks);
+    // Offset relative to the chunk and size of the pages that are not read, per column chunk
+    std::vector<std::pair<size_t, size_t>> column_chunk_skips(num_chunks);
+
+    // Reads of later row groups overlap the device transfers of earlier ones
+    detail::staged_device_copier copier(stream);
+
+    // Number of values of each list column; null and empty lists have one value
+    std::vector<size_t> list_values(num_columns, 0);
 
     // Initialize column chunk information
     size_t total_decompressed_size = 0;
@@ -774,14 +1646,21 @@ table_with_metadata reader::impl::read(size_type skip_rows,
       auto const row_group_rows   = std::min<int>(remaining_rows, row_group.num_rows);
       auto const io_chunk_idx     = chunks.size();
 
+      // Rows of the row group that are part of the output
+      auto const min_row = std::max<int64_t>(static_cast<int64_t>(skip_rows) - row_group_start, 0);
+      auto const max_row = std::min<int64_t>(
+        static_cast<int64_t>(skip_rows) + num_rows - row_group_start, row_group.num_rows);
+      auto const is_partial = (min_row > 0 || max_row < row_group.num_rows);
+      CUDF_EXPECTS(!is_partial || !has_lists, "List columns can only be read in whole row groups");
+
       for (size_t i = 0; i < num_columns; ++i) {
-        auto const col         = _selected_columns[i];
+        auto const col         = columns[i];
         auto const &col_meta   = row_group.columns[col.first].meta_data;
         auto const &col_schema = _metadata->get_schema(row_group.columns[col.first].schema_idx);
 
         // Spec requires each row group to contain exactly one chunk for every
         // column. If there are too many or too few, continue with best effort
-        if (col.second != name_from_path(col_meta.path_in_schema)) {
+        if (col.second != column_name(row_group.columns[col.first], col_schema)) {
           std::cerr << "Detected mismatched column chunk" << std::endl;
           continue;
         }
@@ -794,7 +1673,7 @@ table_with_metadata reader::impl::read(size_type skip_rows,
         int32_t clock_rate;
         int8_t converted_type;
         std::tie(type_width, clock_rate, converted_type) =
-          conversion_info(column_types[i].id(),
+          conversion_info(decode_type_id(column_types[i]),
                           _timestamp_type.id(),
                           col_schema.type,
                           col_schema.converted_type,
@@ -805,13 +1684,42 @@ table_with_metadata reader::impl::read(size_type skip_rows,
             ? std::min(col_meta.data_page_offset, col_meta.dictionary_page_offset)
             : col_meta.data_page_offset;
 
-        chunks.insert(gpu::ColumnChunkDesc(col_meta.total_compressed_size,
+        // Only read the data pages that overlap the output rows if the chunk has a page index.
+        // This requires one value per row, so that page row counts are known before decoding.
+        size_t chunk_size      = col_meta.total_compressed_size;
+        size_t chunk_values    = col_meta.num_values;
+        size_t chunk_start_row = row_group_start;
+        page_selection selection;
+        if (is_partial && col_meta.num_values == row_group.num_rows &&
+            col_schema.max_repetition_level == 0 &&
+            select_pages(
+              read_offset_index(*_sources[row_group_source], row_group.columns[col.first]),
+              column_chunk_offsets[chunks.size()],
+              col_meta.total_compressed_size,
+              row_group.num_rows,
+              min_row,
+              max_row,
+              selection)) {
+          column_chunk_skips[chunks.size()] = {selection.skip_offset, selection.skip_size};
+          chunk_size                        = selection.read_size;
+          chunk_values                      = selection.num_rows;
+          chunk_start_row                   = row_group_start + selection.first_row;
+        }
+        // Lists are decoded with one output row per value, and assembled once all are decoded
+        auto chunk_rows = static_cast<uint32_t>(row_group_rows);
+        if (column_lists[i].is_list) {
+          chunk_start_row = skip_rows + list_values[i];
+          chunk_rows      = static_cast<uint32_t>(col_meta.num_values);
+          list_values[i] += col_meta.num_values;
+        }
+
+        chunks.insert(gpu::ColumnChunkDesc(chunk_size,
                                            nullptr,
-                                           col_meta.num_values,
+                                           chunk_values,
                                            col_schema.type,
                                            type_width,
-                                           row_group_start,
-                                           row_group_rows,
+                                           chunk_start_row,
+                                           chunk_rows,
                                            col_schema.max_definition_level,
                                            col_schema.max_repetition_level,
                                            required_bits(col_schema.max_definition_level),
@@ -824,6 +1732,7 @@ table_with_metadata reader::impl::read(size_type skip_rows,
         // Map each column chunk to its column index and its source index
         chunk_col_map[chunks.size() - 1]    = i;
         chunk_source_map[chunks.size() - 1] = row_group_source;
+        bytes_read += chunk_size;
 
         if (col_meta.codec != Compression::UNCOMPRESSED) {
           total_decompressed_size += col_meta.total_uncompressed_size;
@@ -835,12 +1744,15 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                          io_chunk_idx,
                          chunks.size(),
                          column_chunk_offsets,
+                         column_chunk_skips,
                          chunk_source_map,
+                         copier,
                          stream);
 
       remaining_rows -= row_group.num_rows;
     }
     assert(remaining_rows <= 0);
+    bytes_decompressed = total_decompressed_size;
 
     // Process dataset chunk pages into output columns
     const auto total_pages = count_page_headers(chunks, stream);
@@ -849,6 +1761,18 @@ table_with_metadata reader::impl::read(size_type skip_rows,
       rmm::device_buffer decomp_page_data;
 
       decode_page_headers(chunks, pages, stream);
+      if (has_lists) {
+        // Rows are only delimited by the repetition levels in V2 data pages
+        for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
+          if (column_lists[chunk_col_map[c]].is_list) {
+            for (int p = chunks[c].num_dict_pages; p < chunks[c].max_num_pages; ++p) {
+              CUDF_EXPECTS(pages[page_count + p].num_rows == pages[page_count + p].num_values,
+                           "V2 data pages are not supported in list columns");
+            }
+          }
+          page_count += chunks[c].max_num_pages;
+        }
+      }
       if (total_decompressed_size > 0) {
         decomp_page_data = decompress_page_data(chunks, pages, stream);
         // Free compressed data
@@ -859,44 +1783,311 @@ table_with_metadata reader::impl::read(size_type skip_rows,
           }
         }
       }
+      // Prefix-compressed strings are rebuilt as PLAIN pages before decoding
+      auto const expanded_page_data = expand_delta_byte_array_pages(chunks, pages, stream);
+
+      // Dictionary columns whose data pages all use the chunk's dictionary are decoded as
+      // indices into the concatenated dictionaries of their chunks
+      std::vector<bool> decode_indices(column_types.size());
+      for (size_t i = 0; i < column_types.size(); ++i) {
+        decode_indices[i] = (column_types[i].id() == type_id::DICTIONARY32);
+      }
+      std::vector<size_type> num_dict_keys(column_types.size(), 0);
+      for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
+        auto const col = chunk_col_map[c];
+        decode_indices[col] =
+          decode_indices[col] && is_dictionary_encoded(chunks[c], &pages[page_count]);
+        if (decode_indices[col]) { num_dict_keys[col] += pages[page_count].num_values; }
+        page_count += chunks[c].max_num_pages;
+      }
+      // Columns with only empty dictionaries have no keys to index
+      for (size_t i = 0; i < column_types.size(); ++i) {
+        decode_indices[i] = decode_indices[i] && num_dict_keys[i] != 0;
+      }
+      std::vector<size_type> dict_index_bases(column_types.size(), 0);
+      for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
+        auto const col = chunk_col_map[c];
+        if (decode_indices[col]) {
+          chunks[c].data_type       = (chunks[c].data_type & 7) | (sizeof(int32_t) << 3);
+          chunks[c].dict_index_base = dict_index_bases[col];
+          dict_index_bases[col] += pages[page_count].num_values;
+        }
+        page_count += chunks[c].max_num_pages;
+      }
 
       std::vector<column_buffer> out_buffers;
       out_buffers.reserve(column_types.size());
       for (size_t i = 0; i < column_types.size(); ++i) {
-        auto col                    = _selected_columns[i];
+        auto col                    = columns[i];
         auto const &first_row_group = _metadata->get_row_group(selected_row_groups[0].index,
                                                                selected_row_groups[0].source_index);
         auto &col_schema = _metadata->get_schema(first_row_group.columns[col.first].schema_idx);
         bool is_nullable = (col_schema.max_definition_level != 0);
-        out_buffers.emplace_back(column_types[i], num_rows, is_nullable, stream, _mr);
+        auto const buffer_id = decode_indices[i] ? type_id::INT32 : decode_type_id(column_types[i]);
+        auto const buffer_rows =
+          column_lists[i].is_list ? static_cast<size_type>(list_values[i]) : num_rows;
+        if (outputs != nullptr) {
+          auto const &output = (*outputs)[i];
+          // Rows of a column without nulls are all valid in a nullable output
+          if (!is_nullable && output.nullable()) {
+            cudf::set_null_mask(output.null_mask(), 0, num_rows, true, stream);
+          }
+          out_buffers.emplace_back(output, is_nullable, stream, _mr);
+        } else {
+          out_buffers.emplace_back(data_type{buffer_id}, buffer_rows, is_nullable, stream, _mr);
+          // The page null counts are those of the rows, not of the values of list columns
+          out_buffers.back()._strings_validity_in_mask = !column_lists[i].is_list;
+        }
       }
 
-      decode_page_data(chunks, pages, skip_rows, num_rows, chunk_col_map, out_buffers, stream);
-
+      // Levels of the values of list columns
+      std::vector<rmm::device_vector<uint8_t>> rep_levels(column_types.size());
+      std::vector<rmm::device_vector<uint8_t>> def_levels(column_types.size());
+      size_t decode_rows = num_rows;
       for (size_t i = 0; i < column_types.size(); ++i) {
-        out_columns.emplace_back(
-          make_column(column_types[i], num_rows, out_buffers[i], stream, _mr));
+        if (column_lists[i].is_list) {
+          rep_levels[i].resize(list_values[i]);
+          def_levels[i].resize(list_values[i]);
+          decode_rows = std::max(decode_rows, list_values[i]);
+        }
+      }
+      for (size_t c = 0; c < chunks.size(); c++) {
+        auto const col = chunk_col_map[c];
+        if (column_lists[col].is_list) {
+          chunks[c].rep_levels = rep_levels[col].data().get();
+          chunks[c].def_levels = def_levels[col].data().get();
+        }
+      }
+
+      rmm::device_vector<gpu::nvstrdesc_s> str_dict_index;
+      decode_page_data(
+        chunks, pages, skip_rows, decode_rows, chunk_col_map, out_buffers, str_dict_index, stream);
+
+      if (outputs != nullptr) {
+        for (size_t i = 0; i < column_types.size(); ++i) {
+          CUDF_EXPECTS((*outputs)[i].nullable() || out_buffers[i].null_count() == 0,
+                       "Column with nulls read into an output without null mask");
+          into->null_counts[i] = out_buffers[i].null_count();
+        }
+      }
+      for (size_t i = 0; i < column_types.size() && outputs == nullptr; ++i) {
+        if (column_lists[i].is_list) {
+          auto leaf = make_column(
+            column_types[i], static_cast<size_type>(list_values[i]), out_buffers[i], stream, _mr);
+          out_columns.emplace_back(make_list_column(std::move(leaf),
+                                                    rep_levels[i],
+                                                    def_levels[i],
+                                                    column_lists[i],
+                                                    num_rows,
+                                                    _mr,
+                                                    stream));
+        } else if (column_types[i].id() == type_id::DICTIONARY32) {
+          out_columns.emplace_back(make_dictionary_column(
+            chunks, pages, chunk_col_map, i, num_rows, decode_indices[i], out_buffers[i], stream));
+        } else {
+          out_columns.emplace_back(
+            make_column(column_types[i], num_rows, out_buffers[i], stream, _mr));
+          // The statistics of the row groups read bound the values of the column
+          auto stats = _metadata->chunk_statistics(selected_row_groups.front(), columns[i].first);
+          for (size_t r = 1; r < selected_row_groups.size() && stats.has_minmax; ++r) {
+            stats = merge_statistics(
+              stats, _metadata->chunk_statistics(selected_row_groups[r], columns[i].first));
+          }
+          out_columns.back()->set_statistics(to_column_statistics(stats, column_types[i]));
+        }
       }
     }
   }
 
   // Create empty columns as needed
   for (size_t i = out_columns.size(); i < column_types.size(); ++i) {
-    out_columns.emplace_back(make_empty_column(column_types[i]));
+    if (column_lists[i].is_list) {
+      out_columns.emplace_back(make_list_column(make_empty_column(column_types[i]),
+                                                rmm::device_vector<uint8_t>{},
+                                                rmm::device_vector<uint8_t>{},
+                                                column_lists[i],
+                                                0,
+                                                _mr,
+                                                stream));
+    } else {
+      out_columns.emplace_back(make_empty_column(column_types[i]));
+    }
   }
 
   table_metadata out_metadata;
   // Return column names (must match order of returned columns)
-  out_metadata.column_names.resize(_selected_columns.size());
-  for (size_t i = 0; i < _selected_columns.size(); i++) {
-    out_metadata.column_names[i] = _selected_columns[i].second;
+  out_metadata.column_names.resize(columns.size());
+  for (size_t i = 0; i < columns.size(); i++) {
+    out_metadata.column_names[i] = columns[i].second;
   }
   // Return user metadata
   out_metadata.user_data = _metadata->get_key_value_metadata();
 
+  cudf::detail::report_counter("read_parquet", "bytes_read", bytes_read);
+  cudf::detail::report_counter("read_parquet", "bytes_decompressed", bytes_decompressed);
+  cudf::detail::report_counter(
+    "read_parquet", "rows_skipped", _metadata->get_num_rows() - rows_selected);
+
   return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
 }
 
+table_with_metadata reader::impl::read(size_type skip_rows,
+                                       size_type num_rows,
+                                       std::vector<std::vector<size_type>> const &row_group_list,
+                                       cudaStream_t stream,
+                                       std::vector<mutable_column_view> const *outputs,
+                                       read_into_result *into)
+{
+  if (_filter_rows && !_filter.empty()) {
+    CUDF_EXPECTS(outputs == nullptr, "Rows cannot be filtered when reading into caller memory");
+    return read_filtered(skip_rows, num_rows, row_group_list, stream);
+  }
+  return read_columns(
+    _selected_columns, skip_rows, num_rows, row_group_list, stream, outputs, into);
+}
+
+table_with_metadata reader::impl::read_filtered(
+  size_type skip_rows,
+  size_type num_rows,
+  std::vector<std::vector<size_type>> const &row_group_list,
+  cudaStream_t stream)
+{
+  auto const &column_names = _metadata->get_column_names();
+
+  // Decode the columns referenced by the filter first
+  std::vector<int> filter_indices;
+  for (auto const &conjunction : _filter) {
+    for (auto const &pred : conjunction) { filter_indices.push_back(pred.first); }
+  }
+  std::sort(filter_indices.begin(), filter_indices.end());
+  filter_indices.erase(std::unique(filter_indices.begin(), filter_indices.end()),
+                       filter_indices.end());
+  std::vector<std::pair<int, std::string>> filter_columns;
+  for (auto const idx : filter_indices) { filter_columns.emplace_back(idx, column_names[idx]); }
+  auto filter_table = read_columns(filter_columns, skip_rows, num_rows, row_group_list, stream);
+
+  // Rows of the decoded range that satisfy the filter
+  auto local_filter = _filter;
+  for (auto &conjunction : local_filter) {
+    for (auto &pred : conjunction) {
+      pred.first = std::distance(
+        filter_indices.cbegin(),
+        std::lower_bound(filter_indices.cbegin(), filter_indices.cend(), pred.first));
+    }
+  }
+  auto const rows = satisfying_rows(filter_table.tbl->view(), local_filter, stream);
+  std::vector<size_type> h_rows(rows.size());
+  CUDA_TRY(cudaMemcpyAsync(h_rows.data(),
+                           rows.data().get(),
+                           rows.size() * sizeof(size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  // Same row group selection as the read of the filter columns
+  auto row_start = skip_rows;
+  auto row_count = num_rows;
+  auto const filtered_row_groups =
+    _metadata->filter_row_groups(_sources, row_group_list, _filter);
+  auto const selection = _metadata->select_row_groups(filtered_row_groups, row_start, row_count);
+
+  // Row groups of the selection that hold rows satisfying the filter
+  std::vector<size_t> row_group_of(h_rows.size());
+  std::vector<bool> is_surviving(selection.size(), false);
+  for (size_t i = 0; i < h_rows.size(); ++i) {
+    auto const row = static_cast<size_t>(row_start) + h_rows[i];
+    auto const rg  = std::upper_bound(
+                      selection.cbegin(),
+                      selection.cend(),
+                      row,
+                      [](size_t r, auto const &info) { return r < info.start_row; }) -
+                    selection.cbegin() - 1;
+    row_group_of[i]  = rg;
+    is_surviving[rg] = true;
+  }
+
+  // Decode the other selected columns, only for the row groups with rows left
+  std::vector<std::pair<int, std::string>> remaining_columns;
+  for (auto const &col : _selected_columns) {
+    if (!std::binary_search(filter_indices.cbegin(), filter_indices.cend(), col.first)) {
+      remaining_columns.push_back(col);
+    }
+  }
+  std::unique_ptr<table> remaining_table;
+  rmm::device_vector<size_type> remaining_rows;
+  if (!remaining_columns.empty()) {
+    if (std::all_of(is_surviving.cbegin(), is_surviving.cend(), [](bool s) { return s; })) {
+      remaining_table =
+        read_columns(remaining_columns, skip_rows, num_rows, row_group_list, stream).tbl;
+      remaining_rows = rows;
+    } else {
+      std::vector<std::vector<size_type>> surviving_row_groups(_sources.size());
+      std::vector<size_t> decoded_start(selection.size(), 0);
+      size_t num_decoded = 0;
+      for (size_t rg = 0; rg < selection.size(); ++rg) {
+        if (!is_surviving[rg]) { continue; }
+        auto const &info = selection[rg];
+        surviving_row_groups[info.source_index].push_back(info.index);
+        decoded_start[rg] = num_decoded;
+        num_decoded += _metadata->get_row_group(info.index, info.source_index).num_rows;
+      }
+      remaining_table = read_columns(remaining_columns, 0, -1, surviving_row_groups, stream).tbl;
+      std::vector<size_type> h_remaining_rows(h_rows.size());
+      for (size_t i = 0; i < h_rows.size(); ++i) {
+        auto const &info    = selection[row_group_of[i]];
+        auto const row      = static_cast<size_t>(row_start) + h_rows[i];
+        h_remaining_rows[i] = decoded_start[row_group_of[i]] + (row - info.start_row);
+      }
+      remaining_rows = h_remaining_rows;
+    }
+  }
+
+  // Gather the rows left and assemble the columns in the order of the selection
+  auto const gather_rows = [&](table_view const &tbl, rmm::device_vector<size_type> const &map) {
+    column_view const gather_map(
+      data_type{type_id::INT32}, static_cast<size_type>(map.size()), map.data().get());
+    return cudf::detail::gather(tbl,
+                                gather_map,
+                                cudf::detail::out_of_bounds_policy::IGNORE,
+                                cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                _mr,
+                                stream)
+      ->release();
+  };
+  auto filter_out = gather_rows(filter_table.tbl->view(), rows);
+  std::vector<std::unique_ptr<column>> remaining_out;
+  if (remaining_table != nullptr) {
+    remaining_out = gather_rows(remaining_table->view(), remaining_rows);
+  }
+
+  std::vector<std::unique_ptr<column>> out_columns;
+  table_metadata out_metadata;
+  size_t next_remaining = 0;
+  for (auto const &col : _selected_columns) {
+    auto const filter_pos =
+      std::lower_bound(filter_indices.cbegin(), filter_indices.cend(), col.first);
+    if (filter_pos != filter_indices.cend() && *filter_pos == col.first) {
+      out_columns.emplace_back(std::move(filter_out[filter_pos - filter_indices.cbegin()]));
+    } else {
+      out_columns.emplace_back(std::move(remaining_out[next_remaining++]));
+    }
+    out_metadata.column_names.push_back(col.second);
+  }
+  out_metadata.user_data = _metadata->get_key_value_metadata();
+
+  return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
+}
+
+read_into_result reader::impl::read_into(std::vector<mutable_column_view> const &outputs,
+                                         size_type skip_rows,
+                                         size_type num_rows,
+                                         cudaStream_t stream)
+{
+  read_into_result result;
+  result.metadata = read(skip_rows, num_rows, {}, stream, &outputs, &result).metadata;
+  return result;
+}
+
 // Forward to implementation
 reader::reader(std::vector<std::string> const &filepaths,
                reader_options const &options,
@@ -932,6 +2123,26 @@ table_with_metadata reader::read_rows(size_type skip_rows, size_type num_rows, c
   return _impl->read(skip_rows, (num_rows != 0) ? num_rows : -1, {}, stream);
 }
 
+// Forward to implementation
+read_into_result reader::read_rows_into(std::vector<mutable_column_view> const &outputs,
+                                        size_type skip_rows,
+                                        size_type num_rows,
+                                        cudaStream_t stream)
+{
+  return _impl->read_into(outputs, skip_rows, (num_rows != 0) ? num_rows : -1, stream);
+}
+
+// Forward to implementation
+std::vector<std::pair<size_type, size_type>> reader::split_rows(size_t chunk_read_limit,
+                                                                size_type skip_rows,
+                                                                size_type num_rows)
+{
+  return _impl->split_rows(chunk_read_limit, skip_rows, (num_rows != 0) ? num_rows : -1);
+}
+
+// Forward to implementation
+std::vector<block_info> reader::get_row_group_info() { return _impl->get_row_group_info(); }
+
 }  // namespace parquet
 }  // namespace detail
 }  // namespace io
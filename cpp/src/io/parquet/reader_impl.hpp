@@ -24,8 +24,10 @@
 #include "parquet.h"
 #include "parquet_gpu.h"
 
+#include <io/statistics/predicate_filter.hpp>
 #include <io/utilities/column_buffer.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/staging_buffer.hpp>
 
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/readers.hpp>
@@ -68,15 +70,102 @@ class reader::impl {
    * @param num_rows Number of rows to read
    * @param row_group_indices TODO
    * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @param outputs Caller-owned columns to decode into, or null to allocate the columns
+   * @param into Receives the number of rows and null counts decoded into `outputs`
    *
-   * @return The set of columns along with metadata
+   * @return The set of columns along with metadata; empty columns if decoded into `outputs`
    */
   table_with_metadata read(size_type skip_rows,
                            size_type num_rows,
                            std::vector<std::vector<size_type>> const &row_group_indices,
-                           cudaStream_t stream);
+                           cudaStream_t stream,
+                           std::vector<mutable_column_view> const *outputs = nullptr,
+                           read_into_result *into                          = nullptr);
+
+  /**
+   * @brief Read a range of rows into caller-owned columns
+   *
+   * @param outputs Fixed-width columns of the types of the selected columns, without offset
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to read
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The number of rows and null counts decoded, along with metadata
+   */
+  read_into_result read_into(std::vector<mutable_column_view> const &outputs,
+                             size_type skip_rows,
+                             size_type num_rows,
+                             cudaStream_t stream);
+
+  /**
+   * @brief Splits a range of rows into consecutive ranges that fit a decompressed size limit
+   *
+   * @param chunk_read_limit Limit on the decompressed size of each range in bytes; `0` for none
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to split; `-1` for all remaining rows
+   *
+   * @return List of (skip_rows, num_rows) pairs
+   */
+  std::vector<std::pair<size_type, size_type>> split_rows(size_t chunk_read_limit,
+                                                          size_type skip_rows,
+                                                          size_type num_rows);
+
+  /**
+   * @brief Returns the size information of the row groups that pass the filters
+   *
+   * @return Size information of each row group
+   */
+  std::vector<block_info> get_row_group_info();
 
  private:
+  /**
+   * @brief Reads a set of columns of a range of rows
+   *
+   * @param columns Indices and names of the columns to read
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to read
+   * @param row_group_list Lists of row groups to read, one per source; empty for all row groups
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @param outputs Caller-owned columns to decode into, or null to allocate the columns
+   * @param into Receives the number of rows and null counts decoded into `outputs`
+   *
+   * @return The columns along with metadata; empty columns if decoded into `outputs`
+   */
+  table_with_metadata read_columns(std::vector<std::pair<int, std::string>> const &columns,
+                                   size_type skip_rows,
+                                   size_type num_rows,
+                                   std::vector<std::vector<size_type>> const &row_group_list,
+                                   cudaStream_t stream,
+                                   std::vector<mutable_column_view> const *outputs = nullptr,
+                                   read_into_result *into                          = nullptr);
+
+  /**
+   * @brief Reads the rows of a range that satisfy the filter
+   *
+   * The columns referenced by the filter are decoded and evaluated first; the other selected
+   * columns are then only decoded for the row groups that hold rows satisfying the filter.
+   *
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to read
+   * @param row_group_list Lists of row groups to read, one per source; empty for all row groups
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The rows satisfying the filter along with metadata
+   */
+  table_with_metadata read_filtered(size_type skip_rows,
+                                    size_type num_rows,
+                                    std::vector<std::vector<size_type>> const &row_group_list,
+                                    cudaStream_t stream);
+
+  /**
+   * @brief Estimates the decoded size of the selected columns of a row group
+   *
+   * @param row_group Row group metadata
+   *
+   * @return Uncompressed page sizes plus string offsets, in bytes
+   */
+  size_t decoded_size(RowGroup const &row_group) const;
+
   /**
    * @brief Reads compressed page data to device memory
    *
@@ -85,6 +174,9 @@ class reader::impl {
    * @param begin_chunk Index of first column chunk to read
    * @param end_chunk Index after the last column chunk to read
    * @param column_chunk_offsets File offset for all chunks
+   * @param column_chunk_skips Relative offset and size of the pages to skip for all chunks
+   * @param chunk_source_map Source index for all chunks
+   * @param copier Staged copier used to transfer chunk data to the device
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
    */
@@ -93,7 +185,9 @@ class reader::impl {
                           size_t begin_chunk,
                           size_t end_chunk,
                           const std::vector<size_t> &column_chunk_offsets,
+                          std::vector<std::pair<size_t, size_t>> const &column_chunk_skips,
                           std::vector<size_type> const &chunk_source_map,
+                          detail::staged_device_copier &copier,
                           cudaStream_t stream);
 
   /**
@@ -130,6 +224,19 @@ class reader::impl {
                                           hostdevice_vector<gpu::PageInfo> &pages,
                                           cudaStream_t stream);
 
+  /**
+   * @brief Rebuilds the DELTA_BYTE_ARRAY pages as PLAIN pages, at page granularity.
+   *
+   * @param chunks List of column chunk descriptors
+   * @param pages List of page information
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Device buffer to rebuilt page data, empty if there are no DELTA_BYTE_ARRAY pages
+   */
+  rmm::device_buffer expand_delta_byte_array_pages(hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
+                                                   hostdevice_vector<gpu::PageInfo> &pages,
+                                                   cudaStream_t stream);
+
   /**
    * @brief Converts the page data and outputs to columns.
    *
@@ -139,6 +246,7 @@ class reader::impl {
    * @param total_rows Number of rows to output
    * @param chunk_map Mapping between chunk and column
    * @param out_buffers Output columns' device buffers
+   * @param str_dict_index Output string dictionary entries of all chunks
    * @param stream CUDA stream used for device memory operations and kernel launches.
    */
   void decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
@@ -147,8 +255,36 @@ class reader::impl {
                         size_t total_rows,
                         const std::vector<int> &chunk_map,
                         std::vector<column_buffer> &out_buffers,
+                        rmm::device_vector<gpu::nvstrdesc_s> &str_dict_index,
                         cudaStream_t stream);
 
+  /**
+   * @brief Creates a dictionary column from a decoded string column buffer.
+   *
+   * If the chunks were decoded as dictionary indices, the dictionaries of the column's chunks are
+   * merged into a single set of keys and the indices are remapped onto them. Otherwise the decoded
+   * strings are dictionary encoded.
+   *
+   * @param chunks List of column chunk descriptors
+   * @param pages List of page information
+   * @param chunk_map Mapping between chunk and column
+   * @param col_idx Index of the output column
+   * @param num_rows Number of rows in the output column
+   * @param is_indices Whether the buffer holds dictionary indices instead of strings
+   * @param buffer Output column's device buffers
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The dictionary column
+   */
+  std::unique_ptr<column> make_dictionary_column(hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
+                                                 hostdevice_vector<gpu::PageInfo> &pages,
+                                                 const std::vector<int> &chunk_map,
+                                                 size_t col_idx,
+                                                 size_type num_rows,
+                                                 bool is_indices,
+                                                 column_buffer &buffer,
+                                                 cudaStream_t stream);
+
  private:
   rmm::mr::device_memory_resource *_mr = nullptr;
   std::vector<std::unique_ptr<datasource>> _sources;
@@ -156,7 +292,10 @@ class reader::impl {
 
   std::vector<std::pair<int, std::string>> _selected_columns;
   bool _strings_to_categorical = false;
+  bool _strings_to_dictionary  = false;
   data_type _timestamp_type{type_id::EMPTY};
+  resolved_predicate_filter _filter;
+  bool _filter_rows = false;
 };
 
 }  // namespace parquet
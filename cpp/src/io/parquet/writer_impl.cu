@@ -19,18 +19,31 @@
  * @brief cuDF-IO parquet writer class implementation
  */
 
+#include "bloom_filter.hpp"
 #include "writer_impl.hpp"
 
+#include <cudf/detail/gather.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/bit.hpp>
 
 #include <algorithm>
 #include <cstring>
+#include <iterator>
+#include <limits>
+#include <numeric>
 #include <utility>
 
 #include <rmm/thrust_rmm_allocator.h>
 #include <rmm/device_buffer.hpp>
 
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
 namespace cudf {
 namespace io {
 namespace detail {
@@ -53,6 +66,8 @@ parquet::Compression to_parquet_compression(compression_type compression)
   switch (compression) {
     case compression_type::AUTO:
     case compression_type::SNAPPY: return parquet::Compression::SNAPPY;
+    case compression_type::ZSTD: return parquet::Compression::ZSTD;
+    case compression_type::LZ4: return parquet::Compression::LZ4;
     case compression_type::NONE: return parquet::Compression::UNCOMPRESSED;
     default:
       CUDF_EXPECTS(false, "Unsupported compression type");
@@ -60,6 +75,277 @@ parquet::Compression to_parquet_compression(compression_type compression)
   }
 }
 
+/**
+ * @brief Returns the plain encoding of a page min/max value, as stored in a ColumnIndex
+ *
+ * String values are copied from device memory beforehand by `copy_string_page_bounds`.
+ *
+ * @param val Statistics value
+ * @param dtype Statistics type of the column, other than `dtype_string`
+ **/
+std::vector<uint8_t> encode_page_bound(statistics_val const &val, statistics_dtype dtype)
+{
+  std::vector<uint8_t> bound;
+  auto const store = [&](auto value) {
+    bound.resize(sizeof(value));
+    std::memcpy(bound.data(), &value, sizeof(value));
+  };
+  switch (dtype) {
+    case dtype_bool: store(static_cast<uint8_t>(val.i_val != 0)); break;
+    case dtype_int8:
+    case dtype_int16:
+    case dtype_int32:
+    case dtype_date32: store(static_cast<int32_t>(val.i_val)); break;
+    case dtype_int64:
+    case dtype_timestamp64:
+    case dtype_decimal64: store(val.i_val); break;
+    case dtype_float32: store(static_cast<float>(val.fp_val)); break;
+    case dtype_float64: store(val.fp_val); break;
+    default: break;
+  }
+  return bound;
+}
+
+/**
+ * @brief Copies the min/max values of the pages of string columns to host memory, truncated to
+ * at most `truncate_length` bytes as in the statistics of the page headers
+ *
+ * The values are truncated and gathered on the device, so that they are all copied at once.
+ *
+ * @param page_stats Statistics of each page, in host memory
+ * @param is_string Whether each page belongs to a string column
+ * @param truncate_length Maximum length of the values, 0 for no limit
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The min and max value of each page with string bounds, empty for the other pages
+ **/
+std::vector<std::pair<std::vector<uint8_t>, std::vector<uint8_t>>> copy_string_page_bounds(
+  std::vector<statistics_chunk> const &page_stats,
+  std::vector<bool> const &is_string,
+  uint32_t truncate_length,
+  cudaStream_t stream)
+{
+  std::vector<std::pair<std::vector<uint8_t>, std::vector<uint8_t>>> bounds(page_stats.size());
+  // min and max of each page, in turn
+  std::vector<string_stats> h_values;
+  std::vector<size_t> value_pages;
+  for (size_t p = 0; p < page_stats.size(); p++) {
+    if (is_string[p] && page_stats[p].non_nulls != 0 && page_stats[p].has_minmax) {
+      h_values.push_back(page_stats[p].min_value.str_val);
+      h_values.push_back(page_stats[p].max_value.str_val);
+      value_pages.push_back(p);
+    }
+  }
+  if (h_values.empty()) { return bounds; }
+
+  auto const num_values = h_values.size();
+  rmm::device_vector<string_stats> values(h_values);
+  rmm::device_vector<uint32_t> lengths(num_values);
+  auto execpol = rmm::exec_policy(stream);
+  thrust::transform(execpol->on(stream),
+                    thrust::make_counting_iterator<size_t>(0),
+                    thrust::make_counting_iterator<size_t>(num_values),
+                    lengths.begin(),
+                    [values = values.data().get(), truncate_length] __device__(size_t i) {
+                      auto const str = reinterpret_cast<uint8_t const *>(values[i].ptr);
+                      return (i % 2 == 0)
+                               ? gpu::TruncatedMinLength(str, values[i].length, truncate_length)
+                               : gpu::TruncatedMaxLength(str, values[i].length, truncate_length);
+                    });
+  std::vector<uint32_t> h_lengths(num_values);
+  CUDA_TRY(cudaMemcpyAsync(h_lengths.data(),
+                           lengths.data().get(),
+                           num_values * sizeof(uint32_t),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  std::vector<size_t> h_offsets(num_values + 1, 0);
+  for (size_t i = 0; i < num_values; i++) { h_offsets[i + 1] = h_offsets[i] + h_lengths[i]; }
+  rmm::device_vector<size_t> offsets(h_offsets);
+  rmm::device_buffer chars(h_offsets.back(), stream);
+  thrust::for_each_n(execpol->on(stream),
+                     thrust::make_counting_iterator<size_t>(0),
+                     num_values,
+                     [values  = values.data().get(),
+                      lengths = lengths.data().get(),
+                      offsets = offsets.data().get(),
+                      chars   = static_cast<uint8_t *>(chars.data())] __device__(size_t i) {
+                       auto const length = lengths[i];
+                       memcpy(chars + offsets[i], values[i].ptr, length);
+                       // A truncated max is incremented to remain an upper bound
+                       if (i % 2 == 1 && length < values[i].length) {
+                         chars[offsets[i] + length - 1]++;
+                       }
+                     });
+  std::vector<uint8_t> h_chars(h_offsets.back());
+  CUDA_TRY(cudaMemcpyAsync(
+    h_chars.data(), chars.data(), h_chars.size(), cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  for (size_t v = 0; v < value_pages.size(); v++) {
+    auto const value = [&](size_t i) {
+      return std::vector<uint8_t>(h_chars.begin() + h_offsets[i],
+                                  h_chars.begin() + h_offsets[i + 1]);
+    };
+    bounds[value_pages[v]] = {value(2 * v), value(2 * v + 1)};
+  }
+  return bounds;
+}
+
+/**
+ * @brief Builds the page indexes of an encoded column chunk
+ *
+ * @param ck Encoded column chunk
+ * @param pages Encoded pages of the chunk, starting with the dictionary page if any
+ * @param page_stats Statistics of each page, or nullptr to omit the ColumnIndex
+ * @param string_bounds Min/max values of each page of a string column, from
+ * `copy_string_page_bounds`
+ * @param dtype Statistics type of the column
+ * @param chunk_offset File offset of the column chunk
+ * @param row_offsets Index of the first value of each row of a list column, or nullptr
+ * @param offset_index Page locations of the chunk
+ * @param column_index Per-page statistics of the chunk; left empty if they are not available
+ **/
+void build_page_indexes(
+  gpu::EncColumnChunk const &ck,
+  gpu::EncPage const *pages,
+  statistics_chunk const *page_stats,
+  std::pair<std::vector<uint8_t>, std::vector<uint8_t>> const *string_bounds,
+  statistics_dtype dtype,
+  size_t chunk_offset,
+  std::vector<uint32_t> const *row_offsets,
+  OffsetIndex &offset_index,
+  ColumnIndex &column_index)
+{
+  bool has_column_index =
+    (page_stats != nullptr && dtype != dtype_none && dtype != dtype_decimal128);
+  // Pages of list columns start at a row boundary; convert their first value to a row index
+  auto const row_index = [&](uint32_t value) -> int64_t {
+    if (row_offsets == nullptr) { return value; }
+    return std::upper_bound(row_offsets->cbegin(), row_offsets->cend(), value) -
+           row_offsets->cbegin() - 1;
+  };
+  size_t page_offset = chunk_offset;
+  for (uint32_t p = 0; p < ck.num_pages; p++) {
+    auto const page_size = pages[p].hdr_size + pages[p].max_data_size;
+    if (pages[p].page_type == DATA_PAGE) {
+      PageLocation location;
+      location.offset               = page_offset;
+      location.compressed_page_size = page_size;
+      location.first_row_index      = row_index(pages[p].start_row) - row_index(ck.start_row);
+      offset_index.page_locations.push_back(location);
+
+      if (has_column_index) {
+        auto const &stats   = page_stats[p];
+        bool const all_null = (stats.non_nulls == 0);
+        // Pages with values but without bounds (e.g. all NaNs) cannot be described
+        has_column_index = (all_null || stats.has_minmax);
+        column_index.null_pages.push_back(all_null);
+        if (all_null) {
+          column_index.min_values.emplace_back();
+          column_index.max_values.emplace_back();
+        } else if (dtype == dtype_string) {
+          column_index.min_values.push_back(string_bounds[p].first);
+          column_index.max_values.push_back(string_bounds[p].second);
+        } else {
+          column_index.min_values.push_back(encode_page_bound(stats.min_value, dtype));
+          column_index.max_values.push_back(encode_page_bound(stats.max_value, dtype));
+        }
+        column_index.null_counts.push_back(stats.null_count);
+      }
+    }
+    page_offset += page_size;
+  }
+  if (!has_column_index) { column_index = ColumnIndex{}; }
+}
+
+/**
+ * @brief Returns the number of blocks of a split-block Bloom filter sized for a false positive
+ * rate of about 1% with the given number of distinct values
+ **/
+uint32_t bloom_filter_num_blocks(size_t num_distinct)
+{
+  // ~10 bits per distinct value, rounded up to a power of two as readers expect
+  size_t const target_bytes = std::min<size_t>(num_distinct * 10 / 8, kBloomFilterMaxBytes);
+  size_t num_bytes          = kBloomFilterMinBytes;
+  while (num_bytes < target_bytes) { num_bytes *= 2; }
+  return static_cast<uint32_t>(num_bytes / kBloomFilterBlockBytes);
+}
+
+/**
+ * @brief Returns the first row of each page fragment, followed by the number of rows
+ *
+ * Fragments do not straddle partitions: each partition is split in fragments of `fragment_size`
+ * rows but its last one, and a partition without rows has no fragment.
+ *
+ * @param partition_offsets First row of each partition, in increasing order
+ * @param num_rows Total number of rows
+ * @param fragment_size Maximum number of rows per fragment
+ **/
+std::vector<uint32_t> fragment_starts(std::vector<size_type> const &partition_offsets,
+                                      uint32_t num_rows,
+                                      uint32_t fragment_size)
+{
+  std::vector<uint32_t> starts;
+  for (size_t p = 0; p < partition_offsets.size(); p++) {
+    uint32_t const end_row =
+      (p + 1 < partition_offsets.size()) ? partition_offsets[p + 1] : num_rows;
+    for (uint32_t row = partition_offsets[p]; row < end_row; row += fragment_size) {
+      starts.push_back(row);
+    }
+  }
+  starts.push_back(num_rows);
+  return starts;
+}
+
+/**
+ * @brief Returns the largest number of values held by a page fragment of a list column
+ *
+ * @param row_offsets Index of the first value of each row, followed by the total number of values
+ * @param partition_offsets First row of each partition, in increasing order
+ * @param fragment_size Maximum number of rows per fragment
+ **/
+uint32_t max_fragment_values(std::vector<uint32_t> const &row_offsets,
+                             std::vector<size_type> const &partition_offsets,
+                             uint32_t fragment_size)
+{
+  auto const starts = fragment_starts(partition_offsets, row_offsets.size() - 1, fragment_size);
+  uint32_t max_values = 0;
+  for (size_t f = 0; f + 1 < starts.size(); f++) {
+    max_values = std::max(max_values, row_offsets[starts[f + 1]] - row_offsets[starts[f]]);
+  }
+  return max_values;
+}
+
+/**
+ * @brief Returns the largest number of rows per page fragment, up to `fragment_size`, for which
+ * no fragment of a list column holds more than MAX_PAGE_FRAGMENT_SIZE values
+ *
+ * Returns 1 when a single row holds more values; such fragments cannot be dictionary encoded.
+ *
+ * @param row_offsets Index of the first value of each row, followed by the total number of values
+ * @param partition_offsets First row of each partition, in increasing order
+ * @param fragment_size Maximum number of rows per fragment
+ **/
+uint32_t list_fragment_size(std::vector<uint32_t> const &row_offsets,
+                            std::vector<size_type> const &partition_offsets,
+                            uint32_t fragment_size)
+{
+  while (fragment_size > 1 &&
+         max_fragment_values(row_offsets, partition_offsets, fragment_size) >
+           MAX_PAGE_FRAGMENT_SIZE) {
+    fragment_size /= 2;
+  }
+  return fragment_size;
+}
+
+std::vector<std::unique_ptr<data_sink>> single_sink(std::unique_ptr<data_sink> sink)
+{
+  std::vector<std::unique_ptr<data_sink>> sinks;
+  sinks.push_back(std::move(sink));
+  return sinks;
+}
+
 }  // namespace
 
 /**
@@ -92,6 +378,64 @@ __global__ void stringdata_to_nvstrdesc(gpu::nvstrdesc_s *dst,
   }
 }
 
+/**
+ * @brief Helper kernel for computing the number of leaf values of each row of a list column;
+ * null and empty lists are stored as a single null value
+ **/
+__global__ void list_row_sizes(uint32_t *sizes,
+                               const size_type *offsets,
+                               const bitmask_type *list_nulls,
+                               size_type list_offset,
+                               size_type num_rows)
+{
+  size_type row = blockIdx.x * blockDim.x + threadIdx.x;
+  if (row < num_rows) {
+    bool is_valid  = !list_nulls || bit_is_set(list_nulls, list_offset + row);
+    size_type size = offsets[row + 1] - offsets[row];
+    sizes[row]     = (is_valid && size > 0) ? size : 1;
+  }
+}
+
+/**
+ * @brief Helper kernel for computing the repetition and definition levels of each leaf value of
+ * a list column, along with the index of its list element (out of bounds for null and empty lists)
+ **/
+__global__ void list_levels(uint8_t *rep,
+                            uint8_t *def,
+                            size_type *element_map,
+                            const uint32_t *row_offsets,
+                            const size_type *offsets,
+                            const bitmask_type *list_nulls,
+                            size_type list_offset,
+                            const bitmask_type *element_nulls,
+                            size_type element_offset,
+                            size_type num_elements,
+                            uint8_t list_def,
+                            uint8_t max_def,
+                            size_type num_rows)
+{
+  size_type row = blockIdx.x * blockDim.x + threadIdx.x;
+  if (row < num_rows) {
+    uint32_t pos = row_offsets[row];
+    if (list_nulls && !bit_is_set(list_nulls, list_offset + row)) {
+      rep[pos]         = 0;
+      def[pos]         = 0;
+      element_map[pos] = num_elements;
+    } else if (offsets[row + 1] == offsets[row]) {
+      rep[pos]         = 0;
+      def[pos]         = list_def;
+      element_map[pos] = num_elements;
+    } else {
+      for (size_type i = offsets[row]; i < offsets[row + 1]; i++, pos++) {
+        bool is_valid    = !element_nulls || bit_is_set(element_nulls, element_offset + i);
+        rep[pos]         = (i == offsets[row]) ? 0 : 1;
+        def[pos]         = is_valid ? max_def : list_def + 1;
+        element_map[pos] = i;
+      }
+    }
+  }
+}
+
 /**
  * @brief Helper class that adds parquet-specific column info
  **/
@@ -100,22 +444,26 @@ class parquet_column_view {
   /**
    * @brief Constructor that extracts out the string position + length pairs
    * for building dictionaries for string columns
+   *
+   * The leaf values of list columns are only available after `build_levels()`.
    **/
   explicit parquet_column_view(size_t id,
                                column_view const &col,
                                const table_metadata *metadata,
                                cudaStream_t stream)
     : _id(id),
-      _string_type(col.type().id() == type_id::STRING),
-      _type_width(_string_type ? 0 : cudf::size_of(col.type())),
+      _column(col),
+      _null_count(col.null_count()),
       _converted_type(ConvertedType::UNKNOWN),
       _ts_scale(0),
-      _data_count(col.size()),
-      _null_count(col.null_count()),
-      _data(col.head<uint8_t>() + col.offset() * _type_width),
-      _nulls(col.nullable() ? col.null_mask() : nullptr)
+      _list_type(col.type().id() == type_id::LIST)
   {
-    switch (col.type().id()) {
+    column_view const leaf = _list_type ? lists_column_view(col).child() : col;
+    CUDF_EXPECTS(leaf.type().id() != type_id::LIST,
+                 "Parquet writer only supports lists of non-nested types");
+    _string_type = (leaf.type().id() == type_id::STRING);
+    _type_width  = _string_type ? 0 : cudf::size_of(leaf.type());
+    switch (leaf.type().id()) {
       case cudf::type_id::INT8:
         _physical_type  = Type::INT32;
         _converted_type = ConvertedType::INT_8;
@@ -203,17 +551,11 @@ class parquet_column_view {
         _stats_dtype   = dtype_none;
         break;
     }
-    if (_string_type && _data_count > 0) {
-      strings_column_view view{col};
-      _indexes = rmm::device_buffer(_data_count * sizeof(gpu::nvstrdesc_s), stream);
-      stringdata_to_nvstrdesc<<<((_data_count - 1) >> 8) + 1, 256, 0, stream>>>(
-        reinterpret_cast<gpu::nvstrdesc_s *>(_indexes.data()),
-        view.offsets().data<size_type>(),
-        view.chars().data<char>(),
-        _nulls,
-        _data_count);
-      _data = _indexes.data();
-      CUDA_TRY(cudaStreamSynchronize(stream));
+    if (_list_type) {
+      _list_nullable    = col.nullable();
+      _element_nullable = leaf.nullable();
+    } else {
+      set_leaf(col, stream);
     }
     // Generating default name if name isn't present in metadata
     if (metadata && _id < metadata->column_names.size()) {
@@ -223,6 +565,89 @@ class parquet_column_view {
     }
   }
 
+  /**
+   * @brief Computes the repetition and definition levels of a list column, and gathers its leaf
+   * values so that there is one value per level; null and empty lists take up a single null value
+   *
+   * @param list_optional Whether the list is OPTIONAL in the schema
+   * @param element_optional Whether the list elements are OPTIONAL in the schema
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   **/
+  void build_levels(bool list_optional, bool element_optional, cudaStream_t stream)
+  {
+    lists_column_view const lists{_column};
+    column_view const child   = lists.child();
+    size_type const num_rows  = lists.size();
+    const size_type *offsets  = lists.offsets().data<size_type>() + lists.offset();
+    uint8_t const list_def    = list_optional ? 1 : 0;
+    uint8_t const max_def     = list_def + (element_optional ? 2 : 1);
+    auto exec                 = rmm::exec_policy(stream)->on(stream);
+    uint32_t const num_blocks = (num_rows + 255) >> 8;
+
+    _row_offsets.resize(num_rows + 1, 0);
+    if (num_rows > 0) {
+      list_row_sizes<<<num_blocks, 256, 0, stream>>>(
+        _row_offsets.data().get(), offsets, lists.null_mask(), lists.offset(), num_rows);
+    }
+    thrust::exclusive_scan(exec, _row_offsets.begin(), _row_offsets.end(), _row_offsets.begin());
+    _host_row_offsets.resize(num_rows + 1);
+    CUDA_TRY(cudaMemcpyAsync(_host_row_offsets.data(),
+                             _row_offsets.data().get(),
+                             (num_rows + 1) * sizeof(uint32_t),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    size_type const num_values = _host_row_offsets[num_rows];
+
+    rmm::device_vector<size_type> element_map(num_values);
+    _rep_values.resize(num_values);
+    _def_values.resize(num_values);
+    if (num_rows > 0) {
+      list_levels<<<num_blocks, 256, 0, stream>>>(_rep_values.data().get(),
+                                                  _def_values.data().get(),
+                                                  element_map.data().get(),
+                                                  _row_offsets.data().get(),
+                                                  offsets,
+                                                  lists.null_mask(),
+                                                  lists.offset(),
+                                                  child.null_mask(),
+                                                  child.offset(),
+                                                  child.size(),
+                                                  list_def,
+                                                  max_def,
+                                                  num_rows);
+    }
+    column_view const map_view{data_type{type_id::INT32}, num_values, element_map.data().get()};
+    auto leaf = cudf::detail::gather(table_view{{child}},
+                                     map_view,
+                                     cudf::detail::out_of_bounds_policy::NULLIFY,
+                                     cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                     rmm::mr::get_default_resource(),
+                                     stream)
+                  ->release();
+    _leaf = std::move(leaf[0]);
+    set_leaf(_leaf->view(), stream);
+    _level_bits = (1 << 4) | ((max_def > 1) ? 2 : 1);
+  }
+
+  auto is_list() const noexcept { return _list_type; }
+  bool list_nullable() const noexcept { return _list_nullable; }
+  bool element_nullable() const noexcept { return _element_nullable; }
+  uint8_t level_bits() const noexcept { return _level_bits; }
+  uint32_t const *row_offsets() const noexcept
+  {
+    return _list_type ? _row_offsets.data().get() : nullptr;
+  }
+  std::vector<uint32_t> const &host_row_offsets() const noexcept { return _host_row_offsets; }
+  uint8_t const *rep_values() const noexcept
+  {
+    return _list_type ? _rep_values.data().get() : nullptr;
+  }
+  uint8_t const *def_values() const noexcept
+  {
+    return _list_type ? _def_values.data().get() : nullptr;
+  }
+
   auto is_string() const noexcept { return _string_type; }
   size_t type_width() const noexcept { return _type_width; }
   size_t data_count() const noexcept { return _data_count; }
@@ -258,8 +683,31 @@ class parquet_column_view {
   }
 
  private:
+  /**
+   * @brief Sets the values to encode, converting strings to position + length pairs
+   **/
+  void set_leaf(column_view const &leaf, cudaStream_t stream)
+  {
+    _data_count = leaf.size();
+    _data       = leaf.head<uint8_t>() + leaf.offset() * _type_width;
+    _nulls      = leaf.nullable() ? leaf.null_mask() : nullptr;
+    if (_string_type && _data_count > 0) {
+      strings_column_view view{leaf};
+      _indexes = rmm::device_buffer(_data_count * sizeof(gpu::nvstrdesc_s), stream);
+      stringdata_to_nvstrdesc<<<((_data_count - 1) >> 8) + 1, 256, 0, stream>>>(
+        reinterpret_cast<gpu::nvstrdesc_s *>(_indexes.data()),
+        view.offsets().data<size_type>(),
+        view.chars().data<char>(),
+        _nulls,
+        _data_count);
+      _data = _indexes.data();
+      CUDA_TRY(cudaStreamSynchronize(stream));
+    }
+  }
+
   // Identifier within set of columns
   size_t _id        = 0;
+  column_view _column;
   bool _string_type = false;
 
   size_t _type_width     = 0;
@@ -282,6 +730,17 @@ class parquet_column_view {
 
   // String-related members
   rmm::device_buffer _indexes;
+
+  // List-related members
+  bool _list_type        = false;
+  bool _list_nullable    = false;
+  bool _element_nullable = false;
+  uint8_t _level_bits    = 0;
+  rmm::device_vector<uint32_t> _row_offsets;
+  std::vector<uint32_t> _host_row_offsets;
+  rmm::device_vector<uint8_t> _rep_values;
+  rmm::device_vector<uint8_t> _def_values;
+  std::unique_ptr<column> _leaf;
 };
 
 void writer::impl::init_page_fragments(hostdevice_vector<gpu::PageFragment> &frag,
@@ -290,6 +749,7 @@ void writer::impl::init_page_fragments(hostdevice_vector<gpu::PageFragment> &fra
                                        uint32_t num_fragments,
                                        uint32_t num_rows,
                                        uint32_t fragment_size,
+                                       const uint32_t *fragment_starts,
                                        cudaStream_t stream)
 {
   CUDA_TRY(cudaMemcpyAsync(col_desc.device_ptr(),
@@ -303,6 +763,7 @@ void writer::impl::init_page_fragments(hostdevice_vector<gpu::PageFragment> &fra
                                   num_columns,
                                   fragment_size,
                                   num_rows,
+                                  fragment_starts,
                                   stream));
   CUDA_TRY(cudaMemcpyAsync(
     frag.host_ptr(), frag.device_ptr(), frag.memory_size(), cudaMemcpyDeviceToHost, stream));
@@ -315,6 +776,7 @@ void writer::impl::gather_fragment_statistics(statistics_chunk *frag_stats_chunk
                                               uint32_t num_columns,
                                               uint32_t num_fragments,
                                               uint32_t fragment_size,
+                                              const uint32_t *fragment_starts,
                                               cudaStream_t stream)
 {
   rmm::device_vector<statistics_group> frag_stats_group(num_fragments * num_columns);
@@ -325,6 +787,7 @@ void writer::impl::gather_fragment_statistics(statistics_chunk *frag_stats_chunk
                                        num_fragments,
                                        num_columns,
                                        fragment_size,
+                                       fragment_starts,
                                        stream));
   CUDA_TRY(GatherColumnStatistics(
     frag_stats_chunk, frag_stats_group.data().get(), num_fragments * num_columns, stream));
@@ -352,6 +815,8 @@ void writer::impl::build_chunk_dictionaries(hostdevice_vector<gpu::EncColumnChun
                                  col_desc.device_ptr(),
                                  num_rowgroups,
                                  num_columns,
+                                 max_page_size_bytes_,
+                                 max_page_size_rows_,
                                  nullptr,
                                  nullptr,
                                  stream));
@@ -380,6 +845,8 @@ void writer::impl::init_encoder_pages(hostdevice_vector<gpu::EncColumnChunk> &ch
     col_desc.device_ptr(),
     num_rowgroups,
     num_columns,
+    max_page_size_bytes_,
+    max_page_size_rows_,
     (num_stats_bfr) ? page_stats_mrg.data().get() : nullptr,
     (num_stats_bfr > num_pages) ? page_stats_mrg.data().get() + num_pages : nullptr,
     stream));
@@ -416,6 +883,12 @@ void writer::impl::encode_pages(hostdevice_vector<gpu::EncColumnChunk> &chunks,
     case parquet::Compression::SNAPPY:
       CUDA_TRY(gpu_snap(comp_in, comp_out, pages_in_batch, stream));
       break;
+    case parquet::Compression::ZSTD:
+      CUDA_TRY(gpu_zstd(comp_in, comp_out, pages_in_batch, stream));
+      break;
+    case parquet::Compression::LZ4:
+      CUDA_TRY(gpu_lz4(comp_in, comp_out, pages_in_batch, 1, stream));
+      break;
     default: break;
   }
   // TBD: Not clear if the official spec actually allows dynamically turning off compression at the
@@ -433,6 +906,7 @@ void writer::impl::encode_pages(hostdevice_vector<gpu::EncColumnChunk> &chunks,
                              comp_out,
                              page_stats,
                              chunk_stats,
+                             stats_truncate_length_,
                              stream));
   CUDA_TRY(GatherPages(chunks.device_ptr() + first_rowgroup * num_columns,
                        pages,
@@ -449,11 +923,34 @@ void writer::impl::encode_pages(hostdevice_vector<gpu::EncColumnChunk> &chunks,
 writer::impl::impl(std::unique_ptr<data_sink> sink,
                    writer_options const &options,
                    rmm::mr::device_memory_resource *mr)
+  : impl(single_sink(std::move(sink)), options, mr)
+{
+}
+
+writer::impl::impl(std::vector<std::unique_ptr<data_sink>> sinks,
+                   writer_options const &options,
+                   rmm::mr::device_memory_resource *mr)
   : _mr(mr),
+    max_rowgroup_size_(options.row_group_size_bytes),
+    max_rowgroup_rows_(options.row_group_size_rows),
+    max_page_size_bytes_(options.max_page_size_bytes),
+    max_page_size_rows_(options.max_page_size_rows),
     compression_(to_parquet_compression(options.compression)),
     stats_granularity_(options.stats_granularity),
-    out_sink_(std::move(sink))
+    stats_truncate_length_(options.stats_truncate_length),
+    bloom_filter_columns_(options.bloom_filter_columns),
+    dictionary_policy_(options.dictionary),
+    column_dictionary_policy_(options.column_dictionary_policy),
+    delta_encoding_columns_(options.delta_encoding_columns),
+    out_sinks_(std::move(sinks))
 {
+  CUDF_EXPECTS(!out_sinks_.empty(), "At least one sink is required");
+  CUDF_EXPECTS(options.stats_truncate_length >= 0, "Negative statistics truncation length");
+  CUDF_EXPECTS(options.row_group_size_bytes > 0 && options.row_group_size_rows > 0,
+               "Row group size limits must be positive");
+  CUDF_EXPECTS(options.max_page_size_bytes > 0 && options.max_page_size_rows > 0 &&
+                 options.max_page_size_bytes <= std::numeric_limits<uint32_t>::max(),
+               "Page size limits must be positive and below 4GB");
 }
 
 std::unique_ptr<std::vector<uint8_t>> writer::impl::write(table_view const &table,
@@ -469,13 +966,37 @@ std::unique_ptr<std::vector<uint8_t>> writer::impl::write(table_view const &tabl
   return write_chunked_end(state, return_filemetadata, metadata_out_file_path);
 }
 
+void writer::impl::write_partitioned(table_view const &table,
+                                     std::vector<size_type> const &partition_offsets,
+                                     const table_metadata *metadata,
+                                     cudaStream_t stream)
+{
+  CUDF_EXPECTS(partition_offsets.size() == out_sinks_.size() + 1,
+               "Mismatch between the number of partitions and of sinks");
+  CUDF_EXPECTS(partition_offsets.front() == 0 && partition_offsets.back() == table.num_rows(),
+               "Partitions must span the rows of the table");
+  CUDF_EXPECTS(std::is_sorted(partition_offsets.cbegin(), partition_offsets.cend()),
+               "Partition offsets must be in increasing order");
+
+  pq_chunked_state state{metadata, SingleWriteMode::YES, stream};
+  state.partition_offsets.assign(partition_offsets.cbegin(), partition_offsets.cend() - 1);
+
+  write_chunked_begin(state);
+  write_chunked(table, state);
+  write_chunked_end(state);
+}
+
 void writer::impl::write_chunked_begin(pq_chunked_state &state)
 {
+  auto const num_partitions = std::max<size_t>(state.partition_offsets.size(), 1);
+  CUDF_EXPECTS(num_partitions == out_sinks_.size(),
+               "Mismatch between the number of partitions and of sinks");
+
   // Write file header
   file_header_s fhdr;
   fhdr.magic = PARQUET_MAGIC;
-  out_sink_->host_write(&fhdr, sizeof(fhdr));
-  state.current_chunk_offset = sizeof(file_header_s);
+  for (auto &sink : out_sinks_) { sink->host_write(&fhdr, sizeof(fhdr)); }
+  state.current_chunk_offsets.assign(out_sinks_.size(), sizeof(file_header_s));
 }
 
 void writer::impl::write_chunked(table_view const &table, pq_chunked_state &state)
@@ -506,10 +1027,11 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
 
   // first call. setup metadata. num_rows will get incremented as write_chunked is
   // called multiple times.
-  if (state.md.version == 0) {
+  bool const first_chunk = (state.md.version == 0);
+  if (first_chunk) {
     state.md.version  = 1;
     state.md.num_rows = num_rows;
-    state.md.schema.resize(1 + num_columns);
+    state.md.schema.resize(1);
     state.md.schema[0].type            = UNDEFINED_TYPE;
     state.md.schema[0].repetition_type = NO_REPETITION_TYPE;
     state.md.schema[0].name            = "schema";
@@ -525,9 +1047,10 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
     }
     for (auto i = 0; i < num_columns; i++) {
       auto &col = parquet_columns[i];
+      SchemaElement column_schema;
       // Column metadata
-      state.md.schema[1 + i].type           = col.physical_type();
-      state.md.schema[1 + i].converted_type = col.converted_type();
+      column_schema.type           = col.physical_type();
+      column_schema.converted_type = col.converted_type();
       // because the repetition type is global (in the sense of, not per-rowgroup or per
       // write_chunked() call) we cannot know up front if the user is going to end up passing tables
       // with nulls/no nulls in the multiple write_chunked() case.  so we'll do some special
@@ -535,30 +1058,67 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
       //
       // if the user is explicitly saying "I am only calling this once", fall back to the original
       // behavior and assume the columns in this one table tell us everything we need to know.
+      bool const nullable = col.is_list() ? col.list_nullable() : col.nullable();
       if (state.single_write_mode) {
-        state.md.schema[1 + i].repetition_type =
-          (col.nullable() || col.data_count() < (size_t)num_rows) ? OPTIONAL : REQUIRED;
+        column_schema.repetition_type =
+          (nullable || col.data_count() < (size_t)num_rows) ? OPTIONAL : REQUIRED;
       }
       // otherwise, if the user is explicitly telling us global information about all the tables
       // that will ever get passed in
       else if (state.user_metadata_with_nullability.column_nullable.size() > 0) {
-        state.md.schema[1 + i].repetition_type =
+        column_schema.repetition_type =
           state.user_metadata_with_nullability.column_nullable[i] ? OPTIONAL : REQUIRED;
       }
       // otherwise assume the worst case.
       else {
-        state.md.schema[1 + i].repetition_type = OPTIONAL;
+        column_schema.repetition_type = OPTIONAL;
+      }
+      column_schema.name         = col.name();
+      column_schema.num_children = 0;  // Leaf node
+      if (col.is_list()) {
+        // Three-level list encoding: <optional|required> group <name> (LIST) {
+        //   repeated group list { <optional|required> <element-type> element; } }
+        SchemaElement list_schema;
+        list_schema.type            = UNDEFINED_TYPE;
+        list_schema.converted_type  = ConvertedType::LIST;
+        list_schema.repetition_type = column_schema.repetition_type;
+        list_schema.name            = col.name();
+        list_schema.num_children    = 1;
+        state.md.schema.push_back(list_schema);
+
+        SchemaElement repeated_schema;
+        repeated_schema.type            = UNDEFINED_TYPE;
+        repeated_schema.converted_type  = ConvertedType::UNKNOWN;
+        repeated_schema.repetition_type = REPEATED;
+        repeated_schema.name            = "list";
+        repeated_schema.num_children    = 1;
+        state.md.schema.push_back(repeated_schema);
+
+        column_schema.repetition_type =
+          (state.single_write_mode && !col.element_nullable()) ? REQUIRED : OPTIONAL;
+        column_schema.name = "element";
       }
-      state.md.schema[1 + i].name         = col.name();
-      state.md.schema[1 + i].num_children = 0;  // Leaf node
+      state.md.schema.push_back(column_schema);
     }
   } else {
     // verify the user isn't passing mismatched tables
     CUDF_EXPECTS(state.md.schema[0].num_children == num_columns,
                  "Mismatch in table structure between multiple calls to write_chunked");
+  }
+
+  // Schema element of the values of each column
+  std::vector<size_t> leaf_schema(num_columns);
+  for (size_t i = 0, idx = 1; i < leaf_schema.size(); i++) {
+    bool const is_list = (state.md.schema[idx].converted_type == ConvertedType::LIST);
+    leaf_schema[i]     = is_list ? idx + 2 : idx;
+    idx                = leaf_schema[i] + 1;
+  }
+  if (!first_chunk) {
     for (auto i = 0; i < num_columns; i++) {
       auto &col = parquet_columns[i];
-      CUDF_EXPECTS(state.md.schema[1 + i].type == col.physical_type(),
+      CUDF_EXPECTS(state.md.schema[leaf_schema[i]].type == col.physical_type() &&
+                     (state.md.schema[leaf_schema[i] - 1].repetition_type == REPEATED) ==
+                       col.is_list(),
                    "Mismatch in column types between multiple calls to write_chunked");
     }
 
@@ -566,6 +1126,56 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
     state.md.num_rows += num_rows;
   }
 
+  // List levels depend on the schema, which is fixed by the first call
+  for (auto i = 0; i < num_columns; i++) {
+    auto &col = parquet_columns[i];
+    if (col.is_list()) {
+      col.build_levels(state.md.schema[leaf_schema[i] - 2].repetition_type == OPTIONAL,
+                       state.md.schema[leaf_schema[i]].repetition_type == OPTIONAL,
+                       state.stream);
+    }
+  }
+
+  // Columns that get a Bloom filter in each row group
+  std::vector<bool> bloom_filter_enabled(num_columns, false);
+  for (auto const &name : bloom_filter_columns_) {
+    auto const it =
+      std::find_if(parquet_columns.cbegin(),
+                   parquet_columns.cend(),
+                   [&](parquet_column_view const &col) { return col.name() == name; });
+    CUDF_EXPECTS(it != parquet_columns.cend(), "Bloom filter column not found: " + name);
+    // Boolean columns have at most two values; min/max statistics already cover them
+    if (it->physical_type() != BOOLEAN) {
+      bloom_filter_enabled[std::distance(parquet_columns.cbegin(), it)] = true;
+    }
+  }
+
+  // Integer columns whose pages without a dictionary are DELTA_BINARY_PACKED
+  std::vector<bool> delta_enabled(num_columns, false);
+  for (auto const &name : delta_encoding_columns_) {
+    auto const it =
+      std::find_if(parquet_columns.cbegin(),
+                   parquet_columns.cend(),
+                   [&](parquet_column_view const &col) { return col.name() == name; });
+    CUDF_EXPECTS(it != parquet_columns.cend(), "Delta encoding column not found: " + name);
+    CUDF_EXPECTS(it->physical_type() == INT32 || it->physical_type() == INT64,
+                 "Delta encoding requires an integer or timestamp column: " + name);
+    delta_enabled[std::distance(parquet_columns.cbegin(), it)] = true;
+  }
+
+  // Dictionary encoding policy of each column
+  std::vector<dictionary_policy> dict_policy(num_columns, dictionary_policy_);
+  for (auto const &column_policy : column_dictionary_policy_) {
+    auto const it = std::find_if(
+      parquet_columns.cbegin(), parquet_columns.cend(), [&](parquet_column_view const &col) {
+        return col.name() == column_policy.first;
+      });
+    CUDF_EXPECTS(it != parquet_columns.cend(),
+                 "Dictionary policy column not found: " + column_policy.first);
+    dict_policy[std::distance(parquet_columns.cbegin(), it)] = column_policy.second;
+  }
+  state.high_cardinality_columns.resize(num_columns, false);
+
   // Initialize column description
   hostdevice_vector<gpu::EncColumnDesc> col_desc(num_columns);
 
@@ -579,63 +1189,152 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
     desc->valid_map_base   = col.nulls();
     desc->stats_dtype      = col.stats_type();
     desc->ts_scale         = col.ts_scale();
-    if (state.md.schema[1 + i].type != BOOLEAN && state.md.schema[1 + i].type != UNDEFINED_TYPE) {
-      col.alloc_dictionary(num_rows);
+    // Columns without a dictionary also skip the distinct value analysis of the page fragments
+    bool const dict_allowed =
+      dict_policy[i] == dictionary_policy::ALWAYS ||
+      (dict_policy[i] == dictionary_policy::ADAPTIVE && !state.high_cardinality_columns[i]);
+    auto const &schema = state.md.schema[leaf_schema[i]];
+    if (schema.type != BOOLEAN && schema.type != UNDEFINED_TYPE && dict_allowed) {
+      col.alloc_dictionary(col.data_count());
       desc->dict_index = col.get_dict_index();
       desc->dict_data  = col.get_dict_data();
     } else {
       desc->dict_data  = nullptr;
       desc->dict_index = nullptr;
     }
+    desc->row_offsets    = col.row_offsets();
+    desc->rep_values     = col.rep_values();
+    desc->def_values     = col.def_values();
     desc->num_rows       = col.data_count();
-    desc->physical_type  = static_cast<uint8_t>(state.md.schema[1 + i].type);
-    desc->converted_type = static_cast<uint8_t>(state.md.schema[1 + i].converted_type);
-    desc->level_bits     = (state.md.schema[1 + i].repetition_type == OPTIONAL) ? 1 : 0;
+    desc->physical_type  = static_cast<uint8_t>(schema.type);
+    desc->converted_type = static_cast<uint8_t>(schema.converted_type);
+    desc->delta_encoding = delta_enabled[i];
+    if (col.is_list()) {
+      desc->level_bits = col.level_bits();
+    } else {
+      desc->level_bits = (schema.repetition_type == OPTIONAL) ? 1 : 0;
+    }
   }
 
-  // Init page fragments
-  // 5000 is good enough for up to ~200-character strings. Longer strings will start producing
-  // fragments larger than the desired page size -> TODO: keep track of the max fragment size, and
-  // iteratively reduce this value if the largest fragment exceeds the max page size limit (we
-  // ideally want the page size to be below 1MB so as to have enough pages to get good
-  // compression/decompression performance).
-  uint32_t fragment_size = 5000;
-  uint32_t num_fragments = (uint32_t)((num_rows + fragment_size - 1) / fragment_size);
-  hostdevice_vector<gpu::PageFragment> fragments(num_columns * num_fragments);
-  if (fragments.size() != 0) {
-    init_page_fragments(
-      fragments, col_desc, num_columns, num_fragments, num_rows, fragment_size, state.stream);
+  // Init page fragments. Pages hold whole fragments, so a fragment has at most as many rows as a
+  // page, and fragments of wide rows are shrunk until each of them fits in a page.
+  uint32_t fragment_size = std::min<size_t>(MAX_PAGE_FRAGMENT_SIZE, max_page_size_rows_);
+  auto const partition_offsets =
+    state.partition_offsets.empty() ? std::vector<size_type>{0} : state.partition_offsets;
+  // The fragments of list columns hold the values of their rows, so lists may need smaller ones
+  for (auto const &col : parquet_columns) {
+    if (col.is_list()) {
+      fragment_size = list_fragment_size(col.host_row_offsets(), partition_offsets, fragment_size);
+    }
   }
+  // The fragment dictionaries hold up to MAX_PAGE_FRAGMENT_SIZE values, so the lists with more
+  // values in a row are written without a dictionary
+  for (auto i = 0; i < num_columns; i++) {
+    auto const &col = parquet_columns[i];
+    if (col.is_list() && col_desc[i].dict_index != nullptr &&
+        max_fragment_values(col.host_row_offsets(), partition_offsets, fragment_size) >
+          MAX_PAGE_FRAGMENT_SIZE) {
+      col_desc[i].dict_index = nullptr;
+      col_desc[i].dict_data  = nullptr;
+    }
+  }
+  // Fragments, and therefore row groups, do not straddle partitions; the fragments of all the
+  // partitions are processed together, and only need their first rows when there are several
+  std::vector<uint32_t> frag_starts;
+  std::vector<size_t> frag_partition;
+  rmm::device_vector<uint32_t> d_frag_starts;
+  std::unique_ptr<hostdevice_vector<gpu::PageFragment>> frag_bfr;
+  uint32_t num_fragments = 0;
+  for (;;) {
+    frag_starts   = fragment_starts(partition_offsets, num_rows, fragment_size);
+    num_fragments = frag_starts.size() - 1;
+    frag_partition.resize(num_fragments);
+    for (uint32_t f = 0; f < num_fragments; f++) {
+      frag_partition[f] = std::upper_bound(partition_offsets.cbegin(),
+                                           partition_offsets.cend(),
+                                           static_cast<size_type>(frag_starts[f])) -
+                          partition_offsets.cbegin() - 1;
+    }
+    if (partition_offsets.size() > 1) { d_frag_starts = frag_starts; }
+    frag_bfr = std::make_unique<hostdevice_vector<gpu::PageFragment>>(num_columns * num_fragments);
+    if (frag_bfr->size() != 0) {
+      init_page_fragments(*frag_bfr,
+                          col_desc,
+                          num_columns,
+                          num_fragments,
+                          num_rows,
+                          fragment_size,
+                          d_frag_starts.empty() ? nullptr : d_frag_starts.data().get(),
+                          state.stream);
+    }
+    size_t max_fragment_data_size = 0;
+    for (size_t i = 0; i < frag_bfr->size(); i++) {
+      max_fragment_data_size =
+        std::max<size_t>(max_fragment_data_size, (*frag_bfr)[i].fragment_data_size);
+    }
+    if (max_fragment_data_size <= max_page_size_bytes_ || fragment_size == 1) { break; }
+    fragment_size = static_cast<uint32_t>(std::max<size_t>(
+      1, fragment_size * max_page_size_bytes_ / max_fragment_data_size));
+  }
+  auto &fragments             = *frag_bfr;
+  auto const *frag_starts_ptr = d_frag_starts.empty() ? nullptr : d_frag_starts.data().get();
 
   size_t global_rowgroup_base = state.md.row_groups.size();
 
   // Decide row group boundaries based on uncompressed data size
-  size_t rowgroup_size   = 0;
   uint32_t num_rowgroups = 0;
-  for (uint32_t f = 0, global_r = global_rowgroup_base, rowgroup_start = 0; f < num_fragments;
-       f++) {
-    size_t fragment_data_size = 0;
+  std::vector<uint32_t> rowgroup_fragments;
+  auto add_rowgroup = [&](uint32_t first_fragment, uint32_t end_fragment) {
+    // update schema
+    state.md.row_groups.resize(state.md.row_groups.size() + 1);
+    state.md.row_groups.back().num_rows = frag_starts[end_fragment] - frag_starts[first_fragment];
+    state.rowgroup_partitions.push_back(frag_partition[first_fragment]);
+    rowgroup_fragments.push_back(end_fragment - first_fragment);
+    num_rowgroups++;
+  };
+  std::vector<size_t> frag_data_sizes(num_fragments, 0);
+  for (uint32_t f = 0; f < num_fragments; f++) {
     for (auto i = 0; i < num_columns; i++) {
-      fragment_data_size += fragments[i * num_fragments + f].fragment_data_size;
-    }
-    if (f > rowgroup_start && (rowgroup_size + fragment_data_size > max_rowgroup_size_ ||
-                               (f + 1 - rowgroup_start) * fragment_size > max_rowgroup_rows_)) {
-      // update schema
-      state.md.row_groups.resize(state.md.row_groups.size() + 1);
-      state.md.row_groups[global_r++].num_rows = (f - rowgroup_start) * fragment_size;
-      num_rowgroups++;
-      rowgroup_start = f;
-      rowgroup_size  = 0;
+      frag_data_sizes[f] += fragments[i * num_fragments + f].fragment_data_size;
     }
-    rowgroup_size += fragment_data_size;
-    if (f + 1 == num_fragments) {
-      // update schema
-      state.md.row_groups.resize(state.md.row_groups.size() + 1);
-      state.md.row_groups[global_r++].num_rows = num_rows - rowgroup_start * fragment_size;
-      num_rowgroups++;
+  }
+  for (uint32_t first = 0, end = 0; first < num_fragments; first = end) {
+    while (end < num_fragments && frag_partition[end] == frag_partition[first]) { end++; }
+    // The partition is split in the fewest row groups within the limits, whose boundaries are the
+    // fragments closest to the even splits of its size and rows, so that the last row group is
+    // not a small remainder
+    size_t const part_size = std::accumulate(
+      frag_data_sizes.begin() + first, frag_data_sizes.begin() + end, size_t{0});
+    size_t const part_rows = frag_starts[end] - frag_starts[first];
+    size_t const num_parts = std::max({size_t{1},
+                                       (part_size + max_rowgroup_size_ - 1) / max_rowgroup_size_,
+                                       (part_rows + max_rowgroup_rows_ - 1) / max_rowgroup_rows_});
+    auto const even_split  = [&](size_t size_before, size_t rows_before) {
+      return std::max((part_size != 0) ? size_before * num_parts / part_size : 0,
+                      rows_before * num_parts / part_rows);
+    };
+    size_t size_before = 0, rowgroup_size = 0, rowgroup_split = 0;
+    for (uint32_t f = first, rowgroup_start = first; f < end; f++) {
+      size_t const split = even_split(size_before, frag_starts[f] - frag_starts[first]);
+      if (f > rowgroup_start &&
+          (split != rowgroup_split || rowgroup_size + frag_data_sizes[f] > max_rowgroup_size_ ||
+           frag_starts[f + 1] - frag_starts[rowgroup_start] > max_rowgroup_rows_)) {
+        add_rowgroup(rowgroup_start, f);
+        rowgroup_start = f;
+        rowgroup_size  = 0;
+      }
+      if (f == rowgroup_start) { rowgroup_split = split; }
+      rowgroup_size += frag_data_sizes[f];
+      size_before += frag_data_sizes[f];
+      if (f + 1 == end) { add_rowgroup(rowgroup_start, end); }
     }
   }
 
+  state.offset_indexes.resize(state.md.row_groups.size(), std::vector<OffsetIndex>(num_columns));
+  state.column_indexes.resize(state.md.row_groups.size(), std::vector<ColumnIndex>(num_columns));
+  state.bloom_filters.resize(state.md.row_groups.size(),
+                             std::vector<std::vector<uint8_t>>(num_columns));
+
   // Allocate column chunks and gather fragment statistics
   rmm::device_vector<statistics_chunk> frag_stats;
   if (stats_granularity_ != statistics_freq::STATISTICS_NONE) {
@@ -647,6 +1346,7 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
                                  num_columns,
                                  num_fragments,
                                  fragment_size,
+                                 frag_starts_ptr,
                                  state.stream);
     }
   }
@@ -655,10 +1355,10 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
   uint32_t num_chunks = num_rowgroups * num_columns;
   hostdevice_vector<gpu::EncColumnChunk> chunks(num_chunks);
   uint32_t num_dictionaries = 0;
+  std::vector<uint32_t> high_cardinality_chunks(num_columns, 0);
   for (uint32_t r = 0, global_r = global_rowgroup_base, f = 0, start_row = 0; r < num_rowgroups;
        r++, global_r++) {
-    uint32_t fragments_in_chunk =
-      (uint32_t)((state.md.row_groups[global_r].num_rows + fragment_size - 1) / fragment_size);
+    uint32_t fragments_in_chunk                   = rowgroup_fragments[r];
     state.md.row_groups[global_r].total_byte_size = 0;
     state.md.row_groups[global_r].columns.resize(num_columns);
     for (int i = 0; i < num_columns; i++) {
@@ -673,42 +1373,70 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
       ck->fragments        = fragments.device_ptr() + i * num_fragments + f;
       ck->stats =
         (frag_stats.size() != 0) ? frag_stats.data().get() + i * num_fragments + f : nullptr;
-      ck->start_row      = start_row;
-      ck->num_rows       = (uint32_t)state.md.row_groups[global_r].num_rows;
-      ck->first_fragment = i * num_fragments + f;
-      ck->first_page     = 0;
-      ck->num_pages      = 0;
-      ck->is_compressed  = 0;
-      ck->dictionary_id  = num_dictionaries;
-      ck->ck_stat_size   = 0;
+      ck->start_row           = start_row;
+      ck->num_rows            = (uint32_t)state.md.row_groups[global_r].num_rows;
+      ck->first_fragment      = i * num_fragments + f;
+      ck->first_page          = 0;
+      ck->num_pages           = 0;
+      ck->is_compressed       = 0;
+      ck->dictionary_id       = num_dictionaries;
+      ck->ck_stat_size        = 0;
+      ck->bloom_filter        = nullptr;
+      ck->bloom_filter_blocks = 0;
+      if (parquet_columns[i].is_list()) {
+        // List chunks are delimited by leaf values rather than rows
+        auto const &row_offsets = parquet_columns[i].host_row_offsets();
+        ck->start_row           = row_offsets[start_row];
+        ck->num_rows            = row_offsets[start_row + ck->num_rows] - ck->start_row;
+      }
       if (col_desc[i].dict_data) {
         const gpu::PageFragment *ck_frag = &fragments[i * num_fragments + f];
         size_t plain_size                = 0;
         size_t dict_size                 = 1;
         uint32_t num_dict_vals           = 0;
+        uint32_t num_values              = 0;
         for (uint32_t j = 0; j < fragments_in_chunk && num_dict_vals < 65536; j++) {
           plain_size += ck_frag[j].fragment_data_size;
           dict_size +=
             ck_frag[j].dict_data_size + ((num_dict_vals > 256) ? 2 : 1) * ck_frag[j].non_nulls;
           num_dict_vals += ck_frag[j].num_dict_vals;
+          num_values += ck_frag[j].non_nulls;
         }
-        if (dict_size < plain_size) {
+        // Distinct values are counted per fragment, so the ratio overestimates the cardinality
+        // of the chunk; a high ratio means the dictionary would barely deduplicate anything
+        bool const high_cardinality =
+          num_values >= MIN_DICTIONARY_SAMPLE &&
+          num_dict_vals > MAX_DICTIONARY_RATIO * static_cast<double>(num_values);
+        if (high_cardinality) { high_cardinality_chunks[i]++; }
+        bool const use_dict =
+          (dict_policy[i] == dictionary_policy::ALWAYS)
+            ? num_dict_vals != 0
+            : (dict_size < plain_size && !high_cardinality);
+        if (use_dict) {
           parquet_columns[i].use_dictionary(true);
           dict_enable = true;
           num_dictionaries++;
         }
       }
-      ck->has_dictionary                                           = dict_enable;
-      state.md.row_groups[global_r].columns[i].meta_data.type      = state.md.schema[1 + i].type;
+      ck->has_dictionary = dict_enable;
+      state.md.row_groups[global_r].columns[i].meta_data.type =
+        state.md.schema[leaf_schema[i]].type;
       state.md.row_groups[global_r].columns[i].meta_data.encodings = {PLAIN, RLE};
       if (dict_enable) {
         state.md.row_groups[global_r].columns[i].meta_data.encodings.push_back(PLAIN_DICTIONARY);
       }
-      state.md.row_groups[global_r].columns[i].meta_data.path_in_schema = {
-        state.md.schema[1 + i].name};
-      state.md.row_groups[global_r].columns[i].meta_data.codec = UNCOMPRESSED;
-      state.md.row_groups[global_r].columns[i].meta_data.num_values =
-        state.md.row_groups[global_r].num_rows;
+      if (delta_enabled[i]) {
+        state.md.row_groups[global_r].columns[i].meta_data.encodings.push_back(DELTA_BINARY_PACKED);
+      }
+      if (parquet_columns[i].is_list()) {
+        state.md.row_groups[global_r].columns[i].meta_data.path_in_schema = {
+          parquet_columns[i].name(), "list", "element"};
+      } else {
+        state.md.row_groups[global_r].columns[i].meta_data.path_in_schema = {
+          parquet_columns[i].name()};
+      }
+      state.md.row_groups[global_r].columns[i].meta_data.codec      = UNCOMPRESSED;
+      state.md.row_groups[global_r].columns[i].meta_data.num_values = ck->num_rows;
     }
     f += fragments_in_chunk;
     start_row += (uint32_t)state.md.row_groups[global_r].num_rows;
@@ -717,12 +1445,44 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
   // Free unused dictionaries
   for (auto &col : parquet_columns) { col.check_dictionary_used(); }
 
+  // Stop analyzing the columns whose every row group had too many distinct values
+  for (auto i = 0; i < num_columns; i++) {
+    if (dict_policy[i] == dictionary_policy::ADAPTIVE && num_rowgroups != 0 &&
+        high_cardinality_chunks[i] == num_rowgroups) {
+      state.high_cardinality_columns[i] = true;
+    }
+  }
+
   // Build chunk dictionaries and count pages
   if (num_chunks != 0) {
     build_chunk_dictionaries(
       chunks, col_desc, num_rowgroups, num_columns, num_dictionaries, state.stream);
   }
 
+  // Size the Bloom filters from the number of distinct values when the chunk has a dictionary,
+  // otherwise from the number of rows
+  size_t bloom_bfr_size = 0;
+  for (uint32_t ck_idx = 0; ck_idx < num_chunks; ck_idx++) {
+    gpu::EncColumnChunk *ck = &chunks[ck_idx];
+    if (bloom_filter_enabled[ck_idx % num_columns]) {
+      ck->bloom_filter_blocks =
+        bloom_filter_num_blocks(ck->has_dictionary ? ck->total_dict_entries : ck->num_rows);
+      bloom_bfr_size += ck->bloom_filter_blocks * kBloomFilterBlockBytes;
+    }
+  }
+  rmm::device_buffer bloom_bfr(bloom_bfr_size, state.stream);
+  if (bloom_bfr_size != 0) {
+    CUDA_TRY(cudaMemsetAsync(bloom_bfr.data(), 0, bloom_bfr_size, state.stream));
+    auto *bloom_data = reinterpret_cast<uint32_t *>(bloom_bfr.data());
+    for (uint32_t ck_idx = 0; ck_idx < num_chunks; ck_idx++) {
+      gpu::EncColumnChunk *ck = &chunks[ck_idx];
+      if (ck->bloom_filter_blocks != 0) {
+        ck->bloom_filter = bloom_data;
+        bloom_data += ck->bloom_filter_blocks * kBloomFilterBlockWords;
+      }
+    }
+  }
+
   // Initialize batches of rowgroups to encode (mainly to limit peak memory usage)
   std::vector<uint32_t> batch_list;
   uint32_t num_pages          = 0;
@@ -802,9 +1562,32 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
                        state.stream);
   }
 
+  // Hash the values of each chunk into its Bloom filter; the filters are written at the end
+  if (bloom_bfr_size != 0) {
+    CUDA_TRY(gpu::BuildBloomFilters(chunks.device_ptr(), num_chunks, state.stream));
+    std::vector<uint8_t> h_bloom_bfr(bloom_bfr_size);
+    CUDA_TRY(cudaMemcpyAsync(h_bloom_bfr.data(),
+                             bloom_bfr.data(),
+                             bloom_bfr_size,
+                             cudaMemcpyDeviceToHost,
+                             state.stream));
+    CUDA_TRY(cudaStreamSynchronize(state.stream));
+    auto const *bloom_data = h_bloom_bfr.data();
+    for (uint32_t r = 0; r < num_rowgroups; r++) {
+      for (int i = 0; i < num_columns; i++) {
+        auto const num_bytes =
+          chunks[r * num_columns + i].bloom_filter_blocks * kBloomFilterBlockBytes;
+        state.bloom_filters[global_rowgroup_base + r][i].assign(bloom_data, bloom_data + num_bytes);
+        bloom_data += num_bytes;
+      }
+    }
+  }
+
   auto host_bfr = [&]() {
-    // if the writer supports device_write(), we don't need this scratch space
-    if (out_sink_->supports_device_write()) {
+    // if the writers support device_write(), we don't need this scratch space
+    if (std::all_of(out_sinks_.cbegin(), out_sinks_.cend(), [](auto const &sink) {
+          return sink->supports_device_write();
+        })) {
       return pinned_buffer<uint8_t>{nullptr, cudaFreeHost};
     } else {
       return pinned_buffer<uint8_t>{[](size_t size) {
@@ -839,7 +1622,36 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
       (stats_granularity_ != statistics_freq::STATISTICS_NONE) ? page_stats.data().get() + num_pages
                                                                : nullptr,
       state.stream);
+
+    // Page sizes and statistics for the page indexes
+    std::vector<gpu::EncPage> h_pages(pages_in_batch);
+    std::vector<statistics_chunk> h_page_stats(
+      (stats_granularity_ == statistics_freq::STATISTICS_PAGE) ? pages_in_batch : 0);
+    CUDA_TRY(cudaMemcpyAsync(h_pages.data(),
+                             pages.data().get() + first_page_in_batch,
+                             pages_in_batch * sizeof(gpu::EncPage),
+                             cudaMemcpyDeviceToHost,
+                             state.stream));
+    if (!h_page_stats.empty()) {
+      CUDA_TRY(cudaMemcpyAsync(h_page_stats.data(),
+                               page_stats.data().get() + first_page_in_batch,
+                               pages_in_batch * sizeof(statistics_chunk),
+                               cudaMemcpyDeviceToHost,
+                               state.stream));
+    }
+    CUDA_TRY(cudaStreamSynchronize(state.stream));
+    std::vector<bool> is_string_page(h_page_stats.size());
+    for (size_t p = 0; p < h_page_stats.size(); p++) {
+      is_string_page[p] =
+        (col_desc[h_pages[p].chunk_id % num_columns].stats_dtype == dtype_string);
+    }
+    auto const h_string_bounds =
+      copy_string_page_bounds(h_page_stats, is_string_page, stats_truncate_length_, state.stream);
+
     for (; r < rnext; r++, global_r++) {
+      auto const partition = state.rowgroup_partitions[global_r];
+      auto &out_sink       = out_sinks_[partition];
+      auto &chunk_offset   = state.current_chunk_offsets[partition];
       for (auto i = 0; i < num_columns; i++) {
         gpu::EncColumnChunk *ck = &chunks[r * num_columns + i];
         uint8_t *dev_bfr;
@@ -850,9 +1662,9 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
           dev_bfr = ck->uncompressed_bfr;
         }
 
-        if (out_sink_->supports_device_write()) {
+        if (out_sink->supports_device_write()) {
           // let the writer do what it wants to retrieve the data from the gpu.
-          out_sink_->device_write(dev_bfr + ck->ck_stat_size, ck->compressed_size, state.stream);
+          out_sink->device_write(dev_bfr + ck->ck_stat_size, ck->compressed_size, state.stream);
           // we still need to do a (much smaller) memcpy for the statistics.
           if (ck->ck_stat_size != 0) {
             state.md.row_groups[global_r].columns[i].meta_data.statistics_blob.resize(
@@ -873,7 +1685,7 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
                                    cudaMemcpyDeviceToHost,
                                    state.stream));
           CUDA_TRY(cudaStreamSynchronize(state.stream));
-          out_sink_->host_write(host_bfr.get() + ck->ck_stat_size, ck->compressed_size);
+          out_sink->host_write(host_bfr.get() + ck->ck_stat_size, ck->compressed_size);
           if (ck->ck_stat_size != 0) {
             state.md.row_groups[global_r].columns[i].meta_data.statistics_blob.resize(
               ck->ck_stat_size);
@@ -884,13 +1696,25 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
         }
         state.md.row_groups[global_r].total_byte_size += ck->compressed_size;
         state.md.row_groups[global_r].columns[i].meta_data.data_page_offset =
-          state.current_chunk_offset + ((ck->has_dictionary) ? ck->dictionary_size : 0);
+          chunk_offset + ((ck->has_dictionary) ? ck->dictionary_size : 0);
         state.md.row_groups[global_r].columns[i].meta_data.dictionary_page_offset =
-          (ck->has_dictionary) ? state.current_chunk_offset : 0;
+          (ck->has_dictionary) ? chunk_offset : 0;
         state.md.row_groups[global_r].columns[i].meta_data.total_uncompressed_size = ck->bfr_size;
         state.md.row_groups[global_r].columns[i].meta_data.total_compressed_size =
           ck->compressed_size;
-        state.current_chunk_offset += ck->compressed_size;
+        auto const ck_first_page = ck->first_page - first_page_in_batch;
+        build_page_indexes(*ck,
+                           h_pages.data() + ck_first_page,
+                           h_page_stats.empty() ? nullptr : h_page_stats.data() + ck_first_page,
+                           h_string_bounds.empty() ? nullptr
+                                                   : h_string_bounds.data() + ck_first_page,
+                           col_desc[i].stats_dtype,
+                           chunk_offset,
+                           parquet_columns[i].is_list() ? &parquet_columns[i].host_row_offsets()
+                                                        : nullptr,
+                           state.offset_indexes[global_r][i],
+                           state.column_indexes[global_r][i]);
+        chunk_offset += ck->compressed_size;
       }
     }
   }
@@ -901,12 +1725,75 @@ std::unique_ptr<std::vector<uint8_t>> writer::impl::write_chunked_end(
 {
   CompactProtocolWriter cpw(&buffer_);
   file_ender_s fendr;
-  buffer_.resize(0);
-  fendr.footer_len = static_cast<uint32_t>(cpw.write(&state.md));
-  fendr.magic      = PARQUET_MAGIC;
-  out_sink_->host_write(buffer_.data(), buffer_.size());
-  out_sink_->host_write(&fendr, sizeof(fendr));
-  out_sink_->flush();
+
+  // Each partition ends its file with its own row groups, which are contiguous
+  bool const partitioned = (out_sinks_.size() > 1);
+  std::vector<RowGroup> partitioned_row_groups;
+  if (partitioned) { std::swap(partitioned_row_groups, state.md.row_groups); }
+  auto &row_groups = partitioned ? partitioned_row_groups : state.md.row_groups;
+
+  for (size_t p = 0, first_r = 0; p < out_sinks_.size(); p++) {
+    size_t end_r = first_r;
+    while (end_r < row_groups.size() && state.rowgroup_partitions[end_r] == p) { end_r++; }
+    auto &out_sink     = out_sinks_[p];
+    auto &chunk_offset = state.current_chunk_offsets[p];
+
+    // Write the Bloom filters after the last row group, ahead of the page indexes
+    for (size_t r = first_r; r < end_r; r++) {
+      for (size_t i = 0; i < row_groups[r].columns.size(); i++) {
+        auto const &bitset = state.bloom_filters[r][i];
+        if (bitset.empty()) { continue; }
+        auto &column_chunk = row_groups[r].columns[i];
+        BloomFilterHeader header;
+        header.num_bytes = static_cast<int32_t>(bitset.size());
+        buffer_.resize(0);
+        cpw.write(&header);
+        buffer_.insert(buffer_.end(), bitset.cbegin(), bitset.cend());
+        column_chunk.meta_data.bloom_filter_offset = chunk_offset;
+        column_chunk.meta_data.bloom_filter_length = static_cast<int32_t>(buffer_.size());
+        out_sink->host_write(buffer_.data(), buffer_.size());
+        chunk_offset += buffer_.size();
+      }
+    }
+
+    // Write the page indexes after the last row group, all column indexes first
+    for (size_t r = first_r; r < end_r; r++) {
+      for (size_t i = 0; i < row_groups[r].columns.size(); i++) {
+        if (state.column_indexes[r][i].null_pages.empty()) { continue; }
+        auto &column_chunk = row_groups[r].columns[i];
+        buffer_.resize(0);
+        column_chunk.column_index_offset = chunk_offset;
+        column_chunk.column_index_length = cpw.write(&state.column_indexes[r][i]);
+        out_sink->host_write(buffer_.data(), buffer_.size());
+        chunk_offset += buffer_.size();
+      }
+    }
+    for (size_t r = first_r; r < end_r; r++) {
+      for (size_t i = 0; i < row_groups[r].columns.size(); i++) {
+        if (state.offset_indexes[r][i].page_locations.empty()) { continue; }
+        auto &column_chunk = row_groups[r].columns[i];
+        buffer_.resize(0);
+        column_chunk.offset_index_offset = chunk_offset;
+        column_chunk.offset_index_length = cpw.write(&state.offset_indexes[r][i]);
+        out_sink->host_write(buffer_.data(), buffer_.size());
+        chunk_offset += buffer_.size();
+      }
+    }
+
+    if (partitioned) {
+      state.md.row_groups.assign(std::make_move_iterator(row_groups.begin() + first_r),
+                                 std::make_move_iterator(row_groups.begin() + end_r));
+      state.md.num_rows = 0;
+      for (auto const &rowgroup : state.md.row_groups) { state.md.num_rows += rowgroup.num_rows; }
+    }
+    buffer_.resize(0);
+    fendr.footer_len = static_cast<uint32_t>(cpw.write(&state.md));
+    fendr.magic      = PARQUET_MAGIC;
+    out_sink->host_write(buffer_.data(), buffer_.size());
+    out_sink->host_write(&fendr, sizeof(fendr));
+    out_sink->flush();
+    first_r = end_r;
+  }
 
   // Optionally output raw file metadata with the specified column chunk file path
   if (return_filemetadata) {
@@ -936,6 +1823,13 @@ writer::writer(std::unique_ptr<data_sink> sink,
 {
 }
 
+writer::writer(std::vector<std::unique_ptr<data_sink>> sinks,
+               writer_options const &options,
+               rmm::mr::device_memory_resource *mr)
+  : _impl(std::make_unique<impl>(std::move(sinks), options, mr))
+{
+}
+
 // Destructor within this translation unit
 writer::~writer() = default;
 
@@ -949,6 +1843,15 @@ std::unique_ptr<std::vector<uint8_t>> writer::write_all(table_view const &table,
   return _impl->write(table, metadata, return_filemetadata, metadata_out_file_path, stream);
 }
 
+// Forward to implementation
+void writer::write_partitioned(table_view const &table,
+                               std::vector<size_type> const &partition_offsets,
+                               const table_metadata *metadata,
+                               cudaStream_t stream)
+{
+  _impl->write_partitioned(table, partition_offsets, metadata, stream);
+}
+
 // Forward to implementation
 void writer::write_chunked_begin(pq_chunked_state &state)
 {
@@ -32,6 +32,7 @@
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -52,12 +53,10 @@ using namespace cudf::io;
  * @brief Implementation for parquet writer
  **/
 class writer::impl {
-  // Parquet datasets are divided into fixed-size, independent rowgroups
-  static constexpr uint32_t DEFAULT_ROWGROUP_MAXSIZE = 128 * 1024 * 1024;  // 128MB
-  static constexpr uint32_t DEFAULT_ROWGROUP_MAXROWS = 1000000;            // Or at most 1M rows
-
-  // rowgroups are divided into pages
-  static constexpr uint32_t DEFAULT_TARGET_PAGE_SIZE = 512 * 1024;
+  // Adaptive dictionary encoding skips chunks with more distinct values per value than this,
+  // once at least MIN_DICTIONARY_SAMPLE values have been seen
+  static constexpr double MAX_DICTIONARY_RATIO    = 0.5;
+  static constexpr uint32_t MIN_DICTIONARY_SAMPLE = 1000;
 
  public:
   /**
@@ -71,6 +70,17 @@ class writer::impl {
                 writer_options const& options,
                 rmm::mr::device_memory_resource* mr);
 
+  /**
+   * @brief Constructor with one sink per partition, for `write_partitioned`.
+   *
+   * @param sinks Sinks of the files, one per partition
+   * @param options Settings for controlling behavior
+   * @param mr Device memory resource to use for device memory allocation
+   **/
+  explicit impl(std::vector<std::unique_ptr<data_sink>> sinks,
+                writer_options const& options,
+                rmm::mr::device_memory_resource* mr);
+
   /**
    * @brief Write an entire dataset to parquet format.
    *
@@ -87,6 +97,23 @@ class writer::impl {
                                               const std::string& metadata_out_file_path,
                                               cudaStream_t stream);
 
+  /**
+   * @brief Write the partitions of a table to parquet format, each to its own sink.
+   *
+   * The partitions are encoded together, so that each step of the encoding is a single launch
+   * over all of them, and row groups do not straddle partitions.
+   *
+   * @param table The set of columns
+   * @param partition_offsets Offsets of the partitions, as returned by `cudf::partition`: partition
+   * `i` holds the rows [`partition_offsets[i]`, `partition_offsets[i + 1]`)
+   * @param metadata The metadata associated with the table
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   **/
+  void write_partitioned(table_view const& table,
+                         std::vector<size_type> const& partition_offsets,
+                         const table_metadata* metadata,
+                         cudaStream_t stream);
+
   /**
    * @brief Begins the chunked/streamed write process.
    *
@@ -128,6 +155,8 @@ class writer::impl {
    * @param num_fragments Total number of fragments per column
    * @param num_rows Total number of rows
    * @param fragment_size Number of rows per fragment
+   * @param fragment_starts Device array of the first row of each fragment followed by the number
+   * of rows, or null for fragments of `fragment_size` rows
    * @param stream CUDA stream used for device memory operations and kernel launches.
    **/
   void init_page_fragments(hostdevice_vector<gpu::PageFragment>& frag,
@@ -136,6 +165,7 @@ class writer::impl {
                            uint32_t num_fragments,
                            uint32_t num_rows,
                            uint32_t fragment_size,
+                           const uint32_t* fragment_starts,
                            cudaStream_t stream);
   /**
    * @brief Gather per-fragment statistics
@@ -146,6 +176,8 @@ class writer::impl {
    * @param num_columns Total number of columns
    * @param num_fragments Total number of fragments per column
    * @param fragment_size Number of rows per fragment
+   * @param fragment_starts Device array of the first row of each fragment, or null for fragments
+   * of `fragment_size` rows
    * @param stream CUDA stream used for device memory operations and kernel launches.
    **/
   void gather_fragment_statistics(statistics_chunk* dst_stats,
@@ -154,6 +186,7 @@ class writer::impl {
                                   uint32_t num_columns,
                                   uint32_t num_fragments,
                                   uint32_t fragment_size,
+                                  const uint32_t* fragment_starts,
                                   cudaStream_t stream);
   /**
    * @brief Build per-chunk dictionaries and count data pages
@@ -226,14 +259,22 @@ class writer::impl {
   // TODO : figure out if we want to keep this. It is currently unused.
   rmm::mr::device_memory_resource* _mr = nullptr;
 
-  size_t max_rowgroup_size_          = DEFAULT_ROWGROUP_MAXSIZE;
-  size_t max_rowgroup_rows_          = DEFAULT_ROWGROUP_MAXROWS;
-  size_t target_page_size_           = DEFAULT_TARGET_PAGE_SIZE;
+  // Parquet datasets are divided into independent rowgroups, which are divided into pages
+  size_t max_rowgroup_size_          = 0;
+  size_t max_rowgroup_rows_          = 0;
+  size_t max_page_size_bytes_        = 0;
+  size_t max_page_size_rows_         = 0;
   Compression compression_           = Compression::UNCOMPRESSED;
   statistics_freq stats_granularity_ = statistics_freq::STATISTICS_NONE;
+  uint32_t stats_truncate_length_    = 0;
+  std::vector<std::string> bloom_filter_columns_;
+  dictionary_policy dictionary_policy_ = dictionary_policy::ADAPTIVE;
+  std::map<std::string, dictionary_policy> column_dictionary_policy_;
+  std::vector<std::string> delta_encoding_columns_;
 
   std::vector<uint8_t> buffer_;
-  std::unique_ptr<data_sink> out_sink_;
+  // One sink per partition; a single one unless writing partitions
+  std::vector<std::unique_ptr<data_sink>> out_sinks_;
 };
 
 }  // namespace parquet
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "predicate_filter.hpp"
+
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <algorithm>
+#include <type_traits>
+
+namespace cudf {
+namespace io {
+namespace {
+/**
+ * @brief Evaluates `op` on the range [min, max] against a literal
+ *
+ * @return `false` only if no value within [min, max] can satisfy the comparison
+ */
+template <typename T>
+bool range_may_satisfy(T const &min, T const &max, predicate_op op, T const &literal)
+{
+  switch (op) {
+    case predicate_op::EQUAL: return !(literal < min) && !(max < literal);
+    case predicate_op::NOT_EQUAL: return !(min == literal && max == literal);
+    case predicate_op::LESS: return min < literal;
+    case predicate_op::LESS_EQUAL: return !(literal < min);
+    case predicate_op::GREATER: return literal < max;
+    case predicate_op::GREATER_EQUAL: return !(max < literal);
+    default: return true;
+  }
+}
+
+
+/**
+ * @brief Creates the min or max of a column of type `T` from the statistics of its rows, or
+ * returns null if the statistics are not represented like the values of the column
+ */
+struct make_bound_fn {
+  template <typename T>
+  std::enable_if_t<std::is_integral<T>::value, std::shared_ptr<scalar const>> operator()(
+    minmax_statistics const &stats, bool is_max)
+  {
+    if (stats.kind != minmax_statistics::literal_kind::INTEGER) { return nullptr; }
+    return std::make_shared<numeric_scalar<T>>(
+      static_cast<T>(is_max ? stats.int_max : stats.int_min));
+  }
+
+  template <typename T>
+  std::enable_if_t<std::is_floating_point<T>::value, std::shared_ptr<scalar const>> operator()(
+    minmax_statistics const &stats, bool is_max)
+  {
+    if (stats.kind != minmax_statistics::literal_kind::FLOAT) { return nullptr; }
+    return std::make_shared<numeric_scalar<T>>(
+      static_cast<T>(is_max ? stats.float_max : stats.float_min));
+  }
+
+  template <typename T>
+  std::enable_if_t<std::is_same<T, string_view>::value, std::shared_ptr<scalar const>> operator()(
+    minmax_statistics const &stats, bool is_max)
+  {
+    if (stats.kind != minmax_statistics::literal_kind::STRING) { return nullptr; }
+    return std::make_shared<string_scalar>(is_max ? stats.string_max : stats.string_min);
+  }
+
+  template <typename T>
+  std::enable_if_t<not std::is_arithmetic<T>::value && not std::is_same<T, string_view>::value,
+                   std::shared_ptr<scalar const>>
+  operator()(minmax_statistics const &, bool)
+  {
+    return nullptr;
+  }
+};
+}  // namespace
+
+resolved_predicate_filter resolve_predicate_filter(predicate_filter const &filter,
+                                                   std::vector<std::string> const &column_names)
+{
+  resolved_predicate_filter resolved;
+  resolved.reserve(filter.size());
+  for (auto const &conjunction : filter) {
+    std::vector<resolved_predicate> preds;
+    preds.reserve(conjunction.size());
+    for (auto const &pred : conjunction) {
+      auto const it = std::find(column_names.cbegin(), column_names.cend(), pred.column_name);
+      CUDF_EXPECTS(it != column_names.cend(), "Filter column not found: " + pred.column_name);
+      preds.emplace_back(static_cast<int>(std::distance(column_names.cbegin(), it)), pred);
+    }
+    resolved.emplace_back(std::move(preds));
+  }
+  return resolved;
+}
+
+bool may_satisfy(minmax_statistics const &stats, column_predicate const &predicate)
+{
+  using literal_kind = column_predicate::literal_kind;
+
+  CUDF_EXPECTS((stats.kind == literal_kind::STRING) == (predicate.kind == literal_kind::STRING),
+               "Filter literal type does not match column type: " + predicate.column_name);
+
+  // No comparison against a null is true, so an all-null block never matches
+  if (stats.null_count >= 0 && stats.num_rows > 0 && stats.null_count >= stats.num_rows) {
+    return false;
+  }
+  if (not stats.has_minmax) { return true; }
+
+  switch (stats.kind) {
+    case literal_kind::STRING:
+      return range_may_satisfy(
+        stats.string_min, stats.string_max, predicate.op, predicate.string_value);
+    case literal_kind::FLOAT: {
+      auto const literal = (predicate.kind == literal_kind::FLOAT)
+                             ? predicate.float_value
+                             : static_cast<double>(predicate.int_value);
+      return range_may_satisfy(stats.float_min, stats.float_max, predicate.op, literal);
+    }
+    case literal_kind::INTEGER:
+    default:
+      if (predicate.kind == literal_kind::FLOAT) {
+        return range_may_satisfy(static_cast<double>(stats.int_min),
+                                 static_cast<double>(stats.int_max),
+                                 predicate.op,
+                                 predicate.float_value);
+      }
+      return range_may_satisfy(stats.int_min, stats.int_max, predicate.op, predicate.int_value);
+  }
+}
+
+minmax_statistics merge_statistics(minmax_statistics const &lhs, minmax_statistics const &rhs)
+{
+  minmax_statistics merged = lhs;
+  merged.num_rows          = lhs.num_rows + rhs.num_rows;
+  merged.null_count =
+    (lhs.null_count < 0 || rhs.null_count < 0) ? -1 : lhs.null_count + rhs.null_count;
+  merged.has_minmax = lhs.has_minmax && rhs.has_minmax;
+  if (merged.has_minmax) {
+    merged.int_min    = std::min(lhs.int_min, rhs.int_min);
+    merged.int_max    = std::max(lhs.int_max, rhs.int_max);
+    merged.float_min  = std::min(lhs.float_min, rhs.float_min);
+    merged.float_max  = std::max(lhs.float_max, rhs.float_max);
+    merged.string_min = std::min(lhs.string_min, rhs.string_min);
+    merged.string_max = std::max(lhs.string_max, rhs.string_max);
+  }
+  return merged;
+}
+
+column_statistics to_column_statistics(minmax_statistics const &stats, data_type type)
+{
+  column_statistics result;
+  if (not stats.has_minmax) { return result; }
+  result.min = type_dispatcher(type, make_bound_fn{}, stats, false);
+  result.max = type_dispatcher(type, make_bound_fn{}, stats, true);
+  return result;
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/io/types.hpp>
+
+#include <stdint.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace io {
+/**
+ * @brief Host-side min/max summary of one column within a block of rows (row group, stripe),
+ * decoded from the statistics stored in the file
+ */
+struct minmax_statistics {
+  using literal_kind = column_predicate::literal_kind;
+
+  literal_kind kind  = literal_kind::INTEGER;  //!< Representation of min/max
+  bool has_minmax    = false;                  //!< Whether the min/max members are valid
+  int64_t num_rows   = 0;                      //!< Number of rows in the block
+  int64_t null_count = -1;                     //!< Number of nulls; -1 if unknown
+  int64_t int_min    = 0;                      //!< Minimum for `literal_kind::INTEGER`
+  int64_t int_max    = 0;                      //!< Maximum for `literal_kind::INTEGER`
+  double float_min   = 0;                      //!< Minimum for `literal_kind::FLOAT`
+  double float_max   = 0;                      //!< Maximum for `literal_kind::FLOAT`
+  std::string string_min;                      //!< Minimum for `literal_kind::STRING`
+  std::string string_max;                      //!< Maximum for `literal_kind::STRING`
+};
+
+/**
+ * @brief Column-resolved form of a `predicate_filter`
+ *
+ * Each predicate is paired with the index of the column it refers to, so readers only need to
+ * resolve column names once per file.
+ */
+using resolved_predicate        = std::pair<int, column_predicate>;
+using resolved_predicate_filter = std::vector<std::vector<resolved_predicate>>;
+
+/**
+ * @brief Resolves the column names of a filter against a list of column names
+ *
+ * @throw cudf::logic_error if a predicate refers to a column that is not in the dataset
+ *
+ * @param filter Filter to resolve
+ * @param column_names Names of all columns in the dataset
+ *
+ * @return Filter with each predicate's column index
+ */
+resolved_predicate_filter resolve_predicate_filter(predicate_filter const &filter,
+                                                   std::vector<std::string> const &column_names);
+
+/**
+ * @brief Returns whether any row described by the statistics could satisfy the predicate
+ *
+ * Returns `true` whenever the statistics are insufficient to decide, so callers can only use a
+ * `false` result to skip data.
+ *
+ * @throw cudf::logic_error if the literal type cannot be compared against the column type
+ *
+ * @param stats Decoded statistics of the predicate's column
+ * @param predicate Predicate to evaluate
+ */
+bool may_satisfy(minmax_statistics const &stats, column_predicate const &predicate);
+
+/**
+ * @brief Merges the statistics of two blocks of rows into the statistics of all their rows
+ *
+ * The result has min/max only if both blocks have them, and a null count only if both blocks
+ * have one.
+ *
+ * @param lhs Statistics of the first block
+ * @param rhs Statistics of the second block, of the same kind
+ */
+minmax_statistics merge_statistics(minmax_statistics const &lhs, minmax_statistics const &rhs);
+
+/**
+ * @brief Converts the statistics of the rows read into a column to the statistics of the column
+ *
+ * Only min/max represented like the values of the column are converted: integer statistics for
+ * integer and boolean columns, floating-point statistics for floating-point columns and string
+ * statistics for string columns. Other columns, e.g. timestamps whose unit may differ from the
+ * one of the file, get no min/max.
+ *
+ * @param stats Statistics of the rows read
+ * @param type Type of the column
+ */
+column_statistics to_column_statistics(minmax_statistics const &stats, data_type type);
+
+/**
+ * @brief Returns whether any row of a block could satisfy the filter
+ *
+ * @param filter Filter with resolved columns
+ * @param get_stats Callable returning the `minmax_statistics` for a column index
+ * @param may_contain Callable taking a column index and an `EQUAL` predicate, returning `false`
+ * only if the block is known not to contain the literal (e.g. from a Bloom filter); it is only
+ * invoked for predicates that the statistics cannot rule out
+ */
+template <typename StatsFn, typename ContainsFn>
+bool may_satisfy(resolved_predicate_filter const &filter, StatsFn get_stats, ContainsFn may_contain)
+{
+  if (filter.empty()) { return true; }
+  for (auto const &conjunction : filter) {
+    bool match = true;
+    for (auto const &pred : conjunction) {
+      if (not may_satisfy(get_stats(pred.first), pred.second) ||
+          (pred.second.op == predicate_op::EQUAL && not may_contain(pred.first, pred.second))) {
+        match = false;
+        break;
+      }
+    }
+    if (match) { return true; }
+  }
+  return false;
+}
+
+/**
+ * @brief Returns whether any row of a block could satisfy the filter
+ *
+ * @param filter Filter with resolved columns
+ * @param get_stats Callable returning the `minmax_statistics` for a column index
+ */
+template <typename StatsFn>
+bool may_satisfy(resolved_predicate_filter const &filter, StatsFn get_stats)
+{
+  return may_satisfy(filter, get_stats, [](int, column_predicate const &) { return true; });
+}
+
+}  // namespace io
+}  // namespace cudf
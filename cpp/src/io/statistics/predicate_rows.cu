@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "predicate_rows.hpp"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace io {
+namespace {
+template <typename T>
+__device__ bool compare(T const &value, predicate_op op, T const &literal)
+{
+  switch (op) {
+    case predicate_op::EQUAL: return value == literal;
+    case predicate_op::NOT_EQUAL: return !(value == literal);
+    case predicate_op::LESS: return value < literal;
+    case predicate_op::LESS_EQUAL: return !(literal < value);
+    case predicate_op::GREATER: return literal < value;
+    case predicate_op::GREATER_EQUAL: return !(value < literal);
+    default: return false;
+  }
+}
+
+template <typename T, std::enable_if_t<is_timestamp<T>()>* = nullptr>
+__device__ auto as_number(T const &value)
+{
+  return value.time_since_epoch().count();
+}
+
+template <typename T, std::enable_if_t<!is_timestamp<T>()>* = nullptr>
+__device__ T as_number(T const &value)
+{
+  return value;
+}
+
+/**
+ * @brief Clears the rows of `matches` whose value of `column` does not satisfy `value op literal`
+ */
+template <typename T, typename Convert>
+void and_predicate(column_view const &column,
+                   predicate_op op,
+                   T literal,
+                   Convert convert,
+                   bool *matches,
+                   cudaStream_t stream)
+{
+  auto const d_column = column_device_view::create(column, stream);
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     column.size(),
+                     [col = *d_column, op, literal, convert, matches] __device__(size_type i) {
+                       if (!matches[i]) { return; }
+                       matches[i] = col.is_valid(i) && compare(convert(col, i), op, literal);
+                     });
+}
+
+struct predicate_dispatch {
+  using literal_kind = column_predicate::literal_kind;
+
+  template <typename T>
+  static constexpr bool is_integer_like()
+  {
+    return std::is_integral<T>::value || is_timestamp<T>();
+  }
+
+  template <typename T,
+            std::enable_if_t<is_integer_like<T>() || std::is_floating_point<T>::value>* = nullptr>
+  void operator()(column_view const &column,
+                  column_predicate const &predicate,
+                  bool *matches,
+                  cudaStream_t stream)
+  {
+    CUDF_EXPECTS(predicate.kind != literal_kind::STRING,
+                 "Filter literal type does not match column type: " + predicate.column_name);
+    if (is_integer_like<T>() && predicate.kind == literal_kind::INTEGER) {
+      and_predicate(
+        column,
+        predicate.op,
+        predicate.int_value,
+        [] __device__(column_device_view const &col, size_type i) {
+          return static_cast<int64_t>(as_number(col.element<T>(i)));
+        },
+        matches,
+        stream);
+    } else {
+      auto const literal = (predicate.kind == literal_kind::FLOAT)
+                             ? predicate.float_value
+                             : static_cast<double>(predicate.int_value);
+      and_predicate(
+        column,
+        predicate.op,
+        literal,
+        [] __device__(column_device_view const &col, size_type i) {
+          return static_cast<double>(as_number(col.element<T>(i)));
+        },
+        matches,
+        stream);
+    }
+  }
+
+  template <typename T, std::enable_if_t<std::is_same<T, string_view>::value>* = nullptr>
+  void operator()(column_view const &column,
+                  column_predicate const &predicate,
+                  bool *matches,
+                  cudaStream_t stream)
+  {
+    CUDF_EXPECTS(predicate.kind == literal_kind::STRING,
+                 "Filter literal type does not match column type: " + predicate.column_name);
+    rmm::device_vector<char> d_literal(predicate.string_value.cbegin(),
+                                       predicate.string_value.cend());
+    and_predicate(
+      column,
+      predicate.op,
+      string_view(d_literal.data().get(), static_cast<size_type>(d_literal.size())),
+      [] __device__(column_device_view const &col, size_type i) {
+        return col.element<string_view>(i);
+      },
+      matches,
+      stream);
+  }
+
+  template <typename T,
+            std::enable_if_t<!is_integer_like<T>() && !std::is_floating_point<T>::value &&
+                             !std::is_same<T, string_view>::value>* = nullptr>
+  void operator()(column_view const &, column_predicate const &predicate, bool *, cudaStream_t)
+  {
+    CUDF_FAIL("Unsupported filter column type: " + predicate.column_name);
+  }
+};
+
+}  // namespace
+
+rmm::device_vector<size_type> satisfying_rows(table_view const &table,
+                                              resolved_predicate_filter const &filter,
+                                              cudaStream_t stream)
+{
+  auto const num_rows = table.num_rows();
+  rmm::device_vector<bool> any_match(num_rows, filter.empty());
+  rmm::device_vector<bool> matches(num_rows);
+  for (auto const &conjunction : filter) {
+    thrust::fill(rmm::exec_policy(stream)->on(stream), matches.begin(), matches.end(), true);
+    for (auto const &pred : conjunction) {
+      auto const &column = table.column(pred.first);
+      type_dispatcher(
+        column.type(), predicate_dispatch{}, column, pred.second, matches.data().get(), stream);
+    }
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      any_match.begin(),
+                      any_match.end(),
+                      matches.begin(),
+                      any_match.begin(),
+                      thrust::logical_or<bool>());
+  }
+
+  rmm::device_vector<size_type> rows(num_rows);
+  auto const rows_end = thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                                        thrust::make_counting_iterator<size_type>(0),
+                                        thrust::make_counting_iterator<size_type>(num_rows),
+                                        any_match.begin(),
+                                        rows.begin(),
+                                        thrust::identity<bool>());
+  rows.resize(thrust::distance(rows.begin(), rows_end));
+  return rows;
+}
+
+}  // namespace io
+}  // namespace cudf
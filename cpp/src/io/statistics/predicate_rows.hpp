@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "predicate_filter.hpp"
+
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+namespace cudf {
+namespace io {
+/**
+ * @brief Returns the indices of the rows of a table that satisfy a filter, in increasing order
+ *
+ * Integer literals compare against the values of integer, boolean and timestamp columns (the
+ * latter in the unit of the column), and float literals against those of floating point
+ * columns; mixed comparisons are done in floating point. No comparison against a null is true.
+ *
+ * @throw cudf::logic_error if a literal cannot be compared against the type of its column
+ *
+ * @param table Columns referenced by the filter
+ * @param filter Filter whose predicates hold indices into `table`
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return Indices of the rows that satisfy `filter`
+ */
+rmm::device_vector<size_type> satisfying_rows(table_view const &table,
+                                              resolved_predicate_filter const &filter,
+                                              cudaStream_t stream = 0);
+
+}  // namespace io
+}  // namespace cudf
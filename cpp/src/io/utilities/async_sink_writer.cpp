@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "async_sink_writer.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <cassert>
+
+namespace cudf {
+namespace io {
+namespace detail {
+async_sink_writer::async_sink_writer(data_sink &sink, size_t buffer_size, int num_buffers)
+  : _sink(sink),
+    _buffer_size(buffer_size),
+    _slots(std::max(num_buffers, 1)),
+    _bytes_written(sink.bytes_written())
+{
+  CUDF_EXPECTS(buffer_size > 0, "Staging buffer size must be positive");
+  CUDA_TRY(cudaGetDevice(&_device));
+  // A separate stream lets the copies run as soon as their data is ready, rather than after all
+  // the work the caller has enqueued so far
+  CUDA_TRY(cudaStreamCreateWithFlags(&_stream, cudaStreamNonBlocking));
+}
+
+async_sink_writer::~async_sink_writer()
+{
+  // Errors can only be reported by flush(); the writes must still finish before the buffers go
+  if (_last_write.valid()) { _last_write.wait(); }
+  for (auto &slot : _slots) {
+    if (slot.event != nullptr) { cudaEventDestroy(slot.event); }
+    if (slot.host != nullptr) {
+      auto const free_result = cudaFreeHost(slot.host);
+      assert(free_result == cudaSuccess);
+    }
+  }
+  cudaStreamDestroy(_stream);
+}
+
+void async_sink_writer::allocate()
+{
+  for (auto &slot : _slots) {
+    CUDA_TRY(cudaMallocHost(&slot.host, _buffer_size));
+    CUDA_TRY(cudaEventCreateWithFlags(&slot.event, cudaEventDisableTiming));
+  }
+  _allocated = true;
+}
+
+void async_sink_writer::enqueue(std::function<void()> &&write)
+{
+  // Bound the number of threads waiting for their predecessor
+  while (_pending.size() >= max_pending_writes) {
+    _pending.front().wait();
+    _pending.pop_front();
+  }
+
+  // Each write runs after the previous one, and forwards its error
+  _last_write = std::async(std::launch::async,
+                           [previous = _last_write, write = std::move(write), device = _device]() {
+                             if (previous.valid()) { previous.get(); }
+                             CUDA_TRY(cudaSetDevice(device));
+                             write();
+                           })
+                  .share();
+  _pending.push_back(_last_write);
+}
+
+void async_sink_writer::wait_event(cudaEvent_t event)
+{
+  CUDA_TRY(cudaStreamWaitEvent(_stream, event, 0));
+}
+
+void async_sink_writer::host_write(void const *data, size_t size)
+{
+  auto const bytes = static_cast<uint8_t const *>(data);
+  _host_data.insert(_host_data.end(), bytes, bytes + size);
+  _bytes_written += size;
+}
+
+void async_sink_writer::write_host_data()
+{
+  if (_host_data.empty()) { return; }
+  enqueue([this, buffer = std::move(_host_data)]() {
+    _sink.host_write(buffer.data(), buffer.size());
+  });
+  _host_data = {};
+}
+
+void async_sink_writer::device_write(void const *gpu_data, size_t size)
+{
+  if (size == 0) { return; }
+  write_host_data();
+
+  if (_sink.supports_device_write()) {
+    cudaEvent_t event;
+    CUDA_TRY(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+    CUDA_TRY(cudaEventRecord(event, _stream));
+    enqueue([this, event, gpu_data, size]() {
+      auto const sync_result = cudaEventSynchronize(event);
+      cudaEventDestroy(event);
+      CUDA_TRY(sync_result);
+      _sink.device_write(gpu_data, size, _stream);
+    });
+    _bytes_written += size;
+    return;
+  }
+
+  if (!_allocated) { allocate(); }
+  auto src = static_cast<uint8_t const *>(gpu_data);
+  while (size > 0) {
+    auto &slot = _slots[_next_slot];
+    _next_slot = (_next_slot + 1) % _slots.size();
+    // Wait for the previous write out of this buffer before overwriting it
+    if (slot.write.valid()) { slot.write.wait(); }
+
+    auto const slice_size = std::min(size, _buffer_size);
+    CUDA_TRY(cudaMemcpyAsync(slot.host, src, slice_size, cudaMemcpyDeviceToHost, _stream));
+    CUDA_TRY(cudaEventRecord(slot.event, _stream));
+    enqueue([this, &slot, slice_size]() {
+      CUDA_TRY(cudaEventSynchronize(slot.event));
+      _sink.host_write(slot.host, slice_size);
+    });
+    slot.write = _last_write;
+    _bytes_written += slice_size;
+
+    src += slice_size;
+    size -= slice_size;
+  }
+}
+
+void async_sink_writer::flush()
+{
+  write_host_data();
+  _pending.clear();
+  for (auto &slot : _slots) { slot.write = {}; }
+  if (_last_write.valid()) {
+    auto last_write = std::move(_last_write);
+    _last_write     = {};
+    last_write.get();
+  }
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
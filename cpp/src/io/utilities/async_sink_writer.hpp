@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file async_sink_writer.hpp
+ * @brief cuDF-IO writes to a data sink on background threads
+ */
+
+#pragma once
+
+#include <cudf/io/data_sink.hpp>
+
+#include <cuda_runtime.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Appends host and device data to a data sink on background threads
+ *
+ * Writes are applied to the sink in the order they are issued, but the calls return as soon as
+ * the write is queued. Device data is copied to a ring of pinned staging buffers on a stream
+ * owned by the writer, and each buffer is handed to the sink once its copy has completed; a
+ * staging buffer is only reused once its previous write has completed. The sink therefore writes
+ * slice N while slice N+1 is copied from the device, and the caller can enqueue more GPU work on
+ * its own streams meanwhile.
+ *
+ * Device writes are not ordered with other streams; use `wait_event()` to make them wait for the
+ * work producing their data. Sinks that support `device_write` receive the device data directly.
+ *
+ * Errors raised by the sink are rethrown by `flush()`.
+ */
+class async_sink_writer {
+ public:
+  static constexpr size_t default_buffer_size = 8 * 1024 * 1024;
+  static constexpr int default_num_buffers    = 3;
+  static constexpr size_t max_pending_writes  = 16;
+
+  /**
+   * @brief Constructor
+   *
+   * @param sink Sink to write to; must outlive the writer
+   * @param buffer_size Size of each pinned staging buffer in bytes
+   * @param num_buffers Number of staging buffers in the ring
+   */
+  explicit async_sink_writer(data_sink &sink,
+                             size_t buffer_size = default_buffer_size,
+                             int num_buffers    = default_num_buffers);
+
+  /**
+   * @brief Waits for all queued writes, then releases the staging buffers and the stream
+   */
+  ~async_sink_writer();
+
+  async_sink_writer(async_sink_writer const &) = delete;
+  async_sink_writer &operator=(async_sink_writer const &) = delete;
+
+  /**
+   * @brief Queues a write of host data; the data is copied and can be reused on return
+   *
+   * Consecutive host writes are coalesced into a single write to the sink.
+   *
+   * @param data Host data to write
+   * @param size Number of bytes to write
+   */
+  void host_write(void const *data, size_t size);
+
+  /**
+   * @brief Makes the device writes queued from now on wait for an event
+   *
+   * @param event Event recorded after the work producing the data of the next device writes
+   */
+  void wait_event(cudaEvent_t event);
+
+  /**
+   * @brief Queues a write of device data
+   *
+   * The data must remain valid until `flush()` returns.
+   *
+   * @param gpu_data Device data to write
+   * @param size Number of bytes to write
+   */
+  void device_write(void const *gpu_data, size_t size);
+
+  /**
+   * @brief Blocks until all queued writes have been applied to the sink
+   *
+   * @throw The first error raised by a queued write
+   */
+  void flush();
+
+  /**
+   * @brief Returns the size of the sink once all queued writes are applied
+   */
+  size_t bytes_written() const { return _bytes_written; }
+
+ private:
+  struct staging_slot {
+    uint8_t *host     = nullptr;
+    cudaEvent_t event = nullptr;
+    std::shared_future<void> write;
+  };
+
+  data_sink &_sink;
+  cudaStream_t _stream = nullptr;
+  size_t _buffer_size;
+  int _device = 0;
+  std::vector<staging_slot> _slots;
+  size_t _next_slot = 0;
+  bool _allocated   = false;
+  std::shared_future<void> _last_write;
+  std::deque<std::shared_future<void>> _pending;
+  std::vector<uint8_t> _host_data;
+  size_t _bytes_written = 0;
+
+  void allocate();
+  void enqueue(std::function<void()> &&write);
+  void write_host_data();
+};
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "caching_datasource.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace {
+/**
+ * @brief Buffer referencing a range of a cached block, which it keeps alive
+ */
+class block_slice : public datasource::buffer {
+ public:
+  block_slice(std::shared_ptr<datasource::buffer> block, size_t offset, size_t size)
+    : _block(std::move(block)), _offset(offset), _size(size)
+  {
+  }
+  size_t size() const override { return _size; }
+  const uint8_t *data() const override { return _block->data() + _offset; }
+
+ private:
+  std::shared_ptr<datasource::buffer> _block;
+  size_t _offset;
+  size_t _size;
+};
+
+/**
+ * @brief Buffer owning host memory, for reads that span several blocks
+ */
+class host_vector_buffer : public datasource::buffer {
+ public:
+  explicit host_vector_buffer(std::vector<uint8_t> &&data) : _data(std::move(data)) {}
+  size_t size() const override { return _data.size(); }
+  const uint8_t *data() const override { return _data.data(); }
+
+ private:
+  std::vector<uint8_t> _data;
+};
+
+}  // namespace
+
+caching_datasource::caching_datasource(std::unique_ptr<datasource> source,
+                                       size_t block_size,
+                                       int read_ahead_blocks,
+                                       size_t max_cached_blocks)
+  : _source(std::move(source)),
+    _size(_source->size()),
+    _block_size(block_size),
+    _read_ahead_blocks(std::max(read_ahead_blocks, 0)),
+    _max_cached_blocks(max_cached_blocks)
+{
+  CUDF_EXPECTS(block_size > 0, "Block size must be positive");
+  if (_size > 0) {
+    // The readers start with the footer
+    auto const last_block = (_size - 1) / _block_size;
+    fetch_blocks(last_block, last_block);
+  }
+}
+
+std::vector<caching_datasource::block_future> caching_datasource::fetch_blocks(size_t first,
+                                                                               size_t last)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto const num_blocks = (_size + _block_size - 1) / _block_size;
+  auto const fetch_end  = std::min(std::max(last + _read_ahead_blocks, first + 1), num_blocks);
+
+  std::vector<block_future> blocks;
+  for (auto index = first; index < fetch_end; ++index) {
+    auto block = _blocks.find(index);
+    if (block == _blocks.end()) {
+      auto const offset = index * _block_size;
+      auto const size   = std::min(_block_size, _size - offset);
+      auto read         = [source = _source.get(), offset, size] {
+        return std::shared_ptr<buffer>(source->host_read(offset, size));
+      };
+      auto data = std::async(std::launch::async, read).share();
+      block     = _blocks.emplace(index, cached_block{std::move(data), _lru.end()}).first;
+    } else {
+      _lru.erase(block->second.lru_position);
+    }
+    _lru.push_front(index);
+    block->second.lru_position = _lru.begin();
+    if (index < last) { blocks.push_back(block->second.data); }
+  }
+
+  // Evict the least recently used blocks; the blocks still being read are kept since dropping
+  // the last reference to them would wait for the read
+  for (auto index = _lru.rbegin(); index != _lru.rend() && _blocks.size() > _max_cached_blocks;) {
+    auto const block = _blocks.find(*index);
+    if ((*index >= first && *index < fetch_end) ||
+        block->second.data.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+      ++index;
+      continue;
+    }
+    _blocks.erase(block);
+    index = std::list<size_t>::reverse_iterator(_lru.erase(std::next(index).base()));
+  }
+  return blocks;
+}
+
+std::shared_ptr<datasource::buffer> caching_datasource::get_block(block_future const &block,
+                                                                  size_t index)
+{
+  try {
+    return block.get();
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto const cached = _blocks.find(index);
+    if (cached != _blocks.end()) {
+      _lru.erase(cached->second.lru_position);
+      _blocks.erase(cached);
+    }
+    throw;
+  }
+}
+
+std::unique_ptr<datasource::buffer> caching_datasource::host_read(size_t offset, size_t size)
+{
+  if (offset >= _size || size == 0) { return std::make_unique<non_owning_buffer>(); }
+  size = std::min(size, _size - offset);
+
+  auto const first = offset / _block_size;
+  if ((offset + size - 1) / _block_size == first) {
+    // Zero-copy read when the range is within a block
+    auto const block     = get_block(fetch_blocks(first, first + 1).front(), first);
+    auto const in_offset = offset - first * _block_size;
+    auto const read_size = std::min(size, block->size() - std::min(in_offset, block->size()));
+    return std::make_unique<block_slice>(block, in_offset, read_size);
+  }
+
+  std::vector<uint8_t> data(size);
+  data.resize(host_read(offset, size, data.data()));
+  return std::make_unique<host_vector_buffer>(std::move(data));
+}
+
+size_t caching_datasource::host_read(size_t offset, size_t size, uint8_t *dst)
+{
+  if (offset >= _size || size == 0) { return 0; }
+  size = std::min(size, _size - offset);
+
+  auto const first  = offset / _block_size;
+  auto const blocks = fetch_blocks(first, (offset + size - 1) / _block_size + 1);
+  size_t bytes_read = 0;
+  for (size_t i = 0; i < blocks.size(); ++i) {
+    auto const block        = get_block(blocks[i], first + i);
+    auto const block_offset = (first + i) * _block_size;
+    auto const begin        = offset + bytes_read;
+    auto const end          = std::min(offset + size, block_offset + block->size());
+    if (end <= begin) { break; }
+    std::memcpy(dst + bytes_read, block->data() + (begin - block_offset), end - begin);
+    bytes_read += end - begin;
+    // A short block ends the data of the source
+    if (block->size() < _block_size) { break; }
+  }
+  return bytes_read;
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file caching_datasource.hpp
+ * @brief cuDF-IO datasource decorator that reads ahead and caches blocks of a slow source
+ */
+
+#pragma once
+
+#include <cudf/io/datasource.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Datasource that reads a source in aligned blocks, concurrently and ahead of the reader
+ *
+ * Each host read is served from the cached blocks that cover its range; the missing blocks are
+ * read from the source concurrently, each in its own thread, along with the `read_ahead_blocks`
+ * blocks that follow the range. Small nearby reads, such as those of the footer and the
+ * metadata, are thereby coalesced into a single read of the source, and sequential reads only
+ * wait for the first block. The last block of the source, which holds the footer of Parquet and
+ * ORC files, is read when the datasource is created.
+ *
+ * Meant for sources where each read is a round trip, e.g. Arrow files backed by remote storage.
+ * The source must support concurrent host reads. Device reads are forwarded to the source.
+ */
+class caching_datasource : public datasource {
+ public:
+  static constexpr size_t default_block_size        = 8 * 1024 * 1024;
+  static constexpr int default_read_ahead_blocks    = 2;
+  static constexpr size_t default_max_cached_blocks = 16;
+
+  /**
+   * @brief Constructor
+   *
+   * @param source Source to read from
+   * @param block_size Size of the blocks read from the source in bytes
+   * @param read_ahead_blocks Number of blocks read past the end of each read
+   * @param max_cached_blocks Number of blocks above which the least recently used are evicted
+   */
+  explicit caching_datasource(std::unique_ptr<datasource> source,
+                              size_t block_size        = default_block_size,
+                              int read_ahead_blocks    = default_read_ahead_blocks,
+                              size_t max_cached_blocks = default_max_cached_blocks);
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override;
+
+  size_t host_read(size_t offset, size_t size, uint8_t *dst) override;
+
+  bool supports_device_read() const override { return _source->supports_device_read(); }
+
+  std::unique_ptr<buffer> device_read(size_t offset, size_t size) override
+  {
+    return _source->device_read(offset, size);
+  }
+
+  size_t device_read(size_t offset, size_t size, uint8_t *dst) override
+  {
+    return _source->device_read(offset, size, dst);
+  }
+
+  size_t size() const override { return _size; }
+
+ private:
+  using block_future = std::shared_future<std::shared_ptr<buffer>>;
+
+  struct cached_block {
+    block_future data;
+    std::list<size_t>::iterator lru_position;
+  };
+
+  /**
+   * @brief Returns the blocks [first, last), starting the reads of the missing blocks and of the
+   * blocks read ahead
+   */
+  std::vector<block_future> fetch_blocks(size_t first, size_t last);
+
+  /**
+   * @brief Waits for a block returned by `fetch_blocks`; a block that failed to read is dropped
+   * from the cache, so that a later read retries it
+   */
+  std::shared_ptr<buffer> get_block(block_future const &block, size_t index);
+
+  // Declared first so that the pending block reads complete before the source is destroyed
+  std::unique_ptr<datasource> _source;
+  size_t _size;
+  size_t _block_size;
+  size_t _read_ahead_blocks;
+  size_t _max_cached_blocks;
+
+  std::mutex _mutex;
+  std::map<size_t, cached_block> _blocks;
+  std::list<size_t> _lru;  // Block indices, most recently used first
+};
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -22,7 +22,10 @@
 #pragma once
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/utilities/prefetch.hpp>
 #include <cudf/null_mask.hpp>
+#include <cudf/strings/detail/utilities.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/traits.hpp>
 
@@ -52,6 +55,8 @@ inline rmm::device_buffer create_data(
   std::size_t data_size = size_of(type) * size;
 
   rmm::device_buffer data(data_size, stream, mr);
+  // Managed memory is migrated in bulk rather than faulted in by the memset and the decode
+  cudf::detail::prefetch(data.data(), data_size, stream);
   CUDA_TRY(cudaMemsetAsync(data.data(), 0, data_size, stream));
 
   return data;
@@ -79,13 +84,37 @@ struct column_buffer {
     _null_count = 0;
   }
 
-  auto data() { return _strings.size() ? _strings.data().get() : _data.data(); }
+  /**
+   * @brief Constructor for decoding a fixed-width column into caller-owned memory
+   *
+   * The rows are decoded at the head of `output`. The validity of a nullable column is decoded
+   * into the null mask of `output`, or into an owned one if `output` has none.
+   */
+  column_buffer(mutable_column_view const& output,
+                bool is_nullable,
+                cudaStream_t stream                 = 0,
+                rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource())
+    : _external_data(output.head())
+  {
+    cudf::detail::prefetch(output, stream);
+    if (is_nullable && output.nullable()) {
+      _external_null_mask = output.null_mask();
+    } else if (is_nullable) {
+      _null_mask = create_null_mask(output.size(), mask_state::ALL_NULL, stream, mr);
+    }
+  }
+
+  auto data()
+  {
+    if (_external_data != nullptr) { return _external_data; }
+    return _strings.size() ? static_cast<void*>(_strings.data().get()) : _data.data();
+  }
   auto data_size() { return std::max(_data.size(), _strings.size() * sizeof(str_pair)); }
 
   template <typename T = uint32_t>
   auto null_mask()
   {
-    return static_cast<T*>(_null_mask.data());
+    return static_cast<T*>(_external_null_mask ? _external_null_mask : _null_mask.data());
   }
   auto null_mask_size() { return _null_mask.size(); };
 
@@ -95,6 +124,12 @@ struct column_buffer {
   rmm::device_buffer _data{};
   rmm::device_buffer _null_mask{};
   size_type _null_count{0};
+  // Whether the decoder sets the validity of string rows in the null mask, with empty pairs for
+  // the null rows; otherwise the null strings are the pairs with a null pointer
+  bool _strings_validity_in_mask{false};
+  // Caller-owned memory decoded into, instead of the owned buffers
+  void* _external_data{nullptr};
+  bitmask_type* _external_null_mask{nullptr};
 };
 
 namespace {
@@ -119,7 +154,17 @@ std::unique_ptr<column> make_column(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource())
 {
   if (type.id() == type_id::STRING) {
-    return make_strings_column(buffer._strings, stream, mr);
+    std::unique_ptr<column> strings;
+    if (buffer._strings_validity_in_mask) {
+      strings = cudf::strings::detail::make_strings_column(
+        buffer._strings, std::move(buffer._null_mask), buffer._null_count, mr, stream);
+    } else {
+      strings = make_strings_column(buffer._strings, stream, mr);
+    }
+    // Release the pairs now rather than with the buffer, so that the pairs of all the string
+    // columns of a read are not held at once
+    rmm::device_vector<column_buffer::str_pair>().swap(buffer._strings);
+    return strings;
   } else {
     return std::make_unique<column>(
       type, size, std::move(buffer._data), std::move(buffer._null_mask), buffer._null_count);
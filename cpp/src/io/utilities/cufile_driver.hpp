@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file cufile_driver.hpp
+ * @brief cuDF-IO cuFile (GPUDirect Storage) driver lifetime
+ */
+
+#pragma once
+
+#ifdef CUFILE_FOUND
+#include <cufile.h>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Opens the cuFile driver once per process and closes it at exit.
+ */
+class cufile_driver {
+ public:
+  static cufile_driver const &instance()
+  {
+    static cufile_driver driver;
+    return driver;
+  }
+
+  bool is_open() const { return is_open_; }
+
+ private:
+  cufile_driver() : is_open_(cuFileDriverOpen().err == CU_FILE_SUCCESS) {}
+  ~cufile_driver()
+  {
+    if (is_open_) { cuFileDriverClose(); }
+  }
+
+  bool is_open_ = false;
+};
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
+#endif
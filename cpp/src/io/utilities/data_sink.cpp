@@ -19,6 +19,13 @@
 #include <cudf/io/data_sink.hpp>
 #include <cudf/utilities/error.hpp>
 
+#ifdef CUFILE_FOUND
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <io/utilities/cufile_driver.hpp>
+#endif
+
 namespace cudf {
 namespace io {
 /**
@@ -44,10 +51,59 @@ class file_sink : public data_sink {
 
   size_t bytes_written() override { return outfile_.tellp(); }
 
- private:
+ protected:
   std::ofstream outfile_;
 };
 
+#ifdef CUFILE_FOUND
+/**
+ * @brief Implementation class for writing to a local file directly from device memory using
+ * cuFile (GPUDirect Storage).
+ *
+ * Host writes go through the buffered file stream of the base class.
+ */
+class gds_file_sink : public file_sink {
+ public:
+  explicit gds_file_sink(std::string const& filepath)
+    : file_sink(filepath), fd_(open(filepath.c_str(), O_WRONLY))
+  {
+    CUDF_EXPECTS(fd_ != -1, "Cannot open output file");
+
+    CUfileDescr_t desc{};
+    desc.handle.fd = fd_;
+    desc.type      = CU_FILE_HANDLE_TYPE_OPAQUE_FD;
+    if (cuFileHandleRegister(&handle_, &desc).err != CU_FILE_SUCCESS) {
+      close(fd_);
+      CUDF_FAIL("Cannot register file handle with cuFile");
+    }
+  }
+
+  virtual ~gds_file_sink()
+  {
+    cuFileHandleDeregister(handle_);
+    close(fd_);
+  }
+
+  bool supports_device_write() const override { return true; }
+
+  void device_write(void const* gpu_data, size_t size, cudaStream_t stream) override
+  {
+    // Earlier host writes must reach the file before it is written at the current offset
+    outfile_.flush();
+    auto const offset = bytes_written();
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    auto const written = cuFileWrite(handle_, gpu_data, size, offset, 0);
+    CUDF_EXPECTS(written >= 0 && static_cast<size_t>(written) == size,
+                 "cuFile error writing to a file");
+    outfile_.seekp(offset + size);
+  }
+
+ private:
+  int fd_ = -1;
+  CUfileHandle_t handle_;
+};
+#endif
+
 /**
  * @brief Implementation class for storing data into a std::vector.
  *
@@ -126,6 +182,12 @@ class user_sink_wrapper : public data_sink {
 
 std::unique_ptr<data_sink> data_sink::create(const std::string& filepath)
 {
+#ifdef CUFILE_FOUND
+  // Write straight from device memory when the platform supports GPUDirect Storage
+  if (detail::cufile_driver::instance().is_open()) {
+    return std::make_unique<gds_file_sink>(filepath);
+  }
+#endif
   return std::make_unique<file_sink>(filepath);
 }
 
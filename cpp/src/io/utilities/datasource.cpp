@@ -23,6 +23,14 @@
 #include <cudf/io/datasource.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <io/utilities/caching_datasource.hpp>
+
+#ifdef CUFILE_FOUND
+#include <io/utilities/cufile_driver.hpp>
+
+#include <rmm/device_buffer.hpp>
+#endif
+
 namespace cudf {
 namespace io {
 /**
@@ -169,6 +177,71 @@ class memory_mapped_source : public datasource {
   size_t map_offset_ = 0;
 };
 
+#ifdef CUFILE_FOUND
+/**
+ * @brief Implementation class for reading from a file directly into device memory using cuFile
+ * (GPUDirect Storage).
+ *
+ * Host reads, used by the readers for metadata, go through the memory mapping of the base class.
+ */
+class gds_file_source : public memory_mapped_source {
+  class device_buffer_wrapper : public buffer {
+    rmm::device_buffer _buffer;
+
+   public:
+    explicit device_buffer_wrapper(rmm::device_buffer &&buffer) : _buffer(std::move(buffer)) {}
+    size_t size() const override { return _buffer.size(); }
+    const uint8_t *data() const override { return static_cast<uint8_t const *>(_buffer.data()); }
+  };
+
+ public:
+  explicit gds_file_source(const char *filepath, size_t offset, size_t size)
+    : memory_mapped_source(filepath, offset, size), fd_(open(filepath, O_RDONLY | O_DIRECT))
+  {
+    CUDF_EXPECTS(fd_ != -1, "Cannot open file");
+
+    CUfileDescr_t desc{};
+    desc.handle.fd = fd_;
+    desc.type      = CU_FILE_HANDLE_TYPE_OPAQUE_FD;
+    if (cuFileHandleRegister(&handle_, &desc).err != CU_FILE_SUCCESS) {
+      close(fd_);
+      CUDF_FAIL("Cannot register file handle with cuFile");
+    }
+  }
+
+  virtual ~gds_file_source()
+  {
+    cuFileHandleDeregister(handle_);
+    close(fd_);
+  }
+
+  bool supports_device_read() const override { return true; }
+
+  std::unique_ptr<buffer> device_read(size_t offset, size_t size) override
+  {
+    rmm::device_buffer out_data(size);
+    out_data.resize(device_read(offset, size, static_cast<uint8_t *>(out_data.data())));
+    return std::make_unique<device_buffer_wrapper>(std::move(out_data));
+  }
+
+  size_t device_read(size_t offset, size_t size, uint8_t *dst) override
+  {
+    CUDF_EXPECTS(offset <= this->size(), "Offset is past end of file");
+
+    // Clamp length to available data in the file
+    auto const read_size = std::min(size, this->size() - offset);
+
+    auto const bytes_read = cuFileRead(handle_, dst, read_size, offset, 0);
+    CUDF_EXPECTS(bytes_read >= 0, "cuFile error reading from a file");
+    return bytes_read;
+  }
+
+ private:
+  int fd_ = -1;
+  CUfileHandle_t handle_;
+};
+#endif
+
 /**
  * @brief Wrapper class for user implemented data sources
  *
@@ -212,6 +285,12 @@ std::unique_ptr<datasource> datasource::create(const std::string &filepath,
                                                size_t offset,
                                                size_t size)
 {
+#ifdef CUFILE_FOUND
+  // Read straight into device memory when the platform supports GPUDirect Storage
+  if (detail::cufile_driver::instance().is_open()) {
+    return std::make_unique<gds_file_source>(filepath.c_str(), offset, size);
+  }
+#endif
   // Use our own memory mapping implementation for direct file reads
   return std::make_unique<memory_mapped_source>(filepath.c_str(), offset, size);
 }
@@ -227,7 +306,10 @@ std::unique_ptr<datasource> datasource::create(
   std::shared_ptr<arrow::io::RandomAccessFile> arrow_file)
 {
   // Support derived classes of the top-level Arrow IO interface
-  return std::make_unique<arrow_io_source>(arrow_file);
+  auto source = std::make_unique<arrow_io_source>(arrow_file);
+  if (arrow_file->supports_zero_copy()) { return std::move(source); }
+  // Each read of other Arrow files may be a round trip to remote storage
+  return std::make_unique<detail::caching_datasource>(std::move(source));
 }
 
 std::unique_ptr<datasource> datasource::create(datasource *source)
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include "pinned_memory_pool.hpp"
+
 #include <rmm/device_buffer.hpp>
 
 #include <cudf/utilities/error.hpp>
@@ -28,6 +30,12 @@
  * initialized upfront, or gradually initialized as required.
  * The host-side memory can be used to manipulate data on the CPU before and
  * after operating on the same data on the GPU.
+ *
+ * The host memory comes from the `pinned_memory_pool`, so readers and writers
+ * that create vectors on every call reuse pinned blocks rather than paying for
+ * `cudaMallocHost` and the device synchronization of `cudaFreeHost` each time.
+ * It is returned to the pool with the vector's stream, which must be the stream
+ * of its last transfer.
  **/
 template <typename T>
 class hostdevice_vector {
@@ -40,20 +48,24 @@ class hostdevice_vector {
   }
 
   explicit hostdevice_vector(size_t initial_size, size_t max_size, cudaStream_t stream = 0)
-    : num_elements(initial_size), max_elements(max_size)
+    : stream(stream), max_elements(max_size), num_elements(initial_size)
   {
     if (max_elements != 0) {
-      CUDA_TRY(cudaMallocHost(&h_data, sizeof(T) * max_elements));
+      h_data = static_cast<T *>(
+        cudf::io::detail::pinned_memory_pool::instance().allocate(sizeof(T) * max_elements));
       d_data.resize(sizeof(T) * max_elements, stream);
     }
   }
 
   ~hostdevice_vector()
   {
-    auto const free_result = cudaFreeHost(h_data);
-    assert(free_result == cudaSuccess);
+    cudf::io::detail::pinned_memory_pool::instance().deallocate(
+      h_data, sizeof(T) * max_elements, stream);
   }
 
+  hostdevice_vector(hostdevice_vector const &) = delete;
+  hostdevice_vector &operator=(hostdevice_vector const &) = delete;
+
   bool insert(const T &data)
   {
     if (num_elements < max_elements) {
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/detail/utilities/parse_digits.cuh>
 #include <cudf/detail/utilities/trie.cuh>
 #include <cudf/io/types.hpp>
 
@@ -40,6 +41,14 @@ struct ParseOptions {
   SerialTrieNode* falseValuesTrie;
   SerialTrieNode* naValuesTrie;
   bool multi_delimiter;
+  // Masks of the lengths of the values in each trie, see `createTrieLengthMask`
+  uint64_t trueValuesLengths  = ~uint64_t{0};
+  uint64_t falseValuesLengths = ~uint64_t{0};
+  uint64_t naValuesLengths    = ~uint64_t{0};
+  // Number of nodes in each trie
+  int trueValuesTrieSize  = 0;
+  int falseValuesTrieSize = 0;
+  int naValuesTrieSize    = 0;
 };
 
 namespace gpu {
@@ -160,6 +169,17 @@ parse_numeric(const char* data, long start, long end, ParseOptions const& opts)
   // Handle the whole part of the number
   long index = start;
   while (index <= end) {
+    if (base == 10 && std::is_integral<T>::value && !std::is_same<T, bool>::value) {
+      // take up to 8 digits at once
+      uint64_t digits  = 0;
+      auto const count = cudf::detail::parse_digits_chunk(data + index, data + end + 1, digits);
+      if (count > 0) {
+        auto const scale = cudf::detail::digits_chunk_scale(count);
+        value            = (value * static_cast<T>(scale)) + static_cast<T>(digits);
+        index += count;
+        continue;
+      }
+    }
     if (data[index] == opts.decimal) {
       ++index;
       break;
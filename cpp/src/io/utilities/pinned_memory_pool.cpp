@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pinned_memory_pool.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <cassert>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace {
+size_t block_size(size_t size)
+{
+  size_t block = pinned_memory_pool::min_block_size;
+  while (block < size) { block *= 2; }
+  return block;
+}
+
+}  // namespace
+
+pinned_memory_pool &pinned_memory_pool::instance()
+{
+  // Never destroyed: the CUDA runtime may already be torn down when static objects are
+  static auto *pool = new pinned_memory_pool;
+  return *pool;
+}
+
+pinned_memory_pool::~pinned_memory_pool()
+{
+  for (auto &blocks : _free_blocks) {
+    for (auto &block : blocks.second) {
+      cudaEventSynchronize(block.freed);
+      cudaEventDestroy(block.freed);
+      auto const free_result = cudaFreeHost(block.ptr);
+      assert(free_result == cudaSuccess);
+    }
+  }
+}
+
+void *pinned_memory_pool::allocate(size_t size)
+{
+  if (size == 0) { return nullptr; }
+  auto const block = block_size(size);
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto const it = _free_blocks.find(block);
+    if (it != _free_blocks.end()) {
+      auto &blocks     = it->second;
+      auto const ready = std::find_if(blocks.begin(), blocks.end(), [](auto const &b) {
+        return cudaEventQuery(b.freed) == cudaSuccess;
+      });
+      if (ready != blocks.end()) {
+        auto const ptr = ready->ptr;
+        cudaEventDestroy(ready->freed);
+        blocks.erase(ready);
+        _cached_size -= block;
+        return ptr;
+      }
+    }
+  }
+
+  void *ptr = nullptr;
+  CUDA_TRY(cudaMallocHost(&ptr, block));
+  return ptr;
+}
+
+void pinned_memory_pool::deallocate(void *ptr, size_t size, cudaStream_t stream) noexcept
+{
+  if (ptr == nullptr) { return; }
+  auto const block = block_size(size);
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    cudaEvent_t freed = nullptr;
+    if (_cached_size + block <= max_cached_size &&
+        cudaEventCreateWithFlags(&freed, cudaEventDisableTiming) == cudaSuccess) {
+      if (cudaEventRecord(freed, stream) == cudaSuccess) {
+        _free_blocks[block].push_back({ptr, freed});
+        _cached_size += block;
+        return;
+      }
+      cudaEventDestroy(freed);
+    }
+  }
+
+  auto const free_result = cudaFreeHost(ptr);
+  assert(free_result == cudaSuccess);
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file pinned_memory_pool.hpp
+ * @brief cuDF-IO process-wide cache of pinned host allocations
+ */
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Process-wide cache of pinned host allocations
+ *
+ * `cudaMallocHost` is orders of magnitude slower than a pageable allocation, and `cudaFreeHost`
+ * synchronizes the device, so readers and writers that stage a few small buffers per call spend
+ * measurable time allocating them. The pool keeps freed blocks instead, bucketed by power of two
+ * sizes, and hands them out again.
+ *
+ * A block is freed with the stream of its last transfer. It is only handed out again once the
+ * work enqueued on that stream before the free has completed, so an in-flight copy never reads a
+ * reused block. At most `max_cached_size` bytes are kept; larger frees go to `cudaFreeHost`.
+ */
+class pinned_memory_pool {
+ public:
+  static constexpr size_t min_block_size  = 4 * 1024;
+  static constexpr size_t max_cached_size = 256 * 1024 * 1024;
+
+  /**
+   * @brief Returns the pool of the process
+   */
+  static pinned_memory_pool &instance();
+
+  pinned_memory_pool() = default;
+  ~pinned_memory_pool();
+
+  pinned_memory_pool(pinned_memory_pool const &) = delete;
+  pinned_memory_pool &operator=(pinned_memory_pool const &) = delete;
+
+  /**
+   * @brief Returns a pinned host block of at least `size` bytes
+   *
+   * @throw cudf::cuda_error if a new block cannot be allocated
+   *
+   * @param size Number of bytes to allocate
+   * @return Pointer to the block; nullptr if `size` is 0
+   */
+  void *allocate(size_t size);
+
+  /**
+   * @brief Returns a block obtained from `allocate` to the pool
+   *
+   * @param ptr Pointer returned by `allocate(size)`
+   * @param size Size passed to `allocate`
+   * @param stream Stream of the last transfer from or to the block
+   */
+  void deallocate(void *ptr, size_t size, cudaStream_t stream) noexcept;
+
+ private:
+  struct cached_block {
+    void *ptr;
+    cudaEvent_t freed;  ///< Recorded on the stream the block was freed with
+  };
+
+  std::mutex _mutex;
+  std::map<size_t, std::vector<cached_block>> _free_blocks;  ///< By block size
+  size_t _cached_size = 0;
+};
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
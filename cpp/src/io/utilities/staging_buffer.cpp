@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "staging_buffer.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <cassert>
+
+namespace cudf {
+namespace io {
+namespace detail {
+staged_device_copier::staged_device_copier(cudaStream_t stream,
+                                           size_t buffer_size,
+                                           int num_buffers)
+  : _stream(stream), _buffer_size(buffer_size), _slots(std::max(num_buffers, 1))
+{
+  CUDF_EXPECTS(buffer_size > 0, "Staging buffer size must be positive");
+}
+
+staged_device_copier::~staged_device_copier()
+{
+  for (auto &slot : _slots) {
+    if (slot.event != nullptr) {
+      auto const sync_result = cudaEventSynchronize(slot.event);
+      assert(sync_result == cudaSuccess);
+      cudaEventDestroy(slot.event);
+    }
+    if (slot.host != nullptr) {
+      auto const free_result = cudaFreeHost(slot.host);
+      assert(free_result == cudaSuccess);
+    }
+  }
+}
+
+void staged_device_copier::allocate()
+{
+  for (auto &slot : _slots) {
+    CUDA_TRY(cudaMallocHost(&slot.host, _buffer_size));
+    CUDA_TRY(cudaEventCreateWithFlags(&slot.event, cudaEventDisableTiming));
+  }
+  _allocated = true;
+}
+
+void staged_device_copier::copy(datasource &source, size_t offset, size_t size, void *dst)
+{
+  if (size == 0) { return; }
+  auto d_dst = static_cast<uint8_t *>(dst);
+
+  if (source.supports_device_read() && size >= min_staged_size) {
+    // Direct reads are not ordered on the stream, so wait for any pending use of `dst`
+    CUDA_TRY(cudaStreamSynchronize(_stream));
+    CUDF_EXPECTS(source.device_read(offset, size, d_dst) == size, "Unexpected end of data source");
+    return;
+  }
+  if (size < min_staged_size) {
+    // The driver stages pageable copies itself, so the source buffer can be released on return
+    auto const buffer = source.host_read(offset, size);
+    CUDF_EXPECTS(buffer->size() == size, "Unexpected end of data source");
+    CUDA_TRY(cudaMemcpyAsync(d_dst, buffer->data(), size, cudaMemcpyHostToDevice, _stream));
+    return;
+  }
+
+  if (!_allocated) { allocate(); }
+  while (size > 0) {
+    auto &slot = _slots[_next_slot];
+    _next_slot = (_next_slot + 1) % _slots.size();
+    // Wait for the previous transfer out of this buffer before overwriting it
+    if (slot.pending) { CUDA_TRY(cudaEventSynchronize(slot.event)); }
+
+    auto const slice_size = std::min(size, _buffer_size);
+    auto const bytes_read = source.host_read(offset, slice_size, slot.host);
+    CUDF_EXPECTS(bytes_read == slice_size, "Unexpected end of data source");
+    CUDA_TRY(cudaMemcpyAsync(d_dst, slot.host, slice_size, cudaMemcpyHostToDevice, _stream));
+    CUDA_TRY(cudaEventRecord(slot.event, _stream));
+    slot.pending = true;
+
+    offset += slice_size;
+    d_dst += slice_size;
+    size -= slice_size;
+  }
+}
+
+void staged_device_copier::synchronize()
+{
+  for (auto &slot : _slots) {
+    if (slot.pending) {
+      CUDA_TRY(cudaEventSynchronize(slot.event));
+      slot.pending = false;
+    }
+  }
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
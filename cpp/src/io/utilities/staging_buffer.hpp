@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file staging_buffer.hpp
+ * @brief cuDF-IO host-to-device transfers through pinned staging buffers
+ */
+
+#pragma once
+
+#include <cudf/io/datasource.hpp>
+
+#include <cuda_runtime.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Copies byte ranges of a datasource to device memory through a ring of pinned staging
+ * buffers
+ *
+ * Each range is read from the source in slices into the next free staging buffer and copied to
+ * the device with `cudaMemcpyAsync`; a staging buffer is only reused once its previous copy has
+ * completed. Reading slice N+1 from the source therefore overlaps the transfer of slice N, and
+ * the last transfers overlap whatever the caller does before the stream is synchronized.
+ *
+ * Ranges smaller than `min_staged_size` are copied directly from the source's host buffer, which
+ * avoids the cost of allocating pinned memory for small reads. The pinned buffers are allocated
+ * on first use. Ranges of at least `min_staged_size` bytes are read with `device_read` when the
+ * source supports direct device reads, bypassing host memory entirely.
+ */
+class staged_device_copier {
+ public:
+  static constexpr size_t default_buffer_size = 8 * 1024 * 1024;
+  static constexpr int default_num_buffers    = 3;
+  static constexpr size_t min_staged_size     = 1024 * 1024;
+
+  /**
+   * @brief Constructor
+   *
+   * @param stream CUDA stream used for the host-to-device copies
+   * @param buffer_size Size of each pinned staging buffer in bytes
+   * @param num_buffers Number of staging buffers in the ring
+   */
+  explicit staged_device_copier(cudaStream_t stream,
+                                size_t buffer_size = default_buffer_size,
+                                int num_buffers    = default_num_buffers);
+
+  /**
+   * @brief Waits for all pending copies, then releases the staging buffers
+   */
+  ~staged_device_copier();
+
+  staged_device_copier(staged_device_copier const &) = delete;
+  staged_device_copier &operator=(staged_device_copier const &) = delete;
+
+  /**
+   * @brief Enqueues a copy of `size` bytes at `offset` in `source` to device memory at `dst`
+   *
+   * The copy is ordered on the copier's stream; `dst` must not be read until the stream has been
+   * synchronized or a later operation on the same stream consumes it.
+   *
+   * @throw cudf::logic_error if the source has fewer than `offset + size` bytes
+   *
+   * @param source Data source to read from
+   * @param offset Byte offset in the source
+   * @param size Number of bytes to copy
+   * @param dst Device memory destination
+   */
+  void copy(datasource &source, size_t offset, size_t size, void *dst);
+
+  /**
+   * @brief Blocks until all enqueued copies have completed
+   */
+  void synchronize();
+
+ private:
+  struct staging_slot {
+    uint8_t *host     = nullptr;
+    cudaEvent_t event = nullptr;
+    bool pending      = false;
+  };
+
+  cudaStream_t _stream;
+  size_t _buffer_size;
+  std::vector<staging_slot> _slots;
+  size_t _next_slot = 0;
+  bool _allocated   = false;
+
+  void allocate();
+};
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
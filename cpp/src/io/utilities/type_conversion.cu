@@ -33,7 +33,7 @@ data_type convert_string_to_dtype(const std::string& dtype_in)
   std::transform(dtype_in.begin(), dtype_in.end(), dtype.begin(), [](unsigned char ch) {
     return static_cast<char>(std::tolower(ch));
   });
-  if (dtype == "str") return data_type(cudf::type_id::STRING);
+  if (dtype == "str" || dtype == "category") return data_type(cudf::type_id::STRING);
   if (dtype == "timestamp[s]") return data_type(cudf::type_id::TIMESTAMP_SECONDS);
   // backwards compat: "timestamp" defaults to milliseconds
   if (dtype == "timestamp[ms]" || dtype == "timestamp")
@@ -57,5 +57,18 @@ data_type convert_string_to_dtype(const std::string& dtype_in)
   return data_type(cudf::type_id::EMPTY);
 }
 
+/**
+ * @copydoc cudf::io:is_dictionary_dtype
+ *
+ **/
+bool is_dictionary_dtype(const std::string &dtype)
+{
+  std::string lower_dtype = dtype;
+  std::transform(dtype.begin(), dtype.end(), lower_dtype.begin(), [](unsigned char ch) {
+    return static_cast<char>(std::tolower(ch));
+  });
+  return lower_dtype == "category";
+}
+
 }  // namespace io
 }  // namespace cudf
@@ -27,5 +27,16 @@ namespace io {
  */
 data_type convert_string_to_dtype(const std::string &dtype);
 
+/**
+ * @brief Returns whether a dtype string requests a dictionary-encoded column
+ *
+ * A "category" column is read as strings, which are then dictionary encoded.
+ *
+ * @param[in] dtype The dtype string
+ *
+ * @return bool Whether the column is returned as a DICTIONARY32 column
+ */
+bool is_dictionary_dtype(const std::string &dtype);
+
 }  // namespace io
 }  // namespace cudf
@@ -24,6 +24,14 @@
 #include <unistd.h>
 #include <boost/filesystem.hpp>
 
+#include <algorithm>
+#include <cstdlib>
+#include <ctime>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
 #include <cuda.h>
 
 namespace cudf {
@@ -85,12 +93,155 @@ boost::filesystem::path getCacheDir()
   return kernel_cache_path;
 }
 
-cudfJitCache::cudfJitCache() {}
+/**
+ * @brief Get the paths to the read-only JITIFY kernel cache directories.
+ *
+ * The paths are listed in the environment variable named
+ * `LIBCUDF_KERNEL_CACHE_READONLY_PATH`, separated by `:`. Empty entries and
+ * directories that don't exist are skipped; the directories are never created.
+ **/
+std::vector<boost::filesystem::path> getReadOnlyCacheDirs()
+{
+  std::vector<boost::filesystem::path> cache_dirs;
+  auto readonly_path_env = std::getenv("LIBCUDF_KERNEL_CACHE_READONLY_PATH");
+  if (readonly_path_env == nullptr) { return cache_dirs; }
+
+  std::istringstream paths{readonly_path_env};
+  std::string path;
+  while (std::getline(paths, path, ':')) {
+    if (path.empty()) { continue; }
+    auto cache_dir = boost::filesystem::path(path) / std::string{CUDF_STRINGIFY(CUDF_VERSION)};
+    boost::system::error_code error;
+    if (boost::filesystem::is_directory(cache_dir, error)) { cache_dirs.push_back(cache_dir); }
+  }
+  return cache_dirs;
+}
+
+// Get a size limit in bytes from an environment variable, 0 (no limit) if it is unset
+std::size_t get_limit_from_env(char const* name)
+{
+  auto value = std::getenv(name);
+  return value != nullptr ? std::strtoull(value, nullptr, 10) : 0;
+}
+
+cudfJitCache::cudfJitCache()
+  : _memory_limit{get_limit_from_env("LIBCUDF_KERNEL_CACHE_LIMIT_MEMORY")},
+    _disk_limit{get_limit_from_env("LIBCUDF_KERNEL_CACHE_LIMIT_DISK")}
+{
+}
 
 cudfJitCache::~cudfJitCache() {}
 
 std::mutex cudfJitCache::_kernel_cache_mutex;
 std::mutex cudfJitCache::_program_cache_mutex;
+std::mutex cudfJitCache::_file_eviction_mutex;
+
+kernel_cache_statistics cudfJitCache::getStatistics() const
+{
+  kernel_cache_statistics statistics;
+  statistics.memory_hits    = _memory_hits;
+  statistics.file_hits      = _file_hits;
+  statistics.misses         = _misses;
+  statistics.evictions      = _evictions;
+  statistics.file_evictions = _file_evictions;
+  statistics.compile_time   = std::chrono::nanoseconds{_compile_time.load()};
+  return statistics;
+}
+
+void cudfJitCache::resetStatistics()
+{
+  _memory_hits    = 0;
+  _file_hits      = 0;
+  _misses         = 0;
+  _evictions      = 0;
+  _file_evictions = 0;
+  _compile_time   = 0;
+}
+
+void cudfJitCache::setLimits(std::size_t memory_limit, std::size_t disk_limit)
+{
+  // The limits are applied to the maps as they are next added to
+  _memory_limit = memory_limit;
+  _disk_limit   = disk_limit;
+}
+
+std::string cudfJitCache::cacheFileName(std::string const& name)
+{
+  // 64-bit FNV-1a, which unlike std::hash is the same in every process and build, keeps file
+  // names short whatever the length of the template arguments in `name`
+  uint64_t hash = 14695981039346656037ull;
+  for (unsigned char c : name) {
+    hash ^= c;
+    hash *= 1099511628211ull;
+  }
+  char file_name[17];
+  snprintf(file_name, sizeof(file_name), "%016llx", static_cast<unsigned long long>(hash));
+  return file_name;
+}
+
+bool cudfJitCache::readCacheFile(boost::filesystem::path const& file_name,
+                                 std::string const& name,
+                                 std::string& serialized)
+{
+  cacheFile file{file_name.string()};
+  auto content = file.read();
+  // The file starts with the name of the object, on its own line
+  if (not file.is_read_successful() or content.size() <= name.size() or
+      content.compare(0, name.size(), name) != 0 or content[name.size()] != '\n') {
+    return false;
+  }
+  serialized = content.substr(name.size() + 1);
+
+  // Mark the file as recently used, which fails harmlessly in read-only directories
+  boost::system::error_code error;
+  boost::filesystem::last_write_time(file_name, std::time(nullptr), error);
+  return true;
+}
+
+bool cudfJitCache::writeCacheFile(boost::filesystem::path const& file_name,
+                                  std::string const& name,
+                                  std::string const& serialized)
+{
+  cacheFile file{file_name.string()};
+  file.write(name + '\n' + serialized);
+  return file.is_write_successful();
+}
+
+void cudfJitCache::evictCacheFiles(boost::filesystem::path const& cache_dir)
+{
+  std::size_t const disk_limit = _disk_limit;
+  if (disk_limit == 0) { return; }
+
+  // Other processes may add or remove files meanwhile, which only makes the eviction approximate
+  std::lock_guard<std::mutex> lock(_file_eviction_mutex);
+  try {
+    std::vector<std::tuple<std::time_t, std::uintmax_t, boost::filesystem::path>> files;
+    std::uintmax_t total_size = 0;
+    for (auto const& entry : boost::filesystem::directory_iterator(cache_dir)) {
+      // Skip the files still being written
+      if (not boost::filesystem::is_regular_file(entry.status()) or
+          entry.path().extension() == ".tmp") {
+        continue;
+      }
+      auto const size = boost::filesystem::file_size(entry.path());
+      files.emplace_back(boost::filesystem::last_write_time(entry.path()), size, entry.path());
+      total_size += size;
+    }
+    if (total_size <= disk_limit) { return; }
+
+    std::sort(files.begin(), files.end());
+    for (auto const& file : files) {
+      if (total_size <= disk_limit) { break; }
+      boost::system::error_code error;
+      if (boost::filesystem::remove(std::get<2>(file), error)) {
+        total_size -= std::get<1>(file);
+        ++_file_evictions;
+      }
+    }
+  } catch (const std::exception& e) {
+    // if the cache directory can't be listed, leave it as it is
+  }
+}
 
 named_prog<jitify::experimental::Program> cudfJitCache::getProgram(
   std::string const& prog_name,
@@ -160,8 +311,8 @@ cudfJitCache::cacheFile::~cacheFile() {}
 
 std::string cudfJitCache::cacheFile::read()
 {
-  // Open file (duh)
-  int fd = open(_file_name.c_str(), O_RDWR);
+  // Open file for reading only, which also allows reading read-only cache directories
+  int fd = open(_file_name.c_str(), O_RDONLY);
   if (fd == -1) {
     successful_read = false;
     return std::string();
@@ -175,6 +326,7 @@ std::string cudfJitCache::cacheFile::read()
   // Lock the file descriptor. Only reading is allowed now
   if (fcntl(fd, F_SETLKW, &fl) == -1) {
     successful_read = false;
+    close(fd);
     return std::string();
   }
 
@@ -195,7 +347,6 @@ std::string cudfJitCache::cacheFile::read()
   if (fread(buffer, file_size, 1, fp) != 1) {
     successful_read = false;
     fclose(fp);
-    free(buffer);
     return std::string();
   }
   fclose(fp);
@@ -206,24 +357,15 @@ std::string cudfJitCache::cacheFile::read()
 
 void cudfJitCache::cacheFile::write(std::string content)
 {
-  // Open file and create if it doesn't exist, with access 0600
-  int fd = open(_file_name.c_str(), O_RDWR | O_CREAT, S_IRUSR | S_IWUSR);
+  // Write to a file of this process, with access 0600, and rename it to the cache file. Readers in
+  // other processes then see either the whole file or no file at all
+  std::string const temp_file_name = _file_name + '.' + std::to_string(getpid()) + ".tmp";
+  int fd = open(temp_file_name.c_str(), O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
   if (fd == -1) {
     successful_write = false;
     return;
   }
 
-  // Create args for file locking
-  flock fl{};
-  fl.l_type   = F_WRLCK;  // Exclusive lock for writing
-  fl.l_whence = SEEK_SET;
-
-  // Lock the file descriptor. we the only ones now
-  if (fcntl(fd, F_SETLKW, &fl) == -1) {
-    successful_write = false;
-    return;
-  }
-
   // Get file descriptor from file pointer
   FILE* fp = fdopen(fd, "wb");
 
@@ -231,13 +373,31 @@ void cudfJitCache::cacheFile::write(std::string content)
   if (fwrite(content.c_str(), content.length(), 1, fp) != 1) {
     successful_write = false;
     fclose(fp);
+    unlink(temp_file_name.c_str());
+    return;
+  }
+  if (fclose(fp) != 0 or rename(temp_file_name.c_str(), _file_name.c_str()) != 0) {
+    successful_write = false;
+    unlink(temp_file_name.c_str());
     return;
   }
-  fclose(fp);
 
   successful_write = true;
   return;
 }
 
 }  // namespace jit
+
+kernel_cache_statistics get_kernel_cache_statistics()
+{
+  return jit::cudfJitCache::Instance().getStatistics();
+}
+
+void reset_kernel_cache_statistics() { jit::cudfJitCache::Instance().resetStatistics(); }
+
+void set_kernel_cache_limits(std::size_t memory_limit, std::size_t disk_limit)
+{
+  jit::cudfJitCache::Instance().setLimits(memory_limit, disk_limit);
+}
+
 }  // namespace cudf
@@ -19,11 +19,16 @@
 
 #include <boost/filesystem.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/kernel_cache.hpp>
 #include <jitify.hpp>
+#include <atomic>
+#include <chrono>
+#include <list>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace cudf {
 namespace jit {
@@ -44,6 +49,19 @@ using named_prog = std::pair<std::string, std::shared_ptr<Tv>>;
  **/
 boost::filesystem::path getCacheDir();
 
+/**
+ * @brief Get the paths to the read-only JITIFY kernel cache directories.
+ *
+ * These are listed, separated by `:`, in the environment variable named
+ * `LIBCUDF_KERNEL_CACHE_READONLY_PATH`, and are searched for cached kernels
+ * after the directory returned by `getCacheDir()`. Kernels found there are
+ * never written back, so the directories can be shared by processes without
+ * write privileges, e.g. to ship kernels compiled ahead of time.
+ *
+ * As with `getCacheDir()`, each path is suffixed with `$CUDF_VERSION`.
+ **/
+std::vector<boost::filesystem::path> getReadOnlyCacheDirs();
+
 class cudfJitCache {
  public:
   /**
@@ -98,13 +116,58 @@ class cudfJitCache {
     std::vector<std::string> const& given_options          = {},
     jitify::experimental::file_callback_type file_callback = nullptr);
 
+  /**
+   * @brief Get the counters of this cache
+   *
+   **/
+  kernel_cache_statistics getStatistics() const;
+
+  /**
+   * @brief Reset the counters of this cache to zero
+   *
+   **/
+  void resetStatistics();
+
+  /**
+   * @brief Set the size limits of this cache, evicting the least recently used entries above them
+   *
+   * @param memory_limit maximum serialized size in bytes of the programs, and of the kernels of
+   *                     each CUDA context, held in memory, or 0 for no limit
+   * @param disk_limit   maximum size in bytes of the files in the cache directory, or 0 for no
+   *                     limit
+   **/
+  void setLimits(std::size_t memory_limit, std::size_t disk_limit);
+
  private:
+  /**
+   * @brief In-memory cache of named objects, ordered from the most recently used
+   *
+   **/
   template <typename Tv>
-  using umap_str_shptr = std::unordered_map<std::string, std::shared_ptr<Tv>>;
+  struct lru_map {
+    struct entry {
+      std::string name;
+      std::shared_ptr<Tv> value;
+      std::size_t size;
+    };
+    std::list<entry> entries;
+    std::unordered_map<std::string, typename std::list<entry>::iterator> index;
+    std::size_t size{0};
+  };
 
-  std::unordered_map<CUcontext, umap_str_shptr<jitify::experimental::KernelInstantiation>>
+  std::unordered_map<CUcontext, lru_map<jitify::experimental::KernelInstantiation>>
     kernel_inst_context_map;
-  umap_str_shptr<jitify::experimental::Program> program_map;
+  lru_map<jitify::experimental::Program> program_map;
+
+  std::atomic<std::size_t> _memory_limit{0};
+  std::atomic<std::size_t> _disk_limit{0};
+
+  std::atomic<std::size_t> _memory_hits{0};
+  std::atomic<std::size_t> _file_hits{0};
+  std::atomic<std::size_t> _misses{0};
+  std::atomic<std::size_t> _evictions{0};
+  std::atomic<std::size_t> _file_evictions{0};
+  std::atomic<std::chrono::nanoseconds::rep> _compile_time{0};
 
   /*
     Even though this class can be used as a non-singleton, the file cache
@@ -116,6 +179,7 @@ class cudfJitCache {
     */
   static std::mutex _kernel_cache_mutex;
   static std::mutex _program_cache_mutex;
+  static std::mutex _file_eviction_mutex;
 
  private:
   /**
@@ -162,41 +226,90 @@ class cudfJitCache {
   };
 
  private:
+  /**
+   * @brief Get the name of the cache file of an object, a fixed-length hash of its name
+   *
+   **/
+  static std::string cacheFileName(std::string const& name);
+
+  /**
+   * @brief Read the serialized object `name` from the cache file `file_name`
+   *
+   * @return true if the file exists and holds `name`, rather than another object whose name has
+   * the same hash
+   **/
+  static bool readCacheFile(boost::filesystem::path const& file_name,
+                            std::string const& name,
+                            std::string& serialized);
+
+  /**
+   * @brief Write the serialized object `name` to the cache file `file_name`
+   *
+   **/
+  static bool writeCacheFile(boost::filesystem::path const& file_name,
+                             std::string const& name,
+                             std::string const& serialized);
+
+  /**
+   * @brief Remove the least recently used files of `cache_dir` while it exceeds the disk limit
+   *
+   **/
+  void evictCacheFiles(boost::filesystem::path const& cache_dir);
+
   template <typename T, typename FallbackFunc>
-  named_prog<T> getCached(std::string const& name, umap_str_shptr<T>& map, FallbackFunc func)
+  named_prog<T> getCached(std::string const& name, lru_map<T>& map, FallbackFunc func)
   {
     // Find memory cached T object
-    auto it = map.find(name);
-    if (it != map.end()) {
-      return std::make_pair(name, it->second);
-    } else {  // Find file cached T object
-      bool successful_read = false;
-      std::string serialized;
+    auto it = map.index.find(name);
+    if (it != map.index.end()) {
+      map.entries.splice(map.entries.begin(), map.entries, it->second);
+      ++_memory_hits;
+      return std::make_pair(name, it->second->value);
+    }
+
+    // Find file cached T object
+    bool successful_read = false;
+    std::string serialized;
 #if defined(JITIFY_USE_CACHE)
-      boost::filesystem::path cache_dir = getCacheDir();
-      if (not cache_dir.empty()) {
-        boost::filesystem::path file_name = cache_dir / name;
-        cacheFile file{file_name.string()};
-        serialized      = file.read();
-        successful_read = file.is_read_successful();
-      }
+    std::string const file_name       = cacheFileName(name);
+    boost::filesystem::path cache_dir = getCacheDir();
+    if (not cache_dir.empty()) {
+      successful_read = readCacheFile(cache_dir / file_name, name, serialized);
+    }
+    for (auto const& readonly_dir : getReadOnlyCacheDirs()) {
+      if (successful_read) { break; }
+      successful_read = readCacheFile(readonly_dir / file_name, name, serialized);
+    }
 #endif
-      if (not successful_read) {
-        // JIT compile and write to file if possible
-        serialized = func().serialize();
+    if (successful_read) {
+      ++_file_hits;
+    } else {
+      // JIT compile and write to file if possible
+      auto const start = std::chrono::steady_clock::now();
+      serialized         = func().serialize();
+      auto const elapsed = std::chrono::steady_clock::now() - start;
+      _compile_time += std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+      ++_misses;
 #if defined(JITIFY_USE_CACHE)
-        if (not cache_dir.empty()) {
-          boost::filesystem::path file_name = cache_dir / name;
-          cacheFile file{file_name.string()};
-          file.write(serialized);
-        }
-#endif
+      if (not cache_dir.empty() and writeCacheFile(cache_dir / file_name, name, serialized)) {
+        evictCacheFiles(cache_dir);
       }
-      // Add deserialized T to cache and return
-      auto program = std::make_shared<T>(T::deserialize(serialized));
-      map[name]    = program;
-      return std::make_pair(name, program);
+#endif
+    }
+
+    // Add deserialized T to cache, evicting the least recently used objects above the limit
+    auto program = std::make_shared<T>(T::deserialize(serialized));
+    map.entries.push_front({name, program, serialized.size()});
+    map.index[name] = map.entries.begin();
+    map.size += serialized.size();
+    std::size_t const memory_limit = _memory_limit;
+    while (memory_limit > 0 and map.size > memory_limit and map.entries.size() > 1) {
+      map.size -= map.entries.back().size;
+      map.index.erase(map.entries.back().name);
+      map.entries.pop_back();
+      ++_evictions;
     }
+    return std::make_pair(name, program);
   }
 };
 
@@ -15,10 +15,14 @@
  */
 
 #include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/gather.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/repeat.hpp>
 #include <cudf/detail/reshape.hpp>
+#include <cudf/detail/transform.hpp>
 #include <cudf/filling.hpp>
 #include <cudf/join.hpp>
 #include <cudf/reshape.hpp>
@@ -27,6 +31,19 @@
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <vector>
+
 namespace cudf {
 namespace detail {
 /**
@@ -42,6 +59,9 @@ std::unique_ptr<cudf::table> cross_join(
 {
   CUDF_EXPECTS(0 != left.num_columns(), "Left table is empty");
   CUDF_EXPECTS(0 != right.num_columns(), "Right table is empty");
+  CUDF_EXPECTS(static_cast<int64_t>(left.num_rows()) * right.num_rows() <=
+                 std::numeric_limits<size_type>::max(),
+               "Cross join result has more rows than a column can hold");
 
   // If left or right table has no rows, return an empty table with all columns
   if ((0 == left.num_rows()) || (0 == right.num_rows())) {
@@ -68,8 +88,210 @@ std::unique_ptr<cudf::table> cross_join(
 
   return std::make_unique<table>(std::move(left_repeated_columns));
 }
+
+namespace {
+/**
+ * @brief The row of the left table of the joined row `first_row + i`
+ */
+struct left_row_fn {
+  int64_t first_row;
+  size_type num_right_rows;
+  __device__ size_type operator()(size_type i) const
+  {
+    return static_cast<size_type>((first_row + i) / num_right_rows);
+  }
+};
+
+/**
+ * @brief The row of the right table of the joined row `first_row + i`
+ */
+struct right_row_fn {
+  int64_t first_row;
+  size_type num_right_rows;
+  __device__ size_type operator()(size_type i) const
+  {
+    return static_cast<size_type>((first_row + i) % num_right_rows);
+  }
+};
+
+/**
+ * @brief Gathers the joined rows `first_row + offsets[i]` of the columns `left_columns` of
+ * `left` and `right_columns` of `right`
+ */
+template <typename OffsetIterator>
+std::unique_ptr<table> gather_joined_rows(table_view const& left,
+                                          std::vector<size_type> const& left_columns,
+                                          table_view const& right,
+                                          std::vector<size_type> const& right_columns,
+                                          int64_t first_row,
+                                          OffsetIterator offsets,
+                                          size_type size,
+                                          rmm::mr::device_memory_resource* mr,
+                                          cudaStream_t stream)
+{
+  std::vector<std::unique_ptr<column>> columns;
+  if (not left_columns.empty()) {
+    auto const left_rows =
+      thrust::make_transform_iterator(offsets, left_row_fn{first_row, right.num_rows()});
+    columns =
+      detail::gather(left.select(left_columns), left_rows, left_rows + size, false, mr, stream)
+        ->release();
+  }
+  if (not right_columns.empty()) {
+    auto const right_rows =
+      thrust::make_transform_iterator(offsets, right_row_fn{first_row, right.num_rows()});
+    auto right_gathered =
+      detail::gather(right.select(right_columns), right_rows, right_rows + size, false, mr, stream)
+        ->release();
+    std::move(right_gathered.begin(), right_gathered.end(), std::back_inserter(columns));
+  }
+  return std::make_unique<table>(std::move(columns));
+}
+
+/**
+ * @brief Returns the indices of the rows of a `BOOL8` column that are valid and true
+ */
+rmm::device_vector<size_type> true_rows(column_view const& mask, cudaStream_t stream)
+{
+  rmm::device_vector<size_type> rows(mask.size());
+  auto const d_mask = column_device_view::create(mask, stream);
+  auto const end    = thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                                   thrust::make_counting_iterator<size_type>(0),
+                                   thrust::make_counting_iterator<size_type>(mask.size()),
+                                   rows.begin(),
+                                   [d_mask = *d_mask] __device__(size_type i) {
+                                     return d_mask.is_valid(i) and d_mask.element<bool>(i);
+                                   });
+  rows.resize(thrust::distance(rows.begin(), end));
+  return rows;
+}
+
+std::vector<size_type> all_columns(table_view const& input)
+{
+  std::vector<size_type> indices(input.num_columns());
+  std::iota(indices.begin(), indices.end(), 0);
+  return indices;
+}
+
+}  // namespace
 }  // namespace detail
 
+class chunked_cross_join::impl {
+ public:
+  impl(table_view const& left,
+       table_view const& right,
+       size_type max_chunk_rows,
+       expression const* predicate)
+    : _left{left},
+      _right{right},
+      _max_chunk_rows{max_chunk_rows},
+      _predicate{predicate},
+      _num_rows{static_cast<int64_t>(left.num_rows()) * right.num_rows()}
+  {
+    CUDF_EXPECTS(0 != left.num_columns(), "Left table is empty");
+    CUDF_EXPECTS(0 != right.num_columns(), "Right table is empty");
+    CUDF_EXPECTS(max_chunk_rows > 0, "Chunks must have a positive number of rows");
+    if (predicate != nullptr) {
+      // The predicate refers to the columns of the joined table, of which only the types matter
+      std::vector<column_view> joined_columns;
+      for (auto const& col : cudf::slice(left, {0, 0})[0]) { joined_columns.push_back(col); }
+      for (auto const& col : cudf::slice(right, {0, 0})[0]) { joined_columns.push_back(col); }
+      for (auto const index : detail::expression_columns(table_view{joined_columns}, *predicate)) {
+        if (index < left.num_columns()) {
+          _predicate_left_columns.push_back(index);
+        } else {
+          _predicate_right_columns.push_back(index - left.num_columns());
+        }
+      }
+    }
+  }
+
+  bool has_next() const { return _next_row < _num_rows; }
+
+  std::unique_ptr<table> next(rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+  {
+    CUDF_EXPECTS(has_next(), "No rows left to return");
+    auto first_row = _next_row;
+    auto size = static_cast<size_type>(std::min<int64_t>(_max_chunk_rows, _num_rows - _next_row));
+    _next_row += size;
+    if (_predicate == nullptr) {
+      return detail::gather_joined_rows(_left,
+                                        detail::all_columns(_left),
+                                        _right,
+                                        detail::all_columns(_right),
+                                        first_row,
+                                        thrust::make_counting_iterator<size_type>(0),
+                                        size,
+                                        mr,
+                                        stream);
+    }
+
+    // Skip the windows without a selected row, but the last one
+    auto selected = select_rows(first_row, size, stream);
+    while (selected.empty() and has_next()) {
+      first_row = _next_row;
+      size      = static_cast<size_type>(std::min<int64_t>(_max_chunk_rows, _num_rows - _next_row));
+      _next_row += size;
+      selected = select_rows(first_row, size, stream);
+    }
+    return detail::gather_joined_rows(_left,
+                                      detail::all_columns(_left),
+                                      _right,
+                                      detail::all_columns(_right),
+                                      first_row,
+                                      selected.begin(),
+                                      static_cast<size_type>(selected.size()),
+                                      mr,
+                                      stream);
+  }
+
+ private:
+  /**
+   * @brief Returns the offsets from `first_row` of the `size` joined rows following it for which
+   * the predicate is true
+   */
+  rmm::device_vector<size_type> select_rows(int64_t first_row,
+                                            size_type size,
+                                            cudaStream_t stream) const
+  {
+    auto const values = detail::gather_joined_rows(_left,
+                                                   _predicate_left_columns,
+                                                   _right,
+                                                   _predicate_right_columns,
+                                                   first_row,
+                                                   thrust::make_counting_iterator<size_type>(0),
+                                                   size,
+                                                   rmm::mr::get_default_resource(),
+                                                   stream);
+    // Columns the predicate does not refer to are never read, so any column of the window's size
+    // stands in for them
+    auto const placeholder = make_numeric_column(
+      data_type{type_id::INT8}, size, mask_state::UNALLOCATED, stream);
+    std::vector<column_view> columns(_left.num_columns() + _right.num_columns(),
+                                     placeholder->view());
+    size_type value_index = 0;
+    for (auto const index : _predicate_left_columns) {
+      columns[index] = values->get_column(value_index++);
+    }
+    for (auto const index : _predicate_right_columns) {
+      columns[_left.num_columns() + index] = values->get_column(value_index++);
+    }
+    auto const mask = detail::compute_column(
+      table_view{columns}, *_predicate, rmm::mr::get_default_resource(), stream);
+    CUDF_EXPECTS(mask->type().id() == type_id::BOOL8, "Cross join predicate must be boolean");
+    return detail::true_rows(mask->view(), stream);
+  }
+
+  table_view const _left;
+  table_view const _right;
+  size_type const _max_chunk_rows;
+  expression const* _predicate;
+  int64_t const _num_rows;
+  int64_t _next_row{0};
+  std::vector<size_type> _predicate_left_columns;
+  std::vector<size_type> _predicate_right_columns;
+};
+
 std::unique_ptr<cudf::table> cross_join(cudf::table_view const& left,
                                         cudf::table_view const& right,
                                         rmm::mr::device_memory_resource* mr)
@@ -78,4 +300,22 @@ std::unique_ptr<cudf::table> cross_join(cudf::table_view const& left,
   return detail::cross_join(left, right, 0, mr);
 }
 
+chunked_cross_join::chunked_cross_join(table_view const& left,
+                                       table_view const& right,
+                                       size_type max_chunk_rows,
+                                       expression const* predicate)
+  : _impl{std::make_unique<impl>(left, right, max_chunk_rows, predicate)}
+{
+}
+
+chunked_cross_join::~chunked_cross_join() = default;
+
+bool chunked_cross_join::has_next() const { return _impl->has_next(); }
+
+std::unique_ptr<table> chunked_cross_join::next(rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return _impl->next(mr, 0);
+}
+
 }  // namespace cudf
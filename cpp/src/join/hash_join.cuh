@@ -15,7 +15,12 @@
  */
 #pragma once
 
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/prefetch.hpp>
+#include <cudf/detail/utilities/scratch_allocator.cuh>
+#include <cudf/join.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/table/table.hpp>
@@ -26,134 +31,85 @@
 #include "join_common_utils.hpp"
 #include "join_kernels.cuh"
 
+#include <thrust/scan.h>
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <vector>
+
 namespace cudf {
 namespace detail {
 /**
- * @brief Gives an estimate of the size of the join output produced when
- * joining two tables together.
+ * @brief Returns the launch configuration of a kernel that processes each of `num_rows` rows with
+ * a tile of threads of the join hash table
  *
- * If the two tables are of relatively equal size, then the returned output
- * size will be the exact output size. However, if the probe table is
- * significantly larger than the build table, then we attempt to estimate the
- * output size by using only a subset of the rows in the probe table.
+ * The kernels loop over the rows, so the grid is capped to keep the thread count in range.
+ */
+inline detail::grid_1d hash_table_grid(size_type num_rows)
+{
+  constexpr size_type tile_size{multimap_type::device_view::tile_size};
+  auto const max_rows = std::numeric_limits<size_type>::max() / tile_size;
+  return detail::grid_1d(std::min(num_rows, max_rows) * tile_size, DEFAULT_JOIN_BLOCK_SIZE);
+}
+
+/**
+ * @brief Computes the exact size of the join output produced when joining
+ * two tables together, and the offset of the output rows of each probe row.
  *
- * @throw cudf::logic_error if JoinKind is not INNER_JOIN or LEFT_JOIN
+ * The hash table is probed with every row of the probe table and the matches
+ * are counted without writing any output, so the output of the join can be
+ * allocated exactly and written by a single probe.
  *
  * @tparam JoinKind The type of join to be performed
- * @tparam multimap_type The type of the hash table
  *
  * @param build_table The right hand table
  * @param probe_table The left hand table
  * @param hash_table A hash table built on the build table that maps the index
  * of every row to the hash value of that row.
- * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param equality Compares a row of the probe table with a row of the build table
+ * @param[out] output_offsets The offset of the output rows of each probe row
  * @param stream CUDA stream used for device memory operations and kernel launches
  *
- * @return An estimate of the size of the output of the join operation
+ * @return The size of the output of the join operation
  */
-template <join_kind JoinKind, typename multimap_type>
-size_type estimate_join_output_size(table_device_view build_table,
-                                    table_device_view probe_table,
-                                    multimap_type const& hash_table,
-                                    null_equality compare_nulls,
-                                    cudaStream_t stream)
+template <join_kind JoinKind, typename Equality>
+size_type compute_join_output_offsets(table_device_view build_table,
+                                      table_device_view probe_table,
+                                      multimap_type::device_view hash_table,
+                                      Equality const& equality,
+                                      scratch_vector<size_type>& output_offsets,
+                                      cudaStream_t stream)
 {
   const size_type build_table_num_rows{build_table.num_rows()};
   const size_type probe_table_num_rows{probe_table.num_rows()};
 
-  // If the probe table is significantly larger (5x) than the build table,
-  // then we attempt to only use a subset of the probe table rows to compute an
-  // estimate of the join output size.
-  size_type probe_to_build_ratio{0};
-  if (build_table_num_rows > 0) {
-    probe_to_build_ratio = static_cast<size_type>(
-      std::ceil(static_cast<float>(probe_table_num_rows) / build_table_num_rows));
-  } else {
-    // If the build table is empty, we know exactly how large the output
-    // will be for the different types of joins and can return immediately
-    switch (JoinKind) {
-      // Inner join with an empty table will have no output
-      case join_kind::INNER_JOIN: return 0;
-
-      // Left join with an empty table will have an output of NULL rows
-      // equal to the number of rows in the probe table
-      case join_kind::LEFT_JOIN: return probe_table_num_rows;
-
-      default: CUDF_FAIL("Unsupported join type");
-    }
+  // Inner join with an empty table will have no output
+  if (probe_table_num_rows == 0 ||
+      (JoinKind == join_kind::INNER_JOIN && build_table_num_rows == 0)) {
+    return 0;
   }
 
-  size_type sample_probe_num_rows{probe_table_num_rows};
-  constexpr size_type MAX_RATIO{5};
-  if (probe_to_build_ratio > MAX_RATIO) { sample_probe_num_rows = build_table_num_rows; }
+  // The last element receives the total size of the output
+  output_offsets.resize(probe_table_num_rows + 1);
 
-  // Allocate storage for the counter used to get the size of the join output
-  size_type h_size_estimate{0};
-  rmm::device_scalar<size_type> size_estimate(0, stream);
+  auto const config = hash_table_grid(probe_table_num_rows);
 
+  row_hash hash_probe{probe_table};
+  // Probe the hash table without actually building the output to simply
+  // find what the size of the output will be.
+  compute_join_output_size<JoinKind>
+    <<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
+      hash_table, hash_probe, equality, probe_table_num_rows, output_offsets.data().get());
   CHECK_CUDA(stream);
 
-  constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
-  int numBlocks{-1};
-
-  CUDA_TRY(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
-    &numBlocks, compute_join_output_size<JoinKind, multimap_type, block_size>, block_size, 0));
-
-  int dev_id{-1};
-  CUDA_TRY(cudaGetDevice(&dev_id));
-
-  int num_sms{-1};
-  CUDA_TRY(cudaDeviceGetAttribute(&num_sms, cudaDevAttrMultiProcessorCount, dev_id));
-
-  // Continue probing with a subset of the probe table until either:
-  // a non-zero output size estimate is found OR
-  // all of the rows in the probe table have been sampled
-  do {
-    sample_probe_num_rows = std::min(sample_probe_num_rows, probe_table_num_rows);
-
-    size_estimate.set_value(0);
-
-    row_hash hash_probe{probe_table};
-    row_equality equality{probe_table, build_table, compare_nulls == null_equality::EQUAL};
-    // Probe the hash table without actually building the output to simply
-    // find what the size of the output will be.
-    compute_join_output_size<JoinKind, multimap_type, block_size>
-      <<<numBlocks * num_sms, block_size, 0, stream>>>(hash_table,
-                                                       build_table,
-                                                       probe_table,
-                                                       hash_probe,
-                                                       equality,
-                                                       sample_probe_num_rows,
-                                                       size_estimate.data());
-    CHECK_CUDA(stream);
-
-    // Only in case subset of probe table is chosen,
-    // increase the estimated output size by a factor of the ratio between the
-    // probe and build tables
-    if (sample_probe_num_rows < probe_table_num_rows) {
-      h_size_estimate = size_estimate.value() * probe_to_build_ratio;
-    } else {
-      h_size_estimate = size_estimate.value();
-    }
-
-    // If the size estimate is non-zero, then we have a valid estimate and can break
-    // If sample_probe_num_rows >= probe_table_num_rows, then we've sampled the entire
-    // probe table, in which case the estimate is exact and we can break
-    if ((h_size_estimate > 0) || (sample_probe_num_rows >= probe_table_num_rows)) { break; }
-
-    // If the size estimate is zero, then double the number of sampled rows in the probe
-    // table. Reduce the ratio of the number of probe rows sampled to the number of rows
-    // in the build table by the same factor
-    if (0 == h_size_estimate) {
-      constexpr size_type GROW_RATIO{2};
-      sample_probe_num_rows *= GROW_RATIO;
-      probe_to_build_ratio =
-        static_cast<size_type>(std::ceil(static_cast<float>(probe_to_build_ratio) / GROW_RATIO));
-    }
-
-  } while (true);
-
-  return h_size_estimate;
+  thrust::exclusive_scan(scratch_policy(stream)->on(stream),
+                         output_offsets.begin(),
+                         output_offsets.end(),
+                         output_offsets.begin());
+
+  return output_offsets.back();
 }
 
 /**
@@ -172,15 +128,120 @@ get_trivial_left_join_indices(table_view const& left, cudaStream_t stream)
 {
   rmm::device_vector<size_type> left_indices(left.num_rows());
   thrust::sequence(
-    rmm::exec_policy(stream)->on(stream), left_indices.begin(), left_indices.end(), 0);
+    scratch_policy(stream)->on(stream), left_indices.begin(), left_indices.end(), 0);
   rmm::device_vector<size_type> right_indices(left.num_rows());
-  thrust::fill(rmm::exec_policy(stream)->on(stream),
+  thrust::fill(scratch_policy(stream)->on(stream),
                right_indices.begin(),
                right_indices.end(),
                JoinNoneValue);
   return std::make_pair(std::move(left_indices), std::move(right_indices));
 }
 
+/**
+ * @brief Builds the hash table of a join, which maps the hash value of every
+ * row of the build table to the index of that row.
+ *
+ * @throw cudf::logic_error if the hash table insert fails
+ *
+ * @param build_table The table to build the hash table from
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param row_bitmask Bitmask of the rows to insert, or nullptr to insert every row
+ * @param mr Device memory resource used to allocate the hash table
+ *
+ * @return The hash table built on `build_table`
+ */
+inline std::unique_ptr<multimap_type> build_join_hash_table(
+  table_device_view build_table,
+  cudaStream_t stream,
+  bitmask_type const* row_bitmask     = nullptr,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource())
+{
+  const size_type build_table_num_rows{build_table.num_rows()};
+  // Every inserted row takes a slot, duplicate keys included, so the map is sized for the rows
+  // that are inserted rather than for all the rows of the build table
+  auto const num_inserted_rows =
+    (row_bitmask == nullptr or build_table_num_rows == 0)
+      ? build_table_num_rows
+      : segmented_count_set_bits(row_bitmask, {0, build_table_num_rows}, stream).front();
+  auto hash_table = std::make_unique<multimap_type>(num_inserted_rows,
+                                                    DEFAULT_HASH_TABLE_OCCUPANCY / 100.0,
+                                                    std::numeric_limits<hash_value_type>::max(),
+                                                    stream,
+                                                    mr);
+
+  if (build_table_num_rows > 0) {
+    row_hash hash_build{build_table};
+    rmm::device_scalar<int> failure(0, stream);
+    auto const config = hash_table_grid(build_table_num_rows);
+    build_hash_table<<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
+      hash_table->to_device(), hash_build, build_table_num_rows, row_bitmask, failure.data());
+    // Check error code from the kernel
+    if (failure.value() == 1) { CUDF_FAIL("Hash Table insert failure."); }
+  }
+  return hash_table;
+}
+
+/**
+ * @brief Probes the hash table of a join with the rows of the probe table and
+ * returns the output indices of the probe and build tables
+ *
+ * @tparam JoinKind The type of join to be performed
+ *
+ * @param build_table The table the hash table was built on
+ * @param probe_table The table to probe the hash table with
+ * @param hash_table The hash table built on `build_table`
+ * @param flip_join_indices Flag that indicates whether the output indices of the probe table
+ * should be returned second, as when the left and right tables have been flipped
+ * @param equality Compares a row of the probe table with a row of the build table, as chosen by
+ * `dispatch_row_equality_comparator`
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return Join output indices vector pair
+ */
+template <join_kind JoinKind, typename Equality>
+std::enable_if_t<(JoinKind == join_kind::INNER_JOIN || JoinKind == join_kind::LEFT_JOIN),
+                 std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>>>
+probe_join_hash_table(table_device_view build_table,
+                      table_device_view probe_table,
+                      multimap_type::device_view hash_table,
+                      bool flip_join_indices,
+                      Equality const& equality,
+                      cudaStream_t stream)
+{
+  scratch_vector<size_type> output_offsets;
+  size_type const join_size = compute_join_output_offsets<JoinKind>(
+    build_table, probe_table, hash_table, equality, output_offsets, stream);
+
+  // If the output size is zero, return immediately
+  if (join_size == 0) {
+    return std::make_pair(rmm::device_vector<size_type>{}, rmm::device_vector<size_type>{});
+  }
+
+  // The output size is exact, so a single probe writes the whole output
+  rmm::device_vector<size_type> left_indices(join_size);
+  rmm::device_vector<size_type> right_indices(join_size);
+
+  auto const config = hash_table_grid(probe_table.num_rows());
+
+  row_hash hash_probe{probe_table};
+  const auto& join_output_l =
+    flip_join_indices ? right_indices.data().get() : left_indices.data().get();
+  const auto& join_output_r =
+    flip_join_indices ? left_indices.data().get() : right_indices.data().get();
+  probe_hash_table<JoinKind><<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
+    hash_table,
+    hash_probe,
+    equality,
+    probe_table.num_rows(),
+    output_offsets.data().get(),
+    join_output_l,
+    join_output_r);
+
+  CHECK_CUDA(stream);
+
+  return std::make_pair(std::move(left_indices), std::move(right_indices));
+}
+
 /**
  * @brief Computes the join operation between two tables and returns the
  * output indices of left and right table as a combined table
@@ -215,88 +276,105 @@ get_base_hash_join_indices(table_view const& left,
     return get_trivial_left_join_indices(left, stream);
   }
 
+  // Every probe reads the build rows, migrate them once if they are managed memory
+  prefetch(right, stream);
+  prefetch(left, stream);
   auto build_table = table_device_view::create(right, stream);
-  const size_type build_table_num_rows{build_table->num_rows()};
 
   // Probe with the left table
   auto probe_table = table_device_view::create(left, stream);
 
-  size_t const hash_table_size = compute_hash_table_size(build_table_num_rows);
-
-  auto hash_table = multimap_type::create(hash_table_size,
-                                          true,
-                                          multimap_type::hasher(),
-                                          multimap_type::key_equal(),
-                                          multimap_type::allocator_type(),
-                                          stream);
-
-  // build the hash table
-  if (build_table_num_rows > 0) {
-    row_hash hash_build{*build_table};
-    rmm::device_scalar<int> failure(0, stream);
-    constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
-    detail::grid_1d config(build_table_num_rows, block_size);
-    build_hash_table<<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
-      *hash_table, hash_build, build_table_num_rows, failure.data());
-    // Check error code from the kernel
-    if (failure.value() == 1) { CUDF_FAIL("Hash Table insert failure."); }
-  }
-
-  size_type estimated_size = estimate_join_output_size<JoinKind, multimap_type>(
-    *build_table, *probe_table, *hash_table, compare_nulls, stream);
-
-  // If the estimated output size is zero, return immediately
-  if (estimated_size == 0) {
-    return std::make_pair(rmm::device_vector<size_type>{}, rmm::device_vector<size_type>{});
-  }
-
-  // Because we are approximating the number of joined elements, our approximation
-  // might be incorrect and we might have underestimated the number of joined elements.
-  // As such we will need to de-allocate memory and re-allocate memory to ensure
-  // that the final output is correct.
-  rmm::device_scalar<size_type> write_index(0, stream);
-  size_type join_size{0};
-
-  rmm::device_vector<size_type> left_indices;
-  rmm::device_vector<size_type> right_indices;
-  auto current_estimated_size = estimated_size;
-  do {
-    left_indices.resize(estimated_size);
-    right_indices.resize(estimated_size);
-
-    constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
-    detail::grid_1d config(probe_table->num_rows(), block_size);
-    write_index.set_value(0);
-
-    row_hash hash_probe{*probe_table};
-    row_equality equality{*probe_table, *build_table, compare_nulls == null_equality::EQUAL};
-    const auto& join_output_l =
-      flip_join_indices ? right_indices.data().get() : left_indices.data().get();
-    const auto& join_output_r =
-      flip_join_indices ? left_indices.data().get() : right_indices.data().get();
-    probe_hash_table<JoinKind, multimap_type, block_size, DEFAULT_JOIN_CACHE_SIZE>
-      <<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(*hash_table,
-                                                                       *build_table,
-                                                                       *probe_table,
-                                                                       hash_probe,
-                                                                       equality,
-                                                                       join_output_l,
-                                                                       join_output_r,
-                                                                       write_index.data(),
-                                                                       estimated_size);
-
-    CHECK_CUDA(stream);
-
-    join_size              = write_index.value();
-    current_estimated_size = estimated_size;
-    estimated_size *= 2;
-  } while ((current_estimated_size < join_size));
-
-  left_indices.resize(join_size);
-  right_indices.resize(join_size);
-  return std::make_pair(std::move(left_indices), std::move(right_indices));
+  // Build rows with a null key match nothing when nulls are unequal, so only the rows
+  // valid in the AND of the key null masks are inserted
+  auto const build_row_mask = (compare_nulls == null_equality::UNEQUAL && has_nulls(right))
+                                ? bitmask_and(right, scratch_resource(), stream)
+                                : rmm::device_buffer{0, stream};
+  // The hash table is a temporary of the join, unlike the one of a `hash_join` object
+  auto hash_table = build_join_hash_table(*build_table,
+                                          stream,
+                                          static_cast<bitmask_type const*>(build_row_mask.data()),
+                                          scratch_resource());
+
+  return dispatch_row_equality_comparator(
+    left,
+    right,
+    *probe_table,
+    *build_table,
+    compare_nulls == null_equality::EQUAL,
+    [&](auto const& equality) {
+      return probe_join_hash_table<JoinKind>(
+        *build_table, *probe_table, hash_table->to_device(), flip_join_indices, equality, stream);
+    });
 }
 
 }  // namespace detail
 
+/**
+ * @brief Hash table built on the join columns of a build table, shared by the
+ * joins of a `cudf::hash_join`
+ */
+struct hash_join::hash_join_impl {
+ public:
+  hash_join_impl() = delete;
+  ~hash_join_impl();
+  hash_join_impl(hash_join_impl const&) = delete;
+  hash_join_impl(hash_join_impl&&)      = delete;
+  hash_join_impl& operator=(hash_join_impl const&) = delete;
+  hash_join_impl& operator=(hash_join_impl&&) = delete;
+
+ private:
+  cudf::table_view _build;
+  std::vector<size_type> _build_on;
+  std::unique_ptr<table_device_view, std::function<void(table_device_view*)>> _build_table;
+  std::unique_ptr<detail::multimap_type> _hash_table;
+
+ public:
+  /**
+   * @brief Builds the hash table on the join columns of `build`
+   *
+   * @param build The build table
+   * @param build_on The column indices from `build` to join on
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  hash_join_impl(cudf::table_view const& build,
+                 std::vector<size_type> const& build_on,
+                 cudaStream_t stream = 0);
+
+  std::pair<std::unique_ptr<column>, std::unique_ptr<column>> inner_join(
+    cudf::table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    null_equality compare_nulls,
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream = 0) const;
+
+  std::pair<std::unique_ptr<column>, std::unique_ptr<column>> left_join(
+    cudf::table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    null_equality compare_nulls,
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream = 0) const;
+
+  std::pair<std::unique_ptr<column>, std::unique_ptr<column>> full_join(
+    cudf::table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    null_equality compare_nulls,
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream = 0) const;
+
+ private:
+  /**
+   * @brief Probes the hash table with the join columns of `probe`
+   *
+   * @tparam JoinKind The type of join to be performed, INNER_JOIN or LEFT_JOIN
+   *
+   * @return Pair of vectors with the indices of the probe and build tables
+   */
+  template <cudf::detail::join_kind JoinKind>
+  std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>> probe_join_indices(
+    cudf::table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    null_equality compare_nulls,
+    cudaStream_t stream) const;
+};
+
 }  // namespace cudf
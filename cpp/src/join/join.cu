@@ -13,14 +13,23 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/concatenate.cuh>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
+#include <cudf/detail/hashing.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sequence.cuh>
+#include <cudf/detail/utilities/prefetch.hpp>
+#include <cudf/dictionary/detail/update_keys.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/join.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/error.hpp>
 
 #include "cudf/detail/utilities/cuda.cuh"
@@ -29,6 +38,12 @@
 #include "join_common_utils.hpp"
 #include "nested_loop_join.cuh"
 
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/logical.h>
+#include <thrust/transform.h>
+
 namespace cudf {
 namespace detail {
 
@@ -180,6 +195,103 @@ get_left_join_indices_complement(rmm::device_vector<size_type>& right_indices,
   return std::make_pair(std::move(left_invalid_indices), std::move(right_indices_complement));
 }
 
+/**
+ * @brief Checks that two tables can be joined on all of their columns
+ *
+ * @throw cudf::logic_error if `left` or `right` table is empty
+ * @throw cudf::logic_error if types do not match between joining columns
+ *
+ * @param left  Table of left columns to join
+ * @param right Table of right columns to join
+ */
+void validate_join_keys(table_view const& left, table_view const& right)
+{
+  CUDF_EXPECTS(0 != left.num_columns(), "Selected left dataset is empty");
+  CUDF_EXPECTS(0 != right.num_columns(), "Selected right dataset is empty");
+  CUDF_EXPECTS(std::equal(std::cbegin(left),
+                          std::cend(left),
+                          std::cbegin(right),
+                          std::cend(right),
+                          [](const auto& l, const auto& r) { return l.type() == r.type(); }),
+               "Mismatch in joining column data types");
+}
+
+/**
+ * @brief Join keys whose dictionary columns have the same keys on both sides
+ */
+struct matched_join_keys {
+  std::vector<std::unique_ptr<column>> owner;  ///< Re-encoded dictionary columns, if any
+  table_view left;                             ///< Left keys using the re-encoded columns
+  table_view right;                            ///< Right keys using the re-encoded columns
+};
+
+/**
+ * @brief Re-encodes the dictionary columns of two tables of join keys with the union of
+ * their keys.
+ *
+ * The join hashes and compares dictionary rows by their indices, which identify the same values
+ * in both tables only when both columns have the same keys. Columns already sharing the same
+ * keys are not copied, so `owner` is empty when nothing needed re-encoding.
+ *
+ * @param left  Table of left columns to join
+ * @param right Table of right columns to join, with the same column types as `left`
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+matched_join_keys match_dictionary_join_keys(table_view const& left,
+                                             table_view const& right,
+                                             cudaStream_t stream)
+{
+  matched_join_keys result;
+  std::vector<column_view> left_columns(left.begin(), left.end());
+  std::vector<column_view> right_columns(right.begin(), right.end());
+  for (size_type i = 0; i < left.num_columns(); ++i) {
+    if (left.column(i).type().id() != type_id::DICTIONARY32) { continue; }
+    auto matched = dictionary::detail::match_dictionaries(
+      {left.column(i), right.column(i)}, rmm::mr::get_default_resource(), stream);
+    left_columns[i]  = matched.second[0];
+    right_columns[i] = matched.second[1];
+    std::move(matched.first.begin(), matched.first.end(), std::back_inserter(result.owner));
+  }
+  result.left  = table_view{left_columns};
+  result.right = table_view{right_columns};
+  return result;
+}
+
+/**
+ * @brief Returns whether the dictionary columns of two tables of join keys have equal keys.
+ *
+ * The keys are compared by value, so the columns need not share the memory of their keys.
+ *
+ * @param left  Table of left columns to join
+ * @param right Table of right columns to join, with the same column types as `left`
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+bool have_same_dictionary_keys(table_view const& left,
+                               table_view const& right,
+                               cudaStream_t stream)
+{
+  for (size_type i = 0; i < left.num_columns(); ++i) {
+    if (left.column(i).type().id() != type_id::DICTIONARY32) { continue; }
+    // empty dictionaries have no keys, and match any other
+    if (left.column(i).size() == 0 || right.column(i).size() == 0) { continue; }
+    auto const left_keys  = dictionary_column_view(left.column(i)).keys();
+    auto const right_keys = dictionary_column_view(right.column(i)).keys();
+    if (!(left_keys.type() == right_keys.type()) || left_keys.size() != right_keys.size()) {
+      return false;
+    }
+    auto const d_left  = table_device_view::create(table_view{{left_keys}}, stream);
+    auto const d_right = table_device_view::create(table_view{{right_keys}}, stream);
+    row_equality_comparator<false> equal(*d_left, *d_right);
+    if (!thrust::all_of(rmm::exec_policy(stream)->on(stream),
+                        thrust::make_counting_iterator<size_type>(0),
+                        thrust::make_counting_iterator<size_type>(left_keys.size()),
+                        [equal] __device__(size_type row) { return equal(row, row); })) {
+      return false;
+    }
+  }
+  return true;
+}
+
 /**
  * @brief Computes the base join operation between two tables and returns the
  * output indices of left and right table as a combined table, i.e. if full
@@ -199,20 +311,18 @@ get_left_join_indices_complement(rmm::device_vector<size_type>& right_indices,
  */
 template <join_kind JoinKind>
 std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>> get_base_join_indices(
-  table_view const& left, table_view const& right, null_equality compare_nulls, cudaStream_t stream)
+  table_view const& left,
+  table_view const& right,
+  null_equality compare_nulls,
+  cudaStream_t stream)
 {
-  CUDF_EXPECTS(0 != left.num_columns(), "Selected left dataset is empty");
-  CUDF_EXPECTS(0 != right.num_columns(), "Selected right dataset is empty");
-  CUDF_EXPECTS(std::equal(std::cbegin(left),
-                          std::cend(left),
-                          std::cbegin(right),
-                          std::cend(right),
-                          [](const auto& l, const auto& r) { return l.type() == r.type(); }),
-               "Mismatch in joining column data types");
+  validate_join_keys(left, right);
+  auto const keys = match_dictionary_join_keys(left, right, stream);
 
   constexpr join_kind BaseJoinKind =
     (JoinKind == join_kind::FULL_JOIN) ? join_kind::LEFT_JOIN : JoinKind;
-  return get_base_hash_join_indices<BaseJoinKind>(left, right, false, compare_nulls, stream);
+  return get_base_hash_join_indices<BaseJoinKind>(
+    keys.left, keys.right, false, compare_nulls, stream);
 }
 
 /**
@@ -438,8 +548,510 @@ std::unique_ptr<table> join_call_compute_df(
     left, right, joined_indices, columns_in_common, mr, stream);
 }
 
+std::unique_ptr<column> make_gather_map_column(rmm::device_vector<size_type> const& indices,
+                                               rmm::mr::device_memory_resource* mr,
+                                               cudaStream_t stream)
+{
+  auto gather_map = make_numeric_column(data_type(type_to_id<size_type>()),
+                                        static_cast<size_type>(indices.size()),
+                                        mask_state::UNALLOCATED,
+                                        stream,
+                                        mr);
+  CUDA_TRY(cudaMemcpyAsync(gather_map->mutable_view().data<size_type>(),
+                           indices.data().get(),
+                           indices.size() * sizeof(size_type),
+                           cudaMemcpyDeviceToDevice,
+                           stream));
+  return gather_map;
+}
+
+/**
+ * @brief Computes the join indices of two tables and returns them as gather maps
+ *
+ * @tparam JoinKind The type of join to be performed
+ *
+ * @param left_keys The join columns of the left table
+ * @param right_keys The join columns of the right table
+ * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return Gather maps of the left and right tables
+ */
+template <join_kind JoinKind>
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> join_call_compute_indices(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream = 0)
+{
+  auto joined_indices =
+    get_base_join_indices<JoinKind>(left_keys, right_keys, compare_nulls, stream);
+  if (JoinKind == join_kind::FULL_JOIN) {
+    auto complement_indices = get_left_join_indices_complement(
+      joined_indices.second, left_keys.num_rows(), right_keys.num_rows(), stream);
+    joined_indices = concatenate_vector_pairs(joined_indices, complement_indices);
+  }
+  return std::make_pair(make_gather_map_column(joined_indices.first, mr, stream),
+                        make_gather_map_column(joined_indices.second, mr, stream));
+}
+
+/**
+ * @brief Maps the row indices of a partition to the row indices of the table it was
+ * partitioned from
+ */
+struct partition_to_table_index {
+  size_type const* table_rows;
+
+  __device__ size_type operator()(size_type index) const
+  {
+    return index == JoinNoneValue ? JoinNoneValue : table_rows[index];
+  }
+};
+
+/**
+ * @brief Returns the number of partitions for which the hash table of each partition of the
+ * build table fits in half of the L2 cache, leaving the other half to the probe table
+ *
+ * @param build_num_rows The number of rows of the build table
+ */
+size_type default_num_join_partitions(size_type build_num_rows)
+{
+  int dev_id{-1};
+  CUDA_TRY(cudaGetDevice(&dev_id));
+  int l2_size{0};
+  CUDA_TRY(cudaDeviceGetAttribute(&l2_size, cudaDevAttrL2CacheSize, dev_id));
+
+  auto const hash_table_size =
+    compute_hash_table_size(build_num_rows) * (sizeof(hash_value_type) + sizeof(size_type));
+  auto const partition_size = std::max<size_t>(l2_size / 2, 1);
+  return static_cast<size_type>(
+    std::max<size_t>(1, (hash_table_size + partition_size - 1) / partition_size));
+}
+
+/**
+ * @brief Hash partitions the join keys of a table, together with the index of each row
+ *
+ * @param keys The join keys
+ * @param num_partitions The number of partitions
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return The partitioned table, whose last column holds the row indices in `keys`, and the
+ * offsets of the partitions
+ */
+std::pair<std::unique_ptr<table>, std::vector<size_type>> partition_join_keys(
+  table_view const& keys, size_type num_partitions, cudaStream_t stream)
+{
+  auto row_indices = affine_sequence<size_type>{0, 1, keys.num_rows()}.materialize(
+    rmm::mr::get_default_resource(), stream);
+
+  std::vector<column_view> columns(keys.begin(), keys.end());
+  columns.push_back(row_indices->view());
+  std::vector<size_type> key_columns(keys.num_columns());
+  std::iota(key_columns.begin(), key_columns.end(), 0);
+  return hash_partition(
+    table_view{columns}, key_columns, num_partitions, rmm::mr::get_default_resource(), stream);
+}
+
+/**
+ * @brief Returns the bounds of each partition, in the format expected by `cudf::slice`
+ *
+ * @param offsets The offsets of the partitions, empty if the partitioned table is empty
+ * @param num_partitions The number of partitions
+ * @param num_rows The number of rows of the partitioned table
+ */
+std::vector<size_type> partition_bounds(std::vector<size_type> const& offsets,
+                                        size_type num_partitions,
+                                        size_type num_rows)
+{
+  std::vector<size_type> bounds;
+  for (size_type p = 0; p < num_partitions; ++p) {
+    if (offsets.empty()) {
+      bounds.insert(bounds.end(), {0, 0});
+    } else {
+      bounds.push_back(offsets[p]);
+      bounds.push_back(p + 1 < num_partitions ? offsets[p + 1] : num_rows);
+    }
+  }
+  return bounds;
+}
+
+/**
+ * @brief Computes the join indices of two tables by joining the matching hash partitions of
+ * the tables pairwise, and returns them as gather maps
+ *
+ * Rows with equal keys always land in the same partition, so the unmatched rows of a partition
+ * are unmatched in the whole table.
+ *
+ * @tparam JoinKind The type of join to be performed
+ *
+ * @param left_keys The join columns of the left table
+ * @param right_keys The join columns of the right table
+ * @param num_partitions The number of partitions, or 0 to fit each partition of the hash table
+ * in the L2 cache
+ * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return Gather maps of the left and right tables
+ */
+template <join_kind JoinKind>
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> partitioned_join_indices(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  size_type num_partitions,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream = 0)
+{
+  CUDF_EXPECTS(num_partitions >= 0, "Invalid number of partitions");
+  validate_join_keys(left_keys, right_keys);
+  auto const matched = match_dictionary_join_keys(left_keys, right_keys, stream);
+  if (!matched.owner.empty()) {
+    return partitioned_join_indices<JoinKind>(
+      matched.left, matched.right, num_partitions, compare_nulls, mr, stream);
+  }
+  if (num_partitions == 0) { num_partitions = default_num_join_partitions(right_keys.num_rows()); }
+  if (num_partitions == 1) {
+    return join_call_compute_indices<JoinKind>(left_keys, right_keys, compare_nulls, mr, stream);
+  }
+
+  auto const left_partitioned  = partition_join_keys(left_keys, num_partitions, stream);
+  auto const right_partitioned = partition_join_keys(right_keys, num_partitions, stream);
+  auto const left_parts        = cudf::slice(
+    left_partitioned.first->view(),
+    partition_bounds(left_partitioned.second, num_partitions, left_keys.num_rows()));
+  auto const right_parts       = cudf::slice(
+    right_partitioned.first->view(),
+    partition_bounds(right_partitioned.second, num_partitions, right_keys.num_rows()));
+
+  std::vector<size_type> key_columns(left_keys.num_columns());
+  std::iota(key_columns.begin(), key_columns.end(), 0);
+  auto const row_index_column = left_keys.num_columns();
+
+  constexpr join_kind BaseJoinKind =
+    (JoinKind == join_kind::FULL_JOIN) ? join_kind::LEFT_JOIN : JoinKind;
+  std::vector<VectorPair> partition_indices;
+  size_t output_size = 0;
+  for (size_type p = 0; p < num_partitions; ++p) {
+    auto const& left_part  = left_parts[p];
+    auto const& right_part = right_parts[p];
+    bool const has_output  = (JoinKind == join_kind::INNER_JOIN)
+                              ? (left_part.num_rows() > 0 && right_part.num_rows() > 0)
+                              : (JoinKind == join_kind::LEFT_JOIN)
+                                  ? (left_part.num_rows() > 0)
+                                  : (left_part.num_rows() > 0 || right_part.num_rows() > 0);
+    if (!has_output) { continue; }
+
+    auto joined_indices = get_base_hash_join_indices<BaseJoinKind>(
+      left_part.select(key_columns), right_part.select(key_columns), false, compare_nulls, stream);
+    if (JoinKind == join_kind::FULL_JOIN) {
+      auto complement_indices = get_left_join_indices_complement(
+        joined_indices.second, left_part.num_rows(), right_part.num_rows(), stream);
+      joined_indices = concatenate_vector_pairs(joined_indices, complement_indices);
+    }
+
+    // Convert the indices within the partitions to indices within the tables
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      joined_indices.first.begin(),
+                      joined_indices.first.end(),
+                      joined_indices.first.begin(),
+                      partition_to_table_index{
+                        left_part.column(row_index_column).data<size_type>()});
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      joined_indices.second.begin(),
+                      joined_indices.second.end(),
+                      joined_indices.second.begin(),
+                      partition_to_table_index{
+                        right_part.column(row_index_column).data<size_type>()});
+    output_size += joined_indices.first.size();
+    partition_indices.push_back(std::move(joined_indices));
+  }
+
+  auto left_map  = make_numeric_column(data_type(type_to_id<size_type>()),
+                                      static_cast<size_type>(output_size),
+                                      mask_state::UNALLOCATED,
+                                      stream,
+                                      mr);
+  auto right_map = make_numeric_column(data_type(type_to_id<size_type>()),
+                                       static_cast<size_type>(output_size),
+                                       mask_state::UNALLOCATED,
+                                       stream,
+                                       mr);
+  size_t offset = 0;
+  for (auto const& indices : partition_indices) {
+    auto const size = indices.first.size() * sizeof(size_type);
+    CUDA_TRY(cudaMemcpyAsync(left_map->mutable_view().data<size_type>() + offset,
+                             indices.first.data().get(),
+                             size,
+                             cudaMemcpyDeviceToDevice,
+                             stream));
+    CUDA_TRY(cudaMemcpyAsync(right_map->mutable_view().data<size_type>() + offset,
+                             indices.second.data().get(),
+                             size,
+                             cudaMemcpyDeviceToDevice,
+                             stream));
+    offset += indices.first.size();
+  }
+  return std::make_pair(std::move(left_map), std::move(right_map));
+}
+
+/**
+ * @brief Computes the join indices of two sorted tables by searching the range of rows of the
+ * right table that match each row of the left table, and returns them as gather maps
+ *
+ * @tparam JoinKind The type of join to be performed
+ *
+ * @param left_keys The join columns of the left table
+ * @param right_keys The join columns of the right table
+ * @param column_order The sort order of each column
+ * @param null_precedence The position of the nulls of each column
+ * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return Gather maps of the left and right tables
+ */
+template <join_kind JoinKind>
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> sorted_join_indices(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream = 0)
+{
+  validate_join_keys(left_keys, right_keys);
+  auto const matched = match_dictionary_join_keys(left_keys, right_keys, stream);
+  if (!matched.owner.empty()) {
+    return sorted_join_indices<JoinKind>(
+      matched.left, matched.right, column_order, null_precedence, compare_nulls, mr, stream);
+  }
+  auto const left_num_rows = left_keys.num_rows();
+
+  // The matches of each left row are the rows [lower, upper) of the right table
+  auto const lower = lower_bound(right_keys,
+                                 left_keys,
+                                 column_order,
+                                 null_precedence,
+                                 rmm::mr::get_default_resource(),
+                                 stream);
+  auto const upper = upper_bound(right_keys,
+                                 left_keys,
+                                 column_order,
+                                 null_precedence,
+                                 rmm::mr::get_default_resource(),
+                                 stream);
+  auto const d_lower = lower->view().data<size_type>();
+  auto const d_upper = upper->view().data<size_type>();
+
+  // Rows with a null key match nothing when nulls are unequal. The AND of the key null masks
+  // marks the rows with no null key.
+  bool const skip_nulls =
+    (compare_nulls == null_equality::UNEQUAL) && has_nulls(left_keys) && has_nulls(right_keys);
+  auto const left_row_mask =
+    skip_nulls ? bitmask_and(left_keys, rmm::mr::get_default_resource(), stream)
+               : rmm::device_buffer{0, stream};
+  auto const d_left_row_mask = static_cast<bitmask_type const*>(left_row_mask.data());
+  rmm::device_vector<size_type> match_counts(left_num_rows);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(left_num_rows),
+                    match_counts.begin(),
+                    [d_lower, d_upper, d_left_row_mask] __device__(size_type i) {
+                      if (d_left_row_mask != nullptr && not bit_is_set(d_left_row_mask, i)) {
+                        return size_type{0};
+                      }
+                      return d_upper[i] - d_lower[i];
+                    });
+
+  // Left joins always have an entry in the output
+  rmm::device_vector<size_type> output_offsets(left_num_rows + 1, 0);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    match_counts.begin(),
+                    match_counts.end(),
+                    output_offsets.begin(),
+                    [] __device__(size_type count) {
+                      return (JoinKind != join_kind::INNER_JOIN && count == 0) ? 1 : count;
+                    });
+  thrust::exclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         output_offsets.begin(),
+                         output_offsets.end(),
+                         output_offsets.begin());
+  size_type const output_size = output_offsets.back();
+
+  // Each output row finds its left row by binary search in the offsets, which balances the work
+  // when some keys have many more matches than others
+  VectorPair joined_indices{rmm::device_vector<size_type>(output_size),
+                            rmm::device_vector<size_type>(output_size)};
+  thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                   thrust::make_counting_iterator<size_type>(0),
+                   thrust::make_counting_iterator<size_type>(output_size),
+                   [offsets       = output_offsets.data().get(),
+                    counts        = match_counts.data().get(),
+                    left_num_rows,
+                    d_lower,
+                    left_indices  = joined_indices.first.data().get(),
+                    right_indices = joined_indices.second.data().get()] __device__(size_type j) {
+                     auto const i = static_cast<size_type>(
+                       thrust::upper_bound(thrust::seq, offsets, offsets + left_num_rows, j) -
+                       offsets - 1);
+                     left_indices[j]  = i;
+                     right_indices[j] = counts[i] == 0 ? JoinNoneValue : d_lower[i] + j - offsets[i];
+                   });
+
+  if (JoinKind == join_kind::FULL_JOIN) {
+    auto complement_indices = get_left_join_indices_complement(
+      joined_indices.second, left_num_rows, right_keys.num_rows(), stream);
+    joined_indices = concatenate_vector_pairs(joined_indices, complement_indices);
+  }
+  return std::make_pair(make_gather_map_column(joined_indices.first, mr, stream),
+                        make_gather_map_column(joined_indices.second, mr, stream));
+}
+
 }  // namespace detail
 
+hash_join::hash_join_impl::~hash_join_impl() = default;
+
+hash_join::hash_join_impl::hash_join_impl(cudf::table_view const& build,
+                                          std::vector<size_type> const& build_on,
+                                          cudaStream_t stream)
+  : _build(build),
+    _build_on(build_on),
+    _build_table(nullptr, [](table_device_view*) {})
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(0 != build_on.size(), "Selected build dataset is empty");
+
+  auto build_keys = _build.select(_build_on);
+  detail::prefetch(build_keys, stream);
+  _build_table    = table_device_view::create(build_keys, stream);
+  _hash_table     = detail::build_join_hash_table(*_build_table, stream);
+}
+
+template <cudf::detail::join_kind JoinKind>
+std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>>
+hash_join::hash_join_impl::probe_join_indices(cudf::table_view const& probe,
+                                              std::vector<size_type> const& probe_on,
+                                              null_equality compare_nulls,
+                                              cudaStream_t stream) const
+{
+  CUDF_EXPECTS(probe_on.size() == _build_on.size(),
+               "Mismatch in number of columns to be joined on");
+  auto probe_keys = probe.select(probe_on);
+  auto build_keys = _build.select(_build_on);
+  CUDF_EXPECTS(std::equal(std::cbegin(build_keys),
+                          std::cend(build_keys),
+                          std::cbegin(probe_keys),
+                          std::cend(probe_keys),
+                          [](const auto& b, const auto& p) { return b.type() == p.type(); }),
+               "Mismatch in joining column data types");
+  // the hash table holds the dictionary indices of the build table
+  CUDF_EXPECTS(detail::have_same_dictionary_keys(build_keys, probe_keys, stream),
+               "Probe dictionary columns must have the keys of the build dictionary columns");
+
+  // Trivial left join case - exit early
+  if (JoinKind == cudf::detail::join_kind::LEFT_JOIN && _build.num_rows() == 0) {
+    return detail::get_trivial_left_join_indices(probe_keys, stream);
+  }
+
+  detail::prefetch(probe_keys, stream);
+  auto probe_table = table_device_view::create(probe_keys, stream);
+  return dispatch_row_equality_comparator(
+    probe_keys,
+    build_keys,
+    *probe_table,
+    *_build_table,
+    compare_nulls == null_equality::EQUAL,
+    [&](auto const& equality) {
+      return cudf::detail::probe_join_hash_table<JoinKind>(
+        *_build_table, *probe_table, _hash_table->to_device(), false, equality, stream);
+    });
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> hash_join::hash_join_impl::inner_join(
+  cudf::table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  auto joined_indices = probe_join_indices<cudf::detail::join_kind::INNER_JOIN>(
+    probe, probe_on, compare_nulls, stream);
+  return std::make_pair(detail::make_gather_map_column(joined_indices.first, mr, stream),
+                        detail::make_gather_map_column(joined_indices.second, mr, stream));
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> hash_join::hash_join_impl::left_join(
+  cudf::table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  auto joined_indices = probe_join_indices<cudf::detail::join_kind::LEFT_JOIN>(
+    probe, probe_on, compare_nulls, stream);
+  return std::make_pair(detail::make_gather_map_column(joined_indices.first, mr, stream),
+                        detail::make_gather_map_column(joined_indices.second, mr, stream));
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> hash_join::hash_join_impl::full_join(
+  cudf::table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  auto joined_indices = probe_join_indices<cudf::detail::join_kind::LEFT_JOIN>(
+    probe, probe_on, compare_nulls, stream);
+  // Append the build rows that no probe row matched
+  auto complement_indices = detail::get_left_join_indices_complement(
+    joined_indices.second, probe.num_rows(), _build.num_rows(), stream);
+  joined_indices = detail::concatenate_vector_pairs(joined_indices, complement_indices);
+  return std::make_pair(detail::make_gather_map_column(joined_indices.first, mr, stream),
+                        detail::make_gather_map_column(joined_indices.second, mr, stream));
+}
+
+hash_join::~hash_join() = default;
+
+hash_join::hash_join(cudf::table_view const& build, std::vector<size_type> const& build_on)
+  : impl{std::make_unique<const hash_join_impl>(build, build_on)}
+{
+}
+
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> hash_join::inner_join(
+  cudf::table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) const
+{
+  return impl->inner_join(probe, probe_on, compare_nulls, mr, stream);
+}
+
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> hash_join::left_join(
+  cudf::table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr) const
+{
+  return impl->left_join(probe, probe_on, compare_nulls, mr);
+}
+
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> hash_join::full_join(
+  cudf::table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr) const
+{
+  return impl->full_join(probe, probe_on, compare_nulls, mr);
+}
+
 std::unique_ptr<table> inner_join(
   table_view const& left,
   table_view const& right,
@@ -447,11 +1059,12 @@ std::unique_ptr<table> inner_join(
   std::vector<size_type> const& right_on,
   std::vector<std::pair<size_type, size_type>> const& columns_in_common,
   null_equality compare_nulls,
-  rmm::mr::device_memory_resource* mr)
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
   return detail::join_call_compute_df<::cudf::detail::join_kind::INNER_JOIN>(
-    left, right, left_on, right_on, columns_in_common, compare_nulls, mr);
+    left, right, left_on, right_on, columns_in_common, compare_nulls, mr, stream);
 }
 
 std::unique_ptr<table> left_join(
@@ -482,4 +1095,113 @@ std::unique_ptr<table> full_join(
     left, right, left_on, right_on, columns_in_common, compare_nulls, mr);
 }
 
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> inner_join(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::join_call_compute_indices<::cudf::detail::join_kind::INNER_JOIN>(
+    left_keys, right_keys, compare_nulls, mr, stream);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> left_join(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::join_call_compute_indices<::cudf::detail::join_kind::LEFT_JOIN>(
+    left_keys, right_keys, compare_nulls, mr);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> full_join(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::join_call_compute_indices<::cudf::detail::join_kind::FULL_JOIN>(
+    left_keys, right_keys, compare_nulls, mr);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> partitioned_inner_join(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  size_type num_partitions,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::partitioned_join_indices<::cudf::detail::join_kind::INNER_JOIN>(
+    left_keys, right_keys, num_partitions, compare_nulls, mr);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> partitioned_left_join(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  size_type num_partitions,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::partitioned_join_indices<::cudf::detail::join_kind::LEFT_JOIN>(
+    left_keys, right_keys, num_partitions, compare_nulls, mr);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> partitioned_full_join(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  size_type num_partitions,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::partitioned_join_indices<::cudf::detail::join_kind::FULL_JOIN>(
+    left_keys, right_keys, num_partitions, compare_nulls, mr);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> sorted_inner_join(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::sorted_join_indices<::cudf::detail::join_kind::INNER_JOIN>(
+    left_keys, right_keys, column_order, null_precedence, compare_nulls, mr);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> sorted_left_join(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::sorted_join_indices<::cudf::detail::join_kind::LEFT_JOIN>(
+    left_keys, right_keys, column_order, null_precedence, compare_nulls, mr);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> sorted_full_join(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::sorted_join_indices<::cudf::detail::join_kind::FULL_JOIN>(
+    left_keys, right_keys, column_order, null_precedence, compare_nulls, mr);
+}
+
 }  // namespace cudf
@@ -19,7 +19,7 @@
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
-#include <hash/concurrent_unordered_multimap.cuh>
+#include <hash/static_multimap.cuh>
 
 #include <algorithm>
 #include <limits>
@@ -36,15 +36,7 @@ constexpr size_type JoinNoneValue     = -1;
 
 using VectorPair = std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>>;
 
-using multimap_type =
-  concurrent_unordered_multimap<hash_value_type,
-                                size_type,
-                                size_t,
-                                std::numeric_limits<hash_value_type>::max(),
-                                std::numeric_limits<size_type>::max(),
-                                default_hash<hash_value_type>,
-                                equal_to<hash_value_type>,
-                                default_allocator<thrust::pair<hash_value_type, size_type>>>;
+using multimap_type = static_multimap<hash_value_type, size_type>;
 
 using row_hash = cudf::row_hasher<default_hash>;
 
@@ -76,6 +68,19 @@ inline bool is_trivial_join(table_view const& left,
   return false;
 }
 
+/**
+ * @brief Copies a vector of join indices into an `INT32` column
+ *
+ * @param indices The join indices
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return Column holding the join indices
+ */
+std::unique_ptr<column> make_gather_map_column(rmm::device_vector<size_type> const& indices,
+                                               rmm::mr::device_memory_resource* mr,
+                                               cudaStream_t stream);
+
 }  // namespace detail
 
 }  // namespace cudf
@@ -0,0 +1,346 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include "join_common_utils.hpp"
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+/**
+ * @brief Sorted order and sorted copy of a column, with the nulls first
+ */
+struct sorted_column {
+  std::unique_ptr<column> order;
+  std::unique_ptr<table> sorted;
+};
+
+sorted_column sort_with_nulls_first(table_view const& input, cudaStream_t stream)
+{
+  std::vector<order> const column_order(input.num_columns(), order::ASCENDING);
+  std::vector<null_order> const null_precedence(input.num_columns(), null_order::BEFORE);
+  auto sorted_order = detail::sorted_order(
+    input, column_order, null_precedence, rmm::mr::get_default_resource(), stream);
+  auto sorted = detail::gather(input,
+                               sorted_order->view(),
+                               out_of_bounds_policy::FAIL,
+                               negative_index_policy::NOT_ALLOWED,
+                               rmm::mr::get_default_resource(),
+                               stream);
+  return {std::move(sorted_order), std::move(sorted)};
+}
+
+/**
+ * @brief Searches the values of `right` in the sorted, single-column table `sorted_left`
+ */
+std::unique_ptr<column> search_sorted(table_view const& sorted_left,
+                                      column_view const& right,
+                                      bool find_first,
+                                      cudaStream_t stream)
+{
+  table_view const values{{right}};
+  return find_first ? lower_bound(sorted_left,
+                                  values,
+                                  {order::ASCENDING},
+                                  {null_order::BEFORE},
+                                  rmm::mr::get_default_resource(),
+                                  stream)
+                    : upper_bound(sorted_left,
+                                  values,
+                                  {order::ASCENDING},
+                                  {null_order::BEFORE},
+                                  rmm::mr::get_default_resource(),
+                                  stream);
+}
+
+/**
+ * @brief Expands a range `[begins[i], ends[i])` of rows of the sorted left column for every row
+ * `i` of the right column into a pair of gather maps
+ *
+ * The ranges are clamped to exclude the null rows at the start of the sorted left column. The
+ * output is ordered by right row, then by sorted left row.
+ */
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> expand_ranges(
+  rmm::device_vector<size_type>& begins,
+  rmm::device_vector<size_type> const& ends,
+  size_type left_null_count,
+  size_type const* left_order,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  auto const right_num_rows = static_cast<size_type>(begins.size());
+  rmm::device_vector<size_type> output_offsets(right_num_rows + 1, 0);
+  thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                   thrust::make_counting_iterator<size_type>(0),
+                   thrust::make_counting_iterator<size_type>(right_num_rows),
+                   [begins = begins.data().get(),
+                    ends   = ends.data().get(),
+                    left_null_count,
+                    counts = output_offsets.data().get()] __device__(size_type i) {
+                     begins[i] = max(begins[i], left_null_count);
+                     counts[i] = max(ends[i] - begins[i], 0);
+                   });
+  thrust::exclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         output_offsets.begin(),
+                         output_offsets.end(),
+                         output_offsets.begin());
+  size_type const output_size = output_offsets.back();
+
+  auto left_map = make_numeric_column(
+    data_type(type_to_id<size_type>()), output_size, mask_state::UNALLOCATED, stream, mr);
+  auto right_map = make_numeric_column(
+    data_type(type_to_id<size_type>()), output_size, mask_state::UNALLOCATED, stream, mr);
+  // Each output row finds its right row by binary search in the offsets, so that wide ranges are
+  // spread over many threads
+  thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                   thrust::make_counting_iterator<size_type>(0),
+                   thrust::make_counting_iterator<size_type>(output_size),
+                   [offsets       = output_offsets.data().get(),
+                    begins        = begins.data().get(),
+                    right_num_rows,
+                    left_order,
+                    left_indices  = left_map->mutable_view().data<size_type>(),
+                    right_indices = right_map->mutable_view().data<size_type>()] __device__(
+                     size_type j) {
+                     auto const i = static_cast<size_type>(
+                       thrust::upper_bound(thrust::seq, offsets, offsets + right_num_rows, j) -
+                       offsets - 1);
+                     left_indices[j]  = left_order[begins[i] + j - offsets[i]];
+                     right_indices[j] = i;
+                   });
+  return std::make_pair(std::move(left_map), std::move(right_map));
+}
+
+}  // namespace
+
+/**
+ * @copydoc cudf::inequality_join
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> inequality_join(
+  column_view const& left_values,
+  column_view const& right_values,
+  binary_operator op,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream = 0)
+{
+  CUDF_EXPECTS(left_values.type() == right_values.type(), "Mismatch in joining column data types");
+  CUDF_EXPECTS(op == binary_operator::LESS || op == binary_operator::LESS_EQUAL ||
+                 op == binary_operator::GREATER || op == binary_operator::GREATER_EQUAL,
+               "Unsupported inequality join operator");
+
+  auto const left = sort_with_nulls_first(table_view{{left_values}}, stream);
+
+  // The left values below a right value form a prefix of the sorted left column, and the values
+  // above it a suffix
+  bool const is_less    = (op == binary_operator::LESS || op == binary_operator::LESS_EQUAL);
+  bool const find_first = (op == binary_operator::LESS || op == binary_operator::GREATER_EQUAL);
+  auto const bounds     = search_sorted(left.sorted->view(), right_values, find_first, stream);
+
+  auto const right_rows = right_values.size();
+  auto const d_right    = column_device_view::create(right_values, stream);
+  rmm::device_vector<size_type> begins(right_rows);
+  rmm::device_vector<size_type> ends(right_rows);
+  thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                   thrust::make_counting_iterator<size_type>(0),
+                   thrust::make_counting_iterator<size_type>(right_rows),
+                   [d_right   = *d_right,
+                    bounds    = bounds->view().data<size_type>(),
+                    left_rows = left_values.size(),
+                    is_less,
+                    begins    = begins.data().get(),
+                    ends      = ends.data().get()] __device__(size_type i) {
+                     begins[i] = is_less ? 0 : bounds[i];
+                     ends[i]   = d_right.is_null(i) ? 0 : (is_less ? bounds[i] : left_rows);
+                   });
+  return expand_ranges(
+    begins, ends, left_values.null_count(), left.order->view().data<size_type>(), mr, stream);
+}
+
+/**
+ * @copydoc cudf::range_join
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> range_join(
+  column_view const& left_values,
+  column_view const& right_lower,
+  column_view const& right_upper,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream = 0)
+{
+  CUDF_EXPECTS(left_values.type() == right_lower.type() && left_values.type() == right_upper.type(),
+               "Mismatch in joining column data types");
+  CUDF_EXPECTS(right_lower.size() == right_upper.size(), "Mismatch in range bounds sizes");
+
+  auto const left       = sort_with_nulls_first(table_view{{left_values}}, stream);
+  auto const lower      = search_sorted(left.sorted->view(), right_lower, true, stream);
+  auto const upper      = search_sorted(left.sorted->view(), right_upper, false, stream);
+  auto const right_rows = right_lower.size();
+  auto const d_lower    = column_device_view::create(right_lower, stream);
+  auto const d_upper    = column_device_view::create(right_upper, stream);
+  rmm::device_vector<size_type> begins(right_rows);
+  rmm::device_vector<size_type> ends(right_rows);
+  thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                   thrust::make_counting_iterator<size_type>(0),
+                   thrust::make_counting_iterator<size_type>(right_rows),
+                   [d_lower = *d_lower,
+                    d_upper = *d_upper,
+                    lower   = lower->view().data<size_type>(),
+                    upper   = upper->view().data<size_type>(),
+                    begins  = begins.data().get(),
+                    ends    = ends.data().get()] __device__(size_type i) {
+                     // A range with a null bound matches nothing
+                     begins[i] = lower[i];
+                     ends[i]   = (d_lower.is_null(i) || d_upper.is_null(i)) ? 0 : upper[i];
+                   });
+  return expand_ranges(
+    begins, ends, left_values.null_count(), left.order->view().data<size_type>(), mr, stream);
+}
+
+/**
+ * @copydoc cudf::asof_join
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> asof_join(table_view const& left_by,
+                                  column_view const& left_on,
+                                  table_view const& right_by,
+                                  column_view const& right_on,
+                                  null_equality compare_nulls,
+                                  rmm::mr::device_memory_resource* mr,
+                                  cudaStream_t stream = 0)
+{
+  CUDF_EXPECTS(left_by.num_columns() == right_by.num_columns(),
+               "Mismatch in number of columns to be joined on");
+  CUDF_EXPECTS(std::equal(std::cbegin(left_by),
+                          std::cend(left_by),
+                          std::cbegin(right_by),
+                          std::cend(right_by),
+                          [](auto const& l, auto const& r) { return l.type() == r.type(); }),
+               "Mismatch in joining column data types");
+  CUDF_EXPECTS(left_on.type() == right_on.type(), "Mismatch in joining column data types");
+  CUDF_EXPECTS(left_by.num_columns() == 0 ||
+                 (left_by.num_rows() == left_on.size() && right_by.num_rows() == right_on.size()),
+               "Mismatch in number of rows of the join columns");
+
+  // Sorting the right table by (by, on) puts the rows of each group in `on` order, so the last
+  // row not greater than a left row is found by a single binary search
+  std::vector<column_view> left_columns(left_by.begin(), left_by.end());
+  left_columns.push_back(left_on);
+  std::vector<column_view> right_columns(right_by.begin(), right_by.end());
+  right_columns.push_back(right_on);
+  table_view const left{left_columns};
+  auto const right = sort_with_nulls_first(table_view{right_columns}, stream);
+
+  std::vector<order> const column_order(left.num_columns(), order::ASCENDING);
+  std::vector<null_order> const null_precedence(left.num_columns(), null_order::BEFORE);
+  auto const bounds = upper_bound(right.sorted->view(),
+                                  left,
+                                  column_order,
+                                  null_precedence,
+                                  rmm::mr::get_default_resource(),
+                                  stream);
+
+  auto const num_by       = left_by.num_columns();
+  auto const sorted_right = right.sorted->view();
+  auto const d_left_on    = column_device_view::create(left_on, stream);
+  auto const d_right_on   = column_device_view::create(sorted_right.column(num_by), stream);
+  auto const d_left_by    = table_device_view::create(left_by, stream);
+  auto const d_right_by   = table_device_view::create(
+    table_view{std::vector<column_view>(sorted_right.begin(), sorted_right.begin() + num_by)},
+    stream);
+  row_equality const equal_by{*d_left_by, *d_right_by, compare_nulls == null_equality::EQUAL};
+
+  auto right_map = make_numeric_column(
+    data_type(type_to_id<size_type>()), left.num_rows(), mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(left.num_rows()),
+                    right_map->mutable_view().begin<size_type>(),
+                    [bounds      = bounds->view().data<size_type>(),
+                     right_order = right.order->view().data<size_type>(),
+                     left_on     = *d_left_on,
+                     right_on    = *d_right_on,
+                     equal_by] __device__(size_type i) {
+                      auto const match = bounds[i] - 1;
+                      if (match < 0 || left_on.is_null(i) || right_on.is_null(match) ||
+                          !equal_by(i, match)) {
+                        return JoinNoneValue;
+                      }
+                      return right_order[match];
+                    });
+  return right_map;
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> inequality_join(
+  column_view const& left_values,
+  column_view const& right_values,
+  binary_operator op,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::inequality_join(left_values, right_values, op, mr);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> range_join(
+  column_view const& left_values,
+  column_view const& right_lower,
+  column_view const& right_upper,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::range_join(left_values, right_lower, right_upper, mr);
+}
+
+std::unique_ptr<column> asof_join(table_view const& left_by,
+                                  column_view const& left_on,
+                                  table_view const& right_by,
+                                  column_view const& right_on,
+                                  null_equality compare_nulls,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::asof_join(left_by, left_on, right_by, right_on, compare_nulls, mr);
+}
+
+}  // namespace cudf
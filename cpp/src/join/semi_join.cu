@@ -16,22 +16,164 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
-#include <cudf/detail/gather.hpp>
+#include <cudf/detail/gather.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/join.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/error.hpp>
-#include <hash/concurrent_unordered_map.cuh>
-
+#include <hash/row_multiset.cuh>
 #include <join/join_common_utils.hpp>
 
-#include <cudf/detail/gather.cuh>
-#include <join/hash_join.cuh>
-#include "cudf/types.hpp"
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <type_traits>
 
 namespace cudf {
 namespace detail {
+namespace {
+/**
+ * @brief Returns whether a row of the left table has an equal row in the right table is
+ * `has_match`
+ */
+template <typename Equality>
+struct match_fn {
+  row_multiset_device_view right_rows;
+  row_hash hash_left;
+  Equality equality;
+  bitmask_type const* left_valid;  ///< Rows that can match, all of them if null
+  bool has_match;
+
+  __device__ bool operator()(size_type idx) const
+  {
+    bool const found = (left_valid == nullptr or bit_is_set(left_valid, idx)) and
+                       right_rows.contains(hash_left(idx), idx, equality);
+    return found == has_match;
+  }
+};
+
+/**
+ * @brief Builds the set of the rows of `right_keys` and calls `probe` with a `match_fn` of the
+ * rows of `left_keys`
+ *
+ * The set only holds the indices of the right rows, and a left row is compared with the right
+ * rows of its hash bucket until one is equal. When nulls are unequal, rows with a null key are not
+ * added to the set nor looked up, as they cannot match.
+ */
+template <typename ProbeFn>
+void probe_semi_join(table_view const& left_keys,
+                     table_view const& right_keys,
+                     bool has_match,
+                     null_equality compare_nulls,
+                     cudaStream_t stream,
+                     ProbeFn probe)
+{
+  CUDF_EXPECTS(0 != left_keys.num_columns(), "Left table is empty");
+  CUDF_EXPECTS(left_keys.num_columns() == right_keys.num_columns(),
+               "Mismatch in number of columns to be joined on");
+
+  bool const nulls_equal = compare_nulls == null_equality::EQUAL;
+  auto const rows_valid  = [&](table_view const& keys) {
+    return nulls_equal ? rmm::device_buffer{0, stream}
+                       : cudf::bitmask_and(keys, rmm::mr::get_default_resource(), stream);
+  };
+  auto const left_valid  = rows_valid(left_keys);
+  auto const right_valid = rows_valid(right_keys);
+  auto const valid_bits = [](rmm::device_buffer const& mask) {
+    return mask.is_empty() ? nullptr : static_cast<bitmask_type const*>(mask.data());
+  };
+
+  auto const left_rows_d  = table_device_view::create(left_keys, stream);
+  auto const right_rows_d = table_device_view::create(right_keys, stream);
+  auto const right_rows =
+    row_multiset::create(*right_rows_d, row_hash{*right_rows_d}, valid_bits(right_valid), stream);
+
+  dispatch_row_equality_comparator(
+    left_keys,
+    right_keys,
+    *left_rows_d,
+    *right_rows_d,
+    nulls_equal,
+    [&](auto const& equality) {
+      using Equality = std::decay_t<decltype(equality)>;
+      probe(match_fn<Equality>{right_rows.to_device(),
+                               row_hash{*left_rows_d},
+                               equality,
+                               valid_bits(left_valid),
+                               has_match});
+    });
+}
+
+}  // namespace
+
+/**
+ * @brief Returns the indices of the rows of `left_keys` that have an equal row in `right_keys` if
+ * `JoinKind` is `LEFT_SEMI_JOIN`, or that do not if `JoinKind` is `LEFT_ANTI_JOIN`
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+template <join_kind JoinKind>
+std::unique_ptr<column> left_semi_anti_join_gather_map(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0)
+{
+  rmm::device_vector<size_type> gather_map(left_keys.num_rows());
+  size_type gather_map_size = 0;
+  probe_semi_join(left_keys,
+                  right_keys,
+                  JoinKind == join_kind::LEFT_SEMI_JOIN,
+                  compare_nulls,
+                  stream,
+                  [&](auto const& keep) {
+                    auto const gather_map_end =
+                      thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                                      thrust::make_counting_iterator<size_type>(0),
+                                      thrust::make_counting_iterator(left_keys.num_rows()),
+                                      gather_map.begin(),
+                                      keep);
+                    gather_map_size =
+                      static_cast<size_type>(thrust::distance(gather_map.begin(), gather_map_end));
+                  });
+  gather_map.resize(gather_map_size);
+  return make_gather_map_column(gather_map, mr, stream);
+}
+
+/**
+ * @copydoc cudf::left_semi_join_mask
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> left_semi_join_mask(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0)
+{
+  auto mask = make_numeric_column(
+    data_type{type_id::BOOL8}, left_keys.num_rows(), mask_state::UNALLOCATED, stream, mr);
+  probe_semi_join(
+    left_keys, right_keys, true, compare_nulls, stream, [&](auto const& has_match) {
+      thrust::transform(rmm::exec_policy(stream)->on(stream),
+                        thrust::make_counting_iterator<size_type>(0),
+                        thrust::make_counting_iterator(left_keys.num_rows()),
+                        mask->mutable_view().begin<bool>(),
+                        has_match);
+    });
+  return mask;
+}
+
 /**
  * @brief  Performs a left semi or anti join on the specified columns of two
  * tables (left, right)
@@ -40,9 +182,8 @@ namespace detail {
  * returns rows that exist in the right table, a left anti join returns rows
  * that do not exist in the right table.
  *
- * The basic approach is to create a hash table containing the contents of the right
- * table and then select only rows that exist (or don't exist) to be included in
- * the return set.
+ * The rows to return are found by `left_semi_anti_join_gather_map`, which only keeps the
+ * indices of the right rows in a hash set and stops looking up a left row at its first match.
  *
  * @throws cudf::logic_error if number of columns in either `left` or `right` table is 0
  * @throws cudf::logic_error if number of returned columns is 0
@@ -96,57 +237,18 @@ std::unique_ptr<cudf::table> left_semi_anti_join(
     return std::make_unique<table>(left.select(return_columns), stream, mr);
   }
 
-  // Only care about existence, so we'll use an unordered map (other joins need a multimap)
-  using hash_table_type = concurrent_unordered_map<cudf::size_type, bool, row_hash, row_equality>;
-
-  // Create hash table containing all keys found in right table
-  auto right_rows_d            = table_device_view::create(right.select(right_on), stream);
-  size_t const hash_table_size = compute_hash_table_size(right.num_rows());
-  row_hash hash_build{*right_rows_d};
-  row_equality equality_build{*right_rows_d, *right_rows_d, compare_nulls == null_equality::EQUAL};
-
-  // Going to join it with left table
-  auto left_rows_d = table_device_view::create(left.select(left_on), stream);
-  row_hash hash_probe{*left_rows_d};
-  row_equality equality_probe{*left_rows_d, *right_rows_d, compare_nulls == null_equality::EQUAL};
-
-  auto hash_table_ptr = hash_table_type::create(hash_table_size,
-                                                std::numeric_limits<bool>::max(),
-                                                std::numeric_limits<cudf::size_type>::max(),
-                                                hash_build,
-                                                equality_build);
-  auto hash_table     = *hash_table_ptr;
-
-  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
-                     thrust::make_counting_iterator<size_type>(0),
-                     right.num_rows(),
-                     [hash_table] __device__(size_type idx) mutable {
-                       hash_table.insert(thrust::make_pair(idx, true));
-                     });
-
-  //
-  // Now we have a hash table, we need to iterate over the rows of the left table
-  // and check to see if they are contained in the hash table
-  //
-
-  // For semi join we want contains to be true, for anti join we want contains to be false
-  bool join_type_boolean = (JoinKind == join_kind::LEFT_SEMI_JOIN);
-
-  rmm::device_vector<size_type> gather_map(left.num_rows());
-
-  // gather_map_end will be the end of valid data in gather_map
-  auto gather_map_end = thrust::copy_if(
-    rmm::exec_policy(stream)->on(stream),
-    thrust::make_counting_iterator<size_type>(0),
-    thrust::make_counting_iterator<size_type>(left.num_rows()),
-    gather_map.begin(),
-    [hash_table, join_type_boolean, hash_probe, equality_probe] __device__(size_type idx) {
-      auto pos = hash_table.find(idx, hash_probe, equality_probe);
-      return (pos != hash_table.end()) == join_type_boolean;
-    });
-
-  return cudf::detail::gather(
-    left.select(return_columns), gather_map.begin(), gather_map_end, false, mr);
+  auto const gather_map = left_semi_anti_join_gather_map<JoinKind>(left.select(left_on),
+                                                                   right.select(right_on),
+                                                                   compare_nulls,
+                                                                   rmm::mr::get_default_resource(),
+                                                                   stream);
+  auto const gather_map_begin = gather_map->view().begin<size_type>();
+  return cudf::detail::gather(left.select(return_columns),
+                              gather_map_begin,
+                              gather_map_begin + gather_map->size(),
+                              false,
+                              mr,
+                              stream);
 }
 }  // namespace detail
 
@@ -176,4 +278,33 @@ std::unique_ptr<cudf::table> left_anti_join(cudf::table_view const& left,
     left, right, left_on, right_on, return_columns, compare_nulls, mr, 0);
 }
 
+std::unique_ptr<cudf::column> left_semi_join_gather_map(cudf::table_view const& left_keys,
+                                                        cudf::table_view const& right_keys,
+                                                        null_equality compare_nulls,
+                                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::left_semi_anti_join_gather_map<detail::join_kind::LEFT_SEMI_JOIN>(
+    left_keys, right_keys, compare_nulls, mr, 0);
+}
+
+std::unique_ptr<cudf::column> left_anti_join_gather_map(cudf::table_view const& left_keys,
+                                                        cudf::table_view const& right_keys,
+                                                        null_equality compare_nulls,
+                                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::left_semi_anti_join_gather_map<detail::join_kind::LEFT_ANTI_JOIN>(
+    left_keys, right_keys, compare_nulls, mr, 0);
+}
+
+std::unique_ptr<cudf::column> left_semi_join_mask(cudf::table_view const& left_keys,
+                                                  cudf::table_view const& right_keys,
+                                                  null_equality compare_nulls,
+                                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::left_semi_join_mask(left_keys, right_keys, compare_nulls, mr, 0);
+}
+
 }  // namespace cudf
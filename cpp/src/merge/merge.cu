@@ -15,6 +15,8 @@
  */
 #include <rmm/thrust_rmm_allocator.h>
 #include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.cuh>
+#include <cudf/detail/gather.cuh>
 #include <cudf/detail/merge.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
@@ -22,12 +24,15 @@
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
 
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/merge.h>
 #include <thrust/tuple.h>
 
-#include <queue>
+#include <algorithm>
+#include <iterator>
 #include <vector>
 
 namespace {  // anonym.
@@ -380,28 +385,81 @@ table_ptr_type merge(cudf::table_view const& left_table,
   return std::make_unique<cudf::table>(std::move(merged_cols));
 }
 
-struct merge_queue_item {
-  table_view view;
-  table_ptr_type table;
-  // Priority is a separate member to ensure that moving from an object
-  // does not change its priority (which would ruin the queue invariant)
-  cudf::size_type priority = 0;
-
-  merge_queue_item(table_view const& view, table_ptr_type&& table)
-    : view{view}, table{std::move(table)}, priority{-view.num_rows()}
+/**
+ * @brief Computes the output position of a row of the concatenation of sorted tables
+ *
+ * The position of a row is its index in its own table plus, for every other table, the number of
+ * rows of that table merged before it. Rows with an equal key are merged before it if their table
+ * comes first, and after it otherwise, which keeps the merge stable.
+ */
+template <typename Comparator>
+struct merged_position_fn {
+  Comparator comparator;
+  size_type const* offsets;
+  size_type num_tables;
+  size_type* gather_map;
+
+  __device__ void operator()(size_type row) const
   {
+    auto const source = static_cast<size_type>(
+      thrust::upper_bound(thrust::seq, offsets, offsets + num_tables + 1, row) - offsets - 1);
+    size_type position = row - offsets[source];
+    for (size_type t = 0; t < num_tables; ++t) {
+      if (t == source) { continue; }
+      auto const begin = thrust::make_counting_iterator(offsets[t]);
+      auto const end   = thrust::make_counting_iterator(offsets[t + 1]);
+      auto const bound = t < source ? thrust::upper_bound(thrust::seq, begin, end, row, comparator)
+                                    : thrust::lower_bound(thrust::seq, begin, end, row, comparator);
+      position += *bound - offsets[t];
+    }
+    gather_map[position] = row;
   }
-
-  bool operator<(merge_queue_item const& other) const { return priority < other.priority; }
 };
 
-// Helper function to ensure that moving out of the priority_queue is "atomic"
-template <typename T>
-T top_and_pop(std::priority_queue<T>& q)
+/**
+ * @brief Merges more than two sorted tables in one pass
+ *
+ * Rather than merging the tables pairwise, which copies the data once per round, every row finds
+ * its output position by binary searching its key in each of the other tables. The tables are
+ * concatenated, then gathered once into the merged order.
+ */
+table_ptr_type merge_k_way(std::vector<table_view> const& tables,
+                           std::vector<cudf::size_type> const& key_cols,
+                           std::vector<cudf::order> const& column_order,
+                           std::vector<cudf::null_order> const& null_precedence,
+                           rmm::mr::device_memory_resource* mr,
+                           cudaStream_t stream)
 {
-  auto moved = std::move(const_cast<T&>(q.top()));
-  q.pop();
-  return moved;
+  std::vector<size_type> h_offsets{0};
+  for (auto const& table : tables) { h_offsets.push_back(h_offsets.back() + table.num_rows()); }
+  auto const num_tables = static_cast<size_type>(tables.size());
+  auto const num_rows   = h_offsets.back();
+
+  auto const concatenated = detail::concatenate(tables, rmm::mr::get_default_resource(), stream);
+  auto const keys         = concatenated->view().select(key_cols);
+  auto const d_keys       = table_device_view::create(keys, stream);
+  rmm::device_vector<size_type> offsets(h_offsets);
+  rmm::device_vector<order> d_column_order(column_order);
+  rmm::device_vector<null_order> d_null_precedence(null_precedence);
+  rmm::device_vector<size_type> gather_map(num_rows);
+
+  dispatch_row_lexicographic_comparator(
+    keys,
+    keys,
+    *d_keys,
+    *d_keys,
+    d_column_order.data().get(),
+    d_null_precedence.data().get(),
+    [&](auto const& comparator) {
+      thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                         thrust::make_counting_iterator<size_type>(0),
+                         num_rows,
+                         merged_position_fn<std::decay_t<decltype(comparator)>>{
+                           comparator, offsets.data().get(), num_tables, gather_map.data().get()});
+    });
+
+  return detail::gather(
+    concatenated->view(), gather_map.begin(), gather_map.end(), false, mr, stream);
 }
 
 }  // namespace
@@ -411,7 +469,7 @@ table_ptr_type merge(std::vector<table_view> const& tables_to_merge,
                      std::vector<cudf::order> const& column_order,
                      std::vector<cudf::null_order> const& null_precedence,
                      rmm::mr::device_memory_resource* mr,
-                     cudaStream_t stream = 0)
+                     cudaStream_t stream)
 {
   if (tables_to_merge.empty()) { return std::make_unique<cudf::table>(); }
 
@@ -434,41 +492,29 @@ table_ptr_type merge(std::vector<table_view> const& tables_to_merge,
   CUDF_EXPECTS(key_cols.size() == column_order.size(),
                "Mismatched size between key_cols and column_order");
 
-  // A queue of (table view, table) pairs
-  std::priority_queue<merge_queue_item> merge_queue;
-  // The table pointer is null if we do not own the table (input tables)
-  std::for_each(tables_to_merge.begin(), tables_to_merge.end(), [&](auto const& table) {
-    if (table.num_rows() > 0) merge_queue.emplace(table, table_ptr_type());
-  });
+  std::vector<table_view> non_empty_tables;
+  std::copy_if(tables_to_merge.begin(),
+               tables_to_merge.end(),
+               std::back_inserter(non_empty_tables),
+               [](auto const& table) { return table.num_rows() > 0; });
 
   // If there is only one non-empty table_view, return its copy
-  if (merge_queue.size() == 1) { return std::make_unique<cudf::table>(merge_queue.top().view); }
+  if (non_empty_tables.size() == 1) {
+    return std::make_unique<cudf::table>(non_empty_tables.front(), stream, mr);
+  }
   // No inputs have rows, return a table with same columns as the first one
-  if (merge_queue.empty()) { return empty_like(first_table); }
-
-  // Pick the two smallest tables and merge them
-  // Until there is only one table left in the queue
-  while (merge_queue.size() > 1) {
-    // To delete the intermediate table at the end of the block
-    auto const left_table = top_and_pop(merge_queue);
-    // Deallocated at the end of the block
-    auto const right_table = top_and_pop(merge_queue);
-
-    // Only use mr for the output table
-    auto const& new_tbl_rm = merge_queue.empty() ? mr : rmm::mr::get_default_resource();
-    auto merged_table      = merge(left_table.view,
-                              right_table.view,
-                              key_cols,
-                              column_order,
-                              null_precedence,
-                              new_tbl_rm,
-                              stream);
-
-    auto const merged_table_view = merged_table->view();
-    merge_queue.emplace(merged_table_view, std::move(merged_table));
+  if (non_empty_tables.empty()) { return empty_like(first_table); }
+
+  if (non_empty_tables.size() == 2) {
+    return merge(non_empty_tables[0],
+                 non_empty_tables[1],
+                 key_cols,
+                 column_order,
+                 null_precedence,
+                 mr,
+                 stream);
   }
-
-  return std::move(top_and_pop(merge_queue).table);
+  return merge_k_way(non_empty_tables, key_cols, column_order, null_precedence, mr, stream);
 }
 
 }  // namespace detail
@@ -480,7 +526,11 @@ std::unique_ptr<cudf::table> merge(std::vector<table_view> const& tables_to_merg
                                    rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::merge(tables_to_merge, key_cols, column_order, null_precedence, mr);
+  auto merged = detail::merge(tables_to_merge, key_cols, column_order, null_precedence, mr);
+  if (merged->num_columns() > 0) {
+    merged->set_sort_order(key_cols, column_order, null_precedence);
+  }
+  return merged;
 }
 
 }  // namespace cudf
@@ -19,12 +19,28 @@
 #include <cudf/copying.hpp>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/partitioning.hpp>
 #include <cudf/detail/scatter.cuh>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/partitioning.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/bit.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/gather.h>
+#include <thrust/host_vector.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scatter.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
 
 namespace cudf {
 namespace {
@@ -47,7 +63,12 @@ class modulo_partitioner {
  public:
   modulo_partitioner(size_type num_partitions) : divisor{num_partitions} {}
 
-  __device__ size_type operator()(hash_value_t hash_value) const { return hash_value % divisor; }
+  __device__ size_type operator()(hash_value_t hash_value) const
+  {
+    // the non-negative remainder of a signed hash value
+    auto const remainder = static_cast<size_type>(hash_value % divisor);
+    return remainder < 0 ? remainder + divisor : remainder;
+  }
 
  private:
   const size_type divisor;
@@ -138,7 +159,7 @@ __global__ void compute_row_partition_numbers(row_hasher_t the_hasher,
   // and compute the partition to which the hash value belongs and increment
   // the shared memory counter for that partition
   while (row_number < num_rows) {
-    const hash_value_type row_hash_value = the_hasher(row_number);
+    auto const row_hash_value = the_hasher(row_number);
 
     const size_type partition_number = the_partitioner(row_hash_value);
 
@@ -446,53 +467,61 @@ struct copy_block_partitions_dispatcher {
   }
 };
 
-// NOTE hash_has_nulls must be true if table_to_hash has nulls
-template <bool hash_has_nulls>
-std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
-  table_view const& input,
-  table_view const& table_to_hash,
-  size_type num_partitions,
-  rmm::mr::device_memory_resource* mr,
-  cudaStream_t stream)
-{
-  auto const num_rows = table_to_hash.num_rows();
+template <bool has_nulls>
+using murmur_row_hasher = row_hasher<MurmurHash3_32, has_nulls>;
 
-  bool const use_optimization{num_partitions <= THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL};
-  auto const block_size = use_optimization ? OPTIMIZED_BLOCK_SIZE : FALLBACK_BLOCK_SIZE;
-  auto const rows_per_thread =
-    use_optimization ? OPTIMIZED_ROWS_PER_THREAD : FALLBACK_ROWS_PER_THREAD;
-  auto const rows_per_block = block_size * rows_per_thread;
+template <bool has_nulls>
+using xxhash_row_hasher = row_hasher<XXHash_64, has_nulls>;
 
-  // NOTE grid_size is non-const to workaround lambda capture bug in gcc 5.4
-  auto grid_size = util::div_rounding_up_safe(num_rows, rows_per_block);
-
-  // Allocate array to hold which partition each row belongs to
-  auto row_partition_numbers = rmm::device_vector<size_type>(num_rows);
-
-  // Array to hold the size of each partition computed by each block
-  //  i.e., { {block0 partition0 size, block1 partition0 size, ...},
-  //          {block0 partition1 size, block1 partition1 size, ...},
-  //          ...
-  //          {block0 partition(num_partitions-1) size, block1
-  //          partition(num_partitions -1) size, ...} }
-  auto block_partition_sizes = rmm::device_vector<size_type>(grid_size * num_partitions);
+/**
+ * @brief Computes the hash value of a row as Hive does to assign it to a bucket, the
+ * `hive_row_hasher` value without its sign bit.
+ */
+template <bool has_nulls>
+class hive_bucket_row_hasher {
+ public:
+  hive_bucket_row_hasher(table_device_view t) : _hasher{t} {}
 
-  auto scanned_block_partition_sizes = rmm::device_vector<size_type>(grid_size * num_partitions);
+  using result_type = int32_t;
 
-  // Holds the total number of rows in each partition
-  auto global_partition_sizes = rmm::device_vector<size_type>(num_partitions, size_type{0});
+  __device__ result_type operator()(size_type row_index) const
+  {
+    return _hasher(row_index) & std::numeric_limits<result_type>::max();
+  }
 
-  auto row_partition_offset = rmm::device_vector<size_type>(num_rows);
+ private:
+  hive_row_hasher<has_nulls> _hasher;
+};
 
+/**
+ * @brief Computes the partition of each row of `table_to_hash`, its offset in its partition
+ * within its thread block and the number of rows of each partition in each thread block and
+ * in total.
+ *
+ * See `compute_row_partition_numbers` for the outputs.
+ */
+template <template <bool> class row_hasher_t, bool hash_has_nulls>
+void compute_partitions(table_view const& table_to_hash,
+                        size_type num_partitions,
+                        size_type grid_size,
+                        size_type block_size,
+                        size_type* row_partition_numbers,
+                        size_type* row_partition_offset,
+                        size_type* block_partition_sizes,
+                        size_type* global_partition_sizes,
+                        cudaStream_t stream)
+{
+  auto const num_rows = table_to_hash.num_rows();
   auto const device_input = table_device_view::create(table_to_hash, stream);
-  auto const hasher       = row_hasher<MurmurHash3_32, hash_has_nulls>(*device_input);
+  auto const hasher       = row_hasher_t<hash_has_nulls>(*device_input);
+  using hash_value_t      = typename decltype(hasher)::result_type;
 
   // If the number of partitions is a power of two, we can compute the partition
   // number of each row more efficiently with bitwise operations
   if (is_power_two(num_partitions)) {
     // Determines how the mapping between hash value and partition number is
     // computed
-    using partitioner_type = bitwise_partitioner<hash_value_type>;
+    using partitioner_type = bitwise_partitioner<hash_value_t>;
 
     // Computes which partition each row belongs to by hashing the row and
     // performing a partitioning operator on the hash value. Also computes the
@@ -505,14 +534,14 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
                                               num_rows,
                                               num_partitions,
                                               partitioner_type(num_partitions),
-                                              row_partition_numbers.data().get(),
-                                              row_partition_offset.data().get(),
-                                              block_partition_sizes.data().get(),
-                                              global_partition_sizes.data().get());
+                                              row_partition_numbers,
+                                              row_partition_offset,
+                                              block_partition_sizes,
+                                              global_partition_sizes);
   } else {
     // Determines how the mapping between hash value and partition number is
     // computed
-    using partitioner_type = modulo_partitioner<hash_value_type>;
+    using partitioner_type = modulo_partitioner<hash_value_t>;
 
     // Computes which partition each row belongs to by hashing the row and
     // performing a partitioning operator on the hash value. Also computes the
@@ -525,11 +554,60 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
                                               num_rows,
                                               num_partitions,
                                               partitioner_type(num_partitions),
-                                              row_partition_numbers.data().get(),
-                                              row_partition_offset.data().get(),
-                                              block_partition_sizes.data().get(),
-                                              global_partition_sizes.data().get());
+                                              row_partition_numbers,
+                                              row_partition_offset,
+                                              block_partition_sizes,
+                                              global_partition_sizes);
   }
+}
+
+// NOTE hash_has_nulls must be true if table_to_hash has nulls
+template <template <bool> class row_hasher_t, bool hash_has_nulls>
+std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
+  table_view const& input,
+  table_view const& table_to_hash,
+  size_type num_partitions,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  auto const num_rows = table_to_hash.num_rows();
+
+  bool const use_optimization{num_partitions <= THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL};
+  auto const block_size = use_optimization ? OPTIMIZED_BLOCK_SIZE : FALLBACK_BLOCK_SIZE;
+  auto const rows_per_thread =
+    use_optimization ? OPTIMIZED_ROWS_PER_THREAD : FALLBACK_ROWS_PER_THREAD;
+  auto const rows_per_block = block_size * rows_per_thread;
+
+  // NOTE grid_size is non-const to workaround lambda capture bug in gcc 5.4
+  auto grid_size = util::div_rounding_up_safe(num_rows, rows_per_block);
+
+  // Allocate array to hold which partition each row belongs to
+  auto row_partition_numbers = rmm::device_vector<size_type>(num_rows);
+
+  // Array to hold the size of each partition computed by each block
+  //  i.e., { {block0 partition0 size, block1 partition0 size, ...},
+  //          {block0 partition1 size, block1 partition1 size, ...},
+  //          ...
+  //          {block0 partition(num_partitions-1) size, block1
+  //          partition(num_partitions -1) size, ...} }
+  auto block_partition_sizes = rmm::device_vector<size_type>(grid_size * num_partitions);
+
+  auto scanned_block_partition_sizes = rmm::device_vector<size_type>(grid_size * num_partitions);
+
+  // Holds the total number of rows in each partition
+  auto global_partition_sizes = rmm::device_vector<size_type>(num_partitions, size_type{0});
+
+  auto row_partition_offset = rmm::device_vector<size_type>(num_rows);
+
+  compute_partitions<row_hasher_t, hash_has_nulls>(table_to_hash,
+                                                    num_partitions,
+                                                    grid_size,
+                                                    block_size,
+                                                    row_partition_numbers.data().get(),
+                                                    row_partition_offset.data().get(),
+                                                    block_partition_sizes.data().get(),
+                                                    global_partition_sizes.data().get(),
+                                                    stream);
 
   // Compute exclusive scan of all blocks' partition sizes in-place to determine
   // the starting point for each blocks portion of each partition in the output
@@ -621,6 +699,373 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
   }
 }
 
+// align the buffers of the columns in a packed partition as contiguous_split does
+constexpr size_t packed_align = 64;
+
+/**
+ * @brief Copies the rows of a fixed-width column into the packed buffers of their partitions.
+ *
+ * Row `row` of the partitioned rows is row `gather_map[row]` of the column and is at position
+ * `row - partition_offsets[partition]` of its partition.
+ */
+template <typename T>
+struct pack_fixed_width_rows {
+  T const* input;
+  size_type const* gather_map;
+  size_type const* row_partitions;
+  size_type const* partition_offsets;
+  char* const* outputs;  // data of the column in the buffer of each partition
+
+  __device__ void operator()(size_type row) const
+  {
+    auto const partition = row_partitions[row];
+    auto const output    = reinterpret_cast<T*>(outputs[partition]);
+
+    output[row - partition_offsets[partition]] = input[gather_map[row]];
+  }
+};
+
+/**
+ * @brief Builds each word of the null masks of a column in the packed buffers of the
+ * partitions, counting the valid rows of each partition.
+ */
+struct pack_validity_words {
+  bitmask_type const* input;
+  size_type input_offset;
+  size_type const* gather_map;
+  size_type const* partition_offsets;
+  size_type const* word_offsets;  // first word of each partition in the words of all partitions
+  size_type num_partitions;
+  char* const* outputs;  // null mask of the column in the buffer of each partition
+  size_type* valid_counts;
+
+  __device__ void operator()(size_type word) const
+  {
+    constexpr size_type word_bits = detail::size_in_bits<bitmask_type>();
+    auto const partition          = static_cast<size_type>(
+      thrust::upper_bound(thrust::seq, word_offsets, word_offsets + num_partitions + 1, word) -
+      word_offsets - 1);
+    auto const partition_word = word - word_offsets[partition];
+    auto const first_row      = partition_offsets[partition] + partition_word * word_bits;
+    auto const end_row        = min(first_row + word_bits, partition_offsets[partition + 1]);
+
+    bitmask_type bits = 0;
+    for (auto row = first_row; row < end_row; ++row) {
+      if (bit_is_set(input, input_offset + gather_map[row])) {
+        bits |= bitmask_type{1} << (row - first_row);
+      }
+    }
+    reinterpret_cast<bitmask_type*>(outputs[partition])[partition_word] = bits;
+    if (bits != 0) { atomicAdd(valid_counts + partition, __popc(bits)); }
+  }
+};
+
+/**
+ * @brief Copies the characters and writes the offsets of the rows of a strings column in the
+ * packed buffers of their partitions.
+ */
+struct pack_string_rows {
+  size_type const* input_offsets;  // offsets of the rows of the column
+  char const* input_chars;
+  size_type const* gather_map;
+  size_type const* row_partitions;
+  size_type const* partition_offsets;
+  size_type const* char_positions;  // position of the characters of each partitioned row
+  char* const* output_offsets;      // offsets of the column in the buffer of each partition
+  char* const* output_chars;        // characters of the column in the buffer of each partition
+
+  __device__ void operator()(size_type row) const
+  {
+    auto const partition   = row_partitions[row];
+    auto const first_row   = partition_offsets[partition];
+    auto const chars_begin = char_positions[first_row];
+    auto const offsets     = reinterpret_cast<size_type*>(output_offsets[partition]);
+    auto const position    = char_positions[row] - chars_begin;
+
+    offsets[row - first_row] = position;
+    // the last row of a partition also writes the end of its characters
+    if (row + 1 == partition_offsets[partition + 1]) {
+      offsets[row - first_row + 1] = char_positions[row + 1] - chars_begin;
+    }
+
+    auto const input_row = gather_map[row];
+    auto const begin     = input_offsets[input_row];
+    memcpy(output_chars[partition] + position,
+           input_chars + begin,
+           input_offsets[input_row + 1] - begin);
+  }
+};
+
+/**
+ * @brief Position of the buffers of a column within the packed buffer of a partition.
+ */
+struct packed_column_layout {
+  size_t validity_pos;
+  size_t data_pos;  // data of a fixed-width column or offsets of a strings column
+  size_t chars_pos;
+};
+
+/**
+ * @brief Copies the rows of `input` into one contiguous buffer per partition.
+ *
+ * The rows are moved to the partitions by the `scatter_map` of the rows of all partitions,
+ * whose partition `p` spans `[partition_offsets[p], partition_offsets[p + 1])`. Each buffer of
+ * each column of each partition is written once, directly from `input`.
+ */
+std::vector<contiguous_split_result> pack_partitions(
+  table_view const& input,
+  size_type const* scatter_map,
+  std::vector<size_type> const& partition_offsets,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  auto const num_rows       = input.num_rows();
+  auto const num_columns    = input.num_columns();
+  auto const num_partitions = static_cast<size_type>(partition_offsets.size()) - 1;
+  auto exec                 = rmm::exec_policy(stream);
+
+  // the input row and the partition of each partitioned row
+  rmm::device_vector<size_type> d_partition_offsets(partition_offsets);
+  rmm::device_vector<size_type> gather_map(num_rows);
+  thrust::scatter(exec->on(stream),
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(num_rows),
+                  scatter_map,
+                  gather_map.begin());
+  rmm::device_vector<size_type> row_partitions(num_rows);
+  thrust::upper_bound(exec->on(stream),
+                      d_partition_offsets.begin() + 1,
+                      d_partition_offsets.end(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_rows),
+                      row_partitions.begin());
+  auto const d_gather_map = gather_map.data().get();
+
+  // the position of the characters of each partitioned row of each strings column
+  std::vector<rmm::device_vector<size_type>> char_positions(num_columns);
+  std::vector<thrust::host_vector<size_type>> partition_char_offsets(num_columns);
+  for (size_type c = 0; c < num_columns; ++c) {
+    auto const& col = input.column(c);
+    if (col.type().id() != type_id::STRING) { continue; }
+    partition_char_offsets[c].resize(num_partitions + 1, 0);
+    if (num_rows == 0) { continue; }  // a strings column with no rows may have no children
+
+    auto const d_offsets = col.child(0).data<size_type>() + col.offset();
+    char_positions[c].resize(num_rows + 1);
+    thrust::transform(exec->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_rows + 1),
+                      char_positions[c].begin(),
+                      [d_offsets, d_gather_map, num_rows] __device__(size_type row) {
+                        if (row == num_rows) { return 0; }
+                        auto const input_row = d_gather_map[row];
+                        return d_offsets[input_row + 1] - d_offsets[input_row];
+                      });
+    thrust::exclusive_scan(exec->on(stream),
+                           char_positions[c].begin(),
+                           char_positions[c].end(),
+                           char_positions[c].begin());
+    rmm::device_vector<size_type> d_char_offsets(num_partitions + 1);
+    thrust::gather(exec->on(stream),
+                   d_partition_offsets.begin(),
+                   d_partition_offsets.end(),
+                   char_positions[c].begin(),
+                   d_char_offsets.begin());
+    partition_char_offsets[c] = d_char_offsets;
+  }
+
+  // lay out the buffers of each partition
+  std::vector<packed_column_layout> layout(num_partitions * num_columns);
+  std::vector<std::unique_ptr<rmm::device_buffer>> buffers;
+  std::vector<size_type> word_offsets{0};
+  for (size_type p = 0; p < num_partitions; ++p) {
+    auto const rows   = partition_offsets[p + 1] - partition_offsets[p];
+    size_t total_size = 0;
+    for (size_type c = 0; c < num_columns; ++c) {
+      auto const& col = input.column(c);
+      auto& dst       = layout[p * num_columns + c];
+      if (rows == 0) { continue; }
+      if (col.nullable()) {
+        dst.validity_pos = total_size;
+        total_size += bitmask_allocation_size_bytes(rows, packed_align);
+      }
+      if (col.type().id() == type_id::STRING) {
+        auto const chars = partition_char_offsets[c][p + 1] - partition_char_offsets[c][p];
+        dst.data_pos     = total_size;
+        total_size += util::round_up_safe((rows + 1) * sizeof(size_type), packed_align);
+        dst.chars_pos = total_size;
+        total_size += util::round_up_safe(static_cast<size_t>(chars), packed_align);
+      } else {
+        dst.data_pos = total_size;
+        total_size += util::round_up_safe(rows * size_of(col.type()), packed_align);
+      }
+    }
+    buffers.push_back(std::make_unique<rmm::device_buffer>(total_size, stream, mr));
+    word_offsets.push_back(word_offsets.back() + num_bitmask_words(rows));
+  }
+  rmm::device_vector<size_type> d_word_offsets(word_offsets);
+
+  // copy each column into the buffers of all the partitions
+  auto const d_row_partitions = row_partitions.data().get();
+  auto const d_offsets        = d_partition_offsets.data().get();
+  rmm::device_vector<size_type> valid_counts(num_partitions * num_columns, 0);
+  for (size_type c = 0; c < num_columns && num_rows > 0; ++c) {
+    auto const& col = input.column(c);
+
+    auto buffer_pointers = [&](size_t packed_column_layout::*pos) {
+      thrust::host_vector<char*> pointers(num_partitions);
+      for (size_type p = 0; p < num_partitions; ++p) {
+        pointers[p] = static_cast<char*>(buffers[p]->data()) + layout[p * num_columns + c].*pos;
+      }
+      return rmm::device_vector<char*>(pointers);
+    };
+
+    if (col.nullable()) {
+      auto const outputs = buffer_pointers(&packed_column_layout::validity_pos);
+      thrust::for_each_n(exec->on(stream),
+                         thrust::make_counting_iterator<size_type>(0),
+                         word_offsets.back(),
+                         pack_validity_words{col.null_mask(),
+                                             col.offset(),
+                                             d_gather_map,
+                                             d_offsets,
+                                             d_word_offsets.data().get(),
+                                             num_partitions,
+                                             outputs.data().get(),
+                                             valid_counts.data().get() + c * num_partitions});
+    }
+
+    auto const outputs = buffer_pointers(&packed_column_layout::data_pos);
+    if (col.type().id() == type_id::STRING) {
+      auto const chars_outputs = buffer_pointers(&packed_column_layout::chars_pos);
+      thrust::for_each_n(exec->on(stream),
+                         thrust::make_counting_iterator<size_type>(0),
+                         num_rows,
+                         pack_string_rows{col.child(0).data<size_type>() + col.offset(),
+                                          col.child(1).data<char>(),
+                                          d_gather_map,
+                                          d_row_partitions,
+                                          d_offsets,
+                                          char_positions[c].data().get(),
+                                          outputs.data().get(),
+                                          chars_outputs.data().get()});
+      continue;
+    }
+
+    // fixed-width elements are copied as integers of their size
+    auto pack_rows = [&](auto element) {
+      using T = decltype(element);
+      thrust::for_each_n(exec->on(stream),
+                         thrust::make_counting_iterator<size_type>(0),
+                         num_rows,
+                         pack_fixed_width_rows<T>{col.data<T>(),
+                                                  d_gather_map,
+                                                  d_row_partitions,
+                                                  d_offsets,
+                                                  outputs.data().get()});
+    };
+    switch (size_of(col.type())) {
+      case 1: pack_rows(int8_t{}); break;
+      case 2: pack_rows(int16_t{}); break;
+      case 4: pack_rows(int32_t{}); break;
+      case 8: pack_rows(int64_t{}); break;
+      default: CUDF_FAIL("Unsupported element size for hash_partition_packed");
+    }
+  }
+  thrust::host_vector<size_type> h_valid_counts(valid_counts);
+
+  // build the views of the partitions into their buffers
+  std::vector<contiguous_split_result> result;
+  for (size_type p = 0; p < num_partitions; ++p) {
+    auto const rows = partition_offsets[p + 1] - partition_offsets[p];
+    char* buf       = static_cast<char*>(buffers[p]->data());
+    std::vector<column_view> out_cols;
+    for (size_type c = 0; c < num_columns; ++c) {
+      auto const& col      = input.column(c);
+      auto const& dst      = layout[p * num_columns + c];
+      bool const has_nulls = col.nullable() && rows > 0;
+      auto const null_mask =
+        has_nulls ? reinterpret_cast<bitmask_type const*>(buf + dst.validity_pos) : nullptr;
+      auto const null_count = has_nulls ? rows - h_valid_counts[c * num_partitions + p] : 0;
+      if (col.type().id() == type_id::STRING) {
+        auto const chars = partition_char_offsets[c][p + 1] - partition_char_offsets[c][p];
+        column_view const offsets{data_type{type_id::INT32},
+                                  rows > 0 ? rows + 1 : 0,
+                                  rows > 0 ? buf + dst.data_pos : nullptr};
+        column_view const chars_view{
+          data_type{type_id::INT8}, chars, chars > 0 ? buf + dst.chars_pos : nullptr};
+        out_cols.emplace_back(col.type(),
+                              rows,
+                              nullptr,
+                              null_mask,
+                              null_count,
+                              0,
+                              std::vector<column_view>{offsets, chars_view});
+      } else {
+        out_cols.emplace_back(
+          col.type(), rows, rows > 0 ? buf + dst.data_pos : nullptr, null_mask, null_count);
+      }
+    }
+    result.push_back(contiguous_split_result{table_view{out_cols}, std::move(buffers[p])});
+  }
+  return result;
+}
+
+/**
+ * @brief Hash partitions the rows of `input` directly into one contiguous buffer per partition.
+ */
+template <template <bool> class row_hasher_t, bool hash_has_nulls>
+std::vector<contiguous_split_result> hash_partition_packed_table(
+  table_view const& input,
+  table_view const& table_to_hash,
+  size_type num_partitions,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  auto const num_rows = table_to_hash.num_rows();
+  std::vector<size_type> partition_offsets(num_partitions + 1, 0);
+  auto row_partition_numbers = rmm::device_vector<size_type>(num_rows);
+
+  if (num_rows > 0) {
+    auto const grid_size =
+      util::div_rounding_up_safe(num_rows, FALLBACK_BLOCK_SIZE * FALLBACK_ROWS_PER_THREAD);
+    auto block_partition_sizes = rmm::device_vector<size_type>(grid_size * num_partitions);
+    auto scanned_block_partition_sizes =
+      rmm::device_vector<size_type>(grid_size * num_partitions);
+    auto global_partition_sizes = rmm::device_vector<size_type>(num_partitions, size_type{0});
+    auto row_partition_offset   = rmm::device_vector<size_type>(num_rows);
+
+    compute_partitions<row_hasher_t, hash_has_nulls>(table_to_hash,
+                                                      num_partitions,
+                                                      grid_size,
+                                                      FALLBACK_BLOCK_SIZE,
+                                                      row_partition_numbers.data().get(),
+                                                      row_partition_offset.data().get(),
+                                                      block_partition_sizes.data().get(),
+                                                      global_partition_sizes.data().get(),
+                                                      stream);
+    thrust::exclusive_scan(rmm::exec_policy(stream)->on(stream),
+                           block_partition_sizes.begin(),
+                           block_partition_sizes.end(),
+                           scanned_block_partition_sizes.data().get());
+
+    // the partition numbers become the output location of each row
+    compute_row_output_locations<<<grid_size,
+                                   FALLBACK_BLOCK_SIZE,
+                                   num_partitions * sizeof(size_type),
+                                   stream>>>(row_partition_numbers.data().get(),
+                                             num_rows,
+                                             num_partitions,
+                                             scanned_block_partition_sizes.data().get());
+
+    thrust::host_vector<size_type> partition_sizes(global_partition_sizes);
+    std::partial_sum(
+      partition_sizes.begin(), partition_sizes.end(), partition_offsets.begin() + 1);
+  }
+
+  return pack_partitions(input, row_partition_numbers.data().get(), partition_offsets, mr, stream);
+}
+
 struct dispatch_map_type {
   /**
    * @brief Partitions the table `t` according to the `partition_map`.
@@ -728,6 +1173,7 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   table_view const& input,
   std::vector<size_type> const& columns_to_hash,
   int num_partitions,
+  hash_id hash_function,
   rmm::mr::device_memory_resource* mr,
   cudaStream_t stream = 0)
 {
@@ -738,14 +1184,91 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
     return std::make_pair(empty_like(input), std::vector<size_type>{});
   }
 
-  if (has_nulls(table_to_hash)) {
-    return hash_partition_table<true>(input, table_to_hash, num_partitions, mr, stream);
-  } else {
-    return hash_partition_table<false>(input, table_to_hash, num_partitions, mr, stream);
+  bool const nullable = has_nulls(table_to_hash);
+  switch (hash_function) {
+    case hash_id::HASH_MURMUR3:
+      return nullable ? hash_partition_table<murmur_row_hasher, true>(
+                          input, table_to_hash, num_partitions, mr, stream)
+                      : hash_partition_table<murmur_row_hasher, false>(
+                          input, table_to_hash, num_partitions, mr, stream);
+    case hash_id::HASH_XXHASH64:
+      return nullable ? hash_partition_table<xxhash_row_hasher, true>(
+                          input, table_to_hash, num_partitions, mr, stream)
+                      : hash_partition_table<xxhash_row_hasher, false>(
+                          input, table_to_hash, num_partitions, mr, stream);
+    case hash_id::HASH_SPARK_MURMUR3:
+      return nullable ? hash_partition_table<spark_murmur_row_hasher, true>(
+                          input, table_to_hash, num_partitions, mr, stream)
+                      : hash_partition_table<spark_murmur_row_hasher, false>(
+                          input, table_to_hash, num_partitions, mr, stream);
+    case hash_id::HASH_HIVE:
+      return nullable ? hash_partition_table<hive_bucket_row_hasher, true>(
+                          input, table_to_hash, num_partitions, mr, stream)
+                      : hash_partition_table<hive_bucket_row_hasher, false>(
+                          input, table_to_hash, num_partitions, mr, stream);
+    default: CUDF_FAIL("Unsupported hash function in hash_partition");
+  }
+}
+
+std::vector<contiguous_split_result> hash_partition_packed(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  hash_id hash_function,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream = 0)
+{
+  CUDF_EXPECTS(std::all_of(input.begin(),
+                           input.end(),
+                           [](column_view const& col) {
+                             return is_fixed_width(col.type()) or
+                                    col.type().id() == type_id::STRING;
+                           }),
+               "hash_partition_packed supports only fixed-width and string columns");
+  auto table_to_hash = input.select(columns_to_hash);
+
+  // Return empty result if there are no partitions or nothing to hash
+  if (num_partitions <= 0 || table_to_hash.num_columns() == 0) { return {}; }
+
+  bool const nullable = has_nulls(table_to_hash);
+  switch (hash_function) {
+    case hash_id::HASH_MURMUR3:
+      return nullable ? hash_partition_packed_table<murmur_row_hasher, true>(
+                          input, table_to_hash, num_partitions, mr, stream)
+                      : hash_partition_packed_table<murmur_row_hasher, false>(
+                          input, table_to_hash, num_partitions, mr, stream);
+    case hash_id::HASH_XXHASH64:
+      return nullable ? hash_partition_packed_table<xxhash_row_hasher, true>(
+                          input, table_to_hash, num_partitions, mr, stream)
+                      : hash_partition_packed_table<xxhash_row_hasher, false>(
+                          input, table_to_hash, num_partitions, mr, stream);
+    case hash_id::HASH_SPARK_MURMUR3:
+      return nullable ? hash_partition_packed_table<spark_murmur_row_hasher, true>(
+                          input, table_to_hash, num_partitions, mr, stream)
+                      : hash_partition_packed_table<spark_murmur_row_hasher, false>(
+                          input, table_to_hash, num_partitions, mr, stream);
+    case hash_id::HASH_HIVE:
+      return nullable ? hash_partition_packed_table<hive_bucket_row_hasher, true>(
+                          input, table_to_hash, num_partitions, mr, stream)
+                      : hash_partition_packed_table<hive_bucket_row_hasher, false>(
+                          input, table_to_hash, num_partitions, mr, stream);
+    default: CUDF_FAIL("Unsupported hash function in hash_partition_packed");
   }
 }
 }  // namespace local
 
+std::vector<contiguous_split_result> hash_partition_packed(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  hash_id hash_function,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  return local::hash_partition_packed(
+    input, columns_to_hash, num_partitions, hash_function, mr, stream);
+}
+
 std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
   table_view const& t,
   column_view const& partition_map,
@@ -764,6 +1287,48 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
   return cudf::type_dispatcher(
     partition_map.type(), dispatch_map_type{}, t, partition_map, num_partitions, mr, stream);
 }
+
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  table_view const& splitters,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream = 0)
+{
+  CUDF_EXPECTS(input.num_columns() == splitters.num_columns(),
+               "Mismatch between number of columns in input and splitters.");
+
+  // the partition of each row is the number of splitters ordered before it
+  auto const partition_map = detail::lower_bound(
+    splitters, input, column_order, null_precedence, rmm::mr::get_default_resource(), stream);
+  return partition(input, partition_map->view(), splitters.num_rows() + 1, mr, stream);
+}
+
+std::unique_ptr<table> range_partition_splitters(table_view const& sample,
+                                                 size_type num_partitions,
+                                                 std::vector<order> const& column_order,
+                                                 std::vector<null_order> const& null_precedence,
+                                                 rmm::mr::device_memory_resource* mr,
+                                                 cudaStream_t stream = 0)
+{
+  CUDF_EXPECTS(num_partitions > 0, "Number of partitions must be positive.");
+  auto const num_rows = sample.num_rows();
+  if (num_rows == 0) { return empty_like(sample); }
+
+  auto const sorted = detail::sorted_order(
+    sample, column_order, null_precedence, rmm::mr::get_default_resource(), stream);
+
+  // splitter i - 1 is the sorted sample row below which i / num_partitions of the sample falls
+  auto const splitter_rows = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(1),
+    [d_sorted = sorted->view().data<size_type>(), num_rows, num_partitions] __device__(
+      size_type i) {
+      return d_sorted[static_cast<int64_t>(i) * num_rows / num_partitions];
+    });
+  return detail::gather(
+    sample, splitter_rows, splitter_rows + (num_partitions - 1), false, mr, stream);
+}
 }  // namespace detail
 
 // Partition based on hash values
@@ -771,10 +1336,46 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   table_view const& input,
   std::vector<size_type> const& columns_to_hash,
   int num_partitions,
+  hash_id hash_function,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::local::hash_partition(input, columns_to_hash, num_partitions, hash_function, mr);
+}
+
+// Partition based on hash values into contiguous buffers
+std::vector<contiguous_split_result> hash_partition_packed(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  hash_id hash_function,
   rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::local::hash_partition(input, columns_to_hash, num_partitions, mr);
+  return detail::hash_partition_packed(input, columns_to_hash, num_partitions, hash_function, mr);
+}
+
+// Partition between sorted splitters
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  table_view const& splitters,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::range_partition(input, splitters, column_order, null_precedence, mr);
+}
+
+std::unique_ptr<table> range_partition_splitters(table_view const& sample,
+                                                 size_type num_partitions,
+                                                 std::vector<order> const& column_order,
+                                                 std::vector<null_order> const& null_precedence,
+                                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::range_partition_splitters(
+    sample, num_partitions, column_order, null_precedence, mr);
 }
 
 // Partition based on an explicit partition map
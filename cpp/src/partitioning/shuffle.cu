@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/partitioning.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+namespace cudf {
+namespace detail {
+std::unique_ptr<table> shuffle(table_view const& input,
+                               std::vector<size_type> const& columns_to_hash,
+                               shuffle_communicator& communicator,
+                               hash_id hash_function,
+                               rmm::mr::device_memory_resource* mr,
+                               cudaStream_t stream = 0)
+{
+  CUDF_EXPECTS(not columns_to_hash.empty(), "shuffle requires columns to hash");
+  auto const rank = communicator.rank();
+  auto const size = communicator.size();
+  CUDF_EXPECTS(rank >= 0 && rank < size, "Invalid rank of the communicator");
+
+  // each partition is written once, into the buffer it is sent from
+  auto const partitions = hash_partition_packed(
+    input, columns_to_hash, size, hash_function, rmm::mr::get_default_resource(), stream);
+
+  // start all the sends before receiving, each rank sending to the next ones first so that the
+  // ranks do not all send to the same rank at once
+  for (int step = 1; step < size; ++step) {
+    auto const destination = (rank + step) % size;
+    auto const& partition  = partitions[destination];
+    auto const metadata    = cudf::pack_metadata(
+      partition.table, partition.all_data->data(), partition.all_data->size());
+    communicator.send(destination, metadata, *partition.all_data, stream);
+  }
+
+  // the received tables are viewed in place, they are only copied by the concatenation
+  std::vector<packed_columns> received(size);
+  std::vector<table_view> views(size);
+  views[rank] = partitions[rank].table;
+  for (int step = 1; step < size; ++step) {
+    auto const source = (rank - step + size) % size;
+    received[source]  = communicator.recv(source, rmm::mr::get_default_resource(), stream);
+    views[source]     = cudf::unpack(received[source]);
+  }
+
+  auto result = concatenate(views, mr, stream);
+
+  // the partitions must outlive their sends
+  communicator.synchronize();
+  return result;
+}
+}  // namespace detail
+
+std::unique_ptr<table> shuffle(table_view const& input,
+                               std::vector<size_type> const& columns_to_hash,
+                               shuffle_communicator& communicator,
+                               hash_id hash_function,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::shuffle(input, columns_to_hash, communicator, hash_function, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,342 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <quantiles/quantile_select.hpp>
+#include <quantiles/quantiles_util.hpp>
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <type_traits>
+
+namespace cudf {
+namespace detail {
+namespace {
+constexpr int radix_bits            = 8;
+constexpr size_type radix_bins      = 1 << radix_bits;
+constexpr size_type block_size      = 256;
+constexpr size_type rows_per_thread = 16;
+constexpr size_type max_slots       = 1 << 14;  ///< At most 16 MB of histograms
+constexpr size_type max_shared      = 16;       ///< Histograms kept in shared memory, 16 KB
+
+/**
+ * @brief Maps values to unsigned keys that are ordered as the values
+ */
+template <typename T, typename Enable = void>
+struct radix_key;
+
+template <typename T>
+struct radix_key<T,
+                 std::enable_if_t<std::is_integral<T>::value and
+                                  not std::is_same<T, bool>::value>> {
+  using type = std::make_unsigned_t<T>;
+  static constexpr type sign_bit =
+    std::is_signed<T>::value ? static_cast<type>(type{1} << (sizeof(T) * 8 - 1)) : type{0};
+
+  __device__ static type encode(T value) { return static_cast<type>(value ^ sign_bit); }
+  __device__ static T decode(type key) { return static_cast<T>(static_cast<type>(key ^ sign_bit)); }
+};
+
+template <typename T>
+struct radix_key<T, std::enable_if_t<std::is_same<T, bool>::value>> {
+  using type = uint8_t;
+
+  __device__ static type encode(T value) { return value ? 1 : 0; }
+  __device__ static T decode(type key) { return key != 0; }
+};
+
+// Flips all the bits of negative values and the sign bit of positive ones; NaNs map to the
+// largest key, after infinity
+template <typename T>
+struct radix_key<T, std::enable_if_t<std::is_floating_point<T>::value>> {
+  using type = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+  static constexpr type sign_bit = type{1} << (sizeof(T) * 8 - 1);
+
+  __device__ static type encode(T value)
+  {
+    if (isnan(value)) { return ~type{0}; }
+    type bits;
+    memcpy(&bits, &value, sizeof(T));
+    return (bits & sign_bit) ? ~bits : (bits | sign_bit);
+  }
+  __device__ static T decode(type key)
+  {
+    type const bits = (key & sign_bit) ? (key & ~sign_bit) : ~key;
+    T value;
+    memcpy(&value, &bits, sizeof(T));
+    return value;
+  }
+};
+
+/**
+ * @brief Counts the next digit of the keys of the valid values whose higher bits match the
+ * prefix of each slot
+ *
+ * Slot `s` selects a rank of segment `s / slots_per_segment`; its histogram is the `radix_bins`
+ * counters at `histograms + s * radix_bins`. All the rows are in segment 0 if `labels` is null.
+ * With `block_local`, the histograms are built in shared memory and added to `histograms` once
+ * per block.
+ */
+template <typename T, typename Key>
+__global__ void select_histogram_kernel(column_device_view values,
+                                        size_type const* labels,
+                                        bitmask_type const* labels_mask,
+                                        size_type labels_offset,
+                                        size_type slots_per_segment,
+                                        size_type num_slots,
+                                        Key const* prefixes,
+                                        Key high_mask,
+                                        int shift,
+                                        bool block_local,
+                                        size_type* histograms)
+{
+  extern __shared__ size_type block_histograms[];
+  size_type* hist = block_local ? block_histograms : histograms;
+  if (block_local) {
+    for (size_type i = threadIdx.x; i < num_slots * radix_bins; i += blockDim.x) { hist[i] = 0; }
+    __syncthreads();
+  }
+
+  for (size_type row = threadIdx.x + blockIdx.x * blockDim.x; row < values.size();
+       row += blockDim.x * gridDim.x) {
+    if (values.is_null(row)) { continue; }
+    if (labels_mask != nullptr and not bit_is_set(labels_mask, labels_offset + row)) { continue; }
+    auto const key   = radix_key<T>::encode(values.element<T>(row));
+    auto const digit = static_cast<size_type>((key >> shift) & (radix_bins - 1));
+    auto const first = labels != nullptr ? labels[row] * slots_per_segment : 0;
+    for (size_type s = first; s < first + slots_per_segment; ++s) {
+      if ((key & high_mask) == prefixes[s]) { atomicAdd(hist + s * radix_bins + digit, 1); }
+    }
+  }
+
+  if (block_local) {
+    __syncthreads();
+    for (size_type i = threadIdx.x; i < num_slots * radix_bins; i += blockDim.x) {
+      if (hist[i] != 0) { atomicAdd(histograms + i, hist[i]); }
+    }
+  }
+}
+
+/**
+ * @brief Returns the number of ranks a quantile interpolates between
+ */
+size_type ranks_per_quantile(interpolation interp)
+{
+  return (interp == interpolation::LINEAR or interp == interpolation::MIDPOINT) ? 2 : 1;
+}
+
+struct select_quantiles_functor {
+  template <typename T>
+  std::enable_if_t<std::is_arithmetic<T>::value, std::unique_ptr<column>> operator()(
+    column_view const& values,
+    column_view const& segment_labels,
+    size_type num_segments,
+    std::vector<double> const& quantiles,
+    interpolation interp,
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream)
+  {
+    using Key = typename radix_key<T>::type;
+
+    auto const num_quantiles     = static_cast<size_type>(quantiles.size());
+    auto const quantile_ranks    = ranks_per_quantile(interp);
+    auto const slots_per_segment = num_quantiles * quantile_ranks;
+    auto const num_slots         = num_segments * slots_per_segment;
+    auto const num_rows          = num_segments * num_quantiles;
+
+    auto result = make_numeric_column(
+      data_type{type_id::FLOAT64}, num_rows, mask_state::UNALLOCATED, stream, mr);
+    if (num_rows == 0) { return result; }
+    if (values.is_empty()) {
+      result->set_null_mask(create_null_mask(num_rows, mask_state::ALL_NULL, stream, mr),
+                            num_rows);
+      return result;
+    }
+
+    rmm::device_vector<double> d_quantiles(quantiles);
+    rmm::device_vector<Key> prefixes(num_slots, Key{0});
+    rmm::device_vector<size_type> ranks(num_slots, 0);
+    rmm::device_vector<size_type> counts(num_segments, 0);
+    rmm::device_vector<size_type> histograms(num_slots * radix_bins);
+
+    auto const d_values     = column_device_view::create(values, stream);
+    auto const block_local  = num_slots <= max_shared;
+    auto const shared_bytes = block_local ? num_slots * radix_bins * sizeof(size_type) : 0;
+    cudf::detail::grid_1d const grid{values.size(), block_size, rows_per_thread};
+
+    for (int shift = static_cast<int>(sizeof(Key) * 8) - radix_bits; shift >= 0;
+         shift -= radix_bits) {
+      auto const high_bits = static_cast<int>(sizeof(Key) * 8) - shift - radix_bits;
+      auto const all_bits  = static_cast<Key>(~Key{0});
+      auto const high_mask =
+        high_bits == 0 ? Key{0} : static_cast<Key>(all_bits << (shift + radix_bits));
+
+      CUDA_TRY(cudaMemsetAsync(
+        histograms.data().get(), 0, histograms.size() * sizeof(size_type), stream));
+      select_histogram_kernel<T, Key>
+        <<<grid.num_blocks, grid.num_threads_per_block, shared_bytes, stream>>>(
+          *d_values,
+          segment_labels.is_empty() ? nullptr : segment_labels.data<size_type>(),
+          segment_labels.null_mask(),
+          segment_labels.offset(),
+          slots_per_segment,
+          num_slots,
+          prefixes.data().get(),
+          high_mask,
+          shift,
+          block_local,
+          histograms.data().get());
+      CUDA_TRY(cudaGetLastError());
+
+      // The first histogram of a slot counts all the valid values of its segment, from which
+      // the rank it selects follows; each pass then appends the digit holding that rank
+      thrust::for_each_n(
+        rmm::exec_policy(stream)->on(stream),
+        thrust::make_counting_iterator<size_type>(0),
+        num_slots,
+        [d_histograms = histograms.data().get(),
+         d_prefixes   = prefixes.data().get(),
+         d_ranks      = ranks.data().get(),
+         d_counts     = counts.data().get(),
+         d_quantiles  = d_quantiles.data().get(),
+         first_pass   = high_bits == 0,
+         slots_per_segment,
+         quantile_ranks,
+         interp,
+         shift] __device__(size_type s) {
+          auto const histogram = d_histograms + s * radix_bins;
+          if (first_pass) {
+            size_type count = 0;
+            for (size_type d = 0; d < radix_bins; ++d) { count += histogram[d]; }
+            auto const slot = s % slots_per_segment;
+            if (slot == 0) { d_counts[s / slots_per_segment] = count; }
+            quantile_index const idx(count, d_quantiles[slot / quantile_ranks]);
+            auto const higher = quantile_ranks == 2 ? slot % 2 == 1
+                                                    : interp == interpolation::HIGHER;
+            d_ranks[s] = interp == interpolation::NEAREST ? idx.nearest
+                         : higher                         ? idx.higher
+                                                          : idx.lower;
+          }
+          size_type below = 0;
+          for (size_type d = 0; d < radix_bins; ++d) {
+            if (d_ranks[s] < below + histogram[d]) {
+              d_prefixes[s] |= static_cast<Key>(static_cast<Key>(d) << shift);
+              d_ranks[s] -= below;
+              return;
+            }
+            below += histogram[d];
+          }
+        });
+    }
+
+    thrust::for_each_n(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      num_rows,
+      [d_result    = result->mutable_view().data<double>(),
+       d_prefixes  = prefixes.data().get(),
+       d_counts    = counts.data().get(),
+       d_quantiles = d_quantiles.data().get(),
+       num_quantiles,
+       quantile_ranks,
+       interp] __device__(size_type i) {
+        auto const count = d_counts[i / num_quantiles];
+        if (count == 0) { return; }
+        auto const slot  = i * quantile_ranks;
+        auto const lower = radix_key<T>::decode(d_prefixes[slot]);
+        auto const upper =
+          quantile_ranks == 2 ? radix_key<T>::decode(d_prefixes[slot + 1]) : lower;
+        if (count < 2 or quantile_ranks == 1) {
+          d_result[i] = static_cast<double>(lower);
+        } else if (interp == interpolation::LINEAR) {
+          quantile_index const idx(count, d_quantiles[i % num_quantiles]);
+          d_result[i] = interpolate::linear<double>(lower, upper, idx.fraction);
+        } else {
+          d_result[i] = interpolate::midpoint<double>(lower, upper);
+        }
+      });
+
+    auto null_mask = valid_if(
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(num_rows),
+      [d_counts = counts.data().get(), num_quantiles] __device__(size_type i) {
+        return d_counts[i / num_quantiles] > 0;
+      },
+      stream,
+      mr);
+    if (null_mask.second > 0) {
+      result->set_null_mask(std::move(null_mask.first), null_mask.second);
+    }
+    return result;
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not std::is_arithmetic<T>::value, std::unique_ptr<column>> operator()(
+    Args&&...)
+  {
+    CUDF_FAIL("Only arithmetic types are supported in quantile selection");
+  }
+};
+
+}  // namespace
+
+bool is_quantile_select_supported(data_type type,
+                                  size_type num_segments,
+                                  size_type num_quantiles,
+                                  interpolation interp)
+{
+  return is_numeric(type) and num_quantiles > 0 and
+         static_cast<int64_t>(num_segments) * num_quantiles * ranks_per_quantile(interp) <=
+           max_slots;
+}
+
+std::unique_ptr<column> select_quantiles(column_view const& values,
+                                         column_view const& segment_labels,
+                                         size_type num_segments,
+                                         std::vector<double> const& quantiles,
+                                         interpolation interp,
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream)
+{
+  CUDF_EXPECTS(segment_labels.is_empty() or segment_labels.size() == values.size(),
+               "Size mismatch between values and segment labels");
+  CUDF_EXPECTS(segment_labels.is_empty() or segment_labels.type().id() == type_id::INT32,
+               "Segment labels must be of INT32 type");
+  CUDF_EXPECTS(not segment_labels.is_empty() or num_segments == 1,
+               "Values without segment labels are a single segment");
+  return type_dispatcher(values.type(),
+                         select_quantiles_functor{},
+                         values,
+                         segment_labels,
+                         num_segments,
+                         quantiles,
+                         interp,
+                         mr,
+                         stream);
+}
+
+}  // namespace detail
+}  // namespace cudf
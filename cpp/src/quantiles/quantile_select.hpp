@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/mr/device/default_memory_resource.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Returns whether `select_quantiles` supports computing `num_quantiles` quantiles of
+ * each of `num_segments` segments of a column of type `type`
+ *
+ * Selection keeps a histogram for each value it selects, so it is only used for arithmetic
+ * columns when the number of segments times the number of quantiles is small.
+ */
+bool is_quantile_select_supported(data_type type,
+                                  size_type num_segments,
+                                  size_type num_quantiles,
+                                  interpolation interp);
+
+/**
+ * @brief Computes exact quantiles of the valid values of each segment of a column without
+ * sorting it
+ *
+ * The values of the ranks a quantile interpolates between are found by a radix select: each
+ * pass builds a histogram of the next 8 bits of the values whose higher bits match the bits
+ * selected so far, and picks the bucket holding the rank. A column of `N`-byte values is read
+ * `N` times, where sorting it would take several passes over the values and their indices.
+ *
+ * The results are the same as `group_quantiles` of the sorted values. NaNs are ordered after
+ * all other values, as they are sorted.
+ *
+ * @param values The values, of an arithmetic type
+ * @param segment_labels The `INT32` segment of each row of `values`, in `[0, num_segments)`.
+ * Rows with a null label are skipped. If empty, all the rows are in a single segment.
+ * @param num_segments The number of segments
+ * @param quantiles The quantiles to compute, in `[0, 1]`
+ * @param interp Strategy used to interpolate between the values on either side of a quantile
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return `FLOAT64` column whose row `i * quantiles.size() + j` is quantile `j` of segment `i`,
+ * null if the segment has no valid values
+ */
+std::unique_ptr<column> select_quantiles(
+  column_view const& values,
+  column_view const& segment_labels,
+  size_type num_segments,
+  std::vector<double> const& quantiles,
+  interpolation interp,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+}  // namespace detail
+}  // namespace cudf
@@ -18,6 +18,7 @@
 
 #include <cudf/detail/reduction.cuh>
 
+#include <cudf/null_mask.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 #include <rmm/device_scalar.hpp>
@@ -56,7 +57,17 @@ std::unique_ptr<scalar> compound_reduction(column_view const& col,
   std::unique_ptr<scalar> result;
   Op compound_op{};
 
-  if (col.has_nulls()) {
+  if (col.has_nulls() && detail::reduce_valid_words(col)) {
+    // reduce a bitmask word of elements per item, reading only the valid elements
+    using IntermediateType = typename Op::template intermediate<ResultType>::IntermediateType;
+    auto it                = detail::make_valid_word_iterator<ElementType>(
+      *dcol,
+      compound_op.template get_element_transformer<ResultType>(),
+      compound_op.get_binary_op(),
+      compound_op.template get_identity<IntermediateType>());
+    result = detail::reduce<Op, decltype(it), ResultType>(
+      it, num_bitmask_words(col.size()), compound_op, valid_count, ddof, mr, stream);
+  } else if (col.has_nulls()) {
     auto it = thrust::make_transform_iterator(
       dcol->pair_begin<ElementType, true>(),
       compound_op.template get_null_replacing_element_transformer<ResultType>());
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+// The translation unit for the reductions computed together in a single pass
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/reduction_functions.hpp>
+#include <cudf/detail/reduction_operators.cuh>
+#include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform_reduce.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace reduction {
+namespace {
+bool is_fused(aggregation::Kind kind)
+{
+  switch (kind) {
+    case aggregation::SUM:
+    case aggregation::SUM_OF_SQUARES:
+    case aggregation::MIN:
+    case aggregation::MAX:
+    case aggregation::MEAN:
+    case aggregation::VARIANCE:
+    case aggregation::STD: return true;
+    default: return false;
+  }
+}
+
+// intermediate data structure shared by all fused reductions
+template <typename ResultType>
+struct partial_results {
+  ResultType sum;             /// the sum of the values
+  ResultType sum_of_squares;  /// the sum of the squared values
+  ResultType min;             /// the minimum value
+  ResultType max;             /// the maximum value
+};
+
+template <typename ResultType>
+CUDA_HOST_DEVICE_CALLABLE partial_results<ResultType> identity_partial_results()
+{
+  return partial_results<ResultType>{DeviceSum::identity<ResultType>(),
+                                     DeviceSum::identity<ResultType>(),
+                                     DeviceMin::identity<ResultType>(),
+                                     DeviceMax::identity<ResultType>()};
+}
+
+// transformer of the element `i` of the column into `partial_results`,
+// null elements are replaced by the identity
+template <typename ElementType, typename ResultType>
+struct element_partial_results {
+  column_device_view col;
+
+  CUDA_DEVICE_CALLABLE partial_results<ResultType> operator()(size_type i) const
+  {
+    if (not col.is_valid(i)) { return identity_partial_results<ResultType>(); }
+    auto const value = static_cast<ResultType>(col.element<ElementType>(i));
+    return partial_results<ResultType>{value, static_cast<ResultType>(value * value), value, value};
+  }
+};
+
+// binary operator combining two `partial_results`
+template <typename ResultType>
+struct combine_partial_results {
+  CUDA_HOST_DEVICE_CALLABLE partial_results<ResultType> operator()(
+    partial_results<ResultType> const& lhs, partial_results<ResultType> const& rhs) const
+  {
+    return partial_results<ResultType>{DeviceSum{}(lhs.sum, rhs.sum),
+                                       DeviceSum{}(lhs.sum_of_squares, rhs.sum_of_squares),
+                                       DeviceMin{}(lhs.min, rhs.min),
+                                       DeviceMax{}(lhs.max, rhs.max)};
+  }
+};
+
+// compute the result of `agg` from the partial results, or nullptr if it is not fused
+template <typename ResultType>
+std::unique_ptr<scalar> make_fused_result(aggregation const& agg,
+                                          partial_results<ResultType> const& partial,
+                                          size_type valid_count,
+                                          rmm::mr::device_memory_resource* mr,
+                                          cudaStream_t stream)
+{
+  // `mean`, `var`, `std` only accept floating points as output dtype
+  constexpr bool is_compound_supported = std::is_floating_point<ResultType>::value;
+  auto make_result = [&](ResultType value) { return make_fixed_width_scalar(value, stream, mr); };
+  switch (agg.kind) {
+    case aggregation::SUM: return make_result(partial.sum);
+    case aggregation::SUM_OF_SQUARES: return make_result(partial.sum_of_squares);
+    case aggregation::MIN: return make_result(partial.min);
+    case aggregation::MAX: return make_result(partial.max);
+    case aggregation::MEAN: {
+      if (not is_compound_supported) { return nullptr; }
+      return make_result(
+        op::mean::intermediate<ResultType>::compute_result(partial.sum, valid_count, 1));
+    }
+    case aggregation::VARIANCE: {
+      if (not is_compound_supported) { return nullptr; }
+      auto const ddof = static_cast<std_var_aggregation const&>(agg)._ddof;
+      return make_result(op::variance::intermediate<ResultType>::compute_result(
+        var_std<ResultType>{partial.sum, partial.sum_of_squares}, valid_count, ddof));
+    }
+    case aggregation::STD: {
+      if (not is_compound_supported) { return nullptr; }
+      auto const ddof = static_cast<std_var_aggregation const&>(agg)._ddof;
+      return make_result(op::standard_deviation::intermediate<ResultType>::compute_result(
+        var_std<ResultType>{partial.sum, partial.sum_of_squares}, valid_count, ddof));
+    }
+    default: return nullptr;
+  }
+}
+
+// @brief result type dispatcher for fused reductions
+template <typename ElementType>
+struct result_type_dispatcher {
+ private:
+  template <typename ResultType>
+  static constexpr bool is_supported_v()
+  {
+    return std::is_arithmetic<ResultType>::value && !std::is_same<ResultType, bool>::value;
+  }
+
+ public:
+  template <typename ResultType, std::enable_if_t<is_supported_v<ResultType>()>* = nullptr>
+  std::vector<std::unique_ptr<scalar>> operator()(
+    column_view const& col,
+    std::vector<std::unique_ptr<aggregation>> const& aggs,
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream)
+  {
+    auto dcol    = column_device_view::create(col, stream);
+    auto partial = thrust::transform_reduce(rmm::exec_policy(stream)->on(stream),
+                                            thrust::make_counting_iterator<size_type>(0),
+                                            thrust::make_counting_iterator(col.size()),
+                                            element_partial_results<ElementType, ResultType>{*dcol},
+                                            identity_partial_results<ResultType>(),
+                                            combine_partial_results<ResultType>{});
+
+    size_type const valid_count = col.size() - col.null_count();
+    std::vector<std::unique_ptr<scalar>> results(aggs.size());
+    std::transform(aggs.begin(), aggs.end(), results.begin(), [&](auto const& agg) {
+      return make_fused_result(*agg, partial, valid_count, mr, stream);
+    });
+    return results;
+  }
+
+  template <typename ResultType, std::enable_if_t<not is_supported_v<ResultType>()>* = nullptr>
+  std::vector<std::unique_ptr<scalar>> operator()(
+    column_view const&,
+    std::vector<std::unique_ptr<aggregation>> const& aggs,
+    rmm::mr::device_memory_resource*,
+    cudaStream_t)
+  {
+    return std::vector<std::unique_ptr<scalar>>(aggs.size());
+  }
+};
+
+// @brief input column element dispatcher for fused reductions
+struct element_type_dispatcher {
+  template <typename ElementType,
+            std::enable_if_t<std::is_arithmetic<ElementType>::value>* = nullptr>
+  std::vector<std::unique_ptr<scalar>> operator()(
+    column_view const& col,
+    std::vector<std::unique_ptr<aggregation>> const& aggs,
+    data_type const output_dtype,
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream)
+  {
+    return type_dispatcher(
+      output_dtype, result_type_dispatcher<ElementType>(), col, aggs, mr, stream);
+  }
+
+  template <typename ElementType,
+            std::enable_if_t<not std::is_arithmetic<ElementType>::value>* = nullptr>
+  std::vector<std::unique_ptr<scalar>> operator()(
+    column_view const&,
+    std::vector<std::unique_ptr<aggregation>> const& aggs,
+    data_type const,
+    rmm::mr::device_memory_resource*,
+    cudaStream_t)
+  {
+    return std::vector<std::unique_ptr<scalar>>(aggs.size());
+  }
+};
+}  // namespace
+
+std::vector<std::unique_ptr<scalar>> fused_reductions(
+  column_view const& col,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  data_type const output_dtype,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  if (std::none_of(aggs.begin(), aggs.end(), [](auto const& agg) { return is_fused(agg->kind); }))
+    return std::vector<std::unique_ptr<scalar>>(aggs.size());
+
+  return type_dispatcher(
+    col.type(), element_type_dispatcher{}, col, aggs, output_dtype, mr, stream);
+}
+
+}  // namespace reduction
+}  // namespace cudf
@@ -15,16 +15,20 @@
  */
 
 #include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/detail/stream_compaction.hpp>
 #include <cudf/quantiles.hpp>
 #include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
 
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/reduction_functions.hpp>
 #include <cudf/reduction.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
+#include <quantiles/quantile_select.hpp>
 
 namespace cudf {
 namespace detail {
@@ -65,6 +69,11 @@ struct reduce_dispatch_functor {
         return reduction::standard_deviation(col, output_dtype, var_agg->_ddof, mr, stream);
       } break;
       case aggregation::MEDIAN: {
+        if (is_quantile_select_supported(col.type(), 1, 1, interpolation::LINEAR)) {
+          auto col_ptr =
+            select_quantiles(col, column_view{}, 1, {0.5}, interpolation::LINEAR, mr, stream);
+          return get_element(*col_ptr, 0, mr);
+        }
         auto sorted_indices       = sorted_order(table_view{{col}}, {}, {null_order::AFTER}, mr);
         auto valid_sorted_indices = split(*sorted_indices, {col.size() - col.null_count()})[0];
         auto col_ptr = quantile(col, {0.5}, interpolation::LINEAR, valid_sorted_indices, true, mr);
@@ -74,6 +83,16 @@ struct reduce_dispatch_functor {
         auto quantile_agg = static_cast<quantile_aggregation const *>(agg.get());
         CUDF_EXPECTS(quantile_agg->_quantiles.size() == 1,
                      "Reduction quantile accepts only one quantile value");
+        if (is_quantile_select_supported(col.type(), 1, 1, quantile_agg->_interpolation)) {
+          auto col_ptr = select_quantiles(col,
+                                          column_view{},
+                                          1,
+                                          quantile_agg->_quantiles,
+                                          quantile_agg->_interpolation,
+                                          mr,
+                                          stream);
+          return get_element(*col_ptr, 0, mr);
+        }
         auto sorted_indices       = sorted_order(table_view{{col}}, {}, {null_order::AFTER}, mr);
         auto valid_sorted_indices = split(*sorted_indices, {col.size() - col.null_count()})[0];
         auto col_ptr              = quantile(col,
@@ -92,6 +111,14 @@ struct reduce_dispatch_functor {
           stream,
           mr);
       } break;
+      case aggregation::APPROX_NUNIQUE: {
+        auto approx_agg = static_cast<approx_nunique_aggregation const *>(agg.get());
+        return make_fixed_width_scalar(
+          detail::approx_distinct_count(
+            col, approx_agg->_precision, approx_agg->_null_handling, stream),
+          stream,
+          mr);
+      } break;
       default: CUDF_FAIL("Unsupported reduction operator");
     }
   }
@@ -114,6 +141,129 @@ std::unique_ptr<scalar> reduce(
     aggregation_dispatcher(agg->kind, reduce_dispatch_functor{col, output_dtype, mr, stream}, agg);
   return result;
 }
+
+std::vector<std::unique_ptr<scalar>> reduce(
+  column_view const &col,
+  std::vector<std::unique_ptr<aggregation>> const &aggs,
+  data_type output_dtype,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0)
+{
+  // the reductions sharing partial results are computed in a single pass
+  std::vector<std::unique_ptr<scalar>> results(aggs.size());
+  if (col.size() > col.null_count()) {
+    results = reduction::fused_reductions(col, aggs, output_dtype, mr, stream);
+  }
+
+  for (size_t i = 0; i < aggs.size(); ++i) {
+    if (results[i] != nullptr) continue;
+    switch (aggs[i]->kind) {
+      case aggregation::COUNT_VALID:
+        results[i] = make_fixed_width_scalar(col.size() - col.null_count(), stream, mr);
+        break;
+      case aggregation::COUNT_ALL:
+        results[i] = make_fixed_width_scalar(col.size(), stream, mr);
+        break;
+      default: results[i] = reduce(col, aggs[i], output_dtype, mr, stream);
+    }
+  }
+  return results;
+}
+
+namespace {
+// counting nulls would count the rows that are not selected
+bool counts_nulls(std::unique_ptr<aggregation> const &agg)
+{
+  switch (agg->kind) {
+    case aggregation::NUNIQUE:
+      return static_cast<nunique_aggregation const *>(agg.get())->_null_handling ==
+             null_policy::INCLUDE;
+    case aggregation::APPROX_NUNIQUE:
+      return static_cast<approx_nunique_aggregation const *>(agg.get())->_null_handling ==
+             null_policy::INCLUDE;
+    default: return false;
+  }
+}
+
+// Reduces `col` with the null mask of the selected rows instead of its own
+std::unique_ptr<scalar> reduce_with_null_mask(
+  column_view const &col,
+  std::pair<rmm::device_buffer, size_type> const &null_mask,
+  std::unique_ptr<aggregation> const &agg,
+  data_type output_dtype,
+  rmm::mr::device_memory_resource *mr,
+  cudaStream_t stream)
+{
+  std::vector<column_view> children;
+  for (size_type i = 0; i < col.num_children(); ++i) { children.push_back(col.child(i)); }
+  column_view selected_col{col.type(),
+                           col.size(),
+                           col.head(),
+                           static_cast<bitmask_type const *>(null_mask.first.data()),
+                           null_mask.second,
+                           col.offset(),
+                           children};
+  return reduce(selected_col, agg, output_dtype, mr, stream);
+}
+}  // namespace
+
+std::unique_ptr<scalar> reduce(
+  column_view const &col,
+  selection const &rows,
+  std::unique_ptr<aggregation> const &agg,
+  data_type output_dtype,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0)
+{
+  CUDF_EXPECTS(col.size() == rows.size(), "Column size mismatch");
+
+  if (counts_nulls(agg)) {
+    auto selected =
+      apply_selection(table_view{{col}}, rows, rmm::mr::get_default_resource(), stream);
+    return reduce(selected->get_column(0).view(), agg, output_dtype, mr, stream);
+  }
+
+  auto const null_mask = selection_null_mask(col, rows, rmm::mr::get_default_resource(), stream);
+  return reduce_with_null_mask(col, null_mask, agg, output_dtype, mr, stream);
+}
+
+std::unique_ptr<scalar> reduce(
+  column_view const &col,
+  column_view const &boolean_mask,
+  std::unique_ptr<aggregation> const &agg,
+  data_type output_dtype,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0)
+{
+  if (counts_nulls(agg)) {
+    auto selected = apply_boolean_mask(
+      table_view{{col}}, boolean_mask, rmm::mr::get_default_resource(), stream);
+    return reduce(selected->get_column(0).view(), agg, output_dtype, mr, stream);
+  }
+
+  auto const null_mask =
+    selection_null_mask(col, boolean_mask, rmm::mr::get_default_resource(), stream);
+  return reduce_with_null_mask(col, null_mask, agg, output_dtype, mr, stream);
+}
+
+std::unique_ptr<column> reduce(
+  table_view const &input,
+  std::unique_ptr<aggregation> const &agg,
+  data_type output_dtype,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0)
+{
+  CUDF_EXPECTS(is_fixed_width(output_dtype), "The output type must be a fixed-width type");
+  if (input.num_columns() == 0) { return make_empty_column(output_dtype); }
+
+  // The results stay on the device and are copied into the rows of the output together
+  std::vector<std::unique_ptr<scalar>> results;
+  for (auto const &col : input) {
+    results.push_back(reduce(col, agg, output_dtype, rmm::mr::get_default_resource(), stream));
+  }
+  std::vector<std::reference_wrapper<scalar const>> result_refs(results.begin(), results.end());
+  return make_column_from_scalars(result_refs, mr, stream);
+}
 }  // namespace detail
 
 std::unique_ptr<scalar> reduce(column_view const &col,
@@ -125,4 +275,42 @@ std::unique_ptr<scalar> reduce(column_view const &col,
   return detail::reduce(col, agg, output_dtype, mr);
 }
 
+std::vector<std::unique_ptr<scalar>> reduce(column_view const &col,
+                                            std::vector<std::unique_ptr<aggregation>> const &aggs,
+                                            data_type output_dtype,
+                                            rmm::mr::device_memory_resource *mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::reduce(col, aggs, output_dtype, mr);
+}
+
+std::unique_ptr<column> reduce(table_view const &input,
+                               std::unique_ptr<aggregation> const &agg,
+                               data_type output_dtype,
+                               rmm::mr::device_memory_resource *mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::reduce(input, agg, output_dtype, mr);
+}
+
+std::unique_ptr<scalar> reduce(column_view const &col,
+                               selection const &rows,
+                               std::unique_ptr<aggregation> const &agg,
+                               data_type output_dtype,
+                               rmm::mr::device_memory_resource *mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::reduce(col, rows, agg, output_dtype, mr);
+}
+
+std::unique_ptr<scalar> reduce(column_view const &col,
+                               column_view const &boolean_mask,
+                               std::unique_ptr<aggregation> const &agg,
+                               data_type output_dtype,
+                               rmm::mr::device_memory_resource *mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::reduce(col, boolean_mask, agg, output_dtype, mr);
+}
+
 }  // namespace cudf
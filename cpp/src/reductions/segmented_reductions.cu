@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reduction_operators.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <cub/device/device_segmented_reduce.cuh>
+
+namespace cudf {
+namespace detail {
+namespace {
+/**
+ * @brief The segments of a column reduced by a segmented reduction.
+ *
+ * Segment `i` spans the rows `[offsets[i], offsets[i + 1])`. If `null_mask` is not null, the
+ * segment `i` is null if bit `mask_offset + i` of `null_mask` is not set.
+ */
+struct segments_info {
+  size_type const* offsets;
+  size_type count;
+  bitmask_type const* null_mask;
+  size_type mask_offset;
+};
+
+// Returns true if segment i is not null and contains at least one valid element
+struct valid_segment {
+  size_type const* valid_counts;
+  bitmask_type const* null_mask;
+  size_type mask_offset;
+
+  __device__ inline bool operator()(size_type i) const
+  {
+    return valid_counts[i] > 0 && (null_mask == nullptr || bit_is_set(null_mask, mask_offset + i));
+  }
+};
+
+// Returns 1 if row i of the column is valid, 0 otherwise
+struct valid_element {
+  column_device_view col;
+
+  __device__ inline size_type operator()(size_type i) const { return col.is_valid(i) ? 1 : 0; }
+};
+
+/**
+ * @brief Reduces each segment of `d_in` into `d_out` with a single cub segmented reduction.
+ */
+template <typename InputIterator, typename OutputIterator, typename BinaryOp, typename T>
+void reduce_segments(InputIterator d_in,
+                     OutputIterator d_out,
+                     segments_info const& segments,
+                     BinaryOp binary_op,
+                     T identity,
+                     cudaStream_t stream)
+{
+  size_t temp_storage_bytes = 0;
+  CUDA_TRY(cub::DeviceSegmentedReduce::Reduce(nullptr,
+                                              temp_storage_bytes,
+                                              d_in,
+                                              d_out,
+                                              segments.count,
+                                              segments.offsets,
+                                              segments.offsets + 1,
+                                              binary_op,
+                                              identity,
+                                              stream));
+  rmm::device_buffer d_temp_storage{temp_storage_bytes, stream};
+  CUDA_TRY(cub::DeviceSegmentedReduce::Reduce(d_temp_storage.data(),
+                                              temp_storage_bytes,
+                                              d_in,
+                                              d_out,
+                                              segments.count,
+                                              segments.offsets,
+                                              segments.offsets + 1,
+                                              binary_op,
+                                              identity,
+                                              stream));
+}
+
+/**
+ * @brief Reduces each segment of `values` with the simple reduction operator `Op`.
+ *
+ * A segment of the output is null if the segment is null, or if it is empty or all its elements
+ * are null.
+ */
+template <typename ElementType, typename ResultType, typename Op>
+std::unique_ptr<column> segmented_reduction(column_view const& values,
+                                            segments_info const& segments,
+                                            data_type const output_dtype,
+                                            rmm::mr::device_memory_resource* mr,
+                                            cudaStream_t stream)
+{
+  auto dvalues = column_device_view::create(values, stream);
+  auto result =
+    make_fixed_width_column(output_dtype, segments.count, mask_state::UNALLOCATED, stream, mr);
+  auto d_out = result->mutable_view().template data<ResultType>();
+  Op simple_op{};
+
+  if (values.has_nulls()) {
+    auto it = thrust::make_transform_iterator(
+      dvalues->pair_begin<ElementType, true>(),
+      simple_op.template get_null_replacing_element_transformer<ResultType>());
+    reduce_segments(it,
+                    d_out,
+                    segments,
+                    simple_op.get_binary_op(),
+                    simple_op.template get_identity<ResultType>(),
+                    stream);
+  } else {
+    auto it = thrust::make_transform_iterator(
+      dvalues->begin<ElementType>(), simple_op.template get_element_transformer<ResultType>());
+    reduce_segments(it,
+                    d_out,
+                    segments,
+                    simple_op.get_binary_op(),
+                    simple_op.template get_identity<ResultType>(),
+                    stream);
+  }
+
+  // count the valid elements of each segment to find the null results
+  rmm::device_vector<size_type> valid_counts(segments.count);
+  auto valid_it = thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                                  valid_element{*dvalues});
+  reduce_segments(valid_it, valid_counts.begin(), segments, DeviceSum{}, size_type{0}, stream);
+
+  auto null_mask =
+    valid_if(thrust::make_counting_iterator<size_type>(0),
+             thrust::make_counting_iterator<size_type>(segments.count),
+             valid_segment{valid_counts.data().get(), segments.null_mask, segments.mask_offset},
+             stream,
+             mr);
+  if (null_mask.second > 0) { result->set_null_mask(std::move(null_mask.first), null_mask.second); }
+  return result;
+}
+
+// @brief result type dispatcher for segmented reduction (a.k.a. sum, prod, min...)
+template <typename ElementType, typename Op>
+struct result_type_dispatcher {
+ private:
+  template <typename ResultType>
+  static constexpr bool is_supported_v()
+  {
+    // same combinations of input and output dtypes as the simple reductions
+    return is_fixed_width<ResultType>() && std::is_convertible<ElementType, ResultType>::value &&
+           (std::is_arithmetic<ResultType>::value ||
+            std::is_same<Op, reduction::op::min>::value ||
+            std::is_same<Op, reduction::op::max>::value);
+  }
+
+ public:
+  template <typename ResultType, std::enable_if_t<is_supported_v<ResultType>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& values,
+                                     segments_info const& segments,
+                                     data_type const output_dtype,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+  {
+    return segmented_reduction<ElementType, ResultType, Op>(
+      values, segments, output_dtype, mr, stream);
+  }
+
+  template <typename ResultType, std::enable_if_t<not is_supported_v<ResultType>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const&,
+                                     segments_info const&,
+                                     data_type const,
+                                     rmm::mr::device_memory_resource*,
+                                     cudaStream_t)
+  {
+    CUDF_FAIL("input data type is not convertible to output data type");
+  }
+};
+
+// @brief input column element dispatcher for segmented reduction (a.k.a. sum, prod, min...)
+template <typename Op>
+struct element_type_dispatcher {
+  template <typename ElementType, std::enable_if_t<is_fixed_width<ElementType>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& values,
+                                     segments_info const& segments,
+                                     data_type const output_dtype,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+  {
+    return type_dispatcher(output_dtype,
+                           result_type_dispatcher<ElementType, Op>(),
+                           values,
+                           segments,
+                           output_dtype,
+                           mr,
+                           stream);
+  }
+
+  template <typename ElementType, std::enable_if_t<not is_fixed_width<ElementType>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const&,
+                                     segments_info const&,
+                                     data_type const,
+                                     rmm::mr::device_memory_resource*,
+                                     cudaStream_t)
+  {
+    CUDF_FAIL("Segmented reductions are only supported for fixed-width types");
+  }
+};
+
+template <typename Op>
+std::unique_ptr<column> dispatch_segmented_reduce(column_view const& values,
+                                                  segments_info const& segments,
+                                                  data_type const output_dtype,
+                                                  rmm::mr::device_memory_resource* mr,
+                                                  cudaStream_t stream)
+{
+  return type_dispatcher(
+    values.type(), element_type_dispatcher<Op>(), values, segments, output_dtype, mr, stream);
+}
+
+std::unique_ptr<column> segmented_reduce(column_view const& values,
+                                         segments_info const& segments,
+                                         std::unique_ptr<aggregation> const& agg,
+                                         data_type output_dtype,
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream)
+{
+  if (segments.count == 0) { return make_empty_column(output_dtype); }
+
+  switch (agg->kind) {
+    case aggregation::SUM:
+      return dispatch_segmented_reduce<reduction::op::sum>(
+        values, segments, output_dtype, mr, stream);
+    case aggregation::PRODUCT:
+      return dispatch_segmented_reduce<reduction::op::product>(
+        values, segments, output_dtype, mr, stream);
+    case aggregation::MIN:
+      return dispatch_segmented_reduce<reduction::op::min>(
+        values, segments, output_dtype, mr, stream);
+    case aggregation::MAX:
+      return dispatch_segmented_reduce<reduction::op::max>(
+        values, segments, output_dtype, mr, stream);
+    case aggregation::ANY:
+      CUDF_EXPECTS(output_dtype == data_type(type_id::BOOL8),
+                   "any() operation can be applied with output type `bool8` only");
+      return dispatch_segmented_reduce<reduction::op::max>(
+        values, segments, output_dtype, mr, stream);
+    case aggregation::ALL:
+      CUDF_EXPECTS(output_dtype == data_type(type_id::BOOL8),
+                   "all() operation can be applied with output type `bool8` only");
+      return dispatch_segmented_reduce<reduction::op::min>(
+        values, segments, output_dtype, mr, stream);
+    default: CUDF_FAIL("Unsupported segmented reduction operator");
+  }
+}
+}  // namespace
+
+std::unique_ptr<column> segmented_reduce(
+  column_view const& values,
+  column_view const& offsets,
+  std::unique_ptr<aggregation> const& agg,
+  data_type output_dtype,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0)
+{
+  CUDF_EXPECTS(offsets.type().id() == type_id::INT32, "Offsets must be INT32 type");
+  CUDF_EXPECTS(not offsets.has_nulls(), "Offsets must not have nulls");
+
+  size_type const num_segments = offsets.size() > 0 ? offsets.size() - 1 : 0;
+  return segmented_reduce(values,
+                          segments_info{offsets.data<size_type>(), num_segments, nullptr, 0},
+                          agg,
+                          output_dtype,
+                          mr,
+                          stream);
+}
+
+std::unique_ptr<column> segmented_reduce(
+  lists_column_view const& input,
+  std::unique_ptr<aggregation> const& agg,
+  data_type output_dtype,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0)
+{
+  if (input.size() == 0) { return make_empty_column(output_dtype); }
+
+  // the offsets of a sliced lists column start at the first row of the slice
+  return segmented_reduce(input.child(),
+                          segments_info{input.offsets().data<size_type>() + input.offset(),
+                                        input.size(),
+                                        input.null_mask(),
+                                        input.offset()},
+                          agg,
+                          output_dtype,
+                          mr,
+                          stream);
+}
+}  // namespace detail
+
+std::unique_ptr<column> segmented_reduce(column_view const& values,
+                                         column_view const& offsets,
+                                         std::unique_ptr<aggregation> const& agg,
+                                         data_type output_dtype,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::segmented_reduce(values, offsets, agg, output_dtype, mr);
+}
+
+std::unique_ptr<column> segmented_reduce(lists_column_view const& input,
+                                         std::unique_ptr<aggregation> const& agg,
+                                         data_type output_dtype,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::segmented_reduce(input, agg, output_dtype, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/null_mask.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/tuple.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+/**
+ * @brief Element of a segmented scan: the value, whether the value and all the values it
+ * accumulates are valid, and whether it is the first element of its segment.
+ */
+template <typename T>
+using scan_element = thrust::tuple<T, bool, bool>;
+
+/**
+ * @brief Segmented scan operator.
+ *
+ * The accumulation restarts at every segment head, which makes the segmented scan a single scan
+ * over the whole column.
+ */
+template <typename T, typename Op>
+struct segmented_scan_op {
+  CUDA_HOST_DEVICE_CALLABLE scan_element<T> operator()(scan_element<T> const& lhs,
+                                                       scan_element<T> const& rhs) const
+  {
+    if (thrust::get<2>(rhs)) { return rhs; }
+    return scan_element<T>{Op{}(thrust::get<0>(lhs), thrust::get<0>(rhs)),
+                           thrust::get<1>(lhs) && thrust::get<1>(rhs),
+                           thrust::get<2>(lhs)};
+  }
+};
+
+/**
+ * @brief Transforms row `i` of the input into a scan element, replacing a null value with the
+ * identity of `Op`.
+ *
+ * For an exclusive scan, element `i` is the value of row `i - 1`, and the identity for the first
+ * row of a segment.
+ */
+template <typename T, typename Op>
+struct segmented_scan_input {
+  column_device_view values;
+  bool const* heads;
+  bool exclusive;
+
+  __device__ scan_element<T> operator()(size_type i) const
+  {
+    bool const head = heads[i];
+    if (exclusive) {
+      if (head) { return scan_element<T>{Op::template identity<T>(), true, true}; }
+      --i;
+    }
+    bool const valid = values.is_valid(i);
+    return scan_element<T>{valid ? values.element<T>(i) : Op::template identity<T>(), valid, head};
+  }
+};
+
+// Marks the first row of every non-empty segment as a segment head
+struct mark_segment_heads {
+  size_type const* offsets;
+  bool* heads;
+
+  __device__ void operator()(size_type segment) const
+  {
+    if (offsets[segment] < offsets[segment + 1]) { heads[offsets[segment]] = true; }
+  }
+};
+
+template <typename Op>
+struct segmented_scan_dispatcher {
+  template <typename T, std::enable_if_t<std::is_arithmetic<T>::value>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& values,
+                                     column_view const& offsets,
+                                     scan_type inclusive,
+                                     null_policy null_handling,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+  {
+    size_type const size = values.size();
+    auto output_column =
+      detail::allocate_like(values, size, mask_allocation_policy::NEVER, mr, stream);
+    if (size == 0) { return output_column; }
+
+    auto exec = rmm::exec_policy(stream);
+    rmm::device_vector<bool> heads(size, false);
+    heads[0] = true;
+    thrust::for_each_n(exec->on(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       offsets.size() - 1,
+                       mark_segment_heads{offsets.data<size_type>(), heads.data().get()});
+
+    // the validity of the outputs is only needed when a null propagates to the segment's end
+    bool const include_nulls = null_handling == null_policy::INCLUDE && values.nullable();
+    rmm::device_vector<bool> validity(include_nulls ? size : 0);
+
+    auto d_values = column_device_view::create(values, stream);
+    auto input    = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0),
+      segmented_scan_input<T, Op>{
+        *d_values, heads.data().get(), inclusive == scan_type::EXCLUSIVE});
+    auto output_data = output_column->mutable_view().data<T>();
+    if (include_nulls) {
+      auto output = thrust::make_zip_iterator(
+        thrust::make_tuple(output_data, validity.begin(), thrust::make_discard_iterator()));
+      thrust::inclusive_scan(
+        exec->on(stream), input, input + size, output, segmented_scan_op<T, Op>{});
+    } else {
+      auto output = thrust::make_zip_iterator(thrust::make_tuple(
+        output_data, thrust::make_discard_iterator(), thrust::make_discard_iterator()));
+      thrust::inclusive_scan(
+        exec->on(stream), input, input + size, output, segmented_scan_op<T, Op>{});
+    }
+    CHECK_CUDA(stream);
+
+    if (include_nulls) {
+      auto null_mask =
+        valid_if(validity.begin(), validity.end(), thrust::identity<bool>{}, stream, mr);
+      output_column->set_null_mask(std::move(null_mask.first), null_mask.second);
+    } else if (values.nullable()) {
+      output_column->set_null_mask(copy_bitmask(values, stream, mr), values.null_count());
+    }
+    return output_column;
+  }
+
+  template <typename T, std::enable_if_t<not std::is_arithmetic<T>::value>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const&,
+                                     column_view const&,
+                                     scan_type,
+                                     null_policy,
+                                     rmm::mr::device_memory_resource*,
+                                     cudaStream_t)
+  {
+    CUDF_FAIL("Non-arithmetic types not supported for `cudf::segmented_scan`");
+  }
+};
+
+template <typename Op>
+std::unique_ptr<column> dispatch_segmented_scan(column_view const& values,
+                                                column_view const& offsets,
+                                                scan_type inclusive,
+                                                null_policy null_handling,
+                                                rmm::mr::device_memory_resource* mr,
+                                                cudaStream_t stream)
+{
+  return type_dispatcher(values.type(),
+                         segmented_scan_dispatcher<Op>{},
+                         values,
+                         offsets,
+                         inclusive,
+                         null_handling,
+                         mr,
+                         stream);
+}
+}  // namespace
+
+std::unique_ptr<column> segmented_scan(
+  column_view const& values,
+  column_view const& offsets,
+  std::unique_ptr<aggregation> const& agg,
+  scan_type inclusive,
+  null_policy null_handling,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0)
+{
+  CUDF_EXPECTS(offsets.type().id() == type_id::INT32, "Offsets must be INT32 type");
+  CUDF_EXPECTS(not offsets.has_nulls(), "Offsets must not have nulls");
+  CUDF_EXPECTS(offsets.size() > 0 || values.size() == 0, "Offsets must not be empty");
+
+  switch (agg->kind) {
+    case aggregation::SUM:
+      return dispatch_segmented_scan<DeviceSum>(
+        values, offsets, inclusive, null_handling, mr, stream);
+    case aggregation::MIN:
+      return dispatch_segmented_scan<DeviceMin>(
+        values, offsets, inclusive, null_handling, mr, stream);
+    case aggregation::MAX:
+      return dispatch_segmented_scan<DeviceMax>(
+        values, offsets, inclusive, null_handling, mr, stream);
+    case aggregation::PRODUCT:
+      return dispatch_segmented_scan<DeviceProduct>(
+        values, offsets, inclusive, null_handling, mr, stream);
+    default: CUDF_FAIL("Unsupported aggregation operator for segmented scan");
+  }
+}
+}  // namespace detail
+
+std::unique_ptr<column> segmented_scan(column_view const& values,
+                                       column_view const& offsets,
+                                       std::unique_ptr<aggregation> const& agg,
+                                       scan_type inclusive,
+                                       null_policy null_handling,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::segmented_scan(values, offsets, agg, inclusive, null_handling, mr);
+}
+
+}  // namespace cudf
@@ -18,6 +18,7 @@
 
 #include <cudf/detail/reduction.cuh>
 
+#include <cudf/null_mask.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
@@ -49,7 +50,15 @@ std::unique_ptr<scalar> simple_reduction(column_view const& col,
   std::unique_ptr<scalar> result;
   Op simple_op{};
 
-  if (col.has_nulls()) {
+  if (col.has_nulls() && detail::reduce_valid_words(col)) {
+    // reduce a bitmask word of elements per item, reading only the valid elements
+    auto it = detail::make_valid_word_iterator<ElementType>(
+      *dcol,
+      simple_op.template get_element_transformer<ResultType>(),
+      simple_op.get_binary_op(),
+      simple_op.template get_identity<ResultType>());
+    result = detail::reduce(it, num_bitmask_words(col.size()), Op{}, mr, stream);
+  } else if (col.has_nulls()) {
     auto it = thrust::make_transform_iterator(
       dcol->pair_begin<ElementType, true>(),
       simple_op.template get_null_replacing_element_transformer<ResultType>());
@@ -38,6 +38,7 @@
 #include <cudf/copying.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/copy_if_else.cuh>
+#include <cudf/detail/gather.cuh>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/replace.hpp>
@@ -49,6 +50,8 @@
 #include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/replace.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/error.hpp>
@@ -58,6 +61,8 @@
 #include <thrust/device_ptr.h>
 #include <thrust/execution_policy.h>
 #include <thrust/find.h>
+#include <thrust/iterator/reverse_iterator.h>
+#include <thrust/scan.h>
 #include <cub/cub.cuh>
 
 namespace {  // anonymous
@@ -828,6 +833,48 @@ std::unique_ptr<cudf::column> replace_nulls(cudf::column_view const& input,
     input.type(), replace_nulls_scalar_kernel_forwarder{}, input, replacement, mr, stream);
 }
 
+std::unique_ptr<cudf::column> replace_nulls(cudf::column_view const& input,
+                                            cudf::replace_policy const& replace_policy,
+                                            rmm::mr::device_memory_resource* mr,
+                                            cudaStream_t stream)
+{
+  if (input.size() == 0) { return cudf::empty_like(input); }
+
+  if (!input.has_nulls()) { return std::make_unique<cudf::column>(input, stream, mr); }
+
+  // Each row is gathered from the nearest valid row before or after it, found by a scan of the
+  // indices of the valid rows. Rows with no such valid row get an out of bounds index, and stay
+  // null
+  auto device_in = cudf::column_device_view::create(input, stream);
+  rmm::device_vector<cudf::size_type> gather_map(input.size());
+  auto exec = rmm::exec_policy(stream);
+  if (replace_policy == cudf::replace_policy::PRECEDING) {
+    auto valid_indices = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<cudf::size_type>(0),
+      [in = *device_in] __device__(cudf::size_type i) { return in.is_valid_nocheck(i) ? i : -1; });
+    thrust::inclusive_scan(exec->on(stream),
+                           valid_indices,
+                           valid_indices + input.size(),
+                           gather_map.begin(),
+                           thrust::maximum<cudf::size_type>{});
+  } else {
+    auto valid_indices = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<cudf::size_type>(0),
+      [in = *device_in, size = input.size()] __device__(cudf::size_type i) {
+        return in.is_valid_nocheck(i) ? i : size;
+      });
+    thrust::inclusive_scan(exec->on(stream),
+                           thrust::make_reverse_iterator(valid_indices + input.size()),
+                           thrust::make_reverse_iterator(valid_indices),
+                           gather_map.rbegin(),
+                           thrust::minimum<cudf::size_type>{});
+  }
+
+  auto output = cudf::detail::gather(
+    cudf::table_view{{input}}, gather_map.begin(), gather_map.end(), true, mr, stream);
+  return std::move(output->release()[0]);
+}
+
 }  // namespace detail
 
 std::unique_ptr<cudf::column> replace_nulls(cudf::column_view const& input,
@@ -845,6 +892,29 @@ std::unique_ptr<cudf::column> replace_nulls(cudf::column_view const& input,
   CUDF_FUNC_RANGE();
   return cudf::detail::replace_nulls(input, replacement, mr, 0);
 }
+
+std::unique_ptr<cudf::column> replace_nulls(cudf::column_view const& input,
+                                            cudf::replace_policy const& replace_policy,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return cudf::detail::replace_nulls(input, replace_policy, mr, 0);
+}
+
+std::unique_ptr<cudf::table> replace_nulls(
+  cudf::table_view const& input,
+  std::vector<std::reference_wrapper<cudf::scalar const>> const& replacements,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(replacements.size() == static_cast<size_t>(input.num_columns()),
+               "Number of replacements must match the number of columns");
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  for (size_t i = 0; i < replacements.size(); ++i) {
+    columns.push_back(cudf::detail::replace_nulls(input.column(i), replacements[i].get(), mr, 0));
+  }
+  return std::make_unique<cudf::table>(std::move(columns));
+}
 }  // namespace cudf
 
 namespace cudf {
@@ -14,23 +14,168 @@
  * limitations under the License.
  */
 
+#include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/lists/detail/concatenate.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/types.hpp>
 #include <strings/utilities.cuh>
 
+#include <thrust/for_each.h>
+
 namespace cudf {
 namespace detail {
 namespace {
+// the fixed-width kernel transposes tiles of `interleave_tile_dim` rows of as many columns
+constexpr int interleave_tile_dim   = 32;
+constexpr int interleave_block_rows = 8;
+
+/**
+ * @brief Unsigned integer of `size` bytes, used to move fixed-width elements as raw words
+ */
+template <size_t size>
+struct word_of_size;
+template <>
+struct word_of_size<1> {
+  using type = uint8_t;
+};
+template <>
+struct word_of_size<2> {
+  using type = uint16_t;
+};
+template <>
+struct word_of_size<4> {
+  using type = uint32_t;
+};
+template <>
+struct word_of_size<8> {
+  using type = uint64_t;
+};
+
+/**
+ * @brief Interleaves the fixed-width columns of `input` into `output`
+ *
+ * Each block stages a tile of rows and columns in shared memory, so that the warps read
+ * consecutive rows of a column and write consecutive elements of the output.
+ */
+template <typename Word>
+__global__ void interleave_fixed_width_kernel(table_device_view input, Word* output)
+{
+  __shared__ Word tile[interleave_tile_dim][interleave_tile_dim + 1];
+  auto const num_columns = input.num_columns();
+  auto const num_rows    = input.num_rows();
+  auto const row_begin   = static_cast<size_type>(blockIdx.x) * interleave_tile_dim;
+  auto const col_begin   = static_cast<size_type>(blockIdx.y) * interleave_tile_dim;
+
+  for (int j = threadIdx.y; j < interleave_tile_dim; j += interleave_block_rows) {
+    auto const row = row_begin + static_cast<size_type>(threadIdx.x);
+    auto const col = col_begin + j;
+    if (row < num_rows && col < num_columns) {
+      tile[j][threadIdx.x] = input.column(col).data<Word>()[row];
+    }
+  }
+  __syncthreads();
+  for (int j = threadIdx.y; j < interleave_tile_dim; j += interleave_block_rows) {
+    auto const row = row_begin + j;
+    auto const col = col_begin + static_cast<size_type>(threadIdx.x);
+    if (row < num_rows && col < num_columns) {
+      output[static_cast<size_t>(row) * num_columns + col] = tile[threadIdx.x][j];
+    }
+  }
+}
+
 struct interleave_columns_functor {
   template <typename T, typename... Args>
-  std::enable_if_t<not cudf::is_fixed_width<T>() and not std::is_same<T, cudf::string_view>::value,
+  std::enable_if_t<not cudf::is_fixed_width<T>() and
+                     not std::is_same<T, cudf::string_view>::value and
+                     not std::is_same<T, cudf::list_view>::value,
                    std::unique_ptr<cudf::column>>
   operator()(Args&&... args)
   {
-    CUDF_FAIL("interleave_columns not supported for dictionary and list types.");
+    CUDF_FAIL("interleave_columns not supported for dictionary types.");
+  }
+
+  template <typename T>
+  std::enable_if_t<std::is_same<T, cudf::list_view>::value, std::unique_ptr<cudf::column>>
+  operator()(table_view const& lists_columns,
+             bool create_mask,
+             rmm::mr::device_memory_resource* mr,
+             cudaStream_t stream = 0)
+  {
+    auto const num_columns = lists_columns.num_columns();
+    if (num_columns == 1)  // Single lists column returns a copy
+      return std::make_unique<column>(*(lists_columns.begin()), stream, mr);
+
+    auto const num_rows    = lists_columns.num_rows();
+    auto const output_size = num_columns * num_rows;
+    if (output_size == 0) return empty_like(lists_columns.column(0));
+
+    // The list at output row i is the list at row (i % num_columns) * num_rows + i / num_columns
+    // of the concatenated columns
+    auto const concatenated = lists::detail::concatenate(
+      std::vector<column_view>(lists_columns.begin(), lists_columns.end()), stream);
+    lists_column_view const lists(concatenated->view());
+    CUDF_EXPECTS(lists.child().type().id() != type_id::LIST,
+                 "interleave_columns not supported for nested list types.");
+    auto const d_offsets  = lists.offsets().data<size_type>();
+    auto const source_row = [num_columns, num_rows] __device__(size_type idx) {
+      return (idx % num_columns) * num_rows + idx / num_columns;
+    };
+
+    auto sizes_itr = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0),
+      [d_offsets, source_row] __device__(size_type idx) {
+        auto const row = source_row(idx);
+        return d_offsets[row + 1] - d_offsets[row];
+      });
+    auto offsets_column = strings::detail::make_offsets_child_column(
+      sizes_itr, sizes_itr + output_size, mr, stream);
+    auto const d_results_offsets = offsets_column->view().template data<size_type>();
+    size_type const child_size = thrust::device_pointer_cast(d_results_offsets)[output_size];
+
+    // Gather the elements of each output list from the child of the concatenated columns
+    rmm::device_vector<size_type> child_map(child_size);
+    thrust::for_each_n(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      output_size,
+      [d_offsets, d_results_offsets, source_row, d_map = child_map.data().get()] __device__(
+        size_type idx) {
+        auto const row = source_row(idx);
+        auto target    = d_results_offsets[idx];
+        for (auto element = d_offsets[row]; element < d_offsets[row + 1]; ++element) {
+          d_map[target++] = element;
+        }
+      });
+    auto child = std::move(
+      detail::gather(
+        table_view{{lists.child()}}, child_map.begin(), child_map.end(), false, mr, stream)
+        ->release()
+        .front());
+
+    std::pair<rmm::device_buffer, size_type> valid_mask{{}, 0};
+    if (create_mask) {
+      auto const d_lists = column_device_view::create(concatenated->view(), stream);
+      valid_mask         = cudf::detail::valid_if(
+        thrust::make_counting_iterator<size_type>(0),
+        thrust::make_counting_iterator<size_type>(output_size),
+        [d_lists = *d_lists, source_row] __device__(size_type idx) {
+          return d_lists.is_valid(source_row(idx));
+        },
+        stream,
+        mr);
+    }
+
+    return make_lists_column(output_size,
+                             std::move(offsets_column),
+                             std::move(child),
+                             valid_mask.second,
+                             std::move(valid_mask.first),
+                             stream,
+                             mr);
   }
 
   template <typename T>
@@ -124,42 +269,30 @@ struct interleave_columns_functor {
     rmm::mr::device_memory_resource* mr,
     cudaStream_t stream = 0)
   {
+    using Word       = typename word_of_size<sizeof(T)>::type;
     auto arch_column = input.column(0);
     auto output_size = input.num_columns() * input.num_rows();
     auto output =
       allocate_like(arch_column, output_size, mask_allocation_policy::NEVER, mr, stream);
-    auto device_input  = table_device_view::create(input);
-    auto device_output = mutable_column_device_view::create(*output);
-    auto index_begin   = thrust::make_counting_iterator<size_type>(0);
-    auto index_end     = thrust::make_counting_iterator<size_type>(output_size);
-
-    auto func_value = [input   = *device_input,
-                       divisor = input.num_columns()] __device__(size_type idx) {
-      return input.column(idx % divisor).element<T>(idx / divisor);
-    };
+    if (output_size == 0) { return output; }
 
-    if (not create_mask) {
-      thrust::transform(rmm::exec_policy(stream)->on(stream),
-                        index_begin,
-                        index_end,
-                        device_output->data<T>(),
-                        func_value);
+    auto device_input = table_device_view::create(input, stream);
+    dim3 const grid((input.num_rows() + interleave_tile_dim - 1) / interleave_tile_dim,
+                    (input.num_columns() + interleave_tile_dim - 1) / interleave_tile_dim);
+    dim3 const block(interleave_tile_dim, interleave_block_rows);
+    interleave_fixed_width_kernel<<<grid, block, 0, stream>>>(
+      *device_input, output->mutable_view().template data<Word>());
 
-      return output;
-    }
+    if (not create_mask) { return output; }
+
+    auto index_begin = thrust::make_counting_iterator<size_type>(0);
+    auto index_end   = thrust::make_counting_iterator<size_type>(output_size);
 
     auto func_validity = [input   = *device_input,
                           divisor = input.num_columns()] __device__(size_type idx) {
       return input.column(idx % divisor).is_valid(idx / divisor);
     };
 
-    thrust::transform_if(rmm::exec_policy(stream)->on(stream),
-                         index_begin,
-                         index_end,
-                         device_output->data<T>(),
-                         func_value,
-                         func_validity);
-
     rmm::device_buffer mask;
     size_type null_count;
 
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reshape.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/reshape.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sequence.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace cudf {
+namespace detail {
+namespace {
+/**
+ * @brief Size in bytes of the slot of each value of an UnsafeRow
+ */
+constexpr size_type slot_size = 8;
+
+/**
+ * @brief Size in bytes of the null bitset of an UnsafeRow of `num_columns` values
+ */
+constexpr size_type null_bitset_size(size_type num_columns)
+{
+  return ((num_columns + 63) / 64) * 8;
+}
+
+/**
+ * @brief Copies the `size` bytes of a value between locations aligned to `size`
+ */
+__device__ inline void copy_value(int8_t const* source, int8_t* target, size_type size)
+{
+  switch (size) {
+    case 1: *target = *source; break;
+    case 2: *reinterpret_cast<int16_t*>(target) = *reinterpret_cast<int16_t const*>(source); break;
+    case 4: *reinterpret_cast<int32_t*>(target) = *reinterpret_cast<int32_t const*>(source); break;
+    default:
+      *reinterpret_cast<int64_t*>(target) = *reinterpret_cast<int64_t const*>(source);
+      break;
+  }
+}
+
+rmm::device_vector<size_type> value_sizes(std::vector<data_type> const& types)
+{
+  std::vector<size_type> sizes(types.size());
+  std::transform(types.begin(), types.end(), sizes.begin(), [](data_type type) {
+    CUDF_EXPECTS(is_fixed_width(type), "Only fixed-width types can be converted to rows");
+    return static_cast<size_type>(size_of(type));
+  });
+  return rmm::device_vector<size_type>(sizes);
+}
+
+}  // namespace
+
+std::unique_ptr<column> convert_to_rows(table_view const& input,
+                                        cudaStream_t stream,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  std::vector<data_type> types(input.num_columns());
+  std::transform(
+    input.begin(), input.end(), types.begin(), [](column_view const& col) { return col.type(); });
+  auto const d_sizes = value_sizes(types);
+
+  auto const num_rows    = input.num_rows();
+  auto const num_columns = input.num_columns();
+  auto const bitset_size = null_bitset_size(num_columns);
+  auto const row_size    = bitset_size + num_columns * slot_size;
+  CUDF_EXPECTS(static_cast<int64_t>(num_rows) * row_size < std::numeric_limits<size_type>::max(),
+               "Rows are too large for a column");
+
+  auto offsets = make_numeric_column(
+    data_type{type_id::INT32}, num_rows + 1, mask_state::UNALLOCATED, stream, mr);
+  auto execpol = rmm::exec_policy(stream);
+  thrust::sequence(execpol->on(stream),
+                   offsets->mutable_view().begin<size_type>(),
+                   offsets->mutable_view().end<size_type>(),
+                   0,
+                   row_size);
+
+  auto rows = make_numeric_column(
+    data_type{type_id::INT8}, num_rows * row_size, mask_state::UNALLOCATED, stream, mr);
+  auto const d_rows = rows->mutable_view().data<int8_t>();
+  // the padding and the slots of null values are zero
+  CUDA_TRY(cudaMemsetAsync(d_rows, 0, num_rows * row_size, stream));
+
+  auto const d_input = table_device_view::create(input, stream);
+  // consecutive threads write the values of a row
+  thrust::for_each_n(
+    execpol->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    num_rows * num_columns,
+    [d_input   = *d_input,
+     d_sizes   = d_sizes.data().get(),
+     d_rows,
+     row_size,
+     bitset_size,
+     num_columns] __device__(size_type idx) {
+      auto const row  = idx / num_columns;
+      auto const col  = idx % num_columns;
+      auto const& src = d_input.column(col);
+      if (src.is_null(row)) { return; }
+      auto const size = d_sizes[col];
+      copy_value(src.head<int8_t>() + (src.offset() + row) * size,
+                 d_rows + row * row_size + bitset_size + col * slot_size,
+                 size);
+    });
+
+  // each thread sets the null bits of a word of the bitset of a row
+  auto const words_per_row = bitset_size / 8;
+  thrust::for_each_n(
+    execpol->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    num_rows * words_per_row,
+    [d_input = *d_input, d_rows, row_size, words_per_row, num_columns] __device__(size_type idx) {
+      auto const row   = idx / words_per_row;
+      auto const word  = idx % words_per_row;
+      auto const begin = word * 64;
+      auto const end   = min(begin + 64, num_columns);
+      uint64_t nulls   = 0;
+      for (auto col = begin; col < end; ++col) {
+        if (d_input.column(col).is_null(row)) { nulls |= uint64_t{1} << (col - begin); }
+      }
+      reinterpret_cast<uint64_t*>(d_rows + row * row_size)[word] = nulls;
+    });
+
+  return make_lists_column(num_rows,
+                           std::move(offsets),
+                           std::move(rows),
+                           0,
+                           rmm::device_buffer{0, stream, mr},
+                           stream,
+                           mr);
+}
+
+std::unique_ptr<table> convert_from_rows(lists_column_view const& input,
+                                         std::vector<data_type> const& schema,
+                                         cudaStream_t stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  auto const d_sizes     = value_sizes(schema);
+  auto const num_rows    = input.size();
+  auto const num_columns = static_cast<size_type>(schema.size());
+  auto const bitset_size = null_bitset_size(num_columns);
+  auto const row_size    = bitset_size + num_columns * slot_size;
+
+  std::vector<std::unique_ptr<column>> columns;
+  std::vector<mutable_column_view> views;
+  for (auto type : schema) {
+    columns.push_back(
+      make_fixed_width_column(type, num_rows, mask_state::UNINITIALIZED, stream, mr));
+    views.push_back(columns.back()->mutable_view());
+  }
+  if (num_rows == 0) { return std::make_unique<table>(std::move(columns)); }
+
+  auto const d_offsets = input.offsets().data<size_type>() + input.offset();
+  size_type first_offset = 0, last_offset = 0;
+  CUDA_TRY(cudaMemcpyAsync(
+    &first_offset, d_offsets, sizeof(size_type), cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaMemcpyAsync(
+    &last_offset, d_offsets + num_rows, sizeof(size_type), cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  CUDF_EXPECTS(last_offset - first_offset == num_rows * row_size,
+               "Rows do not have the size of a row of the schema");
+
+  auto const d_rows   = input.child().data<int8_t>();
+  auto const d_output = mutable_table_device_view::create(mutable_table_view{views}, stream);
+  auto execpol        = rmm::exec_policy(stream);
+  // consecutive threads read the values of a row
+  thrust::for_each_n(
+    execpol->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    num_rows * num_columns,
+    [d_output  = *d_output,
+     d_sizes   = d_sizes.data().get(),
+     d_offsets,
+     d_rows,
+     bitset_size,
+     num_columns] __device__(size_type idx) {
+      auto const row  = idx / num_columns;
+      auto const col  = idx % num_columns;
+      auto const size = d_sizes[col];
+      copy_value(d_rows + d_offsets[row] + bitset_size + col * slot_size,
+                 d_output.column(col).head<int8_t>() + row * size,
+                 size);
+    });
+
+  // each thread sets a word of the null mask of a column
+  auto const words_per_column = num_bitmask_words(num_rows);
+  thrust::for_each_n(
+    execpol->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    num_columns * words_per_column,
+    [d_output = *d_output, d_offsets, d_rows, num_rows, words_per_column] __device__(
+      size_type idx) {
+      auto const col   = idx / words_per_column;
+      auto const word  = idx % words_per_column;
+      auto const begin = word * size_in_bits<bitmask_type>();
+      auto const end   = min(begin + size_in_bits<bitmask_type>(), num_rows);
+      bitmask_type valid = 0;
+      for (auto row = begin; row < end; ++row) {
+        auto const nulls = reinterpret_cast<uint64_t const*>(d_rows + d_offsets[row]);
+        if (not(nulls[col / 64] & (uint64_t{1} << (col % 64)))) {
+          valid |= bitmask_type{1} << (row - begin);
+        }
+      }
+      d_output.column(col).null_mask()[word] = valid;
+    });
+
+  return std::make_unique<table>(std::move(columns));
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> convert_to_rows(table_view const& input,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::convert_to_rows(input, 0, mr);
+}
+
+std::unique_ptr<table> convert_from_rows(lists_column_view const& input,
+                                         std::vector<data_type> const& schema,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::convert_from_rows(input, schema, 0, mr);
+}
+
+}  // namespace cudf
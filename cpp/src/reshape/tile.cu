@@ -15,12 +15,17 @@
  */
 
 #include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/reshape.hpp>
+#include <cudf/detail/valid_if.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
 
+#include <algorithm>
 #include <memory>
 
 #include <thrust/iterator/counting_iterator.h>
@@ -34,6 +39,46 @@ struct tile_functor {
   size_type __device__ operator()(size_type i) { return i % count; }
 };
 
+/**
+ * @brief Tiles a fixed-width column by copying its data, then doubling the copied rows with
+ * device-to-device copies until the output is full, instead of gathering each element.
+ */
+std::unique_ptr<column> tile_fixed_width(column_view const& in,
+                                         size_type count,
+                                         cudaStream_t stream,
+                                         rmm::mr::device_memory_resource *mr)
+{
+  auto const in_num_rows  = in.size();
+  auto const out_num_rows = in_num_rows * count;
+  auto out =
+    detail::allocate_like(in, out_num_rows, mask_allocation_policy::NEVER, mr, stream);
+
+  auto const width = size_of(in.type());
+  auto const d_in  = static_cast<char const *>(in.head()) + in.offset() * width;
+  auto const d_out = static_cast<char *>(out->mutable_view().head());
+  CUDA_TRY(
+    cudaMemcpyAsync(d_out, d_in, in_num_rows * width, cudaMemcpyDeviceToDevice, stream));
+  for (size_type copied = in_num_rows; copied < out_num_rows;) {
+    auto const rows = std::min(copied, out_num_rows - copied);
+    CUDA_TRY(cudaMemcpyAsync(
+      d_out + copied * width, d_out, rows * width, cudaMemcpyDeviceToDevice, stream));
+    copied += rows;
+  }
+
+  if (in.nullable()) {
+    auto mask = detail::valid_if(
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(out_num_rows),
+      [null_mask = in.null_mask(), offset = in.offset(), in_num_rows] __device__(size_type i) {
+        return bit_is_set(null_mask, offset + i % in_num_rows);
+      },
+      stream,
+      mr);
+    out->set_null_mask(std::move(mask.first), mask.second);
+  }
+  return out;
+}
+
 }  // anonymous namespace
 
 namespace detail {
@@ -52,7 +97,18 @@ std::unique_ptr<table> tile(const table_view &in,
   auto counting_it  = thrust::make_counting_iterator<size_type>(0);
   auto tiled_it     = thrust::make_transform_iterator(counting_it, tile_functor{in_num_rows});
 
-  return detail::gather(in, tiled_it, tiled_it + out_num_rows, false, mr, stream);
+  // fixed-width columns are contiguous repetitions of their data, the others are gathered
+  std::vector<std::unique_ptr<column>> columns;
+  for (auto const &col : in) {
+    if (is_fixed_width(col.type())) {
+      columns.push_back(tile_fixed_width(col, count, stream, mr));
+    } else {
+      auto tiled = detail::gather(
+        table_view{{col}}, tiled_it, tiled_it + out_num_rows, false, mr, stream);
+      columns.push_back(std::move(tiled->release().front()));
+    }
+  }
+  return std::make_unique<table>(std::move(columns));
 }
 }  // namespace detail
 
@@ -25,7 +25,11 @@
 #include <cudf/detail/groupby/sort_helper.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/valid_if.cuh>
 #include <cudf/rolling.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
 #include <cudf/types.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/nvtx_utils.hpp>
@@ -42,8 +46,16 @@
 #include <types.hpp.jit>
 
 #include <thrust/binary_search.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
 #include <rmm/device_scalar.hpp>
 
+#include <algorithm>
+#include <functional>
 #include <memory>
 
 namespace cudf {
@@ -517,6 +529,743 @@ struct dispatch_rolling {
   }
 };
 
+/**
+ * @brief Windows at least this wide are evaluated from prefix sums or a sparse table, at a cost per
+ * row independent of the window size, instead of by visiting every row of the window
+ */
+constexpr size_type min_window_for_prefix_evaluation = 64;
+
+/**
+ * @brief Returns whether windows of `type` can be aggregated with `kind` from prefix sums or a
+ * sparse table
+ *
+ * Floating-point sums are left to the direct evaluation, as the difference of two prefix sums
+ * loses the precision of the small values of a window. So are the means of 64-bit integers, whose
+ * prefix sums may overflow where the direct evaluation sums in floating point.
+ */
+bool has_prefix_evaluation(data_type type, aggregation::Kind kind)
+{
+  bool const integral =
+    is_numeric(type) and not is_floating_point(type) and not is_boolean(type);
+  switch (kind) {
+    case aggregation::COUNT_VALID:
+    case aggregation::COUNT_ALL: return true;
+    case aggregation::SUM: return integral;
+    case aggregation::MEAN: return integral and size_of(type) < sizeof(int64_t);
+    case aggregation::MIN:
+    case aggregation::MAX: return is_numeric(type) and not is_boolean(type);
+    default: return false;
+  }
+}
+
+/**
+ * @brief Counts the rows of each window `[starts[i], ends[i])`, or only its valid rows given the
+ * number of valid rows before each row in `valid_prefix`
+ */
+struct window_count_fn {
+  size_type const* valid_prefix;
+  size_type const* starts;
+  size_type const* ends;
+
+  __device__ size_type operator()(size_type i) const
+  {
+    return valid_prefix == nullptr ? ends[i] - starts[i]
+                                   : valid_prefix[ends[i]] - valid_prefix[starts[i]];
+  }
+};
+
+rmm::device_vector<size_type> valid_count_prefix(column_view const& input, cudaStream_t stream)
+{
+  rmm::device_vector<size_type> prefix(input.size() + 1, 0);
+  auto const d_input = column_device_view::create(input, stream);
+  thrust::transform_inclusive_scan(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(input.size()),
+    prefix.begin() + 1,
+    [d_input = *d_input] __device__(size_type i) { return d_input.is_valid(i) ? 1 : 0; },
+    thrust::plus<size_type>());
+  return prefix;
+}
+
+/**
+ * @brief Allocates the output of a rolling window, whose row `i` is valid if its window has at
+ * least `min_periods` rows counted by `count`
+ */
+std::unique_ptr<column> make_window_output(data_type type,
+                                           size_type num_rows,
+                                           window_count_fn count,
+                                           size_type min_periods,
+                                           rmm::mr::device_memory_resource* mr,
+                                           cudaStream_t stream)
+{
+  auto output   = make_fixed_width_column(type, num_rows, mask_state::UNALLOCATED, stream, mr);
+  auto validity = detail::valid_if(
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_rows),
+    [count, min_periods] __device__(size_type i) { return count(i) >= min_periods; },
+    stream,
+    mr);
+  output->set_null_mask(std::move(validity.first), validity.second);
+  return output;
+}
+
+std::unique_ptr<column> prefix_rolling_count(column_view const& input,
+                                             size_type const* starts,
+                                             size_type const* ends,
+                                             size_type min_periods,
+                                             aggregation::Kind kind,
+                                             rmm::mr::device_memory_resource* mr,
+                                             cudaStream_t stream)
+{
+  rmm::device_vector<size_type> valid_prefix;
+  if (kind == aggregation::COUNT_VALID) { valid_prefix = valid_count_prefix(input, stream); }
+  window_count_fn const count{valid_prefix.data().get(), starts, ends};
+
+  auto output = make_window_output(
+    data_type{type_to_id<size_type>()}, input.size(), count, min_periods, mr, stream);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(input.size()),
+                    output->mutable_view().begin<size_type>(),
+                    count);
+  return output;
+}
+
+/**
+ * @brief Computes the SUM or MEAN of each window as the difference of two prefix sums
+ */
+struct prefix_rolling_sum_fn {
+  template <typename T,
+            std::enable_if_t<std::is_integral<T>::value and not is_boolean<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& input,
+                                     size_type const* starts,
+                                     size_type const* ends,
+                                     size_type min_periods,
+                                     aggregation::Kind kind,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+  {
+    using SumType      = target_type_t<T, aggregation::SUM>;
+    auto const d_input = column_device_view::create(input, stream);
+    rmm::device_vector<SumType> sums(input.size() + 1, 0);
+    thrust::transform_inclusive_scan(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(input.size()),
+      sums.begin() + 1,
+      [d_input = *d_input] __device__(size_type i) {
+        return d_input.is_valid(i) ? static_cast<SumType>(d_input.element<T>(i)) : SumType{0};
+      },
+      thrust::plus<SumType>());
+    auto const valid_prefix = valid_count_prefix(input, stream);
+    window_count_fn const count{valid_prefix.data().get(), starts, ends};
+
+    auto output = make_window_output(
+      target_type(input.type(), kind), input.size(), count, min_periods, mr, stream);
+    if (kind == aggregation::SUM) {
+      thrust::transform(rmm::exec_policy(stream)->on(stream),
+                        thrust::make_counting_iterator<size_type>(0),
+                        thrust::make_counting_iterator<size_type>(input.size()),
+                        output->mutable_view().begin<SumType>(),
+                        [d_sums = sums.data().get(), starts, ends] __device__(size_type i) {
+                          return d_sums[ends[i]] - d_sums[starts[i]];
+                        });
+    } else {
+      using MeanType = target_type_t<T, aggregation::MEAN>;
+      thrust::transform(rmm::exec_policy(stream)->on(stream),
+                        thrust::make_counting_iterator<size_type>(0),
+                        thrust::make_counting_iterator<size_type>(input.size()),
+                        output->mutable_view().begin<MeanType>(),
+                        [d_sums = sums.data().get(), starts, ends, count] __device__(size_type i) {
+                          return static_cast<MeanType>(d_sums[ends[i]] - d_sums[starts[i]]) /
+                                 count(i);
+                        });
+    }
+    return output;
+  }
+
+  template <typename T,
+            std::enable_if_t<not(std::is_integral<T>::value and not is_boolean<T>())>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const&,
+                                     size_type const*,
+                                     size_type const*,
+                                     size_type,
+                                     aggregation::Kind,
+                                     rmm::mr::device_memory_resource*,
+                                     cudaStream_t)
+  {
+    CUDF_FAIL("Prefix sums are only used for integral types");
+  }
+};
+
+/**
+ * @brief Computes the MIN or MAX of each window from a sparse table
+ *
+ * Level `l` of the table holds the aggregate of the `2^l` rows starting at each row, so a window
+ * is covered by two, possibly overlapping, entries of the level of its largest power of two. Only
+ * the levels up to the widest window are built.
+ */
+template <typename Op>
+struct sparse_table_rolling_fn {
+  template <typename T, std::enable_if_t<is_numeric<T>() and not is_boolean<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& input,
+                                     size_type const* starts,
+                                     size_type const* ends,
+                                     size_type max_window,
+                                     size_type min_periods,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+  {
+    auto const num_rows = input.size();
+    int num_levels      = 1;
+    while ((size_type{1} << num_levels) <= max_window) { ++num_levels; }
+
+    auto const d_input = column_device_view::create(input, stream);
+    rmm::device_vector<T> table(static_cast<std::size_t>(num_rows) * num_levels);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_rows),
+                      table.begin(),
+                      [d_input = *d_input] __device__(size_type i) {
+                        return d_input.is_valid(i) ? d_input.element<T>(i)
+                                                   : Op::template identity<T>();
+                      });
+    for (int level = 1; level < num_levels; ++level) {
+      auto const half = size_type{1} << (level - 1);
+      thrust::transform(rmm::exec_policy(stream)->on(stream),
+                        thrust::make_counting_iterator<size_type>(0),
+                        thrust::make_counting_iterator<size_type>(num_rows - 2 * half + 1),
+                        table.begin() + static_cast<std::size_t>(level) * num_rows,
+                        [previous = table.data().get() + static_cast<std::size_t>(level - 1) *
+                                                           num_rows,
+                         half] __device__(size_type i) {
+                          return Op{}(previous[i], previous[i + half]);
+                        });
+    }
+
+    auto const valid_prefix = valid_count_prefix(input, stream);
+    window_count_fn const count{valid_prefix.data().get(), starts, ends};
+    auto output = make_window_output(input.type(), num_rows, count, min_periods, mr, stream);
+    thrust::transform(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(num_rows),
+      output->mutable_view().begin<T>(),
+      [d_table = table.data().get(), num_rows, starts, ends] __device__(size_type i) {
+        auto const width = ends[i] - starts[i];
+        if (width == 0) { return Op::template identity<T>(); }
+        auto const level = 31 - __clz(width);
+        auto const row   = d_table + static_cast<std::size_t>(level) * num_rows;
+        return Op{}(row[starts[i]], row[ends[i] - (size_type{1} << level)]);
+      });
+    return output;
+  }
+
+  template <typename T,
+            std::enable_if_t<not(is_numeric<T>() and not is_boolean<T>())>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const&,
+                                     size_type const*,
+                                     size_type const*,
+                                     size_type,
+                                     size_type,
+                                     rmm::mr::device_memory_resource*,
+                                     cudaStream_t)
+  {
+    CUDF_FAIL("Sparse tables are only used for numeric types");
+  }
+};
+
+/**
+ * @brief Aggregates the windows `[starts[i], ends[i])` of `input` at a cost per row independent of
+ * their width
+ */
+std::unique_ptr<column> prefix_rolling_window(column_view const& input,
+                                              size_type const* starts,
+                                              size_type const* ends,
+                                              size_type max_window,
+                                              size_type min_periods,
+                                              aggregation::Kind kind,
+                                              rmm::mr::device_memory_resource* mr,
+                                              cudaStream_t stream)
+{
+  switch (kind) {
+    case aggregation::SUM:
+    case aggregation::MEAN:
+      return type_dispatcher(
+        input.type(), prefix_rolling_sum_fn{}, input, starts, ends, min_periods, kind, mr, stream);
+    case aggregation::MIN:
+      return type_dispatcher(input.type(),
+                             sparse_table_rolling_fn<DeviceMin>{},
+                             input,
+                             starts,
+                             ends,
+                             max_window,
+                             min_periods,
+                             mr,
+                             stream);
+    case aggregation::MAX:
+      return type_dispatcher(input.type(),
+                             sparse_table_rolling_fn<DeviceMax>{},
+                             input,
+                             starts,
+                             ends,
+                             max_window,
+                             min_periods,
+                             mr,
+                             stream);
+    default: return prefix_rolling_count(input, starts, ends, min_periods, kind, mr, stream);
+  }
+}
+
+/**
+ * @brief Returns whether all of `aggs` can be computed over windows of `type` in one pass
+ */
+bool is_fusable(data_type type, std::vector<std::unique_ptr<aggregation>> const& aggs)
+{
+  return is_numeric(type) and not is_boolean(type) and
+         std::all_of(aggs.begin(), aggs.end(), [](auto const& agg) {
+           return agg->kind == aggregation::SUM or agg->kind == aggregation::MIN or
+                  agg->kind == aggregation::MAX or agg->kind == aggregation::COUNT_VALID or
+                  agg->kind == aggregation::COUNT_ALL or agg->kind == aggregation::MEAN;
+         });
+}
+
+/**
+ * @brief Computes several aggregations of the same windows, reading each window once
+ *
+ * Every window accumulates its sum, count, minimum and maximum together, from which the output
+ * `outputs[k]` of each aggregation `kinds[k]` is written. The sums are accumulated in the output
+ * type of each aggregation, in the order of `process_rolling_window`, so the results match those
+ * of separate rolling windows.
+ */
+template <typename T,
+          int block_size,
+          bool has_nulls,
+          typename PrecedingWindowIterator,
+          typename FollowingWindowIterator>
+__launch_bounds__(block_size) __global__
+  void gpu_rolling_fused(column_device_view input,
+                         mutable_column_device_view* outputs,
+                         aggregation::Kind const* kinds,
+                         size_type num_outputs,
+                         size_type* __restrict__ output_valid_counts,
+                         PrecedingWindowIterator preceding_window_begin,
+                         FollowingWindowIterator following_window_begin,
+                         size_type min_periods)
+{
+  using SumType  = target_type_t<T, aggregation::SUM>;
+  using MeanType = target_type_t<T, aggregation::MEAN>;
+
+  size_type i      = blockIdx.x * block_size + threadIdx.x;
+  size_type stride = block_size * gridDim.x;
+
+  auto active_threads = __ballot_sync(0xffffffff, i < input.size());
+  while (i < input.size()) {
+    size_type preceding_window = preceding_window_begin[i];
+    size_type following_window = following_window_begin[i];
+
+    // compute bounds
+    size_type start       = min(input.size(), max(0, i - preceding_window + 1));
+    size_type end         = min(input.size(), max(0, i + following_window + 1));
+    size_type start_index = min(start, end);
+    size_type end_index   = max(start, end);
+
+    SumType sum     = DeviceSum::identity<SumType>();
+    MeanType mean   = DeviceSum::identity<MeanType>();
+    T min_value     = DeviceMin::identity<T>();
+    T max_value     = DeviceMax::identity<T>();
+    size_type count = 0;
+    for (size_type j = start_index; j < end_index; j++) {
+      if (!has_nulls || input.is_valid(j)) {
+        T const element = input.element<T>(j);
+        sum             = DeviceSum{}(static_cast<SumType>(element), sum);
+        mean            = DeviceSum{}(static_cast<MeanType>(element), mean);
+        min_value       = DeviceMin{}(element, min_value);
+        max_value       = DeviceMax{}(element, max_value);
+        count++;
+      }
+    }
+
+    for (size_type k = 0; k < num_outputs; ++k) {
+      auto& output         = outputs[k];
+      bool output_is_valid = count >= min_periods;
+      switch (kinds[k]) {
+        case aggregation::SUM: output.element<SumType>(i) = sum; break;
+        case aggregation::MEAN:
+          rolling_store_output_functor<MeanType, true>{}(output.element<MeanType>(i), mean, count);
+          break;
+        case aggregation::MIN: output.element<T>(i) = min_value; break;
+        case aggregation::MAX: output.element<T>(i) = max_value; break;
+        case aggregation::COUNT_VALID: output.element<size_type>(i) = count; break;
+        default:
+          output.element<size_type>(i) = end_index - start_index;
+          output_is_valid              = (end_index - start_index) >= min_periods;
+          break;
+      }
+
+      // set the mask
+      cudf::bitmask_type result_mask{__ballot_sync(active_threads, output_is_valid)};
+
+      // only one thread writes the mask
+      if (0 == threadIdx.x % cudf::detail::warp_size) {
+        output.set_mask_word(cudf::word_index(i), result_mask);
+        atomicAdd(output_valid_counts + k, __popc(result_mask));
+      }
+    }
+
+    // process next element
+    i += stride;
+    active_threads = __ballot_sync(active_threads, i < input.size());
+  }
+}
+
+struct fused_rolling_fn {
+  template <typename T,
+            typename PrecedingWindowIterator,
+            typename FollowingWindowIterator,
+            std::enable_if_t<is_numeric<T>() and not is_boolean<T>()>* = nullptr>
+  std::vector<std::unique_ptr<column>> operator()(
+    column_view const& input,
+    PrecedingWindowIterator preceding_window_begin,
+    FollowingWindowIterator following_window_begin,
+    size_type min_periods,
+    std::vector<std::unique_ptr<aggregation>> const& aggs,
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream)
+  {
+    std::vector<std::unique_ptr<column>> outputs;
+    std::vector<std::unique_ptr<mutable_column_device_view,
+                                std::function<void(mutable_column_device_view*)>>>
+      output_device_views;
+    std::vector<mutable_column_device_view> h_outputs;
+    std::vector<aggregation::Kind> h_kinds;
+    for (auto const& agg : aggs) {
+      outputs.push_back(make_fixed_width_column(target_type(input.type(), agg->kind),
+                                                input.size(),
+                                                mask_state::UNINITIALIZED,
+                                                stream,
+                                                mr));
+      output_device_views.push_back(
+        mutable_column_device_view::create(outputs.back()->mutable_view(), stream));
+      h_outputs.push_back(*output_device_views.back());
+      h_kinds.push_back(agg->kind);
+    }
+    rmm::device_vector<mutable_column_device_view> d_outputs(h_outputs);
+    rmm::device_vector<aggregation::Kind> d_kinds(h_kinds);
+    rmm::device_vector<size_type> valid_counts(aggs.size(), 0);
+
+    constexpr cudf::size_type block_size = 256;
+    cudf::detail::grid_1d grid(input.size(), block_size);
+    auto input_device_view = column_device_view::create(input, stream);
+
+    if (input.has_nulls()) {
+      gpu_rolling_fused<T, block_size, true><<<grid.num_blocks, block_size, 0, stream>>>(
+        *input_device_view,
+        d_outputs.data().get(),
+        d_kinds.data().get(),
+        static_cast<size_type>(aggs.size()),
+        valid_counts.data().get(),
+        preceding_window_begin,
+        following_window_begin,
+        min_periods);
+    } else {
+      gpu_rolling_fused<T, block_size, false><<<grid.num_blocks, block_size, 0, stream>>>(
+        *input_device_view,
+        d_outputs.data().get(),
+        d_kinds.data().get(),
+        static_cast<size_type>(aggs.size()),
+        valid_counts.data().get(),
+        preceding_window_begin,
+        following_window_begin,
+        min_periods);
+    }
+
+    std::vector<size_type> h_valid_counts(aggs.size());
+    CUDA_TRY(cudaMemcpyAsync(h_valid_counts.data(),
+                             valid_counts.data().get(),
+                             aggs.size() * sizeof(size_type),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    for (std::size_t k = 0; k < outputs.size(); ++k) {
+      outputs[k]->set_null_count(input.size() - h_valid_counts[k]);
+    }
+    return outputs;
+  }
+
+  template <typename T,
+            typename PrecedingWindowIterator,
+            typename FollowingWindowIterator,
+            std::enable_if_t<not(is_numeric<T>() and not is_boolean<T>())>* = nullptr>
+  std::vector<std::unique_ptr<column>> operator()(column_view const&,
+                                                  PrecedingWindowIterator,
+                                                  FollowingWindowIterator,
+                                                  size_type,
+                                                  std::vector<std::unique_ptr<aggregation>> const&,
+                                                  rmm::mr::device_memory_resource*,
+                                                  cudaStream_t)
+  {
+    CUDF_FAIL("Fused rolling windows are only computed for numeric types");
+  }
+};
+
+/**
+ * @brief Returns whether each row of a window aggregated with `kind` is an element of its window,
+ * which is gathered
+ */
+bool is_positional(aggregation::Kind kind)
+{
+  return kind == aggregation::LEAD or kind == aggregation::LAG or
+         kind == aggregation::NTH_ELEMENT;
+}
+
+/**
+ * @brief Returns, for each row of `input`, the index of the element of its window returned by the
+ * `LEAD`, `LAG` or `NTH_ELEMENT` aggregation `agg`, or -1 when there is none
+ */
+template <typename PrecedingWindowIterator, typename FollowingWindowIterator>
+rmm::device_vector<size_type> positional_gather_map(column_view const& input,
+                                                    PrecedingWindowIterator preceding_window_begin,
+                                                    FollowingWindowIterator following_window_begin,
+                                                    size_type min_periods,
+                                                    aggregation const& agg,
+                                                    cudaStream_t stream)
+{
+  auto const kind    = agg.kind;
+  size_type n        = 0;
+  bool exclude_nulls = false;
+  if (kind == aggregation::NTH_ELEMENT) {
+    auto const& nth_agg = dynamic_cast<nth_element_aggregation const&>(agg);
+    n                   = nth_agg._n;
+    exclude_nulls       = nth_agg._null_handling == null_policy::EXCLUDE and input.has_nulls();
+  } else {
+    n = dynamic_cast<lead_lag_aggregation const&>(agg)._row_offset;
+  }
+
+  auto const num_rows = input.size();
+  auto const d_input  = column_device_view::create(input, stream);
+  rmm::device_vector<size_type> gather_map(num_rows);
+  thrust::transform(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_rows),
+    gather_map.begin(),
+    [input = *d_input,
+     preceding_window_begin,
+     following_window_begin,
+     num_rows,
+     min_periods,
+     kind,
+     n,
+     exclude_nulls] __device__(size_type i) -> size_type {
+      // Same bounds as gpu_rolling
+      size_type start             = min(num_rows, max(0, i - preceding_window_begin[i] + 1));
+      size_type end               = min(num_rows, max(0, i + following_window_begin[i] + 1));
+      size_type const start_index = min(start, end);
+      size_type const end_index   = max(start, end);
+
+      if (kind == aggregation::LEAD or kind == aggregation::LAG) {
+        auto const row = (kind == aggregation::LEAD) ? i + n : i - n;
+        return (row >= start_index and row < end_index) ? row : -1;
+      }
+      if (not exclude_nulls) {
+        auto const row      = (n >= 0) ? start_index + n : end_index + n;
+        auto const is_valid =
+          (end_index - start_index >= min_periods) and row >= start_index and row < end_index;
+        return is_valid ? row : -1;
+      }
+      // The n-th valid element, counted from the end of the window when n is negative
+      auto const target = (n >= 0) ? n : -n - 1;
+      size_type count   = 0;
+      size_type row     = -1;
+      for (size_type k = 0; k < end_index - start_index; ++k) {
+        auto const j = (n >= 0) ? start_index + k : end_index - 1 - k;
+        if (input.is_valid(j)) {
+          if (count == target) { row = j; }
+          ++count;
+        }
+      }
+      return (count >= min_periods) ? row : -1;
+    });
+  return gather_map;
+}
+
+/**
+ * @brief Computes the `LEAD`, `LAG` or `NTH_ELEMENT` aggregation `agg` by gathering an element of
+ * the window of each row
+ *
+ * The rows without an element are null, or taken from `default_outputs` when it is not empty.
+ */
+template <typename PrecedingWindowIterator, typename FollowingWindowIterator>
+std::unique_ptr<column> positional_rolling_window(column_view const& input,
+                                                  column_view const& default_outputs,
+                                                  PrecedingWindowIterator preceding_window_begin,
+                                                  FollowingWindowIterator following_window_begin,
+                                                  size_type min_periods,
+                                                  aggregation const& agg,
+                                                  rmm::mr::device_memory_resource* mr,
+                                                  cudaStream_t stream)
+{
+  auto const gather_map = positional_gather_map(
+    input, preceding_window_begin, following_window_begin, min_periods, agg, stream);
+  auto const gather_map_view =
+    column_view(data_type{type_to_id<size_type>()}, input.size(), gather_map.data().get());
+
+  if (default_outputs.is_empty()) {
+    auto result = detail::gather(table_view{{input}},
+                                 gather_map_view,
+                                 detail::out_of_bounds_policy::NULLIFY,
+                                 detail::negative_index_policy::NOT_ALLOWED,
+                                 mr,
+                                 stream);
+    return std::move(result->release()[0]);
+  }
+
+  auto const gathered = detail::gather(table_view{{input}},
+                                       gather_map_view,
+                                       detail::out_of_bounds_policy::NULLIFY,
+                                       detail::negative_index_policy::NOT_ALLOWED,
+                                       rmm::mr::get_default_resource(),
+                                       stream);
+  rmm::device_vector<bool> has_element(input.size());
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    gather_map.begin(),
+                    gather_map.end(),
+                    has_element.begin(),
+                    [] __device__(size_type row) { return row >= 0; });
+  return detail::copy_if_else(
+    gathered->get_column(0),
+    default_outputs,
+    column_view(data_type{type_id::BOOL8}, input.size(), has_element.data().get()),
+    mr,
+    stream);
+}
+
+/**
+ * @brief Computes the `RANK` or `DENSE_RANK` of each row of `input` within its group, the rows of
+ * each group being sorted
+ *
+ * The groups are given by `group_offsets` and `group_labels`, as in `grouped_rolling_window`; all
+ * the rows form a single group when they are null.
+ */
+std::unique_ptr<column> rank_window(column_view const& input,
+                                    size_type const* group_offsets,
+                                    size_type const* group_labels,
+                                    aggregation::Kind kind,
+                                    rmm::mr::device_memory_resource* mr,
+                                    cudaStream_t stream)
+{
+  auto const num_rows = input.size();
+  auto result         = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_rows, mask_state::UNALLOCATED, stream, mr);
+  if (num_rows == 0) { return result; }
+
+  // A row starts a run of equal rows when it starts its group or differs from the previous row.
+  // The rank of a row is one plus the position of its run in the group, and its dense rank the
+  // number of runs of the group up to it.
+  auto const dense   = kind == aggregation::DENSE_RANK;
+  auto const d_input = table_device_view::create(table_view{{input}}, stream);
+  rmm::device_vector<size_type> run_starts(num_rows);
+  thrust::transform(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_rows),
+    run_starts.begin(),
+    [equal = row_equality_comparator<true>{*d_input, *d_input, true},
+     group_offsets,
+     group_labels,
+     dense] __device__(size_type i) -> size_type {
+      auto const group_start  = (group_labels == nullptr) ? 0 : group_offsets[group_labels[i]];
+      auto const is_run_start = i == group_start or not equal(i, i - 1);
+      if (dense) { return is_run_start ? 1 : 0; }
+      return is_run_start ? i - group_start + 1 : 0;
+    });
+
+  auto const scan = [&](auto group_keys) {
+    auto const output = result->mutable_view().data<size_type>();
+    if (dense) {
+      thrust::inclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                    group_keys,
+                                    group_keys + num_rows,
+                                    run_starts.begin(),
+                                    output);
+    } else {
+      thrust::inclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                    group_keys,
+                                    group_keys + num_rows,
+                                    run_starts.begin(),
+                                    output,
+                                    thrust::equal_to<size_type>{},
+                                    thrust::maximum<size_type>{});
+    }
+  };
+  if (group_labels == nullptr) {
+    scan(thrust::make_constant_iterator<size_type>(0));
+  } else {
+    scan(group_labels);
+  }
+  CHECK_CUDA(stream);
+  return result;
+}
+
+/**
+ * @brief Returns a launcher of the rolling window kernel of `udf_agg` over `input_type`
+ *
+ * The kernel is compiled on first use, or read from the JIT cache if it was compiled before.
+ */
+cudf::jit::launcher make_udf_launcher(udf_aggregation const& udf_agg,
+                                      data_type input_type,
+                                      std::string const& preceding_window_str,
+                                      std::string const& following_window_str,
+                                      cudaStream_t stream)
+{
+  std::string hash = "prog_rolling." + std::to_string(std::hash<std::string>{}(udf_agg._source));
+
+  std::string cuda_source;
+  switch (udf_agg.kind) {
+    case aggregation::Kind::PTX:
+      cuda_source = cudf::rolling::jit::code::kernel_headers;
+      cuda_source +=
+        cudf::jit::parse_single_function_ptx(udf_agg._source,
+                                             udf_agg._function_name,
+                                             cudf::jit::get_type_name(udf_agg._output_type),
+                                             {0, 5});  // args 0 and 5 are pointers.
+      cuda_source += cudf::rolling::jit::code::kernel;
+      break;
+    case aggregation::Kind::CUDA:
+      cuda_source = cudf::rolling::jit::code::kernel_headers;
+      cuda_source +=
+        cudf::jit::parse_single_function_cuda(udf_agg._source, udf_agg._function_name);
+      cuda_source += cudf::rolling::jit::code::kernel;
+      break;
+    default: CUDF_FAIL("Unsupported UDF type.");
+  }
+
+  const std::vector<std::string> compiler_flags{"-std=c++14",
+                                                // Have jitify prune unused global variables
+                                                "-remove-unused-globals",
+                                                // suppress all NVRTC warnings
+                                                "-w"};
+
+  cudf::jit::launcher launcher(hash,
+                               cuda_source,
+                               {cudf_types_hpp,
+                                cudf_utilities_bit_hpp,
+                                cudf::rolling::jit::code::operation_h,
+                                ___src_rolling_rolling_jit_detail_hpp},
+                               compiler_flags,
+                               nullptr,
+                               stream);
+  launcher.set_kernel_inst("gpu_rolling_new",  // name of the kernel we are launching
+                           {cudf::jit::get_type_name(input_type),  // list of template arguments
+                            cudf::jit::get_type_name(udf_agg._output_type),
+                            udf_agg._operator_name,
+                            preceding_window_str.c_str(),
+                            following_window_str.c_str()});
+  return launcher;
+}
+
 }  // namespace
 
 // Applies a user-defined rolling window function to the values in a column.
@@ -544,56 +1293,14 @@ std::unique_ptr<column> rolling_window_udf(column_view const& input,
 
   auto udf_agg = static_cast<udf_aggregation*>(agg.get());
 
-  std::string hash = "prog_rolling." + std::to_string(std::hash<std::string>{}(udf_agg->_source));
-
-  std::string cuda_source;
-  switch (udf_agg->kind) {
-    case aggregation::Kind::PTX:
-      cuda_source = cudf::rolling::jit::code::kernel_headers;
-      cuda_source +=
-        cudf::jit::parse_single_function_ptx(udf_agg->_source,
-                                             udf_agg->_function_name,
-                                             cudf::jit::get_type_name(udf_agg->_output_type),
-                                             {0, 5});  // args 0 and 5 are pointers.
-      cuda_source += cudf::rolling::jit::code::kernel;
-      break;
-    case aggregation::Kind::CUDA:
-      cuda_source = cudf::rolling::jit::code::kernel_headers;
-      cuda_source +=
-        cudf::jit::parse_single_function_cuda(udf_agg->_source, udf_agg->_function_name);
-      cuda_source += cudf::rolling::jit::code::kernel;
-      break;
-    default: CUDF_FAIL("Unsupported UDF type.");
-  }
-
   std::unique_ptr<column> output = make_numeric_column(
     udf_agg->_output_type, input.size(), cudf::mask_state::UNINITIALIZED, stream, mr);
 
   auto output_view = output->mutable_view();
   rmm::device_scalar<size_type> device_valid_count{0, stream};
 
-  const std::vector<std::string> compiler_flags{"-std=c++14",
-                                                // Have jitify prune unused global variables
-                                                "-remove-unused-globals",
-                                                // suppress all NVRTC warnings
-                                                "-w"};
-
   // Launch the jitify kernel
-  cudf::jit::launcher(hash,
-                      cuda_source,
-                      {cudf_types_hpp,
-                       cudf_utilities_bit_hpp,
-                       cudf::rolling::jit::code::operation_h,
-                       ___src_rolling_rolling_jit_detail_hpp},
-                      compiler_flags,
-                      nullptr,
-                      stream)
-    .set_kernel_inst("gpu_rolling_new",  // name of the kernel we are launching
-                     {cudf::jit::get_type_name(input.type()),  // list of template arguments
-                      cudf::jit::get_type_name(output->type()),
-                      udf_agg->_operator_name,
-                      preceding_window_str.c_str(),
-                      following_window_str.c_str()})
+  make_udf_launcher(*udf_agg, input.type(), preceding_window_str, following_window_str, stream)
     .launch(input.size(),
             cudf::jit::get_data_ptr(input),
             input.null_mask(),
@@ -639,6 +1346,59 @@ std::unique_ptr<column> rolling_window(column_view const& input,
 
   min_periods = std::max(min_periods, 0);
 
+  if (agg->kind == aggregation::RANK or agg->kind == aggregation::DENSE_RANK) {
+    // Without groups, all the rows are ranked together
+    return rank_window(input, nullptr, nullptr, agg->kind, mr, stream);
+  }
+  if (is_positional(agg->kind)) {
+    return positional_rolling_window(input,
+                                     column_view{},
+                                     preceding_window_begin,
+                                     following_window_begin,
+                                     min_periods,
+                                     *agg,
+                                     mr,
+                                     stream);
+  }
+
+  if (input.size() > 0 and has_prefix_evaluation(input.type(), agg->kind)) {
+    auto const num_rows = input.size();
+    rmm::device_vector<size_type> window_starts(num_rows);
+    rmm::device_vector<size_type> window_ends(num_rows);
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       num_rows,
+                       [preceding_window_begin,
+                        following_window_begin,
+                        num_rows,
+                        starts = window_starts.data().get(),
+                        ends   = window_ends.data().get()] __device__(size_type i) {
+                         // Same bounds as gpu_rolling
+                         size_type start = min(num_rows, max(0, i - preceding_window_begin[i] + 1));
+                         size_type end   = min(num_rows, max(0, i + following_window_begin[i] + 1));
+                         starts[i]       = min(start, end);
+                         ends[i]         = max(start, end);
+                       });
+    auto const max_window = thrust::transform_reduce(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(num_rows),
+      [starts = window_starts.data().get(), ends = window_ends.data().get()] __device__(
+        size_type i) { return ends[i] - starts[i]; },
+      0,
+      thrust::maximum<size_type>());
+    if (max_window >= min_window_for_prefix_evaluation) {
+      return prefix_rolling_window(input,
+                                   window_starts.data().get(),
+                                   window_ends.data().get(),
+                                   max_window,
+                                   min_periods,
+                                   agg->kind,
+                                   mr,
+                                   stream);
+    }
+  }
+
   return cudf::type_dispatcher(input.type(),
                                dispatch_rolling{},
                                input,
@@ -650,6 +1410,63 @@ std::unique_ptr<column> rolling_window(column_view const& input,
                                stream);
 }
 
+/**
+ * @copydoc cudf::rolling_window(column_view const& input,
+ *                               size_type preceding_window,
+ *                               size_type following_window,
+ *                               size_type min_periods,
+ *                               std::vector<std::unique_ptr<aggregation>> const& aggs,
+ *                               rmm::mr::device_memory_resource* mr)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+template <typename PrecedingWindowIterator, typename FollowingWindowIterator>
+std::vector<std::unique_ptr<column>> rolling_window(
+  column_view const& input,
+  PrecedingWindowIterator preceding_window_begin,
+  FollowingWindowIterator following_window_begin,
+  size_type min_periods,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream = 0)
+{
+  min_periods = std::max(min_periods, 0);
+
+  if (aggs.size() > 1 and input.size() > 0 and is_fusable(input.type(), aggs)) {
+    // Windows wide enough for the prefix evaluation are cheaper to aggregate separately
+    auto const num_rows   = input.size();
+    auto const max_window = thrust::transform_reduce(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(num_rows),
+      [preceding_window_begin, following_window_begin, num_rows] __device__(size_type i) {
+        size_type start = min(num_rows, max(0, i - preceding_window_begin[i] + 1));
+        size_type end   = min(num_rows, max(0, i + following_window_begin[i] + 1));
+        return max(start, end) - min(start, end);
+      },
+      0,
+      thrust::maximum<size_type>());
+    if (max_window < min_window_for_prefix_evaluation) {
+      return cudf::type_dispatcher(input.type(),
+                                   fused_rolling_fn{},
+                                   input,
+                                   preceding_window_begin,
+                                   following_window_begin,
+                                   min_periods,
+                                   aggs,
+                                   mr,
+                                   stream);
+    }
+  }
+
+  std::vector<std::unique_ptr<column>> results;
+  for (auto const& agg : aggs) {
+    results.push_back(detail::rolling_window(
+      input, preceding_window_begin, following_window_begin, min_periods, agg, mr, stream));
+  }
+  return results;
+}
+
 }  // namespace detail
 
 // Applies a fixed-size rolling window function to the values in a column.
@@ -723,52 +1540,102 @@ std::unique_ptr<column> rolling_window(column_view const& input,
   }
 }
 
-std::unique_ptr<column> grouped_rolling_window(table_view const& group_keys,
-                                               column_view const& input,
-                                               size_type preceding_window,
-                                               size_type following_window,
-                                               size_type min_periods,
-                                               std::unique_ptr<aggregation> const& aggr,
-                                               rmm::mr::device_memory_resource* mr)
+namespace {
+bool has_udf(std::vector<std::unique_ptr<aggregation>> const& aggs)
 {
-  if (input.size() == 0) return empty_like(input);
+  return std::any_of(aggs.begin(), aggs.end(), [](auto const& agg) {
+    return agg->kind == aggregation::CUDA || agg->kind == aggregation::PTX;
+  });
+}
 
-  CUDF_EXPECTS((group_keys.num_columns() == 0 || group_keys.num_rows() == input.size()),
-               "Size mismatch between group_keys and input vector.");
+}  // namespace
 
-  CUDF_EXPECTS((min_periods > 0), "min_periods must be positive");
+// Applies several fixed-size rolling window functions to the values in a column.
+std::vector<std::unique_ptr<column>> rolling_window(
+  column_view const& input,
+  size_type preceding_window,
+  size_type following_window,
+  size_type min_periods,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS((min_periods >= 0), "min_periods must be non-negative");
 
-  if (group_keys.num_columns() == 0) {
-    // No Groupby columns specified. Treat as one big group.
-    return rolling_window(input, preceding_window, following_window, min_periods, aggr, mr);
+  if (input.size() == 0 || has_udf(aggs)) {
+    std::vector<std::unique_ptr<column>> results;
+    for (auto const& agg : aggs) {
+      results.push_back(
+        rolling_window(input, preceding_window, following_window, min_periods, agg, mr));
+    }
+    return results;
   }
+  return cudf::detail::rolling_window(input,
+                                      thrust::make_constant_iterator(preceding_window),
+                                      thrust::make_constant_iterator(following_window),
+                                      min_periods,
+                                      aggs,
+                                      mr,
+                                      0);
+}
 
-  using sort_groupby_helper = cudf::groupby::detail::sort::sort_groupby_helper;
+// Applies several variable-size rolling window functions to the values in a column.
+std::vector<std::unique_ptr<column>> rolling_window(
+  column_view const& input,
+  column_view const& preceding_window,
+  column_view const& following_window,
+  size_type min_periods,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  if (preceding_window.size() == 0 || following_window.size() == 0 || input.size() == 0 ||
+      has_udf(aggs)) {
+    std::vector<std::unique_ptr<column>> results;
+    for (auto const& agg : aggs) {
+      results.push_back(
+        rolling_window(input, preceding_window, following_window, min_periods, agg, mr));
+    }
+    return results;
+  }
 
-  sort_groupby_helper helper{group_keys, cudf::null_policy::INCLUDE, cudf::sorted::YES};
-  auto group_offsets{helper.group_offsets()};
-  auto const& group_labels{helper.group_labels()};
+  CUDF_EXPECTS(preceding_window.type().id() == type_id::INT32 &&
+                 following_window.type().id() == type_id::INT32,
+               "preceding_window/following_window must have type_id::INT32 type");
 
-  // `group_offsets` are interpreted in adjacent pairs, each pair representing the offsets
-  // of the first, and one past the last elements in a group.
-  //
-  // If `group_offsets` is not empty, it must contain at least two offsets:
-  //   a. 0, indicating the first element in `input`
-  //   b. input.size(), indicating one past the last element in `input`.
-  //
-  // Thus, for an input of 1000 rows,
-  //   0. [] indicates a single group, spanning the entire column.
-  //   1  [10] is invalid.
-  //   2. [0, 1000] indicates a single group, spanning the entire column (thus, equivalent to no
-  //   groups.)
-  //   3. [0, 500, 1000] indicates two equal-sized groups: [0,500), and [500,1000).
+  CUDF_EXPECTS(preceding_window.size() == input.size() && following_window.size() == input.size(),
+               "preceding_window/following_window size must match input size");
 
-  assert(group_offsets.size() >= 2 && group_offsets[0] == 0 &&
-         group_offsets[group_offsets.size() - 1] == input.size() &&
-         "Must have at least one group.");
+  return cudf::detail::rolling_window(input,
+                                      preceding_window.begin<size_type>(),
+                                      following_window.begin<size_type>(),
+                                      min_periods,
+                                      aggs,
+                                      mr,
+                                      0);
+}
 
-  auto preceding_calculator = [d_group_offsets = group_offsets.data().get(),
-                               d_group_labels  = group_labels.data().get(),
+namespace {
+/**
+ * @brief Applies a fixed-size rolling window to `input`, whose rows are grouped in contiguous
+ * ranges given by `group_offsets`, without crossing the group boundaries
+ */
+std::unique_ptr<column> grouped_rolling_window_impl(column_view const& input,
+                                                    size_type const* group_offsets,
+                                                    size_type const* group_labels,
+                                                    size_type preceding_window,
+                                                    size_type following_window,
+                                                    size_type min_periods,
+                                                    std::unique_ptr<aggregation> const& aggr,
+                                                    rmm::mr::device_memory_resource* mr,
+                                                    column_view const& default_outputs = {})
+{
+  if (aggr->kind == aggregation::RANK or aggr->kind == aggregation::DENSE_RANK) {
+    return detail::rank_window(input, group_offsets, group_labels, aggr->kind, mr, 0);
+  }
+
+  auto preceding_calculator = [d_group_offsets = group_offsets,
+                               d_group_labels  = group_labels,
                                preceding_window] __device__(size_type idx) {
     auto group_label = d_group_labels[idx];
     auto group_start = d_group_offsets[group_label];
@@ -776,8 +1643,8 @@ std::unique_ptr<column> grouped_rolling_window(table_view const& group_keys,
                                         idx - group_start + 1);  // Preceding includes current row.
   };
 
-  auto following_calculator = [d_group_offsets = group_offsets.data().get(),
-                               d_group_labels  = group_labels.data().get(),
+  auto following_calculator = [d_group_offsets = group_offsets,
+                               d_group_labels  = group_labels,
                                following_window] __device__(size_type idx) {
     auto group_label = d_group_labels[idx];
     auto group_end =
@@ -788,10 +1655,10 @@ std::unique_ptr<column> grouped_rolling_window(table_view const& group_keys,
 
   if (aggr->kind == aggregation::CUDA || aggr->kind == aggregation::PTX) {
     cudf::detail::preceding_window_wrapper grouped_preceding_window{
-      group_offsets.data().get(), group_labels.data().get(), preceding_window};
+      group_offsets, group_labels, preceding_window};
 
     cudf::detail::following_window_wrapper grouped_following_window{
-      group_offsets.data().get(), group_labels.data().get(), following_window};
+      group_offsets, group_labels, following_window};
 
     return cudf::detail::rolling_window_udf(input,
                                             grouped_preceding_window,
@@ -802,6 +1669,18 @@ std::unique_ptr<column> grouped_rolling_window(table_view const& group_keys,
                                             aggr,
                                             mr,
                                             0);
+  } else if (not default_outputs.is_empty()) {
+    return cudf::detail::positional_rolling_window(
+      input,
+      default_outputs,
+      thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                      preceding_calculator),
+      thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                      following_calculator),
+      min_periods,
+      *aggr,
+      mr,
+      0);
   } else {
     return cudf::detail::rolling_window(
       input,
@@ -816,6 +1695,158 @@ std::unique_ptr<column> grouped_rolling_window(table_view const& group_keys,
   }
 }
 
+/**
+ * @brief Applies a fixed-size rolling window to `input`, whose rows are sorted by `group_keys`;
+ * see `grouped_rolling_window`
+ */
+std::unique_ptr<column> grouped_rolling_window_sorted(table_view const& group_keys,
+                                                      column_view const& input,
+                                                      column_view const& default_outputs,
+                                                      size_type preceding_window,
+                                                      size_type following_window,
+                                                      size_type min_periods,
+                                                      std::unique_ptr<aggregation> const& aggr,
+                                                      rmm::mr::device_memory_resource* mr)
+{
+  if (input.size() == 0) return empty_like(input);
+
+  CUDF_EXPECTS((group_keys.num_columns() == 0 || group_keys.num_rows() == input.size()),
+               "Size mismatch between group_keys and input vector.");
+
+  CUDF_EXPECTS((min_periods > 0), "min_periods must be positive");
+
+  if (group_keys.num_columns() == 0 and not default_outputs.is_empty()) {
+    return detail::positional_rolling_window(input,
+                                             default_outputs,
+                                             thrust::make_constant_iterator(preceding_window),
+                                             thrust::make_constant_iterator(following_window),
+                                             min_periods,
+                                             *aggr,
+                                             mr,
+                                             0);
+  }
+  if (group_keys.num_columns() == 0) {
+    // No Groupby columns specified. Treat as one big group.
+    return rolling_window(input, preceding_window, following_window, min_periods, aggr, mr);
+  }
+
+  using sort_groupby_helper = cudf::groupby::detail::sort::sort_groupby_helper;
+
+  sort_groupby_helper helper{group_keys, cudf::null_policy::INCLUDE, cudf::sorted::YES};
+  auto group_offsets{helper.group_offsets()};
+  auto const& group_labels{helper.group_labels()};
+
+  // `group_offsets` are interpreted in adjacent pairs, each pair representing the offsets
+  // of the first, and one past the last elements in a group.
+  //
+  // If `group_offsets` is not empty, it must contain at least two offsets:
+  //   a. 0, indicating the first element in `input`
+  //   b. input.size(), indicating one past the last element in `input`.
+  //
+  // Thus, for an input of 1000 rows,
+  //   0. [] indicates a single group, spanning the entire column.
+  //   1  [10] is invalid.
+  //   2. [0, 1000] indicates a single group, spanning the entire column (thus, equivalent to no
+  //   groups.)
+  //   3. [0, 500, 1000] indicates two equal-sized groups: [0,500), and [500,1000).
+
+  assert(group_offsets.size() >= 2 && group_offsets[0] == 0 &&
+         group_offsets[group_offsets.size() - 1] == input.size() &&
+         "Must have at least one group.");
+
+  return grouped_rolling_window_impl(input,
+                                     group_offsets.data().get(),
+                                     group_labels.data().get(),
+                                     preceding_window,
+                                     following_window,
+                                     min_periods,
+                                     aggr,
+                                     mr,
+                                     default_outputs);
+}
+}  // namespace
+
+std::unique_ptr<column> grouped_rolling_window(table_view const& group_keys,
+                                               column_view const& input,
+                                               size_type preceding_window,
+                                               size_type following_window,
+                                               size_type min_periods,
+                                               std::unique_ptr<aggregation> const& aggr,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return grouped_rolling_window_sorted(
+    group_keys, input, column_view{}, preceding_window, following_window, min_periods, aggr, mr);
+}
+
+std::unique_ptr<column> grouped_rolling_window(table_view const& group_keys,
+                                               column_view const& input,
+                                               column_view const& default_outputs,
+                                               size_type preceding_window,
+                                               size_type following_window,
+                                               size_type min_periods,
+                                               std::unique_ptr<aggregation> const& aggr,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(aggr->kind == aggregation::LEAD or aggr->kind == aggregation::LAG,
+               "Default outputs are only supported for LEAD and LAG aggregations.");
+  CUDF_EXPECTS(default_outputs.type() == input.type(),
+               "Type mismatch between default outputs and input vector.");
+  CUDF_EXPECTS(default_outputs.size() == input.size(),
+               "Size mismatch between default outputs and input vector.");
+  return grouped_rolling_window_sorted(
+    group_keys, input, default_outputs, preceding_window, following_window, min_periods, aggr, mr);
+}
+
+std::unique_ptr<column> grouped_rolling_window(groupby::grouping const& groups,
+                                               column_view const& input,
+                                               size_type preceding_window,
+                                               size_type following_window,
+                                               size_type min_periods,
+                                               std::unique_ptr<aggregation> const& aggr,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(groups.keys().num_rows() == input.size(),
+               "Size mismatch between grouping keys and input vector.");
+
+  CUDF_EXPECTS((min_periods > 0), "min_periods must be positive");
+
+  if (input.size() == 0) return empty_like(input);
+
+  // Roll over the rows in group order, where every group is a contiguous range
+  auto const sort_order    = groups.key_sort_order();
+  auto const grouped_input = detail::gather(table_view{{input}},
+                                            sort_order,
+                                            detail::out_of_bounds_policy::FAIL,
+                                            detail::negative_index_policy::NOT_ALLOWED);
+  auto const grouped_result = grouped_rolling_window_impl(grouped_input->get_column(0),
+                                                          groups.group_offsets().data<size_type>(),
+                                                          groups.group_labels().data<size_type>(),
+                                                          preceding_window,
+                                                          following_window,
+                                                          min_periods,
+                                                          aggr,
+                                                          rmm::mr::get_default_resource());
+
+  // Return the results in the original row order; rows without a group map out of bounds and
+  // are nullified
+  rmm::device_vector<size_type> original_order(input.size(), sort_order.size());
+  thrust::scatter(rmm::exec_policy(0)->on(0),
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(sort_order.size()),
+                  sort_order.begin<size_type>(),
+                  original_order.begin());
+  auto result = detail::gather(
+    table_view{{grouped_result->view()}},
+    column_view(data_type(type_to_id<size_type>()), input.size(), original_order.data().get()),
+    detail::out_of_bounds_policy::NULLIFY,
+    detail::negative_index_policy::NOT_ALLOWED,
+    mr);
+  return std::move(result->release()[0]);
+}
+
 namespace {
 bool is_supported_range_frame_unit(cudf::data_type const& data_type)
 {
@@ -1056,6 +2087,18 @@ std::unique_ptr<column> time_range_window_DESC(
 
   if (aggr->kind == aggregation::CUDA || aggr->kind == aggregation::PTX) {
     CUDF_FAIL("Time ranged rolling window does NOT (yet) support UDF.");
+  } else if (not default_outputs.is_empty()) {
+    return cudf::detail::positional_rolling_window(
+      input,
+      default_outputs,
+      thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                      preceding_calculator),
+      thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                      following_calculator),
+      min_periods,
+      *aggr,
+      mr,
+      0);
   } else {
     return cudf::detail::rolling_window(
       input,
@@ -1084,6 +2127,15 @@ std::unique_ptr<column> grouped_time_range_rolling_window_impl(
   std::unique_ptr<aggregation> const& aggr,
   rmm::mr::device_memory_resource* mr)
 {
+  if (aggr->kind == aggregation::RANK or aggr->kind == aggregation::DENSE_RANK) {
+    return detail::rank_window(input,
+                               group_offsets.empty() ? nullptr : group_offsets.data().get(),
+                               group_labels.empty() ? nullptr : group_labels.data().get(),
+                               aggr->kind,
+                               mr,
+                               0);
+  }
+
   TimestampImpl_t mult_factor{
     static_cast<TimestampImpl_t>(multiplication_factor(timestamp_column.type()))};
 
@@ -1138,6 +2190,7 @@ std::unique_ptr<column> grouped_time_range_rolling_window(table_view const& grou
                                                           std::unique_ptr<aggregation> const& aggr,
                                                           rmm::mr::device_memory_resource* mr)
 {
+  CUDF_FUNC_RANGE();
   if (input.size() == 0) return empty_like(input);
 
   CUDF_EXPECTS((group_keys.num_columns() == 0 || group_keys.num_rows() == input.size()),
@@ -1182,4 +2235,46 @@ std::unique_ptr<column> grouped_time_range_rolling_window(table_view const& grou
                                                              mr);
 }
 
+std::unique_ptr<column> time_range_rolling_window(column_view const& timestamp_column,
+                                                  cudf::order const& timestamp_order,
+                                                  column_view const& input,
+                                                  size_type preceding_window_in_days,
+                                                  size_type following_window_in_days,
+                                                  size_type min_periods,
+                                                  std::unique_ptr<aggregation> const& aggr,
+                                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return grouped_time_range_rolling_window(table_view{},
+                                           timestamp_column,
+                                           timestamp_order,
+                                           input,
+                                           preceding_window_in_days,
+                                           following_window_in_days,
+                                           min_periods,
+                                           aggr,
+                                           mr);
+}
+
+// Compiles the kernels of a user-defined rolling window aggregation ahead of use.
+void precompile_rolling_window_udf(std::vector<data_type> const& input_types,
+                                   std::unique_ptr<aggregation> const& agg)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(agg->kind == aggregation::CUDA || agg->kind == aggregation::PTX,
+               "Aggregation is not a user-defined function");
+  auto const& udf_agg = static_cast<udf_aggregation const&>(*agg);
+
+  // The window types of the fixed-size, variable-size and grouped rolling windows
+  std::vector<std::pair<std::string, std::string>> const window_types{
+    {"cudf::size_type", "cudf::size_type"},
+    {"cudf::size_type*", "cudf::size_type*"},
+    {"cudf::detail::preceding_window_wrapper", "cudf::detail::following_window_wrapper"}};
+  for (auto const& input_type : input_types) {
+    for (auto const& windows : window_types) {
+      detail::make_udf_launcher(udf_agg, input_type, windows.first, windows.second, 0);
+    }
+  }
+}
+
 }  // namespace cudf
@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.cuh>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/merge.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+namespace cudf {
+namespace {
+/**
+ * @brief Pinned host memory holding a spilled chunk
+ */
+struct pinned_host_buffer {
+  explicit pinned_host_buffer(std::size_t size) : size{size}
+  {
+    if (size > 0) { CUDA_TRY(cudaMallocHost(&data, size)); }
+  }
+  ~pinned_host_buffer()
+  {
+    if (data != nullptr) { cudaFreeHost(data); }
+  }
+  pinned_host_buffer(pinned_host_buffer const&) = delete;
+  pinned_host_buffer& operator=(pinned_host_buffer const&) = delete;
+
+  void* data{nullptr};
+  std::size_t size;
+};
+
+/**
+ * @brief The layout of a column packed by `contiguous_split`, its buffers being located by their
+ * byte offset in the packed data, or -1 if absent
+ */
+struct packed_column {
+  data_type type;
+  size_type size;
+  size_type null_count;
+  size_type offset;
+  std::ptrdiff_t data_offset;
+  std::ptrdiff_t null_mask_offset;
+  std::vector<packed_column> children;
+};
+
+std::ptrdiff_t offset_in(void const* ptr, uint8_t const* base)
+{
+  return ptr == nullptr ? -1 : static_cast<uint8_t const*>(ptr) - base;
+}
+
+void const* pointer_at(uint8_t const* base, std::ptrdiff_t offset)
+{
+  return offset < 0 ? nullptr : base + offset;
+}
+
+packed_column describe(column_view const& col, uint8_t const* base)
+{
+  packed_column packed{col.type(),
+                       col.size(),
+                       col.null_count(),
+                       col.offset(),
+                       offset_in(col.head(), base),
+                       offset_in(col.null_mask(), base),
+                       {}};
+  for (size_type i = 0; i < col.num_children(); ++i) {
+    packed.children.push_back(describe(col.child(i), base));
+  }
+  return packed;
+}
+
+column_view rebuild(packed_column const& packed, uint8_t const* base)
+{
+  std::vector<column_view> children;
+  for (auto const& child : packed.children) { children.push_back(rebuild(child, base)); }
+  return column_view{packed.type,
+                     packed.size,
+                     pointer_at(base, packed.data_offset),
+                     static_cast<bitmask_type const*>(pointer_at(base, packed.null_mask_offset)),
+                     packed.null_count,
+                     packed.offset,
+                     children};
+}
+
+/**
+ * @brief A chunk of a sorted run, packed in host memory
+ */
+struct spilled_chunk {
+  std::vector<packed_column> columns;
+  std::unique_ptr<pinned_host_buffer> data;
+};
+
+spilled_chunk spill(contiguous_split_result const& chunk, cudaStream_t stream)
+{
+  auto const base = static_cast<uint8_t const*>(chunk.all_data->data());
+  spilled_chunk spilled{{}, std::make_unique<pinned_host_buffer>(chunk.all_data->size())};
+  std::transform(chunk.table.begin(),
+                 chunk.table.end(),
+                 std::back_inserter(spilled.columns),
+                 [base](auto const& col) { return describe(col, base); });
+  if (spilled.data->size > 0) {
+    CUDA_TRY(cudaMemcpyAsync(
+      spilled.data->data, base, spilled.data->size, cudaMemcpyDeviceToHost, stream));
+  }
+  return spilled;
+}
+
+size_type read_element(column_view const& col, size_type index, cudaStream_t stream)
+{
+  size_type value;
+  CUDA_TRY(cudaMemcpyAsync(
+    &value, col.data<size_type>() + index, sizeof(size_type), cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  return value;
+}
+
+}  // namespace
+
+class external_sorter::impl {
+ public:
+  impl(std::vector<size_type> const& key_cols,
+       std::vector<order> const& column_order,
+       std::vector<null_order> const& null_precedence,
+       size_type chunk_rows)
+    : _key_cols{key_cols},
+      _column_order{column_order},
+      _null_precedence{null_precedence},
+      _chunk_rows{chunk_rows}
+  {
+    CUDF_EXPECTS(not _key_cols.empty(), "Empty key_cols");
+    CUDF_EXPECTS(_key_cols.size() == _column_order.size(),
+                 "Mismatched size between key_cols and column_order");
+    CUDF_EXPECTS(_null_precedence.empty() or _key_cols.size() == _null_precedence.size(),
+                 "Mismatched size between key_cols and null_precedence");
+    CUDF_EXPECTS(_chunk_rows > 0, "chunk_rows must be positive");
+    if (_null_precedence.empty()) { _null_precedence.resize(_key_cols.size(), null_order::BEFORE); }
+  }
+
+  void push(table_view const& batch, cudaStream_t stream)
+  {
+    CUDF_EXPECTS(not _merging, "Cannot push a batch once the merge has started");
+    if (_types.empty()) {
+      CUDF_EXPECTS(std::all_of(_key_cols.begin(),
+                               _key_cols.end(),
+                               [&batch](auto col) { return col < batch.num_columns(); }),
+                   "Key column index out of bounds");
+      std::transform(batch.begin(), batch.end(), std::back_inserter(_types), [](auto const& col) {
+        return col.type();
+      });
+    } else {
+      CUDF_EXPECTS(std::equal(_types.begin(),
+                              _types.end(),
+                              batch.begin(),
+                              batch.end(),
+                              [](auto type, auto const& col) { return type == col.type(); }),
+                   "Mismatched column types");
+    }
+    if (batch.num_rows() == 0) { return; }
+
+    auto const sorted = detail::sort_by_key(batch,
+                                            batch.select(_key_cols),
+                                            _column_order,
+                                            _null_precedence,
+                                            rmm::mr::get_default_resource(),
+                                            stream);
+    std::vector<size_type> splits;
+    for (int64_t i = _chunk_rows; i < batch.num_rows(); i += _chunk_rows) {
+      splits.push_back(static_cast<size_type>(i));
+    }
+    auto const chunks = detail::contiguous_split(
+      sorted->view(), splits, rmm::mr::get_default_resource(), stream);
+
+    run spilled;
+    std::transform(chunks.begin(),
+                   chunks.end(),
+                   std::back_inserter(spilled.chunks),
+                   [stream](auto const& chunk) { return spill(chunk, stream); });
+    // The device copy of the run is freed on return
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    _runs.push_back(std::move(spilled));
+  }
+
+  bool has_next() const
+  {
+    return std::any_of(_runs.begin(), _runs.end(), [](auto const& r) {
+      return r.rows.num_rows() > 0 or r.next_chunk < r.chunks.size();
+    });
+  }
+
+  std::unique_ptr<table> next(rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+  {
+    CUDF_EXPECTS(has_next(), "No rows left to return");
+    _merging = true;
+
+    for (auto& r : _runs) {
+      if (r.rows.num_rows() == 0 and r.next_chunk < r.chunks.size()) { load_next_chunk(r, stream); }
+    }
+
+    // The rows of a run that are still in host memory are not less than the last loaded row of
+    // the run, so every loaded row up to the least of these last rows is ready to be returned
+    std::vector<table_view> last_keys;
+    for (auto const& r : _runs) {
+      if (r.next_chunk < r.chunks.size()) {
+        auto const num_rows = r.rows.num_rows();
+        last_keys.push_back(cudf::slice(r.rows.select(_key_cols), {num_rows - 1, num_rows})[0]);
+      }
+    }
+    table_view bound;
+    if (not last_keys.empty()) {
+      auto const candidates =
+        detail::concatenate(last_keys, rmm::mr::get_default_resource(), stream);
+      auto const candidates_order = detail::sorted_order(candidates->view(),
+                                                         _column_order,
+                                                         _null_precedence,
+                                                         rmm::mr::get_default_resource(),
+                                                         stream);
+      bound = last_keys[read_element(candidates_order->view(), 0, stream)];
+    }
+
+    std::vector<size_type> num_ready;
+    std::vector<table_view> ready;
+    for (auto const& r : _runs) {
+      auto count = r.rows.num_rows();
+      if (count > 0 and bound.num_columns() > 0) {
+        auto const position = detail::upper_bound(r.rows.select(_key_cols),
+                                                  bound,
+                                                  _column_order,
+                                                  _null_precedence,
+                                                  rmm::mr::get_default_resource(),
+                                                  stream);
+        count = read_element(position->view(), 0, stream);
+      }
+      num_ready.push_back(count);
+      if (count > 0) { ready.push_back(cudf::slice(r.rows, {0, count})[0]); }
+    }
+
+    auto result = detail::merge(ready, _key_cols, _column_order, _null_precedence, mr, stream);
+
+    for (std::size_t i = 0; i < _runs.size(); ++i) {
+      auto& r = _runs[i];
+      if (num_ready[i] == r.rows.num_rows()) {
+        r.rows = table_view{};
+        r.data.reset();
+      } else if (num_ready[i] > 0) {
+        r.rows = cudf::slice(r.rows, {num_ready[i], r.rows.num_rows()})[0];
+      }
+    }
+    return result;
+  }
+
+ private:
+  /**
+   * @brief A sorted batch, spilled in chunks, and the rows of its loaded chunk not returned yet
+   */
+  struct run {
+    std::vector<spilled_chunk> chunks;
+    std::size_t next_chunk{0};
+    std::unique_ptr<rmm::device_buffer> data;
+    table_view rows;
+  };
+
+  void load_next_chunk(run& r, cudaStream_t stream)
+  {
+    auto& chunk = r.chunks[r.next_chunk++];
+    r.data      = std::make_unique<rmm::device_buffer>(chunk.data->size, stream);
+    if (chunk.data->size > 0) {
+      CUDA_TRY(cudaMemcpyAsync(
+        r.data->data(), chunk.data->data, chunk.data->size, cudaMemcpyHostToDevice, stream));
+    }
+    auto const base = static_cast<uint8_t const*>(r.data->data());
+    std::vector<column_view> columns;
+    std::transform(chunk.columns.begin(),
+                   chunk.columns.end(),
+                   std::back_inserter(columns),
+                   [base](auto const& col) { return rebuild(col, base); });
+    r.rows = table_view{columns};
+
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    chunk.data.reset();
+  }
+
+  std::vector<size_type> _key_cols;
+  std::vector<order> _column_order;
+  std::vector<null_order> _null_precedence;
+  size_type _chunk_rows;
+  std::vector<data_type> _types;
+  std::vector<run> _runs;
+  bool _merging{false};
+};
+
+external_sorter::external_sorter(std::vector<size_type> const& key_cols,
+                                 std::vector<order> const& column_order,
+                                 std::vector<null_order> const& null_precedence,
+                                 size_type chunk_rows)
+  : _impl{std::make_unique<impl>(key_cols, column_order, null_precedence, chunk_rows)}
+{
+}
+
+external_sorter::~external_sorter() = default;
+
+void external_sorter::push(table_view const& batch)
+{
+  CUDF_FUNC_RANGE();
+  _impl->push(batch, 0);
+}
+
+bool external_sorter::has_next() const { return _impl->has_next(); }
+
+std::unique_ptr<table> external_sorter::next(rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return _impl->next(mr, 0);
+}
+
+}  // namespace cudf
@@ -16,6 +16,7 @@
 
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/table/row_operators.cuh>
+#include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
@@ -23,6 +24,8 @@
 
 #include <rmm/thrust_rmm_allocator.h>
 
+#include <numeric>
+
 namespace cudf {
 namespace detail {
 template <bool has_nulls>
@@ -74,4 +77,16 @@ bool is_sorted(cudf::table_view const& in,
   }
 }
 
+bool is_sorted(cudf::table const& in,
+               std::vector<order> const& column_order,
+               std::vector<null_order> const& null_precedence)
+{
+  CUDF_FUNC_RANGE();
+  std::vector<size_type> all_columns(in.num_columns());
+  std::iota(all_columns.begin(), all_columns.end(), 0);
+  if (in.is_sorted_by(all_columns, column_order, null_precedence)) { return true; }
+
+  return is_sorted(in.view(), column_order, null_precedence);
+}
+
 }  // namespace cudf
@@ -15,7 +15,9 @@
  */
 
 #include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/table/row_operators.cuh>
@@ -25,6 +27,7 @@
 #include <cudf/utilities/error.hpp>
 
 #include <rmm/thrust_rmm_allocator.h>
+#include <thrust/binary_search.h>
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/permutation_iterator.h>
 #include <thrust/sequence.h>
@@ -32,36 +35,72 @@
 namespace cudf {
 namespace detail {
 namespace {
+/**
+ * @brief Finds the segment of each row of a sorted column, all the rows forming a single segment
+ * when `labels` is null.
+ */
+struct segment_finder {
+  size_type const* offsets;  ///< Offsets of the segments
+  size_type const* labels;   ///< Segment of each row, or null for a single segment
+  size_type num_rows;
+
+  __device__ size_type begin(size_type index) const noexcept
+  {
+    return labels == nullptr ? 0 : offsets[labels[index]];
+  }
+  __device__ size_type end(size_type index) const noexcept
+  {
+    return labels == nullptr ? num_rows : offsets[labels[index] + 1];
+  }
+  __device__ bool is_first(size_type index) const noexcept
+  {
+    return index == 0 or (labels != nullptr and labels[index] != labels[index - 1]);
+  }
+};
+
 // Functor to identify unique elements in a sorted order table/column
 template <bool has_nulls, typename ReturnType, typename Iterator>
 struct unique_comparator {
-  unique_comparator(table_device_view device_table, Iterator const sorted_order)
-    : comparator(device_table, device_table, true), permute(sorted_order)
+  unique_comparator(table_device_view device_table,
+                    Iterator const sorted_order,
+                    segment_finder segments)
+    : comparator(device_table, device_table, true), permute(sorted_order), segments(segments)
   {
   }
   __device__ ReturnType operator()(size_type index) const noexcept
   {
-    return index == 0 || not comparator(permute[index], permute[index - 1]);
+    return segments.is_first(index) || not comparator(permute[index], permute[index - 1]);
   };
 
  private:
   row_equality_comparator<has_nulls> comparator;
   Iterator const permute;
+  segment_finder segments;
+};
+
+// Functor returning the position from 1 of each row of a sorted column in its segment
+struct segment_position {
+  segment_finder segments;
+  __device__ size_type operator()(size_type index) const noexcept
+  {
+    return index - segments.begin(index) + 1;
+  }
 };
 
 // Assign rank from 1 to n unique values. Equal values get same rank value.
+// The ranks keep increasing across segments, so that they are unique keys of the equal values.
+template <typename SortedOrder>
 rmm::device_vector<size_type> sorted_dense_rank(column_view input_col,
-                                                column_view sorted_order_view,
+                                                SortedOrder sorted_order,
+                                                segment_finder segments,
                                                 cudaStream_t stream)
 {
   auto device_table     = table_device_view::create(table_view{{input_col}}, stream);
   auto const input_size = input_col.size();
   rmm::device_vector<size_type> dense_rank_sorted(input_size);
-  auto sorted_index_order = thrust::make_permutation_iterator(
-    sorted_order_view.begin<size_type>(), thrust::make_counting_iterator<size_type>(0));
   if (input_col.has_nulls()) {
-    auto conv = unique_comparator<true, size_type, decltype(sorted_index_order)>(
-      *device_table, sorted_index_order);
+    auto conv =
+      unique_comparator<true, size_type, SortedOrder>(*device_table, sorted_order, segments);
     auto unique_it =
       thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0), conv);
 
@@ -70,8 +109,8 @@ rmm::device_vector<size_type> sorted_dense_rank(column_view input_col,
                            unique_it + input_size,
                            dense_rank_sorted.data().get());
   } else {
-    auto conv = unique_comparator<false, size_type, decltype(sorted_index_order)>(
-      *device_table, sorted_index_order);
+    auto conv =
+      unique_comparator<false, size_type, SortedOrder>(*device_table, sorted_order, segments);
     auto unique_it =
       thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0), conv);
 
@@ -90,26 +129,27 @@ rmm::device_vector<size_type> sorted_dense_rank(column_view input_col,
  * @param dense_rank dense rank of sorted input column (acts as key for value
  * groups).
  * @param tie_iter  iterator of rank to break ties among equal value groups.
- * @param sorted_order_view sorted order indices of input column
+ * @param sorted_order sorted order indices of input column
  * @param rank_iter output rank iterator
  * @param tie_breaker tie breaking operator. For example, maximum & minimum.
  * @param transformer transform after tie breaking (useful for average).
  * @param stream CUDA stream used for device memory operations and kernel launches.
  */
 template <typename TieType,
+          typename SortedOrder,
           typename outputIterator,
           typename TieBreaker,
           typename Transformer,
           typename TieIterator>
 void tie_break_ranks_transform(rmm::device_vector<size_type> const &dense_rank_sorted,
                                TieIterator tie_iter,
-                               column_view const &sorted_order_view,
+                               SortedOrder sorted_order,
                                outputIterator rank_iter,
                                TieBreaker tie_breaker,
                                Transformer transformer,
                                cudaStream_t stream)
 {
-  auto const input_size = sorted_order_view.size();
+  auto const input_size = dense_rank_sorted.size();
   rmm::device_vector<TieType> tie_sorted(input_size, 0);
   // algorithm: reduce_by_key(dense_rank, 1, n, reduction_tie_breaker)
   // reduction_tie_breaker = min, max, min_count
@@ -129,75 +169,92 @@ void tie_break_ranks_transform(rmm::device_vector<size_type> const &dense_rank_s
   thrust::scatter(rmm::exec_policy(stream)->on(stream),
                   sorted_tied_rank,
                   sorted_tied_rank + input_size,
-                  sorted_order_view.begin<size_type>(),
+                  sorted_order,
                   rank_iter);
 }
 
-template <typename outputType>
-void rank_first(column_view sorted_order_view,
+template <typename outputType, typename SortedOrder>
+void rank_first(SortedOrder sorted_order,
+                segment_finder segments,
                 mutable_column_view rank_mutable_view,
                 cudaStream_t stream)
 {
   // stable sort order ranking (no ties)
+  auto positions = thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                                   segment_position{segments});
   thrust::scatter(rmm::exec_policy(stream)->on(stream),
-                  thrust::make_counting_iterator<size_type>(1),
-                  thrust::make_counting_iterator<size_type>(rank_mutable_view.size() + 1),
-                  sorted_order_view.begin<size_type>(),
+                  positions,
+                  positions + rank_mutable_view.size(),
+                  sorted_order,
                   rank_mutable_view.begin<outputType>());
 }
 
-template <typename outputType>
+template <typename outputType, typename SortedOrder>
 void rank_dense(rmm::device_vector<size_type> const &dense_rank_sorted,
-                column_view sorted_order_view,
+                SortedOrder sorted_order,
+                segment_finder segments,
                 mutable_column_view rank_mutable_view,
                 cudaStream_t stream)
 {
   // All equal values have same rank and rank always increases by 1 between groups
+  auto segment_dense_rank = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    [drs = dense_rank_sorted.data().get(), segments] __device__(size_type index) {
+      return drs[index] - drs[segments.begin(index)] + 1;
+    });
   thrust::scatter(rmm::exec_policy(stream)->on(stream),
-                  dense_rank_sorted.begin(),
-                  dense_rank_sorted.end(),
-                  sorted_order_view.begin<size_type>(),
+                  segment_dense_rank,
+                  segment_dense_rank + rank_mutable_view.size(),
+                  sorted_order,
                   rank_mutable_view.begin<outputType>());
 }
 
-template <typename outputType>
+template <typename outputType, typename SortedOrder>
 void rank_min(rmm::device_vector<size_type> const &group_keys,
-              column_view sorted_order_view,
+              SortedOrder sorted_order,
+              segment_finder segments,
               mutable_column_view rank_mutable_view,
               cudaStream_t stream)
 {
   // min of first in the group
   // All equal values have min of ranks among them.
   // algorithm: reduce_by_key(dense_rank, 1, n, min), scatter
-  tie_break_ranks_transform<size_type>(group_keys,
-                                       thrust::make_counting_iterator<size_type>(1),
-                                       sorted_order_view,
-                                       rank_mutable_view.begin<outputType>(),
-                                       thrust::minimum<size_type>{},
-                                       thrust::identity<outputType>{},
-                                       stream);
+  tie_break_ranks_transform<size_type>(
+    group_keys,
+    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                    segment_position{segments}),
+    sorted_order,
+    rank_mutable_view.begin<outputType>(),
+    thrust::minimum<size_type>{},
+    thrust::identity<outputType>{},
+    stream);
 }
 
-template <typename outputType>
+template <typename outputType, typename SortedOrder>
 void rank_max(rmm::device_vector<size_type> const &group_keys,
-              column_view sorted_order_view,
+              SortedOrder sorted_order,
+              segment_finder segments,
               mutable_column_view rank_mutable_view,
               cudaStream_t stream)
 {
   // max of first in the group
   // All equal values have max of ranks among them.
   // algorithm: reduce_by_key(dense_rank, 1, n, max), scatter
-  tie_break_ranks_transform<size_type>(group_keys,
-                                       thrust::make_counting_iterator<size_type>(1),
-                                       sorted_order_view,
-                                       rank_mutable_view.begin<outputType>(),
-                                       thrust::maximum<size_type>{},
-                                       thrust::identity<outputType>{},
-                                       stream);
+  tie_break_ranks_transform<size_type>(
+    group_keys,
+    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                    segment_position{segments}),
+    sorted_order,
+    rank_mutable_view.begin<outputType>(),
+    thrust::maximum<size_type>{},
+    thrust::identity<outputType>{},
+    stream);
 }
 
+template <typename SortedOrder>
 void rank_average(rmm::device_vector<size_type> const &group_keys,
-                  column_view sorted_order_view,
+                  SortedOrder sorted_order,
+                  segment_finder segments,
                   mutable_column_view rank_mutable_view,
                   cudaStream_t stream)
 {
@@ -207,12 +264,14 @@ void rank_average(rmm::device_vector<size_type> const &group_keys,
   // Calculate Min of ranks and Count of equal values
   // algorithm: reduce_by_key(dense_rank, 1, n, min_count)
   //            transform(min+(count-1)/2), scatter
-  using MinCount = thrust::tuple<size_type, size_type>;
+  using MinCount  = thrust::tuple<size_type, size_type>;
+  auto positions = thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                                   segment_position{segments});
   tie_break_ranks_transform<MinCount>(
     group_keys,
-    thrust::make_zip_iterator(thrust::make_tuple(thrust::make_counting_iterator<size_type>(1),
-                                                 thrust::make_constant_iterator<size_type>(1))),
-    sorted_order_view,
+    thrust::make_zip_iterator(
+      thrust::make_tuple(positions, thrust::make_constant_iterator<size_type>(1))),
+    sorted_order,
     rank_mutable_view.begin<double>(),
     [] __device__(auto rank_count1, auto rank_count2) {
       return MinCount{std::min(thrust::get<0>(rank_count1), thrust::get<0>(rank_count2)),
@@ -225,16 +284,21 @@ void rank_average(rmm::device_vector<size_type> const &group_keys,
     stream);
 }
 
-}  // anonymous namespace
-
-std::unique_ptr<column> rank(column_view const &input,
-                             rank_method method,
-                             order column_order,
-                             null_policy null_handling,
-                             null_order null_precedence,
-                             bool percentage,
-                             rmm::mr::device_memory_resource *mr,
-                             cudaStream_t stream = 0)
+/**
+ * @brief Ranks `input` given the indices of its rows in sorted order.
+ *
+ * The rows are ranked within the segments of `segments`; the rows of a segment must be
+ * contiguous in the sorted order, as they are when the input is already sorted in each segment.
+ */
+template <typename SortedOrder>
+std::unique_ptr<column> rank_sorted(column_view const &input,
+                                    SortedOrder sorted_order,
+                                    segment_finder segments,
+                                    rank_method method,
+                                    null_policy null_handling,
+                                    bool percentage,
+                                    rmm::mr::device_memory_resource *mr,
+                                    cudaStream_t stream)
 {
   data_type const output_type = (percentage or method == rank_method::AVERAGE)
                                   ? data_type(type_id::FLOAT64)
@@ -248,20 +312,14 @@ std::unique_ptr<column> rank(column_view const &input,
       return make_numeric_column(output_type, input.size(), mask_state::UNALLOCATED, stream, mr);
   }();
   auto rank_mutable_view = rank_column->mutable_view();
-
-  std::unique_ptr<column> sorted_order =
-    (method == rank_method::FIRST)
-      ? detail::stable_sorted_order(
-          table_view{{input}}, {column_order}, {null_precedence}, mr, stream)
-      : detail::sorted_order(table_view{{input}}, {column_order}, {null_precedence}, mr, stream);
-  column_view sorted_order_view = sorted_order->view();
+  if (input.is_empty()) { return rank_column; }
 
   // dense: All equal values have same rank and rank always increases by 1 between groups
   // acts as key for min, max, average to denote equal value groups
   rmm::device_vector<size_type> const dense_rank_sorted =
-    [&method, &input, &sorted_order_view, &stream] {
+    [&method, &input, &sorted_order, &segments, &stream] {
       if (method != rank_method::FIRST)
-        return sorted_dense_rank(input, sorted_order_view, stream);
+        return sorted_dense_rank(input, sorted_order, segments, stream);
       else
         return rmm::device_vector<size_type>();
     }();
@@ -269,38 +327,39 @@ std::unique_ptr<column> rank(column_view const &input,
   if (output_type.id() == type_id::FLOAT64) {
     switch (method) {
       case rank_method::FIRST:
-        rank_first<double>(sorted_order_view, rank_mutable_view, stream);
+        rank_first<double>(sorted_order, segments, rank_mutable_view, stream);
         break;
       case rank_method::DENSE:
-        rank_dense<double>(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
+        rank_dense<double>(dense_rank_sorted, sorted_order, segments, rank_mutable_view, stream);
         break;
       case rank_method::MIN:
-        rank_min<double>(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
+        rank_min<double>(dense_rank_sorted, sorted_order, segments, rank_mutable_view, stream);
         break;
       case rank_method::MAX:
-        rank_max<double>(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
+        rank_max<double>(dense_rank_sorted, sorted_order, segments, rank_mutable_view, stream);
         break;
       case rank_method::AVERAGE:
-        rank_average(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
+        rank_average(dense_rank_sorted, sorted_order, segments, rank_mutable_view, stream);
         break;
       default: CUDF_FAIL("Unexpected rank_method for rank()");
     }
   } else {
     switch (method) {
       case rank_method::FIRST:
-        rank_first<size_type>(sorted_order_view, rank_mutable_view, stream);
+        rank_first<size_type>(sorted_order, segments, rank_mutable_view, stream);
         break;
       case rank_method::DENSE:
-        rank_dense<size_type>(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
+        rank_dense<size_type>(
+          dense_rank_sorted, sorted_order, segments, rank_mutable_view, stream);
         break;
       case rank_method::MIN:
-        rank_min<size_type>(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
+        rank_min<size_type>(dense_rank_sorted, sorted_order, segments, rank_mutable_view, stream);
         break;
       case rank_method::MAX:
-        rank_max<size_type>(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
+        rank_max<size_type>(dense_rank_sorted, sorted_order, segments, rank_mutable_view, stream);
         break;
       case rank_method::AVERAGE:
-        rank_average(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
+        rank_average(dense_rank_sorted, sorted_order, segments, rank_mutable_view, stream);
         break;
       default: CUDF_FAIL("Unexpected rank_method for rank()");
     }
@@ -308,21 +367,130 @@ std::unique_ptr<column> rank(column_view const &input,
 
   // pct inplace transform
   if (percentage) {
-    auto rank_iter = rank_mutable_view.begin<double>();
-    size_type const count =
-      (null_handling == null_policy::EXCLUDE) ? input.size() - input.null_count() : input.size();
+    // The null rows preceding each row, to count the rows of its segment that are ranked
+    auto const exclude_nulls = null_handling == null_policy::EXCLUDE and input.has_nulls();
+    rmm::device_vector<size_type> null_prefix(exclude_nulls ? input.size() + 1 : 0, 0);
+    if (exclude_nulls) {
+      auto const device_input = column_device_view::create(input, stream);
+      thrust::transform_inclusive_scan(
+        rmm::exec_policy(stream)->on(stream),
+        thrust::make_counting_iterator<size_type>(0),
+        thrust::make_counting_iterator<size_type>(input.size()),
+        null_prefix.begin() + 1,
+        [d_input = *device_input] __device__(size_type index) -> size_type {
+          return d_input.is_null(index);
+        },
+        thrust::plus<size_type>{});
+    }
+
+    // The rows of a segment are only permuted within the segment, so that the segment of an
+    // output row is the segment of the same sorted row
+    auto rank_iter      = rank_mutable_view.begin<double>();
     auto drs            = dense_rank_sorted.data().get();
+    auto nulls          = null_prefix.data().get();
     bool const is_dense = (method == rank_method::DENSE);
     thrust::transform(rmm::exec_policy(stream)->on(stream),
                       rank_iter,
                       rank_iter + input.size(),
+                      thrust::make_counting_iterator<size_type>(0),
                       rank_iter,
-                      [is_dense, drs, count] __device__(double r) -> double {
-                        return is_dense ? r / drs[count - 1] : r / count;
+                      [is_dense, drs, nulls, segments] __device__(double r, size_type index) {
+                        auto const begin = segments.begin(index);
+                        auto const end   = segments.end(index);
+                        auto const count =
+                          (end - begin) - (nulls == nullptr ? 0 : nulls[end] - nulls[begin]);
+                        if (count == 0) { return r; }
+                        return is_dense ? r / (drs[begin + count - 1] - drs[begin] + 1)
+                                        : r / count;
                       });
   }
   return rank_column;
 }
+
+}  // anonymous namespace
+
+std::unique_ptr<column> rank(column_view const &input,
+                             rank_method method,
+                             order column_order,
+                             null_policy null_handling,
+                             null_order null_precedence,
+                             bool percentage,
+                             sorted is_sorted,
+                             rmm::mr::device_memory_resource *mr,
+                             cudaStream_t stream)
+{
+  auto const segments = segment_finder{nullptr, nullptr, input.size()};
+
+  // Already sorted: the sorted order is the identity, and no sort is needed
+  if (is_sorted == sorted::YES) {
+    return rank_sorted(input,
+                       thrust::make_counting_iterator<size_type>(0),
+                       segments,
+                       method,
+                       null_handling,
+                       percentage,
+                       mr,
+                       stream);
+  }
+
+  std::unique_ptr<column> sorted_order =
+    (method == rank_method::FIRST)
+      ? detail::stable_sorted_order(table_view{{input}},
+                                    {column_order},
+                                    {null_precedence},
+                                    rmm::mr::get_default_resource(),
+                                    stream)
+      : detail::sorted_order(table_view{{input}},
+                             {column_order},
+                             {null_precedence},
+                             rmm::mr::get_default_resource(),
+                             stream);
+  return rank_sorted(input,
+                     sorted_order->view().begin<size_type>(),
+                     segments,
+                     method,
+                     null_handling,
+                     percentage,
+                     mr,
+                     stream);
+}
+
+std::unique_ptr<column> segmented_rank(column_view const &input,
+                                       column_view const &segment_offsets,
+                                       rank_method method,
+                                       null_policy null_handling,
+                                       bool percentage,
+                                       rmm::mr::device_memory_resource *mr,
+                                       cudaStream_t stream)
+{
+  CUDF_EXPECTS(segment_offsets.type() == data_type(type_to_id<size_type>()),
+               "segment_offsets must be of type size_type");
+  CUDF_EXPECTS(not segment_offsets.has_nulls(), "segment_offsets must not contain nulls");
+
+  // The segment of each row, with an upper bound search since segments may be empty
+  rmm::device_vector<size_type> segment_labels(input.size());
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(input.size()),
+                    segment_labels.begin(),
+                    [offsets     = segment_offsets.begin<size_type>(),
+                     num_offsets = segment_offsets.size()] __device__(size_type row) {
+                      return static_cast<size_type>(
+                        thrust::upper_bound(thrust::seq, offsets, offsets + num_offsets, row) -
+                        offsets - 1);
+                    });
+
+  auto const segments = segment_finder{
+    segment_offsets.begin<size_type>(), segment_labels.data().get(), input.size()};
+  return rank_sorted(input,
+                     thrust::make_counting_iterator<size_type>(0),
+                     segments,
+                     method,
+                     null_handling,
+                     percentage,
+                     mr,
+                     stream);
+}
 }  // namespace detail
 
 std::unique_ptr<column> rank(column_view const &input,
@@ -333,6 +501,39 @@ std::unique_ptr<column> rank(column_view const &input,
                              bool percentage,
                              rmm::mr::device_memory_resource *mr)
 {
-  return detail::rank(input, method, column_order, null_handling, null_precedence, percentage, mr);
+  CUDF_FUNC_RANGE();
+  return detail::rank(input,
+                      method,
+                      column_order,
+                      null_handling,
+                      null_precedence,
+                      percentage,
+                      sorted::NO,
+                      mr);
+}
+
+std::unique_ptr<column> rank(column_view const &input,
+                             rank_method method,
+                             order column_order,
+                             null_policy null_handling,
+                             null_order null_precedence,
+                             bool percentage,
+                             sorted is_sorted,
+                             rmm::mr::device_memory_resource *mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::rank(
+    input, method, column_order, null_handling, null_precedence, percentage, is_sorted, mr);
+}
+
+std::unique_ptr<column> segmented_rank(column_view const &input,
+                                       column_view const &segment_offsets,
+                                       rank_method method,
+                                       null_policy null_handling,
+                                       bool percentage,
+                                       rmm::mr::device_memory_resource *mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::segmented_rank(input, segment_offsets, method, null_handling, percentage, mr);
 }
 }  // namespace cudf
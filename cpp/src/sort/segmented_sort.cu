@@ -0,0 +1,473 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sort_impl.cuh"
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+constexpr int RADIX_BITS    = 8;
+constexpr int RADIX_BUCKETS = 1 << RADIX_BITS;
+// Segments selected at once, which bounds the digit histograms to 64MB
+constexpr size_type SELECT_SEGMENTS_PER_BATCH = 1 << 16;
+
+void verify_segment_offsets(column_view const& segment_offsets)
+{
+  CUDF_EXPECTS(segment_offsets.type() == data_type(type_to_id<size_type>()),
+               "segment_offsets must be of type size_type");
+  CUDF_EXPECTS(not segment_offsets.has_nulls(), "segment_offsets must not contain nulls");
+}
+
+/**
+ * @brief Returns the index of the segment of each row
+ *
+ * Each non-empty segment marks its first row, and a running maximum spreads the marks to the
+ * other rows of the segment.
+ */
+rmm::device_vector<size_type> segment_labels(column_view const& segment_offsets,
+                                             size_type num_rows,
+                                             cudaStream_t stream)
+{
+  rmm::device_vector<size_type> labels(num_rows);
+  thrust::fill(rmm::exec_policy(stream)->on(stream), labels.begin(), labels.end(), 0);
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     std::max(segment_offsets.size() - 1, 0),
+                     [d_offsets = segment_offsets.data<size_type>(),
+                      d_labels  = labels.data().get()] __device__(size_type segment) {
+                       if (d_offsets[segment] < d_offsets[segment + 1]) {
+                         d_labels[d_offsets[segment]] = segment;
+                       }
+                     });
+  thrust::inclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         labels.begin(),
+                         labels.end(),
+                         labels.begin(),
+                         thrust::maximum<size_type>());
+  return labels;
+}
+
+/**
+ * @brief Counts the keys of each segment of a batch matching the prefix of their segment on the
+ * bits of `prefix_mask` by their digit at `shift`
+ *
+ * Segments whose rank is 0 are kept whole, and are not counted.
+ */
+__global__ void segmented_digit_histogram(uint64_t const* keys,
+                                          size_type const* labels,
+                                          size_type first_row,
+                                          size_type end_row,
+                                          size_type first_segment,
+                                          uint64_t const* prefixes,
+                                          size_type const* ranks,
+                                          uint64_t prefix_mask,
+                                          int shift,
+                                          size_type* histograms)
+{
+  for (size_type i = first_row + threadIdx.x + blockIdx.x * blockDim.x; i < end_row;
+       i += blockDim.x * gridDim.x) {
+    auto const segment = labels[i];
+    auto const key     = keys[i];
+    if (ranks[segment] != 0 and (key & prefix_mask) == prefixes[segment]) {
+      atomicAdd(&histograms[(segment - first_segment) * RADIX_BUCKETS +
+                            ((key >> shift) & (RADIX_BUCKETS - 1))],
+                1);
+    }
+  }
+}
+
+/**
+ * @brief Selects the row indices of the first `k` elements in sorted order of each segment
+ *
+ * Fixed-width columns without nulls are mapped to order-preserving 64-bit keys, ascending in the
+ * requested order, and the key of the `k`-th element of each segment larger than `k` is found by
+ * a radix selection of all those segments at once, one digit per pass. Only the selected rows are
+ * then sorted, on their segment and key. Other columns are sorted whole by segment and key, and
+ * the first `k` rows of each segment are kept.
+ */
+struct segmented_top_k_fn {
+  template <typename T, std::enable_if_t<is_radix_sortable<T>()>* = nullptr>
+  void operator()(column_view const& input,
+                  column_view const& segment_offsets,
+                  std::vector<size_type> const& h_segment_offsets,
+                  column_view const& top_k_offsets,
+                  size_type k,
+                  order column_order,
+                  null_order null_precedence,
+                  mutable_column_view& top_k_indices,
+                  cudaStream_t stream)
+  {
+    if (input.has_nulls()) {
+      sort_and_truncate(input,
+                        segment_offsets,
+                        top_k_offsets,
+                        column_order,
+                        null_precedence,
+                        top_k_indices,
+                        stream);
+      return;
+    }
+
+    size_type const num_segments = h_segment_offsets.size() - 1;
+    auto const labels            = segment_labels(segment_offsets, input.size(), stream);
+    auto const d_input           = column_device_view::create(input, stream);
+    rmm::device_vector<uint64_t> keys(input.size());
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(input.size()),
+                      keys.begin(),
+                      [d_input    = *d_input,
+                       descending = column_order == order::DESCENDING] __device__(size_type i) {
+                        auto const bits = ordered_bits(radix_sort_key<T>{}(d_input.element<T>(i)));
+                        return descending ? ~bits : bits;
+                      });
+
+    // The segments larger than `k` select the `k`-th key, and the others, of rank 0, keep all
+    // their rows
+    rmm::device_vector<uint64_t> prefixes(num_segments, 0);
+    rmm::device_vector<size_type> ranks(num_segments);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_segments),
+                      ranks.begin(),
+                      [d_offsets = segment_offsets.data<size_type>(), k] __device__(size_type s) {
+                        return d_offsets[s + 1] - d_offsets[s] > k ? k : 0;
+                      });
+
+    rmm::device_vector<size_type> histograms(
+      std::min(num_segments, SELECT_SEGMENTS_PER_BATCH) * RADIX_BUCKETS);
+    for (size_type first = 0; first < num_segments; first += SELECT_SEGMENTS_PER_BATCH) {
+      auto const last = std::min(first + SELECT_SEGMENTS_PER_BATCH, num_segments);
+      bool const any_selection = std::any_of(
+        thrust::make_counting_iterator(first), thrust::make_counting_iterator(last), [&](auto s) {
+          return h_segment_offsets[s + 1] - h_segment_offsets[s] > k;
+        });
+      if (not any_selection) { continue; }
+      auto const first_row = h_segment_offsets[first];
+      auto const end_row   = h_segment_offsets[last];
+      cudf::detail::grid_1d const grid{end_row - first_row, 256, 4};
+      uint64_t prefix_mask{0};
+      for (int shift = 64 - RADIX_BITS; shift >= 0; shift -= RADIX_BITS) {
+        thrust::fill(rmm::exec_policy(stream)->on(stream),
+                     histograms.begin(),
+                     histograms.begin() + (last - first) * RADIX_BUCKETS,
+                     0);
+        segmented_digit_histogram<<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
+          keys.data().get(),
+          labels.data().get(),
+          first_row,
+          end_row,
+          first,
+          prefixes.data().get(),
+          ranks.data().get(),
+          prefix_mask,
+          shift,
+          histograms.data().get());
+        // The selected key is in the bucket where the count of the smaller keys reaches the rank
+        thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                         thrust::make_counting_iterator<size_type>(first),
+                         thrust::make_counting_iterator<size_type>(last),
+                         [d_histograms = histograms.data().get(),
+                          d_prefixes   = prefixes.data().get(),
+                          d_ranks      = ranks.data().get(),
+                          first,
+                          shift] __device__(size_type s) {
+                           auto rank = d_ranks[s];
+                           if (rank == 0) { return; }
+                           auto const histogram = d_histograms + (s - first) * RADIX_BUCKETS;
+                           uint64_t digit       = 0;
+                           while (histogram[digit] < rank) { rank -= histogram[digit++]; }
+                           d_prefixes[s] |= digit << shift;
+                           d_ranks[s] = rank;
+                         });
+        prefix_mask |= static_cast<uint64_t>(RADIX_BUCKETS - 1) << shift;
+      }
+    }
+
+    // Rank of each key among the keys of its segment equal to the selected key, to select the
+    // first ones, as many as the remaining rank of the segment
+    rmm::device_vector<size_type> tie_ranks(input.size());
+    auto const is_tie = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0),
+      [d_keys     = keys.data().get(),
+       d_labels   = labels.data().get(),
+       d_prefixes = prefixes.data().get()] __device__(size_type i) {
+        return d_keys[i] == d_prefixes[d_labels[i]] ? 1 : 0;
+      });
+    thrust::exclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                  labels.begin(),
+                                  labels.end(),
+                                  is_tie,
+                                  tie_ranks.begin());
+
+    rmm::device_vector<size_type> selected_labels(top_k_indices.size());
+    rmm::device_vector<uint64_t> selected_keys(top_k_indices.size());
+    thrust::copy_if(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_zip_iterator(thrust::make_tuple(
+        labels.begin(), keys.begin(), thrust::make_counting_iterator<size_type>(0))),
+      thrust::make_zip_iterator(thrust::make_tuple(
+        labels.end(), keys.end(), thrust::make_counting_iterator<size_type>(input.size()))),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_zip_iterator(thrust::make_tuple(
+        selected_labels.begin(), selected_keys.begin(), top_k_indices.begin<size_type>())),
+      [d_keys      = keys.data().get(),
+       d_labels    = labels.data().get(),
+       d_prefixes  = prefixes.data().get(),
+       d_ranks     = ranks.data().get(),
+       d_tie_ranks = tie_ranks.data().get()] __device__(size_type i) {
+        auto const segment   = d_labels[i];
+        auto const threshold = d_prefixes[segment];
+        return d_ranks[segment] == 0 or d_keys[i] < threshold or
+               (d_keys[i] == threshold and d_tie_ranks[i] < d_ranks[segment]);
+      });
+
+    // The selected rows are in row order, so a stable sort keeps the ties in row order
+    thrust::stable_sort_by_key(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_zip_iterator(thrust::make_tuple(selected_labels.begin(), selected_keys.begin())),
+      thrust::make_zip_iterator(thrust::make_tuple(selected_labels.end(), selected_keys.end())),
+      top_k_indices.begin<size_type>());
+  }
+
+  template <typename T, std::enable_if_t<not is_radix_sortable<T>()>* = nullptr>
+  void operator()(column_view const& input,
+                  column_view const& segment_offsets,
+                  std::vector<size_type> const&,
+                  column_view const& top_k_offsets,
+                  size_type,
+                  order column_order,
+                  null_order null_precedence,
+                  mutable_column_view& top_k_indices,
+                  cudaStream_t stream)
+  {
+    sort_and_truncate(
+      input, segment_offsets, top_k_offsets, column_order, null_precedence, top_k_indices, stream);
+  }
+
+  /**
+   * @brief Sorts each segment and keeps the rows up to the size of its range of `top_k_offsets`
+   */
+  static void sort_and_truncate(column_view const& input,
+                                column_view const& segment_offsets,
+                                column_view const& top_k_offsets,
+                                order column_order,
+                                null_order null_precedence,
+                                mutable_column_view& top_k_indices,
+                                cudaStream_t stream)
+  {
+    auto const sorted_indices = detail::segmented_sorted_order(table_view{{input}},
+                                                               segment_offsets,
+                                                               {column_order},
+                                                               {null_precedence},
+                                                               rmm::mr::get_default_resource(),
+                                                               stream);
+    size_type const num_segments = top_k_offsets.size() - 1;
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(top_k_indices.size()),
+                      top_k_indices.begin<size_type>(),
+                      [d_top_k_offsets = top_k_offsets.data<size_type>(),
+                       d_offsets       = segment_offsets.data<size_type>(),
+                       num_segments,
+                       d_sorted_indices = sorted_indices->view().data<size_type>()] __device__(
+                        size_type i) {
+                        auto const segment =
+                          thrust::upper_bound(
+                            thrust::seq, d_top_k_offsets, d_top_k_offsets + num_segments + 1, i) -
+                          d_top_k_offsets - 1;
+                        return d_sorted_indices[d_offsets[segment] + i - d_top_k_offsets[segment]];
+                      });
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> segmented_sorted_order(table_view const& keys,
+                                               column_view const& segment_offsets,
+                                               std::vector<order> const& column_order,
+                                               std::vector<null_order> const& null_precedence,
+                                               rmm::mr::device_memory_resource* mr,
+                                               cudaStream_t stream)
+{
+  verify_segment_offsets(segment_offsets);
+  if (keys.num_rows() == 0 or segment_offsets.size() <= 2) {
+    return detail::stable_sorted_order(keys, column_order, null_precedence, mr, stream);
+  }
+
+  // A single sort on the segment of each row, then on the keys, keeps the segments in place
+  auto const labels = segment_labels(segment_offsets, keys.num_rows(), stream);
+  std::vector<column_view> columns{column_view(
+    data_type(type_to_id<size_type>()), keys.num_rows(), labels.data().get())};
+  columns.insert(columns.end(), keys.begin(), keys.end());
+  std::vector<order> orders{order::ASCENDING};
+  if (column_order.empty()) {
+    orders.resize(columns.size(), order::ASCENDING);
+  } else {
+    orders.insert(orders.end(), column_order.begin(), column_order.end());
+  }
+  std::vector<null_order> null_orders;
+  if (not null_precedence.empty()) {
+    null_orders.push_back(null_order::BEFORE);
+    null_orders.insert(null_orders.end(), null_precedence.begin(), null_precedence.end());
+  }
+  return detail::stable_sorted_order(table_view{columns}, orders, null_orders, mr, stream);
+}
+
+std::unique_ptr<table> segmented_sort_by_key(table_view const& values,
+                                             table_view const& keys,
+                                             column_view const& segment_offsets,
+                                             std::vector<order> const& column_order,
+                                             std::vector<null_order> const& null_precedence,
+                                             rmm::mr::device_memory_resource* mr,
+                                             cudaStream_t stream)
+{
+  CUDF_EXPECTS(values.num_rows() == keys.num_rows(),
+               "Mismatch in number of rows for values and keys");
+
+  auto const sorted_order = detail::segmented_sorted_order(
+    keys, segment_offsets, column_order, null_precedence, rmm::mr::get_default_resource(), stream);
+
+  return detail::gather(values,
+                        sorted_order->view(),
+                        detail::out_of_bounds_policy::NULLIFY,
+                        detail::negative_index_policy::NOT_ALLOWED,
+                        mr,
+                        stream);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> segmented_top_k_order(
+  column_view const& input,
+  column_view const& segment_offsets,
+  size_type k,
+  order column_order,
+  null_order null_precedence,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_EXPECTS(k >= 0, "k must not be negative");
+  verify_segment_offsets(segment_offsets);
+
+  // Each segment keeps its first `k` sorted rows
+  std::vector<size_type> h_segment_offsets(segment_offsets.size());
+  CUDA_TRY(cudaMemcpyAsync(h_segment_offsets.data(),
+                           segment_offsets.data<size_type>(),
+                           segment_offsets.size() * sizeof(size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  size_type const num_segments = std::max(segment_offsets.size() - 1, 0);
+  std::vector<size_type> h_top_k_offsets(num_segments + 1, 0);
+  for (size_type s = 0; s < num_segments; ++s) {
+    h_top_k_offsets[s + 1] =
+      h_top_k_offsets[s] + std::min(k, h_segment_offsets[s + 1] - h_segment_offsets[s]);
+  }
+  auto top_k_offsets = make_numeric_column(
+    data_type(type_to_id<size_type>()), num_segments + 1, mask_state::UNALLOCATED, stream, mr);
+  CUDA_TRY(cudaMemcpyAsync(top_k_offsets->mutable_view().data<size_type>(),
+                           h_top_k_offsets.data(),
+                           h_top_k_offsets.size() * sizeof(size_type),
+                           cudaMemcpyHostToDevice,
+                           stream));
+
+  auto const num_selected = h_top_k_offsets.back();
+  auto top_k_indices      = make_numeric_column(
+    data_type(type_to_id<size_type>()), num_selected, mask_state::UNALLOCATED, stream, mr);
+  if (num_selected > 0) {
+    auto indices_view = top_k_indices->mutable_view();
+    type_dispatcher(input.type(),
+                    segmented_top_k_fn{},
+                    input,
+                    segment_offsets,
+                    h_segment_offsets,
+                    top_k_offsets->view(),
+                    k,
+                    column_order,
+                    null_precedence,
+                    indices_view,
+                    stream);
+  }
+
+  return std::make_pair(std::move(top_k_indices), std::move(top_k_offsets));
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> segmented_sorted_order(table_view const& keys,
+                                               column_view const& segment_offsets,
+                                               std::vector<order> const& column_order,
+                                               std::vector<null_order> const& null_precedence,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::segmented_sorted_order(keys, segment_offsets, column_order, null_precedence, mr);
+}
+
+std::unique_ptr<table> segmented_sort_by_key(table_view const& values,
+                                             table_view const& keys,
+                                             column_view const& segment_offsets,
+                                             std::vector<order> const& column_order,
+                                             std::vector<null_order> const& null_precedence,
+                                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::segmented_sort_by_key(
+    values, keys, segment_offsets, column_order, null_precedence, mr);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> segmented_top_k_order(
+  column_view const& input,
+  column_view const& segment_offsets,
+  size_type k,
+  order column_order,
+  null_order null_precedence,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::segmented_top_k_order(
+    input, segment_offsets, k, column_order, null_precedence, mr);
+}
+
+}  // namespace cudf
@@ -20,8 +20,11 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 
+#include <numeric>
+
 namespace cudf {
 namespace detail {
 std::unique_ptr<column> sorted_order(table_view input,
@@ -58,10 +61,11 @@ std::unique_ptr<table> sort_by_key(table_view const& values,
 std::unique_ptr<column> sorted_order(table_view input,
                                      std::vector<order> const& column_order,
                                      std::vector<null_order> const& null_precedence,
-                                     rmm::mr::device_memory_resource* mr)
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  return detail::sorted_order(input, column_order, null_precedence, mr);
+  return detail::sorted_order(input, column_order, null_precedence, mr, stream);
 }
 
 std::unique_ptr<table> sort(table_view input,
@@ -70,7 +74,15 @@ std::unique_ptr<table> sort(table_view input,
                             rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::sort_by_key(input, input, column_order, null_precedence, mr);
+  auto sorted = detail::sort_by_key(input, input, column_order, null_precedence, mr);
+
+  std::vector<size_type> key_columns(input.num_columns());
+  std::iota(key_columns.begin(), key_columns.end(), 0);
+  sorted->set_sort_order(
+    key_columns,
+    column_order.empty() ? std::vector<order>(input.num_columns(), order::ASCENDING) : column_order,
+    null_precedence);
+  return sorted;
 }
 
 std::unique_ptr<table> sort_by_key(table_view const& values,
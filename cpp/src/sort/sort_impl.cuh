@@ -16,17 +16,417 @@
 
 #pragma once
 
+#include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/gather.hpp>
+#include <cudf/detail/utilities/prefetch.hpp>
+#include <cudf/detail/utilities/scratch_allocator.cuh>
+#include <cudf/strings/string_view.cuh>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/thrust_rmm_allocator.h>
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/partition.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
 #include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <limits>
+#include <type_traits>
 
 namespace cudf {
 namespace detail {
+/**
+ * @brief Maps an element to a key that `thrust` sorts with a radix sort in the same order as
+ * `element_relational_comparator`
+ *
+ * Floating point -0.0 is mapped to +0.0 and every NaN to the same positive NaN, which the radix
+ * sort places after +Inf, so that they are equivalent and ordered as by the comparator.
+ */
+template <typename T, typename Enable = void>
+struct radix_sort_key {
+  using type = void;
+};
+
+template <typename T>
+struct radix_sort_key<T, std::enable_if_t<std::is_integral<T>::value and not is_boolean<T>()>> {
+  using type = T;
+  __device__ type operator()(T element) const { return element; }
+};
+
+template <typename T>
+struct radix_sort_key<T, std::enable_if_t<is_boolean<T>()>> {
+  using type = uint8_t;
+  __device__ type operator()(T element) const { return static_cast<type>(element); }
+};
+
+template <typename T>
+struct radix_sort_key<T, std::enable_if_t<std::is_floating_point<T>::value>> {
+  using type = T;
+  __device__ type operator()(T element) const
+  {
+    if (isnan(element)) { return std::numeric_limits<T>::quiet_NaN(); }
+    return element == T{0} ? T{0} : element;
+  }
+};
+
+template <typename T>
+struct radix_sort_key<T, std::enable_if_t<is_timestamp<T>()>> {
+  using type = typename T::rep;
+  __device__ type operator()(T element) const { return element.time_since_epoch().count(); }
+};
+
+template <typename T>
+struct radix_sort_key<T, std::enable_if_t<is_duration<T>()>> {
+  using type = typename T::rep;
+  __device__ type operator()(T element) const { return element.count(); }
+};
+
+template <typename T>
+constexpr bool is_radix_sortable()
+{
+  return not std::is_void<typename radix_sort_key<T>::type>::value;
+}
+
+struct is_radix_sortable_fn {
+  template <typename T>
+  constexpr bool operator()() const
+  {
+    return is_radix_sortable<T>();
+  }
+};
+
+/**
+ * @brief Sorts the row indices `[indices, indices + input.size())` of a single fixed-width column
+ * with a radix sort on the values
+ *
+ * Null rows are first moved to the beginning or the end of the indices by a stable partition; the
+ * remaining rows are then sorted by a stable radix sort of their keys.
+ */
+struct column_radix_sort_fn {
+  template <typename T, std::enable_if_t<is_radix_sortable<T>()>* = nullptr>
+  void operator()(column_view const& input,
+                  size_type* indices,
+                  order column_order,
+                  null_order null_precedence,
+                  cudaStream_t stream)
+  {
+    using Key = typename radix_sort_key<T>::type;
+
+    auto valid_begin = indices;
+    auto num_valid   = input.size();
+    if (input.has_nulls()) {
+      // Nulls compare less than any value with null_order::BEFORE, so they go first when sorting
+      // in ascending order
+      bool const nulls_first =
+        (null_precedence == null_order::BEFORE) == (column_order == order::ASCENDING);
+      auto const d_input = column_device_view::create(input, stream);
+      auto const partition_point =
+        thrust::stable_partition(scratch_policy(stream)->on(stream),
+                                 indices,
+                                 indices + input.size(),
+                                 [nulls_first, d_input = *d_input] __device__(size_type i) {
+                                   return d_input.is_null_nocheck(i) == nulls_first;
+                                 });
+      num_valid   = input.size() - input.null_count();
+      valid_begin = nulls_first ? partition_point : indices;
+    }
+
+    scratch_vector<Key> keys(num_valid);
+    thrust::transform(scratch_policy(stream)->on(stream),
+                      valid_begin,
+                      valid_begin + num_valid,
+                      keys.begin(),
+                      [data = input.data<T>()] __device__(size_type i) {
+                        return radix_sort_key<T>{}(data[i]);
+                      });
+
+    if (column_order == order::ASCENDING) {
+      thrust::stable_sort_by_key(scratch_policy(stream)->on(stream),
+                                 keys.begin(),
+                                 keys.end(),
+                                 valid_begin,
+                                 thrust::less<Key>());
+    } else {
+      thrust::stable_sort_by_key(scratch_policy(stream)->on(stream),
+                                 keys.begin(),
+                                 keys.end(),
+                                 valid_begin,
+                                 thrust::greater<Key>());
+    }
+  }
+
+  template <typename T, std::enable_if_t<not is_radix_sortable<T>()>* = nullptr>
+  void operator()(column_view const&, size_type*, order, null_order, cudaStream_t)
+  {
+    CUDF_FAIL("Type does not support radix sort");
+  }
+};
+
+/**
+ * @brief Maps a radix sort key to unsigned bits whose unsigned order is the order of the key
+ */
+template <typename Key>
+__device__ std::enable_if_t<std::is_unsigned<Key>::value, uint64_t> ordered_bits(Key key)
+{
+  return static_cast<uint64_t>(key);
+}
+
+template <typename Key>
+__device__ std::enable_if_t<std::is_signed<Key>::value and std::is_integral<Key>::value, uint64_t>
+ordered_bits(Key key)
+{
+  // Flipping the sign bit orders negative values before positive ones
+  using Unsigned = std::make_unsigned_t<Key>;
+  return static_cast<uint64_t>(static_cast<Unsigned>(key) ^
+                               (Unsigned{1} << (sizeof(Key) * 8 - 1)));
+}
+
+template <typename Key>
+__device__ std::enable_if_t<std::is_floating_point<Key>::value, uint64_t> ordered_bits(Key key)
+{
+  // Negative values have the sign bit set and compare in reverse order of their magnitude
+  using Unsigned      = std::conditional_t<sizeof(Key) == 4, uint32_t, uint64_t>;
+  Unsigned const bits = *reinterpret_cast<Unsigned const*>(&key);
+  Unsigned const sign = Unsigned{1} << (sizeof(Key) * 8 - 1);
+  return static_cast<uint64_t>((bits & sign) ? ~bits : (bits | sign));
+}
+
+/**
+ * @brief Returns the number of bits of the packed key of an element of type `T`, or 0 if `T`
+ * cannot be packed
+ */
+struct packed_key_width_fn {
+  template <typename T>
+  std::enable_if_t<is_radix_sortable<T>(), int> operator()() const
+  {
+    return is_boolean<T>() ? 1 : sizeof(typename radix_sort_key<T>::type) * 8;
+  }
+
+  template <typename T>
+  std::enable_if_t<not is_radix_sortable<T>(), int> operator()() const
+  {
+    return 0;
+  }
+};
+
+/**
+ * @brief Returns the number of bits of the packed keys of the rows of `input`, or 0 if they cannot
+ * be packed in 64 bits
+ *
+ * Each column contributes the width of its values, plus one bit to order the nulls if it has any.
+ */
+inline int packed_key_width(table_view const& input)
+{
+  int width = 0;
+  for (auto const& column : input) {
+    auto const column_width = cudf::type_dispatcher(column.type(), packed_key_width_fn{});
+    if (column_width == 0) { return 0; }
+    width += column_width + (column.has_nulls() ? 1 : 0);
+  }
+  return width <= 64 ? width : 0;
+}
+
+/**
+ * @brief Appends the bits of a column to the packed keys of the rows
+ *
+ * The packed key of a row is shifted left to make room for the column, whose bits are then set to
+ * an unsigned value preserving the order of the column: the null bit, if the column has nulls,
+ * followed by the value bits, inverted for a descending order. Null rows have the same value bits.
+ */
+struct append_packed_key_fn {
+  template <typename T, std::enable_if_t<is_radix_sortable<T>()>* = nullptr>
+  void operator()(column_view const& input,
+                  uint64_t* keys,
+                  order column_order,
+                  null_order null_precedence,
+                  cudaStream_t stream)
+  {
+    int const value_width = packed_key_width_fn{}.template operator()<T>();
+    bool const has_nulls  = input.has_nulls();
+    int const width       = value_width + (has_nulls ? 1 : 0);
+    uint64_t const value_mask =
+      value_width == 64 ? ~uint64_t{0} : ((uint64_t{1} << value_width) - 1);
+    bool const descending = column_order == order::DESCENDING;
+    // Nulls compare less than any value with null_order::BEFORE, so they go first when sorting
+    // in ascending order
+    bool const nulls_first =
+      (null_precedence == null_order::BEFORE) == (column_order == order::ASCENDING);
+
+    auto const d_input = column_device_view::create(input, stream);
+    thrust::for_each_n(
+      scratch_policy(stream)->on(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      input.size(),
+      [keys, d_input = *d_input, width, value_mask, descending, has_nulls, nulls_first] __device__(
+        size_type i) {
+        auto key = width == 64 ? uint64_t{0} : keys[i] << width;
+        if (has_nulls and d_input.is_null_nocheck(i)) {
+          keys[i] = key | (nulls_first ? uint64_t{0} : (value_mask + 1));
+          return;
+        }
+        auto value = ordered_bits(radix_sort_key<T>{}(d_input.element<T>(i))) & value_mask;
+        if (descending) { value = ~value & value_mask; }
+        if (has_nulls and nulls_first) { value |= value_mask + 1; }
+        keys[i] = key | value;
+      });
+  }
+
+  template <typename T, std::enable_if_t<not is_radix_sortable<T>()>* = nullptr>
+  void operator()(column_view const&, uint64_t*, order, null_order, cudaStream_t)
+  {
+    CUDF_FAIL("Type does not support packed keys");
+  }
+};
+
+/**
+ * @brief Returns the first 8 bytes of a string as a big-endian integer, padded with zero bytes
+ *
+ * Strings whose prefixes differ compare as their prefixes do, `string_view::compare` comparing the
+ * bytes as unsigned values.
+ */
+__device__ inline uint64_t string_prefix_key(string_view const& str)
+{
+  auto const bytes = reinterpret_cast<unsigned char const*>(str.data());
+  uint64_t key     = 0;
+  for (size_type i = 0; i < 8; ++i) { key = (key << 8) | (i < str.size_bytes() ? bytes[i] : 0); }
+  return key;
+}
+
+/**
+ * @brief Sorts the row indices `[indices, indices + input.size())` of a strings column with a
+ * radix sort on the first 8 bytes of the strings, the rows with equal prefixes being then sorted by
+ * comparing their strings
+ *
+ * Null rows are first moved to the beginning or the end of the indices as by
+ * `column_radix_sort_fn`. After the radix sort, the rows with the same prefix are consecutive. A
+ * run of them is already sorted if its strings have the same size of at most 8 bytes, since they
+ * are then equal. Only the rows of the other runs are sorted again, by a comparison sort of their
+ * run and string, and put back in place. Both sorts are stable.
+ */
+inline void strings_prefix_sort(column_view const& input,
+                                size_type* indices,
+                                order column_order,
+                                null_order null_precedence,
+                                cudaStream_t stream)
+{
+  auto const d_input   = column_device_view::create(input, stream);
+  auto const d_strings = *d_input;
+
+  auto valid_begin = indices;
+  auto num_valid   = input.size();
+  if (input.has_nulls()) {
+    bool const nulls_first =
+      (null_precedence == null_order::BEFORE) == (column_order == order::ASCENDING);
+    auto const partition_point =
+      thrust::stable_partition(scratch_policy(stream)->on(stream),
+                               indices,
+                               indices + input.size(),
+                               [nulls_first, d_strings] __device__(size_type i) {
+                                 return d_strings.is_null_nocheck(i) == nulls_first;
+                               });
+    num_valid   = input.size() - input.null_count();
+    valid_begin = nulls_first ? partition_point : indices;
+  }
+  if (num_valid < 2) { return; }
+
+  bool const descending = column_order == order::DESCENDING;
+  scratch_vector<uint64_t> keys(num_valid);
+  thrust::transform(scratch_policy(stream)->on(stream),
+                    valid_begin,
+                    valid_begin + num_valid,
+                    keys.begin(),
+                    [d_strings, descending] __device__(size_type i) {
+                      auto const key = string_prefix_key(d_strings.element<string_view>(i));
+                      return descending ? ~key : key;
+                    });
+  thrust::stable_sort_by_key(
+    scratch_policy(stream)->on(stream), keys.begin(), keys.end(), valid_begin);
+
+  // Number the runs of equal prefixes and flag those whose strings may differ
+  auto const d_keys = keys.data().get();
+  scratch_vector<size_type> runs(num_valid);
+  thrust::transform_inclusive_scan(
+    scratch_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_valid),
+    runs.begin(),
+    [d_keys] __device__(size_type i) { return (i > 0 and d_keys[i] != d_keys[i - 1]) ? 1 : 0; },
+    thrust::plus<size_type>());
+  auto const d_runs = runs.data().get();
+  scratch_vector<bool> unsorted_runs(num_valid, false);
+  auto const d_unsorted_runs = unsorted_runs.data().get();
+  thrust::for_each_n(scratch_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(1),
+                     num_valid - 1,
+                     [d_strings, d_keys, d_runs, d_unsorted_runs, valid_begin] __device__(
+                       size_type i) {
+                       if (d_keys[i] != d_keys[i - 1]) { return; }
+                       auto const lhs = d_strings.element<string_view>(valid_begin[i - 1]);
+                       auto const rhs = d_strings.element<string_view>(valid_begin[i]);
+                       if (lhs.size_bytes() != rhs.size_bytes() or rhs.size_bytes() > 8) {
+                         d_unsorted_runs[d_runs[i]] = true;
+                       }
+                     });
+
+  scratch_vector<size_type> positions(num_valid);
+  auto const positions_end =
+    thrust::copy_if(scratch_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_valid),
+                    positions.begin(),
+                    [d_runs, d_unsorted_runs] __device__(size_type i) {
+                      return d_unsorted_runs[d_runs[i]];
+                    });
+  auto const num_unsorted = static_cast<size_type>(positions_end - positions.begin());
+  if (num_unsorted == 0) { return; }
+
+  scratch_vector<size_type> unsorted_run(num_unsorted);
+  scratch_vector<size_type> unsorted_indices(num_unsorted);
+  thrust::gather(scratch_policy(stream)->on(stream),
+                 positions.begin(),
+                 positions_end,
+                 runs.begin(),
+                 unsorted_run.begin());
+  thrust::gather(scratch_policy(stream)->on(stream),
+                 positions.begin(),
+                 positions_end,
+                 valid_begin,
+                 unsorted_indices.begin());
+  auto const rows =
+    thrust::make_zip_iterator(thrust::make_tuple(unsorted_run.begin(), unsorted_indices.begin()));
+  thrust::stable_sort(
+    scratch_policy(stream)->on(stream),
+    rows,
+    rows + num_unsorted,
+    [d_strings, descending] __device__(thrust::tuple<size_type, size_type> const& lhs,
+                                       thrust::tuple<size_type, size_type> const& rhs) {
+      if (thrust::get<0>(lhs) != thrust::get<0>(rhs)) {
+        return thrust::get<0>(lhs) < thrust::get<0>(rhs);
+      }
+      auto const cmp = d_strings.element<string_view>(thrust::get<1>(lhs))
+                         .compare(d_strings.element<string_view>(thrust::get<1>(rhs)));
+      return descending ? cmp > 0 : cmp < 0;
+    });
+  thrust::scatter(scratch_policy(stream)->on(stream),
+                  unsorted_indices.begin(),
+                  unsorted_indices.end(),
+                  positions.begin(),
+                  valid_begin);
+}
+
 // Create permuted row indices that would materialize sorted order
 template <bool stable = false>
 std::unique_ptr<column> sorted_order(table_view input,
@@ -54,46 +454,86 @@ std::unique_ptr<column> sorted_order(table_view input,
 
   mutable_column_view mutable_indices_view = sorted_indices->mutable_view();
 
-  auto device_table = table_device_view::create(input, stream);
+  // The sorts below read the keys in several passes, migrate them once if they are managed memory
+  prefetch(input, stream);
+  prefetch(mutable_indices_view, stream);
 
-  thrust::sequence(rmm::exec_policy(stream)->on(stream),
+  thrust::sequence(scratch_policy(stream)->on(stream),
                    mutable_indices_view.begin<size_type>(),
                    mutable_indices_view.end<size_type>(),
                    0);
 
-  rmm::device_vector<order> d_column_order(column_order);
-
-  if (has_nulls(input)) {
-    rmm::device_vector<null_order> d_null_precedence(null_precedence);
-    auto comparator = row_lexicographic_comparator<true>(
-      *device_table, *device_table, d_column_order.data().get(), d_null_precedence.data().get());
-    if (stable) {
-      thrust::stable_sort(rmm::exec_policy(stream)->on(stream),
-                          mutable_indices_view.begin<size_type>(),
-                          mutable_indices_view.end<size_type>(),
-                          comparator);
-    } else {
-      thrust::sort(rmm::exec_policy(stream)->on(stream),
-                   mutable_indices_view.begin<size_type>(),
-                   mutable_indices_view.end<size_type>(),
-                   comparator);
-    }
-  } else {
-    auto comparator = row_lexicographic_comparator<false>(
-      *device_table, *device_table, d_column_order.data().get());
-    if (stable) {
-      thrust::stable_sort(rmm::exec_policy(stream)->on(stream),
-                          mutable_indices_view.begin<size_type>(),
-                          mutable_indices_view.end<size_type>(),
-                          comparator);
-    } else {
-      thrust::sort(rmm::exec_policy(stream)->on(stream),
-                   mutable_indices_view.begin<size_type>(),
-                   mutable_indices_view.end<size_type>(),
-                   comparator);
+  // A single fixed-width column is sorted faster by a radix sort of its values than by a
+  // comparison sort of the row indices. The radix sort is stable, so it serves both cases.
+  if (input.num_columns() == 1 and
+      cudf::type_dispatcher(input.column(0).type(), is_radix_sortable_fn{})) {
+    cudf::type_dispatcher(input.column(0).type(),
+                          column_radix_sort_fn{},
+                          input.column(0),
+                          mutable_indices_view.data<size_type>(),
+                          column_order.empty() ? order::ASCENDING : column_order.front(),
+                          null_precedence.empty() ? null_order::BEFORE : null_precedence.front(),
+                          stream);
+    return sorted_indices;
+  }
+
+  // A single strings column is sorted by a radix sort of the prefixes of the strings, leaving
+  // only the rows with equal prefixes to a comparison sort
+  if (input.num_columns() == 1 and input.column(0).type().id() == type_id::STRING) {
+    strings_prefix_sort(input.column(0),
+                        mutable_indices_view.data<size_type>(),
+                        column_order.empty() ? order::ASCENDING : column_order.front(),
+                        null_precedence.empty() ? null_order::BEFORE : null_precedence.front(),
+                        stream);
+    return sorted_indices;
+  }
+
+  // Several fixed-width columns whose values fit together in 64 bits are sorted by a single radix
+  // sort of order-preserving keys packing the values of each row
+  if (input.num_columns() > 1 and packed_key_width(input) > 0) {
+    scratch_vector<uint64_t> keys(input.num_rows(), 0);
+    for (size_type i = 0; i < input.num_columns(); ++i) {
+      cudf::type_dispatcher(input.column(i).type(),
+                            append_packed_key_fn{},
+                            input.column(i),
+                            keys.data().get(),
+                            column_order.empty() ? order::ASCENDING : column_order[i],
+                            null_precedence.empty() ? null_order::BEFORE : null_precedence[i],
+                            stream);
     }
+    thrust::stable_sort_by_key(scratch_policy(stream)->on(stream),
+                               keys.begin(),
+                               keys.end(),
+                               mutable_indices_view.begin<size_type>());
+    return sorted_indices;
   }
 
+  auto device_table = table_device_view::create(input, stream);
+
+  scratch_vector<order> d_column_order(column_order);
+  scratch_vector<null_order> d_null_precedence(null_precedence);
+
+  dispatch_row_lexicographic_comparator(
+    input,
+    input,
+    *device_table,
+    *device_table,
+    d_column_order.data().get(),
+    d_null_precedence.data().get(),
+    [&](auto const& comparator) {
+      if (stable) {
+        thrust::stable_sort(scratch_policy(stream)->on(stream),
+                            mutable_indices_view.begin<size_type>(),
+                            mutable_indices_view.end<size_type>(),
+                            comparator);
+      } else {
+        thrust::sort(scratch_policy(stream)->on(stream),
+                     mutable_indices_view.begin<size_type>(),
+                     mutable_indices_view.end<size_type>(),
+                     comparator);
+      }
+    });
+
   return sorted_indices;
 }
 
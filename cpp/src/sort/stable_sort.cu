@@ -17,6 +17,7 @@
 #include "sort_impl.cuh"
 
 #include <cudf/column/column.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/table/table_view.hpp>
@@ -37,9 +38,11 @@ std::unique_ptr<column> stable_sorted_order(table_view input,
 std::unique_ptr<column> stable_sorted_order(table_view input,
                                             std::vector<order> const& column_order,
                                             std::vector<null_order> const& null_precedence,
-                                            rmm::mr::device_memory_resource* mr)
+                                            rmm::mr::device_memory_resource* mr,
+                                            cudaStream_t stream)
 {
-  return detail::stable_sorted_order(input, column_order, null_precedence, mr);
+  CUDF_FUNC_RANGE();
+  return detail::stable_sorted_order(input, column_order, null_precedence, mr, stream);
 }
 
 }  // namespace cudf
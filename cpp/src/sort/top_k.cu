@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sort_impl.cuh"
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/sorting.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+constexpr int RADIX_BITS        = 8;
+constexpr int RADIX_BUCKETS     = 1 << RADIX_BITS;
+constexpr int SELECT_BLOCK_SIZE = 256;
+
+/**
+ * @brief Counts the keys matching `prefix` on the bits of `prefix_mask` by their digit at `shift`
+ */
+__global__ void digit_histogram(uint64_t const* keys,
+                                size_type num_keys,
+                                uint64_t prefix,
+                                uint64_t prefix_mask,
+                                int shift,
+                                size_type* histogram)
+{
+  __shared__ size_type block_histogram[RADIX_BUCKETS];
+  for (int i = threadIdx.x; i < RADIX_BUCKETS; i += blockDim.x) { block_histogram[i] = 0; }
+  __syncthreads();
+
+  for (size_type i = threadIdx.x + blockIdx.x * blockDim.x; i < num_keys;
+       i += blockDim.x * gridDim.x) {
+    auto const key = keys[i];
+    if ((key & prefix_mask) == prefix) {
+      atomicAdd(&block_histogram[(key >> shift) & (RADIX_BUCKETS - 1)], 1);
+    }
+  }
+  __syncthreads();
+
+  for (int i = threadIdx.x; i < RADIX_BUCKETS; i += blockDim.x) {
+    if (block_histogram[i] != 0) { atomicAdd(&histogram[i], block_histogram[i]); }
+  }
+}
+
+/**
+ * @brief Finds the `rank`-th smallest of `keys`, counting from 1, one digit at a time
+ *
+ * @return The `rank`-th smallest key, and how many of the keys equal to it are among the `rank`
+ * smallest keys
+ */
+std::pair<uint64_t, size_type> radix_select(rmm::device_vector<uint64_t> const& keys,
+                                            size_type rank,
+                                            cudaStream_t stream)
+{
+  rmm::device_vector<size_type> histogram(RADIX_BUCKETS);
+  std::vector<size_type> h_histogram(RADIX_BUCKETS);
+  cudf::detail::grid_1d const grid{static_cast<size_type>(keys.size()), SELECT_BLOCK_SIZE, 4};
+
+  uint64_t prefix{0};
+  uint64_t prefix_mask{0};
+  for (int shift = 64 - RADIX_BITS; shift >= 0; shift -= RADIX_BITS) {
+    thrust::fill(rmm::exec_policy(stream)->on(stream), histogram.begin(), histogram.end(), 0);
+    digit_histogram<<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
+      keys.data().get(), keys.size(), prefix, prefix_mask, shift, histogram.data().get());
+    CUDA_TRY(cudaMemcpyAsync(h_histogram.data(),
+                             histogram.data().get(),
+                             RADIX_BUCKETS * sizeof(size_type),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+
+    // The selected key is in the bucket where the count of the smaller keys reaches `rank`
+    uint64_t digit = 0;
+    while (h_histogram[digit] < rank) { rank -= h_histogram[digit++]; }
+    prefix |= digit << shift;
+    prefix_mask |= static_cast<uint64_t>(RADIX_BUCKETS - 1) << shift;
+  }
+  return {prefix, rank};
+}
+
+/**
+ * @brief Selects the first `k` row indices of a fixed-width column in sorted order
+ *
+ * The valid rows are mapped to order-preserving 64-bit keys, ascending in the requested order, and
+ * the key of the last selected value is found by `radix_select`. The rows with a smaller key, and
+ * the first rows with an equal key, are then the selected values, which only need to be sorted
+ * among themselves. Null rows are selected in row order, before or after the values.
+ */
+struct top_k_fn {
+  template <typename T, std::enable_if_t<is_radix_sortable<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& input,
+                                     size_type k,
+                                     order column_order,
+                                     null_order null_precedence,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+  {
+    auto const d_input   = column_device_view::create(input, stream);
+    auto const num_nulls = input.null_count();
+    auto const num_valid = input.size() - num_nulls;
+    // Nulls compare less than any value with null_order::BEFORE, so they go first when sorting
+    // in ascending order
+    bool const nulls_first =
+      (null_precedence == null_order::BEFORE) == (column_order == order::ASCENDING);
+    auto const num_selected_nulls =
+      nulls_first ? std::min(k, num_nulls) : std::max(0, k - num_valid);
+    auto const num_selected_values = k - num_selected_nulls;
+
+    auto result = make_numeric_column(
+      data_type(type_to_id<size_type>()), k, mask_state::UNALLOCATED, stream, mr);
+    auto const result_begin = result->mutable_view().begin<size_type>();
+    auto const values_begin = nulls_first ? result_begin + num_selected_nulls : result_begin;
+    auto const nulls_begin  = nulls_first ? result_begin : result_begin + num_selected_values;
+
+    if (num_selected_nulls > 0) {
+      rmm::device_vector<size_type> null_rows(num_nulls);
+      thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(input.size()),
+                      null_rows.begin(),
+                      [d_input = *d_input] __device__(size_type i) { return d_input.is_null(i); });
+      thrust::copy(rmm::exec_policy(stream)->on(stream),
+                   null_rows.begin(),
+                   null_rows.begin() + num_selected_nulls,
+                   nulls_begin);
+    }
+    if (num_selected_values == 0) { return result; }
+
+    rmm::device_vector<size_type> rows(num_valid);
+    thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(input.size()),
+                    rows.begin(),
+                    [d_input = *d_input] __device__(size_type i) { return d_input.is_valid(i); });
+    rmm::device_vector<uint64_t> keys(num_valid);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      rows.begin(),
+                      rows.end(),
+                      keys.begin(),
+                      [d_input    = *d_input,
+                       descending = column_order == order::DESCENDING] __device__(size_type i) {
+                        auto const bits = ordered_bits(radix_sort_key<T>{}(d_input.element<T>(i)));
+                        return descending ? ~bits : bits;
+                      });
+
+    uint64_t threshold;
+    size_type num_ties;
+    std::tie(threshold, num_ties) = radix_select(keys, num_selected_values, stream);
+
+    // Rank of each key among the keys equal to the threshold, to select the first `num_ties`
+    rmm::device_vector<size_type> tie_ranks(num_valid);
+    thrust::transform_exclusive_scan(
+      rmm::exec_policy(stream)->on(stream),
+      keys.begin(),
+      keys.end(),
+      tie_ranks.begin(),
+      [threshold] __device__(uint64_t key) { return key == threshold ? 1 : 0; },
+      0,
+      thrust::plus<size_type>());
+
+    rmm::device_vector<uint64_t> selected_keys(num_selected_values);
+    auto const selected_begin = thrust::make_zip_iterator(
+      thrust::make_tuple(selected_keys.begin(), values_begin));
+    thrust::copy_if(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_zip_iterator(thrust::make_tuple(keys.begin(), rows.begin())),
+      thrust::make_zip_iterator(thrust::make_tuple(keys.end(), rows.end())),
+      thrust::make_counting_iterator<size_type>(0),
+      selected_begin,
+      [d_keys      = keys.data().get(),
+       d_tie_ranks = tie_ranks.data().get(),
+       threshold,
+       num_ties] __device__(size_type i) {
+        return d_keys[i] < threshold or (d_keys[i] == threshold and d_tie_ranks[i] < num_ties);
+      });
+
+    thrust::stable_sort_by_key(rmm::exec_policy(stream)->on(stream),
+                               selected_keys.begin(),
+                               selected_keys.end(),
+                               values_begin);
+    return result;
+  }
+
+  template <typename T, std::enable_if_t<not is_radix_sortable<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& input,
+                                     size_type k,
+                                     order column_order,
+                                     null_order null_precedence,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+  {
+    // Elements without a fixed-width order-preserving key are sorted fully
+    auto const sorted_indices = detail::stable_sorted_order(table_view{{input}},
+                                                            {column_order},
+                                                            {null_precedence},
+                                                            rmm::mr::get_default_resource(),
+                                                            stream);
+    return std::make_unique<column>(detail::slice(sorted_indices->view(), 0, k), stream, mr);
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> top_k_order(column_view const& input,
+                                    size_type k,
+                                    order column_order,
+                                    null_order null_precedence,
+                                    rmm::mr::device_memory_resource* mr,
+                                    cudaStream_t stream)
+{
+  CUDF_EXPECTS(k >= 0, "k must not be negative");
+  k = std::min(k, input.size());
+  if (k == 0) { return make_numeric_column(data_type(type_to_id<size_type>()), 0); }
+
+  return type_dispatcher(
+    input.type(), top_k_fn{}, input, k, column_order, null_precedence, mr, stream);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> top_k_order(column_view const& input,
+                                    size_type k,
+                                    order column_order,
+                                    null_order null_precedence,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::top_k_order(input, k, column_order, null_precedence, mr);
+}
+
+}  // namespace cudf
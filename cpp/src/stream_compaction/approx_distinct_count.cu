@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/null_mask.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace cudf {
+namespace detail {
+namespace {
+constexpr int min_precision = 4;
+constexpr int max_precision = 18;
+constexpr int hash_bits     = 8 * sizeof(hash_value_type);
+
+/**
+ * @brief Adds a hash value to the HyperLogLog registers.
+ *
+ * The first `precision` bits of the hash select a register, which keeps the maximum position of
+ * the first set bit among the remaining bits.
+ */
+__device__ void add_hash(int32_t* registers, int precision, hash_value_type hash)
+{
+  auto const index   = hash >> (hash_bits - precision);
+  auto const rest    = hash << precision;
+  int32_t const rank = min(__clz(static_cast<int32_t>(rest)), hash_bits - precision) + 1;
+  // the registers only grow, so most updates are skipped without an atomic operation
+  if (rank > registers[index]) { atomicMax(registers + index, rank); }
+}
+
+/**
+ * @brief Adds row `i` of the column to the HyperLogLog registers.
+ */
+struct update_registers {
+  column_device_view input;
+  int precision;
+  bool skip_nulls;
+  int32_t* registers;
+
+  __device__ void operator()(size_type i) const
+  {
+    if (skip_nulls && input.is_null(i)) { return; }
+    add_hash(registers,
+             precision,
+             type_dispatcher(input.type(), element_hasher<MurmurHash3_32, true>{}, input, i));
+  }
+};
+
+/**
+ * @brief Adds row `i` of the table to the HyperLogLog registers, unless its bit in `rows_valid`
+ * is unset.
+ */
+struct update_row_registers {
+  row_hasher<MurmurHash3_32, true> hasher;
+  bitmask_type const* rows_valid;  // null to add all the rows
+  int precision;
+  int32_t* registers;
+
+  __device__ void operator()(size_type i) const
+  {
+    if (rows_valid != nullptr && !bit_is_set(rows_valid, i)) { return; }
+    add_hash(registers, precision, hasher(i));
+  }
+};
+
+/**
+ * @brief Returns the bias correction constant of the HyperLogLog estimate for `m` registers
+ */
+double alpha(size_type m)
+{
+  switch (m) {
+    case 16: return 0.673;
+    case 32: return 0.697;
+    case 64: return 0.709;
+    default: return 0.7213 / (1.0 + 1.079 / m);
+  }
+}
+}  // namespace
+
+std::unique_ptr<column> make_distinct_count_sketch(column_view const& input,
+                                                   int precision,
+                                                   null_policy null_handling,
+                                                   rmm::mr::device_memory_resource* mr,
+                                                   cudaStream_t stream)
+{
+  CUDF_EXPECTS(precision >= min_precision && precision <= max_precision,
+               "Sketch precision must be in [4, 18]");
+
+  size_type const num_registers = size_type{1} << precision;
+  auto sketch                   = make_numeric_column(
+    data_type{type_id::INT32}, num_registers, mask_state::UNALLOCATED, stream, mr);
+  auto registers = sketch->mutable_view().data<int32_t>();
+  thrust::fill_n(rmm::exec_policy(stream)->on(stream), registers, num_registers, 0);
+  if (input.is_empty()) { return sketch; }
+
+  auto d_input = column_device_view::create(input, stream);
+  thrust::for_each_n(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    input.size(),
+    update_registers{
+      *d_input, precision, null_handling == null_policy::EXCLUDE && input.nullable(), registers});
+  return sketch;
+}
+
+std::unique_ptr<column> merge_distinct_count_sketches(std::vector<column_view> const& sketches,
+                                                      rmm::mr::device_memory_resource* mr,
+                                                      cudaStream_t stream)
+{
+  CUDF_EXPECTS(not sketches.empty(), "No sketches to merge");
+  auto const num_registers = sketches.front().size();
+  CUDF_EXPECTS(std::all_of(sketches.begin(),
+                           sketches.end(),
+                           [num_registers](auto const& sketch) {
+                             return sketch.type().id() == type_id::INT32 &&
+                                    sketch.size() == num_registers;
+                           }),
+               "Sketches must have the same precision");
+
+  auto merged = make_numeric_column(
+    data_type{type_id::INT32}, num_registers, mask_state::UNALLOCATED, stream, mr);
+  auto merged_view = merged->mutable_view();
+  thrust::copy_n(rmm::exec_policy(stream)->on(stream),
+                 sketches.front().begin<int32_t>(),
+                 num_registers,
+                 merged_view.begin<int32_t>());
+  // the union of the columns has the maximum register values of their sketches
+  std::for_each(sketches.begin() + 1, sketches.end(), [&](auto const& sketch) {
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      merged_view.begin<int32_t>(),
+                      merged_view.end<int32_t>(),
+                      sketch.template begin<int32_t>(),
+                      merged_view.begin<int32_t>(),
+                      thrust::maximum<int32_t>{});
+  });
+  return merged;
+}
+
+cudf::size_type estimate_distinct_count(column_view const& sketch, cudaStream_t stream)
+{
+  CUDF_EXPECTS(sketch.type().id() == type_id::INT32, "Sketch must be INT32 type");
+  size_type const m = sketch.size();
+  CUDF_EXPECTS(m >= (1 << min_precision) && m <= (1 << max_precision) && (m & (m - 1)) == 0,
+               "Invalid sketch size");
+
+  std::vector<int32_t> registers(m);
+  CUDA_TRY(cudaMemcpyAsync(registers.data(),
+                           sketch.data<int32_t>(),
+                           m * sizeof(int32_t),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  double const harmonic_sum = std::accumulate(
+    registers.begin(), registers.end(), 0.0, [](double sum, int32_t rank) {
+      return sum + std::ldexp(1.0, -rank);
+    });
+  double estimate = alpha(m) * m * m / harmonic_sum;
+
+  // small range correction: linear counting while some registers are empty
+  auto const empty_registers = std::count(registers.begin(), registers.end(), 0);
+  if (estimate <= 2.5 * m && empty_registers > 0) {
+    estimate = m * std::log(static_cast<double>(m) / empty_registers);
+  }
+  // large range correction for the collisions of the 32-bit hash values
+  double const hash_range = std::ldexp(1.0, hash_bits);
+  if (estimate > hash_range / 30) { estimate = -hash_range * std::log1p(-estimate / hash_range); }
+
+  auto const max_count = static_cast<double>(std::numeric_limits<size_type>::max());
+  return static_cast<size_type>(std::llround(std::min(estimate, max_count)));
+}
+
+cudf::size_type approx_distinct_count(column_view const& input,
+                                      int precision,
+                                      null_policy null_handling,
+                                      cudaStream_t stream)
+{
+  auto sketch = make_distinct_count_sketch(
+    input, precision, null_handling, rmm::mr::get_default_resource(), stream);
+  return estimate_distinct_count(sketch->view(), stream);
+}
+
+cudf::size_type approx_distinct_count(table_view const& input,
+                                      int precision,
+                                      null_policy null_handling,
+                                      cudaStream_t stream)
+{
+  CUDF_EXPECTS(precision >= min_precision && precision <= max_precision,
+               "Sketch precision must be in [4, 18]");
+
+  size_type const num_registers = size_type{1} << precision;
+  rmm::device_vector<int32_t> registers(num_registers, 0);
+  if (input.num_rows() != 0) {
+    auto const rows_valid = (null_handling == null_policy::EXCLUDE && has_nulls(input))
+                              ? bitmask_and(input, rmm::mr::get_default_resource(), stream)
+                              : rmm::device_buffer{};
+    auto d_input = table_device_view::create(input, stream);
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       input.num_rows(),
+                       update_row_registers{row_hasher<MurmurHash3_32, true>{*d_input},
+                                            static_cast<bitmask_type const*>(rows_valid.data()),
+                                            precision,
+                                            registers.data().get()});
+  }
+  column_view const sketch{data_type{type_id::INT32}, num_registers, registers.data().get()};
+  return estimate_distinct_count(sketch, stream);
+}
+}  // namespace detail
+
+std::unique_ptr<column> make_distinct_count_sketch(column_view const& input,
+                                                   int precision,
+                                                   null_policy null_handling,
+                                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::make_distinct_count_sketch(input, precision, null_handling, mr);
+}
+
+std::unique_ptr<column> merge_distinct_count_sketches(std::vector<column_view> const& sketches,
+                                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::merge_distinct_count_sketches(sketches, mr);
+}
+
+cudf::size_type estimate_distinct_count(column_view const& sketch)
+{
+  CUDF_FUNC_RANGE();
+  return detail::estimate_distinct_count(sketch);
+}
+
+cudf::size_type approx_distinct_count(column_view const& input,
+                                      int precision,
+                                      null_policy null_handling)
+{
+  CUDF_FUNC_RANGE();
+  return detail::approx_distinct_count(input, precision, null_handling);
+}
+
+}  // namespace cudf
@@ -31,6 +31,7 @@
 
 #include <thrust/execution_policy.h>
 #include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/logical.h>
 #include <algorithm>
 #include <cmath>
@@ -96,6 +97,8 @@ OutputIterator unique_copy(Exec&& exec,
  * @param[in] keep            keep first entry, last entry, or no entries if duplicates found
  * @param[in] nulls_equal     flag to denote nulls are equal if null_equality::EQUAL,
  *                            nulls are not equal if null_equality::UNEQUAL
+ * @param[in] keys_are_sorted flag to denote the rows of `keys` are already sorted, so that
+ *                            duplicate rows are consecutive and no sort is needed
  * @param[in] stream          CUDA stream used for device memory operations and kernel launches.
  *
  * @return column_view column_view of unique row index as per specified `keep`, this is actually
@@ -105,44 +108,55 @@ column_view get_unique_ordered_indices(cudf::table_view const& keys,
                                        cudf::mutable_column_view& unique_indices,
                                        duplicate_keep_option keep,
                                        null_equality nulls_equal,
-                                       cudaStream_t stream = 0)
+                                       sorted keys_are_sorted = sorted::NO,
+                                       cudaStream_t stream    = 0)
 {
-  // sort only indices
-  auto sorted_indices = sorted_order(
-    keys, std::vector<order>{}, std::vector<null_order>{}, rmm::mr::get_default_resource(), stream);
-
   // extract unique indices
   auto device_input_table = cudf::table_device_view::create(keys, stream);
 
-  if (cudf::has_nulls(keys)) {
-    auto comp = row_equality_comparator<true>(
-      *device_input_table, *device_input_table, nulls_equal == null_equality::EQUAL);
-    auto result_end = unique_copy(rmm::exec_policy(stream)->on(stream),
-                                  sorted_indices->view().begin<cudf::size_type>(),
-                                  sorted_indices->view().end<cudf::size_type>(),
-                                  unique_indices.begin<cudf::size_type>(),
-                                  comp,
-                                  keep);
-
-    return cudf::detail::slice(
-      column_view(unique_indices),
-      0,
-      thrust::distance(unique_indices.begin<cudf::size_type>(), result_end));
-  } else {
-    auto comp = row_equality_comparator<false>(
-      *device_input_table, *device_input_table, nulls_equal == null_equality::EQUAL);
-    auto result_end = unique_copy(rmm::exec_policy(stream)->on(stream),
-                                  sorted_indices->view().begin<cudf::size_type>(),
-                                  sorted_indices->view().end<cudf::size_type>(),
-                                  unique_indices.begin<cudf::size_type>(),
-                                  comp,
-                                  keep);
-
-    return cudf::detail::slice(
-      column_view(unique_indices),
-      0,
-      thrust::distance(unique_indices.begin<cudf::size_type>(), result_end));
+  auto unique_indices_in = [&](auto sorted_begin, auto sorted_end) {
+    if (cudf::has_nulls(keys)) {
+      auto comp = row_equality_comparator<true>(
+        *device_input_table, *device_input_table, nulls_equal == null_equality::EQUAL);
+      auto result_end = unique_copy(rmm::exec_policy(stream)->on(stream),
+                                    sorted_begin,
+                                    sorted_end,
+                                    unique_indices.begin<cudf::size_type>(),
+                                    comp,
+                                    keep);
+
+      return cudf::detail::slice(
+        column_view(unique_indices),
+        0,
+        thrust::distance(unique_indices.begin<cudf::size_type>(), result_end));
+    } else {
+      auto comp = row_equality_comparator<false>(
+        *device_input_table, *device_input_table, nulls_equal == null_equality::EQUAL);
+      auto result_end = unique_copy(rmm::exec_policy(stream)->on(stream),
+                                    sorted_begin,
+                                    sorted_end,
+                                    unique_indices.begin<cudf::size_type>(),
+                                    comp,
+                                    keep);
+
+      return cudf::detail::slice(
+        column_view(unique_indices),
+        0,
+        thrust::distance(unique_indices.begin<cudf::size_type>(), result_end));
+    }
+  };
+
+  // sorted keys are their own sorted order
+  if (keys_are_sorted == sorted::YES) {
+    return unique_indices_in(thrust::make_counting_iterator<cudf::size_type>(0),
+                             thrust::make_counting_iterator<cudf::size_type>(keys.num_rows()));
   }
+
+  // sort only indices
+  auto sorted_indices = sorted_order(
+    keys, std::vector<order>{}, std::vector<null_order>{}, rmm::mr::get_default_resource(), stream);
+  return unique_indices_in(sorted_indices->view().begin<cudf::size_type>(),
+                           sorted_indices->view().end<cudf::size_type>());
 }
 
 cudf::size_type distinct_count(table_view const& keys,
@@ -184,6 +198,7 @@ std::unique_ptr<table> drop_duplicates(table_view const& input,
                                        std::vector<size_type> const& keys,
                                        duplicate_keep_option keep,
                                        null_equality nulls_equal,
+                                       sorted keys_are_sorted,
                                        rmm::mr::device_memory_resource* mr,
                                        cudaStream_t stream)
 {
@@ -200,15 +215,18 @@ std::unique_ptr<table> drop_duplicates(table_view const& input,
   // This is just slice of `unique_indices` but with different size as per the
   // keys_view has been processed in `get_unique_ordered_indices`
   auto unique_indices_view = detail::get_unique_ordered_indices(
-    keys_view, mutable_unique_indices_view, keep, nulls_equal, stream);
+    keys_view, mutable_unique_indices_view, keep, nulls_equal, keys_are_sorted, stream);
 
   // run gather operation to establish new order
-  return detail::gather(input,
-                        unique_indices_view,
-                        detail::out_of_bounds_policy::NULLIFY,
-                        detail::negative_index_policy::NOT_ALLOWED,
-                        mr,
-                        stream);
+  auto result = detail::gather(input,
+                               unique_indices_view,
+                               detail::out_of_bounds_policy::NULLIFY,
+                               detail::negative_index_policy::NOT_ALLOWED,
+                               mr,
+                               stream);
+  // the unique rows are gathered in the ascending order of the keys
+  result->set_sort_order(keys, std::vector<order>(keys.size(), order::ASCENDING));
+  return result;
 }
 
 /**
@@ -326,7 +344,18 @@ std::unique_ptr<table> drop_duplicates(table_view const& input,
                                        rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::drop_duplicates(input, keys, keep, nulls_equal, mr);
+  return detail::drop_duplicates(input, keys, keep, nulls_equal, sorted::NO, mr);
+}
+
+std::unique_ptr<table> drop_duplicates(table const& input,
+                                       std::vector<size_type> const& keys,
+                                       duplicate_keep_option const keep,
+                                       null_equality nulls_equal,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  auto const keys_are_sorted = input.is_sorted_by(keys) ? sorted::YES : sorted::NO;
+  return detail::drop_duplicates(input.view(), keys, keep, nulls_equal, keys_are_sorted, mr);
 }
 
 cudf::size_type distinct_count(column_view const& input,
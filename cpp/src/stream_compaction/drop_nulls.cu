@@ -17,10 +17,12 @@
 #include <cudf/detail/copy_if.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/stream_compaction.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
 
 namespace {
 // Returns true if the mask is true for index i in at least keep_threshold
@@ -51,6 +53,13 @@ struct valid_table_filter {
   cudf::table_device_view keys_device_view;
 };
 
+// Returns true if bit i of the row mask is set
+struct valid_row_filter {
+  __device__ inline bool operator()(cudf::size_type i) { return cudf::bit_is_set(row_mask, i); }
+
+  cudf::bitmask_type const* row_mask;
+};
+
 }  // namespace
 
 namespace cudf {
@@ -69,6 +78,18 @@ std::unique_ptr<table> drop_nulls(table_view const& input,
     return std::make_unique<table>(input, stream, mr);
   }
 
+  // Keeping rows valid in all or in any of the keys only needs the AND or the OR of the key
+  // null masks, computed a word at a time, instead of counting each row's valid keys
+  if (keep_threshold == keys_view.num_columns() || keep_threshold == 1) {
+    auto const row_mask = keep_threshold == keys_view.num_columns()
+                            ? bitmask_and(keys_view, rmm::mr::get_default_resource(), stream)
+                            : bitmask_or(keys_view, rmm::mr::get_default_resource(), stream);
+    // an empty mask means every row is valid in some key
+    if (row_mask.size() == 0) { return std::make_unique<table>(input, stream, mr); }
+    return cudf::detail::copy_if(
+      input, valid_row_filter{static_cast<bitmask_type const*>(row_mask.data())}, mr, stream);
+  }
+
   auto keys_device_view = cudf::table_device_view::create(keys_view, stream);
 
   return cudf::detail::copy_if(
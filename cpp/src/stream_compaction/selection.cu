@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy_if.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/selection.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+
+namespace {
+// Returns true if row i is selected and the mask is true and valid (non-null) for it
+struct selection_filter {
+  cudf::bitmask_type const* rows;
+  cudf::column_device_view boolean_mask;
+
+  __device__ inline bool operator()(cudf::size_type i) const
+  {
+    return (rows == nullptr || cudf::bit_is_set(rows, i)) && boolean_mask.is_valid(i) &&
+           boolean_mask.data<bool>()[i];
+  }
+};
+
+// Returns true if row i is selected
+struct selected_row {
+  cudf::bitmask_type const* rows;
+
+  __device__ inline bool operator()(cudf::size_type i) const { return cudf::bit_is_set(rows, i); }
+};
+
+// Returns true if row i is selected by a boolean mask
+struct boolean_mask_row {
+  cudf::column_device_view boolean_mask;
+
+  __device__ inline bool operator()(cudf::size_type i) const
+  {
+    return boolean_mask.is_valid(i) && boolean_mask.data<bool>()[i];
+  }
+};
+
+// Returns true if bit i of a null mask with the offset of the input column is set, i.e. if
+// row i - offset is selected and the column is valid (non-null) for it
+template <typename RowFilter>
+struct selected_valid_row {
+  RowFilter is_selected;
+  cudf::column_device_view input;
+  cudf::size_type offset;
+
+  __device__ inline bool operator()(cudf::size_type i) const
+  {
+    return i >= offset && is_selected(i - offset) && input.is_valid(i - offset);
+  }
+};
+
+template <typename RowFilter>
+std::pair<rmm::device_buffer, cudf::size_type> masked_null_mask(
+  cudf::column_view const& input,
+  RowFilter is_selected,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  auto device_input = cudf::column_device_view::create(input, stream);
+  auto mask         = cudf::detail::valid_if(
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    thrust::make_counting_iterator(input.offset() + input.size()),
+    selected_valid_row<RowFilter>{is_selected, *device_input, input.offset()},
+    stream,
+    mr);
+  // the bits before the offset are unset but are not part of the column
+  mask.second -= input.offset();
+  return mask;
+}
+
+std::unique_ptr<cudf::selection> filter_rows(cudf::bitmask_type const* rows,
+                                             cudf::column_view const& boolean_mask,
+                                             rmm::mr::device_memory_resource* mr,
+                                             cudaStream_t stream)
+{
+  CUDF_EXPECTS(boolean_mask.type().id() == cudf::type_id::BOOL8, "Mask must be Boolean type");
+  auto device_boolean_mask = cudf::column_device_view::create(boolean_mask, stream);
+  auto mask = cudf::detail::valid_if(thrust::make_counting_iterator<cudf::size_type>(0),
+                                     thrust::make_counting_iterator(boolean_mask.size()),
+                                     selection_filter{rows, *device_boolean_mask},
+                                     stream,
+                                     mr);
+  return std::make_unique<cudf::selection>(
+    std::move(mask.first), boolean_mask.size(), boolean_mask.size() - mask.second);
+}
+
+}  // namespace
+
+namespace cudf {
+namespace detail {
+std::unique_ptr<selection> make_selection(column_view const& boolean_mask,
+                                          rmm::mr::device_memory_resource* mr,
+                                          cudaStream_t stream)
+{
+  return filter_rows(nullptr, boolean_mask, mr, stream);
+}
+
+std::unique_ptr<selection> make_selection(selection const& rows,
+                                          column_view const& boolean_mask,
+                                          rmm::mr::device_memory_resource* mr,
+                                          cudaStream_t stream)
+{
+  CUDF_EXPECTS(rows.size() == boolean_mask.size(), "Column size mismatch");
+  return filter_rows(rows.mask(), boolean_mask, mr, stream);
+}
+
+/*
+ * Copies the selected rows of a table_view.
+ *
+ * calls copy_if() with the `selected_row` functor.
+ */
+std::unique_ptr<table> apply_selection(table_view const& input,
+                                       selection const& rows,
+                                       rmm::mr::device_memory_resource* mr,
+                                       cudaStream_t stream)
+{
+  if (rows.size() == 0) { return empty_like(input); }
+
+  // zero-size inputs are OK, but otherwise input size must match the selection size
+  CUDF_EXPECTS(input.num_rows() == 0 || input.num_rows() == rows.size(), "Column size mismatch");
+
+  if (rows.selected_count() == rows.size()) { return std::make_unique<table>(input, stream, mr); }
+
+  return detail::copy_if(input, selected_row{rows.mask()}, mr, stream);
+}
+
+std::pair<rmm::device_buffer, size_type> selection_null_mask(column_view const& input,
+                                                             selection const& rows,
+                                                             rmm::mr::device_memory_resource* mr,
+                                                             cudaStream_t stream)
+{
+  CUDF_EXPECTS(input.size() == rows.size(), "Column size mismatch");
+  return masked_null_mask(input, selected_row{rows.mask()}, mr, stream);
+}
+
+std::pair<rmm::device_buffer, size_type> selection_null_mask(column_view const& input,
+                                                             column_view const& boolean_mask,
+                                                             rmm::mr::device_memory_resource* mr,
+                                                             cudaStream_t stream)
+{
+  CUDF_EXPECTS(boolean_mask.type().id() == type_id::BOOL8, "Mask must be Boolean type");
+  CUDF_EXPECTS(input.size() == boolean_mask.size(), "Column size mismatch");
+  auto device_boolean_mask = column_device_view::create(boolean_mask, stream);
+  return masked_null_mask(input, boolean_mask_row{*device_boolean_mask}, mr, stream);
+}
+
+}  // namespace detail
+
+std::unique_ptr<selection> make_selection(column_view const& boolean_mask,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::make_selection(boolean_mask, mr);
+}
+
+std::unique_ptr<selection> make_selection(selection const& rows,
+                                          column_view const& boolean_mask,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::make_selection(rows, boolean_mask, mr);
+}
+
+std::unique_ptr<table> apply_selection(table_view const& input,
+                                       selection const& rows,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::apply_selection(input, rows, mr);
+}
+}  // namespace cudf
@@ -118,6 +118,87 @@ struct upper_lower_fn {
   }
 };
 
+/**
+ * @brief Converts the case of 4 ASCII characters at a time.
+ *
+ * Adding to each byte the distance from a bound to 0x80 sets its high bit when the byte is at
+ * or above the bound; no byte carries into the next since all bytes are below 0x80.
+ */
+struct ascii_case_fn {
+  bool convert_upper;  // upper case characters are made lower case
+  bool convert_lower;  // lower case characters are made upper case
+
+  __device__ uint32_t operator()(uint32_t chars) const
+  {
+    auto const upper = (chars + 0x3F3F3F3Fu) & ~(chars + 0x25252525u);  // in ['A','Z']
+    auto const lower = (chars + 0x1F1F1F1Fu) & ~(chars + 0x05050505u);  // in ['a','z']
+    auto const cased = ((convert_upper ? upper : 0) | (convert_lower ? lower : 0)) & 0x80808080u;
+    return chars ^ (cased >> 2);  // flip the 0x20 bit
+  }
+};
+
+/**
+ * @brief Case conversion of strings made only of ASCII characters.
+ *
+ * Each character converts to a single byte, so the offsets are those of the input and the
+ * chars are converted 4 bytes per thread, independently of the string boundaries.
+ */
+std::unique_ptr<column> convert_case_ascii(strings_column_view const& strings,
+                                           character_flags_table_type case_flag,
+                                           rmm::mr::device_memory_resource* mr,
+                                           cudaStream_t stream)
+{
+  auto const strings_count = strings.size();
+  auto const d_offsets     = strings.offsets().data<int32_t>() + strings.offset();
+  int32_t first_offset = 0, bytes = 0;
+  CUDA_TRY(cudaMemcpyAsync(
+    &first_offset, d_offsets, sizeof(int32_t), cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaMemcpyAsync(
+    &bytes, d_offsets + strings_count, sizeof(int32_t), cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  bytes -= first_offset;
+
+  auto offsets_column = make_numeric_column(
+    data_type{type_id::INT32}, strings_count + 1, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    d_offsets,
+                    d_offsets + strings_count + 1,
+                    offsets_column->mutable_view().data<int32_t>(),
+                    [first_offset] __device__(int32_t offset) { return offset - first_offset; });
+
+  auto chars_column = strings::detail::create_chars_child_column(
+    strings_count, strings.null_count(), bytes, mr, stream);
+  auto const d_input  = strings.chars().data<char>() + first_offset;
+  auto const d_output = chars_column->mutable_view().data<char>();
+  ascii_case_fn const convert{IS_UPPER(case_flag) != 0, IS_LOWER(case_flag) != 0};
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     (bytes + 3) / 4,
+                     [d_input, d_output, bytes, convert] __device__(size_type idx) {
+                       auto const first = idx * 4;
+                       auto const count = min(bytes - first, 4);
+                       uint32_t chars   = 0;
+                       for (int i = 0; i < count; ++i) {
+                         chars |= static_cast<uint32_t>(static_cast<uint8_t>(d_input[first + i]))
+                                  << (8 * i);
+                       }
+                       chars = convert(chars);
+                       if (count == 4) {
+                         *reinterpret_cast<uint32_t*>(d_output + first) = chars;
+                       } else {
+                         for (int i = 0; i < count; ++i) { d_output[first + i] = chars >> (8 * i); }
+                       }
+                     });
+
+  return make_strings_column(strings_count,
+                             std::move(offsets_column),
+                             std::move(chars_column),
+                             strings.null_count(),
+                             copy_bitmask(strings.parent(), stream, mr),
+                             stream,
+                             mr);
+}
+
 /**
  * @brief Utility method for converting upper and lower case characters
  * in a strings column.
@@ -135,6 +216,7 @@ std::unique_ptr<column> convert_case(strings_column_view const& strings,
 {
   auto strings_count = strings.size();
   if (strings_count == 0) return detail::make_empty_strings_column(mr, stream);
+  if (is_ascii(strings, stream)) return convert_case_ascii(strings, case_flag, mr, stream);
 
   auto execpol         = rmm::exec_policy(stream);
   auto strings_column  = column_device_view::create(strings.parent(), stream);
@@ -188,7 +188,7 @@ std::unique_ptr<column> join_strings(strings_column_view const& strings,
       if ((idx + 1) < d_strings.size()) bytes += d_separator.size_bytes();
       return bytes;
     },
-    thrust::plus<size_type>());
+    detail::saturating_offsets_sum{});
   CUDA_TRY(cudaMemsetAsync(d_output_offsets, 0, sizeof(size_type), stream));
   // total size is the last entry
   size_type bytes = output_offsets.back();
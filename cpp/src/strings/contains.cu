@@ -23,9 +23,11 @@
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
-#include <strings/regex/regex.cuh>
+#include <strings/regex/regex_program_impl.cuh>
 #include <strings/utilities.hpp>
 
+#include <rmm/thrust_rmm_allocator.h>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -65,7 +67,7 @@ struct contains_fn {
 //
 std::unique_ptr<column> contains_util(
   strings_column_view const& strings,
-  std::string const& pattern,
+  regex_program const& program,
   bool beginning_only                 = false,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0)
@@ -74,10 +76,6 @@ std::unique_ptr<column> contains_util(
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_column       = *strings_column;
 
-  // compile regex into device object
-  auto prog   = reprog_device::create(pattern, get_character_flags_table(), strings_count, stream);
-  auto d_prog = *prog;
-
   // create the output column
   auto results   = make_numeric_column(data_type{type_id::BOOL8},
                                      strings_count,
@@ -87,6 +85,18 @@ std::unique_ptr<column> contains_util(
                                      mr);
   auto d_results = results->mutable_view().data<bool>();
 
+  // patterns without anchors or word boundaries are evaluated with a DFA
+  auto dfa = program.get_impl()->get_dfa(beginning_only, stream);
+  if (dfa) {
+    dfa->matches(d_column, d_results, stream);
+    results->set_null_count(strings.null_count());
+    return results;
+  }
+
+  // device object of the compiled regex
+  auto prog   = program.get_impl()->get_device_program(strings_count, stream);
+  auto d_prog = *prog;
+
   // fill the output column
   auto execpol    = rmm::exec_policy(stream);
   int regex_insts = d_prog.insts_counts();
@@ -117,20 +127,20 @@ std::unique_ptr<column> contains_util(
 
 std::unique_ptr<column> contains_re(
   strings_column_view const& strings,
-  std::string const& pattern,
+  regex_program const& program,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0)
 {
-  return contains_util(strings, pattern, false, mr, stream);
+  return contains_util(strings, program, false, mr, stream);
 }
 
 std::unique_ptr<column> matches_re(
   strings_column_view const& strings,
-  std::string const& pattern,
+  regex_program const& program,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0)
 {
-  return contains_util(strings, pattern, true, mr, stream);
+  return contains_util(strings, program, true, mr, stream);
 }
 
 }  // namespace detail
@@ -142,7 +152,15 @@ std::unique_ptr<column> contains_re(strings_column_view const& strings,
                                     rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::contains_re(strings, pattern, mr);
+  return detail::contains_re(strings, *regex_program::create(pattern), mr);
+}
+
+std::unique_ptr<column> contains_re(strings_column_view const& strings,
+                                    regex_program const& program,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::contains_re(strings, program, mr);
 }
 
 std::unique_ptr<column> matches_re(strings_column_view const& strings,
@@ -150,7 +168,15 @@ std::unique_ptr<column> matches_re(strings_column_view const& strings,
                                    rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::matches_re(strings, pattern, mr);
+  return detail::matches_re(strings, *regex_program::create(pattern), mr);
+}
+
+std::unique_ptr<column> matches_re(strings_column_view const& strings,
+                                   regex_program const& program,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::matches_re(strings, program, mr);
 }
 
 namespace detail {
@@ -163,9 +189,11 @@ template <size_t stack_size>
 struct count_fn {
   reprog_device prog;
   column_device_view d_strings;
+  bool const* d_candidates;  // strings the pattern may match, or nullptr to search all strings
 
   __device__ int32_t operator()(unsigned int idx)
   {
+    if (d_candidates && !d_candidates[idx]) return 0;
     u_char data1[stack_size], data2[stack_size];
     prog.set_stack_mem(data1, data2);
     if (d_strings.is_null(idx)) return 0;
@@ -187,7 +215,7 @@ struct count_fn {
 
 std::unique_ptr<column> count_re(
   strings_column_view const& strings,
-  std::string const& pattern,
+  regex_program const& program,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0)
 {
@@ -195,8 +223,17 @@ std::unique_ptr<column> count_re(
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_column       = *strings_column;
 
-  // compile regex into device object
-  auto prog   = reprog_device::create(pattern, get_character_flags_table(), strings_count, stream);
+  // the match positions need the regex program but a DFA quickly finds the strings without any
+  rmm::device_vector<bool> candidates;
+  auto dfa = program.get_impl()->get_dfa(false, stream);
+  if (dfa) {
+    candidates.resize(strings_count);
+    dfa->matches(d_column, candidates.data().get(), stream);
+  }
+  bool const* d_candidates = dfa ? candidates.data().get() : nullptr;
+
+  // device object of the compiled regex
+  auto prog   = program.get_impl()->get_device_program(strings_count, stream);
   auto d_prog = *prog;
 
   // create the output column
@@ -216,19 +253,19 @@ std::unique_ptr<column> count_re(
                       thrust::make_counting_iterator<size_type>(0),
                       thrust::make_counting_iterator<size_type>(strings_count),
                       d_results,
-                      count_fn<RX_STACK_SMALL>{d_prog, d_column});
+                      count_fn<RX_STACK_SMALL>{d_prog, d_column, d_candidates});
   else if (regex_insts <= RX_MEDIUM_INSTS)
     thrust::transform(execpol->on(stream),
                       thrust::make_counting_iterator<size_type>(0),
                       thrust::make_counting_iterator<size_type>(strings_count),
                       d_results,
-                      count_fn<RX_STACK_MEDIUM>{d_prog, d_column});
+                      count_fn<RX_STACK_MEDIUM>{d_prog, d_column, d_candidates});
   else
     thrust::transform(execpol->on(stream),
                       thrust::make_counting_iterator<size_type>(0),
                       thrust::make_counting_iterator<size_type>(strings_count),
                       d_results,
-                      count_fn<RX_STACK_LARGE>{d_prog, d_column});
+                      count_fn<RX_STACK_LARGE>{d_prog, d_column, d_candidates});
 
   results->set_null_count(strings.null_count());
   return results;
@@ -243,7 +280,15 @@ std::unique_ptr<column> count_re(strings_column_view const& strings,
                                  rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::count_re(strings, pattern, mr);
+  return detail::count_re(strings, *regex_program::create(pattern), mr);
+}
+
+std::unique_ptr<column> count_re(strings_column_view const& strings,
+                                 regex_program const& program,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::count_re(strings, program, mr);
 }
 
 }  // namespace strings
@@ -29,6 +29,7 @@
 #include <strings/utilities.cuh>
 
 #include <rmm/thrust_rmm_allocator.h>
+#include <limits>
 #include <map>
 #include <vector>
 
@@ -91,6 +92,19 @@ struct alignas(4) format_item {
   }
 };
 
+/**
+ * @brief Positions of the timestamp components in strings of a format with only
+ * fixed-width numeric specifiers.
+ *
+ * Every component of such a format is found at the same byte offset in every string,
+ * so it can be read there directly instead of walking the format items for each string.
+ */
+struct fixed_format_layout {
+  int16_t offsets[TP_ARRAYSIZE] = {};  // byte offset of each component
+  int8_t lengths[TP_ARRAYSIZE]  = {};  // bytes of each component, 0 if not in the format
+  size_type bytes               = 0;   // minimum bytes of a string
+};
+
 /**
  * @brief The format_compiler parses a timestamp format string into a vector of
  * format_items.
@@ -102,6 +116,7 @@ struct format_compiler {
   std::string format;
   std::string template_string;
   timestamp_units units;
+  std::vector<format_item> items;
   rmm::device_vector<format_item> d_items;
 
   std::map<char, int8_t> specifier_lengths = {{'Y', 4},
@@ -122,7 +137,6 @@ struct format_compiler {
 
   format_item const* compile_to_device()
   {
-    std::vector<format_item> items;
     const char* str = format.c_str();
     auto length     = format.length();
     while (length > 0) {
@@ -167,16 +181,47 @@ struct format_compiler {
   size_type template_bytes() const { return static_cast<size_type>(template_string.size()); }
   size_type items_count() const { return static_cast<size_type>(d_items.size()); }
   int8_t subsecond_precision() const { return specifier_lengths.at('f'); }
+
+  /**
+   * @brief Computes the fixed layout of the format if it has only literals and the
+   * %Y, %m, %d, %H, %M, %S and %f specifiers, as the ISO 8601 formats do.
+   *
+   * @param[out] layout Positions of the components when this returns true.
+   * @return false if the strings must be parsed by walking the format items.
+   */
+  bool fixed_layout(fixed_format_layout& layout) const
+  {
+    std::map<char, timestamp_parse_component> const components = {{'Y', TP_YEAR},
+                                                                   {'m', TP_MONTH},
+                                                                   {'d', TP_DAY},
+                                                                   {'H', TP_HOUR},
+                                                                   {'M', TP_MINUTE},
+                                                                   {'S', TP_SECOND},
+                                                                   {'f', TP_SUBSECOND}};
+    layout = fixed_format_layout{};
+    for (auto const& item : items) {
+      if (item.item_type == format_char_type::specifier) {
+        auto const component = components.find(item.value);
+        if (component == components.end()) return false;
+        layout.offsets[component->second] = static_cast<int16_t>(layout.bytes);
+        layout.lengths[component->second] = item.length;
+      }
+      layout.bytes += item.length;
+    }
+    return layout.bytes <= std::numeric_limits<int16_t>::max();
+  }
 };
 
 // this parses date/time characters into a timestamp integer
-template <typename T>  // timestamp type
+// the components are read at fixed offsets when has_fixed_layout is true
+template <typename T, bool has_fixed_layout = false>  // timestamp type
 struct parse_datetime {
   column_device_view const d_strings;
   format_item const* d_format_items;
   size_type items_count;
   timestamp_units units;
   int8_t subsecond_precision;
+  fixed_format_layout layout;
 
   //
   __device__ int32_t str2int(const char* str, size_type bytes)
@@ -247,6 +292,20 @@ struct parse_datetime {
     return 0;
   }
 
+  // Read each component of the datetime string at its offset in the fixed layout.
+  // Returns 0 if all ok.
+  __device__ int parse_fixed_into_parts(string_view const& d_string, int32_t* timeparts)
+  {
+    if (d_string.size_bytes() < layout.bytes) return 1;
+    auto ptr = d_string.data();
+#pragma unroll
+    for (int part = 0; part < TP_ARRAYSIZE; ++part) {
+      if (layout.lengths[part] > 0)
+        timeparts[part] = str2int(ptr + layout.offsets[part], layout.lengths[part]);
+    }
+    return 0;
+  }
+
   __device__ int64_t timestamp_from_parts(int32_t const* timeparts, timestamp_units units)
   {
     auto year = timeparts[TP_YEAR];
@@ -305,7 +364,9 @@ struct parse_datetime {
     if (d_str.empty()) return 0;
     //
     int32_t timeparts[TP_ARRAYSIZE] = {0, 1, 1};       // month and day are 1-based
-    if (parse_into_parts(d_str, timeparts)) return 0;  // unexpected parse case
+    auto const error = has_fixed_layout ? parse_fixed_into_parts(d_str, timeparts)
+                                        : parse_into_parts(d_str, timeparts);
+    if (error) return 0;  // unexpected parse case
     //
     return static_cast<T>(timestamp_from_parts(timeparts, units));
   }
@@ -358,6 +419,17 @@ struct dispatch_to_timestamps_fn {
     format_compiler compiler(format.c_str(), units);
     auto d_items   = compiler.compile_to_device();
     auto d_results = results_view.data<T>();
+    fixed_format_layout layout;
+    if (compiler.fixed_layout(layout)) {
+      parse_datetime<T, true> pfn{
+        d_strings, d_items, compiler.items_count(), units, compiler.subsecond_precision(), layout};
+      thrust::transform(rmm::exec_policy(stream)->on(stream),
+                        thrust::make_counting_iterator<size_type>(0),
+                        thrust::make_counting_iterator<size_type>(results_view.size()),
+                        d_results,
+                        pfn);
+      return;
+    }
     parse_datetime<T> pfn{
       d_strings, d_items, compiler.items_count(), units, compiler.subsecond_precision()};
     thrust::transform(rmm::exec_policy(stream)->on(stream),
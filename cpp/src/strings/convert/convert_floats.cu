@@ -17,6 +17,7 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/parse_digits.cuh>
 #include <cudf/strings/convert/convert_floats.hpp>
 #include <cudf/strings/detail/converters.hpp>
 #include <cudf/strings/detail/utilities.hpp>
@@ -71,7 +72,18 @@ __device__ inline double stod(string_view const& d_str)
       ++in_ptr;
       continue;
     }
-    if (ch < '0' || ch > '9') break;
+    // take up to 8 digits at once while they fit in the mantissa
+    uint64_t chunk   = 0;
+    auto const count = cudf::detail::parse_digits_chunk(in_ptr, end, chunk);
+    if (count == 0) break;
+    auto const scale = cudf::detail::digits_chunk_scale(count);
+    if (digits <= (max_mantissa - chunk) / scale) {
+      digits = (digits * scale) + chunk;
+      exp_off -= decimal ? count : 0;
+      in_ptr += count;
+      continue;
+    }
+    // otherwise the digits past the mantissa are dropped one at a time
     if (digits > max_mantissa)
       exp_off += (int)!decimal;
     else {
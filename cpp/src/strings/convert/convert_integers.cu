@@ -18,6 +18,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/parse_digits.cuh>
 #include <cudf/strings/convert/convert_integers.hpp>
 #include <cudf/strings/detail/converters.hpp>
 #include <cudf/strings/detail/utilities.hpp>
@@ -64,10 +65,14 @@ struct string_to_integer_fn {
       ++ptr;
       --bytes;
     }
-    for (size_type idx = 0; idx < bytes; ++idx) {
-      char chr = *ptr++;
-      if (chr < '0' || chr > '9') break;
-      value = (value * 10) + static_cast<int64_t>(chr - '0');
+    // parse up to 8 digits per step
+    const char* end = ptr + bytes;
+    uint64_t digits = 0;
+    int count       = 0;
+    while ((count = cudf::detail::parse_digits_chunk(ptr, end, digits)) > 0) {
+      value = (value * static_cast<int64_t>(cudf::detail::digits_chunk_scale(count))) +
+              static_cast<int64_t>(digits);
+      ptr += count;
     }
     return value * static_cast<int64_t>(sign);
   }
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/strings/convert/convert_ipv6.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <thrust/for_each.h>
+
+#include <vector>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+namespace {
+/**
+ * @brief Converts IPv6 strings into the high and low 64 bits of their 128-bit integers.
+ *
+ * Only single-byte characters are expected.
+ * No checking is done on the format of individual strings:
+ * any character that is not a hex digit counts as a zero digit.
+ */
+struct ipv6_to_integers_fn {
+  column_device_view const d_strings;
+  uint64_t* d_high;
+  uint64_t* d_low;
+
+  __device__ static uint32_t hex_value(char ch)
+  {
+    if (ch >= '0' && ch <= '9') return ch - '0';
+    if (ch >= 'A' && ch <= 'F') return ch - 'A' + 10;
+    if (ch >= 'a' && ch <= 'f') return ch - 'a' + 10;
+    return 0;
+  }
+
+  // converts a dotted IPv4 address into its 32 bits
+  __device__ static uint32_t ipv4_value(char const* ptr, char const* end)
+  {
+    uint32_t result = 0;
+    uint32_t octet  = 0;
+    for (; ptr < end; ++ptr) {
+      if (*ptr == '.') {
+        result = (result << 8) | octet;
+        octet  = 0;
+      } else {
+        octet = octet * 10 + static_cast<uint32_t>(*ptr - '0');
+      }
+    }
+    return (result << 8) | octet;
+  }
+
+  __device__ void operator()(size_type idx)
+  {
+    uint16_t groups[8] = {0};
+    if (d_strings.is_valid(idx)) {
+      string_view d_str = d_strings.element<string_view>(idx);
+      const char* ptr   = d_str.data();
+      const char* end   = ptr + d_str.size_bytes();
+      int32_t count     = 0;   // groups found
+      int32_t gap       = -1;  // groups found before the "::"
+      if ((end - ptr >= 2) && (ptr[0] == ':') && (ptr[1] == ':')) {
+        gap = 0;
+        ptr += 2;
+      }
+      while ((ptr < end) && (count < 8)) {
+        auto const group_begin = ptr;
+        uint32_t value         = 0;
+        bool dotted            = false;
+        for (; (ptr < end) && (*ptr != ':'); ++ptr) {
+          dotted = dotted || (*ptr == '.');
+          value  = (value << 4) | hex_value(*ptr);
+        }
+        if (dotted) {  // the last 32 bits in the IPv4 format
+          auto const ipv4 = ipv4_value(group_begin, ptr);
+          groups[count++] = static_cast<uint16_t>(ipv4 >> 16);
+          if (count < 8) groups[count++] = static_cast<uint16_t>(ipv4);
+          break;
+        }
+        groups[count++] = static_cast<uint16_t>(value);
+        if (ptr < end) ++ptr;  // skip the ':'
+        if ((ptr < end) && (*ptr == ':')) {
+          gap = count;
+          ++ptr;
+        }
+      }
+      if (gap >= 0) {  // move the groups after the "::" to the end
+        auto const tail = count - gap;
+        for (int32_t i = 0; i < tail; ++i) { groups[7 - i] = groups[count - 1 - i]; }
+        for (int32_t i = gap; i < 8 - tail; ++i) { groups[i] = 0; }
+      }
+    }
+    uint64_t high = 0;
+    uint64_t low  = 0;
+    for (int32_t i = 0; i < 4; ++i) {
+      high = (high << 16) | groups[i];
+      low  = (low << 16) | groups[i + 4];
+    }
+    d_high[idx] = high;
+    d_low[idx]  = low;
+  }
+};
+
+}  // namespace
+
+// Convert strings column of IPv6 addresses to the two halves of their integers
+std::unique_ptr<table> ipv6_to_integers(
+  strings_column_view const& strings,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0)
+{
+  size_type strings_count = strings.size();
+  auto make_half          = [&] {
+    return make_numeric_column(data_type{type_id::UINT64},
+                               strings_count,
+                               copy_bitmask(strings.parent(), stream, mr),
+                               strings.null_count(),
+                               stream,
+                               mr);
+  };
+  auto high = make_half();
+  auto low  = make_half();
+  if (strings_count > 0) {
+    auto strings_column = column_device_view::create(strings.parent(), stream);
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       strings_count,
+                       ipv6_to_integers_fn{*strings_column,
+                                           high->mutable_view().data<uint64_t>(),
+                                           low->mutable_view().data<uint64_t>()});
+  }
+  std::vector<std::unique_ptr<column>> results;
+  results.push_back(std::move(high));
+  results.push_back(std::move(low));
+  return std::make_unique<table>(std::move(results));
+}
+
+}  // namespace detail
+
+// external API
+std::unique_ptr<table> ipv6_to_integers(strings_column_view const& strings,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::ipv6_to_integers(strings, mr);
+}
+
+}  // namespace strings
+}  // namespace cudf
@@ -17,16 +17,91 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/strings/convert/convert_urls.hpp>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <strings/utilities.cuh>
+#include <strings/utilities.hpp>
 
 namespace cudf {
 namespace strings {
 namespace detail {
 namespace {
+constexpr int url_block_size = 256;
+
+/**
+ * @brief Signature of the kernels converting each string with the threads of a warp.
+ *
+ * With a null `d_chars`, the kernel sets the output size of each string in `d_sizes`.
+ * Otherwise it writes each string to `d_chars` at its offset in `d_offsets`.
+ */
+using warp_url_kernel = void (*)(column_device_view const, int32_t const*, char*, size_type*);
+
+/**
+ * @brief Converts the strings with a warp per string: a sizes pass, then a writing pass.
+ */
+std::unique_ptr<column> convert_with_warps(strings_column_view const& strings,
+                                           warp_url_kernel kernel,
+                                           rmm::mr::device_memory_resource* mr,
+                                           cudaStream_t stream)
+{
+  auto const strings_count = strings.size();
+  auto strings_column      = column_device_view::create(strings.parent(), stream);
+  auto d_strings           = *strings_column;
+
+  constexpr size_type warps_per_block = url_block_size / cudf::detail::warp_size;
+  auto const blocks = util::div_rounding_up_safe(strings_count, warps_per_block);
+
+  rmm::device_vector<size_type> sizes(strings_count);
+  kernel<<<blocks, url_block_size, 0, stream>>>(d_strings, nullptr, nullptr, sizes.data().get());
+  CHECK_CUDA(stream);
+  auto offsets_column = make_offsets_child_column(sizes.begin(), sizes.end(), mr, stream);
+  auto d_offsets      = offsets_column->view().data<int32_t>();
+
+  auto chars_column =
+    create_chars_child_column(strings_count,
+                              strings.null_count(),
+                              thrust::device_pointer_cast(d_offsets)[strings_count],
+                              mr,
+                              stream);
+  kernel<<<blocks, url_block_size, 0, stream>>>(
+    d_strings, d_offsets, chars_column->mutable_view().data<char>(), nullptr);
+  CHECK_CUDA(stream);
+
+  return make_strings_column(strings_count,
+                             std::move(offsets_column),
+                             std::move(chars_column),
+                             strings.null_count(),
+                             copy_bitmask(strings.parent(), stream, mr),
+                             stream,
+                             mr);
+}
+
+// utility to create 2-byte hex characters from single binary byte
+__device__ void byte_to_hex(uint8_t byte, char* hex)
+{
+  hex[0] = '0';
+  if (byte >= 16) {
+    uint8_t hibyte = byte / 16;
+    hex[0]         = hibyte < 10 ? '0' + hibyte : 'A' + (hibyte - 10);
+    byte           = byte - (hibyte * 16);
+  }
+  hex[1] = byte < 10 ? '0' + byte : 'A' + (byte - 10);
+}
+
+__device__ bool should_not_url_encode(char ch)
+{
+  return (
+    (ch >= '0' && ch <= '9') ||  // these are the characters
+    (ch >= 'A' && ch <= 'Z') ||  // that are not to be url encoded
+    (ch >= 'a' &&
+     ch <= 'z') ||  // reference: docs.python.org/3/library/urllib.parse.html#urllib.parse.quote
+    (ch == '.') ||
+    (ch == '_') || (ch == '~') || (ch == '-'));
+}
+
 //
 // This is the functor for the url_encode() method below.
 // Specific requirements are documented in custrings issue #321.
@@ -41,29 +116,6 @@ struct url_encoder_fn {
   int32_t const* d_offsets{};
   char* d_chars{};
 
-  // utility to create 2-byte hex characters from single binary byte
-  __device__ void byte_to_hex(uint8_t byte, char* hex)
-  {
-    hex[0] = '0';
-    if (byte >= 16) {
-      uint8_t hibyte = byte / 16;
-      hex[0]         = hibyte < 10 ? '0' + hibyte : 'A' + (hibyte - 10);
-      byte           = byte - (hibyte * 16);
-    }
-    hex[1] = byte < 10 ? '0' + byte : 'A' + (byte - 10);
-  }
-
-  __device__ bool should_not_url_encode(char ch)
-  {
-    return (
-      (ch >= '0' && ch <= '9') ||  // these are the characters
-      (ch >= 'A' && ch <= 'Z') ||  // that are not to be url encoded
-      (ch >= 'a' &&
-       ch <= 'z') ||  // reference: docs.python.org/3/library/urllib.parse.html#urllib.parse.quote
-      (ch == '.') ||
-      (ch == '_') || (ch == '~') || (ch == '-'));
-  }
-
   // main part of the functor the performs the url-encoding
   __device__ size_type operator()(size_type idx)
   {
@@ -105,6 +157,48 @@ struct url_encoder_fn {
   }
 };
 
+/**
+ * @brief Encodes each string with the threads of a warp, a byte per thread.
+ *
+ * Each byte of a character that is not ASCII is encoded on its own, so every byte is either
+ * copied or encoded into 3 characters independently of the others. The output position of
+ * each byte follows from a ballot of the encoded bytes of its tile of the string.
+ */
+__global__ void url_encode_warp_kernel(column_device_view const d_strings,
+                                       int32_t const* d_offsets,
+                                       char* d_chars,
+                                       size_type* d_sizes)
+{
+  auto const lane = static_cast<size_type>(threadIdx.x % cudf::detail::warp_size);
+  auto const idx  = static_cast<size_type>((threadIdx.x + blockIdx.x * blockDim.x) /
+                                          cudf::detail::warp_size);
+  if (idx >= d_strings.size()) return;
+  size_type nbytes = 0;
+  if (d_strings.is_valid(idx)) {
+    auto const d_str   = d_strings.element<string_view>(idx);
+    auto const in_ptr  = d_str.data();
+    auto const bytes   = d_str.size_bytes();
+    auto const out_ptr = d_chars ? d_chars + d_offsets[idx] : nullptr;
+    for (size_type base = 0; base < bytes; base += cudf::detail::warp_size) {
+      auto const pos     = base + lane;
+      auto const byte    = pos < bytes ? static_cast<uint8_t>(in_ptr[pos]) : uint8_t{0};
+      auto const encode  = (pos < bytes) && ((byte >= 128) || !should_not_url_encode(byte));
+      auto const encoded = __ballot_sync(0xffffffff, encode);
+      if (out_ptr && (pos < bytes)) {
+        auto const out = out_ptr + nbytes + lane + 2 * __popc(encoded & ((1u << lane) - 1));
+        if (encode) {
+          out[0] = '%';
+          byte_to_hex(byte, out + 1);
+        } else {
+          out[0] = static_cast<char>(byte);
+        }
+      }
+      nbytes += min(bytes - base, cudf::detail::warp_size) + 2 * __popc(encoded);
+    }
+  }
+  if (!d_chars && lane == 0) d_sizes[idx] = nbytes;
+}
+
 }  // namespace
 
 //
@@ -115,6 +209,9 @@ std::unique_ptr<column> url_encode(
 {
   size_type strings_count = strings.size();
   if (strings_count == 0) return make_empty_strings_column(mr, stream);
+  // long strings are encoded with a warp per string
+  if (get_string_parallelism(strings, stream) != string_parallelism::THREAD_PER_STRING)
+    return convert_with_warps(strings, url_encode_warp_kernel, mr, stream);
 
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_strings      = *strings_column;
@@ -160,6 +257,15 @@ std::unique_ptr<column> url_encode(strings_column_view const& strings,
 
 namespace detail {
 namespace {
+// utility to convert a hex char into a single byte
+__device__ uint8_t hex_char_to_byte(char ch)
+{
+  if (ch >= '0' && ch <= '9') return (ch - '0');
+  if (ch >= 'A' && ch <= 'F') return (ch - 'A' + 10);  // in hex A=10,B=11,...,F=15
+  if (ch >= 'a' && ch <= 'f') return (ch - 'a' + 10);  // same for lower case
+  return 0;
+}
+
 //
 // This is the functor for the url_decode() method below.
 // Specific requirements are documented in custrings issue #321.
@@ -175,15 +281,6 @@ struct url_decoder_fn {
   int32_t const* d_offsets{};
   char* d_chars{};
 
-  // utility to convert a hex char into a single byte
-  __device__ uint8_t hex_char_to_byte(char ch)
-  {
-    if (ch >= '0' && ch <= '9') return (ch - '0');
-    if (ch >= 'A' && ch <= 'F') return (ch - 'A' + 10);  // in hex A=10,B=11,...,F=15
-    if (ch >= 'a' && ch <= 'f') return (ch - 'a' + 10);  // same for lower case
-    return 0;
-  }
-
   // main functor method executed on each string
   __device__ size_type operator()(size_type idx)
   {
@@ -207,6 +304,67 @@ struct url_decoder_fn {
   }
 };
 
+/**
+ * @brief Decodes each string with the threads of a warp, a byte per thread.
+ *
+ * All the threads resolve the escapes of a tile of the string from a ballot of its '%'
+ * bytes: an escape starts at each '%' followed by 2 bytes that the escape before it does not
+ * consume. The 2 bytes of an escape produce no output, so the output position of each byte is
+ * the number of lower bytes producing output, from a second ballot.
+ */
+__global__ void url_decode_warp_kernel(column_device_view const d_strings,
+                                       int32_t const* d_offsets,
+                                       char* d_chars,
+                                       size_type* d_sizes)
+{
+  auto const lane = static_cast<size_type>(threadIdx.x % cudf::detail::warp_size);
+  auto const idx  = static_cast<size_type>((threadIdx.x + blockIdx.x * blockDim.x) /
+                                          cudf::detail::warp_size);
+  if (idx >= d_strings.size()) return;
+  size_type nbytes = 0;
+  if (d_strings.is_valid(idx)) {
+    auto const d_str   = d_strings.element<string_view>(idx);
+    auto const in_ptr  = d_str.data();
+    auto const bytes   = d_str.size_bytes();
+    auto const out_ptr = d_chars ? d_chars + d_offsets[idx] : nullptr;
+    size_type carry    = 0;  // bytes at the start of the tile consumed by the last escape
+    for (size_type base = 0; base < bytes; base += cudf::detail::warp_size) {
+      auto const pos     = base + lane;
+      auto const ch      = pos < bytes ? in_ptr[pos] : '\0';
+      auto const percent = __ballot_sync(0xffffffff, (ch == '%') && (pos + 2 < bytes));
+      // every thread resolves the escapes of the tile in order
+      uint32_t consumed   = (1u << carry) - 1;
+      uint32_t candidates = percent & ~consumed;
+      uint32_t starts     = 0;
+      carry               = 0;
+      while (candidates) {
+        auto const bit  = __ffs(candidates) - 1;
+        auto const next = bit + 3;  // first byte after the escape
+        starts |= 1u << bit;
+        if (next < cudf::detail::warp_size) {
+          candidates &= 0xffffffffu << next;
+        } else {
+          candidates = 0;
+          carry      = next - cudf::detail::warp_size;
+        }
+      }
+      consumed |= (starts << 1) | (starts << 2);
+      auto const output   = (pos < bytes) && !((consumed >> lane) & 1);
+      auto const produced = __ballot_sync(0xffffffff, output);
+      if (out_ptr && output) {
+        auto out = ch;
+        if ((starts >> lane) & 1) {
+          out = static_cast<char>(16 * hex_char_to_byte(in_ptr[pos + 1]) +
+                                  hex_char_to_byte(in_ptr[pos + 2]));
+        }
+        out_ptr[nbytes + __popc(produced & ((1u << lane) - 1))] = out;
+      }
+      nbytes += __popc(produced);
+    }
+  }
+  if (!d_chars && lane == 0) d_sizes[idx] = nbytes;
+}
+
 }  // namespace
 
 //
@@ -217,6 +375,9 @@ std::unique_ptr<column> url_decode(
 {
   size_type strings_count = strings.size();
   if (strings_count == 0) return make_empty_strings_column(mr, stream);
+  // long strings are decoded with a warp per string
+  if (get_string_parallelism(strings, stream) != string_parallelism::THREAD_PER_STRING)
+    return convert_with_warps(strings, url_decode_warp_kernel, mr, stream);
 
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_strings      = *strings_column;
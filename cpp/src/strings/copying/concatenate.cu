@@ -25,6 +25,7 @@
 
 #include <thrust/binary_search.h>
 #include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/transform_reduce.h>
 #include <thrust/transform_scan.h>
 
@@ -44,16 +45,34 @@ constexpr bool use_fused_kernel_heuristic(bool const has_nulls,
                    : total_bytes < num_columns * 393216;  // midpoint of 262144 and 524288
 }
 
-// Using a functor instead of a lambda as a workaround for:
-// error: The enclosing parent function ("create_strings_device_views") for an
-// extended __device__ lambda must not have deduced return type
+/**
+ * @brief The part of an input strings column read by the concatenate kernels
+ *
+ * The inputs are uploaded at once as plain pointers, where creating a `column_device_view` of
+ * each input takes an allocation and a copy of its own.
+ */
+struct strings_input {
+  int32_t const* offsets;         ///< The offsets of the strings, starting at the column offset
+  char const* chars;              ///< The chars of the column, not adjusted for its offset
+  bitmask_type const* null_mask;  ///< Null if the column has no null mask
+  size_type offset;
+
+  __device__ bool is_valid(size_type index) const
+  {
+    return null_mask == nullptr or bit_is_set(null_mask, offset + index);
+  }
+};
+
 struct chars_size_transform {
-  __device__ size_t operator()(column_device_view const& col) const
+  strings_input const* inputs;
+  size_t const* input_offsets;
+
+  __device__ size_t operator()(size_type index) const
   {
-    if (col.size() > 0) {
-      constexpr auto offsets_index = strings_column_view::offsets_column_index;
-      auto d_offsets               = col.child(offsets_index).data<int32_t>();
-      return d_offsets[col.size() + col.offset()] - d_offsets[col.offset()];
+    auto const size = input_offsets[index + 1] - input_offsets[index];
+    if (size > 0) {
+      auto const& input = inputs[index];
+      return input.offsets[size] - input.offsets[0];
     } else {
       return 0;
     }
@@ -62,57 +81,41 @@ struct chars_size_transform {
 
 auto create_strings_device_views(std::vector<column_view> const& views, cudaStream_t stream)
 {
-  // Create device views for each input view
-  using CDViewPtr =
-    decltype(column_device_view::create(std::declval<column_view>(), std::declval<cudaStream_t>()));
-  auto device_view_owners = std::vector<CDViewPtr>(views.size());
-  std::transform(
-    views.cbegin(), views.cend(), device_view_owners.begin(), [stream](auto const& col) {
-      return column_device_view::create(col, stream);
-    });
-
-  // Assemble contiguous array of device views
-  auto device_views = thrust::host_vector<column_device_view>();
-  device_views.reserve(views.size());
-  std::transform(device_view_owners.cbegin(),
-                 device_view_owners.cend(),
-                 std::back_inserter(device_views),
-                 [](auto const& col) { return *col; });
-  auto d_views = rmm::device_vector<column_device_view>{device_views};
-
-  // Compute the partition offsets and size of offset column
+  // Assemble the inputs and the partition offsets with one upload each
   // Note: Using 64-bit size_t so we can detect overflow of 32-bit size_type
-  auto input_offsets = thrust::host_vector<size_t>(views.size() + 1);
-  thrust::transform_inclusive_scan(
-    thrust::host,
-    device_views.cbegin(),
-    device_views.cend(),
-    std::next(input_offsets.begin()),
-    [](auto const& col) { return static_cast<size_t>(col.size()); },
-    thrust::plus<size_t>{});
+  auto inputs        = thrust::host_vector<strings_input>();
+  auto input_offsets = thrust::host_vector<size_t>();
+  inputs.reserve(views.size());
+  input_offsets.reserve(views.size() + 1);
+  input_offsets.push_back(0);
+  for (auto const& view : views) {
+    // empty column may not have children
+    auto input = strings_input{nullptr, nullptr, view.null_mask(), view.offset()};
+    if (view.size() > 0) {
+      input.offsets =
+        view.child(strings_column_view::offsets_column_index).data<int32_t>() + view.offset();
+      input.chars = view.child(strings_column_view::chars_column_index).data<char>();
+    }
+    inputs.push_back(input);
+    input_offsets.push_back(input_offsets.back() + view.size());
+  }
+  auto d_inputs              = rmm::device_vector<strings_input>{inputs};
   auto const d_input_offsets = rmm::device_vector<size_t>{input_offsets};
   auto const output_size     = input_offsets.back();
 
   // Compute the partition offsets and size of chars column
   // Note: Using 64-bit size_t so we can detect overflow of 32-bit size_type
-  // Note: Using separate transform and inclusive_scan because
-  // transform_inclusive_scan fails to compile with:
-  // error: the default constructor of "cudf::column_device_view" cannot be
-  // referenced -- it is a deleted function
-  auto d_partition_offsets = rmm::device_vector<size_t>(views.size() + 1);
-  thrust::transform(rmm::exec_policy(stream)->on(stream),
-                    d_views.cbegin(),
-                    d_views.cend(),
-                    std::next(d_partition_offsets.begin()),
-                    chars_size_transform{});
-  thrust::inclusive_scan(rmm::exec_policy(stream)->on(stream),
-                         d_partition_offsets.cbegin(),
-                         d_partition_offsets.cend(),
-                         d_partition_offsets.begin());
+  auto d_partition_offsets = rmm::device_vector<size_t>(views.size() + 1, 0);
+  thrust::transform_inclusive_scan(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(views.size()),
+    std::next(d_partition_offsets.begin()),
+    chars_size_transform{d_inputs.data().get(), d_input_offsets.data().get()},
+    thrust::plus<size_t>{});
   auto const output_chars_size = d_partition_offsets.back();
 
-  return std::make_tuple(std::move(device_view_owners),
-                         std::move(d_views),
+  return std::make_tuple(std::move(d_inputs),
                          std::move(d_input_offsets),
                          std::move(d_partition_offsets),
                          output_size,
@@ -120,10 +123,10 @@ auto create_strings_device_views(std::vector<column_view> const& views, cudaStre
 }
 
 template <size_type block_size, bool Nullable>
-__global__ void fused_concatenate_string_offset_kernel(column_device_view const* input_views,
+__global__ void fused_concatenate_string_offset_kernel(strings_input const* inputs,
                                                        size_t const* input_offsets,
                                                        size_t const* partition_offsets,
-                                                       size_type const num_input_views,
+                                                       size_type const num_inputs,
                                                        size_type const output_size,
                                                        size_type* output_data,
                                                        bitmask_type* output_mask,
@@ -138,21 +141,19 @@ __global__ void fused_concatenate_string_offset_kernel(column_device_view const*
     // Lookup input index by searching for output index in offsets
     // thrust::prev isn't in CUDA 10.0, so subtracting 1 here instead
     auto const offset_it =
-      -1 + thrust::upper_bound(
-             thrust::seq, input_offsets, input_offsets + num_input_views, output_index);
+      -1 +
+      thrust::upper_bound(thrust::seq, input_offsets, input_offsets + num_inputs, output_index);
     size_type const partition_index = offset_it - input_offsets;
 
-    auto const offset_index      = output_index - *offset_it;
-    auto const& input_view       = input_views[partition_index];
-    constexpr auto offsets_child = strings_column_view::offsets_column_index;
-    auto const* input_data       = input_view.child(offsets_child).data<int32_t>();
+    auto const offset_index   = output_index - *offset_it;
+    auto const& input         = inputs[partition_index];
     output_data[output_index] =
-      input_data[offset_index + input_view.offset()]  // handle parent offset
-      - input_data[input_view.offset()]               // subract first offset if non-zero
-      + partition_offsets[partition_index];           // add offset of source column
+      input.offsets[offset_index]            // offsets start at the parent offset
+      - input.offsets[0]                     // subract first offset if non-zero
+      + partition_offsets[partition_index];  // add offset of source column
 
     if (Nullable) {
-      bool const bit_is_set       = input_view.is_valid(offset_index);
+      bool const bit_is_set       = input.is_valid(offset_index);
       bitmask_type const new_word = __ballot_sync(active_mask, bit_is_set);
 
       // First thread writes bitmask word
@@ -168,9 +169,7 @@ __global__ void fused_concatenate_string_offset_kernel(column_device_view const*
   }
 
   // Fill final offsets index with total size of char data
-  if (output_index == output_size) {
-    output_data[output_size] = partition_offsets[num_input_views];
-  }
+  if (output_index == output_size) { output_data[output_size] = partition_offsets[num_inputs]; }
 
   if (Nullable) {
     using cudf::detail::single_lane_block_sum_reduce;
@@ -179,9 +178,9 @@ __global__ void fused_concatenate_string_offset_kernel(column_device_view const*
   }
 }
 
-__global__ void fused_concatenate_string_chars_kernel(column_device_view const* input_views,
+__global__ void fused_concatenate_string_chars_kernel(strings_input const* inputs,
                                                       size_t const* partition_offsets,
-                                                      size_type const num_input_views,
+                                                      size_type const num_inputs,
                                                       size_type const output_size,
                                                       char* output_data)
 {
@@ -192,20 +191,12 @@ __global__ void fused_concatenate_string_chars_kernel(column_device_view const*
     // thrust::prev isn't in CUDA 10.0, so subtracting 1 here instead
     auto const offset_it =
       -1 + thrust::upper_bound(
-             thrust::seq, partition_offsets, partition_offsets + num_input_views, output_index);
+             thrust::seq, partition_offsets, partition_offsets + num_inputs, output_index);
     size_type const partition_index = offset_it - partition_offsets;
 
-    auto const offset_index = output_index - *offset_it;
-    auto const& input_view  = input_views[partition_index];
-
-    constexpr auto offsets_child   = strings_column_view::offsets_column_index;
-    auto const* input_offsets_data = input_view.child(offsets_child).data<int32_t>();
-
-    constexpr auto chars_child   = strings_column_view::chars_column_index;
-    auto const* input_chars_data = input_view.child(chars_child).data<char>();
-
-    auto const first_char     = input_offsets_data[input_view.offset()];
-    output_data[output_index] = input_chars_data[offset_index + first_char];
+    auto const offset_index   = output_index - *offset_it;
+    auto const& input         = inputs[partition_index];
+    output_data[output_index] = input.chars[offset_index + input.offsets[0]];
 
     output_index += blockDim.x * gridDim.x;
   }
@@ -217,11 +208,11 @@ std::unique_ptr<column> concatenate(std::vector<column_view> const& columns,
 {
   // Compute output sizes
   auto const device_views         = create_strings_device_views(columns, stream);
-  auto const& d_views             = std::get<1>(device_views);
-  auto const& d_input_offsets     = std::get<2>(device_views);
-  auto const& d_partition_offsets = std::get<3>(device_views);
-  auto const strings_count        = std::get<4>(device_views);
-  auto const total_bytes          = std::get<5>(device_views);
+  auto const& d_inputs            = std::get<0>(device_views);
+  auto const& d_input_offsets     = std::get<1>(device_views);
+  auto const& d_partition_offsets = std::get<2>(device_views);
+  auto const strings_count        = std::get<3>(device_views);
+  auto const total_bytes          = std::get<4>(device_views);
   auto const offsets_count        = strings_count + 1;
 
   if (strings_count == 0) { return make_empty_strings_column(mr, stream); }
@@ -260,10 +251,10 @@ std::unique_ptr<column> concatenate(std::vector<column_view> const& columns,
     auto const kernel = has_nulls ? fused_concatenate_string_offset_kernel<block_size, true>
                                   : fused_concatenate_string_offset_kernel<block_size, false>;
     kernel<<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
-      d_views.data().get(),
+      d_inputs.data().get(),
       d_input_offsets.data().get(),
       d_partition_offsets.data().get(),
-      static_cast<size_type>(d_views.size()),
+      static_cast<size_type>(d_inputs.size()),
       strings_count,
       d_new_offsets,
       reinterpret_cast<bitmask_type*>(null_mask.data()),
@@ -280,9 +271,9 @@ std::unique_ptr<column> concatenate(std::vector<column_view> const& columns,
       cudf::detail::grid_1d config(total_bytes, block_size);
       auto const kernel = fused_concatenate_string_chars_kernel;
       kernel<<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
-        d_views.data().get(),
+        d_inputs.data().get(),
         d_partition_offsets.data().get(),
-        static_cast<size_type>(d_views.size()),
+        static_cast<size_type>(d_inputs.size()),
         total_bytes,
         d_new_chars);
     } else {
@@ -16,14 +16,13 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
-#include <cudf/detail/gather.hpp>
+#include <cudf/detail/gather.cuh>
+#include <cudf/detail/sequence.cuh>
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/strings/copying.hpp>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
-#include <thrust/sequence.h>
-
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -42,19 +41,12 @@ std::unique_ptr<cudf::column> slice(strings_column_view const& strings,
   if (end < 0 || end > strings_count) end = strings_count;
   CUDF_EXPECTS(((start >= 0) && (start < end)), "Invalid start parameter value.");
   strings_count = cudf::util::round_up_safe<size_type>((end - start), step);
-  //
-  auto execpol = rmm::exec_policy(stream);
-  // build indices
-  rmm::device_vector<size_type> indices(strings_count);
-  thrust::sequence(execpol->on(stream), indices.begin(), indices.end(), start, step);
-  // create a column_view as a wrapper of these indices
-  column_view indices_view(
-    data_type{type_id::INT32}, strings_count, indices.data().get(), nullptr, 0);
-  // build a new strings column from the indices
+  // gather the strings through the indices without materializing them
+  cudf::detail::affine_sequence<size_type> const indices{start, step, strings_count};
   auto sliced_table = cudf::detail::gather(table_view{{strings.parent()}},
-                                           indices_view,
-                                           cudf::detail::out_of_bounds_policy::NULLIFY,
-                                           cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                           indices.begin(),
+                                           indices.end(),
+                                           true,
                                            mr,
                                            stream)
                         ->release();
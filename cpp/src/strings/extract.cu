@@ -23,7 +23,7 @@
 #include <cudf/strings/extract.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
-#include <strings/regex/regex.cuh>
+#include <strings/regex/regex_program_impl.cuh>
 #include <strings/utilities.hpp>
 
 namespace cudf {
@@ -69,7 +69,7 @@ struct extract_fn {
 //
 std::unique_ptr<table> extract(
   strings_column_view const& strings,
-  std::string const& pattern,
+  regex_program const& program,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0)
 {
@@ -77,8 +77,8 @@ std::unique_ptr<table> extract(
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_strings      = *strings_column;
 
-  // compile regex into device object
-  auto prog   = reprog_device::create(pattern, get_character_flags_table(), strings_count, stream);
+  // device object of the compiled regex
+  auto prog   = program.get_impl()->get_device_program(strings_count, stream);
   auto d_prog = *prog;
   // extract should include groups
   int groups = d_prog.group_counts();
@@ -125,7 +125,15 @@ std::unique_ptr<table> extract(strings_column_view const& strings,
                                rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::extract(strings, pattern, mr);
+  return detail::extract(strings, *regex_program::create(pattern), mr);
+}
+
+std::unique_ptr<table> extract(strings_column_view const& strings,
+                               regex_program const& program,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::extract(strings, program, mr);
 }
 
 }  // namespace strings
@@ -17,25 +17,272 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/find.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/error.hpp>
+#include <strings/utilities.hpp>
 
+#include <cub/cub.cuh>
+#include <thrust/functional.h>
 #include <thrust/transform.h>
 
+#include <limits>
+
 namespace cudf {
 namespace strings {
 namespace detail {
 namespace {
+/**
+ * @brief The threads of a warp cooperating on a single string.
+ */
+struct warp_group {
+  __device__ size_type rank() const { return threadIdx.x % cudf::detail::warp_size; }
+  __device__ size_type size() const { return cudf::detail::warp_size; }
+
+  /**
+   * @brief Returns `total` plus the number of lower ranked threads with `flag` set,
+   * and adds the number of threads with `flag` set to `total`.
+   */
+  __device__ size_type exclusive_count(bool flag, size_type& total) const
+  {
+    auto const ballot = __ballot_sync(0xffffffff, flag);
+    auto const result = total + __popc(ballot & ((1u << rank()) - 1));
+    total += __popc(ballot);
+    return result;
+  }
+
+  /**
+   * @brief Returns the reduction of `value` over all the threads, to all the threads.
+   */
+  template <typename BinaryOp>
+  __device__ size_type reduce(size_type value, BinaryOp op) const
+  {
+    for (int offset = cudf::detail::warp_size / 2; offset > 0; offset /= 2)
+      value = op(value, __shfl_xor_sync(0xffffffff, value, offset));
+    return value;
+  }
+};
+
+/**
+ * @brief The threads of a block cooperating on a single string.
+ */
+template <int block_size>
+struct block_group {
+  using block_scan   = cub::BlockScan<size_type, block_size>;
+  using block_reduce = cub::BlockReduce<size_type, block_size>;
+  struct storage_type {
+    union {
+      typename block_scan::TempStorage scan;
+      typename block_reduce::TempStorage reduce;
+    } temp;
+    size_type result;
+  };
+
+  storage_type& storage;
+
+  __device__ size_type rank() const { return threadIdx.x; }
+  __device__ size_type size() const { return block_size; }
+
+  /**
+   * @copydoc warp_group::exclusive_count
+   */
+  __device__ size_type exclusive_count(bool flag, size_type& total) const
+  {
+    size_type count     = 0;
+    size_type aggregate = 0;
+    block_scan(storage.temp.scan).ExclusiveSum(static_cast<size_type>(flag), count, aggregate);
+    __syncthreads();  // temp storage is reused by the next call
+    count += total;
+    total += aggregate;
+    return count;
+  }
+
+  /**
+   * @copydoc warp_group::reduce
+   */
+  template <typename BinaryOp>
+  __device__ size_type reduce(size_type value, BinaryOp op) const
+  {
+    auto const result = block_reduce(storage.temp.reduce).Reduce(value, op);
+    if (threadIdx.x == 0) storage.result = result;
+    __syncthreads();
+    value = storage.result;
+    __syncthreads();
+    return value;
+  }
+};
+
+/**
+ * @brief Returns the character position of `target` in `d_string` found by the threads
+ * of `group`, with the same results as the `find` and `rfind` functors below.
+ *
+ * The characters of the string are located in tiles of `group.size()` bytes, then the
+ * target is compared at every byte position of a tile at once.
+ *
+ * @tparam forward Return the first position found if true, the last position otherwise.
+ */
+template <bool forward, typename Group>
+__device__ size_type find_in_string(Group const& group,
+                                    string_view d_string,
+                                    string_view d_target,
+                                    size_type start,
+                                    size_type stop)
+{
+  auto const d_chars = d_string.data();
+  auto const bytes   = d_string.size_bytes();
+  auto const rank    = group.rank();
+
+  // byte positions of the start and stop characters, and the number of characters
+  size_type spos   = bytes;
+  size_type epos   = bytes;
+  size_type length = 0;
+  for (size_type base = 0; base < bytes; base += group.size()) {
+    auto const pos      = base + rank;
+    auto const is_char  = (pos < bytes) && is_begin_utf8_char(d_chars[pos]);
+    auto const char_pos = group.exclusive_count(is_char, length);
+    if (is_char && (char_pos == start)) spos = pos;
+    if (is_char && (char_pos == stop)) epos = pos;
+  }
+  auto const min_fn = thrust::minimum<size_type>{};
+  auto const max_fn = thrust::maximum<size_type>{};
+  spos              = group.reduce(spos, min_fn);
+  epos              = group.reduce(epos, min_fn);
+
+  if (d_target.empty()) {
+    if (start > length) return -1;
+    if (forward) return start;
+    return ((stop < 0) || (stop > length)) ? length : stop;
+  }
+  if (forward && (epos < spos)) epos = bytes;  // find searches to the end if stop < start
+
+  // compare the target at each byte position, stopping at the first tile with a match
+  auto const tsize = d_target.size_bytes();
+  auto const none  = forward ? std::numeric_limits<size_type>::max() : -1;
+  auto found       = none;
+  for (size_type base = forward ? spos : epos - tsize;
+       (found == none) && (forward ? (base + tsize <= epos) : (base >= spos));
+       base += forward ? group.size() : -group.size()) {
+    auto const pos = forward ? base + rank : base - rank;
+    auto match     = (pos >= spos) && (pos + tsize <= epos);
+    for (size_type idx = 0; match && (idx < tsize); ++idx)
+      match = (d_chars[pos + idx] == d_target.data()[idx]);
+    auto const value = match ? pos : none;
+    found            = forward ? group.reduce(value, min_fn) : group.reduce(value, max_fn);
+  }
+  if (found == none) return -1;
+
+  // convert the byte position to a character position
+  size_type count = 0;
+  for (size_type pos = rank; pos < found; pos += group.size())
+    count += static_cast<size_type>(is_begin_utf8_char(d_chars[pos]));
+  return group.reduce(count, thrust::plus<size_type>{});
+}
+
+/**
+ * @brief Converts the position found in each string to the output value.
+ */
+struct position_fn {
+  __device__ int32_t operator()(size_type position) const { return position; }
+};
+struct found_fn {
+  __device__ bool operator()(size_type position) const { return position >= 0; }
+};
+
+constexpr int find_block_size = 256;
+
+/**
+ * @brief Kernel searching each string with the threads of a warp.
+ */
+template <bool forward, typename ResultType, typename ResultFn>
+__global__ void warp_find_kernel(column_device_view const d_strings,
+                                 string_view const d_target,
+                                 size_type start,
+                                 size_type stop,
+                                 ResultFn result_fn,
+                                 ResultType* d_results)
+{
+  warp_group const group{};
+  auto const idx = static_cast<size_type>((threadIdx.x + blockIdx.x * blockDim.x) /
+                                          cudf::detail::warp_size);
+  if (idx >= d_strings.size()) return;
+  size_type position = -1;
+  if (d_strings.is_valid(idx))
+    position =
+      find_in_string<forward>(group, d_strings.element<string_view>(idx), d_target, start, stop);
+  if (group.rank() == 0) d_results[idx] = result_fn(position);
+}
+
+/**
+ * @brief Kernel searching each string with the threads of a block.
+ */
+template <bool forward, typename ResultType, typename ResultFn>
+__global__ void block_find_kernel(column_device_view const d_strings,
+                                  string_view const d_target,
+                                  size_type start,
+                                  size_type stop,
+                                  ResultFn result_fn,
+                                  ResultType* d_results)
+{
+  __shared__ typename block_group<find_block_size>::storage_type storage;
+  block_group<find_block_size> const group{storage};
+  auto const idx     = static_cast<size_type>(blockIdx.x);
+  size_type position = -1;
+  if (d_strings.is_valid(idx))
+    position =
+      find_in_string<forward>(group, d_strings.element<string_view>(idx), d_target, start, stop);
+  if (group.rank() == 0) d_results[idx] = result_fn(position);
+}
+
+/**
+ * @brief Searches the strings with a warp or a block of threads per string.
+ *
+ * @tparam forward Find the first position of the target if true, the last position otherwise.
+ * @param parallelism Either `WARP_PER_STRING` or `BLOCK_PER_STRING`.
+ * @param d_strings Strings to search.
+ * @param d_target String to search for.
+ * @param start First character position to start the search.
+ * @param stop Last character position (exclusive) to end the search.
+ * @param result_fn Converts the position found to the output value.
+ * @param d_results Output values, one per string.
+ * @param stream CUDA stream used for kernel launches.
+ */
+template <bool forward, typename ResultType, typename ResultFn>
+void find_with_groups(string_parallelism parallelism,
+                      column_device_view const& d_strings,
+                      string_view const& d_target,
+                      size_type start,
+                      size_type stop,
+                      ResultFn result_fn,
+                      ResultType* d_results,
+                      cudaStream_t stream)
+{
+  auto const strings_count = d_strings.size();
+  if (strings_count == 0) return;
+  if (parallelism == string_parallelism::BLOCK_PER_STRING) {
+    block_find_kernel<forward><<<strings_count, find_block_size, 0, stream>>>(
+      d_strings, d_target, start, stop, result_fn, d_results);
+  } else {
+    constexpr size_type warps_per_block = find_block_size / cudf::detail::warp_size;
+    auto const blocks = util::div_rounding_up_safe(strings_count, warps_per_block);
+    warp_find_kernel<forward><<<blocks, find_block_size, 0, stream>>>(
+      d_strings, d_target, start, stop, result_fn, d_results);
+  }
+  CHECK_CUDA(stream);
+}
+
 /**
  * @brief Utility to return integer column indicating the postion of
  * target string within each string in a strings column.
  *
  * Null string entries return corresponding null output column entries.
  *
+ * Columns with long strings are searched with a warp or a block of threads per string.
+ *
+ * @tparam forward True if `pfn` returns the first position of the target, false for the last.
  * @tparam FindFunction Returns integer character position value given a string and target.
  *
  * @param strings Strings column to search for target.
@@ -47,7 +294,7 @@ namespace {
  * @param stream CUDA stream used for device memory operations and kernel launches.
  * @return New integer column with character position values.
  */
-template <typename FindFunction>
+template <bool forward, typename FindFunction>
 std::unique_ptr<column> find_fn(strings_column_view const& strings,
                                 string_scalar const& target,
                                 size_type start,
@@ -73,6 +320,13 @@ std::unique_ptr<column> find_fn(strings_column_view const& strings,
                                      mr);
   auto results_view = results->mutable_view();
   auto d_results    = results_view.data<int32_t>();
+  auto const parallelism = get_string_parallelism(strings, stream);
+  if (parallelism != string_parallelism::THREAD_PER_STRING) {
+    find_with_groups<forward>(
+      parallelism, d_strings, d_target, start, stop, position_fn{}, d_results, stream);
+    results->set_null_count(strings.null_count());
+    return results;
+  }
   // set the position values by evaluating the passed function
   thrust::transform(rmm::exec_policy(stream)->on(stream),
                     thrust::make_counting_iterator<size_type>(0),
@@ -107,7 +361,7 @@ std::unique_ptr<column> find(strings_column_view const& strings,
     return d_string.find(d_target, begin, end - begin);
   };
 
-  return find_fn(strings, target, start, stop, pfn, mr, stream);
+  return find_fn<true>(strings, target, start, stop, pfn, mr, stream);
 }
 
 std::unique_ptr<column> rfind(strings_column_view const& strings,
@@ -126,7 +380,7 @@ std::unique_ptr<column> rfind(strings_column_view const& strings,
     return d_string.rfind(d_target, begin, end - begin);
   };
 
-  return find_fn(strings, target, start, stop, pfn, mr, stream);
+  return find_fn<false>(strings, target, start, stop, pfn, mr, stream);
 }
 
 }  // namespace detail
@@ -168,14 +422,18 @@ namespace {
  * @param pfn Returns bool value if target is found in the given string.
  * @param mr Device memory resource used to allocate the returned column's device memory.
  * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param parallelism Threads per string, other than `THREAD_PER_STRING` only if `pfn`
+ *        returns whether the target is anywhere in the string.
  * @return New BOOL column.
  */
 template <typename BoolFunction>
-std::unique_ptr<column> contains_fn(strings_column_view const& strings,
-                                    string_scalar const& target,
-                                    BoolFunction pfn,
-                                    rmm::mr::device_memory_resource* mr,
-                                    cudaStream_t stream)
+std::unique_ptr<column> contains_fn(
+  strings_column_view const& strings,
+  string_scalar const& target,
+  BoolFunction pfn,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream,
+  string_parallelism parallelism = string_parallelism::THREAD_PER_STRING)
 {
   auto strings_count = strings.size();
   if (strings_count == 0) return make_empty_column(data_type{type_id::BOOL8});
@@ -201,6 +459,11 @@ std::unique_ptr<column> contains_fn(strings_column_view const& strings,
                                      mr);
   auto results_view = results->mutable_view();
   auto d_results    = results_view.data<bool>();
+  if (parallelism != string_parallelism::THREAD_PER_STRING) {
+    find_with_groups<true>(parallelism, d_strings, d_target, 0, -1, found_fn{}, d_results, stream);
+    results->set_null_count(strings.null_count());
+    return results;
+  }
   // set the bool values by evaluating the passed function
   thrust::transform(rmm::exec_policy(stream)->on(stream),
                     thrust::make_counting_iterator<size_type>(0),
@@ -287,7 +550,7 @@ std::unique_ptr<column> contains(
   auto pfn = [] __device__(string_view d_string, string_view d_target) {
     return d_string.find(d_target) >= 0;
   };
-  return contains_fn(strings, target, pfn, mr, stream);
+  return contains_fn(strings, target, pfn, mr, stream, get_string_parallelism(strings, stream));
 }
 
 std::unique_ptr<column> starts_with(
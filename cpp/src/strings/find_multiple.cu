@@ -17,13 +17,23 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/strings/find_multiple.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+#include <strings/utilities.hpp>
 
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
 #include <thrust/transform.h>
 
+#include <algorithm>
+#include <map>
+#include <queue>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -70,8 +80,205 @@ std::unique_ptr<column> find_multiple(
   return results;
 }
 
+namespace {
+/**
+ * @brief Aho-Corasick automaton of the patterns in device memory.
+ *
+ * The trie edges of each state are sorted by byte value in `labels` and `targets`, from
+ * `edge_offsets[state]` to `edge_offsets[state + 1]`. State 0 is the root.
+ */
+struct multi_pattern_device {
+  int32_t const* edge_offsets;
+  uint8_t const* labels;
+  int32_t const* targets;
+  int32_t const* failures;  // state of the longest proper suffix of each state in the trie
+  int32_t const* outputs;   // lowest id of the patterns ending at each state, or -1
+
+  __device__ int32_t next_state(int32_t state, uint8_t byte) const
+  {
+    while (true) {
+      auto const begin = labels + edge_offsets[state];
+      auto const end   = labels + edge_offsets[state + 1];
+      auto const itr   = thrust::lower_bound(thrust::seq, begin, end, byte);
+      if ((itr != end) && (*itr == byte)) return targets[itr - labels];
+      if (state == 0) return 0;
+      state = failures[state];
+    }
+  }
+
+  __device__ int32_t find(string_view const& d_str) const
+  {
+    int32_t state = 0;
+    if (outputs[state] >= 0) return outputs[state];  // empty pattern
+    auto const bytes = reinterpret_cast<uint8_t const*>(d_str.data());
+    for (size_type idx = 0; idx < d_str.size_bytes(); ++idx) {
+      state = next_state(state, bytes[idx]);
+      if (outputs[state] >= 0) return outputs[state];
+    }
+    return -1;
+  }
+};
+
+/**
+ * @brief Transforms the id of the first pattern found in each string, or -1 if none is found.
+ */
+template <typename Transform>
+struct find_any_fn {
+  column_device_view const d_strings;
+  multi_pattern_device const d_matcher;
+  Transform transform;
+
+  __device__ auto operator()(size_type idx) const
+  {
+    if (d_strings.is_null(idx)) return transform(-1);
+    return transform(d_matcher.find(d_strings.element<string_view>(idx)));
+  }
+};
+}  // namespace
 }  // namespace detail
 
+struct multi_pattern_matcher::matcher_impl {
+ public:
+  matcher_impl()                    = delete;
+  matcher_impl(matcher_impl const&) = delete;
+  matcher_impl& operator=(matcher_impl const&) = delete;
+
+  matcher_impl(strings_column_view const& patterns, cudaStream_t stream = 0)
+  {
+    CUDF_EXPECTS(patterns.size() > 0, "Must include at least one search pattern");
+    CUDF_EXPECTS(!patterns.has_nulls(), "Search patterns cannot contain null strings");
+    auto const h_patterns = detail::strings_to_host(patterns, stream);
+
+    // trie of the patterns
+    std::vector<std::map<uint8_t, int32_t>> edges(1);
+    std::vector<int32_t> h_outputs(1, -1);
+    for (size_type id = 0; id < static_cast<size_type>(h_patterns.size()); ++id) {
+      int32_t state = 0;
+      for (auto const ch : h_patterns[id]) {
+        auto const byte   = static_cast<uint8_t>(ch);
+        auto const result = edges[state].insert({byte, static_cast<int32_t>(edges.size())});
+        if (result.second) {
+          edges.emplace_back();
+          h_outputs.push_back(-1);
+        }
+        state = result.first->second;
+      }
+      if (h_outputs[state] < 0) { h_outputs[state] = id; }
+    }
+
+    // the failure links are resolved breadth-first so the shorter suffixes are known first
+    std::vector<int32_t> h_failures(edges.size(), 0);
+    std::queue<int32_t> states;
+    for (auto const& edge : edges[0]) { states.push(edge.second); }
+    while (!states.empty()) {
+      auto const state = states.front();
+      states.pop();
+      for (auto const& edge : edges[state]) {
+        auto const target = edge.second;
+        int32_t failure   = h_failures[state];
+        while (failure != 0 && edges[failure].count(edge.first) == 0) {
+          failure = h_failures[failure];
+        }
+        auto const itr     = edges[failure].find(edge.first);
+        h_failures[target] = (itr != edges[failure].end()) ? itr->second : 0;
+        // a state also reports the patterns ending at its suffixes
+        auto const suffix_output = h_outputs[h_failures[target]];
+        if (suffix_output >= 0 && (h_outputs[target] < 0 || suffix_output < h_outputs[target])) {
+          h_outputs[target] = suffix_output;
+        }
+        states.push(target);
+      }
+    }
+
+    std::vector<int32_t> h_edge_offsets{0};
+    std::vector<uint8_t> h_labels;
+    std::vector<int32_t> h_targets;
+    for (auto const& state_edges : edges) {
+      for (auto const& edge : state_edges) {
+        h_labels.push_back(edge.first);
+        h_targets.push_back(edge.second);
+      }
+      h_edge_offsets.push_back(h_labels.size());
+    }
+    _edge_offsets = h_edge_offsets;
+    _labels       = h_labels;
+    _targets      = h_targets;
+    _failures     = h_failures;
+    _outputs      = h_outputs;
+  }
+
+  /**
+   * @brief Sets the pattern id found in each string with `transform`.
+   */
+  template <typename ResultType, typename Transform>
+  std::unique_ptr<column> search(strings_column_view const& strings,
+                                 Transform transform,
+                                 rmm::mr::device_memory_resource* mr,
+                                 cudaStream_t stream = 0) const
+  {
+    auto const strings_count = strings.size();
+    auto results             = make_numeric_column(data_type{type_to_id<ResultType>()},
+                                       strings_count,
+                                       copy_bitmask(strings.parent(), stream, mr),
+                                       strings.null_count(),
+                                       stream,
+                                       mr);
+    if (strings_count == 0) return results;
+    auto strings_column = column_device_view::create(strings.parent(), stream);
+    auto d_strings      = *strings_column;
+    detail::multi_pattern_device const d_matcher{_edge_offsets.data().get(),
+                                                 _labels.data().get(),
+                                                 _targets.data().get(),
+                                                 _failures.data().get(),
+                                                 _outputs.data().get()};
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(strings_count),
+                      results->mutable_view().data<ResultType>(),
+                      detail::find_any_fn<Transform>{d_strings, d_matcher, transform});
+    results->set_null_count(strings.null_count());
+    return results;
+  }
+
+ private:
+  rmm::device_vector<int32_t> _edge_offsets;
+  rmm::device_vector<uint8_t> _labels;
+  rmm::device_vector<int32_t> _targets;
+  rmm::device_vector<int32_t> _failures;
+  rmm::device_vector<int32_t> _outputs;
+};
+
+namespace {
+struct pattern_found_fn {
+  __device__ bool operator()(int32_t id) const { return id >= 0; }
+};
+
+struct pattern_id_fn {
+  __device__ int32_t operator()(int32_t id) const { return id; }
+};
+}  // namespace
+
+multi_pattern_matcher::~multi_pattern_matcher() = default;
+
+multi_pattern_matcher::multi_pattern_matcher(strings_column_view const& patterns)
+  : impl{std::make_unique<const matcher_impl>(patterns)}
+{
+}
+
+std::unique_ptr<column> multi_pattern_matcher::contains_any(
+  strings_column_view const& strings, rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return impl->search<bool>(strings, pattern_found_fn{}, mr);
+}
+
+std::unique_ptr<column> multi_pattern_matcher::find_any(strings_column_view const& strings,
+                                                        rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return impl->search<int32_t>(strings, pattern_id_fn{}, mr);
+}
+
 // external API
 std::unique_ptr<column> find_multiple(strings_column_view const& strings,
                                       strings_column_view const& targets,
@@ -81,5 +288,21 @@ std::unique_ptr<column> find_multiple(strings_column_view const& strings,
   return detail::find_multiple(strings, targets, mr);
 }
 
+std::unique_ptr<column> contains_any(strings_column_view const& strings,
+                                     strings_column_view const& patterns,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return multi_pattern_matcher{patterns}.contains_any(strings, mr);
+}
+
+std::unique_ptr<column> find_any(strings_column_view const& strings,
+                                 strings_column_view const& patterns,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return multi_pattern_matcher{patterns}.find_any(strings, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
@@ -23,7 +23,7 @@
 #include <cudf/strings/findall.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
-#include <strings/regex/regex.cuh>
+#include <strings/regex/regex_program_impl.cuh>
 #include <strings/utilities.hpp>
 
 #include <thrust/extrema.h>
@@ -93,13 +93,18 @@ struct findall_fn {
 
 template <size_t stack_size>
 struct findall_count_fn : public findall_fn<stack_size> {
-  findall_count_fn(column_device_view const& strings, reprog_device& prog)
-    : findall_fn<stack_size>{strings, prog}
+  bool const* d_candidates;  // strings the pattern may match, or nullptr to search all strings
+
+  findall_count_fn(column_device_view const& strings,
+                   reprog_device& prog,
+                   bool const* d_candidates = nullptr)
+    : findall_fn<stack_size>{strings, prog}, d_candidates(d_candidates)
   {
   }
 
   __device__ size_type operator()(size_type idx)
   {
+    if (d_candidates && !d_candidates[idx]) return 0;
     // this one only cares about the column count
     return findall_fn<stack_size>::findall(idx).first;
   }
@@ -110,7 +115,7 @@ struct findall_count_fn : public findall_fn<stack_size> {
 //
 std::unique_ptr<table> findall_re(
   strings_column_view const& strings,
-  std::string const& pattern,
+  regex_program const& program,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0)
 {
@@ -118,9 +123,17 @@ std::unique_ptr<table> findall_re(
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_strings      = *strings_column;
 
-  auto d_flags = detail::get_character_flags_table();
-  // compile regex into device object
-  auto prog       = reprog_device::create(pattern, d_flags, strings_count, stream);
+  // a DFA quickly finds the strings without any match to skip them when counting the matches
+  rmm::device_vector<bool> candidates;
+  auto dfa = program.get_impl()->get_dfa(false, stream);
+  if (dfa) {
+    candidates.resize(strings_count);
+    dfa->matches(d_strings, candidates.data().get(), stream);
+  }
+  bool const* d_candidates = dfa ? candidates.data().get() : nullptr;
+
+  // device object of the compiled regex
+  auto prog       = program.get_impl()->get_device_program(strings_count, stream);
   auto d_prog     = *prog;
   auto execpol    = rmm::exec_policy(stream);
   int regex_insts = prog->insts_counts();
@@ -133,19 +146,19 @@ std::unique_ptr<table> findall_re(
                       thrust::make_counting_iterator<size_type>(0),
                       thrust::make_counting_iterator<size_type>(strings_count),
                       d_find_counts,
-                      findall_count_fn<RX_STACK_SMALL>{d_strings, d_prog});
+                      findall_count_fn<RX_STACK_SMALL>{d_strings, d_prog, d_candidates});
   else if (regex_insts <= RX_MEDIUM_INSTS)
     thrust::transform(execpol->on(stream),
                       thrust::make_counting_iterator<size_type>(0),
                       thrust::make_counting_iterator<size_type>(strings_count),
                       d_find_counts,
-                      findall_count_fn<RX_STACK_MEDIUM>{d_strings, d_prog});
+                      findall_count_fn<RX_STACK_MEDIUM>{d_strings, d_prog, d_candidates});
   else
     thrust::transform(execpol->on(stream),
                       thrust::make_counting_iterator<size_type>(0),
                       thrust::make_counting_iterator<size_type>(strings_count),
                       d_find_counts,
-                      findall_count_fn<RX_STACK_LARGE>{d_strings, d_prog});
+                      findall_count_fn<RX_STACK_LARGE>{d_strings, d_prog, d_candidates});
 
   std::vector<std::unique_ptr<column>> results;
 
@@ -198,7 +211,15 @@ std::unique_ptr<table> findall_re(strings_column_view const& strings,
                                   rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::findall_re(strings, pattern, mr);
+  return detail::findall_re(strings, *regex_program::create(pattern), mr);
+}
+
+std::unique_ptr<table> findall_re(strings_column_view const& strings,
+                                  regex_program const& program,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::findall_re(strings, program, mr);
 }
 
 }  // namespace strings
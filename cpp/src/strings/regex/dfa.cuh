@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column_device_view.cuh>
+
+#include <rmm/device_buffer.hpp>
+
+#include <cuda_runtime.h>
+#include <memory>
+#include <string>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+
+// largest transition table of a DFA, which must fit in the shared memory of a block
+constexpr size_t MAX_DFA_TABLES_SIZE = 32 * 1024;
+
+/**
+ * @brief Layout of the tables of a DFA within a single device buffer.
+ *
+ * The characters are mapped to a few classes of characters which the regex instructions do not
+ * distinguish. Characters below 128 are mapped directly. Other characters are first found in
+ * the sorted `bounds` of character ranges and, when the pattern uses builtin classes like `\w`,
+ * combined with the builtin flags of the character.
+ */
+struct dfa_layout {
+  size_t bounds_offset;          // char32_t per range: lower bound of the range
+  size_t transitions_offset;     // int16_t per (state, class): next state
+  size_t state_flags_offset;     // uint8_t per state: accepting or dead
+  size_t ascii_classes_offset;   // uint8_t per character below 128: class
+  size_t symbol_classes_offset;  // uint8_t per range, or per (range, builtin flags): class
+  size_t size;
+  int32_t bounds_count;
+  int32_t classes_count;
+  int32_t start_state;
+  bool uses_builtins;
+};
+
+/**
+ * @brief Deterministic automaton evaluating whether a regex pattern matches a string.
+ *
+ * Only built for patterns whose instructions are all characters, character classes,
+ * alternations and groups: there are no anchors, word boundaries or results other than
+ * matching, so each string is evaluated with a single table lookup per character instead of
+ * tracking the set of active instructions of `reprog_device`.
+ */
+class reprog_dfa {
+ public:
+  /**
+   * @brief Builds the DFA of a regex pattern, or returns nullptr if the pattern is not
+   * supported or its DFA is too large for the shared memory of a block.
+   *
+   * @param pattern The regex pattern to compile.
+   * @param anchored Only match at the beginning of the strings.
+   * @param codepoint_flags The code-point lookup table for character types.
+   * @param stream CUDA stream used for device memory operations.
+   */
+  static std::unique_ptr<reprog_dfa> create(std::string const& pattern,
+                                            bool anchored,
+                                            uint8_t const* codepoint_flags,
+                                            cudaStream_t stream = 0);
+
+  /**
+   * @brief Sets `d_results[i]` to whether the pattern matches string `i`; null strings do not
+   * match.
+   *
+   * The tables are loaded in shared memory once per block.
+   */
+  void matches(column_device_view const& d_strings, bool* d_results, cudaStream_t stream) const;
+
+  reprog_dfa(dfa_layout const& layout, uint8_t const* codepoint_flags, rmm::device_buffer&& tables)
+    : _layout(layout), _codepoint_flags(codepoint_flags), _tables(std::move(tables))
+  {
+  }
+
+ private:
+  dfa_layout _layout;
+  uint8_t const* _codepoint_flags;
+  rmm::device_buffer _tables;
+};
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
@@ -123,6 +123,12 @@ class reprog {
   int32_t _num_capturing_groups;
 };
 
+/**
+ * @brief Converts a UTF-8 regex pattern into the 0-terminated 32-bit characters
+ * expected by `reprog::create_from`.
+ */
+std::vector<char32_t> string_to_char32_vector(std::string const& pattern);
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
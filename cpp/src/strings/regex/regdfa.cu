@@ -0,0 +1,403 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <strings/char_types/is_flags.h>
+#include <strings/regex/dfa.cuh>
+#include <strings/regex/regcomp.h>
+#include <strings/utilities.cuh>
+
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <vector>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+namespace {
+// flags of a character tested by the builtin classes; none for characters past 0xFFFF
+constexpr uint8_t HAS_FLAGS           = 1;
+constexpr uint8_t ALPHANUM_FLAG       = 2;
+constexpr uint8_t SPACE_FLAG          = 4;
+constexpr uint8_t DIGIT_FLAG          = 8;
+constexpr int32_t BUILTIN_FLAGS_COUNT = 16;
+
+// flags of a DFA state
+constexpr uint8_t ACCEPTING_STATE = 1;
+constexpr uint8_t DEAD_STATE      = 2;
+
+CUDA_HOST_DEVICE_CALLABLE uint8_t builtin_flags(uint8_t codepoint_flags)
+{
+  return HAS_FLAGS | (IS_ALPHANUM(codepoint_flags) ? ALPHANUM_FLAG : 0) |
+         (IS_SPACE(codepoint_flags) ? SPACE_FLAG : 0) |
+         (IS_DIGIT(codepoint_flags) ? DIGIT_FLAG : 0);
+}
+
+/**
+ * @brief Host version of `reclass_device::is_match` for a character with the given builtin flags.
+ */
+bool class_matches(reclass const& cls, char32_t ch, uint8_t flags)
+{
+  for (size_t i = 0; i + 1 < cls.literals.size(); i += 2) {
+    if ((ch >= cls.literals[i]) && (ch <= cls.literals[i + 1])) return true;
+  }
+  if (!cls.builtins || !(flags & HAS_FLAGS)) return false;
+  bool const alphanum = flags & ALPHANUM_FLAG;
+  bool const space    = flags & SPACE_FLAG;
+  bool const digit    = flags & DIGIT_FLAG;
+  if ((cls.builtins & 1) && ((ch == '_') || alphanum)) return true;                  // \w
+  if ((cls.builtins & 2) && space) return true;                                      // \s
+  if ((cls.builtins & 4) && digit) return true;                                      // \d
+  if ((cls.builtins & 8) && ((ch != '\n') && (ch != '_') && !alphanum)) return true;  // \W
+  if ((cls.builtins & 16) && !space) return true;                                    // \S
+  if ((cls.builtins & 32) && ((ch != '\n') && !digit)) return true;                  // \D
+  return false;
+}
+
+/**
+ * @brief Builds the tables of the DFA of a regex program with the subset construction.
+ *
+ * The DFA states are the sets of active character-consuming and END instructions.
+ */
+class dfa_builder {
+ public:
+  dfa_builder(reprog& prog, bool anchored) : _prog(prog), _anchored(anchored)
+  {
+    for (auto ids = prog.starts_data(); *ids >= 0; ++ids) { _start_ids.push_back(*ids); }
+  }
+
+  /**
+   * @brief Returns false if the program has instructions the DFA cannot evaluate.
+   */
+  bool is_supported()
+  {
+    _consuming_index.assign(_prog.insts_count(), -1);
+    for (int32_t id = 0; id < _prog.insts_count(); ++id) {
+      auto const& inst = _prog.inst_at(id);
+      if (inst.type == CCLASS || inst.type == NCCLASS) {
+        _uses_builtins |= _prog.class_at(inst.u1.cls_id).builtins != 0;
+      }
+      switch (inst.type) {
+        case CCLASS:
+        case NCCLASS:
+        case CHAR:
+        case ANY:
+        case ANYNL:
+          _consuming_index[id] = _consuming.size();
+          _consuming.push_back(id);
+          break;
+        case OR:
+        case LBRA:
+        case RBRA:
+        case END: break;
+        default: return false;  // anchors and word boundaries depend on the adjacent characters
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Builds the DFA, or returns false if it is larger than `MAX_DFA_TABLES_SIZE`.
+   */
+  bool build(uint8_t const* ascii_codepoint_flags)
+  {
+    build_classes(ascii_codepoint_flags);
+    if (_class_matches.size() > std::numeric_limits<uint8_t>::max()) { return false; }
+
+    add_state(closure(_start_ids));
+    for (size_t state = 0; state < _states.size(); ++state) {
+      bool const accepting = _state_flags[state] & ACCEPTING_STATE;
+      for (auto const& matches : _class_matches) {
+        // a match is final, so the accepting states never change
+        if (accepting) {
+          _transitions.push_back(state);
+          continue;
+        }
+        std::vector<int32_t> next_ids;
+        for (auto id : _states[state]) {
+          auto const index = _consuming_index[id];
+          if (index >= 0 && matches[index]) { next_ids.push_back(_prog.inst_at(id).u2.next_id); }
+        }
+        // a match may begin at any character unless anchored
+        if (!_anchored) { next_ids.insert(next_ids.end(), _start_ids.begin(), _start_ids.end()); }
+        _transitions.push_back(add_state(closure(next_ids)));
+      }
+      if (_states.size() * _class_matches.size() * sizeof(int16_t) > MAX_DFA_TABLES_SIZE) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Returns the tables of the DFA in the layout described by `layout`.
+   */
+  std::vector<uint8_t> tables(dfa_layout& layout) const
+  {
+    layout.bounds_count  = _bounds.size();
+    layout.classes_count = _class_matches.size();
+    layout.start_state   = 0;
+    layout.uses_builtins = _uses_builtins;
+
+    layout.bounds_offset         = 0;
+    layout.transitions_offset    = _bounds.size() * sizeof(char32_t);
+    layout.state_flags_offset =
+      layout.transitions_offset + _transitions.size() * sizeof(int16_t);
+    layout.ascii_classes_offset  = layout.state_flags_offset + _state_flags.size();
+    layout.symbol_classes_offset = layout.ascii_classes_offset + _ascii_classes.size();
+    layout.size                  = cudf::util::round_up_safe(
+      layout.symbol_classes_offset + _symbol_classes.size(), sizeof(int32_t));
+
+    std::vector<uint8_t> buffer(layout.size);
+    std::copy(_bounds.begin(),
+              _bounds.end(),
+              reinterpret_cast<char32_t*>(buffer.data() + layout.bounds_offset));
+    std::copy(_transitions.begin(),
+              _transitions.end(),
+              reinterpret_cast<int16_t*>(buffer.data() + layout.transitions_offset));
+    std::copy(
+      _state_flags.begin(), _state_flags.end(), buffer.begin() + layout.state_flags_offset);
+    std::copy(
+      _ascii_classes.begin(), _ascii_classes.end(), buffer.begin() + layout.ascii_classes_offset);
+    std::copy(_symbol_classes.begin(),
+              _symbol_classes.end(),
+              buffer.begin() + layout.symbol_classes_offset);
+    return buffer;
+  }
+
+ private:
+  reprog& _prog;
+  bool _anchored;
+  bool _uses_builtins{false};
+  std::vector<int32_t> _start_ids;
+  std::vector<int32_t> _consuming;        // ids of the character-consuming instructions
+  std::vector<int32_t> _consuming_index;  // index in `_consuming` of each instruction, or -1
+
+  std::vector<char32_t> _bounds;
+  std::map<std::vector<bool>, int32_t> _class_ids;
+  std::vector<std::vector<bool>> _class_matches;  // consuming instructions matching each class
+  std::vector<uint8_t> _ascii_classes;
+  std::vector<uint8_t> _symbol_classes;
+
+  std::map<std::vector<int32_t>, int32_t> _state_ids;
+  std::vector<std::vector<int32_t>> _states;
+  std::vector<uint8_t> _state_flags;
+  std::vector<int16_t> _transitions;
+
+  // returns the class of the characters matched by the same instructions as `ch`
+  uint8_t class_of(char32_t ch, uint8_t flags)
+  {
+    std::vector<bool> matches(_consuming.size());
+    std::transform(_consuming.begin(), _consuming.end(), matches.begin(), [&](int32_t id) {
+      auto const& inst = _prog.inst_at(id);
+      switch (inst.type) {
+        case CHAR: return inst.u1.c == ch;
+        case ANY: return ch != '\n';
+        case ANYNL: return true;
+        case CCLASS: return class_matches(_prog.class_at(inst.u1.cls_id), ch, flags);
+        default: return !class_matches(_prog.class_at(inst.u1.cls_id), ch, flags);  // NCCLASS
+      }
+    });
+    auto const result = _class_ids.insert({matches, _class_matches.size()});
+    if (result.second) { _class_matches.push_back(matches); }
+    return static_cast<uint8_t>(result.first->second);
+  }
+
+  void build_classes(uint8_t const* ascii_codepoint_flags)
+  {
+    // split the characters into ranges that every instruction matches entirely or not at all
+    _bounds = {0, '\n', '\n' + 1, '_', '_' + 1, 128};
+    auto add_range = [this](char32_t first, char32_t last) {
+      _bounds.push_back(first);
+      if (last < std::numeric_limits<char32_t>::max()) { _bounds.push_back(last + 1); }
+    };
+    for (auto id : _consuming) {
+      auto const& inst = _prog.inst_at(id);
+      if (inst.type == CHAR) { add_range(inst.u1.c, inst.u1.c); }
+      if (inst.type == CCLASS || inst.type == NCCLASS) {
+        auto const& literals = _prog.class_at(inst.u1.cls_id).literals;
+        for (size_t i = 0; i + 1 < literals.size(); i += 2) {
+          add_range(literals[i], literals[i + 1]);
+        }
+      }
+    }
+    std::sort(_bounds.begin(), _bounds.end());
+    _bounds.erase(std::unique(_bounds.begin(), _bounds.end()), _bounds.end());
+
+    for (char32_t ch = 0; ch < 128; ++ch) {
+      _ascii_classes.push_back(
+        class_of(ch, _uses_builtins ? builtin_flags(ascii_codepoint_flags[ch]) : 0));
+    }
+    int32_t const flags_count = _uses_builtins ? BUILTIN_FLAGS_COUNT : 1;
+    for (auto bound : _bounds) {
+      for (int32_t flags = 0; flags < flags_count; ++flags) {
+        _symbol_classes.push_back(class_of(bound, flags));
+      }
+    }
+  }
+
+  // returns the instructions reached from `ids` without consuming a character
+  std::vector<int32_t> closure(std::vector<int32_t> ids) const
+  {
+    std::vector<bool> visited(_prog.insts_count(), false);
+    std::vector<int32_t> result;
+    while (!ids.empty()) {
+      auto const id = ids.back();
+      ids.pop_back();
+      if (visited[id]) continue;
+      visited[id]      = true;
+      auto const& inst = _prog.inst_at(id);
+      switch (inst.type) {
+        case OR:
+          ids.push_back(inst.u1.right_id);
+          ids.push_back(inst.u2.left_id);
+          break;
+        case LBRA:
+        case RBRA: ids.push_back(inst.u2.next_id); break;
+        default: result.push_back(id);
+      }
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+
+  int16_t add_state(std::vector<int32_t> const& ids)
+  {
+    auto const result = _state_ids.insert({ids, _states.size()});
+    if (result.second) {
+      bool const accepting = std::any_of(
+        ids.begin(), ids.end(), [this](int32_t id) { return _prog.inst_at(id).type == END; });
+      _states.push_back(ids);
+      _state_flags.push_back(accepting ? ACCEPTING_STATE : (ids.empty() ? DEAD_STATE : 0));
+    }
+    return static_cast<int16_t>(result.first->second);
+  }
+};
+
+/**
+ * @brief The DFA tables in shared memory.
+ */
+struct dfa_device {
+  char32_t const* bounds;
+  int16_t const* transitions;
+  uint8_t const* state_flags;
+  uint8_t const* ascii_classes;
+  uint8_t const* symbol_classes;
+  uint8_t const* codepoint_flags;
+  dfa_layout layout;
+
+  __device__ int32_t char_class(char_utf8 ch) const
+  {
+    if (ch < 128) return ascii_classes[ch];
+    int32_t const range =
+      thrust::upper_bound(thrust::seq, bounds, bounds + layout.bounds_count, ch) - bounds - 1;
+    if (!layout.uses_builtins) return symbol_classes[range];
+    auto const codept   = utf8_to_codepoint(ch);
+    uint8_t const flags = codept > 0x00FFFF ? 0 : builtin_flags(codepoint_flags[codept]);
+    return symbol_classes[range * BUILTIN_FLAGS_COUNT + flags];
+  }
+
+  __device__ bool is_match(string_view const& d_str) const
+  {
+    int32_t state   = layout.start_state;
+    auto ptr        = d_str.data();
+    auto const last = ptr + d_str.size_bytes();
+    while (!(state_flags[state] & (ACCEPTING_STATE | DEAD_STATE)) && (ptr < last)) {
+      char_utf8 ch = 0;
+      ptr += to_char_utf8(ptr, ch);
+      if (ch == 0) break;  // like regexec, stop at a null character
+      state = transitions[state * layout.classes_count + char_class(ch)];
+    }
+    return state_flags[state] & ACCEPTING_STATE;
+  }
+};
+
+template <int block_size>
+__launch_bounds__(block_size) __global__ void dfa_matches_kernel(dfa_layout const layout,
+                                                                 int32_t const* tables,
+                                                                 uint8_t const* codepoint_flags,
+                                                                 column_device_view const d_strings,
+                                                                 bool* d_results)
+{
+  extern __shared__ int32_t shared_tables[];
+  for (size_t i = threadIdx.x; i < layout.size / sizeof(int32_t); i += block_size) {
+    shared_tables[i] = tables[i];
+  }
+  __syncthreads();
+
+  auto const base = reinterpret_cast<uint8_t const*>(shared_tables);
+  dfa_device const dfa{reinterpret_cast<char32_t const*>(base + layout.bounds_offset),
+                       reinterpret_cast<int16_t const*>(base + layout.transitions_offset),
+                       base + layout.state_flags_offset,
+                       base + layout.ascii_classes_offset,
+                       base + layout.symbol_classes_offset,
+                       codepoint_flags,
+                       layout};
+  for (size_type idx = threadIdx.x + blockIdx.x * block_size; idx < d_strings.size();
+       idx += block_size * gridDim.x) {
+    d_results[idx] = d_strings.is_valid(idx) && dfa.is_match(d_strings.element<string_view>(idx));
+  }
+}
+}  // namespace
+
+std::unique_ptr<reprog_dfa> reprog_dfa::create(std::string const& pattern,
+                                               bool anchored,
+                                               uint8_t const* codepoint_flags,
+                                               cudaStream_t stream)
+{
+  std::vector<char32_t> pattern32 = string_to_char32_vector(pattern);
+  reprog h_prog                   = reprog::create_from(pattern32.data());
+  dfa_builder builder(h_prog, anchored);
+  if (!builder.is_supported()) { return nullptr; }
+
+  // the classes of the ASCII characters are computed once on the host
+  std::vector<uint8_t> ascii_flags(128);
+  CUDA_TRY(cudaMemcpyAsync(
+    ascii_flags.data(), codepoint_flags, ascii_flags.size(), cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  if (!builder.build(ascii_flags.data())) { return nullptr; }
+
+  dfa_layout layout;
+  auto const h_tables = builder.tables(layout);
+  if (layout.size > MAX_DFA_TABLES_SIZE) { return nullptr; }
+  rmm::device_buffer d_tables(h_tables.data(), h_tables.size(), stream);
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  return std::make_unique<reprog_dfa>(layout, codepoint_flags, std::move(d_tables));
+}
+
+void reprog_dfa::matches(column_device_view const& d_strings,
+                         bool* d_results,
+                         cudaStream_t stream) const
+{
+  if (d_strings.size() == 0) { return; }
+  constexpr int block_size = 256;
+  // each block loads the tables once, so it evaluates several strings per thread
+  cudf::detail::grid_1d grid{d_strings.size(), block_size, 4};
+  auto const d_tables = static_cast<int32_t const*>(_tables.data());
+  dfa_matches_kernel<block_size><<<grid.num_blocks, block_size, _layout.size, stream>>>(
+    _layout, d_tables, _codepoint_flags, d_strings, d_results);
+  CHECK_CUDA(stream);
+}
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
@@ -77,6 +77,22 @@ class reprog_device {
     const uint8_t* cp_flags,
     int32_t strings_count,
     cudaStream_t stream = 0);
+
+  /**
+   * @brief Create device program instance sharing the instructions of an existing program.
+   *
+   * Only the state data required to evaluate `strings_count` strings is allocated, so a
+   * compiled program can be evaluated on many strings columns. The instructions of `prog` must
+   * outlive the returned object.
+   *
+   * @param prog The program whose instructions are evaluated.
+   * @param strings_count Number of strings that will be evaluated.
+   * @param stream CUDA stream for asynchronous memory allocations.
+   * @return The program device object.
+   */
+  static std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> create(
+    reprog_device const& prog, int32_t strings_count, cudaStream_t stream = 0);
+
   /**
    * @brief Called automatically by the unique_ptr returned from create().
    */
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/utilities/error.hpp>
+#include <strings/regex/regex_program_impl.cuh>
+#include <strings/utilities.hpp>
+
+#include <cstdlib>
+#include <list>
+#include <unordered_map>
+
+namespace cudf {
+namespace strings {
+namespace {
+constexpr size_t default_cache_size = 128;
+
+size_t get_cache_size_from_env()
+{
+  auto value = std::getenv("LIBCUDF_REGEX_CACHE_SIZE");
+  return value != nullptr ? std::stoul(value) : default_cache_size;
+}
+
+/**
+ * @brief Cache of the most recently used compiled programs, keyed by pattern.
+ */
+class program_cache {
+ public:
+  using program_ptr = std::shared_ptr<regex_program::regex_program_impl const>;
+
+  program_ptr get(std::string const& pattern)
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      auto const itr = _index.find(pattern);
+      if (itr != _index.end()) {
+        _entries.splice(_entries.begin(), _entries, itr->second);
+        return itr->second->second;
+      }
+    }
+    // compiled without the lock so other patterns are not blocked
+    auto program = std::make_shared<regex_program::regex_program_impl const>(pattern);
+    if (_capacity == 0) { return program; }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto const itr = _index.find(pattern);
+    if (itr != _index.end()) { return itr->second->second; }  // compiled by another thread
+    _entries.emplace_front(pattern, program);
+    _index[pattern] = _entries.begin();
+    if (_entries.size() > _capacity) {
+      _index.erase(_entries.back().first);
+      _entries.pop_back();
+    }
+    return program;
+  }
+
+ private:
+  using entries_type = std::list<std::pair<std::string, program_ptr>>;
+
+  std::mutex _mutex;
+  size_t const _capacity{get_cache_size_from_env()};
+  entries_type _entries;  // most recently used first
+  std::unordered_map<std::string, entries_type::iterator> _index;
+};
+
+program_cache& get_program_cache()
+{
+  // never destroyed, since device memory cannot be freed once the CUDA runtime is unloaded
+  static program_cache* cache = new program_cache;
+  return *cache;
+}
+}  // namespace
+
+regex_program::regex_program_impl::regex_program_impl(std::string const& pattern,
+                                                      cudaStream_t stream)
+  : _pattern{pattern},
+    _prog{detail::reprog_device::create(pattern, detail::get_character_flags_table(), 0, stream)}
+{
+}
+
+size_type regex_program::regex_program_impl::groups_count() const
+{
+  return _prog->group_counts();
+}
+
+regex_program::regex_program_impl::device_program
+regex_program::regex_program_impl::get_device_program(size_type strings_count,
+                                                      cudaStream_t stream) const
+{
+  return detail::reprog_device::create(*_prog, strings_count, stream);
+}
+
+detail::reprog_dfa const* regex_program::regex_program_impl::get_dfa(bool anchored,
+                                                                    cudaStream_t stream) const
+{
+  std::call_once(_dfa_built[anchored], [&] {
+    _dfas[anchored] = detail::reprog_dfa::create(
+      _pattern, anchored, detail::get_character_flags_table(), stream);
+  });
+  return _dfas[anchored].get();
+}
+
+regex_program::regex_program(std::string const& pattern,
+                             std::shared_ptr<regex_program_impl const> impl)
+  : _pattern{pattern}, _impl{std::move(impl)}
+{
+}
+
+regex_program::~regex_program() = default;
+
+std::unique_ptr<regex_program> regex_program::create(std::string const& pattern)
+{
+  CUDF_FUNC_RANGE();
+  return std::unique_ptr<regex_program>(
+    new regex_program(pattern, get_program_cache().get(pattern)));
+}
+
+std::string const& regex_program::pattern() const { return _pattern; }
+
+size_type regex_program::groups_count() const { return _impl->groups_count(); }
+
+regex_program::regex_program_impl const* regex_program::get_impl() const { return _impl.get(); }
+
+}  // namespace strings
+}  // namespace cudf
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/strings/regex_program.hpp>
+#include <strings/regex/dfa.cuh>
+#include <strings/regex/regex.cuh>
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace cudf {
+namespace strings {
+
+/**
+ * @brief Compiled regex program, with its instructions in device memory.
+ *
+ * The programs are shared by the `regex_program` objects and the cache of compiled patterns, so
+ * they are never modified once compiled, except for the DFA which is built on first use.
+ */
+struct regex_program::regex_program_impl {
+ public:
+  using device_program = std::unique_ptr<detail::reprog_device,
+                                         std::function<void(detail::reprog_device*)>>;
+
+  regex_program_impl()                          = delete;
+  regex_program_impl(regex_program_impl const&) = delete;
+  regex_program_impl& operator=(regex_program_impl const&) = delete;
+
+  /**
+   * @brief Compiles the pattern and copies its instructions to device memory.
+   *
+   * @param pattern Regex pattern to compile.
+   * @param stream CUDA stream used for device memory operations.
+   */
+  regex_program_impl(std::string const& pattern, cudaStream_t stream = 0);
+
+  /**
+   * @brief Returns the number of capturing groups of the pattern.
+   */
+  size_type groups_count() const;
+
+  /**
+   * @brief Returns a device program to evaluate `strings_count` strings.
+   *
+   * Only the state data of large programs is allocated, the instructions are shared.
+   *
+   * @param strings_count Number of strings that will be evaluated.
+   * @param stream CUDA stream used for device memory operations.
+   */
+  device_program get_device_program(size_type strings_count, cudaStream_t stream = 0) const;
+
+  /**
+   * @brief Returns the DFA of the pattern, or nullptr if the pattern has no DFA.
+   *
+   * The DFA is built on the first call for each value of `anchored`.
+   *
+   * @param anchored Only match at the beginning of the strings.
+   * @param stream CUDA stream used for device memory operations.
+   */
+  detail::reprog_dfa const* get_dfa(bool anchored, cudaStream_t stream = 0) const;
+
+ private:
+  std::string _pattern;
+  device_program _prog;
+  mutable std::once_flag _dfa_built[2];
+  mutable std::unique_ptr<detail::reprog_dfa> _dfas[2];
+};
+
+}  // namespace strings
+}  // namespace cudf
@@ -22,7 +22,6 @@
 namespace cudf {
 namespace strings {
 namespace detail {
-namespace {
 /**
  * @brief Converts UTF-8 string into fixed-width 32-bit character vector.
  *
@@ -52,8 +51,6 @@ std::vector<char32_t> string_to_char32_vector(std::string const& pattern)
   return result;
 }
 
-}  // namespace
-
 // Copy reprog primitive values
 reprog_device::reprog_device(reprog& prog)
   : _startinst_id{prog.get_start_inst()},
@@ -158,6 +155,25 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
   return std::unique_ptr<reprog_device, std::function<void(reprog_device*)>>(d_prog, deleter);
 }
 
+std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_device::create(
+  reprog_device const& prog, int32_t strings_count, cudaStream_t stream)
+{
+  reprog_device* d_prog = new reprog_device(prog);
+  // allocate execute memory if needed
+  rmm::device_buffer* d_relists{};
+  if (prog._insts_count > MAX_STACK_INSTS) {
+    auto relist_alloc_size = relist::alloc_size(prog._insts_count);
+    auto rlm_size          = relist_alloc_size * 2L * strings_count;  // reljunk has 2 relist ptrs
+    d_relists              = new rmm::device_buffer(rlm_size, stream);
+    d_prog->_relists_mem   = d_relists->data();
+  }
+  auto deleter = [d_relists](reprog_device* t) {
+    t->destroy();
+    delete d_relists;
+  };
+  return std::unique_ptr<reprog_device, std::function<void(reprog_device*)>>(d_prog, deleter);
+}
+
 void reprog_device::destroy() { delete this; }
 
 }  // namespace detail
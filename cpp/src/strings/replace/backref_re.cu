@@ -23,7 +23,7 @@
 #include <cudf/strings/replace_re.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
-#include <strings/regex/regex.cuh>
+#include <strings/regex/regex_program_impl.cuh>
 #include <strings/utilities.hpp>
 
 #include <regex>
@@ -79,7 +79,7 @@ std::string parse_backrefs(std::string const& repl, std::vector<backref_type>& b
 //
 std::unique_ptr<column> replace_with_backrefs(
   strings_column_view const& strings,
-  std::string const& pattern,
+  regex_program const& program,
   std::string const& repl,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0)
@@ -87,13 +87,13 @@ std::unique_ptr<column> replace_with_backrefs(
   auto strings_count = strings.size();
   if (strings_count == 0) return make_empty_strings_column(mr, stream);
 
-  CUDF_EXPECTS(!pattern.empty(), "Parameter pattern must not be empty");
+  CUDF_EXPECTS(!program.pattern().empty(), "Parameter pattern must not be empty");
   CUDF_EXPECTS(!repl.empty(), "Parameter repl must not be empty");
 
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_strings      = *strings_column;
-  // compile regex into device object
-  auto prog   = reprog_device::create(pattern, get_character_flags_table(), strings_count, stream);
+  // device object of the compiled regex
+  auto prog   = program.get_impl()->get_device_program(strings_count, stream);
   auto d_prog = *prog;
   auto regex_insts = d_prog.insts_counts();
 
@@ -146,7 +146,16 @@ std::unique_ptr<column> replace_with_backrefs(strings_column_view const& strings
                                               rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::replace_with_backrefs(strings, pattern, repl, mr);
+  return detail::replace_with_backrefs(strings, *regex_program::create(pattern), repl, mr);
+}
+
+std::unique_ptr<column> replace_with_backrefs(strings_column_view const& strings,
+                                              regex_program const& program,
+                                              std::string const& repl,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::replace_with_backrefs(strings, program, repl, mr);
 }
 
 }  // namespace strings
@@ -23,7 +23,7 @@
 #include <cudf/strings/replace_re.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
-#include <strings/regex/regex.cuh>
+#include <strings/regex/regex_program_impl.cuh>
 #include <strings/utilities.cuh>
 #include <strings/utilities.hpp>
 
@@ -146,13 +146,14 @@ std::unique_ptr<column> replace_re(
   auto d_strings      = *strings_column;
   auto repls_column   = column_device_view::create(repls.parent(), stream);
   auto d_repls        = *repls_column;
-  auto d_flags        = get_character_flags_table();
   // compile regexes into device objects
   size_type regex_insts = 0;
+  std::vector<std::unique_ptr<regex_program>> programs;
   std::vector<std::unique_ptr<reprog_device, std::function<void(reprog_device*)>>> h_progs;
   rmm::device_vector<reprog_device> progs;
   for (auto itr = patterns.begin(); itr != patterns.end(); ++itr) {
-    auto prog  = reprog_device::create(*itr, d_flags, strings_count, stream);
+    programs.emplace_back(regex_program::create(*itr));
+    auto prog  = programs.back()->get_impl()->get_device_program(strings_count, stream);
     auto insts = prog->insts_counts();
     if (insts > regex_insts) regex_insts = insts;
     progs.push_back(*prog);
@@ -21,9 +21,13 @@
 #include <cudf/strings/replace.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
+#include <strings/target_trie.cuh>
 #include <strings/utilities.cuh>
 #include <strings/utilities.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/count.h>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -75,7 +79,7 @@ struct replace_fn {
         out_ptr = copy_string(out_ptr, d_repl);                                         // copy repl
         last_pos = curr_pos + d_target.size_bytes();
       }
-      position = d_str.find(d_target, position + d_target.size_bytes());
+      position = d_str.find(d_target, position + d_target.length());
       --max_n;
     }
     if (Pass == two_pass::EXECUTE_OP)  // copy whats left (or right depending on your point of view)
@@ -84,6 +88,130 @@ struct replace_fn {
   }
 };
 
+/**
+ * @brief Returns true if a prefix of `target` is also its suffix.
+ *
+ * The occurrences of such a target may overlap in a string, so which ones are replaced
+ * depends on the ones found before them.
+ */
+bool has_overlapping_occurrences(std::string const& target)
+{
+  auto const size = target.size();
+  for (std::size_t length = 1; length < size; ++length)
+    if (target.compare(0, length, target, size - length, length) == 0) return true;
+  return false;
+}
+
+/**
+ * @brief Replaces every occurrence of the target with a thread per byte of the chars
+ * of all the strings, instead of a thread per string.
+ *
+ * Each output byte position is its input byte position shifted by the size difference
+ * of the occurrences located before it in its string. Only valid for targets without
+ * overlapping occurrences, so that every occurrence is replaced.
+ */
+std::unique_ptr<column> replace_char_parallel(strings_column_view const& strings,
+                                              string_view const& d_target,
+                                              string_view const& d_repl,
+                                              rmm::mr::device_memory_resource* mr,
+                                              cudaStream_t stream)
+{
+  auto const strings_count = strings.size();
+  auto const d_in_offsets  = strings.offsets().data<int32_t>() + strings.offset();
+  auto const d_in_chars    = strings.chars().data<char>();
+  size_type const first_offset = thrust::device_pointer_cast(d_in_offsets)[0];
+  size_type const last_offset  = thrust::device_pointer_cast(d_in_offsets)[strings_count];
+  auto strings_column          = column_device_view::create(strings.parent(), stream);
+  auto d_strings               = *strings_column;
+  auto execpol                 = rmm::exec_policy(stream);
+
+  // locate the target in the chars of the non-null strings
+  auto is_target = [d_strings, d_in_offsets, d_in_chars, d_target, strings_count] __device__(
+                     size_type pos) {
+    auto const tsize = d_target.size_bytes();
+    auto const idx   = static_cast<size_type>(
+      thrust::upper_bound(thrust::seq, d_in_offsets, d_in_offsets + strings_count, pos) -
+      d_in_offsets - 1);
+    if (d_strings.is_null(idx) || (pos + tsize > d_in_offsets[idx + 1])) return false;
+    for (size_type jdx = 0; jdx < tsize; ++jdx)
+      if (d_in_chars[pos + jdx] != d_target.data()[jdx]) return false;
+    return true;
+  };
+  auto const positions_count = thrust::count_if(execpol->on(stream),
+                                                thrust::make_counting_iterator(first_offset),
+                                                thrust::make_counting_iterator(last_offset),
+                                                is_target);
+  rmm::device_vector<size_type> positions(positions_count);
+  auto d_positions     = positions.data().get();
+  auto d_positions_end = d_positions + positions_count;
+  thrust::copy_if(execpol->on(stream),
+                  thrust::make_counting_iterator(first_offset),
+                  thrust::make_counting_iterator(last_offset),
+                  d_positions,
+                  is_target);
+
+  // each occurrence changes the size of its string by the same amount
+  auto const delta = d_repl.size_bytes() - d_target.size_bytes();
+  auto sizes_itr   = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    [d_strings, d_in_offsets, d_positions, d_positions_end, delta] __device__(size_type idx) {
+      if (d_strings.is_null(idx)) return 0;
+      auto const begin = d_in_offsets[idx];
+      auto const end   = d_in_offsets[idx + 1];
+      auto const count = thrust::lower_bound(thrust::seq, d_positions, d_positions_end, end) -
+                         thrust::lower_bound(thrust::seq, d_positions, d_positions_end, begin);
+      return (end - begin) + static_cast<size_type>(count) * delta;
+    });
+  auto offsets_column =
+    make_offsets_child_column(sizes_itr, sizes_itr + strings_count, mr, stream);
+  auto d_offsets = offsets_column->view().data<int32_t>();
+
+  // copy each byte, or the replacement for the first byte of each occurrence
+  size_type bytes = thrust::device_pointer_cast(d_offsets)[strings_count];
+  auto chars_column =
+    create_chars_child_column(strings_count, strings.null_count(), bytes, mr, stream);
+  auto d_chars = chars_column->mutable_view().data<char>();
+  thrust::for_each(
+    execpol->on(stream),
+    thrust::make_counting_iterator(first_offset),
+    thrust::make_counting_iterator(last_offset),
+    [d_strings,
+     d_in_offsets,
+     d_in_chars,
+     d_positions,
+     d_positions_end,
+     d_target,
+     d_repl,
+     delta,
+     strings_count,
+     d_offsets,
+     d_chars] __device__(size_type pos) {
+      auto const idx = static_cast<size_type>(
+        thrust::upper_bound(thrust::seq, d_in_offsets, d_in_offsets + strings_count, pos) -
+        d_in_offsets - 1);
+      if (d_strings.is_null(idx)) return;
+      auto const first = thrust::lower_bound(thrust::seq, d_positions, d_positions_end, pos);
+      // bytes within an occurrence are replaced by its first byte
+      if ((first != d_positions) && (pos < *(first - 1) + d_target.size_bytes())) return;
+      auto const string_first =
+        thrust::lower_bound(thrust::seq, d_positions, first, d_in_offsets[idx]);
+      auto const out_ptr = d_chars + d_offsets[idx] + (pos - d_in_offsets[idx]) +
+                           static_cast<size_type>(first - string_first) * delta;
+      if ((first != d_positions_end) && (*first == pos))
+        copy_string(out_ptr, d_repl);
+      else
+        *out_ptr = d_in_chars[pos];
+    });
+
+  return make_strings_column(strings_count,
+                             std::move(offsets_column),
+                             std::move(chars_column),
+                             strings.null_count(),
+                             copy_bitmask(strings.parent(), stream, mr),
+                             stream,
+                             mr);
+}
+
 }  // namespace
 
 //
@@ -104,6 +232,12 @@ std::unique_ptr<column> replace(
   string_view d_target(target.data(), target.size());
   string_view d_repl(repl.data(), repl.size());
 
+  // long strings are processed a byte per thread, instead of a string per thread
+  if ((maxrepl < 0) &&
+      (get_string_parallelism(strings, stream) != string_parallelism::THREAD_PER_STRING) &&
+      !has_overlapping_occurrences(target.to_string(stream)))
+    return replace_char_parallel(strings, d_target, d_repl, mr, stream);
+
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_strings      = *strings_column;
 
@@ -231,12 +365,14 @@ namespace {
  * @brief Function logic for the replace_multi API.
  *
  * This will perform the multi-replace operation on each string.
+ * The targets matching at each position are found with a single walk of their trie.
  */
 template <two_pass Pass = two_pass::SIZE_ONLY>
 struct replace_multi_fn {
   column_device_view const d_strings;
   column_device_view const d_targets;
   column_device_view const d_repls;
+  target_trie_device const d_trie;
   const int32_t* d_offsets{};
   char* d_chars{};
 
@@ -249,27 +385,23 @@ struct replace_multi_fn {
     const char* in_ptr = d_str.data();
     size_type size     = d_str.size_bytes();
     size_type bytes = size, spos = 0, lpos = 0;
-    while (spos < size) {  // check each character against each target
-      for (int tgt_idx = 0; tgt_idx < d_targets.size(); ++tgt_idx) {
+    while (spos < size) {  // find the first target starting at each character
+      auto const tgt_idx = d_trie.find_prefix(in_ptr + spos, size - spos);
+      if (tgt_idx >= 0) {  // found one
         string_view d_tgt = d_targets.element<string_view>(tgt_idx);
-        if ((d_tgt.size_bytes() <= (size - spos)) &&                  // check fit
-            (d_tgt.compare(in_ptr + spos, d_tgt.size_bytes()) == 0))  // does it match
-        {                                                             // found one
-          string_view d_repl;
-          if (d_repls.size() == 1)
-            d_repl = d_repls.element<string_view>(0);
-          else
-            d_repl = d_repls.element<string_view>(tgt_idx);
-          if (Pass == two_pass::SIZE_ONLY)
-            bytes += d_repl.size_bytes() - d_tgt.size_bytes();
-          else {
-            out_ptr = copy_and_increment(out_ptr, in_ptr + lpos, spos - lpos);
-            out_ptr = copy_string(out_ptr, d_repl);
-            lpos    = spos + d_tgt.size_bytes();
-          }
-          spos += d_tgt.size_bytes() - 1;
-          break;
+        string_view d_repl;
+        if (d_repls.size() == 1)
+          d_repl = d_repls.element<string_view>(0);
+        else
+          d_repl = d_repls.element<string_view>(tgt_idx);
+        if (Pass == two_pass::SIZE_ONLY)
+          bytes += d_repl.size_bytes() - d_tgt.size_bytes();
+        else {
+          out_ptr = copy_and_increment(out_ptr, in_ptr + lpos, spos - lpos);
+          out_ptr = copy_string(out_ptr, d_repl);
+          lpos    = spos + d_tgt.size_bytes();
         }
+        spos += d_tgt.size_bytes() - 1;
       }
       ++spos;
     }
@@ -303,13 +435,15 @@ std::unique_ptr<column> replace(
   auto d_targets      = *targets_column;
   auto repls_column   = column_device_view::create(repls.parent(), stream);
   auto d_repls        = *repls_column;
+  target_trie const trie(targets, stream);
+  auto const d_trie = trie.view();
 
   // copy the null mask
   rmm::device_buffer null_mask = copy_bitmask(strings.parent(), stream, mr);
   // build offsets column
   auto offsets_transformer_itr = thrust::make_transform_iterator(
     thrust::make_counting_iterator<int32_t>(0),
-    replace_multi_fn<two_pass::SIZE_ONLY>{d_strings, d_targets, d_repls});
+    replace_multi_fn<two_pass::SIZE_ONLY>{d_strings, d_targets, d_repls, d_trie});
   auto offsets_column = make_offsets_child_column(
     offsets_transformer_itr, offsets_transformer_itr + strings_count, mr, stream);
   auto d_offsets = offsets_column->view().data<int32_t>();
@@ -323,7 +457,8 @@ std::unique_ptr<column> replace(
     rmm::exec_policy(stream)->on(stream),
     thrust::make_counting_iterator<size_type>(0),
     strings_count,
-    replace_multi_fn<two_pass::EXECUTE_OP>{d_strings, d_targets, d_repls, d_offsets, d_chars});
+    replace_multi_fn<two_pass::EXECUTE_OP>{
+      d_strings, d_targets, d_repls, d_trie, d_offsets, d_chars});
   //
   return make_strings_column(strings_count,
                              std::move(offsets_column),
@@ -23,7 +23,7 @@
 #include <cudf/strings/replace_re.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
-#include <strings/regex/regex.cuh>
+#include <strings/regex/regex_program_impl.cuh>
 #include <strings/utilities.cuh>
 #include <strings/utilities.hpp>
 
@@ -102,7 +102,7 @@ struct replace_regex_fn {
 //
 std::unique_ptr<column> replace_re(
   strings_column_view const& strings,
-  std::string const& pattern,
+  regex_program const& program,
   string_scalar const& repl           = string_scalar(""),
   size_type maxrepl                   = -1,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
@@ -116,8 +116,8 @@ std::unique_ptr<column> replace_re(
 
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_strings      = *strings_column;
-  // compile regex into device object
-  auto prog   = reprog_device::create(pattern, get_character_flags_table(), strings_count, stream);
+  // device object of the compiled regex
+  auto prog   = program.get_impl()->get_device_program(strings_count, stream);
   auto d_prog = *prog;
   auto regex_insts = d_prog.insts_counts();
 
@@ -171,7 +171,17 @@ std::unique_ptr<column> replace_re(strings_column_view const& strings,
                                    rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::replace_re(strings, pattern, repl, maxrepl, mr);
+  return detail::replace_re(strings, *regex_program::create(pattern), repl, maxrepl, mr);
+}
+
+std::unique_ptr<column> replace_re(strings_column_view const& strings,
+                                   regex_program const& program,
+                                   string_scalar const& repl,
+                                   size_type maxrepl,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::replace_re(strings, program, repl, maxrepl, mr);
 }
 
 }  // namespace strings
@@ -16,6 +16,7 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/gather.hpp>
+#include <cudf/detail/sorting.hpp>
 #include <cudf/strings/sorting.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
@@ -35,33 +36,52 @@ std::unique_ptr<cudf::column> sort(strings_column_view strings,
                                    cudaStream_t stream,
                                    rmm::mr::device_memory_resource* mr)
 {
-  auto execpol        = rmm::exec_policy(stream);
-  auto strings_column = column_device_view::create(strings.parent(), stream);
-  auto d_column       = *strings_column;
-
-  // sort the indices of the strings
+  auto execpol          = rmm::exec_policy(stream);
   size_type num_strings = strings.size();
-  rmm::device_vector<size_type> indices(num_strings);
-  thrust::sequence(execpol->on(stream), indices.begin(), indices.end());
-  thrust::sort(execpol->on(stream),
-               indices.begin(),
-               indices.end(),
-               [d_column, stype, order, null_order] __device__(size_type lhs, size_type rhs) {
-                 bool lhs_null{d_column.is_null(lhs)};
-                 bool rhs_null{d_column.is_null(rhs)};
-                 if (lhs_null || rhs_null)
-                   return (null_order == cudf::null_order::BEFORE ? !rhs_null : !lhs_null);
-                 string_view lhs_str = d_column.element<string_view>(lhs);
-                 string_view rhs_str = d_column.element<string_view>(rhs);
-                 int cmp             = 0;
-                 if (stype & sort_type::length) cmp = lhs_str.length() - rhs_str.length();
-                 if (stype & sort_type::name) cmp = lhs_str.compare(rhs_str);
-                 return (order == cudf::order::ASCENDING ? (cmp < 0) : (cmp > 0));
-               });
+  rmm::device_vector<size_type> indices;
+  std::unique_ptr<column> sorted_order;
+  column_view indices_view;
+
+  if (stype & sort_type::name) {
+    // sorted_order sorts by a radix sort of the prefixes of the strings; its null order is
+    // relative to the sort order, while nulls go to the beginning or the end of the column here
+    auto const column_null_order =
+      (order == cudf::order::ASCENDING) == (null_order == cudf::null_order::BEFORE)
+        ? cudf::null_order::BEFORE
+        : cudf::null_order::AFTER;
+    sorted_order = cudf::detail::sorted_order(table_view{{strings.parent()}},
+                                              {order},
+                                              {column_null_order},
+                                              rmm::mr::get_default_resource(),
+                                              stream);
+    indices_view = sorted_order->view();
+  } else {
+    auto strings_column = column_device_view::create(strings.parent(), stream);
+    auto d_column       = *strings_column;
+
+    // sort the indices of the strings
+    indices.resize(num_strings);
+    thrust::sequence(execpol->on(stream), indices.begin(), indices.end());
+    thrust::sort(execpol->on(stream),
+                 indices.begin(),
+                 indices.end(),
+                 [d_column, stype, order, null_order] __device__(size_type lhs, size_type rhs) {
+                   bool lhs_null{d_column.is_null(lhs)};
+                   bool rhs_null{d_column.is_null(rhs)};
+                   if (lhs_null || rhs_null)
+                     return (null_order == cudf::null_order::BEFORE ? !rhs_null : !lhs_null);
+                   string_view lhs_str = d_column.element<string_view>(lhs);
+                   string_view rhs_str = d_column.element<string_view>(rhs);
+                   int cmp             = 0;
+                   if (stype & sort_type::length) cmp = lhs_str.length() - rhs_str.length();
+                   return (order == cudf::order::ASCENDING ? (cmp < 0) : (cmp > 0));
+                 });
+
+    // create a column_view as a wrapper of these indices
+    indices_view =
+      column_view(data_type{type_id::INT32}, num_strings, indices.data().get(), nullptr, 0);
+  }
 
-  // create a column_view as a wrapper of these indices
-  column_view indices_view(
-    data_type{type_id::INT32}, num_strings, indices.data().get(), nullptr, 0);
   // now build a new strings column from the indices
   auto table_sorted = cudf::detail::gather(table_view{{strings.parent()}},
                                            indices_view,
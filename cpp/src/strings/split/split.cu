@@ -24,6 +24,7 @@
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/error.hpp>
+#include <strings/utilities.hpp>
 
 #include <thrust/binary_search.h>  // upper_bound()
 #include <thrust/copy.h>           // copy_if()
@@ -776,6 +777,58 @@ struct whitespace_rsplit_tokenizer_fn : base_whitespace_split_tokenizer {
   }
 };
 
+/**
+ * @brief Counts the tokens of each string with a thread per byte, as
+ * `base_whitespace_split_tokenizer::count_tokens` does with a thread per string.
+ *
+ * A token starts at each byte above the space character following a whitespace
+ * byte or the start of its string.
+ *
+ * @param strings Strings to count the tokens of.
+ * @param max_tokens Maximum number of tokens per string, or 0 for no maximum.
+ * @param d_token_counts Output number of tokens for each string.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+void count_whitespace_tokens(strings_column_view const& strings,
+                             size_type max_tokens,
+                             size_type* d_token_counts,
+                             cudaStream_t stream)
+{
+  auto execpol                 = rmm::exec_policy(stream);
+  auto const strings_count     = strings.size();
+  auto const d_offsets         = strings.offsets().data<int32_t>() + strings.offset();
+  auto const d_chars           = strings.chars().data<uint8_t>();
+  size_type const first_offset = thrust::device_pointer_cast(d_offsets)[0];
+  size_type const last_offset  = thrust::device_pointer_cast(d_offsets)[strings_count];
+
+  thrust::fill(execpol->on(stream), d_token_counts, d_token_counts + strings_count, 0);
+  thrust::for_each(execpol->on(stream),
+                   thrust::make_counting_iterator(first_offset),
+                   thrust::make_counting_iterator(last_offset),
+                   [d_offsets, d_chars, d_token_counts, strings_count] __device__(size_type pos) {
+                     if (d_chars[pos] <= ' ') return;
+                     auto const idx = static_cast<size_type>(
+                       thrust::upper_bound(
+                         thrust::seq, d_offsets, d_offsets + strings_count, pos) -
+                       d_offsets - 1);
+                     if ((pos == d_offsets[idx]) || (d_chars[pos - 1] <= ' '))
+                       atomicAdd(d_token_counts + idx, 1);
+                   });
+
+  auto strings_column = column_device_view::create(strings.parent(), stream);
+  auto d_strings      = *strings_column;
+  thrust::transform(execpol->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(strings_count),
+                    d_token_counts,
+                    [d_strings, d_token_counts, max_tokens] __device__(size_type idx) {
+                      if (d_strings.is_null(idx)) return 0;
+                      auto token_count = d_token_counts[idx];
+                      if (max_tokens && (token_count > max_tokens)) token_count = max_tokens;
+                      return token_count == 0 ? 1 : token_count;  // always at least 1 token
+                    });
+}
+
 /**
  * @brief Generic split function called by split() and rsplit() using whitespace as a delimiter.
  *
@@ -825,29 +878,35 @@ struct whitespace_rsplit_tokenizer_fn : base_whitespace_split_tokenizer {
  *      6    aa     b  ccc
  *
  * @tparam Tokenizer provides unique functions for split/rsplit.
- * @param strings_count The number of strings in the column
+ * @param strings The strings column to split
  * @param tokenizer Tokenizer for counting and producing tokens
+ * @param max_tokens Maximum number of tokens per string, or 0 for no maximum
  * @return table of columns for the output of the split
  */
 template <typename Tokenizer>
-std::unique_ptr<table> whitespace_split_fn(size_type strings_count,
+std::unique_ptr<table> whitespace_split_fn(strings_column_view const& strings,
                                            Tokenizer tokenizer,
+                                           size_type max_tokens,
                                            rmm::mr::device_memory_resource* mr,
                                            cudaStream_t stream)
 {
-  auto execpol = rmm::exec_policy(stream);
+  auto execpol       = rmm::exec_policy(stream);
+  auto strings_count = strings.size();
 
   // compute the number of tokens per string
   size_type columns_count = 0;
   rmm::device_vector<size_type> token_counts(strings_count);
   auto d_token_counts = token_counts.data().get();
   if (strings_count > 0) {
-    thrust::transform(
-      execpol->on(stream),
-      thrust::make_counting_iterator<size_type>(0),
-      thrust::make_counting_iterator<size_type>(strings_count),
-      d_token_counts,
-      [tokenizer] __device__(size_type idx) { return tokenizer.count_tokens(idx); });
+    if (get_string_parallelism(strings, stream) == string_parallelism::THREAD_PER_STRING)
+      thrust::transform(
+        execpol->on(stream),
+        thrust::make_counting_iterator<size_type>(0),
+        thrust::make_counting_iterator<size_type>(strings_count),
+        d_token_counts,
+        [tokenizer] __device__(size_type idx) { return tokenizer.count_tokens(idx); });
+    else
+      count_whitespace_tokens(strings, max_tokens, d_token_counts, stream);
     // column count is the maximum number of tokens for any string
     columns_count =
       *thrust::max_element(execpol->on(stream), token_counts.begin(), token_counts.end());
@@ -905,8 +964,9 @@ std::unique_ptr<table> split(strings_column_view const& strings_column,
 
   auto strings_device_view = column_device_view::create(strings_column.parent(), stream);
   if (delimiter.size() == 0) {
-    return whitespace_split_fn(strings_column.size(),
+    return whitespace_split_fn(strings_column,
                                whitespace_split_tokenizer_fn{*strings_device_view, max_tokens},
+                               max_tokens,
                                mr,
                                stream);
   }
@@ -929,8 +989,9 @@ std::unique_ptr<table> rsplit(strings_column_view const& strings_column,
 
   auto strings_device_view = column_device_view::create(strings_column.parent(), stream);
   if (delimiter.size() == 0) {
-    return whitespace_split_fn(strings_column.size(),
+    return whitespace_split_fn(strings_column,
                                whitespace_rsplit_tokenizer_fn{*strings_device_view, max_tokens},
+                               max_tokens,
                                mr,
                                stream);
   }
@@ -18,6 +18,11 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/null_mask.hpp>
+#include <cudf/strings/detail/string_index_pairs.hpp>
+#include <cudf/strings/detail/strings_column_factories.cuh>
+#include <cudf/strings/detail/utilities.cuh>
+#include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/split/split.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
@@ -509,6 +514,229 @@ contiguous_split_record_result contiguous_split_record(
   }
 }
 
+
+namespace {
+/**
+ * @brief Finds the tokens of a string split on a delimiter, or on runs of whitespace when the
+ * delimiter is empty, as `split` and `rsplit` find them.
+ *
+ * The tokens are found on the bytes of the string: a valid UTF-8 delimiter can only match at
+ * a character boundary and whitespace characters are single bytes, so no character positions
+ * need to be converted to byte offsets.
+ */
+template <Dir dir>
+struct list_tokenizer {
+  string_view const d_delimiter;  // empty to split on whitespace
+  size_type const max_tokens;
+
+  __device__ static bool is_whitespace(char ch) { return static_cast<uint8_t>(ch) <= ' '; }
+
+  /**
+   * @brief Calls `token_fn(token_idx, begin, end)` on the byte range of each token of `d_str`
+   * and returns the number of tokens.
+   *
+   * Tokens are numbered in the order they are split: from the end of the string for
+   * `Dir::BACKWARD`. The last token split holds the rest of the string once `max_tokens - 1`
+   * tokens are split.
+   */
+  template <typename TokenFn>
+  __device__ size_type operator()(string_view const& d_str, TokenFn token_fn) const
+  {
+    auto const d_chars    = d_str.data();
+    auto const bytes      = d_str.size_bytes();
+    auto const delim_size = d_delimiter.size_bytes();
+
+    auto const is_delimiter = [&](size_type pos) {
+      return d_delimiter.compare(d_chars + pos, delim_size) == 0;
+    };
+    size_type count = 0;
+    if (delim_size > 0 && dir == Dir::FORWARD) {
+      size_type start = 0;
+      for (size_type pos = 0; (count < max_tokens - 1) && (pos + delim_size <= bytes);) {
+        if (is_delimiter(pos)) {
+          token_fn(count++, start, pos);
+          pos   = pos + delim_size;
+          start = pos;
+        } else {
+          ++pos;
+        }
+      }
+      token_fn(count++, start, bytes);
+    } else if (delim_size > 0) {
+      size_type end = bytes;
+      for (size_type pos = bytes - delim_size; (count < max_tokens - 1) && (pos >= 0);) {
+        if (is_delimiter(pos)) {
+          token_fn(count++, pos + delim_size, end);
+          end = pos;
+          pos -= delim_size;
+        } else {
+          --pos;
+        }
+      }
+      token_fn(count++, 0, end);
+    } else if (dir == Dir::FORWARD) {
+      size_type pos = 0;
+      while (true) {
+        while ((pos < bytes) && is_whitespace(d_chars[pos])) { ++pos; }
+        if (pos == bytes) break;
+        auto const start = pos;
+        if (count == max_tokens - 1) {
+          token_fn(count++, start, bytes);
+          break;
+        }
+        while ((pos < bytes) && !is_whitespace(d_chars[pos])) { ++pos; }
+        token_fn(count++, start, pos);
+      }
+    } else {
+      size_type end = bytes;
+      while (true) {
+        while ((end > 0) && is_whitespace(d_chars[end - 1])) { --end; }
+        if (end == 0) break;
+        if (count == max_tokens - 1) {
+          token_fn(count++, 0, end);
+          break;
+        }
+        auto pos = end;
+        while ((pos > 0) && !is_whitespace(d_chars[pos - 1])) { --pos; }
+        token_fn(count++, pos, end);
+        end = pos;
+      }
+    }
+    return count;
+  }
+};
+
+/**
+ * @brief Returns the number of tokens of each string, 0 for null strings.
+ */
+template <Dir dir>
+struct count_list_tokens_fn {
+  column_device_view const d_strings;
+  list_tokenizer<dir> const tokenizer;
+
+  __device__ size_type operator()(size_type idx) const
+  {
+    if (d_strings.is_null(idx)) return 0;
+    return tokenizer(d_strings.element<string_view>(idx), [](size_type, size_type, size_type) {});
+  }
+};
+
+/**
+ * @brief Writes the tokens of each string in order to `d_tokens`, from the list offset
+ * of the string.
+ */
+template <Dir dir>
+struct write_list_tokens_fn {
+  column_device_view const d_strings;
+  list_tokenizer<dir> const tokenizer;
+  int32_t const* d_offsets;
+  string_index_pair* d_tokens;
+
+  __device__ void operator()(size_type idx) const
+  {
+    if (d_strings.is_null(idx)) return;
+    auto const d_str       = d_strings.element<string_view>(idx);
+    auto const d_chars     = d_str.data() == nullptr ? "" : d_str.data();
+    auto const token_count = d_offsets[idx + 1] - d_offsets[idx];
+    auto const d_output    = d_tokens + d_offsets[idx];
+    tokenizer(d_str, [&](size_type token_idx, size_type begin, size_type end) {
+      auto const position = dir == Dir::FORWARD ? token_idx : token_count - 1 - token_idx;
+      d_output[position]  = string_index_pair{d_chars + begin, end - begin};
+    });
+  }
+};
+
+}  // namespace
+
+/**
+ * @brief Splits each string into a list of its tokens.
+ *
+ * The token counts are scanned into the list offsets and each string then writes its tokens
+ * at its offset, so no table padded to the largest count is built.
+ */
+template <Dir dir>
+std::unique_ptr<column> split_record(
+  strings_column_view const& strings,
+  string_scalar const& delimiter      = string_scalar(""),
+  size_type maxsplit                  = -1,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0)
+{
+  CUDF_EXPECTS(delimiter.is_valid(), "Parameter delimiter must be valid");
+
+  auto const strings_count = strings.size();
+  if (strings_count == 0) return make_empty_column(data_type{type_id::LIST});
+
+  auto const max_tokens = maxsplit > 0 ? maxsplit + 1 : std::numeric_limits<size_type>::max();
+  list_tokenizer<dir> const tokenizer{string_view(delimiter.data(), delimiter.size()),
+                                      max_tokens};
+  auto strings_column = column_device_view::create(strings.parent(), stream);
+  auto d_strings      = *strings_column;
+
+  // list offsets from the token counts
+  auto counts_itr = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0), count_list_tokens_fn<dir>{d_strings, tokenizer});
+  auto offsets   = make_offsets_child_column(counts_itr, counts_itr + strings_count, mr, stream);
+  auto d_offsets = offsets->view().data<int32_t>();
+
+  // the tokens, referencing the chars of the strings
+  size_type const total_tokens = thrust::device_pointer_cast(d_offsets)[strings_count];
+  rmm::device_vector<string_index_pair> tokens(total_tokens);
+  thrust::for_each_n(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    strings_count,
+    write_list_tokens_fn<dir>{d_strings, tokenizer, d_offsets, tokens.data().get()});
+  auto child = make_strings_column(tokens.begin(), tokens.end(), mr, stream);
+
+  return make_lists_column(strings_count,
+                           std::move(offsets),
+                           std::move(child),
+                           strings.null_count(),
+                           copy_bitmask(strings.parent(), stream, mr),
+                           stream,
+                           mr);
+}
+
+/**
+ * @copydoc cudf::strings::split_part
+ */
+std::unique_ptr<column> split_part(
+  strings_column_view const& strings,
+  size_type index,
+  string_scalar const& delimiter      = string_scalar(""),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0)
+{
+  CUDF_EXPECTS(delimiter.is_valid(), "Parameter delimiter must be valid");
+  CUDF_EXPECTS(index >= 0, "Parameter index must not be negative");
+
+  if (strings.size() == 0) return make_empty_strings_column(mr, stream);
+
+  // splitting stops once the token at index is found
+  auto const max_tokens = index < std::numeric_limits<size_type>::max() - 1
+                            ? index + 2
+                            : std::numeric_limits<size_type>::max();
+  list_tokenizer<Dir::FORWARD> const tokenizer{string_view(delimiter.data(), delimiter.size()),
+                                               max_tokens};
+  auto strings_column = column_device_view::create(strings.parent(), stream);
+  auto d_strings      = *strings_column;
+
+  auto tokens_itr = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    [d_strings, tokenizer, index] __device__(size_type idx) {
+      string_index_pair result{nullptr, 0};
+      if (d_strings.is_null(idx)) return result;
+      auto const d_str   = d_strings.element<string_view>(idx);
+      auto const d_chars = d_str.data() == nullptr ? "" : d_str.data();
+      tokenizer(d_str, [&](size_type token_idx, size_type begin, size_type end) {
+        if (token_idx == index) result = string_index_pair{d_chars + begin, end - begin};
+      });
+      return result;
+    });
+  return make_strings_column(tokens_itr, tokens_itr + strings.size(), mr, stream);
+}
+
 }  // namespace detail
 
 // external APIs
@@ -532,5 +760,32 @@ contiguous_split_record_result contiguous_rsplit_record(strings_column_view cons
     strings, delimiter, maxsplit, mr, 0);
 }
 
+std::unique_ptr<column> split_record(strings_column_view const& strings,
+                                     string_scalar const& delimiter,
+                                     size_type maxsplit,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::split_record<detail::Dir::FORWARD>(strings, delimiter, maxsplit, mr, 0);
+}
+
+std::unique_ptr<column> rsplit_record(strings_column_view const& strings,
+                                      string_scalar const& delimiter,
+                                      size_type maxsplit,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::split_record<detail::Dir::BACKWARD>(strings, delimiter, maxsplit, mr, 0);
+}
+
+std::unique_ptr<column> split_part(strings_column_view const& strings,
+                                   size_type index,
+                                   string_scalar const& delimiter,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::split_part(strings, index, delimiter, mr, 0);
+}
+
 }  // namespace strings
 }  // namespace cudf
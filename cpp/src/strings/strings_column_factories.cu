@@ -217,5 +217,64 @@ std::unique_ptr<column> make_strings_column(size_type num_strings,
                                   std::move(children));
 }
 
+namespace strings {
+namespace detail {
+
+// Create a strings-type column from pointer/size pairs with a null mask decoded separately
+std::unique_ptr<column> make_strings_column(
+  const rmm::device_vector<thrust::pair<const char*, size_type>>& strings,
+  rmm::device_buffer&& null_mask,
+  size_type null_count,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) {
+  size_type strings_count = strings.size();
+  if (strings_count == 0) return make_empty_strings_column(mr, stream);
+
+  auto execpol   = rmm::exec_policy(stream);
+  auto d_strings = strings.data().get();
+
+  // the null rows have a size of zero, so the sizes need no check of the pointers
+  size_t bytes = thrust::transform_reduce(
+    execpol->on(stream),
+    d_strings,
+    d_strings + strings_count,
+    [] __device__(thrust::pair<const char*, size_type> const& item) {
+      return static_cast<size_t>(item.second);
+    },
+    size_t{0},
+    thrust::plus<size_t>());
+  CUDF_EXPECTS(bytes < std::numeric_limits<size_type>::max(),
+               "total size of strings is too large for cudf column");
+
+  auto sizes_itr = thrust::make_transform_iterator(
+    d_strings, [] __device__(thrust::pair<const char*, size_type> const& item) {
+      return item.second;
+    });
+  auto offsets_column =
+    make_offsets_child_column(sizes_itr, sizes_itr + strings_count, mr, stream);
+  auto d_offsets = offsets_column->view().data<int32_t>();
+
+  auto chars_column = create_chars_child_column(strings_count, null_count, bytes, mr, stream);
+  auto d_chars      = chars_column->mutable_view().data<char>();
+  thrust::for_each_n(execpol->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     strings_count,
+                     [d_strings, d_offsets, d_chars] __device__(size_type idx) {
+                       auto item = d_strings[idx];
+                       if (item.second > 0)
+                         memcpy(d_chars + d_offsets[idx], item.first, item.second);
+                     });
+
+  return cudf::make_strings_column(strings_count,
+                                   std::move(offsets_column),
+                                   std::move(chars_column),
+                                   null_count,
+                                   std::move(null_mask),
+                                   stream,
+                                   mr);
+}
+
+}  // namespace detail
+}  // namespace strings
 }  // namespace cudf
 // clang-format on TODO fix
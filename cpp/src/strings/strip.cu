@@ -17,6 +17,8 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/strings/detail/string_index_pairs.hpp>
+#include <cudf/strings/detail/strings_column_factories.cuh>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
@@ -31,34 +33,17 @@ namespace cudf {
 namespace strings {
 namespace detail {
 namespace {
-/**
- * @brief Used as template parameter to divide size calculation from
- * the actual string operation within a function.
- *
- * Useful when most of the logic is identical for both passes.
- */
-enum TwoPass {
-  SizeOnly = 0,  ///< calculate the size only
-  ExecuteOp      ///< run the string operation
-};
-
 /**
  * @brief Strip characters from the beginning and/or end of a string.
  *
  * This functor strips the beginning and/or end of each string
  * of any characters found in d_to_strip or whitespace if
- * d_to_strip is empty.
- *
- * @tparam Pass Allows computing only the size of the output
- *              or writing the output to device memory.
+ * d_to_strip is empty, and returns the remaining chars.
  */
-template <TwoPass Pass = SizeOnly>
 struct strip_fn {
   column_device_view const d_strings;
   strip_type stype;  // right, left, or both
   string_view d_to_strip;
-  int32_t const* d_offsets{};
-  char* d_chars{};
 
   __device__ bool is_strip_character(char_utf8 chr)
   {
@@ -69,9 +54,9 @@ struct strip_fn {
                });
   }
 
-  __device__ size_type operator()(size_type idx)
+  __device__ string_index_pair operator()(size_type idx)
   {
-    if (d_strings.is_null(idx)) return 0;
+    if (d_strings.is_null(idx)) return string_index_pair{nullptr, 0};
     string_view d_str     = d_strings.element<string_view>(idx);
     size_type length      = d_str.length();
     size_type left_offset = 0;
@@ -92,58 +77,48 @@ struct strip_fn {
     }
     size_type bytes = 0;
     if (right_offset > left_offset) bytes = right_offset - left_offset;
-    if (Pass == ExecuteOp) memcpy(d_chars + d_offsets[idx], d_str.data() + left_offset, bytes);
-    return bytes;
+    // the chars of a column of empty strings may be null, which would make the string null
+    if (d_str.data() == nullptr) return string_index_pair{"", 0};
+    return string_index_pair{d_str.data() + left_offset, bytes};
   }
 };
 
 }  // namespace
 
+rmm::device_vector<string_index_pair> strip_index_pairs(strings_column_view const& strings,
+                                                        strip_type stype,
+                                                        string_scalar const& to_strip,
+                                                        cudaStream_t stream)
+{
+  CUDF_EXPECTS(to_strip.is_valid(), "Parameter to_strip must be valid");
+  string_view d_to_strip(to_strip.data(), to_strip.size());
+
+  auto strings_column = column_device_view::create(strings.parent(), stream);
+  rmm::device_vector<string_index_pair> results(strings.size());
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(strings.size()),
+                    results.begin(),
+                    strip_fn{*strings_column, stype, d_to_strip});
+  return results;
+}
+
 std::unique_ptr<column> strip(strings_column_view const& strings,
                               strip_type stype                    = strip_type::BOTH,
                               string_scalar const& to_strip       = string_scalar(""),
                               rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
                               cudaStream_t stream                 = 0)
 {
-  auto strings_count = strings.size();
-  if (strings_count == 0) return detail::make_empty_strings_column(mr, stream);
-
-  CUDF_EXPECTS(to_strip.is_valid(), "Parameter to_strip must be valid");
-  string_view d_to_strip(to_strip.data(), to_strip.size());
-
-  auto execpol         = rmm::exec_policy(stream);
-  auto strings_column  = column_device_view::create(strings.parent(), stream);
-  auto d_column        = *strings_column;
-  size_type null_count = strings.null_count();
-
-  // copy null mask
-  rmm::device_buffer null_mask = copy_bitmask(strings.parent(), stream, mr);
-
-  // build offsets column -- calculate the size of each output string
-  auto offsets_transformer_itr = thrust::make_transform_iterator(
-    thrust::make_counting_iterator<size_type>(0), strip_fn<SizeOnly>{d_column, stype, d_to_strip});
-  auto offsets_column = make_offsets_child_column(
-    offsets_transformer_itr, offsets_transformer_itr + strings_count, mr, stream);
-  auto offsets_view = offsets_column->view();
-  auto d_offsets    = offsets_view.data<int32_t>();
-
-  // build the chars column -- convert characters based on case_flag parameter
-  size_type bytes   = thrust::device_pointer_cast(d_offsets)[strings_count];
-  auto chars_column = create_chars_child_column(strings_count, null_count, bytes, mr, stream);
-  auto chars_view   = chars_column->mutable_view();
-  auto d_chars      = chars_view.data<char>();
-  thrust::for_each_n(execpol->on(stream),
-                     thrust::make_counting_iterator<size_type>(0),
-                     strings_count,
-                     strip_fn<ExecuteOp>{d_column, stype, d_to_strip, d_offsets, d_chars});
-  //
-  return make_strings_column(strings_count,
-                             std::move(offsets_column),
-                             std::move(chars_column),
-                             null_count,
-                             std::move(null_mask),
-                             stream,
-                             mr);
+  if (strings.is_empty()) return detail::make_empty_strings_column(mr, stream);
+
+  // the stripped strings are found once, and their chars copied when building the column
+  auto const results = strip_index_pairs(strings, stype, to_strip, stream);
+  auto output        = make_strings_column(results.begin(), results.end(), mr, stream);
+  // the null mask of the strings is kept even when there are no nulls
+  if (strings.parent().nullable() && !output->nullable()) {
+    output->set_null_mask(copy_bitmask(strings.parent(), stream, mr), 0);
+  }
+  return output;
 }
 
 }  // namespace detail
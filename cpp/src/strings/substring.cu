@@ -19,6 +19,8 @@
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
+#include <cudf/strings/detail/string_index_pairs.hpp>
+#include <cudf/strings/detail/strings_column_factories.cuh>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
@@ -101,8 +103,55 @@ struct substring_fn {
   }
 };
 
+/**
+ * @brief Function logic for the substring API with a step of 1.
+ *
+ * The substring is a contiguous range of the chars of each string,
+ * which is returned rather than copied.
+ */
+struct substring_index_pair_fn {
+  const column_device_view d_column;
+  numeric_scalar_device_view<size_type> d_start, d_stop;
+
+  __device__ string_index_pair operator()(size_type idx)
+  {
+    if (d_column.is_null(idx)) return string_index_pair{nullptr, 0};
+    string_view d_str = d_column.template element<string_view>(idx);
+    auto const length = d_str.length();
+    // negative positions count from the end; positions are clamped to [0, length]
+    auto const position = [length](size_type pos) {
+      if (pos < 0) pos += length;
+      return pos < 0 ? 0 : (pos > length ? length : pos);
+    };
+    auto const begin = d_start.is_valid() ? position(d_start.value()) : 0;
+    auto const end   = d_stop.is_valid() ? position(d_stop.value()) : length;
+    // the chars of a column of empty strings may be null, which would make the string null
+    if (end <= begin || d_str.data() == nullptr) return string_index_pair{"", 0};
+    string_view d_substr = d_str.substr(begin, end - begin);
+    return string_index_pair{d_substr.data(), d_substr.size_bytes()};
+  }
+};
+
 }  // namespace
 
+rmm::device_vector<string_index_pair> slice_strings_index_pairs(
+  strings_column_view const& strings,
+  numeric_scalar<size_type> const& start,
+  numeric_scalar<size_type> const& stop,
+  cudaStream_t stream)
+{
+  auto strings_column = column_device_view::create(strings.parent(), stream);
+  auto d_start        = get_scalar_device_view(const_cast<numeric_scalar<size_type>&>(start));
+  auto d_stop         = get_scalar_device_view(const_cast<numeric_scalar<size_type>&>(stop));
+  rmm::device_vector<string_index_pair> results(strings.size());
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(strings.size()),
+                    results.begin(),
+                    substring_index_pair_fn{*strings_column, d_start, d_stop});
+  return results;
+}
+
 //
 std::unique_ptr<column> slice_strings(
   strings_column_view const& strings,
@@ -115,7 +164,18 @@ std::unique_ptr<column> slice_strings(
   size_type strings_count = strings.size();
   if (strings_count == 0) return make_empty_strings_column(mr, stream);
 
-  if (step.is_valid()) CUDF_EXPECTS(step.value(stream) != 0, "Step parameter must not be 0");
+  auto const step_value = step.is_valid() ? step.value(stream) : 1;
+  CUDF_EXPECTS(step_value != 0, "Step parameter must not be 0");
+  if (step_value == 1) {
+    // the substrings are found once, and their chars copied when building the column
+    auto const results = slice_strings_index_pairs(strings, start, stop, stream);
+    auto output        = make_strings_column(results.begin(), results.end(), mr, stream);
+    // the null mask of the strings is kept even when there are no nulls
+    if (strings.parent().nullable() && !output->nullable()) {
+      output->set_null_mask(copy_bitmask(strings.parent(), stream, mr), 0);
+    }
+    return output;
+  }
 
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_column       = *strings_column;
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/utilities/error.hpp>
+#include <strings/target_trie.cuh>
+#include <strings/utilities.hpp>
+
+#include <map>
+#include <vector>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+target_trie::target_trie(strings_column_view const& targets, cudaStream_t stream)
+{
+  CUDF_EXPECTS(!targets.has_nulls(), "Targets cannot contain null strings");
+  auto const h_targets = strings_to_host(targets, stream);
+
+  std::vector<std::map<uint8_t, int32_t>> edges(1);
+  std::vector<int32_t> h_ids(1, -1);
+  for (size_type id = 0; id < static_cast<size_type>(h_targets.size()); ++id) {
+    int32_t node = 0;
+    for (auto const ch : h_targets[id]) {
+      auto const result =
+        edges[node].insert({static_cast<uint8_t>(ch), static_cast<int32_t>(edges.size())});
+      if (result.second) {
+        edges.emplace_back();
+        h_ids.push_back(-1);
+      }
+      node = result.first->second;
+    }
+    if (h_ids[node] < 0) { h_ids[node] = id; }
+  }
+
+  std::vector<int32_t> h_edge_offsets{0};
+  std::vector<uint8_t> h_labels;
+  std::vector<int32_t> h_children;
+  for (auto const& node_edges : edges) {
+    for (auto const& edge : node_edges) {
+      h_labels.push_back(edge.first);
+      h_children.push_back(edge.second);
+    }
+    h_edge_offsets.push_back(h_labels.size());
+  }
+  _edge_offsets = h_edge_offsets;
+  _labels       = h_labels;
+  _children     = h_children;
+  _ids          = h_ids;
+}
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
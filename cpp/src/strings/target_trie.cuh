@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+/**
+ * @brief Device view of a trie of target strings.
+ *
+ * The edges of each node are sorted by byte value in `labels` and `children`, from
+ * `edge_offsets[node]` to `edge_offsets[node + 1]`. Node 0 is the root.
+ *
+ * Matching the targets at a position of a string follows a single path of the trie, so it
+ * reads at most as many bytes as the longest target whatever the number of targets.
+ */
+struct target_trie_device {
+  int32_t const* edge_offsets;
+  uint8_t const* labels;
+  int32_t const* children;
+  int32_t const* ids;  // lowest index of the targets ending at each node, or -1
+
+  /**
+   * @brief Returns the child of `node` along `byte`, or -1 if there is none.
+   */
+  __device__ int32_t child(int32_t node, uint8_t byte) const
+  {
+    auto const begin = labels + edge_offsets[node];
+    auto const end   = labels + edge_offsets[node + 1];
+    auto const itr   = thrust::lower_bound(thrust::seq, begin, end, byte);
+    return ((itr != end) && (*itr == byte)) ? children[itr - labels] : -1;
+  }
+
+  /**
+   * @brief Returns the lowest index of the non-empty targets starting the `size` bytes at
+   * `ptr`, or -1 if none does.
+   */
+  __device__ int32_t find_prefix(char const* ptr, size_type size) const
+  {
+    int32_t found = -1;
+    int32_t node  = 0;
+    for (size_type idx = 0; idx < size; ++idx) {
+      node = child(node, static_cast<uint8_t>(ptr[idx]));
+      if (node < 0) break;
+      auto const id = ids[node];
+      if (id >= 0 && (found < 0 || id < found)) found = id;
+    }
+    return found;
+  }
+
+  /**
+   * @brief Returns the lowest index of the targets equal to the `size` bytes at `ptr`,
+   * or -1 if none is.
+   */
+  __device__ int32_t find(char const* ptr, size_type size) const
+  {
+    int32_t node = 0;
+    for (size_type idx = 0; (idx < size) && (node >= 0); ++idx) {
+      node = child(node, static_cast<uint8_t>(ptr[idx]));
+    }
+    return node < 0 ? -1 : ids[node];
+  }
+};
+
+/**
+ * @brief Trie of the strings of a column of targets, in device memory.
+ *
+ * The trie is built on the host, so it suits target columns much smaller than the strings
+ * they are matched in.
+ */
+class target_trie {
+ public:
+  /**
+   * @brief Builds the trie of `targets`.
+   *
+   * @throw cudf::logic_error if `targets` has nulls.
+   *
+   * @param targets Strings to match.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  target_trie(strings_column_view const& targets, cudaStream_t stream = 0);
+
+  /**
+   * @brief Returns the device view of the trie.
+   */
+  target_trie_device view() const
+  {
+    return target_trie_device{_edge_offsets.data().get(),
+                              _labels.data().get(),
+                              _children.data().get(),
+                              _ids.data().get()};
+  }
+
+ private:
+  rmm::device_vector<int32_t> _edge_offsets;
+  rmm::device_vector<uint8_t> _labels;
+  rmm::device_vector<int32_t> _children;
+  rmm::device_vector<int32_t> _ids;
+};
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
@@ -25,8 +25,11 @@
 #include "char_types/char_flags.h"
 
 #include <rmm/thrust_rmm_allocator.h>
+#include <thrust/functional.h>
 #include <thrust/transform_reduce.h>
 #include <thrust/transform_scan.h>
+#include <algorithm>
+#include <limits>
 #include <mutex>
 
 namespace cudf {
@@ -41,7 +44,6 @@ std::unique_ptr<string_view, std::function<void(string_view*)>> string_from_host
 
   auto* d_str = new rmm::device_buffer(length, stream);
   CUDA_TRY(cudaMemcpyAsync(d_str->data(), str, length, cudaMemcpyHostToDevice, stream));
-  CUDA_TRY(cudaStreamSynchronize(stream));
 
   auto deleter = [d_str](string_view* sv) { delete d_str; };
   return std::unique_ptr<string_view, decltype(deleter)>{
@@ -119,6 +121,8 @@ std::unique_ptr<column> create_chars_child_column(cudf::size_type strings_count,
                                                   cudaStream_t stream)
 {
   CUDF_EXPECTS(null_count <= strings_count, "Invalid null count");
+  CUDF_EXPECTS(total_bytes >= 0 && total_bytes < std::numeric_limits<size_type>::max(),
+               "total size of strings is too large for cudf column");
   return make_numeric_column(
     data_type{type_id::INT8}, total_bytes, mask_state::UNALLOCATED, stream, mr);
 }
@@ -231,6 +235,102 @@ const special_case_mapping* get_special_case_mapping_table()
   });
 }
 
+/**
+ * @copydoc cudf::strings::detail::get_string_parallelism
+ */
+string_parallelism get_string_parallelism(strings_column_view const& strings, cudaStream_t stream)
+{
+  auto const strings_count = strings.size() - strings.null_count();
+  if (strings_count <= 0) return string_parallelism::THREAD_PER_STRING;
+  auto const d_offsets = strings.offsets().data<int32_t>() + strings.offset();
+  auto const max_bytes = thrust::transform_reduce(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(strings.size()),
+    [d_offsets] __device__(size_type idx) { return d_offsets[idx + 1] - d_offsets[idx]; },
+    0,
+    thrust::maximum<int32_t>{});
+  if (max_bytes <= MAX_THREAD_STRING_BYTES) return string_parallelism::THREAD_PER_STRING;
+
+  int32_t first_offset = 0, last_offset = 0;
+  CUDA_TRY(cudaMemcpyAsync(
+    &first_offset, d_offsets, sizeof(int32_t), cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaMemcpyAsync(
+    &last_offset, d_offsets + strings.size(), sizeof(int32_t), cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  auto const average_bytes = (last_offset - first_offset) / strings_count;
+  return average_bytes >= MIN_BLOCK_STRING_BYTES ? string_parallelism::BLOCK_PER_STRING
+                                                 : string_parallelism::WARP_PER_STRING;
+}
+
+/**
+ * @copydoc cudf::strings::detail::is_ascii
+ */
+bool is_ascii(strings_column_view const& strings, cudaStream_t stream)
+{
+  if (strings.size() == 0) return true;
+  auto const d_offsets = strings.offsets().data<int32_t>() + strings.offset();
+  int32_t first_offset = 0, last_offset = 0;
+  CUDA_TRY(cudaMemcpyAsync(
+    &first_offset, d_offsets, sizeof(int32_t), cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaMemcpyAsync(
+    &last_offset, d_offsets + strings.size(), sizeof(int32_t), cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  auto const bytes = last_offset - first_offset;
+  if (bytes <= 0) return true;
+
+  // The head bytes up to the first aligned word and the tail bytes after the last one are read
+  // one at a time, so no load reaches outside the chars.
+  auto const d_chars =
+    reinterpret_cast<uint8_t const*>(strings.chars().data<char>() + first_offset);
+  auto const misalign  = static_cast<int32_t>(reinterpret_cast<uintptr_t>(d_chars) & 3);
+  auto const head      = std::min((4 - misalign) & 3, bytes);
+  auto const num_words = (bytes - head) / 4;
+  auto const tail      = bytes - head - num_words * 4;
+  auto const d_words   = reinterpret_cast<uint32_t const*>(d_chars + head);
+  auto const high_bits = thrust::transform_reduce(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<int32_t>(0),
+    thrust::make_counting_iterator<int32_t>(head + num_words + tail),
+    [d_chars, d_words, head, num_words] __device__(int32_t idx) -> uint32_t {
+      if (idx < head) { return d_chars[idx] & 0x80u; }
+      if (idx < head + num_words) { return d_words[idx - head] & 0x80808080u; }
+      return d_chars[head + num_words * 4 + (idx - head - num_words)] & 0x80u;
+    },
+    uint32_t{0},
+    thrust::bit_or<uint32_t>{});
+  return high_bits == 0;
+}
+
+
+/**
+ * @copydoc cudf::strings::detail::strings_to_host
+ */
+std::vector<std::string> strings_to_host(strings_column_view const& strings, cudaStream_t stream)
+{
+  auto const count = strings.size();
+  std::vector<int32_t> h_offsets(count + 1);
+  CUDA_TRY(cudaMemcpyAsync(h_offsets.data(),
+                           strings.offsets().data<int32_t>() + strings.offset(),
+                           h_offsets.size() * sizeof(int32_t),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  std::vector<char> h_chars(h_offsets.back() - h_offsets.front());
+  CUDA_TRY(cudaMemcpyAsync(h_chars.data(),
+                           strings.chars().data<char>() + h_offsets.front(),
+                           h_chars.size(),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  std::vector<std::string> result;
+  for (size_type idx = 0; idx < count; ++idx) {
+    result.emplace_back(h_chars.data() + h_offsets[idx] - h_offsets.front(),
+                        h_offsets[idx + 1] - h_offsets[idx]);
+  }
+  return result;
+}
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
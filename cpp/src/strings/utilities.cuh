@@ -93,8 +93,12 @@ auto make_strings_children(SizeAndExecuteFunction size_and_exec_fn,
 
   // Compute the offsets values
   for_each_fn(size_and_exec_fn);
-  thrust::exclusive_scan(
-    rmm::exec_policy(stream)->on(stream), d_offsets, d_offsets + strings_count + 1, d_offsets);
+  thrust::exclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         d_offsets,
+                         d_offsets + strings_count + 1,
+                         d_offsets,
+                         size_type{0},
+                         saturating_offsets_sum{});
 
   // Now build the chars column
   std::unique_ptr<column> chars_column = create_chars_child_column(
@@ -15,6 +15,13 @@
  */
 #pragma once
 
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <cuda_runtime.h>
+
+#include <string>
+#include <vector>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -60,6 +67,57 @@ const character_cases_table_type* get_character_cases_table();
  */
 const struct special_case_mapping* get_special_case_mapping_table();
 
+/**
+ * @brief Number of threads cooperating on each string of a strings column.
+ */
+enum class string_parallelism {
+  THREAD_PER_STRING,  ///< each thread processes a string sequentially
+  WARP_PER_STRING,    ///< the threads of a warp process consecutive bytes of a string
+  BLOCK_PER_STRING    ///< the threads of a block process consecutive bytes of a string
+};
+
+/**
+ * @brief Returns the parallelism suited to the byte lengths of the strings.
+ *
+ * A thread per string is best for short strings, but a single long string keeps its whole
+ * warp waiting. Warps are used once the longest string is above `MAX_THREAD_STRING_BYTES`,
+ * and blocks once the strings average more than `MIN_BLOCK_STRING_BYTES`.
+ *
+ * @param strings Strings column to process.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The parallelism to use.
+ */
+string_parallelism get_string_parallelism(strings_column_view const& strings,
+                                          cudaStream_t stream = 0);
+
+/**
+ * @brief Returns whether all the chars of the strings are ASCII, so that each byte is a character.
+ *
+ * The chars of the strings are OR-ed together 4 bytes at a time.
+ *
+ * @param strings Strings column to check.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return `true` if no char has its high bit set.
+ */
+bool is_ascii(strings_column_view const& strings, cudaStream_t stream = 0);
+
+/**
+ * @brief Copies the bytes of each string of a strings column to the host.
+ *
+ * Null strings are copied as empty strings.
+ *
+ * @param strings Strings column to copy.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The strings on the host.
+ */
+std::vector<std::string> strings_to_host(strings_column_view const& strings,
+                                         cudaStream_t stream = 0);
+
+// longest string processed with a thread per string
+constexpr size_type MAX_THREAD_STRING_BYTES = 256;
+// average string length processed with a block per string
+constexpr size_type MIN_BLOCK_STRING_BYTES = 16 * 1024;
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
@@ -0,0 +1,383 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/join.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/table/distributed_table.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <numeric>
+#include <utility>
+
+namespace cudf {
+namespace {
+/**
+ * @brief Makes a device current for the lifetime of the guard
+ */
+class device_guard {
+ public:
+  explicit device_guard(int device)
+  {
+    CUDA_TRY(cudaGetDevice(&_previous));
+    CUDA_TRY(cudaSetDevice(device));
+  }
+  ~device_guard() { cudaSetDevice(_previous); }
+
+ private:
+  int _previous;
+};
+
+/**
+ * @brief Enables the kernels of `device` to read the memory of `peer`; returns false when the
+ * devices do not support peer access
+ */
+bool enable_peer(int device, int peer)
+{
+  if (device == peer) { return true; }
+  int can_access = 0;
+  CUDA_TRY(cudaDeviceCanAccessPeer(&can_access, device, peer));
+  if (can_access == 0) { return false; }
+  device_guard guard(device);
+  auto const result = cudaDeviceEnablePeerAccess(peer, 0);
+  if (result == cudaErrorPeerAccessAlreadyEnabled) {
+    cudaGetLastError();
+  } else {
+    CUDA_TRY(result);
+  }
+  return true;
+}
+
+/**
+ * @brief Waits for the work of the default stream of `device`
+ */
+void synchronize_device(int device)
+{
+  device_guard guard(device);
+  CUDA_TRY(cudaStreamSynchronize(0));
+}
+
+/**
+ * @brief Copies a column of `source_device` to the current device, `device`
+ */
+std::unique_ptr<column> copy_column(column_view const& input,
+                                    int source_device,
+                                    int device,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(input.offset() == 0, "Cannot copy a sliced column across devices");
+  auto const null_count = [&] {
+    // The null count may be computed by a kernel of the device of the column
+    device_guard guard(source_device);
+    return input.null_count();
+  }();
+
+  auto const data_size = is_fixed_width(input.type()) ? size_of(input.type()) * input.size() : 0;
+  rmm::device_buffer data(data_size, 0, mr);
+  if (data_size > 0) {
+    CUDA_TRY(cudaMemcpyPeerAsync(
+      data.data(), device, input.head<uint8_t>(), source_device, data_size, 0));
+  }
+  rmm::device_buffer null_mask{};
+  if (input.nullable()) {
+    null_mask = rmm::device_buffer(bitmask_allocation_size_bytes(input.size()), 0, mr);
+    CUDA_TRY(cudaMemcpyPeerAsync(null_mask.data(),
+                                 device,
+                                 input.null_mask(),
+                                 source_device,
+                                 num_bitmask_words(input.size()) * sizeof(bitmask_type),
+                                 0));
+  }
+
+  std::vector<std::unique_ptr<column>> children;
+  for (size_type i = 0; i < input.num_children(); ++i) {
+    children.push_back(copy_column(input.child(i), source_device, device, mr));
+  }
+  return std::make_unique<column>(input.type(),
+                                  input.size(),
+                                  std::move(data),
+                                  std::move(null_mask),
+                                  null_count,
+                                  std::move(children));
+}
+
+/**
+ * @brief Copies a table of `source_device` to `device`
+ */
+std::unique_ptr<table> copy_table(table_view const& input,
+                                  int source_device,
+                                  int device,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  device_guard guard(device);
+  std::vector<std::unique_ptr<column>> columns;
+  for (auto const& c : input) { columns.push_back(copy_column(c, source_device, device, mr)); }
+  return std::make_unique<table>(std::move(columns));
+}
+
+/**
+ * @brief Returns the columns `column_indices` of the partitions of `input` as views readable by
+ * the kernels of `device`, along with the copies to `device` they reference, if any
+ */
+std::pair<std::vector<table_view>, std::vector<std::unique_ptr<table>>> partitions_on_device(
+  distributed_table const& input,
+  std::vector<size_type> const& column_indices,
+  int device,
+  rmm::mr::device_memory_resource* mr)
+{
+  std::vector<table_view> views;
+  std::vector<std::unique_ptr<table>> copies;
+  for (size_type i = 0; i < input.num_partitions(); ++i) {
+    auto const& partition = input.partition(i);
+    auto const view       = partition.data->select(column_indices);
+    synchronize_device(partition.device);
+    if (enable_peer(device, partition.device)) {
+      views.push_back(view);
+    } else {
+      copies.push_back(copy_table(view, partition.device, device, mr));
+      views.push_back(copies.back()->view());
+    }
+  }
+  return {std::move(views), std::move(copies)};
+}
+
+std::vector<size_type> all_columns(distributed_table const& input)
+{
+  std::vector<size_type> indices(input.partition(0).data->num_columns());
+  std::iota(indices.begin(), indices.end(), 0);
+  return indices;
+}
+
+enum class join_kind { INNER_JOIN, LEFT_JOIN };
+
+distributed_table broadcast_join(distributed_table const& probe,
+                                 std::vector<size_type> const& probe_on,
+                                 table_view const& build,
+                                 int build_device,
+                                 std::vector<size_type> const& build_on,
+                                 join_kind kind,
+                                 null_equality compare_nulls)
+{
+  // Packed once, so that each device receives the build table in a single copy
+  packed_columns packed;
+  {
+    device_guard guard(build_device);
+    packed = pack(build);
+    CUDA_TRY(cudaStreamSynchronize(0));
+  }
+
+  struct replica {
+    rmm::device_buffer data;
+    std::unique_ptr<hash_join> hash_table;
+  };
+  std::map<int, replica> replicas;  // By device, shared by the partitions of the device
+
+  std::vector<device_partition> results;
+  for (size_type i = 0; i < probe.num_partitions(); ++i) {
+    auto const& partition = probe.partition(i);
+    device_guard guard(partition.device);
+    auto it = replicas.find(partition.device);
+    if (it == replicas.end()) {
+      auto const size = packed.gpu_data->size();
+      rmm::device_buffer data(size, 0, partition.mr);
+      if (size > 0) {
+        CUDA_TRY(cudaMemcpyPeerAsync(
+          data.data(), partition.device, packed.gpu_data->data(), build_device, size, 0));
+      }
+      it = replicas.emplace(partition.device, replica{std::move(data), nullptr}).first;
+      it->second.hash_table = std::make_unique<hash_join>(
+        unpack(packed.metadata->data(), it->second.data.data()), build_on);
+    }
+    auto const build_view = unpack(packed.metadata->data(), it->second.data.data());
+
+    auto const probe_view = partition.data->view();
+    auto const maps =
+      kind == join_kind::INNER_JOIN
+        ? it->second.hash_table->inner_join(probe_view, probe_on, compare_nulls, partition.mr)
+        : it->second.hash_table->left_join(probe_view, probe_on, compare_nulls, partition.mr);
+    auto columns    = gather(probe_view, maps.first->view(), false, partition.mr)->release();
+    auto build_rows = detail::gather(build_view,
+                                     maps.second->view(),
+                                     detail::out_of_bounds_policy::NULLIFY,
+                                     detail::negative_index_policy::NOT_ALLOWED,
+                                     partition.mr)
+                        ->release();
+    std::move(build_rows.begin(), build_rows.end(), std::back_inserter(columns));
+    results.push_back(
+      {partition.device, std::make_unique<table>(std::move(columns)), partition.mr});
+  }
+
+  // The replicas may still be read from the packed build table
+  for (auto const& r : replicas) { synchronize_device(r.first); }
+  return distributed_table{std::move(results)};
+}
+
+}  // namespace
+
+distributed_table::distributed_table(std::vector<device_partition>&& partitions)
+  : _partitions{std::move(partitions)}
+{
+  std::vector<int> devices;
+  for (auto const& partition : _partitions) {
+    CUDF_EXPECTS(partition.data != nullptr, "Unexpected null partition");
+    CUDF_EXPECTS(partition.mr != nullptr, "Unexpected null memory resource");
+    auto const& first = *_partitions.front().data;
+    CUDF_EXPECTS(partition.data->num_columns() == first.num_columns(),
+                 "Mismatch in the number of columns of the partitions");
+    for (size_type i = 0; i < first.num_columns(); ++i) {
+      CUDF_EXPECTS(partition.data->get_column(i).type() == first.get_column(i).type(),
+                   "Mismatch in the column types of the partitions");
+    }
+    devices.push_back(partition.device);
+  }
+  enable_peer_access(devices);
+}
+
+size_type distributed_table::num_rows() const noexcept
+{
+  return std::accumulate(
+    _partitions.begin(), _partitions.end(), size_type{0}, [](size_type rows, auto const& p) {
+      return rows + p.data->num_rows();
+    });
+}
+
+void enable_peer_access(std::vector<int> const& devices)
+{
+  for (auto const device : devices) {
+    for (auto const peer : devices) { enable_peer(device, peer); }
+  }
+}
+
+std::unique_ptr<table> concatenate(distributed_table const& input,
+                                   int device,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(input.num_partitions() > 0, "Cannot concatenate a table without partitions");
+  auto const partitions = partitions_on_device(input, all_columns(input), device, mr);
+  device_guard guard(device);
+  return concatenate(partitions.first, mr);
+}
+
+std::unique_ptr<table> gather(distributed_table const& input,
+                              std::vector<size_type> const& column_indices,
+                              column_view const& gather_map,
+                              int device,
+                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(input.num_partitions() > 0, "Cannot gather from a table without partitions");
+  auto const partitions = partitions_on_device(input, column_indices, device, mr);
+  device_guard guard(device);
+  if (partitions.first.size() == 1) {
+    return gather(partitions.first.front(), gather_map, false, mr);
+  }
+  auto const rows = concatenate(partitions.first, mr);
+  return gather(rows->view(), gather_map, false, mr);
+}
+
+std::unique_ptr<scalar> reduce(distributed_table const& input,
+                               size_type column_index,
+                               std::unique_ptr<aggregation> const& agg,
+                               data_type output_dtype,
+                               int device,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  auto const k = agg->kind;
+  CUDF_EXPECTS(k == aggregation::SUM or k == aggregation::PRODUCT or k == aggregation::MIN or
+                 k == aggregation::MAX or k == aggregation::ANY or k == aggregation::ALL,
+               "Unsupported aggregation for the reduction of a distributed table");
+
+  // A row per partition, null if the partition has no valid element
+  std::vector<device_partition> partials;
+  for (size_type i = 0; i < input.num_partitions(); ++i) {
+    auto const& partition = input.partition(i);
+    device_guard guard(partition.device);
+    auto const partial =
+      reduce(partition.data->get_column(column_index).view(), agg, output_dtype, partition.mr);
+    std::vector<std::unique_ptr<column>> columns;
+    columns.push_back(make_column_from_scalar(*partial, 1, partition.mr));
+    partials.push_back(
+      {partition.device, std::make_unique<table>(std::move(columns)), partition.mr});
+  }
+
+  auto const rows = concatenate(distributed_table{std::move(partials)}, device, mr);
+  device_guard guard(device);
+  return reduce(rows->get_column(0).view(), agg, output_dtype, mr);
+}
+
+distributed_table broadcast(table_view const& input,
+                            int source_device,
+                            distributed_table const& layout)
+{
+  CUDF_FUNC_RANGE();
+  // The columns are copied from their head, which requires them unsliced
+  std::unique_ptr<table> compacted;
+  auto source = input;
+  if (std::any_of(input.begin(), input.end(), [](auto const& c) { return c.offset() != 0; })) {
+    device_guard guard(source_device);
+    compacted = std::make_unique<table>(input);
+    source    = compacted->view();
+  }
+  synchronize_device(source_device);
+
+  std::vector<device_partition> copies;
+  for (size_type i = 0; i < layout.num_partitions(); ++i) {
+    auto const& partition = layout.partition(i);
+    copies.push_back({partition.device,
+                      copy_table(source, source_device, partition.device, partition.mr),
+                      partition.mr});
+  }
+  // The copies may still read the compacted columns
+  for (auto const& copy : copies) { synchronize_device(copy.device); }
+  return distributed_table{std::move(copies)};
+}
+
+distributed_table broadcast_inner_join(distributed_table const& probe,
+                                       std::vector<size_type> const& probe_on,
+                                       table_view const& build,
+                                       int build_device,
+                                       std::vector<size_type> const& build_on,
+                                       null_equality compare_nulls)
+{
+  CUDF_FUNC_RANGE();
+  return broadcast_join(
+    probe, probe_on, build, build_device, build_on, join_kind::INNER_JOIN, compare_nulls);
+}
+
+distributed_table broadcast_left_join(distributed_table const& probe,
+                                      std::vector<size_type> const& probe_on,
+                                      table_view const& build,
+                                      int build_device,
+                                      std::vector<size_type> const& build_on,
+                                      null_equality compare_nulls)
+{
+  CUDF_FUNC_RANGE();
+  return broadcast_join(
+    probe, probe_on, build, build_device, build_on, join_kind::LEFT_JOIN, compare_nulls);
+}
+
+}  // namespace cudf
@@ -22,7 +22,7 @@
 namespace cudf {
 
 // Copy the columns from another table
-table::table(table const& other) : _num_rows{other.num_rows()}
+table::table(table const& other) : _num_rows{other.num_rows()}, _sort_order{other._sort_order}
 {
   CUDF_FUNC_RANGE();
   _columns.reserve(other._columns.size());
@@ -66,6 +66,7 @@ table_view table::view() const
 // Create mutable view
 mutable_table_view table::mutable_view()
 {
+  _sort_order = {};
   std::vector<mutable_column_view> views;
   views.reserve(_columns.size());
   for (auto const& c : _columns) { views.push_back(c->mutable_view()); }
@@ -75,7 +76,8 @@ mutable_table_view table::mutable_view()
 // Release ownership of columns
 std::vector<std::unique_ptr<column>> table::release()
 {
-  _num_rows = 0;
+  _num_rows   = 0;
+  _sort_order = {};
   return std::move(_columns);
 }
 
@@ -87,4 +89,44 @@ table_view table::select(std::vector<cudf::size_type> const& column_indices) con
   return table_view(columns);
 }
 
+// Record the columns the rows are sorted by
+void table::set_sort_order(std::vector<size_type> const& key_columns,
+                           std::vector<order> const& column_order,
+                           std::vector<null_order> const& null_precedence)
+{
+  CUDF_EXPECTS(column_order.size() == key_columns.size(),
+               "Mismatch between number of key columns and column_order size.");
+  CUDF_EXPECTS(null_precedence.empty() or null_precedence.size() == key_columns.size(),
+               "Mismatch between number of key columns and null_precedence size.");
+  for (auto index : key_columns) {
+    CUDF_EXPECTS(index >= 0 and index < num_columns(), "Key column index out of bounds.");
+  }
+  _sort_order.key_columns  = key_columns;
+  _sort_order.column_order = column_order;
+  _sort_order.null_precedence =
+    null_precedence.empty() ? std::vector<null_order>(key_columns.size(), null_order::BEFORE)
+                            : null_precedence;
+}
+
+// Whether `key_columns` lead the recorded sort order
+bool table::is_sorted_by(std::vector<size_type> const& key_columns,
+                         std::vector<order> const& column_order,
+                         std::vector<null_order> const& null_precedence) const
+{
+  if (key_columns.empty() or key_columns.size() > _sort_order.key_columns.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < key_columns.size(); ++i) {
+    auto const expected_order = column_order.empty() ? order::ASCENDING : column_order.at(i);
+    auto const expected_null_order =
+      null_precedence.empty() ? null_order::BEFORE : null_precedence.at(i);
+    if (key_columns[i] != _sort_order.key_columns[i] or
+        expected_order != _sort_order.column_order[i] or
+        expected_null_order != _sort_order.null_precedence[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
 }  // namespace cudf
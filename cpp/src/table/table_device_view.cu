@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2020, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,19 +15,22 @@
  */
 
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/utilities/view_descriptors.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/error.hpp>
 
 #include <algorithm>
 #include <numeric>
-#include <vector>
+#include <type_traits>
+#include <utility>
 
 namespace cudf {
 namespace detail {
 template <typename ColumnDeviceView, typename HostTableView>
 void table_device_view_base<ColumnDeviceView, HostTableView>::destroy()
 {
+  delete _descendant_storage;
   delete this;
 }
 
@@ -48,42 +51,36 @@ table_device_view_base<ColumnDeviceView, HostTableView>::table_device_view_base(
       std::accumulate(source_view.begin(), source_view.end(), 0, [](std::size_t init, auto col) {
         return init + ColumnDeviceView::extent(col);
       });
-    // A buffer of CPU memory is allocated to hold the ColumnDeviceView
-    // objects. Once filled, the CPU memory is then copied to device memory
-    // and the pointer is set in the _columns member.
-    std::vector<int8_t> h_buffer(views_size_bytes);
-    ColumnDeviceView* h_column = reinterpret_cast<ColumnDeviceView*>(h_buffer.data());
-    // Each ColumnDeviceView instance may have child objects which may
-    // require setting some internal device pointers before being copied
-    // from CPU to device.
-    // Allocate the device memory to be used in the result.
-    // We need this pointer in order to pass it down when creating the
-    // ColumnDeviceViews so the column can set the pointer(s) for any
-    // of its child objects.
-    _descendant_storage = new rmm::device_buffer(views_size_bytes, stream);
-    _columns            = reinterpret_cast<ColumnDeviceView*>(_descendant_storage->data());
-    // The beginning of the memory must be the fixed-sized ColumnDeviceView
-    // objects in order for _columns to be used as an array. Therefore,
-    // any child data is assigned to the end of this array (h_end/d_end).
-    auto h_end = (int8_t*)(h_column + source_view.num_columns());
-    auto d_end = (int8_t*)(_columns + source_view.num_columns());
-    // Create the ColumnDeviceView from each column within the CPU memory
-    // Any column child data should be copied into h_end and any
-    // internal pointers should be set using d_end.
-    for (auto itr = source_view.begin(); itr != source_view.end(); ++itr) {
-      auto col = *itr;
-      // convert the ColumnView into ColumnDeviceView
-      new (h_column) ColumnDeviceView(col, h_end, d_end);
-      h_column++;  // point to memory slot for the next ColumnDeviceView
-      // update the pointers for holding ColumnDeviceView's child data
-      auto col_child_data_size = (ColumnDeviceView::extent(col) - sizeof(ColumnDeviceView));
-      h_end += col_child_data_size;
-      d_end += col_child_data_size;
-    }
-
-    CUDA_TRY(
-      cudaMemcpyAsync(_columns, h_buffer.data(), views_size_bytes, cudaMemcpyDefault, stream));
-    CUDA_TRY(cudaStreamSynchronize(stream));
+    // The ColumnDeviceView objects are laid out in host memory and then copied to device memory
+    // for the _columns member. Each ColumnDeviceView instance may have child objects which
+    // require setting some internal device pointers, so the layout is computed for the device
+    // address it is copied to. Views of immutable tables may share the copy with equal views.
+    auto fill = [&source_view](void* h_ptr, void* d_ptr) {
+      auto h_column = reinterpret_cast<ColumnDeviceView*>(h_ptr);
+      auto d_column = reinterpret_cast<ColumnDeviceView*>(d_ptr);
+      // The beginning of the memory must be the fixed-sized ColumnDeviceView
+      // objects in order for _columns to be used as an array. Therefore,
+      // any child data is assigned to the end of this array (h_end/d_end).
+      auto h_end = (int8_t*)(h_column + source_view.num_columns());
+      auto d_end = (int8_t*)(d_column + source_view.num_columns());
+      // Create the ColumnDeviceView from each column within the CPU memory
+      // Any column child data should be copied into h_end and any
+      // internal pointers should be set using d_end.
+      for (auto itr = source_view.begin(); itr != source_view.end(); ++itr) {
+        auto col = *itr;
+        // convert the ColumnView into ColumnDeviceView
+        new (h_column) ColumnDeviceView(col, h_end, d_end);
+        h_column++;  // point to memory slot for the next ColumnDeviceView
+        // update the pointers for holding ColumnDeviceView's child data
+        auto col_child_data_size = (ColumnDeviceView::extent(col) - sizeof(ColumnDeviceView));
+        h_end += col_child_data_size;
+        d_end += col_child_data_size;
+      }
+    };
+    auto storage = copy_view_descriptors(
+      views_size_bytes, fill, std::is_same<HostTableView, table_view>::value, stream);
+    _columns            = reinterpret_cast<ColumnDeviceView*>(storage->data());
+    _descendant_storage = new view_descriptors{std::move(storage)};
   }
 }
 
@@ -33,39 +33,6 @@
 namespace nvtext {
 namespace detail {
 namespace {
-/**
- * @brief This records the byte positions of each token within each string.
- *
- * The position values are recorded since we need to reference tokens
- * within a string multiple times to generate the ngrams. For example,
- * to generate tri-grams for string "aa b ccc dd" requires creating
- * the following two strings ["aa_b_ccc","b_ccc_dd"]. Notice the
- * tokens "b" and "ccc" needed to be copied twice for this string.
- *
- * Most of the work is done in the characters_tokenizer locating the tokens.
- * This functor simply records the byte positions in the d_token_positions
- * member.
- */
-struct string_tokens_positions_fn {
-  cudf::column_device_view const d_strings;  // strings to tokenize
-  cudf::string_view const d_delimiter;       // delimiter to tokenize around
-  int32_t const* d_token_offsets;            // offsets into the d_token_positions for each string
-  position_pair* d_token_positions;          // token positions in each string
-
-  __device__ void operator()(cudf::size_type idx)
-  {
-    if (d_strings.is_null(idx)) return;
-    cudf::string_view d_str = d_strings.element<cudf::string_view>(idx);
-    // create tokenizer for this string
-    characters_tokenizer tokenizer(d_str, d_delimiter);
-    // record the token positions for this string
-    cudf::size_type token_index = 0;
-    auto token_positions        = d_token_positions + d_token_offsets[idx];
-    while (tokenizer.next_token())
-      token_positions[token_index++] = tokenizer.token_byte_positions();
-  }
-};
-
 /**
  * @brief Generate the ngrams for each string.
  *
@@ -151,28 +118,13 @@ std::unique_ptr<cudf::column> ngrams_tokenize(
   // Example for comments with ngrams=2
   // ["a bb ccc","dd e"] => ["a_bb", "bb_ccc", "dd_e"]
 
-  // first, get the number of tokens per string to get the token-offsets
+  // first, locate the tokens of all the strings at once to get the token-offsets
+  // and the token positions (in bytes) per string
   // Ex. token-counts = [3,2]; token-offsets = [0,3,5]
-  rmm::device_vector<int32_t> token_offsets(strings_count + 1);
-  auto d_token_offsets = token_offsets.data().get();
-  thrust::transform_inclusive_scan(rmm::exec_policy(stream)->on(stream),
-                                   thrust::make_counting_iterator<cudf::size_type>(0),
-                                   thrust::make_counting_iterator<cudf::size_type>(strings_count),
-                                   d_token_offsets + 1,
-                                   strings_tokenizer{d_strings, d_delimiter},
-                                   thrust::plus<int32_t>());
-  CUDA_TRY(cudaMemsetAsync(d_token_offsets, 0, sizeof(int32_t), stream));
-  auto total_tokens = token_offsets[strings_count];  // Ex. 5 tokens
-
-  // get the token positions (in bytes) per string
-  // Ex. start/end pairs: [(0,1),(2,4),(5,8), (0,2),(3,4)]
-  rmm::device_vector<position_pair> token_positions(total_tokens);
-  auto d_token_positions = token_positions.data().get();
-  thrust::for_each_n(
-    execpol->on(stream),
-    thrust::make_counting_iterator<cudf::size_type>(0),
-    strings_count,
-    string_tokens_positions_fn{d_strings, d_delimiter, d_token_offsets, d_token_positions});
+  //     start/end pairs: [(0,1),(2,4),(5,8), (0,2),(3,4)]
+  auto const tokens      = locate_tokens(strings, d_delimiter, stream);
+  auto d_token_offsets   = tokens.offsets.data().get();
+  auto d_token_positions = tokens.positions.data().get();
 
   // compute the number of ngrams per string to get the total number of ngrams to generate
   // Ex. ngram-counts = [2,1]; ngram-offsets = [0,2,3]; total = 3 bigrams
@@ -24,6 +24,7 @@
 #include <cudf/utilities/error.hpp>
 #include <nvtext/detail/tokenize.hpp>
 #include <nvtext/tokenize.hpp>
+#include <strings/target_trie.cuh>
 #include <strings/utilities.cuh>
 #include <text/utilities/tokenize_ops.cuh>
 
@@ -31,13 +32,11 @@ namespace nvtext {
 namespace detail {
 namespace {
 
-using strings_iterator = cudf::column_device_view::const_iterator<cudf::string_view>;
-
 /**
  * @brief Functor to replace tokens in each string.
  *
  * This tokenizes a string using the given d_delimiter and replaces any tokens that match
- * a string in d_targets_begin/end with those from the d_replacements column.
+ * a string in the d_targets trie with those from the d_replacements column.
  * Strings with no matching tokens are left unchanged.
  *
  * This should be called first to compute the size of each output string and then a second
@@ -45,8 +44,8 @@ using strings_iterator = cudf::column_device_view::const_iterator<cudf::string_v
  */
 struct replace_tokens_fn {
   cudf::column_device_view const d_strings;  ///< strings to tokenize
-  strings_iterator d_targets_begin;          ///< strings to search for
-  strings_iterator d_targets_end;
+  /// trie of the strings to search for
+  cudf::strings::detail::target_trie_device const d_targets;
   cudf::column_device_view const d_replacements;  ///< replacement strings
   cudf::string_view const d_delimiter;            ///< delimiter characters for tokenizing
   const int32_t* d_offsets{};                     ///< for locating output string in d_chars
@@ -69,12 +68,11 @@ struct replace_tokens_fn {
         cudf::string_view{d_str.data() + token_pos.first, token_pos.second - token_pos.first};
 
       // check if the token matches any of the targets
-      auto const found_itr = thrust::find(thrust::seq, d_targets_begin, d_targets_end, token);
-      if (found_itr != d_targets_end) {  // match found
+      auto const repl_idx = d_targets.find(token.data(), token.size_bytes());
+      if (repl_idx >= 0) {  // match found
         // retrieve the corresponding replacement string or
         // if only one repl string, use that one for all targets
         auto const d_repl = [&] {
-          auto const repl_idx = thrust::distance(d_targets_begin, found_itr);
           return d_replacements.size() == 1 ? d_replacements.element<cudf::string_view>(0)
                                             : d_replacements.element<cudf::string_view>(repl_idx);
         }();
@@ -121,14 +119,11 @@ std::unique_ptr<cudf::column> replace_tokens(cudf::strings_column_view const& st
   if (strings_count == 0) return cudf::make_empty_column(cudf::data_type{cudf::type_id::STRING});
 
   auto strings_column      = cudf::column_device_view::create(strings.parent(), stream);
-  auto targets_column      = cudf::column_device_view::create(targets.parent(), stream);
   auto replacements_column = cudf::column_device_view::create(replacements.parent(), stream);
+  cudf::strings::detail::target_trie const targets_trie(targets, stream);
   cudf::string_view d_delimiter(delimiter.data(), delimiter.size());
-  replace_tokens_fn replacer{*strings_column,
-                             targets_column->begin<cudf::string_view>(),
-                             targets_column->end<cudf::string_view>(),
-                             *replacements_column,
-                             d_delimiter};
+  replace_tokens_fn replacer{
+    *strings_column, targets_trie.view(), *replacements_column, d_delimiter};
 
   // copy null mask from input column
   rmm::device_buffer null_mask = copy_bitmask(strings.parent(), stream, mr);
@@ -0,0 +1,352 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/case.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <nvtext/subword_tokenize.hpp>
+
+#include <thrust/count.h>
+#include <thrust/find.h>
+#include <thrust/for_each.h>
+
+#include <functional>
+#include <limits>
+
+namespace nvtext {
+namespace detail {
+namespace {
+// words longer than this are replaced by the unknown token, as BERT tokenizers do
+constexpr cudf::size_type max_word_characters = 100;
+
+/**
+ * @brief Return true if the byte is an ASCII punctuation character.
+ */
+__device__ bool is_punctuation(uint8_t byte)
+{
+  return ((byte >= '!') && (byte <= '/')) || ((byte >= ':') && (byte <= '@')) ||
+         ((byte >= '[') && (byte <= '`')) || ((byte >= '{') && (byte <= '~'));
+}
+
+/**
+ * @brief Device view of the vocabulary hash tables.
+ *
+ * Each table is open-addressed with linear probing, and holds the token ids at the slot of
+ * their hash, or -1 for empty slots. Tables are at least twice the size of the vocabulary so
+ * there is always an empty slot ending a probe.
+ */
+struct vocabulary_device {
+  cudf::column_device_view const d_vocabulary;
+  int32_t* d_words;     // tokens starting a word
+  int32_t* d_suffixes;  // tokens continuing a word, hashed without their "##"
+  uint32_t mask;        // table size - 1
+
+  /**
+   * @brief Returns the bytes of the token hashed in its table.
+   */
+  __device__ cudf::string_view key(int32_t id, bool suffix) const
+  {
+    auto const token = d_vocabulary.element<cudf::string_view>(id);
+    return suffix ? cudf::string_view(token.data() + 2, token.size_bytes() - 2) : token;
+  }
+
+  /**
+   * @brief Returns the id of the token `d_piece`, or -1 if it is not in the vocabulary.
+   *
+   * @param suffix True to find the token continuing a word, "##" followed by `d_piece`.
+   */
+  __device__ int32_t find(cudf::string_view const& d_piece, bool suffix) const
+  {
+    auto const table = suffix ? d_suffixes : d_words;
+    auto slot        = MurmurHash3_32<cudf::string_view>{}(d_piece) & mask;
+    for (auto id = table[slot]; id >= 0; id = table[slot]) {
+      if (key(id, suffix) == d_piece) return id;
+      slot = (slot + 1) & mask;
+    }
+    return -1;
+  }
+};
+
+/**
+ * @brief Inserts each token in its hash table.
+ */
+struct insert_token_fn {
+  vocabulary_device d_vocabulary;
+
+  __device__ void operator()(int32_t id)
+  {
+    auto const token  = d_vocabulary.d_vocabulary.element<cudf::string_view>(id);
+    bool const suffix = (token.size_bytes() > 2) && (token.data()[0] == '#') &&
+                        (token.data()[1] == '#');
+    auto const table  = suffix ? d_vocabulary.d_suffixes : d_vocabulary.d_words;
+    auto const key    = d_vocabulary.key(id, suffix);
+    auto slot         = MurmurHash3_32<cudf::string_view>{}(key) & d_vocabulary.mask;
+    while (atomicCAS(table + slot, -1, id) != -1) slot = (slot + 1) & d_vocabulary.mask;
+  }
+};
+
+/**
+ * @brief Returns true for the id of the token equal to `d_token`.
+ */
+struct token_equal_fn {
+  cudf::column_device_view const d_vocabulary;
+  cudf::string_view const d_token;
+
+  __device__ bool operator()(int32_t id) const
+  {
+    return d_vocabulary.element<cudf::string_view>(id) == d_token;
+  }
+};
+
+/**
+ * @brief Splits each string into the WordPiece tokens of the vocabulary.
+ *
+ * Each string writes its `sequence_length` token ids, mask values and offsets.
+ */
+struct wordpiece_tokenizer_fn {
+  cudf::column_device_view const d_strings;
+  vocabulary_device const d_vocabulary;
+  int32_t unknown_id;
+  cudf::size_type sequence_length;
+  int32_t* d_token_ids;
+  int8_t* d_attention_mask;
+  int32_t* d_token_offsets;
+
+  /**
+   * @brief Adds the tokens of the word in bytes `[begin, end)` of `d_str`.
+   *
+   * @return The number of tokens of the string after this word.
+   */
+  __device__ cudf::size_type add_word_tokens(cudf::string_view const& d_str,
+                                             cudf::size_type begin,
+                                             cudf::size_type end,
+                                             cudf::size_type count,
+                                             int32_t* ids,
+                                             int32_t* offsets) const
+  {
+    auto const data = d_str.data();
+    auto const chars =
+      thrust::count_if(thrust::seq, data + begin, data + end, [] __device__(char byte) {
+        return cudf::strings::detail::is_begin_utf8_char(byte);
+      });
+    auto const first_count = count;
+    if (chars <= max_word_characters) {
+      // the longest token from the start of the remaining piece of the word
+      for (auto start = begin; (start < end) && (count < sequence_length);) {
+        auto stop  = end;
+        int32_t id = -1;
+        while (stop > start) {
+          id = d_vocabulary.find(cudf::string_view(data + start, stop - start), start > begin);
+          if (id >= 0) break;
+          do {  // back off one character
+            --stop;
+          } while ((stop > start) && !cudf::strings::detail::is_begin_utf8_char(data[stop]));
+        }
+        if (id < 0) {  // the whole word is unknown
+          count = first_count;
+          break;
+        }
+        ids[count]     = id;
+        offsets[count] = start;
+        ++count;
+        start = stop;
+      }
+    }
+    if (count == first_count) {
+      ids[count]     = unknown_id;
+      offsets[count] = begin;
+      ++count;
+    }
+    return count;
+  }
+
+  __device__ void operator()(cudf::size_type idx) const
+  {
+    auto const first      = static_cast<std::size_t>(idx) * sequence_length;
+    auto ids              = d_token_ids + first;
+    auto offsets          = d_token_offsets + first;
+    cudf::size_type count = 0;
+    if (d_strings.is_valid(idx)) {
+      auto const d_str = d_strings.element<cudf::string_view>(idx);
+      auto const data  = reinterpret_cast<uint8_t const*>(d_str.data());
+      auto const bytes = d_str.size_bytes();
+      for (cudf::size_type pos = 0; (pos < bytes) && (count < sequence_length);) {
+        if (data[pos] <= ' ') {  // whitespace
+          ++pos;
+          continue;
+        }
+        // a word ends at whitespace or punctuation, which is a word by itself
+        auto end = pos + 1;
+        if (!is_punctuation(data[pos]))
+          while ((end < bytes) && (data[end] > ' ') && !is_punctuation(data[end])) ++end;
+        count = add_word_tokens(d_str, pos, end, count, ids, offsets);
+        pos   = end;
+      }
+    }
+    auto const mask = d_attention_mask + first;
+    for (cudf::size_type jdx = 0; jdx < sequence_length; ++jdx) mask[jdx] = (jdx < count);
+    for (cudf::size_type jdx = count; jdx < sequence_length; ++jdx) {
+      ids[jdx]     = 0;
+      offsets[jdx] = 0;
+    }
+  }
+};
+
+}  // namespace
+}  // namespace detail
+
+struct wordpiece_vocabulary::vocabulary_impl {
+ public:
+  vocabulary_impl()                       = delete;
+  vocabulary_impl(vocabulary_impl const&) = delete;
+  vocabulary_impl& operator=(vocabulary_impl const&) = delete;
+
+  vocabulary_impl(cudf::strings_column_view const& vocabulary,
+                  std::string const& unknown_token,
+                  cudaStream_t stream = 0)
+  {
+    CUDF_EXPECTS(vocabulary.size() > 0, "Vocabulary must not be empty");
+    CUDF_EXPECTS(!vocabulary.has_nulls(), "Vocabulary must not have nulls");
+    _vocabulary      = std::make_unique<cudf::column>(vocabulary.parent(), stream);
+    _d_vocabulary    = cudf::column_device_view::create(_vocabulary->view(), stream);
+    auto const count = vocabulary.size();
+
+    // tables of a power of 2 size, at least twice the number of tokens
+    std::size_t size = 2;
+    while (size < 2 * static_cast<std::size_t>(count)) size *= 2;
+    _words.resize(size, -1);
+    _suffixes.resize(size, -1);
+    thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<int32_t>(0),
+                     thrust::make_counting_iterator<int32_t>(count),
+                     detail::insert_token_fn{get_device_vocabulary()});
+
+    cudf::string_scalar const token(unknown_token, true, stream);
+    auto const itr = thrust::find_if(rmm::exec_policy(stream)->on(stream),
+                                     thrust::make_counting_iterator<int32_t>(0),
+                                     thrust::make_counting_iterator<int32_t>(count),
+                                     detail::token_equal_fn{*_d_vocabulary, token.value(stream)});
+    _unknown_id = *itr;
+    CUDF_EXPECTS(_unknown_id < count, "Unknown token must be in the vocabulary");
+  }
+
+  detail::vocabulary_device get_device_vocabulary() const
+  {
+    return detail::vocabulary_device{*_d_vocabulary,
+                                     const_cast<int32_t*>(_words.data().get()),
+                                     const_cast<int32_t*>(_suffixes.data().get()),
+                                     static_cast<uint32_t>(_words.size() - 1)};
+  }
+
+  int32_t unknown_id() const { return _unknown_id; }
+
+ private:
+  std::unique_ptr<cudf::column> _vocabulary;
+  std::unique_ptr<cudf::column_device_view, std::function<void(cudf::column_device_view*)>>
+    _d_vocabulary;
+  rmm::device_vector<int32_t> _words;
+  rmm::device_vector<int32_t> _suffixes;
+  int32_t _unknown_id;
+};
+
+namespace detail {
+subword_tokens subword_tokenize(cudf::strings_column_view const& strings,
+                                wordpiece_vocabulary const& vocabulary,
+                                cudf::size_type max_sequence_length,
+                                bool do_lower_case,
+                                rmm::mr::device_memory_resource* mr,
+                                cudaStream_t stream = 0)
+{
+  CUDF_EXPECTS(max_sequence_length > 0, "Parameter max_sequence_length must be positive");
+  auto const strings_count = strings.size();
+  CUDF_EXPECTS(static_cast<std::size_t>(strings_count) * max_sequence_length <=
+                 static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max()),
+               "Size of the output exceeds the column size limit");
+  auto const size = strings_count * max_sequence_length;
+
+  subword_tokens result;
+  result.token_ids      = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                               size,
+                                               cudf::mask_state::UNALLOCATED,
+                                               stream,
+                                               mr);
+  result.attention_mask = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT8},
+                                                    size,
+                                                    cudf::mask_state::UNALLOCATED,
+                                                    stream,
+                                                    mr);
+  result.token_offsets  = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                                   size,
+                                                   cudf::mask_state::UNALLOCATED,
+                                                   stream,
+                                                   mr);
+  if (strings_count == 0) return result;
+
+  // lower case strings are only needed until the tokens are found
+  std::unique_ptr<cudf::column> lower_strings;
+  if (do_lower_case) lower_strings = cudf::strings::to_lower(strings);
+  auto strings_column =
+    cudf::column_device_view::create(do_lower_case ? lower_strings->view() : strings.parent(),
+                                     stream);
+  thrust::for_each_n(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    strings_count,
+    wordpiece_tokenizer_fn{*strings_column,
+                           vocabulary.get_impl()->get_device_vocabulary(),
+                           vocabulary.get_impl()->unknown_id(),
+                           max_sequence_length,
+                           result.token_ids->mutable_view().data<int32_t>(),
+                           result.attention_mask->mutable_view().data<int8_t>(),
+                           result.token_offsets->mutable_view().data<int32_t>()});
+  return result;
+}
+
+}  // namespace detail
+
+wordpiece_vocabulary::wordpiece_vocabulary(cudf::strings_column_view const& vocabulary,
+                                           std::string const& unknown_token)
+  : impl{std::make_unique<const vocabulary_impl>(vocabulary, unknown_token)}
+{
+}
+
+wordpiece_vocabulary::~wordpiece_vocabulary() = default;
+
+wordpiece_vocabulary::vocabulary_impl const* wordpiece_vocabulary::get_impl() const
+{
+  return impl.get();
+}
+
+// external API
+
+subword_tokens subword_tokenize(cudf::strings_column_view const& strings,
+                                wordpiece_vocabulary const& vocabulary,
+                                cudf::size_type max_sequence_length,
+                                bool do_lower_case,
+                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::subword_tokenize(strings, vocabulary, max_sequence_length, do_lower_case, mr);
+}
+
+}  // namespace nvtext
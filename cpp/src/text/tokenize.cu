@@ -26,12 +26,50 @@
 #include <nvtext/tokenize.hpp>
 #include <text/utilities/tokenize_ops.cuh>
 
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
 #include <thrust/count.h>
 #include <thrust/transform.h>
 
 namespace nvtext {
 namespace detail {
 namespace {
+/**
+ * @brief Identifies the first byte of each token in the chars of a strings column.
+ *
+ * A token starts at a character that is not a delimiter, at the beginning of
+ * its string or following a delimiter.
+ */
+struct token_start_fn {
+  cudf::column_device_view const d_strings;
+  cudf::string_view const d_delimiter;
+  int32_t const* d_offsets;  // offsets of the strings, adjusted for the column's offset
+  char const* d_chars;
+
+  // true if a delimiter character starts at this byte position
+  __device__ bool is_delimiter_at(cudf::size_type pos) const
+  {
+    if (!cudf::strings::detail::is_begin_utf8_char(d_chars[pos])) return false;
+    cudf::char_utf8 chr = 0;
+    cudf::strings::detail::to_char_utf8(d_chars + pos, chr);
+    return is_delimiter(d_delimiter, chr);
+  }
+
+  __device__ bool operator()(cudf::size_type pos) const
+  {
+    if (!cudf::strings::detail::is_begin_utf8_char(d_chars[pos]) || is_delimiter_at(pos))
+      return false;
+    auto const idx = static_cast<cudf::size_type>(
+      thrust::upper_bound(thrust::seq, d_offsets, d_offsets + d_strings.size(), pos) - d_offsets -
+      1);
+    if (d_strings.is_null(idx)) return false;
+    if (pos == d_offsets[idx]) return true;
+    auto prev = pos - 1;  // the first byte of the previous character
+    while (!cudf::strings::detail::is_begin_utf8_char(d_chars[prev])) --prev;
+    return is_delimiter_at(prev);
+  }
+};
+
 // common pattern for token_count functions
 template <typename TokenCounter>
 std::unique_ptr<cudf::column> token_count_fn(cudf::size_type strings_count,
@@ -90,6 +128,72 @@ std::unique_ptr<cudf::column> tokenize_fn(cudf::size_type strings_count,
 
 }  // namespace
 
+strings_token_positions locate_tokens(cudf::strings_column_view const& strings,
+                                      cudf::string_view const& d_delimiter,
+                                      cudaStream_t stream,
+                                      bool with_positions)
+{
+  auto const strings_count = strings.size();
+  strings_token_positions result;
+  result.offsets.resize(strings_count + 1, 0);
+  if (strings_count == 0) return result;
+
+  auto execpol         = rmm::exec_policy(stream);
+  auto strings_column  = cudf::column_device_view::create(strings.parent(), stream);
+  auto const d_offsets = strings.offsets().data<int32_t>() + strings.offset();
+  auto const d_chars   = strings.chars().data<char>();
+  auto const first_offset =
+    cudf::detail::get_value<int32_t>(strings.offsets(), strings.offset(), stream);
+  auto const last_offset =
+    cudf::detail::get_value<int32_t>(strings.offsets(), strings.offset() + strings_count, stream);
+
+  // locate the first byte of every token
+  token_start_fn is_token_start{*strings_column, d_delimiter, d_offsets, d_chars};
+  auto const tokens_count = thrust::count_if(execpol->on(stream),
+                                             thrust::make_counting_iterator(first_offset),
+                                             thrust::make_counting_iterator(last_offset),
+                                             is_token_start);
+  rmm::device_vector<cudf::size_type> starts(tokens_count);
+  auto const d_starts     = starts.data().get();
+  auto const d_starts_end = d_starts + tokens_count;
+  thrust::copy_if(execpol->on(stream),
+                  thrust::make_counting_iterator(first_offset),
+                  thrust::make_counting_iterator(last_offset),
+                  d_starts,
+                  is_token_start);
+
+  // the tokens of each string start after the ones of the previous strings
+  thrust::transform(execpol->on(stream),
+                    d_offsets,
+                    d_offsets + strings_count + 1,
+                    result.offsets.begin(),
+                    [d_starts, d_starts_end] __device__(int32_t offset) {
+                      return static_cast<int32_t>(
+                        thrust::lower_bound(thrust::seq, d_starts, d_starts_end, offset) -
+                        d_starts);
+                    });
+  if (!with_positions) return result;
+
+  // each token ends at the next delimiter or at the end of its string
+  result.positions.resize(tokens_count);
+  thrust::transform(
+    execpol->on(stream),
+    d_starts,
+    d_starts_end,
+    result.positions.begin(),
+    [is_token_start, d_offsets, strings_count] __device__(cudf::size_type start) {
+      auto const idx = static_cast<cudf::size_type>(
+        thrust::upper_bound(thrust::seq, d_offsets, d_offsets + strings_count, start) -
+        d_offsets - 1);
+      auto const begin = d_offsets[idx];
+      auto const end   = d_offsets[idx + 1];
+      auto pos         = start + 1;
+      while ((pos < end) && !is_token_start.is_delimiter_at(pos)) ++pos;
+      return position_pair{start - begin, pos - begin};
+    });
+  return result;
+}
+
 // detail APIs
 
 // zero or more character tokenizer
@@ -100,8 +204,30 @@ std::unique_ptr<cudf::column> tokenize(cudf::strings_column_view const& strings,
 {
   CUDF_EXPECTS(delimiter.is_valid(), "Parameter delimiter must be valid");
   cudf::string_view d_delimiter(delimiter.data(), delimiter.size());
-  auto strings_column = cudf::column_device_view::create(strings.parent(), stream);
-  return tokenize_fn(strings.size(), strings_tokenizer{*strings_column, d_delimiter}, mr, stream);
+  auto const tokens = locate_tokens(strings, d_delimiter, stream);
+  // build a list of pointers to each token
+  auto strings_column      = cudf::column_device_view::create(strings.parent(), stream);
+  auto d_strings           = *strings_column;
+  auto const d_token_offs  = tokens.offsets.data().get();
+  auto const strings_count = strings.size();
+  rmm::device_vector<string_index_pair> token_pairs(tokens.positions.size());
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<cudf::size_type>(0),
+                    thrust::make_counting_iterator<cudf::size_type>(token_pairs.size()),
+                    tokens.positions.begin(),
+                    token_pairs.begin(),
+                    [d_strings, d_token_offs, strings_count] __device__(cudf::size_type token_idx,
+                                                                         position_pair position) {
+                      auto const idx = static_cast<cudf::size_type>(
+                        thrust::upper_bound(
+                          thrust::seq, d_token_offs, d_token_offs + strings_count, token_idx) -
+                        d_token_offs - 1);
+                      auto const d_str = d_strings.element<cudf::string_view>(idx);
+                      return string_index_pair{d_str.data() + position.first,
+                                               position.second - position.first};
+                    });
+  // create the strings column using the tokens pointers
+  return cudf::make_strings_column(token_pairs, stream, mr);
 }
 
 // zero or more character token counter
@@ -112,9 +238,24 @@ std::unique_ptr<cudf::column> count_tokens(cudf::strings_column_view const& stri
 {
   CUDF_EXPECTS(delimiter.is_valid(), "Parameter delimiter must be valid");
   cudf::string_view d_delimiter(delimiter.data(), delimiter.size());
-  auto strings_column = cudf::column_device_view::create(strings.parent(), stream);
-  return token_count_fn(
-    strings.size(), strings_tokenizer{*strings_column, d_delimiter}, mr, stream);
+  auto const tokens   = locate_tokens(strings, d_delimiter, stream, false);
+  auto token_counts   = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                                strings.size(),
+                                                cudf::mask_state::UNALLOCATED,
+                                                stream,
+                                                mr);
+  auto d_token_counts = token_counts->mutable_view().data<int32_t>();
+  auto d_token_offs   = tokens.offsets.data().get();
+  // the count for each string is the difference of its token offsets
+  thrust::transform(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    thrust::make_counting_iterator<cudf::size_type>(strings.size()),
+    d_token_counts,
+    [d_token_offs] __device__(cudf::size_type idx) {
+      return d_token_offs[idx + 1] - d_token_offs[idx];
+    });
+  return token_counts;
 }
 
 // one or more string delimiter tokenizer
@@ -14,9 +14,13 @@
  * limitations under the License.
  */
 
+#pragma once
+
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/strings/string_view.cuh>
+#include <cudf/strings/strings_column_view.hpp>
 
+#include <rmm/thrust_rmm_allocator.h>
 #include <thrust/logical.h>
 
 namespace nvtext {
@@ -24,6 +28,24 @@ namespace detail {
 using string_index_pair = thrust::pair<const char*, cudf::size_type>;
 using position_pair     = thrust::pair<cudf::size_type, cudf::size_type>;
 
+/**
+ * @brief Return true if the given character is one of the delimiter characters.
+ *
+ * For empty delimiter, whitespace code-point is checked.
+ *
+ * @param d_delimiter The delimiter characters.
+ * @param chr The character to test.
+ * @return true if the character is a delimiter
+ */
+__device__ inline bool is_delimiter(cudf::string_view const& d_delimiter, cudf::char_utf8 chr)
+{
+  return d_delimiter.empty() ? (chr <= ' ') :  // whitespace check
+           thrust::any_of(thrust::seq,
+                          d_delimiter.begin(),
+                          d_delimiter.end(),
+                          [chr] __device__(cudf::char_utf8 c) { return c == chr; });
+}
+
 /**
  * @brief Tokenizer class that use multi-character delimiters.
  *
@@ -63,11 +85,7 @@ struct characters_tokenizer {
    */
   __device__ bool is_delimiter(cudf::char_utf8 chr)
   {
-    return d_delimiter.empty() ? (chr <= ' ') :  // whitespace check
-             thrust::any_of(thrust::seq,
-                            d_delimiter.begin(),
-                            d_delimiter.end(),
-                            [chr] __device__(cudf::char_utf8 c) { return c == chr; });
+    return detail::is_delimiter(d_delimiter, chr);
   }
 
   /**
@@ -130,47 +148,31 @@ struct characters_tokenizer {
 };
 
 /**
- * @brief Tokenizing function for multi-character delimiter.
- *
- * The first pass simply counts the tokens so the size of the output
- * vector can be calculated. The second pass places the token
- * positions into the d_tokens vector.
+ * @brief Byte positions of the tokens of each string in a strings column.
  */
-struct strings_tokenizer {
-  cudf::column_device_view const d_strings;  ///< strings to tokenize
-  cudf::string_view const d_delimiter;       ///< delimiter characters to tokenize around
-  cudf::size_type* d_offsets{};              ///< offsets into the d_tokens vector for each string
-  string_index_pair* d_tokens{};             ///< token positions in device memory
-
-  /**
-   * @brief Identifies the token positions within each string.
-   *
-   * This counts the tokens in each string and also places the token positions
-   * into the d_tokens member.
-   *
-   * @param idx Index of the string to tokenize in the d_strings column.
-   * @return The number of tokens for this string.
-   */
-  __device__ cudf::size_type operator()(cudf::size_type idx)
-  {
-    if (d_strings.is_null(idx)) return 0;
-    auto d_str = d_strings.element<cudf::string_view>(idx);
-    // create tokenizer for this string
-    characters_tokenizer tokenizer(d_str, d_delimiter);
-    string_index_pair* d_str_tokens = d_tokens ? d_tokens + d_offsets[idx] : nullptr;
-    cudf::size_type token_idx       = 0;
-    while (tokenizer.next_token()) {
-      if (d_str_tokens) {
-        auto token_pos = tokenizer.token_byte_positions();
-        d_str_tokens[token_idx] =
-          string_index_pair{d_str.data() + token_pos.first, (token_pos.second - token_pos.first)};
-      }
-      ++token_idx;
-    }
-    return token_idx;  // number of tokens found
-  }
+struct strings_token_positions {
+  rmm::device_vector<int32_t> offsets;          ///< offsets into `positions` for each string
+  rmm::device_vector<position_pair> positions;  ///< token byte positions within their string
 };
 
+/**
+ * @brief Locates the tokens of all the strings with a thread per byte of the strings' chars.
+ *
+ * The tokens are identified as the `characters_tokenizer` does, but without processing
+ * each string sequentially: the first byte of each token is located over the entire
+ * chars buffer, and a prefix sum of these gives the token offsets of each string.
+ *
+ * @param strings Strings column to tokenize.
+ * @param d_delimiter The delimiter characters, or empty to tokenize on whitespace.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param with_positions False to only compute the token offsets of each string.
+ * @return The token offsets and positions of each string.
+ */
+strings_token_positions locate_tokens(cudf::strings_column_view const& strings,
+                                      cudf::string_view const& d_delimiter,
+                                      cudaStream_t stream,
+                                      bool with_positions = true);
+
 // delimiters' iterator = delimiterator
 using delimiterator = cudf::column_device_view::const_iterator<cudf::string_view>;
 
@@ -0,0 +1,586 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/detail/utilities/release_assert.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/expressions.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+constexpr size_type MAX_EXPRESSION_OPERATIONS = 64;
+
+/**
+ * @brief A value computed by an expression, integral and boolean values being widened to 64-bit
+ * integers and floating point values to doubles
+ */
+union expression_value {
+  int64_t i;
+  double f;
+};
+
+enum class operand_source : int8_t { COLUMN, LITERAL, OPERATION };
+
+enum class operation_kind : int8_t { UNARY, BINARY, CAST };
+
+/**
+ * @brief An operand of the operations of an expression
+ */
+struct expression_operand {
+  operand_source source;
+  bool is_float;
+  size_type index;  ///< The index of the column, or of the operation computing the operand
+  expression_value literal;
+};
+
+/**
+ * @brief An operation of an expression, computing a value from one or two operands
+ */
+struct expression_operation {
+  operation_kind kind;
+  int32_t op;  ///< The `unary_op` or `binary_operator`
+  type_id output_type;
+  bool output_is_float;
+  bool input_is_float;  ///< Whether the operands are computed on as doubles
+  size_type lhs;
+  size_type rhs;
+};
+
+/**
+ * @brief Flattens an expression tree into a sequence of operations, each operation only depending
+ * on the operations before it
+ */
+class expression_linearizer {
+ public:
+  expression_linearizer(table_view const& table, cudaStream_t stream)
+    : _table{table}, _stream{stream}
+  {
+  }
+
+  size_type add_column(size_type column_index)
+  {
+    CUDF_EXPECTS(column_index >= 0 and column_index < _table.num_columns(),
+                 "Expression column index out of bounds");
+    auto const type = _table.column(column_index).type();
+    CUDF_EXPECTS(is_numeric(type), "Expression columns must be of numeric type");
+    if (std::find(_columns.begin(), _columns.end(), column_index) == _columns.end()) {
+      _columns.push_back(column_index);
+    }
+    return add_operand({operand_source::COLUMN, is_floating_point(type), column_index, {}}, type);
+  }
+
+  size_type add_literal(scalar const& value)
+  {
+    CUDF_EXPECTS(is_numeric(value.type()), "Expression literals must be of numeric type");
+    if (not value.is_valid(_stream)) { _has_null_literal = true; }
+    return add_operand({operand_source::LITERAL,
+                        is_floating_point(value.type()),
+                        0,
+                        type_dispatcher(value.type(), literal_value_fn{}, value, _stream)},
+                       value.type());
+  }
+
+  size_type add_unary(unary_op op, size_type input)
+  {
+    bool const is_float = is_floating_point(_types[input]);
+    auto output_type    = data_type{type_id::FLOAT64};
+    switch (op) {
+      case unary_op::CEIL:
+      case unary_op::FLOOR:
+      case unary_op::RINT:
+      case unary_op::ABS:
+        output_type = data_type{is_float ? type_id::FLOAT64 : type_id::INT64};
+        break;
+      case unary_op::BIT_INVERT:
+        CUDF_EXPECTS(not is_float, "Bitwise operators require integral operands");
+        output_type = data_type{type_id::INT64};
+        break;
+      case unary_op::NOT: output_type = data_type{type_id::BOOL8}; break;
+      default: break;
+    }
+    return add_operation(
+      operation_kind::UNARY, static_cast<int32_t>(op), output_type, input, input);
+  }
+
+  size_type add_binary(binary_operator op, size_type lhs, size_type rhs)
+  {
+    bool const is_float = is_floating_point(_types[lhs]) or is_floating_point(_types[rhs]);
+    auto output_type    = data_type{is_float ? type_id::FLOAT64 : type_id::INT64};
+    switch (op) {
+      case binary_operator::ADD:
+      case binary_operator::SUB:
+      case binary_operator::MUL:
+      case binary_operator::DIV:
+      case binary_operator::MOD:
+      case binary_operator::PYMOD:
+      case binary_operator::PMOD: break;
+      case binary_operator::TRUE_DIV:
+      case binary_operator::FLOOR_DIV:
+      case binary_operator::POW:
+      case binary_operator::LOG_BASE:
+      case binary_operator::ATAN2: output_type = data_type{type_id::FLOAT64}; break;
+      case binary_operator::EQUAL:
+      case binary_operator::NOT_EQUAL:
+      case binary_operator::LESS:
+      case binary_operator::GREATER:
+      case binary_operator::LESS_EQUAL:
+      case binary_operator::GREATER_EQUAL:
+      case binary_operator::LOGICAL_AND:
+      case binary_operator::LOGICAL_OR: output_type = data_type{type_id::BOOL8}; break;
+      case binary_operator::BITWISE_AND:
+      case binary_operator::BITWISE_OR:
+      case binary_operator::BITWISE_XOR:
+      case binary_operator::SHIFT_LEFT:
+      case binary_operator::SHIFT_RIGHT:
+        CUDF_EXPECTS(not is_float, "Bitwise operators require integral operands");
+        break;
+      default: CUDF_FAIL("Unsupported binary operator in expression");
+    }
+    return add_operation(operation_kind::BINARY, static_cast<int32_t>(op), output_type, lhs, rhs);
+  }
+
+  size_type add_cast(data_type type, size_type input)
+  {
+    CUDF_EXPECTS(is_numeric(type), "Expressions can only be cast to numeric types");
+    return add_operation(operation_kind::CAST, 0, type, input, input);
+  }
+
+  bool is_operation(size_type operand) const
+  {
+    return _operands[operand].source == operand_source::OPERATION;
+  }
+  data_type type(size_type operand) const { return _types[operand]; }
+  bool has_null_literal() const { return _has_null_literal; }
+  std::vector<size_type> const& columns() const { return _columns; }
+  std::vector<expression_operand> const& operands() const { return _operands; }
+  std::vector<expression_operation> const& operations() const { return _operations; }
+
+ private:
+  struct literal_value_fn {
+    template <typename T, std::enable_if_t<std::is_integral<T>::value>* = nullptr>
+    expression_value operator()(scalar const& value, cudaStream_t stream)
+    {
+      expression_value result;
+      result.i = static_cast<int64_t>(static_cast<numeric_scalar<T> const&>(value).value(stream));
+      return result;
+    }
+
+    template <typename T, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+    expression_value operator()(scalar const& value, cudaStream_t stream)
+    {
+      expression_value result;
+      result.f = static_cast<double>(static_cast<numeric_scalar<T> const&>(value).value(stream));
+      return result;
+    }
+
+    template <typename T, std::enable_if_t<not std::is_arithmetic<T>::value>* = nullptr>
+    expression_value operator()(scalar const&, cudaStream_t)
+    {
+      CUDF_FAIL("Expression literals must be of numeric type");
+    }
+  };
+
+  size_type add_operand(expression_operand operand, data_type type)
+  {
+    _operands.push_back(operand);
+    _types.push_back(type);
+    return static_cast<size_type>(_operands.size() - 1);
+  }
+
+  size_type add_operation(
+    operation_kind kind, int32_t op, data_type output_type, size_type lhs, size_type rhs)
+  {
+    CUDF_EXPECTS(static_cast<size_type>(_operations.size()) < MAX_EXPRESSION_OPERATIONS,
+                 "Expression has too many operators");
+    bool const output_is_float = is_floating_point(output_type);
+    bool const input_is_float  = _operands[lhs].is_float or _operands[rhs].is_float;
+    _operations.push_back({kind, op, output_type.id(), output_is_float, input_is_float, lhs, rhs});
+    return add_operand({operand_source::OPERATION,
+                        output_is_float,
+                        static_cast<size_type>(_operations.size() - 1),
+                        {}},
+                       output_type);
+  }
+
+  table_view const& _table;
+  cudaStream_t _stream;
+  std::vector<expression_operand> _operands;
+  std::vector<data_type> _types;
+  std::vector<expression_operation> _operations;
+  std::vector<size_type> _columns;
+  bool _has_null_literal{false};
+};
+
+namespace {
+__device__ inline expression_value int_value(int64_t x)
+{
+  expression_value result;
+  result.i = x;
+  return result;
+}
+
+__device__ inline expression_value float_value(double x)
+{
+  expression_value result;
+  result.f = x;
+  return result;
+}
+
+__device__ inline double as_float(expression_value x, bool is_float)
+{
+  return is_float ? x.f : static_cast<double>(x.i);
+}
+
+/**
+ * @brief Converts a value to `T`, returning the converted value widened back
+ */
+struct cast_value_fn {
+  template <typename T, std::enable_if_t<std::is_integral<T>::value>* = nullptr>
+  __device__ expression_value operator()(expression_value x, bool is_float)
+  {
+    return int_value(static_cast<int64_t>(is_float ? static_cast<T>(x.f) : static_cast<T>(x.i)));
+  }
+
+  template <typename T, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+  __device__ expression_value operator()(expression_value x, bool is_float)
+  {
+    return float_value(static_cast<double>(is_float ? static_cast<T>(x.f) : static_cast<T>(x.i)));
+  }
+
+  template <typename T, std::enable_if_t<not std::is_arithmetic<T>::value>* = nullptr>
+  __device__ expression_value operator()(expression_value x, bool)
+  {
+    release_assert(false && "Expressions can only be cast to numeric types");
+    return x;
+  }
+};
+
+struct load_element_fn {
+  template <typename T, std::enable_if_t<std::is_integral<T>::value>* = nullptr>
+  __device__ expression_value operator()(column_device_view const& input, size_type row)
+  {
+    return int_value(static_cast<int64_t>(input.element<T>(row)));
+  }
+
+  template <typename T, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+  __device__ expression_value operator()(column_device_view const& input, size_type row)
+  {
+    return float_value(static_cast<double>(input.element<T>(row)));
+  }
+
+  template <typename T, std::enable_if_t<not std::is_arithmetic<T>::value>* = nullptr>
+  __device__ expression_value operator()(column_device_view const&, size_type)
+  {
+    release_assert(false && "Expression columns must be of numeric type");
+    return int_value(0);
+  }
+};
+
+struct store_element_fn {
+  template <typename T, std::enable_if_t<std::is_arithmetic<T>::value>* = nullptr>
+  __device__ void operator()(mutable_column_device_view& output,
+                             size_type row,
+                             expression_value x,
+                             bool is_float)
+  {
+    output.element<T>(row) = is_float ? static_cast<T>(x.f) : static_cast<T>(x.i);
+  }
+
+  template <typename T, std::enable_if_t<not std::is_arithmetic<T>::value>* = nullptr>
+  __device__ void operator()(mutable_column_device_view&, size_type, expression_value, bool)
+  {
+    release_assert(false && "Expression output must be of numeric type");
+  }
+};
+
+__device__ expression_value evaluate_unary(unary_op op, expression_value x, bool is_float)
+{
+  switch (op) {
+    case unary_op::SIN: return float_value(sin(as_float(x, is_float)));
+    case unary_op::COS: return float_value(cos(as_float(x, is_float)));
+    case unary_op::TAN: return float_value(tan(as_float(x, is_float)));
+    case unary_op::ARCSIN: return float_value(asin(as_float(x, is_float)));
+    case unary_op::ARCCOS: return float_value(acos(as_float(x, is_float)));
+    case unary_op::ARCTAN: return float_value(atan(as_float(x, is_float)));
+    case unary_op::SINH: return float_value(sinh(as_float(x, is_float)));
+    case unary_op::COSH: return float_value(cosh(as_float(x, is_float)));
+    case unary_op::TANH: return float_value(tanh(as_float(x, is_float)));
+    case unary_op::ARCSINH: return float_value(asinh(as_float(x, is_float)));
+    case unary_op::ARCCOSH: return float_value(acosh(as_float(x, is_float)));
+    case unary_op::ARCTANH: return float_value(atanh(as_float(x, is_float)));
+    case unary_op::EXP: return float_value(exp(as_float(x, is_float)));
+    case unary_op::LOG: return float_value(log(as_float(x, is_float)));
+    case unary_op::SQRT: return float_value(sqrt(as_float(x, is_float)));
+    case unary_op::CBRT: return float_value(cbrt(as_float(x, is_float)));
+    case unary_op::CEIL: return is_float ? float_value(ceil(x.f)) : x;
+    case unary_op::FLOOR: return is_float ? float_value(floor(x.f)) : x;
+    case unary_op::RINT: return is_float ? float_value(rint(x.f)) : x;
+    case unary_op::ABS: return is_float ? float_value(fabs(x.f)) : int_value(x.i < 0 ? -x.i : x.i);
+    case unary_op::BIT_INVERT: return int_value(~x.i);
+    case unary_op::NOT: return int_value(is_float ? x.f == 0 : x.i == 0);
+    default: release_assert(false && "Unsupported unary operator in expression"); return x;
+  }
+}
+
+__device__ expression_value evaluate_binary(binary_operator op, double x, double y)
+{
+  switch (op) {
+    case binary_operator::ADD: return float_value(x + y);
+    case binary_operator::SUB: return float_value(x - y);
+    case binary_operator::MUL: return float_value(x * y);
+    case binary_operator::DIV:
+    case binary_operator::TRUE_DIV: return float_value(x / y);
+    case binary_operator::FLOOR_DIV: return float_value(floor(x / y));
+    case binary_operator::MOD: return float_value(fmod(x, y));
+    case binary_operator::PYMOD: return float_value(fmod(fmod(x, y) + y, y));
+    case binary_operator::PMOD: {
+      auto const remainder = fmod(x, y);
+      return float_value(remainder < 0 ? fmod(remainder + y, y) : remainder);
+    }
+    case binary_operator::POW: return float_value(pow(x, y));
+    case binary_operator::LOG_BASE: return float_value(log(x) / log(y));
+    case binary_operator::ATAN2: return float_value(atan2(x, y));
+    case binary_operator::EQUAL: return int_value(x == y);
+    case binary_operator::NOT_EQUAL: return int_value(x != y);
+    case binary_operator::LESS: return int_value(x < y);
+    case binary_operator::GREATER: return int_value(x > y);
+    case binary_operator::LESS_EQUAL: return int_value(x <= y);
+    case binary_operator::GREATER_EQUAL: return int_value(x >= y);
+    case binary_operator::LOGICAL_AND: return int_value(x != 0 and y != 0);
+    case binary_operator::LOGICAL_OR: return int_value(x != 0 or y != 0);
+    default:
+      release_assert(false && "Unsupported binary operator in expression");
+      return int_value(0);
+  }
+}
+
+__device__ expression_value evaluate_binary(binary_operator op, int64_t x, int64_t y)
+{
+  switch (op) {
+    case binary_operator::ADD: return int_value(x + y);
+    case binary_operator::SUB: return int_value(x - y);
+    case binary_operator::MUL: return int_value(x * y);
+    case binary_operator::DIV: return int_value(x / y);
+    case binary_operator::MOD: return int_value(x % y);
+    case binary_operator::PYMOD: return int_value(((x % y) + y) % y);
+    case binary_operator::PMOD: {
+      auto const remainder = x % y;
+      return int_value(remainder < 0 ? (remainder + y) % y : remainder);
+    }
+    case binary_operator::BITWISE_AND: return int_value(x & y);
+    case binary_operator::BITWISE_OR: return int_value(x | y);
+    case binary_operator::BITWISE_XOR: return int_value(x ^ y);
+    case binary_operator::SHIFT_LEFT: return int_value(x << y);
+    case binary_operator::SHIFT_RIGHT: return int_value(x >> y);
+    case binary_operator::EQUAL: return int_value(x == y);
+    case binary_operator::NOT_EQUAL: return int_value(x != y);
+    case binary_operator::LESS: return int_value(x < y);
+    case binary_operator::GREATER: return int_value(x > y);
+    case binary_operator::LESS_EQUAL: return int_value(x <= y);
+    case binary_operator::GREATER_EQUAL: return int_value(x >= y);
+    case binary_operator::LOGICAL_AND: return int_value(x != 0 and y != 0);
+    case binary_operator::LOGICAL_OR: return int_value(x != 0 or y != 0);
+    // Operators returning FLOAT64 whatever their operands
+    default: return evaluate_binary(op, static_cast<double>(x), static_cast<double>(y));
+  }
+}
+
+/**
+ * @brief Evaluates the operations of an expression on a row, storing the value of the last one
+ */
+struct evaluate_expression_fn {
+  table_device_view table;
+  expression_operand const* operands;
+  expression_operation const* operations;
+  size_type num_operations;
+  mutable_column_device_view output;
+
+  __device__ expression_value load(size_type operand,
+                                   size_type row,
+                                   expression_value const* results) const
+  {
+    auto const& input = operands[operand];
+    switch (input.source) {
+      case operand_source::COLUMN:
+        return type_dispatcher(
+          table.column(input.index).type(), load_element_fn{}, table.column(input.index), row);
+      case operand_source::LITERAL: return input.literal;
+      default: return results[input.index];
+    }
+  }
+
+  __device__ void operator()(size_type row)
+  {
+    expression_value results[MAX_EXPRESSION_OPERATIONS];
+    for (size_type k = 0; k < num_operations; ++k) {
+      auto const& operation   = operations[k];
+      auto const lhs          = load(operation.lhs, row, results);
+      bool const lhs_is_float = operands[operation.lhs].is_float;
+      switch (operation.kind) {
+        case operation_kind::UNARY:
+          results[k] = evaluate_unary(static_cast<unary_op>(operation.op), lhs, lhs_is_float);
+          break;
+        case operation_kind::CAST:
+          results[k] = type_dispatcher(
+            data_type{operation.output_type}, cast_value_fn{}, lhs, lhs_is_float);
+          break;
+        default: {
+          auto const rhs          = load(operation.rhs, row, results);
+          bool const rhs_is_float = operands[operation.rhs].is_float;
+          auto const op           = static_cast<binary_operator>(operation.op);
+          results[k] = operation.input_is_float ? evaluate_binary(op,
+                                                                  as_float(lhs, lhs_is_float),
+                                                                  as_float(rhs, rhs_is_float))
+                                                : evaluate_binary(op, lhs.i, rhs.i);
+          break;
+        }
+      }
+    }
+    type_dispatcher(output.type(),
+                    store_element_fn{},
+                    output,
+                    row,
+                    results[num_operations - 1],
+                    operations[num_operations - 1].output_is_float);
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> compute_column(table_view const& table,
+                                       expression const& expr,
+                                       rmm::mr::device_memory_resource* mr,
+                                       cudaStream_t stream)
+{
+  expression_linearizer linearizer{table, stream};
+  auto root = expr.accept(linearizer);
+  // A column or a literal is copied as it is
+  if (not linearizer.is_operation(root)) {
+    root = linearizer.add_cast(linearizer.type(root), root);
+  }
+
+  auto const num_rows    = table.num_rows();
+  auto const output_type = linearizer.type(root);
+  if (linearizer.has_null_literal()) {
+    return make_fixed_width_column(output_type, num_rows, mask_state::ALL_NULL, stream, mr);
+  }
+  auto output =
+    make_fixed_width_column(output_type, num_rows, mask_state::UNALLOCATED, stream, mr);
+  if (num_rows == 0) { return output; }
+
+  rmm::device_vector<expression_operand> operands(linearizer.operands());
+  rmm::device_vector<expression_operation> operations(linearizer.operations());
+  auto const d_table  = table_device_view::create(table, stream);
+  auto const d_output = mutable_column_device_view::create(output->mutable_view(), stream);
+  thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                   thrust::make_counting_iterator<size_type>(0),
+                   thrust::make_counting_iterator<size_type>(num_rows),
+                   evaluate_expression_fn{*d_table,
+                                          operands.data().get(),
+                                          operations.data().get(),
+                                          static_cast<size_type>(operations.size()),
+                                          *d_output});
+
+  // An element is valid where all the referenced columns are
+  std::vector<column_view> nullable_columns;
+  for (auto const column_index : linearizer.columns()) {
+    if (table.column(column_index).nullable()) {
+      nullable_columns.push_back(table.column(column_index));
+    }
+  }
+  if (not nullable_columns.empty()) {
+    auto const d_nullable = table_device_view::create(table_view{nullable_columns}, stream);
+    auto mask             = detail::valid_if(
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(num_rows),
+      [d_nullable = *d_nullable] __device__(size_type row) {
+        for (size_type i = 0; i < d_nullable.num_columns(); ++i) {
+          if (d_nullable.column(i).is_null_nocheck(row)) { return false; }
+        }
+        return true;
+      },
+      stream,
+      mr);
+    output->set_null_mask(std::move(mask.first), mask.second);
+  }
+  return output;
+}
+
+std::vector<size_type> expression_columns(table_view const& table,
+                                          expression const& expr,
+                                          cudaStream_t stream)
+{
+  expression_linearizer linearizer{table, stream};
+  expr.accept(linearizer);
+  return linearizer.columns();
+}
+
+}  // namespace detail
+
+size_type column_reference::accept(detail::expression_linearizer& linearizer) const
+{
+  return linearizer.add_column(column_index());
+}
+
+size_type literal::accept(detail::expression_linearizer& linearizer) const
+{
+  return linearizer.add_literal(value());
+}
+
+size_type unary_expression::accept(detail::expression_linearizer& linearizer) const
+{
+  return linearizer.add_unary(op(), input().accept(linearizer));
+}
+
+size_type binary_expression::accept(detail::expression_linearizer& linearizer) const
+{
+  auto const lhs_index = lhs().accept(linearizer);
+  auto const rhs_index = rhs().accept(linearizer);
+  return linearizer.add_binary(op(), lhs_index, rhs_index);
+}
+
+size_type cast_expression::accept(detail::expression_linearizer& linearizer) const
+{
+  return linearizer.add_cast(type(), input().accept(linearizer));
+}
+
+std::unique_ptr<column> compute_column(table_view const& table,
+                                       expression const& expr,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compute_column(table, expr, mr);
+}
+
+}  // namespace cudf
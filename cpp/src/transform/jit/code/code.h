@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2020, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,15 +16,26 @@
 
 #pragma once
 
+#include <string>
+
 namespace cudf {
 namespace transformation {
 namespace jit {
 namespace code {
 extern const char* kernel_header;
-extern const char* kernel;
 extern const char* traits;
 extern const char* operation;
 
+/**
+ * @brief Returns the source of a kernel that applies `GENERIC_TRANSFORM_OP` to the rows of
+ * `num_inputs` columns
+ *
+ * Each thread loads the values of several rows, a block apart, before applying the function to
+ * any of them, so the loads of all the rows are in flight together. Rows that are null in the
+ * kernel's `valid` mask are skipped.
+ */
+std::string kernel(int num_inputs);
+
 }  // namespace code
 }  // namespace jit
 }  // namespace transformation
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2020, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include "code.h"
+
 namespace cudf {
 namespace transformation {
 namespace jit {
@@ -26,25 +28,63 @@ const char* kernel_header =
     #include <cudf/wrappers/timestamps.hpp>
   )***";
 
-const char* kernel =
-  R"***(
-    template <typename TypeOut, typename TypeIn>
+std::string kernel(int num_inputs)
+{
+  auto const for_each_input = [num_inputs](auto const& make_code) {
+    std::string code;
+    for (int j = 0; j < num_inputs; ++j) { code += make_code(std::to_string(j)); }
+    return code;
+  };
+
+  std::string source = "template <typename TypeOut";
+  source += for_each_input([](auto const& j) { return ", typename TypeIn" + j; });
+  source += R"***(>
     __global__
     void kernel(cudf::size_type size,
-                    TypeOut* out_data, TypeIn* in_data) {
-        int tid = threadIdx.x;
-        int blkid = blockIdx.x;
-        int blksz = blockDim.x;
-        int gridsz = gridDim.x;
+                TypeOut* out_data,
+                cudf::bitmask_type const* valid,
+                void const* const* in_data) {
+  )***";
+  source += for_each_input([](auto const& j) {
+    return "TypeIn" + j + " const* in" + j + " = static_cast<TypeIn" + j + " const*>(in_data[" +
+           j + "]);\n";
+  });
+  source += R"***(
+        constexpr int elements_per_thread = 4;
+        cudf::size_type const tile_size = blockDim.x * elements_per_thread;
 
-        int start = tid + blkid * blksz;
-        int step = blksz * gridsz;
+        for (cudf::size_type tile = blockIdx.x * tile_size; tile < size;
+             tile += gridDim.x * tile_size) {
+          cudf::size_type const first = tile + threadIdx.x;
+  )***";
+  source += for_each_input(
+    [](auto const& j) { return "TypeIn" + j + " values" + j + "[elements_per_thread];\n"; });
+  source += R"***(
+          #pragma unroll
+          for (int k = 0; k < elements_per_thread; ++k) {
+            cudf::size_type const i = first + k * blockDim.x;
+            if (i < size) {
+  )***";
+  source += for_each_input([](auto const& j) { return "values" + j + "[k] = in" + j + "[i];\n"; });
+  source += R"***(
+            }
+          }
 
-        for (cudf::size_type i=start; i<size; i+=step) {
-          GENERIC_UNARY_OP(&out_data[i], in_data[i]);  
+          #pragma unroll
+          for (int k = 0; k < elements_per_thread; ++k) {
+            cudf::size_type const i = first + k * blockDim.x;
+            if (i < size && (valid == nullptr || (valid[i / 32] >> (i % 32)) & 1)) {
+              GENERIC_TRANSFORM_OP(&out_data[i]
+  )***";
+  source += for_each_input([](auto const& j) { return ", values" + j + "[k]"; });
+  source += R"***();
+            }
+          }
         }
     }
   )***";
+  return source;
+}
 
 }  // namespace code
 }  // namespace jit
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2020, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,6 +19,7 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/transform.hpp>
 #include <cudf/null_mask.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
@@ -31,6 +32,8 @@
 #include <timestamps.hpp.jit>
 #include <types.hpp.jit>
 
+#include <algorithm>
+
 namespace cudf {
 namespace transformation {
 //! Jit functions
@@ -47,23 +50,37 @@ std::istream* headers_code(std::string filename, std::iostream& stream)
   return nullptr;
 }
 
-void unary_operation(mutable_column_view output,
-                     column_view input,
-                     const std::string& udf,
-                     data_type output_type,
-                     bool is_ptx,
-                     cudaStream_t stream)
+void transform_operation(mutable_column_view output,
+                         table_view const& inputs,
+                         const std::string& udf,
+                         data_type output_type,
+                         bool is_ptx,
+                         bitmask_type const* valid,
+                         cudaStream_t stream)
 {
-  std::string hash = "prog_transform" + std::to_string(std::hash<std::string>{}(udf));
+  // The generated function depends on the output type and the number of inputs as well as the
+  // UDF, and the program is cached across processes under this name
+  std::string hash = "prog_transform" + std::to_string(std::hash<std::string>{}(udf)) + "_" +
+                     cudf::jit::get_type_name(output_type) + "_" +
+                     std::to_string(inputs.num_columns());
 
   std::string cuda_source = code::kernel_header;
   if (is_ptx) {
     cuda_source += cudf::jit::parse_single_function_ptx(
-                     udf, "GENERIC_UNARY_OP", cudf::jit::get_type_name(output_type), {0}) +
-                   code::kernel;
+      udf, "GENERIC_TRANSFORM_OP", cudf::jit::get_type_name(output_type), {0});
   } else {
-    cuda_source += cudf::jit::parse_single_function_cuda(udf, "GENERIC_UNARY_OP") + code::kernel;
+    cuda_source += cudf::jit::parse_single_function_cuda(udf, "GENERIC_TRANSFORM_OP");
+  }
+  cuda_source += code::kernel(inputs.num_columns());
+
+  std::vector<std::string> template_types{cudf::jit::get_type_name(output.type())};
+  std::vector<void const*> input_data;
+  for (auto const& input : inputs) {
+    template_types.push_back(cudf::jit::get_type_name(input.type()));
+    input_data.push_back(cudf::jit::get_data_ptr(input));
   }
+  rmm::device_buffer d_input_data{
+    input_data.data(), input_data.size() * sizeof(void const*), stream};
 
   // Launch the jitify kernel
   cudf::jit::launcher(hash,
@@ -73,9 +90,11 @@ void unary_operation(mutable_column_view output,
                       headers_code,
                       stream)
     .set_kernel_inst("kernel",  // name of the kernel we are launching
-                     {cudf::jit::get_type_name(output.type()),  // list of template arguments
-                      cudf::jit::get_type_name(input.type())})
-    .launch(output.size(), cudf::jit::get_data_ptr(output), cudf::jit::get_data_ptr(input));
+                     template_types)
+    .launch(output.size(),
+            cudf::jit::get_data_ptr(output),
+            valid,
+            static_cast<void const* const*>(d_input_data.data()));
 }
 
 }  // namespace jit
@@ -99,7 +118,44 @@ std::unique_ptr<column> transform(column_view const& input,
   mutable_column_view output_view = *output;
 
   // transform
-  transformation::jit::unary_operation(output_view, input, unary_udf, output_type, is_ptx, stream);
+  transformation::jit::transform_operation(output_view,
+                                           table_view{{input}},
+                                           unary_udf,
+                                           output_type,
+                                           is_ptx,
+                                           output_view.null_mask(),
+                                           stream);
+
+  return output;
+}
+
+std::unique_ptr<column> transform(table_view const& inputs,
+                                  std::string const& udf,
+                                  data_type output_type,
+                                  bool is_ptx,
+                                  rmm::mr::device_memory_resource* mr,
+                                  cudaStream_t stream)
+{
+  CUDF_EXPECTS(inputs.num_columns() > 0, "Transform requires at least one input column.");
+  CUDF_EXPECTS(std::all_of(inputs.begin(),
+                           inputs.end(),
+                           [](column_view const& input) { return is_fixed_width(input.type()); }),
+               "Unexpected non-fixed-width type.");
+  CUDF_EXPECTS(is_fixed_width(output_type), "Unexpected non-fixed-width type.");
+
+  std::unique_ptr<column> output = make_fixed_width_column(output_type,
+                                                           inputs.num_rows(),
+                                                           cudf::bitmask_and(inputs, mr, stream),
+                                                           cudf::UNKNOWN_NULL_COUNT,
+                                                           stream,
+                                                           mr);
+
+  if (inputs.num_rows() == 0) { return output; }
+
+  mutable_column_view output_view = *output;
+
+  transformation::jit::transform_operation(
+    output_view, inputs, udf, output_type, is_ptx, output_view.null_mask(), stream);
 
   return output;
 }
@@ -116,4 +172,14 @@ std::unique_ptr<column> transform(column_view const& input,
   return detail::transform(input, unary_udf, output_type, is_ptx, mr);
 }
 
+std::unique_ptr<column> transform(table_view const& inputs,
+                                  std::string const& udf,
+                                  data_type output_type,
+                                  bool is_ptx,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::transform(inputs, udf, output_type, is_ptx, mr);
+}
+
 }  // namespace cudf
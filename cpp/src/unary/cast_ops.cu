@@ -17,14 +17,40 @@
 #include <cudf/column/column.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/unary.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/null_mask.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/unary.hpp>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/traits.hpp>
 
 #include <rmm/thrust_rmm_allocator.h>
 
+#include <algorithm>
+#include <cstdint>
+
 namespace cudf {
 namespace detail {
+namespace {
+constexpr int cast_block_size = 256;
+// each thread loads 128 bits of the input at a time
+constexpr size_t cast_vector_bytes = 16;
+
+/**
+ * @brief Whether casting `T` to `R` keeps the bits of every element, e.g. INT64 to
+ * TIMESTAMP_SECONDS, so that the data can be copied or reinterpreted as is
+ */
+template <typename T, typename R>
+constexpr bool is_identity_layout_cast()
+{
+  return sizeof(T) == sizeof(R) and not cudf::is_boolean<T>() and not cudf::is_boolean<R>() and
+         ((std::is_integral<T>::value and std::is_integral<R>::value) or
+          std::is_same<T, R>::value or (cudf::is_timestamp<T>() and std::is_integral<R>::value) or
+          (std::is_integral<T>::value and cudf::is_timestamp<R>()));
+}
+
+}  // namespace
+
 template <typename _T, typename _R>
 struct unary_cast {
   template <typename T                                                                   = _T,
@@ -58,6 +84,53 @@ struct unary_cast {
   }
 };
 
+/**
+ * @brief Casts `size` elements of `input` into `output`, and copies `num_mask_words` words of
+ * `input_mask` into `output_mask` in the same pass
+ *
+ * If `vectorized`, `input` is aligned to `cast_vector_bytes` and each thread reads that many bytes
+ * of elements at a time, writing the cast elements with as wide stores.
+ */
+template <typename T, typename R>
+__global__ void cast_kernel(T const* __restrict__ input,
+                            R* __restrict__ output,
+                            size_type size,
+                            bool vectorized,
+                            bitmask_type const* __restrict__ input_mask,
+                            bitmask_type* __restrict__ output_mask,
+                            size_type num_mask_words)
+{
+  constexpr size_type N = sizeof(T) >= cast_vector_bytes ? 1 : cast_vector_bytes / sizeof(T);
+  struct alignas(sizeof(T) * N) input_vector {
+    T values[N];
+  };
+  struct alignas(sizeof(R) * N) output_vector {
+    R values[N];
+  };
+
+  auto const tid    = static_cast<size_type>(threadIdx.x + blockIdx.x * blockDim.x);
+  auto const stride = static_cast<size_type>(blockDim.x * gridDim.x);
+  unary_cast<T, R> op{};
+
+  size_type cast_size = 0;
+  if (vectorized) {
+    auto const num_vectors = size / N;
+    auto const in_vectors  = reinterpret_cast<input_vector const*>(input);
+    auto const out_vectors = reinterpret_cast<output_vector*>(output);
+    for (size_type i = tid; i < num_vectors; i += stride) {
+      auto const in = in_vectors[i];
+      output_vector out;
+#pragma unroll
+      for (size_type j = 0; j < N; ++j) { out.values[j] = op(in.values[j]); }
+      out_vectors[i] = out;
+    }
+    cast_size = num_vectors * N;
+  }
+  for (size_type i = cast_size + tid; i < size; i += stride) { output[i] = op(input[i]); }
+
+  for (size_type i = tid; i < num_mask_words; i += stride) { output_mask[i] = input_mask[i]; }
+}
+
 template <typename T>
 struct dispatch_unary_cast_to {
   column_view input;
@@ -70,22 +143,48 @@ struct dispatch_unary_cast_to {
                                      rmm::mr::device_memory_resource* mr,
                                      cudaStream_t stream)
   {
-    auto size   = input.size();
-    auto output = std::make_unique<column>(type,
-                                           size,
-                                           rmm::device_buffer{size * cudf::size_of(type), 0, mr},
-                                           copy_bitmask(input, 0, mr),
-                                           input.null_count());
-
-    mutable_column_view output_mutable = *output;
-
-    thrust::transform(rmm::exec_policy(stream)->on(stream),
-                      input.begin<T>(),
-                      input.end<T>(),
-                      output_mutable.begin<R>(),
-                      unary_cast<T, R>{});
-
-    return output;
+    auto const size = input.size();
+    rmm::device_buffer data{size * cudf::size_of(type), stream, mr};
+    if (size == 0) {
+      return std::make_unique<column>(type, 0, std::move(data), rmm::device_buffer{}, 0);
+    }
+
+    // the null mask is copied by the cast kernel when its words are aligned with the rows
+    auto const fused_mask = input.nullable() and intra_word_index(input.offset()) == 0;
+    auto null_mask = fused_mask ? create_null_mask(size, mask_state::UNINITIALIZED, stream, mr)
+                                : copy_bitmask(input, stream, mr);
+
+    if (is_identity_layout_cast<T, R>()) {
+      CUDA_TRY(cudaMemcpyAsync(
+        data.data(), input.data<T>(), data.size(), cudaMemcpyDeviceToDevice, stream));
+      if (fused_mask) {
+        CUDA_TRY(cudaMemcpyAsync(null_mask.data(),
+                                 input.null_mask() + word_index(input.offset()),
+                                 num_bitmask_words(size) * sizeof(bitmask_type),
+                                 cudaMemcpyDeviceToDevice,
+                                 stream));
+      }
+    } else {
+      constexpr size_t vector_bytes =
+        sizeof(T) >= cast_vector_bytes ? sizeof(T) : cast_vector_bytes;
+      auto const vectorized     = reinterpret_cast<uintptr_t>(input.data<T>()) % vector_bytes == 0;
+      auto const num_mask_words = fused_mask ? num_bitmask_words(size) : 0;
+      auto const num_items =
+        std::max(vectorized ? size / static_cast<size_type>(vector_bytes / sizeof(T)) : size,
+                 num_mask_words);
+      cudf::detail::grid_1d const grid{std::max(num_items, 1), cast_block_size};
+      cast_kernel<T, R><<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
+        input.data<T>(),
+        static_cast<R*>(data.data()),
+        size,
+        vectorized,
+        fused_mask ? input.null_mask() + word_index(input.offset()) : nullptr,
+        static_cast<bitmask_type*>(null_mask.data()),
+        num_mask_words);
+    }
+
+    return std::make_unique<column>(
+      type, size, std::move(data), std::move(null_mask), input.null_count());
   }
 
   template <
@@ -144,4 +243,27 @@ std::unique_ptr<column> cast(column_view const& input,
   return detail::cast(input, type, mr);
 }
 
+std::unique_ptr<table> cast(table_view const& input,
+                            std::vector<data_type> const& types,
+                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(static_cast<size_t>(input.num_columns()) == types.size(),
+               "Number of types must match the number of columns.");
+  std::vector<std::unique_ptr<column>> columns;
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    columns.push_back(detail::cast(input.column(i), types[i], mr));
+  }
+  return std::make_unique<table>(std::move(columns));
+}
+
+column_view bit_cast(column_view const& input, data_type type)
+{
+  CUDF_EXPECTS(is_fixed_width(input.type()) and is_fixed_width(type),
+               "Bit cast types must be fixed-width.");
+  CUDF_EXPECTS(size_of(input.type()) == size_of(type), "Bit cast types must have the same size.");
+  return column_view{
+    type, input.size(), input.head(), input.null_mask(), input.null_count(), input.offset()};
+}
+
 }  // namespace cudf
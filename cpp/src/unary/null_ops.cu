@@ -18,10 +18,69 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/unary.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/for_each.h>
+#include <thrust/host_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+
 namespace cudf {
+namespace {
+/**
+ * @brief An input column and its output column of `null_flags`
+ */
+struct null_flags_column {
+  bitmask_type const* null_mask;
+  size_type offset;
+  bool* output;
+};
+
+/**
+ * @brief Returns a table of `BOOL8` columns whose rows are `true` where the validity of the
+ * corresponding element of `input` is `valid`
+ *
+ * The columns are uploaded at once and filled by a single kernel, a thread per element of the
+ * table.
+ */
+std::unique_ptr<table> null_flags(table_view const& input,
+                                  bool valid,
+                                  rmm::mr::device_memory_resource* mr,
+                                  cudaStream_t stream)
+{
+  auto const num_rows = input.num_rows();
+  std::vector<std::unique_ptr<column>> columns;
+  thrust::host_vector<null_flags_column> flags;
+  for (auto const& col : input) {
+    columns.push_back(make_numeric_column(
+      data_type(type_id::BOOL8), num_rows, mask_state::UNALLOCATED, stream, mr));
+    flags.push_back(null_flags_column{
+      col.null_mask(), col.offset(), columns.back()->mutable_view().data<bool>()});
+  }
+  if (num_rows == 0 or columns.empty()) { return std::make_unique<table>(std::move(columns)); }
+
+  rmm::device_vector<null_flags_column> d_flags{flags};
+  thrust::for_each_n(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<int64_t>(0),
+    static_cast<int64_t>(num_rows) * static_cast<int64_t>(flags.size()),
+    [d_flags = d_flags.data().get(), num_rows, valid] __device__(int64_t index) {
+      auto const& column = d_flags[index / num_rows];
+      auto const row     = static_cast<size_type>(index % num_rows);
+      bool const is_valid =
+        column.null_mask == nullptr or bit_is_set(column.null_mask, column.offset + row);
+      column.output[row] = is_valid == valid;
+    });
+  return std::make_unique<table>(std::move(columns));
+}
+
+}  // namespace
+
 std::unique_ptr<column> is_null(cudf::column_view const& input, rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
@@ -49,4 +108,16 @@ std::unique_ptr<column> is_valid(cudf::column_view const& input,
                          mr);
 }
 
+std::unique_ptr<table> is_null(table_view const& input, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return null_flags(input, false, mr, 0);
+}
+
+std::unique_ptr<table> is_valid(table_view const& input, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return null_flags(input, true, mr, 0);
+}
+
 }  // namespace cudf
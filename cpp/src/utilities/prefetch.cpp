@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/utilities/prefetch.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+namespace cudf {
+namespace detail {
+namespace {
+bool is_managed(void const* ptr)
+{
+  cudaPointerAttributes attributes;
+  if (cudaPointerGetAttributes(&attributes, ptr) != cudaSuccess) {
+    // Older runtimes fail on pointers they did not allocate, clear the error they leave behind
+    cudaGetLastError();
+    return false;
+  }
+  return attributes.type == cudaMemoryTypeManaged;
+}
+
+}  // namespace
+
+void prefetch(void const* ptr, std::size_t size, cudaStream_t stream)
+{
+  if (ptr == nullptr or size == 0 or not is_managed(ptr)) { return; }
+  int device = 0;
+  CUDA_TRY(cudaGetDevice(&device));
+  int concurrent_access = 0;
+  CUDA_TRY(
+    cudaDeviceGetAttribute(&concurrent_access, cudaDevAttrConcurrentManagedAccess, device));
+  if (concurrent_access == 0) { return; }
+  // A failed migration only loses the hint, the memory is still faulted in on access
+  if (cudaMemPrefetchAsync(ptr, size, device, stream) != cudaSuccess) { cudaGetLastError(); }
+}
+
+void prefetch(column_view const& input, cudaStream_t stream)
+{
+  auto const end = input.offset() + input.size();
+  if (is_fixed_width(input.type())) {
+    auto const width = size_of(input.type());
+    prefetch(input.head<uint8_t>() + width * input.offset(), width * input.size(), stream);
+  }
+  if (input.nullable()) {
+    // Round the range out to the words holding the bits of the rows
+    auto const begin_word = word_index(input.offset());
+    prefetch(input.null_mask() + begin_word,
+             (num_bitmask_words(end) - begin_word) * sizeof(bitmask_type),
+             stream);
+  }
+  for (size_type i = 0; i < input.num_children(); ++i) { prefetch(input.child(i), stream); }
+}
+
+void prefetch(table_view const& input, cudaStream_t stream)
+{
+  for (auto const& column : input) { prefetch(column, stream); }
+}
+
+}  // namespace detail
+}  // namespace cudf
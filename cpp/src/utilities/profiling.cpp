@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/utilities/profiling.hpp>
+
+#include <atomic>
+
+namespace cudf {
+namespace {
+std::atomic<profiling_callbacks*>& current_callbacks()
+{
+  static std::atomic<profiling_callbacks*> callbacks{nullptr};
+  return callbacks;
+}
+
+}  // namespace
+
+profiling_callbacks* set_profiling_callbacks(profiling_callbacks* callbacks)
+{
+  return current_callbacks().exchange(callbacks);
+}
+
+profiling_callbacks* get_profiling_callbacks()
+{
+  return current_callbacks().load(std::memory_order_acquire);
+}
+
+void metrics_registry::on_end(char const* name, std::chrono::nanoseconds elapsed)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto& metrics = _metrics[name];
+  ++metrics.calls;
+  metrics.elapsed += elapsed;
+}
+
+void metrics_registry::on_counter(char const* name, char const* counter, int64_t value)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _metrics[name].counters[counter] += value;
+}
+
+std::map<std::string, metrics_registry::operation_metrics> metrics_registry::metrics() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _metrics;
+}
+
+void metrics_registry::reset()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _metrics.clear();
+}
+
+}  // namespace cudf
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/scratch_arena.hpp>
+
+#include <algorithm>
+
+namespace cudf {
+namespace {
+// Alignment of the allocations, that of the device memory resources of RMM
+constexpr std::size_t allocation_alignment = 256;
+
+std::size_t align_up(std::size_t bytes)
+{
+  return (bytes + allocation_alignment - 1) / allocation_alignment * allocation_alignment;
+}
+
+thread_local rmm::mr::device_memory_resource* current_scratch_resource = nullptr;
+
+}  // namespace
+
+scratch_arena::scratch_arena(cudaStream_t stream,
+                             rmm::mr::device_memory_resource* upstream,
+                             std::size_t block_size)
+  : _stream{stream}, _upstream{upstream}, _block_size{align_up(block_size)}
+{
+  CUDF_EXPECTS(_upstream != nullptr, "Unexpected null upstream resource pointer.");
+  CUDF_EXPECTS(block_size > 0, "Scratch arena block size must be positive.");
+}
+
+scratch_arena::~scratch_arena()
+{
+  for (auto const& b : _blocks) { _upstream->deallocate(b.ptr, b.size, _stream); }
+}
+
+void scratch_arena::reset()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  for (auto& b : _blocks) { b.used = 0; }
+  _current = 0;
+}
+
+std::size_t scratch_arena::capacity() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  std::size_t capacity = 0;
+  for (auto const& b : _blocks) { capacity += b.size; }
+  return capacity;
+}
+
+void* scratch_arena::do_allocate(std::size_t bytes, cudaStream_t)
+{
+  if (bytes == 0) { return nullptr; }
+  auto const size = align_up(bytes);
+  std::lock_guard<std::mutex> lock(_mutex);
+  // Skip the full blocks, then take the first block with enough space left
+  while (_current < _blocks.size() and _blocks[_current].used == _blocks[_current].size) {
+    ++_current;
+  }
+  for (auto i = _current; i < _blocks.size(); ++i) {
+    auto& b = _blocks[i];
+    if (b.size - b.used >= size) {
+      auto const ptr = static_cast<char*>(b.ptr) + b.used;
+      b.used += size;
+      return ptr;
+    }
+  }
+
+  auto const block_size = std::max(size, _block_size);
+  _blocks.reserve(_blocks.size() + 1);
+  _blocks.push_back({_upstream->allocate(block_size, _stream), block_size, size});
+  return _blocks.back().ptr;
+}
+
+scratch_resource_scope::scratch_resource_scope(rmm::mr::device_memory_resource* mr)
+  : _previous{current_scratch_resource}
+{
+  CUDF_EXPECTS(mr != nullptr, "Unexpected null scratch resource pointer.");
+  current_scratch_resource = mr;
+}
+
+scratch_resource_scope::~scratch_resource_scope() { current_scratch_resource = _previous; }
+
+namespace detail {
+rmm::mr::device_memory_resource* scratch_resource()
+{
+  return current_scratch_resource != nullptr ? current_scratch_resource
+                                             : rmm::mr::get_default_resource();
+}
+
+}  // namespace detail
+}  // namespace cudf
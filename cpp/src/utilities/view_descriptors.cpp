@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/utilities/view_descriptors.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <io/utilities/pinned_memory_pool.hpp>
+
+#include <cstring>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace cudf {
+namespace detail {
+namespace {
+/**
+ * @brief Block of the pinned memory pool, returned to it with the stream of its copy
+ */
+class staging_block {
+ public:
+  staging_block(std::size_t size, cudaStream_t stream)
+    : _ptr{io::detail::pinned_memory_pool::instance().allocate(size)},
+      _size{size},
+      _stream{stream}
+  {
+  }
+  ~staging_block()
+  {
+    io::detail::pinned_memory_pool::instance().deallocate(_ptr, _size, _stream);
+  }
+  staging_block(staging_block const&) = delete;
+  staging_block& operator=(staging_block const&) = delete;
+
+  void* data() const noexcept { return _ptr; }
+
+ private:
+  void* _ptr;
+  std::size_t _size;
+  cudaStream_t _stream;
+};
+
+/**
+ * @brief Least recently used device copies of view descriptors, keyed on their device, stream
+ * and bytes
+ *
+ * One cache per thread: with per-thread default streams, the default stream of another thread
+ * would not be ordered with the copy.
+ */
+class descriptor_cache {
+ public:
+  static constexpr std::size_t max_entries = 128;
+
+  std::shared_ptr<rmm::device_buffer> find(std::string const& key)
+  {
+    auto const it = _index.find(key);
+    if (it == _index.end()) { return nullptr; }
+    _entries.splice(_entries.begin(), _entries, it->second);
+    return it->second->second;
+  }
+
+  void insert(std::string key, std::shared_ptr<rmm::device_buffer> buffer)
+  {
+    _entries.emplace_front(std::move(key), std::move(buffer));
+    _index.emplace(_entries.front().first, _entries.begin());
+    if (_entries.size() > max_entries) {
+      _index.erase(_entries.back().first);
+      _entries.pop_back();
+    }
+  }
+
+ private:
+  using entry = std::pair<std::string, std::shared_ptr<rmm::device_buffer>>;
+  std::list<entry> _entries;  ///< Most recently used first
+  std::unordered_map<std::string, std::list<entry>::iterator> _index;
+};
+
+bool is_default_stream(cudaStream_t stream)
+{
+  return stream == 0 or stream == cudaStreamLegacy or stream == cudaStreamPerThread;
+}
+
+std::string make_key(void const* descriptors, std::size_t size, cudaStream_t stream)
+{
+  int device = 0;
+  CUDA_TRY(cudaGetDevice(&device));
+  std::string key(sizeof(device) + sizeof(stream) + size, '\0');
+  std::memcpy(&key[0], &device, sizeof(device));
+  std::memcpy(&key[sizeof(device)], &stream, sizeof(stream));
+  std::memcpy(&key[sizeof(device) + sizeof(stream)], descriptors, size);
+  return key;
+}
+
+}  // namespace
+
+std::shared_ptr<rmm::device_buffer> copy_view_descriptors(
+  std::size_t size,
+  std::function<void(void* h_ptr, void* d_ptr)> const& fill,
+  bool shareable,
+  cudaStream_t stream)
+{
+  CUDF_EXPECTS(size > 0, "Device view without descriptors to copy");
+  staging_block staging(size, stream);
+  auto const fill_staging = [&](void* d_ptr) {
+    // Zero the padding of the descriptors, so equal descriptors have equal bytes
+    std::memset(staging.data(), 0, size);
+    fill(staging.data(), d_ptr);
+  };
+
+  thread_local descriptor_cache cache;
+  std::string key;
+  if (shareable and is_default_stream(stream)) {
+    fill_staging(nullptr);
+    key = make_key(staging.data(), size, stream);
+    if (auto cached = cache.find(key)) {
+      fill_staging(cached->data());
+      return cached;
+    }
+  }
+
+  auto buffer = std::make_shared<rmm::device_buffer>(size, stream);
+  fill_staging(buffer->data());
+  CUDA_TRY(
+    cudaMemcpyAsync(buffer->data(), staging.data(), size, cudaMemcpyHostToDevice, stream));
+  if (not key.empty()) { cache.insert(std::move(key), buffer); }
+  return buffer;
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -19,6 +19,7 @@
 
 #include <tests/binaryop/assert-binops.h>
 #include <cudf/binaryop.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <tests/binaryop/binop-fixture.hpp>
 
 namespace cudf {
@@ -320,6 +321,70 @@ TEST_F(BinaryOperationIntegrationTest, Mod_Vector_Vector_FP64)
   ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, MOD());
 }
 
+TEST_F(BinaryOperationIntegrationTest, Mod_Scalar_Vector_SI16)
+{
+  using TypeOut = int16_t;
+  using TypeLhs = int16_t;
+  using TypeRhs = int16_t;
+
+  using MOD = cudf::library::operation::Mod<TypeOut, TypeLhs, TypeRhs>;
+
+  auto lhs = make_random_wrapped_scalar<TypeLhs>();
+  auto rhs = make_random_wrapped_column<TypeRhs>(100);
+  auto out =
+    cudf::binary_operation(lhs, rhs, cudf::binary_operator::MOD, data_type(type_to_id<TypeOut>()));
+
+  ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, MOD());
+}
+
+TEST_F(BinaryOperationIntegrationTest, Sub_Vector_Scalar_UI8)
+{
+  using TypeOut = uint8_t;
+  using TypeLhs = uint8_t;
+  using TypeRhs = uint8_t;
+
+  using SUB = cudf::library::operation::Sub<TypeOut, TypeLhs, TypeRhs>;
+
+  auto lhs = make_random_wrapped_column<TypeLhs>(100);
+  auto rhs = make_random_wrapped_scalar<TypeRhs>();
+  auto out =
+    cudf::binary_operation(lhs, rhs, cudf::binary_operator::SUB, data_type(type_to_id<TypeOut>()));
+
+  ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, SUB());
+}
+
+TEST_F(BinaryOperationIntegrationTest, Less_Vector_Scalar_B8_FP32_FP32)
+{
+  using TypeOut = bool;
+  using TypeLhs = float;
+  using TypeRhs = float;
+
+  using LESS = cudf::library::operation::Less<TypeOut, TypeLhs, TypeRhs>;
+
+  auto lhs = make_random_wrapped_column<TypeLhs>(100);
+  auto rhs = make_random_wrapped_scalar<TypeRhs>();
+  auto out =
+    cudf::binary_operation(lhs, rhs, cudf::binary_operator::LESS, data_type(type_to_id<TypeOut>()));
+
+  ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, LESS());
+}
+
+TEST_F(BinaryOperationIntegrationTest, GreaterEqual_Vector_Vector_B8_SI08_SI08)
+{
+  using TypeOut = bool;
+  using TypeLhs = int8_t;
+  using TypeRhs = int8_t;
+
+  using GREATER_EQUAL = cudf::library::operation::GreaterEqual<TypeOut, TypeLhs, TypeRhs>;
+
+  auto lhs = make_random_wrapped_column<TypeLhs>(100);
+  auto rhs = make_random_wrapped_column<TypeRhs>(100);
+  auto out = cudf::binary_operation(
+    lhs, rhs, cudf::binary_operator::GREATER_EQUAL, data_type(type_to_id<TypeOut>()));
+
+  ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, GREATER_EQUAL());
+}
+
 TEST_F(BinaryOperationIntegrationTest, Pow_Vector_Vector_FP64_SI64_SI64)
 {
   using TypeOut = double;
@@ -1840,6 +1905,62 @@ TEST_F(BinaryOperationIntegrationTest, ATan2_Vector_Vector_FP64_SI32_SI64)
   ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, ATAN2(), NearEqualComparator<TypeOut>{2});
 }
 
+TEST_F(BinaryOperationIntegrationTest, Compare_Dictionary_Scalar_B8)
+{
+  auto const output_type = data_type(type_id::BOOL8);
+
+  auto strings    = cudf::test::strings_column_wrapper({"b", "d", "a", "d", ""}, {1, 1, 1, 1, 0});
+  auto dictionary = cudf::dictionary::encode(strings);
+
+  // "c" is not a key of the dictionary
+  auto out = cudf::binary_operation(
+    *dictionary, cudf::string_scalar("c"), cudf::binary_operator::LESS, output_type);
+  cudf::test::expect_columns_equal(
+    *out, fixed_width_column_wrapper<bool>({1, 0, 1, 0, 0}, {1, 1, 1, 1, 0}));
+  out = cudf::binary_operation(
+    cudf::string_scalar("c"), *dictionary, cudf::binary_operator::LESS, output_type);
+  cudf::test::expect_columns_equal(
+    *out, fixed_width_column_wrapper<bool>({0, 1, 0, 1, 0}, {1, 1, 1, 1, 0}));
+  out = cudf::binary_operation(
+    *dictionary, cudf::string_scalar("c"), cudf::binary_operator::EQUAL, output_type);
+  cudf::test::expect_columns_equal(
+    *out, fixed_width_column_wrapper<bool>({0, 0, 0, 0, 0}, {1, 1, 1, 1, 0}));
+
+  out = cudf::binary_operation(
+    *dictionary, cudf::string_scalar("d"), cudf::binary_operator::EQUAL, output_type);
+  cudf::test::expect_columns_equal(
+    *out, fixed_width_column_wrapper<bool>({0, 1, 0, 1, 0}, {1, 1, 1, 1, 0}));
+  out = cudf::binary_operation(
+    *dictionary, cudf::string_scalar("b"), cudf::binary_operator::GREATER_EQUAL, output_type);
+  cudf::test::expect_columns_equal(
+    *out, fixed_width_column_wrapper<bool>({1, 1, 0, 1, 0}, {1, 1, 1, 1, 0}));
+  out = cudf::binary_operation(
+    *dictionary, cudf::string_scalar("b"), cudf::binary_operator::LESS_EQUAL, output_type);
+  cudf::test::expect_columns_equal(
+    *out, fixed_width_column_wrapper<bool>({1, 0, 1, 0, 0}, {1, 1, 1, 1, 0}));
+}
+
+TEST_F(BinaryOperationIntegrationTest, Compare_Dictionary_Dictionary_B8)
+{
+  auto const output_type = data_type(type_id::BOOL8);
+
+  auto lhs_strings = cudf::test::strings_column_wrapper({"b", "d", "a", "d", ""}, {1, 1, 1, 1, 0});
+  auto rhs_strings = cudf::test::strings_column_wrapper({"c", "d", "b", "a", "e"});
+  auto lhs         = cudf::dictionary::encode(lhs_strings);
+  auto rhs         = cudf::dictionary::encode(rhs_strings);
+
+  // the dictionaries have different keys
+  auto out = cudf::binary_operation(*lhs, *rhs, cudf::binary_operator::LESS, output_type);
+  cudf::test::expect_columns_equal(
+    *out, fixed_width_column_wrapper<bool>({1, 0, 1, 0, 0}, {1, 1, 1, 1, 0}));
+  out = cudf::binary_operation(*lhs, *rhs, cudf::binary_operator::EQUAL, output_type);
+  cudf::test::expect_columns_equal(
+    *out, fixed_width_column_wrapper<bool>({0, 1, 0, 0, 0}, {1, 1, 1, 1, 0}));
+
+  EXPECT_THROW(cudf::binary_operation(*lhs, *rhs, cudf::binary_operator::ADD, output_type),
+               cudf::logic_error);
+}
+
 }  // namespace binop
 }  // namespace test
 }  // namespace cudf
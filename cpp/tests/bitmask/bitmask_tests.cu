@@ -16,6 +16,7 @@
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/null_mask.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 #include <tests/utilities/base_fixture.hpp>
@@ -496,4 +497,46 @@ TEST_F(CopyBitmaskTest, TestCopyColumnViewVectorDiscontiguous)
     concatenated_bitmask.data(), gold_mask.data(), num_elements / CHAR_BIT);
 }
 
+TEST_F(CopyBitmaskTest, TestBitmaskAndOrWithOffsets)
+{
+  cudf::data_type t{cudf::type_id::INT32};
+  cudf::size_type num_elements = 1001;
+  thrust::host_vector<int> validity_a(num_elements);
+  thrust::host_vector<int> validity_b(num_elements);
+  for (auto &m : validity_a) { m = this->generate(); }
+  for (auto &m : validity_b) { m = this->generate(); }
+  cudf::column a{t,
+                 num_elements,
+                 rmm::device_buffer{num_elements * sizeof(int)},
+                 cudf::test::detail::make_null_mask(validity_a.begin(), validity_a.end())};
+  cudf::column b{t,
+                 num_elements,
+                 rmm::device_buffer{num_elements * sizeof(int)},
+                 cudf::test::detail::make_null_mask(validity_b.begin(), validity_b.end())};
+
+  // the columns start at different bits of their masks
+  auto a_view         = cudf::slice(a, {17, 917}).front();
+  auto b_view         = cudf::slice(b, {100, 1000}).front();
+  auto number_of_bits = a_view.size();
+
+  thrust::host_vector<int> gold_and(number_of_bits);
+  thrust::host_vector<int> gold_or(number_of_bits);
+  for (cudf::size_type i = 0; i < number_of_bits; ++i) {
+    gold_and[i] = validity_a[17 + i] && validity_b[100 + i];
+    gold_or[i]  = validity_a[17 + i] || validity_b[100 + i];
+  }
+  auto gold_and_mask = cudf::test::detail::make_null_mask(gold_and.begin(), gold_and.end());
+  auto gold_or_mask  = cudf::test::detail::make_null_mask(gold_or.begin(), gold_or.end());
+
+  auto and_mask = cudf::bitmask_and(cudf::table_view{{a_view, b_view}});
+  auto or_mask  = cudf::bitmask_or(cudf::table_view{{a_view, b_view}});
+  cudf::test::expect_equal_buffers(
+    gold_and_mask.data(), and_mask.data(), number_of_bits / CHAR_BIT);
+  cudf::test::expect_equal_buffers(gold_or_mask.data(), or_mask.data(), number_of_bits / CHAR_BIT);
+
+  // a column without a null mask is all valid, so the OR is too
+  cudf::column c{t, number_of_bits, rmm::device_buffer{number_of_bits * sizeof(int)}};
+  EXPECT_EQ(0, static_cast<int>(cudf::bitmask_or(cudf::table_view{{a_view, c}}).size()));
+}
+
 CUDF_TEST_PROGRAM_MAIN()
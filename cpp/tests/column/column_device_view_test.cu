@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2020, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,6 +18,10 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/utilities/view_descriptors.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 
 #include <tests/utilities/base_fixture.hpp>
@@ -25,6 +29,14 @@
 #include <tests/utilities/column_wrapper.hpp>
 #include <tests/utilities/cudf_gtest.hpp>
 
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <cstring>
+#include <vector>
+
 struct ColumnDeviceViewTest : public cudf::test::BaseFixture {
 };
 
@@ -62,3 +74,77 @@ TEST_F(ColumnDeviceViewTest, MismatchingType)
                             output_device_view->begin<int64_t>()),
                cudf::logic_error);
 }
+
+TEST_F(ColumnDeviceViewTest, SharedDescriptors)
+{
+  auto const fill_bytes = [](void* h_ptr, void*) { std::memset(h_ptr, 7, 64); };
+  auto const first      = cudf::detail::copy_view_descriptors(64, fill_bytes, true, 0);
+  auto const second     = cudf::detail::copy_view_descriptors(64, fill_bytes, true, 0);
+  EXPECT_EQ(first.get(), second.get());
+
+  std::vector<char> h_bytes(64);
+  CUDA_TRY(cudaMemcpy(h_bytes.data(), second->data(), 64, cudaMemcpyDeviceToHost));
+  EXPECT_EQ(std::vector<char>(64, 7), h_bytes);
+
+  auto const other = cudf::detail::copy_view_descriptors(
+    64, [](void* h_ptr, void*) { std::memset(h_ptr, 8, 64); }, true, 0);
+  EXPECT_NE(first.get(), other.get());
+  auto const unshared = cudf::detail::copy_view_descriptors(64, fill_bytes, false, 0);
+  EXPECT_NE(first.get(), unshared.get());
+
+  cudaStream_t stream;
+  CUDA_TRY(cudaStreamCreate(&stream));
+  {
+    auto const on_stream = cudf::detail::copy_view_descriptors(64, fill_bytes, true, stream);
+    EXPECT_NE(first.get(), on_stream.get());
+    CUDA_TRY(cudaStreamSynchronize(stream));
+  }
+  CUDA_TRY(cudaStreamDestroy(stream));
+}
+
+TEST_F(ColumnDeviceViewTest, ViewOutlivesSharedView)
+{
+  cudf::test::strings_column_wrapper input({"a", "", "bcd", "efgh"});
+  auto first  = cudf::column_device_view::create(input);
+  auto second = cudf::column_device_view::create(input);
+  first.reset();
+
+  rmm::device_vector<cudf::size_type> lengths(4);
+  auto const d_view = *second;
+  thrust::transform(rmm::exec_policy(0)->on(0),
+                    thrust::make_counting_iterator<cudf::size_type>(0),
+                    thrust::make_counting_iterator<cudf::size_type>(4),
+                    lengths.begin(),
+                    [d_view] __device__(cudf::size_type i) {
+                      return d_view.element<cudf::string_view>(i).size_bytes();
+                    });
+  EXPECT_EQ(std::vector<cudf::size_type>({1, 0, 3, 4}),
+            std::vector<cudf::size_type>(lengths.begin(), lengths.end()));
+}
+
+TEST_F(ColumnDeviceViewTest, TableDeviceView)
+{
+  using T = int32_t;
+  cudf::test::fixed_width_column_wrapper<T> ints({1, 2, 3, 4});
+  cudf::test::strings_column_wrapper strings({"a", "bb", "ccc", "dddd"});
+  cudf::table_view input({ints, strings});
+  auto output   = cudf::allocate_like(ints);
+  auto first    = cudf::table_device_view::create(input);
+  auto d_table  = cudf::table_device_view::create(input);
+  auto d_output = cudf::mutable_table_device_view::create(
+    cudf::mutable_table_view({output->mutable_view()}));
+  first.reset();
+
+  auto const d_input = *d_table;
+  auto d_results     = *d_output;
+  thrust::for_each(rmm::exec_policy(0)->on(0),
+                   thrust::make_counting_iterator<cudf::size_type>(0),
+                   thrust::make_counting_iterator<cudf::size_type>(4),
+                   [d_input, d_results] __device__(cudf::size_type i) mutable {
+                     d_results.column(0).element<T>(i) =
+                       d_input.column(0).element<T>(i) +
+                       d_input.column(1).element<cudf::string_view>(i).size_bytes();
+                   });
+  cudf::test::expect_columns_equal(cudf::test::fixed_width_column_wrapper<T>({2, 4, 6, 8}),
+                                   output->view());
+}
@@ -18,6 +18,7 @@
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/null_mask.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 #include <tests/utilities/base_fixture.hpp>
@@ -403,4 +404,50 @@ TYPED_TEST(TypedColumnTest, ColumnViewConstructorWithMask)
   EXPECT_NE(original_view.null_mask(), copy_view.null_mask());
 }
 
+struct ColumnStatisticsTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ColumnStatisticsTest, ComputeAndInvalidate)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> wrapper{{5, -2, 7, 5, 100, -2, 3},
+                                                          {1, 1, 1, 1, 0, 1, 1}};
+  auto col = wrapper.release();
+  EXPECT_EQ(col->statistics().min, nullptr);
+  EXPECT_EQ(col->statistics().max, nullptr);
+  EXPECT_EQ(col->statistics().distinct_count, -1);
+
+  auto const &stats = col->compute_statistics();
+  using scalar_type = cudf::scalar_type_t<int32_t>;
+  ASSERT_NE(stats.min, nullptr);
+  ASSERT_NE(stats.max, nullptr);
+  EXPECT_EQ(static_cast<scalar_type const *>(stats.min.get())->value(), -2);
+  EXPECT_EQ(static_cast<scalar_type const *>(stats.max.get())->value(), 7);
+  EXPECT_EQ(stats.distinct_count, 4);
+
+  // Copies keep the statistics, which are dropped when the values may change
+  cudf::column copy{*col};
+  EXPECT_EQ(copy.statistics().min, stats.min);
+  col->mutable_view();
+  EXPECT_EQ(col->statistics().min, nullptr);
+  EXPECT_EQ(col->statistics().distinct_count, -1);
+
+  // Recorded statistics are not recomputed
+  cudf::column_statistics recorded;
+  recorded.min = std::make_shared<scalar_type>(-10);
+  copy.set_statistics(recorded);
+  EXPECT_EQ(copy.compute_statistics().min, recorded.min);
+  EXPECT_EQ(static_cast<scalar_type const *>(copy.statistics().max.get())->value(), 7);
+}
+
+TEST_F(ColumnStatisticsTest, AllNull)
+{
+  cudf::test::fixed_width_column_wrapper<double> wrapper{{1.0, 2.0}, {0, 0}};
+  auto col          = wrapper.release();
+  auto const &stats = col->compute_statistics();
+  ASSERT_NE(stats.min, nullptr);
+  EXPECT_FALSE(stats.min->is_valid());
+  EXPECT_FALSE(stats.max->is_valid());
+  EXPECT_EQ(stats.distinct_count, 0);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
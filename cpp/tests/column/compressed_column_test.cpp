@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2019, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/compressed_column.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/types.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/cudf_gtest.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <limits>
+#include <vector>
+
+template <typename T>
+struct CompressedColumnTest : public cudf::test::BaseFixture {
+};
+
+using CompressibleTypes =
+  cudf::test::Concat<cudf::test::IntegralTypesNotBool, cudf::test::TimestampTypes>;
+TYPED_TEST_CASE(CompressedColumnTest, CompressibleTypes);
+
+TYPED_TEST(CompressedColumnTest, RoundTrip)
+{
+  using T = TypeParam;
+  // Blocks of sorted values (delta), of a repeated value, of scattered values (frame of
+  // reference), and a partial last block
+  auto const size = 3 * cudf::compressed_column::values_per_block + 100;
+  std::vector<int64_t> values(size);
+  for (int i = 0; i < size; ++i) {
+    auto const block = i / cudf::compressed_column::values_per_block;
+    values[i]        = block == 0 ? i / 8 : block == 1 ? 7 : (i * 37) % 101 - (block == 3 ? 50 : 0);
+  }
+  auto valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 5 != 0; });
+  cudf::test::fixed_width_column_wrapper<T> input(values.begin(), values.end(), valids);
+
+  auto const compressed = cudf::compress_column(input);
+  EXPECT_LT(compressed->compressed_size(), cudf::column_view(input).size() * sizeof(T));
+  cudf::test::expect_columns_equal(*cudf::decompress_column(*compressed), input);
+
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> gather_map{
+    0, 1, 1030, size - 1, 2100, 1023, 1024, 5, 3000};
+  auto const expected = cudf::gather(cudf::table_view{{input}}, gather_map);
+  cudf::test::expect_columns_equal(*cudf::decompress_rows(*compressed, gather_map),
+                                   expected->get_column(0));
+
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> negative{0, -1};
+  EXPECT_THROW(cudf::decompress_rows(*compressed, negative), cudf::logic_error);
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> past_end{size};
+  EXPECT_THROW(cudf::decompress_rows(*compressed, past_end), cudf::logic_error);
+}
+
+TYPED_TEST(CompressedColumnTest, Slice)
+{
+  using T = TypeParam;
+  cudf::test::fixed_width_column_wrapper<T> input{5, 4, 3, 2, 1, 0, 1, 2, 3, 4};
+  auto const sliced = cudf::slice(input, {3, 9}).front();
+  cudf::test::expect_columns_equal(*cudf::decompress_column(*cudf::compress_column(sliced)),
+                                   sliced);
+}
+
+struct CompressedColumnLimitsTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(CompressedColumnLimitsTest, FullRange)
+{
+  // Differences that overflow the type wrap around
+  cudf::test::fixed_width_column_wrapper<int64_t> input{std::numeric_limits<int64_t>::min(),
+                                                        std::numeric_limits<int64_t>::max(),
+                                                        0,
+                                                        -1,
+                                                        std::numeric_limits<int64_t>::min()};
+  cudf::test::expect_columns_equal(*cudf::decompress_column(*cudf::compress_column(input)), input);
+
+  cudf::test::fixed_width_column_wrapper<uint64_t> unsigned_input{
+    std::numeric_limits<uint64_t>::max(), 0, 1, std::numeric_limits<uint64_t>::max() - 1};
+  cudf::test::expect_columns_equal(
+    *cudf::decompress_column(*cudf::compress_column(unsigned_input)), unsigned_input);
+
+  auto const empty = cudf::compress_column(cudf::test::fixed_width_column_wrapper<int32_t>{});
+  EXPECT_EQ(cudf::decompress_column(*empty)->size(), 0);
+
+  EXPECT_THROW(cudf::compress_column(cudf::test::fixed_width_column_wrapper<double>{1.0}),
+               cudf::logic_error);
+}
@@ -284,6 +284,32 @@ TEST_F(TableTest, ConcatenateTablesWithOffsetsAndNulls)
   }
 }
 
+TEST_F(TableTest, ConcatenateManySmallTables)
+{
+  // Enough small tables for the fixed-width columns to be concatenated by one kernel
+  constexpr cudf::size_type num_rows = 300;
+  auto values  = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 100; });
+  auto valids  = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 3; });
+  auto strings = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(i % 5, 'a' + i % 26); });
+
+  cudf::test::fixed_width_column_wrapper<int8_t> col1(values, values + num_rows, valids);
+  cudf::test::fixed_width_column_wrapper<double> col2(values, values + num_rows);
+  cudf::test::fixed_width_column_wrapper<int64_t> col3(values, values + num_rows);
+  cudf::test::strings_column_wrapper col4(strings, strings + num_rows, valids);
+  cudf::test::fixed_width_column_wrapper<int16_t> col5(values, values + num_rows, valids);
+  cudf::table_view input{{col1, col2, col3, col4, col5}};
+
+  // Pieces of 0 to 3 rows
+  std::vector<cudf::size_type> splits;
+  for (cudf::size_type i = 0, step = 0; i < num_rows; i += step++ % 4) { splits.push_back(i); }
+  auto const pieces = cudf::split(input, splits);
+  ASSERT_GT(pieces.size(), 100u);
+
+  auto concatenated = cudf::concatenate(pieces);
+  cudf::test::expect_tables_equal(input, concatenated->view());
+}
+
 struct ListsColumnTest : public cudf::test::BaseFixture {
 };
 
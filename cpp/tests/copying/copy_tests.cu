@@ -15,6 +15,7 @@
  */
 
 #include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
 #include <cudf/detail/copy_if_else.cuh>
 #include <cudf/detail/iterator.cuh>
 #include <tests/utilities/base_fixture.hpp>
@@ -355,6 +356,78 @@ TYPED_TEST(CopyTestNumeric, CopyIfElseTestScalarScalar)
   cudf::test::expect_columns_equal(out->view(), expected_w);
 }
 
+TYPED_TEST(CopyTestNumeric, CopyIfElseBitmaskCondition)
+{
+  using T = TypeParam;
+
+  // take the condition from the null mask of a column, spanning 2 words
+  auto condition_valids =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  auto lhs_valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i != 10; });
+  auto lhs        = cudf::test::make_counting_transform_iterator(0, [](auto i) { return 5; });
+  auto rhs        = cudf::test::make_counting_transform_iterator(0, [](auto i) { return 6; });
+  auto expect =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0 ? 5 : 6; });
+  cudf::size_type num_els = 40;
+
+  wrapper<T> condition_w(lhs, lhs + num_els + 1, condition_valids);
+  wrapper<T> lhs_w(lhs, lhs + num_els, lhs_valids);
+  wrapper<T> rhs_w(rhs, rhs + num_els);
+  wrapper<T> expected_w(expect, expect + num_els, lhs_valids);
+
+  cudf::column_view condition = condition_w;
+  auto out = cudf::detail::copy_if_else(lhs_w, rhs_w, condition.null_mask(), 0);
+  cudf::test::expect_columns_equal(out->view(), expected_w);
+
+  // a condition offset shifts the selection by one row
+  auto shifted = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return (i + 1) % 3 != 0 ? 5 : 6; });
+  wrapper<T> shifted_w(shifted, shifted + num_els);
+  out = cudf::detail::copy_if_else(cudf::numeric_scalar<T>(5), rhs_w, condition.null_mask(), 1);
+  cudf::test::expect_columns_equal(out->view(), shifted_w);
+
+  // a null condition selects every row of lhs
+  out = cudf::detail::copy_if_else(lhs_w, rhs_w, nullptr, 0);
+  cudf::test::expect_columns_equal(out->view(), lhs_w);
+}
+
+TYPED_TEST(CopyTestNumeric, CopyIfElseBitmaskConditionWords)
+{
+  using T = TypeParam;
+
+  // words of the condition all set, all clear and mixed, read at an offset straddling them
+  auto condition_valids = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return i < 37 || (i >= 69 && i < 100 && i % 2 == 0); });
+  auto lhs    = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto rhs    = cudf::test::make_counting_transform_iterator(0, [](auto i) { return -i; });
+  auto expect = cudf::test::make_counting_transform_iterator(0, [](auto i) {
+    return i + 5 < 37 || (i + 5 >= 69 && (i + 5) % 2 == 0) ? i : -i;
+  });
+  cudf::size_type num_els = 95;
+
+  wrapper<T> condition_w(lhs, lhs + num_els + 5, condition_valids);
+  wrapper<T> lhs_w(lhs, lhs + num_els);
+  wrapper<T> rhs_w(rhs, rhs + num_els);
+  wrapper<T> expected_w(expect, expect + num_els);
+
+  cudf::column_view condition = condition_w;
+  auto out = cudf::detail::copy_if_else(lhs_w, rhs_w, condition.null_mask(), 5);
+  cudf::test::expect_columns_equal(out->view(), expected_w);
+
+  // conditions selecting all or none of the rows copy one of the inputs
+  auto lhs_valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i != 3; });
+  wrapper<T> nullable_lhs_w(lhs, lhs + 30, lhs_valids);
+  out = cudf::detail::copy_if_else(
+    nullable_lhs_w, cudf::numeric_scalar<T>(1), condition.null_mask(), 7);
+  cudf::test::expect_columns_equal(out->view(), nullable_lhs_w);
+
+  auto ones = cudf::test::make_counting_transform_iterator(0, [](auto i) { return 1; });
+  wrapper<T> ones_w(ones, ones + 30);
+  out = cudf::detail::copy_if_else(
+    nullable_lhs_w, cudf::numeric_scalar<T>(1), condition.null_mask(), 38);
+  cudf::test::expect_columns_equal(out->view(), ones_w);
+}
+
 template <typename T>
 struct CopyTestTimestamp : public cudf::test::BaseFixture {
 };
@@ -242,3 +242,107 @@ TYPED_TEST(GatherTest, MultiColNulls)
     cudf::test::expect_columns_equal(expect_column, result->view().column(i));
   }
 }
+
+TYPED_TEST(GatherTest, NullableWithoutNulls)
+{
+  constexpr cudf::size_type source_size{1000};
+
+  auto data     = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return 1; });
+  auto reversed_data =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return source_size - 1 - i; });
+
+  cudf::test::fixed_width_column_wrapper<TypeParam> source_column(
+    data, data + source_size, validity);
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map(reversed_data,
+                                                             reversed_data + source_size);
+
+  cudf::table_view source_table({source_column});
+
+  std::unique_ptr<cudf::table> result = std::move(cudf::gather(source_table, gather_map));
+
+  // the gathered column keeps an all valid mask
+  cudf::test::fixed_width_column_wrapper<TypeParam> expect_column(
+    reversed_data, reversed_data + source_size, validity);
+  cudf::test::expect_columns_equal(expect_column, result->view().column(0));
+  EXPECT_TRUE(result->view().column(0).nullable());
+  EXPECT_EQ(0, result->get_column(0).null_count());
+}
+
+TYPED_TEST(GatherTest, MixedWidthColumns)
+{
+  cudf::test::fixed_width_column_wrapper<TypeParam> typed_column({1, 2, 3, 4, 5}, {1, 0, 1, 1, 1});
+  cudf::test::fixed_width_column_wrapper<int8_t> narrow_column{10, 20, 30, 40, 50};
+  cudf::test::fixed_width_column_wrapper<double> wide_column{.5, 1.5, 2.5, 3.5, 4.5};
+  cudf::test::strings_column_wrapper strings_column{"a", "b", "c", "d", "e"};
+  auto const sliced = cudf::slice(
+    cudf::table_view{{typed_column, narrow_column, strings_column, wide_column}}, {1, 5})[0];
+
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map{3, 0, 2, 5, 1};
+  auto const result = cudf::detail::gather(sliced,
+                                           gather_map,
+                                           cudf::detail::out_of_bounds_policy::NULLIFY,
+                                           cudf::detail::negative_index_policy::NOT_ALLOWED);
+
+  // the fixed-width columns are gathered together, the strings column on its own
+  cudf::test::fixed_width_column_wrapper<TypeParam> expect_typed({5, 2, 4, 0, 3}, {1, 0, 1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<int8_t> expect_narrow({50, 20, 40, 0, 30},
+                                                               {1, 1, 1, 0, 1});
+  cudf::test::strings_column_wrapper expect_strings({"e", "b", "d", "", "c"}, {1, 1, 1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<double> expect_wide({4.5, 1.5, 3.5, 0, 2.5},
+                                                             {1, 1, 1, 0, 1});
+  cudf::test::expect_tables_equal(
+    cudf::table_view{{expect_typed, expect_narrow, expect_strings, expect_wide}}, result->view());
+}
+
+TYPED_TEST(GatherTest, ConsecutiveRuns)
+{
+  constexpr cudf::size_type source_size{100000};
+  constexpr cudf::size_type run_size{40000};
+
+  auto data  = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 100; });
+  auto valid = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  cudf::test::fixed_width_column_wrapper<TypeParam> source_column(
+    data, data + source_size, valid);
+  cudf::test::fixed_width_column_wrapper<int64_t> other_column(data, data + source_size);
+
+  // two runs of consecutive indices, the second one before the first one in the source
+  auto map_data = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return i < run_size ? i + 50000 : i - run_size + 1000; });
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map(map_data, map_data + 2 * run_size);
+
+  auto const result =
+    cudf::gather(cudf::table_view{{source_column, other_column}}, gather_map);
+
+  auto expect_data =
+    cudf::test::make_counting_transform_iterator(0, [=](auto i) { return map_data[i] % 100; });
+  auto expect_valid =
+    cudf::test::make_counting_transform_iterator(0, [=](auto i) { return map_data[i] % 3 != 0; });
+  cudf::test::fixed_width_column_wrapper<TypeParam> expect_column(
+    expect_data, expect_data + 2 * run_size, expect_valid);
+  cudf::test::fixed_width_column_wrapper<int64_t> expect_other(expect_data,
+                                                               expect_data + 2 * run_size);
+  cudf::test::expect_tables_equal(cudf::table_view{{expect_column, expect_other}},
+                                  result->view());
+}
+
+TYPED_TEST(GatherTest, LargeMapWithoutRuns)
+{
+  constexpr cudf::size_type source_size{100000};
+
+  auto data = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 100; });
+  cudf::test::fixed_width_column_wrapper<TypeParam> source_column(data, data + source_size);
+
+  // every index starts a run, which the samples of the map rule out
+  auto map_data =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return source_size - 1 - i; });
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map(map_data, map_data + source_size);
+
+  auto const result = cudf::gather(cudf::table_view{{source_column}}, gather_map);
+
+  auto expect_data =
+    cudf::test::make_counting_transform_iterator(0, [=](auto i) { return map_data[i] % 100; });
+  cudf::test::fixed_width_column_wrapper<TypeParam> expect_column(expect_data,
+                                                                  expect_data + source_size);
+  cudf::test::expect_tables_equal(cudf::table_view{{expect_column}}, result->view());
+}
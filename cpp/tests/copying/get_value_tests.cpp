@@ -75,6 +75,43 @@ TYPED_TEST(FixedWidthGetValueTest, IndexOutOfBounds)
   CUDF_EXPECT_THROW_MESSAGE(get_element(col, 4);, "Index out of bounds");
 }
 
+TYPED_TEST(FixedWidthGetValueTest, BatchedGet)
+{
+  fixed_width_column_wrapper<TypeParam> col({9, 8, 7, 6, 5}, {1, 1, 0, 1, 1});
+  auto const sliced = slice(col, {1, 5})[0];
+
+  auto const elements = get_elements(sliced, {3, 1, 0, 1});
+
+  ASSERT_EQ(elements.size(), 4);
+  EXPECT_EQ(elements.type, sliced.type());
+  EXPECT_TRUE(elements.is_valid(0));
+  EXPECT_FALSE(elements.is_valid(1));
+  EXPECT_TRUE(elements.is_valid(2));
+  EXPECT_FALSE(elements.is_valid(3));
+  EXPECT_EQ(TypeParam(5), elements.element<TypeParam>(0));
+  EXPECT_EQ(TypeParam(8), elements.element<TypeParam>(2));
+
+  EXPECT_EQ(get_elements(sliced, {}).size(), 0);
+  CUDF_EXPECT_THROW_MESSAGE(get_elements(sliced, {0, 4});, "Index out of bounds");
+}
+
+TYPED_TEST(FixedWidthGetValueTest, BatchedGetScalars)
+{
+  fixed_width_column_wrapper<TypeParam> col({9, 8, 7}, {1, 0, 1});
+  auto const s0 = get_element(col, 2);
+  auto const s1 = get_element(col, 1);
+  auto const s2 = get_element(col, 0);
+
+  auto const elements = get_elements({*s0, *s1, *s2});
+
+  ASSERT_EQ(elements.size(), 3);
+  EXPECT_TRUE(elements.is_valid(0));
+  EXPECT_FALSE(elements.is_valid(1));
+  EXPECT_TRUE(elements.is_valid(2));
+  EXPECT_EQ(TypeParam(7), elements.element<TypeParam>(0));
+  EXPECT_EQ(TypeParam(9), elements.element<TypeParam>(2));
+}
+
 struct StringGetValueTest : public BaseFixture {
 };
 
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+struct PackUnpackTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(PackUnpackTest, MixedColumnTypes)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{{1, 2, 3, 4, 5}, {1, 0, 1, 1, 0}};
+  cudf::test::fixed_width_column_wrapper<double> col2{1.5, 2.5, 3.5, 4.5, 5.5};
+  cudf::test::strings_column_wrapper col3{{"a", "bb", "", "dddd", "eeeee"}, {1, 1, 0, 1, 1}};
+  cudf::test::lists_column_wrapper<int> col4{{1, 2}, {3}, {}, {4, 5, 6}, {7}};
+  cudf::table_view input{{col1, col2, col3, col4}};
+
+  auto packed = cudf::pack(input);
+  auto result = cudf::unpack(packed);
+  cudf::test::expect_tables_equal(input, result);
+
+  // the metadata and the device buffer are enough to rebuild the table
+  auto const metadata  = *packed.metadata;
+  auto result_from_ptr = cudf::unpack(metadata.data(), packed.gpu_data->data());
+  cudf::test::expect_tables_equal(input, result_from_ptr);
+}
+
+TEST_F(PackUnpackTest, ContiguousSplitResults)
+{
+  cudf::test::fixed_width_column_wrapper<int64_t> col1{{1, 2, 3, 4, 5, 6}, {1, 1, 0, 1, 1, 1}};
+  cudf::test::strings_column_wrapper col2{"a", "bb", "ccc", "d", "ee", "fff"};
+  cudf::table_view input{{col1, col2}};
+
+  auto results  = cudf::contiguous_split(input, {2, 3});
+  auto expected = cudf::split(input, {2, 3});
+  for (size_t i = 0; i < results.size(); ++i) {
+    auto const& all_data = results[i].all_data;
+    auto metadata = cudf::pack_metadata(results[i].table, all_data->data(), all_data->size());
+    cudf::test::expect_tables_equal(expected[i], cudf::unpack(metadata.data(), all_data->data()));
+  }
+}
+
+TEST_F(PackUnpackTest, EmptyTable)
+{
+  cudf::table_view input{std::vector<cudf::column_view>{}};
+
+  auto packed = cudf::pack(input);
+  EXPECT_EQ(cudf::unpack(packed).num_columns(), 0);
+}
+
+TEST_F(PackUnpackTest, InvalidMetadata)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col{1, 2, 3};
+  cudf::table_view input{{col}};
+
+  std::vector<uint8_t> metadata(64, 0);
+  EXPECT_THROW(cudf::unpack(metadata.data(), nullptr), cudf::logic_error);
+  // the column is not in the given buffer
+  auto packed = cudf::pack(input);
+  EXPECT_THROW(cudf::pack_metadata(input, packed.gpu_data->data(), 0), cudf::logic_error);
+}
+
+TEST_F(PackUnpackTest, HostRoundTrip)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{{1, 2, 3, 4, 5}, {1, 0, 1, 1, 0}};
+  cudf::test::strings_column_wrapper col2{{"a", "bb", "", "dddd", "eeeee"}, {1, 1, 0, 1, 1}};
+  cudf::test::lists_column_wrapper<int> col3{{1, 2}, {3}, {}, {4, 5, 6}, {7}};
+  cudf::table_view input{{col1, col2, col3}};
+
+  auto host = cudf::pack_to_host(input);
+  // the host view has the metadata of the packed table, and its data can be read on the host
+  auto const host_view = cudf::unpack(host);
+  EXPECT_EQ(host_view.num_rows(), 5);
+  EXPECT_EQ(host_view.column(0).null_count(), 2);
+  EXPECT_EQ(host_view.column(0).data<int32_t>()[3], 4);
+
+  auto device = cudf::copy_to_device(host);
+  cudf::test::expect_tables_equal(input, cudf::unpack(device));
+}
+
+TEST_F(PackUnpackTest, HostSlice)
+{
+  cudf::test::fixed_width_column_wrapper<int64_t> col1{{1, 2, 3, 4, 5, 6}, {1, 1, 0, 1, 1, 0}};
+  cudf::test::strings_column_wrapper col2{{"a", "bb", "ccc", "d", "ee", "fff"},
+                                          {1, 0, 1, 1, 1, 1}};
+  cudf::test::lists_column_wrapper<int> col3{{1}, {2, 3}, {}, {4, 5}, {6}, {7, 8, 9}};
+  cudf::table_view input{{col1, col2, col3}};
+
+  // slices of slices exercise unaligned null masks and rebased offsets
+  auto host      = cudf::pack_to_host(cudf::slice(input, {1, 6}).front());
+  auto host_head = cudf::host_slice(host, 1, 4);
+  auto expected  = cudf::slice(input, {2, 5}).front();
+  cudf::test::expect_tables_equal(expected, cudf::unpack(cudf::copy_to_device(host_head)));
+
+  auto host_empty = cudf::host_slice(host, 2, 2);
+  EXPECT_EQ(cudf::unpack(host_empty).num_rows(), 0);
+
+  EXPECT_THROW(cudf::host_slice(host, 3, 2), cudf::logic_error);
+  EXPECT_THROW(cudf::host_slice(host, 0, 6), cudf::logic_error);
+}
+
+TEST_F(PackUnpackTest, HostConcatenate)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> a0{{1, 2, 3}, {1, 0, 1}};
+  cudf::test::strings_column_wrapper b0{"a", "bb", "ccc"};
+  cudf::test::fixed_width_column_wrapper<int32_t> a1{};
+  cudf::test::strings_column_wrapper b1{};
+  cudf::test::fixed_width_column_wrapper<int32_t> a2{4, 5};
+  cudf::test::strings_column_wrapper b2{{"dddd", ""}, {1, 0}};
+
+  std::vector<cudf::packed_host_columns> inputs;
+  inputs.push_back(cudf::pack_to_host(cudf::table_view{{a0, b0}}));
+  inputs.push_back(cudf::pack_to_host(cudf::table_view{{a1, b1}}));
+  inputs.push_back(cudf::pack_to_host(cudf::table_view{{a2, b2}}));
+  auto result = cudf::host_concatenate(inputs);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_a{{1, 2, 3, 4, 5}, {1, 0, 1, 1, 1}};
+  cudf::test::strings_column_wrapper expected_b{{"a", "bb", "ccc", "dddd", ""}, {1, 1, 1, 1, 0}};
+  cudf::test::expect_tables_equal(cudf::table_view{{expected_a, expected_b}},
+                                  cudf::unpack(cudf::copy_to_device(result)));
+
+  std::vector<cudf::packed_host_columns> mismatched;
+  mismatched.push_back(cudf::pack_to_host(cudf::table_view{{a0}}));
+  mismatched.push_back(cudf::pack_to_host(cudf::table_view{{b0}}));
+  EXPECT_THROW(cudf::host_concatenate(mismatched), cudf::logic_error);
+}
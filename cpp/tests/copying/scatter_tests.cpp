@@ -946,3 +946,65 @@ TEST_F(BooleanMaskScatterScalarFails, NumberOfColumnAndScalarMismatch)
 
   EXPECT_THROW(cudf::boolean_mask_scatter(scalar_vect, target_table, mask), cudf::logic_error);
 }
+
+class ScatterReduceTests : public cudf::test::BaseFixture {
+};
+
+TEST_F(ScatterReduceTests, Sum)
+{
+  using cudf::test::fixed_width_column_wrapper;
+
+  fixed_width_column_wrapper<int32_t> source({1, 2, 3, 4, 5, 6}, {1, 1, 0, 1, 1, 1});
+  fixed_width_column_wrapper<int32_t> scatter_map({0, 2, 2, -1, 2, 7});
+  fixed_width_column_wrapper<int64_t> target({10, 20, 30, 40}, {1, 0, 1, 0});
+
+  // duplicate indices accumulate, the out of bounds index 7 is ignored
+  auto const result =
+    cudf::scatter_reduce(source, scatter_map, target, cudf::make_sum_aggregation());
+  fixed_width_column_wrapper<int64_t> expected({11, 0, 37, 4}, {1, 0, 1, 1});
+  cudf::test::expect_columns_equal(*result, expected);
+
+  // a null source element nullifies its target row
+  auto const include_nulls = cudf::scatter_reduce(
+    source, scatter_map, target, cudf::make_sum_aggregation(), cudf::null_policy::INCLUDE);
+  fixed_width_column_wrapper<int64_t> expected_include({11, 0, 0, 4}, {1, 0, 0, 1});
+  cudf::test::expect_columns_equal(*include_nulls, expected_include);
+}
+
+TEST_F(ScatterReduceTests, MinMaxCount)
+{
+  using cudf::test::fixed_width_column_wrapper;
+
+  fixed_width_column_wrapper<double> source({1.5, -2., 3., 4., .5});
+  fixed_width_column_wrapper<int16_t> scatter_map({1, 1, 0, 1, 0});
+
+  fixed_width_column_wrapper<double> target({2., 0.});
+  auto const min = cudf::scatter_reduce(source, scatter_map, target, cudf::make_min_aggregation());
+  cudf::test::expect_columns_equal(*min, fixed_width_column_wrapper<double>{.5, -2.});
+  auto const max = cudf::scatter_reduce(source, scatter_map, target, cudf::make_max_aggregation());
+  cudf::test::expect_columns_equal(*max, fixed_width_column_wrapper<double>{3., 4.});
+
+  fixed_width_column_wrapper<cudf::size_type> counts{0, 5};
+  auto const count =
+    cudf::scatter_reduce(source, scatter_map, counts, cudf::make_count_aggregation());
+  cudf::test::expect_columns_equal(*count, fixed_width_column_wrapper<cudf::size_type>{2, 8});
+}
+
+TEST_F(ScatterReduceTests, Errors)
+{
+  using cudf::test::fixed_width_column_wrapper;
+
+  fixed_width_column_wrapper<int32_t> source({1, 2, 3});
+  fixed_width_column_wrapper<int32_t> scatter_map({0, 1, 0});
+  fixed_width_column_wrapper<int32_t> target({0, 0});
+
+  // the sum of INT32 elements is INT64
+  EXPECT_THROW(cudf::scatter_reduce(source, scatter_map, target, cudf::make_sum_aggregation()),
+               cudf::logic_error);
+  EXPECT_THROW(
+    cudf::scatter_reduce(source, scatter_map, target, cudf::make_product_aggregation()),
+    cudf::logic_error);
+  fixed_width_column_wrapper<int32_t> short_map({0, 1});
+  EXPECT_THROW(cudf::scatter_reduce(source, short_map, target, cudf::make_min_aggregation()),
+               cudf::logic_error);
+}
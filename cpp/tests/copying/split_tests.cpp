@@ -16,6 +16,8 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <tests/utilities/base_fixture.hpp>
@@ -678,3 +680,46 @@ TEST_F(ContiguousSplitTableCornerCases, MixedColumnTypes)
     cudf::test::expect_tables_equivalent(expected[index], result[index].table);
   }
 }
+
+TEST_F(ContiguousSplitTableCornerCases, NestedColumnTypes)
+{
+  using LCW  = cudf::test::lists_column_wrapper<int>;
+  using SLCW = cudf::test::lists_column_wrapper<cudf::string_view>;
+  LCW c0{{0, 1}, {2}, {3, 4, 5}, {}, {6}, {7, 8}, {9}};
+  SLCW c1{{"a", "bc"}, {"def"}, {}, {"g", "h"}, {"ij"}, {"k"}, {"lm", "no", "p"}};
+  cudf::test::strings_column_wrapper c2{{"x", "yy", "", "zzz", "w", "vv", "u"},
+                                        {1, 1, 0, 1, 1, 0, 1}};
+  cudf::table_view tbl{{c0, c1, c2}};
+
+  std::vector<cudf::size_type> splits{1, 1, 4, 6};
+
+  auto result   = cudf::contiguous_split(tbl, splits);
+  auto expected = cudf::split(tbl, splits);
+
+  EXPECT_EQ(expected.size(), result.size());
+  for (unsigned long index = 0; index < expected.size(); index++) {
+    cudf::test::expect_tables_equal(expected[index], result[index].table);
+  }
+}
+
+TEST_F(ContiguousSplitTableCornerCases, DictionaryColumn)
+{
+  cudf::test::strings_column_wrapper strings{{"b", "a", "", "b", "c", "a", "c"},
+                                             {1, 1, 0, 1, 1, 1, 1}};
+  auto dictionary = cudf::dictionary::encode(strings);
+  cudf::table_view tbl{{dictionary->view()}};
+
+  std::vector<cudf::size_type> splits{2, 5};
+
+  auto result   = cudf::contiguous_split(tbl, splits);
+  auto expected = cudf::split(tbl, splits);
+
+  EXPECT_EQ(expected.size(), result.size());
+  for (unsigned long index = 0; index < expected.size(); index++) {
+    cudf::dictionary_column_view expected_dictionary(expected[index].column(0));
+    cudf::dictionary_column_view result_dictionary(result[index].table.column(0));
+    cudf::test::expect_columns_equal(expected_dictionary.get_indices_annotated(),
+                                     result_dictionary.get_indices_annotated());
+    cudf::test::expect_columns_equal(expected_dictionary.keys(), result_dictionary.keys());
+  }
+}
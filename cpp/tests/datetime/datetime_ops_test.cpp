@@ -17,6 +17,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/datetime.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 #include <cudf/wrappers/timestamps.hpp>
 
@@ -190,6 +191,25 @@ TYPED_TEST(TypedDatetimeOpsTest, TestExtractingGeneratedDatetimeComponents)
   expect_columns_equal(*extract_hour(timestamps), expected_hours);
   expect_columns_equal(*extract_minute(timestamps), expected_minutes);
   expect_columns_equal(*extract_second(timestamps), expected_seconds);
+
+  auto const components = extract_components(timestamps,
+                                             {datetime_component::SECOND,
+                                              datetime_component::YEAR,
+                                              datetime_component::WEEKDAY,
+                                              datetime_component::MONTH,
+                                              datetime_component::HOUR,
+                                              datetime_component::DAY,
+                                              datetime_component::MINUTE,
+                                              datetime_component::YEAR});
+  ASSERT_EQ(components->num_columns(), 8);
+  expect_columns_equal(components->get_column(0), expected_seconds);
+  expect_columns_equal(components->get_column(1), expected_years);
+  expect_columns_equal(components->get_column(2), expected_weekdays);
+  expect_columns_equal(components->get_column(3), expected_months);
+  expect_columns_equal(components->get_column(4), expected_hours);
+  expect_columns_equal(components->get_column(5), expected_days);
+  expect_columns_equal(components->get_column(6), expected_minutes);
+  expect_columns_equal(components->get_column(7), expected_years);
 }
 
 TYPED_TEST(TypedDatetimeOpsTest, TestExtractingGeneratedNullableDatetimeComponents)
@@ -287,6 +307,73 @@ TEST_F(BasicDatetimeOpsTest, TestLastDayOfMonthWithSeconds)
                        true);
 }
 
+TEST_F(BasicDatetimeOpsTest, TestRoundingWithSeconds)
+{
+  using namespace cudf::test;
+  using namespace cudf::datetime;
+
+  auto timestamps_s = fixed_width_column_wrapper<cudf::timestamp_s>{
+    {949496401L,   // 2000-02-02 13:00:01 GMT
+     -131968728L,  // 1965-10-26 14:01:12 GMT
+     90L,          // 1970-01-01 00:01:30 GMT
+     150L,         // 1970-01-01 00:02:30 GMT
+     1582391837L,  // 2020-02-22 17:17:17 GMT
+     0L},
+    {1, 1, 1, 1, 1, 0}};
+
+  expect_columns_equal(
+    *floor_datetimes(timestamps_s, rounding_frequency::HOUR),
+    fixed_width_column_wrapper<cudf::timestamp_s>{
+      {949496400L, -131968800L, 0L, 0L, 1582390800L, 0L}, {1, 1, 1, 1, 1, 0}});
+  expect_columns_equal(
+    *ceil_datetimes(timestamps_s, rounding_frequency::MINUTE),
+    fixed_width_column_wrapper<cudf::timestamp_s>{
+      {949496460L, -131968680L, 120L, 180L, 1582391880L, 0L}, {1, 1, 1, 1, 1, 0}});
+  // halfway values round to the even multiple
+  expect_columns_equal(
+    *round_datetimes(timestamps_s, rounding_frequency::MINUTE),
+    fixed_width_column_wrapper<cudf::timestamp_s>{
+      {949496400L, -131968740L, 120L, 120L, 1582391820L, 0L}, {1, 1, 1, 1, 1, 0}});
+  expect_columns_equal(
+    *round_datetimes(timestamps_s, rounding_frequency::DAY),
+    fixed_width_column_wrapper<cudf::timestamp_s>{
+      {949536000L, -131932800L, 0L, 0L, 1582416000L, 0L}, {1, 1, 1, 1, 1, 0}});
+  // units shorter than the resolution leave the timestamps unchanged
+  expect_columns_equal(*floor_datetimes(timestamps_s, rounding_frequency::MILLISECOND),
+                       timestamps_s);
+}
+
+TEST_F(BasicDatetimeOpsTest, TestConvertTimezone)
+{
+  using namespace cudf::test;
+  using namespace cudf::datetime;
+
+  auto timestamps_s = fixed_width_column_wrapper<cudf::timestamp_s>{
+    {1577836800L,  // 2020-01-01 00:00:00 GMT
+     1593561600L,  // 2020-07-01 00:00:00 GMT
+     4102444800L,  // 2100-01-01 00:00:00 GMT, past the last transition of the tz database
+     0L},
+    {1, 1, 1, 0}};
+  auto local_s = fixed_width_column_wrapper<cudf::timestamp_s>{
+    {1577808000L,  // 2019-12-31 16:00:00 PST
+     1593536400L,  // 2020-06-30 17:00:00 PDT
+     4102416000L,  // 2099-12-31 16:00:00 PST
+     0L},
+    {1, 1, 1, 0}};
+
+  expect_columns_equal(*convert_timezone(timestamps_s, "UTC", "America/Los_Angeles"), local_s);
+  expect_columns_equal(*convert_timezone(local_s, "America/Los_Angeles", ""), timestamps_s);
+  expect_columns_equal(*convert_timezone(timestamps_s, "UTC", "UTC"), timestamps_s);
+
+  auto timestamps_ms = fixed_width_column_wrapper<cudf::timestamp_ms>{1593561600123L};
+  expect_columns_equal(*convert_timezone(timestamps_ms, "UTC", "America/Los_Angeles"),
+                       fixed_width_column_wrapper<cudf::timestamp_ms>{1593536400123L});
+
+  EXPECT_THROW(convert_timezone(timestamps_s, "UTC", "Nowhere/Missing"), cudf::logic_error);
+  EXPECT_THROW(convert_timezone(fixed_width_column_wrapper<int64_t>{0L}, "UTC", "UTC"),
+               cudf::logic_error);
+}
+
 TEST_F(BasicDatetimeOpsTest, TestLastDayOfMonthWithDate)
 {
   using namespace cudf::test;
@@ -20,6 +20,7 @@
 #include <tests/utilities/column_utilities.hpp>
 #include <tests/utilities/column_wrapper.hpp>
 
+#include <string>
 #include <vector>
 
 struct DictionaryEncodeTest : public cudf::test::BaseFixture {
@@ -72,6 +73,31 @@ TEST_F(DictionaryEncodeTest, EncodeWithNull)
   cudf::test::expect_columns_equal(view.indices(), expected);
 }
 
+TEST_F(DictionaryEncodeTest, EncodeManyRowsFewKeys)
+{
+  auto const size = 10000;
+  std::vector<std::string> h_strings(size);
+  std::vector<int32_t> h_expected(size);
+  for (int i = 0; i < size; ++i) {
+    h_strings[i]  = "key" + std::to_string(6 - (i % 7));
+    h_expected[i] = (i % 10) == 0 ? 7 : 6 - (i % 7);
+  }
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 10; });
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end(), validity);
+
+  auto dictionary = cudf::dictionary::encode(strings);
+  cudf::dictionary_column_view view(dictionary->view());
+  EXPECT_EQ(view.null_count(), size / 10);
+
+  cudf::test::strings_column_wrapper keys_expected{
+    "key0", "key1", "key2", "key3", "key4", "key5", "key6"};
+  cudf::test::expect_columns_equal(view.keys(), keys_expected);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> indices_expected(h_expected.begin(),
+                                                                   h_expected.end());
+  cudf::test::expect_columns_equal(view.indices(), indices_expected);
+}
+
 TEST_F(DictionaryEncodeTest, InvalidEncode)
 {
   cudf::test::fixed_width_column_wrapper<int16_t> input{0, 1, 2, 3, -1, -2, -3};
@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/copying.hpp>
 #include <cudf/dlpack.hpp>
 #include <tests/utilities/base_fixture.hpp>
 #include <tests/utilities/column_utilities.hpp>
@@ -369,4 +370,48 @@ TYPED_TEST(DLPackNumericTests, FromDlpackEmpty1D)
   EXPECT_THROW(cudf::from_dlpack(tensor.get()), cudf::logic_error);
 }
 
+TYPED_TEST(DLPackNumericTests, DlpackViewRoundTrip)
+{
+  fixed_width_column_wrapper<TypeParam> col1({1, 2, 3, 4});
+  fixed_width_column_wrapper<TypeParam> col2({5, 6, 7, 8});
+  cudf::table_view input({col1, col2});
+  unique_managed_tensor tensor(cudf::to_dlpack(input));
+
+  // the columns of the viewed tensor are evenly spaced, so the tensor is viewed in turn
+  auto const view = cudf::from_dlpack_view(tensor.get());
+  expect_tables_equal(input, view);
+  EXPECT_EQ(tensor->dl_tensor.data, view.column(0).head());
+  unique_managed_tensor result(cudf::to_dlpack_view(view));
+  EXPECT_EQ(tensor->dl_tensor.data, result->dl_tensor.data);
+  EXPECT_EQ(2, result->dl_tensor.ndim);
+  EXPECT_EQ(tensor->dl_tensor.shape[0], result->dl_tensor.strides[1]);
+}
+
+TYPED_TEST(DLPackNumericTests, ToDlpackViewContiguousSplit)
+{
+  fixed_width_column_wrapper<TypeParam> col1({1, 2, 3, 4, 5});
+  fixed_width_column_wrapper<TypeParam> col2({6, 7, 8, 9, 10});
+  fixed_width_column_wrapper<TypeParam> col3({11, 12, 13, 14, 15});
+  auto const split = cudf::contiguous_split(cudf::table_view({col1, col2, col3}), {});
+  auto const input = split.front().table;
+
+  unique_managed_tensor result(cudf::to_dlpack_view(input));
+  auto const& tensor = result->dl_tensor;
+  EXPECT_EQ(input.column(0).head(), tensor.data);
+  EXPECT_EQ(3, tensor.shape[1]);
+  expect_tables_equal(input, cudf::from_dlpack_view(result.get()));
+}
+
+TYPED_TEST(DLPackNumericTests, ToDlpackViewCopiesUnevenColumns)
+{
+  fixed_width_column_wrapper<TypeParam> col1({1, 2, 3, 4});
+  fixed_width_column_wrapper<TypeParam> col2({5, 6, 7, 8});
+  fixed_width_column_wrapper<TypeParam> col3({9, 10, 11, 12});
+  cudf::table_view input({col1, col3, col2});
+
+  unique_managed_tensor result(cudf::to_dlpack_view(input));
+  auto const view = cudf::from_dlpack_view(result.get());
+  expect_tables_equal(input, view);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
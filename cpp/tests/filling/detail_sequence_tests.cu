@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/gather.cuh>
+#include <cudf/detail/sequence.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/cudf_gtest.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <vector>
+
+struct SequenceDetailTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(SequenceDetailTest, AffineSequence)
+{
+  cudf::detail::affine_sequence<int32_t> const sequence{3, -2, 5};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({3, 1, -1, -3, -5});
+  cudf::test::expect_columns_equal(*sequence.materialize(), expected);
+
+  // read as a gather map
+  cudf::test::fixed_width_column_wrapper<double> source({0.5, 1.5, 2.5, 3.5});
+  cudf::detail::affine_sequence<cudf::size_type> const map{3, -1, 4};
+  auto const result = cudf::detail::gather(cudf::table_view{{source}}, map.begin(), map.end());
+  cudf::test::fixed_width_column_wrapper<double> expected_gather({3.5, 2.5, 1.5, 0.5});
+  cudf::test::expect_columns_equal(result->view().column(0), expected_gather);
+}
+
+TEST_F(SequenceDetailTest, ConstantSequence)
+{
+  cudf::detail::constant_sequence<double> const sequence{1.25, 4};
+
+  cudf::test::fixed_width_column_wrapper<double> expected({1.25, 1.25, 1.25, 1.25});
+  cudf::test::expect_columns_equal(*sequence.materialize(), expected);
+}
+
+TEST_F(SequenceDetailTest, RepeatSequence)
+{
+  // counts {2, 0, 3, 1}
+  std::vector<cudf::size_type> const h_offsets{2, 2, 5, 6};
+  rmm::device_vector<cudf::size_type> const offsets(h_offsets);
+  cudf::detail::repeat_sequence const sequence{offsets.data().get(), 4, 6};
+
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expected({0, 0, 2, 2, 2, 3});
+  cudf::test::expect_columns_equal(*sequence.materialize(), expected);
+
+  cudf::test::strings_column_wrapper source({"a", "b", "c", "d"});
+  auto const result =
+    cudf::detail::gather(cudf::table_view{{source}}, sequence.begin(), sequence.end());
+  cudf::test::strings_column_wrapper expected_gather({"a", "a", "c", "c", "c", "d"});
+  cudf::test::expect_columns_equal(result->view().column(0), expected_gather);
+}
+
+TEST_F(SequenceDetailTest, EmptySequences)
+{
+  EXPECT_EQ(cudf::detail::affine_sequence<int64_t>{0, 1, 0}.materialize()->size(), 0);
+  EXPECT_EQ(cudf::detail::constant_sequence<int8_t>{1, 0}.materialize()->size(), 0);
+  rmm::device_vector<cudf::size_type> const offsets(2, 0);
+  EXPECT_EQ((cudf::detail::repeat_sequence{offsets.data().get(), 2, 0}.materialize()->size()), 0);
+}
@@ -216,6 +216,24 @@ TEST_F(RepeatStringTestFixture, RepeatNullable)
   cudf::test::expect_columns_equal(p_ret->view().column(0), expected);
 }
 
+TEST_F(RepeatStringTestFixture, RepeatMultipleColumns)
+{
+  auto strings = cudf::test::strings_column_wrapper({"a", "b", "c", "d"}, {1, 0, 1, 1});
+  auto values  = cudf::test::fixed_width_column_wrapper<int64_t>({10, 20, 30, 40});
+  auto count   = cudf::test::fixed_width_column_wrapper<cudf::size_type>({2, 0, 3, 1});
+
+  auto expected_strings =
+    cudf::test::strings_column_wrapper({"a", "a", "c", "c", "c", "d"}, {1, 1, 1, 1, 1, 1});
+  auto expected_values = cudf::test::fixed_width_column_wrapper<int64_t>({10, 10, 30, 30, 30, 40});
+
+  cudf::table_view input_table{{strings, values}};
+  auto p_ret = cudf::repeat(input_table, count);
+
+  EXPECT_EQ(p_ret->num_columns(), 2);
+  cudf::test::expect_columns_equal(p_ret->view().column(0), expected_strings);
+  cudf::test::expect_columns_equal(p_ret->view().column(1), expected_values);
+}
+
 TEST_F(RepeatStringTestFixture, ZeroSizeInput)
 {
   std::vector<std::string> input_values{};
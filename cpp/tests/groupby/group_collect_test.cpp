@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <cudf/detail/aggregation/aggregation.hpp>
+
+namespace cudf {
+namespace test {
+template <typename V>
+struct groupby_collect_test : public cudf::test::BaseFixture {
+};
+
+using collect_types = Concat<IntegralTypesNotBool, FloatingPointTypes>;
+
+TYPED_TEST_CASE(groupby_collect_test, collect_types);
+
+// Unless the sort groupby is forced, the results are sorted by a gather, which does not support
+// lists columns
+
+// clang-format off
+TYPED_TEST(groupby_collect_test, collect_list)
+{
+    using K = int32_t;
+    using V = TypeParam;
+
+    fixed_width_column_wrapper<K> keys { 1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+    fixed_width_column_wrapper<V> vals { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    fixed_width_column_wrapper<K> expect_keys { 1, 2, 3 };
+    lists_column_wrapper<V> expect_vals { {0, 3, 6}, {1, 4, 5, 9}, {2, 7, 8} };
+
+    auto agg = cudf::make_collect_list_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg), force_use_sort_impl::YES);
+}
+
+TYPED_TEST(groupby_collect_test, collect_set)
+{
+    using K = int32_t;
+    using V = TypeParam;
+
+    fixed_width_column_wrapper<K> keys { 1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+    fixed_width_column_wrapper<V> vals { 5, 1, 5, 3, 1, 1, 5, 2, 2, 1};
+
+    fixed_width_column_wrapper<K> expect_keys { 1, 2, 3 };
+    lists_column_wrapper<V> expect_vals { {3, 5}, {1}, {2, 5} };
+
+    auto agg = cudf::make_collect_set_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg), force_use_sort_impl::YES);
+}
+
+struct groupby_collect_nulls_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_collect_nulls_test, collect_list)
+{
+    using K = int32_t;
+    using V = int32_t;
+
+    auto const valid_at = [](size_type j) {
+        return make_counting_transform_iterator(0, [j](auto i) { return i == j; });
+    };
+
+    fixed_width_column_wrapper<K> keys { 1, 1, 2, 2, 2};
+    fixed_width_column_wrapper<V> vals({ 1, 0, 0, 3, 0}, { 1, 0, 0, 1, 0});
+
+    fixed_width_column_wrapper<K> expect_keys { 1, 2 };
+    lists_column_wrapper<V> expect_vals { {{1, 0}, valid_at(0)}, {{0, 3, 0}, valid_at(1)} };
+    lists_column_wrapper<V> expect_valid_vals { {1}, {3} };
+
+    test_single_agg(keys, vals, expect_keys, expect_vals,
+                    cudf::make_collect_list_aggregation(), force_use_sort_impl::YES);
+    test_single_agg(keys, vals, expect_keys, expect_valid_vals,
+                    cudf::make_collect_list_aggregation(null_policy::EXCLUDE),
+                    force_use_sort_impl::YES);
+}
+
+TEST_F(groupby_collect_nulls_test, collect_set)
+{
+    using K = int32_t;
+    using V = int32_t;
+
+    auto const valid_at = [](size_type j) {
+        return make_counting_transform_iterator(0, [j](auto i) { return i == j; });
+    };
+
+    fixed_width_column_wrapper<K> keys { 1, 1, 2, 2, 2, 2};
+    fixed_width_column_wrapper<V> vals({ 1, 0, 0, 3, 0, 3}, { 1, 0, 0, 1, 0, 1});
+
+    // The nulls of a group are equal, and sorted after its valid values
+    fixed_width_column_wrapper<K> expect_keys { 1, 2 };
+    lists_column_wrapper<V> expect_vals { {{1, 0}, valid_at(0)}, {{3, 0}, valid_at(0)} };
+    lists_column_wrapper<V> expect_valid_vals { {1}, {3} };
+
+    test_single_agg(keys, vals, expect_keys, expect_vals,
+                    cudf::make_collect_set_aggregation(), force_use_sort_impl::YES);
+    test_single_agg(keys, vals, expect_keys, expect_valid_vals,
+                    cudf::make_collect_set_aggregation(null_policy::EXCLUDE),
+                    force_use_sort_impl::YES);
+}
+
+struct groupby_collect_string_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_collect_string_test, collect_list_and_set)
+{
+    using K = int32_t;
+
+    fixed_width_column_wrapper<K> keys { 1, 2, 1, 2, 1};
+    strings_column_wrapper        vals { "b", "a", "a", "a", "b"};
+
+    fixed_width_column_wrapper<K> expect_keys { 1, 2 };
+    lists_column_wrapper<string_view> expect_list { {"b", "a", "b"}, {"a", "a"} };
+    lists_column_wrapper<string_view> expect_set { {"a", "b"}, {"a"} };
+
+    test_single_agg(keys, vals, expect_keys, expect_list,
+                    cudf::make_collect_list_aggregation(), force_use_sort_impl::YES);
+    test_single_agg(keys, vals, expect_keys, expect_set,
+                    cudf::make_collect_set_aggregation(), force_use_sort_impl::YES);
+}
+// clang-format on
+
+}  // namespace test
+}  // namespace cudf
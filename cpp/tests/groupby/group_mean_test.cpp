@@ -47,6 +47,9 @@ TYPED_TEST(groupby_mean_test, basic)
 
     auto agg = cudf::make_mean_aggregation();
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+    auto agg2 = cudf::make_mean_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 
 TYPED_TEST(groupby_mean_test, empty_cols)
@@ -63,6 +66,9 @@ TYPED_TEST(groupby_mean_test, empty_cols)
 
     auto agg = cudf::make_mean_aggregation();
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+    auto agg2 = cudf::make_mean_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 
 TYPED_TEST(groupby_mean_test, zero_valid_keys)
@@ -79,6 +85,9 @@ TYPED_TEST(groupby_mean_test, zero_valid_keys)
 
     auto agg = cudf::make_mean_aggregation();
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+    auto agg2 = cudf::make_mean_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 
 TYPED_TEST(groupby_mean_test, zero_valid_values)
@@ -95,6 +104,9 @@ TYPED_TEST(groupby_mean_test, zero_valid_values)
 
     auto agg = cudf::make_mean_aggregation();
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+    auto agg2 = cudf::make_mean_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 
 TYPED_TEST(groupby_mean_test, null_keys_and_values)
@@ -116,6 +128,9 @@ TYPED_TEST(groupby_mean_test, null_keys_and_values)
 
     auto agg = cudf::make_mean_aggregation();
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+    auto agg2 = cudf::make_mean_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 // clang-format on
 
@@ -49,6 +49,12 @@ TYPED_TEST(groupby_nunique_test, basic)
         test_single_agg(keys, vals, expect_keys, expect_bool_vals, std::move(agg));
     else
         test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+    auto agg2 = cudf::make_nunique_aggregation();
+    if(std::is_same<V, bool>())
+        test_single_agg(keys, vals, expect_keys, expect_bool_vals, std::move(agg2), force_use_sort_impl::YES);
+    else
+        test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 
 TYPED_TEST(groupby_nunique_test, empty_cols)
@@ -65,6 +71,9 @@ TYPED_TEST(groupby_nunique_test, empty_cols)
 
     auto agg = cudf::make_nunique_aggregation();
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+    auto agg2 = cudf::make_nunique_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 
 TYPED_TEST(groupby_nunique_test, basic_duplicates)
@@ -85,6 +94,12 @@ TYPED_TEST(groupby_nunique_test, basic_duplicates)
         test_single_agg(keys, vals, expect_keys, expect_bool_vals, std::move(agg));
     else
         test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+    auto agg2 = cudf::make_nunique_aggregation();
+    if(std::is_same<V, bool>())
+        test_single_agg(keys, vals, expect_keys, expect_bool_vals, std::move(agg2), force_use_sort_impl::YES);
+    else
+        test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 
 TYPED_TEST(groupby_nunique_test, zero_valid_keys)
@@ -101,6 +116,9 @@ TYPED_TEST(groupby_nunique_test, zero_valid_keys)
 
     auto agg = cudf::make_nunique_aggregation();
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+    auto agg2 = cudf::make_nunique_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 
 TYPED_TEST(groupby_nunique_test, zero_valid_values)
@@ -117,6 +135,9 @@ TYPED_TEST(groupby_nunique_test, zero_valid_values)
 
     auto agg = cudf::make_nunique_aggregation();
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+    auto agg2 = cudf::make_nunique_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 
 TYPED_TEST(groupby_nunique_test, null_keys_and_values)
@@ -142,6 +163,12 @@ TYPED_TEST(groupby_nunique_test, null_keys_and_values)
         test_single_agg(keys, vals, expect_keys, expect_bool_vals, std::move(agg));
     else 
         test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+    auto agg2 = cudf::make_nunique_aggregation();
+    if(std::is_same<V, bool>())
+        test_single_agg(keys, vals, expect_keys, expect_bool_vals, std::move(agg2), force_use_sort_impl::YES);
+    else 
+        test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 
 TYPED_TEST(groupby_nunique_test, null_keys_and_values_with_duplicates)
@@ -168,6 +195,12 @@ TYPED_TEST(groupby_nunique_test, null_keys_and_values_with_duplicates)
         test_single_agg(keys, vals, expect_keys, expect_bool_vals, std::move(agg));
     else 
         test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+    auto agg2 = cudf::make_nunique_aggregation();
+    if(std::is_same<V, bool>())
+        test_single_agg(keys, vals, expect_keys, expect_bool_vals, std::move(agg2), force_use_sort_impl::YES);
+    else 
+        test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 
 
@@ -195,6 +228,12 @@ TYPED_TEST(groupby_nunique_test, include_nulls)
         test_single_agg(keys, vals, expect_keys, expect_bool_vals, std::move(agg));
     else 
         test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+    auto agg2 = cudf::make_nunique_aggregation(null_policy::INCLUDE);
+    if(std::is_same<V, bool>())
+        test_single_agg(keys, vals, expect_keys, expect_bool_vals, std::move(agg2), force_use_sort_impl::YES);
+    else 
+        test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 // clang-format on
 
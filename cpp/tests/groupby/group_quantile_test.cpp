@@ -189,6 +189,47 @@ TYPED_TEST(groupby_quantile_test, interpolation_types)
     test_single_agg(keys, vals, expect_keys, expect_vals5, std::move(agg5));
 
 }
+
+TYPED_TEST(groupby_quantile_test, negative_values)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = cudf::detail::target_type_t<V, aggregation::QUANTILE>;
+
+    fixed_width_column_wrapper<K> keys        { 1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+    fixed_width_column_wrapper<V> vals        {-3, 2,-1, 0,-2, 5,-4, 1, 3,-5};
+
+                                          //  { 1, 1, 1, 2, 2, 2, 2, 3, 3, 3}
+    fixed_width_column_wrapper<K> expect_keys { 1,       2,          3      };
+                                          //  {-4,-3, 0,-5,-2, 2, 5,-1, 1, 3}
+    fixed_width_column_wrapper<R> expect_vals({  -3.,        0.,       1.   }, all_valid());
+
+    auto agg = cudf::make_quantile_aggregation({0.5},
+                                        interpolation::LINEAR);
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+}
+
+TYPED_TEST(groupby_quantile_test, many_groups)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = cudf::detail::target_type_t<V, aggregation::QUANTILE>;
+
+    // Too many groups to select the quantiles of each, so the values are sorted in the groups
+    constexpr size_type num_groups = 10000;
+    auto key_iter = make_counting_transform_iterator(0, [](auto i) { return i % num_groups; });
+    auto val_iter = make_counting_transform_iterator(
+      0, [](auto i) { return (i % num_groups) % 50 + 2 * (i / num_groups); });
+    auto expect_key_iter = make_counting_transform_iterator(0, [](auto i) { return i; });
+    auto expect_val_iter = make_counting_transform_iterator(0, [](auto i) { return i % 50 + 1; });
+
+    fixed_width_column_wrapper<K> keys(key_iter, key_iter + 2 * num_groups);
+    fixed_width_column_wrapper<V> vals(val_iter, val_iter + 2 * num_groups);
+    fixed_width_column_wrapper<K> expect_keys(expect_key_iter, expect_key_iter + num_groups);
+    fixed_width_column_wrapper<R> expect_vals(expect_val_iter, expect_val_iter + num_groups);
+
+    test_single_agg(keys, vals, expect_keys, expect_vals, cudf::make_median_aggregation());
+}
 // clang-format on
 
 }  // namespace test
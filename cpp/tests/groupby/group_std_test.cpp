@@ -49,6 +49,9 @@ TYPED_TEST(groupby_std_test, basic)
 
     auto agg = cudf::make_std_aggregation();
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+    auto agg2 = cudf::make_std_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 
 TYPED_TEST(groupby_std_test, empty_cols)
@@ -65,6 +68,9 @@ TYPED_TEST(groupby_std_test, empty_cols)
 
     auto agg = cudf::make_std_aggregation();
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+    auto agg2 = cudf::make_std_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 
 TYPED_TEST(groupby_std_test, zero_valid_keys)
@@ -81,6 +87,9 @@ TYPED_TEST(groupby_std_test, zero_valid_keys)
 
     auto agg = cudf::make_std_aggregation();
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+    auto agg2 = cudf::make_std_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 
 TYPED_TEST(groupby_std_test, zero_valid_values)
@@ -97,6 +106,9 @@ TYPED_TEST(groupby_std_test, zero_valid_values)
 
     auto agg = cudf::make_std_aggregation();
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+    auto agg2 = cudf::make_std_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 
 TYPED_TEST(groupby_std_test, null_keys_and_values)
@@ -118,6 +130,9 @@ TYPED_TEST(groupby_std_test, null_keys_and_values)
 
     auto agg = cudf::make_std_aggregation();
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+    auto agg2 = cudf::make_std_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 
 TYPED_TEST(groupby_std_test, ddof_non_default)
@@ -139,6 +154,9 @@ TYPED_TEST(groupby_std_test, ddof_non_default)
 
     auto agg = cudf::make_std_aggregation(2);
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+    auto agg2 = cudf::make_std_aggregation(2);
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 // clang-format on
 
@@ -132,7 +132,115 @@ TYPED_TEST(groupby_sum_test, null_keys_and_values)
     auto agg2 = cudf::make_sum_aggregation();
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
+TYPED_TEST(groupby_sum_test, boolean_mask)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = cudf::detail::target_type_t<V, aggregation::SUM>;
+
+    fixed_width_column_wrapper<K> keys        { 1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+    fixed_width_column_wrapper<V> vals        { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    fixed_width_column_wrapper<bool> mask   ( { 1, 1, 0, 1, 0, 1, 1, 0, 0, 1},
+                                              { 1, 0, 1, 1, 1, 1, 1, 1, 1, 1});
+
+                                          //  { 1, 1, 1,  2, 2}
+    fixed_width_column_wrapper<K> expect_keys { 1,        2   };
+                                          //  { 0, 3, 6,  5, 9}
+    fixed_width_column_wrapper<R> expect_vals { 9,        14  };
+
+    auto agg = cudf::make_sum_aggregation();
+    test_single_masked_agg(keys, vals, mask, expect_keys, expect_vals, std::move(agg));
+
+    auto agg2 = cudf::make_sum_aggregation();
+    test_single_masked_agg(
+        keys, vals, mask, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
+}
+
 // clang-format on
 
+TYPED_TEST(groupby_sum_test, many_rows_few_keys)
+{
+  using K = int32_t;
+  using V = TypeParam;
+  using R = cudf::detail::target_type_t<V, aggregation::SUM>;
+
+  // Spans several blocks of the shared memory pre-aggregation
+  auto const num_rows = 10000;
+  auto key_iter       = make_counting_transform_iterator(0, [](auto i) { return i % 3; });
+  auto val_iter       = make_counting_transform_iterator(0, [](auto i) { return 1; });
+  fixed_width_column_wrapper<K> keys(key_iter, key_iter + num_rows);
+  fixed_width_column_wrapper<V> vals(val_iter, val_iter + num_rows);
+
+  fixed_width_column_wrapper<K> expect_keys{0, 1, 2};
+  fixed_width_column_wrapper<R> expect_vals{3334, 3333, 3333};
+
+  test_single_agg(keys, vals, expect_keys, expect_vals, cudf::make_sum_aggregation());
+}
+
+TYPED_TEST(groupby_sum_test, more_keys_than_shared_memory_slots)
+{
+  using K = int32_t;
+  using V = TypeParam;
+  using R = cudf::detail::target_type_t<V, aggregation::SUM>;
+
+  // Overflows the shared memory table of each block into the global hash map
+  auto const num_rows = 10000;
+  auto const num_keys = 1000;
+  auto key_iter = make_counting_transform_iterator(0, [num_keys](auto i) { return i % num_keys; });
+  auto val_iter = make_counting_transform_iterator(0, [](auto i) { return 1; });
+  fixed_width_column_wrapper<K> keys(key_iter, key_iter + num_rows);
+  fixed_width_column_wrapper<V> vals(val_iter, val_iter + num_rows);
+
+  auto expect_key_iter = make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto expect_val_iter = make_counting_transform_iterator(0, [](auto i) { return 10; });
+  fixed_width_column_wrapper<K> expect_keys(expect_key_iter, expect_key_iter + num_keys);
+  fixed_width_column_wrapper<R> expect_vals(expect_val_iter, expect_val_iter + num_keys);
+
+  test_single_agg(keys, vals, expect_keys, expect_vals, cudf::make_sum_aggregation());
+}
+
+TYPED_TEST(groupby_sum_test, estimated_few_groups)
+{
+  using K = int32_t;
+  using V = TypeParam;
+  using R = cudf::detail::target_type_t<V, aggregation::SUM>;
+
+  // Enough rows for the number of groups to be estimated, sizing the hash map after it
+  auto const num_rows = 1 << 17;
+  auto const num_keys = 100;
+  auto key_iter = make_counting_transform_iterator(0, [num_keys](auto i) { return i % num_keys; });
+  auto val_iter = make_counting_transform_iterator(0, [](auto i) { return 1; });
+  fixed_width_column_wrapper<K> keys(key_iter, key_iter + num_rows);
+  fixed_width_column_wrapper<V> vals(val_iter, val_iter + num_rows);
+
+  auto expect_key_iter = make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto expect_val_iter = make_counting_transform_iterator(
+    0, [num_rows, num_keys](auto i) { return num_rows / num_keys + (i < num_rows % num_keys); });
+  fixed_width_column_wrapper<K> expect_keys(expect_key_iter, expect_key_iter + num_keys);
+  fixed_width_column_wrapper<R> expect_vals(expect_val_iter, expect_val_iter + num_keys);
+
+  test_single_agg(keys, vals, expect_keys, expect_vals, cudf::make_sum_aggregation());
+}
+
+TYPED_TEST(groupby_sum_test, estimated_unique_keys)
+{
+  using K = int32_t;
+  using V = TypeParam;
+  using R = cudf::detail::target_type_t<V, aggregation::SUM>;
+
+  // Nearly as many groups as rows are left to the sort groupby
+  auto const num_rows = 1 << 17;
+  auto key_iter = make_counting_transform_iterator(0, [](auto i) { return num_rows - 1 - i; });
+  auto val_iter = make_counting_transform_iterator(0, [](auto i) { return 1; });
+  fixed_width_column_wrapper<K> keys(key_iter, key_iter + num_rows);
+  fixed_width_column_wrapper<V> vals(val_iter, val_iter + num_rows);
+
+  auto expect_key_iter = make_counting_transform_iterator(0, [](auto i) { return i; });
+  fixed_width_column_wrapper<K> expect_keys(expect_key_iter, expect_key_iter + num_rows);
+  fixed_width_column_wrapper<R> expect_vals(val_iter, val_iter + num_rows);
+
+  test_single_agg(keys, vals, expect_keys, expect_vals, cudf::make_sum_aggregation());
+}
+
 }  // namespace test
 }  // namespace cudf
@@ -22,6 +22,8 @@
 
 #include <cudf/detail/aggregation/aggregation.hpp>
 
+#include <cmath>
+
 namespace cudf {
 namespace test {
 template <typename V>
@@ -49,6 +51,9 @@ TYPED_TEST(groupby_var_test, basic)
 
     auto agg = cudf::make_variance_aggregation();
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+    auto agg2 = cudf::make_variance_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 
 TYPED_TEST(groupby_var_test, empty_cols)
@@ -65,6 +70,9 @@ TYPED_TEST(groupby_var_test, empty_cols)
 
     auto agg = cudf::make_variance_aggregation();
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+    auto agg2 = cudf::make_variance_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 
 TYPED_TEST(groupby_var_test, zero_valid_keys)
@@ -81,6 +89,9 @@ TYPED_TEST(groupby_var_test, zero_valid_keys)
 
     auto agg = cudf::make_variance_aggregation();
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+    auto agg2 = cudf::make_variance_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 
 TYPED_TEST(groupby_var_test, zero_valid_values)
@@ -97,6 +108,9 @@ TYPED_TEST(groupby_var_test, zero_valid_values)
 
     auto agg = cudf::make_variance_aggregation();
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+    auto agg2 = cudf::make_variance_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 
 TYPED_TEST(groupby_var_test, null_keys_and_values)
@@ -118,6 +132,9 @@ TYPED_TEST(groupby_var_test, null_keys_and_values)
 
     auto agg = cudf::make_variance_aggregation();
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+    auto agg2 = cudf::make_variance_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 
 TYPED_TEST(groupby_var_test, ddof_non_default)
@@ -139,8 +156,47 @@ TYPED_TEST(groupby_var_test, ddof_non_default)
 
     auto agg = cudf::make_variance_aggregation(2);
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+    auto agg2 = cudf::make_variance_aggregation(2);
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 // clang-format on
 
+TYPED_TEST(groupby_var_test, shared_with_mean_and_std)
+{
+  using K = int32_t;
+  using V = TypeParam;
+  using R = cudf::detail::target_type_t<V, aggregation::VARIANCE>;
+
+  // The compound aggregations of a request share their SUM and COUNT_VALID
+  fixed_width_column_wrapper<K> keys{1, 1, 2, 2, 2};
+  fixed_width_column_wrapper<V> vals{1, 3, 2, 4, 6};
+
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(make_sum_aggregation());
+  requests[0].aggregations.push_back(make_mean_aggregation());
+  requests[0].aggregations.push_back(make_variance_aggregation());
+  requests[0].aggregations.push_back(make_std_aggregation());
+
+  groupby::groupby gb_obj(table_view({keys}));
+  auto result = gb_obj.aggregate(requests);
+
+  auto const sort_order = sorted_order(result.first->view());
+  auto const sorted_results =
+    gather(table_view({result.second[0].results[0]->view(),
+                       result.second[0].results[1]->view(),
+                       result.second[0].results[2]->view(),
+                       result.second[0].results[3]->view()}),
+           *sort_order);
+
+  using S = cudf::detail::target_type_t<V, aggregation::SUM>;
+  expect_columns_equivalent(fixed_width_column_wrapper<S>{4, 12}, sorted_results->get_column(0));
+  expect_columns_equivalent(fixed_width_column_wrapper<R>{2., 4.}, sorted_results->get_column(1));
+  expect_columns_equivalent(fixed_width_column_wrapper<R>{2., 4.}, sorted_results->get_column(2));
+  expect_columns_equivalent(fixed_width_column_wrapper<R>{std::sqrt(2.), 2.},
+                            sorted_results->get_column(3));
+}
+
 }  // namespace test
 }  // namespace cudf
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <cudf/groupby.hpp>
+
+namespace cudf {
+namespace test {
+struct groupby_accumulator_test : public cudf::test::BaseFixture {
+};
+
+namespace {
+std::vector<std::vector<std::unique_ptr<aggregation>>> sum_mean_count_var()
+{
+  std::vector<std::vector<std::unique_ptr<aggregation>>> aggs(1);
+  aggs[0].push_back(make_sum_aggregation());
+  aggs[0].push_back(make_mean_aggregation());
+  aggs[0].push_back(make_count_aggregation());
+  aggs[0].push_back(make_variance_aggregation());
+  return aggs;
+}
+
+// The order of the groups is arbitrary, so compare the results sorted by key
+void expect_results(groupby::groupby_accumulator const& acc,
+                    column_view const& expect_keys,
+                    std::vector<column_view> const& expect_vals)
+{
+  auto const result      = acc.finalize();
+  auto const sort_order  = sorted_order(result.first->view(), {}, {null_order::AFTER});
+  auto const sorted_keys = gather(result.first->view(), *sort_order);
+  expect_tables_equal(table_view({expect_keys}), *sorted_keys);
+
+  ASSERT_EQ(expect_vals.size(), result.second[0].results.size());
+  for (size_t i = 0; i < expect_vals.size(); ++i) {
+    auto const sorted_vals =
+      gather(table_view({result.second[0].results[i]->view()}), *sort_order);
+    expect_columns_equivalent(expect_vals[i], sorted_vals->get_column(0), true);
+  }
+}
+}  // namespace
+
+TEST_F(groupby_accumulator_test, update)
+{
+  groupby::groupby_accumulator acc(sum_mean_count_var());
+
+  fixed_width_column_wrapper<int32_t> keys0{1, 2, 1, 3};
+  fixed_width_column_wrapper<int32_t> vals0({3, 1, 4, 0}, {1, 1, 1, 0});
+  acc.update(table_view({keys0}), table_view({vals0}));
+
+  fixed_width_column_wrapper<int32_t> keys1{2, 1, 4, 2};
+  fixed_width_column_wrapper<int32_t> vals1{5, 2, 9, 6};
+  acc.update(table_view({keys1}), table_view({vals1}));
+
+  fixed_width_column_wrapper<int32_t> expect_keys{1, 2, 3, 4};
+  fixed_width_column_wrapper<int64_t> expect_sum({9, 12, 0, 9}, {1, 1, 0, 1});
+  fixed_width_column_wrapper<double> expect_mean({3, 4, 0, 9}, {1, 1, 0, 1});
+  fixed_width_column_wrapper<size_type> expect_count{3, 3, 0, 1};
+  fixed_width_column_wrapper<double> expect_var({1, 7, 0, 0}, {1, 1, 0, 0});
+  expect_results(acc, expect_keys, {expect_sum, expect_mean, expect_count, expect_var});
+}
+
+TEST_F(groupby_accumulator_test, merge)
+{
+  groupby::groupby_accumulator acc0(sum_mean_count_var());
+  groupby::groupby_accumulator acc1(sum_mean_count_var());
+
+  fixed_width_column_wrapper<int32_t> keys0{1, 2, 1};
+  fixed_width_column_wrapper<int32_t> vals0{3, 1, 4};
+  acc0.update(table_view({keys0}), table_view({vals0}));
+
+  fixed_width_column_wrapper<int32_t> keys1{2, 1, 4, 2};
+  fixed_width_column_wrapper<int32_t> vals1{5, 2, 9, 6};
+  acc1.update(table_view({keys1}), table_view({vals1}));
+
+  acc0.merge(acc1);
+
+  fixed_width_column_wrapper<int32_t> expect_keys{1, 2, 4};
+  fixed_width_column_wrapper<int64_t> expect_sum{9, 12, 9};
+  fixed_width_column_wrapper<double> expect_mean{3, 4, 9};
+  fixed_width_column_wrapper<size_type> expect_count{3, 3, 1};
+  fixed_width_column_wrapper<double> expect_var({1, 7, 0}, {1, 1, 0});
+  expect_results(acc0, expect_keys, {expect_sum, expect_mean, expect_count, expect_var});
+}
+
+TEST_F(groupby_accumulator_test, null_keys)
+{
+  std::vector<std::vector<std::unique_ptr<aggregation>>> aggs(1);
+  aggs[0].push_back(make_min_aggregation());
+  aggs[0].push_back(make_count_aggregation(null_policy::INCLUDE));
+  groupby::groupby_accumulator acc(aggs, null_policy::INCLUDE);
+
+  fixed_width_column_wrapper<int32_t> keys0({1, 0, 1}, {1, 0, 1});
+  fixed_width_column_wrapper<float> vals0{3, 1, 4};
+  acc.update(table_view({keys0}), table_view({vals0}));
+
+  fixed_width_column_wrapper<int32_t> keys1({0, 1}, {0, 1});
+  fixed_width_column_wrapper<float> vals1{5, 2};
+  acc.update(table_view({keys1}), table_view({vals1}));
+
+  fixed_width_column_wrapper<int32_t> expect_keys({1, 0}, {1, 0});
+  fixed_width_column_wrapper<float> expect_min{2, 1};
+  fixed_width_column_wrapper<size_type> expect_count{3, 2};
+  expect_results(acc, expect_keys, {expect_min, expect_count});
+}
+
+TEST_F(groupby_accumulator_test, variance_of_large_values)
+{
+  std::vector<std::vector<std::unique_ptr<aggregation>>> aggs(1);
+  aggs[0].push_back(make_mean_aggregation());
+  aggs[0].push_back(make_variance_aggregation());
+  groupby::groupby_accumulator acc(aggs);
+
+  // The sum of squares of these values loses the deviations to rounding
+  int64_t const base = 1000000000000;
+  fixed_width_column_wrapper<int32_t> keys{1, 1};
+  fixed_width_column_wrapper<int64_t> vals0{base + 1, base + 2};
+  acc.update(table_view({keys}), table_view({vals0}));
+  fixed_width_column_wrapper<int64_t> vals1{base + 3, base + 4};
+  acc.update(table_view({keys}), table_view({vals1}));
+
+  fixed_width_column_wrapper<int32_t> expect_keys{1};
+  fixed_width_column_wrapper<double> expect_mean{base + 2.5};
+  fixed_width_column_wrapper<double> expect_var{5. / 3};
+  expect_results(acc, expect_keys, {expect_mean, expect_var});
+}
+
+TEST_F(groupby_accumulator_test, strings_max)
+{
+  std::vector<std::vector<std::unique_ptr<aggregation>>> aggs(1);
+  aggs[0].push_back(make_max_aggregation());
+  groupby::groupby_accumulator acc(aggs);
+
+  fixed_width_column_wrapper<int32_t> keys0{1, 2};
+  strings_column_wrapper vals0{"b", "x"};
+  acc.update(table_view({keys0}), table_view({vals0}));
+
+  fixed_width_column_wrapper<int32_t> keys1{1, 3};
+  strings_column_wrapper vals1({"c", "a"});
+  acc.update(table_view({keys1}), table_view({vals1}));
+
+  // Only groups seen before, updated without new groups
+  fixed_width_column_wrapper<int32_t> keys2{2, 1};
+  strings_column_wrapper vals2({"y", "z"}, {1, 0});
+  acc.update(table_view({keys2}), table_view({vals2}));
+
+  fixed_width_column_wrapper<int32_t> expect_keys{1, 2, 3};
+  strings_column_wrapper expect_max{"c", "y", "a"};
+  expect_results(acc, expect_keys, {expect_max});
+}
+
+TEST_F(groupby_accumulator_test, unsupported)
+{
+  std::vector<std::vector<std::unique_ptr<aggregation>>> aggs(1);
+  aggs[0].push_back(make_median_aggregation());
+  EXPECT_THROW(groupby::groupby_accumulator{aggs}, cudf::logic_error);
+
+  groupby::groupby_accumulator acc(sum_mean_count_var());
+  EXPECT_THROW(acc.finalize(), cudf::logic_error);
+
+  groupby::groupby_accumulator other(
+    std::vector<std::vector<std::unique_ptr<aggregation>>>{});
+  EXPECT_THROW(acc.merge(other), cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
@@ -89,5 +89,40 @@ TYPED_TEST(groupby_group_keys_and_values_test, some_nulls)
   test_groups(keys, expect_grouped_keys, expect_group_offsets, values, expect_grouped_values);
 }
 
+TEST_F(groupby_group_keys_test, shared_grouping)
+{
+  using K = int32_t;
+
+  fixed_width_column_wrapper<K> keys{3, 1, 2, 1, 3, 1};
+  fixed_width_column_wrapper<K> values{0, 1, 2, 3, 4, 5};
+  groupby::grouping grouping{table_view({keys})};
+
+  EXPECT_EQ(3, grouping.num_groups());
+  EXPECT_EQ(6, grouping.num_grouped_rows());
+  expect_columns_equal(fixed_width_column_wrapper<size_type>{1, 3, 5, 2, 0, 4},
+                       grouping.key_sort_order());
+  expect_columns_equal(fixed_width_column_wrapper<size_type>{0, 3, 4, 6},
+                       grouping.group_offsets());
+  expect_columns_equal(fixed_width_column_wrapper<size_type>{0, 0, 0, 1, 2, 2},
+                       grouping.group_labels());
+
+  // Groupby objects built from the grouping share its sort of the keys
+  groupby::groupby gb0(grouping);
+  auto groups = gb0.get_groups(table_view({values}));
+  expect_tables_equal(table_view({fixed_width_column_wrapper<K>{1, 1, 1, 2, 3, 3}}),
+                      groups.keys->view());
+  expect_tables_equal(table_view({fixed_width_column_wrapper<K>{1, 3, 5, 2, 0, 4}}),
+                      groups.values->view());
+
+  groupby::groupby gb1(grouping);
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = values;
+  requests[0].aggregations.push_back(make_sum_aggregation());
+  auto result = gb1.aggregate(requests);
+  expect_tables_equal(table_view({fixed_width_column_wrapper<K>{1, 2, 3}}), result.first->view());
+  expect_columns_equal(fixed_width_column_wrapper<int64_t>{9, 2, 4},
+                       *result.second[0].results[0]);
+}
+
 }  // namespace test
 }  // namespace cudf
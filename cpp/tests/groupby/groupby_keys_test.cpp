@@ -193,6 +193,25 @@ TEST_F(groupby_string_keys_test, basic)
     auto agg = cudf::make_sum_aggregation();
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
 }
+
+TEST_F(groupby_string_keys_test, long_keys_include_null_keys)
+{
+    using V = int32_t;
+    using R = cudf::detail::target_type_t<V, aggregation::SUM>;
+
+    std::string const prefix = "https://example.com/a/very/long/path/shared/by/every/key?id=";
+    strings_column_wrapper        keys      ( { prefix + "1", prefix + "2", prefix + "1", "", prefix + "2", prefix + "10", ""},
+                                              {            1,            1,            1,  0,            1,             1,  1});
+    fixed_width_column_wrapper<V> vals        {            0,            1,            2,  3,            4,             5,  6};
+
+    strings_column_wrapper        expect_keys({ "", prefix + "1", prefix + "10", prefix + "2", ""},
+                                              {  1,            1,             1,            1,  0});
+    fixed_width_column_wrapper<R> expect_vals {  6,            2,             5,            5,  3};
+
+    auto agg = cudf::make_sum_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg),
+        force_use_sort_impl::NO, null_policy::INCLUDE);
+}
 // clang-format on
 
 }  // namespace test
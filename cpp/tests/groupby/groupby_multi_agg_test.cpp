@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <cudf/detail/aggregation/aggregation.hpp>
+
+namespace cudf {
+namespace test {
+template <typename V>
+struct groupby_multi_agg_test : public cudf::test::BaseFixture {
+};
+
+using supported_types = cudf::test::Types<int8_t, int32_t, int64_t, float, double>;
+
+TYPED_TEST_CASE(groupby_multi_agg_test, supported_types);
+
+// clang-format off
+TYPED_TEST(groupby_multi_agg_test, sort_reductions)
+{
+    using K = int32_t;
+    using V = TypeParam;
+
+    fixed_width_column_wrapper<K> keys { 1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+    fixed_width_column_wrapper<V> vals({ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9},
+                                       { 1, 1, 1, 0, 1, 1, 1, 0, 1, 1});
+
+    fixed_width_column_wrapper<K> expect_keys { 1, 2, 3 };
+    fixed_width_column_wrapper<cudf::detail::target_type_t<V, aggregation::SUM>>
+      expect_sum { 6, 19, 10 };
+    fixed_width_column_wrapper<V> expect_min { 0, 1, 2 };
+    fixed_width_column_wrapper<V> expect_max { 6, 9, 8 };
+    fixed_width_column_wrapper<size_type> expect_argmin { 0, 1, 2 };
+    fixed_width_column_wrapper<size_type> expect_argmax { 6, 9, 8 };
+    fixed_width_column_wrapper<size_type> expect_count { 2, 4, 2 };
+    fixed_width_column_wrapper<cudf::detail::target_type_t<V, aggregation::MEAN>>
+      expect_mean { 3., 19./4, 5. };
+
+    // All the reductions of the request are computed by a single pass over the values
+    std::vector<groupby::aggregation_request> requests(1);
+    requests[0].values = vals;
+    requests[0].aggregations.push_back(make_sum_aggregation());
+    requests[0].aggregations.push_back(make_min_aggregation());
+    requests[0].aggregations.push_back(make_max_aggregation());
+    requests[0].aggregations.push_back(make_argmin_aggregation());
+    requests[0].aggregations.push_back(make_argmax_aggregation());
+    requests[0].aggregations.push_back(make_count_aggregation());
+    requests[0].aggregations.push_back(make_mean_aggregation());
+    // WAR to force groupby to use sort implementation
+    requests[0].aggregations.push_back(make_nth_element_aggregation(0));
+
+    groupby::groupby gb_obj(table_view({keys}));
+    auto result = gb_obj.aggregate(requests);
+
+    expect_tables_equal(table_view({expect_keys}), result.first->view());
+    auto const& results = result.second[0].results;
+    expect_columns_equivalent(expect_sum, *results[0], true);
+    expect_columns_equivalent(expect_min, *results[1], true);
+    expect_columns_equivalent(expect_max, *results[2], true);
+    expect_columns_equivalent(expect_argmin, *results[3], true);
+    expect_columns_equivalent(expect_argmax, *results[4], true);
+    expect_columns_equivalent(expect_count, *results[5], true);
+    expect_columns_equivalent(expect_mean, *results[6], true);
+}
+
+TYPED_TEST(groupby_multi_agg_test, sort_reductions_without_gather)
+{
+    using K = int32_t;
+    using V = TypeParam;
+
+    fixed_width_column_wrapper<K> keys { 1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+    fixed_width_column_wrapper<V> vals({ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9},
+                                       { 1, 1, 1, 0, 1, 1, 1, 0, 1, 1});
+
+    fixed_width_column_wrapper<K> expect_keys { 1, 2, 3 };
+    fixed_width_column_wrapper<size_type> expect_argmin { 0, 1, 2 };
+    fixed_width_column_wrapper<size_type> expect_argmax { 6, 9, 8 };
+    fixed_width_column_wrapper<size_type> expect_count { 2, 4, 2 };
+    fixed_width_column_wrapper<cudf::detail::target_type_t<V, aggregation::MEDIAN>>
+      expect_median { 3., 4.5, 5. };
+
+    // MEDIAN forces the sort implementation without gathering the grouped values, so the
+    // reductions read the values through the key sort order
+    std::vector<groupby::aggregation_request> requests(1);
+    requests[0].values = vals;
+    requests[0].aggregations.push_back(make_argmin_aggregation());
+    requests[0].aggregations.push_back(make_argmax_aggregation());
+    requests[0].aggregations.push_back(make_count_aggregation());
+    requests[0].aggregations.push_back(make_median_aggregation());
+
+    groupby::groupby gb_obj(table_view({keys}));
+    auto result = gb_obj.aggregate(requests);
+
+    expect_tables_equal(table_view({expect_keys}), result.first->view());
+    auto const& results = result.second[0].results;
+    expect_columns_equivalent(expect_argmin, *results[0], true);
+    expect_columns_equivalent(expect_argmax, *results[1], true);
+    expect_columns_equivalent(expect_count, *results[2], true);
+    expect_columns_equivalent(expect_median, *results[3], true);
+}
+// clang-format on
+
+}  // namespace test
+}  // namespace cudf
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <cudf/groupby.hpp>
+#include <cudf/replace.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/types.hpp>
+
+namespace cudf {
+namespace test {
+template <typename V>
+struct groupby_replace_nulls_test : public cudf::test::BaseFixture {
+};
+
+TYPED_TEST_CASE(groupby_replace_nulls_test, FixedWidthTypes);
+
+TYPED_TEST(groupby_replace_nulls_test, preceding_and_following)
+{
+  using K = int32_t;
+  using V = TypeParam;
+
+  fixed_width_column_wrapper<K> keys{1, 2, 1, 2, 1, 2, 1};
+  fixed_width_column_wrapper<V> values({0, 1, 2, 3, 4, 5, 6}, {0, 1, 1, 0, 0, 0, 1});
+
+  fixed_width_column_wrapper<K> expect_keys{1, 1, 1, 1, 2, 2, 2};
+  // Group 1 holds the values {0, 2, 4, 6} and group 2 the values {1, 3, 5}
+  fixed_width_column_wrapper<V> expect_preceding({0, 2, 2, 6, 1, 1, 1}, {0, 1, 1, 1, 1, 1, 1});
+  fixed_width_column_wrapper<V> expect_following({2, 2, 6, 6, 1, 3, 5}, {1, 1, 1, 1, 1, 0, 0});
+
+  groupby::groupby gb_obj(table_view({keys}));
+  auto result = gb_obj.replace_nulls(table_view({values, values}),
+                                     {replace_policy::PRECEDING, replace_policy::FOLLOWING});
+
+  expect_columns_equal(result.first->get_column(0), expect_keys);
+  expect_columns_equal(result.second->get_column(0), expect_preceding);
+  expect_columns_equal(result.second->get_column(1), expect_following);
+}
+
+TYPED_TEST(groupby_replace_nulls_test, null_keys)
+{
+  using K = int32_t;
+  using V = TypeParam;
+
+  fixed_width_column_wrapper<K> keys({1, 1, 2, 1}, {1, 1, 0, 1});
+  fixed_width_column_wrapper<V> values({0, 1, 2, 3}, {1, 0, 1, 0});
+
+  fixed_width_column_wrapper<K> expect_keys{1, 1, 1};
+  fixed_width_column_wrapper<V> expect_values({0, 0, 0});
+
+  groupby::groupby gb_obj(table_view({keys}));
+  auto result = gb_obj.replace_nulls(table_view({values}), {replace_policy::PRECEDING});
+
+  expect_columns_equal(result.first->get_column(0), expect_keys);
+  expect_columns_equal(result.second->get_column(0), expect_values);
+}
+
+}  // namespace test
+}  // namespace cudf
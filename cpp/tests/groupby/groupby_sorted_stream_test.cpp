@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <cudf/groupby.hpp>
+
+namespace cudf {
+namespace test {
+struct groupby_sorted_stream_test : public cudf::test::BaseFixture {
+};
+
+namespace {
+using result_type = std::pair<std::unique_ptr<table>, std::vector<groupby::aggregation_result>>;
+
+std::vector<std::vector<std::unique_ptr<aggregation>>> sum_count_median()
+{
+  std::vector<std::vector<std::unique_ptr<aggregation>>> aggs(1);
+  aggs[0].push_back(make_sum_aggregation());
+  aggs[0].push_back(make_count_aggregation());
+  aggs[0].push_back(make_median_aggregation());
+  return aggs;
+}
+
+// The groups come out in the order of the sorted keys
+void expect_result(result_type const& result,
+                   column_view const& expect_keys,
+                   std::vector<column_view> const& expect_vals)
+{
+  expect_tables_equal(table_view({expect_keys}), result.first->view());
+  ASSERT_EQ(expect_vals.size(), result.second[0].results.size());
+  for (size_t i = 0; i < expect_vals.size(); ++i) {
+    expect_columns_equivalent(expect_vals[i], *result.second[0].results[i], true);
+  }
+}
+}  // namespace
+
+TEST_F(groupby_sorted_stream_test, carry_last_group)
+{
+  using K = int32_t;
+  using V = int32_t;
+
+  groupby::sorted_groupby_stream stream(sum_count_median());
+
+  fixed_width_column_wrapper<K> keys0{1, 1, 2};
+  fixed_width_column_wrapper<V> vals0{3, 1, 4};
+  expect_result(stream.update(table_view{{keys0}}, table_view{{vals0}}),
+                fixed_width_column_wrapper<K>{1},
+                {fixed_width_column_wrapper<int64_t>{4},
+                 fixed_width_column_wrapper<size_type>{2},
+                 fixed_width_column_wrapper<double>{2.0}});
+
+  fixed_width_column_wrapper<K> keys1{2, 2, 3};
+  fixed_width_column_wrapper<V> vals1{5, 9, 2};
+  expect_result(stream.update(table_view{{keys1}}, table_view{{vals1}}),
+                fixed_width_column_wrapper<K>{2},
+                {fixed_width_column_wrapper<int64_t>{18},
+                 fixed_width_column_wrapper<size_type>{3},
+                 fixed_width_column_wrapper<double>{5.0}});
+
+  fixed_width_column_wrapper<K> keys2{3, 4, 5, 5};
+  fixed_width_column_wrapper<V> vals2{1, 7, 1, 1};
+  expect_result(stream.update(table_view{{keys2}}, table_view{{vals2}}),
+                fixed_width_column_wrapper<K>{3, 4},
+                {fixed_width_column_wrapper<int64_t>{3, 7},
+                 fixed_width_column_wrapper<size_type>{2, 1},
+                 fixed_width_column_wrapper<double>{1.5, 7.0}});
+
+  expect_result(stream.finish(),
+                fixed_width_column_wrapper<K>{5},
+                {fixed_width_column_wrapper<int64_t>{2},
+                 fixed_width_column_wrapper<size_type>{2},
+                 fixed_width_column_wrapper<double>{1.0}});
+}
+
+TEST_F(groupby_sorted_stream_test, group_spanning_chunks)
+{
+  using K = int32_t;
+  using V = int32_t;
+
+  std::vector<std::vector<std::unique_ptr<aggregation>>> aggs(1);
+  aggs[0].push_back(make_sum_aggregation());
+  groupby::sorted_groupby_stream stream(aggs);
+
+  fixed_width_column_wrapper<K> keys0{1, 1};
+  fixed_width_column_wrapper<V> vals0{1, 2};
+  fixed_width_column_wrapper<K> keys1{};
+  fixed_width_column_wrapper<V> vals1{};
+  fixed_width_column_wrapper<K> keys2{1, 1, 2};
+  fixed_width_column_wrapper<V> vals2{3, 4, 5};
+
+  fixed_width_column_wrapper<K> no_keys{};
+  fixed_width_column_wrapper<int64_t> no_sums{};
+  expect_result(stream.update(table_view{{keys0}}, table_view{{vals0}}), no_keys, {no_sums});
+  expect_result(stream.update(table_view{{keys1}}, table_view{{vals1}}), no_keys, {no_sums});
+  expect_result(stream.update(table_view{{keys0}}, table_view{{vals0}}), no_keys, {no_sums});
+  expect_result(stream.update(table_view{{keys2}}, table_view{{vals2}}),
+                fixed_width_column_wrapper<K>{1},
+                {fixed_width_column_wrapper<int64_t>{13}});
+  expect_result(
+    stream.finish(), fixed_width_column_wrapper<K>{2}, {fixed_width_column_wrapper<int64_t>{5}});
+}
+
+TEST_F(groupby_sorted_stream_test, null_keys)
+{
+  using K = int32_t;
+  using V = int32_t;
+
+  std::vector<std::vector<std::unique_ptr<aggregation>>> aggs(1);
+  aggs[0].push_back(make_sum_aggregation());
+  groupby::sorted_groupby_stream stream(aggs, null_policy::INCLUDE);
+
+  // The nulls are sorted first, and form one group
+  fixed_width_column_wrapper<K> keys0({0, 0}, {0, 0});
+  fixed_width_column_wrapper<V> vals0{1, 2};
+  fixed_width_column_wrapper<K> keys1({0, 1}, {0, 1});
+  fixed_width_column_wrapper<V> vals1{3, 4};
+
+  expect_result(stream.update(table_view{{keys0}}, table_view{{vals0}}),
+                fixed_width_column_wrapper<K>{},
+                {fixed_width_column_wrapper<int64_t>{}});
+  expect_result(stream.update(table_view{{keys1}}, table_view{{vals1}}),
+                fixed_width_column_wrapper<K>({0}, {0}),
+                {fixed_width_column_wrapper<int64_t>{6}});
+  expect_result(
+    stream.finish(), fixed_width_column_wrapper<K>{1}, {fixed_width_column_wrapper<int64_t>{4}});
+}
+
+TEST_F(groupby_sorted_stream_test, mismatched_chunks)
+{
+  std::vector<std::vector<std::unique_ptr<aggregation>>> aggs(1);
+  aggs[0].push_back(make_sum_aggregation());
+  groupby::sorted_groupby_stream stream(aggs);
+  EXPECT_THROW(stream.finish(), cudf::logic_error);
+
+  fixed_width_column_wrapper<int32_t> keys{1, 2};
+  fixed_width_column_wrapper<int32_t> vals{1, 2};
+  fixed_width_column_wrapper<int64_t> other_keys{3, 4};
+  fixed_width_column_wrapper<int32_t> short_vals{1};
+  stream.update(table_view{{keys}}, table_view{{vals}});
+  EXPECT_THROW(stream.update(table_view{{keys}}, table_view{{short_vals}}), cudf::logic_error);
+  EXPECT_THROW(stream.update(table_view{{other_keys}}, table_view{{vals}}), cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
@@ -98,6 +98,37 @@ inline void test_single_agg(column_view const& keys,
   }
 }
 
+inline void test_single_masked_agg(column_view const& keys,
+                                   column_view const& values,
+                                   column_view const& boolean_mask,
+                                   column_view const& expect_keys,
+                                   column_view const& expect_vals,
+                                   std::unique_ptr<aggregation>&& agg,
+                                   force_use_sort_impl use_sort = force_use_sort_impl::NO)
+{
+  std::vector<groupby::aggregation_request> requests;
+  requests.emplace_back(groupby::aggregation_request());
+  requests[0].values = values;
+
+  requests[0].aggregations.push_back(std::move(agg));
+
+  if (use_sort == force_use_sort_impl::YES) {
+    // WAR to force groupby to use sort implementation
+    requests[0].aggregations.push_back(make_nth_element_aggregation(0));
+  }
+
+  groupby::groupby gb_obj(table_view({keys}));
+
+  auto result = gb_obj.aggregate(requests, boolean_mask);
+
+  auto const sort_order  = sorted_order(result.first->view(), {}, {null_order::AFTER});
+  auto const sorted_keys = gather(result.first->view(), *sort_order);
+  auto const sorted_vals = gather(table_view({result.second[0].results[0]->view()}), *sort_order);
+
+  expect_tables_equal(table_view({expect_keys}), *sorted_keys);
+  expect_columns_equivalent(expect_vals, sorted_vals->get_column(0), true);
+}
+
 inline auto all_valid()
 {
   auto all_valid = make_counting_transform_iterator(0, [](auto i) { return true; });
@@ -642,6 +642,122 @@ TYPED_TEST(GroupedRollingTest, ZeroWindow)
     grouping_keys, input, expected_group_offsets, preceding_window, following_window, 1);
 }
 
+class GroupedRollingGroupingTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(GroupedRollingGroupingTest, UnsortedKeys)
+{
+  fixed_width_column_wrapper<int32_t> keys{{2, 1, 2, 1, 0, 2}, {1, 1, 1, 1, 0, 1}};
+  fixed_width_column_wrapper<int32_t> input{1, 2, 3, 4, 5, 6};
+  cudf::groupby::grouping groups{cudf::table_view{{keys}}};
+
+  // Windows span the rows of each group in their original order; the row with a null key is null
+  auto output = cudf::grouped_rolling_window(groups, input, 2, 0, 1, cudf::make_sum_aggregation());
+  fixed_width_column_wrapper<int64_t> expected{{1, 2, 4, 6, 0, 9}, {1, 1, 1, 1, 0, 1}};
+  cudf::test::expect_columns_equal(expected, *output);
+
+  // The memoized grouping is reused
+  output = cudf::grouped_rolling_window(groups, input, 1, 1, 1, cudf::make_count_aggregation());
+  fixed_width_column_wrapper<size_type> expected_count{{2, 2, 2, 1, 0, 1}, {1, 1, 1, 1, 0, 1}};
+  cudf::test::expect_columns_equal(expected_count, *output);
+
+  fixed_width_column_wrapper<int32_t> short_input{1, 2};
+  EXPECT_THROW(
+    cudf::grouped_rolling_window(groups, short_input, 2, 0, 1, cudf::make_sum_aggregation()),
+    cudf::logic_error);
+}
+
+class GroupedRollingWindowFunctionTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(GroupedRollingWindowFunctionTest, LeadLag)
+{
+  fixed_width_column_wrapper<int32_t> keys{0, 0, 0, 0, 1, 1, 1};
+  fixed_width_column_wrapper<int32_t> input{10, 20, 20, 30, 5, 5, 7};
+  cudf::table_view grouping_keys{{keys}};
+
+  auto output =
+    cudf::grouped_rolling_window(grouping_keys, input, 1, 1, 1, cudf::make_lead_aggregation(1));
+  cudf::test::expect_columns_equivalent(
+    fixed_width_column_wrapper<int32_t>{{20, 20, 30, 0, 5, 7, 0}, {1, 1, 1, 0, 1, 1, 0}},
+    *output);
+
+  // The lagging row must be in the window
+  output =
+    cudf::grouped_rolling_window(grouping_keys, input, 3, 0, 1, cudf::make_lag_aggregation(2));
+  cudf::test::expect_columns_equivalent(
+    fixed_width_column_wrapper<int32_t>{{0, 0, 10, 20, 0, 0, 5}, {0, 0, 1, 1, 0, 0, 1}},
+    *output);
+  output =
+    cudf::grouped_rolling_window(grouping_keys, input, 2, 0, 1, cudf::make_lag_aggregation(2));
+  cudf::test::expect_columns_equivalent(
+    fixed_width_column_wrapper<int32_t>{{0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}}, *output);
+
+  fixed_width_column_wrapper<int32_t> defaults{-1, -2, -3, -4, -5, -6, -7};
+  output = cudf::grouped_rolling_window(
+    grouping_keys, input, defaults, 1, 1, 1, cudf::make_lead_aggregation(1));
+  cudf::test::expect_columns_equivalent(
+    fixed_width_column_wrapper<int32_t>{20, 20, 30, -4, 5, 7, -7}, *output);
+
+  EXPECT_THROW(cudf::grouped_rolling_window(
+                 grouping_keys, input, defaults, 1, 1, 1, cudf::make_sum_aggregation()),
+               cudf::logic_error);
+}
+
+TEST_F(GroupedRollingWindowFunctionTest, FirstLastValue)
+{
+  fixed_width_column_wrapper<int32_t> keys{0, 0, 0, 0, 1, 1, 1};
+  cudf::test::strings_column_wrapper input{{"a", "b", "", "d", "e", "f", "g"},
+                                           {1, 1, 0, 1, 1, 1, 1}};
+  cudf::table_view grouping_keys{{keys}};
+
+  auto output = cudf::grouped_rolling_window(
+    grouping_keys, input, 2, 0, 1, cudf::make_nth_element_aggregation(0));
+  cudf::test::expect_columns_equivalent(
+    cudf::test::strings_column_wrapper{{"a", "a", "b", "", "e", "e", "f"}, {1, 1, 1, 0, 1, 1, 1}},
+    *output);
+
+  output = cudf::grouped_rolling_window(
+    grouping_keys, input, 1, 1, 1, cudf::make_nth_element_aggregation(-1));
+  cudf::test::expect_columns_equivalent(
+    cudf::test::strings_column_wrapper{{"b", "", "d", "d", "f", "g", "g"}, {1, 0, 1, 1, 1, 1, 1}},
+    *output);
+
+  // Skipping the null element
+  output = cudf::grouped_rolling_window(
+    grouping_keys,
+    input,
+    2,
+    0,
+    1,
+    cudf::make_nth_element_aggregation(-1, cudf::null_policy::EXCLUDE));
+  cudf::test::expect_columns_equivalent(
+    cudf::test::strings_column_wrapper{{"a", "b", "b", "d", "e", "f", "g"}}, *output);
+}
+
+TEST_F(GroupedRollingWindowFunctionTest, Rank)
+{
+  fixed_width_column_wrapper<int32_t> keys{0, 0, 0, 0, 1, 1, 1};
+  fixed_width_column_wrapper<int32_t> input{{10, 20, 20, 0, 5, 5, 7}, {1, 1, 1, 0, 1, 1, 1}};
+  cudf::table_view grouping_keys{{keys}};
+
+  // The ranks ignore the window bounds; nulls are equal
+  auto output =
+    cudf::grouped_rolling_window(grouping_keys, input, 1, 0, 1, cudf::make_rank_aggregation());
+  cudf::test::expect_columns_equal(fixed_width_column_wrapper<size_type>{1, 2, 2, 4, 1, 1, 3},
+                                   *output);
+
+  output = cudf::grouped_rolling_window(
+    grouping_keys, input, 1, 0, 1, cudf::make_dense_rank_aggregation());
+  cudf::test::expect_columns_equal(fixed_width_column_wrapper<size_type>{1, 2, 2, 3, 1, 1, 2},
+                                   *output);
+
+  // Without groups, all the rows are ranked together
+  output = cudf::rolling_window(input, 1, 0, 1, cudf::make_dense_rank_aggregation());
+  cudf::test::expect_columns_equal(fixed_width_column_wrapper<size_type>{1, 2, 2, 3, 4, 4, 5},
+                                   *output);
+}
+
 // ------------- non-fixed-width types --------------------
 
 using GroupedRollingTestStrings = GroupedRollingTest<cudf::string_view>;
@@ -1233,4 +1349,25 @@ TYPED_TEST(GroupedTimeRangeRollingTest, SimplePartitionedStaticWindowsWithNoGrou
                          1);
 }
 
+struct TimeRangeRollingTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(TimeRangeRollingTest, Ungrouped)
+{
+  fixed_width_column_wrapper<cudf::timestamp_D> timestamps{1, 2, 3, 7, 7};
+  fixed_width_column_wrapper<int32_t> input{10, 20, 10, 50, 60};
+
+  auto result = cudf::time_range_rolling_window(
+    timestamps, cudf::order::ASCENDING, input, 1, 1, 1, cudf::make_sum_aggregation());
+  cudf::test::expect_columns_equal(
+    fixed_width_column_wrapper<int64_t>{{30, 40, 30, 110, 110}, {1, 1, 1, 1, 1}}, *result);
+
+  fixed_width_column_wrapper<cudf::timestamp_D> descending{7, 7, 3, 2, 1};
+  fixed_width_column_wrapper<int32_t> reversed{60, 50, 10, 20, 10};
+  result = cudf::time_range_rolling_window(
+    descending, cudf::order::DESCENDING, reversed, 1, 0, 2, cudf::make_max_aggregation());
+  cudf::test::expect_columns_equal(
+    fixed_width_column_wrapper<int32_t>{{60, 60, 0, 20, 20}, {0, 1, 0, 1, 1}}, *result);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
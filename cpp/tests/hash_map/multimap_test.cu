@@ -45,11 +45,16 @@ class MultimapTest : public cudf::test::BaseFixture {
   using value_type = typename T::value_type;
   using size_type  = int;
 
-  using multimap_type = concurrent_unordered_multimap<key_type,
-                                                      value_type,
-                                                      size_type,
-                                                      std::numeric_limits<key_type>::max(),
-                                                      std::numeric_limits<value_type>::max()>;
+  // The tests read the slots from host code, so the map is allocated in managed memory
+  using multimap_type =
+    concurrent_unordered_multimap<key_type,
+                                  value_type,
+                                  size_type,
+                                  std::numeric_limits<key_type>::max(),
+                                  std::numeric_limits<value_type>::max(),
+                                  default_hash<key_type>,
+                                  equal_to<key_type>,
+                                  managed_allocator<thrust::pair<key_type, value_type>>>;
 
   std::unique_ptr<multimap_type, std::function<void(multimap_type*)>> the_map;
 
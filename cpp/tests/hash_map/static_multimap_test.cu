@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+
+#include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
+
+#include <hash/static_multimap.cuh>
+
+#include <gtest/gtest.h>
+
+#include <cooperative_groups.h>
+
+#include <limits>
+#include <vector>
+
+template <typename Map>
+__global__ void insert_pairs(Map map,
+                             typename Map::key_type const* keys,
+                             typename Map::mapped_type const* values,
+                             int num_pairs,
+                             int* error)
+{
+  auto const tile = cooperative_groups::tiled_partition<Map::tile_size>(
+    cooperative_groups::this_thread_block());
+  int const num_tiles = (blockDim.x * gridDim.x) / Map::tile_size;
+  for (int i = (threadIdx.x + blockIdx.x * blockDim.x) / Map::tile_size; i < num_pairs;
+       i += num_tiles) {
+    if (!map.insert(tile, keys[i], values[i]) && tile.thread_rank() == 0) { *error = 1; }
+  }
+}
+
+template <typename Map>
+__global__ void sum_values(Map map,
+                           typename Map::key_type const* keys,
+                           int num_keys,
+                           int* counts,
+                           typename Map::mapped_type* sums)
+{
+  using value_type = typename Map::mapped_type;
+  auto const tile  = cooperative_groups::tiled_partition<Map::tile_size>(
+    cooperative_groups::this_thread_block());
+  int const num_tiles = (blockDim.x * gridDim.x) / Map::tile_size;
+  for (int i = (threadIdx.x + blockIdx.x * blockDim.x) / Map::tile_size; i < num_keys;
+       i += num_tiles) {
+    auto const count = map.for_each_match(
+      tile,
+      keys[i],
+      [](value_type) { return true; },
+      [&](value_type value, cudf::size_type) { atomicAdd(&sums[i], value); });
+    if (tile.thread_rank() == 0) { counts[i] = count; }
+  }
+}
+
+template <typename Key>
+struct StaticMultimapTest : public cudf::test::BaseFixture {
+};
+
+using KeyTypes = ::testing::Types<int32_t, uint32_t, int64_t, uint64_t>;
+
+TYPED_TEST_CASE(StaticMultimapTest, KeyTypes);
+
+TYPED_TEST(StaticMultimapTest, InsertAndCount)
+{
+  using Key = TypeParam;
+  using Map = cudf::detail::static_multimap<Key, int>;
+
+  // Key k is inserted k % 4 times, with the values 0, 1, ...
+  constexpr int num_keys = 1000;
+  std::vector<Key> h_keys;
+  std::vector<int> h_values;
+  for (int k = 0; k < num_keys; ++k) {
+    for (int v = 0; v < k % 4; ++v) {
+      h_keys.push_back(static_cast<Key>(k));
+      h_values.push_back(v);
+    }
+  }
+  thrust::device_vector<Key> keys(h_keys);
+  thrust::device_vector<int> values(h_values);
+  thrust::device_vector<int> error(1, 0);
+
+  // High load factor, so the probe sequences span several windows
+  Map map(h_keys.size(), 0.9);
+  int const num_pairs = h_keys.size();
+  insert_pairs<<<(num_pairs * Map::device_view::tile_size + 127) / 128, 128>>>(
+    map.to_device(), keys.data().get(), values.data().get(), num_pairs, error.data().get());
+  EXPECT_EQ(0, error[0]);
+
+  std::vector<Key> h_probe_keys(num_keys + 1);
+  for (int k = 0; k <= num_keys; ++k) { h_probe_keys[k] = static_cast<Key>(k); }
+  thrust::device_vector<Key> probe_keys(h_probe_keys);
+  thrust::device_vector<int> counts(num_keys + 1, -1);
+  thrust::device_vector<int> sums(num_keys + 1, 0);
+  sum_values<<<((num_keys + 1) * Map::device_view::tile_size + 127) / 128, 128>>>(
+    map.to_device(), probe_keys.data().get(), num_keys + 1, counts.data().get(), sums.data().get());
+
+  thrust::host_vector<int> h_counts(counts);
+  thrust::host_vector<int> h_sums(sums);
+  for (int k = 0; k <= num_keys; ++k) {
+    int const expected_count = (k < num_keys) ? k % 4 : 0;
+    EXPECT_EQ(expected_count, h_counts[k]);
+    EXPECT_EQ(expected_count * (expected_count - 1) / 2, h_sums[k]);
+  }
+}
+
+TYPED_TEST(StaticMultimapTest, InsertIntoFullMap)
+{
+  using Key = TypeParam;
+  using Map = cudf::detail::static_multimap<Key, int>;
+
+  Map map(4, 1.0);
+  int const num_pairs = map.capacity() + 1;
+  std::vector<Key> h_keys(num_pairs, Key{7});
+  thrust::device_vector<Key> keys(h_keys);
+  thrust::device_vector<int> values(num_pairs, 0);
+  thrust::device_vector<int> error(1, 0);
+  insert_pairs<<<1, 128>>>(
+    map.to_device(), keys.data().get(), values.data().get(), num_pairs, error.data().get());
+  EXPECT_EQ(1, error[0]);
+}
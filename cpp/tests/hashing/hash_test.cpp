@@ -112,6 +112,73 @@ TEST_F(HashTest, MultiValueNulls)
   expect_columns_equal(output1->view(), output2->view());
 }
 
+TEST_F(HashTest, XXHash64MultiValueNulls)
+{
+  // Nulls with different values should be equal
+  strings_column_wrapper const strings_col1(
+    {"", "The quick brown fox", "All work and no play makes Jack a dull boy"}, {0, 1, 1});
+  strings_column_wrapper const strings_col2(
+    {"different but null", "The quick brown fox", "All work and no play makes Jack a dull boy"},
+    {0, 1, 1});
+
+  // Different truthy values should be equal
+  fixed_width_column_wrapper<bool> const bools_col1({0, 1, 1}, {1, 0, 1});
+  fixed_width_column_wrapper<bool> const bools_col2({0, 0, 255}, {1, 0, 1});
+
+  auto const input1 = cudf::table_view({strings_col1, bools_col1});
+  auto const input2 = cudf::table_view({strings_col2, bools_col2});
+
+  auto const output1 = cudf::hash(input1, cudf::hash_id::HASH_XXHASH64);
+  auto const output2 = cudf::hash(input2, cudf::hash_id::HASH_XXHASH64);
+
+  EXPECT_EQ(cudf::type_id::UINT64, output1->type().id());
+  EXPECT_EQ(input1.num_rows(), output1->size());
+  expect_columns_equal(output1->view(), output2->view());
+}
+
+TEST_F(HashTest, XXHash64Strings)
+{
+  // Covers the lengths below 4 and 8 bytes and the 32-byte stripes
+  strings_column_wrapper const strings_col(
+    {"", "abc", "All work and no play makes Jack a dull boy"});
+  auto const output = cudf::hash(cudf::table_view({strings_col}), cudf::hash_id::HASH_XXHASH64);
+
+  // xxHash64 of each string combined with the initial row hash value 0
+  fixed_width_column_wrapper<uint64_t> const expected(
+    {0x8d7e54f0d12365aeUL, 0xe2f3a6af2cc185aeUL, 0x0fe78562e2fd72c8UL});
+  expect_columns_equal(output->view(), expected);
+}
+
+TEST_F(HashTest, SparkMurmur3AndHive)
+{
+  fixed_width_column_wrapper<int32_t> const ints({0, 100, -100, 0}, {1, 1, 1, 0});
+  strings_column_wrapper const strings({"", "The quick brown fox", "jumps over", "\xc3\xa9"});
+  fixed_width_column_wrapper<double> const doubles({0.0, -0.0, 1.5, 0.0}, {1, 1, 1, 0});
+  fixed_width_column_wrapper<int64_t> const longs({0L, -1L, 1L << 40, 7L});
+  auto const input = cudf::table_view({ints, strings, doubles, longs});
+
+  // Values of Spark's hash(ints, strings, doubles, longs), which skips the nulls
+  auto const spark = cudf::hash(input, cudf::hash_id::HASH_SPARK_MURMUR3);
+  fixed_width_column_wrapper<int32_t> const expected_spark(
+    {-1942770629, 2146813592, -1747804851, -397614363});
+  expect_columns_equal(spark->view(), expected_spark);
+
+  // Values of Hive's hash of the row, for which the nulls are 0
+  auto const hive = cudf::hash(input, cudf::hash_id::HASH_HIVE);
+  fixed_width_column_wrapper<int32_t> const expected_hive({0, -756666625, -416589261, -1900851});
+  expect_columns_equal(hive->view(), expected_hive);
+
+  // Spark's well-known hash(1) and Java's "abc".hashCode()
+  fixed_width_column_wrapper<int32_t> const one({1});
+  strings_column_wrapper const abc({"abc"});
+  auto const spark_one = cudf::hash(cudf::table_view({one}), cudf::hash_id::HASH_SPARK_MURMUR3);
+  auto const hive_abc  = cudf::hash(cudf::table_view({abc}), cudf::hash_id::HASH_HIVE);
+  expect_columns_equal(spark_one->view(), fixed_width_column_wrapper<int32_t>({-559580957}));
+  expect_columns_equal(hive_abc->view(), fixed_width_column_wrapper<int32_t>({96354}));
+
+  EXPECT_THROW(cudf::hash(input, cudf::hash_id::HASH_HIVE, {0, 0, 0, 0}), cudf::logic_error);
+}
+
 template <typename T>
 class HashTestTyped : public cudf::test::BaseFixture {
 };
@@ -176,4 +243,22 @@ TYPED_TEST(HashTestFloatTyped, TestExtremes)
   expect_columns_equal(output1->view(), output2->view(), true);
 }
 
+TYPED_TEST(HashTestFloatTyped, TestExtremesXXHash64)
+{
+  using T = TypeParam;
+  T min   = std::numeric_limits<T>::min();
+  T max   = std::numeric_limits<T>::max();
+  T nan   = std::numeric_limits<T>::quiet_NaN();
+  T inf   = std::numeric_limits<T>::infinity();
+
+  fixed_width_column_wrapper<T> const col1({T(0.0), T(100.0), T(-100.0), min, max, nan, inf, -inf});
+  fixed_width_column_wrapper<T> const col2(
+    {T(-0.0), T(100.0), T(-100.0), min, max, -nan, inf, -inf});
+
+  auto const output1 = cudf::hash(cudf::table_view({col1}), cudf::hash_id::HASH_XXHASH64);
+  auto const output2 = cudf::hash(cudf::table_view({col2}), cudf::hash_id::HASH_XXHASH64);
+
+  expect_columns_equal(output1->view(), output2->view(), true);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/arrow_device.hpp>
+#include <cudf/copying.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <string>
+
+using namespace cudf::test;
+
+struct ArrowDeviceTest : public BaseFixture {
+};
+
+TEST_F(ArrowDeviceTest, RoundTrip)
+{
+  fixed_width_column_wrapper<int32_t> ints({1, 2, 3, 4}, {1, 0, 1, 1});
+  strings_column_wrapper strings({"a", "", "bcd", "ef"}, {1, 1, 0, 1});
+  lists_column_wrapper<int64_t> lists{{1, 2}, {}, {3}, {4, 5, 6}};
+  cudf::table_view input{{ints, strings, lists}};
+
+  ArrowSchema schema;
+  ArrowDeviceArray array;
+  cudf::to_arrow_device(input, &schema, &array);
+
+  EXPECT_EQ(std::string{schema.format}, "+s");
+  EXPECT_EQ(schema.n_children, 3);
+  EXPECT_EQ(std::string{schema.children[0]->format}, "i");
+  EXPECT_EQ(std::string{schema.children[1]->format}, "u");
+  EXPECT_EQ(std::string{schema.children[2]->format}, "+l");
+  EXPECT_EQ(std::string{schema.children[2]->children[0]->format}, "l");
+  EXPECT_EQ(array.device_type, ARROW_DEVICE_CUDA);
+  EXPECT_EQ(array.array.length, 4);
+  EXPECT_EQ(array.array.children[0]->null_count, 1);
+
+  // the buffers are the column's own device memory
+  auto const& exported_ints = *array.array.children[0];
+  EXPECT_EQ(exported_ints.buffers[0], input.column(0).null_mask());
+  EXPECT_EQ(exported_ints.buffers[1], input.column(0).head());
+  auto const& exported_strings = *array.array.children[1];
+  EXPECT_EQ(exported_strings.n_buffers, 3);
+  EXPECT_EQ(exported_strings.buffers[2], input.column(1).child(1).head());
+
+  auto const result = cudf::from_arrow_device(&schema, &array);
+  expect_tables_equal(input, result);
+  EXPECT_EQ(result.column(1).child(1).head(), input.column(1).child(1).head());
+
+  schema.release(&schema);
+  array.array.release(&array.array);
+  EXPECT_EQ(schema.release, nullptr);
+  EXPECT_EQ(array.array.release, nullptr);
+}
+
+TEST_F(ArrowDeviceTest, SlicedColumns)
+{
+  fixed_width_column_wrapper<double> doubles({1., 2., 3., 4., 5.}, {1, 1, 0, 1, 1});
+  strings_column_wrapper strings({"a", "bb", "ccc", "", "ee"}, {0, 1, 1, 1, 1});
+  cudf::table_view input{{doubles, strings}};
+  auto const sliced = cudf::slice(input, {1, 4}).front();
+
+  ArrowSchema schema;
+  ArrowDeviceArray array;
+  cudf::to_arrow_device(sliced, &schema, &array);
+  EXPECT_EQ(array.array.length, 3);
+  EXPECT_EQ(array.array.children[0]->offset, 1);
+  EXPECT_EQ(array.array.children[1]->offset, 1);
+
+  expect_tables_equal(sliced, cudf::from_arrow_device(&schema, &array));
+  schema.release(&schema);
+  array.array.release(&array.array);
+}
+
+TEST_F(ArrowDeviceTest, EmptyTable)
+{
+  strings_column_wrapper strings{};
+  cudf::table_view input{{strings}};
+
+  ArrowSchema schema;
+  ArrowDeviceArray array;
+  cudf::to_arrow_device(input, &schema, &array);
+  auto const result = cudf::from_arrow_device(&schema, &array);
+  EXPECT_EQ(result.num_columns(), 1);
+  EXPECT_EQ(result.num_rows(), 0);
+  schema.release(&schema);
+  array.array.release(&array.array);
+}
+
+TEST_F(ArrowDeviceTest, ErrorTest)
+{
+  fixed_width_column_wrapper<int32_t> ints{1, 2};
+  fixed_width_column_wrapper<bool> bools{1, 0};
+  ArrowSchema schema;
+  ArrowDeviceArray array;
+  // Arrow booleans are bits
+  EXPECT_THROW(cudf::to_arrow_device(cudf::table_view{{ints, bools}}, &schema, &array),
+               cudf::logic_error);
+
+  cudf::to_arrow_device(cudf::table_view{{ints}}, &schema, &array);
+  array.device_type = ARROW_DEVICE_CPU;
+  EXPECT_THROW(cudf::from_arrow_device(&schema, &array), cudf::logic_error);
+  schema.release(&schema);
+  array.array.release(&array.array);
+}
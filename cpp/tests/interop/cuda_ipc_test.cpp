@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/cuda_ipc.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+using namespace cudf::test;
+
+struct CudaIpcTest : public BaseFixture {
+};
+
+TEST_F(CudaIpcTest, EmptyTableRoundTrip)
+{
+  // Columns without device memory can be imported in the exporting process
+  fixed_width_column_wrapper<int32_t> ints{};
+  cudf::column_view doubles{cudf::data_type{cudf::type_id::FLOAT64}, 0, nullptr};
+  cudf::table_view input{{ints, doubles}};
+
+  auto const metadata = cudf::export_ipc(input);
+  auto imported       = cudf::import_ipc(metadata);
+  EXPECT_EQ(imported->view().num_columns(), 2);
+  expect_tables_equal(input, imported->view());
+}
+
+TEST_F(CudaIpcTest, ImportInExportingProcess)
+{
+  fixed_width_column_wrapper<int32_t> ints({1, 2, 3, 4}, {1, 0, 1, 1});
+  strings_column_wrapper strings({"a", "", "bcd", "ef"});
+  cudf::table_view input{{ints, strings}};
+
+  // The allocations can only be opened by another process
+  auto const metadata = cudf::export_ipc(input);
+  EXPECT_THROW(cudf::import_ipc(metadata), cudf::cuda_error);
+}
+
+TEST_F(CudaIpcTest, InvalidMetadata)
+{
+  fixed_width_column_wrapper<int32_t> ints({1, 2, 3, 4});
+  auto metadata = cudf::export_ipc(cudf::table_view{{ints}});
+
+  auto truncated = metadata;
+  truncated.pop_back();
+  EXPECT_THROW(cudf::import_ipc(truncated), cudf::logic_error);
+
+  auto corrupted = metadata;
+  corrupted.front() ^= 1;
+  EXPECT_THROW(cudf::import_ipc(corrupted), cudf::logic_error);
+}
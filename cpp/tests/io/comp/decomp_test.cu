@@ -14,9 +14,15 @@
  * limitations under the License.
  */
 
+#include <cudf/copying.hpp>
+#include <cudf/io/compression.hpp>
 #include <io/comp/gpuinflate.h>
+#include <io/comp/io_uncomp.h>
 #include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
 
+#include <random>
+#include <string>
 #include <vector>
 
 #include <rmm/thrust_rmm_allocator.h>
@@ -123,6 +129,36 @@ struct BrotliDecompressTest : public DecompressTest<BrotliDecompressTest> {
   }
 };
 
+/**
+ * @brief Derived fixture for ZSTD decompression
+ **/
+struct ZstdDecompressTest : public DecompressTest<ZstdDecompressTest> {
+  cudaError_t dispatch()
+  {
+    return cudf::io::gpu_unzstd(d_inf_args.data().get(), d_inf_stat.data().get(), 1);
+  }
+};
+
+/**
+ * @brief Derived fixture for LZ4 decompression
+ **/
+struct Lz4DecompressTest : public DecompressTest<Lz4DecompressTest> {
+  cudaError_t dispatch()
+  {
+    return cudf::io::gpu_unlz4(d_inf_args.data().get(), d_inf_stat.data().get(), 1, 0);
+  }
+};
+
+/**
+ * @brief Derived fixture for Hadoop-framed LZ4 decompression
+ **/
+struct Lz4HadoopDecompressTest : public DecompressTest<Lz4HadoopDecompressTest> {
+  cudaError_t dispatch()
+  {
+    return cudf::io::gpu_unlz4(d_inf_args.data().get(), d_inf_stat.data().get(), 1, 1);
+  }
+};
+
 TEST_F(GzipDecompressTest, HelloWorld)
 {
   constexpr char uncompressed[]  = "hello world";
@@ -171,4 +207,222 @@ TEST_F(BrotliDecompressTest, HelloWorld)
   EXPECT_EQ(output, input);
 }
 
+TEST_F(ZstdDecompressTest, HelloWorld)
+{
+  constexpr char uncompressed[]  = "hello world";
+  constexpr uint8_t compressed[] = {0x28, 0xb5, 0x2f, 0xfd, 0x0,  0x58, 0x59, 0x0, 0x0,  0x68,
+                                    0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+TEST_F(ZstdDecompressTest, RepeatedBytes)
+{
+  constexpr char uncompressed[]  = "Aaaaaaaaaaaah!";
+  constexpr uint8_t compressed[] = {0x28, 0xb5, 0x2f, 0xfd, 0x0,  0x58, 0x55, 0x0,  0x0, 0x20,
+                                    0x41, 0x61, 0x68, 0x21, 0x1,  0x0,  0x1b, 0xc0, 0x2};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+TEST_F(Lz4DecompressTest, HelloWorld)
+{
+  constexpr char uncompressed[]  = "hello world";
+  constexpr uint8_t compressed[] = {
+    0xb0, 0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+TEST_F(Lz4DecompressTest, RepeatedBytes)
+{
+  constexpr char uncompressed[]  = "Aaaaaaaaaaaah!";
+  constexpr uint8_t compressed[] = {
+    0x21, 'A', 'a', 0x1, 0x0, 0x70, 'a', 'a', 'a', 'a', 'a', 'h', '!'};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+TEST_F(Lz4HadoopDecompressTest, RepeatedBytes)
+{
+  constexpr char uncompressed[]  = "Aaaaaaaaaaaah!";
+  constexpr uint8_t compressed[] = {0x0, 0x0, 0x0, 14,  0x0, 0x0, 0x0, 13,  0x21, 'A', 'a',
+                                    0x1, 0x0, 0x70, 'a', 'a', 'a', 'a', 'a', 'h',  '!'};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+TEST_F(Lz4HadoopDecompressTest, RawBlockFallback)
+{
+  constexpr char uncompressed[]  = "hello world";
+  constexpr uint8_t compressed[] = {
+    0xb0, 0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+/**
+ * @brief Test fixture for the chunked compression of device buffers
+ **/
+struct BufferCompressionTest : public cudf::test::BaseFixture {
+  void RoundTrip(std::vector<uint8_t> const& data)
+  {
+    for (auto type : {cudf::io::compression_type::SNAPPY,
+                      cudf::io::compression_type::ZSTD,
+                      cudf::io::compression_type::LZ4}) {
+      RoundTrip(type, rmm::device_buffer(data.data(), data.size()), data.size() / 2);
+    }
+  }
+
+  void RoundTrip(cudf::io::compression_type type,
+                 rmm::device_buffer const& input,
+                 size_t max_compressed_size)
+  {
+    auto compressed = cudf::io::compress_buffer(type, input);
+    EXPECT_LE(compressed->size(), max_compressed_size);
+    auto decompressed = cudf::io::decompress_buffer(type, *compressed);
+    ASSERT_EQ(decompressed->size(), input.size());
+
+    std::vector<uint8_t> expected(input.size());
+    std::vector<uint8_t> result(input.size());
+    ASSERT_CUDA_SUCCEEDED(
+      cudaMemcpy(expected.data(), input.data(), input.size(), cudaMemcpyDeviceToHost));
+    ASSERT_CUDA_SUCCEEDED(cudaMemcpy(
+      result.data(), decompressed->data(), decompressed->size(), cudaMemcpyDeviceToHost));
+    EXPECT_EQ(result, expected);
+  }
+};
+
+TEST_F(BufferCompressionTest, Repetitive)
+{
+  std::vector<uint8_t> data(300000);
+  for (size_t i = 0; i < data.size(); i++) { data[i] = (i % 1000) * 7 / 13; }
+  RoundTrip(data);
+}
+
+TEST_F(BufferCompressionTest, Incompressible)
+{
+  std::mt19937 engine(1);
+  std::vector<uint8_t> data(200001);
+  for (auto& val : data) { val = engine(); }
+  // Chunks are stored as is, with the header as the only overhead
+  for (auto type : {cudf::io::compression_type::SNAPPY,
+                    cudf::io::compression_type::ZSTD,
+                    cudf::io::compression_type::LZ4}) {
+    RoundTrip(type, rmm::device_buffer(data.data(), data.size()), data.size() + 64);
+  }
+}
+
+TEST_F(BufferCompressionTest, Empty)
+{
+  for (auto type : {cudf::io::compression_type::SNAPPY,
+                    cudf::io::compression_type::ZSTD,
+                    cudf::io::compression_type::LZ4}) {
+    RoundTrip(type, rmm::device_buffer{}, 64);
+  }
+}
+
+TEST_F(BufferCompressionTest, ContiguousSplit)
+{
+  auto sequence = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i / 4; });
+  auto valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  cudf::test::fixed_width_column_wrapper<int32_t> col0(sequence, sequence + 100000, valids);
+  cudf::test::fixed_width_column_wrapper<double> col1(sequence, sequence + 100000);
+  cudf::table_view input({col0, col1});
+
+  auto result = cudf::contiguous_split(input, {50000});
+  ASSERT_EQ(result.size(), 2u);
+  for (auto const& split : result) {
+    RoundTrip(cudf::io::compression_type::LZ4, *split.all_data, split.all_data->size() * 3 / 4);
+  }
+}
+
+TEST_F(BufferCompressionTest, UnsupportedType)
+{
+  rmm::device_buffer input(100);
+  EXPECT_THROW(cudf::io::compress_buffer(cudf::io::compression_type::GZIP, input),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::io::decompress_buffer(cudf::io::compression_type::GZIP, input),
+               cudf::logic_error);
+}
+
+/**
+ * @brief Test fixture for the host decompression of whole files
+ **/
+struct HostDecompressTest : public cudf::test::BaseFixture {
+  std::vector<char> Decompress(const uint8_t* compressed, size_t compressed_size, int stream_type)
+  {
+    std::vector<char> output;
+    cudf::io::io_uncompress_single_h2d(compressed, compressed_size, stream_type, output);
+    return output;
+  }
+};
+
+TEST_F(HostDecompressTest, GzipMembers)
+{
+  // Two concatenated gzip files, each with one member
+  constexpr uint8_t compressed[] = {0x1f, 0x8b, 0x8,  0x0,  0x0,  0x0,  0x0,  0x0,  0x2,  0x3,
+                                    0xcb, 0x48, 0xcd, 0xc9, 0xc9, 0x57, 0x0,  0x0,  0xf6, 0xf9,
+                                    0x81, 0xed, 0x6,  0x0,  0x0,  0x0,  0x1f, 0x8b, 0x8,  0x0,
+                                    0x0,  0x0,  0x0,  0x0,  0x2,  0x3,  0x2b, 0xcf, 0x2f, 0xca,
+                                    0x49, 0x1,  0x0,  0x43, 0x11, 0x77, 0x3a, 0x5,  0x0,  0x0,
+                                    0x0};
+
+  auto output = Decompress(compressed, sizeof(compressed), cudf::io::IO_UNCOMP_STREAM_TYPE_GZIP);
+  EXPECT_EQ(std::string(output.begin(), output.end()), "hello world");
+}
+
+TEST_F(HostDecompressTest, Bzip2Blocks)
+{
+  // bzip2 -1 of 60000 "a,b,c" lines, stored as four blocks
+  constexpr uint8_t compressed[] = {0x42, 0x5a, 0x68, 0x31, 0x31, 0x41, 0x59, 0x26, 0x53, 0x59,
+                                    0x82, 0xb0, 0xb5, 0x33, 0x0,  0x61, 0xa3, 0x51, 0x0,  0x0,
+                                    0x10, 0x0,  0x4,  0x38, 0x0,  0x20, 0x0,  0x50, 0x66, 0x80,
+                                    0x29, 0x51, 0x8d, 0xa9, 0x8,  0x18, 0x28, 0x40, 0xd1, 0x42,
+                                    0x6,  0x54, 0x84, 0xd,  0xaa, 0x42, 0x7,  0x18, 0xa0, 0xac,
+                                    0x93, 0x29, 0xac, 0x8f, 0x1,  0xe9, 0x4,  0x0,  0x30, 0xd1,
+                                    0xa8, 0x80, 0x0,  0x8,  0x0,  0x2,  0x1c, 0x0,  0x10, 0x0,
+                                    0x28, 0x33, 0x40, 0x14, 0xa8, 0xc6, 0x8a, 0x10, 0x32, 0xa4,
+                                    0x20, 0x6d, 0x48, 0x40, 0xc1, 0x42, 0x6,  0xd5, 0x21, 0x3,
+                                    0x8c, 0x50, 0x56, 0x49, 0x94, 0xd6, 0x60, 0xac, 0x2d, 0x4c,
+                                    0xc0, 0x18, 0x68, 0xd4, 0x40, 0x0,  0x4,  0x0,  0x1,  0xe,
+                                    0x0,  0x8,  0x0,  0x14, 0x19, 0xa0, 0xa,  0x54, 0x63, 0x6a,
+                                    0x42, 0x6,  0xa,  0x10, 0x34, 0x50, 0x81, 0x95, 0x21, 0x3,
+                                    0x6a, 0x90, 0x81, 0xc6, 0x28, 0x2b, 0x24, 0xca, 0x6b, 0x20,
+                                    0x6b, 0xaa, 0x90, 0xa0, 0x7,  0x54, 0xca, 0x20, 0x0,  0x2,
+                                    0x0,  0x0,  0x87, 0x0,  0x4,  0x0,  0xa,  0xc,  0xd0, 0x5,
+                                    0x2a, 0x31, 0xa9, 0x42, 0xa3, 0x22, 0x85, 0x46, 0xc5, 0xa,
+                                    0x8c, 0x4a, 0x15, 0x1b, 0x45, 0xa,  0x8e, 0x17, 0x72, 0x45,
+                                    0x38, 0x50, 0x90, 0x6b, 0xb6, 0xdf, 0x5e};
+
+  std::string expected;
+  for (int i = 0; i < 60000; i++) { expected += "a,b,c\n"; }
+  auto output = Decompress(compressed, sizeof(compressed), cudf::io::IO_UNCOMP_STREAM_TYPE_BZIP2);
+  EXPECT_EQ(std::string(output.begin(), output.end()), expected);
+
+  // Concatenated streams, as written by pbzip2
+  std::vector<uint8_t> streams(compressed, compressed + sizeof(compressed));
+  streams.insert(streams.end(), compressed, compressed + sizeof(compressed));
+  output = Decompress(streams.data(), streams.size(), cudf::io::IO_UNCOMP_STREAM_TYPE_BZIP2);
+  EXPECT_EQ(std::string(output.begin(), output.end()), expected + expected);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -21,6 +21,8 @@
 #include <tests/utilities/table_utilities.hpp>
 #include <tests/utilities/type_lists.hpp>
 
+#include <cudf/concatenate.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/functions.hpp>
 #include <cudf/strings/string_view.cuh>
@@ -403,6 +405,30 @@ TEST_F(CsvReaderTest, Dates)
                            view.column(0));
 }
 
+TEST_F(CsvReaderTest, DatesISO)
+{
+  auto filepath = temp_env->get_temp_dir() + "DatesISO.csv";
+  {
+    std::ofstream outfile(filepath, std::ofstream::out);
+    outfile << "2001-03-05\n2010-10-31T12:34:56\n1994-10-20 01:02:03.400\n";
+    outfile << "1970-01-01T00:00:00.000\n2006-06-07 11:20:30.4\n";
+  }
+
+  cudf_io::read_csv_args in_args{cudf_io::source_info{filepath}};
+  in_args.names  = {"A"};
+  in_args.dtype  = {"date"};
+  in_args.header = -1;
+  auto result    = cudf_io::read_csv(in_args);
+
+  const auto view = result.tbl->view();
+  EXPECT_EQ(1, view.num_columns());
+  ASSERT_EQ(cudf::type_id::TIMESTAMP_MILLISECONDS, view.column(0).type().id());
+
+  expect_column_data_equal(
+    std::vector<cudf::timestamp_ms>{983750400000, 1288528496000, 782614923400, 0, 1149679230004},
+    view.column(0));
+}
+
 TEST_F(CsvReaderTest, DatesCastToTimestampSeconds)
 {
   auto filepath = temp_env->get_temp_dir() + "DatesCastToTimestampS.csv";
@@ -628,6 +654,33 @@ TEST_F(CsvReaderTest, StringsQuotes)
     std::vector<std::string>{"abc,\ndef, ghi", "jkl, `mno`, pqr", "stu `vwx` yz"}, view.column(1));
 }
 
+TEST_F(CsvReaderTest, Category)
+{
+  std::vector<std::string> names{"id", "color"};
+
+  auto filepath = temp_env->get_temp_dir() + "Category.csv";
+  {
+    std::ofstream outfile(filepath, std::ofstream::out);
+    outfile << "1,red\n2,blue\n3,red\n4,green\n5,blue\n";
+  }
+
+  cudf_io::read_csv_args in_args{cudf_io::source_info{filepath}};
+  in_args.names  = names;
+  in_args.header = -1;
+  in_args.dtype  = {"id:int32", "color:category"};
+  auto result    = cudf_io::read_csv(in_args);
+
+  const auto view = result.tbl->view();
+  EXPECT_EQ(2, view.num_columns());
+  ASSERT_EQ(cudf::type_id::INT32, view.column(0).type().id());
+  ASSERT_EQ(cudf::type_id::DICTIONARY32, view.column(1).type().id());
+
+  cudf::dictionary_column_view dictionary(view.column(1));
+  expect_column_data_equal(std::vector<std::string>{"blue", "green", "red"}, dictionary.keys());
+  cudf::test::expect_columns_equal(dictionary.indices(),
+                                   cudf::test::fixed_width_column_wrapper<int32_t>{2, 0, 2, 1, 0});
+}
+
 TEST_F(CsvReaderTest, StringsQuotesIgnored)
 {
   std::vector<std::string> names{"line", "verse"};
@@ -1161,4 +1214,150 @@ TEST_F(CsvReaderTest, UserImplementedSource)
   expect_column_data_equal(int32_values, view.column(2));
 }
 
+TEST_F(CsvReaderTest, DtypeSampleRows)
+{
+  auto filepath = temp_env->get_temp_dir() + "DtypeSampleRows.csv";
+  {
+    std::ofstream outfile(filepath, std::ofstream::out);
+    outfile << "A,B,C,D\n";
+    for (int i = 0; i < 1000; ++i) {
+      outfile << i << "," << i * 0.25 << ",str" << i << "," << ((i % 3) ? "true" : "false")
+              << "\n";
+    }
+  }
+
+  cudf_io::read_csv_args in_args{cudf_io::source_info{filepath}};
+  auto expected = cudf_io::read_csv(in_args);
+
+  for (cudf::size_type sample_rows : {1, 7, 100, 5000}) {
+    in_args.dtype_sample_rows = sample_rows;
+    auto result               = cudf_io::read_csv(in_args);
+    cudf::test::expect_tables_equal(*result.tbl, *expected.tbl);
+  }
+  const auto view = expected.tbl->view();
+  EXPECT_EQ(cudf::type_id::INT64, view.column(0).type().id());
+  EXPECT_EQ(cudf::type_id::FLOAT64, view.column(1).type().id());
+  EXPECT_EQ(cudf::type_id::STRING, view.column(2).type().id());
+  EXPECT_EQ(cudf::type_id::BOOL8, view.column(3).type().id());
+}
+
+TEST_F(CsvReaderTest, MultipleSources)
+{
+  auto const write_file = [](std::string const& filename, std::string const& contents) {
+    auto filepath = temp_env->get_temp_dir() + filename;
+    std::ofstream outfile(filepath, std::ofstream::out);
+    outfile << contents;
+    return filepath;
+  };
+  // Every source has its own header; the sources don't all end with a line terminator
+  std::vector<std::string> filepaths{write_file("MultipleSources1.csv", "id,name\n1,a\n2,b"),
+                                     write_file("MultipleSources2.csv", ""),
+                                     write_file("MultipleSources3.csv", "id,name\n\n3,c\n"),
+                                     write_file("MultipleSources4.csv", "id,name\n"),
+                                     write_file("MultipleSources5.csv", "id,name\n4,d\n5,e\n")};
+  auto const joint_file =
+    write_file("MultipleSources.csv", "id,name\n1,a\n2,b\n3,c\n4,d\n5,e\n");
+
+  cudf_io::read_csv_args in_args{cudf_io::source_info{filepaths}};
+  auto result   = cudf_io::read_csv(in_args);
+  auto expected = cudf_io::read_csv(cudf_io::read_csv_args{cudf_io::source_info{joint_file}});
+  ASSERT_EQ(5, result.tbl->num_rows());
+  cudf::test::expect_tables_equal(*result.tbl, *expected.tbl);
+  EXPECT_EQ(result.metadata.column_names, expected.metadata.column_names);
+
+  in_args.header = -1;
+  in_args.names  = {"id", "name"};
+  result         = cudf_io::read_csv(in_args);
+  EXPECT_EQ(9, result.tbl->num_rows());
+
+  in_args.nrows = 2;
+  EXPECT_THROW(cudf_io::read_csv(in_args), cudf::logic_error);
+  in_args.nrows = -1;
+  EXPECT_THROW(cudf_io::chunked_csv_reader(in_args, 10).read_chunk(), cudf::logic_error);
+}
+
+namespace {
+std::vector<std::unique_ptr<table>> read_csv_chunks(cudf_io::read_csv_args const& args,
+                                                    size_t chunk_size)
+{
+  cudf_io::chunked_csv_reader reader(args, chunk_size);
+  std::vector<std::unique_ptr<table>> chunks;
+  while (reader.has_next()) { chunks.push_back(std::move(reader.read_chunk().tbl)); }
+  EXPECT_THROW(reader.read_chunk(), cudf::logic_error);
+  return chunks;
+}
+
+std::unique_ptr<table> concatenate_chunks(std::vector<std::unique_ptr<table>> const& chunks)
+{
+  std::vector<table_view> views;
+  for (auto const& chunk : chunks) { views.push_back(*chunk); }
+  return cudf::concatenate(views);
+}
+}  // namespace
+
+TEST_F(CsvReaderTest, ChunkedRead)
+{
+  auto filepath = temp_env->get_temp_dir() + "ChunkedRead.csv";
+  {
+    std::ofstream outfile(filepath, std::ofstream::out);
+    outfile << "id,text,value\n";
+    for (int i = 0; i < 2000; ++i) {
+      // Quoted fields with line terminators and blank lines straddle some chunk boundaries
+      outfile << i << ",";
+      if (i % 7 == 0) {
+        outfile << "\"multi\nline, " << i << "\"";
+      } else {
+        outfile << "text" << i;
+      }
+      outfile << "," << i * 0.5 << "\n";
+      if (i % 13 == 0) { outfile << "\n"; }
+    }
+  }
+
+  cudf_io::read_csv_args in_args{cudf_io::source_info{filepath}};
+  auto expected = cudf_io::read_csv(in_args);
+  ASSERT_EQ(2000, expected.tbl->num_rows());
+
+  auto chunks = read_csv_chunks(in_args, 0);
+  ASSERT_EQ(chunks.size(), 1u);
+  cudf::test::expect_tables_equal(*chunks[0], *expected.tbl);
+
+  for (size_t chunk_size : {100, 1000, 7777}) {
+    chunks = read_csv_chunks(in_args, chunk_size);
+    EXPECT_GT(chunks.size(), 1u);
+    cudf::test::expect_tables_equal(*concatenate_chunks(chunks), *expected.tbl);
+  }
+}
+
+TEST_F(CsvReaderTest, ChunkedReadLongRows)
+{
+  // Rows longer than the data loaded past the end of the chunk
+  std::string data;
+  std::vector<std::string> values;
+  for (int i = 0; i < 20; ++i) {
+    values.push_back(std::string(1000 * (i % 5) + 1, 'a' + i));
+    data += values.back() + "\n";
+  }
+
+  cudf_io::read_csv_args in_args{cudf_io::source_info{data.c_str(), data.size()}};
+  in_args.names  = {"A"};
+  in_args.dtype  = {"str"};
+  in_args.header = -1;
+  auto chunks    = read_csv_chunks(in_args, 500);
+  EXPECT_GT(chunks.size(), 1u);
+  auto result = concatenate_chunks(chunks);
+  expect_column_data_equal(values, result->get_column(0));
+}
+
+TEST_F(CsvReaderTest, ChunkedReadRowSelection)
+{
+  std::string data = "1\n2\n3\n";
+  cudf_io::read_csv_args in_args{cudf_io::source_info{data.c_str(), data.size()}};
+  in_args.nrows = 2;
+  EXPECT_THROW(cudf_io::chunked_csv_reader(in_args, 2), cudf::logic_error);
+  in_args.nrows             = -1;
+  in_args.byte_range_offset = 2;
+  EXPECT_THROW(cudf_io::chunked_csv_reader(in_args, 2), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
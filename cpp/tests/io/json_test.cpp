@@ -20,7 +20,9 @@
 #include <tests/utilities/cudf_gtest.hpp>
 #include <tests/utilities/type_lists.hpp>
 
+#include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/io/functions.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
@@ -31,6 +33,7 @@
 #include <arrow/io/api.h>
 
 #include <fstream>
+#include <limits>
 
 #include <type_traits>
 
@@ -180,6 +183,27 @@ TEST_F(JsonReaderTest, JsonLinesStrings)
                                    cudf::test::strings_column_wrapper({"aa ", "  bbb"}));
 }
 
+TEST_F(JsonReaderTest, JsonLinesCategory)
+{
+  std::string data = "[1, \"red\"]\n[2, \"blue\"]\n[3, \"red\"]\n[4, \"green\"]\n[5, \"red\"]";
+
+  cudf_io::read_json_args in_args{cudf_io::source_info{data.data(), data.size()}};
+  in_args.lines = true;
+  in_args.dtype = {"int", "category"};
+
+  cudf_io::table_with_metadata result = cudf_io::read_json(in_args);
+
+  EXPECT_EQ(result.tbl->num_columns(), 2);
+  EXPECT_EQ(result.tbl->get_column(0).type().id(), cudf::type_id::INT32);
+  EXPECT_EQ(result.tbl->get_column(1).type().id(), cudf::type_id::DICTIONARY32);
+
+  cudf::dictionary_column_view dictionary(result.tbl->get_column(1));
+  cudf::test::expect_columns_equal(dictionary.keys(),
+                                   cudf::test::strings_column_wrapper({"blue", "green", "red"}));
+  cudf::test::expect_columns_equal(dictionary.indices(),
+                                   cudf::test::fixed_width_column_wrapper<int32_t>{2, 0, 2, 1, 2});
+}
+
 TEST_F(JsonReaderTest, MultiColumn)
 {
   constexpr auto num_rows = 10;
@@ -371,6 +395,88 @@ TEST_F(JsonReaderTest, JsonLinesFileInput)
                                    float64_wrapper{{1.1, 2.2}, validity});
 }
 
+TEST_F(JsonReaderTest, JsonLinesMultipleFileInputs)
+{
+  const std::string file1 = temp_env->get_temp_dir() + "JsonLinesFileTest1.json";
+  std::ofstream outfile(file1, std::ofstream::out);
+  outfile << "[11, 1.1]\n[22, 2.2]";
+  outfile.close();
+
+  const std::string file2 = temp_env->get_temp_dir() + "JsonLinesFileTest2.json";
+  std::ofstream outfile2(file2, std::ofstream::out);
+  outfile2 << "[33, 3.3]\n[44, 4.4]\n";
+  outfile2.close();
+
+  const std::string file3 = temp_env->get_temp_dir() + "JsonLinesFileTest3.json";
+  std::ofstream outfile3(file3, std::ofstream::out);
+  outfile3.close();
+
+  cudf_io::read_json_args in_args{cudf_io::source_info{{file1, file3, file2}}};
+  in_args.lines = true;
+
+  cudf_io::table_with_metadata result = cudf_io::read_json(in_args);
+
+  EXPECT_EQ(result.tbl->num_columns(), 2);
+  EXPECT_EQ(result.tbl->num_rows(), 4);
+
+  EXPECT_EQ(result.tbl->get_column(0).type().id(), cudf::type_id::INT64);
+  EXPECT_EQ(result.tbl->get_column(1).type().id(), cudf::type_id::FLOAT64);
+
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return true; });
+
+  cudf::test::expect_columns_equal(result.tbl->get_column(0),
+                                   int64_wrapper{{11, 22, 33, 44}, validity});
+  cudf::test::expect_columns_equal(result.tbl->get_column(1),
+                                   float64_wrapper{{1.1, 2.2, 3.3, 4.4}, validity});
+
+  in_args.byte_range_size = 10;
+  EXPECT_THROW(cudf_io::read_json(in_args), cudf::logic_error);
+}
+
+TEST_F(JsonReaderTest, JsonLinesNestedValues)
+{
+  std::string data =
+    "{\"a\": [1, 2, 3], \"b\": 1.5, \"c\": {\"x\": 1, \"y\": [1, 2]}, \"d\": [\"s\", null]}\n"
+    "{\"a\": [], \"b\": 2.5, \"c\": {\"x\": 2}, \"d\": [\"t\"]}\n"
+    "{\"a\": null, \"b\": 3.5, \"c\": null, \"d\": []}\n"
+    "{\"a\": [ 4 ], \"b\": 4.5, \"c\": {\"x\": 3}, \"d\": [\"u, v\"]}\n";
+  cudf_io::read_json_args in_args{cudf_io::source_info{data.c_str(), data.size()}};
+  in_args.lines = true;
+
+  cudf_io::table_with_metadata result = cudf_io::read_json(in_args);
+
+  ASSERT_EQ(result.tbl->num_columns(), 4);
+  EXPECT_EQ(result.tbl->num_rows(), 4);
+  EXPECT_EQ(result.metadata.column_names, std::vector<std::string>({"a", "b", "c", "d"}));
+
+  EXPECT_EQ(result.tbl->get_column(0).type().id(), cudf::type_id::LIST);
+  EXPECT_EQ(result.tbl->get_column(1).type().id(), cudf::type_id::FLOAT64);
+  EXPECT_EQ(result.tbl->get_column(2).type().id(), cudf::type_id::STRING);
+  EXPECT_EQ(result.tbl->get_column(3).type().id(), cudf::type_id::LIST);
+
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return true; });
+
+  cudf::lists_column_view a(result.tbl->get_column(0));
+  EXPECT_EQ(a.null_count(), 1);
+  cudf::test::expect_columns_equivalent(a.offsets(), int_wrapper{0, 3, 3, 3, 4});
+  cudf::test::expect_columns_equivalent(a.child(), int64_wrapper{1, 2, 3, 4});
+
+  cudf::test::expect_columns_equal(result.tbl->get_column(1),
+                                   float64_wrapper{{1.5, 2.5, 3.5, 4.5}, validity});
+
+  // Nested objects are read as strings
+  cudf::test::expect_columns_equal(
+    result.tbl->get_column(2),
+    cudf::test::strings_column_wrapper(
+      {"{\"x\": 1, \"y\": [1, 2]}", "{\"x\": 2}", "", "{\"x\": 3}"}, {1, 1, 0, 1}));
+
+  cudf::lists_column_view d(result.tbl->get_column(3));
+  EXPECT_EQ(d.null_count(), 0);
+  cudf::test::expect_columns_equivalent(d.offsets(), int_wrapper{0, 2, 3, 3, 4});
+  cudf::test::expect_columns_equivalent(
+    d.child(), cudf::test::strings_column_wrapper({"s", "", "t", "u, v"}, {1, 0, 1, 1}));
+}
+
 TEST_F(JsonReaderTest, JsonLinesByteRange)
 {
   const std::string fname = temp_env->get_temp_dir() + "JsonLinesByteRangeTest.json";
@@ -546,4 +652,65 @@ TEST_F(JsonReaderTest, StringInference)
   EXPECT_EQ(result.tbl->get_column(0).type().id(), cudf::type_id::STRING);
 }
 
+/**
+ * @brief Base test fixture for JSON writer tests
+ **/
+struct JsonWriterTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(JsonWriterTest, Lines)
+{
+  int_wrapper a{{1, 2, 3}, {1, 0, 1}};
+  float64_wrapper b{1.5, std::numeric_limits<double>::quiet_NaN(), -0.25};
+  cudf::test::strings_column_wrapper c{"x\"y", "tab\t", "\x01"};
+  bool_wrapper d{true, false, true};
+  cudf::table_view table{{a, b, c, d}};
+  cudf_io::table_metadata metadata;
+  metadata.column_names = {"a", "b", "c", "d"};
+
+  std::vector<char> out;
+  cudf_io::write_json_args args{cudf_io::sink_info{&out}, table, &metadata};
+  cudf_io::write_json(args);
+
+  std::string const expected =
+    "{\"a\":1,\"b\":1.5,\"c\":\"x\\\"y\",\"d\":true}\n"
+    "{\"a\":null,\"b\":null,\"c\":\"tab\\t\",\"d\":false}\n"
+    "{\"a\":3,\"b\":-0.25,\"c\":\"\\u0001\",\"d\":true}\n";
+  EXPECT_EQ(std::string(out.begin(), out.end()), expected);
+}
+
+TEST_F(JsonWriterTest, RecordsWithoutNulls)
+{
+  int_wrapper a{{1, 2, 3}, {1, 0, 1}};
+  cudf::test::strings_column_wrapper b{{"p", "q", "r"}, {1, 1, 0}};
+  cudf::table_view table{{a, b}};
+  cudf_io::table_metadata metadata;
+  metadata.column_names = {"a", "b"};
+
+  std::vector<char> out;
+  cudf_io::write_json_args args{cudf_io::sink_info{&out}, table, &metadata, false};
+  args.include_nulls  = false;
+  args.rows_per_chunk = 1;
+  cudf_io::write_json(args);
+
+  EXPECT_EQ(std::string(out.begin(), out.end()),
+            "[{\"a\":1,\"b\":\"p\"},{\"b\":\"q\"},{\"a\":3}]");
+}
+
+TEST_F(JsonWriterTest, NestedLists)
+{
+  cudf::test::lists_column_wrapper<int> a{{{1, 2}, {3, 4}}, {{5, 6, 7}, {0}, {8}}, {{9, 10}}};
+  cudf::test::lists_column_wrapper<cudf::string_view> b{{"p"}, {"q", "r"}, {"s"}};
+  cudf::table_view table{{a, b}};
+
+  std::vector<char> out;
+  cudf_io::write_json(cudf_io::write_json_args{cudf_io::sink_info{&out}, table});
+
+  std::string const expected =
+    "{\"0\":[[1,2],[3,4]],\"1\":[\"p\"]}\n"
+    "{\"0\":[[5,6,7],[0],[8]],\"1\":[\"q\",\"r\"]}\n"
+    "{\"0\":[[9,10]],\"1\":[\"s\"]}\n";
+  EXPECT_EQ(std::string(out.begin(), out.end()), expected);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -21,6 +21,8 @@
 #include <tests/utilities/type_lists.hpp>
 
 #include <cudf/concatenate.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/io/functions.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
@@ -398,6 +400,28 @@ TEST_F(OrcWriterTest, Strings)
   EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
 }
 
+TEST_F(OrcWriterTest, StringsWithNulls)
+{
+  // Null rows next to empty strings, so that the column is built from the decoded validity
+  constexpr auto num_rows = 3000;
+  auto strings            = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return i % 7 == 0 ? std::string{} : std::to_string(i % 100); });
+  auto validity =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 4 != 1; });
+  cudf::test::strings_column_wrapper col0(strings, strings + num_rows, validity);
+  auto expected = table_view{{col0}};
+
+  auto filepath = temp_env->get_temp_filepath("OrcStringsWithNulls.orc");
+  cudf_io::write_orc_args out_args{cudf_io::sink_info{filepath}, expected};
+  cudf_io::write_orc(out_args);
+
+  cudf_io::read_orc_args in_args{cudf_io::source_info{filepath}};
+  auto result = cudf_io::read_orc(in_args);
+
+  expect_tables_equal(expected, result.tbl->view());
+  EXPECT_EQ(num_rows / 4, result.tbl->get_column(0).null_count());
+}
+
 TEST_F(OrcWriterTest, HostBuffer)
 {
   constexpr auto num_rows = 100 << 10;
@@ -427,6 +451,144 @@ TEST_F(OrcWriterTest, HostBuffer)
   EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
 }
 
+TEST_F(OrcWriterTest, ZstdCompression)
+{
+  constexpr auto num_rows = 100 << 10;
+  auto values   = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 1000; });
+  auto strings  = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return "value_" + std::to_string(i % 250); });
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+
+  column_wrapper<int32_t> col0{values, values + num_rows, validity};
+  column_wrapper<double> col1{values, values + num_rows};
+  cudf::test::strings_column_wrapper col2{strings, strings + num_rows, validity};
+
+  cudf_io::table_metadata expected_metadata;
+  expected_metadata.column_names.emplace_back("int32s");
+  expected_metadata.column_names.emplace_back("doubles");
+  expected_metadata.column_names.emplace_back("strings");
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  cols.push_back(col2.release());
+  const auto expected = std::make_unique<table>(std::move(cols));
+
+  std::vector<char> out_buffer;
+  cudf_io::write_orc_args out_args{cudf_io::sink_info(&out_buffer),
+                                   expected->view(),
+                                   &expected_metadata,
+                                   cudf_io::compression_type::ZSTD};
+  cudf_io::write_orc(out_args);
+
+  cudf_io::read_orc_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+  in_args.use_index = false;
+  const auto result = cudf_io::read_orc(in_args);
+
+  expect_tables_equal(expected->view(), result.tbl->view());
+  EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
+}
+
+TEST_F(OrcWriterTest, Lz4Compression)
+{
+  constexpr auto num_rows = 100 << 10;
+  auto values   = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 1000; });
+  auto strings  = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return "value_" + std::to_string(i % 250); });
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+
+  column_wrapper<int32_t> col0{values, values + num_rows, validity};
+  column_wrapper<double> col1{values, values + num_rows};
+  cudf::test::strings_column_wrapper col2{strings, strings + num_rows, validity};
+
+  cudf_io::table_metadata expected_metadata;
+  expected_metadata.column_names.emplace_back("int32s");
+  expected_metadata.column_names.emplace_back("doubles");
+  expected_metadata.column_names.emplace_back("strings");
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  cols.push_back(col2.release());
+  const auto expected = std::make_unique<table>(std::move(cols));
+
+  std::vector<char> out_buffer;
+  cudf_io::write_orc_args out_args{cudf_io::sink_info(&out_buffer),
+                                   expected->view(),
+                                   &expected_metadata,
+                                   cudf_io::compression_type::LZ4};
+  cudf_io::write_orc(out_args);
+
+  cudf_io::read_orc_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+  in_args.use_index = false;
+  const auto result = cudf_io::read_orc(in_args);
+
+  expect_tables_equal(expected->view(), result.tbl->view());
+  EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
+}
+
+TEST_F(OrcWriterTest, MonotonicDeltaEncoding)
+{
+  constexpr auto num_rows = 100 << 10;
+  // Increasing and decreasing values with deltas that vary too much for runs of a fixed delta
+  auto increasing = cudf::test::make_counting_transform_iterator(0, [](auto i) {
+    return int64_t{1590000000000} + i * int64_t{1000} + (int64_t{i} * i * 7919) % 499;
+  });
+  auto decreasing = cudf::test::make_counting_transform_iterator(0, [](auto i) {
+    return static_cast<int32_t>(1000000000 - i * 50 - (int64_t{i} * i * 31) % 41);
+  });
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 97; });
+
+  column_wrapper<int64_t> col0{increasing, increasing + num_rows};
+  column_wrapper<int32_t> col1{decreasing, decreasing + num_rows, validity};
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  const auto expected = std::make_unique<table>(std::move(cols));
+
+  std::vector<char> out_buffer;
+  cudf_io::write_orc_args out_args{cudf_io::sink_info(&out_buffer),
+                                   expected->view(),
+                                   nullptr,
+                                   cudf_io::compression_type::NONE};
+  cudf_io::write_orc(out_args);
+
+  cudf_io::read_orc_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+  in_args.use_index = false;
+  const auto result = cudf_io::read_orc(in_args);
+  expect_tables_equal(expected->view(), result.tbl->view());
+
+  // The deltas take 2 and 1 bytes, against 3 and 2 bytes for the offsets of the values from the
+  // minimum of each run of 512
+  EXPECT_LT(out_buffer.size(), static_cast<size_t>(num_rows) * 4);
+}
+
+TEST_F(OrcWriterTest, BalancedStripes)
+{
+  constexpr auto num_rows = 100000;
+  auto values = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  column_wrapper<int32_t> col{values, values + num_rows};
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col.release());
+  const auto expected = std::make_unique<table>(std::move(cols));
+
+  // 10 rowgroups of 10000 rows, in at least 4 stripes of at most 3 rowgroups
+  std::vector<char> out_buffer;
+  cudf_io::write_orc_args out_args{cudf_io::sink_info(&out_buffer), expected->view()};
+  out_args.stripe_size_rows = 30000;
+  cudf_io::write_orc(out_args);
+
+  cudf_io::read_orc_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+  std::vector<cudf::size_type> stripe_rows;
+  for (cudf::size_type stripe = 0; stripe < 4; ++stripe) {
+    in_args.stripe_list = {stripe};
+    stripe_rows.push_back(cudf_io::read_orc(in_args).tbl->num_rows());
+  }
+  EXPECT_EQ(stripe_rows, (std::vector<cudf::size_type>{30000, 20000, 30000, 20000}));
+  in_args.stripe_list = {4};
+  EXPECT_THROW(cudf_io::read_orc(in_args), cudf::logic_error);
+}
+
 TEST_F(OrcChunkedWriterTest, SingleTable)
 {
   srand(31337);
@@ -545,6 +707,43 @@ TEST_F(OrcChunkedWriterTest, Strings)
   expect_tables_equal(*result.tbl, *expected);
 }
 
+TEST_F(OrcChunkedWriterTest, StringsToDictionary)
+{
+  std::vector<std::string> days1{"Monday", "Tuesday", "Friday", "Sunday"};
+  std::vector<std::string> days2{"Friday", "Wednesday", "Tuesday"};
+  auto strings1 =
+    cudf::test::make_counting_transform_iterator(0, [&](auto i) { return days1[i % 4]; });
+  auto strings2 =
+    cudf::test::make_counting_transform_iterator(0, [&](auto i) { return days2[i % 3]; });
+  auto valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 2; });
+  cudf::test::strings_column_wrapper col1(strings1, strings1 + 1000, valids);
+  cudf::test::strings_column_wrapper col2(strings2, strings2 + 1000, valids);
+  cudf::table_view table1({col1});
+  cudf::table_view table2({col2});
+
+  // Each stripe has its own dictionary; the last one is identical to the first
+  auto filepath = temp_env->get_temp_filepath("ChunkedStringsToDictionary.orc");
+  cudf_io::write_orc_chunked_args args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_orc_chunked_begin(args);
+  cudf_io::write_orc_chunked(table1, state);
+  cudf_io::write_orc_chunked(table2, state);
+  cudf_io::write_orc_chunked(table1, state);
+  cudf_io::write_orc_chunked_end(state);
+
+  cudf_io::read_orc_args read_args{cudf_io::source_info{filepath}};
+  read_args.strings_to_dictionary = true;
+  auto result                     = cudf_io::read_orc(read_args);
+
+  ASSERT_EQ(result.tbl->num_columns(), 1);
+  auto const dictionary = result.tbl->get_column(0).view();
+  EXPECT_EQ(dictionary.type().id(), cudf::type_id::DICTIONARY32);
+  EXPECT_EQ(cudf::dictionary_column_view(dictionary).keys_size(), 5);
+
+  auto expected = cudf::concatenate({table1, table2, table1});
+  auto decoded  = cudf::dictionary::decode(cudf::dictionary_column_view(dictionary));
+  cudf::test::expect_columns_equal(expected->get_column(0), decoded->view());
+}
+
 TEST_F(OrcChunkedWriterTest, MismatchedTypes)
 {
   srand(31337);
@@ -613,6 +812,93 @@ TEST_F(OrcChunkedWriterTest, ReadStripesError)
   EXPECT_THROW(cudf_io::read_orc(read_args), cudf::logic_error);
 }
 
+TEST_F(OrcChunkedWriterTest, ReadFilteredStripes)
+{
+  auto seq0 = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto seq1 = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i + 100; });
+  column_wrapper<int> col0(seq0, seq0 + 10);
+  column_wrapper<int> col1(seq1, seq1 + 10);
+  cudf::test::strings_column_wrapper str0({"a", "b", "c", "d", "e", "f", "g", "h", "i", "j"});
+  cudf::test::strings_column_wrapper str1({"p", "q", "r", "s", "t", "u", "v", "w", "x", "y"});
+  table_view table1({col0, str0});
+  table_view table2({col1, str1});
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedFilteredStripes.orc");
+  cudf_io::write_orc_chunked_args args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_orc_chunked_begin(args);
+  cudf_io::write_orc_chunked(table1, state);
+  cudf_io::write_orc_chunked(table2, state);
+  cudf_io::write_orc_chunked_end(state);
+
+  using cudf_io::column_predicate;
+  using cudf_io::predicate_op;
+  cudf_io::read_orc_args read_args{cudf_io::source_info{filepath}};
+
+  read_args.filters = {{column_predicate("_col0", predicate_op::GREATER_EQUAL, 100)}};
+  auto result       = cudf_io::read_orc(read_args);
+  expect_tables_equal(*result.tbl, table2);
+
+  read_args.filters = {{column_predicate("_col1", predicate_op::LESS, std::string("k"))}};
+  result            = cudf_io::read_orc(read_args);
+  expect_tables_equal(*result.tbl, table1);
+
+  // Row selection applies to the rows of the stripes that pass the filter
+  read_args.filters   = {{column_predicate("_col0", predicate_op::GREATER, 104)}};
+  read_args.skip_rows = 5;
+  result              = cudf_io::read_orc(read_args);
+  EXPECT_EQ(result.tbl->num_rows(), 5);
+  read_args.skip_rows = -1;
+
+  read_args.filters = {{column_predicate("_col0", predicate_op::EQUAL, 50)}};
+  result            = cudf_io::read_orc(read_args);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+
+  read_args.filters = {{column_predicate("missing", predicate_op::EQUAL, 0)}};
+  EXPECT_THROW(cudf_io::read_orc(read_args), cudf::logic_error);
+}
+
+TEST_F(OrcChunkedWriterTest, ReadPlannedPartitions)
+{
+  srand(31337);
+  auto table1 = create_random_fixed_table<int>(5, 5, true);
+  auto table2 = create_random_fixed_table<int>(5, 5, true);
+  auto table3 = create_random_fixed_table<int>(5, 5, true);
+
+  auto filepath1 = temp_env->get_temp_filepath("ChunkedPartitions1.orc");
+  auto filepath2 = temp_env->get_temp_filepath("ChunkedPartitions2.orc");
+  cudf_io::write_orc_chunked_args args1{cudf_io::sink_info{filepath1}};
+  auto state = cudf_io::write_orc_chunked_begin(args1);
+  cudf_io::write_orc_chunked(*table1, state);
+  cudf_io::write_orc_chunked(*table2, state);
+  cudf_io::write_orc_chunked_end(state);
+  cudf_io::write_orc_args args2{cudf_io::sink_info{filepath2}, table3->view()};
+  cudf_io::write_orc(args2);
+
+  auto full_table = cudf::concatenate({*table1, *table2, *table3});
+
+  std::vector<std::string> filepaths{filepath1, filepath2};
+  cudf_io::read_orc_args read_args{cudf_io::source_info{filepaths}};
+  for (int num_partitions : {1, 2, 5}) {
+    auto partitions = cudf_io::plan_orc_read(read_args, num_partitions);
+    ASSERT_EQ(partitions.size(), static_cast<size_t>(num_partitions));
+
+    std::vector<std::unique_ptr<cudf::table>> results;
+    std::vector<table_view> result_views;
+    size_t num_stripes = 0;
+    for (auto const& partition : partitions) {
+      num_stripes += partition.blocks[0].size() + partition.blocks[1].size();
+      results.emplace_back(cudf_io::read_orc(read_args, partition).tbl);
+      EXPECT_EQ(static_cast<size_t>(results.back()->num_rows()), partition.num_rows);
+      result_views.push_back(results.back()->view());
+    }
+    EXPECT_EQ(num_stripes, 3u);
+    expect_tables_equal(*cudf::concatenate(result_views), *full_table);
+  }
+
+  read_args.stripe_list = {0};
+  EXPECT_THROW(cudf_io::plan_orc_read(read_args, 2), cudf::logic_error);
+}
+
 TYPED_TEST(OrcChunkedWriterNumericTypeTest, UnalignedSize)
 {
   // write out two 31 row tables and make sure they get
@@ -20,15 +20,28 @@
 #include <tests/utilities/cudf_gtest.hpp>
 #include <tests/utilities/type_lists.hpp>
 
+#include <cudf/column/column_factories.hpp>
 #include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/io/data_sink.hpp>
 #include <cudf/io/functions.hpp>
+#include <cudf/partitioning.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
+#include <cudf/utilities/profiling.hpp>
 
+#include <io/utilities/caching_datasource.hpp>
+
+#include <arrow/io/file.h>
+
+#include <cstring>
 #include <fstream>
+#include <limits>
+#include <numeric>
 #include <type_traits>
 
 namespace cudf_io = cudf::io;
@@ -413,6 +426,33 @@ TEST_F(ParquetWriterTest, Strings)
   EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
 }
 
+TEST_F(ParquetWriterTest, StringsWithNulls)
+{
+  // Null rows next to empty strings, in a repeated and a unique column, so that both the
+  // dictionary and the plain decoders build the columns from the decoded validity
+  constexpr auto num_rows = 3000;
+  auto repeated           = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(i % 3, 'a' + i % 5); });
+  auto unique = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return i % 7 == 0 ? std::string{} : std::to_string(i); });
+  auto validity =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 4 != 1; });
+  cudf::test::strings_column_wrapper col0(repeated, repeated + num_rows, validity);
+  cudf::test::strings_column_wrapper col1(unique, unique + num_rows, validity);
+  auto expected = table_view{{col0, col1}};
+
+  auto filepath = temp_env->get_temp_filepath("StringsWithNulls.parquet");
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath}, expected};
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  auto result = cudf_io::read_parquet(in_args);
+
+  expect_tables_equal(expected, result.tbl->view());
+  EXPECT_EQ(num_rows / 4, result.tbl->get_column(0).null_count());
+  EXPECT_EQ(num_rows / 4, result.tbl->get_column(1).null_count());
+}
+
 TEST_F(ParquetWriterTest, MultiIndex)
 {
   constexpr auto num_rows = 100;
@@ -489,6 +529,106 @@ TEST_F(ParquetWriterTest, HostBuffer)
   EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
 }
 
+TEST_F(ParquetWriterTest, ArrowFileSource)
+{
+  srand(31337);
+  auto expected = create_random_fixed_table<int>(4, 4 * 1024, true);
+  auto filepath = temp_env->get_temp_filepath("ArrowFileSource.parquet");
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath}, *expected};
+  cudf_io::write_parquet(out_args);
+
+  // Reads of files that do not support zero-copy go through the caching datasource
+  auto const file = arrow::io::ReadableFile::Open(filepath).ValueOrDie();
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{file}};
+  auto result = cudf_io::read_parquet(in_args);
+  expect_tables_equal(expected->view(), result.tbl->view());
+}
+
+TEST_F(ParquetWriterTest, ReadPartitioned)
+{
+  srand(31337);
+  auto expected = create_random_fixed_table<int>(4, 1000, true);
+  auto filepath = temp_env->get_temp_filepath("ReadPartitioned.parquet");
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath}, *expected};
+  cudf_io::write_parquet(out_args);
+
+  // The rows are partitioned as the table read would be
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  cudf_io::read_partitioning partitioning;
+  partitioning.num_partitions  = 3;
+  partitioning.columns_to_hash = {0, 2};
+  auto result                  = cudf_io::read_parquet_partitioned(in_args, partitioning);
+  auto const hashed            = cudf::hash_partition(*expected, {0, 2}, 3);
+  expect_tables_equal(hashed.first->view(), result.tbl->view());
+  EXPECT_EQ(hashed.second, result.partition_offsets);
+
+  partitioning.columns_to_hash.clear();
+  partitioning.start_partition = 1;
+  result                       = cudf_io::read_parquet_partitioned(in_args, partitioning);
+  auto const dealt             = cudf::round_robin_partition(*expected, 3, 1);
+  expect_tables_equal(dealt.first->view(), result.tbl->view());
+  EXPECT_EQ(dealt.second, result.partition_offsets);
+
+  partitioning.num_partitions = 1;
+  result                      = cudf_io::read_parquet_partitioned(in_args, partitioning);
+  expect_tables_equal(expected->view(), result.tbl->view());
+  EXPECT_EQ(std::vector<cudf::size_type>{0}, result.partition_offsets);
+
+  partitioning.num_partitions = 0;
+  EXPECT_THROW(cudf_io::read_parquet_partitioned(in_args, partitioning), cudf::logic_error);
+}
+
+TEST_F(ParquetWriterTest, ReadColumnStatistics)
+{
+  column_wrapper<int32_t> col0{{5, -2, 7, 100, 3}, {1, 1, 1, 0, 1}};
+  cudf::test::strings_column_wrapper col1{"pear", "apple", "fig", "kiwi", "plum"};
+  auto expected = table_view{{col0, col1}};
+
+  auto filepath = temp_env->get_temp_filepath("ReadColumnStatistics.parquet");
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath}, expected};
+  cudf_io::write_parquet(out_args);
+
+  // The statistics of the file are recorded on the columns read
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  auto const result = cudf_io::read_parquet(in_args);
+  auto const &table = *result.tbl;
+  auto const &ints  = table.get_column(0).statistics();
+  auto const &strs  = table.get_column(1).statistics();
+  using int_scalar  = cudf::scalar_type_t<int32_t>;
+  using str_scalar  = cudf::scalar_type_t<cudf::string_view>;
+  ASSERT_NE(ints.min, nullptr);
+  ASSERT_NE(ints.max, nullptr);
+  EXPECT_EQ(static_cast<int_scalar const *>(ints.min.get())->value(), -2);
+  EXPECT_EQ(static_cast<int_scalar const *>(ints.max.get())->value(), 7);
+  EXPECT_EQ(ints.distinct_count, -1);
+  ASSERT_NE(strs.min, nullptr);
+  ASSERT_NE(strs.max, nullptr);
+  EXPECT_EQ(static_cast<str_scalar const *>(strs.min.get())->to_string(), "apple");
+  EXPECT_EQ(static_cast<str_scalar const *>(strs.max.get())->to_string(), "plum");
+}
+
+TEST_F(ParquetWriterTest, CachingDatasource)
+{
+  std::vector<char> data(100);
+  std::iota(data.begin(), data.end(), 0);
+  cudf::io::detail::caching_datasource source(
+    cudf_io::datasource::create(cudf_io::host_buffer{data.data(), data.size()}), 16, 1, 2);
+  EXPECT_EQ(source.size(), data.size());
+
+  // Within a block, across blocks, and past the end of the source
+  for (auto const range : {std::make_pair(3, 5), std::make_pair(10, 40), std::make_pair(90, 20)}) {
+    auto const buffer = source.host_read(range.first, range.second);
+    auto const size   = std::min<size_t>(range.second, data.size() - range.first);
+    ASSERT_EQ(buffer->size(), size);
+    EXPECT_EQ(0, std::memcmp(buffer->data(), data.data() + range.first, size));
+
+    std::vector<uint8_t> dst(range.second);
+    ASSERT_EQ(source.host_read(range.first, range.second, dst.data()), size);
+    EXPECT_EQ(0, std::memcmp(dst.data(), data.data() + range.first, size));
+  }
+  EXPECT_EQ(source.host_read(data.size(), 10)->size(), 0);
+}
+
 TEST_F(ParquetWriterTest, NonNullable)
 {
   srand(31337);
@@ -620,6 +760,494 @@ TEST_F(ParquetWriterTest, MultipleMismatchedSources)
   }
 }
 
+TEST_F(ParquetWriterTest, MultipleSources)
+{
+  srand(31337);
+  std::vector<std::unique_ptr<cudf::table>> tables;
+  std::vector<cudf::table_view> table_views;
+  std::vector<std::string> filepaths;
+  for (int i = 0; i < 40; ++i) {
+    tables.emplace_back(create_random_fixed_table<int>(3, 100 + i, true));
+    table_views.emplace_back(tables.back()->view());
+    filepaths.emplace_back(
+      temp_env->get_temp_filepath("MultipleSources" + std::to_string(i) + ".parquet"));
+    cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepaths.back()}, table_views.back()};
+    cudf_io::write_parquet(out_args);
+  }
+  auto const expected = cudf::concatenate(table_views);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepaths}};
+  auto result = cudf_io::read_parquet(in_args);
+  expect_tables_equal(result.tbl->view(), expected->view());
+
+  // Row ranges span several sources
+  in_args.skip_rows = 250;
+  in_args.num_rows  = 1000;
+  result            = cudf_io::read_parquet(in_args);
+
+  auto expected_slice = cudf::slice(expected->view(), {250, 1250});
+  expect_tables_equal(result.tbl->view(), expected_slice[0]);
+}
+
+TEST_F(ParquetWriterTest, PageIndexRowRange)
+{
+  srand(31337);
+  auto expected = create_random_fixed_table<int64_t>(2, 1000000, true);
+
+  auto filepath = temp_env->get_temp_filepath("PageIndexRowRange.parquet");
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath}, *expected};
+  out_args.stats_level = cudf_io::statistics_freq::STATISTICS_PAGE;
+  cudf_io::write_parquet(out_args);
+
+  // Ranges within a single page, and spanning several pages of the row group
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> ranges{
+    {0, 1000}, {500000, 1000}, {100000, 300000}, {999000, 1000}};
+  for (auto const& range : ranges) {
+    cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+    in_args.skip_rows = range.first;
+    in_args.num_rows  = range.second;
+    auto result       = cudf_io::read_parquet(in_args);
+
+    auto expected_slice = cudf::slice(expected->view(), {range.first, range.first + range.second});
+    expect_tables_equal(result.tbl->view(), expected_slice[0]);
+  }
+}
+
+TEST_F(ParquetWriterTest, StringsToDictionary)
+{
+  std::vector<const char*> strings1{"Monday", "Tuesday", "Monday", "Friday", "Sunday", "Monday"};
+  std::vector<const char*> strings2{"Friday", "Wednesday", "Wednesday", "Tuesday", "Friday"};
+  auto valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 4 != 2; });
+  cudf::test::strings_column_wrapper col1(strings1.begin(), strings1.end(), valids);
+  cudf::test::strings_column_wrapper col2(strings2.begin(), strings2.end(), valids);
+  cudf::table_view table1({col1});
+  cudf::table_view table2({col2});
+
+  // Each row group has its own dictionary, with overlapping entries
+  auto filepath = temp_env->get_temp_filepath("StringsToDictionary.parquet");
+  cudf_io::write_parquet_chunked_args out_args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_parquet_chunked_begin(out_args);
+  cudf_io::write_parquet_chunked(table1, state);
+  cudf_io::write_parquet_chunked(table2, state);
+  cudf_io::write_parquet_chunked_end(state);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  in_args.strings_to_dictionary = true;
+  auto result                   = cudf_io::read_parquet(in_args);
+
+  ASSERT_EQ(result.tbl->num_columns(), 1);
+  auto const dictionary = result.tbl->get_column(0).view();
+  EXPECT_EQ(dictionary.type().id(), cudf::type_id::DICTIONARY32);
+  EXPECT_EQ(cudf::dictionary_column_view(dictionary).keys_size(), 5);
+
+  auto expected = cudf::concatenate({table1, table2});
+  auto decoded  = cudf::dictionary::decode(cudf::dictionary_column_view(dictionary));
+  cudf::test::expect_columns_equal(expected->get_column(0), decoded->view());
+}
+
+TEST_F(ParquetWriterTest, DictionaryPolicy)
+{
+  constexpr auto num_rows = 20000;
+  auto repeated = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 10; });
+  auto unique   = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  column_wrapper<int64_t> col0{repeated, repeated + num_rows};
+  column_wrapper<int64_t> col1{unique, unique + num_rows};
+
+  cudf_io::table_metadata expected_metadata;
+  expected_metadata.column_names.emplace_back("repeated");
+  expected_metadata.column_names.emplace_back("unique");
+  table_view expected({col0, col1});
+
+  auto write = [&](cudf_io::dictionary_policy policy,
+                   std::map<std::string, cudf_io::dictionary_policy> const& column_policy) {
+    std::vector<char> out_buffer;
+    cudf_io::write_parquet_args out_args{
+      cudf_io::sink_info(&out_buffer), expected, &expected_metadata};
+    out_args.dictionary               = policy;
+    out_args.column_dictionary_policy = column_policy;
+    cudf_io::write_parquet(out_args);
+
+    cudf_io::read_parquet_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+    auto result = cudf_io::read_parquet(in_args);
+    expect_tables_equal(expected, result.tbl->view());
+    return out_buffer.size();
+  };
+
+  auto const adaptive_size = write(cudf_io::dictionary_policy::ADAPTIVE, {});
+  auto const always_size   = write(cudf_io::dictionary_policy::ALWAYS, {});
+  auto const never_size    = write(cudf_io::dictionary_policy::NEVER, {});
+  auto const override_size = write(cudf_io::dictionary_policy::NEVER,
+                                   {{"repeated", cudf_io::dictionary_policy::ADAPTIVE}});
+
+  // Only the low cardinality column benefits from a dictionary
+  EXPECT_LT(adaptive_size, never_size);
+  EXPECT_LT(adaptive_size, always_size);
+  EXPECT_EQ(adaptive_size, override_size);
+
+  EXPECT_THROW(write(cudf_io::dictionary_policy::ADAPTIVE,
+                     {{"missing", cudf_io::dictionary_policy::NEVER}}),
+               cudf::logic_error);
+}
+
+TEST_F(ParquetWriterTest, DeltaEncoding)
+{
+  constexpr auto num_rows = 20000;
+  auto sorted   = cudf::test::make_counting_transform_iterator(0, [](auto i) { return 3 * i - 7; });
+  auto extremes = cudf::test::make_counting_transform_iterator(0, [](auto i) {
+    return (i % 3 == 0) ? std::numeric_limits<int64_t>::min()
+                        : (i % 3 == 1) ? std::numeric_limits<int64_t>::max() : int64_t{i};
+  });
+  auto narrow   = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int16_t>((i * 7919) % 65536); });
+  auto times    = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return cudf::timestamp_ms{1600000000000L + i * 250L}; });
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+
+  column_wrapper<int32_t> col0{sorted, sorted + num_rows, validity};
+  column_wrapper<int64_t> col1{extremes, extremes + num_rows};
+  column_wrapper<int16_t> col2{narrow, narrow + num_rows, validity};
+  column_wrapper<cudf::timestamp_ms> col3{times, times + num_rows};
+
+  cudf_io::table_metadata expected_metadata;
+  expected_metadata.column_names.emplace_back("sorted");
+  expected_metadata.column_names.emplace_back("extremes");
+  expected_metadata.column_names.emplace_back("narrow");
+  expected_metadata.column_names.emplace_back("times");
+  table_view expected({col0, col1, col2, col3});
+
+  auto write = [&](std::vector<std::string> const& delta_columns) {
+    std::vector<char> out_buffer;
+    cudf_io::write_parquet_args out_args{
+      cudf_io::sink_info(&out_buffer), expected, &expected_metadata};
+    out_args.dictionary             = cudf_io::dictionary_policy::NEVER;
+    out_args.delta_encoding_columns = delta_columns;
+    cudf_io::write_parquet(out_args);
+
+    cudf_io::read_parquet_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+    in_args.timestamp_type = cudf::data_type{cudf::type_id::TIMESTAMP_MILLISECONDS};
+    auto result            = cudf_io::read_parquet(in_args);
+    expect_tables_equal(expected, result.tbl->view());
+    return out_buffer.size();
+  };
+
+  auto const plain_size = write({});
+  auto const delta_size = write({"sorted", "extremes", "narrow", "times"});
+  // Sorted values are stored with a few bits each
+  EXPECT_LT(delta_size, plain_size);
+  EXPECT_LT(write({"sorted", "times"}), plain_size);
+
+  EXPECT_THROW(write({"missing"}), cudf::logic_error);
+}
+
+TEST_F(ParquetWriterTest, RowGroupAndPageSizes)
+{
+  constexpr auto num_rows = 10000;
+  auto values  = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto strings = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(i % 100, 'a' + i % 26); });
+
+  column_wrapper<int32_t> col0{values, values + num_rows};
+  cudf::test::strings_column_wrapper col1{strings, strings + num_rows};
+  table_view expected({col0, col1});
+
+  auto write = [&](cudf_io::write_parquet_args& out_args) {
+    std::vector<char> out_buffer;
+    out_args.sink = cudf_io::sink_info(&out_buffer);
+    cudf_io::write_parquet(out_args);
+    return out_buffer;
+  };
+
+  // 10000 rows with at most 3000 per row group are split in 4 row groups of 2000 or 3000 rows,
+  // rather than 3 full ones and a remainder of 1000
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info(), expected};
+  out_args.row_group_size_rows = 3000;
+  out_args.max_page_size_rows  = 1000;
+  auto out_buffer              = write(out_args);
+  cudf_io::read_parquet_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+  expect_tables_equal(expected, cudf_io::read_parquet(in_args).tbl->view());
+  in_args.row_groups = {{0}};
+  EXPECT_EQ(cudf_io::read_parquet(in_args).tbl->num_rows(), 3000);
+  in_args.row_groups = {{3}};
+  EXPECT_EQ(cudf_io::read_parquet(in_args).tbl->num_rows(), 2000);
+  in_args.row_groups = {{4}};
+  EXPECT_THROW(cudf_io::read_parquet(in_args), cudf::logic_error);
+
+  // Pages smaller than a default fragment of the string column
+  cudf_io::write_parquet_args small_pages_args{cudf_io::sink_info(), expected};
+  small_pages_args.row_group_size_bytes = 64 * 1024;
+  small_pages_args.max_page_size_bytes  = 4 * 1024;
+  out_buffer                            = write(small_pages_args);
+  cudf_io::read_parquet_args small_pages_in_args{
+    cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+  expect_tables_equal(expected, cudf_io::read_parquet(small_pages_in_args).tbl->view());
+
+  cudf_io::write_parquet_args invalid_args{cudf_io::sink_info(), expected};
+  invalid_args.row_group_size_rows = 0;
+  EXPECT_THROW(write(invalid_args), cudf::logic_error);
+  invalid_args.row_group_size_rows = 1000;
+  invalid_args.max_page_size_bytes = 0;
+  EXPECT_THROW(write(invalid_args), cudf::logic_error);
+}
+
+TEST_F(ParquetWriterTest, ZstdCompression)
+{
+  constexpr auto num_rows = 100 << 10;
+  auto values   = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 1000; });
+  auto strings  = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return "value_" + std::to_string(i % 250); });
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+
+  column_wrapper<int32_t> col0{values, values + num_rows, validity};
+  column_wrapper<double> col1{values, values + num_rows};
+  cudf::test::strings_column_wrapper col2{strings, strings + num_rows, validity};
+
+  cudf_io::table_metadata expected_metadata;
+  expected_metadata.column_names.emplace_back("int32s");
+  expected_metadata.column_names.emplace_back("doubles");
+  expected_metadata.column_names.emplace_back("strings");
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  cols.push_back(col2.release());
+  auto expected = std::make_unique<table>(std::move(cols));
+
+  std::vector<char> out_buffer;
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info(&out_buffer),
+                                       expected->view(),
+                                       &expected_metadata,
+                                       cudf_io::compression_type::ZSTD};
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+  auto result = cudf_io::read_parquet(in_args);
+
+  expect_tables_equal(expected->view(), result.tbl->view());
+  EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
+}
+
+TEST_F(ParquetWriterTest, Lz4Compression)
+{
+  constexpr auto num_rows = 100 << 10;
+  auto values   = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 1000; });
+  auto strings  = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return "value_" + std::to_string(i % 250); });
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+
+  column_wrapper<int32_t> col0{values, values + num_rows, validity};
+  column_wrapper<double> col1{values, values + num_rows};
+  cudf::test::strings_column_wrapper col2{strings, strings + num_rows, validity};
+
+  cudf_io::table_metadata expected_metadata;
+  expected_metadata.column_names.emplace_back("int32s");
+  expected_metadata.column_names.emplace_back("doubles");
+  expected_metadata.column_names.emplace_back("strings");
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  cols.push_back(col2.release());
+  auto expected = std::make_unique<table>(std::move(cols));
+
+  std::vector<char> out_buffer;
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info(&out_buffer),
+                                       expected->view(),
+                                       &expected_metadata,
+                                       cudf_io::compression_type::LZ4};
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+  auto result = cudf_io::read_parquet(in_args);
+
+  expect_tables_equal(expected->view(), result.tbl->view());
+  EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
+}
+
+TEST_F(ParquetWriterTest, SelectDottedPaths)
+{
+  // Leaf columns are named by their dotted path in the schema
+  column_wrapper<int> col0{1, 2, 3};
+  column_wrapper<int> col1{4, 5, 6};
+  column_wrapper<int> col2{7, 8, 9};
+  table_view expected({col0, col1, col2});
+  cudf_io::table_metadata metadata;
+  metadata.column_names = {"event.id", "event.time", "eventual"};
+
+  auto filepath = temp_env->get_temp_filepath("SelectDottedPaths.parquet");
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath}, expected, &metadata};
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  in_args.columns = {"event"};
+  auto result     = cudf_io::read_parquet(in_args);
+  expect_tables_equal(*result.tbl, table_view({col0, col1}));
+  EXPECT_EQ(result.metadata.column_names, std::vector<std::string>({"event.id", "event.time"}));
+
+  in_args.columns = {"event.time", "eventual"};
+  result          = cudf_io::read_parquet(in_args);
+  expect_tables_equal(*result.tbl, table_view({col1, col2}));
+}
+
+TEST_F(ParquetWriterTest, ListColumn)
+{
+  using lcw = cudf::test::lists_column_wrapper<int32_t>;
+  auto valids =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 2 == 0; });
+  auto list_valids =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i != 3; });
+
+  // [{1, 2}, {}, {3, NULL, 5}, NULL, {6}, {NULL}]
+  lcw col0{{{1, 2}, lcw{}, {{3, 4, 5}, valids}, lcw{}, {6}, {{7}, list_valids + 3}},
+           list_valids};
+  cudf::test::lists_column_wrapper<cudf::string_view> col1{
+    {"a", "bc"}, {"def"}, {"g", "hi", "jkl"}, {"m"}, {"no"}, {"pqr", "s"}};
+  column_wrapper<int64_t> col2{{1, 2, 3, 4, 5, 6}};
+
+  cudf_io::table_metadata expected_metadata;
+  expected_metadata.column_names.emplace_back("int_lists");
+  expected_metadata.column_names.emplace_back("string_lists");
+  expected_metadata.column_names.emplace_back("int64s");
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  cols.push_back(col2.release());
+  auto expected = std::make_unique<table>(std::move(cols));
+
+  auto filepath = temp_env->get_temp_filepath("ListColumn.parquet");
+  cudf_io::write_parquet_args out_args{
+    cudf_io::sink_info{filepath}, expected->view(), &expected_metadata};
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  auto result = cudf_io::read_parquet(in_args);
+
+  expect_tables_equal(expected->view(), result.tbl->view());
+  EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
+}
+
+TEST_F(ParquetWriterTest, ListColumnMultipleFragments)
+{
+  constexpr auto num_rows = 20000;
+  // Row i holds i % 4 values
+  auto offsets = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return 6 * (i / 4) + (i % 4) * (i % 4 - 1) / 2; });
+  auto values = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 1000; });
+  auto const num_values = 6 * (num_rows / 4);
+
+  column_wrapper<int32_t> offsets_col(offsets, offsets + num_rows + 1);
+  column_wrapper<int32_t> values_col(values, values + num_values);
+  auto col0 = cudf::make_lists_column(
+    num_rows, offsets_col.release(), values_col.release(), 0, rmm::device_buffer{});
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(std::move(col0));
+  auto expected = std::make_unique<table>(std::move(cols));
+
+  std::vector<char> out_buffer;
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info(&out_buffer), expected->view()};
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+  auto result = cudf_io::read_parquet(in_args);
+
+  expect_tables_equal(expected->view(), result.tbl->view());
+}
+
+TEST_F(ParquetWriterTest, ListColumnLongRows)
+{
+  // The middle row holds more values than a page fragment, and than a 16-bit count
+  constexpr auto num_rows   = 3;
+  constexpr auto num_values = 70010;
+  column_wrapper<int32_t> offsets_col{0, 5, 70005, num_values};
+  auto values = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 100; });
+  column_wrapper<int32_t> values_col(values, values + num_values);
+  auto col0 = cudf::make_lists_column(
+    num_rows, offsets_col.release(), values_col.release(), 0, rmm::device_buffer{});
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(std::move(col0));
+  auto expected = std::make_unique<table>(std::move(cols));
+
+  std::vector<char> out_buffer;
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info(&out_buffer), expected->view()};
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+  auto result = cudf_io::read_parquet(in_args);
+
+  expect_tables_equal(expected->view(), result.tbl->view());
+}
+
+TEST_F(ParquetWriterTest, Partitioned)
+{
+  srand(31337);
+  auto expected = create_random_fixed_table<int>(3, 12000, true);
+  // The first partition spans several page fragments, and the second one is empty
+  std::vector<cudf::size_type> const partition_offsets{0, 7000, 7000, 12000};
+
+  std::vector<std::vector<char>> out_buffers(partition_offsets.size() - 1);
+  std::vector<cudf_io::sink_info> sinks;
+  for (auto &out_buffer : out_buffers) { sinks.emplace_back(&out_buffer); }
+  cudf_io::write_parquet_partitioned_args args{sinks, *expected, partition_offsets};
+  cudf_io::write_parquet_partitioned(args);
+
+  auto const slices = cudf::slice(*expected, {0, 7000, 7000, 7000, 7000, 12000});
+  for (size_t p = 0; p < out_buffers.size(); p++) {
+    cudf_io::read_parquet_args in_args{
+      cudf_io::source_info(out_buffers[p].data(), out_buffers[p].size())};
+    auto result = cudf_io::read_parquet(in_args);
+    if (slices[p].num_rows() == 0) {
+      EXPECT_EQ(0, result.tbl->num_rows());
+    } else {
+      expect_tables_equal(slices[p], result.tbl->view());
+    }
+  }
+
+  // One sink per partition is required
+  sinks.pop_back();
+  cudf_io::write_parquet_partitioned_args bad_args{sinks, *expected, partition_offsets};
+  EXPECT_THROW(cudf_io::write_parquet_partitioned(bad_args), cudf::logic_error);
+}
+
+TEST_F(ParquetWriterTest, ReadInto)
+{
+  srand(31337);
+  constexpr cudf::size_type num_rows = 3000;
+  auto expected = create_random_fixed_table<int>(2, num_rows, true);
+  std::vector<char> out_buffer;
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info(&out_buffer), *expected};
+  cudf_io::write_parquet(out_args);
+
+  // Outputs larger than the rows read, as in a staging area
+  std::vector<std::unique_ptr<column>> outputs;
+  std::vector<cudf::mutable_column_view> output_views;
+  for (int i = 0; i < 2; i++) {
+    outputs.push_back(cudf::make_numeric_column(
+      cudf::data_type{cudf::type_id::INT32}, num_rows + 100, cudf::mask_state::ALL_VALID));
+    output_views.push_back(*outputs.back());
+  }
+  cudf_io::read_parquet_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+  auto const result = cudf_io::read_parquet_into(in_args, output_views);
+
+  EXPECT_EQ(num_rows, result.num_rows);
+  for (int i = 0; i < 2; i++) {
+    auto const read = cudf::slice(outputs[i]->view(), {0, num_rows}).front();
+    expect_columns_equal(expected->get_column(i), read);
+    EXPECT_EQ(expected->get_column(i).null_count(), result.null_counts[i]);
+  }
+
+  // Nulls cannot be read into an output without null mask
+  auto no_mask = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32}, num_rows + 100);
+  output_views[1] = *no_mask;
+  EXPECT_THROW(cudf_io::read_parquet_into(in_args, output_views), cudf::logic_error);
+  // Outputs must hold the rows read
+  auto too_small = cudf::make_numeric_column(
+    cudf::data_type{cudf::type_id::INT32}, num_rows - 1, cudf::mask_state::ALL_VALID);
+  output_views[1] = *too_small;
+  EXPECT_THROW(cudf_io::read_parquet_into(in_args, output_views), cudf::logic_error);
+}
+
 TEST_F(ParquetChunkedWriterTest, SingleTable)
 {
   srand(31337);
@@ -808,6 +1436,328 @@ TEST_F(ParquetChunkedWriterTest, ReadRowGroupsError)
   EXPECT_THROW(cudf_io::read_parquet(read_args), cudf::logic_error);
 }
 
+TEST_F(ParquetChunkedWriterTest, ReadRowGroupsMetrics)
+{
+  srand(31337);
+  auto table1 = create_random_fixed_table<int>(5, 5, true);
+  auto table2 = create_random_fixed_table<int>(5, 7, true);
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedRowGroupsMetrics.parquet");
+  cudf_io::write_parquet_chunked_args args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_parquet_chunked_begin(args);
+  cudf_io::write_parquet_chunked(*table1, state);
+  cudf_io::write_parquet_chunked(*table2, state);
+  cudf_io::write_parquet_chunked_end(state);
+
+  cudf::metrics_registry registry;
+  cudf::set_profiling_callbacks(&registry);
+  cudf_io::read_parquet_args read_args{cudf_io::source_info{filepath}};
+  read_args.row_groups = {{0}};
+  auto result          = cudf_io::read_parquet(read_args);
+  cudf::set_profiling_callbacks(nullptr);
+
+  expect_tables_equal(*result.tbl, *table1);
+  auto const metrics = registry.metrics().at("read_parquet");
+  EXPECT_EQ(metrics.calls, 1);
+  EXPECT_GT(metrics.counters.at("bytes_read"), 0);
+  EXPECT_EQ(metrics.counters.at("rows_skipped"), 7);
+}
+
+TEST_F(ParquetChunkedWriterTest, ReadFilteredRowGroups)
+{
+  auto seq0 = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto seq1 = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i + 100; });
+  column_wrapper<int> col0(seq0, seq0 + 10);
+  column_wrapper<int> col1(seq1, seq1 + 10);
+  cudf::test::strings_column_wrapper str0({"a", "b", "c", "d", "e", "f", "g", "h", "i", "j"});
+  cudf::test::strings_column_wrapper str1({"p", "q", "r", "s", "t", "u", "v", "w", "x", "y"});
+  table_view table1({col0, str0});
+  table_view table2({col1, str1});
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedFilteredRowGroups.parquet");
+  cudf_io::write_parquet_chunked_args args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_parquet_chunked_begin(args);
+  cudf_io::write_parquet_chunked(table1, state);
+  cudf_io::write_parquet_chunked(table2, state);
+  cudf_io::write_parquet_chunked_end(state);
+
+  using cudf_io::column_predicate;
+  using cudf_io::predicate_op;
+  cudf_io::read_parquet_args read_args{cudf_io::source_info{filepath}};
+
+  read_args.filters = {{column_predicate("_col0", predicate_op::GREATER_EQUAL, 100)}};
+  auto result       = cudf_io::read_parquet(read_args);
+  expect_tables_equal(*result.tbl, table2);
+
+  read_args.filters = {{column_predicate("_col1", predicate_op::LESS, std::string("k"))}};
+  result            = cudf_io::read_parquet(read_args);
+  expect_tables_equal(*result.tbl, table1);
+
+  // Disjunction of conjunctions; the first term matches nothing
+  read_args.filters = {{column_predicate("_col0", predicate_op::GREATER, 5),
+                        column_predicate("_col0", predicate_op::LESS, 3)},
+                       {column_predicate("_col0", predicate_op::EQUAL, 105.0)}};
+  result            = cudf_io::read_parquet(read_args);
+  expect_tables_equal(*result.tbl, table2);
+
+  read_args.filters = {{column_predicate("_col0", predicate_op::EQUAL, 50)}};
+  result            = cudf_io::read_parquet(read_args);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+  EXPECT_EQ(result.tbl->num_columns(), 2);
+
+  read_args.filters = {{column_predicate("missing", predicate_op::EQUAL, 0)}};
+  EXPECT_THROW(cudf_io::read_parquet(read_args), cudf::logic_error);
+  read_args.filters = {{column_predicate("_col1", predicate_op::EQUAL, 0)}};
+  EXPECT_THROW(cudf_io::read_parquet(read_args), cudf::logic_error);
+}
+
+TEST_F(ParquetChunkedWriterTest, ReadTruncatedStatisticsRowGroups)
+{
+  std::string const prefix(100, 'x');
+  cudf::test::strings_column_wrapper str0({prefix + "a" + prefix, prefix + "b" + prefix});
+  cudf::test::strings_column_wrapper str1({prefix + "c" + prefix, prefix + "d"});
+  table_view table1({str0});
+  table_view table2({str1});
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedTruncatedStatistics.parquet");
+  cudf_io::write_parquet_chunked_args args{cudf_io::sink_info{filepath}};
+  args.stats_level           = cudf_io::statistics_freq::STATISTICS_PAGE;
+  args.stats_truncate_length = 101;
+  auto state                 = cudf_io::write_parquet_chunked_begin(args);
+  cudf_io::write_parquet_chunked(table1, state);
+  cudf_io::write_parquet_chunked(table2, state);
+  cudf_io::write_parquet_chunked_end(state);
+
+  using cudf_io::column_predicate;
+  using cudf_io::predicate_op;
+  cudf_io::read_parquet_args read_args{cudf_io::source_info{filepath}};
+  auto result = cudf_io::read_parquet(read_args);
+  expect_tables_equal(*result.tbl, *cudf::concatenate({table1, table2}));
+
+  // The truncated bounds of the first row group are [x..xa, x..xc)
+  read_args.filters = {{column_predicate("_col0", predicate_op::EQUAL, prefix + "d")}};
+  result            = cudf_io::read_parquet(read_args);
+  expect_tables_equal(*result.tbl, table2);
+
+  read_args.filters = {{column_predicate("_col0", predicate_op::EQUAL, prefix + "b" + prefix)}};
+  result            = cudf_io::read_parquet(read_args);
+  expect_tables_equal(*result.tbl, table1);
+}
+
+TEST_F(ParquetChunkedWriterTest, ReadBloomFilteredRowGroups)
+{
+  // The row groups have overlapping min/max ranges, so only the Bloom filters can tell them apart
+  auto even = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i * 2; });
+  auto odd  = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i * 2 + 1; });
+  column_wrapper<int> col0(even, even + 10);
+  column_wrapper<int> col1(odd, odd + 10);
+  cudf::test::strings_column_wrapper str0({"a", "c", "e", "g", "i", "k", "m", "o", "q", "s"});
+  cudf::test::strings_column_wrapper str1({"b", "d", "f", "h", "j", "l", "n", "p", "r", "t"});
+  table_view table1({col0, str0});
+  table_view table2({col1, str1});
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedBloomFilteredRowGroups.parquet");
+  cudf_io::write_parquet_chunked_args args{cudf_io::sink_info{filepath}};
+  args.bloom_filter_columns = {"_col0", "_col1"};
+  auto state                = cudf_io::write_parquet_chunked_begin(args);
+  cudf_io::write_parquet_chunked(table1, state);
+  cudf_io::write_parquet_chunked(table2, state);
+  cudf_io::write_parquet_chunked_end(state);
+
+  using cudf_io::column_predicate;
+  using cudf_io::predicate_op;
+  cudf_io::read_parquet_args read_args{cudf_io::source_info{filepath}};
+
+  read_args.filters = {{column_predicate("_col0", predicate_op::EQUAL, 7)}};
+  auto result       = cudf_io::read_parquet(read_args);
+  expect_tables_equal(*result.tbl, table2);
+
+  // A set of probe keys
+  read_args.filters = {{column_predicate("_col0", predicate_op::EQUAL, 4)},
+                       {column_predicate("_col0", predicate_op::EQUAL, 10.0)}};
+  result            = cudf_io::read_parquet(read_args);
+  expect_tables_equal(*result.tbl, table1);
+
+  read_args.filters = {{column_predicate("_col1", predicate_op::EQUAL, std::string("d"))}};
+  result            = cudf_io::read_parquet(read_args);
+  expect_tables_equal(*result.tbl, table2);
+
+  // Present in neither row group
+  read_args.filters = {{column_predicate("_col0", predicate_op::EQUAL, 7),
+                        column_predicate("_col1", predicate_op::EQUAL, std::string("a"))}};
+  result            = cudf_io::read_parquet(read_args);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+
+  // Other predicates are unaffected by the Bloom filters
+  read_args.filters = {{column_predicate("_col0", predicate_op::NOT_EQUAL, 7)}};
+  result            = cudf_io::read_parquet(read_args);
+  EXPECT_EQ(result.tbl->num_rows(), 20);
+
+  args.bloom_filter_columns = {"missing"};
+  EXPECT_THROW(cudf_io::write_parquet_chunked(table1, cudf_io::write_parquet_chunked_begin(args)),
+               cudf::logic_error);
+}
+
+TEST_F(ParquetChunkedWriterTest, ReadFilteredRows)
+{
+  auto seq0 = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto seq1 = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i + 100; });
+  auto seq2 = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i + 200; });
+  auto dbl  = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i * 0.5; });
+  column_wrapper<int> col0(seq0, seq0 + 10);
+  column_wrapper<int> col1(seq1, seq1 + 10);
+  column_wrapper<int> col2(seq2, seq2 + 10);
+  column_wrapper<double> dbl0(dbl, dbl + 10);
+  cudf::test::strings_column_wrapper str0({"a", "b", "c", "d", "e", "f", "g", "h", "i", "j"});
+  cudf::test::strings_column_wrapper str1({"p", "q", "r", "s", "t", "u", "v", "w", "x", "y"});
+  table_view table1({col0, str0, dbl0});
+  table_view table2({col1, str1, dbl0});
+  table_view table3({col2, str0, dbl0});
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedFilteredRows.parquet");
+  cudf_io::write_parquet_chunked_args args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_parquet_chunked_begin(args);
+  cudf_io::write_parquet_chunked(table1, state);
+  cudf_io::write_parquet_chunked(table2, state);
+  cudf_io::write_parquet_chunked(table3, state);
+  cudf_io::write_parquet_chunked_end(state);
+
+  using cudf_io::column_predicate;
+  using cudf_io::predicate_op;
+  cudf_io::read_parquet_args read_args{cudf_io::source_info{filepath}};
+  read_args.filter_rows = true;
+
+  // The statistics of the first row group pass the filter, but none of its rows do
+  read_args.filters = {{column_predicate("_col0", predicate_op::GREATER, 5),
+                        column_predicate("_col1", predicate_op::LESS, std::string("b"))},
+                       {column_predicate("_col0", predicate_op::EQUAL, 203)}};
+  auto result       = cudf_io::read_parquet(read_args);
+  column_wrapper<int> expect_col0{200, 203};
+  cudf::test::strings_column_wrapper expect_str{"a", "d"};
+  column_wrapper<double> expect_dbl{0.0, 1.5};
+  expect_tables_equal(*result.tbl, table_view({expect_col0, expect_str, expect_dbl}));
+
+  // Filter columns that are not selected
+  read_args.columns = {"_col2"};
+  result            = cudf_io::read_parquet(read_args);
+  expect_tables_equal(*result.tbl, table_view({expect_dbl}));
+  EXPECT_EQ(result.metadata.column_names, std::vector<std::string>{"_col2"});
+
+  // Rows left in all the row groups that pass the statistics
+  read_args.columns = {"_col2", "_col0"};
+  read_args.filters = {{column_predicate("_col0", predicate_op::EQUAL, 3)},
+                       {column_predicate("_col2", predicate_op::GREATER_EQUAL, 4.0)}};
+  result            = cudf_io::read_parquet(read_args);
+  column_wrapper<double> expect_dbl2{1.5, 4.0, 4.5, 4.0, 4.5, 4.0, 4.5};
+  column_wrapper<int> expect_col02{3, 8, 9, 108, 109, 208, 209};
+  expect_tables_equal(*result.tbl, table_view({expect_dbl2, expect_col02}));
+
+  read_args.filters = {{column_predicate("_col0", predicate_op::EQUAL, 50)}};
+  result            = cudf_io::read_parquet(read_args);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+  EXPECT_EQ(result.tbl->num_columns(), 2);
+
+  read_args.filters = {{column_predicate("_col2", predicate_op::EQUAL, std::string("a"))}};
+  EXPECT_THROW(cudf_io::read_parquet(read_args), cudf::logic_error);
+}
+
+TEST_F(ParquetChunkedWriterTest, ChunkedRead)
+{
+  srand(31337);
+  auto table1 = create_random_fixed_table<int>(4, 1000, true);
+  auto table2 = create_random_fixed_table<int>(4, 3000, true);
+  auto table3 = create_random_fixed_table<int>(4, 500, false);
+
+  auto full_table = cudf::concatenate({*table1, *table2, *table3});
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedRead.parquet");
+  cudf_io::write_parquet_chunked_args args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_parquet_chunked_begin(args);
+  cudf_io::write_parquet_chunked(*table1, state);
+  cudf_io::write_parquet_chunked(*table2, state);
+  cudf_io::write_parquet_chunked(*table3, state);
+  cudf_io::write_parquet_chunked_end(state);
+
+  auto read_chunks = [](cudf_io::read_parquet_args const& read_args, size_t chunk_read_limit) {
+    cudf_io::chunked_parquet_reader reader(read_args, chunk_read_limit);
+    std::vector<std::unique_ptr<table>> chunks;
+    while (reader.has_next()) { chunks.push_back(std::move(reader.read_chunk().tbl)); }
+    EXPECT_THROW(reader.read_chunk(), cudf::logic_error);
+    return chunks;
+  };
+  auto concat = [](std::vector<std::unique_ptr<table>> const& chunks) {
+    std::vector<table_view> views;
+    for (auto const& chunk : chunks) { views.push_back(*chunk); }
+    return cudf::concatenate(views);
+  };
+
+  cudf_io::read_parquet_args read_args{cudf_io::source_info{filepath}};
+
+  // No limit returns everything at once
+  auto chunks = read_chunks(read_args, 0);
+  ASSERT_EQ(chunks.size(), 1u);
+  expect_tables_equal(*chunks[0], *full_table);
+
+  // Small limit splits both across and within row groups
+  chunks = read_chunks(read_args, 8 * 1024);
+  EXPECT_GT(chunks.size(), 3u);
+  expect_tables_equal(*concat(chunks), *full_table);
+
+  // Row range is honored across chunks
+  read_args.skip_rows = 700;
+  read_args.num_rows  = 3200;
+  chunks              = read_chunks(read_args, 8 * 1024);
+  auto expected       = cudf::slice(full_table->view(), {700, 3900});
+  expect_tables_equal(*concat(chunks), expected[0]);
+
+  read_args.row_groups = {{0}};
+  EXPECT_THROW(cudf_io::chunked_parquet_reader(read_args, 0), cudf::logic_error);
+}
+
+TEST_F(ParquetChunkedWriterTest, ReadPlannedPartitions)
+{
+  srand(31337);
+  auto table1 = create_random_fixed_table<int>(5, 5, true);
+  auto table2 = create_random_fixed_table<int>(5, 5, true);
+  auto table3 = create_random_fixed_table<int>(5, 5, true);
+
+  auto filepath1 = temp_env->get_temp_filepath("ChunkedPartitions1.parquet");
+  auto filepath2 = temp_env->get_temp_filepath("ChunkedPartitions2.parquet");
+  cudf_io::write_parquet_chunked_args args1{cudf_io::sink_info{filepath1}};
+  auto state = cudf_io::write_parquet_chunked_begin(args1);
+  cudf_io::write_parquet_chunked(*table1, state);
+  cudf_io::write_parquet_chunked(*table2, state);
+  cudf_io::write_parquet_chunked_end(state);
+  cudf_io::write_parquet_chunked_args args2{cudf_io::sink_info{filepath2}};
+  state = cudf_io::write_parquet_chunked_begin(args2);
+  cudf_io::write_parquet_chunked(*table3, state);
+  cudf_io::write_parquet_chunked_end(state);
+
+  auto full_table = cudf::concatenate({*table1, *table2, *table3});
+
+  std::vector<std::string> filepaths{filepath1, filepath2};
+  cudf_io::read_parquet_args read_args{cudf_io::source_info{filepaths}};
+  for (int num_partitions : {1, 2, 5}) {
+    auto partitions = cudf_io::plan_parquet_read(read_args, num_partitions);
+    ASSERT_EQ(partitions.size(), static_cast<size_t>(num_partitions));
+
+    std::vector<std::unique_ptr<cudf::table>> results;
+    std::vector<table_view> result_views;
+    size_t num_row_groups = 0;
+    for (auto const& partition : partitions) {
+      num_row_groups += partition.blocks[0].size() + partition.blocks[1].size();
+      results.emplace_back(cudf_io::read_parquet(read_args, partition).tbl);
+      EXPECT_EQ(static_cast<size_t>(results.back()->num_rows()), partition.num_rows);
+      result_views.push_back(results.back()->view());
+    }
+    EXPECT_EQ(num_row_groups, 3u);
+    expect_tables_equal(*cudf::concatenate(result_views), *full_table);
+  }
+
+  read_args.row_groups = {{0}, {0}};
+  EXPECT_THROW(cudf_io::plan_parquet_read(read_args, 2), cudf::logic_error);
+}
+
 TYPED_TEST(ParquetChunkedWriterNumericTypeTest, UnalignedSize)
 {
   // write out two 31 row tables and make sure they get
@@ -76,8 +76,48 @@ TEST_F(JitCacheTest, MemoryCacheProgramTest)
   cudf::test::expect_columns_equal(expect, column);
 }
 
+// Test the eviction of the least recently used kernels from memory
+TEST_F(JitCacheTest, MemoryCacheEvictionTest)
+{
+  // Keep a single kernel in memory
+  setLimits(1, 0);
+
+  auto program      = getProgram("MemoryCacheTestProg");
+  auto const before = getStatistics();
+  auto kernel4      = getKernelInstantiation("my_kernel", program, {"4", "int"});
+  auto kernel3      = getKernelInstantiation("my_kernel", program, {"3", "int"});
+  auto const after  = getStatistics();
+
+  // Each kernel evicted the other one, so neither was found in memory
+  EXPECT_EQ(after.memory_hits, before.memory_hits);
+  EXPECT_EQ(after.evictions, before.evictions + 2);
+  EXPECT_EQ(after.file_hits + after.misses, before.file_hits + before.misses + 2);
+
+  // An evicted kernel remains valid while it is in use
+  auto column = cudf::test::fixed_width_column_wrapper<int>{{5, 0}};
+  auto expect = cudf::test::fixed_width_column_wrapper<int>{{625, 0}};
+  (*std::get<1>(kernel4))
+    .configure(grid, block)
+    .launch(column.operator cudf::mutable_column_view().data<int>());
+
+  cudf::test::expect_columns_equal(expect, column);
+}
+
 // Test the file caching ability
 #if defined(JITIFY_USE_CACHE)
+TEST_F(JitCacheTest, FileCacheEvictionTest)
+{
+  // Brand new cache object whose files can't fit in the cache directory
+  cudf::jit::cudfJitCache cache;
+  cache.setLimits(0, 1);
+
+  auto program = cache.getProgram("FileCacheTestProg", program_source);
+
+  EXPECT_EQ(cache.getStatistics().misses, 1u);
+  EXPECT_GT(cache.getStatistics().file_evictions, 0u);
+  EXPECT_TRUE(boost::filesystem::is_empty(cudf::jit::getCacheDir()));
+}
+
 TEST_F(JitCacheTest, FileCacheProgramTest)
 {
   // Brand new cache object that has nothing in in-memory cache
@@ -16,6 +16,8 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/expressions.hpp>
 #include <cudf/join.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
@@ -142,3 +144,82 @@ TEST_F(CrossJoinEmptyResult, NoRows)
   EXPECT_EQ(join_table_reverse->num_columns(), table_a.num_columns() + table_b.num_columns());
   EXPECT_EQ(join_table_reverse->num_rows(), 0);
 }
+
+class ChunkedCrossJoinTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ChunkedCrossJoinTest, Chunks)
+{
+  auto a_0 = column_wrapper<int32_t>{10, 20, 20, 50};
+  auto a_1 = cudf::test::strings_column_wrapper({"quick", "accénted", "turtlé", "composéd"});
+  auto b_0 = column_wrapper<int32_t>{{10, 20, 20}, {1, 0, 1}};
+  auto b_1 = cudf::test::strings_column_wrapper({"result", "", "words"});
+
+  auto table_a = cudf::table_view{{a_0, a_1}};
+  auto table_b = cudf::table_view{{b_0, b_1}};
+
+  cudf::chunked_cross_join joiner(table_a, table_b, 5);
+  std::vector<std::unique_ptr<cudf::table>> chunks;
+  while (joiner.has_next()) { chunks.push_back(joiner.next()); }
+  EXPECT_THROW(joiner.next(), cudf::logic_error);
+
+  ASSERT_EQ(chunks.size(), 3u);
+  EXPECT_EQ(chunks[0]->num_rows(), 5);
+  EXPECT_EQ(chunks[1]->num_rows(), 5);
+  EXPECT_EQ(chunks[2]->num_rows(), 2);
+  std::vector<cudf::table_view> views;
+  for (auto const& chunk : chunks) { views.push_back(chunk->view()); }
+  cudf::test::expect_tables_equal(cudf::concatenate(views)->view(),
+                                  cudf::cross_join(table_a, table_b)->view());
+}
+
+TEST_F(ChunkedCrossJoinTest, Predicate)
+{
+  auto a_0 = column_wrapper<int32_t>{10, 20, 20, 50};
+  auto a_1 = cudf::test::strings_column_wrapper({"quick", "accénted", "turtlé", "composéd"});
+  auto b_0 = column_wrapper<int32_t>{10, 20, 20};
+  auto b_1 = cudf::test::strings_column_wrapper({"result", "", "words"});
+
+  auto table_a = cudf::table_view{{a_0, a_1}};
+  auto table_b = cudf::table_view{{b_0, b_1}};
+
+  // a_0 < b_0
+  cudf::column_reference left_key(0);
+  cudf::column_reference right_key(2);
+  cudf::binary_expression less(cudf::binary_operator::LESS, left_key, right_key);
+
+  cudf::chunked_cross_join joiner(table_a, table_b, 2, &less);
+  std::vector<std::unique_ptr<cudf::table>> chunks;
+  while (joiner.has_next()) { chunks.push_back(joiner.next()); }
+
+  // The windows after the second one have no selected row, and the last one is returned empty
+  ASSERT_EQ(chunks.size(), 3u);
+  EXPECT_EQ(chunks[0]->num_rows(), 1);
+  EXPECT_EQ(chunks[1]->num_rows(), 1);
+  EXPECT_EQ(chunks[2]->num_rows(), 0);
+  std::vector<cudf::table_view> views;
+  for (auto const& chunk : chunks) { views.push_back(chunk->view()); }
+
+  auto expect_0 = column_wrapper<int32_t>{10, 10};
+  auto expect_1 = cudf::test::strings_column_wrapper({"quick", "quick"});
+  auto expect_2 = column_wrapper<int32_t>{20, 20};
+  auto expect_3 = cudf::test::strings_column_wrapper({"", "words"});
+  cudf::test::expect_tables_equal(cudf::concatenate(views)->view(),
+                                  cudf::table_view{{expect_0, expect_1, expect_2, expect_3}});
+}
+
+TEST_F(ChunkedCrossJoinTest, InvalidInputs)
+{
+  auto a_0 = column_wrapper<int32_t>{10, 20};
+  auto b_0 = cudf::test::strings_column_wrapper({"result", "", "words"});
+
+  auto table_a = cudf::table_view{{a_0}};
+  auto table_b = cudf::table_view{{b_0}};
+  EXPECT_THROW(cudf::chunked_cross_join(table_a, table_b, 0), cudf::logic_error);
+
+  // Strings cannot be compared by an expression
+  cudf::column_reference left_key(0);
+  cudf::column_reference right_key(1);
+  cudf::binary_expression less(cudf::binary_operator::LESS, left_key, right_key);
+  EXPECT_THROW(cudf::chunked_cross_join(table_a, table_b, 4, &less), cudf::logic_error);
+}
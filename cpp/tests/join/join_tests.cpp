@@ -17,6 +17,7 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/join.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/table/table.hpp>
@@ -945,4 +946,209 @@ TEST_F(JoinTest, InnerJoinCornerCase)
   cudf::test::expect_tables_equal(*sorted_gold, *sorted_result);
 }
 
+void expect_gather_maps_equal(
+  std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> const& result,
+  column_wrapper<int32_t> const& gold_probe,
+  column_wrapper<int32_t> const& gold_build)
+{
+  cudf::table_view result_maps{{result.first->view(), result.second->view()}};
+  auto result_sort_order = cudf::sorted_order(result_maps);
+  auto sorted_result     = cudf::gather(result_maps, *result_sort_order);
+
+  cudf::table_view gold_maps{{gold_probe, gold_build}};
+  auto gold_sort_order = cudf::sorted_order(gold_maps);
+  auto sorted_gold     = cudf::gather(gold_maps, *gold_sort_order);
+  cudf::test::expect_tables_equal(*sorted_gold, *sorted_result);
+}
+
+TEST_F(JoinTest, HashJoinMultipleProbes)
+{
+  column_wrapper<int32_t> build_col0{{0, 1, 2, 2, 3}};
+  strcol_wrapper build_col1({"s0", "s1", "s2", "s2", "s3"});
+  cudf::table_view build{{build_col0, build_col1}};
+
+  cudf::hash_join hash_join(build, {0});
+
+  column_wrapper<int32_t> probe0_col0{{2, 4, 1}};
+  cudf::table_view probe0{{probe0_col0}};
+
+  expect_gather_maps_equal(hash_join.inner_join(probe0, {0}), {{0, 0, 2}}, {{2, 3, 1}});
+  expect_gather_maps_equal(hash_join.left_join(probe0, {0}), {{0, 0, 1, 2}}, {{2, 3, -1, 1}});
+  expect_gather_maps_equal(
+    hash_join.full_join(probe0, {0}), {{0, 0, 1, 2, -1, -1}}, {{2, 3, -1, 1, 0, 4}});
+
+  // The hash table is reused for another probe table
+  column_wrapper<int64_t> probe1_col0{{7, 7}};
+  column_wrapper<int32_t> probe1_col1{{3, 3}};
+  cudf::table_view probe1{{probe1_col0, probe1_col1}};
+
+  expect_gather_maps_equal(hash_join.inner_join(probe1, {1}), {{0, 1}}, {{4, 4}});
+  EXPECT_THROW(hash_join.inner_join(probe1, {0}), cudf::logic_error);
+}
+
+TEST_F(JoinTest, HashJoinEmptyBuild)
+{
+  column_wrapper<int32_t> build_col0{};
+  cudf::table_view build{{build_col0}};
+
+  cudf::hash_join hash_join(build, {0});
+
+  column_wrapper<int32_t> probe_col0{{2, 4}};
+  cudf::table_view probe{{probe_col0}};
+
+  expect_gather_maps_equal(hash_join.inner_join(probe, {0}), {}, {});
+  expect_gather_maps_equal(hash_join.left_join(probe, {0}), {{0, 1}}, {{-1, -1}});
+  expect_gather_maps_equal(hash_join.full_join(probe, {0}), {{0, 1}}, {{-1, -1}});
+}
+
+TEST_F(JoinTest, InnerJoinGatherMaps)
+{
+  column_wrapper<int32_t> left_col0{{3, 1, 2, 0, 2}};
+  strcol_wrapper left_col1({"s1", "s1", "s0", "s4", "s0"});
+  column_wrapper<int32_t> right_col0{{2, 2, 0, 4, 3}};
+  strcol_wrapper right_col1({"s1", "s0", "s1", "s2", "s1"});
+  cudf::table_view left{{left_col0, left_col1}};
+  cudf::table_view right{{right_col0, right_col1}};
+
+  expect_gather_maps_equal(cudf::inner_join(left, right), {{0, 2, 4}}, {{4, 1, 1}});
+  expect_gather_maps_equal(cudf::inner_join(left.select({0}), right.select({0})),
+                           {{0, 2, 2, 3, 4, 4}},
+                           {{4, 0, 1, 2, 0, 1}});
+}
+
+TEST_F(JoinTest, LeftJoinGatherMaps)
+{
+  column_wrapper<int32_t> left_col0{{0, 1, 2}};
+  column_wrapper<int32_t> right_col0{{1, 2, 3}};
+  column_wrapper<int32_t> right_col1{{10, 20, 30}};
+  cudf::table_view left{{left_col0}};
+  cudf::table_view right{{right_col0, right_col1}};
+
+  auto result = cudf::left_join(left, right.select({0}));
+  expect_gather_maps_equal(result, {{0, 1, 2}}, {{-1, 0, 1}});
+
+  // Gathering through an unsigned view of the map produces nulls for the unmatched rows
+  auto sort_order  = cudf::sorted_order(cudf::table_view{{result.first->view()}});
+  auto sorted_maps = cudf::gather(
+    cudf::table_view{{result.first->view(), result.second->view()}}, *sort_order);
+  auto const right_map = sorted_maps->get_column(1).view();
+  cudf::column_view unsigned_right_map{
+    cudf::data_type{cudf::type_id::UINT32}, right_map.size(), right_map.data<uint32_t>()};
+  auto gathered = cudf::gather(cudf::table_view{{right_col1}}, unsigned_right_map);
+
+  column_wrapper<int32_t> expected{{0, 10, 20}, {0, 1, 1}};
+  cudf::test::expect_columns_equal(expected, gathered->get_column(0));
+}
+
+TEST_F(JoinTest, FullJoinGatherMaps)
+{
+  column_wrapper<int32_t> left_col0{{0, 1, 2}};
+  column_wrapper<int32_t> right_col0{{1, 2, 3}};
+  cudf::table_view left{{left_col0}};
+  cudf::table_view right{{right_col0}};
+
+  expect_gather_maps_equal(cudf::full_join(left, right), {{0, 1, 2, -1}}, {{-1, 0, 1, 2}});
+}
+
+TEST_F(JoinTest, PartitionedJoinGatherMaps)
+{
+  column_wrapper<int32_t> left_col0{{3, 1, 2, 0, 2, 7, 5, 9}, {1, 1, 1, 1, 1, 0, 1, 1}};
+  strcol_wrapper left_col1({"s1", "s1", "s0", "s4", "s0", "s7", "s5", "s9"});
+  column_wrapper<int32_t> right_col0{{2, 2, 0, 4, 3, 6, 9, 8}, {1, 1, 1, 1, 1, 0, 1, 1}};
+  strcol_wrapper right_col1({"s0", "s0", "s1", "s2", "s1", "s7", "s9", "s8"});
+  cudf::table_view left{{left_col0, left_col1}};
+  cudf::table_view right{{right_col0, right_col1}};
+
+  auto const expect_same_maps = [](auto const& expected, auto const& result) {
+    cudf::table_view expected_maps{{expected.first->view(), expected.second->view()}};
+    cudf::table_view result_maps{{result.first->view(), result.second->view()}};
+    auto sorted_expected = cudf::gather(expected_maps, *cudf::sorted_order(expected_maps));
+    auto sorted_result   = cudf::gather(result_maps, *cudf::sorted_order(result_maps));
+    cudf::test::expect_tables_equal(*sorted_expected, *sorted_result);
+  };
+
+  for (cudf::size_type num_partitions : {0, 1, 3, 16}) {
+    for (auto compare_nulls : {cudf::null_equality::EQUAL, cudf::null_equality::UNEQUAL}) {
+      expect_same_maps(cudf::inner_join(left, right, compare_nulls),
+                       cudf::partitioned_inner_join(left, right, num_partitions, compare_nulls));
+      expect_same_maps(cudf::left_join(left, right, compare_nulls),
+                       cudf::partitioned_left_join(left, right, num_partitions, compare_nulls));
+      expect_same_maps(cudf::full_join(left, right, compare_nulls),
+                       cudf::partitioned_full_join(left, right, num_partitions, compare_nulls));
+    }
+  }
+}
+
+TEST_F(JoinTest, SortedJoinGatherMaps)
+{
+  column_wrapper<int32_t> left_col0{{0, 1, 2, 2, 3, 5, 7, 9}, {0, 1, 1, 1, 1, 1, 1, 1}};
+  strcol_wrapper left_col1({"s0", "s1", "s0", "s0", "s1", "s5", "s7", "s9"});
+  column_wrapper<int32_t> right_col0{{0, 0, 2, 2, 3, 4, 8, 9}, {0, 1, 1, 1, 1, 1, 1, 1}};
+  strcol_wrapper right_col1({"s0", "s0", "s0", "s0", "s1", "s2", "s8", "s9"});
+  cudf::table_view left{{left_col0, left_col1}};
+  cudf::table_view right{{right_col0, right_col1}};
+
+  // The sorted join returns its maps ordered by left row, then right row
+  {
+    auto result = cudf::sorted_inner_join(left, right);
+    cudf::test::expect_columns_equal(column_wrapper<int32_t>{0, 2, 2, 3, 3, 4, 7},
+                                     result.first->view());
+    cudf::test::expect_columns_equal(column_wrapper<int32_t>{0, 2, 3, 2, 3, 4, 7},
+                                     result.second->view());
+  }
+  {
+    auto result = cudf::sorted_left_join(left, right, {}, {}, cudf::null_equality::UNEQUAL);
+    cudf::test::expect_columns_equal(column_wrapper<int32_t>{0, 1, 2, 2, 3, 3, 4, 5, 6, 7},
+                                     result.first->view());
+    cudf::test::expect_columns_equal(column_wrapper<int32_t>{-1, -1, 2, 3, 2, 3, 4, -1, -1, 7},
+                                     result.second->view());
+  }
+
+  auto const expect_same_maps = [](auto const& expected, auto const& result) {
+    cudf::table_view expected_maps{{expected.first->view(), expected.second->view()}};
+    cudf::table_view result_maps{{result.first->view(), result.second->view()}};
+    auto sorted_expected = cudf::gather(expected_maps, *cudf::sorted_order(expected_maps));
+    auto sorted_result   = cudf::gather(result_maps, *cudf::sorted_order(result_maps));
+    cudf::test::expect_tables_equal(*sorted_expected, *sorted_result);
+  };
+
+  for (auto compare_nulls : {cudf::null_equality::EQUAL, cudf::null_equality::UNEQUAL}) {
+    expect_same_maps(cudf::inner_join(left, right, compare_nulls),
+                     cudf::sorted_inner_join(left, right, {}, {}, compare_nulls));
+    expect_same_maps(cudf::left_join(left, right, compare_nulls),
+                     cudf::sorted_left_join(left, right, {}, {}, compare_nulls));
+    expect_same_maps(cudf::full_join(left, right, compare_nulls),
+                     cudf::sorted_full_join(left, right, {}, {}, compare_nulls));
+  }
+}
+
+TEST_F(JoinTest, DictionaryJoinGatherMaps)
+{
+  strcol_wrapper left_strings({"s1", "s0", "s4", "s0"});
+  strcol_wrapper right_strings({"s2", "s1", "s3", "s0"});
+  auto left_col0  = cudf::dictionary::encode(left_strings);
+  auto right_col0 = cudf::dictionary::encode(right_strings);
+  cudf::table_view left{{left_col0->view()}};
+  cudf::table_view right{{right_col0->view()}};
+
+  // the keys of the two dictionaries differ so their indices are matched before joining
+  expect_gather_maps_equal(cudf::inner_join(left, right), {{0, 1, 3}}, {{1, 3, 3}});
+  expect_gather_maps_equal(cudf::left_join(left, right), {{0, 1, 2, 3}}, {{1, 3, -1, 3}});
+  expect_gather_maps_equal(
+    cudf::full_join(left, right), {{0, 1, 2, 3, -1, -1}}, {{1, 3, -1, 3, 0, 2}});
+  expect_gather_maps_equal(cudf::partitioned_inner_join(left, right, 3), {{0, 1, 3}}, {{1, 3, 3}});
+  expect_gather_maps_equal(cudf::sorted_inner_join(left, right), {{0, 1, 3}}, {{1, 3, 3}});
+
+  // the probe dictionary of a hash_join must have the keys of its build dictionary
+  cudf::hash_join hash_join(right, {0});
+  EXPECT_THROW(hash_join.inner_join(left, {0}), cudf::logic_error);
+  auto const probe = cudf::slice(right, {1, 4}).front();
+  expect_gather_maps_equal(hash_join.inner_join(probe, {0}), {{0, 1, 2}}, {{1, 2, 3}});
+  // equal keys stored in another column are accepted too
+  strcol_wrapper other_strings({"s3", "s0", "s1", "s2"});
+  auto other_col0 = cudf::dictionary::encode(other_strings);
+  cudf::table_view other{{other_col0->view()}};
+  expect_gather_maps_equal(hash_join.inner_join(other, {0}), {{0, 1, 2, 3}}, {{2, 3, 1, 0}});
+}
+
 CUDF_TEST_PROGRAM_MAIN()
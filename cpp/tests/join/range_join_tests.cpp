@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/join.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+template <typename T>
+using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
+using strcol_wrapper = cudf::test::strings_column_wrapper;
+
+struct RangeJoinTest : public cudf::test::BaseFixture {
+};
+
+namespace {
+// The order of the matches of a right row is unspecified, so compare the maps sorted by
+// (right, left)
+void expect_gather_maps_equal(
+  std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> const& result,
+  column_wrapper<int32_t> const& expected_left,
+  column_wrapper<int32_t> const& expected_right)
+{
+  cudf::table_view result_maps{{result.second->view(), result.first->view()}};
+  auto sorted_result = cudf::sort(result_maps);
+  cudf::test::expect_columns_equal(expected_right, sorted_result->get_column(0));
+  cudf::test::expect_columns_equal(expected_left, sorted_result->get_column(1));
+}
+}  // namespace
+
+TEST_F(RangeJoinTest, InequalityJoin)
+{
+  column_wrapper<int32_t> left{{3, 0, 2, 1, 4}, {1, 1, 1, 1, 0}};
+  column_wrapper<int32_t> right{{1, 2, 5}, {1, 0, 1}};
+
+  expect_gather_maps_equal(cudf::inequality_join(left, right, cudf::binary_operator::LESS),
+                           {1, 0, 1, 2, 3},
+                           {0, 2, 2, 2, 2});
+  expect_gather_maps_equal(cudf::inequality_join(left, right, cudf::binary_operator::LESS_EQUAL),
+                           {1, 3, 0, 1, 2, 3},
+                           {0, 0, 2, 2, 2, 2});
+  expect_gather_maps_equal(
+    cudf::inequality_join(left, right, cudf::binary_operator::GREATER), {0, 2}, {0, 0});
+  expect_gather_maps_equal(cudf::inequality_join(left, right, cudf::binary_operator::GREATER_EQUAL),
+                           {0, 2, 3},
+                           {0, 0, 0});
+  EXPECT_THROW(cudf::inequality_join(left, right, cudf::binary_operator::EQUAL), cudf::logic_error);
+}
+
+TEST_F(RangeJoinTest, RangeJoin)
+{
+  column_wrapper<int32_t> left{{5, 1, 3, 7, 3}, {1, 1, 1, 1, 0}};
+  column_wrapper<int32_t> lower{{0, 2, 6, 4, 0}, {1, 1, 1, 1, 0}};
+  column_wrapper<int32_t> upper{{3, 5, 9, 3, 9}, {1, 1, 1, 1, 1}};
+
+  // An empty range matches nothing, as does a range with a null bound
+  expect_gather_maps_equal(cudf::range_join(left, lower, upper), {1, 2, 0, 2, 3}, {0, 0, 1, 1, 2});
+}
+
+TEST_F(RangeJoinTest, RangeJoinEmpty)
+{
+  column_wrapper<int32_t> left{};
+  column_wrapper<int32_t> lower{0, 2};
+  column_wrapper<int32_t> upper{3, 5};
+
+  auto result = cudf::range_join(left, lower, upper);
+  EXPECT_EQ(0, result.first->size());
+  EXPECT_EQ(0, result.second->size());
+}
+
+TEST_F(RangeJoinTest, AsofJoin)
+{
+  strcol_wrapper left_by({"a", "a", "b", "b", "c", "a"});
+  column_wrapper<int32_t> left_on{2, 5, 5, 9, 1, 0};
+  strcol_wrapper right_by({"b", "a", "a", "b", "a"});
+  column_wrapper<int32_t> right_on{8, 4, 1, 6, 7};
+
+  auto result =
+    cudf::asof_join(cudf::table_view{{left_by}}, left_on, cudf::table_view{{right_by}}, right_on);
+  cudf::test::expect_columns_equal(column_wrapper<int32_t>{2, 1, -1, 0, -1, -1}, result->view());
+}
+
+TEST_F(RangeJoinTest, AsofJoinNoBy)
+{
+  column_wrapper<int32_t> left_on{{3, 10, 0, 6}, {1, 1, 1, 0}};
+  column_wrapper<int32_t> right_on{5, 1, 8};
+
+  auto result = cudf::asof_join(cudf::table_view{}, left_on, cudf::table_view{}, right_on);
+  cudf::test::expect_columns_equal(column_wrapper<int32_t>{1, 2, -1, -1}, result->view());
+}
+
+TEST_F(RangeJoinTest, AsofJoinMismatch)
+{
+  column_wrapper<int32_t> left_on{1, 2};
+  column_wrapper<int64_t> right_on{1, 2};
+
+  EXPECT_THROW(cudf::asof_join(cudf::table_view{}, left_on, cudf::table_view{}, right_on),
+               cudf::logic_error);
+}
@@ -691,3 +691,34 @@ TEST_F(JoinTest, LeftAntiJoin_empty_right_table)
   expect_columns_equal(join_table->get_column(2), expect_2);
   expect_columns_equal(join_table->get_column(3), expect_3);
 }
+
+TEST_F(JoinTest, LeftSemiAntiJoinGatherMapsAndMask)
+{
+  column_wrapper<int32_t> a_0{{0, 1, 2, 1, 4, 5}, {1, 1, 1, 1, 0, 1}};
+  cudf::test::strings_column_wrapper a_1({"a", "b", "c", "b", "", "d"});
+  column_wrapper<int32_t> b_0{{1, 2, 3, 2, 7}, {1, 1, 1, 1, 0}};
+  cudf::test::strings_column_wrapper b_1({"b", "x", "c", "b", ""});
+
+  cudf::table_view left_keys{{a_0, a_1}};
+  cudf::table_view right_keys{{b_0, b_1}};
+
+  // Rows (1, "b") match, (2, "c") does not; the row with a null key matches only if nulls are
+  // equal
+  expect_columns_equal(*cudf::left_semi_join_gather_map(left_keys, right_keys),
+                       column_wrapper<int32_t>{1, 3, 4});
+  expect_columns_equal(*cudf::left_anti_join_gather_map(left_keys, right_keys),
+                       column_wrapper<int32_t>{0, 2, 5});
+  expect_columns_equal(*cudf::left_semi_join_mask(left_keys, right_keys),
+                       column_wrapper<bool>{false, true, false, true, true, false});
+
+  auto const unequal = cudf::null_equality::UNEQUAL;
+  expect_columns_equal(*cudf::left_semi_join_gather_map(left_keys, right_keys, unequal),
+                       column_wrapper<int32_t>{1, 3});
+  expect_columns_equal(*cudf::left_anti_join_gather_map(left_keys, right_keys, unequal),
+                       column_wrapper<int32_t>{0, 2, 4, 5});
+  expect_columns_equal(*cudf::left_semi_join_mask(left_keys, right_keys, unequal),
+                       column_wrapper<bool>{false, true, false, true, false, false});
+
+  EXPECT_THROW(cudf::left_semi_join_gather_map(left_keys, cudf::table_view{{b_0}}),
+               cudf::logic_error);
+}
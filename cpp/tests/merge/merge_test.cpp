@@ -702,4 +702,32 @@ TYPED_TEST(MergeTest_, NMerge1KeyColumns)
   cudf::test::expect_columns_equal(expected_column_view2, output_column_view2);
 }
 
+struct MergeKWayTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(MergeKWayTest, StableWithNullsAndStrings)
+{
+  using cudf::test::fixed_width_column_wrapper;
+  using cudf::test::strings_column_wrapper;
+
+  fixed_width_column_wrapper<int32_t> keys0{{1, 3, 3, 0}, {1, 1, 1, 0}};
+  strings_column_wrapper vals0{"a0", "b0", "c0", "d0"};
+  fixed_width_column_wrapper<int32_t> keys1{0, 3, 5};
+  strings_column_wrapper vals1{"a1", "b1", "c1"};
+  fixed_width_column_wrapper<int32_t> keys2{{3, 0}, {1, 0}};
+  strings_column_wrapper vals2{"a2", "b2"};
+  std::vector<cudf::table_view> tables{cudf::table_view{{keys0, vals0}},
+                                       cudf::table_view{{keys1, vals1}},
+                                       cudf::table_view{{keys2, vals2}}};
+
+  auto result = cudf::merge(tables, {0}, {cudf::order::ASCENDING}, {cudf::null_order::AFTER});
+
+  // Rows with equal keys keep the order of their tables
+  fixed_width_column_wrapper<int32_t> expected_keys{{0, 1, 3, 3, 3, 3, 5, 0, 0},
+                                                    {1, 1, 1, 1, 1, 1, 1, 0, 0}};
+  strings_column_wrapper expected_vals{"a1", "a0", "b0", "c0", "b1", "a2", "c1", "d0", "b2"};
+  cudf::test::expect_columns_equal(expected_keys, result->view().column(0));
+  cudf::test::expect_columns_equal(expected_vals, result->view().column(1));
+}
+
 CUDF_TEST_PROGRAM_MAIN()
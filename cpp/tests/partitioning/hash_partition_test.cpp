@@ -23,6 +23,8 @@
 #include <tests/utilities/table_utilities.hpp>
 #include <tests/utilities/type_lists.hpp>
 
+#include <limits>
+
 using cudf::test::expect_columns_equal;
 using cudf::test::expect_table_properties_equal;
 using cudf::test::expect_tables_equal;
@@ -113,6 +115,100 @@ TEST_F(HashPartition, ZeroColumns)
   EXPECT_EQ(0, offsets.size());
 }
 
+TEST_F(HashPartition, XXHash64)
+{
+  fixed_width_column_wrapper<int32_t> integers({1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+  strings_column_wrapper strings({"a", "bb", "ccc", "d", "ee", "fff", "gg", "h", "ii", "j"});
+  auto input = cudf::table_view({integers, strings});
+
+  auto columns_to_hash = std::vector<cudf::size_type>({0, 1});
+
+  for (cudf::size_type num_partitions : {3, 4}) {
+    std::unique_ptr<cudf::table> output;
+    std::vector<cudf::size_type> offsets;
+    std::tie(output, offsets) =
+      cudf::hash_partition(input, columns_to_hash, num_partitions, cudf::hash_id::HASH_XXHASH64);
+    EXPECT_EQ(static_cast<size_t>(num_partitions), offsets.size());
+
+    // Each row is in the partition of its 64-bit hash value
+    auto const hashes = cudf::hash(output->view(), cudf::hash_id::HASH_XXHASH64);
+    EXPECT_EQ(cudf::type_id::UINT64, hashes->type().id());
+    auto const h_hashes = cudf::test::to_host<uint64_t>(hashes->view()).first;
+    offsets.push_back(output->num_rows());
+    for (cudf::size_type partition = 0; partition < num_partitions; ++partition) {
+      for (auto row = offsets[partition]; row < offsets[partition + 1]; ++row) {
+        EXPECT_EQ(static_cast<uint64_t>(partition), h_hashes[row] % num_partitions);
+      }
+    }
+  }
+}
+
+TEST_F(HashPartition, SparkMurmur3AndHive)
+{
+  fixed_width_column_wrapper<int32_t> integers({1, -2, 3, -4, 5, -6, 7, -8, 9, -10});
+  strings_column_wrapper strings({"a", "bb", "ccc", "d", "ee", "fff", "gg", "h", "ii", "j"});
+  auto input = cudf::table_view({integers, strings});
+
+  auto columns_to_hash = std::vector<cudf::size_type>({0, 1});
+
+  for (auto hash_function : {cudf::hash_id::HASH_SPARK_MURMUR3, cudf::hash_id::HASH_HIVE}) {
+    for (cudf::size_type num_partitions : {3, 4}) {
+      std::unique_ptr<cudf::table> output;
+      std::vector<cudf::size_type> offsets;
+      std::tie(output, offsets) =
+        cudf::hash_partition(input, columns_to_hash, num_partitions, hash_function);
+      EXPECT_EQ(static_cast<size_t>(num_partitions), offsets.size());
+
+      // Spark's partition is the non-negative remainder of the hash value and Hive's bucket the
+      // remainder of the hash value without its sign bit
+      auto const hashes   = cudf::hash(output->view(), hash_function);
+      auto const h_hashes = cudf::test::to_host<int32_t>(hashes->view()).first;
+      offsets.push_back(output->num_rows());
+      for (cudf::size_type partition = 0; partition < num_partitions; ++partition) {
+        for (auto row = offsets[partition]; row < offsets[partition + 1]; ++row) {
+          auto const hash = h_hashes[row];
+          auto const expected =
+            hash_function == cudf::hash_id::HASH_HIVE
+              ? (hash & std::numeric_limits<int32_t>::max()) % num_partitions
+              : ((hash % num_partitions) + num_partitions) % num_partitions;
+          EXPECT_EQ(partition, expected);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(HashPartition, Packed)
+{
+  fixed_width_column_wrapper<int32_t> integers({1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+                                               {1, 1, 0, 1, 1, 1, 1, 0, 1, 1});
+  fixed_width_column_wrapper<int64_t> longs({10, 20, 30, 40, 50, 60, 70, 80, 90, 100});
+  strings_column_wrapper strings({"a", "bb", "", "d", "ee", "fff", "gg", "h", "ii", "j"},
+                                 {1, 1, 1, 0, 1, 1, 1, 1, 1, 1});
+  auto input = cudf::table_view({integers, longs, strings});
+
+  auto columns_to_hash = std::vector<cudf::size_type>({1, 2});
+
+  for (cudf::size_type num_partitions : {3, 4, 16}) {
+    std::unique_ptr<cudf::table> output;
+    std::vector<cudf::size_type> offsets;
+    std::tie(output, offsets) = cudf::hash_partition(input, columns_to_hash, num_partitions);
+    auto const expected =
+      cudf::split(output->view(), std::vector<cudf::size_type>(offsets.begin() + 1, offsets.end()));
+
+    auto const packed = cudf::hash_partition_packed(input, columns_to_hash, num_partitions);
+    ASSERT_EQ(static_cast<size_t>(num_partitions), packed.size());
+
+    // Each partition has the same rows as in hash_partition, in any order
+    for (cudf::size_type partition = 0; partition < num_partitions; ++partition) {
+      expect_tables_equal(cudf::sort(packed[partition].table)->view(),
+                          cudf::sort(expected[partition])->view());
+    }
+  }
+
+  EXPECT_TRUE(cudf::hash_partition_packed(input, columns_to_hash, 0).empty());
+}
+
 TEST_F(HashPartition, MixedColumnTypes)
 {
   fixed_width_column_wrapper<float> floats({1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f});
@@ -200,4 +200,65 @@ TYPED_TEST(PartitionTest, EmptyPartitions)
   auto expected_partitioned_table = cudf::table_view{{expected_first, expected_strings}};
 
   run_partition_test(table_to_partition, map, 5, expected_partitioned_table, expected_offsets);
-}
\ No newline at end of file
+}
+struct RangePartitionTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(RangePartitionTest, Splitters)
+{
+  fixed_width_column_wrapper<int32_t> first{5, 1, 9, 3, 7, 3};
+  strings_column_wrapper strings{"this", "is", "a", "column", "of", "strings"};
+  auto table_to_partition = cudf::table_view{{first, strings}};
+
+  // rows equal to a splitter are in the partition ending at it
+  fixed_width_column_wrapper<int32_t> splitters{3, 7};
+  auto result = cudf::range_partition(
+    cudf::table_view{{first}}, cudf::table_view{{splitters}}, {cudf::order::ASCENDING}, {});
+  std::vector<cudf::size_type> expected_offsets{0, 3, 5, 6};
+  EXPECT_EQ(result.second, expected_offsets);
+
+  fixed_width_column_wrapper<int32_t> expected_first{1, 3, 3, 5, 7, 9};
+  expect_equal_partitions(
+    cudf::table_view{{expected_first}}, result.first->view(), expected_offsets);
+
+  EXPECT_THROW(cudf::range_partition(table_to_partition,
+                                     cudf::table_view{{splitters}},
+                                     {cudf::order::ASCENDING},
+                                     {}),
+               cudf::logic_error);
+}
+
+TEST_F(RangePartitionTest, DescendingWithNulls)
+{
+  fixed_width_column_wrapper<int32_t> first({5, 1, 0, 9, 3, 0}, {1, 1, 0, 1, 1, 0});
+  strings_column_wrapper strings{"this", "is", "a", "column", "of", "strings"};
+  auto table_to_partition = cudf::table_view{{first, strings}};
+
+  std::vector<cudf::order> const column_order{cudf::order::DESCENDING};
+  std::vector<cudf::null_order> const null_precedence{cudf::null_order::BEFORE};
+  fixed_width_column_wrapper<int32_t> splitters{5, 2};
+  auto result = cudf::range_partition(table_to_partition.select({0}),
+                                      cudf::table_view{{splitters}},
+                                      column_order,
+                                      null_precedence);
+  std::vector<cudf::size_type> expected_offsets{0, 4, 5, 6};
+  EXPECT_EQ(result.second, expected_offsets);
+
+  fixed_width_column_wrapper<int32_t> expected_first({0, 0, 9, 5, 3, 1}, {0, 0, 1, 1, 1, 1});
+  expect_equal_partitions(
+    cudf::table_view{{expected_first}}, result.first->view(), expected_offsets);
+}
+
+TEST_F(RangePartitionTest, SplittersFromSample)
+{
+  fixed_width_column_wrapper<int32_t> sample{70, 10, 40, 20, 80, 50, 30, 60};
+  auto const splitters = cudf::range_partition_splitters(
+    cudf::table_view{{sample}}, 4, {cudf::order::ASCENDING}, {});
+  fixed_width_column_wrapper<int32_t> expected{30, 50, 70};
+  cudf::test::expect_columns_equal(splitters->get_column(0), expected);
+
+  fixed_width_column_wrapper<int32_t> empty{};
+  EXPECT_EQ(0, cudf::range_partition_splitters(cudf::table_view{{empty}}, 4, {}, {})->num_rows());
+  EXPECT_THROW(cudf::range_partition_splitters(cudf::table_view{{sample}}, 0, {}, {}),
+               cudf::logic_error);
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+using cudf::test::expect_tables_equal;
+using cudf::test::fixed_width_column_wrapper;
+using cudf::test::strings_column_wrapper;
+
+/**
+ * @brief Communicator of one rank of a group, which receives `peer_table` from every other
+ * rank and keeps the tables it sends.
+ */
+class test_communicator : public cudf::shuffle_communicator {
+ public:
+  test_communicator(int rank, int size, cudf::table_view const& peer_table)
+    : sent(size), _rank{rank}, _size{size}, _peer_table{peer_table}
+  {
+  }
+
+  int rank() const override { return _rank; }
+  int size() const override { return _size; }
+
+  void send(int destination,
+            std::vector<uint8_t> const& metadata,
+            rmm::device_buffer const& gpu_data,
+            cudaStream_t stream) override
+  {
+    sent[destination] =
+      cudf::packed_columns{std::make_unique<std::vector<uint8_t>>(metadata),
+                           std::make_unique<rmm::device_buffer>(gpu_data, stream)};
+  }
+
+  cudf::packed_columns recv(int source,
+                            rmm::mr::device_memory_resource* mr,
+                            cudaStream_t stream) override
+  {
+    EXPECT_NE(source, _rank);
+    return cudf::pack(_peer_table, mr);
+  }
+
+  void synchronize() override { ++synchronized; }
+
+  std::vector<cudf::packed_columns> sent;
+  int synchronized{0};
+
+ private:
+  int _rank;
+  int _size;
+  cudf::table_view _peer_table;
+};
+
+struct ShuffleTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ShuffleTest, TwoRanks)
+{
+  fixed_width_column_wrapper<int32_t> integers({1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+                                               {1, 1, 1, 0, 1, 1, 1, 1, 1, 1});
+  strings_column_wrapper strings({"a", "bb", "ccc", "d", "ee", "fff", "gg", "h", "ii", "j"});
+  auto input = cudf::table_view({integers, strings});
+
+  fixed_width_column_wrapper<int32_t> peer_integers({100, 101});
+  strings_column_wrapper peer_strings({"x", "yy"});
+  auto peer_table = cudf::table_view({peer_integers, peer_strings});
+
+  std::vector<cudf::size_type> const columns_to_hash({0});
+  auto const partitions = cudf::hash_partition_packed(input, columns_to_hash, 2);
+
+  for (int rank : {0, 1}) {
+    test_communicator communicator(rank, 2, peer_table);
+    auto const result = cudf::shuffle(input, columns_to_hash, communicator);
+
+    // this rank keeps its own partition and gets the rows of the other rank
+    auto const expected = cudf::concatenate(
+      rank == 0 ? std::vector<cudf::table_view>{partitions[0].table, peer_table}
+                : std::vector<cudf::table_view>{peer_table, partitions[1].table});
+    expect_tables_equal(cudf::sort(result->view())->view(), cudf::sort(expected->view())->view());
+
+    // and sends the other partition to the other rank
+    auto const other = 1 - rank;
+    ASSERT_NE(communicator.sent[other].metadata, nullptr);
+    EXPECT_EQ(communicator.sent[rank].metadata, nullptr);
+    expect_tables_equal(cudf::sort(cudf::unpack(communicator.sent[other]))->view(),
+                        cudf::sort(partitions[other].table)->view());
+    EXPECT_EQ(1, communicator.synchronized);
+  }
+}
+
+TEST_F(ShuffleTest, SingleRank)
+{
+  fixed_width_column_wrapper<int32_t> integers({3, 1, 2});
+  auto input = cudf::table_view({integers});
+
+  test_communicator communicator(0, 1, input);
+  auto const result = cudf::shuffle(input, {0}, communicator);
+  expect_tables_equal(cudf::sort(result->view())->view(), cudf::sort(input)->view());
+
+  EXPECT_THROW(cudf::shuffle(input, {}, communicator), cudf::logic_error);
+}
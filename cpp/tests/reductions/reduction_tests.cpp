@@ -18,6 +18,7 @@
 #include <vector>
 
 #include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
 #include <tests/utilities/column_wrapper.hpp>
 #include <tests/utilities/type_lists.hpp>
 
@@ -651,6 +652,174 @@ TEST_F(ReductionErrorTest, empty_column)
   CUDF_EXPECT_NO_THROW(statement(col_empty));
 }
 
+struct MultiReductionTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(MultiReductionTest, MatchesSingleReductions)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col{{-3, 2, 1, 0, 5, -3, -2, 28},
+                                                      {1, 1, 0, 1, 1, 1, 0, 1}};
+  auto const output_dtype = cudf::data_type(cudf::type_id::FLOAT64);
+
+  std::vector<std::unique_ptr<aggregation>> aggs;
+  aggs.push_back(cudf::make_count_aggregation());
+  aggs.push_back(cudf::make_count_aggregation(cudf::null_policy::INCLUDE));
+  aggs.push_back(cudf::make_min_aggregation());
+  aggs.push_back(cudf::make_max_aggregation());
+  aggs.push_back(cudf::make_sum_aggregation());
+  aggs.push_back(cudf::make_sum_of_squares_aggregation());
+  aggs.push_back(cudf::make_mean_aggregation());
+  aggs.push_back(cudf::make_variance_aggregation(2));
+  aggs.push_back(cudf::make_std_aggregation());
+  aggs.push_back(cudf::make_median_aggregation());
+
+  auto const results = cudf::reduce(col, aggs, output_dtype);
+  ASSERT_EQ(results.size(), aggs.size());
+
+  using count_scalar = cudf::scalar_type_t<cudf::size_type>;
+  EXPECT_EQ(static_cast<count_scalar *>(results[0].get())->value(), 6);
+  EXPECT_EQ(static_cast<count_scalar *>(results[1].get())->value(), 8);
+
+  using result_scalar = cudf::scalar_type_t<double>;
+  for (size_t i = 2; i < aggs.size(); ++i) {
+    auto const expected = cudf::reduce(col, aggs[i], output_dtype);
+    EXPECT_TRUE(results[i]->is_valid());
+    EXPECT_DOUBLE_EQ(static_cast<result_scalar *>(results[i].get())->value(),
+                     static_cast<result_scalar *>(expected.get())->value());
+  }
+}
+
+TEST_F(MultiReductionTest, AllNull)
+{
+  std::vector<int32_t> col_data(5);
+  std::vector<bool> valids(5, 0);
+  cudf::test::fixed_width_column_wrapper<int32_t> col = construct_null_column(col_data, valids);
+
+  std::vector<std::unique_ptr<aggregation>> aggs;
+  aggs.push_back(cudf::make_count_aggregation());
+  aggs.push_back(cudf::make_sum_aggregation());
+  aggs.push_back(cudf::make_mean_aggregation());
+
+  auto const results = cudf::reduce(col, aggs, cudf::data_type(cudf::type_id::FLOAT64));
+  EXPECT_EQ(static_cast<cudf::scalar_type_t<cudf::size_type> *>(results[0].get())->value(), 0);
+  EXPECT_FALSE(results[1]->is_valid());
+  EXPECT_FALSE(results[2]->is_valid());
+}
+
+TEST_F(MultiReductionTest, TableReduction)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col0{{-3, 2, 1, 0}, {1, 1, 0, 1}};
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{{5, -3, -2, 28}, {0, 0, 0, 0}};
+  cudf::test::fixed_width_column_wrapper<int32_t> col2{7, 8};
+  cudf::table_view input{{col0, col1, col2}};
+
+  auto const results =
+    cudf::reduce(input, cudf::make_sum_aggregation(), cudf::data_type(cudf::type_id::INT64));
+
+  cudf::test::fixed_width_column_wrapper<int64_t> expected{{-1, 0, 15}, {1, 0, 1}};
+  cudf::test::expect_columns_equal(*results, expected);
+
+  // The results are read together
+  auto const values = cudf::get_elements(*results, {0, 2});
+  EXPECT_EQ(values.element<int64_t>(0), -1);
+  EXPECT_EQ(values.element<int64_t>(1), 15);
+}
+
+struct SparseNullReductionTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(SparseNullReductionTest, SlicedColumn)
+{
+  // Mostly null words, a run of all valid words and a partially valid last word, the slice
+  // offset not aligned to the words of the null mask
+  cudf::size_type const size = 300;
+  auto const is_valid        = [](cudf::size_type i) {
+    return i % 10 == 3 || (i >= 96 && i < 192);
+  };
+  std::vector<int64_t> values(size);
+  std::vector<bool> valids(size);
+  for (cudf::size_type i = 0; i < size; ++i) {
+    values[i] = (i % 7) - 3;
+    valids[i] = is_valid(i);
+  }
+  auto const col    = construct_null_column(values, valids);
+  auto const sliced = cudf::slice(col, {5, 290}).front();
+
+  int64_t sum = 0, min = 4, max = -4;
+  int count = 0;
+  for (cudf::size_type i = 5; i < 290; ++i) {
+    if (not valids[i]) continue;
+    sum += values[i];
+    min = std::min(min, values[i]);
+    max = std::max(max, values[i]);
+    ++count;
+  }
+  double const mean = static_cast<double>(sum) / count;
+  double var        = 0;
+  for (cudf::size_type i = 5; i < 290; ++i) {
+    if (valids[i]) var += (values[i] - mean) * (values[i] - mean);
+  }
+  var /= count - 1;
+
+  auto const int64_type   = cudf::data_type(cudf::type_id::INT64);
+  auto const float64_type = cudf::data_type(cudf::type_id::FLOAT64);
+  using int64_scalar      = cudf::scalar_type_t<int64_t>;
+  using float64_scalar    = cudf::scalar_type_t<double>;
+  auto const reduce       = [&](std::unique_ptr<aggregation> const &agg, cudf::data_type type) {
+    return cudf::reduce(sliced, agg, type);
+  };
+  auto result = reduce(cudf::make_sum_aggregation(), int64_type);
+  EXPECT_EQ(static_cast<int64_scalar *>(result.get())->value(), sum);
+  result = reduce(cudf::make_min_aggregation(), int64_type);
+  EXPECT_EQ(static_cast<int64_scalar *>(result.get())->value(), min);
+  result = reduce(cudf::make_max_aggregation(), int64_type);
+  EXPECT_EQ(static_cast<int64_scalar *>(result.get())->value(), max);
+  result = reduce(cudf::make_mean_aggregation(), float64_type);
+  EXPECT_DOUBLE_EQ(static_cast<float64_scalar *>(result.get())->value(), mean);
+  result = reduce(cudf::make_variance_aggregation(), float64_type);
+  EXPECT_DOUBLE_EQ(static_cast<float64_scalar *>(result.get())->value(), var);
+}
+
+struct QuantileReductionTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(QuantileReductionTest, SignedFloatingPoint)
+{
+  cudf::test::fixed_width_column_wrapper<double> col{{-1.5, 4., 9., -7.25, 0., 2.5},
+                                                     {1, 1, 0, 1, 1, 1}};
+  auto const output_dtype = cudf::data_type(cudf::type_id::FLOAT64);
+  using result_scalar     = cudf::scalar_type_t<double>;
+
+  // sorted valid values: {-7.25, -1.5, 0., 2.5, 4.}
+  auto const median = cudf::reduce(col, cudf::make_median_aggregation(), output_dtype);
+  EXPECT_TRUE(median->is_valid());
+  EXPECT_DOUBLE_EQ(static_cast<result_scalar *>(median.get())->value(), 0.);
+
+  auto const lower = cudf::reduce(
+    col, cudf::make_quantile_aggregation({0.375}, cudf::interpolation::LINEAR), output_dtype);
+  EXPECT_DOUBLE_EQ(static_cast<result_scalar *>(lower.get())->value(), -0.75);
+
+  auto const highest = cudf::reduce(
+    col, cudf::make_quantile_aggregation({1.}, cudf::interpolation::HIGHER), output_dtype);
+  EXPECT_DOUBLE_EQ(static_cast<result_scalar *>(highest.get())->value(), 4.);
+}
+
+TEST_F(QuantileReductionTest, Int64Extremes)
+{
+  auto const min = std::numeric_limits<int64_t>::min();
+  auto const max = std::numeric_limits<int64_t>::max();
+  cudf::test::fixed_width_column_wrapper<int64_t> col{max, -1, min, 1, 0};
+  auto const output_dtype = cudf::data_type(cudf::type_id::FLOAT64);
+  using result_scalar     = cudf::scalar_type_t<double>;
+
+  auto const lowest = cudf::reduce(
+    col, cudf::make_quantile_aggregation({0.}, cudf::interpolation::LOWER), output_dtype);
+  EXPECT_DOUBLE_EQ(static_cast<result_scalar *>(lowest.get())->value(), static_cast<double>(min));
+
+  auto const median = cudf::reduce(col, cudf::make_median_aggregation(), output_dtype);
+  EXPECT_DOUBLE_EQ(static_cast<result_scalar *>(median.get())->value(), 0.);
+}
+
 // ----------------------------------------------------------------------------
 
 struct ReductionParamTest : public ReductionTest<double>,
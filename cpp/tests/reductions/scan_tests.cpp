@@ -469,3 +469,44 @@ TYPED_TEST(ScanTest, EmptyColumnskip_nulls)
   cudf::test::expect_column_properties_equal(expected_col_out2, col_out->view());
   cudf::test::expect_columns_equal(expected_col_out2, col_out->view());
 }
+
+struct SegmentedScanTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(SegmentedScanTest, Sum)
+{
+  // segments: {1, 2, NULL, 4}, {}, {5, 6}, {NULL, 8}
+  cudf::test::fixed_width_column_wrapper<int32_t> values{{1, 2, 0, 4, 5, 6, 0, 8},
+                                                         {1, 1, 0, 1, 1, 1, 0, 1}};
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> offsets{0, 4, 4, 6, 8};
+
+  auto result = cudf::segmented_scan(
+    values, offsets, cudf::make_sum_aggregation(), scan_type::INCLUSIVE, null_policy::EXCLUDE);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected{{1, 3, 0, 7, 5, 11, 0, 8},
+                                                           {1, 1, 0, 1, 1, 1, 0, 1}};
+  cudf::test::expect_columns_equal(expected, *result);
+
+  result = cudf::segmented_scan(
+    values, offsets, cudf::make_sum_aggregation(), scan_type::INCLUSIVE, null_policy::INCLUDE);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_include{{1, 3, 0, 0, 5, 11, 0, 0},
+                                                                   {1, 1, 0, 0, 1, 1, 0, 0}};
+  cudf::test::expect_columns_equal(expected_include, *result);
+
+  result = cudf::segmented_scan(
+    values, offsets, cudf::make_sum_aggregation(), scan_type::EXCLUSIVE, null_policy::EXCLUDE);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_exclusive{{0, 1, 0, 3, 0, 5, 0, 0},
+                                                                     {1, 1, 0, 1, 1, 1, 0, 1}};
+  cudf::test::expect_columns_equal(expected_exclusive, *result);
+}
+
+TEST_F(SegmentedScanTest, MaxMatchesScanOfOneSegment)
+{
+  cudf::test::fixed_width_column_wrapper<double> values{{1.5, -2.0, 4.0, 3.0, 0.0, 7.5},
+                                                        {1, 1, 1, 1, 0, 1}};
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> offsets{0, 6};
+
+  auto result =
+    cudf::segmented_scan(values, offsets, cudf::make_max_aggregation(), scan_type::INCLUSIVE);
+  auto expected = cudf::scan(values, cudf::make_max_aggregation(), scan_type::INCLUSIVE);
+  cudf::test::expect_columns_equal(*expected, *result);
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/reduction.hpp>
+
+template <typename T>
+struct SegmentedReductionTest : public cudf::test::BaseFixture {
+};
+
+using SegmentedReductionTypes = cudf::test::Types<int8_t, int32_t, int64_t, float, double>;
+TYPED_TEST_CASE(SegmentedReductionTest, SegmentedReductionTypes);
+
+TYPED_TEST(SegmentedReductionTest, SumMinMax)
+{
+  using T = TypeParam;
+  // segments: {1, 2, 3}, {}, {4, NULL}, {NULL}, {5}
+  cudf::test::fixed_width_column_wrapper<T> values{{1, 2, 3, 4, 0, 0, 5},
+                                                   {1, 1, 1, 1, 0, 0, 1}};
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> offsets{0, 3, 3, 5, 6, 7};
+  auto const dtype = cudf::data_type{cudf::type_to_id<T>()};
+
+  auto sum = cudf::segmented_reduce(values, offsets, cudf::make_sum_aggregation(), dtype);
+  cudf::test::fixed_width_column_wrapper<T> expected_sum{{6, 0, 4, 0, 5}, {1, 0, 1, 0, 1}};
+  cudf::test::expect_columns_equal(expected_sum, *sum);
+
+  auto min = cudf::segmented_reduce(values, offsets, cudf::make_min_aggregation(), dtype);
+  cudf::test::fixed_width_column_wrapper<T> expected_min{{1, 0, 4, 0, 5}, {1, 0, 1, 0, 1}};
+  cudf::test::expect_columns_equal(expected_min, *min);
+
+  auto max = cudf::segmented_reduce(values, offsets, cudf::make_max_aggregation(), dtype);
+  cudf::test::fixed_width_column_wrapper<T> expected_max{{3, 0, 4, 0, 5}, {1, 0, 1, 0, 1}};
+  cudf::test::expect_columns_equal(expected_max, *max);
+}
+
+struct SegmentedReductionListsTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(SegmentedReductionListsTest, AnyAll)
+{
+  using LCW = cudf::test::lists_column_wrapper<int32_t>;
+  LCW input{{0, 1}, {1, 1, 1}, {0}, LCW{}};
+  auto const bool_dtype = cudf::data_type{cudf::type_id::BOOL8};
+
+  auto any = cudf::segmented_reduce(
+    cudf::lists_column_view{input}, cudf::make_any_aggregation(), bool_dtype);
+  cudf::test::fixed_width_column_wrapper<bool> expected_any{{true, true, false, false},
+                                                            {1, 1, 1, 0}};
+  cudf::test::expect_columns_equal(expected_any, *any);
+
+  auto all = cudf::segmented_reduce(
+    cudf::lists_column_view{input}, cudf::make_all_aggregation(), bool_dtype);
+  cudf::test::fixed_width_column_wrapper<bool> expected_all{{false, true, false, false},
+                                                            {1, 1, 1, 0}};
+  cudf::test::expect_columns_equal(expected_all, *all);
+
+  EXPECT_THROW(cudf::segmented_reduce(cudf::lists_column_view{input},
+                                      cudf::make_any_aggregation(),
+                                      cudf::data_type{cudf::type_id::INT32}),
+               cudf::logic_error);
+}
+
+TEST_F(SegmentedReductionListsTest, SlicedNullableLists)
+{
+  using LCW   = cudf::test::lists_column_wrapper<int64_t>;
+  auto valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i != 2; });
+  // {{1, 2}, {3, 4, 5}, NULL, {6}, {7, 8}}
+  LCW input{{{1, 2}, {3, 4, 5}, LCW{}, {6}, {7, 8}}, valids};
+  auto const sliced = cudf::slice(input, {1, 4})[0];
+
+  auto sum = cudf::segmented_reduce(cudf::lists_column_view{sliced},
+                                    cudf::make_sum_aggregation(),
+                                    cudf::data_type{cudf::type_id::INT64});
+  cudf::test::fixed_width_column_wrapper<int64_t> expected{{12, 0, 6}, {1, 0, 1}};
+  cudf::test::expect_columns_equal(expected, *sum);
+}
+
+TEST_F(SegmentedReductionListsTest, Errors)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> values{1, 2, 3};
+  cudf::test::fixed_width_column_wrapper<int64_t> offsets{0, 1, 3};
+  EXPECT_THROW(cudf::segmented_reduce(values,
+                                      offsets,
+                                      cudf::make_sum_aggregation(),
+                                      cudf::data_type{cudf::type_id::INT32}),
+               cudf::logic_error);
+
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> good_offsets{0, 1, 3};
+  EXPECT_THROW(cudf::segmented_reduce(values,
+                                      good_offsets,
+                                      cudf::make_mean_aggregation(),
+                                      cudf::data_type{cudf::type_id::FLOAT64}),
+               cudf::logic_error);
+}
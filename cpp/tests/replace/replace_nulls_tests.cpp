@@ -21,11 +21,13 @@
 
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/utilities/error.hpp>
 #include <tests/utilities/base_fixture.hpp>
 #include <tests/utilities/column_utilities.hpp>
 #include <tests/utilities/column_wrapper.hpp>
 #include <tests/utilities/cudf_gtest.hpp>
+#include <tests/utilities/table_utilities.hpp>
 #include <tests/utilities/type_lists.hpp>
 
 struct ReplaceErrorTest : public cudf::test::BaseFixture {
@@ -297,4 +299,82 @@ TYPED_TEST(ReplaceNullsTest, LargeScaleScalar)
                                   expectedColumn.begin(), expectedColumn.end()));
 }
 
+template <typename T>
+struct ReplaceNullsPolicyTest : public cudf::test::BaseFixture {
+};
+
+TYPED_TEST_CASE(ReplaceNullsPolicyTest, cudf::test::FixedWidthTypes);
+
+TYPED_TEST(ReplaceNullsPolicyTest, Preceding)
+{
+  cudf::test::fixed_width_column_wrapper<TypeParam> input({0, 1, 2, 3, 4, 5, 6, 7},
+                                                          {0, 1, 0, 0, 1, 0, 1, 0});
+  cudf::test::fixed_width_column_wrapper<TypeParam> expected({0, 1, 1, 1, 4, 4, 6, 6},
+                                                             {0, 1, 1, 1, 1, 1, 1, 1});
+
+  auto result = cudf::replace_nulls(input, cudf::replace_policy::PRECEDING, mr());
+  cudf::test::expect_columns_equal(expected, *result);
+}
+
+TYPED_TEST(ReplaceNullsPolicyTest, Following)
+{
+  cudf::test::fixed_width_column_wrapper<TypeParam> input({0, 1, 2, 3, 4, 5, 6, 7},
+                                                          {0, 1, 0, 0, 1, 0, 1, 0});
+  cudf::test::fixed_width_column_wrapper<TypeParam> expected({1, 1, 4, 4, 4, 6, 6, 7},
+                                                             {1, 1, 1, 1, 1, 1, 1, 0});
+
+  auto result = cudf::replace_nulls(input, cudf::replace_policy::FOLLOWING, mr());
+  cudf::test::expect_columns_equal(expected, *result);
+}
+
+struct ReplaceNullsPolicyStringsTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ReplaceNullsPolicyStringsTest, Strings)
+{
+  cudf::test::strings_column_wrapper input({"a", "", "", "d", ""}, {1, 0, 0, 1, 0});
+  cudf::test::strings_column_wrapper preceding({"a", "a", "a", "d", "d"});
+  cudf::test::strings_column_wrapper following({"a", "d", "d", "d", ""}, {1, 1, 1, 1, 0});
+
+  cudf::test::expect_columns_equal(preceding,
+                                   *cudf::replace_nulls(input, cudf::replace_policy::PRECEDING));
+  cudf::test::expect_columns_equal(following,
+                                   *cudf::replace_nulls(input, cudf::replace_policy::FOLLOWING));
+}
+
+struct ReplaceNullsTableTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ReplaceNullsTableTest, ScalarPerColumn)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints({1, 2, 3, 4}, {1, 0, 1, 0});
+  cudf::test::fixed_width_column_wrapper<double> doubles({1.5, 2.5, 3.5, 4.5}, {0, 1, 1, 1});
+  cudf::test::strings_column_wrapper strings({"a", "", "c", ""}, {1, 0, 1, 0});
+  cudf::numeric_scalar<int32_t> int_replacement(-1);
+  cudf::numeric_scalar<double> double_replacement(0.5);
+  cudf::string_scalar string_replacement("z");
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_ints({1, -1, 3, -1});
+  cudf::test::fixed_width_column_wrapper<double> expected_doubles({0.5, 2.5, 3.5, 4.5});
+  cudf::test::strings_column_wrapper expected_strings({"a", "z", "c", "z"});
+
+  auto result = cudf::replace_nulls(cudf::table_view{{ints, doubles, strings}},
+                                    {int_replacement, double_replacement, string_replacement},
+                                    mr());
+  cudf::test::expect_tables_equal(
+    cudf::table_view{{expected_ints, expected_doubles, expected_strings}}, *result);
+}
+
+TEST_F(ReplaceNullsTableTest, ReplacementsMismatch)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints({1, 2, 3, 4}, {1, 0, 1, 0});
+  cudf::numeric_scalar<int32_t> int_replacement(-1);
+  cudf::numeric_scalar<float> float_replacement(1);
+
+  EXPECT_THROW(cudf::replace_nulls(cudf::table_view{{ints, ints}}, {int_replacement}, mr()),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::replace_nulls(cudf::table_view{{ints}}, {float_replacement}, mr()),
+               cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -21,6 +21,7 @@
 #include <tests/utilities/type_list_utilities.hpp>
 #include <tests/utilities/type_lists.hpp>
 
+#include <cudf/copying.hpp>
 #include <cudf/reshape.hpp>
 #include <type_traits>
 
@@ -177,6 +178,31 @@ TYPED_TEST(InterleaveColumnsTest, MismatchedDtypes)
   }
 }
 
+TYPED_TEST(InterleaveColumnsTest, ManyColumnsSliced)
+{
+  using T = TypeParam;
+
+  // more rows and columns than a tile of the fixed-width kernel, with an offset
+  constexpr cudf::size_type num_columns = 40;
+  constexpr cudf::size_type num_rows    = 70;
+  std::vector<fixed_width_column_wrapper<T>> columns;
+  for (cudf::size_type c = 0; c < num_columns; ++c) {
+    auto values = cudf::test::make_counting_transform_iterator(
+      0, [c](auto row) { return (row * num_columns + c) % 100; });
+    columns.emplace_back(values, values + num_rows + 1);
+  }
+  std::vector<cudf::column_view> views(columns.begin(), columns.end());
+  auto const in = cudf::slice(cudf::table_view{views}, {1, num_rows + 1}).front();
+
+  auto expected_values = cudf::test::make_counting_transform_iterator(
+    num_columns, [](auto i) { return i % 100; });
+  fixed_width_column_wrapper<T> expected(expected_values,
+                                         expected_values + num_rows * num_columns);
+  auto actual = cudf::interleave_columns(in);
+
+  cudf::test::expect_columns_equal(expected, actual->view());
+}
+
 struct InterleaveStringsColumnsTest : public BaseFixture {
 };
 
@@ -346,4 +372,30 @@ TEST_F(InterleaveStringsColumnsTest, MultiColumnStringMixNullableMix)
   cudf::test::expect_columns_equal(*results, exp_results, true);
 }
 
+struct InterleaveListsColumnsTest : public BaseFixture {
+};
+
+TEST_F(InterleaveListsColumnsTest, MultiColumnNullable)
+{
+  std::vector<bool> valids{1, 0, 1};
+  lists_column_wrapper<int32_t> col0{{{1, 2}, {3}, {}}, valids.begin()};
+  lists_column_wrapper<int32_t> col1{{4}, {5, 6, 7}, {8, 9}};
+
+  std::vector<bool> expected_valids{1, 1, 0, 1, 1, 1};
+  lists_column_wrapper<int32_t> expected{{{1, 2}, {4}, {3}, {5, 6, 7}, {}, {8, 9}},
+                                         expected_valids.begin()};
+  auto results = cudf::interleave_columns(cudf::table_view{{col0, col1}});
+  cudf::test::expect_columns_equal(expected, *results);
+}
+
+TEST_F(InterleaveListsColumnsTest, Strings)
+{
+  lists_column_wrapper<cudf::string_view> col0{{"a", "bb"}, {"ccc"}};
+  lists_column_wrapper<cudf::string_view> col1{{}, {"dddd", "e"}};
+
+  lists_column_wrapper<cudf::string_view> expected{{"a", "bb"}, {}, {"ccc"}, {"dddd", "e"}};
+  auto results = cudf::interleave_columns(cudf::table_view{{col0, col1}});
+  cudf::test::expect_columns_equal(expected, *results);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
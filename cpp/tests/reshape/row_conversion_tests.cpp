@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/reshape.hpp>
+#include <cudf/table/table.hpp>
+
+using namespace cudf::test;
+
+template <typename T>
+struct RowConversionTypedTest : public BaseFixture {
+};
+
+TYPED_TEST_CASE(RowConversionTypedTest, cudf::test::FixedWidthTypes);
+
+TYPED_TEST(RowConversionTypedTest, RoundTrip)
+{
+  using T = TypeParam;
+
+  fixed_width_column_wrapper<T> col({1, 2, 3, 4, 5}, {1, 0, 1, 1, 0});
+  fixed_width_column_wrapper<int64_t> other({10, 20, 30, 40, 50}, {1, 1, 1, 0, 1});
+  cudf::table_view input{{col, other}};
+
+  auto const rows = cudf::convert_to_rows(input);
+  EXPECT_EQ(rows->size(), 5);
+  auto const result = cudf::convert_from_rows(cudf::lists_column_view{*rows},
+                                              {input.column(0).type(), input.column(1).type()});
+  expect_tables_equal(input, result->view());
+}
+
+struct RowConversionTest : public BaseFixture {
+};
+
+TEST_F(RowConversionTest, UnsafeRowLayout)
+{
+  fixed_width_column_wrapper<int32_t> ints({1, 0}, {1, 0});
+  fixed_width_column_wrapper<bool> bools({true, false});
+  auto const rows = cudf::convert_to_rows(cudf::table_view{{ints, bools}});
+
+  // a word of null bits, then an 8-byte slot per value
+  fixed_width_column_wrapper<int8_t> expected_bytes{
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+  fixed_width_column_wrapper<int32_t> expected_offsets{0, 24, 48};
+  cudf::lists_column_view const result{*rows};
+  expect_columns_equal(result.child(), expected_bytes);
+  expect_columns_equal(result.offsets(), expected_offsets);
+}
+
+TEST_F(RowConversionTest, SlicedInput)
+{
+  fixed_width_column_wrapper<double> doubles({1., 2., 3., 4.}, {1, 1, 0, 1});
+  fixed_width_column_wrapper<int16_t> shorts({5, 6, 7, 8});
+  auto const input = cudf::slice(cudf::table_view{{doubles, shorts}}, {1, 4}).front();
+
+  auto const rows        = cudf::convert_to_rows(input);
+  auto const sliced_rows = cudf::slice(rows->view(), {1, 3}).front();
+  auto const result =
+    cudf::convert_from_rows(cudf::lists_column_view{sliced_rows},
+                            {cudf::data_type{cudf::type_id::FLOAT64},
+                             cudf::data_type{cudf::type_id::INT16}});
+
+  fixed_width_column_wrapper<double> expected_doubles({3., 4.}, {0, 1});
+  fixed_width_column_wrapper<int16_t> expected_shorts({7, 8}, {1, 1});
+  expect_tables_equal(cudf::table_view{{expected_doubles, expected_shorts}}, result->view());
+}
+
+TEST_F(RowConversionTest, ErrorTest)
+{
+  strings_column_wrapper strings{"a", "b"};
+  EXPECT_THROW(cudf::convert_to_rows(cudf::table_view{{strings}}), cudf::logic_error);
+
+  fixed_width_column_wrapper<int32_t> ints{1, 2};
+  auto const rows = cudf::convert_to_rows(cudf::table_view{{ints}});
+  EXPECT_THROW(cudf::convert_from_rows(cudf::lists_column_view{*rows},
+                                       {cudf::data_type{cudf::type_id::INT32},
+                                        cudf::data_type{cudf::type_id::INT32}}),
+               cudf::logic_error);
+}
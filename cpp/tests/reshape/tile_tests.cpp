@@ -20,6 +20,7 @@
 #include <tests/utilities/table_utilities.hpp>
 #include <tests/utilities/type_lists.hpp>
 
+#include <cudf/copying.hpp>
 #include <cudf/reshape.hpp>
 #include <cudf/table/table.hpp>
 #include "cudf/utilities/error.hpp"
@@ -117,3 +118,37 @@ TYPED_TEST(TileTest, OneColumnZeroCount)
 
   cudf::test::expect_tables_equal(expected, actual->view());
 }
+
+TYPED_TEST(TileTest, SlicedNullableRepeatedMoreThanTwice)
+{
+  using T = TypeParam;
+
+  fixed_width_column_wrapper<T> in_a({9, -1, 0, 1}, {1, 1, 0, 1});
+  auto const in = cudf::slice(cudf::table_view{{in_a}}, {1, 4}).front();
+
+  fixed_width_column_wrapper<T> expected_a({-1, 0, 1, -1, 0, 1, -1, 0, 1, -1, 0, 1, -1, 0, 1},
+                                           {1, 0, 1, 1, 0, 1, 1, 0, 1, 1, 0, 1, 1, 0, 1});
+  cudf::table_view expected(std::vector<cudf::column_view>{expected_a});
+
+  auto actual = cudf::tile(in, 5);
+
+  cudf::test::expect_tables_equal(expected, actual->view());
+}
+
+struct TileStringsTest : public BaseFixture {
+};
+
+TEST_F(TileStringsTest, MixedColumns)
+{
+  fixed_width_column_wrapper<int32_t> in_a({1, 2});
+  strings_column_wrapper in_b({"a", "bb"}, {1, 0});
+  cudf::table_view in(std::vector<cudf::column_view>{in_a, in_b});
+
+  fixed_width_column_wrapper<int32_t> expected_a({1, 2, 1, 2, 1, 2});
+  strings_column_wrapper expected_b({"a", "", "a", "", "a", ""}, {1, 0, 1, 0, 1, 0});
+  cudf::table_view expected(std::vector<cudf::column_view>{expected_a, expected_b});
+
+  auto actual = cudf::tile(in, 3);
+
+  cudf::test::expect_tables_equal(expected, actual->view());
+}
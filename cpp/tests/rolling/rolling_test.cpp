@@ -712,6 +712,80 @@ TYPED_TEST(RollingTest, RandomDynamicWithInvalid)
   this->run_test_col_agg(input, preceding_window, following_window, max_window_size);
 }
 
+// random input data, static parameters wide enough for the prefix evaluation, with nulls
+TYPED_TEST(RollingTest, RandomStaticWideWindowWithInvalid)
+{
+  size_type num_rows = 10000;
+
+  // random input
+  std::vector<TypeParam> col_data(num_rows);
+  std::vector<bool> col_valid(num_rows);
+  cudf::test::UniformRandomGenerator<TypeParam> rng;
+  cudf::test::UniformRandomGenerator<bool> rbg;
+  std::generate(col_data.begin(), col_data.end(), [&rng]() { return rng.generate(); });
+  std::generate(col_valid.begin(), col_valid.end(), [&rbg]() { return rbg.generate(); });
+  fixed_width_column_wrapper<TypeParam> input(col_data.begin(), col_data.end(), col_valid.begin());
+
+  std::vector<size_type> preceding_window({300});
+  std::vector<size_type> following_window({-100});
+  size_type periods = 1;
+
+  this->run_test_col_agg(input, preceding_window, following_window, periods);
+}
+
+template <typename T>
+class RollingMultiAggTest : public cudf::test::BaseFixture {
+ protected:
+  std::vector<std::unique_ptr<cudf::aggregation>> make_aggregations()
+  {
+    std::vector<std::unique_ptr<cudf::aggregation>> aggs;
+    aggs.push_back(cudf::make_sum_aggregation());
+    aggs.push_back(cudf::make_min_aggregation());
+    aggs.push_back(cudf::make_max_aggregation());
+    aggs.push_back(cudf::make_count_aggregation());
+    aggs.push_back(cudf::make_count_aggregation(cudf::null_policy::INCLUDE));
+    aggs.push_back(cudf::make_mean_aggregation());
+    return aggs;
+  }
+};
+
+TYPED_TEST_CASE(RollingMultiAggTest, cudf::test::NumericTypes);
+
+// several aggregations over the same windows match the aggregations computed one at a time
+TYPED_TEST(RollingMultiAggTest, MatchesSingleAggregations)
+{
+  size_type num_rows = 10000;
+
+  std::vector<TypeParam> col_data(num_rows);
+  std::vector<bool> col_valid(num_rows);
+  cudf::test::UniformRandomGenerator<TypeParam> rng;
+  cudf::test::UniformRandomGenerator<bool> rbg;
+  std::generate(col_data.begin(), col_data.end(), [&rng]() { return rng.generate(); });
+  std::generate(col_valid.begin(), col_valid.end(), [&rbg]() { return rbg.generate(); });
+  fixed_width_column_wrapper<TypeParam> input(col_data.begin(), col_data.end(), col_valid.begin());
+
+  cudf::test::UniformRandomGenerator<size_type> window_rng(0, 20);
+  std::vector<size_type> preceding(num_rows);
+  std::vector<size_type> following(num_rows);
+  std::generate(preceding.begin(), preceding.end(), [&]() { return window_rng.generate(); });
+  std::generate(following.begin(), following.end(), [&]() { return window_rng.generate(); });
+  fixed_width_column_wrapper<size_type> preceding_col(preceding.begin(), preceding.end());
+  fixed_width_column_wrapper<size_type> following_col(following.begin(), following.end());
+
+  auto const aggs            = this->make_aggregations();
+  auto const static_results  = cudf::rolling_window(input, 7, 3, 2, aggs);
+  auto const dynamic_results = cudf::rolling_window(input, preceding_col, following_col, 2, aggs);
+  ASSERT_EQ(static_results.size(), aggs.size());
+  ASSERT_EQ(dynamic_results.size(), aggs.size());
+
+  for (std::size_t i = 0; i < aggs.size(); ++i) {
+    cudf::test::expect_columns_equal(*static_results[i],
+                                     *cudf::rolling_window(input, 7, 3, 2, aggs[i]));
+    cudf::test::expect_columns_equal(
+      *dynamic_results[i], *cudf::rolling_window(input, preceding_col, following_col, 2, aggs[i]));
+  }
+}
+
 // ------------- non-fixed-width types --------------------
 
 using RollingTestStrings = RollingTest<cudf::string_view>;
@@ -922,4 +996,37 @@ TEST_F(RollingTestUdf, DynamicWindow)
   cudf::test::expect_columns_equal(*output, expected);
 }
 
+TEST_F(RollingTestUdf, Precompile)
+{
+  size_type size = 1000;
+
+  fixed_width_column_wrapper<int32_t> input(thrust::make_counting_iterator(0),
+                                            thrust::make_counting_iterator(size),
+                                            thrust::make_constant_iterator(true));
+
+  auto cuda_udf_agg = cudf::make_udf_aggregation(
+    cudf::udf_type::CUDA, this->cuda_func, cudf::data_type{cudf::type_id::INT64});
+
+  EXPECT_NO_THROW(cudf::precompile_rolling_window_udf(
+    {cudf::data_type{cudf::type_id::INT32}, cudf::data_type{cudf::type_id::INT64}}, cuda_udf_agg));
+
+  auto start = cudf::test::make_counting_transform_iterator(0, [size] __device__(size_type row) {
+    return std::accumulate(thrust::make_counting_iterator(std::max(0, row - 2 + 1)),
+                           thrust::make_counting_iterator(std::min(size, row + 2 + 1)),
+                           0);
+  });
+
+  auto valid = cudf::test::make_counting_transform_iterator(0, [size] __device__(size_type row) {
+    return (row != 0 && row != size - 2 && row != size - 1);
+  });
+
+  fixed_width_column_wrapper<int64_t> expected{start, start + size, valid};
+
+  cudf::test::expect_columns_equal(*cudf::rolling_window(input, 2, 2, 4, cuda_udf_agg), expected);
+
+  EXPECT_THROW(cudf::precompile_rolling_window_udf({cudf::data_type{cudf::type_id::INT32}},
+                                                   cudf::make_sum_aggregation()),
+               cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
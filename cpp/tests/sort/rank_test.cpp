@@ -410,5 +410,66 @@ TYPED_TEST(Rank, min_desc_bottom_pct)
   this->run_all_tests(rank_method::MIN, desc_bottom, col1_rank, col2_rank, col3_rank, true);
 }
 
+struct RankSorted : public BaseFixture {
+};
+
+TEST_F(RankSorted, SortedHint)
+{
+  fixed_width_column_wrapper<int32_t> input{{1, 3, 3, 5, 8, 8, 0}, {1, 1, 1, 1, 1, 1, 0}};
+  for (auto method : {rank_method::FIRST,
+                      rank_method::AVERAGE,
+                      rank_method::MIN,
+                      rank_method::MAX,
+                      rank_method::DENSE}) {
+    for (auto percentage : {false, true}) {
+      auto const expected = cudf::rank(
+        input, method, order::ASCENDING, null_policy::EXCLUDE, null_order::AFTER, percentage);
+      auto const got = cudf::rank(input,
+                                  method,
+                                  order::ASCENDING,
+                                  null_policy::EXCLUDE,
+                                  null_order::AFTER,
+                                  percentage,
+                                  sorted::YES);
+      expect_columns_equal(expected->view(), got->view());
+    }
+  }
+}
+
+TEST_F(RankSorted, Segmented)
+{
+  fixed_width_column_wrapper<int32_t> input{{1, 4, 4, 9, 2, 2, 3, 7, 0},
+                                            {1, 1, 1, 1, 1, 1, 1, 1, 0}};
+  fixed_width_column_wrapper<size_type> offsets{0, 4, 4, 7, 9};
+
+  fixed_width_column_wrapper<size_type> expected_min{{1, 2, 2, 4, 1, 1, 3, 1, 2}};
+  auto result = cudf::segmented_rank(input, offsets, rank_method::MIN, null_policy::INCLUDE, false);
+  expect_columns_equal(expected_min, result->view());
+
+  fixed_width_column_wrapper<size_type> expected_first{{1, 2, 3, 4, 1, 2, 3, 1, 2}};
+  result = cudf::segmented_rank(input, offsets, rank_method::FIRST, null_policy::INCLUDE, false);
+  expect_columns_equal(expected_first, result->view());
+
+  fixed_width_column_wrapper<double> expected_average{{1, 2.5, 2.5, 4, 1.5, 1.5, 3, 1, 2}};
+  result = cudf::segmented_rank(input, offsets, rank_method::AVERAGE, null_policy::INCLUDE, false);
+  expect_columns_equal(expected_average, result->view());
+
+  fixed_width_column_wrapper<size_type> expected_dense{{1, 2, 2, 3, 1, 1, 2, 1, 0},
+                                                       {1, 1, 1, 1, 1, 1, 1, 1, 0}};
+  result = cudf::segmented_rank(input, offsets, rank_method::DENSE, null_policy::EXCLUDE, false);
+  expect_columns_equal(expected_dense, result->view());
+
+  fixed_width_column_wrapper<double> expected_dense_pct{
+    {1.0 / 3.0, 2.0 / 3.0, 2.0 / 3.0, 1., 0.5, 0.5, 1., 1., 0.},
+    {1, 1, 1, 1, 1, 1, 1, 1, 0}};
+  result = cudf::segmented_rank(input, offsets, rank_method::DENSE, null_policy::EXCLUDE, true);
+  expect_columns_equal(expected_dense_pct, result->view());
+
+  fixed_width_column_wrapper<double> expected_max_pct{
+    {0.25, 0.75, 0.75, 1., 2.0 / 3.0, 2.0 / 3.0, 1., 0.5, 1.}};
+  result = cudf::segmented_rank(input, offsets, rank_method::MAX, null_policy::INCLUDE, true);
+  expect_columns_equal(expected_max_pct, result->view());
+}
+
 }  // namespace test
 }  // namespace cudf
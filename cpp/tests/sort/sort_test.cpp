@@ -15,6 +15,7 @@
  */
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/table/table_view.hpp>
@@ -25,6 +26,8 @@
 #include <tests/utilities/column_wrapper.hpp>
 #include <tests/utilities/table_utilities.hpp>
 #include <tests/utilities/type_lists.hpp>
+
+#include <limits>
 #include <vector>
 
 namespace cudf {
@@ -211,6 +214,24 @@ TYPED_TEST(Sort, Stable)
   expect_columns_equal(expected, got->view());
 }
 
+TYPED_TEST(Sort, OnStream)
+{
+  using T = TypeParam;
+  using R = int32_t;
+
+  fixed_width_column_wrapper<T> col1{{1, 0, 1, 0}};
+  fixed_width_column_wrapper<R> expected{{1, 3, 0, 2}};
+
+  cudaStream_t stream;
+  CUDA_TRY(cudaStreamCreate(&stream));
+  auto got =
+    stable_sorted_order(table_view({col1}), {}, {}, rmm::mr::get_default_resource(), stream);
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  CUDA_TRY(cudaStreamDestroy(stream));
+
+  expect_columns_equal(expected, got->view());
+}
+
 TYPED_TEST(Sort, MisMatchInColumnOrderSize)
 {
   using T = TypeParam;
@@ -264,6 +285,297 @@ TYPED_TEST(Sort, ZeroSizedColumns)
   run_sort_test(input, expected, column_order);
 }
 
+TYPED_TEST(Sort, SingleColumnWithNulls)
+{
+  using T = TypeParam;
+  using R = int32_t;
+
+  fixed_width_column_wrapper<T> col1({1, 0, 0, 1, 0, 0, 1}, {1, 1, 0, 1, 1, 0, 1});
+  table_view input{{col1}};
+
+  // Equivalent rows keep their relative order
+  auto got = sorted_order(input, {order::ASCENDING}, {null_order::AFTER});
+  expect_columns_equal(fixed_width_column_wrapper<R>{1, 4, 0, 3, 6, 2, 5}, got->view());
+
+  got = sorted_order(input, {order::DESCENDING}, {null_order::BEFORE});
+  expect_columns_equal(fixed_width_column_wrapper<R>{0, 3, 6, 1, 4, 2, 5}, got->view());
+
+  got = stable_sorted_order(input, {order::DESCENDING}, {null_order::AFTER});
+  expect_columns_equal(fixed_width_column_wrapper<R>{2, 5, 0, 3, 6, 1, 4}, got->view());
+}
+
+struct SortFloat : public BaseFixture {
+};
+
+TEST_F(SortFloat, NaNAndNegativeZero)
+{
+  using T = double;
+  using R = int32_t;
+
+  auto const nan = std::numeric_limits<T>::quiet_NaN();
+  auto const inf = std::numeric_limits<T>::infinity();
+  fixed_width_column_wrapper<T> col1({nan, 1.0, -0.0, -inf, 0.0, -nan, 0.0},
+                                     {1, 1, 1, 1, 1, 1, 0});
+  table_view input{{col1}};
+
+  // NaNs are greater than +Inf and equivalent to each other; -0.0 is equivalent to 0.0
+  auto got = sorted_order(input, {order::ASCENDING}, {null_order::AFTER});
+  expect_columns_equal(fixed_width_column_wrapper<R>{3, 2, 4, 1, 0, 5, 6}, got->view());
+
+  got = sorted_order(input, {order::DESCENDING}, {null_order::AFTER});
+  expect_columns_equal(fixed_width_column_wrapper<R>{6, 0, 5, 1, 2, 4, 3}, got->view());
+}
+
+struct SortStrings : public BaseFixture {
+};
+
+TEST_F(SortStrings, EqualPrefixes)
+{
+  using R = int32_t;
+
+  // Strings sharing their first 8 bytes are ordered by the rest of their bytes, and bytes over
+  // 0x7f by their unsigned value
+  strings_column_wrapper col1({"prefix_shared_b",
+                               "apple",
+                               "",
+                               "prefix_shared_a",
+                               "apple",
+                               "prefix_s",
+                               "",
+                               "prefix_shared_a",
+                               "\xc3\xa9t\xc3\xa9"},
+                              {1, 1, 0, 1, 1, 1, 1, 1, 1});
+  table_view input{{col1}};
+
+  auto got = stable_sorted_order(input, {order::ASCENDING}, {null_order::AFTER});
+  expect_columns_equal(fixed_width_column_wrapper<R>{6, 1, 4, 5, 3, 7, 0, 8, 2}, got->view());
+
+  got = stable_sorted_order(input, {order::DESCENDING}, {null_order::AFTER});
+  expect_columns_equal(fixed_width_column_wrapper<R>{2, 8, 0, 3, 7, 5, 1, 4, 6}, got->view());
+
+  run_sort_test(input,
+                fixed_width_column_wrapper<R>{2, 6, 1, 4, 5, 3, 7, 0, 8},
+                {order::ASCENDING},
+                {null_order::BEFORE});
+}
+
+struct SortPackedKeys : public BaseFixture {
+};
+
+TEST_F(SortPackedKeys, MixedOrders)
+{
+  using R = int32_t;
+
+  fixed_width_column_wrapper<int32_t> col1({2, 1, 2, 1, 1, 0}, {1, 1, 1, 1, 1, 0});
+  fixed_width_column_wrapper<int16_t> col2{-1, 3, 4, -2, 3, 0};
+  table_view input{{col1, col2}};
+
+  auto got = sorted_order(
+    input, {order::ASCENDING, order::DESCENDING}, {null_order::AFTER, null_order::AFTER});
+  expect_columns_equal(fixed_width_column_wrapper<R>{1, 4, 3, 2, 0, 5}, got->view());
+
+  got = sorted_order(
+    input, {order::DESCENDING, order::ASCENDING}, {null_order::AFTER, null_order::AFTER});
+  expect_columns_equal(fixed_width_column_wrapper<R>{5, 0, 2, 3, 1, 4}, got->view());
+}
+
+TEST_F(SortPackedKeys, BoolAndFloat)
+{
+  using R = int32_t;
+
+  auto const nan = std::numeric_limits<float>::quiet_NaN();
+  fixed_width_column_wrapper<bool> col1{1, 0, 1, 0, 1};
+  fixed_width_column_wrapper<float> col2{-1.5f, nan, -0.0f, 2.0f, 0.0f};
+  table_view input{{col1, col2}};
+
+  auto got = sorted_order(input);
+  expect_columns_equal(fixed_width_column_wrapper<R>{3, 1, 0, 2, 4}, got->view());
+}
+
+struct SegmentedSort : public BaseFixture {
+};
+
+TEST_F(SegmentedSort, SortedOrder)
+{
+  using R = int32_t;
+
+  fixed_width_column_wrapper<int32_t> col1{3, 1, 2, 9, 8, 7, 7};
+  fixed_width_column_wrapper<R> offsets{0, 3, 7};
+  table_view input{{col1}};
+
+  auto got = segmented_sorted_order(input, offsets);
+  expect_columns_equal(fixed_width_column_wrapper<R>{1, 2, 0, 5, 6, 4, 3}, got->view());
+
+  fixed_width_column_wrapper<int32_t> values{30, 10, 20, 90, 80, 70, 71};
+  auto sorted = segmented_sort_by_key(table_view{{values}}, input, offsets);
+  expect_columns_equal(fixed_width_column_wrapper<int32_t>{10, 20, 30, 70, 71, 80, 90},
+                       sorted->get_column(0));
+}
+
+TEST_F(SegmentedSort, InvalidOffsets)
+{
+  fixed_width_column_wrapper<int32_t> col1{3, 1, 2};
+  fixed_width_column_wrapper<int64_t> offsets{0, 3};
+
+  EXPECT_THROW(segmented_sorted_order(table_view{{col1}}, offsets), logic_error);
+}
+
+struct TopK : public BaseFixture {
+};
+
+TEST_F(TopK, Ties)
+{
+  using R = int32_t;
+
+  fixed_width_column_wrapper<int32_t> col1{3, 9, 1, 7, 9, 4};
+
+  auto got = top_k_order(col1, 3);
+  expect_columns_equal(fixed_width_column_wrapper<R>{1, 4, 3}, got->view());
+
+  got = top_k_order(col1, 1);
+  expect_columns_equal(fixed_width_column_wrapper<R>{1}, got->view());
+
+  got = top_k_order(col1, 10, order::ASCENDING);
+  expect_columns_equal(fixed_width_column_wrapper<R>{2, 0, 5, 3, 1, 4}, got->view());
+
+  EXPECT_THROW(top_k_order(col1, -1), logic_error);
+}
+
+TEST_F(TopK, NegativeValuesAndNulls)
+{
+  using R = int32_t;
+
+  fixed_width_column_wrapper<int64_t> col1({-5, 0, 3, -10, 0, 8}, {1, 0, 1, 1, 0, 1});
+
+  auto got = top_k_order(col1, 5, order::DESCENDING, null_order::BEFORE);
+  expect_columns_equal(fixed_width_column_wrapper<R>{5, 2, 0, 3, 1}, got->view());
+
+  got = top_k_order(col1, 3, order::ASCENDING, null_order::BEFORE);
+  expect_columns_equal(fixed_width_column_wrapper<R>{1, 4, 3}, got->view());
+
+  got = top_k_order(col1, 2, order::ASCENDING, null_order::AFTER);
+  expect_columns_equal(fixed_width_column_wrapper<R>{3, 0}, got->view());
+}
+
+TEST_F(TopK, Strings)
+{
+  using R = int32_t;
+
+  strings_column_wrapper col1({"b", "d", "a", "c"});
+
+  auto got = top_k_order(col1, 2);
+  expect_columns_equal(fixed_width_column_wrapper<R>{1, 3}, got->view());
+}
+
+TEST_F(TopK, Segmented)
+{
+  using R = int32_t;
+
+  fixed_width_column_wrapper<int32_t> col1{3, 1, 2, 9, 8, 7, 7};
+  fixed_width_column_wrapper<R> offsets{0, 3, 3, 7};
+
+  auto got = segmented_top_k_order(col1, offsets, 2);
+  expect_columns_equal(fixed_width_column_wrapper<R>{0, 2, 3, 4}, got.first->view());
+  expect_columns_equal(fixed_width_column_wrapper<R>{0, 2, 2, 4}, got.second->view());
+}
+
+TEST_F(TopK, SegmentedTies)
+{
+  using R = int32_t;
+
+  // The first segment is smaller than k, and the others tie on the k-th value
+  fixed_width_column_wrapper<int64_t> col1{5, -1, 4, 4, 9, 4, 0, 2, 2, 2, 7, 2};
+  fixed_width_column_wrapper<R> offsets{0, 2, 7, 12};
+
+  auto got = segmented_top_k_order(col1, offsets, 3);
+  expect_columns_equal(fixed_width_column_wrapper<R>{0, 1, 4, 2, 3, 10, 7, 8}, got.first->view());
+  expect_columns_equal(fixed_width_column_wrapper<R>{0, 2, 5, 8}, got.second->view());
+
+  got = segmented_top_k_order(col1, offsets, 2, order::ASCENDING);
+  expect_columns_equal(fixed_width_column_wrapper<R>{1, 0, 6, 2, 7, 8}, got.first->view());
+  expect_columns_equal(fixed_width_column_wrapper<R>{0, 2, 4, 6}, got.second->view());
+
+  got = segmented_top_k_order(col1, offsets, 0);
+  EXPECT_EQ(0, got.first->size());
+  expect_columns_equal(fixed_width_column_wrapper<R>{0, 0, 0, 0}, got.second->view());
+}
+
+TEST_F(TopK, SegmentedNullsAndStrings)
+{
+  using R = int32_t;
+
+  fixed_width_column_wrapper<R> offsets{0, 3, 5};
+
+  fixed_width_column_wrapper<int32_t> col1({3, 1, 2, 9, 8}, {1, 0, 1, 1, 1});
+  auto got = segmented_top_k_order(col1, offsets, 2, order::DESCENDING, null_order::BEFORE);
+  expect_columns_equal(fixed_width_column_wrapper<R>{0, 2, 3, 4}, got.first->view());
+
+  strings_column_wrapper col2({"c", "a", "b", "e", "f"});
+  got = segmented_top_k_order(col2, offsets, 1);
+  expect_columns_equal(fixed_width_column_wrapper<R>{0, 4}, got.first->view());
+  expect_columns_equal(fixed_width_column_wrapper<R>{0, 1, 2}, got.second->view());
+}
+
+TEST_F(SegmentedSort, MultipleKeysAndEmptySegments)
+{
+  using R = int32_t;
+
+  fixed_width_column_wrapper<int32_t> col1{1, 1, 0, 2, 2, 1};
+  fixed_width_column_wrapper<int32_t> col2{5, 4, 6, 1, 0, 3};
+  fixed_width_column_wrapper<R> offsets{0, 0, 3, 3, 6};
+
+  auto got = segmented_sorted_order(
+    table_view{{col1, col2}}, offsets, {order::DESCENDING, order::ASCENDING});
+  expect_columns_equal(fixed_width_column_wrapper<R>{1, 0, 2, 4, 3, 5}, got->view());
+}
+
+struct ExternalSort : public BaseFixture {
+};
+
+TEST_F(ExternalSort, MergesSpilledRuns)
+{
+  external_sorter sorter({0}, {order::ASCENDING}, {}, 2);
+
+  fixed_width_column_wrapper<int32_t> keys0{5, 1, 9, 3};
+  strings_column_wrapper vals0({"e", "a", "i", "c"});
+  sorter.push(table_view{{keys0, vals0}});
+  fixed_width_column_wrapper<int32_t> keys1{2, 8, 4};
+  strings_column_wrapper vals1({"b", "h", "d"});
+  sorter.push(table_view{{keys1, vals1}});
+  fixed_width_column_wrapper<int32_t> keys2({7, 6, 0}, {1, 1, 0});
+  strings_column_wrapper vals2({"g", "f", "z"});
+  sorter.push(table_view{{keys2, vals2}});
+
+  std::vector<std::unique_ptr<table>> pieces;
+  while (sorter.has_next()) { pieces.push_back(sorter.next()); }
+  EXPECT_GT(pieces.size(), 1u);
+  std::vector<table_view> views;
+  for (auto const& piece : pieces) { views.push_back(piece->view()); }
+  auto const got = concatenate(views);
+
+  fixed_width_column_wrapper<int32_t> expect_keys({0, 1, 2, 3, 4, 5, 6, 7, 8, 9},
+                                                  {0, 1, 1, 1, 1, 1, 1, 1, 1, 1});
+  strings_column_wrapper expect_vals({"z", "a", "b", "c", "d", "e", "f", "g", "h", "i"});
+  expect_tables_equal(table_view{{expect_keys, expect_vals}}, got->view());
+
+  EXPECT_THROW(sorter.next(), logic_error);
+  EXPECT_THROW(sorter.push(table_view{{keys0, vals0}}), logic_error);
+}
+
+TEST_F(ExternalSort, InvalidInput)
+{
+  EXPECT_THROW(external_sorter({}, {}), logic_error);
+  EXPECT_THROW(external_sorter({0}, {order::ASCENDING}, {}, 0), logic_error);
+
+  external_sorter sorter({0}, {order::DESCENDING});
+  EXPECT_FALSE(sorter.has_next());
+
+  fixed_width_column_wrapper<int32_t> keys0{5, 1};
+  sorter.push(table_view{{keys0}});
+  fixed_width_column_wrapper<int64_t> keys1{5, 1};
+  EXPECT_THROW(sorter.push(table_view{{keys1}}), logic_error);
+}
+
 struct SortByKey : public BaseFixture {
 };
 
@@ -170,4 +170,16 @@ TEST_F(ApplyBooleanMask, NoNullInput)
   cudf::test::expect_tables_equal(expected, got->view());
 }
 
+TEST_F(ApplyBooleanMask, NullableInputWithoutNulls)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col({10, 40, 70, 5, 2, 10}, {1, 1, 1, 1, 1, 1});
+  cudf::test::fixed_width_column_wrapper<bool> mask({true, false, true, false, true, true});
+  cudf::table_view input({col});
+  cudf::test::fixed_width_column_wrapper<int32_t> col_expected({10, 70, 2, 10}, {1, 1, 1, 1});
+  cudf::table_view expected({col_expected});
+  auto got = cudf::apply_boolean_mask(input, mask);
+  cudf::test::expect_tables_equal(expected, got->view());
+  EXPECT_EQ(0, got->get_column(0).null_count());
+}
+
 CUDF_TEST_PROGRAM_MAIN()
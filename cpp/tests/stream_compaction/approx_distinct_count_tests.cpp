@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/types.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <cmath>
+
+struct ApproxDistinctCountTest : public cudf::test::BaseFixture {
+};
+
+namespace {
+constexpr cudf::size_type num_distinct = 10000;
+
+// every distinct value appears three times
+cudf::test::fixed_width_column_wrapper<int32_t> make_repeated_values()
+{
+  auto values =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % num_distinct; });
+  return cudf::test::fixed_width_column_wrapper<int32_t>(values, values + 3 * num_distinct);
+}
+}  // namespace
+
+TEST_F(ApproxDistinctCountTest, EstimateIsClose)
+{
+  auto const input = make_repeated_values();
+
+  auto const estimate = cudf::approx_distinct_count(input, 14);
+  // the relative error of a sketch of 2^14 registers is about 1%
+  EXPECT_LT(std::abs(estimate - num_distinct), num_distinct / 20);
+}
+
+TEST_F(ApproxDistinctCountTest, SmallCountIsExact)
+{
+  cudf::test::fixed_width_column_wrapper<int64_t> input{{5, 1, 5, 3, 1, 7, 7, 0},
+                                                        {1, 1, 1, 1, 1, 1, 1, 0}};
+
+  EXPECT_EQ(cudf::approx_distinct_count(input), 4);
+  EXPECT_EQ(cudf::approx_distinct_count(input, 12, cudf::null_policy::INCLUDE), 5);
+}
+
+TEST_F(ApproxDistinctCountTest, MergedSketchesMatchWholeColumn)
+{
+  auto const input  = make_repeated_values();
+  auto const halves = cudf::split(cudf::column_view{input}, {num_distinct + num_distinct / 2});
+
+  auto const whole  = cudf::make_distinct_count_sketch(input);
+  auto const first  = cudf::make_distinct_count_sketch(halves[0]);
+  auto const second = cudf::make_distinct_count_sketch(halves[1]);
+  auto const merged = cudf::merge_distinct_count_sketches({first->view(), second->view()});
+
+  cudf::test::expect_columns_equal(whole->view(), merged->view());
+  EXPECT_EQ(cudf::estimate_distinct_count(merged->view()),
+            cudf::estimate_distinct_count(whole->view()));
+}
+
+TEST_F(ApproxDistinctCountTest, Reduction)
+{
+  auto const input = make_repeated_values();
+
+  auto const result = cudf::reduce(input,
+                                   cudf::make_approx_nunique_aggregation(14),
+                                   cudf::data_type{cudf::type_id::INT32});
+  EXPECT_EQ(static_cast<cudf::scalar_type_t<cudf::size_type>*>(result.get())->value(),
+            cudf::approx_distinct_count(input, 14));
+}
+
+TEST_F(ApproxDistinctCountTest, GroupbyUnsupported)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys{1, 1, 2};
+  cudf::test::fixed_width_column_wrapper<int32_t> vals{1, 2, 3};
+
+  std::vector<cudf::groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(cudf::make_approx_nunique_aggregation());
+  cudf::groupby::groupby gb(cudf::table_view({keys}));
+  EXPECT_THROW(gb.aggregate(requests), cudf::logic_error);
+}
+
+TEST_F(ApproxDistinctCountTest, InvalidSketch)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{1, 2, 3};
+
+  EXPECT_THROW(cudf::make_distinct_count_sketch(input, 3), cudf::logic_error);
+  EXPECT_THROW(cudf::make_distinct_count_sketch(input, 19), cudf::logic_error);
+  EXPECT_THROW(cudf::estimate_distinct_count(input), cudf::logic_error);
+
+  auto const small = cudf::make_distinct_count_sketch(input, 4);
+  auto const large = cudf::make_distinct_count_sketch(input, 5);
+  EXPECT_THROW(cudf::merge_distinct_count_sketches({small->view(), large->view()}),
+               cudf::logic_error);
+}
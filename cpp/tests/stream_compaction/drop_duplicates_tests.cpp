@@ -18,6 +18,7 @@
 #include <cmath>
 #include <ctgmath>
 #include <cudf/copying.hpp>
+#include <cudf/sorting.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
@@ -394,3 +395,25 @@ TEST_F(DropDuplicate, EmptyKeys)
 
   cudf::test::expect_tables_equal(cudf::table_view{{empty_col}}, got->view());
 }
+
+TEST_F(DropDuplicate, SortedTable)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> key{{5, 4, 3, 5, 8, 1, 4}, {1, 0, 1, 1, 1, 1, 0}};
+  cudf::test::fixed_width_column_wrapper<float> value{{1, 2, 3, 4, 5, 6, 7}};
+  cudf::table_view input{{key, value}};
+  std::vector<cudf::size_type> keys{0};
+
+  auto const sorted = cudf::sort_by_key(input, cudf::table_view{{key}});
+  EXPECT_FALSE(sorted->is_sorted_by(keys));
+  auto const first = drop_duplicates(input, keys, cudf::duplicate_keep_option::KEEP_FIRST);
+  EXPECT_TRUE(first->is_sorted_by(keys));
+
+  // Sorted by the keys: the duplicates are dropped without sorting, and the result stays sorted
+  auto const unique =
+    drop_duplicates(*cudf::sort(input), keys, cudf::duplicate_keep_option::KEEP_NONE);
+  auto const again  = drop_duplicates(*unique, keys, cudf::duplicate_keep_option::KEEP_FIRST);
+  EXPECT_TRUE(again->is_sorted_by(keys));
+  cudf::test::expect_tables_equal(unique->view(), again->view());
+  cudf::test::expect_tables_equal(
+    drop_duplicates(input, keys, cudf::duplicate_keep_option::KEEP_NONE)->view(), again->view());
+}
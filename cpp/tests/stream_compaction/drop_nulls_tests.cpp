@@ -149,6 +149,27 @@ TEST_F(DropNullsTest, MixedSetOfRowsWithThreshold)
   cudf::test::expect_tables_equal(expected, got->view());
 }
 
+TEST_F(DropNullsTest, MixedSetOfRowsWithThresholdOne)
+{
+  cudf::test::fixed_width_column_wrapper<int16_t> col1{{1, 2, 3, 4, 5, 6}, {1, 0, 0, 1, 0, 0}};
+  cudf::test::fixed_width_column_wrapper<int32_t> col2{{10, 40, 70, 5, 2, 10}, {0, 1, 0, 1, 0, 0}};
+  cudf::test::fixed_width_column_wrapper<double> col3{{10, 40, 70, 5, 2, 10}, {1, 1, 1, 1, 1, 1}};
+  cudf::table_view input{{col1, col2, col3}};
+  std::vector<cudf::size_type> keys{0, 1};
+  cudf::test::fixed_width_column_wrapper<int16_t> col1_expected{{1, 2, 4}, {1, 0, 1}};
+  cudf::test::fixed_width_column_wrapper<int32_t> col2_expected{{10, 40, 5}, {0, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<double> col3_expected{{10, 40, 5}, {1, 1, 1}};
+  cudf::table_view expected{{col1_expected, col2_expected, col3_expected}};
+
+  // rows valid in any key are kept
+  auto got = cudf::drop_nulls(input, keys, 1);
+  cudf::test::expect_tables_equal(expected, got->view());
+
+  // every row is valid in a key without nulls
+  got = cudf::drop_nulls(input, {0, 2}, 1);
+  cudf::test::expect_tables_equal(input, got->view());
+}
+
 TEST_F(DropNullsTest, EmptyTable)
 {
   cudf::table_view input{std::vector<cudf::column_view>()};
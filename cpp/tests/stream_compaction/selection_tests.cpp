@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/selection.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+struct SelectionTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(SelectionTest, RefinedSelectionMatchesSuccessiveMasks)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{{10, 40, 70, 5, 2, 10}, {1, 1, 0, 1, 1, 0}};
+  cudf::test::strings_column_wrapper col2{"a", "b", "c", "d", "e", "f"};
+  cudf::table_view input{{col1, col2}};
+  cudf::test::fixed_width_column_wrapper<bool> first_mask{{true, true, true, false, true, true},
+                                                          {1, 1, 1, 1, 1, 0}};
+  cudf::test::fixed_width_column_wrapper<bool> second_mask{{false, true, true, true, true, true},
+                                                           {1, 1, 1, 1, 0, 1}};
+
+  auto rows = cudf::make_selection(first_mask);
+  EXPECT_EQ(rows->size(), 6);
+  EXPECT_EQ(rows->selected_count(), 4);
+  rows = cudf::make_selection(*rows, second_mask);
+  EXPECT_EQ(rows->selected_count(), 2);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> col1_expected{{40, 70}, {1, 0}};
+  cudf::test::strings_column_wrapper col2_expected{"b", "c"};
+  cudf::table_view expected{{col1_expected, col2_expected}};
+
+  auto got = cudf::apply_selection(input, *rows);
+  cudf::test::expect_tables_equal(expected, got->view());
+}
+
+TEST_F(SelectionTest, EmptySelection)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{};
+  cudf::test::fixed_width_column_wrapper<bool> boolean_mask{};
+  cudf::table_view input{{col1}};
+
+  auto rows = cudf::make_selection(boolean_mask);
+  EXPECT_EQ(rows->selected_count(), 0);
+
+  auto got = cudf::apply_selection(input, *rows);
+  EXPECT_EQ(got->num_rows(), 0);
+}
+
+TEST_F(SelectionTest, ReduceSelectedRows)
+{
+  cudf::test::fixed_width_column_wrapper<int64_t> values{{9, 1, 2, 3, 4, 5, 6, 9},
+                                                         {1, 1, 1, 0, 1, 1, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<bool> boolean_mask{true, false, true, true, true, true};
+  // the selection applies to a slice of the column, which has an offset
+  auto const sliced = cudf::slice(values, {1, 7})[0];
+  auto rows         = cudf::make_selection(boolean_mask);
+
+  auto const sum = cudf::reduce(
+    sliced, *rows, cudf::make_sum_aggregation(), cudf::data_type{cudf::type_id::INT64});
+  EXPECT_EQ(static_cast<cudf::scalar_type_t<int64_t>*>(sum.get())->value(), 16);
+
+  auto const count = cudf::reduce(sliced,
+                                  *rows,
+                                  cudf::make_nunique_aggregation(cudf::null_policy::INCLUDE),
+                                  cudf::data_type{cudf::type_id::INT32});
+  EXPECT_EQ(static_cast<cudf::scalar_type_t<int32_t>*>(count.get())->value(), 5);
+}
+
+TEST_F(SelectionTest, ReduceMaskedRows)
+{
+  cudf::test::fixed_width_column_wrapper<double> values{{1.5, 2.5, 4.0, 8.0, 16.0},
+                                                        {1, 1, 0, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<bool> boolean_mask{{true, false, true, true, true},
+                                                            {1, 1, 1, 1, 0}};
+
+  auto const sum = cudf::reduce(
+    values, boolean_mask, cudf::make_sum_aggregation(), cudf::data_type{cudf::type_id::FLOAT64});
+  EXPECT_EQ(static_cast<cudf::scalar_type_t<double>*>(sum.get())->value(), 9.5);
+
+  auto const max = cudf::reduce(
+    values, boolean_mask, cudf::make_max_aggregation(), cudf::data_type{cudf::type_id::FLOAT64});
+  EXPECT_EQ(static_cast<cudf::scalar_type_t<double>*>(max.get())->value(), 8.0);
+}
+
+TEST_F(SelectionTest, SizeMismatch)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{1, 2, 3};
+  cudf::test::fixed_width_column_wrapper<bool> boolean_mask{true, false};
+  cudf::test::fixed_width_column_wrapper<bool> longer_mask{true, true, true};
+  cudf::test::fixed_width_column_wrapper<int32_t> not_boolean{1, 0};
+
+  auto rows = cudf::make_selection(boolean_mask);
+  EXPECT_THROW(cudf::apply_selection(cudf::table_view{{col1}}, *rows), cudf::logic_error);
+  EXPECT_THROW(cudf::make_selection(*rows, longer_mask), cudf::logic_error);
+  EXPECT_THROW(cudf::make_selection(not_boolean), cudf::logic_error);
+}
@@ -31,6 +31,7 @@
 #include <tests/utilities/column_wrapper.hpp>
 
 #include <thrust/iterator/constant_iterator.h>
+#include <string>
 #include <vector>
 
 struct StringsColumnTest : public cudf::test::BaseFixture {
@@ -163,6 +164,37 @@ TEST_F(StringsColumnTest, Gather)
   cudf::test::expect_columns_equal(results.front()->view(), expected);
 }
 
+TEST_F(StringsColumnTest, GatherSkewedSizes)
+{
+  // long strings on average, so the chars are copied parallel over the chars
+  std::string const long_string(1000, 'x');
+  std::string const other_long_string(333, 'y');
+  std::vector<const char*> h_strings{
+    "a", long_string.c_str(), nullptr, "", "bcd", other_long_string.c_str(), "ééé"};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map{{1, 0, 2, 5, 3, 1, 6, 4, 5}};
+  auto results = cudf::gather(cudf::table_view{{strings}}, gather_map)->release();
+
+  std::vector<const char*> h_expected{long_string.c_str(),
+                                      "a",
+                                      nullptr,
+                                      other_long_string.c_str(),
+                                      "",
+                                      long_string.c_str(),
+                                      "ééé",
+                                      "bcd",
+                                      other_long_string.c_str()};
+  cudf::test::strings_column_wrapper expected(
+    h_expected.begin(),
+    h_expected.end(),
+    thrust::make_transform_iterator(h_expected.begin(), [](auto str) { return str != nullptr; }));
+  cudf::test::expect_columns_equal(results.front()->view(), expected);
+}
+
 TEST_F(StringsColumnTest, GatherZeroSizeStringsColumn)
 {
   cudf::column_view zero_size_strings_column(
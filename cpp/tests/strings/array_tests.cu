@@ -20,6 +20,7 @@
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/copying.hpp>
 #include <cudf/strings/detail/scatter.cuh>
+#include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/sorting.hpp>
 #include <cudf/strings/strings_column_view.hpp>
@@ -30,7 +31,9 @@
 #include <tests/utilities/column_utilities.hpp>
 #include <tests/utilities/column_wrapper.hpp>
 
+#include <thrust/host_vector.h>
 #include <thrust/iterator/constant_iterator.h>
+#include <limits>
 #include <vector>
 
 struct StringsColumnTest : public cudf::test::BaseFixture {
@@ -172,6 +175,22 @@ TEST_F(StringsColumnTest, GatherZeroSizeStringsColumn)
   cudf::test::expect_strings_empty(results.front()->view());
 }
 
+TEST_F(StringsColumnTest, OffsetsOverflow)
+{
+  // three strings of 1GB each do not fit in 32-bit offsets
+  auto sizes   = thrust::make_constant_iterator<cudf::size_type>(1 << 30);
+  auto offsets = cudf::strings::detail::make_offsets_child_column(sizes, sizes + 3);
+  thrust::host_vector<int32_t> h_offsets(3 + 1);
+  CUDA_TRY(cudaMemcpy(h_offsets.data(),
+                      offsets->view().data<int32_t>(),
+                      h_offsets.size() * sizeof(int32_t),
+                      cudaMemcpyDeviceToHost));
+  EXPECT_EQ(h_offsets[1], 1 << 30);
+  EXPECT_EQ(h_offsets[3], std::numeric_limits<cudf::size_type>::max());
+  EXPECT_THROW(cudf::strings::detail::create_chars_child_column(3, 0, h_offsets[3]),
+               cudf::logic_error);
+}
+
 struct column_to_string_view_vector {
   cudf::column_device_view const d_strings;
   __device__ cudf::string_view operator()(cudf::size_type idx) const
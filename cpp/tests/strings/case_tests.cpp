@@ -15,6 +15,7 @@
  */
 
 #include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/strings/capitalize.hpp>
 #include <cudf/strings/case.hpp>
 #include <cudf/strings/strings_column_view.hpp>
@@ -95,6 +96,53 @@ TEST_F(StringsCaseTest, Swapcase)
   cudf::test::expect_columns_equal(*results, expected);
 }
 
+TEST_F(StringsCaseTest, AsciiSlices)
+{
+  // All ASCII, converted 4 bytes at a time regardless of the string boundaries
+  std::vector<const char*> h_strings{
+    "@Zaz[`{", "Examples aBc", nullptr, "ARE THE", "x", "", "tESt StrINGS 123"};
+  std::vector<const char*> h_lower{
+    "@zaz[`{", "examples abc", nullptr, "are the", "x", "", "test strings 123"};
+  std::vector<const char*> h_upper{
+    "@ZAZ[`{", "EXAMPLES ABC", nullptr, "ARE THE", "X", "", "TEST STRINGS 123"};
+  std::vector<const char*> h_swapped{
+    "@zAZ[`{", "eXAMPLES AbC", nullptr, "are the", "X", "", "TesT sTRings 123"};
+  auto validity = [](std::vector<const char*> const& h) {
+    return thrust::make_transform_iterator(h.begin(), [](auto str) { return str != nullptr; });
+  };
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(), h_strings.end(), validity(h_strings));
+  cudf::test::strings_column_wrapper lower(h_lower.begin(), h_lower.end(), validity(h_lower));
+  cudf::test::strings_column_wrapper upper(h_upper.begin(), h_upper.end(), validity(h_upper));
+  cudf::test::strings_column_wrapper swapped(
+    h_swapped.begin(), h_swapped.end(), validity(h_swapped));
+
+  auto strings_view = cudf::strings_column_view(strings);
+  cudf::test::expect_columns_equal(*cudf::strings::to_lower(strings_view), lower);
+  cudf::test::expect_columns_equal(*cudf::strings::to_upper(strings_view), upper);
+  cudf::test::expect_columns_equal(*cudf::strings::swapcase(strings_view), swapped);
+
+  // A slice starting in the middle of the chars
+  auto sliced = cudf::slice(strings, {1, 5}).front();
+  cudf::test::expect_columns_equal(*cudf::strings::to_upper(cudf::strings_column_view(sliced)),
+                                   cudf::slice(upper, {1, 5}).front());
+}
+
+TEST_F(StringsCaseTest, NonAsciiHeadAndTail)
+{
+  // Slices whose only non-ASCII bytes are before or after the aligned words of their chars
+  cudf::test::strings_column_wrapper strings({"a", "é", "bcdefghé", "ÉIJ", "kl", "mé"});
+  cudf::test::strings_column_wrapper upper({"A", "É", "BCDEFGHÉ", "ÉIJ", "KL", "MÉ"});
+  for (cudf::size_type begin = 0; begin < 6; ++begin) {
+    for (cudf::size_type end = begin + 1; end <= 6; ++end) {
+      auto sliced = cudf::slice(strings, {begin, end}).front();
+      cudf::test::expect_columns_equal(
+        *cudf::strings::to_upper(cudf::strings_column_view(sliced)),
+        cudf::slice(upper, {begin, end}).front());
+    }
+  }
+}
+
 TEST_F(StringsCaseTest, EmptyStringsColumn)
 {
   cudf::column_view zero_size_strings_column(
@@ -275,6 +275,79 @@ TEST_F(StringsContainsTests, CountTest)
   }
 }
 
+TEST_F(StringsContainsTests, NonAnchoredPatterns)
+{
+  // patterns without anchors or word boundaries are evaluated with a DFA
+  std::vector<const char*> h_strings{
+    "abc123", "ovér 42", "x_y z", "\t\n", nullptr, "", "éé", "cat dog", "A1b2"};
+  auto validity =
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; });
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end(), validity);
+  auto strings_view = cudf::strings_column_view(strings);
+  {
+    auto results = cudf::strings::contains_re(strings_view, "\\d\\d");
+    cudf::test::fixed_width_column_wrapper<bool> expected(
+      {true, true, false, false, false, false, false, false, false}, validity);
+    cudf::test::expect_columns_equal(*results, expected);
+  }
+  {
+    auto results = cudf::strings::contains_re(strings_view, "(cat|dog|é)+");
+    cudf::test::fixed_width_column_wrapper<bool> expected(
+      {false, true, false, false, false, false, true, true, false}, validity);
+    cudf::test::expect_columns_equal(*results, expected);
+  }
+  {
+    auto results = cudf::strings::contains_re(strings_view, "[^a-z0-9]");
+    cudf::test::fixed_width_column_wrapper<bool> expected(
+      {false, true, true, true, false, false, true, true, true}, validity);
+    cudf::test::expect_columns_equal(*results, expected);
+  }
+  {
+    auto results = cudf::strings::matches_re(strings_view, "[a-z]\\w*\\s");
+    cudf::test::fixed_width_column_wrapper<bool> expected(
+      {false, true, true, false, false, false, false, true, false}, validity);
+    cudf::test::expect_columns_equal(*results, expected);
+  }
+  {
+    auto results = cudf::strings::matches_re(strings_view, "\\D+$");
+    cudf::test::fixed_width_column_wrapper<bool> expected(
+      {false, false, true, true, false, false, true, true, false}, validity);
+    cudf::test::expect_columns_equal(*results, expected);
+  }
+  {
+    auto results         = cudf::strings::count_re(strings_view, "[a-z]\\d");
+    int32_t h_expected[] = {1, 0, 0, 0, 0, 0, 0, 0, 1};
+    cudf::test::fixed_width_column_wrapper<int32_t> expected(
+      h_expected, h_expected + h_strings.size(), validity);
+    cudf::test::expect_columns_equal(*results, expected);
+  }
+}
+
+TEST_F(StringsContainsTests, RegexProgram)
+{
+  auto program = cudf::strings::regex_program::create("(\\d+)-(\\w+)");
+  EXPECT_EQ(program->pattern(), "(\\d+)-(\\w+)");
+  EXPECT_EQ(program->groups_count(), 2);
+
+  // the same program evaluates several columns
+  cudf::test::strings_column_wrapper strings1({"12-ab 3-c", "x-y", "-1-2"}, {1, 1, 0});
+  auto view1 = cudf::strings_column_view(strings1);
+  cudf::test::expect_columns_equal(*cudf::strings::contains_re(view1, *program),
+                                   *cudf::strings::contains_re(view1, program->pattern()));
+  cudf::test::expect_columns_equal(*cudf::strings::matches_re(view1, *program),
+                                   *cudf::strings::matches_re(view1, program->pattern()));
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_counts({2, 0, 0}, {1, 1, 0});
+  cudf::test::expect_columns_equal(*cudf::strings::count_re(view1, *program), expected_counts);
+
+  cudf::test::strings_column_wrapper strings2({"a", "7-b", "", "b 7-"});
+  auto view2 = cudf::strings_column_view(strings2);
+  cudf::test::fixed_width_column_wrapper<bool> expected({false, true, false, false});
+  cudf::test::expect_columns_equal(*cudf::strings::contains_re(view2, *program), expected);
+  cudf::test::expect_columns_equal(*cudf::strings::matches_re(view2, *program), expected);
+
+  EXPECT_THROW(cudf::strings::regex_program::create("*a"), cudf::logic_error);
+}
+
 TEST_F(StringsContainsTests, MediumRegex)
 {
   // This results in 95 regex instructions and falls in the 'medium' range.
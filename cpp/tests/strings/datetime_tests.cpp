@@ -56,6 +56,19 @@ TEST_F(StringsDatetimeTest, ToTimestamp)
   cudf::test::expect_columns_equal(*results, expected);
 }
 
+TEST_F(StringsDatetimeTest, ToTimestampShortStrings)
+{
+  cudf::test::strings_column_wrapper strings{
+    "2019-07-17T21:34:37", "2019-07-17", "2019-07-17T21:34:37.5", "1969-12-31T23:59:45"};
+  auto strings_view = cudf::strings_column_view(strings);
+  auto results      = cudf::strings::to_timestamps(
+    strings_view, cudf::data_type{cudf::type_id::TIMESTAMP_SECONDS}, "%Y-%m-%dT%H:%M:%S");
+  // strings shorter than the format are not parsed
+  cudf::test::fixed_width_column_wrapper<cudf::timestamp_s> expected{
+    1563399277, 0, 1563399277, -15};
+  cudf::test::expect_columns_equal(*results, expected);
+}
+
 TEST_F(StringsDatetimeTest, ToTimestampAmPm)
 {
   cudf::test::strings_column_wrapper strings{"1974-02-28 01:23:45 PM",
@@ -23,6 +23,7 @@
 #include <tests/utilities/column_utilities.hpp>
 #include <tests/utilities/column_wrapper.hpp>
 
+#include <string>
 #include <vector>
 
 struct StringsFindMultipleTest : public cudf::test::BaseFixture {
@@ -78,3 +79,73 @@ TEST_F(StringsFindMultipleTest, ErrorTest)
   // targets cannot have nulls
   EXPECT_THROW(cudf::strings::find_multiple(strings_view, strings_view), cudf::logic_error);
 }
+
+TEST_F(StringsFindMultipleTest, FindAny)
+{
+  std::vector<const char*> h_strings{"abcd", "xbcdx", "z", nullptr, "", "ébcé"};
+  auto validity =
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; });
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end(), validity);
+  auto strings_view = cudf::strings_column_view(strings);
+  cudf::test::strings_column_wrapper patterns({"bcd", "abc", "c", "cé"});
+  auto patterns_view = cudf::strings_column_view(patterns);
+
+  cudf::strings::multi_pattern_matcher matcher(patterns_view);
+  {
+    auto results = matcher.find_any(strings_view);
+    cudf::test::fixed_width_column_wrapper<int32_t> expected({1, 2, -1, 0, -1, 2}, validity);
+    cudf::test::expect_columns_equal(*results, expected);
+    cudf::test::expect_columns_equal(*cudf::strings::find_any(strings_view, patterns_view),
+                                     expected);
+  }
+  {
+    auto results = matcher.contains_any(strings_view);
+    cudf::test::fixed_width_column_wrapper<bool> expected(
+      {true, true, false, false, false, true}, validity);
+    cudf::test::expect_columns_equal(*results, expected);
+    cudf::test::expect_columns_equal(*cudf::strings::contains_any(strings_view, patterns_view),
+                                     expected);
+  }
+}
+
+TEST_F(StringsFindMultipleTest, FindAnyManyPatterns)
+{
+  std::vector<std::string> h_patterns;
+  for (int i = 0; i < 1000; ++i) { h_patterns.push_back("k" + std::to_string(i * 7)); }
+  cudf::test::strings_column_wrapper patterns(h_patterns.begin(), h_patterns.end());
+  cudf::strings::multi_pattern_matcher matcher(cudf::strings_column_view(patterns));
+
+  // the matcher is reused for several columns
+  cudf::test::strings_column_wrapper strings1({"zz k42 zz", "k43", "k6993", "xk6993x"});
+  cudf::test::fixed_width_column_wrapper<int32_t> expected1({6, -1, 999, 999});
+  cudf::test::expect_columns_equal(*matcher.find_any(cudf::strings_column_view(strings1)),
+                                   expected1);
+
+  // "k7" ends before "k70" and "k707"
+  cudf::test::strings_column_wrapper strings2({"k707", "k0", "", "kkk14"});
+  cudf::test::fixed_width_column_wrapper<int32_t> expected2({1, 0, -1, 2});
+  cudf::test::expect_columns_equal(*matcher.find_any(cudf::strings_column_view(strings2)),
+                                   expected2);
+}
+
+TEST_F(StringsFindMultipleTest, FindAnyEmptyPattern)
+{
+  cudf::test::strings_column_wrapper strings({"abc", "", "xyz"}, {1, 1, 0});
+  cudf::test::strings_column_wrapper patterns({"b", ""});
+  auto results = cudf::strings::find_any(cudf::strings_column_view(strings),
+                                         cudf::strings_column_view(patterns));
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({1, 1, 0}, {1, 1, 0});
+  cudf::test::expect_columns_equal(*results, expected);
+}
+
+TEST_F(StringsFindMultipleTest, FindAnyErrorTest)
+{
+  cudf::column_view zero_size_strings_column(
+    cudf::data_type{cudf::type_id::STRING}, 0, nullptr, nullptr, 0);
+  auto empty_view = cudf::strings_column_view(zero_size_strings_column);
+  EXPECT_THROW(cudf::strings::multi_pattern_matcher{empty_view}, cudf::logic_error);
+
+  cudf::test::strings_column_wrapper patterns({"a", "b"}, {1, 0});
+  EXPECT_THROW(cudf::strings::multi_pattern_matcher{cudf::strings_column_view(patterns)},
+               cudf::logic_error);
+}
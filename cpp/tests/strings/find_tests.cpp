@@ -234,6 +234,54 @@ TEST_F(StringsFindTest, AllNull)
   cudf::test::expect_columns_equal(*results, expected8);
 }
 
+TEST_F(StringsFindTest, LongStrings)
+{
+  // searched with a warp per string, then with a block per string
+  for (int32_t const size : {300, 30000}) {
+    auto const padding = std::string(size, 'x');
+    std::vector<std::string> h_strings{
+      padding + "héllo" + padding + "héllo", "héllo", padding, ""};
+    std::vector<bool> h_valids{1, 1, 0, 1};
+    cudf::test::strings_column_wrapper strings(
+      h_strings.begin(), h_strings.end(), h_valids.begin());
+    auto strings_view = cudf::strings_column_view(strings);
+    {
+      cudf::test::fixed_width_column_wrapper<int32_t> expected({size + 2, 2, -1, -1},
+                                                               {1, 1, 0, 1});
+      auto results = cudf::strings::find(strings_view, cudf::string_scalar("llo"));
+      cudf::test::expect_columns_equal(*results, expected);
+    }
+    {
+      cudf::test::fixed_width_column_wrapper<int32_t> expected({2 * size + 7, -1, -1, -1},
+                                                               {1, 1, 0, 1});
+      auto results = cudf::strings::find(strings_view, cudf::string_scalar("llo"), size + 3);
+      cudf::test::expect_columns_equal(*results, expected);
+    }
+    {
+      cudf::test::fixed_width_column_wrapper<int32_t> expected({-1, 1, -1, -1}, {1, 1, 0, 1});
+      auto results = cudf::strings::find(strings_view, cudf::string_scalar("é"), 0, 5);
+      cudf::test::expect_columns_equal(*results, expected);
+    }
+    {
+      cudf::test::fixed_width_column_wrapper<int32_t> expected({2 * size + 7, 2, -1, -1},
+                                                               {1, 1, 0, 1});
+      auto results = cudf::strings::rfind(strings_view, cudf::string_scalar("llo"));
+      cudf::test::expect_columns_equal(*results, expected);
+    }
+    {
+      cudf::test::fixed_width_column_wrapper<int32_t> expected({2 * size + 10, 5, -1, 0},
+                                                               {1, 1, 0, 1});
+      auto results = cudf::strings::rfind(strings_view, cudf::string_scalar(""));
+      cudf::test::expect_columns_equal(*results, expected);
+    }
+    {
+      cudf::test::fixed_width_column_wrapper<bool> expected({1, 1, 0, 0}, {1, 1, 0, 1});
+      auto results = cudf::strings::contains(strings_view, cudf::string_scalar("é"));
+      cudf::test::expect_columns_equal(*results, expected);
+    }
+  }
+}
+
 class FindParmsTest : public StringsFindTest, public testing::WithParamInterface<int32_t> {
 };
 
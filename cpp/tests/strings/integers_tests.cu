@@ -49,6 +49,27 @@ TEST_F(StringsConvertTest, ToInteger)
   cudf::test::expect_columns_equal(*results, expected);
 }
 
+TEST_F(StringsConvertTest, ToIntegerLongDigits)
+{
+  cudf::test::strings_column_wrapper strings{"123456789012345678",
+                                             "-9223372036854775807",
+                                             "+00000000000000042",
+                                             "12345678x9",
+                                             "1234567",
+                                             "87654321",
+                                             "9876543210.5"};
+  auto results = cudf::strings::to_integers(cudf::strings_column_view(strings),
+                                            cudf::data_type{cudf::type_id::INT64});
+  cudf::test::fixed_width_column_wrapper<int64_t> expected{123456789012345678L,
+                                                           -9223372036854775807L,
+                                                           42L,
+                                                           12345678L,
+                                                           1234567L,
+                                                           87654321L,
+                                                           9876543210L};
+  cudf::test::expect_columns_equal(*results, expected);
+}
+
 TEST_F(StringsConvertTest, FromInteger)
 {
   int32_t minint = std::numeric_limits<int32_t>::min();
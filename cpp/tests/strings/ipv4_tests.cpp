@@ -16,6 +16,7 @@
 
 #include <tests/strings/utilities.h>
 #include <cudf/strings/convert/convert_ipv4.hpp>
+#include <cudf/strings/convert/convert_ipv6.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <tests/utilities/base_fixture.hpp>
 #include <tests/utilities/column_utilities.hpp>
@@ -107,3 +108,38 @@ TEST_F(StringsConvertTest, IsIPv4)
   auto results = cudf::strings::is_ipv4(cudf::strings_column_view(strings));
   cudf::test::expect_columns_equal(*results, expected);
 }
+
+TEST_F(StringsConvertTest, IPv6ToIntegers)
+{
+  std::vector<const char*> h_strings{nullptr,
+                                     "::",
+                                     "::1",
+                                     "1:2:3:4:5:6:7:8",
+                                     "2001:db8::ff00:42:8329",
+                                     "fe80::",
+                                     "::ffff:192.168.0.1"};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.cbegin(),
+    h_strings.cend(),
+    thrust::make_transform_iterator(h_strings.begin(),
+                                    [](auto const str) { return str != nullptr; }));
+
+  auto results = cudf::strings::ipv6_to_integers(cudf::strings_column_view(strings));
+
+  auto validity = thrust::make_transform_iterator(h_strings.begin(),
+                                                  [](auto const str) { return str != nullptr; });
+  cudf::test::fixed_width_column_wrapper<uint64_t> expected_high(
+    {0UL, 0UL, 0UL, 0x0001000200030004UL, 0x20010db800000000UL, 0xfe80000000000000UL, 0UL},
+    validity);
+  cudf::test::fixed_width_column_wrapper<uint64_t> expected_low(
+    {0UL, 0UL, 1UL, 0x0005000600070008UL, 0x0000ff0000428329UL, 0UL, 0x0000ffffc0a80001UL},
+    validity);
+  cudf::test::expect_columns_equal(results->get_column(0), expected_high);
+  cudf::test::expect_columns_equal(results->get_column(1), expected_low);
+
+  cudf::column_view zero_size_column(
+    cudf::data_type{cudf::type_id::STRING}, 0, nullptr, nullptr, 0);
+  results = cudf::strings::ipv6_to_integers(cudf::strings_column_view(zero_size_column));
+  EXPECT_EQ(2, results->num_columns());
+  EXPECT_EQ(0, results->num_rows());
+}
@@ -241,3 +241,29 @@ TEST_F(StringsReplaceTests, LargeReplaceRegex)
     thrust::make_transform_iterator(h_expected.begin(), [](auto str) { return str != nullptr; }));
   cudf::test::expect_columns_equal(*results, expected);
 }
+
+TEST_F(StringsReplaceTests, ReplaceRegexProgram)
+{
+  // more than 1000 instructions so each evaluation allocates its own state memory
+  std::string const long_pattern(1100, 'a');
+  auto program = cudf::strings::regex_program::create(long_pattern);
+
+  cudf::test::strings_column_wrapper strings1({"b" + long_pattern + "b", "ab"});
+  auto results = cudf::strings::replace_re(
+    cudf::strings_column_view(strings1), *program, cudf::string_scalar("X"));
+  cudf::test::strings_column_wrapper expected1({"bXb", "ab"});
+  cudf::test::expect_columns_equal(*results, expected1);
+
+  cudf::test::strings_column_wrapper strings2({"", long_pattern + long_pattern, "a", "c"});
+  results = cudf::strings::replace_re(
+    cudf::strings_column_view(strings2), *program, cudf::string_scalar("X"));
+  cudf::test::strings_column_wrapper expected2({"", "XX", "a", "c"});
+  cudf::test::expect_columns_equal(*results, expected2);
+
+  auto backrefs = cudf::strings::regex_program::create("(\\w) (\\d)");
+  cudf::test::strings_column_wrapper strings3({"a 1 b 2", "c3"});
+  results = cudf::strings::replace_with_backrefs(
+    cudf::strings_column_view(strings3), *backrefs, "\\2\\1");
+  cudf::test::strings_column_wrapper expected3({"1a 2b", "c3"});
+  cudf::test::expect_columns_equal(*results, expected3);
+}
@@ -80,6 +80,48 @@ TEST_F(StringsReplaceTest, Replace)
   }
 }
 
+TEST_F(StringsReplaceTest, ReplaceLongStrings)
+{
+  // replaced with a thread per byte, for strings averaging a few hundred bytes then 20KB
+  for (auto const size : {300, 30000}) {
+    auto const padding = std::string(size, 'x');
+    std::vector<std::string> h_strings{
+      padding + "the " + padding + "the", "éé thé", padding, ""};
+    std::vector<bool> h_valids{1, 1, 0, 1};
+    cudf::test::strings_column_wrapper strings(
+      h_strings.begin(), h_strings.end(), h_valids.begin());
+    auto strings_view = cudf::strings_column_view(strings);
+    {
+      auto results = cudf::strings::replace(
+        strings_view, cudf::string_scalar("the"), cudf::string_scalar("tête"));
+      std::vector<std::string> h_expected{
+        padding + "tête " + padding + "tête", "éé thé", "", ""};
+      cudf::test::strings_column_wrapper expected(
+        h_expected.begin(), h_expected.end(), h_valids.begin());
+      cudf::test::expect_columns_equal(*results, expected);
+    }
+    {
+      auto results =
+        cudf::strings::replace(strings_view, cudf::string_scalar("é"), cudf::string_scalar(""));
+      std::vector<std::string> h_expected{h_strings[0], " th", "", ""};
+      cudf::test::strings_column_wrapper expected(
+        h_expected.begin(), h_expected.end(), h_valids.begin());
+      cudf::test::expect_columns_equal(*results, expected);
+    }
+    {
+      // occurrences of "xx" overlap, so they are replaced a string per thread
+      auto results =
+        cudf::strings::replace(strings_view, cudf::string_scalar("xx"), cudf::string_scalar("y"));
+      auto const replaced = std::string(size / 2, 'y');
+      std::vector<std::string> h_expected{
+        replaced + "the " + replaced + "the", "éé thé", "", ""};
+      cudf::test::strings_column_wrapper expected(
+        h_expected.begin(), h_expected.end(), h_valids.begin());
+      cudf::test::expect_columns_equal(*results, expected);
+    }
+  }
+}
+
 TEST_F(StringsReplaceTest, ReplaceSlice)
 {
   std::vector<const char*> h_strings{"Héllo", "thesé", nullptr, "ARE THE", "tést strings", ""};
@@ -196,6 +238,21 @@ TEST_F(StringsReplaceTest, ReplaceMulti)
   }
 }
 
+TEST_F(StringsReplaceTest, ReplaceMultiPrefixTargets)
+{
+  cudf::test::strings_column_wrapper strings({"abcd abc ab a", "bab", "xyz", ""});
+  // where several targets start at a position, the first one in targets is replaced
+  cudf::test::strings_column_wrapper targets({"ab", "abc", "b", "a"});
+  cudf::test::strings_column_wrapper repls({"1", "2", "3", "4"});
+
+  auto results = cudf::strings::replace(cudf::strings_column_view(strings),
+                                        cudf::strings_column_view(targets),
+                                        cudf::strings_column_view(repls));
+
+  cudf::test::strings_column_wrapper expected({"1cd 1c 1 4", "31", "xyz", ""});
+  cudf::test::expect_columns_equal(*results, expected);
+}
+
 TEST_F(StringsReplaceTest, ReplaceNulls)
 {
   std::vector<const char*> h_strings{"Héllo", "thesé", nullptr, "ARE THE", "tést strings", ""};
@@ -129,6 +129,38 @@ TEST_F(StringsSplitTest, SplitWhitespaceWithMax)
   cudf::test::expect_tables_equal(*results, *expected);
 }
 
+TEST_F(StringsSplitTest, SplitWhitespaceLongStrings)
+{
+  // tokens counted with a thread per byte, for strings averaging a few hundred bytes then 20KB
+  for (auto const size : {300, 30000}) {
+    auto const padding = std::string(size, 'x');
+    std::vector<std::string> h_strings{padding + " a\tb  " + padding, "  c ", padding, ""};
+    std::vector<bool> h_valids{1, 1, 0, 1};
+    cudf::test::strings_column_wrapper strings(
+      h_strings.begin(), h_strings.end(), h_valids.begin());
+
+    std::vector<std::string> h_expected1{padding, "c", "", ""};
+    std::vector<std::string> h_expected2{"a", "", "", ""};
+    std::vector<std::string> h_expected3{"b", "", "", ""};
+    std::vector<std::string> h_expected4{padding, "", "", ""};
+    std::vector<bool> h_valids1{1, 1, 0, 0};
+    std::vector<bool> h_valids2{1, 0, 0, 0};
+    std::vector<std::unique_ptr<cudf::column>> expected_columns;
+    expected_columns.push_back(cudf::test::strings_column_wrapper(
+                                 h_expected1.begin(), h_expected1.end(), h_valids1.begin())
+                                 .release());
+    for (auto h_expected : {h_expected2, h_expected3, h_expected4})
+      expected_columns.push_back(cudf::test::strings_column_wrapper(
+                                   h_expected.begin(), h_expected.end(), h_valids2.begin())
+                                   .release());
+    auto expected = std::make_unique<cudf::table>(std::move(expected_columns));
+
+    auto results = cudf::strings::split(cudf::strings_column_view(strings));
+    EXPECT_TRUE(results->num_columns() == 4);
+    cudf::test::expect_tables_equal(*results, *expected);
+  }
+}
+
 TEST_F(StringsSplitTest, RSplit)
 {
   std::vector<const char*> h_strings{
@@ -607,6 +639,69 @@ TEST_F(StringsSplitTest, ContiguousSplitRecordZeroSizeStringsColumns)
   EXPECT_TRUE(rsplit_record_result.column_views.size() == 0);
 }
 
+TEST_F(StringsSplitTest, SplitRecord)
+{
+  std::vector<const char*> h_strings{" Héllo thesé", nullptr, "are some  ", "tést String", ""};
+  auto validity =
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; });
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end(), validity);
+
+  auto results =
+    cudf::strings::split_record(cudf::strings_column_view(strings), cudf::string_scalar(" "));
+  cudf::test::lists_column_wrapper<cudf::string_view> expected(
+    {{"", "Héllo", "thesé"}, {""}, {"are", "some", "", ""}, {"tést", "String"}, {""}}, validity);
+  cudf::test::expect_columns_equal(*results, expected);
+}
+
+TEST_F(StringsSplitTest, SplitRecordWhitespaceWithMaxSplit)
+{
+  std::vector<const char*> h_strings{" Héllo thesé", nullptr, "are some  ", "tést String", "  a"};
+  auto validity =
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; });
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end(), validity);
+  cudf::strings_column_view strings_view(strings);
+
+  auto results = cudf::strings::split_record(strings_view, cudf::string_scalar(""), 1);
+  cudf::test::lists_column_wrapper<cudf::string_view> expected(
+    {{"Héllo", "thesé"}, {""}, {"are", "some  "}, {"tést", "String"}, {"a"}}, validity);
+  cudf::test::expect_columns_equal(*results, expected);
+
+  results = cudf::strings::rsplit_record(strings_view, cudf::string_scalar(""), 1);
+  cudf::test::lists_column_wrapper<cudf::string_view> rexpected(
+    {{" Héllo", "thesé"}, {""}, {"are", "some"}, {"tést", "String"}, {"a"}}, validity);
+  cudf::test::expect_columns_equal(*results, rexpected);
+}
+
+TEST_F(StringsSplitTest, SplitPart)
+{
+  std::vector<const char*> h_strings{"key=value", "other=", "none", nullptr, "a=b=c"};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  cudf::strings_column_view strings_view(strings);
+
+  auto results = cudf::strings::split_part(strings_view, 1, cudf::string_scalar("="));
+  cudf::test::strings_column_wrapper expected({"value", "", "", "", "b"}, {1, 1, 0, 0, 1});
+  cudf::test::expect_columns_equal(*results, expected);
+
+  // the same column as split returns
+  auto table = cudf::strings::split(strings_view, cudf::string_scalar("="));
+  results    = cudf::strings::split_part(strings_view, 0, cudf::string_scalar("="));
+  cudf::test::expect_columns_equal(*results, table->get_column(0));
+  results = cudf::strings::split_part(strings_view, 2, cudf::string_scalar("="));
+  cudf::test::expect_columns_equal(*results, table->get_column(2));
+}
+
+TEST_F(StringsSplitTest, SplitRecordZeroSizeStringsColumns)
+{
+  cudf::column_view zero_size_strings_column(
+    cudf::data_type{cudf::type_id::STRING}, 0, nullptr, nullptr, 0);
+  EXPECT_EQ(cudf::strings::split_record(zero_size_strings_column)->size(), 0);
+  EXPECT_EQ(cudf::strings::rsplit_record(zero_size_strings_column)->size(), 0);
+  EXPECT_EQ(cudf::strings::split_part(zero_size_strings_column, 0)->size(), 0);
+}
+
 TEST_F(StringsSplitTest, Partition)
 {
   std::vector<const char*> h_strings{
@@ -15,7 +15,9 @@
  */
 
 #include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/detail/string_index_pairs.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/strings/substring.hpp>
 
@@ -24,6 +26,7 @@
 #include <tests/utilities/column_utilities.hpp>
 #include <tests/utilities/column_wrapper.hpp>
 
+#include <thrust/host_vector.h>
 #include <thrust/sequence.h>
 #include <string>
 #include <vector>
@@ -49,6 +52,44 @@ TEST_F(StringsSubstringsTest, Substring)
   cudf::test::expect_columns_equal(*results, expected);
 }
 
+TEST_F(StringsSubstringsTest, SubstringIndexPairs)
+{
+  std::vector<const char*> h_strings{"Héllo", "thesé", nullptr, "ARE THE", "tést strings", ""};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  auto strings_column = cudf::strings_column_view(strings);
+
+  auto const firsts = cudf::strings::detail::slice_strings_index_pairs(
+    strings_column, cudf::numeric_scalar<cudf::size_type>(0), 2);
+  auto const lasts = cudf::strings::detail::slice_strings_index_pairs(
+    strings_column, -3, cudf::numeric_scalar<cudf::size_type>(0, false));
+
+  // the substrings reference the chars of the strings
+  thrust::host_vector<cudf::strings::detail::string_index_pair> h_firsts(firsts);
+  auto const d_chars = strings_column.chars().data<char>();
+  EXPECT_EQ(h_firsts[0].first, d_chars);
+  EXPECT_EQ(h_firsts[1].first, d_chars + 6);
+  EXPECT_EQ(h_firsts[2].first, nullptr);
+
+  std::vector<const char*> h_expected_firsts({"Hé", "th", nullptr, "AR", "té", ""});
+  cudf::test::strings_column_wrapper expected_firsts(
+    h_expected_firsts.begin(),
+    h_expected_firsts.end(),
+    thrust::make_transform_iterator(h_expected_firsts.begin(),
+                                    [](auto str) { return str != nullptr; }));
+  cudf::test::expect_columns_equal(*cudf::make_strings_column(firsts), expected_firsts);
+
+  std::vector<const char*> h_expected_lasts({"llo", "esé", nullptr, "THE", "ngs", ""});
+  cudf::test::strings_column_wrapper expected_lasts(
+    h_expected_lasts.begin(),
+    h_expected_lasts.end(),
+    thrust::make_transform_iterator(h_expected_lasts.begin(),
+                                    [](auto str) { return str != nullptr; }));
+  cudf::test::expect_columns_equal(*cudf::make_strings_column(lasts), expected_lasts);
+}
+
 class SubstringParmsTest : public StringsSubstringsTest,
                            public testing::WithParamInterface<int32_t> {
 };
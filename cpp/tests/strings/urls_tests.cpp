@@ -107,3 +107,25 @@ TEST_F(StringsConvertTest, ZeroSizeUrlStringsColumn)
   results = cudf::strings::url_decode(zero_size_column);
   cudf::test::expect_strings_empty(results->view());
 }
+
+TEST_F(StringsConvertTest, UrlEncodeDecodeLongStrings)
+{
+  // long enough strings that each is converted by a warp of threads
+  std::string h_decoded;
+  std::string h_encoded;
+  for (int i = 0; i < 100; ++i) {
+    h_decoded += "a b/c%d";
+    h_encoded += "a%20b%2Fc%25d";
+  }
+  std::vector<const char*> h_strings{h_decoded.c_str(), nullptr, "", h_decoded.c_str()};
+  std::vector<const char*> h_expected{h_encoded.c_str(), nullptr, "", h_encoded.c_str()};
+  auto validity = thrust::make_transform_iterator(h_strings.cbegin(),
+                                                  [](auto const str) { return str != nullptr; });
+  cudf::test::strings_column_wrapper decoded(h_strings.cbegin(), h_strings.cend(), validity);
+  cudf::test::strings_column_wrapper encoded(h_expected.cbegin(), h_expected.cend(), validity);
+
+  auto results = cudf::strings::url_encode(cudf::strings_column_view(decoded));
+  cudf::test::expect_columns_equal(*results, encoded);
+  results = cudf::strings::url_decode(cudf::strings_column_view(encoded));
+  cudf::test::expect_columns_equal(*results, decoded);
+}
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/distributed_table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <memory>
+#include <vector>
+
+using int_column = cudf::test::fixed_width_column_wrapper<int32_t>;
+using strings    = cudf::test::strings_column_wrapper;
+
+struct DistributedTableTest : public cudf::test::BaseFixture {
+  /**
+   * @brief Makes a table of `tables`, spread over the available devices
+   */
+  cudf::distributed_table distribute(std::vector<cudf::table_view> const& tables)
+  {
+    int num_devices = 0;
+    CUDA_TRY(cudaGetDeviceCount(&num_devices));
+    int current = 0;
+    CUDA_TRY(cudaGetDevice(&current));
+
+    std::vector<cudf::device_partition> partitions;
+    for (size_t i = 0; i < tables.size(); ++i) {
+      auto const device = static_cast<int>(i) % num_devices;
+      CUDA_TRY(cudaSetDevice(device));
+      partitions.push_back({device,
+                            std::make_unique<cudf::table>(tables[i]),
+                            rmm::mr::get_default_resource()});
+      CUDA_TRY(cudaDeviceSynchronize());
+    }
+    CUDA_TRY(cudaSetDevice(current));
+    return cudf::distributed_table{std::move(partitions)};
+  }
+};
+
+TEST_F(DistributedTableTest, Concatenate)
+{
+  int_column a0{{1, 2, 3}, {1, 0, 1}};
+  strings b0{"a", "bb", "ccc"};
+  int_column a1{};
+  strings b1{};
+  int_column a2{4, 5};
+  strings b2{{"dddd", ""}, {1, 0}};
+  auto const input = distribute({{{a0, b0}}, {{a1, b1}}, {{a2, b2}}});
+  EXPECT_EQ(input.num_partitions(), 3);
+  EXPECT_EQ(input.num_rows(), 5);
+
+  int_column expected_a{{1, 2, 3, 4, 5}, {1, 0, 1, 1, 1}};
+  strings expected_b{{"a", "bb", "ccc", "dddd", ""}, {1, 1, 1, 1, 0}};
+  auto const result = cudf::concatenate(input, 0);
+  cudf::test::expect_tables_equal(result->view(), cudf::table_view{{expected_a, expected_b}});
+}
+
+TEST_F(DistributedTableTest, Gather)
+{
+  int_column a0{10, 11, 12};
+  strings b0{"a", "bb", "ccc"};
+  int_column a1{13, 14};
+  strings b1{"dddd", "e"};
+  auto const input = distribute({{{a0, b0}}, {{a1, b1}}});
+
+  int_column gather_map{4, 0, 3, 3};
+  strings expected{"e", "a", "dddd", "dddd"};
+  auto const result = cudf::gather(input, {1}, gather_map, 0);
+  cudf::test::expect_tables_equal(result->view(), cudf::table_view{{expected}});
+}
+
+TEST_F(DistributedTableTest, Reduce)
+{
+  int_column a0{{1, 2, 3}, {1, 0, 1}};
+  int_column a1{{7}, {0}};
+  int_column a2{-5, 20};
+  auto const input = distribute({{{a0}}, {{a1}}, {{a2}}});
+
+  auto const int64 = cudf::data_type{cudf::type_id::INT64};
+  auto const sum   = cudf::reduce(input, 0, cudf::make_sum_aggregation(), int64, 0);
+  EXPECT_EQ(static_cast<cudf::scalar_type_t<int64_t>*>(sum.get())->value(), 19);
+
+  auto const int32 = cudf::data_type{cudf::type_id::INT32};
+  auto const min   = cudf::reduce(input, 0, cudf::make_min_aggregation(), int32, 0);
+  EXPECT_EQ(static_cast<cudf::scalar_type_t<int32_t>*>(min.get())->value(), -5);
+
+  auto const nulls = distribute({{{a1}}, {{a1}}});
+  auto const max   = cudf::reduce(nulls, 0, cudf::make_max_aggregation(), int32, 0);
+  EXPECT_FALSE(max->is_valid());
+
+  EXPECT_THROW(cudf::reduce(input, 0, cudf::make_mean_aggregation(), int64, 0), cudf::logic_error);
+}
+
+TEST_F(DistributedTableTest, Broadcast)
+{
+  int_column a0{1, 2, 3};
+  int_column a1{4};
+  auto const layout = distribute({{{a0}}, {{a1}}});
+
+  int_column keys{{5, 6, 7, 8}, {1, 1, 0, 1}};
+  strings values{"w", "x", "y", "z"};
+  auto const input  = cudf::slice(cudf::table_view{{keys, values}}, {1, 4}).front();
+  auto const result = cudf::broadcast(input, 0, layout);
+  ASSERT_EQ(result.num_partitions(), 2);
+  for (cudf::size_type i = 0; i < result.num_partitions(); ++i) {
+    EXPECT_EQ(result.partition(i).device, layout.partition(i).device);
+  }
+
+  auto const expected = cudf::concatenate({input, input});
+  cudf::test::expect_tables_equal(cudf::concatenate(result, 0)->view(), expected->view());
+}
+
+TEST_F(DistributedTableTest, BroadcastJoin)
+{
+  int_column keys0{1, 2, 3};
+  int_column values0{10, 20, 30};
+  int_column keys1{3, 4};
+  int_column values1{40, 50};
+  auto const probe = distribute({{{keys0, values0}}, {{keys1, values1}}});
+
+  int_column build_keys{3, 1, 5};
+  strings names{"c", "a", "e"};
+  auto const build = cudf::table_view{{build_keys, names}};
+
+  auto const inner  = cudf::broadcast_inner_join(probe, {0}, build, 0, {0});
+  auto const result = cudf::sort(cudf::concatenate(inner, 0)->view());
+  int_column expected_keys{1, 3, 3};
+  int_column expected_values{10, 30, 40};
+  int_column expected_build_keys{1, 3, 3};
+  strings expected_names{"a", "c", "c"};
+  cudf::test::expect_tables_equal(
+    result->view(),
+    cudf::table_view{{expected_keys, expected_values, expected_build_keys, expected_names}});
+
+  auto const left = cudf::broadcast_left_join(probe, {0}, build, 0, {0});
+  ASSERT_EQ(left.num_partitions(), 2);
+  EXPECT_EQ(left.partition(0).data->num_rows(), 3);
+  auto const left_result = cudf::sort(cudf::concatenate(left, 0)->view());
+  int_column expected_left_keys{1, 2, 3, 3, 4};
+  int_column expected_left_values{10, 20, 30, 40, 50};
+  int_column expected_left_build_keys{{1, 0, 3, 3, 0}, {1, 0, 1, 1, 0}};
+  strings expected_left_names{{"a", "", "c", "c", ""}, {1, 0, 1, 1, 0}};
+  cudf::test::expect_tables_equal(left_result->view(),
+                                  cudf::table_view{{expected_left_keys,
+                                                    expected_left_values,
+                                                    expected_left_build_keys,
+                                                    expected_left_names}});
+}
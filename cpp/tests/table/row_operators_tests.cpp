@@ -65,3 +65,45 @@ TEST_F(RowOperatorTestForNAN, NANSorting)
 
   cudf::test::expect_columns_equal(expected2, got2->view());
 }
+
+struct RowOperatorTestForCommonType : public cudf::test::BaseFixture {
+};
+
+TEST_F(RowOperatorTestForCommonType, SortingSameTypeColumns)
+{
+  // Both key columns are INT64, with and without nulls
+  cudf::test::fixed_width_column_wrapper<int64_t> col1{{2, 1, 2, 1, 3}};
+  cudf::test::fixed_width_column_wrapper<int64_t> col2{{5, 7, 4, 6, 0}};
+  cudf::test::fixed_width_column_wrapper<int64_t> col2_nulls{{5, 7, 4, 6, 0}, {1, 0, 1, 1, 1}};
+  std::vector<cudf::order> column_order{cudf::order::ASCENDING, cudf::order::DESCENDING};
+  std::vector<cudf::null_order> null_precedence{cudf::null_order::AFTER, cudf::null_order::AFTER};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected{{1, 3, 0, 2, 4}};
+  auto got = cudf::sorted_order(cudf::table_view{{col1, col2}}, column_order, null_precedence);
+  cudf::test::expect_columns_equal(expected, got->view());
+
+  // The null is the greatest value, first in descending order
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_nulls{{1, 3, 0, 2, 4}};
+  auto got_nulls =
+    cudf::sorted_order(cudf::table_view{{col1, col2_nulls}}, column_order, null_precedence);
+  cudf::test::expect_columns_equal(expected_nulls, got_nulls->view());
+
+  // Mixed types take the type dispatched comparator
+  cudf::test::fixed_width_column_wrapper<int32_t> col2_int32{{5, 7, 4, 6, 0}};
+  auto got_mixed =
+    cudf::sorted_order(cudf::table_view{{col1, col2_int32}}, column_order, null_precedence);
+  cudf::test::expect_columns_equal(expected, got_mixed->view());
+}
+
+TEST_F(RowOperatorTestForCommonType, SortingStringColumns)
+{
+  cudf::test::strings_column_wrapper col1({"b", "a", "b", "a", ""}, {1, 1, 1, 1, 0});
+  cudf::test::strings_column_wrapper col2({"x", "z", "w", "y", "v"});
+  std::vector<cudf::order> column_order{cudf::order::ASCENDING, cudf::order::ASCENDING};
+  std::vector<cudf::null_order> null_precedence{cudf::null_order::BEFORE,
+                                                cudf::null_order::BEFORE};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected{{4, 3, 1, 2, 0}};
+  auto got = cudf::sorted_order(cudf::table_view{{col1, col2}}, column_order, null_precedence);
+  cudf::test::expect_columns_equal(expected, got->view());
+}
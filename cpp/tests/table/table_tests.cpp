@@ -17,6 +17,7 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/sorting.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 
@@ -150,4 +151,29 @@ TEST_F(TableTest, CreateFromViewVectorEmptyTables)
   EXPECT_EQ(final_view.num_columns(), 0);
 }
 
+TEST_F(TableTest, SortOrder)
+{
+  column_wrapper<int32_t> col1{{3, 1, 2, 1}};
+  column_wrapper<int32_t> col2{{7, 8, 9, 6}, {1, 1, 1, 0}};
+  TView input{{col1, col2}};
+
+  auto sorted = cudf::sort(input, {cudf::order::ASCENDING, cudf::order::DESCENDING});
+  auto const& sort_order = sorted->sort_order();
+  EXPECT_EQ(sort_order.key_columns, (std::vector<cudf::size_type>{0, 1}));
+  EXPECT_TRUE(sorted->is_sorted_by({0}));
+  EXPECT_TRUE(sorted->is_sorted_by({0, 1}, {cudf::order::ASCENDING, cudf::order::DESCENDING}));
+  EXPECT_FALSE(sorted->is_sorted_by({0, 1}));
+  EXPECT_FALSE(sorted->is_sorted_by({1}, {cudf::order::DESCENDING}));
+  EXPECT_TRUE(cudf::is_sorted(*sorted, {cudf::order::ASCENDING, cudf::order::DESCENDING}, {}));
+
+  Table copy{*sorted};
+  EXPECT_TRUE(copy.is_sorted_by({0}));
+  copy.mutable_view();
+  EXPECT_FALSE(copy.is_sorted_by({0}));
+  EXPECT_TRUE(Table{input}.sort_order().key_columns.empty());
+
+  EXPECT_THROW(copy.set_sort_order({2}, {cudf::order::ASCENDING}), cudf::logic_error);
+  EXPECT_THROW(copy.set_sort_order({0}, {}), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <nvtext/subword_tokenize.hpp>
+
+#include <string>
+#include <vector>
+
+struct TextSubwordTokenizeTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(TextSubwordTokenizeTest, Tokenize)
+{
+  cudf::test::strings_column_wrapper vocabulary{
+    "[PAD]", "[UNK]", "the", "un", "##aff", "##able", ",", "cat", "##s", "é", "##é"};
+  nvtext::wordpiece_vocabulary const d_vocabulary(cudf::strings_column_view{vocabulary});
+
+  std::vector<const char*> h_strings{
+    "The unaffable, the ", "thé", nullptr, "", "cats éé\tcatsup"};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  cudf::strings_column_view strings_view(strings);
+
+  auto results = nvtext::subword_tokenize(strings_view, d_vocabulary, 6);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_ids{
+    2, 3, 4, 5, 6, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 8, 9, 10, 1, 0};
+  cudf::test::fixed_width_column_wrapper<int8_t> expected_mask{
+    1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0};
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_offsets{
+    0, 4, 6, 9, 13, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 5, 7, 10, 0};
+  cudf::test::expect_columns_equal(*results.token_ids, expected_ids);
+  cudf::test::expect_columns_equal(*results.attention_mask, expected_mask);
+  cudf::test::expect_columns_equal(*results.token_offsets, expected_offsets);
+
+  // without lower case "The" is unknown, and the tokens after the first 2 are dropped
+  results = nvtext::subword_tokenize(strings_view, d_vocabulary, 2, false);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_ids2{1, 3, 1, 0, 0, 0, 0, 0, 7, 8};
+  cudf::test::expect_columns_equal(*results.token_ids, expected_ids2);
+}
+
+TEST_F(TextSubwordTokenizeTest, LongWords)
+{
+  cudf::test::strings_column_wrapper vocabulary{"[UNK]", "a", "##a"};
+  nvtext::wordpiece_vocabulary const d_vocabulary(cudf::strings_column_view{vocabulary});
+
+  // words longer than 100 characters are unknown
+  cudf::test::strings_column_wrapper strings{std::string(100, 'a'), std::string(101, 'a')};
+  auto results = nvtext::subword_tokenize(cudf::strings_column_view{strings}, d_vocabulary, 3);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_ids{1, 2, 2, 0, 0, 0};
+  cudf::test::fixed_width_column_wrapper<int8_t> expected_mask{1, 1, 1, 1, 0, 0};
+  cudf::test::expect_columns_equal(*results.token_ids, expected_ids);
+  cudf::test::expect_columns_equal(*results.attention_mask, expected_mask);
+}
+
+TEST_F(TextSubwordTokenizeTest, EmptyStrings)
+{
+  cudf::test::strings_column_wrapper vocabulary{"[UNK]"};
+  nvtext::wordpiece_vocabulary const d_vocabulary(cudf::strings_column_view{vocabulary});
+  cudf::test::strings_column_wrapper strings{};
+  auto results = nvtext::subword_tokenize(cudf::strings_column_view{strings}, d_vocabulary, 8);
+  EXPECT_EQ(results.token_ids->size(), 0);
+  EXPECT_EQ(results.attention_mask->size(), 0);
+  EXPECT_EQ(results.token_offsets->size(), 0);
+}
+
+TEST_F(TextSubwordTokenizeTest, ErrorTest)
+{
+  cudf::test::strings_column_wrapper vocabulary{"a", "b"};
+  EXPECT_THROW(nvtext::wordpiece_vocabulary(cudf::strings_column_view{vocabulary}),
+               cudf::logic_error);
+  cudf::test::strings_column_wrapper nulls({"[UNK]", ""}, {1, 0});
+  EXPECT_THROW(nvtext::wordpiece_vocabulary(cudf::strings_column_view{nulls}), cudf::logic_error);
+
+  nvtext::wordpiece_vocabulary const d_vocabulary(cudf::strings_column_view{vocabulary}, "b");
+  cudf::test::strings_column_wrapper strings{"a b"};
+  EXPECT_THROW(nvtext::subword_tokenize(cudf::strings_column_view{strings}, d_vocabulary, 0),
+               cudf::logic_error);
+}
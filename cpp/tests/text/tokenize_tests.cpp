@@ -15,6 +15,7 @@
  */
 
 #include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <nvtext/tokenize.hpp>
@@ -59,6 +60,29 @@ TEST_F(TextTokenizeTest, Tokenize)
   cudf::test::expect_columns_equal(*results, expected_counts);
 }
 
+TEST_F(TextTokenizeTest, TokenizeDelimiterCharacters)
+{
+  cudf::test::strings_column_wrapper strings{"aé b", "éa", "bééc", "a", "éé"};
+  cudf::string_scalar delimiter("é");
+  {
+    cudf::test::strings_column_wrapper expected{"a", " b", "a", "b", "c", "a"};
+    auto results = nvtext::tokenize(cudf::strings_column_view(strings), delimiter);
+    cudf::test::expect_columns_equal(*results, expected);
+    cudf::test::fixed_width_column_wrapper<int32_t> expected_counts{2, 1, 2, 1, 0};
+    results = nvtext::count_tokens(cudf::strings_column_view(strings), delimiter);
+    cudf::test::expect_columns_equal(*results, expected_counts);
+  }
+  {
+    auto sliced = cudf::slice(strings, {1, 3}).front();
+    cudf::test::strings_column_wrapper expected{"a", "b", "c"};
+    auto results = nvtext::tokenize(cudf::strings_column_view(sliced), delimiter);
+    cudf::test::expect_columns_equal(*results, expected);
+    cudf::test::fixed_width_column_wrapper<int32_t> expected_counts{1, 2};
+    results = nvtext::count_tokens(cudf::strings_column_view(sliced), delimiter);
+    cudf::test::expect_columns_equal(*results, expected_counts);
+  }
+}
+
 TEST_F(TextTokenizeTest, TokenizeMulti)
 {
   std::vector<const char*> h_strings{"the fox jumped over the dog",
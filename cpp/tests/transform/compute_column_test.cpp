@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/expressions.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/transform.hpp>
+#include <cudf/types.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+struct ComputeColumnTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ComputeColumnTest, ArithmeticAndComparison)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> a{{1, 2, 3, 4, 5}, {1, 1, 0, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<int16_t> b{2, 3, 4, 5, 6};
+  cudf::test::fixed_width_column_wrapper<double> c{0.5, 1.5, 2.5, 3.5, 4.5};
+  cudf::test::fixed_width_column_wrapper<int64_t> d{{2, 8, 14, 20, 30}, {1, 1, 1, 1, 0}};
+  cudf::table_view table{{a, b, c, d}};
+
+  // (a * b + c) > d
+  cudf::column_reference col_a(0);
+  cudf::column_reference col_b(1);
+  cudf::column_reference col_c(2);
+  cudf::column_reference col_d(3);
+  cudf::binary_expression product(cudf::binary_operator::MUL, col_a, col_b);
+  cudf::binary_expression sum(cudf::binary_operator::ADD, product, col_c);
+  cudf::binary_expression greater(cudf::binary_operator::GREATER, sum, col_d);
+
+  auto const sums = cudf::compute_column(table, sum);
+  cudf::test::fixed_width_column_wrapper<double> expected_sums{{2.5, 7.5, 0, 23.5, 34.5},
+                                                               {1, 1, 0, 1, 1}};
+  cudf::test::expect_columns_equal(*sums, expected_sums);
+
+  auto const result = cudf::compute_column(table, greater);
+  cudf::test::fixed_width_column_wrapper<bool> expected{{true, false, false, true, false},
+                                                        {1, 1, 0, 1, 0}};
+  cudf::test::expect_columns_equal(*result, expected);
+}
+
+TEST_F(ComputeColumnTest, IntegralOperatorsAndLiterals)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> a{-7, -1, 0, 5, 12};
+  cudf::table_view table{{a}};
+
+  cudf::column_reference col_a(0);
+  cudf::numeric_scalar<int32_t> three(3);
+  cudf::literal lit_three(three);
+
+  cudf::binary_expression pymod(cudf::binary_operator::PYMOD, col_a, lit_three);
+  cudf::test::fixed_width_column_wrapper<int64_t> expected_pymod{2, 2, 0, 2, 0};
+  cudf::test::expect_columns_equal(*cudf::compute_column(table, pymod), expected_pymod);
+
+  cudf::binary_expression true_div(cudf::binary_operator::TRUE_DIV, col_a, lit_three);
+  cudf::unary_expression floored(cudf::unary_op::FLOOR, true_div);
+  cudf::cast_expression cast(cudf::data_type{cudf::type_id::INT8}, floored);
+  cudf::test::fixed_width_column_wrapper<int8_t> expected_floor{-3, -1, 0, 1, 4};
+  cudf::test::expect_columns_equal(*cudf::compute_column(table, cast), expected_floor);
+
+  cudf::unary_expression magnitude(cudf::unary_op::ABS, col_a);
+  cudf::binary_expression shift(cudf::binary_operator::SHIFT_LEFT, magnitude, lit_three);
+  cudf::test::fixed_width_column_wrapper<int64_t> expected_shift{56, 8, 0, 40, 96};
+  cudf::test::expect_columns_equal(*cudf::compute_column(table, shift), expected_shift);
+}
+
+TEST_F(ComputeColumnTest, NullLiteral)
+{
+  cudf::test::fixed_width_column_wrapper<float> a{1.f, 2.f, 3.f};
+  cudf::table_view table{{a}};
+
+  cudf::column_reference col_a(0);
+  cudf::numeric_scalar<float> null_value(0.f, false);
+  cudf::literal lit_null(null_value);
+  cudf::binary_expression sum(cudf::binary_operator::ADD, col_a, lit_null);
+
+  auto const result = cudf::compute_column(table, sum);
+  EXPECT_EQ(result->type(), cudf::data_type{cudf::type_id::FLOAT64});
+  EXPECT_EQ(result->null_count(), 3);
+}
+
+TEST_F(ComputeColumnTest, InvalidExpressions)
+{
+  cudf::test::fixed_width_column_wrapper<double> a{1.0, 2.0};
+  cudf::test::fixed_width_column_wrapper<cudf::timestamp_s> t{1, 2};
+  cudf::table_view table{{a, t}};
+
+  cudf::column_reference col_a(0);
+  cudf::column_reference col_t(1);
+  cudf::column_reference col_missing(2);
+
+  cudf::binary_expression timestamp_sum(cudf::binary_operator::ADD, col_a, col_t);
+  EXPECT_THROW(cudf::compute_column(table, timestamp_sum), cudf::logic_error);
+
+  cudf::binary_expression out_of_bounds(cudf::binary_operator::ADD, col_a, col_missing);
+  EXPECT_THROW(cudf::compute_column(table, out_of_bounds), cudf::logic_error);
+
+  cudf::binary_expression float_bitwise(cudf::binary_operator::BITWISE_AND, col_a, col_a);
+  EXPECT_THROW(cudf::compute_column(table, float_bitwise), cudf::logic_error);
+
+  cudf::binary_expression coalesce(cudf::binary_operator::COALESCE, col_a, col_a);
+  EXPECT_THROW(cudf::compute_column(table, coalesce), cudf::logic_error);
+}
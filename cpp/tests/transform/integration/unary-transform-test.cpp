@@ -17,6 +17,7 @@
  * limitations under the License.
  */
 
+#include <cudf/table/table_view.hpp>
 #include <cudf/transform.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 #include <tests/utilities/base_fixture.hpp>
@@ -221,6 +222,34 @@ __device__ inline void f(cudf::timestamp_us* output, cudf::timestamp_us input)
   test_udf<dtype>(cuda, op, data_init, 500, false);
 }
 
+TEST_F(UnaryOperationIntegrationTest, Transform_Multiple_Nullable)
+{
+  // c = a * b + a
+  const char cuda[] =
+    "__device__ inline void f(double* output, int a, double b){*output = a * b + a;}";
+
+  auto const size = 1000;
+  auto a_data     = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  auto b_data     = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i * 0.5; });
+
+  auto a_valid = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  auto b_valid = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 5 != 0; });
+
+  auto expected_data = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return (i % 7) * (i * 0.5) + (i % 7); });
+  auto expected_valid = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return i % 3 != 0 and i % 5 != 0; });
+
+  auto a = cudf::test::fixed_width_column_wrapper<int32_t>(a_data, a_data + size, a_valid);
+  auto b = cudf::test::fixed_width_column_wrapper<double>(b_data, b_data + size, b_valid);
+  auto expected = cudf::test::fixed_width_column_wrapper<double>(
+    expected_data, expected_data + size, expected_valid);
+
+  auto out = cudf::transform(table_view{{a, b}}, cuda, data_type(type_id::FLOAT64), false);
+
+  cudf::test::expect_columns_equal(out->view(), expected);
+}
+
 }  // namespace transformation
 }  // namespace test
 }  // namespace cudf
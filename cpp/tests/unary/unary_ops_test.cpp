@@ -15,8 +15,10 @@
  */
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/types.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/unary.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
@@ -25,6 +27,7 @@
 #include <tests/utilities/base_fixture.hpp>
 #include <tests/utilities/column_utilities.hpp>
 #include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
 #include <tests/utilities/type_lists.hpp>
 #include <vector>
 
@@ -585,6 +588,106 @@ void validate_cast_result(cudf::column_view expected, cudf::column_view actual)
   }
 }
 
+template <typename T>
+struct CastNumericSliced : public cudf::test::BaseFixture {
+};
+
+TYPED_TEST_CASE(CastNumericSliced, cudf::test::NumericTypes);
+
+TYPED_TEST(CastNumericSliced, WideningAndNarrowing)
+{
+  using T = TypeParam;
+
+  // 100 rows exercise the vectorized body and the scalar tail of the cast kernel, and the offsets
+  // exercise unaligned data as well as null masks copied in and out of the kernel
+  auto values   = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 100; });
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  cudf::test::fixed_width_column_wrapper<T> input(values, values + 164, validity);
+
+  for (cudf::size_type offset : {0, 3, 32, 64}) {
+    auto const sliced = cudf::slice(input, {offset, offset + 100}).front();
+    auto expected_values = cudf::test::make_counting_transform_iterator(
+      offset, [](auto i) { return static_cast<T>(i % 100); });
+    auto expected_validity =
+      cudf::test::make_counting_transform_iterator(offset, [](auto i) { return i % 7; });
+
+    cudf::test::fixed_width_column_wrapper<int64_t> expected_wide(
+      expected_values, expected_values + 100, expected_validity);
+    auto const wide = cudf::cast(sliced, make_data_type<int64_t>());
+    cudf::test::expect_columns_equal(expected_wide, *wide);
+
+    cudf::test::fixed_width_column_wrapper<int8_t> expected_narrow(
+      expected_values, expected_values + 100, expected_validity);
+    auto const narrow = cudf::cast(sliced, make_data_type<int8_t>());
+    cudf::test::expect_columns_equal(expected_narrow, *narrow);
+  }
+}
+
+struct TableUnaryTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(TableUnaryTest, IsNullAndIsValid)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints({1, 2, 3, 4, 5}, {1, 0, 1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<double> doubles({1, 2, 3, 4, 5});
+  cudf::test::strings_column_wrapper strings({"a", "", "c", "d", ""}, {1, 0, 1, 1, 0});
+  auto const sliced = cudf::slice(ints, {1, 5}).front();
+  cudf::table_view input{{ints, doubles, strings}};
+
+  cudf::test::fixed_width_column_wrapper<bool> ints_null({0, 1, 0, 1, 0});
+  cudf::test::fixed_width_column_wrapper<bool> doubles_null({0, 0, 0, 0, 0});
+  cudf::test::fixed_width_column_wrapper<bool> strings_null({0, 1, 0, 0, 1});
+  cudf::test::expect_tables_equal(cudf::table_view{{ints_null, doubles_null, strings_null}},
+                                  *cudf::is_null(input));
+
+  cudf::test::fixed_width_column_wrapper<bool> ints_valid({1, 0, 1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<bool> doubles_valid({1, 1, 1, 1, 1});
+  cudf::test::fixed_width_column_wrapper<bool> strings_valid({1, 0, 1, 1, 0});
+  cudf::test::expect_tables_equal(cudf::table_view{{ints_valid, doubles_valid, strings_valid}},
+                                  *cudf::is_valid(input));
+
+  cudf::test::fixed_width_column_wrapper<bool> sliced_null({1, 0, 1, 0});
+  cudf::test::expect_tables_equal(cudf::table_view{{sliced_null}},
+                                  *cudf::is_null(cudf::table_view{{sliced}}));
+
+  auto const empty = cudf::is_null(cudf::table_view{{cudf::slice(ints, {0, 0}).front()}});
+  EXPECT_EQ(empty->num_columns(), 1);
+  EXPECT_EQ(empty->num_rows(), 0);
+}
+
+TEST_F(TableUnaryTest, Cast)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints({1, 2, 3}, {1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<double> doubles({1.5, 2.5, 3.5});
+  cudf::table_view input{{ints, doubles}};
+
+  cudf::test::fixed_width_column_wrapper<double> expected_doubles({1, 2, 3}, {1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<int64_t> expected_ints({1, 2, 3});
+  auto const result = cudf::cast(input, {make_data_type<double>(), make_data_type<int64_t>()});
+  cudf::test::expect_tables_equal(cudf::table_view{{expected_doubles, expected_ints}}, *result);
+
+  EXPECT_THROW(cudf::cast(input, {make_data_type<double>()}), cudf::logic_error);
+}
+
+struct BitCastTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(BitCastTest, TimestampsAndRep)
+{
+  auto timestamps_s = make_column<cudf::timestamp_s>(test_timestamps_s);
+  cudf::column_view const input = timestamps_s;
+
+  auto const reps = cudf::bit_cast(input, make_data_type<cudf::timestamp_s::rep>());
+  EXPECT_EQ(reps.head(), input.head());
+  cudf::test::expect_columns_equal(*cudf::cast(input, make_data_type<cudf::timestamp_s::rep>()),
+                                   reps);
+
+  auto const back = cudf::bit_cast(reps, cudf::data_type{cudf::type_id::TIMESTAMP_SECONDS});
+  cudf::test::expect_columns_equal(input, back);
+
+  EXPECT_THROW(cudf::bit_cast(input, make_data_type<int32_t>()), cudf::logic_error);
+}
+
 struct CastTimestampsSimple : public cudf::test::BaseFixture {
 };
 
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/utilities/prefetch.hpp>
+#include <cudf/sorting.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <rmm/mr/device/managed_memory_resource.hpp>
+
+#include <vector>
+
+struct PrefetchTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(PrefetchTest, ManagedColumn)
+{
+  rmm::mr::managed_memory_resource managed;
+  cudf::test::fixed_width_column_wrapper<int32_t> values({5, 3, 4, 1, 2}, {1, 0, 1, 1, 1});
+  // Copied into managed memory, as a managed memory resource allocates every column
+  auto column = std::make_unique<cudf::column>(values, 0, &managed);
+  CUDA_TRY(cudaDeviceSynchronize());
+
+  EXPECT_NO_THROW(cudf::detail::prefetch(column->view()));
+  auto const sliced = cudf::slice(column->view(), {1, 4});
+  EXPECT_NO_THROW(cudf::detail::prefetch(sliced.front()));
+
+  auto const order = cudf::sorted_order(cudf::table_view{{column->view()}});
+  cudf::test::fixed_width_column_wrapper<int32_t> expected{1, 3, 4, 2, 0};
+  cudf::test::expect_columns_equal(order->view(), expected);
+}
+
+TEST_F(PrefetchTest, UnmanagedMemory)
+{
+  cudf::test::strings_column_wrapper strings({"a", "", "bc"}, {1, 0, 1});
+  EXPECT_NO_THROW(cudf::detail::prefetch(cudf::table_view{{strings}}));
+
+  std::vector<int32_t> host(16);
+  EXPECT_NO_THROW(cudf::detail::prefetch(host.data(), host.size() * sizeof(int32_t)));
+  EXPECT_NO_THROW(cudf::detail::prefetch(nullptr, 16));
+  EXPECT_EQ(cudaGetLastError(), cudaSuccess);
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/sorting.hpp>
+#include <cudf/utilities/profiling.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <string>
+#include <vector>
+
+namespace {
+struct recording_callbacks : public cudf::profiling_callbacks {
+  std::vector<std::string> begun;
+  std::vector<std::string> ended;
+
+  void on_begin(char const* name) override { begun.emplace_back(name); }
+
+  void on_end(char const* name, std::chrono::nanoseconds elapsed) override
+  {
+    EXPECT_GE(elapsed.count(), 0);
+    ended.emplace_back(name);
+  }
+};
+
+}  // namespace
+
+struct ProfilingTest : public cudf::test::BaseFixture {
+  void TearDown() override { cudf::set_profiling_callbacks(nullptr); }
+};
+
+TEST_F(ProfilingTest, NotifiesPublicApis)
+{
+  EXPECT_EQ(cudf::get_profiling_callbacks(), nullptr);
+  recording_callbacks callbacks;
+  EXPECT_EQ(cudf::set_profiling_callbacks(&callbacks), nullptr);
+  EXPECT_EQ(cudf::get_profiling_callbacks(), &callbacks);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> col{3, 1, 2};
+  cudf::sorted_order(cudf::table_view{{col}});
+
+  EXPECT_EQ(callbacks.begun, std::vector<std::string>{"sorted_order"});
+  EXPECT_EQ(callbacks.ended, std::vector<std::string>{"sorted_order"});
+}
+
+TEST_F(ProfilingTest, StopsNotifying)
+{
+  recording_callbacks callbacks;
+  cudf::set_profiling_callbacks(&callbacks);
+  EXPECT_EQ(cudf::set_profiling_callbacks(nullptr), &callbacks);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> col{3, 1, 2};
+  cudf::sorted_order(cudf::table_view{{col}});
+
+  EXPECT_TRUE(callbacks.begun.empty());
+  EXPECT_TRUE(callbacks.ended.empty());
+}
+
+TEST_F(ProfilingTest, MetricsRegistry)
+{
+  cudf::metrics_registry registry;
+  cudf::set_profiling_callbacks(&registry);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> col{3, 1, 2};
+  cudf::sorted_order(cudf::table_view{{col}});
+  cudf::sorted_order(cudf::table_view{{col}});
+  registry.on_counter("sorted_order", "rows", 3);
+  registry.on_counter("sorted_order", "rows", 3);
+
+  auto const metrics = registry.metrics();
+  ASSERT_EQ(metrics.size(), 1u);
+  EXPECT_EQ(metrics.at("sorted_order").calls, 2);
+  EXPECT_EQ(metrics.at("sorted_order").counters.at("rows"), 6);
+
+  registry.reset();
+  EXPECT_TRUE(registry.metrics().empty());
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/groupby.hpp>
+#include <cudf/join.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/utilities/scratch_arena.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/default_memory_resource.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+struct ScratchArenaTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ScratchArenaTest, AllocatesFromBlocks)
+{
+  cudf::scratch_arena arena{0, rmm::mr::get_default_resource(), 4096};
+  auto const first  = arena.allocate(100);
+  auto const second = arena.allocate(100);
+  EXPECT_EQ(arena.capacity(), 4096u);
+  EXPECT_EQ(static_cast<char*>(second) - static_cast<char*>(first), 256);
+
+  // Larger than a block: a block of its own
+  arena.allocate(10000);
+  EXPECT_EQ(arena.capacity(), 4096u + 10240u);
+  // The first block still has space
+  auto const third = arena.allocate(256);
+  EXPECT_EQ(static_cast<char*>(third) - static_cast<char*>(first), 512);
+
+  arena.deallocate(second, 100);
+  arena.reset();
+  EXPECT_EQ(arena.allocate(100), first);
+  EXPECT_EQ(arena.capacity(), 4096u + 10240u);
+}
+
+TEST_F(ScratchArenaTest, InvalidArguments)
+{
+  EXPECT_THROW(cudf::scratch_arena(0, nullptr), cudf::logic_error);
+  EXPECT_THROW(cudf::scratch_arena(0, rmm::mr::get_default_resource(), 0), cudf::logic_error);
+  EXPECT_THROW(cudf::scratch_resource_scope{nullptr}, cudf::logic_error);
+}
+
+TEST_F(ScratchArenaTest, ScopesNest)
+{
+  cudf::scratch_arena outer;
+  cudf::scratch_arena inner;
+  EXPECT_EQ(cudf::detail::scratch_resource(), rmm::mr::get_default_resource());
+  {
+    cudf::scratch_resource_scope outer_scope{&outer};
+    EXPECT_EQ(cudf::detail::scratch_resource(), &outer);
+    {
+      cudf::scratch_resource_scope inner_scope{&inner};
+      EXPECT_EQ(cudf::detail::scratch_resource(), &inner);
+    }
+    EXPECT_EQ(cudf::detail::scratch_resource(), &outer);
+  }
+  EXPECT_EQ(cudf::detail::scratch_resource(), rmm::mr::get_default_resource());
+}
+
+TEST_F(ScratchArenaTest, OperationTemporaries)
+{
+  using namespace cudf::test;
+  fixed_width_column_wrapper<int32_t> keys({3, 1, 2, 1, 3});
+  fixed_width_column_wrapper<int32_t> values({10, 20, 30, 40, 50});
+  fixed_width_column_wrapper<int64_t> other({5, 4, 3, 2, 1});
+
+  std::unique_ptr<cudf::column> sorted;
+  std::unique_ptr<cudf::table> joined;
+  std::pair<std::unique_ptr<cudf::table>, std::vector<cudf::groupby::aggregation_result>> sums;
+  {
+    cudf::scratch_arena arena;
+    cudf::scratch_resource_scope scope{&arena};
+    sorted = cudf::sorted_order(cudf::table_view{{keys, other}});
+    EXPECT_GT(arena.capacity(), 0u);
+
+    joined = cudf::inner_join(
+      cudf::table_view{{keys}}, cudf::table_view{{keys}}, {0}, {0}, {{0, 0}});
+
+    cudf::groupby::groupby grouper(cudf::table_view{{keys}});
+    std::vector<cudf::groupby::aggregation_request> requests(1);
+    requests[0].values = values;
+    requests[0].aggregations.push_back(cudf::make_sum_aggregation());
+    sums = grouper.aggregate(requests);
+  }
+
+  // The outputs outlive the arena
+  expect_columns_equal(fixed_width_column_wrapper<cudf::size_type>({3, 1, 2, 4, 0}), *sorted);
+  EXPECT_EQ(joined->num_rows(), 9);
+
+  auto const sorted_sums = cudf::sort_by_key(
+    cudf::table_view{{sums.second[0].results[0]->view()}}, sums.first->view());
+  expect_columns_equal(fixed_width_column_wrapper<int64_t>({60, 30, 60}),
+                       sorted_sums->get_column(0));
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/utilities/spill_resource_adaptor.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/default_memory_resource.hpp>
+
+#include <new>
+
+namespace {
+// Fails a number of allocations before allocating from the default resource
+class failing_resource final : public rmm::mr::device_memory_resource {
+ public:
+  explicit failing_resource(int failures) : failures_{failures} {}
+
+  bool supports_streams() const noexcept override { return false; }
+  bool supports_get_mem_info() const noexcept override { return false; }
+
+ private:
+  void* do_allocate(std::size_t bytes, cudaStream_t stream) override
+  {
+    if (failures_ > 0) {
+      --failures_;
+      throw std::bad_alloc{};
+    }
+    return rmm::mr::get_default_resource()->allocate(bytes, stream);
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, cudaStream_t stream) override
+  {
+    rmm::mr::get_default_resource()->deallocate(p, bytes, stream);
+  }
+
+  std::pair<std::size_t, std::size_t> do_get_mem_info(cudaStream_t) const override
+  {
+    return {0, 0};
+  }
+
+  int failures_;
+};
+}  // namespace
+
+struct SpillResourceAdaptorTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(SpillResourceAdaptorTest, RetriesAfterSpill)
+{
+  failing_resource upstream{2};
+  int calls = 0;
+  cudf::spill_resource_adaptor<failing_resource> mr{&upstream, [&calls](std::size_t bytes) {
+                                                      EXPECT_EQ(bytes, 256u);
+                                                      ++calls;
+                                                      return true;
+                                                    }};
+  rmm::device_buffer buffer(256, 0, &mr);
+  EXPECT_EQ(calls, 2);
+  EXPECT_EQ(buffer.size(), 256u);
+}
+
+TEST_F(SpillResourceAdaptorTest, FailsWhenNothingSpilled)
+{
+  failing_resource upstream{3};
+  int calls = 0;
+  cudf::spill_resource_adaptor<failing_resource> mr{&upstream, [&calls](std::size_t) {
+                                                      return ++calls < 2;
+                                                    }};
+  EXPECT_THROW(rmm::device_buffer(256, 0, &mr), std::bad_alloc);
+  EXPECT_EQ(calls, 2);
+}
+
+TEST_F(SpillResourceAdaptorTest, ErrorTest)
+{
+  failing_resource upstream{0};
+  EXPECT_THROW(cudf::spill_resource_adaptor<failing_resource>(nullptr, [](std::size_t) {
+                 return false;
+               }),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::spill_resource_adaptor<failing_resource>(&upstream, cudf::spill_handler{}),
+               cudf::logic_error);
+}
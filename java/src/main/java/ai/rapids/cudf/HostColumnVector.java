@@ -205,6 +205,37 @@ public final class HostColumnVector implements AutoCloseable {
   // DATA MOVEMENT
   /////////////////////////////////////////////////////////////////////////////
 
+  /**
+   * Get the lengths in bytes of the buffers this column needs on the device.
+   * @return the lengths of the data, validity and offset buffers, in that order. A length is 0
+   * if the column has no such buffer.
+   */
+  long[] getDeviceBufferLengths() {
+    long[] lengths = new long[3];
+    if (rows == 0) {
+      return lengths;
+    }
+    if (offHeap.data != null) {
+      lengths[0] = rows * type.sizeInBytes;
+      if (type == DType.STRING) {
+        // This needs a different type
+        lengths[0] = getEndStringOffset(rows - 1);
+        if (lengths[0] == 0 && getNullCount() == 0) {
+          // This is a work around to an issue where a column of all empty strings must have at
+          // least one byte or it will not be interpreted correctly.
+          lengths[0] = 1;
+        }
+      }
+    }
+    if (offHeap.valid != null) {
+      lengths[1] = ColumnVector.getNativeValidPointerSize((int)rows);
+    }
+    if (offHeap.offsets != null) {
+      lengths[2] = OFFSET_SIZE * (rows + 1);
+    }
+    return lengths;
+  }
+
   /**
    * Copy the data to the device.
    */
@@ -217,33 +248,18 @@ public final class HostColumnVector implements AutoCloseable {
     DeviceMemoryBuffer valid = null;
     DeviceMemoryBuffer offsets = null;
     try {
-      HostMemoryBuffer hdata = this.offHeap.data;
-      if (hdata != null) {
-        long dataLen = rows * type.sizeInBytes;
-        if (type == DType.STRING) {
-          // This needs a different type
-          dataLen = getEndStringOffset(rows - 1);
-          if (dataLen == 0 && getNullCount() == 0) {
-            // This is a work around to an issue where a column of all empty strings must have at
-            // least one byte or it will not be interpreted correctly.
-            dataLen = 1;
-          }
-        }
-        data = DeviceMemoryBuffer.allocate(dataLen);
-        data.copyFromHostBuffer(hdata, 0, dataLen);
+      long[] lengths = getDeviceBufferLengths();
+      if (lengths[0] > 0) {
+        data = DeviceMemoryBuffer.allocate(lengths[0]);
+        data.copyFromHostBuffer(offHeap.data, 0, lengths[0]);
       }
-      HostMemoryBuffer hvalid = this.offHeap.valid;
-      if (hvalid != null) {
-        long validLen = ColumnVector.getNativeValidPointerSize((int)rows);
-        valid = DeviceMemoryBuffer.allocate(validLen);
-        valid.copyFromHostBuffer(hvalid, 0 , validLen);
+      if (lengths[1] > 0) {
+        valid = DeviceMemoryBuffer.allocate(lengths[1]);
+        valid.copyFromHostBuffer(offHeap.valid, 0 , lengths[1]);
       }
-
-      HostMemoryBuffer hoff = this.offHeap.offsets;
-      if (hoff != null) {
-        long offsetsLen = OFFSET_SIZE * (rows + 1);
-        offsets = DeviceMemoryBuffer.allocate(offsetsLen);
-        offsets.copyFromHostBuffer(hoff, 0 , offsetsLen);
+      if (lengths[2] > 0) {
+        offsets = DeviceMemoryBuffer.allocate(lengths[2]);
+        offsets.copyFromHostBuffer(offHeap.offsets, 0 , lengths[2]);
       }
 
       ColumnVector ret = new ColumnVector(type, rows, nullCount, data, valid, offsets);
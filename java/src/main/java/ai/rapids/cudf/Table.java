@@ -24,6 +24,7 @@ import java.util.Arrays;
 import java.util.Collection;
 import java.util.List;
 import java.util.Map;
+import java.util.Optional;
 import java.util.Set;
 import java.util.TreeMap;
 
@@ -107,6 +108,13 @@ public final class Table implements AutoCloseable {
     return columns;
   }
 
+  /**
+   * The native table_view of the columns. Only to be used internally.
+   */
+  long getNativeView() {
+    return nativeHandle;
+  }
+
   /**
    * Return the {@link ColumnVector} at the specified index. If you want to keep a reference to
    * the column around past the life time of the table, you will need to increment the reference
@@ -1185,6 +1193,126 @@ public final class Table implements AutoCloseable {
     return contiguousSplit(nativeHandle, indices);
   }
 
+  /**
+   * Copy all the columns of this table to the host with a single transfer. The columns are packed
+   * into one device buffer with {@link #contiguousSplit(int...)}, which is copied into one host
+   * buffer, pinned if the {@link PinnedMemoryPool} can hold it. Each returned column is a slice of
+   * that host buffer.
+   * @return the columns on the host. NOTE: It is the responsibility of the caller to close them.
+   */
+  public HostColumnVector[] copyToHost() {
+    HostColumnVector[] result = new HostColumnVector[columns.length];
+    boolean success = false;
+    ContiguousTable[] packed = contiguousSplit();
+    try (NvtxRange toHost = new NvtxRange("copyToHost", NvtxColor.BLUE)) {
+      DeviceMemoryBuffer deviceBuffer = packed[0].getBuffer();
+      long length = deviceBuffer == null ? 0 : deviceBuffer.getLength();
+      try (HostMemoryBuffer hostBuffer = HostMemoryBuffer.allocate(length, true)) {
+        if (length > 0) {
+          hostBuffer.copyFromDeviceBuffer(deviceBuffer);
+        }
+        Table packedTable = packed[0].getTable();
+        for (int i = 0; i < result.length; i++) {
+          ColumnVector column = packedTable.getColumn(i);
+          result[i] = new HostColumnVector(column.getType(), column.getRowCount(),
+              Optional.of(column.getNullCount()),
+              sliceOfPacked(hostBuffer, deviceBuffer, column.getDeviceBufferFor(BufferType.DATA)),
+              sliceOfPacked(hostBuffer, deviceBuffer,
+                  column.getDeviceBufferFor(BufferType.VALIDITY)),
+              sliceOfPacked(hostBuffer, deviceBuffer,
+                  column.getDeviceBufferFor(BufferType.OFFSET)));
+        }
+      }
+      success = true;
+      return result;
+    } finally {
+      for (ContiguousTable table : packed) {
+        table.close();
+      }
+      if (!success) {
+        for (HostColumnVector column : result) {
+          if (column != null) {
+            column.close();
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * Slice the part of a host copy of a packed device buffer that holds the device buffer
+   * `part`, or return null if there is no such part.
+   */
+  private static HostMemoryBuffer sliceOfPacked(HostMemoryBuffer hostBuffer,
+      DeviceMemoryBuffer deviceBuffer, BaseDeviceMemoryBuffer part) {
+    if (part == null) {
+      return null;
+    }
+    return hostBuffer.slice(part.getAddress() - deviceBuffer.getAddress(), part.getLength());
+  }
+
+  /**
+   * Copy host columns to the device as a table with a single transfer. The buffers of all the
+   * columns are packed into one host buffer, pinned if the {@link PinnedMemoryPool} can hold it,
+   * which is copied into one device buffer. Each column of the table is a slice of that device
+   * buffer.
+   * @param columns the columns to copy, which must all have the same number of rows.
+   * @return the table on the device. NOTE: It is the responsibility of the caller to close it.
+   */
+  public static Table copyFromHost(HostColumnVector... columns) {
+    assert columns != null && columns.length > 0 : "HostColumnVectors can't be null or empty";
+    // each buffer is aligned as the buffers packed by contiguousSplit
+    final long alignment = 64;
+    long[][] lengths = new long[columns.length][];
+    long totalLength = 0;
+    for (int i = 0; i < columns.length; i++) {
+      lengths[i] = columns[i].getDeviceBufferLengths();
+      for (long length : lengths[i]) {
+        totalLength += (length + alignment - 1) / alignment * alignment;
+      }
+    }
+
+    ColumnVector[] vectors = new ColumnVector[columns.length];
+    try (NvtxRange toDevice = new NvtxRange("copyFromHost", NvtxColor.BLUE);
+         HostMemoryBuffer hostBuffer = HostMemoryBuffer.allocate(totalLength, true);
+         DeviceMemoryBuffer deviceBuffer = DeviceMemoryBuffer.allocate(totalLength)) {
+      long offset = 0;
+      for (int i = 0; i < columns.length; i++) {
+        BufferType[] types = {BufferType.DATA, BufferType.VALIDITY, BufferType.OFFSET};
+        for (int j = 0; j < types.length; j++) {
+          if (lengths[i][j] > 0) {
+            hostBuffer.copyFromHostBuffer(offset, columns[i].getHostBufferFor(types[j]), 0,
+                lengths[i][j]);
+            offset += (lengths[i][j] + alignment - 1) / alignment * alignment;
+          }
+        }
+      }
+      if (totalLength > 0) {
+        deviceBuffer.copyFromHostBuffer(hostBuffer);
+      }
+
+      offset = 0;
+      for (int i = 0; i < columns.length; i++) {
+        DeviceMemoryBuffer[] parts = new DeviceMemoryBuffer[3];
+        for (int j = 0; j < parts.length; j++) {
+          if (lengths[i][j] > 0) {
+            parts[j] = deviceBuffer.slice(offset, lengths[i][j]);
+            offset += (lengths[i][j] + alignment - 1) / alignment * alignment;
+          }
+        }
+        vectors[i] = new ColumnVector(columns[i].getType(), columns[i].getRowCount(),
+            Optional.of(columns[i].getNullCount()), parts[0], parts[1], parts[2]);
+      }
+      return new Table(vectors);
+    } finally {
+      for (ColumnVector vector : vectors) {
+        if (vector != null) {
+          vector.close();
+        }
+      }
+    }
+  }
+
   /////////////////////////////////////////////////////////////////////////////
   // HELPER CLASSES
   /////////////////////////////////////////////////////////////////////////////
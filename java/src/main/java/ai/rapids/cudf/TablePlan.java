@@ -0,0 +1,242 @@
+/*
+ *
+ *  Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+package ai.rapids.cudf;
+
+import java.util.ArrayList;
+import java.util.List;
+
+/**
+ * A small graph of table operations run natively by a single call.
+ *
+ * Each operation adds a node, identified by the int it returns, whose table is computed from
+ * the tables of earlier nodes. {@link #execute(int...)} runs all the operations in one JNI call:
+ * no intermediate table is returned to Java, projections only select columns of their source
+ * without copying them, and each intermediate table is freed as soon as no later operation
+ * reads it.
+ *
+ * <pre>
+ *   TablePlan plan = new TablePlan();
+ *   int orders = plan.input(ordersTable);
+ *   int filtered = plan.filter(orders, 3);
+ *   int joined = plan.innerJoin(filtered, new int[]{0}, plan.input(customers), new int[]{0});
+ *   int summed = plan.groupBy(joined, new int[]{5}, Table.sum(1));
+ *   Table[] results = plan.execute(summed);
+ * </pre>
+ *
+ * The input tables are not copied, they must stay open until the plan is executed.
+ */
+public final class TablePlan {
+  static {
+    NativeDepsLoader.loadNativeDeps();
+  }
+
+  // These numbers must stay in sync with TablePlanJni.cpp
+  private static final int PROJECT = 0;
+  private static final int FILTER = 1;
+  private static final int INNER_JOIN = 2;
+  private static final int GROUP_BY = 3;
+
+  private final List<Table> inputs = new ArrayList<>();
+  private final List<Integer> program = new ArrayList<>();
+  // The number of columns of the table of each operation, after the inputs
+  private final List<Integer> operationColumns = new ArrayList<>();
+
+  /**
+   * Add an input table to the plan.
+   * @return the node of the table. Input nodes are numbered before all the operations, so the
+   * inputs are best added first.
+   */
+  public int input(Table table) {
+    if (!operationColumns.isEmpty()) {
+      throw new IllegalStateException("Inputs must be added before the operations");
+    }
+    inputs.add(table);
+    return inputs.size() - 1;
+  }
+
+  /**
+   * Select some columns of a node's table, without copying them.
+   * @param node the source node
+   * @param columns the indices of the columns to keep, in order
+   */
+  public int project(int node, int... columns) {
+    checkColumns(node, columns);
+    if (columns.length == 0) {
+      throw new IllegalArgumentException("A projection keeps at least one column");
+    }
+    program.add(PROJECT);
+    program.add(node);
+    addArray(columns);
+    return addOperation(columns.length);
+  }
+
+  /**
+   * Keep the rows of a node's table whose value in a BOOL8 column is true. All the columns are
+   * kept, the mask included.
+   * @param node the source node
+   * @param maskColumn the index of the mask column
+   */
+  public int filter(int node, int maskColumn) {
+    checkColumns(node, maskColumn);
+    program.add(FILTER);
+    program.add(node);
+    program.add(maskColumn);
+    return addOperation(numColumns(node));
+  }
+
+  /**
+   * Inner join of the tables of two nodes, null keys matching each other as in
+   * {@link Table.TableOperation#innerJoin(Table.TableOperation)}. Unlike it, the key columns are
+   * not moved first: the result has all the columns of the left table followed by all those of
+   * the right table.
+   */
+  public int innerJoin(int left, int[] leftKeys, int right, int[] rightKeys) {
+    return innerJoin(left, leftKeys, right, rightKeys, true);
+  }
+
+  /**
+   * Inner join of the tables of two nodes. The result has the columns of the left table followed
+   * by those of the right table.
+   * @param compareNullsEqual whether null keys match each other
+   */
+  public int innerJoin(int left, int[] leftKeys, int right, int[] rightKeys,
+                       boolean compareNullsEqual) {
+    checkColumns(left, leftKeys);
+    checkColumns(right, rightKeys);
+    if (leftKeys.length != rightKeys.length || leftKeys.length == 0) {
+      throw new IllegalArgumentException("The same number of left and right keys is required");
+    }
+    program.add(INNER_JOIN);
+    program.add(left);
+    program.add(right);
+    program.add(compareNullsEqual ? 1 : 0);
+    addArray(leftKeys);
+    addArray(rightKeys);
+    return addOperation(numColumns(left) + numColumns(right));
+  }
+
+  /**
+   * Group the rows of a node's table by some keys and aggregate the groups, null keys being
+   * ignored. The result has the key columns followed by the aggregates, in order.
+   */
+  public int groupBy(int node, int[] keys, Aggregate... aggregates) {
+    return groupBy(node, keys, true, aggregates);
+  }
+
+  /**
+   * Group the rows of a node's table by some keys and aggregate the groups. The result has the
+   * key columns followed by the aggregates, in order.
+   * @param ignoreNullKeys whether the rows with a null key are dropped
+   */
+  public int groupBy(int node, int[] keys, boolean ignoreNullKeys, Aggregate... aggregates) {
+    checkColumns(node, keys);
+    int[] aggColumns = new int[aggregates.length];
+    int[] aggOps = new int[aggregates.length];
+    for (int i = 0; i < aggregates.length; i++) {
+      aggColumns[i] = aggregates[i].getIndex();
+      aggOps[i] = aggregates[i].getNativeId();
+    }
+    checkColumns(node, aggColumns);
+    program.add(GROUP_BY);
+    program.add(node);
+    program.add(ignoreNullKeys ? 1 : 0);
+    addArray(keys);
+    addArray(aggColumns);
+    addArray(aggOps);
+    return addOperation(keys.length + aggregates.length);
+  }
+
+  /**
+   * Run the plan.
+   * @param outputs the nodes whose tables are returned
+   * @return the tables of the outputs, in order. The caller owns them.
+   */
+  public Table[] execute(int... outputs) {
+    long[] inputHandles = new long[inputs.size()];
+    for (int i = 0; i < inputHandles.length; i++) {
+      inputHandles[i] = inputs.get(i).getNativeView();
+    }
+    int[] encoded = new int[program.size()];
+    for (int i = 0; i < encoded.length; i++) {
+      encoded[i] = program.get(i);
+    }
+    for (int output : outputs) {
+      checkNode(output);
+    }
+
+    long[] columns = execute(inputHandles, encoded, outputs);
+    Table[] result = new Table[outputs.length];
+    int position = 0;
+    try {
+      for (int i = 0; i < outputs.length; i++) {
+        long[] tableColumns = new long[numColumns(outputs[i])];
+        System.arraycopy(columns, position, tableColumns, 0, tableColumns.length);
+        position += tableColumns.length;
+        result[i] = new Table(tableColumns);
+      }
+    } catch (Throwable t) {
+      for (Table table : result) {
+        if (table != null) {
+          table.close();
+        }
+      }
+      for (int i = position; i < columns.length; i++) {
+        ColumnVector.deleteCudfColumn(columns[i]);
+      }
+      throw t;
+    }
+    return result;
+  }
+
+  private int addOperation(int numColumns) {
+    operationColumns.add(numColumns);
+    return inputs.size() + operationColumns.size() - 1;
+  }
+
+  private void addArray(int[] values) {
+    program.add(values.length);
+    for (int value : values) {
+      program.add(value);
+    }
+  }
+
+  private void checkNode(int node) {
+    if (node < 0 || node >= inputs.size() + operationColumns.size()) {
+      throw new IllegalArgumentException("Unknown node " + node);
+    }
+  }
+
+  private int numColumns(int node) {
+    checkNode(node);
+    return node < inputs.size() ? inputs.get(node).getNumberOfColumns() :
+        operationColumns.get(node - inputs.size());
+  }
+
+  private void checkColumns(int node, int... columns) {
+    int numColumns = numColumns(node);
+    for (int column : columns) {
+      if (column < 0 || column >= numColumns) {
+        throw new IllegalArgumentException("Node " + node + " has no column " + column);
+      }
+    }
+  }
+
+  private static native long[] execute(long[] inputs, int[] program, int[] outputs)
+      throws CudfException;
+}
@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/join.hpp>
+#include <cudf/stream_compaction.hpp>
+
+#include "jni_utils.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace jni {
+
+namespace {
+
+// These numbers come from TablePlan.java and must stay in sync
+enum plan_op : jint { PROJECT = 0, FILTER = 1, INNER_JOIN = 2, GROUP_BY = 3 };
+
+/**
+ * A table produced by a node of the plan. Projections view the table of their source, so the
+ * memory is shared and released with its last user.
+ */
+struct plan_node {
+  cudf::table_view view;
+  std::shared_ptr<cudf::table> owner; // null for the inputs of the plan
+  bool projected = false;             // whether `view` selects some columns of `owner`
+};
+
+/**
+ * Reads the encoded program of a plan one operation at a time.
+ */
+class program_reader {
+public:
+  program_reader(native_jintArray const &program) : program(program) {}
+
+  bool done() const { return position == program.size(); }
+
+  jint next() {
+    CUDF_EXPECTS(position < program.size(), "truncated plan");
+    return program[position++];
+  }
+
+  std::vector<cudf::size_type> next_array() {
+    auto const size = next();
+    CUDF_EXPECTS(size >= 0 && position + size <= program.size(), "truncated plan");
+    std::vector<cudf::size_type> result(program.data() + position,
+                                        program.data() + position + size);
+    position += size;
+    return result;
+  }
+
+private:
+  native_jintArray const &program;
+  int position = 0;
+};
+
+/**
+ * Decoded operation of a plan.
+ */
+struct plan_step {
+  jint op;
+  std::vector<int> sources;
+  std::vector<cudf::size_type> columns;       // PROJECT, FILTER mask, GROUP_BY keys
+  std::vector<cudf::size_type> right_columns; // INNER_JOIN right keys
+  std::vector<jint> agg_ops;                  // GROUP_BY aggregations, on `right_columns`
+  bool flag = false;                          // INNER_JOIN nulls equal, GROUP_BY ignore null keys
+};
+
+std::vector<plan_step> decode(native_jintArray const &program, int num_inputs) {
+  std::vector<plan_step> steps;
+  program_reader reader(program);
+  auto source = [&](program_reader &r) {
+    auto const node = r.next();
+    CUDF_EXPECTS(node >= 0 && node < num_inputs + static_cast<int>(steps.size()),
+                 "plan refers to a node that is not computed yet");
+    return node;
+  };
+  while (!reader.done()) {
+    plan_step step;
+    step.op = reader.next();
+    switch (step.op) {
+      case PROJECT:
+        step.sources.push_back(source(reader));
+        step.columns = reader.next_array();
+        break;
+      case FILTER:
+        step.sources.push_back(source(reader));
+        step.columns.push_back(reader.next());
+        break;
+      case INNER_JOIN:
+        step.sources.push_back(source(reader));
+        step.sources.push_back(source(reader));
+        step.flag = reader.next() != 0;
+        step.columns = reader.next_array();
+        step.right_columns = reader.next_array();
+        CUDF_EXPECTS(step.columns.size() == step.right_columns.size(),
+                     "join keys of different lengths");
+        break;
+      case GROUP_BY:
+        step.sources.push_back(source(reader));
+        step.flag = reader.next() != 0;
+        step.columns = reader.next_array();
+        step.right_columns = reader.next_array();
+        {
+          auto const ops = reader.next_array();
+          CUDF_EXPECTS(ops.size() == step.right_columns.size(), "aggregations mismatch");
+          step.agg_ops.assign(ops.begin(), ops.end());
+        }
+        break;
+      default: CUDF_FAIL("unknown plan operation");
+    }
+    steps.push_back(std::move(step));
+  }
+  return steps;
+}
+
+std::unique_ptr<cudf::table> group_by(cudf::table_view const &input, plan_step const &step) {
+  cudf::groupby::groupby grouper(input.select(step.columns),
+                                 step.flag ? cudf::null_policy::EXCLUDE :
+                                             cudf::null_policy::INCLUDE);
+  // Consecutive aggregations of the same column share a request, which keeps the results in
+  // the order of the aggregations
+  std::vector<cudf::groupby::aggregation_request> requests;
+  for (std::size_t i = 0; i < step.agg_ops.size(); i++) {
+    if (i == 0 || step.right_columns[i] != step.right_columns[i - 1]) {
+      requests.emplace_back();
+      requests.back().values = input.column(step.right_columns[i]);
+    }
+    requests.back().aggregations.push_back(map_jni_aggregation(step.agg_ops[i]));
+  }
+  auto result = grouper.aggregate(requests);
+  auto columns = result.first->release();
+  for (auto &agg_result : result.second) {
+    for (auto &column : agg_result.results) {
+      columns.push_back(std::move(column));
+    }
+  }
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
+plan_node run(plan_step const &step, std::vector<plan_node> const &nodes) {
+  auto const &input = nodes[step.sources[0]];
+  switch (step.op) {
+    case PROJECT: return plan_node{input.view.select(step.columns), input.owner, true};
+    case FILTER: {
+      auto result = cudf::apply_boolean_mask(input.view, input.view.column(step.columns[0]));
+      auto const view = result->view();
+      return plan_node{view, std::move(result)};
+    }
+    case INNER_JOIN: {
+      std::vector<std::pair<cudf::size_type, cudf::size_type>> columns_in_common;
+      auto result = cudf::inner_join(input.view, nodes[step.sources[1]].view, step.columns,
+                                     step.right_columns, columns_in_common,
+                                     step.flag ? cudf::null_equality::EQUAL :
+                                                 cudf::null_equality::UNEQUAL);
+      auto const view = result->view();
+      return plan_node{view, std::move(result)};
+    }
+    default: {
+      auto result = group_by(input.view, step);
+      auto const view = result->view();
+      return plan_node{view, std::move(result)};
+    }
+  }
+}
+
+/**
+ * Returns the columns of an output node, moving them out of their table when nothing else
+ * uses it and copying them otherwise.
+ */
+std::vector<std::unique_ptr<cudf::column>> take_output(plan_node &node) {
+  if (node.owner && !node.projected && node.owner.use_count() == 1) {
+    auto owner = std::move(node.owner);
+    return owner->release();
+  }
+  return cudf::table(node.view).release();
+}
+
+} // anonymous namespace
+
+} // namespace jni
+} // namespace cudf
+
+extern "C" {
+
+JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_TablePlan_execute(JNIEnv *env, jclass,
+                                                                   jlongArray j_inputs,
+                                                                   jintArray j_program,
+                                                                   jintArray j_outputs) {
+  JNI_NULL_CHECK(env, j_inputs, "inputs are null", NULL);
+  JNI_NULL_CHECK(env, j_program, "program is null", NULL);
+  JNI_NULL_CHECK(env, j_outputs, "outputs are null", NULL);
+  try {
+    cudf::jni::auto_set_device(env);
+    cudf::jni::native_jpointerArray<cudf::table_view> inputs(env, j_inputs);
+    cudf::jni::native_jintArray program(env, j_program);
+    cudf::jni::native_jintArray outputs(env, j_outputs);
+
+    auto const steps = cudf::jni::decode(program, inputs.size());
+    int const num_nodes = inputs.size() + steps.size();
+
+    // The last step reading each node, the outputs being read after all the steps
+    std::vector<int> last_use(num_nodes, -1);
+    for (std::size_t i = 0; i < steps.size(); i++) {
+      for (auto source : steps[i].sources) {
+        last_use[source] = i;
+      }
+    }
+    for (int i = 0; i < outputs.size(); i++) {
+      JNI_ARG_CHECK(env, outputs[i] >= 0 && outputs[i] < num_nodes, "output is not a node", NULL);
+      last_use[outputs[i]] = steps.size();
+    }
+
+    std::vector<cudf::jni::plan_node> nodes;
+    nodes.reserve(num_nodes);
+    for (int i = 0; i < inputs.size(); i++) {
+      nodes.push_back(cudf::jni::plan_node{*inputs[i]});
+    }
+    for (std::size_t i = 0; i < steps.size(); i++) {
+      int const node = nodes.size();
+      nodes.push_back(cudf::jni::run(steps[i], nodes));
+      // Release the temporaries no later step reads, and the results nothing reads at all
+      for (auto source : steps[i].sources) {
+        if (last_use[source] == static_cast<int>(i)) {
+          nodes[source] = cudf::jni::plan_node{};
+        }
+      }
+      if (last_use[node] < 0) {
+        nodes[node] = cudf::jni::plan_node{};
+      }
+    }
+
+    std::vector<std::unique_ptr<cudf::column>> result;
+    for (int i = 0; i < outputs.size(); i++) {
+      auto &node = nodes[outputs[i]];
+      // An output listed twice keeps its table for the second copy
+      bool const listed_again =
+          std::find(outputs.data() + i + 1, outputs.data() + outputs.size(), outputs[i]) !=
+          outputs.data() + outputs.size();
+      auto columns = listed_again ? cudf::table(node.view).release() : cudf::jni::take_output(node);
+      std::move(columns.begin(), columns.end(), std::back_inserter(result));
+    }
+
+    cudf::jni::native_jlongArray handles(env, result.size());
+    for (std::size_t i = 0; i < result.size(); i++) {
+      handles[i] = reinterpret_cast<jlong>(result[i].release());
+    }
+    return handles.get_jArray();
+  }
+  CATCH_STD(env, NULL);
+}
+
+} // extern "C"
@@ -0,0 +1,78 @@
+/*
+ *
+ *  Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+package ai.rapids.cudf;
+
+import org.junit.jupiter.api.Test;
+
+import static ai.rapids.cudf.Table.sum;
+import static ai.rapids.cudf.TableTest.assertTablesAreEqual;
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertThrows;
+
+public class TablePlanTest extends CudfTestBase {
+  @Test
+  void testFilterJoinGroupBy() {
+    try (Table orders = new Table.TestBuilder()
+             .column(   1,    2,     1,    3,    2,    4) // customer
+             .column( 10L,  20L,   30L,  40L,  50L,  60L) // amount
+             .column(true, true, false, true, true, true) // keep
+             .build();
+         Table customers = new Table.TestBuilder()
+             .column(  1,   2,   3) // customer
+             .column(100, 200, 100) // region
+             .build()) {
+      TablePlan plan = new TablePlan();
+      int ordersNode = plan.input(orders);
+      int customersNode = plan.input(customers);
+      int kept = plan.project(plan.filter(ordersNode, 2), 0, 1);
+      int joined = plan.innerJoin(kept, new int[]{0}, customersNode, new int[]{0});
+      int byRegion = plan.groupBy(joined, new int[]{3}, sum(1));
+
+      Table[] results = plan.execute(byRegion, kept);
+      try (Table regions = results[0];
+           Table keptOrders = results[1];
+           Table sortedRegions = regions.orderBy(Table.asc(0));
+           Table expectedRegions = new Table.TestBuilder()
+               .column(100, 200)
+               .column(50L, 70L)
+               .build();
+           Table expectedKept = new Table.TestBuilder()
+               .column(  1,   2,   3,   2,   4)
+               .column(10L, 20L, 40L, 50L, 60L)
+               .build()) {
+        assertEquals(2, results.length);
+        assertTablesAreEqual(expectedRegions, sortedRegions);
+        assertTablesAreEqual(expectedKept, keptOrders);
+      }
+    }
+  }
+
+  @Test
+  void testInvalidNodes() {
+    try (Table t = new Table.TestBuilder().column(1, 2, 3).build()) {
+      TablePlan plan = new TablePlan();
+      int input = plan.input(t);
+      assertThrows(IllegalArgumentException.class, () -> plan.project(input, 1));
+      assertThrows(IllegalArgumentException.class, () -> plan.filter(input + 1, 0));
+      plan.project(input, 0);
+      assertThrows(IllegalStateException.class, () -> plan.input(t));
+      assertThrows(IllegalArgumentException.class, () -> plan.execute(input + 2));
+    }
+  }
+}
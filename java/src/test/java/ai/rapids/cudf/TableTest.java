@@ -1411,6 +1411,33 @@ public class TableTest extends CudfTestBase {
     }
   }
 
+  @Test
+  void testCopyToHostAndBack() {
+    HostColumnVector[] hostColumns = null;
+    try (Table t1 = new Table.TestBuilder()
+        .column(10, 12, 14, null, 18)
+        .column(5.0, 2.0, null, 4.0, 1.0)
+        .column("A", "BB", null, "", "EEE")
+        .build()) {
+      hostColumns = t1.copyToHost();
+      assertEquals(3, hostColumns.length);
+      for (int i = 0; i < hostColumns.length; i++) {
+        try (HostColumnVector expected = t1.getColumn(i).copyToHost()) {
+          assertColumnsAreEqual(expected, hostColumns[i], "column " + i);
+        }
+      }
+      try (Table t2 = Table.copyFromHost(hostColumns)) {
+        assertTablesAreEqual(t1, t2);
+      }
+    } finally {
+      if (hostColumns != null) {
+        for (HostColumnVector column : hostColumns) {
+          column.close();
+        }
+      }
+    }
+  }
+
   @Test
   void testContiguousSplitWithStrings() {
     ContiguousTable[] splits = null;
@@ -13,5 +13,6 @@ cimport cudf._lib.cpp.types as libcudf_types
 cdef extern from "cudf/hashing.hpp" namespace "cudf" nogil:
     cdef unique_ptr[column] hash "cudf::hash" (
         const table_view& input,
+        libcudf_types.hash_id hash_function,
         const vector[uint32_t]& initial_hash
     ) except +
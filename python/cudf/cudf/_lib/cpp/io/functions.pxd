@@ -129,6 +129,12 @@ cdef extern from "cudf/io/functions.hpp" \
     cdef cudf_io_types.table_with_metadata read_parquet(
         read_parquet_args args) except +
 
+    cdef cppclass chunked_parquet_reader:
+        chunked_parquet_reader(read_parquet_args args,
+                               size_t chunk_read_limit) except +
+        bool has_next() except +
+        cudf_io_types.table_with_metadata read_chunk() except +
+
     cdef cppclass write_csv_args:
         cudf_io_types.sink_info snk
         cudf_table_view.table_view table
@@ -164,6 +170,27 @@ cdef extern from "cudf/io/functions.hpp" \
 
     cdef void write_orc(write_orc_args args) except +
 
+    cdef cppclass write_orc_chunked_args:
+        cudf_io_types.sink_info sink
+        cudf_io_types.compression_type compression
+        bool enable_statistics
+        const cudf_io_types.table_metadata_with_nullability *metadata
+
+        write_orc_chunked_args(
+            cudf_io_types.sink_info sink_,
+            cudf_io_types.table_metadata_with_nullability *metadata_,
+            cudf_io_types.compression_type compression_,
+            bool enable_statistics_
+        ) except +
+
+    cdef shared_ptr[orc_chunked_state] \
+        write_orc_chunked_begin(write_orc_chunked_args args) except +
+
+    cdef void write_orc_chunked(cudf_table_view.table_view table_,
+                                shared_ptr[orc_chunked_state]) except +
+
+    cdef void write_orc_chunked_end(shared_ptr[orc_chunked_state]) except +
+
     cdef cppclass write_parquet_args:
         cudf_io_types.sink_info sink
         cudf_io_types.compression_type compression
@@ -215,3 +242,10 @@ cdef extern from "cudf/io/functions.hpp" \
 
     cdef cppclass pq_chunked_state:
         pass
+
+
+cdef extern from "cudf/io/functions.hpp" \
+        namespace "cudf::io::detail::orc" nogil:
+
+    cdef cppclass orc_chunked_state:
+        pass
@@ -1,10 +1,14 @@
 # Copyright (c) 2020, NVIDIA CORPORATION.
 
 from libcpp.memory cimport unique_ptr
+from libcpp.vector cimport vector
 
 from cudf._lib.types import np_to_cudf_types, cudf_to_np_types
 
+from cudf._lib.cpp.libcpp.functional cimport reference_wrapper
 from cudf._lib.cpp.scalar.scalar cimport scalar
+from cudf._lib.cpp.table.table cimport table
+from cudf._lib.cpp.table.table_view cimport table_view
 from cudf._lib.cpp.column.column cimport column
 from cudf._lib.cpp.column.column_view cimport (
     column_view,
@@ -20,6 +24,10 @@ cdef extern from "cudf/replace.hpp" namespace "cudf" nogil:
         column_view source_column,
         scalar replacement) except +
 
+    cdef unique_ptr[table] replace_nulls(
+        table_view source_table,
+        vector[reference_wrapper[scalar]] replacements) except +
+
     cdef unique_ptr[column] find_and_replace_all(
         column_view source_column,
         column_view values_to_replace,
@@ -46,6 +46,12 @@ cdef extern from "cudf/types.hpp" namespace "cudf" nogil:
         EQUAL "cudf::null_equality::EQUAL"
         UNEQUAL "cudf::null_equality::UNEQUAL"
 
+    ctypedef enum hash_id "cudf::hash_id":
+        HASH_MURMUR3 "cudf::hash_id::HASH_MURMUR3"
+        HASH_XXHASH64 "cudf::hash_id::HASH_XXHASH64"
+        HASH_SPARK_MURMUR3 "cudf::hash_id::HASH_SPARK_MURMUR3"
+        HASH_HIVE "cudf::hash_id::HASH_HIVE"
+
     ctypedef enum type_id "cudf::type_id":
         EMPTY "cudf::type_id::EMPTY"
         INT8  "cudf::type_id::INT8"
@@ -2,12 +2,15 @@
 
 from libc.stdint cimport int32_t
 from libcpp.memory cimport unique_ptr
+from libcpp.vector cimport vector
 from cudf._lib.cpp.column.column_view cimport (
     column_view
 )
 from cudf._lib.cpp.column.column cimport (
     column
 )
+from cudf._lib.cpp.table.table cimport table
+from cudf._lib.cpp.table.table_view cimport table_view
 from cudf._lib.cpp.types cimport (
     data_type
 )
@@ -50,5 +53,10 @@ cdef extern from "cudf/unary.hpp" namespace "cudf" nogil:
     cdef extern unique_ptr[column] cast(
         column_view input,
         data_type out_type) except +
+    cdef extern unique_ptr[table] is_null(table_view input) except +
+    cdef extern unique_ptr[table] is_valid(table_view input) except +
+    cdef extern unique_ptr[table] cast(
+        table_view input,
+        vector[data_type] out_types) except +
     cdef extern unique_ptr[column] is_nan(column_view input) except +
     cdef extern unique_ptr[column] is_not_nan(column_view input) except +
@@ -55,8 +55,16 @@ def hash_partition(Table source_table, object columns_to_hash,
     )
 
 
-def hash(Table source_table, object initial_hash_values=None):
+def hash(Table source_table, object initial_hash_values=None,
+         object method="murmur3"):
     cdef vector[uint32_t] c_initial_hash = initial_hash_values or []
+    cdef libcudf_types.hash_id c_hash_function
+    if method == "murmur3":
+        c_hash_function = libcudf_types.hash_id.HASH_MURMUR3
+    elif method == "xxhash64":
+        c_hash_function = libcudf_types.hash_id.HASH_XXHASH64
+    else:
+        raise ValueError(f"Unsupported hash function: {method}")
     cdef table_view c_source_view = source_table.data_view()
 
     cdef unique_ptr[column] c_result
@@ -64,6 +72,7 @@ def hash(Table source_table, object initial_hash_values=None):
         c_result = move(
             cpp_hash(
                 c_source_view,
+                c_hash_function,
                 c_initial_hash
             )
         )
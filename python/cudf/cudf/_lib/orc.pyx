@@ -1,6 +1,7 @@
 # Copyright (c) 2020, NVIDIA CORPORATION.
 
 from libcpp cimport bool, int
+from libcpp.memory cimport shared_ptr, unique_ptr, make_unique
 from libcpp.string cimport string
 from cudf._lib.cpp.column.column cimport column
 
@@ -8,19 +9,27 @@ from cudf._lib.cpp.io.functions cimport (
     read_orc_args,
     write_orc_args,
     read_orc as libcudf_read_orc,
-    write_orc as libcudf_write_orc
+    write_orc as libcudf_write_orc,
+    write_orc_chunked_args,
+    write_orc_chunked_begin,
+    write_orc_chunked,
+    write_orc_chunked_end,
+    orc_chunked_state
 )
 from cudf._lib.cpp.io.types cimport (
     compression_type,
+    data_sink,
     sink_info,
     table_metadata,
+    table_metadata_with_nullability,
     table_with_metadata,
 )
+from cudf._lib.cpp.table.table_view cimport table_view
 from cudf._lib.cpp.types cimport (
     data_type, type_id, size_type
 )
 
-from cudf._lib.io.utils cimport make_source_info
+from cudf._lib.io.utils cimport make_source_info, make_sink_info
 from cudf._lib.move cimport move
 from cudf._lib.table cimport Table
 from cudf._lib.types import np_to_cudf_types
@@ -82,15 +91,7 @@ cpdef write_orc(Table table,
     --------
     cudf.io.orc.read_orc
     """
-    cdef compression_type compression_ = compression_type.NONE
-    if compression is None or compression is False:
-        compression_ = compression_type.NONE
-    elif compression == "snappy":
-        compression_ = compression_type.SNAPPY
-    else:
-        raise ValueError(
-            "Unsupported compression type `{}`".format(compression)
-        )
+    cdef compression_type compression_ = _get_comp_type(compression)
 
     cdef table_metadata metadata_ = table_metadata()
     metadata_.column_names.reserve(len(table._column_names))
@@ -108,6 +109,84 @@ cpdef write_orc(Table table,
         libcudf_write_orc(c_write_orc_args)
 
 
+cdef class ORCWriter:
+    """
+    ORCWriter lets you incrementally write out an ORC file from a series
+    of cudf tables
+
+    See Also
+    --------
+    cudf.io.orc.to_orc
+    """
+    cdef shared_ptr[orc_chunked_state] state
+    cdef sink_info sink
+    cdef unique_ptr[data_sink] _data_sink
+    cdef compression_type comp_type
+    cdef bool enable_statistics
+
+    def __cinit__(self, object path, object compression=None,
+                  object enable_statistics=False):
+        self.sink = make_sink_info(path, &self._data_sink)
+        self.comp_type = _get_comp_type(compression)
+        self.enable_statistics = <bool> (True if enable_statistics else False)
+
+    def write_table(self, Table table):
+        """ Writes a single table to the file """
+        if not self.state:
+            self._initialize_chunked_state(table)
+
+        cdef table_view tv = table.data_view()
+        with nogil:
+            write_orc_chunked(tv, self.state)
+
+    def close(self):
+        if self.state:
+            with nogil:
+                write_orc_chunked_end(self.state)
+                self.state.reset()
+
+    def __dealloc__(self):
+        self.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        self.close()
+
+    def _initialize_chunked_state(self, Table table):
+        """ Wraps write_orc_chunked_begin. This is called lazily on the first
+        call to write, so that we can get metadata from the first table """
+        cdef unique_ptr[table_metadata_with_nullability] tbl_meta
+        tbl_meta = make_unique[table_metadata_with_nullability]()
+        for col_name in table._column_names:
+            tbl_meta.get().column_names.push_back(str.encode(col_name))
+
+        # call write_orc_chunked_begin
+        cdef unique_ptr[write_orc_chunked_args] args
+        with nogil:
+            args.reset(new write_orc_chunked_args(self.sink,
+                                                  tbl_meta.get(),
+                                                  self.comp_type,
+                                                  self.enable_statistics))
+            self.state = write_orc_chunked_begin(args.get()[0])
+
+
+cdef compression_type _get_comp_type(object compression) except *:
+    if compression is None or compression is False:
+        return compression_type.NONE
+    elif compression == "snappy":
+        return compression_type.SNAPPY
+    elif compression == "zstd":
+        return compression_type.ZSTD
+    elif compression == "lz4":
+        return compression_type.LZ4
+    else:
+        raise ValueError(
+            "Unsupported compression type `{}`".format(compression)
+        )
+
+
 cdef size_type get_size_t_arg(arg, name) except*:
     arg = -1 if arg is None else arg
     if not isinstance(arg, int) or arg < -1:
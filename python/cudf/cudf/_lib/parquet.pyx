@@ -32,6 +32,7 @@ from cudf._lib.cpp.io.functions cimport (
     merge_rowgroup_metadata as parquet_merge_metadata,
     read_parquet_args,
     read_parquet as parquet_reader,
+    chunked_parquet_reader,
     write_parquet_chunked_args,
     write_parquet_chunked_begin,
     write_parquet_chunked,
@@ -159,6 +160,69 @@ cpdef read_parquet(filepaths_or_buffers, columns=None, row_groups=None,
     cudf.io.parquet.to_parquet
     """
 
+    cdef read_parquet_args args = _make_read_parquet_args(
+        filepaths_or_buffers, columns, strings_to_categorical,
+        use_pandas_metadata)
+
+    args.skip_rows = skip_rows if skip_rows is not None else 0
+    args.num_rows = num_rows if num_rows is not None else -1
+    if row_groups is not None:
+        args.row_groups = row_groups
+
+    # Read Parquet
+    cdef cudf_io_types.table_with_metadata c_out_table
+
+    with nogil:
+        c_out_table = move(parquet_reader(args))
+
+    return _make_dataframe(c_out_table, use_pandas_metadata)
+
+
+cdef class ParquetChunkedReader:
+    """
+    ParquetChunkedReader iterates over a Parquet dataset as a sequence of
+    DataFrames, each of whose decompressed data is estimated to fit within
+    `chunk_read_limit` bytes
+
+    See Also
+    --------
+    cudf.io.parquet.read_parquet_chunked
+    """
+    cdef unique_ptr[chunked_parquet_reader] c_reader
+    cdef object use_pandas_metadata
+
+    def __cinit__(self, object filepaths_or_buffers, object columns=None,
+                  size_t chunk_read_limit=0,
+                  object strings_to_categorical=False,
+                  object use_pandas_metadata=True):
+        cdef read_parquet_args args = _make_read_parquet_args(
+            filepaths_or_buffers, columns, strings_to_categorical,
+            use_pandas_metadata)
+        self.use_pandas_metadata = use_pandas_metadata
+        with nogil:
+            self.c_reader.reset(new chunked_parquet_reader(args,
+                                                           chunk_read_limit))
+
+    def __iter__(self):
+        return self
+
+    def __next__(self):
+        """ Reads the next chunk of rows """
+        if not self.c_reader.get().has_next():
+            raise StopIteration
+
+        cdef cudf_io_types.table_with_metadata c_out_table
+        with nogil:
+            c_out_table = move(self.c_reader.get().read_chunk())
+
+        return _make_dataframe(c_out_table, self.use_pandas_metadata)
+
+
+cdef read_parquet_args _make_read_parquet_args(
+        object filepaths_or_buffers,
+        object columns,
+        object strings_to_categorical,
+        object use_pandas_metadata) except *:
     cdef cudf_io_types.source_info source = make_source_info(
         filepaths_or_buffers)
 
@@ -171,19 +235,17 @@ cpdef read_parquet(filepaths_or_buffers, columns=None, row_groups=None,
             args.columns.push_back(str(col).encode())
     args.strings_to_categorical = strings_to_categorical
     args.use_pandas_metadata = use_pandas_metadata
-
-    args.skip_rows = skip_rows if skip_rows is not None else 0
-    args.num_rows = num_rows if num_rows is not None else -1
-    if row_groups is not None:
-        args.row_groups = row_groups
     args.timestamp_type = cudf_types.data_type(cudf_types.type_id.EMPTY)
+    return args
 
-    # Read Parquet
-    cdef cudf_io_types.table_with_metadata c_out_table
-
-    with nogil:
-        c_out_table = move(parquet_reader(args))
 
+cdef object _make_dataframe(
+        cudf_io_types.table_with_metadata &c_out_table,
+        object use_pandas_metadata):
+    """
+    Makes a DataFrame of the table of a read, without copying the columns,
+    and restores its index from the pandas metadata
+    """
     column_names = [x.decode() for x in c_out_table.metadata.column_names]
 
     # Access the Parquet user_data json to find the index
@@ -354,6 +416,12 @@ cdef class ParquetWriter:
     def __dealloc__(self):
         self.close()
 
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        self.close()
+
     def _initialize_chunked_state(self, Table table):
         """ Wraps write_parquet_chunked_begin. This is called lazily on the first
         call to write, so that we can get metadata from the first table """
@@ -415,6 +483,10 @@ cdef cudf_io_types.compression_type _get_comp_type(object compression):
         return cudf_io_types.compression_type.NONE
     elif compression == "snappy":
         return cudf_io_types.compression_type.SNAPPY
+    elif compression == "zstd":
+        return cudf_io_types.compression_type.ZSTD
+    elif compression == "lz4":
+        return cudf_io_types.compression_type.LZ4
     else:
         raise ValueError("Unsupported `compression` type")
 
@@ -1,6 +1,7 @@
 # Copyright (c) 2020, NVIDIA CORPORATION.
 
 from libcpp.memory cimport unique_ptr
+from libcpp.vector cimport vector
 
 from cudf.utils.dtypes import is_scalar
 
@@ -8,8 +9,12 @@ from cudf._lib.column cimport Column
 from cudf._lib.scalar import as_scalar
 from cudf._lib.scalar cimport Scalar
 from cudf._lib.move cimport move
+from cudf._lib.table cimport Table
 
+from cudf._lib.cpp.libcpp.functional cimport reference_wrapper
 from cudf._lib.cpp.scalar.scalar cimport scalar
+from cudf._lib.cpp.table.table cimport table
+from cudf._lib.cpp.table.table_view cimport table_view
 from cudf._lib.cpp.column.column cimport column
 from cudf._lib.cpp.column.column_view cimport (
     column_view,
@@ -107,6 +112,36 @@ def replace_nulls(Column input_col, object replacement, object dtype=None):
         return replace_nulls_column(input_col, replacement)
 
 
+def replace_nulls_table(Table input_table, list replacements):
+    """
+    Replaces the null values of each column of input_table with the
+    corresponding scalar of replacements, in a single call
+
+    Parameters
+    ----------
+    input_table : Table whose values will be updated
+    replacements : list of Scalar, one per column of input_table
+    """
+
+    cdef table_view input_table_view = input_table.data_view()
+    cdef vector[reference_wrapper[scalar]] c_replacements
+    c_replacements.reserve(len(replacements))
+    cdef Scalar replacement
+    for replacement in replacements:
+        c_replacements.push_back(
+            reference_wrapper[scalar](replacement.c_value.get()[0])
+        )
+
+    cdef unique_ptr[table] c_result
+    with nogil:
+        c_result = move(cpp_replace_nulls(input_table_view, c_replacements))
+
+    return Table.from_unique_ptr(
+        move(c_result),
+        column_names=input_table._column_names
+    )
+
+
 def clamp(Column input_col, Scalar lo, Scalar lo_replace,
           Scalar hi, Scalar hi_replace):
     """
@@ -4,13 +4,17 @@ from enum import IntEnum
 
 from libcpp cimport bool
 from libcpp.memory cimport unique_ptr
+from libcpp.vector cimport vector
 import numpy as np
 
 from cudf._lib.column cimport Column
+from cudf._lib.table cimport Table
 from cudf._lib.cpp.column.column cimport column
 from cudf._lib.cpp.column.column_view cimport (
     column_view, mutable_column_view
 )
+from cudf._lib.cpp.table.table cimport table
+from cudf._lib.cpp.table.table_view cimport table_view
 from cudf._lib.types import np_to_cudf_types
 from cudf._lib.cpp.types cimport (
     size_type,
@@ -108,6 +112,68 @@ def cast(Column input, object dtype=np.float64):
     return Column.from_unique_ptr(move(c_result))
 
 
+def table_is_null(Table input):
+    """
+    Returns a table of boolean columns, true where the element of the
+    corresponding column of `input` is null, computed in a single pass
+    """
+    cdef table_view c_input = input.data_view()
+    cdef unique_ptr[table] c_result
+
+    with nogil:
+        c_result = move(libcudf_unary.is_null(c_input))
+
+    return Table.from_unique_ptr(
+        move(c_result),
+        column_names=input._column_names
+    )
+
+
+def table_is_valid(Table input):
+    """
+    Returns a table of boolean columns, true where the element of the
+    corresponding column of `input` is valid, computed in a single pass
+    """
+    cdef table_view c_input = input.data_view()
+    cdef unique_ptr[table] c_result
+
+    with nogil:
+        c_result = move(libcudf_unary.is_valid(c_input))
+
+    return Table.from_unique_ptr(
+        move(c_result),
+        column_names=input._column_names
+    )
+
+
+def table_cast(Table input, list dtypes):
+    """
+    Casts each column of `input` to the corresponding dtype of `dtypes`
+    """
+    cdef table_view c_input = input.data_view()
+    cdef vector[data_type] c_dtypes
+    c_dtypes.reserve(len(dtypes))
+    for dtype in dtypes:
+        c_dtypes.push_back(
+            data_type(
+                <type_id> (
+                    <underlying_type_t_type_id> (
+                        np_to_cudf_types[np.dtype(dtype)]
+                    )
+                )
+            )
+        )
+    cdef unique_ptr[table] c_result
+
+    with nogil:
+        c_result = move(libcudf_unary.cast(c_input, c_dtypes))
+
+    return Table.from_unique_ptr(
+        move(c_result),
+        column_names=input._column_names
+    )
+
+
 def is_nan(Column input):
     cdef column_view c_input = input.view()
     cdef unique_ptr[column] c_result
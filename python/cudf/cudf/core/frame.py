@@ -1416,7 +1416,7 @@ class Frame(libcudf.table.Table):
     def isnull(self):
         """Identify missing values.
         """
-        data_columns = (col.isnull() for col in self._columns)
+        data_columns = libcudf.unary.table_is_null(self)._columns
         data = zip(self._column_names, data_columns)
         return self.__class__._from_table(Frame(data, self._index))
 
@@ -1428,7 +1428,7 @@ class Frame(libcudf.table.Table):
     def notnull(self):
         """Identify non-missing values.
         """
-        data_columns = (col.notnull() for col in self._columns)
+        data_columns = libcudf.unary.table_is_valid(self)._columns
         data = zip(self._column_names, data_columns)
         return self.__class__._from_table(Frame(data, self._index))
 
@@ -9,6 +9,7 @@ from cudf.io.orc import read_orc, read_orc_metadata, to_orc
 from cudf.io.parquet import (
     merge_parquet_filemetadata,
     read_parquet,
+    read_parquet_chunked,
     read_parquet_metadata,
     write_to_dataset,
 )
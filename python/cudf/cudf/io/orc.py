@@ -81,3 +81,6 @@ def to_orc(df, fname, compression=None, enable_statistics=False):
     """{docstring}"""
 
     libcudf.orc.write_orc(df, fname, compression, enable_statistics)
+
+
+ORCWriter = libcudf.orc.ORCWriter
@@ -217,6 +217,71 @@ def read_parquet(
         )
 
 
+def read_parquet_chunked(
+    filepath_or_buffer,
+    chunk_read_limit,
+    columns=None,
+    strings_to_categorical=False,
+    use_pandas_metadata=True,
+    **kwargs,
+):
+    """Reads a Parquet dataset as a sequence of DataFrames, so that datasets
+    larger than device memory can be processed a piece at a time.
+
+    Parameters
+    ----------
+    filepath_or_buffer : str, path object, bytes, file-like object, or a list
+        of such objects
+        Same as `read_parquet`.
+    chunk_read_limit : int
+        Limit in bytes on the decompressed data of each DataFrame, as
+        estimated from the column chunk sizes recorded in the file footers.
+        0 reads the whole dataset as a single DataFrame.
+    columns : list, default None
+        If not None, only these columns will be read.
+    strings_to_categorical : boolean, default False
+        Same as `read_parquet`.
+    use_pandas_metadata : boolean, default True
+        Same as `read_parquet`.
+
+    Returns
+    -------
+    Iterator of DataFrame, over consecutive ranges of rows
+
+    Examples
+    --------
+    >>> import cudf
+    >>> for df in cudf.io.read_parquet_chunked("dataset.parquet", 1 << 30):
+    ...     process(df)
+
+    See Also
+    --------
+    cudf.io.parquet.read_parquet
+    """
+
+    if not is_list_like(filepath_or_buffer):
+        filepath_or_buffer = [filepath_or_buffer]
+
+    filepaths_or_buffers = []
+    for source in filepath_or_buffer:
+        tmp_source, compression = ioutils.get_filepath_or_buffer(
+            source, None, **kwargs
+        )
+        if compression is not None:
+            raise ValueError(
+                "URL content-encoding decompression is not supported"
+            )
+        filepaths_or_buffers.append(tmp_source)
+
+    return libparquet.ParquetChunkedReader(
+        filepaths_or_buffers,
+        columns=columns,
+        chunk_read_limit=chunk_read_limit,
+        strings_to_categorical=strings_to_categorical,
+        use_pandas_metadata=use_pandas_metadata,
+    )
+
+
 @ioutils.doc_to_parquet()
 def to_parquet(
     df,
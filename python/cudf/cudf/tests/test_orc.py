@@ -10,6 +10,7 @@ import pyarrow.orc
 import pytest
 
 import cudf
+from cudf.io.orc import ORCWriter
 from cudf.tests.utils import assert_eq
 
 
@@ -319,3 +320,19 @@ def test_orc_writer_strings(tmpdir, dtypes):
     got = pa.orc.ORCFile(gdf_fname).read().to_pandas()
 
     assert_eq(expect, got)
+
+
+def test_orc_writer_chunked(tmpdir):
+    gdf_fname = tmpdir.join("gdf_chunked.orc")
+
+    gdf = cudf.datasets.randomdata(
+        nrows=100, dtypes={"a": int, "b": str, "c": float}, seed=1
+    )
+    with ORCWriter(gdf_fname.strpath) as writer:
+        writer.write_table(gdf)
+        writer.write_table(gdf)
+
+    expect = cudf.concat([gdf, gdf]).reset_index(drop=True)
+    got = pa.orc.ORCFile(gdf_fname).read().to_pandas()
+
+    assert_eq(expect, got)
@@ -419,6 +419,34 @@ def test_parquet_reader_mixedcompression(datadir):
     assert_eq(expect, got)
 
 
+def test_parquet_reader_delta_encodings(datadir):
+    # INT64 column in DELTA_BINARY_PACKED, and nullable string columns in
+    # DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY, spanning several 128-value
+    # blocks with a partial last block and miniblock bit widths up to 42
+    fname = datadir / "delta_encoding.parquet"
+
+    ints = [
+        (i * 7919) % 10007 - 5000 + ((1 << 40) if i == 150 else 0)
+        for i in range(300)
+    ]
+    strs = [
+        None
+        if i % 5 == 3
+        else ("" if i % 7 == 0 else ("s%d" % i) * (i % 4 + 1))
+        for i in range(300)
+    ]
+    keys = [
+        None
+        if i % 6 == 5
+        else ("" if i % 50 == 0 else "key_%04d_%s" % (i // 10, "x" * (i % 3)))
+        for i in range(300)
+    ]
+    expect = pd.DataFrame({"ints": ints, "strs": strs, "keys": keys})
+    got = cudf.read_parquet(fname)
+
+    assert_eq(expect, got)
+
+
 def test_parquet_reader_invalids(tmpdir):
     test_pdf = make_pdf(nrows=1000, nvalids=1000 // 4, dtype=np.int64)
 
@@ -709,6 +737,23 @@ def test_parquet_writer_bytes_io(simple_gdf):
     assert_eq(cudf.read_parquet(output), cudf.concat([simple_gdf, simple_gdf]))
 
 
+def test_parquet_reader_chunked(tmpdir):
+    fname = tmpdir.join("chunked.parquet")
+    gdf = cudf.DataFrame({"a": np.arange(10000), "b": np.arange(10000) * 0.5})
+
+    # Each table is written as its own row group
+    with ParquetWriter(fname.strpath, index=False) as writer:
+        for _ in range(4):
+            writer.write_table(gdf)
+
+    chunks = list(cudf.io.read_parquet_chunked(fname.strpath, 200000))
+    assert len(chunks) > 1
+
+    expect = cudf.concat([gdf] * 4).reset_index(drop=True)
+    got = cudf.concat(chunks).reset_index(drop=True)
+    assert_eq(expect, got)
+
+
 @pytest.mark.parametrize("cols", [["b"], ["c", "b"]])
 def test_parquet_write_partitioned(tmpdir_factory, cols):
     # Checks that write_to_dataset is wrapping to_parquet